@@ -0,0 +1,24 @@
+/**********************************************************************************************
+*
+*   raylib microbenchmarks - Kernels shared definitions
+*
+*   Kernels run a number of iterations and return an accumulated value, so compiler can not
+*   discard the work done. raymath kernels are compiled once per implementation variant
+*   (microbench_raymath.c, with and without RAYMATH_SIMD).
+*
+**********************************************************************************************/
+
+#ifndef MICROBENCH_H
+#define MICROBENCH_H
+
+typedef struct MicroKernel {
+    const char *name;               // Kernel name (function measured)
+    const char *variant;            // Implementation variant (scalar, sse, neon...)
+    float (*Run)(int iterations);   // Run kernel iterations, returns accumulated result
+} MicroKernel;
+
+// raymath kernels by variant, returns kernels array (count returned by parameter)
+const MicroKernel *GetRaymathKernelsScalar(int *count);
+const MicroKernel *GetRaymathKernelsSimd(int *count);
+
+#endif // MICROBENCH_H
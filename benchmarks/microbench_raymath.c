@@ -0,0 +1,99 @@
+/**********************************************************************************************
+*
+*   raylib microbenchmarks - raymath kernels
+*
+*   This file is compiled twice: with RAYMATH_SIMD defined (SIMD variant) and without it
+*   (scalar variant). raymath is used in header only mode, so the library raymath build
+*   does not change the functions measured.
+*
+**********************************************************************************************/
+
+#define RAYMATH_HEADER_ONLY
+#include "raymath.h"
+
+#include "microbench.h"
+
+#if defined(RAYMATH_SIMD_SSE)
+    #define RAYMATH_VARIANT     "sse"
+#elif defined(RAYMATH_SIMD_NEON)
+    #define RAYMATH_VARIANT     "neon"
+#else
+    #define RAYMATH_VARIANT     "scalar"
+#endif
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition
+//----------------------------------------------------------------------------------
+// NOTE: Rotations are chained so values stay bounded (no inf/denormal slowdowns)
+static float RunMatrixMultiply(int iterations)
+{
+    Matrix mat = MatrixIdentity();
+    Matrix rotation = MatrixRotate((Vector3){ 0.267f, 0.534f, 0.801f }, 0.01f);
+
+    for (int i = 0; i < iterations; i++) mat = MatrixMultiply(mat, rotation);
+
+    return mat.m0 + mat.m5 + mat.m10;
+}
+
+static float RunMatrixInvert(int iterations)
+{
+    Matrix mat = MatrixMultiply(MatrixRotate((Vector3){ 0.267f, 0.534f, 0.801f }, 0.5f), MatrixTranslate(1.0f, 2.0f, 3.0f));
+
+    for (int i = 0; i < iterations; i++) mat = MatrixInvert(mat);
+
+    return mat.m0 + mat.m12;
+}
+
+static float RunVector3Transform(int iterations)
+{
+    Vector3 v = { 1.0f, 2.0f, 3.0f };
+    Matrix rotation = MatrixRotate((Vector3){ 0.267f, 0.534f, 0.801f }, 0.01f);
+
+    for (int i = 0; i < iterations; i++) v = Vector3Transform(v, rotation);
+
+    return v.x + v.y + v.z;
+}
+
+static float RunQuaternionMultiply(int iterations)
+{
+    Quaternion q = QuaternionIdentity();
+    Quaternion rotation = QuaternionFromAxisAngle((Vector3){ 0.267f, 0.534f, 0.801f }, 0.01f);
+
+    for (int i = 0; i < iterations; i++) q = QuaternionMultiply(q, rotation);
+
+    return q.x + q.w;
+}
+
+static float RunQuaternionSlerp(int iterations)
+{
+    Quaternion q1 = QuaternionFromAxisAngle((Vector3){ 0.0f, 1.0f, 0.0f }, 0.3f);
+    Quaternion q2 = QuaternionFromAxisAngle((Vector3){ 1.0f, 0.0f, 0.0f }, 1.2f);
+    float sum = 0.0f;
+
+    for (int i = 0; i < iterations; i++)
+    {
+        Quaternion q = QuaternionSlerp(q1, q2, (float)(i & 1023)/1023.0f);
+        sum += q.x;
+        q1.w += q.w*1e-7f;      // Loop carried dependency, avoid computation hoisting
+    }
+
+    return sum;
+}
+
+static const MicroKernel kernels[] = {
+    { "MatrixMultiply", RAYMATH_VARIANT, RunMatrixMultiply },
+    { "MatrixInvert", RAYMATH_VARIANT, RunMatrixInvert },
+    { "Vector3Transform", RAYMATH_VARIANT, RunVector3Transform },
+    { "QuaternionMultiply", RAYMATH_VARIANT, RunQuaternionMultiply },
+    { "QuaternionSlerp", RAYMATH_VARIANT, RunQuaternionSlerp },
+};
+
+#if defined(RAYMATH_SIMD)
+const MicroKernel *GetRaymathKernelsSimd(int *count)
+#else
+const MicroKernel *GetRaymathKernelsScalar(int *count)
+#endif
+{
+    *count = sizeof(kernels)/sizeof(kernels[0]);
+    return kernels;
+}
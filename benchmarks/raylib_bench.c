@@ -0,0 +1,570 @@
+/*******************************************************************************************
+*
+*   raylib benchmark suite - Scripted, fixed-duration performance scenarios
+*
+*   Every scenario runs for a fixed wall-clock duration with a fixed random seed and no
+*   frame rate limit, so results are reproducible between runs and between raylib versions.
+*   Results are written as JSON: operations per second and frame time percentiles.
+*
+*   Usage: raylib_bench [--duration <seconds>] [--scenario <name>] [--output <file.json>]
+*
+*   Scenarios that need external resources (animation) are reported as skipped if the
+*   resources path (BENCH_RESOURCES_PATH) can not be found.
+*
+*   NOTE: Window is created hidden (FLAG_WINDOW_HIDDEN), use PLATFORM=Headless to run
+*   without any display at all. Drawing scenarios measure CPU work submitted per frame.
+*
+*   This benchmark has been created using raylib 2.5 (www.raylib.com)
+*   raylib is licensed under an unmodified zlib/libpng license (View raylib.h for details)
+*
+********************************************************************************************/
+
+#include "raylib.h"
+#include "raymath.h"
+
+#define PHYSAC_IMPLEMENTATION
+#define PHYSAC_NO_THREADS
+#include "physac.h"
+
+#include <stdio.h>              // Required for: FILE, fopen(), fprintf(), fclose()
+#include <stdlib.h>             // Required for: malloc(), realloc(), free(), qsort(), atof()
+#include <string.h>             // Required for: strcmp()
+
+#ifndef BENCH_RESOURCES_PATH
+    #define BENCH_RESOURCES_PATH    "../examples/"
+#endif
+#ifndef BENCH_RAYLIB_VERSION
+    #define BENCH_RAYLIB_VERSION    "unknown"
+#endif
+
+#define BENCH_SCREEN_WIDTH      1280
+#define BENCH_SCREEN_HEIGHT      720
+#define BENCH_RANDOM_SEED       1337
+#define BENCH_MAX_FRAMES      500000    // Frame times stored per scenario
+
+#define MAX_BUNNIES            50000
+#define MAX_SHAPES              2000
+#define MODEL_MESHES              64
+#define MODEL_INSTANCES           16
+#define PHYSICS_BODIES           200
+#define AUDIO_VOICES              32
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+typedef struct BenchScenario {
+    const char *name;
+    bool (*Init)(void);             // Load scenario data, returns false to skip scenario
+    int (*Run)(void);               // Run one frame/iteration, returns operations done
+    void (*Close)(void);            // Unload scenario data
+    void (*Report)(FILE *file);     // Write extra JSON fields (optional)
+} BenchScenario;
+
+typedef struct Bunny {
+    Vector2 position;
+    Vector2 speed;
+    Color color;
+} Bunny;
+
+//----------------------------------------------------------------------------------
+// Global Variables Definition
+//----------------------------------------------------------------------------------
+static Bunny *bunnies = NULL;
+static Texture2D texBunny = { 0 };
+
+static Font font = { 0 };
+
+static Model model = { 0 };
+static Camera camera = { 0 };
+
+static Model animModel = { 0 };
+static ModelAnimation *anims = NULL;
+static int animsCount = 0;
+static int animFrame = 0;
+
+static Image imgSource = { 0 };
+static Image imgTarget = { 0 };
+
+static Sound sound = { 0 };
+static AudioStats audioStats = { 0 };
+static int audioFrame = 0;
+
+//----------------------------------------------------------------------------------
+// Scenario: Sprites batching (bunnymark)
+//----------------------------------------------------------------------------------
+static bool InitBunnies(void)
+{
+    Image image = GenImageGradientRadial(32, 32, 0.0f, WHITE, BLANK);
+    texBunny = LoadTextureFromImage(image);
+    UnloadImage(image);
+
+    bunnies = (Bunny *)malloc(MAX_BUNNIES*sizeof(Bunny));
+
+    for (int i = 0; i < MAX_BUNNIES; i++)
+    {
+        bunnies[i].position = (Vector2){ (float)GetRandomValue(0, BENCH_SCREEN_WIDTH - 32), (float)GetRandomValue(0, BENCH_SCREEN_HEIGHT - 32) };
+        bunnies[i].speed = (Vector2){ (float)GetRandomValue(-250, 250)/60.0f, (float)GetRandomValue(-250, 250)/60.0f };
+        bunnies[i].color = (Color){ GetRandomValue(50, 240), GetRandomValue(80, 240), GetRandomValue(100, 240), 255 };
+    }
+
+    return true;
+}
+
+static int RunBunnies(void)
+{
+    for (int i = 0; i < MAX_BUNNIES; i++)
+    {
+        bunnies[i].position.x += bunnies[i].speed.x;
+        bunnies[i].position.y += bunnies[i].speed.y;
+
+        if ((bunnies[i].position.x > (BENCH_SCREEN_WIDTH - 32)) || (bunnies[i].position.x < 0)) bunnies[i].speed.x *= -1;
+        if ((bunnies[i].position.y > (BENCH_SCREEN_HEIGHT - 32)) || (bunnies[i].position.y < 0)) bunnies[i].speed.y *= -1;
+    }
+
+    BeginDrawing();
+        ClearBackground(RAYWHITE);
+        for (int i = 0; i < MAX_BUNNIES; i++) DrawTexture(texBunny, (int)bunnies[i].position.x, (int)bunnies[i].position.y, bunnies[i].color);
+    EndDrawing();
+
+    return MAX_BUNNIES;
+}
+
+static void CloseBunnies(void)
+{
+    UnloadTexture(texBunny);
+    free(bunnies);
+    bunnies = NULL;
+}
+
+//----------------------------------------------------------------------------------
+// Scenario: Text drawing with large fonts
+//----------------------------------------------------------------------------------
+static const char *benchText = "The quick brown fox jumps over the lazy dog 0123456789";
+
+static bool InitText(void)
+{
+    font = GetFontDefault();
+    return true;
+}
+
+static int RunText(void)
+{
+    int characters = 0;
+
+    BeginDrawing();
+        ClearBackground(RAYWHITE);
+        for (int i = 0; i < 40; i++)
+        {
+            DrawTextEx(font, benchText, (Vector2){ -(float)(i%8)*40.0f, (float)(i*18) }, 64.0f, 4.0f, DARKGRAY);
+            characters += (int)strlen(benchText);
+        }
+    EndDrawing();
+
+    return characters;
+}
+
+//----------------------------------------------------------------------------------
+// Scenario: Shapes drawing
+//----------------------------------------------------------------------------------
+static int RunShapes(void)
+{
+    BeginDrawing();
+        ClearBackground(RAYWHITE);
+        for (int i = 0; i < MAX_SHAPES; i++)
+        {
+            float x = (float)((i*37)%BENCH_SCREEN_WIDTH);
+            float y = (float)((i*91)%BENCH_SCREEN_HEIGHT);
+
+            switch (i%4)
+            {
+                case 0: DrawCircleV((Vector2){ x, y }, 12.0f, RED); break;
+                case 1: DrawRectangleRec((Rectangle){ x, y, 24.0f, 16.0f }, BLUE); break;
+                case 2: DrawPoly((Vector2){ x, y }, 6, 14.0f, (float)i, GREEN); break;
+                case 3: DrawLineEx((Vector2){ x, y }, (Vector2){ x + 40.0f, y + 20.0f }, 3.0f, MAROON); break;
+                default: break;
+            }
+        }
+    EndDrawing();
+
+    return MAX_SHAPES;
+}
+
+//----------------------------------------------------------------------------------
+// Scenario: Models drawing (many meshes per model)
+//----------------------------------------------------------------------------------
+static bool InitModels(void)
+{
+    model = LoadModelFromMesh(GenMeshCube(1.0f, 1.0f, 1.0f));
+
+    // Grow model meshes array, model arrays are allocated with malloc() by default (RL_MALLOC)
+    model.meshes = (Mesh *)realloc(model.meshes, MODEL_MESHES*sizeof(Mesh));
+    model.meshMaterial = (int *)realloc(model.meshMaterial, MODEL_MESHES*sizeof(int));
+
+    for (int i = 1; i < MODEL_MESHES; i++)
+    {
+        float size = 0.25f + 0.75f*(float)i/MODEL_MESHES;
+        model.meshes[i] = (i%2 == 0)? GenMeshCube(size, size, size) : GenMeshSphere(size*0.5f, 8, 8);
+        model.meshMaterial[i] = 0;
+    }
+
+    model.meshCount = MODEL_MESHES;
+
+    camera.position = (Vector3){ 12.0f, 12.0f, 12.0f };
+    camera.target = (Vector3){ 0.0f, 0.0f, 0.0f };
+    camera.up = (Vector3){ 0.0f, 1.0f, 0.0f };
+    camera.fovy = 45.0f;
+    camera.type = CAMERA_PERSPECTIVE;
+
+    return true;
+}
+
+static int RunModels(void)
+{
+    BeginDrawing();
+        ClearBackground(RAYWHITE);
+        BeginMode3D(camera);
+            for (int i = 0; i < MODEL_INSTANCES; i++)
+            {
+                DrawModel(model, (Vector3){ (float)(i%4)*3.0f - 4.5f, 0.0f, (float)(i/4)*3.0f - 4.5f }, 1.0f, GRAY);
+            }
+        EndMode3D();
+    EndDrawing();
+
+    return MODEL_INSTANCES*MODEL_MESHES;
+}
+
+static void CloseModels(void)
+{
+    UnloadModel(model);
+}
+
+//----------------------------------------------------------------------------------
+// Scenario: Model animation update (CPU skinning)
+//----------------------------------------------------------------------------------
+static bool InitAnimation(void)
+{
+    if (!FileExists(BENCH_RESOURCES_PATH "models/resources/guy/guy.iqm") ||
+        !FileExists(BENCH_RESOURCES_PATH "models/resources/guy/guyanim.iqm")) return false;
+
+    animModel = LoadModel(BENCH_RESOURCES_PATH "models/resources/guy/guy.iqm");
+    anims = LoadModelAnimations(BENCH_RESOURCES_PATH "models/resources/guy/guyanim.iqm", &animsCount);
+
+    if ((anims == NULL) || (animsCount <= 0))
+    {
+        UnloadModel(animModel);
+        return false;
+    }
+
+    animFrame = 0;
+
+    return true;
+}
+
+static int RunAnimation(void)
+{
+    UpdateModelAnimation(animModel, anims[0], animFrame);
+    animFrame = (animFrame + 1)%anims[0].frameCount;
+
+    return 1;
+}
+
+static void CloseAnimation(void)
+{
+    for (int i = 0; i < animsCount; i++) UnloadModelAnimation(anims[i]);
+    free(anims);
+    anims = NULL;
+
+    UnloadModel(animModel);
+}
+
+//----------------------------------------------------------------------------------
+// Scenario: Image processing (resize, draw, format)
+//----------------------------------------------------------------------------------
+static bool InitImages(void)
+{
+    imgSource = GenImageChecked(512, 512, 32, 32, ORANGE, DARKBLUE);
+    imgTarget = GenImageGradientRadial(512, 512, 0.2f, SKYBLUE, BLANK);
+
+    return true;
+}
+
+static int RunImageResize(void)
+{
+    Image image = ImageCopy(imgSource);
+    ImageResize(&image, 384, 384);
+    UnloadImage(image);
+
+    return 1;
+}
+
+static int RunImageDraw(void)
+{
+    for (int i = 0; i < 16; i++)
+    {
+        ImageDraw(&imgTarget, imgSource, (Rectangle){ 0, 0, 256, 256 }, (Rectangle){ (float)(i%4)*64.0f, (float)(i/4)*64.0f, 256, 256 }, (Color){ 255, 255, 255, 128 });
+    }
+
+    return 16;
+}
+
+static int RunImageFormat(void)
+{
+    Image image = ImageCopy(imgSource);
+    ImageFormat(&image, UNCOMPRESSED_R5G6B5);
+    ImageFormat(&image, UNCOMPRESSED_R32G32B32A32);
+    ImageFormat(&image, UNCOMPRESSED_R8G8B8A8);
+    UnloadImage(image);
+
+    return 3;
+}
+
+static void CloseImages(void)
+{
+    UnloadImage(imgSource);
+    UnloadImage(imgTarget);
+}
+
+//----------------------------------------------------------------------------------
+// Scenario: Audio mixing (null audio backend, no output device required)
+//----------------------------------------------------------------------------------
+#if !defined(BENCH_NO_AUDIO)
+static bool InitAudio(void)
+{
+    AudioDeviceConfig config = { 0 };
+    config.sampleRate = 44100;
+    config.backend = AUDIO_BACKEND_NULL;
+
+    InitAudioDeviceEx(config);
+    if (!IsAudioDeviceReady()) return false;
+
+    // Generate a 1 second 16 bit mono sine wave
+    Wave wave = { 0 };
+    wave.sampleCount = 44100;
+    wave.sampleRate = 44100;
+    wave.sampleSize = 16;
+    wave.channels = 1;
+    wave.data = malloc(wave.sampleCount*sizeof(short));
+
+    for (unsigned int i = 0; i < wave.sampleCount; i++) ((short *)wave.data)[i] = (short)(sinf(2.0f*PI*440.0f*(float)i/44100.0f)*16000.0f);
+
+    sound = LoadSoundFromWave(wave);
+    free(wave.data);
+
+    SetAudioVoicesLimit(AUDIO_VOICES);
+    audioFrame = 0;
+
+    GetAudioStats();    // Reset statistics
+
+    return true;
+}
+
+static int RunAudio(void)
+{
+    // Keep mixer busy: trigger a new voice every 8 frames, ended voices are released
+    if ((audioFrame%8) == 0) PlaySoundVoice(sound, 0.5f, (float)(audioFrame%AUDIO_VOICES));
+    audioFrame++;
+
+    UpdateAudioVoices();
+
+    return 1;
+}
+
+static void CloseAudio(void)
+{
+    audioStats = GetAudioStats();
+
+    UnloadSound(sound);
+    CloseAudioDevice();
+}
+
+static void ReportAudio(FILE *file)
+{
+    fprintf(file, ",\n      \"mix_callbacks\": %i", audioStats.callbackCount);
+    fprintf(file, ",\n      \"mix_ms\": { \"min\": %.4f, \"avg\": %.4f, \"max\": %.4f, \"budget\": %.4f }",
+            audioStats.callbackTimeMin, audioStats.callbackTimeAvg, audioStats.callbackTimeMax, audioStats.callbackPeriod);
+    fprintf(file, ",\n      \"voices_mixed\": %i", audioStats.voicesMixed);
+}
+#else
+static bool InitAudio(void) { return false; }    // raylib built without audio module (USE_AUDIO=OFF)
+static int RunAudio(void) { return 0; }
+#define CloseAudio NULL
+#define ReportAudio NULL
+#endif
+
+//----------------------------------------------------------------------------------
+// Scenario: Physics stepping (physac, fixed time step)
+//----------------------------------------------------------------------------------
+static bool InitPhysicsBench(void)
+{
+    InitPhysics();
+
+    PhysicsBody floor = CreatePhysicsBodyRectangle((Vector2){ BENCH_SCREEN_WIDTH/2, BENCH_SCREEN_HEIGHT }, BENCH_SCREEN_WIDTH, 100, 10);
+    floor->enabled = false;
+
+    for (int i = 0; i < PHYSICS_BODIES; i++)
+    {
+        Vector2 position = { (float)GetRandomValue(100, BENCH_SCREEN_WIDTH - 100), (float)GetRandomValue(-2000, BENCH_SCREEN_HEIGHT/2) };
+
+        if (i%2 == 0) CreatePhysicsBodyCircle(position, (float)GetRandomValue(8, 20), 10);
+        else CreatePhysicsBodyPolygon(position, (float)GetRandomValue(10, 24), GetRandomValue(3, 8), 10);
+    }
+
+    return true;
+}
+
+static int RunPhysicsBench(void)
+{
+    // NOTE: Stepping directly instead of RunPhysicsStep(), it depends on elapsed time
+    PhysicsStep();
+
+    return 1;
+}
+
+static void ClosePhysicsBench(void)
+{
+    ClosePhysics();
+}
+
+//----------------------------------------------------------------------------------
+// Benchmark runner
+//----------------------------------------------------------------------------------
+static const BenchScenario scenarios[] = {
+    { "sprites_bunnymark", InitBunnies, RunBunnies, CloseBunnies, NULL },
+    { "text_large_font", InitText, RunText, NULL, NULL },
+    { "shapes", NULL, RunShapes, NULL, NULL },
+    { "models_many_meshes", InitModels, RunModels, CloseModels, NULL },
+    { "model_animation", InitAnimation, RunAnimation, CloseAnimation, NULL },
+    { "image_resize", InitImages, RunImageResize, CloseImages, NULL },
+    { "image_draw", InitImages, RunImageDraw, CloseImages, NULL },
+    { "image_format", InitImages, RunImageFormat, CloseImages, NULL },
+    { "audio_mixing", InitAudio, RunAudio, CloseAudio, ReportAudio },
+    { "physics_step", InitPhysicsBench, RunPhysicsBench, ClosePhysicsBench, NULL },
+};
+
+static int CompareDouble(const void *a, const void *b)
+{
+    double da = *(const double *)a;
+    double db = *(const double *)b;
+
+    return (da > db) - (da < db);
+}
+
+// Get percentile from sorted frame times (nearest rank)
+static double GetPercentile(const double *sorted, int count, float percentile)
+{
+    int index = (int)(percentile*(count - 1) + 0.5f);
+    return sorted[index];
+}
+
+static void RunScenario(const BenchScenario *scenario, double duration, double *frameTimes, FILE *file, bool first)
+{
+    SetRandomSeed(BENCH_RANDOM_SEED);
+
+    fprintf(file, "%s    {\n      \"name\": \"%s\"", first? "" : ",\n", scenario->name);
+
+    if ((scenario->Init != NULL) && !scenario->Init())
+    {
+        TraceLog(LOG_WARNING, "BENCH: [%s] Scenario skipped, resources or module not available", scenario->name);
+        fprintf(file, ",\n      \"skipped\": true\n    }");
+        return;
+    }
+
+    int frames = 0;
+    long long ops = 0;
+    double start = GetTime();
+    double current = start;
+
+    // NOTE: At least one frame is always measured
+    do
+    {
+        double frameStart = current;
+        ops += scenario->Run();
+        current = GetTime();
+
+        frameTimes[frames++] = (current - frameStart)*1000.0;
+    } while (((current - start) < duration) && (frames < BENCH_MAX_FRAMES));
+
+    double elapsed = current - start;
+
+    if (scenario->Close != NULL) scenario->Close();
+
+    qsort(frameTimes, frames, sizeof(double), CompareDouble);
+
+    double total = 0.0;
+    for (int i = 0; i < frames; i++) total += frameTimes[i];
+
+    fprintf(file, ",\n      \"frames\": %i,\n      \"seconds\": %.4f,\n      \"ops\": %lld,\n      \"ops_per_sec\": %.2f", frames, elapsed, ops, (double)ops/elapsed);
+    fprintf(file, ",\n      \"frame_ms\": { \"mean\": %.4f, \"p50\": %.4f, \"p90\": %.4f, \"p99\": %.4f, \"max\": %.4f }",
+            total/frames, GetPercentile(frameTimes, frames, 0.5f), GetPercentile(frameTimes, frames, 0.9f),
+            GetPercentile(frameTimes, frames, 0.99f), frameTimes[frames - 1]);
+
+    if (scenario->Report != NULL) scenario->Report(file);
+
+    fprintf(file, "\n    }");
+
+    TraceLog(LOG_INFO, "BENCH: [%s] %i frames, %.2f ops/s, p50 %.3f ms", scenario->name, frames, (double)ops/elapsed, GetPercentile(frameTimes, frames, 0.5f));
+}
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+    double duration = 5.0;
+    const char *scenarioName = NULL;
+    const char *outputFile = NULL;
+
+    for (int i = 1; i < argc; i++)
+    {
+        if ((strcmp(argv[i], "--duration") == 0) && (i + 1 < argc)) duration = atof(argv[++i]);
+        else if ((strcmp(argv[i], "--scenario") == 0) && (i + 1 < argc)) scenarioName = argv[++i];
+        else if ((strcmp(argv[i], "--output") == 0) && (i + 1 < argc)) outputFile = argv[++i];
+        else
+        {
+            printf("Usage: %s [--duration <seconds>] [--scenario <name>] [--output <file.json>]\nScenarios:", argv[0]);
+            for (int s = 0; s < (int)(sizeof(scenarios)/sizeof(scenarios[0])); s++) printf(" %s", scenarios[s].name);
+            printf("\n");
+            return 1;
+        }
+    }
+
+    // Initialization
+    //--------------------------------------------------------------------------------------
+    SetConfigFlags(FLAG_WINDOW_HIDDEN);
+    InitWindow(BENCH_SCREEN_WIDTH, BENCH_SCREEN_HEIGHT, "raylib benchmark");
+    SetTargetFPS(0);    // No frame rate limit
+
+    FILE *file = (outputFile != NULL)? fopen(outputFile, "wt") : stdout;
+    if (file == NULL)
+    {
+        TraceLog(LOG_WARNING, "BENCH: [%s] Output file could not be opened", outputFile);
+        CloseWindow();
+        return 1;
+    }
+
+    double *frameTimes = (double *)malloc(BENCH_MAX_FRAMES*sizeof(double));
+    bool first = true;
+    //--------------------------------------------------------------------------------------
+
+    fprintf(file, "{\n  \"raylib\": \"%s\",\n  \"duration\": %.2f,\n  \"seed\": %i,\n  \"scenarios\": [\n", BENCH_RAYLIB_VERSION, duration, BENCH_RANDOM_SEED);
+
+    for (int s = 0; s < (int)(sizeof(scenarios)/sizeof(scenarios[0])); s++)
+    {
+        if ((scenarioName != NULL) && (strcmp(scenarioName, scenarios[s].name) != 0)) continue;
+
+        RunScenario(&scenarios[s], duration, frameTimes, file, first);
+        first = false;
+    }
+
+    fprintf(file, "\n  ]\n}\n");
+
+    // De-Initialization
+    //--------------------------------------------------------------------------------------
+    free(frameTimes);
+    if (file != stdout) fclose(file);
+
+    CloseWindow();
+    //--------------------------------------------------------------------------------------
+
+    return 0;
+}
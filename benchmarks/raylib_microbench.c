@@ -0,0 +1,470 @@
+/*******************************************************************************************
+*
+*   raylib microbenchmarks - CPU hot paths by implementation variant
+*
+*   Measures ns/op of raylib CPU kernels: raymath (scalar and SIMD variants), pixel formats
+*   conversion (ImageFormat() pairs), mipmaps generation (rlGenNextMipmap()), audio mixing
+*   (MixAudioFrames() on audio callback) and UTF-8 decoding, reporting CPU features detected
+*   at runtime and enabled at compile time. Results are written as JSON.
+*
+*   Usage: raylib_microbench [--output <file.json>]
+*
+*   NOTE: Library kernels are measured as built, their variant is the SIMD path selected by
+*   the library module for the same compiler flags. Best of several runs is reported.
+*
+*   This benchmark has been created using raylib 2.5 (www.raylib.com)
+*   raylib is licensed under an unmodified zlib/libpng license (View raylib.h for details)
+*
+********************************************************************************************/
+
+#include "raylib.h"
+#include "rlgl.h"               // Required for: rlGenNextMipmap()
+
+#include "microbench.h"
+
+#include <stdio.h>              // Required for: FILE, fopen(), fprintf(), fclose()
+#include <stdlib.h>             // Required for: malloc(), free()
+#include <string.h>             // Required for: strcmp(), strlen(), memcpy()
+#include <math.h>               // Required for: sinf()
+
+#if defined(_WIN32)
+    // Functions required to query time on Windows
+    int __stdcall QueryPerformanceCounter(unsigned long long int *lpPerformanceCount);
+    int __stdcall QueryPerformanceFrequency(unsigned long long int *lpFrequency);
+#elif defined(__APPLE__)
+    #include <mach/mach_time.h> // Required for: mach_absolute_time()
+#else
+    #if _POSIX_C_SOURCE < 199309L
+        #undef _POSIX_C_SOURCE
+        #define _POSIX_C_SOURCE 199309L // Required for CLOCK_MONOTONIC if compiled with c99 without gnu ext.
+    #endif
+    #include <time.h>           // Required for: clock_gettime()
+#endif
+
+#ifndef BENCH_RAYLIB_VERSION
+    #define BENCH_RAYLIB_VERSION    "unknown"
+#endif
+
+// Library modules SIMD paths, same detection as modules for same compiler flags
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+    #define TEXT_VARIANT        "sse2"          // text.c: TEXT_SIMD_SSE2
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+    #define TEXT_VARIANT        "neon"          // text.c: TEXT_SIMD_NEON
+#else
+    #define TEXT_VARIANT        "scalar"
+#endif
+
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 1))
+    #define AUDIO_VARIANT       "sse"           // raudio.c: RAUDIO_SIMD_SSE
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+    #define AUDIO_VARIANT       "neon"          // raudio.c: RAUDIO_SIMD_NEON
+#else
+    #define AUDIO_VARIANT       "scalar"
+#endif
+
+#define MIN_RUN_TIME            0.01            // Minimum kernel run time (seconds), iterations calibrated to reach it
+#define RUNS_COUNT                 5            // Kernel runs, best time is reported
+
+#define IMAGE_SIZE               256
+#define MIPMAP_SIZE             1024
+#define TEXT_SIZE              65536
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+typedef struct LibraryKernel {
+    MicroKernel kernel;
+    const char *unit;               // Operation unit (call, pixel, byte, sample)
+    int unitsPerIteration;          // Operation units processed by kernel iteration
+} LibraryKernel;
+
+//----------------------------------------------------------------------------------
+// Global Variables Definition
+//----------------------------------------------------------------------------------
+static Image image = { 0 };
+static unsigned char *mipmapData = NULL;
+static char *textAscii = NULL;
+static char *textMixed = NULL;
+static int textAsciiLength = 0;
+static int textMixedLength = 0;
+static int *codepoints = NULL;
+
+//----------------------------------------------------------------------------------
+// Timing
+//----------------------------------------------------------------------------------
+static double GetTimeSeconds(void)
+{
+#if defined(_WIN32)
+    unsigned long long int frequency, value;
+    QueryPerformanceFrequency(&frequency);
+    QueryPerformanceCounter(&value);
+    return (double)value/(double)frequency;
+#elif defined(__APPLE__)
+    mach_timebase_info_data_t timebase;
+    mach_timebase_info(&timebase);
+    return (double)mach_absolute_time()*timebase.numer/timebase.denom*1e-9;
+#else
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (double)now.tv_sec + (double)now.tv_nsec*1e-9;
+#endif
+}
+
+// Measure kernel time by iteration (seconds), best of several runs
+static double MeasureKernel(const MicroKernel *kernel)
+{
+    volatile float sink = 0.0f;
+    int iterations = 1;
+
+    // Calibrate iterations for a minimum run time
+    for (;;)
+    {
+        double start = GetTimeSeconds();
+        sink += kernel->Run(iterations);
+        if ((GetTimeSeconds() - start) >= MIN_RUN_TIME) break;
+        iterations *= 2;
+    }
+
+    double best = 0.0;
+
+    for (int i = 0; i < RUNS_COUNT; i++)
+    {
+        double start = GetTimeSeconds();
+        sink += kernel->Run(iterations);
+        double time = GetTimeSeconds() - start;
+
+        if ((i == 0) || (time < best)) best = time;
+    }
+
+    (void)sink;
+
+    return best/iterations;
+}
+
+//----------------------------------------------------------------------------------
+// Library kernels: pixel formats conversion and mipmaps generation
+//----------------------------------------------------------------------------------
+// NOTE: Image is converted back and forth, iteration does two conversions
+static float RunImageFormat(int iterations, int format)
+{
+    for (int i = 0; i < iterations; i++)
+    {
+        ImageFormat(&image, format);
+        ImageFormat(&image, UNCOMPRESSED_R8G8B8A8);
+    }
+
+    return (float)((unsigned char *)image.data)[0];
+}
+
+static float RunImageFormatR8G8B8(int iterations) { return RunImageFormat(iterations, UNCOMPRESSED_R8G8B8); }
+static float RunImageFormatGrayAlpha(int iterations) { return RunImageFormat(iterations, UNCOMPRESSED_GRAY_ALPHA); }
+static float RunImageFormatR5G6B5(int iterations) { return RunImageFormat(iterations, UNCOMPRESSED_R5G6B5); }
+static float RunImageFormatR32G32B32A32(int iterations) { return RunImageFormat(iterations, UNCOMPRESSED_R32G32B32A32); }
+
+static float RunGenNextMipmap(int iterations)
+{
+    unsigned char *dstData = mipmapData + MIPMAP_SIZE*MIPMAP_SIZE*4;
+
+    for (int i = 0; i < iterations; i++) rlGenNextMipmap(mipmapData, MIPMAP_SIZE, MIPMAP_SIZE, 4, dstData);
+
+    return (float)dstData[0];
+}
+
+//----------------------------------------------------------------------------------
+// Library kernels: UTF-8 decoding
+//----------------------------------------------------------------------------------
+static float RunGetCodepointsAscii(int iterations)
+{
+    int count = 0;
+    for (int i = 0; i < iterations; i++) count += GetCodepointsEx(textAscii, codepoints, TEXT_SIZE);
+    return (float)count;
+}
+
+static float RunGetCodepointsMixed(int iterations)
+{
+    int count = 0;
+    for (int i = 0; i < iterations; i++) count += GetCodepointsEx(textMixed, codepoints, TEXT_SIZE);
+    return (float)count;
+}
+
+// Reference decoding, codepoint by codepoint
+static float RunGetNextCodepointAscii(int iterations)
+{
+    int sum = 0;
+
+    for (int i = 0; i < iterations; i++)
+    {
+        for (int b = 0; textAscii[b] != '\0';)
+        {
+            int bytesProcessed = 0;
+            sum += GetNextCodepoint(&textAscii[b], &bytesProcessed);
+            b += bytesProcessed;
+        }
+    }
+
+    return (float)sum;
+}
+
+static void InitLibraryKernels(void)
+{
+    Image checked = GenImageChecked(IMAGE_SIZE, IMAGE_SIZE, 16, 16, ORANGE, DARKBLUE);
+    image = checked;
+
+    mipmapData = (unsigned char *)malloc(MIPMAP_SIZE*MIPMAP_SIZE*4 + (MIPMAP_SIZE/2)*(MIPMAP_SIZE/2)*4);
+    for (int i = 0; i < MIPMAP_SIZE*MIPMAP_SIZE*4; i++) mipmapData[i] = (unsigned char)((i*7) ^ (i >> 5));
+
+    // Text buffers: plain ASCII and mixed text (ASCII with 2, 3 and 4 bytes sequences)
+    const char *ascii = "The quick brown fox jumps over the lazy dog. ";
+    const char *mixed = "Ni\xc3\xb1o \xe6\x97\xa5\xe6\x9c\xac smile \xf0\x9f\x98\x80 caf\xc3\xa9 text. ";
+    int asciiLength = (int)strlen(ascii);
+    int mixedLength = (int)strlen(mixed);
+
+    textAscii = (char *)malloc(TEXT_SIZE + 1);
+    textMixed = (char *)malloc(TEXT_SIZE + 1);
+
+    textAsciiLength = 0;
+    for (; (textAsciiLength + asciiLength) <= TEXT_SIZE; textAsciiLength += asciiLength) memcpy(textAscii + textAsciiLength, ascii, asciiLength);
+    textAscii[textAsciiLength] = '\0';
+
+    textMixedLength = 0;
+    for (; (textMixedLength + mixedLength) <= TEXT_SIZE; textMixedLength += mixedLength) memcpy(textMixed + textMixedLength, mixed, mixedLength);
+    textMixed[textMixedLength] = '\0';
+
+    codepoints = (int *)malloc(TEXT_SIZE*sizeof(int));
+}
+
+static void CloseLibraryKernels(void)
+{
+    UnloadImage(image);
+    free(mipmapData);
+    free(textAscii);
+    free(textMixed);
+    free(codepoints);
+}
+
+//----------------------------------------------------------------------------------
+// Library kernels: audio mixing
+//----------------------------------------------------------------------------------
+// Measure audio mixing time by sample (seconds), from audio callback statistics
+// NOTE: MixAudioFrames() is internal to raudio, measured on a null backend device mixing
+// voices for some time, time by sample includes callback overhead (voices update, clamping)
+static bool MeasureAudioMixing(double *timePerSample)
+{
+#if !defined(BENCH_NO_AUDIO)
+    const int periodSize = 1024;
+    const int voices = 16;
+
+    AudioDeviceConfig config = { 0 };
+    config.sampleRate = 44100;
+    config.periodSize = periodSize;
+    config.backend = AUDIO_BACKEND_NULL;
+
+    InitAudioDeviceEx(config);
+    if (!IsAudioDeviceReady()) return false;
+
+    // Generate a 1 second 16 bit stereo sine wave
+    Wave wave = { 0 };
+    wave.sampleCount = 44100*2;
+    wave.sampleRate = 44100;
+    wave.sampleSize = 16;
+    wave.channels = 2;
+    wave.data = malloc(wave.sampleCount*sizeof(short));
+
+    for (unsigned int i = 0; i < wave.sampleCount; i++) ((short *)wave.data)[i] = (short)(sinf(2.0f*PI*440.0f*(float)(i/2)/44100.0f)*16000.0f);
+
+    Sound sound = LoadSoundFromWave(wave);
+    free(wave.data);
+
+    SetAudioVoicesLimit(voices);
+    for (int i = 0; i < voices; i++) PlaySoundVoice(sound, 0.5f, 0.0f);
+    UpdateAudioVoices();
+
+    GetAudioStats();    // Reset statistics
+
+    double start = GetTimeSeconds();
+    while ((GetTimeSeconds() - start) < 0.5) UpdateAudioVoices();
+
+    AudioStats stats = GetAudioStats();
+
+    UnloadSound(sound);
+    CloseAudioDevice();
+
+    if ((stats.callbackCount == 0) || (stats.voicesMixed == 0)) return false;
+
+    // Samples mixed by callback: period frames, by stereo channels, by voices
+    *timePerSample = (double)stats.callbackTimeAvg*1e-3/((double)periodSize*2*stats.voicesMixed);
+
+    return true;
+#else
+    (void)timePerSample;
+    return false;   // raylib built without audio module (USE_AUDIO=OFF)
+#endif
+}
+
+//----------------------------------------------------------------------------------
+// CPU features
+//----------------------------------------------------------------------------------
+// Write CPU features detected at runtime, as JSON array items
+static void WriteCpuFeaturesDetected(FILE *file)
+{
+    int count = 0;
+
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+    const char *names[] = { "sse", "sse2", "sse3", "ssse3", "sse4.1", "sse4.2", "avx", "avx2", "fma", "avx512f" };
+    int supported[sizeof(names)/sizeof(names[0])] = { 0 };
+
+    __builtin_cpu_init();
+    supported[0] = __builtin_cpu_supports("sse");
+    supported[1] = __builtin_cpu_supports("sse2");
+    supported[2] = __builtin_cpu_supports("sse3");
+    supported[3] = __builtin_cpu_supports("ssse3");
+    supported[4] = __builtin_cpu_supports("sse4.1");
+    supported[5] = __builtin_cpu_supports("sse4.2");
+    supported[6] = __builtin_cpu_supports("avx");
+    supported[7] = __builtin_cpu_supports("avx2");
+    supported[8] = __builtin_cpu_supports("fma");
+    supported[9] = __builtin_cpu_supports("avx512f");
+
+    for (int i = 0; i < (int)(sizeof(names)/sizeof(names[0])); i++)
+    {
+        if (supported[i]) fprintf(file, "%s\"%s\"", (count++ > 0)? ", " : "", names[i]);
+    }
+#elif defined(__aarch64__) || defined(_M_ARM64)
+    fprintf(file, "\"neon\"");   // NEON is mandatory on ARM64
+    count++;
+#endif
+
+    if (count == 0) fprintf(file, "\"unknown\"");
+}
+
+// Write CPU features enabled at compile time (used by raylib SIMD paths), as JSON array items
+static void WriteCpuFeaturesCompiled(FILE *file)
+{
+    const char *names[16] = { 0 };
+    int count = 0;
+
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 1))
+    names[count++] = "sse";
+#endif
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+    names[count++] = "sse2";
+#endif
+#if defined(__SSE4_1__)
+    names[count++] = "sse4.1";
+#endif
+#if defined(__AVX__)
+    names[count++] = "avx";
+#endif
+#if defined(__AVX2__)
+    names[count++] = "avx2";
+#endif
+#if defined(__FMA__)
+    names[count++] = "fma";
+#endif
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+    names[count++] = "neon";
+#endif
+
+    for (int i = 0; i < count; i++) fprintf(file, "%s\"%s\"", (i > 0)? ", " : "", names[i]);
+}
+
+static void WriteResult(FILE *file, const char *name, const char *variant, const char *unit, double timePerOp, bool first)
+{
+    fprintf(file, "%s    { \"name\": \"%s\", \"variant\": \"%s\", \"unit\": \"%s\", \"ns_per_op\": %.4f }",
+            first? "" : ",\n", name, variant, unit, timePerOp*1e9);
+
+    // Results table, only when JSON is written to a file
+    if (file != stdout) printf("%-36s %-8s %10.3f ns/%s\n", name, variant, timePerOp*1e9, unit);
+}
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+    const char *outputFile = NULL;
+
+    for (int i = 1; i < argc; i++)
+    {
+        if ((strcmp(argv[i], "--output") == 0) && (i + 1 < argc)) outputFile = argv[++i];
+        else
+        {
+            printf("Usage: %s [--output <file.json>]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    SetTraceLogLevel(LOG_WARNING);
+
+    FILE *file = (outputFile != NULL)? fopen(outputFile, "wt") : stdout;
+    if (file == NULL)
+    {
+        TraceLog(LOG_WARNING, "BENCH: [%s] Output file could not be opened", outputFile);
+        return 1;
+    }
+
+    fprintf(file, "{\n  \"raylib\": \"%s\",\n  \"cpu\": {\n    \"detected\": [ ", BENCH_RAYLIB_VERSION);
+    WriteCpuFeaturesDetected(file);
+    fprintf(file, " ],\n    \"compiled\": [ ");
+    WriteCpuFeaturesCompiled(file);
+    fprintf(file, " ]\n  },\n  \"kernels\": [\n");
+
+    if (file != stdout)
+    {
+        printf("CPU features detected: ");
+        WriteCpuFeaturesDetected(stdout);
+        printf("\nCPU features compiled: ");
+        WriteCpuFeaturesCompiled(stdout);
+        printf("\n\n");
+    }
+
+    bool first = true;
+
+    // raymath kernels, by variant
+    const MicroKernel *(*getRaymathKernels[2])(int *) = { GetRaymathKernelsScalar, GetRaymathKernelsSimd };
+
+    for (int v = 0; v < 2; v++)
+    {
+        int count = 0;
+        const MicroKernel *kernels = getRaymathKernels[v](&count);
+
+        for (int i = 0; i < count; i++)
+        {
+            WriteResult(file, kernels[i].name, kernels[i].variant, "call", MeasureKernel(&kernels[i]), first);
+            first = false;
+        }
+    }
+
+    // Library kernels
+    InitLibraryKernels();
+
+    const int imagePixels = IMAGE_SIZE*IMAGE_SIZE;
+    const LibraryKernel libraryKernels[] = {
+        { { "ImageFormat R8G8B8A8<->R8G8B8", "scalar", RunImageFormatR8G8B8 }, "pixel", 2*imagePixels },
+        { { "ImageFormat R8G8B8A8<->GRAY_ALPHA", "scalar", RunImageFormatGrayAlpha }, "pixel", 2*imagePixels },
+        { { "ImageFormat R8G8B8A8<->R5G6B5", "scalar", RunImageFormatR5G6B5 }, "pixel", 2*imagePixels },
+        { { "ImageFormat R8G8B8A8<->R32G32B32A32", "scalar", RunImageFormatR32G32B32A32 }, "pixel", 2*imagePixels },
+        { { "rlGenNextMipmap", "scalar", RunGenNextMipmap }, "pixel", (MIPMAP_SIZE/2)*(MIPMAP_SIZE/2) },
+        { { "GetCodepointsEx (ascii)", TEXT_VARIANT, RunGetCodepointsAscii }, "byte", textAsciiLength },
+        { { "GetCodepointsEx (mixed)", TEXT_VARIANT, RunGetCodepointsMixed }, "byte", textMixedLength },
+        { { "GetNextCodepoint (ascii)", "scalar", RunGetNextCodepointAscii }, "byte", textAsciiLength },
+    };
+
+    for (int i = 0; i < (int)(sizeof(libraryKernels)/sizeof(libraryKernels[0])); i++)
+    {
+        WriteResult(file, libraryKernels[i].kernel.name, libraryKernels[i].kernel.variant, libraryKernels[i].unit,
+                    MeasureKernel(&libraryKernels[i].kernel)/libraryKernels[i].unitsPerIteration, first);
+        first = false;
+    }
+
+    CloseLibraryKernels();
+
+    double timePerSample = 0.0;
+    if (MeasureAudioMixing(&timePerSample)) WriteResult(file, "MixAudioFrames (audio callback)", AUDIO_VARIANT, "sample", timePerSample, first);
+    else TraceLog(LOG_WARNING, "BENCH: Audio mixing not measured, audio device not available");
+
+    fprintf(file, "\n  ]\n}\n");
+    if (file != stdout) fclose(file);
+
+    return 0;
+}
@@ -0,0 +1,513 @@
+/*******************************************************************************************
+*
+*   rlgl_replay - Replay frame captures (rlCaptureFrame()) for offline profiling
+*
+*   Captured frame commands are replayed through rlgl the requested number of frames:
+*   batch flushes are submitted again with rlBegin()/rlVertex3f(), meshes are reloaded from
+*   captured vertex data and drawn with rlDrawMesh() and render state changes are applied.
+*   Results are written as JSON: CPU submission and GPU frame time percentiles.
+*
+*   Usage: rlgl_replay <capture.rlfc> [--frames <count>] [--output <file.json>]
+*
+*   NOTE: Capture does not store texture pixels nor shaders source: textures are replaced by
+*   placeholder textures of the same size, custom shaders are replaced by default shader and
+*   shader uniforms are only counted. Replayed cost is close to captured frame geometry and
+*   state changes cost, not to its shading cost.
+*
+*   NOTE: GPU times are only available on OpenGL 3.3 (GPU timing zones), 0 otherwise.
+*
+*   This tool has been created using raylib 2.5 (www.raylib.com)
+*   raylib is licensed under an unmodified zlib/libpng license (View raylib.h for details)
+*
+********************************************************************************************/
+
+#include "raylib.h"
+#include "rlgl.h"
+
+#include <stdio.h>              // Required for: FILE, fopen(), fread(), fprintf(), fclose()
+#include <stdlib.h>             // Required for: malloc(), calloc(), free(), qsort(), atoi()
+#include <string.h>             // Required for: memcpy(), strcmp()
+
+#define MAX_REPLAY_RESOURCES    1024    // Maximum textures, meshes and render textures mapped
+#define MAX_MESH_VBO               9    // Mesh vertex buffers ids array size (same as models module)
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+typedef struct ReplayTexture {
+    unsigned int capturedId;    // Texture id on captured frame
+    Texture2D texture;          // Placeholder texture
+} ReplayTexture;
+
+typedef struct ReplayMesh {
+    unsigned int capturedId;    // Mesh id on captured frame
+    Mesh mesh;                  // Mesh loaded from captured vertex data
+} ReplayMesh;
+
+typedef struct ReplayTarget {
+    unsigned int capturedId;    // Framebuffer id on captured frame
+    RenderTexture2D target;     // Render texture created on first use
+} ReplayTarget;
+
+// Replayed commands count (by type) and resources substitutions
+typedef struct ReplayCounters {
+    int commands[CAPTURE_UNIFORM + 1];
+    int vertices;
+    int shadersReplaced;
+    int missingMeshes;
+} ReplayCounters;
+
+//----------------------------------------------------------------------------------
+// Global Variables Definition
+//----------------------------------------------------------------------------------
+static ReplayTexture textures[MAX_REPLAY_RESOURCES] = { 0 };
+static int texturesCount = 0;
+static ReplayMesh meshes[MAX_REPLAY_RESOURCES] = { 0 };
+static int meshesCount = 0;
+static ReplayTarget targets[MAX_REPLAY_RESOURCES] = { 0 };
+static int targetsCount = 0;
+
+static CaptureHeader header = { 0 };
+static Material material = { 0 };
+static Color clearColor = { 0 };
+static CaptureDraw replayState = { 0 };     // Render state set by state changes (blend mode and scissor), draw calls set their own
+static ReplayCounters counters = { 0 };
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition
+//----------------------------------------------------------------------------------
+// Get texture used on replay for captured texture id
+static unsigned int GetReplayTexture(unsigned int capturedId)
+{
+    if ((capturedId == 0) || (capturedId == header.defaultTextureId)) return GetTextureDefault().id;
+
+    for (int i = 0; i < texturesCount; i++) if (textures[i].capturedId == capturedId) return textures[i].texture.id;
+
+    return GetTextureDefault().id;
+}
+
+// Get mesh loaded for captured mesh id, NULL if mesh data was not captured
+static Mesh *GetReplayMesh(unsigned int capturedId)
+{
+    for (int i = 0; i < meshesCount; i++) if (meshes[i].capturedId == capturedId) return &meshes[i].mesh;
+
+    return NULL;
+}
+
+// Get render texture used on replay for captured framebuffer id (created on first use)
+static unsigned int GetReplayTarget(unsigned int capturedId, int width, int height)
+{
+    for (int i = 0; i < targetsCount; i++) if (targets[i].capturedId == capturedId) return targets[i].target.id;
+
+    if (targetsCount >= MAX_REPLAY_RESOURCES) return 0;
+
+    // NOTE: Framebuffer size is unknown on OpenGL ES 2.0 captures, screen size is used
+    if ((width <= 0) || (height <= 0)) { width = header.width; height = header.height; }
+
+    targets[targetsCount].capturedId = capturedId;
+    targets[targetsCount].target = LoadRenderTexture(width, height);
+
+    return targets[targetsCount++].target.id;
+}
+
+// Load captured texture placeholder
+static void LoadReplayTexture(const CaptureTexture *info)
+{
+    if (texturesCount >= MAX_REPLAY_RESOURCES) return;
+
+    int width = (info->width > 0)? info->width : 64;
+    int height = (info->height > 0)? info->height : 64;
+
+    Image image = GenImageChecked(width, height, 8, 8, LIGHTGRAY, GRAY);
+    textures[texturesCount].capturedId = info->id;
+    textures[texturesCount].texture = LoadTextureFromImage(image);
+    texturesCount++;
+
+    UnloadImage(image);
+}
+
+// Copy captured mesh data array into a new allocated array
+static void *LoadReplayArray(const unsigned char **data, int size)
+{
+    void *array = malloc(size);
+    memcpy(array, *data, size);
+    *data += size;
+
+    return array;
+}
+
+// Load captured mesh vertex data into GPU
+static void LoadReplayMesh(const unsigned char *data)
+{
+    if (meshesCount >= MAX_REPLAY_RESOURCES) return;
+
+    CaptureMesh info = { 0 };
+    memcpy(&info, data, sizeof(CaptureMesh));
+    data += sizeof(CaptureMesh);
+
+    Mesh mesh = { 0 };
+    mesh.vertexCount = info.vertexCount;
+    mesh.triangleCount = info.triangleCount;
+
+    if (info.dataFlags & CAPTURE_MESH_VERTICES) mesh.vertices = (float *)LoadReplayArray(&data, info.vertexCount*3*sizeof(float));
+    if (info.dataFlags & CAPTURE_MESH_TEXCOORDS) mesh.texcoords = (float *)LoadReplayArray(&data, info.vertexCount*2*sizeof(float));
+    if (info.dataFlags & CAPTURE_MESH_NORMALS) mesh.normals = (float *)LoadReplayArray(&data, info.vertexCount*3*sizeof(float));
+    if (info.dataFlags & CAPTURE_MESH_COLORS) mesh.colors = (unsigned char *)LoadReplayArray(&data, info.vertexCount*4*sizeof(unsigned char));
+    if (info.dataFlags & CAPTURE_MESH_INDICES) mesh.indices = (unsigned short *)LoadReplayArray(&data, info.triangleCount*3*sizeof(unsigned short));
+
+    // NOTE: Meshes without texcoords are drawn by default shader with a placeholder array
+    if (mesh.texcoords == NULL) mesh.texcoords = (float *)calloc(info.vertexCount*2, sizeof(float));
+
+    mesh.vboId = (unsigned int *)calloc(MAX_MESH_VBO, sizeof(unsigned int));
+    rlLoadMesh(&mesh, false);
+
+    meshes[meshesCount].capturedId = info.id;
+    meshes[meshesCount].mesh = mesh;
+    meshesCount++;
+}
+
+// Check capture commands are well formed and load captured resources (textures and meshes)
+static bool LoadReplayResources(const unsigned char *data, int dataSize)
+{
+    int offset = sizeof(CaptureHeader);
+
+    while (offset < dataSize)
+    {
+        if ((dataSize - offset) < (int)(2*sizeof(int))) return false;
+
+        int command[2] = { 0 };
+        memcpy(command, data + offset, 2*sizeof(int));
+        offset += 2*sizeof(int);
+
+        if ((command[0] < CAPTURE_TEXTURE) || (command[0] > CAPTURE_UNIFORM) || (command[1] < 0) || (command[1] > (dataSize - offset))) return false;
+
+        if (command[0] == CAPTURE_TEXTURE) LoadReplayTexture((const CaptureTexture *)(data + offset));
+        else if (command[0] == CAPTURE_MESH) LoadReplayMesh(data + offset);
+
+        offset += command[1];
+    }
+
+    return true;
+}
+
+// Set render state of next draw calls: blend mode and scissor
+static void ReplayDrawState(int blendMode, int scissorTest, const int *scissor)
+{
+    BeginBlendMode(blendMode);
+    rlScissor(scissor[0], scissor[1], scissor[2], scissor[3]);
+
+    if (scissorTest) rlEnableScissorTest();
+    else rlDisableScissorTest();
+}
+
+// Replay captured batch flush
+static void ReplayBatch(const unsigned char *data)
+{
+    CaptureBatch info = { 0 };
+    memcpy(&info, data, sizeof(CaptureBatch));
+
+    const CaptureVertex *vertices = (const CaptureVertex *)(data + sizeof(CaptureBatch));
+    const CaptureDraw *draws = (const CaptureDraw *)(data + sizeof(CaptureBatch) + info.vertexCount*sizeof(CaptureVertex));
+
+    if (info.shaderId != header.defaultShaderId) counters.shadersReplaced++;
+
+    SetMatrixProjection(info.projection);
+    SetMatrixModelview(info.modelview);
+
+    int vertex = 0;
+
+    for (int i = 0; i < info.drawsCount; i++)
+    {
+        CaptureDraw draw = { 0 };
+        memcpy(&draw, &draws[i], sizeof(CaptureDraw));
+
+        // NOTE: Draw calls render state is registered per draw call by rlgl, no batch flush
+        ReplayDrawState(draw.blendMode, draw.scissorTest, draw.scissor);
+
+        rlEnableTexture(GetReplayTexture(draw.textureId));
+        rlBegin(draw.mode);
+
+        for (int v = 0; (v < draw.vertexCount) && (vertex < info.vertexCount); v++, vertex++)
+        {
+            CaptureVertex cv = { 0 };
+            memcpy(&cv, &vertices[vertex], sizeof(CaptureVertex));
+
+            rlColor4ub(cv.color[0], cv.color[1], cv.color[2], cv.color[3]);
+            rlTexCoord2f(cv.texcoord[0], cv.texcoord[1]);
+            rlVertex3f(cv.position[0], cv.position[1], cv.position[2]);
+        }
+
+        rlEnd();
+        rlDisableTexture();
+
+        vertex += draw.vertexAlignment;     // Alignment vertices are added again by rlgl
+    }
+
+    ReplayDrawState(replayState.blendMode, replayState.scissorTest, replayState.scissor);
+    rlglDraw();
+
+    counters.vertices += info.vertexCount;
+}
+
+// Replay captured mesh draw (instanced or not)
+static void ReplayMeshDraw(const unsigned char *data)
+{
+    CaptureMeshDraw info = { 0 };
+    memcpy(&info, data, sizeof(CaptureMeshDraw));
+
+    Mesh *mesh = GetReplayMesh(info.meshId);
+
+    if (mesh == NULL)
+    {
+        counters.missingMeshes++;
+        return;
+    }
+
+    if (info.shaderId != header.defaultShaderId) counters.shadersReplaced++;
+
+    for (int i = 0; i < MAX_MATERIAL_MAPS; i++) material.maps[i].texture.id = GetReplayTexture(info.textureIds[i]);
+    material.maps[MAP_DIFFUSE].color = (Color){ info.color[0], info.color[1], info.color[2], info.color[3] };
+
+    SetMatrixProjection(info.projection);
+    SetMatrixModelview(info.modelview);
+
+    if (info.instances > 0)
+    {
+        Matrix *transforms = (Matrix *)malloc(info.instances*sizeof(Matrix));
+        memcpy(transforms, data + sizeof(CaptureMeshDraw), info.instances*sizeof(Matrix));
+
+        rlDrawMeshInstanced(*mesh, material, transforms, info.instances);
+
+        free(transforms);
+    }
+    else rlDrawMesh(*mesh, material, info.transform);
+
+    counters.vertices += mesh->vertexCount*((info.instances > 0)? info.instances : 1);
+}
+
+// Replay captured render state change
+static void ReplayState(const CaptureState *data)
+{
+    CaptureState info = { 0 };
+    memcpy(&info, data, sizeof(CaptureState));
+
+    switch (info.state)
+    {
+        case CAPTURE_STATE_DEPTH_TEST: if (info.values[0]) rlEnableDepthTest(); else rlDisableDepthTest(); break;
+        case CAPTURE_STATE_BACKFACE_CULLING: if (info.values[0]) rlEnableBackfaceCulling(); else rlDisableBackfaceCulling(); break;
+        case CAPTURE_STATE_SCISSOR_TEST:
+        {
+            if (info.values[0]) rlEnableScissorTest();
+            else rlDisableScissorTest();
+
+            replayState.scissorTest = info.values[0];
+        } break;
+        case CAPTURE_STATE_SCISSOR:
+        {
+            rlScissor(info.values[0], info.values[1], info.values[2], info.values[3]);
+            memcpy(replayState.scissor, info.values, 4*sizeof(int));
+        } break;
+        case CAPTURE_STATE_WIRE_MODE: if (info.values[0]) rlEnableWireMode(); else rlDisableWireMode(); break;
+        case CAPTURE_STATE_BLEND_MODE: BeginBlendMode(info.values[0]); replayState.blendMode = info.values[0]; break;
+        case CAPTURE_STATE_VIEWPORT: rlViewport(info.values[0], info.values[1], info.values[2], info.values[3]); break;
+        case CAPTURE_STATE_RENDER_TEXTURE:
+        {
+            if (info.values[0] == 0) rlDisableRenderTexture();
+            else rlEnableRenderTexture(GetReplayTarget(info.values[0], info.values[1], info.values[2]));
+        } break;
+        case CAPTURE_STATE_CLEAR_COLOR: clearColor = (Color){ info.values[0], info.values[1], info.values[2], info.values[3] }; break;
+        case CAPTURE_STATE_CLEAR: ClearBackground(clearColor); break;
+        default: break;
+    }
+}
+
+// Replay all captured commands once
+static void ReplayFrame(const unsigned char *data, int dataSize)
+{
+    int offset = sizeof(CaptureHeader);
+
+    while (offset < dataSize)
+    {
+        int command[2] = { 0 };
+        memcpy(command, data + offset, 2*sizeof(int));
+        offset += 2*sizeof(int);
+
+        switch (command[0])
+        {
+            case CAPTURE_BATCH: ReplayBatch(data + offset); break;
+            case CAPTURE_DRAW_MESH: ReplayMeshDraw(data + offset); break;
+            case CAPTURE_STATE: ReplayState((const CaptureState *)(data + offset)); break;
+            default: break;     // Resources loaded before replay, uniforms not applied (shaders replaced)
+        }
+
+        counters.commands[command[0]]++;
+        offset += command[1];
+    }
+
+    // Reset state changed by captured frame, next replayed frame starts from same state
+    rlDisableRenderTexture();
+    rlDisableScissorTest();
+    rlDisableWireMode();
+    BeginBlendMode(BLEND_ALPHA);
+    rlViewport(0, 0, GetScreenWidth(), GetScreenHeight());
+}
+
+static int CompareFloat(const void *a, const void *b)
+{
+    float fa = *(const float *)a;
+    float fb = *(const float *)b;
+
+    return (fa > fb) - (fa < fb);
+}
+
+// Get percentile from sorted frame times (nearest rank)
+static float GetPercentile(const float *sorted, int count, float percentile)
+{
+    int index = (int)(percentile*(count - 1) + 0.5f);
+    return sorted[index];
+}
+
+// Write frame times percentiles JSON object
+static void WriteTimes(FILE *file, const char *name, float *times, int count)
+{
+    float total = 0.0f;
+    for (int i = 0; i < count; i++) total += times[i];
+
+    qsort(times, count, sizeof(float), CompareFloat);
+
+    if (count == 0) fprintf(file, "  \"%s\": null", name);
+    else fprintf(file, "  \"%s\": { \"mean\": %.4f, \"p50\": %.4f, \"p90\": %.4f, \"p99\": %.4f, \"max\": %.4f }", name,
+                 total/count, GetPercentile(times, count, 0.5f), GetPercentile(times, count, 0.9f),
+                 GetPercentile(times, count, 0.99f), times[count - 1]);
+}
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+    const char *captureFile = NULL;
+    const char *outputFile = NULL;
+    int frames = 300;
+    bool usage = false;
+
+    for (int i = 1; i < argc; i++)
+    {
+        if ((strcmp(argv[i], "--frames") == 0) && (i + 1 < argc)) frames = atoi(argv[++i]);
+        else if ((strcmp(argv[i], "--output") == 0) && (i + 1 < argc)) outputFile = argv[++i];
+        else if ((captureFile == NULL) && (argv[i][0] != '-')) captureFile = argv[i];
+        else usage = true;
+    }
+
+    if (usage || (captureFile == NULL) || (frames <= 0))
+    {
+        printf("Usage: %s <capture.rlfc> [--frames <count>] [--output <file.json>]\n", argv[0]);
+        return 1;
+    }
+
+    // Load capture file
+    //--------------------------------------------------------------------------------------
+    FILE *file = fopen(captureFile, "rb");
+    if (file == NULL)
+    {
+        printf("REPLAY: [%s] Capture file could not be opened\n", captureFile);
+        return 1;
+    }
+
+    fseek(file, 0, SEEK_END);
+    int dataSize = (int)ftell(file);
+    fseek(file, 0, SEEK_SET);
+
+    unsigned char *data = (unsigned char *)malloc(dataSize);
+    int bytesRead = (int)fread(data, 1, dataSize, file);
+    fclose(file);
+
+    if (bytesRead >= (int)sizeof(CaptureHeader)) memcpy(&header, data, sizeof(CaptureHeader));
+
+    if ((bytesRead != dataSize) || (bytesRead < (int)sizeof(CaptureHeader)) || (memcmp(header.id, "rlFC", 4) != 0) || (header.version != CAPTURE_FILE_VERSION))
+    {
+        printf("REPLAY: [%s] Not a valid frame capture file (version %i expected)\n", captureFile, CAPTURE_FILE_VERSION);
+        free(data);
+        return 1;
+    }
+    //--------------------------------------------------------------------------------------
+
+    // Initialization
+    //--------------------------------------------------------------------------------------
+    SetConfigFlags(FLAG_WINDOW_HIDDEN);
+    InitWindow(header.width, header.height, "rlgl frame replay");
+    SetTargetFPS(0);    // No frame rate limit
+
+    if (!LoadReplayResources(data, dataSize))
+    {
+        TraceLog(LOG_WARNING, "REPLAY: [%s] Capture file commands are corrupted", captureFile);
+        free(data);
+        CloseWindow();
+        return 1;
+    }
+
+    material = LoadMaterialDefault();
+
+    float *cpuTimes = (float *)malloc(frames*sizeof(float));
+    float *gpuTimes = (float *)malloc(frames*sizeof(float));
+    int gpuTimesCount = 0;
+    //--------------------------------------------------------------------------------------
+
+    // Replay loop
+    //--------------------------------------------------------------------------------------
+    for (int frame = 0; frame < frames; frame++)
+    {
+        double start = GetTime();
+
+        BeginDrawing();
+            rlBeginGpuZone("replay");
+            ReplayFrame(data, dataSize);
+            rlEndGpuZone();
+        EndDrawing();
+
+        cpuTimes[frame] = (float)((GetTime() - start)*1000.0);
+
+        // NOTE: GPU zones results are available some frames later, latest measured frame is collected
+        int zonesCount = 0;
+        const GpuZoneTime *zones = rlGetGpuZones(&zonesCount);
+        for (int i = 0; i < zonesCount; i++) if ((zones[i].depth == 0) && (gpuTimesCount < frames)) gpuTimes[gpuTimesCount++] = zones[i].time;
+    }
+    //--------------------------------------------------------------------------------------
+
+    // Write results
+    //--------------------------------------------------------------------------------------
+    FILE *output = (outputFile != NULL)? fopen(outputFile, "wt") : stdout;
+    if (output == NULL) output = stdout;
+
+    fprintf(output, "{\n  \"capture\": \"%s\",\n  \"width\": %i,\n  \"height\": %i,\n  \"frames\": %i,\n", captureFile, header.width, header.height, frames);
+    WriteTimes(output, "cpu_ms", cpuTimes, frames);
+    fprintf(output, ",\n");
+    WriteTimes(output, "gpu_ms", gpuTimes, gpuTimesCount);
+    fprintf(output, ",\n  \"commands\": { \"batches\": %i, \"mesh_draws\": %i, \"states\": %i, \"uniforms\": %i },\n",
+            counters.commands[CAPTURE_BATCH]/frames, counters.commands[CAPTURE_DRAW_MESH]/frames,
+            counters.commands[CAPTURE_STATE]/frames, counters.commands[CAPTURE_UNIFORM]/frames);
+    fprintf(output, "  \"vertices\": %i,\n  \"textures\": %i,\n  \"meshes\": %i,\n  \"render_textures\": %i,\n",
+            counters.vertices/frames, texturesCount, meshesCount, targetsCount);
+    fprintf(output, "  \"shaders_replaced\": %i,\n  \"missing_meshes\": %i\n}\n", counters.shadersReplaced/frames, counters.missingMeshes/frames);
+
+    if (output != stdout) fclose(output);
+    //--------------------------------------------------------------------------------------
+
+    // De-Initialization
+    //--------------------------------------------------------------------------------------
+    free(cpuTimes);
+    free(gpuTimes);
+    free(data);
+
+    for (int i = 0; i < texturesCount; i++) UnloadTexture(textures[i].texture);
+    for (int i = 0; i < meshesCount; i++) UnloadMesh(meshes[i].mesh);
+    for (int i = 0; i < targetsCount; i++) UnloadRenderTexture(targets[i].target);
+
+    // NOTE: Material maps textures are replay textures (already unloaded) and shader is default shader
+    free(material.maps);
+
+    CloseWindow();
+    //--------------------------------------------------------------------------------------
+
+    return 0;
+}
@@ -46,11 +46,13 @@
 #define SUPPORT_SSH_KEYBOARD_RPI    1
 // Draw a mouse reference on screen (square cursor box)
 #define SUPPORT_MOUSE_CURSOR_RPI    1
-// Use busy wait loop for timing sync, if not defined, a high-resolution timer is setup and used
+// Use busy wait loop for timing sync by default, if not defined, a high-resolution timer is setup and used
+// NOTE: Frame pacing mode can be changed at runtime with SetFramePacing()
 //#define SUPPORT_BUSY_WAIT_LOOP      1
-// Use a half-busy wait loop, in this case frame sleeps for some time and runs a busy-wait-loop at the end
+// Use a half-busy wait loop by default, in this case frame sleeps for some time and runs a busy-wait-loop at the end
 //#define SUPPORT_HALFBUSY_WAIT_LOOP
 // Wait for events passively (sleeping while no events) instead of polling them actively every frame
+// NOTE: Mode can be changed at runtime with EnableEventWaiting()/DisableEventWaiting()
 //#define SUPPORT_EVENTS_WAITING      1
 // Allow automatic screen capture of current screen pressing F12, defined in KeyCallback()
 #define SUPPORT_SCREEN_CAPTURE      1
@@ -58,14 +60,43 @@
 #define SUPPORT_GIF_RECORDING       1
 // Allow scale all the drawn content to match the high-DPI equivalent size (only PLATFORM_DESKTOP)
 //#define SUPPORT_HIGH_DPI            1
+// Request WebGL 2.0 (OpenGL ES 3.0) context, rlgl uses ES3 core features on ES2 code path (only PLATFORM_WEB)
+// NOTE: Requires linking with -s USE_WEBGL2=1 (Makefile: USE_WEBGL2=TRUE)
+//#define SUPPORT_WEBGL2              1
+// Run main loop on a worker thread rendering to an OffscreenCanvas, context and input managed by HTML5 API (only PLATFORM_WEB)
+// NOTE: Requires linking with -s USE_PTHREADS=1 -s PROXY_TO_PTHREAD=1 -s OFFSCREENCANVAS_SUPPORT=1 (Makefile: USE_WEB_WORKER=TRUE)
+//#define SUPPORT_WEB_WORKER          1
+// Pace frames on display vsync by default on Android (FRAME_PACING_DISPLAY): Choreographer vsync times
+// and EGL_ANDROID_presentation_time, Choreographer loaded at runtime (Android 7.0, sleep pacing fallback)
+#define SUPPORT_ANDROID_FRAME_PACING 1
 // Support CompressData() and DecompressData() functions
 #define SUPPORT_COMPRESSION_API     1
+// CPU frame profiler zones (BeginProfileZone()/EndProfileZone()), recording disabled until EnableProfiler()
+#define SUPPORT_PROFILER            1
+// Use SSE/NEON instructions on raymath matrix and quaternion functions (MatrixMultiply(), MatrixInvert()...)
+#define RAYMATH_SIMD                1
 
 //------------------------------------------------------------------------------------
 // Module: rlgl - Configuration Flags
 //------------------------------------------------------------------------------------
 // Support VR simulation functionality (stereo rendering)
 #define SUPPORT_VR_SIMULATOR        1
+// Draw both VR eyes with a single instanced draw call per batch draw (OpenGL 3.3 only)
+#define SUPPORT_VR_SINGLE_PASS      1
+// Store default batch vertex data interleaved (position + texcoord + color) in a single VBO
+#define SUPPORT_BATCH_INTERLEAVED   1
+// Batch draws using multiple texture units, avoids flushes on texture switches (requires SUPPORT_BATCH_INTERLEAVED)
+#define SUPPORT_BATCH_MULTITEXTURE  1
+// Stream default batch vertex data through a ring of mapped buffers guarded by fences (OpenGL 3.3 only)
+#define SUPPORT_BATCH_STREAMING     1
+// Batch draws can sample texture arrays, layer selected per vertex (rlTexLayer()) (OpenGL 3.3 only)
+#define SUPPORT_BATCH_TEXTURE_ARRAYS 1
+// Keep active render batch and matrix stack per thread, worker threads can record their own render batches
+//#define SUPPORT_THREADED_RECORDING  1
+// Skin animated meshes on GPU (bone matrices uniform array, bone ids and weights vertex attributes)
+#define SUPPORT_GPU_SKINNING        1
+// Allow capturing one frame render commands to file (rlCaptureFrame()), replayed offline by rlgl_replay (OpenGL 3.3 and ES2)
+#define SUPPORT_FRAME_CAPTURE       1
 
 
 //------------------------------------------------------------------------------------
@@ -91,6 +122,7 @@
 #define SUPPORT_FILEFORMAT_DDS    1
 #define SUPPORT_FILEFORMAT_HDR      1
 //#define SUPPORT_FILEFORMAT_KTX    1
+#define SUPPORT_FILEFORMAT_KTX2     1
 //#define SUPPORT_FILEFORMAT_ASTC   1
 //#define SUPPORT_FILEFORMAT_PKM    1
 //#define SUPPORT_FILEFORMAT_PVR    1
@@ -123,6 +155,8 @@
 #define SUPPORT_FILEFORMAT_MTL      1
 #define SUPPORT_FILEFORMAT_IQM      1
 #define SUPPORT_FILEFORMAT_GLTF     1
+// Support raylib binary mesh cache format (.rlmesh), written by ExportModel()/ExportMesh()
+#define SUPPORT_FILEFORMAT_RLMESH   1
 // Support procedural mesh generation functions, uses external par_shapes.h library
 // NOTE: Some generated meshes DO NOT include generated texture coordinates
 #define SUPPORT_MESH_GENERATION     1
@@ -146,6 +180,12 @@
 // Show TraceLog() output messages
 // NOTE: By default LOG_DEBUG traces not shown
 #define SUPPORT_TRACELOG    1
+// Run internal jobs (asynchronous image loading, image processing) on a worker threads pool
+#define SUPPORT_WORKER_THREADS  1
+// Mount pack files (MountPackFile()), every file loader reads packed files first (read-only virtual filesystem)
+#define SUPPORT_PACK_FILES      1
+// Track memory allocations by subsystem, current and peak usage reported by GetMemoryStats()
+#define SUPPORT_MEMORY_TRACKING 1
 
 
 #endif  //defined(RAYLIB_CMAKE)
@@ -11,6 +11,7 @@
 *       - PLATFORM_RPI:     Raspberry Pi 0,1,2,3,4 (Raspbian)
 *       - PLATFORM_WEB:     HTML5 with asm.js (Chrome, Firefox)
 *       - PLATFORM_UWP:     Windows 10 App, Windows Phone, Xbox One
+*       - PLATFORM_HEADLESS: Linux servers without display (offscreen rendering)
 *
 *   CONFIGURATION:
 *
@@ -34,6 +35,11 @@
 *       Universal Windows Platform support, using OpenGL ES 2.0 through ANGLE on multiple Windows platforms,
 *       including Windows 10 App, Windows Phone and Xbox One platforms.
 *
+*   #define PLATFORM_HEADLESS
+*       No window and no input system, graphic device is managed by EGL on a pbuffer or surfaceless context
+*       (no display server required), OpenGL 3.3 or ES 2.0 rendering, intended for server-side batch rendering.
+*       NOTE: If no pbuffer is available, only render textures can be drawn (BeginTextureMode())
+*
 *   #define SUPPORT_DEFAULT_FONT (default)
 *       Default font is loaded on window initialization to be available for the user to render simple text.
 *       NOTE: If enabled, uses external module functions to load default raylib font (module: text)
@@ -59,13 +65,19 @@
 *       Draw a mouse reference on screen (square cursor box)
 *
 *   #define SUPPORT_BUSY_WAIT_LOOP
-*       Use busy wait loop for timing sync, if not defined, a high-resolution timer is setup and used
+*       Use busy wait loop for timing sync by default (FRAME_PACING_BUSY), mode can be changed with SetFramePacing()
 *
 *   #define SUPPORT_HALFBUSY_WAIT_LOOP
-*       Use a half-busy wait loop, in this case frame sleeps for some time and runs a busy-wait-loop at the end
+*       Use a half-busy wait loop by default (FRAME_PACING_HYBRID), frame sleeps while remaining time
+*       is over a calibrated margin and runs a busy-wait-loop at the end
+*
+*   #define SUPPORT_ANDROID_FRAME_PACING (Android only)
+*       Pace frames on display vsync by default (FRAME_PACING_DISPLAY), vsync times from Choreographer
+*       callbacks and frames presentation time set with EGL_ANDROID_presentation_time
 *
 *   #define SUPPORT_EVENTS_WAITING
 *       Wait for events passively (sleeping while no events) instead of polling them actively every frame
+*       by default, mode can be changed with EnableEventWaiting()/DisableEventWaiting()
 *
 *   #define SUPPORT_SCREEN_CAPTURE
 *       Allow automatic screen capture of current screen pressing F12, defined in KeyCallback()
@@ -110,6 +122,7 @@
 *
 **********************************************************************************************/
 
+#define RL_MEMORY_TAG   MEMORY_TAG_CORE // Module allocations subsystem (GetMemoryStats())
 #include "raylib.h"             // Declares module functions
 
 // Check if config flags have been externally provided on compilation line
@@ -119,18 +132,28 @@
     #define RAYLIB_VERSION  "2.6-dev"
 #endif
 
-#if (defined(__linux__) || defined(PLATFORM_WEB)) && _POSIX_C_SOURCE < 199309L
+#if (defined(__linux__) || defined(PLATFORM_WEB)) && _POSIX_C_SOURCE < 200112L
     #undef _POSIX_C_SOURCE
-    #define _POSIX_C_SOURCE 199309L // Required for CLOCK_MONOTONIC if compiled with c99 without gnu ext.
+    #define _POSIX_C_SOURCE 200112L // Required for CLOCK_MONOTONIC and lstat() if compiled with c99 without gnu ext.
 #endif
 
 #define RAYMATH_IMPLEMENTATION  // Define external out-of-line implementation of raymath here
 #include "raymath.h"            // Required for: Vector3 and Matrix functions
 
+#include "utils.h"              // Required for: fopen() Android and pack files mapping (also used by rlgl LoadText())
+
+#if defined(PLATFORM_HEADLESS)
+    #define EGL_NO_X11              // No display server, avoid X11 headers inclusion by EGL (Font type conflicts)
+    #define MESA_EGL_NO_X11_HEADERS
+#endif
+
+// NOTE: rlgl implementation allocations are accounted to rlgl subsystem
+#undef RL_MEMORY_TAG
+#define RL_MEMORY_TAG   MEMORY_TAG_RLGL
 #define RLGL_IMPLEMENTATION
 #include "rlgl.h"               // raylib OpenGL abstraction layer to OpenGL 1.1, 3.3+ or ES2
-
-#include "utils.h"              // Required for: fopen() Android mapping
+#undef RL_MEMORY_TAG
+#define RL_MEMORY_TAG   MEMORY_TAG_CORE
 
 #if defined(SUPPORT_GESTURES_SYSTEM)
     #define GESTURES_IMPLEMENTATION
@@ -152,7 +175,7 @@
 #endif
 
 #include <stdio.h>          // Standard input / output lib
-#include <stdlib.h>         // Required for: srand(), rand(), atexit()
+#include <stdlib.h>         // Required for: srand(), atexit()
 #include <stdint.h>         // Required for: typedef unsigned long long int uint64_t, used by hi-res timer
 #include <time.h>           // Required for: time() - Android/RPI hi-res timer (NOTE: Linux only!)
 #include <math.h>           // Required for: tan() [Used in BeginMode3D() to set perspective]
@@ -161,6 +184,15 @@
 #include <ctype.h>          // Required for: tolower() [Used in IsFileExtension()]
 #include <sys/stat.h>       // Required for stat() [Used in GetLastWriteTime()]
 
+// SIMD instructions used on bulk world to screen projection (GetWorldToScreenBatch())
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 1))
+    #include <xmmintrin.h>      // Required for: SSE intrinsics
+    #define CORE_SIMD_SSE
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+    #include <arm_neon.h>       // Required for: NEON intrinsics
+    #define CORE_SIMD_NEON
+#endif
+
 #if (defined(PLATFORM_DESKTOP) || defined(PLATFORM_UWP)) && defined(_WIN32) && (defined(_MSC_VER) || defined(__TINYC__))
     #include "external/dirent.h"    // Required for: DIR, opendir(), closedir() [Used in GetDirectoryFiles()]
 #else
@@ -173,7 +205,7 @@
     #define CHDIR _chdir
     #include <io.h>                 // Required for _access() [Used in FileExists()]
 #else
-    #include "unistd.h"             // Required for: getch(), chdir() (POSIX), access()
+    #include "unistd.h"             // Required for: getch(), chdir() (POSIX), access(), fsync()
     #define GETCWD getcwd
     #define CHDIR chdir
 #endif
@@ -189,11 +221,9 @@
         #define GLFW_EXPOSE_NATIVE_WIN32
         #include <GLFW/glfw3native.h>       // WARNING: It requires customization to avoid windows.h inclusion!
 
-        #if !defined(SUPPORT_BUSY_WAIT_LOOP)
-            // NOTE: Those functions require linking with winmm library
-            unsigned int __stdcall timeBeginPeriod(unsigned int uPeriod);
-            unsigned int __stdcall timeEndPeriod(unsigned int uPeriod);
-        #endif
+        // NOTE: Those functions require linking with winmm library
+        unsigned int __stdcall timeBeginPeriod(unsigned int uPeriod);
+        unsigned int __stdcall timeEndPeriod(unsigned int uPeriod);
 
     #elif defined(__linux__)
         #include <sys/time.h>           // Required for: timespec, nanosleep(), select() - POSIX
@@ -224,14 +254,19 @@
 
     #include <EGL/egl.h>        // Khronos EGL library - Native platform display device control functions
     #include <GLES2/gl2.h>      // Khronos OpenGL ES 2.0 library
+
+    #if defined(SUPPORT_ANDROID_FRAME_PACING)
+        #include <EGL/eglext.h>     // Required for: EGL_ANDROID_presentation_time (PFNEGLPRESENTATIONTIMEANDROIDPROC)
+        #include <dlfcn.h>          // Required for: dlopen(), dlsym() [AChoreographer functions, Android 7.0 (API 24)]
+    #endif
 #endif
 
 #if defined(PLATFORM_RPI)
     #include <fcntl.h>          // POSIX file control definitions - open(), creat(), fcntl()
     #include <unistd.h>         // POSIX standard function definitions - read(), close(), STDIN_FILENO
     #include <termios.h>        // POSIX terminal control definitions - tcgetattr(), tcsetattr()
-    #include <pthread.h>        // POSIX threads management (mouse input)
     #include <dirent.h>         // POSIX directory browsing
+    #include <sys/epoll.h>      // Linux: epoll_create1(), epoll_ctl(), epoll_wait() - Input devices events polling
 
     #include <sys/ioctl.h>      // UNIX System call for device-specific input/output operations - ioctl()
     #include <linux/kd.h>       // Linux: KDSKBMODE, K_MEDIUMRAM constants definition
@@ -251,6 +286,15 @@
     #include "GLES2/gl2.h"      // Khronos OpenGL ES 2.0 library
 #endif
 
+#if defined(PLATFORM_HEADLESS)
+    #include "EGL/egl.h"        // Khronos EGL library - Native platform display device control functions
+    #include "EGL/eglext.h"     // Khronos EGL library - Extensions (surfaceless and device platforms)
+
+    #if !defined(EGL_PLATFORM_SURFACELESS_MESA)
+        #define EGL_PLATFORM_SURFACELESS_MESA   0x31DD  // Not defined by older EGL headers
+    #endif
+#endif
+
 #if defined(PLATFORM_WEB)
     #define GLFW_INCLUDE_ES2        // GLFW3: Enable OpenGL ES 2.0 (translated to WebGL)
     #include <GLFW/glfw3.h>         // GLFW3 library: Windows, OpenGL context and Input management
@@ -258,12 +302,16 @@
 
     #include <emscripten/emscripten.h>  // Emscripten library - LLVM to JavaScript compiler
     #include <emscripten/html5.h>       // Emscripten HTML5 library
+#if defined(SUPPORT_WEB_WORKER)
+    #include <emscripten/threading.h>   // Emscripten threading library - Required for: emscripten_current_thread_process_queued_calls()
+#endif
 #endif
 
 #if defined(SUPPORT_COMPRESSION_API)
     // NOTE: Those declarations require stb_image and stb_image_write definitions, included in textures module
     unsigned char *stbi_zlib_compress(unsigned char *data, int data_len, int *out_len, int quality);
     char *stbi_zlib_decode_malloc(char const *buffer, int len, int *outlen);
+    int stbi_zlib_decode_buffer(char *obuffer, int olen, char const *ibuffer, int ilen);
 #endif
 
 //----------------------------------------------------------------------------------
@@ -290,15 +338,24 @@
 #define MAX_GAMEPAD_AXIS          8         // Max number of axis supported (per gamepad)
 
 #define MAX_CHARS_QUEUE           16        // Max number of characters in the input queue
+#define MAX_INPUT_EVENTS          512       // Max number of timestamped input events queued (GetInputEvent())
+
+#define MAX_FIXED_UPDATES         8         // Max number of fixed-rate update callbacks
+#define MAX_FIXED_UPDATE_STEPS    5         // Default max fixed update steps per frame (spiral-of-death clamping)
+
+#define RANDOM_BULK_LANES         8         // Independent generators interleaved on random values bulk fill (vectorized)
+#define RANDOM_BULK_CHUNK       256         // Random values generated per chunk on bulk fill conversions
 
 #define STORAGE_FILENAME        "storage.data"
 
+#define COMPRESSION_QUALITY_DEFLATE  8      // DEFLATE compression quality (CompressData(), CompressDataEx())
+
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
 #if defined(PLATFORM_RPI)
 typedef struct {
-    pthread_t threadId;                         // Event reading thread id
+    bool active;                                // Device opened and registered for events reading
     int fd;                                     // File descriptor to the device it is assigned to
     int eventNum;                               // Number of 'event<N>' device
     Rectangle absRange;                         // Range of values for absolute pointing devices (touchscreens)
@@ -308,7 +365,10 @@ typedef struct {
     bool isMultitouch;                          // True if device supports multiple absolute movevents and has BTN_TOUCH
     bool isKeyboard;                            // True if device has letter keycodes
     bool isGamepad;                             // True if device has gamepad buttons
-} InputEventWorker;
+    bool monotonicTime;                         // True if events are timestamped with monotonic clock (GetTime() clock)
+    bool touchDown[MAX_TOUCH_POINTS];           // Touch points down, queued as one event on sync report
+    bool touchMoved[MAX_TOUCH_POINTS];          // Touch points moved, queued as one event on sync report
+} InputDevice;
 
 typedef struct{
     int Contents[8];
@@ -317,6 +377,13 @@ typedef struct{
 } KeyEventFifo;
 #endif
 
+#if defined(PLATFORM_ANDROID) && defined(SUPPORT_ANDROID_FRAME_PACING)
+// Android Choreographer functions, loaded from libandroid.so (not available before Android 7.0, API 24)
+typedef void (*ChoreographerFrameCallback)(long frameTimeNanos, void *data);
+typedef void *(*ChoreographerGetInstanceFunc)(void);
+typedef void (*ChoreographerPostFrameCallbackFunc)(void *choreographer, ChoreographerFrameCallback callback, void *data);
+#endif
+
 //----------------------------------------------------------------------------------
 // Global Variables Definition
 //----------------------------------------------------------------------------------
@@ -326,19 +393,29 @@ typedef struct{
 #if defined(PLATFORM_DESKTOP) || defined(PLATFORM_WEB)
 static GLFWwindow *window;                      // Native window (graphic device)
 #endif
+#if defined(PLATFORM_WEB) && defined(SUPPORT_WEB_WORKER)
+static EMSCRIPTEN_WEBGL_CONTEXT_HANDLE webglContext = 0;   // WebGL context owned by main loop worker thread (OffscreenCanvas)
+static double baseTime = 0.0;                   // Base time measure for hi-res timer (milliseconds)
+static bool windowShouldClose = false;          // Flag to set window for closing
+#endif
+#if defined(PLATFORM_DESKTOP)
+static GLFWwindow *loaderWindow = NULL;         // Hidden window owning loader context (shared with window context)
+#endif
 #if defined(PLATFORM_RPI)
 static EGL_DISPMANX_WINDOW_T window;            // Native window (graphic device)
 #endif
 #if defined(PLATFORM_UWP)
 extern EGLNativeWindowType window;              // Native window handler for UWP (external, defined in UWP App)
 #endif
-#if defined(PLATFORM_ANDROID) || defined(PLATFORM_RPI) || defined(PLATFORM_UWP)
+#if defined(PLATFORM_ANDROID) || defined(PLATFORM_RPI) || defined(PLATFORM_UWP) || defined(PLATFORM_HEADLESS)
 static EGLDisplay display;                      // Native display device (physical screen connection)
 static EGLSurface surface;                      // Surface to draw on, framebuffers (connected to context)
 static EGLContext context;                      // Graphic context, mode in which drawing can be done
 static EGLConfig config;                        // Graphic config
 static uint64_t baseTime = 0;                   // Base time measure for hi-res timer
 static bool windowShouldClose = false;          // Flag to set window for closing
+static EGLContext loaderContext = EGL_NO_CONTEXT;   // Loader context (shared with graphic context)
+static EGLSurface loaderSurface = EGL_NO_SURFACE;   // Loader context 1x1 pbuffer surface (EGL_NO_SURFACE if surfaceless)
 #endif
 
 static const char *windowTitle = NULL;          // Window text title...
@@ -356,6 +433,35 @@ static int currentWidth, currentHeight;         // Current render width and heig
 static int renderOffsetX = 0;                   // Offset X from render area (must be divided by 2)
 static int renderOffsetY = 0;                   // Offset Y from render area (must be divided by 2)
 static Matrix screenScaling = { 0 };            // Matrix to scale screen (framebuffer rendering)
+
+#define MAX_CAMERA_CACHE            4       // Maximum cameras matrices cached (different cameras used in a frame)
+
+// Camera matrices cached for a camera and viewport size
+typedef struct CameraCacheEntry {
+    Camera camera;                  // Camera matrices are computed from
+    int width;                      // Viewport width used for projection aspect
+    int height;                     // Viewport height used for projection aspect
+    bool valid;                     // Entry has been computed
+    CameraMatrices matrices;        // Camera matrices and frustum planes
+} CameraCacheEntry;
+
+static CameraCacheEntry cameraCache[MAX_CAMERA_CACHE] = { 0 };  // Camera matrices cache
+static int cameraCacheNext = 0;                                 // Next camera cache entry to replace
+
+#define RESOLUTION_ADJUST_FRAMES    8       // Frames measured between dynamic resolution scale adjustments
+#define RESOLUTION_PROBE_WINDOWS    8       // Adjustments within budget before trying next scale step up
+#define RESOLUTION_SCALE_STEP    0.05f      // Dynamic resolution scale granularity (keeps pooled render targets reused)
+#define RESOLUTION_GPU_ZONE "Scaled frame"  // GPU timing zone measuring drawing to internal render target
+
+static bool resolutionScaling = false;          // Dynamic resolution enabled, drawing goes to internal render target
+static float resolutionScale = 1.0f;            // Internal render target scale relative to render area
+static float resolutionMinScale = 0.5f;         // Minimum internal render target scale
+static double resolutionBudget = 0.0;           // Frame time budget in seconds (0 uses target FPS frame time)
+static double resolutionTimeAccum = 0.0;        // Frame times measured since last scale adjustment
+static int resolutionTimeFrames = 0;            // Frames measured since last scale adjustment
+static int resolutionStableWindows = 0;         // Consecutive adjustments within budget
+static RenderTexture2D resolutionTarget = { 0 };    // Internal render target of current frame (pooled render texture)
+static bool resolutionTargetBound = false;      // Internal render target receiving drawing (no user render texture)
 //-----------------------------------------------------------------------------------
 
 #if defined(PLATFORM_ANDROID)
@@ -366,6 +472,15 @@ static const char *internalDataPath = NULL;     // Android internal data path to
 
 static bool appEnabled = true;                  // Used to detec if app is active
 static bool contextRebindRequired = false;      // Used to know context rebind required
+
+#if defined(SUPPORT_ANDROID_FRAME_PACING)
+static void *choreographer = NULL;              // Choreographer of main loop thread (display vsync callbacks), NULL if not available
+static ChoreographerPostFrameCallbackFunc choreographerPostFrameCallback = NULL;   // AChoreographer_postFrameCallback()
+static PFNEGLPRESENTATIONTIMEANDROIDPROC eglPresentationTime = NULL;    // EGL_ANDROID_presentation_time: eglPresentationTimeANDROID()
+static int64_t vsyncTime = 0;                   // Last display vsync time (nanoseconds, CLOCK_MONOTONIC)
+static int64_t vsyncPeriod = 0;                 // Display refresh period estimation (nanoseconds), 0 if not measured yet
+static int64_t presentTime = 0;                 // Last frame requested presentation time (nanoseconds, CLOCK_MONOTONIC)
+#endif
 #endif
 
 // Input system variables
@@ -378,6 +493,11 @@ static int exitKey = KEY_ESCAPE;                // Default exit key (ESC)
 static unsigned int keyPressedQueue[MAX_CHARS_QUEUE] = { 0 }; // Input characters queue
 static int keyPressedQueueCount = 0;             // Input characters queue count
 
+static InputEvent inputEvents[MAX_INPUT_EVENTS] = { 0 };    // Input events queue (ring buffer, oldest at head)
+static int inputEventsHead = 0;                 // Input events queue head (oldest event)
+static int inputEventsCount = 0;                // Input events queued count
+static int inputEventsDropped = 0;              // Input events dropped (oldest overwritten) on full queue
+
 #if defined(PLATFORM_RPI)
 // NOTE: For keyboard we will use the standard input (but reconfigured...)
 static struct termios defaultKeyboardSettings;  // Used to store default keyboard settings
@@ -392,7 +512,14 @@ static bool cursorHidden = false;               // Track if cursor is hidden
 static bool cursorOnScreen = false;             // Tracks if cursor is inside client area
 static Vector2 touchPosition[MAX_TOUCH_POINTS]; // Touch position on screen
 
-#if defined(PLATFORM_DESKTOP) || defined(PLATFORM_RPI) || defined(PLATFORM_WEB) || defined(PLATFORM_UWP)
+#if defined(SUPPORT_GESTURES_SYSTEM)
+#define MAX_GESTURE_EVENTS         64       // Maximum gesture events queued between input polls
+
+static GestureEvent gestureEvents[MAX_GESTURE_EVENTS];  // Gesture events queued, processed as a batch on PollInputEvents()
+static int gestureEventsCount = 0;              // Gesture events queued count
+#endif
+
+#if defined(PLATFORM_DESKTOP) || defined(PLATFORM_RPI) || defined(PLATFORM_WEB) || defined(PLATFORM_UWP) || defined(PLATFORM_HEADLESS)
 static char previousMouseState[3] = { 0 };      // Registers previous mouse button state
 static char currentMouseState[3] = { 0 };       // Registers current mouse button state
 static int previousMouseWheelY = 0;             // Registers previous mouse wheel variation
@@ -400,8 +527,10 @@ static int currentMouseWheelY = 0;              // Registers current mouse wheel
 #endif
 
 #if defined(PLATFORM_RPI)
-static char currentMouseStateEvdev[3] = { 0 };  // Holds the new mouse state for the next polling event to grab (Can't be written directly due to multithreading, app could miss the update)
-static InputEventWorker eventWorkers[10];       // List of worker threads for every monitored "/dev/input/event<N>"
+static char currentMouseStateEvdev[3] = { 0 };  // Holds the new mouse state read from input devices, registered as current state after reading
+static InputDevice inputDevices[10];            // List of input devices for every monitored "/dev/input/event<N>"
+static int inputEpollFd = -1;                   // Input devices (evdev and gamepads) events polling descriptor (epoll)
+static double inputEventTime = -1.0;            // Kernel timestamp of input event being processed, -1 if not available
 static KeyEventFifo lastKeyPressedEvdev = { 0 }; // Buffer for holding keydown events as they arrive (Needed due to multitreading of event workers)
 static char currentKeyStateEvdev[512] = { 0 };   // Registers current frame key state from event based driver (Needs to be seperate because the legacy console based method clears keys on every frame)
 #endif
@@ -414,7 +543,7 @@ static bool toggleCursorLock = false;           // Ask for cursor pointer lock o
 static int lastGamepadButtonPressed = -1;       // Register last gamepad button pressed
 static int gamepadAxisCount = 0;                // Register number of available gamepad axis
 
-#if defined(PLATFORM_DESKTOP) || defined(PLATFORM_RPI) || defined(PLATFORM_WEB) || defined(PLATFORM_UWP)
+#if defined(PLATFORM_DESKTOP) || defined(PLATFORM_RPI) || defined(PLATFORM_WEB) || defined(PLATFORM_UWP) || defined(PLATFORM_HEADLESS)
 static bool gamepadReady[MAX_GAMEPADS] = { false };             // Flag to know if gamepad is ready
 static float gamepadAxisState[MAX_GAMEPADS][MAX_GAMEPAD_AXIS];  // Gamepad axis state
 static char previousGamepadState[MAX_GAMEPADS][MAX_GAMEPAD_BUTTONS];    // Previous gamepad buttons state
@@ -423,7 +552,6 @@ static char currentGamepadState[MAX_GAMEPADS][MAX_GAMEPAD_BUTTONS];     // Curre
 
 #if defined(PLATFORM_RPI)
 static int gamepadStream[MAX_GAMEPADS] = { -1 };// Gamepad device file descriptor
-static pthread_t gamepadThreadId;               // Gamepad reading thread id
 static char gamepadName[64];                    // Gamepad name holder
 #endif
 
@@ -438,26 +566,163 @@ static double updateTime = 0.0;             // Time measure for frame update
 static double drawTime = 0.0;               // Time measure for frame draw
 static double frameTime = 0.0;              // Time measure for one frame
 static double targetTime = 0.0;             // Desired time for one frame, if 0 not applied
+
+#if defined(SUPPORT_BUSY_WAIT_LOOP)
+static int framePacingMode = FRAME_PACING_BUSY;     // Frame pacing mode (FramePacingMode)
+#elif defined(SUPPORT_HALFBUSY_WAIT_LOOP)
+static int framePacingMode = FRAME_PACING_HYBRID;   // Frame pacing mode (FramePacingMode)
+#elif defined(PLATFORM_ANDROID) && defined(SUPPORT_ANDROID_FRAME_PACING)
+static int framePacingMode = FRAME_PACING_DISPLAY;  // Frame pacing mode (FramePacingMode)
+#else
+static int framePacingMode = FRAME_PACING_SLEEP;    // Frame pacing mode (FramePacingMode)
+#endif
+static double sleepTimeEstimate = 0.002;    // Estimated time of one sleep step, hybrid pacing spins under it
+static double sleepTimeMean = 0.001;        // Measured sleep step time mean
+static double sleepTimeM2 = 0.0;            // Measured sleep step time squared deviations sum
+static int sleepTimeCount = 1;              // Measured sleep steps count
+static FrameTimeHistogram frameHistogram = { 0 };   // Frame times measured since last GetFrameTimeHistogram()
+#if defined(_WIN32)
+static void *waitableTimer = NULL;          // High-resolution waitable timer handle (Windows 10 1803+)
+#endif
+
+// Fixed-rate update, callback is called every fixed time step on BeginDrawing()
+typedef struct FixedUpdate {
+    FixedUpdateCallback callback;   // Update callback (NULL if slot not used)
+    void *userData;                 // Callback user data
+    double step;                    // Fixed time step (seconds)
+    double accumulator;             // Elapsed time not yet simulated (seconds)
+    double time;                    // Last scheduling time
+    int stepsDropped;               // Steps skipped by max steps per frame clamping
+} FixedUpdate;
+
+static FixedUpdate fixedUpdates[MAX_FIXED_UPDATES] = { 0 };     // Fixed-rate updates, id is index + 1
+static int fixedUpdateMaxSteps = MAX_FIXED_UPDATE_STEPS;        // Max fixed update steps per frame
+
+#if defined(SUPPORT_EVENTS_WAITING)
+static bool eventWaiting = true;            // Wait for events passively on PollInputEvents() instead of polling
+#else
+static bool eventWaiting = false;           // Wait for events passively on PollInputEvents() instead of polling
+#endif
+static double eventWaitingTimeout = 0.0;    // Max time waiting for events (seconds), 0 waits without timeout
+static volatile bool redrawRequested = false;   // Redraw requested, next events waiting returns immediately (any thread)
+static bool inputLateLatching = false;      // Poll input events after frame wait instead of after buffers swap
+static int swapInterval = 0;                // Buffers swap interval (0: no V-Sync, 1: V-Sync, -1: adaptive V-Sync)
 //-----------------------------------------------------------------------------------
 
 // Config internal variables
 //-----------------------------------------------------------------------------------
 static unsigned int configFlags = 0;        // Configuration flags (bit based)
 
+static RandomState randomState = { { 0x9e3779b9, 0x243f6a88, 0xb7e15162, 0x85a308d3 } };  // GetRandomValue() generator state (seeded on InitWindow())
+
 static char **dropFilesPath;                // Store dropped files paths as strings
 static int dropFilesCount = 0;              // Count dropped files strings
 
-static char **dirFilesPath;                 // Store directory files paths as strings
+static char **dirFilesPath = NULL;          // Store directory files paths as strings
 static int dirFilesCount = 0;               // Count directory files strings
 
+static CommandList *recordingList = NULL;   // Command list being recorded (BeginCommandList())
+
 #if defined(SUPPORT_SCREEN_CAPTURE)
 static int screenshotCounter = 0;           // Screenshots counter
 #endif
 
+static unsigned int screenshotRequest = 0;  // Screenshot pending screen readback request (0 if none)
+static char screenshotPath[512] = { 0 };    // Screenshot pending file path
+static int screenshotWidth = 0;             // Screenshot pending width
+static int screenshotHeight = 0;            // Screenshot pending height
+
+#define MAX_SCREENSHOT_SAVES        2       // Maximum screenshots saved at the same time on worker threads
+
+// Screenshot saved on worker thread, screen data owned by the job
+typedef struct ScreenshotSave {
+    unsigned char *data;        // Screen pixels data (RGBA)
+    int width;                  // Screenshot width
+    int height;                 // Screenshot height
+    char path[512];             // Screenshot file path
+} ScreenshotSave;
+
+static int screenshotSavesPending = 0;      // Screenshots saving worker jobs pending counter
+
 #if defined(SUPPORT_GIF_RECORDING)
+#define MAX_GIF_FRAME_REQUESTS      4       // Maximum GIF frames pending screen readback
+#define MAX_GIF_QUEUED_FRAMES       8       // Maximum GIF frames queued for encoding (worker thread)
+
 static int gifFramesCounter = 0;            // GIF frames counter
 static bool gifRecording = false;           // GIF recording state
-#endif
+static unsigned int gifFrameRequests[MAX_GIF_FRAME_REQUESTS] = { 0 };  // GIF frames pending screen readback requests (oldest first)
+static int gifFrameRequestsCount = 0;       // GIF frames pending screen readback requests counter
+
+static unsigned char *gifQueuedFrames[MAX_GIF_QUEUED_FRAMES] = { 0 };     // GIF frames queued for encoding (screen size)
+static int gifQueuedFramesCount = 0;        // GIF frames queued counter
+static unsigned char *gifEncodingFrames[MAX_GIF_QUEUED_FRAMES] = { 0 };   // GIF frames being encoded (owned by worker job)
+static int gifEncodingFramesCount = 0;      // GIF frames being encoded counter
+static int gifEncodingPending = 0;          // GIF encoding worker job pending counter
+static int gifDownscale = 1;                // GIF frames downscale divider (SetGifRecordingOptions())
+static bool gifFixedPalette = false;        // GIF palette computed once and reused (SetGifRecordingOptions())
+static int gifWidth = 0;                    // GIF recording width (screen size downscaled)
+static int gifHeight = 0;                   // GIF recording height (screen size downscaled)
+static int gifSourceWidth = 0;              // GIF recording frames source width (screen width)
+#endif
+
+#define STORAGE_FILE_VERSION        1       // Storage file format version (keyed values)
+#define MAX_STORAGE_KEY_LENGTH    255       // Maximum storage value key length
+
+// Storage keyed value types
+typedef enum {
+    STORAGE_VALUE_INT = 0,
+    STORAGE_VALUE_FLOAT,
+    STORAGE_VALUE_STRING
+} StorageValueType;
+
+// Storage keyed value, kept in memory until flushed to storage file
+typedef struct StorageEntry {
+    char *key;                  // Value key
+    int type;                   // Value type (StorageValueType)
+    int intValue;               // Integer value
+    float floatValue;           // Float value
+    char *text;                 // String value
+} StorageEntry;
+
+static bool storageLoaded = false;          // Storage file loaded in memory (on first storage access)
+static bool storageDirty = false;           // Storage values modified since last flush (StorageFlush())
+static int *storageValues = NULL;           // Storage positional integer values (StorageSaveValue())
+static int storageValuesCount = 0;          // Storage positional integer values count
+static StorageEntry *storageEntries = NULL; // Storage keyed values
+static int storageEntriesCount = 0;         // Storage keyed values count
+
+// Directory opened for reading (one per directory depth level)
+typedef struct DirectoryLevel {
+    DIR *dir;                   // Directory stream
+    int pathLength;             // Directory path length (prefix of entries path)
+} DirectoryLevel;
+
+// Directory reading internal data (OpenDirectory())
+typedef struct DirectoryData {
+    DirectoryLevel *levels;     // Open directories, opened directory first (subdirectories on recursive reading)
+    int levelsCount;            // Open directories count
+    int levelsCapacity;         // Open directories array size
+    char *path;                 // Last entry path (directories paths are prefixes)
+    int pathCapacity;           // Path buffer size
+    char *filters;              // Filter extensions (lower case, no dot, NULL terminated each)
+    int *filterStarts;          // Filter extensions start in filters string
+    int filtersCount;           // Filter extensions count
+} DirectoryData;
+
+#define COMPRESS_STREAM_BLOCK_SIZE  65536   // Compression stream block size, data is compressed by independent blocks
+#define COMPRESS_BLOCK_STORED  0x80000000   // Compression stream block stored uncompressed (flag on block compressed size)
+
+// Compression stream internal data
+// NOTE: Stream blocks are written as: uint32 size, uint32 compressed size (COMPRESS_BLOCK_STORED flag), compressed data
+typedef struct CompressStreamData {
+    unsigned char *input;       // Input data pending (block data to compress or compressed blocks to decompress)
+    int inputLength;            // Input data pending size
+    int inputCapacity;          // Input buffer size
+    unsigned char *output;      // Output data available to read
+    int outputLength;           // Output data size (read data included)
+    int outputRead;             // Output data already read
+    int outputCapacity;         // Output buffer size
+} CompressStreamData;
 //-----------------------------------------------------------------------------------
 
 //----------------------------------------------------------------------------------
@@ -466,24 +731,70 @@ static bool gifRecording = false;           // GIF recording state
 #if defined(SUPPORT_DEFAULT_FONT)
 extern void LoadFontDefault(void);          // [Module: text] Loads default font on InitWindow()
 extern void UnloadFontDefault(void);        // [Module: text] Unloads default font from GPU memory
+extern void FlushTransparentQueue(void);    // [Module: models] Draws transparent queue items sorted by depth
+extern void UpdateImagesAsync(void);        // [Module: textures] Delivers images loaded asynchronously to callbacks
+#endif
+extern void UpdateTextureResidency(void);    // [Module: textures] Evicts least recently used textures over VRAM budget
+extern void UpdateTexturesProgressive(void); // [Module: textures] Uploads progressive textures mipmaps within per-frame budget
+#if defined(SUPPORT_IMAGE_EXPORT) && defined(SUPPORT_FILEFORMAT_PNG)
+extern int SavePNG(const char *fileName, const unsigned char *data, int width, int height, int channels);  // [Module: textures] Saves PNG file (worker threads safe)
 #endif
 
 //----------------------------------------------------------------------------------
 // Module specific Functions Declaration
 //----------------------------------------------------------------------------------
 static bool InitGraphicsDevice(int width, int height);  // Initialize graphics device
+#if defined(PLATFORM_HEADLESS)
+static bool InitHeadlessDevice(void);                   // Initialize EGL offscreen display, context and surface (no display server)
+static EGLDisplay GetHeadlessDisplay(void);             // Get EGL display without display server (surfaceless or device platforms)
+#endif
 static void SetupFramebuffer(int width, int height);    // Setup main framebuffer
 static void SetupViewport(int width, int height);       // Set viewport for a provided width and height
+static const CameraMatrices *GetCameraMatricesCached(Camera camera, int width, int height);  // Get camera matrices, computed only if camera or viewport changed
+static void BeginResolutionTarget(void);                // Begin drawing to internal render target (dynamic resolution)
+static void EnableResolutionTarget(void);               // Bind internal render target, viewport and projection for scaled drawing
+static void EndResolutionTarget(void);                  // End drawing to internal render target and upscale it to screen
+static void UpdateResolutionScale(double frameTime);    // Adjust internal render target scale from measured frame time
+static unsigned int RandomRotl(unsigned int x, int k);  // Rotate left 32 bit value (random generator)
+static unsigned long long SplitMix64(unsigned long long *x); // Get next splitmix64 value (random generator seeding)
+static void GetRandomBulk(RandomState *state, unsigned int *values, int count); // Fill random 32 bit values from interleaved generators (vectorized)
 static void SwapBuffers(void);                          // Copy back buffer to front buffers
+static void UpdateScreenCaptures(bool wait);            // Collect asynchronous screen readbacks (screenshot and GIF frames)
+static void ExportScreenshot(unsigned char *imgData, int width, int height, const char *path);  // Export screenshot image data to file, data is freed
+#if defined(SUPPORT_IMAGE_EXPORT) && defined(SUPPORT_FILEFORMAT_PNG)
+static void SaveScreenshotJob(void *data);              // Worker job: save PNG screenshot (ScreenshotSave)
+#endif
+#if defined(SUPPORT_GIF_RECORDING)
+static void QueueGifFrame(unsigned char *frame);        // Queue GIF frame for encoding (frame data owned by encoder)
+static void UpdateGifEncoder(bool wait);                // Submit queued GIF frames to encoder worker job (wait for all frames if required)
+static void EncodeGifFramesJob(void *data);             // Worker job: downscale, quantize and encode GIF frames
+#endif
 
 static void InitTimer(void);                            // Initialize timer
 static void Wait(float ms);                             // Wait for some milliseconds (stop program execution)
+static void WaitSleep(double seconds);                  // Sleep for some time, using high-resolution timer if available
+static void UpdateFrameTimeHistogram(double time, bool waited, double waitError);  // Register frame time on histogram
+static void UpdateFixedSteps(void);                     // Run fixed-rate update callbacks for elapsed time
+
+static const char *GetStoragePath(void);                // Get storage file path (internal data path on Android)
+static void LoadStorage(void);                          // Load storage file values in memory (once)
+static StorageEntry *GetStorageEntry(const char *key, int type, bool create);  // Get storage keyed value (created if required)
+static void UnloadStorage(void);                        // Release storage values from memory
+static unsigned char *GetCompressStreamOutput(CompressStreamData *data, int size); // Get compression stream output space (size bytes appended)
+static void CompressStreamBlock(CompressStream stream);             // Compress stream input block into output
 
 static bool GetKeyStatus(int key);                      // Returns if a key has been pressed
 static bool GetMouseButtonStatus(int button);           // Returns if a mouse button has been pressed
 static int GetGamepadButton(int button);                // Get gamepad button generic to all platforms
 static int GetGamepadAxis(int axis);                    // Get gamepad axis generic to all platforms
 static void PollInputEvents(void);                      // Register user events
+#if defined(SUPPORT_GESTURES_SYSTEM)
+static void QueueGestureEvent(GestureEvent event);      // Queue gesture event to be processed on next input poll
+#endif
+static void PushInputEvent(int type, int code, int device, Vector2 value);  // Queue timestamped input event
+#if defined(PLATFORM_DESKTOP) || defined(PLATFORM_WEB)
+static void PushGamepadButtonEvents(int gamepad);       // Queue gamepad buttons changes events (polled gamepads)
+#endif
 
 #if defined(PLATFORM_DESKTOP) || defined(PLATFORM_WEB)
 static void ErrorCallback(int error, const char *description);                             // GLFW3 Error Callback, runs on GLFW3 error
@@ -501,6 +812,13 @@ static void WindowDropCallback(GLFWwindow *window, int count, const char **paths
 #if defined(PLATFORM_ANDROID)
 static void AndroidCommandCallback(struct android_app *app, int32_t cmd);                  // Process Android activity lifecycle commands
 static int32_t AndroidInputCallback(struct android_app *app, AInputEvent *event);          // Process Android inputs
+static void SetSustainedPerformanceMode(bool enabled);                                    // Request window sustained performance mode (FLAG_SUSTAINED_PERFORMANCE)
+#if defined(SUPPORT_ANDROID_FRAME_PACING)
+static void InitDisplayPacing(void);                                                      // Init display frame pacing: Choreographer vsync callbacks and EGL presentation time
+static void ChoreographerCallback(long frameTimeNanos, void *data);                       // Register display vsync time, posted again for next vsync
+static bool IsDisplayPacingActive(void);                                                  // Check if frames are paced on display vsync (FRAME_PACING_DISPLAY)
+static void UpdateDisplayPacing(void);                                                    // Set current frame presentation time on display vsync
+#endif
 #endif
 
 #if defined(PLATFORM_WEB)
@@ -509,6 +827,11 @@ static EM_BOOL EmscriptenKeyboardCallback(int eventType, const EmscriptenKeyboar
 static EM_BOOL EmscriptenMouseCallback(int eventType, const EmscriptenMouseEvent *mouseEvent, void *userData);
 static EM_BOOL EmscriptenTouchCallback(int eventType, const EmscriptenTouchEvent *touchEvent, void *userData);
 static EM_BOOL EmscriptenGamepadCallback(int eventType, const EmscriptenGamepadEvent *gamepadEvent, void *userData);
+#if defined(SUPPORT_WEB_WORKER)
+static EM_BOOL EmscriptenWorkerKeyCallback(int eventType, const EmscriptenKeyboardEvent *keyEvent, void *userData);
+static EM_BOOL EmscriptenWorkerMouseCallback(int eventType, const EmscriptenMouseEvent *mouseEvent, void *userData);
+static EM_BOOL EmscriptenWorkerWheelCallback(int eventType, const EmscriptenWheelEvent *wheelEvent, void *userData);
+#endif
 #endif
 
 #if defined(PLATFORM_RPI)
@@ -522,16 +845,27 @@ static void RestoreTerminal(void);                      // Restore terminal
 #endif
 
 static void InitEvdevInput(void);                       // Evdev inputs initialization
-static void EventThreadSpawn(char *device);             // Identifies a input device and spawns a thread to handle it if needed
-static void *EventThread(void *arg);                    // Input device events reading thread
+static void OpenInputDevice(char *path);                // Identifies a input device and registers it for events reading if needed
+static void CloseInputDevice(InputDevice *device);      // Unregister and close input device
+static void ProcessInputDevices(void);                  // Read input devices pending events (main thread, no blocking)
+static void ProcessInputDeviceEvents(InputDevice *device);  // Read and process input device pending events
 
 static void InitGamepad(void);                          // Init raw gamepad input
-static void *GamepadThread(void *arg);                  // Mouse reading thread
+static void ProcessGamepadEvents(int gamepad);          // Read and process gamepad pending events
 #endif  // PLATFORM_RPI
 
 #if defined(_WIN32)
     // NOTE: We include Sleep() function signature here to avoid windows.h inclusion
     void __stdcall Sleep(unsigned long msTimeout);      // Required for Wait()
+
+    // NOTE: Waitable timers signatures, LARGE_INTEGER due time is passed as 64bit integer
+    // NOTE: Storage file is replaced atomically with MoveFileExA(), MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH
+    int __stdcall MoveFileExA(const char *lpExistingFileName, const char *lpNewFileName, unsigned long dwFlags);
+
+    void *__stdcall CreateWaitableTimerExW(void *lpTimerAttributes, const unsigned short *lpTimerName, unsigned long dwFlags, unsigned long dwDesiredAccess);
+    int __stdcall SetWaitableTimer(void *hTimer, const long long *lpDueTime, long lPeriod, void *pfnCompletionRoutine, void *lpArgToCompletionRoutine, int fResume);
+    unsigned long __stdcall WaitForSingleObject(void *hHandle, unsigned long dwMilliseconds);
+    int __stdcall CloseHandle(void *hObject);
 #endif
 
 //----------------------------------------------------------------------------------
@@ -610,6 +944,8 @@ void InitWindow(int width, int height, const char *title)
 {
     TraceLog(LOG_INFO, "Initializing raylib %s", RAYLIB_VERSION);
 
+    InitScratchMemory();            // Create scratch memory arena, owned by main thread
+
     windowTitle = title;
 #if defined(PLATFORM_ANDROID)
     screenWidth = width;
@@ -624,6 +960,9 @@ void InitWindow(int width, int height, const char *title)
     ANativeActivity_setWindowFlags(androidApp->activity, AWINDOW_FLAG_FULLSCREEN, 0);  //AWINDOW_FLAG_SCALED, AWINDOW_FLAG_DITHER
     //ANativeActivity_setWindowFlags(androidApp->activity, AWINDOW_FLAG_FORCE_NOT_FULLSCREEN, AWINDOW_FLAG_FULLSCREEN);
 
+    // Steady device clocks for long sessions instead of thermal throttling swings
+    if (configFlags & FLAG_SUSTAINED_PERFORMANCE) SetSustainedPerformanceMode(true);
+
     int orientation = AConfiguration_getOrientation(androidApp->config);
 
     if (orientation == ACONFIGURATION_ORIENTATION_PORT) TraceLog(LOG_INFO, "PORTRAIT window orientation");
@@ -666,6 +1005,10 @@ void InitWindow(int width, int height, const char *title)
             //if (androidApp->destroyRequested != 0) windowShouldClose = true;
         }
     }
+
+#if defined(SUPPORT_ANDROID_FRAME_PACING)
+    InitDisplayPacing();    // Display vsync callbacks registered on main loop thread looper
+#endif
 #else
     // Init graphics device (display device and OpenGL context)
     // NOTE: returns true if window and graphic device has been initialized successfully
@@ -710,6 +1053,18 @@ void InitWindow(int width, int height, const char *title)
     // Support gamepad events (not provided by GLFW3 on emscripten)
     emscripten_set_gamepadconnected_callback(NULL, 1, EmscriptenGamepadCallback);
     emscripten_set_gamepaddisconnected_callback(NULL, 1, EmscriptenGamepadCallback);
+
+#if defined(SUPPORT_WEB_WORKER)
+    // Support keyboard and mouse events (not provided by GLFW3 on worker thread)
+    // NOTE: Events are queued to this thread and dispatched on PollInputEvents()
+    emscripten_set_keydown_callback(EMSCRIPTEN_EVENT_TARGET_WINDOW, NULL, 1, EmscriptenWorkerKeyCallback);
+    emscripten_set_keyup_callback(EMSCRIPTEN_EVENT_TARGET_WINDOW, NULL, 1, EmscriptenWorkerKeyCallback);
+    emscripten_set_keypress_callback(EMSCRIPTEN_EVENT_TARGET_WINDOW, NULL, 1, EmscriptenWorkerKeyCallback);
+    emscripten_set_mousedown_callback("#canvas", NULL, 1, EmscriptenWorkerMouseCallback);
+    emscripten_set_mouseup_callback("#canvas", NULL, 1, EmscriptenWorkerMouseCallback);
+    emscripten_set_mousemove_callback("#canvas", NULL, 1, EmscriptenWorkerMouseCallback);
+    emscripten_set_wheel_callback("#canvas", NULL, 1, EmscriptenWorkerWheelCallback);
+#endif
 #endif
 
     mousePosition.x = (float)screenWidth/2.0f;
@@ -720,9 +1075,13 @@ void InitWindow(int width, int height, const char *title)
 // Close window and unload OpenGL context
 void CloseWindow(void)
 {
+    UpdateScreenCaptures(true);     // Wait for pending screenshot and GIF frames
+    WaitWorkerJobs(&screenshotSavesPending);    // Wait for screenshots being saved
+
 #if defined(SUPPORT_GIF_RECORDING)
     if (gifRecording)
     {
+        UpdateGifEncoder(true);     // Wait for queued GIF frames encoding
         GifEnd();
         gifRecording = false;
     }
@@ -732,18 +1091,35 @@ void CloseWindow(void)
     UnloadFontDefault();
 #endif
 
+    StorageFlush();             // Write storage values modified
+    UnloadStorage();
+
     rlglClose();                // De-init rlgl
 
-#if defined(PLATFORM_DESKTOP) || defined(PLATFORM_WEB)
+    CloseWorkerThreads();       // Stop worker threads (queued jobs are finished)
+    CloseFileWatches();         // Stop watching files (asset hot reload and WatchFile())
+    CloseProfiler();            // Release recorded CPU profile zones
+    CloseScratchMemory();       // Release scratch memory arena
+    CloseLoaderContext();       // Destroy loader shared context (if initialized)
+
+#if defined(PLATFORM_DESKTOP) || (defined(PLATFORM_WEB) && !defined(SUPPORT_WEB_WORKER))
     glfwDestroyWindow(window);
     glfwTerminate();
 #endif
 
-#if !defined(SUPPORT_BUSY_WAIT_LOOP) && defined(_WIN32)
+#if defined(PLATFORM_WEB) && defined(SUPPORT_WEB_WORKER)
+    emscripten_webgl_destroy_context(webglContext);
+    webglContext = 0;
+#endif
+
+#if defined(_WIN32)
     timeEndPeriod(1);           // Restore time period
+
+    if (waitableTimer != NULL) CloseHandle(waitableTimer);
+    waitableTimer = NULL;
 #endif
 
-#if defined(PLATFORM_ANDROID) || defined(PLATFORM_RPI) || defined(PLATFORM_UWP)
+#if defined(PLATFORM_ANDROID) || defined(PLATFORM_RPI) || defined(PLATFORM_UWP) || defined(PLATFORM_HEADLESS)
     // Close surface, context and display
     if (display != EGL_NO_DISPLAY)
     {
@@ -767,21 +1143,20 @@ void CloseWindow(void)
 #endif
 
 #if defined(PLATFORM_RPI)
-    // Wait for mouse and gamepad threads to finish before closing
-    // NOTE: Those threads should already have finished at this point
-    // because they are controlled by windowShouldClose variable
-
-    windowShouldClose = true;   // Added to force threads to exit when the close window is called
+    // Close input devices and gamepads
+    for (int i = 0; i < sizeof(inputDevices)/sizeof(InputDevice); ++i)
+    {
+        if (inputDevices[i].active) CloseInputDevice(&inputDevices[i]);
+    }
 
-    for (int i = 0; i < sizeof(eventWorkers)/sizeof(InputEventWorker); ++i)
+    for (int i = 0; i < MAX_GAMEPADS; i++)
     {
-        if (eventWorkers[i].threadId)
-        {
-            pthread_join(eventWorkers[i].threadId, NULL);
-        }
+        if (gamepadReady[i]) close(gamepadStream[i]);
+        gamepadReady[i] = false;
     }
 
-    if (gamepadThreadId) pthread_join(gamepadThreadId, NULL);
+    if (inputEpollFd >= 0) close(inputEpollFd);
+    inputEpollFd = -1;
 #endif
 
     TraceLog(LOG_INFO, "Window closed successfully");
@@ -796,7 +1171,11 @@ bool IsWindowReady(void)
 // Check if KEY_ESCAPE pressed or Close icon pressed
 bool WindowShouldClose(void)
 {
-#if defined(PLATFORM_WEB)
+#if defined(PLATFORM_WEB) && defined(SUPPORT_WEB_WORKER)
+    // NOTE: Main loop runs on a worker thread, it can block without yielding to the browser
+    if (windowReady) return windowShouldClose;
+    else return true;
+#elif defined(PLATFORM_WEB)
     // Emterpreter-Async required to run sync code
     // https://github.com/emscripten-core/emscripten/wiki/Emterpreter#emterpreter-async-run-synchronous-code
     // By default, this function is never called on a web-ready raylib example because we encapsulate
@@ -817,7 +1196,7 @@ bool WindowShouldClose(void)
     else return true;
 #endif
 
-#if defined(PLATFORM_ANDROID) || defined(PLATFORM_RPI) || defined(PLATFORM_UWP)
+#if defined(PLATFORM_ANDROID) || defined(PLATFORM_RPI) || defined(PLATFORM_UWP) || defined(PLATFORM_HEADLESS)
     if (windowReady) return windowShouldClose;
     else return true;
 #endif
@@ -877,7 +1256,7 @@ void ToggleFullscreen(void)
         
         // Try to enable GPU V-Sync, so frames are limited to screen refresh rate (60Hz -> 60 FPS)
         // NOTE: V-Sync can be enabled by graphic driver configuration
-        if (configFlags & FLAG_VSYNC_HINT) glfwSwapInterval(1);
+        if (swapInterval != 0) glfwSwapInterval(swapInterval);
     }
     else glfwSetWindowMonitor(window, NULL, windowPositionX, windowPositionY, screenWidth, screenHeight, GLFW_DONT_CARE);
 #endif
@@ -1009,6 +1388,137 @@ void *GetWindowHandle(void)
 #endif
 }
 
+// Initialize graphics context for a resources loader thread, sharing objects with window context
+// NOTE: Must be called from main thread after InitWindow(), loader thread makes it current with BeginLoaderContext()
+bool InitLoaderContext(void)
+{
+    if (!windowReady)
+    {
+        TraceLog(LOG_WARNING, "Loader context requires window initialized");
+        return false;
+    }
+
+#if defined(PLATFORM_DESKTOP)
+    if (loaderWindow != NULL) return true;
+
+    // NOTE: Context hints set on InitGraphicsDevice() are kept, window is never shown
+    glfwWindowHint(GLFW_VISIBLE, GL_FALSE);
+    loaderWindow = glfwCreateWindow(1, 1, "", NULL, window);
+
+    if (loaderWindow == NULL)
+    {
+        TraceLog(LOG_WARNING, "Failed to create loader shared context");
+        return false;
+    }
+#elif defined(PLATFORM_ANDROID) || defined(PLATFORM_RPI) || defined(PLATFORM_UWP) || defined(PLATFORM_HEADLESS)
+    if (loaderContext != EGL_NO_CONTEXT) return true;
+
+#if defined(GRAPHICS_API_OPENGL_ES2)
+    const EGLint contextAttribs[] = { EGL_CONTEXT_CLIENT_VERSION, 2, EGL_NONE };
+#elif defined(GRAPHICS_API_OPENGL_33) && !defined(GRAPHICS_API_OPENGL_21)
+    const EGLint contextAttribs[] =
+    {
+        EGL_CONTEXT_MAJOR_VERSION, 3,
+        EGL_CONTEXT_MINOR_VERSION, 3,
+        EGL_CONTEXT_OPENGL_PROFILE_MASK, EGL_CONTEXT_OPENGL_CORE_PROFILE_BIT,
+        EGL_NONE
+    };
+#else
+    const EGLint contextAttribs[] = { EGL_NONE };
+#endif
+
+    loaderContext = eglCreateContext(display, config, context, contextAttribs);
+
+    if (loaderContext == EGL_NO_CONTEXT)
+    {
+        TraceLog(LOG_WARNING, "Failed to create loader shared context");
+        return false;
+    }
+
+    // NOTE: Window configs could not support pbuffers, context is made current surfaceless then
+    EGLint surfaceType = 0;
+    eglGetConfigAttrib(display, config, EGL_SURFACE_TYPE, &surfaceType);
+
+    if (surfaceType & EGL_PBUFFER_BIT)
+    {
+        const EGLint pbufferAttribs[] = { EGL_WIDTH, 1, EGL_HEIGHT, 1, EGL_NONE };
+        loaderSurface = eglCreatePbufferSurface(display, config, pbufferAttribs);
+    }
+#else
+    TraceLog(LOG_WARNING, "Loader context not supported on this platform");
+    return false;
+#endif
+
+    TraceLog(LOG_INFO, "Loader shared context initialized successfully");
+    return true;
+}
+
+// Close loader context, it must not be current on loader thread
+void CloseLoaderContext(void)
+{
+#if defined(PLATFORM_DESKTOP)
+    if (loaderWindow != NULL) glfwDestroyWindow(loaderWindow);
+    loaderWindow = NULL;
+#elif defined(PLATFORM_ANDROID) || defined(PLATFORM_RPI) || defined(PLATFORM_UWP) || defined(PLATFORM_HEADLESS)
+    if (loaderSurface != EGL_NO_SURFACE) eglDestroySurface(display, loaderSurface);
+    if (loaderContext != EGL_NO_CONTEXT) eglDestroyContext(display, loaderContext);
+    loaderSurface = EGL_NO_SURFACE;
+    loaderContext = EGL_NO_CONTEXT;
+#endif
+}
+
+// Make loader context current on calling thread, textures, shaders and meshes can be loaded
+// NOTE: Loaded meshes require rlLoadMeshVertexArray() on main thread before drawing (vertex arrays are not shared)
+void BeginLoaderContext(void)
+{
+#if defined(PLATFORM_DESKTOP)
+    if (loaderWindow == NULL)
+    {
+        TraceLog(LOG_WARNING, "Loader context not initialized, call InitLoaderContext()");
+        return;
+    }
+
+    glfwMakeContextCurrent(loaderWindow);
+#elif defined(PLATFORM_ANDROID) || defined(PLATFORM_RPI) || defined(PLATFORM_UWP) || defined(PLATFORM_HEADLESS)
+    if (loaderContext == EGL_NO_CONTEXT)
+    {
+        TraceLog(LOG_WARNING, "Loader context not initialized, call InitLoaderContext()");
+        return;
+    }
+
+    // NOTE: Rendering API is bound per thread
+#if defined(PLATFORM_HEADLESS) && !defined(GRAPHICS_API_OPENGL_ES2)
+    eglBindAPI(EGL_OPENGL_API);
+#else
+    eglBindAPI(EGL_OPENGL_ES_API);
+#endif
+
+    if (eglMakeCurrent(display, loaderSurface, loaderSurface, loaderContext) == EGL_FALSE)
+    {
+        TraceLog(LOG_WARNING, "Unable to make loader context current");
+        return;
+    }
+#else
+    return;
+#endif
+
+    rlBeginLoaderContext();
+}
+
+// Wait for loader context GPU work completion (fence) and release context from calling thread
+void EndLoaderContext(void)
+{
+    if (!rlIsLoaderContext()) return;
+
+    rlEndLoaderContext();
+
+#if defined(PLATFORM_DESKTOP)
+    glfwMakeContextCurrent(NULL);
+#elif defined(PLATFORM_ANDROID) || defined(PLATFORM_RPI) || defined(PLATFORM_UWP) || defined(PLATFORM_HEADLESS)
+    eglMakeCurrent(display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+#endif
+}
+
 // Get number of monitors
 int GetMonitorCount(void)
 {
@@ -1219,6 +1729,12 @@ void BeginDrawing(void)
     updateTime = currentTime - previousTime;
     previousTime = currentTime;
 
+    rlSetFrameTime((float)currentTime); // Set time value shared by shaders (frame uniform block)
+
+    UpdateFixedSteps();                 // Run fixed-rate updates, interpolation alpha ready for drawing
+
+    if (resolutionScaling) BeginResolutionTarget();    // Draw to internal render target (dynamic resolution)
+
     rlLoadIdentity();                   // Reset current matrix (MODELVIEW)
     rlMultMatrixf(MatrixToFloat(screenScaling));       // Apply screen scaling
 
@@ -1235,8 +1751,20 @@ void EndDrawing(void)
     DrawRectangle(mousePosition.x, mousePosition.y, 3, 3, MAROON);
 #endif
 
+    if (resolutionTarget.id > 0) EndResolutionTarget();    // Upscale internal render target to screen
+
     rlglDraw();                     // Draw Buffers (Only OpenGL 3+ and ES2)
 
+    UpdateScreenCaptures(false);    // Collect finished screen readbacks (screenshot and GIF frames)
+
+    UpdateImagesAsync();            // Deliver images loaded on worker threads (callbacks upload them)
+
+    UpdateTexturesProgressive();    // Upload progressive textures mipmaps within per-frame budget
+
+    UpdateTextureResidency();       // Evict least recently used textures over VRAM budget
+
+    UpdateCachedAssets();           // Check cached assets files modification (hot reload)
+
 #if defined(SUPPORT_GIF_RECORDING)
 
     #define GIF_RECORD_FRAMERATE    10
@@ -1248,14 +1776,22 @@ void EndDrawing(void)
         // NOTE: We record one gif frame every 10 game frames
         if ((gifFramesCounter%GIF_RECORD_FRAMERATE) == 0)
         {
-            // Get image data for the current frame (from backbuffer)
-            // NOTE: This process is very slow... :(
-            unsigned char *screenData = rlReadScreenPixels(screenWidth, screenHeight);
-            GifWriteFrame(screenData, screenWidth, screenHeight, 10, 8, false);
+            // Request image data for the current frame (from backbuffer), written once GPU copy is done
+            unsigned int requestId = 0;
+            if (gifFrameRequestsCount < MAX_GIF_FRAME_REQUESTS) requestId = rlReadScreenPixelsAsync(screenWidth, screenHeight);
+
+            if (requestId != 0) gifFrameRequests[gifFrameRequestsCount++] = requestId;
+            else
+            {
+                // NOTE: Asynchronous readback not available, pending frames are written first to keep order
+                UpdateScreenCaptures(true);
 
-            RL_FREE(screenData);   // Free image data
+                QueueGifFrame(rlReadScreenPixels(screenWidth, screenHeight));
+            }
         }
 
+        UpdateGifEncoder(false);    // Submit queued frames if encoder is idle
+
         if (((gifFramesCounter/15)%2) == 1)
         {
             DrawCircle(30, screenHeight - 20, 10, RED);
@@ -1266,31 +1802,57 @@ void EndDrawing(void)
     }
 #endif
 
+    rlUpdateGpuZones();             // Collect GPU timing zones results (Only OpenGL 3.3)
+    rlUpdateRenderStats();          // Store frame render statistics and reset counters
+    rlUpdateMeshFences();           // Place frame fence for dynamic meshes buffers copies
+    rlUpdateRenderTexturePool();    // Unload transient render textures not used for a while
+
     SwapBuffers();                  // Copy back buffer to front buffer
-    PollInputEvents();              // Poll user events
-    
+
+    // NOTE: With input late latching, events are polled after frame wait, just before next frame update
+    if (!inputLateLatching) PollInputEvents();  // Poll user events
+
     // Frame time control system
     currentTime = GetTime();
     drawTime = currentTime - previousTime;
     previousTime = currentTime;
 
     frameTime = updateTime + drawTime;
-    
+
+    UpdateResolutionScale(frameTime);   // Adjust dynamic resolution scale (frame time without wait)
+
+    double requestedTime = targetTime - frameTime;
+
+#if defined(PLATFORM_ANDROID) && defined(SUPPORT_ANDROID_FRAME_PACING)
+    // Display pacing: next frame starts once current frame is latched by display (one vsync before presentation)
+    if (IsDisplayPacingActive()) requestedTime = (double)(presentTime - vsyncPeriod - (int64_t)baseTime)*1e-9 - currentTime;
+#endif
+
     // Wait for some milliseconds...
-    if (frameTime < targetTime)
+    if (requestedTime > 0.0)
     {
-        Wait((float)(targetTime - frameTime)*1000.0f);
+
+        Wait((float)requestedTime*1000.0f);
 
         currentTime = GetTime();
         double waitTime = currentTime - previousTime;
         previousTime = currentTime;
 
         frameTime += waitTime;      // Total frame time: update + draw + wait
-        
+
+        UpdateFrameTimeHistogram(frameTime, true, waitTime - requestedTime);
+
         //SetWindowTitle(FormatText("Update: %f, Draw: %f, Req.Wait: %f, Real.Wait: %f, Total: %f, Target: %f\n", 
         //               (float)updateTime, (float)drawTime, (float)(targetTime - (updateTime + drawTime)), 
         //               (float)waitTime, (float)frameTime, (float)targetTime));
     }
+    else UpdateFrameTimeHistogram(frameTime, false, 0.0);
+
+    if (inputLateLatching) PollInputEvents();   // Poll user events
+
+    UpdateProfiler();               // Collect CPU profile zones of this frame (GetProfileZones())
+
+    ResetScratchMemory();           // Release frame scratch allocations (MemAllocScratch())
 }
 
 // Initialize 2D mode with custom camera (2D)
@@ -1325,33 +1887,18 @@ void BeginMode3D(Camera3D camera)
     rlPushMatrix();                     // Save previous matrix, which contains the settings for the 2d ortho projection
     rlLoadIdentity();                   // Reset current matrix (PROJECTION)
 
-    float aspect = (float)currentWidth/(float)currentHeight;
-
-    if (camera.type == CAMERA_PERSPECTIVE)
-    {
-        // Setup perspective projection
-        double top = 0.01*tan(camera.fovy*0.5*DEG2RAD);
-        double right = top*aspect;
-
-        rlFrustum(-right, right, -top, top, DEFAULT_NEAR_CULL_DISTANCE, DEFAULT_FAR_CULL_DISTANCE);
-    }
-    else if (camera.type == CAMERA_ORTHOGRAPHIC)
-    {
-        // Setup orthographic projection
-        double top = camera.fovy/2.0;
-        double right = top*aspect;
-
-        rlOrtho(-right, right, -top,top, DEFAULT_NEAR_CULL_DISTANCE, DEFAULT_FAR_CULL_DISTANCE);
-    }
+    // Camera matrices are only computed when camera or render size changed
+    const CameraMatrices *matrices = GetCameraMatricesCached(camera, currentWidth, currentHeight);
 
+    // Setup perspective or orthographic projection
     // NOTE: zNear and zFar values are important when computing depth buffer values
+    rlMultMatrixf(MatrixToFloat(matrices->projection));
 
     rlMatrixMode(RL_MODELVIEW);         // Switch back to modelview matrix
     rlLoadIdentity();                   // Reset current matrix (MODELVIEW)
 
     // Setup Camera view
-    Matrix matView = MatrixLookAt(camera.position, camera.target, camera.up);
-    rlMultMatrixf(MatrixToFloat(matView));      // Multiply MODELVIEW matrix by view matrix (camera)
+    rlMultMatrixf(MatrixToFloat(matrices->view));   // Multiply MODELVIEW matrix by view matrix (camera)
 
     rlEnableDepthTest();                // Enable DEPTH_TEST for 3D
 }
@@ -1359,6 +1906,8 @@ void BeginMode3D(Camera3D camera)
 // Ends 3D mode and returns to default 2D orthographic mode
 void EndMode3D(void)
 {
+    FlushTransparentQueue();            // Draw deferred transparent items (back-to-front)
+
     rlglDraw();                         // Process internal buffers (update + draw)
 
     rlMatrixMode(RL_PROJECTION);        // Switch to projection matrix
@@ -1378,6 +1927,7 @@ void BeginTextureMode(RenderTexture2D target)
     rlglDraw();                         // Draw Buffers (Only OpenGL 3+ and ES2)
 
     rlEnableRenderTexture(target.id);   // Enable render target
+    resolutionTargetBound = false;
 
     // Set viewport to framebuffer size
     rlViewport(0, 0, target.texture.width, target.texture.height);
@@ -1407,8 +1957,9 @@ void EndTextureMode(void)
 
     rlDisableRenderTexture();           // Disable render target
 
-    // Set viewport to default framebuffer size
-    SetupViewport(renderWidth, renderHeight);
+    // Set viewport to default framebuffer size, internal render target if dynamic resolution is drawing
+    if (resolutionTarget.id > 0) EnableResolutionTarget();
+    else SetupViewport(renderWidth, renderHeight);
 
     // Reset current screen size
     currentWidth = GetScreenWidth();
@@ -1419,82 +1970,184 @@ void EndTextureMode(void)
 // NOTE: Scissor rec refers to bottom-left corner, we change it to upper-left
 void BeginScissorMode(int x, int y, int width, int height)
 {
-    rlglDraw(); // Force drawing elements
-
+    // NOTE: Scissor is registered per draw call, no need to force drawing elements
     rlEnableScissorTest();
-    rlScissor(x, GetScreenHeight() - (y + height), width, height);
+
+    if (resolutionTargetBound)
+    {
+        // Scissor area scaled to internal render target size (dynamic resolution)
+        float scaleX = (float)resolutionTarget.texture.width/renderWidth;
+        float scaleY = (float)resolutionTarget.texture.height/renderHeight;
+
+        rlScissor((int)(x*scaleX), resolutionTarget.texture.height - (int)((y + height)*scaleY), (int)(width*scaleX), (int)(height*scaleY));
+    }
+    else rlScissor(x, GetScreenHeight() - (y + height), width, height);
 }
 
 // End scissor mode
 void EndScissorMode(void)
 {
-    rlglDraw(); // Force drawing elements
     rlDisableScissorTest();
 }
 
-// Returns a ray trace from mouse position
-Ray GetMouseRay(Vector2 mousePosition, Camera camera)
+// Enable dynamic resolution: frames are drawn to an internal render target upscaled to screen on EndDrawing(),
+// its size is adjusted every few frames from measured GPU frame time against target frame time
+// NOTE: Target frame time 0 uses SetTargetFPS() frame time (60 fps if not set), without GPU timer queries
+// CPU frame time is measured (it includes waiting for GPU on buffers swap when fill-rate bound)
+void EnableDynamicResolution(float targetFrameTime, float minScale)
 {
-    Ray ray;
+    resolutionScaling = true;
+    resolutionBudget = (targetFrameTime > 0.0f)? targetFrameTime : 0.0;
+    resolutionMinScale = Clamp(minScale, RESOLUTION_SCALE_STEP, 1.0f);
+    resolutionScale = 1.0f;
+    resolutionTimeAccum = 0.0;
+    resolutionTimeFrames = 0;
+    resolutionStableWindows = 0;
+}
 
-    // Calculate normalized device coordinates
-    // NOTE: y value is negative
-    float x = (2.0f*mousePosition.x)/(float)GetScreenWidth() - 1.0f;
-    float y = 1.0f - (2.0f*mousePosition.y)/(float)GetScreenHeight();
-    float z = 1.0f;
+// Disable dynamic resolution, frames are drawn directly to screen
+void DisableDynamicResolution(void)
+{
+    resolutionScaling = false;
+    resolutionScale = 1.0f;
+}
 
-    // Store values in a vector
-    Vector3 deviceCoords = { x, y, z };
+// Get current dynamic resolution scale (1.0f if disabled)
+float GetResolutionScale(void)
+{
+    return resolutionScale;
+}
+
+// Load command list to record drawing commands
+// NOTE: Command lists require OpenGL 3.3 or ES2, on OpenGL 1.1 commands are drawn while recording
+CommandList LoadCommandList(int elements)
+{
+    CommandList list = { 0 };
 
-    // Calculate view matrix from camera look at
-    Matrix matView = MatrixLookAt(camera.position, camera.target, camera.up);
+    list.batch = rlLoadRenderBatch(elements);
+    list.dirty = true;
 
-    Matrix matProj = MatrixIdentity();
+    return list;
+}
 
-    if (camera.type == CAMERA_PERSPECTIVE)
+// Unload command list
+void UnloadCommandList(CommandList list)
+{
+    if (recordingList != NULL)
     {
-        // Calculate projection matrix from perspective
-        matProj = MatrixPerspective(camera.fovy*DEG2RAD, ((double)GetScreenWidth()/(double)GetScreenHeight()), DEFAULT_NEAR_CULL_DISTANCE, DEFAULT_FAR_CULL_DISTANCE);
+        if (recordingList->batch == list.batch) EndCommandList();
     }
-    else if (camera.type == CAMERA_ORTHOGRAPHIC)
-    {
-        float aspect = (float)screenWidth/(float)screenHeight;
-        double top = camera.fovy/2.0;
-        double right = top*aspect;
 
-        // Calculate projection matrix from orthographic
-        matProj = MatrixOrtho(-right, right, -top, top, 0.01, 1000.0);
-    }
+    rlUnloadRenderBatch(list.batch);
+}
 
-    // Unproject far/near points
-    Vector3 nearPoint = rlUnproject((Vector3){ deviceCoords.x, deviceCoords.y, 0.0f }, matProj, matView);
-    Vector3 farPoint = rlUnproject((Vector3){ deviceCoords.x, deviceCoords.y, 1.0f }, matProj, matView);
+// Begin recording drawing commands into command list
+// NOTE: Previously recorded commands are discarded
+void BeginCommandList(CommandList *list)
+{
+    if (recordingList != NULL) EndCommandList();
 
-    // Unproject the mouse cursor in the near plane.
-    // We need this as the source position because orthographic projects, compared to perspect doesn't have a
-    // convergence point, meaning that the "eye" of the camera is more like a plane than a point.
-    Vector3 cameraPlanePointerPos = rlUnproject((Vector3){ deviceCoords.x, deviceCoords.y, -1.0f }, matProj, matView);
+    rlResetRenderBatch(list->batch);
+    rlSetRenderBatchActive(list->batch);
 
-    // Calculate normalized direction vector
-    Vector3 direction = Vector3Normalize(Vector3Subtract(farPoint, nearPoint));
+    recordingList = list;
+}
 
-    if (camera.type == CAMERA_PERSPECTIVE) ray.position = camera.position;
-    else if (camera.type == CAMERA_ORTHOGRAPHIC) ray.position = cameraPlanePointerPos;
+// End recording drawing commands
+void EndCommandList(void)
+{
+    if (recordingList == NULL) return;
 
-    // Apply calculated vectors to ray
-    ray.direction = direction;
+    rlSetRenderBatchActive(NULL);     // Set default batch active
 
-    return ray;
+    // NOTE: Without render batch support, commands must be recorded (drawn) every frame
+    recordingList->dirty = (recordingList->batch == NULL);
+    recordingList = NULL;
 }
 
-// Get transform matrix for camera
-Matrix GetCameraMatrix(Camera camera)
+// Draw command list with a transform (applied over current modelview)
+void DrawCommandList(CommandList list, Matrix transform)
 {
-    return MatrixLookAt(camera.position, camera.target, camera.up);
+    if (list.batch == NULL) return;
+
+    rlglDraw();                         // Draw pending elements with current modelview
+
+    Matrix matModelView = GetMatrixModelview();
+    SetMatrixModelview(MatrixMultiply(transform, matModelView));
+
+    rlDrawRenderBatch(list.batch);
+
+    SetMatrixModelview(matModelView);
 }
 
-// Returns camera 2d transform matrix
-Matrix GetCameraMatrix2D(Camera2D camera)
+// Mark command list to be recorded again
+void SetCommandListDirty(CommandList *list)
+{
+    list->dirty = true;
+}
+
+// Check if command list requires to be recorded
+bool IsCommandListDirty(CommandList list)
+{
+    return list.dirty;
+}
+
+// Returns a ray trace from mouse position
+Ray GetMouseRay(Vector2 mousePosition, Camera camera)
+{
+    Ray ray;
+
+    // Calculate normalized device coordinates
+    // NOTE: y value is negative
+    float x = (2.0f*mousePosition.x)/(float)GetScreenWidth() - 1.0f;
+    float y = 1.0f - (2.0f*mousePosition.y)/(float)GetScreenHeight();
+    float z = 1.0f;
+
+    // Store values in a vector
+    Vector3 deviceCoords = { x, y, z };
+
+    // Inverse view*projection matrix is cached, no matrix inversion on every call
+    Matrix matInvViewProj = GetCameraMatricesCached(camera, GetScreenWidth(), GetScreenHeight())->invViewProjection;
+
+    // Unproject far/near points
+    Quaternion nearQuat = QuaternionTransform((Quaternion){ deviceCoords.x, deviceCoords.y, 0.0f, 1.0f }, matInvViewProj);
+    Quaternion farQuat = QuaternionTransform((Quaternion){ deviceCoords.x, deviceCoords.y, 1.0f, 1.0f }, matInvViewProj);
+    Vector3 nearPoint = { nearQuat.x/nearQuat.w, nearQuat.y/nearQuat.w, nearQuat.z/nearQuat.w };
+    Vector3 farPoint = { farQuat.x/farQuat.w, farQuat.y/farQuat.w, farQuat.z/farQuat.w };
+
+    // Unproject the mouse cursor in the near plane.
+    // We need this as the source position because orthographic projects, compared to perspect doesn't have a
+    // convergence point, meaning that the "eye" of the camera is more like a plane than a point.
+    Quaternion planeQuat = QuaternionTransform((Quaternion){ deviceCoords.x, deviceCoords.y, -1.0f, 1.0f }, matInvViewProj);
+    Vector3 cameraPlanePointerPos = { planeQuat.x/planeQuat.w, planeQuat.y/planeQuat.w, planeQuat.z/planeQuat.w };
+
+    // Calculate normalized direction vector
+    Vector3 direction = Vector3Normalize(Vector3Subtract(farPoint, nearPoint));
+
+    if (camera.type == CAMERA_PERSPECTIVE) ray.position = camera.position;
+    else if (camera.type == CAMERA_ORTHOGRAPHIC) ray.position = cameraPlanePointerPos;
+
+    // Apply calculated vectors to ray
+    ray.direction = direction;
+
+    return ray;
+}
+
+// Get transform matrix for camera
+Matrix GetCameraMatrix(Camera camera)
+{
+    return GetCameraMatricesCached(camera, currentWidth, currentHeight)->view;
+}
+
+// Get camera matrices and frustum planes for current render size (screen or render texture)
+// NOTE: Matrices are cached, same camera used again (i.e. BeginMode3D(), GetMouseRay()) does not recompute them
+CameraMatrices GetCameraMatrices(Camera camera)
+{
+    return *GetCameraMatricesCached(camera, currentWidth, currentHeight);
+}
+
+// Returns camera 2d transform matrix
+Matrix GetCameraMatrix2D(Camera2D camera)
 {
     Matrix matTransform = { 0 };
     // The camera in world-space is set by
@@ -1532,35 +2185,14 @@ Vector2 GetWorldToScreen(Vector3 position, Camera camera)
 // Returns size position for a 3d world space position (useful for texture drawing)
 Vector2 GetWorldToScreenEx(Vector3 position, Camera camera, int width, int height)
 {
-	// Calculate projection matrix (from perspective instead of frustum
-	Matrix matProj = MatrixIdentity();
-
-	if (camera.type == CAMERA_PERSPECTIVE)
-	{
-		// Calculate projection matrix from perspective
-		matProj = MatrixPerspective(camera.fovy * DEG2RAD, ((double)width/(double)height), DEFAULT_NEAR_CULL_DISTANCE, DEFAULT_FAR_CULL_DISTANCE);
-	}
-	else if (camera.type == CAMERA_ORTHOGRAPHIC)
-	{
-		float aspect = (float)width/(float)height;
-		double top = camera.fovy/2.0;
-		double right = top*aspect;
-
-		// Calculate projection matrix from orthographic
-		matProj = MatrixOrtho(-right, right, -top, top, DEFAULT_NEAR_CULL_DISTANCE, DEFAULT_FAR_CULL_DISTANCE);
-	}
-
-	// Calculate view matrix from camera look at (and transpose it)
-	Matrix matView = MatrixLookAt(camera.position, camera.target, camera.up);
+	// View*projection matrix is cached, projecting many points with same camera does not recompute it
+	Matrix matViewProj = GetCameraMatricesCached(camera, width, height)->viewProjection;
 
 	// Convert world position vector to quaternion
 	Quaternion worldPos = { position.x, position.y, position.z, 1.0f };
 
-	// Transform world position to view
-	worldPos = QuaternionTransform(worldPos, matView);
-
-	// Transform result to projection (clip space position)
-	worldPos = QuaternionTransform(worldPos, matProj);
+	// Transform world position to projection (clip space position)
+	worldPos = QuaternionTransform(worldPos, matViewProj);
 
 	// Calculate normalized device coordinates (inverted y)
 	Vector3 ndcPos = { worldPos.x/worldPos.w, -worldPos.y/worldPos.w, worldPos.z/worldPos.w };
@@ -1571,6 +2203,135 @@ Vector2 GetWorldToScreenEx(Vector3 position, Camera camera, int width, int heigh
 	return sizePosition;
 }
 
+// Returns screen space positions for 3d world space positions, returns visible points count
+// NOTE: flags (optional) must hold count values, ScreenPointFlag bits for every point (culling)
+int GetWorldToScreenBatch(const Vector3 *in, Vector2 *out, int count, Camera camera, unsigned char *flags)
+{
+    int width = GetScreenWidth();
+    int height = GetScreenHeight();
+
+    // View*projection matrix computed once for all points (cached)
+    Matrix mat = GetCameraMatricesCached(camera, width, height)->viewProjection;
+
+    float halfWidth = (float)width*0.5f;
+    float halfHeight = (float)height*0.5f;
+    int visibleCount = 0;
+    int i = 0;
+
+#if defined(CORE_SIMD_SSE)
+    __m128 m0 = _mm_set1_ps(mat.m0), m4 = _mm_set1_ps(mat.m4), m8 = _mm_set1_ps(mat.m8), m12 = _mm_set1_ps(mat.m12);
+    __m128 m1 = _mm_set1_ps(mat.m1), m5 = _mm_set1_ps(mat.m5), m9 = _mm_set1_ps(mat.m9), m13 = _mm_set1_ps(mat.m13);
+    __m128 m2 = _mm_set1_ps(mat.m2), m6 = _mm_set1_ps(mat.m6), m10 = _mm_set1_ps(mat.m10), m14 = _mm_set1_ps(mat.m14);
+    __m128 m3 = _mm_set1_ps(mat.m3), m7 = _mm_set1_ps(mat.m7), m11 = _mm_set1_ps(mat.m11), m15 = _mm_set1_ps(mat.m15);
+    __m128 one = _mm_set1_ps(1.0f);
+    __m128 scaleX = _mm_set1_ps(halfWidth), scaleY = _mm_set1_ps(halfHeight);
+
+    for (; i + 4 <= count; i += 4)
+    {
+        // Four points (12 floats) deinterleaved: (x0, y0, z0, x1), (y1, z1, x2, y2), (z2, x3, y3, z3)
+        const float *src = &in[i].x;
+        __m128 a = _mm_loadu_ps(src), b = _mm_loadu_ps(src + 4), c = _mm_loadu_ps(src + 8);
+        __m128 bc = _mm_shuffle_ps(b, c, _MM_SHUFFLE(2, 1, 3, 2));
+        __m128 ab = _mm_shuffle_ps(a, b, _MM_SHUFFLE(1, 0, 2, 1));
+        __m128 x = _mm_shuffle_ps(a, bc, _MM_SHUFFLE(2, 0, 3, 0));
+        __m128 y = _mm_shuffle_ps(ab, bc, _MM_SHUFFLE(3, 1, 2, 0));
+        __m128 z = _mm_shuffle_ps(ab, c, _MM_SHUFFLE(3, 0, 3, 1));
+
+        // Clip space positions
+        __m128 cx = _mm_add_ps(_mm_add_ps(_mm_mul_ps(m0, x), _mm_mul_ps(m4, y)), _mm_add_ps(_mm_mul_ps(m8, z), m12));
+        __m128 cy = _mm_add_ps(_mm_add_ps(_mm_mul_ps(m1, x), _mm_mul_ps(m5, y)), _mm_add_ps(_mm_mul_ps(m9, z), m13));
+        __m128 cz = _mm_add_ps(_mm_add_ps(_mm_mul_ps(m2, x), _mm_mul_ps(m6, y)), _mm_add_ps(_mm_mul_ps(m10, z), m14));
+        __m128 cw = _mm_add_ps(_mm_add_ps(_mm_mul_ps(m3, x), _mm_mul_ps(m7, y)), _mm_add_ps(_mm_mul_ps(m11, z), m15));
+
+        // Normalized device coordinates to screen (inverted y)
+        __m128 nx = _mm_div_ps(cx, cw);
+        __m128 ny = _mm_div_ps(cy, cw);
+        __m128 sx = _mm_mul_ps(_mm_add_ps(nx, one), scaleX);
+        __m128 sy = _mm_mul_ps(_mm_sub_ps(one, ny), scaleY);
+
+        _mm_storeu_ps(&out[i].x, _mm_unpacklo_ps(sx, sy));
+        _mm_storeu_ps(&out[i + 2].x, _mm_unpackhi_ps(sx, sy));
+
+        int behind = _mm_movemask_ps(_mm_cmplt_ps(cz, _mm_sub_ps(_mm_setzero_ps(), cw)));
+        int offscreen = _mm_movemask_ps(_mm_or_ps(_mm_or_ps(_mm_cmplt_ps(nx, _mm_sub_ps(_mm_setzero_ps(), one)), _mm_cmpgt_ps(nx, one)),
+                                                  _mm_or_ps(_mm_cmplt_ps(ny, _mm_sub_ps(_mm_setzero_ps(), one)), _mm_cmpgt_ps(ny, one))));
+
+        for (int k = 0; k < 4; k++)
+        {
+            unsigned char flag = ((behind >> k) & 1)? SCREEN_POINT_BEHIND : (((offscreen >> k) & 1)? SCREEN_POINT_OFFSCREEN : SCREEN_POINT_VISIBLE);
+
+            if (flags != NULL) flags[i + k] = flag;
+            if (flag == SCREEN_POINT_VISIBLE) visibleCount++;
+        }
+    }
+#elif defined(CORE_SIMD_NEON)
+    float32x4_t m12 = vdupq_n_f32(mat.m12), m13 = vdupq_n_f32(mat.m13), m14 = vdupq_n_f32(mat.m14), m15 = vdupq_n_f32(mat.m15);
+    float32x4_t one = vdupq_n_f32(1.0f);
+
+    for (; i + 4 <= count; i += 4)
+    {
+        float32x4x3_t p = vld3q_f32(&in[i].x);     // Deinterleaved x, y, z
+
+        // Clip space positions
+        float32x4_t cx = vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(m12, p.val[0], mat.m0), p.val[1], mat.m4), p.val[2], mat.m8);
+        float32x4_t cy = vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(m13, p.val[0], mat.m1), p.val[1], mat.m5), p.val[2], mat.m9);
+        float32x4_t cz = vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(m14, p.val[0], mat.m2), p.val[1], mat.m6), p.val[2], mat.m10);
+        float32x4_t cw = vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(m15, p.val[0], mat.m3), p.val[1], mat.m7), p.val[2], mat.m11);
+
+        // Reciprocal estimate refined with two Newton-Raphson steps (no division on ARMv7 NEON)
+        float32x4_t iw = vrecpeq_f32(cw);
+        iw = vmulq_f32(iw, vrecpsq_f32(cw, iw));
+        iw = vmulq_f32(iw, vrecpsq_f32(cw, iw));
+
+        // Normalized device coordinates to screen (inverted y)
+        float32x4_t nx = vmulq_f32(cx, iw);
+        float32x4_t ny = vmulq_f32(cy, iw);
+        float32x4x2_t screen = { { vmulq_n_f32(vaddq_f32(nx, one), halfWidth), vmulq_n_f32(vsubq_f32(one, ny), halfHeight) } };
+        vst2q_f32(&out[i].x, screen);
+
+        uint32x4_t behind = vcltq_f32(cz, vnegq_f32(cw));
+        uint32x4_t offscreen = vorrq_u32(vcagtq_f32(nx, one), vcagtq_f32(ny, one));
+
+        unsigned int behindMask[4] = { 0 };
+        unsigned int offscreenMask[4] = { 0 };
+        vst1q_u32(behindMask, behind);
+        vst1q_u32(offscreenMask, offscreen);
+
+        for (int k = 0; k < 4; k++)
+        {
+            unsigned char flag = behindMask[k]? SCREEN_POINT_BEHIND : (offscreenMask[k]? SCREEN_POINT_OFFSCREEN : SCREEN_POINT_VISIBLE);
+
+            if (flags != NULL) flags[i + k] = flag;
+            if (flag == SCREEN_POINT_VISIBLE) visibleCount++;
+        }
+    }
+#endif
+
+    // Remaining points (or all points without SIMD support)
+    for (; i < count; i++)
+    {
+        Vector3 p = in[i];
+        float cx = mat.m0*p.x + mat.m4*p.y + mat.m8*p.z + mat.m12;
+        float cy = mat.m1*p.x + mat.m5*p.y + mat.m9*p.z + mat.m13;
+        float cz = mat.m2*p.x + mat.m6*p.y + mat.m10*p.z + mat.m14;
+        float cw = mat.m3*p.x + mat.m7*p.y + mat.m11*p.z + mat.m15;
+
+        float nx = cx/cw;
+        float ny = cy/cw;
+
+        out[i] = (Vector2){ (nx + 1.0f)*halfWidth, (1.0f - ny)*halfHeight };
+
+        unsigned char flag = SCREEN_POINT_VISIBLE;
+        if (cz < -cw) flag = SCREEN_POINT_BEHIND;
+        else if ((nx < -1.0f) || (nx > 1.0f) || (ny < -1.0f) || (ny > 1.0f)) flag = SCREEN_POINT_OFFSCREEN;
+
+        if (flags != NULL) flags[i] = flag;
+        if (flag == SCREEN_POINT_VISIBLE) visibleCount++;
+    }
+
+    return visibleCount;
+}
+
 // Returns the screen space position for a 2d camera world space position
 Vector2 GetWorldToScreen2D(Vector2 position, Camera2D camera)
 {
@@ -1598,6 +2359,162 @@ void SetTargetFPS(int fps)
     TraceLog(LOG_INFO, "Target time per frame: %02.03f milliseconds", (float)targetTime*1000);
 }
 
+// Set buffers swap interval: 0 no V-Sync, 1 V-Sync, N V-Sync every N refreshes, -1 adaptive V-Sync
+// NOTE: Adaptive V-Sync swaps immediately when frame is late (tearing instead of waiting a full refresh),
+// it requires WGL/GLX_EXT_swap_control_tear, V-Sync is used if not supported
+void SetSwapInterval(int interval)
+{
+#if defined(PLATFORM_DESKTOP)
+    if ((interval < 0) && !glfwExtensionSupported("WGL_EXT_swap_control_tear") && !glfwExtensionSupported("GLX_EXT_swap_control_tear"))
+    {
+        TraceLog(LOG_WARNING, "Adaptive VSYNC not supported, using VSYNC");
+        interval = 1;
+    }
+
+    glfwSwapInterval(interval);
+#elif defined(PLATFORM_ANDROID) || defined(PLATFORM_RPI) || defined(PLATFORM_UWP)
+    // NOTE: Adaptive V-Sync not available on EGL
+    if (interval < 0) interval = 1;
+
+    eglSwapInterval(display, interval);
+#elif defined(PLATFORM_WEB)
+    TraceLog(LOG_WARNING, "Swap interval is controlled by browser");
+    return;
+#elif defined(PLATFORM_HEADLESS)
+    TraceLog(LOG_WARNING, "Swap interval not available on offscreen rendering");
+    return;
+#endif
+
+    swapInterval = interval;
+
+    if (interval == 0) configFlags &= ~FLAG_VSYNC_HINT;
+    else configFlags |= FLAG_VSYNC_HINT;
+}
+
+// Set input late latching, input events are polled after frame wait instead of after buffers swap
+// NOTE: Input is sampled right before next frame update, removing frame wait time from input latency
+void SetInputLateLatching(bool enabled)
+{
+    inputLateLatching = enabled;
+}
+
+// Set frame pacing mode (FramePacingMode), used to wait for target frame time
+void SetFramePacing(int mode)
+{
+#if defined(PLATFORM_UWP)
+    // NOTE: GetTime() is updated through messages, spinning would never end
+    mode = FRAME_PACING_SLEEP;
+#endif
+    if ((mode < FRAME_PACING_SLEEP) || (mode > FRAME_PACING_DISPLAY)) mode = FRAME_PACING_SLEEP;
+
+    framePacingMode = mode;
+}
+
+// Get frame time histogram, measured since last call (counters are reset)
+FrameTimeHistogram GetFrameTimeHistogram(void)
+{
+    FrameTimeHistogram histogram = frameHistogram;
+
+    if (histogram.frameCount > 0)
+    {
+        histogram.frameTimeAvg /= (float)histogram.frameCount;
+        if (histogram.framesWaited > 0) histogram.waitErrorAvg /= (float)histogram.framesWaited;
+    }
+    histogram.targetTime = (float)targetTime*1000.0f;
+
+    memset(&frameHistogram, 0, sizeof(FrameTimeHistogram));
+
+    return histogram;
+}
+
+// Add fixed-rate update callback (rate in updates per second), returns id (0 on failure)
+// NOTE: Callbacks are called on BeginDrawing() for every fixed step elapsed since last frame
+int AddFixedUpdate(FixedUpdateCallback callback, float rate, void *userData)
+{
+    if ((callback == NULL) || (rate <= 0.0f)) return 0;
+
+    for (int i = 0; i < MAX_FIXED_UPDATES; i++)
+    {
+        if (fixedUpdates[i].callback == NULL)
+        {
+            fixedUpdates[i].callback = callback;
+            fixedUpdates[i].userData = userData;
+            fixedUpdates[i].step = 1.0/(double)rate;
+            fixedUpdates[i].accumulator = 0.0;
+            fixedUpdates[i].time = GetTime();
+            fixedUpdates[i].stepsDropped = 0;
+
+            return i + 1;
+        }
+    }
+
+    TraceLog(LOG_WARNING, "Fixed updates limit reached (%i)", MAX_FIXED_UPDATES);
+
+    return 0;
+}
+
+// Remove fixed-rate update callback
+void RemoveFixedUpdate(int id)
+{
+    if ((id > 0) && (id <= MAX_FIXED_UPDATES)) fixedUpdates[id - 1].callback = NULL;
+}
+
+// Set max fixed update steps run per frame, exceeding time is dropped (spiral-of-death clamping)
+void SetFixedUpdateMaxSteps(int maxSteps)
+{
+    fixedUpdateMaxSteps = (maxSteps < 1)? 1 : maxSteps;
+}
+
+// Get fixed update interpolation alpha [0..1], elapsed fraction of next step
+// NOTE: Used to interpolate previous and current simulation states for drawing
+float GetFixedUpdateAlpha(int id)
+{
+    if ((id < 1) || (id > MAX_FIXED_UPDATES) || (fixedUpdates[id - 1].callback == NULL)) return 1.0f;
+
+    return (float)(fixedUpdates[id - 1].accumulator/fixedUpdates[id - 1].step);
+}
+
+// Get fixed update steps dropped by max steps clamping (counter is reset)
+int GetFixedUpdateStepsDropped(int id)
+{
+    if ((id < 1) || (id > MAX_FIXED_UPDATES)) return 0;
+
+    int steps = fixedUpdates[id - 1].stepsDropped;
+    fixedUpdates[id - 1].stepsDropped = 0;
+
+    return steps;
+}
+
+// Enable waiting for events on EndDrawing(), no automatic event polling
+// NOTE: Frame loop only runs on input and window events, timeout or RequestRedraw() (PLATFORM_DESKTOP)
+void EnableEventWaiting(void)
+{
+    eventWaiting = true;
+}
+
+// Disable waiting for events on EndDrawing(), automatic event polling
+void DisableEventWaiting(void)
+{
+    eventWaiting = false;
+}
+
+// Set max time waiting for events in seconds (0 to wait without timeout)
+void SetEventWaitingTimeout(float seconds)
+{
+    eventWaitingTimeout = (seconds > 0.0f)? (double)seconds : 0.0;
+}
+
+// Request a redraw, next frame doesn't wait for events
+// NOTE: It can be called from any thread, waiting main thread is woken up
+void RequestRedraw(void)
+{
+    redrawRequested = true;
+
+#if defined(PLATFORM_DESKTOP)
+    if (windowReady) glfwPostEmptyEvent();
+#endif
+}
+
 // Returns current FPS
 int GetFPS(void)
 {
@@ -1615,11 +2532,15 @@ float GetFrameTime(void)
 // NOTE: On PLATFORM_DESKTOP, timer is initialized on glfwInit()
 double GetTime(void)
 {
-#if defined(PLATFORM_DESKTOP) || defined(PLATFORM_WEB)
+#if defined(PLATFORM_DESKTOP) || (defined(PLATFORM_WEB) && !defined(SUPPORT_WEB_WORKER))
     return glfwGetTime();                   // Elapsed time since glfwInit()
 #endif
 
-#if defined(PLATFORM_ANDROID) || defined(PLATFORM_RPI)
+#if defined(PLATFORM_WEB) && defined(SUPPORT_WEB_WORKER)
+    return (emscripten_get_now() - baseTime)*0.001;    // Elapsed time since InitGraphicsDevice()
+#endif
+
+#if defined(PLATFORM_ANDROID) || defined(PLATFORM_RPI) || defined(PLATFORM_HEADLESS)
     struct timespec ts;
     clock_gettime(CLOCK_MONOTONIC, &ts);
     uint64_t time = (uint64_t)ts.tv_sec*1000000000LLU + (uint64_t)ts.tv_nsec;
@@ -1766,6 +2687,7 @@ Color GetColor(int hexValue)
 }
 
 // Returns a random value between min and max (both included)
+// NOTE: Generator state is global (not thread-safe), use a RandomState per thread for threaded generation
 int GetRandomValue(int min, int max)
 {
     if (min > max)
@@ -1775,7 +2697,136 @@ int GetRandomValue(int min, int max)
         min = tmp;
     }
 
-    return (rand()%(abs(max - min) + 1) + min);
+    return GetRandomInt(&randomState, min, max);
+}
+
+// Set the seed of GetRandomValue() generator, sequence is the same on every platform
+void SetRandomSeed(unsigned int seed)
+{
+    randomState = LoadRandomState(seed);
+}
+
+// Load random generator state from seed, state words are expanded with splitmix64
+RandomState LoadRandomState(unsigned long long seed)
+{
+    RandomState state = { 0 };
+
+    for (int i = 0; i < 4; i += 2)
+    {
+        unsigned long long value = SplitMix64(&seed);
+        state.s[i] = (unsigned int)value;
+        state.s[i + 1] = (unsigned int)(value >> 32);
+    }
+
+    if ((state.s[0] | state.s[1] | state.s[2] | state.s[3]) == 0) state.s[0] = 1;     // All zero state is invalid
+
+    return state;
+}
+
+// Get random 32 bit value from generator state (xoshiro128**)
+unsigned int GetRandomUInt(RandomState *state)
+{
+    unsigned int *s = state->s;
+    unsigned int result = RandomRotl(s[1]*5, 7)*9;
+    unsigned int t = s[1] << 9;
+
+    s[2] ^= s[0];
+    s[3] ^= s[1];
+    s[1] ^= s[2];
+    s[0] ^= s[3];
+    s[2] ^= t;
+    s[3] = RandomRotl(s[3], 11);
+
+    return result;
+}
+
+// Get random integer between min and max (both included)
+// NOTE: Multiply-shift range reduction with rejection (Lemire), no modulo bias
+int GetRandomInt(RandomState *state, int min, int max)
+{
+    if (min > max)
+    {
+        int tmp = max;
+        max = min;
+        min = tmp;
+    }
+
+    unsigned int range = (unsigned int)max - (unsigned int)min + 1;
+    if (range == 0) return (int)GetRandomUInt(state);     // Full 32 bit range
+
+    unsigned long long m = (unsigned long long)GetRandomUInt(state)*range;
+
+    if ((unsigned int)m < range)
+    {
+        unsigned int threshold = (0u - range)%range;
+        while ((unsigned int)m < threshold) m = (unsigned long long)GetRandomUInt(state)*range;
+    }
+
+    return (int)((unsigned int)min + (unsigned int)(m >> 32));
+}
+
+// Get random float between min (included) and max (excluded)
+float GetRandomFloat(RandomState *state, float min, float max)
+{
+    return min + (max - min)*((GetRandomUInt(state) >> 8)*(1.0f/16777216.0f));
+}
+
+// Fill array with random integers between min and max (both included)
+// NOTE: Values come from interleaved generators (GetRandomBulk()), not the same sequence than GetRandomInt()
+void GetRandomInts(RandomState *state, int *values, int count, int min, int max)
+{
+    if (min > max)
+    {
+        int tmp = max;
+        max = min;
+        min = tmp;
+    }
+
+    unsigned int range = (unsigned int)max - (unsigned int)min + 1;
+    unsigned int threshold = (range > 0)? (0u - range)%range : 0;
+    unsigned int chunk[RANDOM_BULK_CHUNK];
+
+    for (int i = 0; i < count; i += RANDOM_BULK_CHUNK)
+    {
+        int chunkCount = ((count - i) < RANDOM_BULK_CHUNK)? (count - i) : RANDOM_BULK_CHUNK;
+        GetRandomBulk(state, chunk, chunkCount);
+
+        if (range == 0)
+        {
+            for (int k = 0; k < chunkCount; k++) values[i + k] = (int)chunk[k];
+            continue;
+        }
+
+        // Vectorizable range reduction, rejected values (rare, low product word under threshold) are drawn again
+        for (int k = 0; k < chunkCount; k++) values[i + k] = (int)((unsigned int)min + (unsigned int)(((unsigned long long)chunk[k]*range) >> 32));
+
+        for (int k = 0; k < chunkCount; k++)
+        {
+            unsigned long long m = (unsigned long long)chunk[k]*range;
+
+            if ((unsigned int)m < threshold)
+            {
+                while ((unsigned int)m < threshold) m = (unsigned long long)GetRandomUInt(state)*range;
+                values[i + k] = (int)((unsigned int)min + (unsigned int)(m >> 32));
+            }
+        }
+    }
+}
+
+// Fill array with random floats between min (included) and max (excluded)
+// NOTE: Values come from interleaved generators (GetRandomBulk()), not the same sequence than GetRandomFloat()
+void GetRandomFloats(RandomState *state, float *values, int count, float min, float max)
+{
+    float scale = (max - min)*(1.0f/16777216.0f);
+    unsigned int chunk[RANDOM_BULK_CHUNK];
+
+    for (int i = 0; i < count; i += RANDOM_BULK_CHUNK)
+    {
+        int chunkCount = ((count - i) < RANDOM_BULK_CHUNK)? (count - i) : RANDOM_BULK_CHUNK;
+        GetRandomBulk(state, chunk, chunkCount);
+
+        for (int k = 0; k < chunkCount; k++) values[i + k] = min + (float)(chunk[k] >> 8)*scale;
+    }
 }
 
 // Color fade-in or fade-out, alpha goes from 0.0f to 1.0f
@@ -1798,14 +2849,23 @@ void SetConfigFlags(unsigned int flags)
 
 // NOTE TraceLog() function is located in [utils.h]
 
+// Set GIF recording options (applied on next recording): frames downscale divider (1: screen size)
+// and palette computed once on first frame and reused (faster encoding, colors could be approximated)
+// NOTE: GIF frames are quantized and encoded on a worker thread (if available)
+void SetGifRecordingOptions(int downscale, bool fixedPalette)
+{
+#if defined(SUPPORT_GIF_RECORDING)
+    gifDownscale = (downscale > 1)? downscale : 1;
+    gifFixedPalette = fixedPalette;
+#endif
+}
+
 // Takes a screenshot of current screen (saved a .png)
 // NOTE: This function could work in any platform but some platforms: PLATFORM_ANDROID and PLATFORM_WEB
 // have their own internal file-systems, to dowload image to user file-system some additional mechanism is required
+// NOTE: If supported, screen is read asynchronously and file is saved on a following EndDrawing()
 void TakeScreenshot(const char *fileName)
 {
-    unsigned char *imgData = rlReadScreenPixels(renderWidth, renderHeight);
-    Image image = { imgData, renderWidth, renderHeight, 1, UNCOMPRESSED_R8G8B8A8 };
-
     char path[512] = { 0 };
 #if defined(PLATFORM_ANDROID)
     strcpy(path, internalDataPath);
@@ -1815,16 +2875,40 @@ void TakeScreenshot(const char *fileName)
     strcpy(path, fileName);
 #endif
 
-    ExportImage(image, path);
-    RL_FREE(imgData);
+    // Previous screenshot must be saved before requesting a new one
+    if (screenshotRequest != 0) UpdateScreenCaptures(true);
 
-#if defined(PLATFORM_WEB)
-    // Download file from MEMFS (emscripten memory filesystem)
-    // saveFileFromMEMFSToDisk() function is defined in raylib/src/shell.html
-    emscripten_run_script(TextFormat("saveFileFromMEMFSToDisk('%s','%s')", GetFileName(path), GetFileName(path)));
-#endif
+    screenshotRequest = rlReadScreenPixelsAsync(renderWidth, renderHeight);
 
-    TraceLog(LOG_INFO, "Screenshot taken: %s", path);
+    if (screenshotRequest != 0)
+    {
+        strcpy(screenshotPath, path);
+        screenshotWidth = renderWidth;
+        screenshotHeight = renderHeight;
+    }
+    else
+    {
+        unsigned char *imgData = rlReadScreenPixels(renderWidth, renderHeight);
+        ExportScreenshot(imgData, renderWidth, renderHeight, path);
+    }
+}
+
+// Get memory usage statistics, CPU memory by subsystem and GPU memory by resources kind
+// NOTE: CPU memory is only tracked with SUPPORT_MEMORY_TRACKING, GPU memory is estimated from
+// resources formats and sizes, video peak is the sum of textures and buffers peaks
+MemoryStats GetMemoryStats(void)
+{
+    MemoryStats stats = { 0 };
+
+    GetMemoryUsage(&stats.heap, stats.tags);
+    rlGetVideoMemoryUsage(&stats.videoTextures, &stats.videoBuffers);
+
+    stats.video.bytes = stats.videoTextures.bytes + stats.videoBuffers.bytes;
+    stats.video.peakBytes = stats.videoTextures.peakBytes + stats.videoBuffers.peakBytes;
+    stats.video.count = stats.videoTextures.count + stats.videoBuffers.count;
+    stats.video.totalCount = stats.videoTextures.totalCount + stats.videoBuffers.totalCount;
+
+    return stats;
 }
 
 // Check if the file exists
@@ -1837,6 +2921,9 @@ bool FileExists(const char *fileName)
 #else
     if (access(fileName, F_OK) != -1) result = true;
 #endif
+#if defined(SUPPORT_PACK_FILES)
+    if (!result && IsPackedFile(fileName)) result = true;
+#endif
 
     return result;
 }
@@ -1988,39 +3075,35 @@ const char *GetWorkingDirectory(void)
     return currentDir;
 }
 
-// Get filenames in a directory path (max 512 files)
+// Get filenames in a directory path
 // NOTE: Files count is returned by parameters pointer
 char **GetDirectoryFiles(const char *dirPath, int *fileCount)
 {
-    #define MAX_DIRECTORY_FILES     512
-
     ClearDirectoryFiles();
 
-    // Memory allocation for MAX_DIRECTORY_FILES
-    dirFilesPath = (char **)RL_MALLOC(sizeof(char *)*MAX_DIRECTORY_FILES);
-    for (int i = 0; i < MAX_DIRECTORY_FILES; i++) dirFilesPath[i] = (char *)RL_MALLOC(sizeof(char)*MAX_FILEPATH_LENGTH);
-
-    int counter = 0;
+    int capacity = 0;
     struct dirent *ent;
     DIR *dir = opendir(dirPath);
 
     if (dir != NULL)  // It's a directory
     {
-        // TODO: Reading could be done in two passes,
-        // first one to count files and second one to read names
-        // That way we can allocate required memory, instead of a limited pool
-
         while ((ent = readdir(dir)) != NULL)
         {
-            strcpy(dirFilesPath[counter], ent->d_name);
-            counter++;
+            if (dirFilesCount == capacity)
+            {
+                capacity = (capacity > 0)? capacity*2 : 64;
+                dirFilesPath = (char **)RL_REALLOC(dirFilesPath, capacity*sizeof(char *));
+            }
+
+            dirFilesPath[dirFilesCount] = (char *)RL_MALLOC(strlen(ent->d_name) + 1);
+            strcpy(dirFilesPath[dirFilesCount], ent->d_name);
+            dirFilesCount++;
         }
 
         closedir(dir);
     }
     else TraceLog(LOG_WARNING, "Can not open directory...\n"); // Maybe it's a file...
 
-    dirFilesCount = counter;
     *fileCount = dirFilesCount;
 
     return dirFilesPath;
@@ -2029,17 +3112,198 @@ char **GetDirectoryFiles(const char *dirPath, int *fileCount)
 // Clear directory files paths buffers
 void ClearDirectoryFiles(void)
 {
-    if (dirFilesCount > 0)
-    {
-        for (int i = 0; i < MAX_DIRECTORY_FILES; i++) RL_FREE(dirFilesPath[i]);
+    for (int i = 0; i < dirFilesCount; i++) RL_FREE(dirFilesPath[i]);
 
-        RL_FREE(dirFilesPath);
-    }
-    
+    RL_FREE(dirFilesPath);
+
+    dirFilesPath = NULL;
     dirFilesCount = 0;
 }
 
-// Change working directory, returns true if success
+// Open directory to read entries one by one, no entries limit (ReadDirectoryEntry())
+// NOTE: Filter is a list of file extensions separated by ';' (i.e. ".png;.jpg"), NULL reads all files,
+// directories are always read (filter only applies to files)
+Directory OpenDirectory(const char *dirPath, const char *filter, bool recursive)
+{
+    Directory directory = { 0 };
+    directory.recursive = recursive;
+
+    DIR *dir = opendir(dirPath);
+
+    if (dir == NULL)
+    {
+        TraceLog(LOG_WARNING, "[%s] Directory could not be opened", dirPath);
+        return directory;
+    }
+
+    DirectoryData *data = (DirectoryData *)RL_CALLOC(1, sizeof(DirectoryData));
+
+    // Path separators at the end are removed, entries path is built as path + '/' + name
+    int pathLength = (int)strlen(dirPath);
+    while ((pathLength > 0) && ((dirPath[pathLength - 1] == '/') || (dirPath[pathLength - 1] == '\\'))) pathLength--;
+
+    data->pathCapacity = pathLength + 256;
+    data->path = (char *)RL_MALLOC(data->pathCapacity);
+    memcpy(data->path, dirPath, pathLength);
+    data->path[pathLength] = '\0';
+
+    data->levels = (DirectoryLevel *)RL_MALLOC(8*sizeof(DirectoryLevel));
+    data->levelsCapacity = 8;
+    data->levels[0].dir = dir;
+    data->levels[0].pathLength = pathLength;
+    data->levelsCount = 1;
+
+    // Filter extensions are stored once in lower case (without dot)
+    if ((filter != NULL) && (filter[0] != '\0'))
+    {
+        int separators = 0;
+        for (int i = 0; filter[i] != '\0'; i++) if (filter[i] == ';') separators++;
+
+        data->filters = (char *)RL_MALLOC(strlen(filter) + 1);
+        data->filterStarts = (int *)RL_CALLOC(separators + 2, sizeof(int));
+
+        for (int i = 0; ; i++)
+        {
+            char c = filter[i];
+
+            if ((c == ';') || (c == '\0'))
+            {
+                data->filters[i] = '\0';
+
+                if (filter[data->filterStarts[data->filtersCount]] == '.') data->filterStarts[data->filtersCount]++;
+                if (data->filterStarts[data->filtersCount] < i) data->filtersCount++;
+                data->filterStarts[data->filtersCount] = i + 1;
+
+                if (c == '\0') break;
+            }
+            else data->filters[i] = (char)tolower((unsigned char)c);
+        }
+    }
+
+    directory.ctxData = data;
+
+    return directory;
+}
+
+// Read next directory entry, returns false when all entries have been read
+// NOTE: Entry file info (type, size and modification time) is read with a single stat() call,
+// symbolic links to directories are reported but not followed on recursive reading
+bool ReadDirectoryEntry(Directory directory, DirectoryEntry *entry)
+{
+    DirectoryData *data = (DirectoryData *)directory.ctxData;
+
+    if ((data == NULL) || (entry == NULL)) return false;
+
+    while (data->levelsCount > 0)
+    {
+        DirectoryLevel *level = &data->levels[data->levelsCount - 1];
+        struct dirent *ent = readdir(level->dir);
+
+        if (ent == NULL)
+        {
+            closedir(level->dir);
+            data->levelsCount--;
+            continue;
+        }
+
+        const char *name = ent->d_name;
+        if ((name[0] == '.') && ((name[1] == '\0') || ((name[1] == '.') && (name[2] == '\0')))) continue;
+
+        int nameLength = (int)strlen(name);
+        int pathLength = level->pathLength + 1 + nameLength;
+
+        if ((pathLength + 1) > data->pathCapacity)
+        {
+            while ((pathLength + 1) > data->pathCapacity) data->pathCapacity *= 2;
+            data->path = (char *)RL_REALLOC(data->path, data->pathCapacity);
+        }
+
+        data->path[level->pathLength] = '/';
+        memcpy(data->path + level->pathLength + 1, name, nameLength + 1);
+
+        struct stat info = { 0 };
+        bool link = false;
+#if defined(_WIN32)
+        bool valid = (stat(data->path, &info) == 0);
+        bool isDirectory = valid && ((info.st_mode & S_IFMT) == S_IFDIR);
+#else
+        bool valid = (lstat(data->path, &info) == 0);
+
+        if (valid && S_ISLNK(info.st_mode))
+        {
+            link = true;
+            valid = (stat(data->path, &info) == 0);
+        }
+
+        bool isDirectory = valid && S_ISDIR(info.st_mode);
+#endif
+
+        if (!isDirectory && (data->filtersCount > 0))
+        {
+            const char *ext = strrchr(name, '.');
+            bool accepted = false;
+
+            for (int i = 0; (ext != NULL) && (i < data->filtersCount) && !accepted; i++)
+            {
+                const char *filterExt = data->filters + data->filterStarts[i];
+                int k = 0;
+
+                while ((filterExt[k] != '\0') && (filterExt[k] == tolower((unsigned char)ext[k + 1]))) k++;
+
+                accepted = ((filterExt[k] == '\0') && (ext[k + 1] == '\0'));
+            }
+
+            if (!accepted) continue;
+        }
+
+        entry->name = data->path + level->pathLength + 1;
+        entry->path = data->path;
+        entry->isDirectory = isDirectory;
+        entry->size = (valid && !isDirectory)? (long long)info.st_size : 0;
+        entry->modTime = valid? (long)info.st_mtime : 0;
+        entry->depth = data->levelsCount - 1;
+
+        if (isDirectory && directory.recursive && !link)
+        {
+            DIR *dir = opendir(data->path);
+
+            if (dir != NULL)
+            {
+                if (data->levelsCount == data->levelsCapacity)
+                {
+                    data->levelsCapacity *= 2;
+                    data->levels = (DirectoryLevel *)RL_REALLOC(data->levels, data->levelsCapacity*sizeof(DirectoryLevel));
+                }
+
+                data->levels[data->levelsCount].dir = dir;
+                data->levels[data->levelsCount].pathLength = pathLength;
+                data->levelsCount++;
+            }
+        }
+
+        return true;
+    }
+
+    return false;
+}
+
+// Close directory opened for reading entries
+void CloseDirectory(Directory directory)
+{
+    DirectoryData *data = (DirectoryData *)directory.ctxData;
+
+    if (data == NULL) return;
+
+    for (int i = 0; i < data->levelsCount; i++) closedir(data->levels[i].dir);
+
+    RL_FREE(data->levels);
+    RL_FREE(data->path);
+    RL_FREE(data->filters);
+    RL_FREE(data->filterStarts);
+    RL_FREE(data);
+}
+
+// Change working directory, returns true if success
 bool ChangeDirectory(const char *dir)
 {
     return (CHDIR(dir) == 0);
@@ -2090,8 +3354,6 @@ long GetFileModTime(const char *fileName)
 // Compress data (DEFLATE algorythm)
 unsigned char *CompressData(unsigned char *data, int dataLength, int *compDataLength)
 {
-    #define COMPRESSION_QUALITY_DEFLATE  8
-
     unsigned char *compData = NULL;
 
 #if defined(SUPPORT_COMPRESSION_API)
@@ -2113,83 +3375,353 @@ unsigned char *DecompressData(unsigned char *compData, int compDataLength, int *
     return (unsigned char *)data;
 }
 
-// Save integer value to storage file (to defined position)
-// NOTE: Storage positions is directly related to file memory layout (4 bytes each integer)
-void StorageSaveValue(int position, int value)
+// Get compressed data max size for a codec, output buffer of this size is always enough
+int GetCompressDataBound(int dataLength, int codec)
 {
-    FILE *storageFile = NULL;
+    // NOTE: DEFLATE compressor uses fixed Huffman codes, literals take up to 9 bits
+    // and shortest matches (3 bytes) up to 31 bits
+    if (codec == COMPRESSION_LZ4) return dataLength + dataLength/255 + 16;
+    else return dataLength + dataLength/3 + 64;
+}
 
-    char path[512] = { 0 };
-#if defined(PLATFORM_ANDROID)
-    strcpy(path, internalDataPath);
-    strcat(path, "/");
-    strcat(path, STORAGE_FILENAME);
+// Compress data into provided buffer, returns compressed size (0 if buffer is not enough or codec not available)
+// NOTE: LZ4 compresses directly into buffer, DEFLATE data is copied from a temporary buffer
+int CompressDataEx(const unsigned char *data, int dataLength, unsigned char *compData, int compDataCapacity, int codec)
+{
+    int compDataLength = 0;
+
+    if ((data == NULL) || (dataLength <= 0) || (compData == NULL)) return 0;
+
+    if (codec == COMPRESSION_LZ4) compDataLength = CompressLZ4(data, dataLength, compData, compDataCapacity);
+    else
+    {
+#if defined(SUPPORT_COMPRESSION_API)
+        unsigned char *deflateData = stbi_zlib_compress((unsigned char *)data, dataLength, &compDataLength, COMPRESSION_QUALITY_DEFLATE);
+
+        if ((deflateData != NULL) && (compDataLength <= compDataCapacity)) memcpy(compData, deflateData, compDataLength);
+        else compDataLength = 0;
+
+        RL_FREE(deflateData);
 #else
-    strcpy(path, STORAGE_FILENAME);
+        TraceLog(LOG_WARNING, "DEFLATE compression not supported (SUPPORT_COMPRESSION_API)");
 #endif
+    }
+
+    return compDataLength;
+}
 
-    // Try open existing file to append data
-    storageFile = fopen(path, "rb+");
+// Decompress data into provided buffer, returns decompressed size (-1 if malformed data, buffer not enough or codec not available)
+// NOTE: LZ4 blocks do not store decompressed size, it should be stored along with compressed data
+int DecompressDataEx(const unsigned char *compData, int compDataLength, unsigned char *data, int dataCapacity, int codec)
+{
+    int dataLength = -1;
 
-    // If file doesn't exist, create a new storage data file
-    if (!storageFile) storageFile = fopen(path, "wb");
+    if ((compData == NULL) || (compDataLength <= 0) || (data == NULL)) return -1;
 
-    if (!storageFile) TraceLog(LOG_WARNING, "Storage data file could not be created");
+    if (codec == COMPRESSION_LZ4) dataLength = DecompressLZ4(compData, compDataLength, data, dataCapacity);
     else
     {
-        // Get file size
-        fseek(storageFile, 0, SEEK_END);
-        int fileSize = ftell(storageFile);  // Size in bytes
-        fseek(storageFile, 0, SEEK_SET);
+#if defined(SUPPORT_COMPRESSION_API)
+        dataLength = stbi_zlib_decode_buffer((char *)data, dataCapacity, (const char *)compData, compDataLength);
+#else
+        TraceLog(LOG_WARNING, "DEFLATE decompression not supported (SUPPORT_COMPRESSION_API)");
+#endif
+    }
 
-        if (fileSize < (position*sizeof(int))) TraceLog(LOG_WARNING, "Storage position could not be found");
-        else
+    return dataLength;
+}
+
+// Load compression stream, data fed is compressed (or decompressed) by blocks of COMPRESS_STREAM_BLOCK_SIZE
+// NOTE: Blocks are compressed independently, so decompression can start as soon as first block is received
+CompressStream LoadCompressStream(int codec, bool decompress)
+{
+    CompressStream stream = { 0 };
+
+    stream.codec = codec;
+    stream.decompress = decompress;
+
+    CompressStreamData *data = (CompressStreamData *)RL_CALLOC(1, sizeof(CompressStreamData));
+    data->inputCapacity = decompress? GetCompressDataBound(COMPRESS_STREAM_BLOCK_SIZE, codec) + 8 : COMPRESS_STREAM_BLOCK_SIZE;
+    data->input = (unsigned char *)RL_MALLOC(data->inputCapacity);
+
+    stream.ctxData = data;
+
+    return stream;
+}
+
+// Unload compression stream, data not read is discarded
+void UnloadCompressStream(CompressStream stream)
+{
+    CompressStreamData *data = (CompressStreamData *)stream.ctxData;
+
+    if (data == NULL) return;
+
+    RL_FREE(data->input);
+    RL_FREE(data->output);
+    RL_FREE(data);
+}
+
+// Feed data to compression stream, output is available to read once a block is completed
+// NOTE: Returns false if decompressed data is malformed (stream should be unloaded)
+bool UpdateCompressStream(CompressStream stream, const unsigned char *data, int dataLength)
+{
+    CompressStreamData *streamData = (CompressStreamData *)stream.ctxData;
+
+    if ((streamData == NULL) || (data == NULL)) return false;
+
+    while (dataLength > 0)
+    {
+        int size = streamData->inputCapacity - streamData->inputLength;
+        if (size > dataLength) size = dataLength;
+
+        memcpy(streamData->input + streamData->inputLength, data, size);
+        streamData->inputLength += size;
+        data += size;
+        dataLength -= size;
+
+        if (!stream.decompress)
+        {
+            if (streamData->inputLength == streamData->inputCapacity) CompressStreamBlock(stream);
+            continue;
+        }
+
+        // Decompress every complete block received
+        int offset = 0;
+
+        while ((streamData->inputLength - offset) >= 8)
+        {
+            unsigned int header[2] = { 0 };     // Block size and compressed size
+            memcpy(header, streamData->input + offset, 8);
+
+            bool stored = ((header[1] & COMPRESS_BLOCK_STORED) != 0);
+            int blockSize = (int)header[0];
+            int compSize = (int)(header[1] & ~COMPRESS_BLOCK_STORED);
+
+            if ((blockSize > COMPRESS_STREAM_BLOCK_SIZE) || ((compSize + 8) > streamData->inputCapacity) || (stored && (compSize != blockSize))) return false;
+            if ((streamData->inputLength - offset - 8) < compSize) break;      // Block not completed yet
+
+            const unsigned char *compData = streamData->input + offset + 8;
+            unsigned char *output = GetCompressStreamOutput(streamData, blockSize);
+
+            if (stored) memcpy(output, compData, blockSize);
+            else if (DecompressDataEx(compData, compSize, output, blockSize, stream.codec) != blockSize) return false;
+
+            offset += (8 + compSize);
+        }
+
+        if (offset > 0)
         {
-            fseek(storageFile, (position*sizeof(int)), SEEK_SET);
-            fwrite(&value, 1, sizeof(int), storageFile);
+            streamData->inputLength -= offset;
+            memmove(streamData->input, streamData->input + offset, streamData->inputLength);
         }
+    }
+
+    return true;
+}
+
+// Compress data fed not compressed yet (partial block), output can be read after flushing
+void FlushCompressStream(CompressStream stream)
+{
+    if ((stream.ctxData != NULL) && !stream.decompress) CompressStreamBlock(stream);
+}
+
+// Read compression stream output available (compressed or decompressed blocks), returns bytes read
+int ReadCompressStream(CompressStream stream, unsigned char *buffer, int bufferSize)
+{
+    CompressStreamData *data = (CompressStreamData *)stream.ctxData;
+
+    if ((data == NULL) || (buffer == NULL)) return 0;
+
+    int size = data->outputLength - data->outputRead;
+    if (size > bufferSize) size = bufferSize;
+    if (size <= 0) return 0;
+
+    memcpy(buffer, data->output + data->outputRead, size);
+    data->outputRead += size;
+
+    if (data->outputRead == data->outputLength)
+    {
+        data->outputLength = 0;
+        data->outputRead = 0;
+    }
+
+    return size;
+}
+
+// Save integer value to storage (to defined position)
+// NOTE: Value is kept in memory, storage file is written on StorageFlush() or CloseWindow(),
+// storage grows as required (positions not saved before are 0)
+void StorageSaveValue(int position, int value)
+{
+    if (position < 0) return;
+
+    LoadStorage();
+
+    if (position >= storageValuesCount)
+    {
+        int *values = (int *)RL_REALLOC(storageValues, (position + 1)*sizeof(int));
 
-        fclose(storageFile);
+        if (values == NULL) { TraceLog(LOG_WARNING, "Storage position could not be allocated"); return; }
+
+        for (int i = storageValuesCount; i <= position; i++) values[i] = 0;
+
+        storageValues = values;
+        storageValuesCount = position + 1;
     }
+
+    storageValues[position] = value;
+    storageDirty = true;
 }
 
-// Load integer value from storage file (from defined position)
+// Load integer value from storage (from defined position)
 // NOTE: If requested position could not be found, value 0 is returned
 int StorageLoadValue(int position)
 {
-    int value = 0;
+    LoadStorage();
 
-    char path[512] = { 0 };
-#if defined(PLATFORM_ANDROID)
-    strcpy(path, internalDataPath);
-    strcat(path, "/");
-    strcat(path, STORAGE_FILENAME);
-#else
-    strcpy(path, STORAGE_FILENAME);
-#endif
+    if ((position < 0) || (position >= storageValuesCount))
+    {
+        TraceLog(LOG_WARNING, "Storage position could not be found");
+        return 0;
+    }
 
-    // Try open existing file to append data
-    FILE *storageFile = fopen(path, "rb");
+    return storageValues[position];
+}
 
-    if (!storageFile) TraceLog(LOG_WARNING, "Storage data file could not be found");
-    else
+// Save integer value to storage (keyed)
+void StorageSaveInt(const char *key, int value)
+{
+    StorageEntry *entry = GetStorageEntry(key, STORAGE_VALUE_INT, true);
+
+    if ((entry != NULL) && (entry->intValue != value))
     {
-        // Get file size
-        fseek(storageFile, 0, SEEK_END);
-        int fileSize = ftell(storageFile);      // Size in bytes
-        rewind(storageFile);
+        entry->intValue = value;
+        storageDirty = true;
+    }
+}
 
-        if (fileSize < (position*4)) TraceLog(LOG_WARNING, "Storage position could not be found");
-        else
+// Load integer value from storage (keyed), default value returned if key not found (or different type)
+int StorageLoadInt(const char *key, int defaultValue)
+{
+    StorageEntry *entry = GetStorageEntry(key, STORAGE_VALUE_INT, false);
+
+    return (entry != NULL)? entry->intValue : defaultValue;
+}
+
+// Save float value to storage (keyed)
+void StorageSaveFloat(const char *key, float value)
+{
+    StorageEntry *entry = GetStorageEntry(key, STORAGE_VALUE_FLOAT, true);
+
+    if ((entry != NULL) && (entry->floatValue != value))
+    {
+        entry->floatValue = value;
+        storageDirty = true;
+    }
+}
+
+// Load float value from storage (keyed), default value returned if key not found (or different type)
+float StorageLoadFloat(const char *key, float defaultValue)
+{
+    StorageEntry *entry = GetStorageEntry(key, STORAGE_VALUE_FLOAT, false);
+
+    return (entry != NULL)? entry->floatValue : defaultValue;
+}
+
+// Save string value to storage (keyed), string is copied
+void StorageSaveString(const char *key, const char *text)
+{
+    if (text == NULL) text = "";
+
+    StorageEntry *entry = GetStorageEntry(key, STORAGE_VALUE_STRING, true);
+
+    if ((entry != NULL) && ((entry->text == NULL) || (strcmp(entry->text, text) != 0)))
+    {
+        char *copy = (char *)RL_MALLOC(strlen(text) + 1);
+        strcpy(copy, text);
+
+        RL_FREE(entry->text);
+        entry->text = copy;
+        storageDirty = true;
+    }
+}
+
+// Load string value from storage (keyed), default value returned if key not found (or different type)
+// NOTE: Returned string is owned by storage, valid until key value is saved again
+const char *StorageLoadString(const char *key, const char *defaultValue)
+{
+    StorageEntry *entry = GetStorageEntry(key, STORAGE_VALUE_STRING, false);
+
+    return (entry != NULL)? entry->text : defaultValue;
+}
+
+// Write storage values to storage file, if modified since last flush (also called on CloseWindow())
+// NOTE: Values are written to a temporary file that replaces storage file once completed (atomic),
+// previous storage file is kept if writing fails
+bool StorageFlush(void)
+{
+    if (!storageDirty) return true;
+
+    const char *path = GetStoragePath();
+    char tempPath[MAX_FILEPATH_LENGTH + 8] = { 0 };
+    sprintf(tempPath, "%s.tmp", path);
+
+    FILE *storageFile = fopen(tempPath, "wb");
+
+    if (storageFile == NULL)
+    {
+        TraceLog(LOG_WARNING, "Storage data file could not be created");
+        return false;
+    }
+
+    // Storage file header (16 bytes): char id[4] = "rSTG", uint32 version, uint32 valuesCount, uint32 entriesCount
+    unsigned int header[3] = { STORAGE_FILE_VERSION, (unsigned int)storageValuesCount, (unsigned int)storageEntriesCount };
+    bool success = (fwrite("rSTG", 1, 4, storageFile) == 4) && (fwrite(header, sizeof(unsigned int), 3, storageFile) == 3);
+
+    if (success && (storageValuesCount > 0)) success = (fwrite(storageValues, sizeof(int), storageValuesCount, storageFile) == (size_t)storageValuesCount);
+
+    // Keyed values: uint16 type, uint16 keyLength, char key[keyLength], value (int, float or uint32 length + chars)
+    for (int i = 0; success && (i < storageEntriesCount); i++)
+    {
+        StorageEntry *entry = &storageEntries[i];
+        unsigned short info[2] = { (unsigned short)entry->type, (unsigned short)strlen(entry->key) };
+
+        success = (fwrite(info, sizeof(unsigned short), 2, storageFile) == 2) && (fwrite(entry->key, 1, info[1], storageFile) == info[1]);
+
+        if (success)
         {
-            fseek(storageFile, (position*4), SEEK_SET);
-            fread(&value, 4, 1, storageFile);   // Read 1 element of 4 bytes size
+            if (entry->type == STORAGE_VALUE_INT) success = (fwrite(&entry->intValue, sizeof(int), 1, storageFile) == 1);
+            else if (entry->type == STORAGE_VALUE_FLOAT) success = (fwrite(&entry->floatValue, sizeof(float), 1, storageFile) == 1);
+            else
+            {
+                unsigned int length = (unsigned int)strlen(entry->text);
+                success = (fwrite(&length, sizeof(unsigned int), 1, storageFile) == 1) && (fwrite(entry->text, 1, length, storageFile) == length);
+            }
         }
+    }
 
-        fclose(storageFile);
+    if (fflush(storageFile) != 0) success = false;
+#if !defined(_WIN32)
+    if (success && (fsync(fileno(storageFile)) != 0)) success = false;
+#endif
+    fclose(storageFile);
+
+#if defined(_WIN32)
+    if (success) success = (MoveFileExA(tempPath, path, 0x00000001 | 0x00000008) != 0);
+#else
+    if (success) success = (rename(tempPath, path) == 0);
+#endif
+
+    if (!success)
+    {
+        remove(tempPath);
+        TraceLog(LOG_WARNING, "Storage data file could not be written");
+        return false;
     }
 
-    return value;
+    storageDirty = false;
+
+    return true;
 }
 
 // Open URL with default system browser (if available)
@@ -2221,6 +3753,36 @@ void OpenURL(const char *url)
     }
 }
 
+// Load shader from files shared with previous loads of same files (not modified since)
+// NOTE: Cached shaders should be unloaded with UnloadShaderCached(), program is unloaded with last reference
+Shader LoadShaderCached(const char *vsFileName, const char *fsFileName)
+{
+    // NOTE: Default shader is not cached, it is loaded directly
+    if ((vsFileName == NULL) && (fsFileName == NULL)) return LoadShader(vsFileName, fsFileName);
+
+    const char *fileName = (vsFileName != NULL)? vsFileName : "";
+    Shader *cached = (Shader *)AcquireCachedAsset(ASSET_SHADER, fileName, fsFileName);
+
+    if (cached != NULL) return *cached;
+
+    Shader shader = LoadShader(vsFileName, fsFileName);
+
+    if (shader.id != GetShaderDefault().id) AddCachedAsset(ASSET_SHADER, fileName, fsFileName, &shader, sizeof(Shader), shader.id, NULL);
+
+    return shader;
+}
+
+// Release cached shader reference, shader is unloaded with last reference
+// NOTE: Shaders not cached are unloaded directly
+void UnloadShaderCached(Shader shader)
+{
+    Shader cached = { 0 };
+    int result = ReleaseCachedAsset(ASSET_SHADER, shader.id, &cached, sizeof(Shader));
+
+    if (result == 1) UnloadShader(cached);
+    else if (result == -1) UnloadShader(shader);
+}
+
 //----------------------------------------------------------------------------------
 // Module Functions Definition - Input (Keyboard, Mouse, Gamepad) Functions
 //----------------------------------------------------------------------------------
@@ -2281,16 +3843,49 @@ int GetKeyPressed(void)
     return value;
 }
 
-// Set a custom key to exit program
-// NOTE: default exitKey is ESCAPE
-void SetExitKey(int key)
+// Get next queued input event (oldest first), returns false if queue is empty
+// NOTE: Events are timestamped when received, including the ones shorter than a frame
+bool GetInputEvent(InputEvent *event)
 {
-#if !defined(PLATFORM_ANDROID)
-    exitKey = key;
-#endif
-}
+    bool result = false;
 
-// NOTE: Gamepad support not implemented in emscripten GLFW3 (PLATFORM_WEB)
+    if (inputEventsCount > 0)
+    {
+        *event = inputEvents[inputEventsHead];
+        inputEventsHead = (inputEventsHead + 1)%MAX_INPUT_EVENTS;
+        inputEventsCount--;
+        result = true;
+    }
+
+    return result;
+}
+
+// Clear queued input events
+void ClearInputEvents(void)
+{
+    inputEventsHead = 0;
+    inputEventsCount = 0;
+}
+
+// Get input events dropped on full queue (counter is reset)
+int GetInputEventsDropped(void)
+{
+    int dropped = inputEventsDropped;
+    inputEventsDropped = 0;
+
+    return dropped;
+}
+
+// Set a custom key to exit program
+// NOTE: default exitKey is ESCAPE
+void SetExitKey(int key)
+{
+#if !defined(PLATFORM_ANDROID)
+    exitKey = key;
+#endif
+}
+
+// NOTE: Gamepad support not implemented in emscripten GLFW3 (PLATFORM_WEB)
 
 // Detect if a gamepad is available
 bool IsGamepadAvailable(int gamepad)
@@ -2642,7 +4237,52 @@ static bool InitGraphicsDevice(int width, int height)
     // NOTE: Framebuffer (render area - renderWidth, renderHeight) could include black bars...
     // ...in top-down or left-right to match display aspect ratio (no weird scalings)
 
-#if defined(PLATFORM_DESKTOP) || defined(PLATFORM_WEB)
+#if defined(PLATFORM_WEB) && defined(SUPPORT_WEB_WORKER)
+    // NOTE: Main loop runs on a worker thread (PROXY_TO_PTHREAD) with canvas transferred as OffscreenCanvas,
+    // emscripten GLFW3 requires the browser main thread, so WebGL context is created directly on this thread
+    baseTime = emscripten_get_now();
+
+    displayWidth = screenWidth;
+    displayHeight = screenHeight;
+    renderWidth = screenWidth;
+    renderHeight = screenHeight;
+
+    emscripten_set_canvas_element_size("#canvas", screenWidth, screenHeight);
+
+    EmscriptenWebGLContextAttributes attribs;
+    emscripten_webgl_init_context_attributes(&attribs);
+    attribs.alpha = (configFlags & FLAG_WINDOW_TRANSPARENT)? EM_TRUE : EM_FALSE;
+    attribs.antialias = (configFlags & FLAG_MSAA_4X_HINT)? EM_TRUE : EM_FALSE;
+    attribs.explicitSwapControl = EM_TRUE;              // Frames presented on SwapBuffers(), worker never yields to browser
+    attribs.renderViaOffscreenBackBuffer = EM_TRUE;     // Fallback to proxied rendering if OffscreenCanvas not supported
+#if defined(SUPPORT_WEBGL2)
+    attribs.majorVersion = 2;                           // Request WebGL 2.0 (OpenGL ES 3.0)
+#endif
+
+    webglContext = emscripten_webgl_create_context("#canvas", &attribs);
+
+#if defined(SUPPORT_WEBGL2)
+    if (webglContext <= 0)
+    {
+        TraceLog(LOG_WARNING, "WebGL 2.0 context not available, trying WebGL 1.0");
+        attribs.majorVersion = 1;
+        webglContext = emscripten_webgl_create_context("#canvas", &attribs);
+    }
+#endif
+
+    if (webglContext <= 0)
+    {
+        TraceLog(LOG_WARNING, "Failed to create WebGL context on worker thread");
+        return false;
+    }
+
+    emscripten_webgl_make_context_current(webglContext);
+
+    TraceLog(LOG_INFO, "Display device initialized successfully (worker thread, WebGL %i.0)", attribs.majorVersion);
+    TraceLog(LOG_INFO, "Render size: %i x %i", renderWidth, renderHeight);
+#endif  // PLATFORM_WEB && SUPPORT_WEB_WORKER
+
+#if defined(PLATFORM_DESKTOP) || (defined(PLATFORM_WEB) && !defined(SUPPORT_WEB_WORKER))
     glfwSetErrorCallback(ErrorCallback);
 
 #if defined(__APPLE__)
@@ -2735,7 +4375,12 @@ static bool InitGraphicsDevice(int width, int height)
     }
     else if (rlGetVersion() == OPENGL_ES_20)                    // Request OpenGL ES 2.0 context
     {
+#if defined(PLATFORM_WEB) && defined(SUPPORT_WEBGL2)
+        // NOTE: OpenGL ES 3.0 (WebGL 2.0) context is backward compatible, rlgl uses its core features on ES2 code path
+        glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
+#else
         glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 2);
+#endif
         glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 0);
         glfwWindowHint(GLFW_CLIENT_API, GLFW_OPENGL_ES_API);
 #if defined(PLATFORM_DESKTOP)
@@ -2866,9 +4511,10 @@ static bool InitGraphicsDevice(int width, int height)
     {
         // WARNING: It seems to hits a critical render path in Intel HD Graphics
         glfwSwapInterval(1);
+        swapInterval = 1;
         TraceLog(LOG_INFO, "Trying to enable VSYNC");
     }
-#endif // PLATFORM_DESKTOP || PLATFORM_WEB
+#endif // PLATFORM_DESKTOP || (PLATFORM_WEB && !SUPPORT_WEB_WORKER)
 
 #if defined(PLATFORM_ANDROID) || defined(PLATFORM_RPI) || defined(PLATFORM_UWP)
     fullscreenMode = true;
@@ -3199,6 +4845,25 @@ static bool InitGraphicsDevice(int width, int height)
     }
 #endif // PLATFORM_ANDROID || PLATFORM_RPI
 
+#if defined(PLATFORM_HEADLESS)
+    // No display available, screen size is the offscreen framebuffer size
+    if ((screenWidth <= 0) || (screenHeight <= 0))
+    {
+        TraceLog(LOG_WARNING, "Offscreen framebuffer size must be provided on headless mode");
+        return false;
+    }
+
+    displayWidth = screenWidth;
+    displayHeight = screenHeight;
+    renderWidth = screenWidth;
+    renderHeight = screenHeight;
+
+    if (!InitHeadlessDevice()) return false;
+
+    TraceLog(LOG_INFO, "Headless device initialized successfully (%s)", (surface != EGL_NO_SURFACE)? "pbuffer" : "surfaceless, render textures only");
+    TraceLog(LOG_INFO, "Render size: %i x %i", renderWidth, renderHeight);
+#endif  // PLATFORM_HEADLESS
+
     // Initialize OpenGL context (states and resources)
     // NOTE: screenWidth and screenHeight not used, just stored as globals in rlgl
     rlglInit(screenWidth, screenHeight);
@@ -3231,6 +4896,229 @@ static bool InitGraphicsDevice(int width, int height)
     return true;
 }
 
+#if defined(PLATFORM_HEADLESS)
+// Initialize EGL offscreen display, context and surface, no display server required
+// NOTE: A pbuffer surface (renderWidth x renderHeight) is used as default framebuffer if available,
+// otherwise context is made current without surface and only render textures can be drawn
+static bool InitHeadlessDevice(void)
+{
+    display = GetHeadlessDisplay();
+
+    if (display == EGL_NO_DISPLAY)
+    {
+        TraceLog(LOG_WARNING, "Failed to initialize EGL headless display");
+        return false;
+    }
+
+#if defined(GRAPHICS_API_OPENGL_ES2)
+    EGLint renderableType = EGL_OPENGL_ES2_BIT;
+    EGLBoolean apiBound = eglBindAPI(EGL_OPENGL_ES_API);
+#else
+    EGLint renderableType = EGL_OPENGL_BIT;
+    EGLBoolean apiBound = eglBindAPI(EGL_OPENGL_API);
+#endif
+
+    if (apiBound == EGL_FALSE)
+    {
+        TraceLog(LOG_WARNING, "Failed to bind EGL rendering API");
+        return false;
+    }
+
+    EGLint samples = 0;
+    EGLint sampleBuffer = 0;
+    if (configFlags & FLAG_MSAA_4X_HINT)
+    {
+        samples = 4;
+        sampleBuffer = 1;
+        TraceLog(LOG_INFO, "Trying to enable MSAA x4");
+    }
+
+    EGLint framebufferAttribs[] =
+    {
+        EGL_SURFACE_TYPE, EGL_PBUFFER_BIT,  // Offscreen pbuffer surface (replaced by 0 if not available)
+        EGL_RENDERABLE_TYPE, renderableType,
+        EGL_RED_SIZE, 8,            // RED color bit depth
+        EGL_GREEN_SIZE, 8,          // GREEN color bit depth
+        EGL_BLUE_SIZE, 8,           // BLUE color bit depth
+        EGL_ALPHA_SIZE, 8,          // ALPHA bit depth (images readback with transparency)
+        EGL_DEPTH_SIZE, 24,         // Depth buffer size (Required to use Depth testing!)
+        EGL_SAMPLE_BUFFERS, sampleBuffer,   // Activate MSAA
+        EGL_SAMPLES, samples,       // 4x Antialiasing if activated
+        EGL_NONE
+    };
+
+    EGLint numConfigs = 0;
+
+    if ((eglChooseConfig(display, framebufferAttribs, &config, 1, &numConfigs) == EGL_FALSE) || (numConfigs == 0))
+    {
+        // NOTE: Surfaceless displays could provide no pbuffer configs, context is used without surface
+        framebufferAttribs[1] = 0;
+
+        if ((eglChooseConfig(display, framebufferAttribs, &config, 1, &numConfigs) == EGL_FALSE) || (numConfigs == 0))
+        {
+            TraceLog(LOG_WARNING, "Unable to choose EGL headless config");
+            return false;
+        }
+    }
+
+#if defined(GRAPHICS_API_OPENGL_ES2)
+    const EGLint contextAttribs[] = { EGL_CONTEXT_CLIENT_VERSION, 2, EGL_NONE };
+#elif defined(GRAPHICS_API_OPENGL_33) && !defined(GRAPHICS_API_OPENGL_21)
+    const EGLint contextAttribs[] =
+    {
+        EGL_CONTEXT_MAJOR_VERSION, 3,
+        EGL_CONTEXT_MINOR_VERSION, 3,
+        EGL_CONTEXT_OPENGL_PROFILE_MASK, EGL_CONTEXT_OPENGL_CORE_PROFILE_BIT,
+        EGL_NONE
+    };
+#else
+    const EGLint contextAttribs[] = { EGL_NONE };
+#endif
+
+    context = eglCreateContext(display, config, EGL_NO_CONTEXT, contextAttribs);
+
+    if (context == EGL_NO_CONTEXT)
+    {
+        TraceLog(LOG_WARNING, "Failed to create EGL headless context");
+        return false;
+    }
+
+    EGLint surfaceType = 0;
+    eglGetConfigAttrib(display, config, EGL_SURFACE_TYPE, &surfaceType);
+
+    if (surfaceType & EGL_PBUFFER_BIT)
+    {
+        const EGLint pbufferAttribs[] = { EGL_WIDTH, renderWidth, EGL_HEIGHT, renderHeight, EGL_NONE };
+        surface = eglCreatePbufferSurface(display, config, pbufferAttribs);
+    }
+
+    // NOTE: Without surface, context is made current surfaceless (requires EGL_KHR_surfaceless_context)
+    if (eglMakeCurrent(display, surface, surface, context) == EGL_FALSE)
+    {
+        TraceLog(LOG_WARNING, "Unable to make EGL headless context current");
+        return false;
+    }
+
+#if defined(GRAPHICS_API_OPENGL_33)
+    // Load OpenGL 3.3 extensions
+    // NOTE: EGL loader function is passed as parameter
+    rlLoadExtensions(eglGetProcAddress);
+#endif
+
+    return true;
+}
+
+// Get EGL display without display server, initialized
+// NOTE: Mesa surfaceless platform is tried first, then first GPU device (EGL_EXT_platform_device),
+// default display is used as fallback (it could require a display server depending on EGL implementation)
+static EGLDisplay GetHeadlessDisplay(void)
+{
+    EGLDisplay headlessDisplay = EGL_NO_DISPLAY;
+    const char *clientExtensions = eglQueryString(EGL_NO_DISPLAY, EGL_EXTENSIONS);
+
+    if ((clientExtensions != NULL) && (strstr(clientExtensions, "EGL_EXT_platform_base") != NULL))
+    {
+        PFNEGLGETPLATFORMDISPLAYEXTPROC eglGetPlatformDisplayEXT = (PFNEGLGETPLATFORMDISPLAYEXTPROC)eglGetProcAddress("eglGetPlatformDisplayEXT");
+
+        if ((eglGetPlatformDisplayEXT != NULL) && (strstr(clientExtensions, "EGL_MESA_platform_surfaceless") != NULL))
+        {
+            headlessDisplay = eglGetPlatformDisplayEXT(EGL_PLATFORM_SURFACELESS_MESA, EGL_DEFAULT_DISPLAY, NULL);
+
+            if ((headlessDisplay != EGL_NO_DISPLAY) && (eglInitialize(headlessDisplay, NULL, NULL) == EGL_FALSE)) headlessDisplay = EGL_NO_DISPLAY;
+        }
+
+        if ((headlessDisplay == EGL_NO_DISPLAY) && (eglGetPlatformDisplayEXT != NULL) && (strstr(clientExtensions, "EGL_EXT_platform_device") != NULL))
+        {
+            PFNEGLQUERYDEVICESEXTPROC eglQueryDevicesEXT = (PFNEGLQUERYDEVICESEXTPROC)eglGetProcAddress("eglQueryDevicesEXT");
+            EGLDeviceEXT device = NULL;
+            EGLint devicesCount = 0;
+
+            if ((eglQueryDevicesEXT != NULL) && eglQueryDevicesEXT(1, &device, &devicesCount) && (devicesCount > 0))
+            {
+                headlessDisplay = eglGetPlatformDisplayEXT(EGL_PLATFORM_DEVICE_EXT, device, NULL);
+
+                if ((headlessDisplay != EGL_NO_DISPLAY) && (eglInitialize(headlessDisplay, NULL, NULL) == EGL_FALSE)) headlessDisplay = EGL_NO_DISPLAY;
+            }
+        }
+    }
+
+    if (headlessDisplay == EGL_NO_DISPLAY)
+    {
+        headlessDisplay = eglGetDisplay(EGL_DEFAULT_DISPLAY);
+
+        if ((headlessDisplay != EGL_NO_DISPLAY) && (eglInitialize(headlessDisplay, NULL, NULL) == EGL_FALSE)) headlessDisplay = EGL_NO_DISPLAY;
+    }
+
+    return headlessDisplay;
+}
+#endif  // PLATFORM_HEADLESS
+
+// Get camera matrices for a viewport size, computed only if camera or viewport changed
+// NOTE: Last cameras used are cached, so different cameras in the same frame (i.e. main view and minimap) are kept
+static const CameraMatrices *GetCameraMatricesCached(Camera camera, int width, int height)
+{
+    for (int i = 0; i < MAX_CAMERA_CACHE; i++)
+    {
+        CameraCacheEntry *entry = &cameraCache[i];
+
+        if (entry->valid && (entry->width == width) && (entry->height == height) &&
+            (memcmp(&entry->camera, &camera, sizeof(Camera)) == 0)) return &entry->matrices;
+    }
+
+    CameraCacheEntry *entry = &cameraCache[cameraCacheNext];
+    cameraCacheNext = (cameraCacheNext + 1)%MAX_CAMERA_CACHE;
+
+    entry->camera = camera;
+    entry->width = width;
+    entry->height = height;
+    entry->valid = true;
+
+    CameraMatrices *matrices = &entry->matrices;
+    double aspect = (double)width/(double)height;
+
+    matrices->view = MatrixLookAt(camera.position, camera.target, camera.up);
+
+    if (camera.type == CAMERA_ORTHOGRAPHIC)
+    {
+        double top = camera.fovy/2.0;
+        double right = top*aspect;
+
+        matrices->projection = MatrixOrtho(-right, right, -top, top, DEFAULT_NEAR_CULL_DISTANCE, DEFAULT_FAR_CULL_DISTANCE);
+    }
+    else matrices->projection = MatrixPerspective(camera.fovy*DEG2RAD, aspect, DEFAULT_NEAR_CULL_DISTANCE, DEFAULT_FAR_CULL_DISTANCE);
+
+    matrices->viewProjection = MatrixMultiply(matrices->view, matrices->projection);
+    matrices->invViewProjection = MatrixInvert(matrices->viewProjection);
+
+    // Frustum planes extracted from clip space rows: w + x, w - x, w + y, w - y, w + z, w - z
+    Matrix mvp = matrices->viewProjection;
+    float rows[4][4] = {
+        { mvp.m0, mvp.m4, mvp.m8, mvp.m12 },
+        { mvp.m1, mvp.m5, mvp.m9, mvp.m13 },
+        { mvp.m2, mvp.m6, mvp.m10, mvp.m14 },
+        { mvp.m3, mvp.m7, mvp.m11, mvp.m15 }
+    };
+
+    for (int i = 0; i < 6; i++)
+    {
+        float sign = (i%2 == 0)? 1.0f : -1.0f;
+        Vector4 plane = {
+            rows[3][0] + sign*rows[i/2][0],
+            rows[3][1] + sign*rows[i/2][1],
+            rows[3][2] + sign*rows[i/2][2],
+            rows[3][3] + sign*rows[i/2][3]
+        };
+
+        // Normalized planes, point to plane distances are in world units
+        float length = sqrtf(plane.x*plane.x + plane.y*plane.y + plane.z*plane.z);
+        if (length > 0.0f) plane = (Vector4){ plane.x/length, plane.y/length, plane.z/length, plane.w/length };
+
+        matrices->planes[i] = plane;
+    }
+
+    return matrices;
+}
+
 // Set viewport for a provided width and height
 static void SetupViewport(int width, int height)
 {
@@ -3253,6 +5141,189 @@ static void SetupViewport(int width, int height)
     rlLoadIdentity();                   // Reset current matrix (MODELVIEW)
 }
 
+// Begin drawing to internal render target, sized to render area scaled by dynamic resolution scale
+// NOTE: Render targets are taken from rlgl transient pool, scale steps keep a few sizes reused
+static void BeginResolutionTarget(void)
+{
+    int width = (int)((renderWidth - renderOffsetX)*resolutionScale);
+    int height = (int)((renderHeight - renderOffsetY)*resolutionScale);
+
+    if (width < 1) width = 1;
+    if (height < 1) height = 1;
+
+    rlglDraw();
+
+    resolutionTarget = rlGetPooledRenderTexture(width, height, UNCOMPRESSED_R8G8B8A8, 24, false);
+
+    if (resolutionTarget.id == 0) return;   // Render textures not available, drawing goes to screen
+
+    // Upscaling uses bilinear filtering
+    rlTextureParameters(resolutionTarget.texture.id, RL_TEXTURE_MIN_FILTER, RL_FILTER_LINEAR);
+    rlTextureParameters(resolutionTarget.texture.id, RL_TEXTURE_MAG_FILTER, RL_FILTER_LINEAR);
+
+    EnableResolutionTarget();
+
+    rlBeginGpuZone(RESOLUTION_GPU_ZONE);
+}
+
+// Bind internal render target for drawing
+// NOTE: Projection matches SetupViewport(), drawing coordinates are the same than drawing to screen
+static void EnableResolutionTarget(void)
+{
+    rlEnableRenderTexture(resolutionTarget.id);
+    rlViewport(0, 0, resolutionTarget.texture.width, resolutionTarget.texture.height);
+
+    rlMatrixMode(RL_PROJECTION);        // Switch to PROJECTION matrix
+    rlLoadIdentity();                   // Reset current matrix (PROJECTION)
+    rlOrtho(0, renderWidth, renderHeight, 0, 0.0f, 1.0f);
+
+    rlMatrixMode(RL_MODELVIEW);         // Switch back to MODELVIEW matrix
+    rlLoadIdentity();                   // Reset current matrix (MODELVIEW)
+
+    resolutionTargetBound = true;
+}
+
+// End drawing to internal render target and upscale it to screen render area
+static void EndResolutionTarget(void)
+{
+    rlglDraw();
+    rlEndGpuZone();
+
+    rlDisableRenderTexture();
+    resolutionTargetBound = false;
+
+    SetupViewport(renderWidth, renderHeight);
+
+    // NOTE: Render texture is flipped vertically (framebuffer origin is bottom-left)
+    Rectangle source = { 0.0f, 0.0f, (float)resolutionTarget.texture.width, -(float)resolutionTarget.texture.height };
+    Rectangle dest = { 0.0f, 0.0f, (float)renderWidth, (float)renderHeight };
+
+    DrawTexturePro(resolutionTarget.texture, source, dest, (Vector2){ 0.0f, 0.0f }, 0.0f, WHITE);
+    rlglDraw();
+
+    rlReleasePooledRenderTexture(resolutionTarget);
+    resolutionTarget = (RenderTexture2D){ 0 };
+
+    rlMultMatrixf(MatrixToFloat(screenScaling));    // Apply screen scaling (drawing after upscale)
+}
+
+// Adjust dynamic resolution scale from measured frame time (every RESOLUTION_ADJUST_FRAMES frames)
+// NOTE: Fill-rate cost is proportional to pixels count (scale squared), scale is reduced as soon as budget
+// is exceeded and increased when time is clearly below budget or after some time within budget (probing)
+static void UpdateResolutionScale(double frameTime)
+{
+    if (!resolutionScaling) return;
+
+    // Use GPU time of scaled drawing if timer queries are available
+    double measuredTime = frameTime;
+    int zonesCount = 0;
+    const GpuZoneTime *zones = rlGetGpuZones(&zonesCount);
+
+    for (int i = 0; i < zonesCount; i++)
+    {
+        if ((zones[i].depth == 0) && (strcmp(zones[i].name, RESOLUTION_GPU_ZONE) == 0))
+        {
+            measuredTime = zones[i].time/1000.0;
+            break;
+        }
+    }
+
+    resolutionTimeAccum += measuredTime;
+    resolutionTimeFrames++;
+
+    if (resolutionTimeFrames < RESOLUTION_ADJUST_FRAMES) return;
+
+    double averageTime = resolutionTimeAccum/resolutionTimeFrames;
+    resolutionTimeAccum = 0.0;
+    resolutionTimeFrames = 0;
+
+    double budget = resolutionBudget;
+    if (budget <= 0.0) budget = (targetTime > 0.0)? targetTime : 1.0/60.0;
+
+    float scale = resolutionScale;
+
+    if (averageTime > budget*1.02)
+    {
+        scale = resolutionScale*sqrtf((float)(budget*0.9/averageTime));
+        if (scale > (resolutionScale - RESOLUTION_SCALE_STEP)) scale = resolutionScale - RESOLUTION_SCALE_STEP;
+        resolutionStableWindows = 0;
+    }
+    else if (averageTime < budget*0.75)
+    {
+        scale = resolutionScale*sqrtf((float)(budget*0.85/averageTime));
+        if (scale > (resolutionScale + 2*RESOLUTION_SCALE_STEP)) scale = resolutionScale + 2*RESOLUTION_SCALE_STEP;
+        resolutionStableWindows = 0;
+    }
+    else if (++resolutionStableWindows >= RESOLUTION_PROBE_WINDOWS)
+    {
+        scale = resolutionScale + RESOLUTION_SCALE_STEP;
+        resolutionStableWindows = 0;
+    }
+
+    scale = roundf(scale/RESOLUTION_SCALE_STEP)*RESOLUTION_SCALE_STEP;
+    resolutionScale = Clamp(scale, resolutionMinScale, 1.0f);
+}
+
+// Rotate left 32 bit value
+static unsigned int RandomRotl(unsigned int x, int k)
+{
+    return (x << k) | (x >> (32 - k));
+}
+
+// Get next splitmix64 value, expands a 64 bit seed into well distributed state words
+static unsigned long long SplitMix64(unsigned long long *x)
+{
+    unsigned long long z = (*x += 0x9e3779b97f4a7c15ULL);
+    z = (z ^ (z >> 30))*0xbf58476d1ce4e5b9ULL;
+    z = (z ^ (z >> 27))*0x94d049bb133111ebULL;
+    return z ^ (z >> 31);
+}
+
+// Fill random 32 bit values from RANDOM_BULK_LANES interleaved xoshiro128** generators
+// NOTE: Lanes are seeded from provided state (advanced once per lane), lanes state is stored as
+// structure of arrays so every generator step is computed for all lanes at once (SIMD vectorized)
+static void GetRandomBulk(RandomState *state, unsigned int *values, int count)
+{
+    int i = 0;
+
+    if (count >= RANDOM_BULK_LANES)
+    {
+        unsigned int s0[RANDOM_BULK_LANES], s1[RANDOM_BULK_LANES], s2[RANDOM_BULK_LANES], s3[RANDOM_BULK_LANES];
+
+        for (int l = 0; l < RANDOM_BULK_LANES; l++)
+        {
+            unsigned long long seed = GetRandomUInt(state);
+            seed = (seed << 32) | GetRandomUInt(state);
+
+            RandomState lane = LoadRandomState(seed);
+            s0[l] = lane.s[0];
+            s1[l] = lane.s[1];
+            s2[l] = lane.s[2];
+            s3[l] = lane.s[3];
+        }
+
+        for (; (i + RANDOM_BULK_LANES) <= count; i += RANDOM_BULK_LANES)
+        {
+            for (int l = 0; l < RANDOM_BULK_LANES; l++)
+            {
+                unsigned int x = s1[l]*5;
+                unsigned int t = s1[l] << 9;
+
+                values[i + l] = ((x << 7) | (x >> 25))*9;
+
+                s2[l] ^= s0[l];
+                s3[l] ^= s1[l];
+                s1[l] ^= s2[l];
+                s0[l] ^= s3[l];
+                s2[l] ^= t;
+                s3[l] = (s3[l] << 11) | (s3[l] >> 21);
+            }
+        }
+    }
+
+    for (; i < count; i++) values[i] = GetRandomUInt(state);
+}
+
 // Compute framebuffer size relative to screen size and display size
 // NOTE: Global variables renderWidth/renderHeight and renderOffsetX/renderOffsetY can be modified
 static void SetupFramebuffer(int width, int height)
@@ -3281,117 +5352,461 @@ static void SetupFramebuffer(int width, int height)
             renderOffsetY = 0;
         }
 
-        // Screen scaling required
-        float scaleRatio = (float)renderWidth/(float)screenWidth;
-        screenScaling = MatrixScale(scaleRatio, scaleRatio, 1.0f);
+        // Screen scaling required
+        float scaleRatio = (float)renderWidth/(float)screenWidth;
+        screenScaling = MatrixScale(scaleRatio, scaleRatio, 1.0f);
+
+        // NOTE: We render to full display resolution!
+        // We just need to calculate above parameters for downscale matrix and offsets
+        renderWidth = displayWidth;
+        renderHeight = displayHeight;
+
+        TraceLog(LOG_WARNING, "Downscale matrix generated, content will be rendered at: %i x %i", renderWidth, renderHeight);
+    }
+    else if ((screenWidth < displayWidth) || (screenHeight < displayHeight))
+    {
+        // Required screen size is smaller than display size
+        TraceLog(LOG_INFO, "UPSCALING: Required screen size: %i x %i -> Display size: %i x %i", screenWidth, screenHeight, displayWidth, displayHeight);
+
+        // Upscaling to fit display with border-bars
+        float displayRatio = (float)displayWidth/(float)displayHeight;
+        float screenRatio = (float)screenWidth/(float)screenHeight;
+
+        if (displayRatio <= screenRatio)
+        {
+            renderWidth = screenWidth;
+            renderHeight = (int)round((float)screenWidth/displayRatio);
+            renderOffsetX = 0;
+            renderOffsetY = (renderHeight - screenHeight);
+        }
+        else
+        {
+            renderWidth = (int)round((float)screenHeight*displayRatio);
+            renderHeight = screenHeight;
+            renderOffsetX = (renderWidth - screenWidth);
+            renderOffsetY = 0;
+        }
+    }
+    else    // screen == display
+    {
+        renderWidth = screenWidth;
+        renderHeight = screenHeight;
+        renderOffsetX = 0;
+        renderOffsetY = 0;
+    }
+}
+
+// Initialize hi-resolution timer
+static void InitTimer(void)
+{
+    srand((unsigned int)time(NULL));              // Initialize random seed
+    randomState = LoadRandomState((unsigned long long)time(NULL));  // Initialize GetRandomValue() generator seed
+
+#if defined(_WIN32)
+    timeBeginPeriod(1);             // Setup high-resolution timer to 1ms (granularity of 1-2 ms)
+
+    // NOTE: High-resolution waitable timer sleeps with ~0.5 ms granularity, not available before Windows 10 1803
+    // CREATE_WAITABLE_TIMER_HIGH_RESOLUTION: 0x00000002, TIMER_ALL_ACCESS: 0x001F0003
+    if (waitableTimer == NULL) waitableTimer = CreateWaitableTimerExW(NULL, NULL, 0x00000002, 0x001F0003);
+#endif
+
+#if defined(PLATFORM_ANDROID) || defined(PLATFORM_RPI) || defined(PLATFORM_HEADLESS)
+    struct timespec now;
+
+    if (clock_gettime(CLOCK_MONOTONIC, &now) == 0)  // Success
+    {
+        baseTime = (uint64_t)now.tv_sec*1000000000LLU + (uint64_t)now.tv_nsec;
+    }
+    else TraceLog(LOG_WARNING, "No hi-resolution timer available");
+#endif
+
+    previousTime = GetTime();       // Get time as double
+}
+
+// Wait for some milliseconds (stop program execution)
+// NOTE: Sleep() granularity could be around 10 ms, it means, Sleep() could
+// take longer than expected... for that reason hybrid pacing sleeps in small steps
+// while remaining time is over the measured step time and busy waits the rest
+// Ref: http://stackoverflow.com/questions/43057578/c-programming-win32-games-sleep-taking-longer-than-expected
+// Ref: http://www.geisswerks.com/ryan/FAQS/timing.html --> All about timming on Win32!
+static void Wait(float ms)
+{
+    double destTime = GetTime() + ms/1000.0;
+
+    if ((framePacingMode == FRAME_PACING_SLEEP) || (framePacingMode == FRAME_PACING_DISPLAY)) WaitSleep(ms/1000.0);
+    else if (framePacingMode == FRAME_PACING_HYBRID)
+    {
+        double remaining = destTime - GetTime();
+
+        while (remaining > sleepTimeEstimate)
+        {
+            double sleepStart = GetTime();
+            WaitSleep(0.001);
+            double sleepTime = GetTime() - sleepStart;
+
+            // Self-tuning margin: sleep step time mean plus one standard deviation (Welford)
+            // NOTE: Measures count is limited to keep adapting to scheduler and power changes
+            if (sleepTimeCount >= 1000) { sleepTimeCount = 500; sleepTimeM2 /= 2.0; }
+            sleepTimeCount++;
+            double delta = sleepTime - sleepTimeMean;
+            sleepTimeMean += delta/sleepTimeCount;
+            sleepTimeM2 += delta*(sleepTime - sleepTimeMean);
+            sleepTimeEstimate = sleepTimeMean + sqrt(sleepTimeM2/(sleepTimeCount - 1));
+
+            remaining = destTime - GetTime();
+        }
+
+        while (GetTime() < destTime) { }
+    }
+    else while (GetTime() < destTime) { }   // FRAME_PACING_BUSY
+}
+
+// Sleep for some time, using high-resolution timer if available
+static void WaitSleep(double seconds)
+{
+    if (seconds <= 0.0) return;
+
+#if defined(_WIN32)
+    if (waitableTimer != NULL)
+    {
+        long long dueTime = -(long long)(seconds*10000000.0);  // Relative time in 100 ns intervals
+
+        if (SetWaitableTimer(waitableTimer, &dueTime, 0, NULL, NULL, 0))
+        {
+            WaitForSingleObject(waitableTimer, 0xFFFFFFFF);     // INFINITE
+            return;
+        }
+    }
+
+    Sleep((unsigned long)(seconds*1000.0));
+#elif defined(__linux__) || defined(PLATFORM_WEB)
+    struct timespec req = { 0 };
+    req.tv_sec = (time_t)seconds;
+    req.tv_nsec = (long)((seconds - (double)req.tv_sec)*1000000000.0);
+
+    // NOTE: Use nanosleep() on Unix platforms... usleep() it's deprecated.
+    while (nanosleep(&req, &req) == -1) continue;
+#elif defined(__APPLE__)
+    usleep((useconds_t)(seconds*1000000.0));
+#endif
+}
+
+// Run fixed-rate update callbacks for elapsed time
+static void UpdateFixedSteps(void)
+{
+    for (int i = 0; i < MAX_FIXED_UPDATES; i++)
+    {
+        FixedUpdate *update = &fixedUpdates[i];
+
+        if (update->callback == NULL) continue;
+
+        update->accumulator += (currentTime - update->time);
+        update->time = currentTime;
+
+        int steps = 0;
+
+        // NOTE: Callback could remove its own fixed update
+        while ((update->callback != NULL) && (update->accumulator >= update->step) && (steps < fixedUpdateMaxSteps))
+        {
+            update->callback((float)update->step, update->userData);
+            update->accumulator -= update->step;
+            steps++;
+        }
+
+        // Time over max steps is dropped, simulation slows down instead of spiraling
+        if (update->accumulator >= update->step)
+        {
+            int dropped = (int)(update->accumulator/update->step);
+            update->stepsDropped += dropped;
+            update->accumulator -= dropped*update->step;
+        }
+    }
+}
+
+// Get storage file path (internal data path on Android)
+static const char *GetStoragePath(void)
+{
+    static char path[MAX_FILEPATH_LENGTH] = { 0 };
+
+#if defined(PLATFORM_ANDROID)
+    strcpy(path, internalDataPath);
+    strcat(path, "/");
+    strcat(path, STORAGE_FILENAME);
+#else
+    strcpy(path, STORAGE_FILENAME);
+#endif
+
+    return path;
+}
+
+// Load storage file values in memory, file is read once (on first storage access)
+// NOTE: Storage files without header (previous format) are loaded as positional integer values
+static void LoadStorage(void)
+{
+    if (storageLoaded) return;
+
+    storageLoaded = true;
+
+    FILE *storageFile = fopen(GetStoragePath(), "rb");
+
+    if (storageFile == NULL) return;    // No storage saved yet
+
+    fseek(storageFile, 0, SEEK_END);
+    long fileSize = ftell(storageFile);
+    fseek(storageFile, 0, SEEK_SET);
+
+    unsigned char *fileData = (fileSize > 0)? (unsigned char *)RL_MALLOC(fileSize) : NULL;
+
+    if ((fileData != NULL) && (fread(fileData, 1, fileSize, storageFile) != (size_t)fileSize)) { RL_FREE(fileData); fileData = NULL; }
+
+    fclose(storageFile);
+
+    if (fileData == NULL) return;
+
+    unsigned int size = (unsigned int)fileSize;
+    unsigned int offset = 0;
+    unsigned int valuesCount = size/sizeof(int);
+    unsigned int entriesCount = 0;
+
+    if ((size >= 16) && (memcmp(fileData, "rSTG", 4) == 0))
+    {
+        unsigned int header[3] = { 0 };
+        memcpy(header, fileData + 4, sizeof(header));
+
+        if (header[0] != STORAGE_FILE_VERSION)
+        {
+            TraceLog(LOG_WARNING, "Storage data file version not supported");
+            RL_FREE(fileData);
+            return;
+        }
+
+        valuesCount = header[1];
+        entriesCount = header[2];
+        offset = 16;
+    }
+
+    if (valuesCount > (size - offset)/sizeof(int))
+    {
+        TraceLog(LOG_WARNING, "Storage data file is corrupted");
+        RL_FREE(fileData);
+        return;
+    }
+
+    if (valuesCount > 0)
+    {
+        storageValues = (int *)RL_MALLOC(valuesCount*sizeof(int));
+        memcpy(storageValues, fileData + offset, valuesCount*sizeof(int));
+        storageValuesCount = (int)valuesCount;
+        offset += valuesCount*sizeof(int);
+    }
+
+    for (unsigned int i = 0; i < entriesCount; i++)
+    {
+        unsigned short info[2] = { 0 };     // Value type and key length
+        unsigned int length = sizeof(int);  // Value data size (string length for strings)
+
+        if ((size - offset) < sizeof(info)) break;
+        memcpy(info, fileData + offset, sizeof(info));
+        offset += sizeof(info);
+
+        if (((size - offset) < (unsigned int)info[1] + sizeof(int)) || (info[1] == 0) || (info[0] > STORAGE_VALUE_STRING)) break;
+
+        char key[MAX_STORAGE_KEY_LENGTH + 1] = { 0 };
+        if (info[1] > MAX_STORAGE_KEY_LENGTH) break;
+        memcpy(key, fileData + offset, info[1]);
+        offset += info[1];
+
+        if (info[0] == STORAGE_VALUE_STRING)
+        {
+            memcpy(&length, fileData + offset, sizeof(unsigned int));
+            offset += sizeof(unsigned int);
+
+            if ((size - offset) < length) break;
+        }
+
+        StorageEntry *entry = GetStorageEntry(key, info[0], true);
+
+        if (entry == NULL) break;
+
+        if (info[0] == STORAGE_VALUE_INT) memcpy(&entry->intValue, fileData + offset, sizeof(int));
+        else if (info[0] == STORAGE_VALUE_FLOAT) memcpy(&entry->floatValue, fileData + offset, sizeof(float));
+        else
+        {
+            entry->text = (char *)RL_MALLOC(length + 1);
+            memcpy(entry->text, fileData + offset, length);
+            entry->text[length] = '\0';
+        }
+
+        offset += length;
+    }
+
+    if (storageEntriesCount < (int)entriesCount) TraceLog(LOG_WARNING, "Storage data file is corrupted, some values could not be loaded");
+
+    RL_FREE(fileData);
+
+    storageDirty = false;       // NOTE: Entries added on loading are not modifications
+}
+
+// Get storage keyed value, created if required (value type changed if different)
+// NOTE: Returns NULL if key is not found (or value type is different) and not created
+static StorageEntry *GetStorageEntry(const char *key, int type, bool create)
+{
+    if ((key == NULL) || (key[0] == '\0')) return NULL;
+
+    LoadStorage();
+
+    for (int i = 0; i < storageEntriesCount; i++)
+    {
+        StorageEntry *entry = &storageEntries[i];
+
+        if (strcmp(entry->key, key) == 0)
+        {
+            if (entry->type == type) return entry;
+            if (!create) return NULL;
+
+            // Value type changed, previous value discarded
+            RL_FREE(entry->text);
+            entry->text = NULL;
+            entry->intValue = 0;
+            entry->floatValue = 0.0f;
+            entry->type = type;
+            storageDirty = true;
+
+            return entry;
+        }
+    }
+
+    if (!create) return NULL;
 
-        // NOTE: We render to full display resolution!
-        // We just need to calculate above parameters for downscale matrix and offsets
-        renderWidth = displayWidth;
-        renderHeight = displayHeight;
+    int keyLength = (int)strlen(key);
 
-        TraceLog(LOG_WARNING, "Downscale matrix generated, content will be rendered at: %i x %i", renderWidth, renderHeight);
+    if (keyLength > MAX_STORAGE_KEY_LENGTH)
+    {
+        TraceLog(LOG_WARNING, "Storage key too long: %s", key);
+        return NULL;
     }
-    else if ((screenWidth < displayWidth) || (screenHeight < displayHeight))
+
+    StorageEntry *entries = (StorageEntry *)RL_REALLOC(storageEntries, (storageEntriesCount + 1)*sizeof(StorageEntry));
+
+    if (entries == NULL) return NULL;
+
+    storageEntries = entries;
+
+    StorageEntry *entry = &storageEntries[storageEntriesCount];
+    memset(entry, 0, sizeof(StorageEntry));
+    entry->key = (char *)RL_MALLOC(keyLength + 1);
+    strcpy(entry->key, key);
+    entry->type = type;
+    storageEntriesCount++;
+    storageDirty = true;
+
+    return entry;
+}
+
+// Release storage values from memory (not flushed values are lost)
+static void UnloadStorage(void)
+{
+    for (int i = 0; i < storageEntriesCount; i++)
     {
-        // Required screen size is smaller than display size
-        TraceLog(LOG_INFO, "UPSCALING: Required screen size: %i x %i -> Display size: %i x %i", screenWidth, screenHeight, displayWidth, displayHeight);
+        RL_FREE(storageEntries[i].key);
+        RL_FREE(storageEntries[i].text);
+    }
 
-        // Upscaling to fit display with border-bars
-        float displayRatio = (float)displayWidth/(float)displayHeight;
-        float screenRatio = (float)screenWidth/(float)screenHeight;
+    RL_FREE(storageEntries);
+    RL_FREE(storageValues);
 
-        if (displayRatio <= screenRatio)
-        {
-            renderWidth = screenWidth;
-            renderHeight = (int)round((float)screenWidth/displayRatio);
-            renderOffsetX = 0;
-            renderOffsetY = (renderHeight - screenHeight);
-        }
-        else
-        {
-            renderWidth = (int)round((float)screenHeight*displayRatio);
-            renderHeight = screenHeight;
-            renderOffsetX = (renderWidth - screenWidth);
-            renderOffsetY = 0;
-        }
+    storageEntries = NULL;
+    storageEntriesCount = 0;
+    storageValues = NULL;
+    storageValuesCount = 0;
+    storageLoaded = false;
+    storageDirty = false;
+}
+
+// Get compression stream output space, size bytes appended to output (read data is discarded first)
+static unsigned char *GetCompressStreamOutput(CompressStreamData *data, int size)
+{
+    if (data->outputRead > 0)
+    {
+        data->outputLength -= data->outputRead;
+        memmove(data->output, data->output + data->outputRead, data->outputLength);
+        data->outputRead = 0;
     }
-    else    // screen == display
+
+    if ((data->outputLength + size) > data->outputCapacity)
     {
-        renderWidth = screenWidth;
-        renderHeight = screenHeight;
-        renderOffsetX = 0;
-        renderOffsetY = 0;
+        int capacity = (data->outputCapacity > 0)? data->outputCapacity : COMPRESS_STREAM_BLOCK_SIZE;
+        while (capacity < (data->outputLength + size)) capacity *= 2;
+
+        data->output = (unsigned char *)RL_REALLOC(data->output, capacity);
+        data->outputCapacity = capacity;
     }
+
+    unsigned char *output = data->output + data->outputLength;
+    data->outputLength += size;
+
+    return output;
 }
 
-// Initialize hi-resolution timer
-static void InitTimer(void)
+// Compress stream input block into output, block is stored uncompressed if compression does not reduce its size
+static void CompressStreamBlock(CompressStream stream)
 {
-    srand((unsigned int)time(NULL));              // Initialize random seed
+    CompressStreamData *data = (CompressStreamData *)stream.ctxData;
 
-#if !defined(SUPPORT_BUSY_WAIT_LOOP) && defined(_WIN32)
-    timeBeginPeriod(1);             // Setup high-resolution timer to 1ms (granularity of 1-2 ms)
-#endif
+    if (data->inputLength == 0) return;
 
-#if defined(PLATFORM_ANDROID) || defined(PLATFORM_RPI)
-    struct timespec now;
+    int capacity = GetCompressDataBound(data->inputLength, stream.codec);
+    unsigned char *output = GetCompressStreamOutput(data, 8 + capacity);
 
-    if (clock_gettime(CLOCK_MONOTONIC, &now) == 0)  // Success
+    int compSize = CompressDataEx(data->input, data->inputLength, output + 8, capacity, stream.codec);
+    unsigned int header[2] = { (unsigned int)data->inputLength, (unsigned int)compSize };
+
+    if ((compSize <= 0) || (compSize >= data->inputLength))
     {
-        baseTime = (uint64_t)now.tv_sec*1000000000LLU + (uint64_t)now.tv_nsec;
+        memcpy(output + 8, data->input, data->inputLength);
+        compSize = data->inputLength;
+        header[1] = (unsigned int)compSize | COMPRESS_BLOCK_STORED;
     }
-    else TraceLog(LOG_WARNING, "No hi-resolution timer available");
-#endif
 
-    previousTime = GetTime();       // Get time as double
+    memcpy(output, header, 8);
+    data->outputLength -= (capacity - compSize);    // Unused output space returned
+    data->inputLength = 0;
 }
 
-// Wait for some milliseconds (stop program execution)
-// NOTE: Sleep() granularity could be around 10 ms, it means, Sleep() could
-// take longer than expected... for that reason we use the busy wait loop
-// Ref: http://stackoverflow.com/questions/43057578/c-programming-win32-games-sleep-taking-longer-than-expected
-// Ref: http://www.geisswerks.com/ryan/FAQS/timing.html --> All about timming on Win32!
-static void Wait(float ms)
+// Register frame time on histogram (waitError is waited time over requested)
+static void UpdateFrameTimeHistogram(double time, bool waited, double waitError)
 {
-#if defined(SUPPORT_BUSY_WAIT_LOOP) && !defined(PLATFORM_UWP)
-    double prevTime = GetTime();
-    double nextTime = 0.0;
+    float ms = (float)time*1000.0f;
+    int bucket = (int)(ms/FRAME_TIME_BUCKET_SIZE);
 
-    // Busy wait loop
-    while ((nextTime - prevTime) < ms/1000.0f) nextTime = GetTime();
-#else
-    #if defined(SUPPORT_HALFBUSY_WAIT_LOOP)
-        #define MAX_HALFBUSY_WAIT_TIME  4
-        double destTime = GetTime() + ms/1000;
-        if (ms > MAX_HALFBUSY_WAIT_TIME) ms -= MAX_HALFBUSY_WAIT_TIME;
-    #endif
+    if (bucket >= MAX_FRAME_TIME_BUCKETS) bucket = MAX_FRAME_TIME_BUCKETS - 1;
+    if (bucket < 0) bucket = 0;
 
-    #if defined(_WIN32)
-        Sleep((unsigned int)ms);
-    #elif defined(__linux__) || defined(PLATFORM_WEB)
-        struct timespec req = { 0 };
-        time_t sec = (int)(ms/1000.0f);
-        ms -= (sec*1000);
-        req.tv_sec = sec;
-        req.tv_nsec = ms*1000000L;
-
-        // NOTE: Use nanosleep() on Unix platforms... usleep() it's deprecated.
-        while (nanosleep(&req, &req) == -1) continue;
-    #elif defined(__APPLE__)
-        usleep(ms*1000.0f);
-    #endif
-    
-    #if defined(SUPPORT_HALFBUSY_WAIT_LOOP)
-        while (GetTime() < destTime) { }
-    #endif
-#endif
+    frameHistogram.buckets[bucket]++;
+
+    if ((frameHistogram.frameCount == 0) || (ms < frameHistogram.frameTimeMin)) frameHistogram.frameTimeMin = ms;
+    if (ms > frameHistogram.frameTimeMax) frameHistogram.frameTimeMax = ms;
+    frameHistogram.frameTimeAvg += ms;      // Accumulated, averaged on GetFrameTimeHistogram()
+    frameHistogram.frameCount++;
+
+    if ((targetTime > 0.0) && (time > (targetTime + 0.001))) frameHistogram.framesLate++;
+
+    if (waited)
+    {
+        frameHistogram.waitErrorAvg += (float)waitError*1000.0f;
+        if ((float)waitError*1000.0f > frameHistogram.waitErrorMax) frameHistogram.waitErrorMax = (float)waitError*1000.0f;
+        frameHistogram.framesWaited++;
+    }
 }
 
 // Get one key state
 static bool GetKeyStatus(int key)
 {
-#if defined(PLATFORM_DESKTOP) || defined(PLATFORM_WEB)
+#if defined(PLATFORM_WEB) && defined(SUPPORT_WEB_WORKER)
+    // NOTE: Keys states are filled by EmscriptenWorkerKeyCallback()
+    if (key < 0 || key > 511) return false;
+    else return currentKeyState[key];
+#elif defined(PLATFORM_DESKTOP) || defined(PLATFORM_WEB)
     return glfwGetKey(window, key);
 #elif defined(PLATFORM_ANDROID)
     // NOTE: Android supports up to 260 keys
@@ -3401,13 +5816,18 @@ static bool GetKeyStatus(int key)
     // NOTE: Keys states are filled in PollInputEvents()
     if (key < 0 || key > 511) return false;
     else return currentKeyState[key];
+#elif defined(PLATFORM_HEADLESS)
+    return false;       // No input system
 #endif
 }
 
 // Get one mouse button state
 static bool GetMouseButtonStatus(int button)
 {
-#if defined(PLATFORM_DESKTOP) || defined(PLATFORM_WEB)
+#if defined(PLATFORM_WEB) && defined(SUPPORT_WEB_WORKER)
+    // NOTE: Mouse buttons states are filled by EmscriptenWorkerMouseCallback()
+    return currentMouseState[button];
+#elif defined(PLATFORM_DESKTOP) || defined(PLATFORM_WEB)
     return glfwGetMouseButton(window, button);
 #elif defined(PLATFORM_ANDROID)
     // TODO: Check for virtual mouse?
@@ -3415,6 +5835,8 @@ static bool GetMouseButtonStatus(int button)
 #elif defined(PLATFORM_RPI) || defined(PLATFORM_UWP)
     // NOTE: Mouse buttons states are filled in PollInputEvents()
     return currentMouseState[button];
+#elif defined(PLATFORM_HEADLESS)
+    return false;       // No input system
 #endif
 }
 
@@ -3514,12 +5936,20 @@ static int GetGamepadAxis(int axis)
 // Poll (store) all input events
 static void PollInputEvents(void)
 {
+    BeginProfileZone("PollInputEvents");
+
 #if defined(SUPPORT_GESTURES_SYSTEM)
     // NOTE: Gestures update must be called every frame to reset gestures correctly
     // because ProcessGestureEvent() is just called on an event, not every frame
     UpdateGestures();
 #endif
 
+    // Deliver files data read on worker threads (LoadFileDataAsync() callbacks)
+    UpdateFileDataAsync();
+
+    // Queue watched files changes (GetFileChangeEvent())
+    UpdateFileWatches();
+
     // Reset key pressed registered
     keyPressedQueueCount = 0;
 
@@ -3533,6 +5963,22 @@ static void PollInputEvents(void)
     // Register previous keys states
     for (int i = 0; i < 512; i++)previousKeyState[i] = currentKeyState[i];
 
+    // Register previous mouse states
+    previousMouseWheelY = currentMouseWheelY;
+    currentMouseWheelY = 0;
+    for (int i = 0; i < 3; i++) previousMouseState[i] = currentMouseState[i];
+
+    // Register previous gamepads states
+    for (int i = 0; i < MAX_GAMEPADS; i++)
+    {
+        for (int k = 0; k < MAX_GAMEPAD_BUTTONS; k++) previousGamepadState[i][k] = currentGamepadState[i][k];
+    }
+
+    // Read input devices and gamepads pending events (new current states)
+    ProcessInputDevices();
+
+    for (int i = 0; i < 3; i++) currentMouseState[i] = currentMouseStateEvdev[i];
+
     // Grab a keypress from the evdev fifo if avalable
     if (lastKeyPressedEvdev.Head != lastKeyPressedEvdev.Tail)
     {
@@ -3541,15 +5987,6 @@ static void PollInputEvents(void)
         
         lastKeyPressedEvdev.Tail = (lastKeyPressedEvdev.Tail + 1) & 0x07;           // Increment the tail pointer forwards and binary wraparound after 7 (fifo is 8 elements long)
     }
-
-    // Register previous mouse states
-    previousMouseWheelY = currentMouseWheelY;
-    currentMouseWheelY = 0;
-    for (int i = 0; i < 3; i++)
-    {
-        previousMouseState[i] = currentMouseState[i];
-        currentMouseState[i] = currentMouseStateEvdev[i];
-    }
 #endif
 
 #if defined(PLATFORM_UWP)
@@ -3649,20 +6086,44 @@ static void PollInputEvents(void)
                     default: break;
                 }
 
-                if (actualKey > -1) currentKeyState[actualKey] = msg->paramChar0;
+                if (actualKey > -1)
+                {
+                    currentKeyState[actualKey] = msg->paramChar0;
+                    PushInputEvent((msg->paramChar0 != 0)? INPUT_EVENT_KEY_DOWN : INPUT_EVENT_KEY_UP, actualKey, 0, (Vector2){ 0.0f, 0.0f });
+                }
 
             } break;
-            case UWP_MSG_REGISTER_CLICK: currentMouseState[msg->paramInt0] = msg->paramChar0; break;
-            case UWP_MSG_SCROLL_WHEEL_UPDATE: currentMouseWheelY += msg->paramInt0; break;
-            case UWP_MSG_UPDATE_MOUSE_LOCATION: mousePosition = msg->paramVector0; break;
+            case UWP_MSG_REGISTER_CLICK:
+            {
+                currentMouseState[msg->paramInt0] = msg->paramChar0;
+                PushInputEvent((msg->paramChar0 != 0)? INPUT_EVENT_MOUSE_BUTTON_DOWN : INPUT_EVENT_MOUSE_BUTTON_UP, msg->paramInt0, 0, GetMousePosition());
+            } break;
+            case UWP_MSG_SCROLL_WHEEL_UPDATE:
+            {
+                currentMouseWheelY += msg->paramInt0;
+                PushInputEvent(INPUT_EVENT_MOUSE_WHEEL, 0, 0, (Vector2){ 0.0f, (float)msg->paramInt0 });
+            } break;
+            case UWP_MSG_UPDATE_MOUSE_LOCATION:
+            {
+                mousePosition = msg->paramVector0;
+                PushInputEvent(INPUT_EVENT_MOUSE_MOVE, 0, 0, GetMousePosition());
+            } break;
             case UWP_MSG_SET_GAMEPAD_ACTIVE: if (msg->paramInt0 < MAX_GAMEPADS) gamepadReady[msg->paramInt0] = msg->paramBool0; break;
             case UWP_MSG_SET_GAMEPAD_BUTTON:
             {
-                if ((msg->paramInt0 < MAX_GAMEPADS) && (msg->paramInt1 < MAX_GAMEPAD_BUTTONS)) currentGamepadState[msg->paramInt0][msg->paramInt1] = msg->paramChar0;
+                if ((msg->paramInt0 < MAX_GAMEPADS) && (msg->paramInt1 < MAX_GAMEPAD_BUTTONS))
+                {
+                    currentGamepadState[msg->paramInt0][msg->paramInt1] = msg->paramChar0;
+                    PushInputEvent((msg->paramChar0 != 0)? INPUT_EVENT_GAMEPAD_BUTTON_DOWN : INPUT_EVENT_GAMEPAD_BUTTON_UP, msg->paramInt1, msg->paramInt0, (Vector2){ 0.0f, 0.0f });
+                }
             } break;
             case UWP_MSG_SET_GAMEPAD_AXIS:
             {
-                if ((msg->paramInt0 < MAX_GAMEPADS) && (msg->paramInt1 < MAX_GAMEPAD_AXIS)) gamepadAxisState[msg->paramInt0][msg->paramInt1] = msg->paramFloat0;
+                if ((msg->paramInt0 < MAX_GAMEPADS) && (msg->paramInt1 < MAX_GAMEPAD_AXIS))
+                {
+                    gamepadAxisState[msg->paramInt0][msg->paramInt1] = msg->paramFloat0;
+                    PushInputEvent(INPUT_EVENT_GAMEPAD_AXIS, msg->paramInt1, msg->paramInt0, (Vector2){ msg->paramFloat0, 0.0f });
+                }
 
                 // Register buttons for 2nd triggers
                 currentGamepadState[msg->paramInt0][GAMEPAD_BUTTON_LEFT_TRIGGER_2] = (char)(gamepadAxisState[msg->paramInt0][GAMEPAD_AXIS_LEFT_TRIGGER] > 0.1);
@@ -3708,6 +6169,7 @@ static void PollInputEvents(void)
 
 #if defined(PLATFORM_DESKTOP) || defined(PLATFORM_WEB)
     // Mouse input polling
+#if !defined(SUPPORT_WEB_WORKER)
     double mouseX;
     double mouseY;
 
@@ -3715,6 +6177,7 @@ static void PollInputEvents(void)
 
     mousePosition.x = (float)mouseX;
     mousePosition.y = (float)mouseY;
+#endif
 
     // Keyboard input polling (automatically managed by GLFW3 through callback)
 
@@ -3772,6 +6235,7 @@ static void PollInputEvents(void)
             for (int k = 0; (axes != NULL) && (k < GLFW_GAMEPAD_AXIS_LAST + 1) && (k < MAX_GAMEPAD_AXIS); k++)
             {
                 const int axis = GetGamepadAxis(k);
+                if (gamepadAxisState[i][axis] != axes[k]) PushInputEvent(INPUT_EVENT_GAMEPAD_AXIS, axis, i, (Vector2){ axes[k], 0.0f });
                 gamepadAxisState[i][axis] = axes[k];
             }
 
@@ -3779,22 +6243,35 @@ static void PollInputEvents(void)
             currentGamepadState[i][GAMEPAD_BUTTON_LEFT_TRIGGER_2] = (char)(gamepadAxisState[i][GAMEPAD_AXIS_LEFT_TRIGGER] > 0.1);
             currentGamepadState[i][GAMEPAD_BUTTON_RIGHT_TRIGGER_2] = (char)(gamepadAxisState[i][GAMEPAD_AXIS_RIGHT_TRIGGER] > 0.1);
 
+            PushGamepadButtonEvents(i);
+
             gamepadAxisCount = GLFW_GAMEPAD_AXIS_LAST;
         }
     }
 
     windowResized = false;
 
-#if defined(SUPPORT_EVENTS_WAITING)
-    glfwWaitEvents();
-#else
-    glfwPollEvents();       // Register keyboard/mouse events (callbacks)... and window events!
-#endif
+    // NOTE: Redraw flag is cleared before waiting, a request from other thread after
+    // clearing wakes the wait with an empty event (see RequestRedraw())
+    bool redraw = redrawRequested;
+    redrawRequested = false;
+
+    if (eventWaiting && !redraw)
+    {
+        if (eventWaitingTimeout > 0.0) glfwWaitEventsTimeout(eventWaitingTimeout);
+        else glfwWaitEvents();
+    }
+    else glfwPollEvents();  // Register keyboard/mouse events (callbacks)... and window events!
 #endif      //defined(PLATFORM_DESKTOP)
 
 // Gamepad support using emscripten API
 // NOTE: GLFW3 joystick functionality not available in web
 #if defined(PLATFORM_WEB)
+#if defined(SUPPORT_WEB_WORKER)
+    // Dispatch input events queued to this thread (keyboard/mouse callbacks)
+    emscripten_current_thread_process_queued_calls();
+#endif
+
     // Get number of gamepads connected
     int numGamepads = 0;
     if (emscripten_sample_gamepad_data() == EMSCRIPTEN_RESULT_SUCCESS) numGamepads = emscripten_get_num_gamepads();
@@ -3828,9 +6305,12 @@ static void PollInputEvents(void)
             for (int j = 0; (j < gamepadState.numAxes) && (j < MAX_GAMEPAD_AXIS); j++)
             {
                 const int axis = GetGamepadAxis(j);
+                if (gamepadAxisState[i][axis] != (float)gamepadState.axis[j]) PushInputEvent(INPUT_EVENT_GAMEPAD_AXIS, axis, i, (Vector2){ (float)gamepadState.axis[j], 0.0f });
                 gamepadAxisState[i][axis] = gamepadState.axis[j];
             }
 
+            PushGamepadButtonEvents(i);
+
             gamepadAxisCount = gamepadState.numAxes;
         }
     }
@@ -3862,22 +6342,248 @@ static void PollInputEvents(void)
     // we now use both methods inside here. 2nd method is still used for legacy purposes (Allows for input trough SSH console)
     ProcessKeyboard();
 
-    // NOTE: Mouse input events polling is done asynchronously in another pthread - EventThread()
-    // NOTE: Gamepad (Joystick) input events polling is done asynchonously in another pthread - GamepadThread()
+    // NOTE: Mouse, touch, keyboard and gamepad devices events are read on ProcessInputDevices()
 #endif
+
+#if defined(SUPPORT_GESTURES_SYSTEM)
+    // Gesture events received by callbacks are processed as a batch, redundant moves are skipped
+    ProcessGestureEvents(gestureEvents, gestureEventsCount);
+    gestureEventsCount = 0;
+#endif
+
+    EndProfileZone();
 }
 
+#if defined(SUPPORT_GESTURES_SYSTEM)
+// Queue gesture event to be processed on next input poll
+// NOTE: If queue is full, queued events are processed right away
+static void QueueGestureEvent(GestureEvent event)
+{
+    if (gestureEventsCount >= MAX_GESTURE_EVENTS)
+    {
+        ProcessGestureEvents(gestureEvents, gestureEventsCount);
+        gestureEventsCount = 0;
+    }
+
+    gestureEvents[gestureEventsCount] = event;
+    gestureEventsCount++;
+}
+#endif
+
 // Copy back buffer to front buffers
 static void SwapBuffers(void)
 {
-#if defined(PLATFORM_DESKTOP) || defined(PLATFORM_WEB)
+    BeginProfileZone("SwapBuffers");
+
+#if defined(PLATFORM_WEB) && defined(SUPPORT_WEB_WORKER)
+    emscripten_webgl_commit_frame();    // Present frame (explicit swap control)
+#elif defined(PLATFORM_DESKTOP) || defined(PLATFORM_WEB)
     glfwSwapBuffers(window);
 #endif
 
+#if defined(PLATFORM_ANDROID) && defined(SUPPORT_ANDROID_FRAME_PACING)
+    UpdateDisplayPacing();      // Frame presented on display vsync (FRAME_PACING_DISPLAY)
+#endif
+
 #if defined(PLATFORM_ANDROID) || defined(PLATFORM_RPI) || defined(PLATFORM_UWP)
     eglSwapBuffers(display, surface);
 #endif
+
+#if defined(PLATFORM_HEADLESS)
+    // NOTE: Offscreen surfaces are not presented, commands are flushed to keep GPU busy while next frame is recorded
+    glFlush();
+#endif
+
+    EndProfileZone();
+}
+
+// Collect asynchronous screen readbacks: export pending screenshot and write pending GIF frames
+// NOTE: If wait is true, GPU copies are waited for, otherwise only finished readbacks are collected
+static void UpdateScreenCaptures(bool wait)
+{
+    if (screenshotRequest != 0)
+    {
+        unsigned char *imgData = rlGetScreenPixelsAsync(screenshotRequest, wait);
+
+        if (imgData != NULL) ExportScreenshot(imgData, screenshotWidth, screenshotHeight, screenshotPath);
+
+        if ((imgData != NULL) || wait) screenshotRequest = 0;
+    }
+
+#if defined(SUPPORT_GIF_RECORDING)
+    // NOTE: Frames are written in request order, collection stops at first frame not ready
+    while (gifFrameRequestsCount > 0)
+    {
+        unsigned char *screenData = rlGetScreenPixelsAsync(gifFrameRequests[0], wait);
+
+        if ((screenData == NULL) && !wait) break;
+
+        if (screenData != NULL) QueueGifFrame(screenData);
+
+        gifFrameRequestsCount--;
+        for (int i = 0; i < gifFrameRequestsCount; i++) gifFrameRequests[i] = gifFrameRequests[i + 1];
+    }
+#endif
+}
+
+// Export screenshot image data to file, screen data is freed
+// NOTE: PNG screenshots are encoded and saved on a worker thread if available, job owns screen data
+static void ExportScreenshot(unsigned char *imgData, int width, int height, const char *path)
+{
+#if defined(SUPPORT_IMAGE_EXPORT) && defined(SUPPORT_FILEFORMAT_PNG) && !defined(PLATFORM_WEB)
+    if ((GetWorkerThreads() > 0) && IsFileExtension(path, ".png"))
+    {
+        // Limit screenshots in flight (bounded memory)
+        if (GetWorkerJobsPending(&screenshotSavesPending) >= MAX_SCREENSHOT_SAVES) WaitWorkerJobs(&screenshotSavesPending);
+
+        ScreenshotSave *save = (ScreenshotSave *)RL_MALLOC(sizeof(ScreenshotSave));
+        save->data = imgData;
+        save->width = width;
+        save->height = height;
+        strcpy(save->path, path);
+
+        SubmitWorkerJob(SaveScreenshotJob, save, &screenshotSavesPending);
+        return;
+    }
+#endif
+
+    Image image = { imgData, width, height, 1, UNCOMPRESSED_R8G8B8A8 };
+
+    ExportImage(image, path);
+    RL_FREE(imgData);
+
+#if defined(PLATFORM_WEB)
+    // Download file from MEMFS (emscripten memory filesystem)
+    // saveFileFromMEMFSToDisk() function is defined in raylib/src/shell.html
+    emscripten_run_script(TextFormat("saveFileFromMEMFSToDisk('%s','%s')", GetFileName(path), GetFileName(path)));
+#endif
+
+    TraceLog(LOG_INFO, "Screenshot taken: %s", path);
+}
+
+#if defined(SUPPORT_IMAGE_EXPORT) && defined(SUPPORT_FILEFORMAT_PNG)
+// Worker job: save PNG screenshot, screen data and job data are freed
+static void SaveScreenshotJob(void *data)
+{
+    ScreenshotSave *save = (ScreenshotSave *)data;
+
+    if (SavePNG(save->path, save->data, save->width, save->height, 4)) TraceLog(LOG_INFO, "Screenshot taken: %s", save->path);
+    else TraceLog(LOG_WARNING, "Screenshot could not be saved: %s", save->path);
+
+    RL_FREE(save->data);
+    RL_FREE(save);
+}
+#endif
+
+#if defined(SUPPORT_GIF_RECORDING)
+// Queue GIF frame for encoding, frame data (screen size, RGBA) is freed by encoder
+// NOTE: If queue is full, encoder is waited for (bounded memory)
+static void QueueGifFrame(unsigned char *frame)
+{
+    if (frame == NULL) return;
+
+    if (gifQueuedFramesCount >= MAX_GIF_QUEUED_FRAMES) UpdateGifEncoder(true);
+
+    gifQueuedFrames[gifQueuedFramesCount++] = frame;
+}
+
+// Submit queued GIF frames to encoder worker job, only one job encodes frames at a time (frames order)
+// NOTE: If wait is true, all queued frames are encoded before returning
+static void UpdateGifEncoder(bool wait)
+{
+    do
+    {
+        if (wait) WaitWorkerJobs(&gifEncodingPending);
+
+        if (GetWorkerJobsPending(&gifEncodingPending) > 0) return;
+
+        gifEncodingFramesCount = 0;
+
+        if (gifQueuedFramesCount > 0)
+        {
+            for (int i = 0; i < gifQueuedFramesCount; i++) gifEncodingFrames[i] = gifQueuedFrames[i];
+
+            gifEncodingFramesCount = gifQueuedFramesCount;
+            gifQueuedFramesCount = 0;
+
+            SubmitWorkerJob(EncodeGifFramesJob, NULL, &gifEncodingPending);
+        }
+
+    } while (wait && (GetWorkerJobsPending(&gifEncodingPending) > 0));
+}
+
+// Worker job: downscale (box filter), quantize and encode GIF frames being encoded
+// NOTE: GIF encoder state (rgif) is only accessed by this job while recording
+static void EncodeGifFramesJob(void *data)
+{
+    for (int i = 0; i < gifEncodingFramesCount; i++)
+    {
+        unsigned char *frame = gifEncodingFrames[i];
+
+        if (gifDownscale > 1)
+        {
+            // NOTE: Downscaled pixels are written in place, output never overwrites pixels still to be read
+            int samples = gifDownscale*gifDownscale;
+
+            for (int y = 0; y < gifHeight; y++)
+            {
+                for (int x = 0; x < gifWidth; x++)
+                {
+                    int sum[4] = { 0 };
+
+                    for (int sy = 0; sy < gifDownscale; sy++)
+                    {
+                        const unsigned char *src = frame + ((y*gifDownscale + sy)*gifSourceWidth + x*gifDownscale)*4;
+
+                        for (int sx = 0; sx < gifDownscale*4; sx++) sum[sx%4] += src[sx];
+                    }
+
+                    for (int c = 0; c < 4; c++) frame[(y*gifWidth + x)*4 + c] = (unsigned char)(sum[c]/samples);
+                }
+            }
+        }
+
+        GifWriteFrameEx(frame, gifWidth, gifHeight, 10, 8, false, gifFixedPalette);
+
+        RL_FREE(frame);
+    }
+}
+#endif
+
+// Queue timestamped input event, oldest event is dropped on full queue
+static void PushInputEvent(int type, int code, int device, Vector2 value)
+{
+    InputEvent event = { type, GetTime(), code, device, value };
+
+#if defined(PLATFORM_RPI)
+    if (inputEventTime >= 0.0) event.time = inputEventTime;     // Event time registered by kernel
+#endif
+
+    if (inputEventsCount == MAX_INPUT_EVENTS)
+    {
+        inputEventsHead = (inputEventsHead + 1)%MAX_INPUT_EVENTS;
+        inputEventsCount--;
+        inputEventsDropped++;
+    }
+
+    inputEvents[(inputEventsHead + inputEventsCount)%MAX_INPUT_EVENTS] = event;
+    inputEventsCount++;
+}
+
+#if defined(PLATFORM_DESKTOP) || defined(PLATFORM_WEB)
+// Queue gamepad buttons changes events (polled gamepads)
+// NOTE: Changes are registered once per frame, event time is the polling time
+static void PushGamepadButtonEvents(int gamepad)
+{
+    for (int i = 0; i < MAX_GAMEPAD_BUTTONS; i++)
+    {
+        if (currentGamepadState[gamepad][i] != previousGamepadState[gamepad][i])
+        {
+            PushInputEvent((currentGamepadState[gamepad][i] == 1)? INPUT_EVENT_GAMEPAD_BUTTON_DOWN : INPUT_EVENT_GAMEPAD_BUTTON_UP, i, gamepad, (Vector2){ 0.0f, 0.0f });
+        }
+    }
 }
+#endif
 
 #if defined(PLATFORM_DESKTOP) || defined(PLATFORM_WEB)
 // GLFW3 Error Callback, runs on GLFW3 error
@@ -3890,14 +6596,27 @@ static void ErrorCallback(int error, const char *description)
 static void ScrollCallback(GLFWwindow *window, double xoffset, double yoffset)
 {
     currentMouseWheelY = (int)yoffset;
+
+    PushInputEvent(INPUT_EVENT_MOUSE_WHEEL, 0, 0, (Vector2){ (float)xoffset, (float)yoffset });
 }
 
 // GLFW3 Keyboard Callback, runs on key pressed
 static void KeyCallback(GLFWwindow *window, int key, int scancode, int action, int mods)
 {
+    if (key >= 0)
+    {
+        if (action == GLFW_PRESS) PushInputEvent(INPUT_EVENT_KEY_DOWN, key, 0, (Vector2){ 0.0f, 0.0f });
+        else if (action == GLFW_RELEASE) PushInputEvent(INPUT_EVENT_KEY_UP, key, 0, (Vector2){ 0.0f, 0.0f });
+        else PushInputEvent(INPUT_EVENT_KEY_REPEAT, key, 0, (Vector2){ 0.0f, 0.0f });
+    }
+
     if (key == exitKey && action == GLFW_PRESS)
     {
+#if defined(PLATFORM_WEB) && defined(SUPPORT_WEB_WORKER)
+        windowShouldClose = true;
+#else
         glfwSetWindowShouldClose(window, GLFW_TRUE);
+#endif
 
         // NOTE: Before closing window, while loop must be left!
     }
@@ -3908,6 +6627,8 @@ static void KeyCallback(GLFWwindow *window, int key, int scancode, int action, i
         {
             if (gifRecording)
             {
+                UpdateScreenCaptures(true);     // Write pending GIF frames
+                UpdateGifEncoder(true);
                 GifEnd();
                 gifRecording = false;
 
@@ -3934,7 +6655,10 @@ static void KeyCallback(GLFWwindow *window, int key, int scancode, int action, i
 
                 // NOTE: delay represents the time between frames in the gif, if we capture a gif frame every
                 // 10 game frames and each frame trakes 16.6ms (60fps), delay between gif frames should be ~16.6*10.
-                GifBegin(path, screenWidth, screenHeight, (int)(GetFrameTime()*10.0f), 8, false);
+                gifSourceWidth = screenWidth;
+                gifWidth = screenWidth/gifDownscale;
+                gifHeight = screenHeight/gifDownscale;
+                GifBegin(path, gifWidth, gifHeight, (int)(GetFrameTime()*10.0f), 8, false);
                 screenshotCounter++;
 
                 TraceLog(LOG_INFO, "Begin animated GIF recording: %s", TextFormat("screenrec%03i.gif", screenshotCounter));
@@ -3958,6 +6682,8 @@ static void MouseButtonCallback(GLFWwindow *window, int button, int action, int
     previousMouseState[button] = currentMouseState[button];
     currentMouseState[button] = action;
 
+    PushInputEvent((action == GLFW_PRESS)? INPUT_EVENT_MOUSE_BUTTON_DOWN : INPUT_EVENT_MOUSE_BUTTON_UP, button, 0, GetMousePosition());
+
 #if defined(SUPPORT_GESTURES_SYSTEM) && defined(SUPPORT_MOUSE_GESTURES)
     // Process mouse events as touches to be able to use mouse-gestures
     GestureEvent gestureEvent;
@@ -3981,14 +6707,16 @@ static void MouseButtonCallback(GLFWwindow *window, int button, int action, int
     gestureEvent.position[0].x /= (float)GetScreenWidth();
     gestureEvent.position[0].y /= (float)GetScreenHeight();
 
-    // Gesture data is sent to gestures system for processing
-    ProcessGestureEvent(gestureEvent);
+    // Gesture data is queued for gestures system processing
+    QueueGestureEvent(gestureEvent);
 #endif
 }
 
 // GLFW3 Cursor Position Callback, runs on mouse move
 static void MouseCursorPosCallback(GLFWwindow *window, double x, double y)
 {
+    PushInputEvent(INPUT_EVENT_MOUSE_MOVE, 0, 0, (Vector2){ ((float)x + mouseOffset.x)*mouseScale.x, ((float)y + mouseOffset.y)*mouseScale.y });
+
 #if defined(SUPPORT_GESTURES_SYSTEM) && defined(SUPPORT_MOUSE_GESTURES)
     // Process mouse events as touches to be able to use mouse-gestures
     GestureEvent gestureEvent;
@@ -4010,8 +6738,8 @@ static void MouseCursorPosCallback(GLFWwindow *window, double x, double y)
     gestureEvent.position[0].x /= (float)GetScreenWidth();
     gestureEvent.position[0].y /= (float)GetScreenHeight();
 
-    // Gesture data is sent to gestures system for processing
-    ProcessGestureEvent(gestureEvent);
+    // Gesture data is queued for gestures system processing
+    QueueGestureEvent(gestureEvent);
 #endif
 }
 
@@ -4023,6 +6751,8 @@ static void CharCallback(GLFWwindow *window, unsigned int key)
     // Ref: https://github.com/glfw/glfw/issues/668#issuecomment-166794907
     // Ref: https://www.glfw.org/docs/latest/input_guide.html#input_char
 
+    PushInputEvent(INPUT_EVENT_CHAR, (int)key, 0, (Vector2){ 0.0f, 0.0f });
+
     // Check if there is space available in the queue
     if (keyPressedQueueCount < MAX_CHARS_QUEUE)
     {
@@ -4146,7 +6876,11 @@ static void AndroidCommandCallback(struct android_app *app, int32_t cmd)
             appEnabled = true;
             //ResumeMusicStream();
         } break;
-        case APP_CMD_PAUSE: break;
+        case APP_CMD_PAUSE:
+        {
+            // NOTE: Application could be killed once paused, storage values modified are written
+            StorageFlush();
+        } break;
         case APP_CMD_LOST_FOCUS:
         {
             appEnabled = false;
@@ -4180,6 +6914,137 @@ static void AndroidCommandCallback(struct android_app *app, int32_t cmd)
     }
 }
 
+// Android: Request window sustained performance mode, Window.setSustainedPerformanceMode() (Android 7.0, API 24)
+// NOTE: Device keeps clocks at a level it can sustain for long sessions (no thermal throttling swings),
+// request is ignored if mode is not supported by device
+static void SetSustainedPerformanceMode(bool enabled)
+{
+    JavaVM *vm = androidApp->activity->vm;
+    JNIEnv *env = NULL;
+
+    if ((*vm)->AttachCurrentThread(vm, &env, NULL) != JNI_OK) return;
+
+    jobject activity = androidApp->activity->clazz;
+    jclass activityClass = (*env)->GetObjectClass(env, activity);
+    jmethodID getWindow = (*env)->GetMethodID(env, activityClass, "getWindow", "()Landroid/view/Window;");
+    jobject window = (*env)->CallObjectMethod(env, activity, getWindow);
+
+    if (window != NULL)
+    {
+        jclass windowClass = (*env)->GetObjectClass(env, window);
+        jmethodID setMode = (*env)->GetMethodID(env, windowClass, "setSustainedPerformanceMode", "(Z)V");
+
+        // NOTE: Method not found (API < 24) raises a Java exception, cleared below
+        if (setMode != NULL) (*env)->CallVoidMethod(env, window, setMode, enabled? JNI_TRUE : JNI_FALSE);
+
+        (*env)->DeleteLocalRef(env, windowClass);
+        (*env)->DeleteLocalRef(env, window);
+    }
+
+    if ((*env)->ExceptionCheck(env))
+    {
+        (*env)->ExceptionClear(env);
+        TraceLog(LOG_WARNING, "Sustained performance mode not supported");
+    }
+    else TraceLog(LOG_INFO, "Sustained performance mode %s", enabled? "requested" : "disabled");
+
+    (*env)->DeleteLocalRef(env, activityClass);
+    (*vm)->DetachCurrentThread(vm);
+}
+
+#if defined(SUPPORT_ANDROID_FRAME_PACING)
+// Android: Init display frame pacing, Choreographer vsync callbacks and EGL presentation time
+// NOTE: Choreographer is only available since Android 7.0 (API 24), loaded at runtime,
+// without it frames are paced sleeping (FRAME_PACING_SLEEP)
+static void InitDisplayPacing(void)
+{
+    if (choreographer == NULL)
+    {
+        void *library = dlopen("libandroid.so", RTLD_NOW | RTLD_LOCAL);
+
+        if (library != NULL)
+        {
+            ChoreographerGetInstanceFunc getInstance = (ChoreographerGetInstanceFunc)dlsym(library, "AChoreographer_getInstance");
+            choreographerPostFrameCallback = (ChoreographerPostFrameCallbackFunc)dlsym(library, "AChoreographer_postFrameCallback");
+
+            // NOTE: Choreographer instance belongs to calling thread looper, callbacks are dispatched on ALooper_pollAll()
+            if ((getInstance != NULL) && (choreographerPostFrameCallback != NULL)) choreographer = getInstance();
+        }
+
+        if (choreographer != NULL) choreographerPostFrameCallback(choreographer, ChoreographerCallback, NULL);
+        else TraceLog(LOG_WARNING, "Choreographer not available, frames paced sleeping");
+    }
+
+    const char *extensions = eglQueryString(display, EGL_EXTENSIONS);
+
+    if ((extensions != NULL) && (strstr(extensions, "EGL_ANDROID_presentation_time") != NULL))
+    {
+        eglPresentationTime = (PFNEGLPRESENTATIONTIMEANDROIDPROC)eglGetProcAddress("eglPresentationTimeANDROID");
+    }
+
+    if ((choreographer != NULL) && (eglPresentationTime != NULL)) TraceLog(LOG_INFO, "Display frame pacing: Choreographer vsync and EGL presentation time");
+}
+
+// Android: Register display vsync time, callback is posted again for next vsync
+// NOTE: Callbacks of skipped vsyncs are not received (looper polled once per frame),
+// refresh period is estimated from vsync times intervals divided by elapsed vsyncs
+static void ChoreographerCallback(long frameTimeNanos, void *data)
+{
+    int64_t time = (int64_t)frameTimeNanos;
+    int64_t elapsed = time - vsyncTime;
+
+    if ((vsyncTime > 0) && (elapsed > 0))
+    {
+        // First measure or refresh rate increased (shorter interval than one period)
+        if ((vsyncPeriod == 0) || (elapsed < vsyncPeriod*3/4)) vsyncPeriod = elapsed;
+        else
+        {
+            int64_t count = (elapsed + vsyncPeriod/2)/vsyncPeriod;
+
+            // Smoothed period estimation, vsync times could jitter slightly
+            if (count < 16) vsyncPeriod += (elapsed/count - vsyncPeriod)/8;
+        }
+    }
+
+    vsyncTime = time;
+
+    choreographerPostFrameCallback(choreographer, ChoreographerCallback, data);
+}
+
+// Android: Check if frames are paced on display vsync (FRAME_PACING_DISPLAY)
+static bool IsDisplayPacingActive(void)
+{
+    return ((framePacingMode == FRAME_PACING_DISPLAY) && (targetTime > 0.0) && (vsyncPeriod > 0));
+}
+
+// Android: Set current frame presentation time on display vsync, target frame time rounded to vsyncs
+// NOTE: Presentation time avoids uneven frames delivery (i.e. 40 fps on 60 Hz display alternating 1 and 2 vsyncs),
+// late frames are presented on next vsync
+static void UpdateDisplayPacing(void)
+{
+    if (!IsDisplayPacingActive()) return;
+
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    int64_t now = (int64_t)ts.tv_sec*1000000000LL + (int64_t)ts.tv_nsec;
+
+    // NOTE: Frame rate never exceeds target (vsyncs rounded up), small tolerance for displays refresh not exactly nominal
+    int64_t vsyncs = (int64_t)ceil(targetTime*1e9/(double)vsyncPeriod - 0.05);
+    if (vsyncs < 1) vsyncs = 1;
+
+    // Next vsync on display vsync grid
+    int64_t nextVsync = vsyncTime + ((now > vsyncTime)? ((now - vsyncTime)/vsyncPeriod + 1) : 1)*vsyncPeriod;
+    int64_t time = presentTime + vsyncs*vsyncPeriod;
+
+    if (time < nextVsync) time = nextVsync;
+    else time = vsyncTime + ((time - vsyncTime + vsyncPeriod/2)/vsyncPeriod)*vsyncPeriod;
+
+    presentTime = time;
+
+    if (eglPresentationTime != NULL) eglPresentationTime(display, surface, (EGLnsecsANDROID)presentTime);
+}
+#endif
+
 // Android: Get input events
 static int32_t AndroidInputCallback(struct android_app *app, AInputEvent *event)
 {
@@ -4210,12 +7075,16 @@ static int32_t AndroidInputCallback(struct android_app *app, AInputEvent *event)
         if (AKeyEvent_getAction(event) == AKEY_EVENT_ACTION_DOWN)
         {
             currentKeyState[keycode] = 1;  // Key down
+            PushInputEvent(INPUT_EVENT_KEY_DOWN, keycode, 0, (Vector2){ 0.0f, 0.0f });
             
             keyPressedQueue[keyPressedQueueCount] = keycode;
             keyPressedQueueCount++;
         }
-        else currentKeyState[keycode] = 0;  // Key up
-
+        else
+        {
+            if (currentKeyState[keycode] == 1) PushInputEvent(INPUT_EVENT_KEY_UP, keycode, 0, (Vector2){ 0.0f, 0.0f });
+            currentKeyState[keycode] = 0;  // Key up
+        }
     }
     else if (type == AINPUT_EVENT_TYPE_KEY)
     {
@@ -4227,11 +7096,16 @@ static int32_t AndroidInputCallback(struct android_app *app, AInputEvent *event)
         if (AKeyEvent_getAction(event) == AKEY_EVENT_ACTION_DOWN)
         {
             currentKeyState[keycode] = 1;   // Key down
+            PushInputEvent((AKeyEvent_getRepeatCount(event) > 0)? INPUT_EVENT_KEY_REPEAT : INPUT_EVENT_KEY_DOWN, keycode, 0, (Vector2){ 0.0f, 0.0f });
             
             keyPressedQueue[keyPressedQueueCount] = keycode;
             keyPressedQueueCount++;
         }
-        else currentKeyState[keycode] = 0;  // Key up
+        else
+        {
+            currentKeyState[keycode] = 0;  // Key up
+            PushInputEvent(INPUT_EVENT_KEY_UP, keycode, 0, (Vector2){ 0.0f, 0.0f });
+        }
 
         if (keycode == AKEYCODE_POWER)
         {
@@ -4257,12 +7131,32 @@ static int32_t AndroidInputCallback(struct android_app *app, AInputEvent *event)
     int32_t action = AMotionEvent_getAction(event);
     unsigned int flags = action & AMOTION_EVENT_ACTION_MASK;
 
+    if (type == AINPUT_EVENT_TYPE_MOTION)
+    {
+        // Queue touch events, touch point code is the pointer id
+        // NOTE: Pointer going down or up is encoded on action for secondary pointers
+        int pointerIndex = (action & AMOTION_EVENT_ACTION_POINTER_INDEX_MASK) >> AMOTION_EVENT_ACTION_POINTER_INDEX_SHIFT;
+        Vector2 position = { AMotionEvent_getX(event, pointerIndex), AMotionEvent_getY(event, pointerIndex) };
+
+        if ((flags == AMOTION_EVENT_ACTION_DOWN) || (flags == AMOTION_EVENT_ACTION_POINTER_DOWN)) PushInputEvent(INPUT_EVENT_TOUCH_DOWN, AMotionEvent_getPointerId(event, pointerIndex), 0, position);
+        else if ((flags == AMOTION_EVENT_ACTION_UP) || (flags == AMOTION_EVENT_ACTION_POINTER_UP)) PushInputEvent(INPUT_EVENT_TOUCH_UP, AMotionEvent_getPointerId(event, pointerIndex), 0, position);
+        else if (flags == AMOTION_EVENT_ACTION_MOVE)
+        {
+            for (int i = 0; (i < (int)AMotionEvent_getPointerCount(event)) && (i < MAX_TOUCH_POINTS); i++)
+            {
+                PushInputEvent(INPUT_EVENT_TOUCH_MOVE, AMotionEvent_getPointerId(event, i), 0, (Vector2){ AMotionEvent_getX(event, i), AMotionEvent_getY(event, i) });
+            }
+        }
+    }
+
 #if defined(SUPPORT_GESTURES_SYSTEM)
-    GestureEvent gestureEvent;
+    GestureEvent gestureEvent = { 0 };
+    gestureEvent.touchAction = -1;
 
     // Register touch actions
-    if (flags == AMOTION_EVENT_ACTION_DOWN) gestureEvent.touchAction = TOUCH_DOWN;
-    else if (flags == AMOTION_EVENT_ACTION_UP) gestureEvent.touchAction = TOUCH_UP;
+    // NOTE: Secondary pointers going down or up change points count (pinch and multi points gestures)
+    if ((flags == AMOTION_EVENT_ACTION_DOWN) || (flags == AMOTION_EVENT_ACTION_POINTER_DOWN)) gestureEvent.touchAction = TOUCH_DOWN;
+    else if ((flags == AMOTION_EVENT_ACTION_UP) || (flags == AMOTION_EVENT_ACTION_POINTER_UP)) gestureEvent.touchAction = TOUCH_UP;
     else if (flags == AMOTION_EVENT_ACTION_MOVE) gestureEvent.touchAction = TOUCH_MOVE;
 
     // Register touch points count
@@ -4270,27 +7164,19 @@ static int32_t AndroidInputCallback(struct android_app *app, AInputEvent *event)
     // but in practice it can be 0 or over a million
     gestureEvent.pointCount = AMotionEvent_getPointerCount(event);
 
-    // Only enable gestures for 1-3 touch points
-    if ((gestureEvent.pointCount > 0) && (gestureEvent.pointCount < 4))
+    // Only enable gestures for 1 to MAX_GESTURE_POINTS touch points
+    if ((gestureEvent.touchAction != -1) && (gestureEvent.pointCount > 0) && (gestureEvent.pointCount <= MAX_GESTURE_POINTS))
     {
-        // Register touch points id
-        // NOTE: Only two points registered
-        gestureEvent.pointerId[0] = AMotionEvent_getPointerId(event, 0);
-        gestureEvent.pointerId[1] = AMotionEvent_getPointerId(event, 1);
-
-        // Register touch points position
-        gestureEvent.position[0] = (Vector2){ AMotionEvent_getX(event, 0), AMotionEvent_getY(event, 0) };
-        gestureEvent.position[1] = (Vector2){ AMotionEvent_getX(event, 1), AMotionEvent_getY(event, 1) };
-
-        // Normalize gestureEvent.position[x] for screenWidth and screenHeight
-        gestureEvent.position[0].x /= (float)GetScreenWidth();
-        gestureEvent.position[0].y /= (float)GetScreenHeight();
-
-        gestureEvent.position[1].x /= (float)GetScreenWidth();
-        gestureEvent.position[1].y /= (float)GetScreenHeight();
+        // Register touch points id and position (normalized for screenWidth and screenHeight)
+        // NOTE: Historical samples batched on move events are skipped, only latest positions are used
+        for (int i = 0; i < gestureEvent.pointCount; i++)
+        {
+            gestureEvent.pointerId[i] = AMotionEvent_getPointerId(event, i);
+            gestureEvent.position[i] = (Vector2){ AMotionEvent_getX(event, i)/(float)GetScreenWidth(), AMotionEvent_getY(event, i)/(float)GetScreenHeight() };
+        }
 
-        // Gesture data is sent to gestures system for processing
-        ProcessGestureEvent(gestureEvent);
+        // Gesture data is queued for gestures system processing
+        QueueGestureEvent(gestureEvent);
     }
 #else
     // Support only simple touch position
@@ -4373,6 +7259,16 @@ static EM_BOOL EmscriptenMouseCallback(int eventType, const EmscriptenMouseEvent
 static EM_BOOL EmscriptenTouchCallback(int eventType, const EmscriptenTouchEvent *touchEvent, void *userData)
 {
     touchDetected = true;
+
+    // Queue changed touch points events, touch point code is the touch identifier
+    int touchType = INPUT_EVENT_TOUCH_MOVE;
+    if (eventType == EMSCRIPTEN_EVENT_TOUCHSTART) touchType = INPUT_EVENT_TOUCH_DOWN;
+    else if ((eventType == EMSCRIPTEN_EVENT_TOUCHEND) || (eventType == EMSCRIPTEN_EVENT_TOUCHCANCEL)) touchType = INPUT_EVENT_TOUCH_UP;
+
+    for (int i = 0; i < touchEvent->numTouches; i++)
+    {
+        if (touchEvent->touches[i].isChanged) PushInputEvent(touchType, (int)touchEvent->touches[i].identifier, 0, (Vector2){ (float)touchEvent->touches[i].targetX, (float)touchEvent->touches[i].targetY });
+    }
     /*
     for (int i = 0; i < touchEvent->numTouches; i++)
     {
@@ -4406,32 +7302,25 @@ static EM_BOOL EmscriptenTouchCallback(int eventType, const EmscriptenTouchEvent
     else if (eventType == EMSCRIPTEN_EVENT_TOUCHMOVE) gestureEvent.touchAction = TOUCH_MOVE;
 
     // Register touch points count
-    gestureEvent.pointCount = touchEvent->numTouches;
+    gestureEvent.pointCount = (touchEvent->numTouches < MAX_GESTURE_POINTS)? touchEvent->numTouches : MAX_GESTURE_POINTS;
 
-    // Register touch points id
-    gestureEvent.pointerId[0] = touchEvent->touches[0].identifier;
-    gestureEvent.pointerId[1] = touchEvent->touches[1].identifier;
-
-    // Register touch points position
-    // NOTE: Only two points registered
+    // Register touch points id and position
     // TODO: Touch data should be scaled accordingly!
-    //gestureEvent.position[0] = (Vector2){ touchEvent->touches[0].canvasX, touchEvent->touches[0].canvasY };
-    //gestureEvent.position[1] = (Vector2){ touchEvent->touches[1].canvasX, touchEvent->touches[1].canvasY };
-    gestureEvent.position[0] = (Vector2){ touchEvent->touches[0].targetX, touchEvent->touches[0].targetY };
-    gestureEvent.position[1] = (Vector2){ touchEvent->touches[1].targetX, touchEvent->touches[1].targetY };
-
-    touchPosition[0] = gestureEvent.position[0];
-    touchPosition[1] = gestureEvent.position[1];
+    //gestureEvent.position[i] = (Vector2){ touchEvent->touches[i].canvasX, touchEvent->touches[i].canvasY };
+    for (int i = 0; i < gestureEvent.pointCount; i++)
+    {
+        gestureEvent.pointerId[i] = touchEvent->touches[i].identifier;
+        gestureEvent.position[i] = (Vector2){ touchEvent->touches[i].targetX, touchEvent->touches[i].targetY };
 
-    // Normalize gestureEvent.position[x] for screenWidth and screenHeight
-    gestureEvent.position[0].x /= (float)GetScreenWidth();
-    gestureEvent.position[0].y /= (float)GetScreenHeight();
+        touchPosition[i] = gestureEvent.position[i];
 
-    gestureEvent.position[1].x /= (float)GetScreenWidth();
-    gestureEvent.position[1].y /= (float)GetScreenHeight();
+        // Normalize gestureEvent.position[i] for screenWidth and screenHeight
+        gestureEvent.position[i].x /= (float)GetScreenWidth();
+        gestureEvent.position[i].y /= (float)GetScreenHeight();
+    }
 
-    // Gesture data is sent to gestures system for processing
-    ProcessGestureEvent(gestureEvent);
+    // Gesture data is queued for gestures system processing
+    QueueGestureEvent(gestureEvent);
 #else
     // Support only simple touch position
     if (eventType == EMSCRIPTEN_EVENT_TOUCHSTART)
@@ -4466,6 +7355,101 @@ static EM_BOOL EmscriptenGamepadCallback(int eventType, const EmscriptenGamepadE
 
     return 0;
 }
+
+#if defined(SUPPORT_WEB_WORKER)
+// Get raylib key code from DOM keyCode, returns -1 if not supported
+static int GetWebKeyCode(unsigned long keyCode)
+{
+    if ((keyCode >= 0x30) && (keyCode <= 0x39)) return KEY_ZERO + (int)(keyCode - 0x30);
+    if ((keyCode >= 0x41) && (keyCode <= 0x5A)) return KEY_A + (int)(keyCode - 0x41);
+    if ((keyCode >= 0x70) && (keyCode <= 0x7B)) return KEY_F1 + (int)(keyCode - 0x70);
+
+    switch (keyCode)
+    {
+        case 0x08: return KEY_BACKSPACE;
+        case 0x09: return KEY_TAB;
+        case 0x0D: return KEY_ENTER;
+        case 0x10: return KEY_LEFT_SHIFT;
+        case 0x11: return KEY_LEFT_CONTROL;
+        case 0x12: return KEY_LEFT_ALT;
+        case 0x1B: return KEY_ESCAPE;
+        case 0x20: return KEY_SPACE;
+        case 0x21: return KEY_PAGE_UP;
+        case 0x22: return KEY_PAGE_DOWN;
+        case 0x23: return KEY_END;
+        case 0x24: return KEY_HOME;
+        case 0x25: return KEY_LEFT;
+        case 0x26: return KEY_UP;
+        case 0x27: return KEY_RIGHT;
+        case 0x28: return KEY_DOWN;
+        case 0x2D: return KEY_INSERT;
+        case 0x2E: return KEY_DELETE;
+        default: return -1;
+    }
+}
+
+// Register keyboard input events (main loop on worker thread)
+// NOTE: Callbacks are proxied to worker thread, return value is ignored (default browser action not prevented)
+static EM_BOOL EmscriptenWorkerKeyCallback(int eventType, const EmscriptenKeyboardEvent *keyEvent, void *userData)
+{
+    if (eventType == EMSCRIPTEN_EVENT_KEYPRESS)
+    {
+        if (keyEvent->charCode > 0) CharCallback(NULL, (unsigned int)keyEvent->charCode);
+        return 0;
+    }
+
+    int key = GetWebKeyCode(keyEvent->keyCode);
+
+    if (key >= 0)
+    {
+        int action = GLFW_PRESS;
+        if (eventType == EMSCRIPTEN_EVENT_KEYUP) action = GLFW_RELEASE;
+        else if (keyEvent->repeat) action = GLFW_REPEAT;
+
+        int mods = 0;
+        if (keyEvent->shiftKey) mods |= GLFW_MOD_SHIFT;
+        if (keyEvent->ctrlKey) mods |= GLFW_MOD_CONTROL;
+        if (keyEvent->altKey) mods |= GLFW_MOD_ALT;
+
+        KeyCallback(NULL, key, 0, action, mods);
+    }
+
+    return 0;
+}
+
+// Register mouse buttons and position input events (main loop on worker thread)
+static EM_BOOL EmscriptenWorkerMouseCallback(int eventType, const EmscriptenMouseEvent *mouseEvent, void *userData)
+{
+    if (eventType == EMSCRIPTEN_EVENT_MOUSEMOVE)
+    {
+        mousePosition.x = (float)mouseEvent->targetX;
+        mousePosition.y = (float)mouseEvent->targetY;
+
+        MouseCursorPosCallback(NULL, (double)mouseEvent->targetX, (double)mouseEvent->targetY);
+    }
+    else
+    {
+        // NOTE: DOM buttons order is left-middle-right, GLFW3 buttons order is left-right-middle
+        int button = -1;
+        if (mouseEvent->button == 0) button = MOUSE_LEFT_BUTTON;
+        else if (mouseEvent->button == 1) button = MOUSE_MIDDLE_BUTTON;
+        else if (mouseEvent->button == 2) button = MOUSE_RIGHT_BUTTON;
+
+        if (button >= 0) MouseButtonCallback(NULL, button, (eventType == EMSCRIPTEN_EVENT_MOUSEDOWN)? GLFW_PRESS : GLFW_RELEASE, 0);
+    }
+
+    return 0;
+}
+
+// Register mouse wheel input events (main loop on worker thread)
+static EM_BOOL EmscriptenWorkerWheelCallback(int eventType, const EmscriptenWheelEvent *wheelEvent, void *userData)
+{
+    // NOTE: DOM wheel delta is positive scrolling down, GLFW3 offset is positive scrolling up
+    if (wheelEvent->deltaY != 0.0) ScrollCallback(NULL, 0.0, (wheelEvent->deltaY > 0.0)? -1.0 : 1.0);
+
+    return 0;
+}
+#endif  // SUPPORT_WEB_WORKER
 #endif
 
 #if defined(PLATFORM_RPI)
@@ -4665,6 +7649,14 @@ static void InitEvdevInput(void)
     // Reset keyboard key state
     for (int i = 0; i < 512; i++) currentKeyStateEvdev[i] = 0;
 
+    // Create input devices events polling descriptor, devices are read on PollInputEvents()
+    if (inputEpollFd < 0) inputEpollFd = epoll_create1(EPOLL_CLOEXEC);
+    if (inputEpollFd < 0)
+    {
+        TraceLog(LOG_WARNING, "Unable to create input events polling descriptor (epoll)");
+        return;
+    }
+
     // Open the linux directory of "/dev/input"
     directory = opendir(DEFAULT_EVDEV_PATH);
 
@@ -4675,7 +7667,7 @@ static void InitEvdevInput(void)
             if (strncmp("event", entity->d_name, strlen("event")) == 0)         // Search for devices named "event*"
             {
                 sprintf(path, "%s%s", DEFAULT_EVDEV_PATH, entity->d_name);
-                EventThreadSpawn(path);                                         // Identify the device and spawn a thread for it
+                OpenInputDevice(path);                                          // Identify the device and register it for events reading
             }
         }
 
@@ -4684,8 +7676,8 @@ static void InitEvdevInput(void)
     else TraceLog(LOG_WARNING, "Unable to open linux event directory: %s", DEFAULT_EVDEV_PATH);
 }
 
-// Identifies a input device and spawns a thread to handle it if needed
-static void EventThreadSpawn(char *device)
+// Identifies a input device and registers it for events reading if needed
+static void OpenInputDevice(char *path)
 {
     #define BITS_PER_LONG   (sizeof(long)*8)
     #define NBITS(x)        ((((x) - 1)/BITS_PER_LONG) + 1)
@@ -4702,53 +7694,53 @@ static void EventThreadSpawn(char *device)
     bool hasAbs = false;
     bool hasRel = false;
     bool hasAbsMulti = false;
-    int freeWorkerId = -1;
+    int freeDeviceId = -1;
     int fd = -1;
 
-    InputEventWorker *worker;
+    InputDevice *device;
 
-    // Open the device and allocate worker
+    // Open the device and allocate input device slot
     //-------------------------------------------------------------------------------------------------------
-    // Find a free spot in the workers array
-    for (int i = 0; i < sizeof(eventWorkers)/sizeof(InputEventWorker); ++i)
+    // Find a free spot in the devices array
+    for (int i = 0; i < sizeof(inputDevices)/sizeof(InputDevice); ++i)
     {
-        if (eventWorkers[i].threadId == 0)
+        if (!inputDevices[i].active)
         {
-            freeWorkerId = i;
+            freeDeviceId = i;
             break;
         }
     }
 
-    // Select the free worker from array
-    if (freeWorkerId >= 0)
+    // Select the free device from array
+    if (freeDeviceId >= 0)
     {
-        worker = &(eventWorkers[freeWorkerId]);       // Grab a pointer to the worker
-        memset(worker, 0, sizeof(InputEventWorker));  // Clear the worker
+        device = &(inputDevices[freeDeviceId]);     // Grab a pointer to the device
+        memset(device, 0, sizeof(InputDevice));     // Clear the device
     }
     else
     {
-        TraceLog(LOG_WARNING, "Error creating input device thread for [%s]: Out of worker slots", device);
+        TraceLog(LOG_WARNING, "Error opening input device [%s]: Out of device slots", path);
         return;
     }
 
     // Open the device
-    fd = open(device, O_RDONLY | O_NONBLOCK);
+    fd = open(path, O_RDONLY | O_NONBLOCK);
     if (fd < 0)
     {
-        TraceLog(LOG_WARNING, "Error creating input device thread for [%s]: Can't open device (Error: %d)", device, worker->fd);
+        TraceLog(LOG_WARNING, "Error opening input device [%s]: Can't open device", path);
         return;
     }
-    worker->fd = fd;
+    device->fd = fd;
 
     // Grab number on the end of the devices name "event<N>"
     int devNum = 0;
-    char *ptrDevName = strrchr(device, 't');
-    worker->eventNum = -1;
+    char *ptrDevName = strrchr(path, 't');
+    device->eventNum = -1;
 
     if (ptrDevName != NULL)
     {
         if (sscanf(ptrDevName, "t%d", &devNum) == 1)
-            worker->eventNum = devNum;
+            device->eventNum = devNum;
     }
 
     // At this point we have a connection to the device, but we don't yet know what the device is.
@@ -4771,11 +7763,11 @@ static void EventThreadSpawn(char *device)
 
             // Get the scaling values
             ioctl(fd, EVIOCGABS(ABS_X), &absinfo);
-            worker->absRange.x = absinfo.minimum;
-            worker->absRange.width = absinfo.maximum - absinfo.minimum;
+            device->absRange.x = absinfo.minimum;
+            device->absRange.width = absinfo.maximum - absinfo.minimum;
             ioctl(fd, EVIOCGABS(ABS_Y), &absinfo);
-            worker->absRange.y = absinfo.minimum;
-            worker->absRange.height = absinfo.maximum - absinfo.minimum;
+            device->absRange.y = absinfo.minimum;
+            device->absRange.height = absinfo.maximum - absinfo.minimum;
         }
 
         // Check for multiple absolute movement support (usualy multitouch touchscreens)
@@ -4785,11 +7777,11 @@ static void EventThreadSpawn(char *device)
 
             // Get the scaling values
             ioctl(fd, EVIOCGABS(ABS_X), &absinfo);
-            worker->absRange.x = absinfo.minimum;
-            worker->absRange.width = absinfo.maximum - absinfo.minimum;
+            device->absRange.x = absinfo.minimum;
+            device->absRange.width = absinfo.maximum - absinfo.minimum;
             ioctl(fd, EVIOCGABS(ABS_Y), &absinfo);
-            worker->absRange.y = absinfo.minimum;
-            worker->absRange.height = absinfo.maximum - absinfo.minimum;
+            device->absRange.y = absinfo.minimum;
+            device->absRange.height = absinfo.maximum - absinfo.minimum;
         }
     }
 
@@ -4808,69 +7800,77 @@ static void EventThreadSpawn(char *device)
 
         if (hasAbs || hasAbsMulti)
         {
-            if (TEST_BIT(keyBits, BTN_TOUCH)) worker->isTouch = true;          // This is a touchscreen
-            if (TEST_BIT(keyBits, BTN_TOOL_FINGER)) worker->isTouch = true;    // This is a drawing tablet
-            if (TEST_BIT(keyBits, BTN_TOOL_PEN)) worker->isTouch = true;       // This is a drawing tablet
-            if (TEST_BIT(keyBits, BTN_STYLUS)) worker->isTouch = true;         // This is a drawing tablet
-            if (worker->isTouch || hasAbsMulti) worker->isMultitouch = true;   // This is a multitouch capable device
+            if (TEST_BIT(keyBits, BTN_TOUCH)) device->isTouch = true;          // This is a touchscreen
+            if (TEST_BIT(keyBits, BTN_TOOL_FINGER)) device->isTouch = true;    // This is a drawing tablet
+            if (TEST_BIT(keyBits, BTN_TOOL_PEN)) device->isTouch = true;       // This is a drawing tablet
+            if (TEST_BIT(keyBits, BTN_STYLUS)) device->isTouch = true;         // This is a drawing tablet
+            if (device->isTouch || hasAbsMulti) device->isMultitouch = true;   // This is a multitouch capable device
         }
 
         if (hasRel)
         {
-            if (TEST_BIT(keyBits, BTN_LEFT)) worker->isMouse = true;           // This is a mouse
-            if (TEST_BIT(keyBits, BTN_RIGHT)) worker->isMouse = true;          // This is a mouse
+            if (TEST_BIT(keyBits, BTN_LEFT)) device->isMouse = true;           // This is a mouse
+            if (TEST_BIT(keyBits, BTN_RIGHT)) device->isMouse = true;          // This is a mouse
         }
 
-        if (TEST_BIT(keyBits, BTN_A)) worker->isGamepad = true;                // This is a gamepad
-        if (TEST_BIT(keyBits, BTN_TRIGGER)) worker->isGamepad = true;          // This is a gamepad
-        if (TEST_BIT(keyBits, BTN_START)) worker->isGamepad = true;            // This is a gamepad
-        if (TEST_BIT(keyBits, BTN_TL)) worker->isGamepad = true;               // This is a gamepad
-        if (TEST_BIT(keyBits, BTN_TL)) worker->isGamepad = true;               // This is a gamepad
+        if (TEST_BIT(keyBits, BTN_A)) device->isGamepad = true;                // This is a gamepad
+        if (TEST_BIT(keyBits, BTN_TRIGGER)) device->isGamepad = true;          // This is a gamepad
+        if (TEST_BIT(keyBits, BTN_START)) device->isGamepad = true;            // This is a gamepad
+        if (TEST_BIT(keyBits, BTN_TL)) device->isGamepad = true;               // This is a gamepad
+        if (TEST_BIT(keyBits, BTN_TL)) device->isGamepad = true;               // This is a gamepad
 
-        if (TEST_BIT(keyBits, KEY_SPACE)) worker->isKeyboard = true;           // This is a keyboard
+        if (TEST_BIT(keyBits, KEY_SPACE)) device->isKeyboard = true;           // This is a keyboard
     }
     //-------------------------------------------------------------------------------------------------------
 
     // Decide what to do with the device
     //-------------------------------------------------------------------------------------------------------
-    if (worker->isTouch || worker->isMouse || worker->isKeyboard)
+    if (device->isTouch || device->isMouse || device->isKeyboard)
     {
         // Looks like a interesting device
-        TraceLog(LOG_INFO, "Opening input device [%s] (%s%s%s%s%s)", device,
-            worker->isMouse? "mouse " : "",
-            worker->isMultitouch? "multitouch " : "",
-            worker->isTouch? "touchscreen " : "",
-            worker->isGamepad? "gamepad " : "",
-            worker->isKeyboard? "keyboard " : "");
-
-        // Create a thread for this device
-        int error = pthread_create(&worker->threadId, NULL, &EventThread, (void *)worker);
-        if (error != 0)
+        TraceLog(LOG_INFO, "Opening input device [%s] (%s%s%s%s%s)", path,
+            device->isMouse? "mouse " : "",
+            device->isMultitouch? "multitouch " : "",
+            device->isTouch? "touchscreen " : "",
+            device->isGamepad? "gamepad " : "",
+            device->isKeyboard? "keyboard " : "");
+
+        // Request events timestamps on monotonic clock, same as GetTime()
+        int clockId = CLOCK_MONOTONIC;
+        device->monotonicTime = (ioctl(fd, EVIOCSCLOCKID, &clockId) == 0);
+
+        // Register the device for events reading
+        struct epoll_event registration = { 0 };
+        registration.events = EPOLLIN;
+        registration.data.ptr = device;
+
+        if (epoll_ctl(inputEpollFd, EPOLL_CTL_ADD, fd, &registration) != 0)
         {
-            TraceLog(LOG_WARNING, "Error creating input device thread for [%s]: Can't create thread (Error: %d)", device, error);
-            worker->threadId = 0;
+            TraceLog(LOG_WARNING, "Error opening input device [%s]: Can't register device for events polling", path);
             close(fd);
+            return;
         }
 
+        device->active = true;
+
 #if defined(USE_LAST_TOUCH_DEVICE)
         // Find touchscreen with the highest index
         int maxTouchNumber = -1;
 
-        for (int i = 0; i < sizeof(eventWorkers)/sizeof(InputEventWorker); ++i)
+        for (int i = 0; i < sizeof(inputDevices)/sizeof(InputDevice); ++i)
         {
-            if (eventWorkers[i].isTouch && (eventWorkers[i].eventNum > maxTouchNumber)) maxTouchNumber = eventWorkers[i].eventNum;
+            if (inputDevices[i].isTouch && (inputDevices[i].eventNum > maxTouchNumber)) maxTouchNumber = inputDevices[i].eventNum;
         }
 
         // Find toucnscreens with lower indexes
-        for (int i = 0; i < sizeof(eventWorkers)/sizeof(InputEventWorker); ++i)
+        for (int i = 0; i < sizeof(inputDevices)/sizeof(InputDevice); ++i)
         {
-            if (eventWorkers[i].isTouch && (eventWorkers[i].eventNum < maxTouchNumber))
+            if (inputDevices[i].isTouch && (inputDevices[i].eventNum < maxTouchNumber))
             {
-                if (eventWorkers[i].threadId != 0)
+                if (inputDevices[i].active)
                 {
-                    TraceLog(LOG_WARNING, "Duplicate touchscreen found, killing touchscreen on event: %d", i);
-                    pthread_cancel(eventWorkers[i].threadId);
-                    close(eventWorkers[i].fd);
+                    TraceLog(LOG_WARNING, "Duplicate touchscreen found, closing touchscreen on event: %d", i);
+                    CloseInputDevice(&inputDevices[i]);
                 }
             }
         }
@@ -4880,8 +7880,53 @@ static void EventThreadSpawn(char *device)
     //-------------------------------------------------------------------------------------------------------
 }
 
-// Input device events reading thread
-static void *EventThread(void *arg)
+// Unregister and close input device
+static void CloseInputDevice(InputDevice *device)
+{
+    if (inputEpollFd >= 0) epoll_ctl(inputEpollFd, EPOLL_CTL_DEL, device->fd, NULL);
+    close(device->fd);
+
+    device->active = false;
+}
+
+// Read input devices and gamepads pending events, called on PollInputEvents() (main thread)
+// NOTE: Devices are non-blocking, all events received since last frame are processed in order
+static void ProcessInputDevices(void)
+{
+    #define MAX_INPUT_POLL_EVENTS   16
+
+    struct epoll_event events[MAX_INPUT_POLL_EVENTS];
+    int count = 0;
+
+    if (inputEpollFd < 0) return;
+
+    while ((count = epoll_wait(inputEpollFd, events, MAX_INPUT_POLL_EVENTS, 0)) > 0)
+    {
+        for (int i = 0; i < count; i++)
+        {
+            // NOTE: Gamepads are registered with their index, evdev devices with device pointer
+            if (events[i].data.u64 < MAX_GAMEPADS) ProcessGamepadEvents((int)events[i].data.u64);
+            else
+            {
+                InputDevice *device = (InputDevice *)events[i].data.ptr;
+
+                ProcessInputDeviceEvents(device);
+
+                // Device disconnected
+                if (events[i].events & (EPOLLERR | EPOLLHUP))
+                {
+                    TraceLog(LOG_WARNING, "Input device on event %d disconnected", device->eventNum);
+                    CloseInputDevice(device);
+                }
+            }
+        }
+
+        if (count < MAX_INPUT_POLL_EVENTS) break;
+    }
+}
+
+// Read and process input device pending events
+static void ProcessInputDeviceEvents(InputDevice *device)
 {
     // Scancode to keycode mapping for US keyboards
     // TODO: Probably replace this with a keymap from the X11 to get the correct regional map for the keyboard:
@@ -4904,199 +7949,232 @@ static void *EventThread(void *arg)
         243,244,245,246,247,248,0,0,0,0,0,0,0, };
 
     struct input_event event;
-    InputEventWorker *worker = (InputEventWorker *)arg;
 
     int touchAction = -1;
     bool gestureUpdate = false;
     int keycode;
 
-    while (!windowShouldClose)
+    // Read all pending events, non-blocking read fails when no data available
+    while (read(device->fd, &event, sizeof(event)) == (int)sizeof(event))
     {
-        // Try to read data from the device and only continue if successful
-        if (read(worker->fd, &event, sizeof(event)) == (int)sizeof(event))
+        // Timestamp queued input events with kernel event time
+        if (device->monotonicTime) inputEventTime = (double)((uint64_t)event.time.tv_sec*1000000000LLU + (uint64_t)event.time.tv_usec*1000LLU - baseTime)*1e-9;
+
+        // Relative movement parsing
+        if (event.type == EV_REL)
         {
-            // Relative movement parsing
-            if (event.type == EV_REL)
+            if (event.code == REL_X)
             {
-                if (event.code == REL_X)
-                {
-                    mousePosition.x += event.value;
-                    touchPosition[0].x = mousePosition.x;
+                mousePosition.x += event.value;
+                touchPosition[0].x = mousePosition.x;
 
-                    #if defined(SUPPORT_GESTURES_SYSTEM)
-                        touchAction = TOUCH_MOVE;
-                        gestureUpdate = true;
-                    #endif
-                }
+                #if defined(SUPPORT_GESTURES_SYSTEM)
+                    touchAction = TOUCH_MOVE;
+                    gestureUpdate = true;
+                #endif
+            }
 
-                if (event.code == REL_Y)
-                {
-                    mousePosition.y += event.value;
-                    touchPosition[0].y = mousePosition.y;
+            if (event.code == REL_Y)
+            {
+                mousePosition.y += event.value;
+                touchPosition[0].y = mousePosition.y;
 
-                    #if defined(SUPPORT_GESTURES_SYSTEM)
-                        touchAction = TOUCH_MOVE;
-                        gestureUpdate = true;
-                    #endif
-                }
+                #if defined(SUPPORT_GESTURES_SYSTEM)
+                    touchAction = TOUCH_MOVE;
+                    gestureUpdate = true;
+                #endif
+            }
 
-                if (event.code == REL_WHEEL) currentMouseWheelY += event.value;
+            if (event.code == REL_WHEEL)
+            {
+                currentMouseWheelY += event.value;
+                PushInputEvent(INPUT_EVENT_MOUSE_WHEEL, 0, 0, (Vector2){ 0.0f, (float)event.value });
             }
+        }
 
-            // Absolute movement parsing
-            if (event.type == EV_ABS)
+        // Absolute movement parsing
+        if (event.type == EV_ABS)
+        {
+            // Basic movement
+            if (event.code == ABS_X)
             {
-                // Basic movement
-                if (event.code == ABS_X)
-                {
-                    mousePosition.x = (event.value - worker->absRange.x)*screenWidth/worker->absRange.width;   // Scale acording to absRange
+                mousePosition.x = (event.value - device->absRange.x)*screenWidth/device->absRange.width;   // Scale acording to absRange
 
-                    #if defined(SUPPORT_GESTURES_SYSTEM)
-                        touchAction = TOUCH_MOVE;
-                        gestureUpdate = true;
-                    #endif
-                }
+                #if defined(SUPPORT_GESTURES_SYSTEM)
+                    touchAction = TOUCH_MOVE;
+                    gestureUpdate = true;
+                #endif
+            }
 
-                if (event.code == ABS_Y)
-                {
-                    mousePosition.y = (event.value - worker->absRange.y)*screenHeight/worker->absRange.height; // Scale acording to absRange
+            if (event.code == ABS_Y)
+            {
+                mousePosition.y = (event.value - device->absRange.y)*screenHeight/device->absRange.height; // Scale acording to absRange
 
-                    #if defined(SUPPORT_GESTURES_SYSTEM)
-                        touchAction = TOUCH_MOVE;
-                        gestureUpdate = true;
-                    #endif
-                }
+                #if defined(SUPPORT_GESTURES_SYSTEM)
+                    touchAction = TOUCH_MOVE;
+                    gestureUpdate = true;
+                #endif
+            }
 
-                // Multitouch movement
-                if (event.code == ABS_MT_SLOT) worker->touchSlot = event.value;   // Remeber the slot number for the folowing events
+            // Multitouch movement
+            if (event.code == ABS_MT_SLOT) device->touchSlot = event.value;   // Remeber the slot number for the folowing events
 
-                if (event.code == ABS_MT_POSITION_X)
+            if (event.code == ABS_MT_POSITION_X)
+            {
+                if (device->touchSlot < MAX_TOUCH_POINTS)
                 {
-                    if (worker->touchSlot < MAX_TOUCH_POINTS) touchPosition[worker->touchSlot].x = (event.value - worker->absRange.x)*screenWidth/worker->absRange.width;    // Scale acording to absRange
+                    touchPosition[device->touchSlot].x = (event.value - device->absRange.x)*screenWidth/device->absRange.width;    // Scale acording to absRange
+                    device->touchMoved[device->touchSlot] = true;
                 }
+            }
 
-                if (event.code == ABS_MT_POSITION_Y)
+            if (event.code == ABS_MT_POSITION_Y)
+            {
+                if (device->touchSlot < MAX_TOUCH_POINTS)
                 {
-                    if (worker->touchSlot < MAX_TOUCH_POINTS) touchPosition[worker->touchSlot].y = (event.value - worker->absRange.y)*screenHeight/worker->absRange.height;  // Scale acording to absRange
+                    touchPosition[device->touchSlot].y = (event.value - device->absRange.y)*screenHeight/device->absRange.height;  // Scale acording to absRange
+                    device->touchMoved[device->touchSlot] = true;
                 }
+            }
 
-                if (event.code == ABS_MT_TRACKING_ID)
+            if (event.code == ABS_MT_TRACKING_ID)
+            {
+                if ((event.value < 0) && (device->touchSlot < MAX_TOUCH_POINTS))
                 {
-                    if ((event.value < 0) && (worker->touchSlot < MAX_TOUCH_POINTS))
-                    {
-                        // Touch has ended for this point
-                        touchPosition[worker->touchSlot].x = -1;
-                        touchPosition[worker->touchSlot].y = -1;
-                    }
+                    PushInputEvent(INPUT_EVENT_TOUCH_UP, device->touchSlot, 0, touchPosition[device->touchSlot]);
+                    device->touchDown[device->touchSlot] = false;
+                    device->touchMoved[device->touchSlot] = false;
+
+                    // Touch has ended for this point
+                    touchPosition[device->touchSlot].x = -1;
+                    touchPosition[device->touchSlot].y = -1;
                 }
+                else if (device->touchSlot < MAX_TOUCH_POINTS) device->touchDown[device->touchSlot] = true;  // Queued on sync report, position received
             }
+        }
 
-            // Button parsing
-            if (event.type == EV_KEY)
+        // Button parsing
+        if (event.type == EV_KEY)
+        {
+            // Mouse button parsing
+            if ((event.code == BTN_TOUCH) || (event.code == BTN_LEFT))
             {
-                // Mouse button parsing
-                if ((event.code == BTN_TOUCH) || (event.code == BTN_LEFT))
-                {
-                    currentMouseStateEvdev[MOUSE_LEFT_BUTTON] = event.value;
+                currentMouseStateEvdev[MOUSE_LEFT_BUTTON] = event.value;
+                PushInputEvent((event.value > 0)? INPUT_EVENT_MOUSE_BUTTON_DOWN : INPUT_EVENT_MOUSE_BUTTON_UP, MOUSE_LEFT_BUTTON, 0, GetMousePosition());
 
-                    #if defined(SUPPORT_GESTURES_SYSTEM)
-                        if (event.value > 0) touchAction = TOUCH_DOWN;
-                        else touchAction = TOUCH_UP;
-                        gestureUpdate = true;
-                    #endif
-                }
+                #if defined(SUPPORT_GESTURES_SYSTEM)
+                    if (event.value > 0) touchAction = TOUCH_DOWN;
+                    else touchAction = TOUCH_UP;
+                    gestureUpdate = true;
+                #endif
+            }
+
+            if (event.code == BTN_RIGHT)
+            {
+                currentMouseStateEvdev[MOUSE_RIGHT_BUTTON] =  event.value;
+                PushInputEvent((event.value > 0)? INPUT_EVENT_MOUSE_BUTTON_DOWN : INPUT_EVENT_MOUSE_BUTTON_UP, MOUSE_RIGHT_BUTTON, 0, GetMousePosition());
+            }
 
-                if (event.code == BTN_RIGHT) currentMouseStateEvdev[MOUSE_RIGHT_BUTTON] =  event.value;
+            if (event.code == BTN_MIDDLE)
+            {
+                currentMouseStateEvdev[MOUSE_MIDDLE_BUTTON] =  event.value;
+                PushInputEvent((event.value > 0)? INPUT_EVENT_MOUSE_BUTTON_DOWN : INPUT_EVENT_MOUSE_BUTTON_UP, MOUSE_MIDDLE_BUTTON, 0, GetMousePosition());
+            }
 
-                if (event.code == BTN_MIDDLE) currentMouseStateEvdev[MOUSE_MIDDLE_BUTTON] =  event.value;
+            // Keyboard button parsing
+            if ((event.code >= 1) && (event.code <= 255))     //Keyboard keys appear for codes 1 to 255
+            {
+                keycode = keymap_US[event.code & 0xFF];     // The code we get is a scancode so we look up the apropriate keycode
 
-                // Keyboard button parsing
-                if ((event.code >= 1) && (event.code <= 255))     //Keyboard keys appear for codes 1 to 255
+                // Make sure we got a valid keycode
+                if ((keycode > 0) && (keycode < sizeof(currentKeyState)))
                 {
-                    keycode = keymap_US[event.code & 0xFF];     // The code we get is a scancode so we look up the apropriate keycode
+                    /* Disabled buffer !!
+                    // Store the key information for raylib to later use
+                    currentKeyStateEvdev[keycode] = event.value;
+                    if (event.value > 0)
+                    {
+                        // Add the key int the fifo
+                        lastKeyPressedEvdev.Contents[lastKeyPressedEvdev.Head] = keycode;   // Put the data at the front of the fifo snake
+                        lastKeyPressedEvdev.Head = (lastKeyPressedEvdev.Head + 1) & 0x07;   // Increment the head pointer forwards and binary wraparound after 7 (fifo is 8 elements long)
+                        // TODO: This fifo is not fully threadsafe with multiple writers, so multiple keyboards hitting a key at the exact same time could miss a key (double write to head before it was incremented)
+                    }
+                    */
+
+                    currentKeyState[keycode] = event.value;
+
+                    // NOTE: Key event value is 0 for release, 1 for press and 2 for autorepeat
+                    if (event.value == 0) PushInputEvent(INPUT_EVENT_KEY_UP, keycode, 0, (Vector2){ 0.0f, 0.0f });
+                    else PushInputEvent((event.value == 2)? INPUT_EVENT_KEY_REPEAT : INPUT_EVENT_KEY_DOWN, keycode, 0, (Vector2){ 0.0f, 0.0f });
 
-                    // Make sure we got a valid keycode
-                    if ((keycode > 0) && (keycode < sizeof(currentKeyState)))
+                    if (event.value == 1) 
                     {
-                        /* Disabled buffer !!
-                        // Store the key information for raylib to later use
-                        currentKeyStateEvdev[keycode] = event.value;
-                        if (event.value > 0)
-                        {
-                            // Add the key int the fifo
-                            lastKeyPressedEvdev.Contents[lastKeyPressedEvdev.Head] = keycode;   // Put the data at the front of the fifo snake
-                            lastKeyPressedEvdev.Head = (lastKeyPressedEvdev.Head + 1) & 0x07;   // Increment the head pointer forwards and binary wraparound after 7 (fifo is 8 elements long)
-                            // TODO: This fifo is not fully threadsafe with multiple writers, so multiple keyboards hitting a key at the exact same time could miss a key (double write to head before it was incremented)
-                        }
-                        */
+                        keyPressedQueue[keyPressedQueueCount] = keycode;     // Register last key pressed
+                        keyPressedQueueCount++;
+                    }
 
-                        currentKeyState[keycode] = event.value;
-                        if (event.value == 1) 
+                    #if defined(SUPPORT_SCREEN_CAPTURE)
+                        // Check screen capture key (raylib key: KEY_F12)
+                        if (currentKeyState[301] == 1)
                         {
-                            keyPressedQueue[keyPressedQueueCount] = keycode;     // Register last key pressed
-                            keyPressedQueueCount++;
+                            TakeScreenshot(FormatText("screenshot%03i.png", screenshotCounter));
+                            screenshotCounter++;
                         }
+                    #endif
 
-                        #if defined(SUPPORT_SCREEN_CAPTURE)
-                            // Check screen capture key (raylib key: KEY_F12)
-                            if (currentKeyState[301] == 1)
-                            {
-                                TakeScreenshot(FormatText("screenshot%03i.png", screenshotCounter));
-                                screenshotCounter++;
-                            }
-                        #endif
-
-                        if (currentKeyState[exitKey] == 1) windowShouldClose = true;
+                    if (currentKeyState[exitKey] == 1) windowShouldClose = true;
 
-                        TraceLog(LOG_DEBUG, "KEY%s ScanCode: %4i KeyCode: %4i",event.value == 0 ? "UP":"DOWN", event.code, keycode);
-                    }
+                    TraceLog(LOG_DEBUG, "KEY%s ScanCode: %4i KeyCode: %4i",event.value == 0 ? "UP":"DOWN", event.code, keycode);
                 }
             }
+        }
+
+        // Screen confinement
+        if (mousePosition.x < 0) mousePosition.x = 0;
+        if (mousePosition.x > screenWidth/mouseScale.x) mousePosition.x = screenWidth/mouseScale.x;
 
-            // Screen confinement
-            if (mousePosition.x < 0) mousePosition.x = 0;
-            if (mousePosition.x > screenWidth/mouseScale.x) mousePosition.x = screenWidth/mouseScale.x;
+        if (mousePosition.y < 0) mousePosition.y = 0;
+        if (mousePosition.y > screenHeight/mouseScale.y) mousePosition.y = screenHeight/mouseScale.y;
 
-            if (mousePosition.y < 0) mousePosition.y = 0;
-            if (mousePosition.y > screenHeight/mouseScale.y) mousePosition.y = screenHeight/mouseScale.y;
+        if (((event.type == EV_REL) && ((event.code == REL_X) || (event.code == REL_Y))) ||
+            ((event.type == EV_ABS) && ((event.code == ABS_X) || (event.code == ABS_Y)))) PushInputEvent(INPUT_EVENT_MOUSE_MOVE, 0, 0, GetMousePosition());
 
-            // Gesture update
-            if (gestureUpdate)
+        // Queue touch points moved (or down) on sync report, when all axis are received
+        if ((event.type == EV_SYN) && (event.code == SYN_REPORT))
+        {
+            for (int i = 0; i < MAX_TOUCH_POINTS; i++)
             {
-            #if defined(SUPPORT_GESTURES_SYSTEM)
-                GestureEvent gestureEvent = { 0 };
+                if (device->touchDown[i]) PushInputEvent(INPUT_EVENT_TOUCH_DOWN, i, 0, touchPosition[i]);
+                else if (device->touchMoved[i]) PushInputEvent(INPUT_EVENT_TOUCH_MOVE, i, 0, touchPosition[i]);
 
-                gestureEvent.pointCount = 0;
-                gestureEvent.touchAction = touchAction;
+                device->touchDown[i] = false;
+                device->touchMoved[i] = false;
+            }
+        }
 
-                if (touchPosition[0].x >= 0) gestureEvent.pointCount++;
-                if (touchPosition[1].x >= 0) gestureEvent.pointCount++;
-                if (touchPosition[2].x >= 0) gestureEvent.pointCount++;
-                if (touchPosition[3].x >= 0) gestureEvent.pointCount++;
+        // Gesture update
+        if (gestureUpdate)
+        {
+        #if defined(SUPPORT_GESTURES_SYSTEM)
+            GestureEvent gestureEvent = { 0 };
 
-                gestureEvent.pointerId[0] = 0;
-                gestureEvent.pointerId[1] = 1;
-                gestureEvent.pointerId[2] = 2;
-                gestureEvent.pointerId[3] = 3;
+            gestureEvent.pointCount = 0;
+            gestureEvent.touchAction = touchAction;
 
-                gestureEvent.position[0] = touchPosition[0];
-                gestureEvent.position[1] = touchPosition[1];
-                gestureEvent.position[2] = touchPosition[2];
-                gestureEvent.position[3] = touchPosition[3];
+            for (int i = 0; i < MAX_GESTURE_POINTS; i++)
+            {
+                if (touchPosition[i].x >= 0) gestureEvent.pointCount++;
 
-                ProcessGestureEvent(gestureEvent);
-            #endif
+                gestureEvent.pointerId[i] = i;
+                gestureEvent.position[i] = touchPosition[i];
             }
-        }
-        else
-        {
-            usleep(5000); // Sleep for 5ms to avoid hogging CPU time
+
+            QueueGestureEvent(gestureEvent);
+        #endif
         }
     }
 
-    close(worker->fd);
-
-    return NULL;
+    inputEventTime = -1.0;
 }
 
 // Init gamepad system
@@ -5115,22 +8193,27 @@ static void InitGamepad(void)
         }
         else
         {
-            gamepadReady[i] = true;
+            // Register the gamepad for events reading, gamepads are registered with their index
+            struct epoll_event registration = { 0 };
+            registration.events = EPOLLIN;
+            registration.data.u64 = i;
 
-            // NOTE: Only create one thread
-            if (i == 0)
+            if ((inputEpollFd >= 0) && (epoll_ctl(inputEpollFd, EPOLL_CTL_ADD, gamepadStream[i], &registration) == 0))
             {
-                int error = pthread_create(&gamepadThreadId, NULL, &GamepadThread, NULL);
-
-                if (error != 0) TraceLog(LOG_WARNING, "Error creating gamepad input event thread");
-                else  TraceLog(LOG_INFO, "Gamepad device initialized successfully");
+                gamepadReady[i] = true;
+                TraceLog(LOG_INFO, "Gamepad device initialized successfully");
+            }
+            else
+            {
+                TraceLog(LOG_WARNING, "Error registering gamepad for events polling");
+                close(gamepadStream[i]);
             }
         }
     }
 }
 
-// Process Gamepad (/dev/input/js0)
-static void *GamepadThread(void *arg)
+// Read and process gamepad (/dev/input/js<N>) pending events
+static void ProcessGamepadEvents(int gamepad)
 {
     #define JS_EVENT_BUTTON         0x01    // Button pressed/released
     #define JS_EVENT_AXIS           0x02    // Joystick axis moved
@@ -5146,46 +8229,37 @@ static void *GamepadThread(void *arg)
     // Read gamepad event
     struct js_event gamepadEvent;
 
-    while (!windowShouldClose)
+    // Read all pending events, non-blocking read fails when no data available
+    while (read(gamepadStream[gamepad], &gamepadEvent, sizeof(struct js_event)) == (int)sizeof(struct js_event))
     {
-        for (int i = 0; i < MAX_GAMEPADS; i++)
-        {
-            if (read(gamepadStream[i], &gamepadEvent, sizeof(struct js_event)) == (int)sizeof(struct js_event))
-            {
-                gamepadEvent.type &= ~JS_EVENT_INIT;     // Ignore synthetic events
-
-                // Process gamepad events by type
-                if (gamepadEvent.type == JS_EVENT_BUTTON)
-                {
-                    TraceLog(LOG_DEBUG, "Gamepad button: %i, value: %i", gamepadEvent.number, gamepadEvent.value);
+        gamepadEvent.type &= ~JS_EVENT_INIT;     // Ignore synthetic events
 
-                    if (gamepadEvent.number < MAX_GAMEPAD_BUTTONS)
-                    {
-                        // 1 - button pressed, 0 - button released
-                        currentGamepadState[i][gamepadEvent.number] = (int)gamepadEvent.value;
+        // Process gamepad events by type
+        if (gamepadEvent.type == JS_EVENT_BUTTON)
+        {
+            TraceLog(LOG_DEBUG, "Gamepad button: %i, value: %i", gamepadEvent.number, gamepadEvent.value);
 
-                        if ((int)gamepadEvent.value == 1) lastGamepadButtonPressed = gamepadEvent.number;
-                        else lastGamepadButtonPressed = -1;
-                    }
-                }
-                else if (gamepadEvent.type == JS_EVENT_AXIS)
-                {
-                    TraceLog(LOG_DEBUG, "Gamepad axis: %i, value: %i", gamepadEvent.number, gamepadEvent.value);
+            if (gamepadEvent.number < MAX_GAMEPAD_BUTTONS)
+            {
+                // 1 - button pressed, 0 - button released
+                currentGamepadState[gamepad][gamepadEvent.number] = (int)gamepadEvent.value;
+                PushInputEvent(((int)gamepadEvent.value == 1)? INPUT_EVENT_GAMEPAD_BUTTON_DOWN : INPUT_EVENT_GAMEPAD_BUTTON_UP, gamepadEvent.number, gamepad, (Vector2){ 0.0f, 0.0f });
 
-                    if (gamepadEvent.number < MAX_GAMEPAD_AXIS)
-                    {
-                        // NOTE: Scaling of gamepadEvent.value to get values between -1..1
-                        gamepadAxisState[i][gamepadEvent.number] = (float)gamepadEvent.value/32768;
-                    }
-                }
+                if ((int)gamepadEvent.value == 1) lastGamepadButtonPressed = gamepadEvent.number;
+                else lastGamepadButtonPressed = -1;
             }
-            else
+        }
+        else if (gamepadEvent.type == JS_EVENT_AXIS)
+        {
+            TraceLog(LOG_DEBUG, "Gamepad axis: %i, value: %i", gamepadEvent.number, gamepadEvent.value);
+
+            if (gamepadEvent.number < MAX_GAMEPAD_AXIS)
             {
-                usleep(1000); //Sleep for 1ms to avoid hogging CPU time
+                // NOTE: Scaling of gamepadEvent.value to get values between -1..1
+                gamepadAxisState[gamepad][gamepadEvent.number] = (float)gamepadEvent.value/32768;
+                PushInputEvent(INPUT_EVENT_GAMEPAD_AXIS, gamepadEvent.number, gamepad, (Vector2){ gamepadAxisState[gamepad][gamepadEvent.number], 0.0f });
             }
         }
     }
-
-    return NULL;
 }
 #endif      // PLATFORM_RPI
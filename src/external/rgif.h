@@ -101,6 +101,7 @@
 // NOTE: By default use bitDepth = 8, dither = false
 RGIFDEF bool GifBegin(const char *filename, unsigned int width, unsigned int height, unsigned int delay, unsigned int bitDepth, bool dither);
 RGIFDEF bool GifWriteFrame(const unsigned char *image, unsigned int width, unsigned int height, unsigned int delay, int bitDepth, bool dither);
+RGIFDEF bool GifWriteFrameEx(const unsigned char *image, unsigned int width, unsigned int height, unsigned int delay, int bitDepth, bool dither, bool fixedPalette);
 RGIFDEF bool GifEnd();
 
 #endif // RGIF_H
@@ -188,6 +189,9 @@ const int gifTransparentIndex = 0;       // Transparent color index
 static FILE *gifFile;
 unsigned char *gifFrame;
 
+static GifPalette gifPalette;           // Palette reused across frames (fixed palette)
+static bool gifPaletteReady = false;    // Fixed palette computed (first frame)
+
 //----------------------------------------------------------------------------------
 // Module specific Functions Declaration
 //----------------------------------------------------------------------------------
@@ -226,6 +230,7 @@ RGIFDEF bool GifBegin(const char *filename, unsigned int width, unsigned int hei
     
     // Allocate space for one gif frame
     gifFrame = (unsigned char *)RGIF_MALLOC(width*height*4);
+    gifPaletteReady = false;
     
     // GIF Header
     fputs("GIF89a",gifFile);
@@ -276,13 +281,28 @@ RGIFDEF bool GifBegin(const char *filename, unsigned int width, unsigned int hei
 // AFAIK, it is legal to use different bit depths for different frames of an image -
 // this may be handy to save bits in animations that don't change much.
 RGIFDEF bool GifWriteFrame(const unsigned char *image, unsigned int width, unsigned int height, unsigned int delay, int bitDepth, bool dither)
+{
+    return GifWriteFrameEx(image, width, height, delay, bitDepth, dither, false);
+}
+
+// Writes out a new frame to a GIF in progress, palette can be computed once (first frame) and reused for next frames
+// NOTE: Fixed palette avoids palette computation (pixels sorting) on every frame, colors not in first frame are approximated
+RGIFDEF bool GifWriteFrameEx(const unsigned char *image, unsigned int width, unsigned int height, unsigned int delay, int bitDepth, bool dither, bool fixedPalette)
 {
     if (!gifFile) return false;
     
     const unsigned char *oldImage = gifFrame;
     
     GifPalette pal;
-    GifMakePalette((dither ? NULL : oldImage), image, width, height, bitDepth, dither, &pal);
+    
+    if (fixedPalette)
+    {
+        // NOTE: Fixed palette is computed from all first frame pixels (not only changed ones)
+        if (!gifPaletteReady) GifMakePalette(NULL, image, width, height, bitDepth, dither, &gifPalette);
+        gifPaletteReady = true;
+        pal = gifPalette;
+    }
+    else GifMakePalette((dither ? NULL : oldImage), image, width, height, bitDepth, dither, &pal);
     
     if (dither) GifDitherImage(oldImage, image, gifFrame, width, height, &pal);
     else GifThresholdImage(oldImage, image, gifFrame, width, height, &pal);
@@ -53,7 +53,9 @@
 //----------------------------------------------------------------------------------
 // Defines and Macros
 //----------------------------------------------------------------------------------
-//...
+#ifndef MAX_GESTURE_POINTS
+    #define MAX_GESTURE_POINTS      5       // Maximum touch points processed by gestures (up to 5 fingers gestures)
+#endif
 
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
@@ -84,19 +86,20 @@
         GESTURE_SWIPE_UP    = 64,
         GESTURE_SWIPE_DOWN  = 128,
         GESTURE_PINCH_IN    = 256,
-        GESTURE_PINCH_OUT   = 512
+        GESTURE_PINCH_OUT   = 512,
+        GESTURE_MULTI_DRAG  = 1024
     } Gestures;
 #endif
 
 typedef enum { TOUCH_UP, TOUCH_DOWN, TOUCH_MOVE } TouchAction;
 
 // Gesture events
-// NOTE: MAX_TOUCH_POINTS fixed to 4
+// NOTE: Points over MAX_GESTURE_POINTS are not processed
 typedef struct {
     int touchAction;
     int pointCount;
-    int pointerId[4];
-    Vector2 position[4];
+    int pointerId[MAX_GESTURE_POINTS];
+    Vector2 position[MAX_GESTURE_POINTS];
 } GestureEvent;
 
 #ifdef __cplusplus
@@ -112,6 +115,7 @@ extern "C" {            // Prevents name mangling of functions
 // Module Functions Declaration
 //----------------------------------------------------------------------------------
 void ProcessGestureEvent(GestureEvent event);           // Process gesture event and translate it into gestures
+void ProcessGestureEvents(const GestureEvent *events, int count);   // Process gesture events batch, redundant move events skipped
 void UpdateGestures(void);                              // Update gestures detected (must be called every frame)
 
 #if defined(GESTURES_STANDALONE)
@@ -124,6 +128,7 @@ Vector2 GetGestureDragVector(void);                     // Get gesture drag vect
 float GetGestureDragAngle(void);                        // Get gesture drag angle
 Vector2 GetGesturePinchVector(void);                    // Get gesture pinch delta
 float GetGesturePinchAngle(void);                       // Get gesture pinch angle
+Vector2 GetGestureMultiDragVector(void);                // Get gesture multi points drag vector (3 or more points)
 #endif
 
 #ifdef __cplusplus
@@ -170,6 +175,7 @@ float GetGesturePinchAngle(void);                       // Get gesture pinch ang
 #define TAP_TIMEOUT             300         // Time in milliseconds
 #define PINCH_TIMEOUT           300         // Time in milliseconds
 #define DOUBLETAP_RANGE         0.03f       // Measured in normalized screen units (0.0f to 1.0f)
+#define GESTURE_MOVE_EPSILON    0.0005f     // Measured in normalized screen units, closer moves are skipped
 
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
@@ -212,12 +218,22 @@ static double swipeTime = 0.0;                  // SWIPE time to calculate drag
 // Pinch gesture variables
 static Vector2 pinchVector = { 0.0f , 0.0f };   // PINCH vector (between first and second touch points)
 static float pinchAngle = 0.0f;                 // PINCH angle (relative to x-axis)
-static float pinchDistance = 0.0f;              // PINCH displacement distance (normalized [0..1])
+static float pinchDistanceSqr = 0.0f;           // PINCH squared distance between points on previous move (normalized [0..1])
+static bool pinchAngleRequired = false;         // PINCH angle computed on request from pinch vector
+
+// Multi points gesture variables (3 or more touch points)
+static Vector2 multiDownCentroid = { 0.0f, 0.0f };  // Touch points centroid on touch down
+static float multiDownSpread = 0.0f;                // Touch points spread on touch down (root mean square distance to centroid)
+static Vector2 multiDragVector = { 0.0f, 0.0f };    // Touch points centroid displacement since touch down
+
+// Move events decimation variables
+static Vector2 lastMovePositions[MAX_GESTURE_POINTS] = { 0 };   // Last processed move positions
+static int lastMoveCount = 0;                   // Last processed move points count (0 if no move processed since touch down/up)
 
 static int currentGesture = GESTURE_NONE;       // Current detected gesture
 
 // Enabled gestures flags, all gestures enabled by default
-static unsigned int enabledGestures = 0b0000001111111111;
+static unsigned int enabledGestures = 0b0000011111111111;
 
 //----------------------------------------------------------------------------------
 // Module specific Functions Declaration
@@ -227,6 +243,7 @@ static unsigned int enabledGestures = 0b0000001111111111;
 static float Vector2Angle(Vector2 initialPosition, Vector2 finalPosition);
 static float Vector2Distance(Vector2 v1, Vector2 v2);
 #endif
+static float GetDistanceSqr(Vector2 v1, Vector2 v2);   // Calculate squared distance between two points
 static double GetCurrentTime(void);
 
 //----------------------------------------------------------------------------------
@@ -250,8 +267,27 @@ bool IsGestureDetected(int gesture)
 void ProcessGestureEvent(GestureEvent event)
 {
     // Reset required variables
+    if (event.pointCount > MAX_GESTURE_POINTS) event.pointCount = MAX_GESTURE_POINTS;
     pointCount = event.pointCount;      // Required on UpdateGestures()
 
+    // Skip redundant move events, positions closer than GESTURE_MOVE_EPSILON to last processed move
+    // NOTE: High rate touch digitizers report many moves per frame with (almost) same positions
+    if (event.touchAction == TOUCH_MOVE)
+    {
+        bool moved = (event.pointCount != lastMoveCount);
+
+        for (int i = 0; !moved && (i < event.pointCount); i++)
+        {
+            if (GetDistanceSqr(lastMovePositions[i], event.position[i]) > GESTURE_MOVE_EPSILON*GESTURE_MOVE_EPSILON) moved = true;
+        }
+
+        if (!moved) return;
+
+        lastMoveCount = event.pointCount;
+        for (int i = 0; i < event.pointCount; i++) lastMovePositions[i] = event.position[i];
+    }
+    else lastMoveCount = 0;
+
     if (pointCount < 2)
     {
         if (event.touchAction == TOUCH_DOWN)
@@ -259,7 +295,7 @@ void ProcessGestureEvent(GestureEvent event)
             tapCounter++;    // Tap counter
 
             // Detect GESTURE_DOUBLE_TAP
-            if ((currentGesture == GESTURE_NONE) && (tapCounter >= 2) && ((GetCurrentTime() - eventTime) < TAP_TIMEOUT) && (Vector2Distance(touchDownPosition, event.position[0]) < DOUBLETAP_RANGE))
+            if ((currentGesture == GESTURE_NONE) && (tapCounter >= 2) && ((GetCurrentTime() - eventTime) < TAP_TIMEOUT) && (GetDistanceSqr(touchDownPosition, event.position[0]) < DOUBLETAP_RANGE*DOUBLETAP_RANGE))
             {
                 currentGesture = GESTURE_DOUBLETAP;
                 tapCounter = 0;
@@ -333,7 +369,7 @@ void ProcessGestureEvent(GestureEvent event)
                 resetHold = false;
 
                 // Detect GESTURE_DRAG
-                if (Vector2Distance(touchDownPosition, moveDownPosition) >= MINIMUM_DRAG)
+                if (GetDistanceSqr(touchDownPosition, moveDownPosition) >= MINIMUM_DRAG*MINIMUM_DRAG)
                 {
                     eventTime = GetCurrentTime();
                     currentGesture = GESTURE_DRAG;
@@ -344,15 +380,13 @@ void ProcessGestureEvent(GestureEvent event)
             dragVector.y = moveDownPosition.y - touchDownDragPosition.y;
         }
     }
-    else    // Two touch points
+    else if (pointCount == 2)   // Two touch points
     {
         if (event.touchAction == TOUCH_DOWN)
         {
             touchDownPosition = event.position[0];
             touchDownPosition2 = event.position[1];
 
-            //pinchDistance = Vector2Distance(touchDownPosition, touchDownPosition2);
-
             pinchVector.x = touchDownPosition2.x - touchDownPosition.x;
             pinchVector.y = touchDownPosition2.y - touchDownPosition.y;
 
@@ -361,7 +395,8 @@ void ProcessGestureEvent(GestureEvent event)
         }
         else if (event.touchAction == TOUCH_MOVE)
         {
-            pinchDistance = Vector2Distance(moveDownPosition, moveDownPosition2);
+            // NOTE: Squared distances compared, same result without square roots on every move
+            pinchDistanceSqr = GetDistanceSqr(moveDownPosition, moveDownPosition2);
 
             touchDownPosition = moveDownPosition;
             touchDownPosition2 = moveDownPosition2;
@@ -372,9 +407,9 @@ void ProcessGestureEvent(GestureEvent event)
             pinchVector.x = moveDownPosition2.x - moveDownPosition.x;
             pinchVector.y = moveDownPosition2.y - moveDownPosition.y;
 
-            if ((Vector2Distance(touchDownPosition, moveDownPosition) >= MINIMUM_PINCH) || (Vector2Distance(touchDownPosition2, moveDownPosition2) >= MINIMUM_PINCH))
+            if ((GetDistanceSqr(touchDownPosition, moveDownPosition) >= MINIMUM_PINCH*MINIMUM_PINCH) || (GetDistanceSqr(touchDownPosition2, moveDownPosition2) >= MINIMUM_PINCH*MINIMUM_PINCH))
             {
-                if ((Vector2Distance(moveDownPosition, moveDownPosition2) - pinchDistance) < 0) currentGesture = GESTURE_PINCH_IN;
+                if ((GetDistanceSqr(moveDownPosition, moveDownPosition2) - pinchDistanceSqr) < 0) currentGesture = GESTURE_PINCH_IN;
                 else currentGesture = GESTURE_PINCH_OUT;
             }
             else
@@ -383,21 +418,85 @@ void ProcessGestureEvent(GestureEvent event)
                 timeHold = GetCurrentTime();
             }
 
-            // NOTE: Angle should be inverted in Y
-            pinchAngle = 360.0f - Vector2Angle(moveDownPosition, moveDownPosition2);
+            // NOTE: Pinch angle computed on GetGesturePinchAngle() from pinchVector
+            pinchAngleRequired = true;
         }
         else if (event.touchAction == TOUCH_UP)
         {
-            pinchDistance = 0.0f;
+            pinchDistanceSqr = 0.0f;
             pinchAngle = 0.0f;
+            pinchAngleRequired = false;
             pinchVector = (Vector2){ 0.0f, 0.0f };
             pointCount = 0;
 
+            currentGesture = GESTURE_NONE;
+        }
+    }
+    else    // Three or more touch points, points centroid and spread (root mean square distance to centroid) are tracked
+    {
+        Vector2 centroid = { 0.0f, 0.0f };
+        for (int i = 0; i < pointCount; i++) { centroid.x += event.position[i].x; centroid.y += event.position[i].y; }
+        centroid.x /= (float)pointCount;
+        centroid.y /= (float)pointCount;
+
+        float spreadSqr = 0.0f;
+        for (int i = 0; i < pointCount; i++) spreadSqr += GetDistanceSqr(centroid, event.position[i]);
+        spreadSqr /= (float)pointCount;
+
+        if (event.touchAction == TOUCH_DOWN)
+        {
+            multiDownCentroid = centroid;
+            multiDownSpread = sqrtf(spreadSqr);
+            multiDragVector = (Vector2){ 0.0f, 0.0f };
+
+            currentGesture = GESTURE_HOLD;
+            timeHold = GetCurrentTime();
+        }
+        else if (event.touchAction == TOUCH_MOVE)
+        {
+            float spreadDelta = sqrtf(spreadSqr) - multiDownSpread;
+
+            multiDragVector.x = centroid.x - multiDownCentroid.x;
+            multiDragVector.y = centroid.y - multiDownCentroid.y;
+
+            float dragSqr = multiDragVector.x*multiDragVector.x + multiDragVector.y*multiDragVector.y;
+
+            // Fingers spreading or closing more than moving together is a pinch, otherwise a multi points drag
+            if ((fabsf(spreadDelta) >= MINIMUM_PINCH) && (spreadDelta*spreadDelta >= dragSqr))
+            {
+                if (spreadDelta < 0) currentGesture = GESTURE_PINCH_IN;
+                else currentGesture = GESTURE_PINCH_OUT;
+            }
+            else if (dragSqr >= MINIMUM_DRAG*MINIMUM_DRAG) currentGesture = GESTURE_MULTI_DRAG;
+            else if (currentGesture != GESTURE_HOLD)
+            {
+                currentGesture = GESTURE_HOLD;
+                timeHold = GetCurrentTime();
+            }
+        }
+        else if (event.touchAction == TOUCH_UP)
+        {
+            multiDragVector = (Vector2){ 0.0f, 0.0f };
+            pointCount = 0;
+
             currentGesture = GESTURE_NONE;
         }
     }
 }
 
+// Process gesture events batch (i.e. events queued during a frame)
+// NOTE: Consecutive move events with same points count are coalesced, only latest positions are processed
+void ProcessGestureEvents(const GestureEvent *events, int count)
+{
+    for (int i = 0; i < count; i++)
+    {
+        if ((events[i].touchAction == TOUCH_MOVE) && (i + 1 < count) &&
+            (events[i + 1].touchAction == TOUCH_MOVE) && (events[i + 1].pointCount == events[i].pointCount)) continue;
+
+        ProcessGestureEvent(events[i]);
+    }
+}
+
 // Update gestures detected (must be called every frame)
 void UpdateGestures(void)
 {
@@ -481,11 +580,24 @@ Vector2 GetGesturePinchVector(void)
 // NOTE: Angle in degrees, horizontal-right is 0, counterclock-wise
 float GetGesturePinchAngle(void)
 {
-    // NOTE: pinch angle is calculated on two touch points TOUCH_MOVE
+    // NOTE: pinch angle is calculated from two touch points TOUCH_MOVE, only when requested
+    if (pinchAngleRequired)
+    {
+        // NOTE: Angle should be inverted in Y
+        pinchAngle = 360.0f - Vector2Angle(moveDownPosition, moveDownPosition2);
+        pinchAngleRequired = false;
+    }
 
     return pinchAngle;
 }
 
+// Get multi points drag vector (centroid displacement since touch down)
+// NOTE: Only calculated on three or more touch points TOUCH_MOVE
+Vector2 GetGestureMultiDragVector(void)
+{
+    return multiDragVector;
+}
+
 //----------------------------------------------------------------------------------
 // Module specific Functions Definition
 //----------------------------------------------------------------------------------
@@ -514,6 +626,15 @@ static float Vector2Distance(Vector2 v1, Vector2 v2)
 }
 #endif
 
+// Calculate squared distance between two points (no square root, enough to compare distances)
+static float GetDistanceSqr(Vector2 v1, Vector2 v2)
+{
+    float dx = v2.x - v1.x;
+    float dy = v2.y - v1.y;
+
+    return (dx*dx + dy*dy);
+}
+
 // Time measure returned are milliseconds
 static double GetCurrentTime(void)
 {
@@ -8,6 +8,7 @@
 *   #define SUPPORT_FILEFORMAT_MTL
 *   #define SUPPORT_FILEFORMAT_IQM
 *   #define SUPPORT_FILEFORMAT_GLTF
+*   #define SUPPORT_FILEFORMAT_RLMESH
 *       Selected desired fileformats to be supported for model data loading.
 *
 *   #define SUPPORT_MESH_GENERATION
@@ -36,6 +37,7 @@
 *
 **********************************************************************************************/
 
+#define RL_MEMORY_TAG   MEMORY_TAG_MODELS   // Module allocations subsystem (GetMemoryStats())
 #include "raylib.h"         // Declares module functions
 
 // Check if config flags have been externally provided on compilation line
@@ -49,9 +51,19 @@
 #include <stdlib.h>         // Required for: malloc(), free()
 #include <string.h>         // Required for: strcmp()
 #include <math.h>           // Required for: sin(), cos()
+#include <float.h>          // Required for: FLT_MAX
 
 #include "rlgl.h"           // raylib OpenGL abstraction layer to OpenGL 1.1, 2.1, 3.3+ or ES2
 
+// SIMD instructions used on CPU skinning (UpdateModelAnimation()) and batched collision checks
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 1))
+    #include <xmmintrin.h>      // Required for: SSE intrinsics
+    #define MODELS_SIMD_SSE
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+    #include <arm_neon.h>       // Required for: NEON intrinsics
+    #define MODELS_SIMD_NEON
+#endif
+
 #if defined(SUPPORT_FILEFORMAT_OBJ) || defined(SUPPORT_FILEFORMAT_MTL)
     #define TINYOBJ_LOADER_C_IMPLEMENTATION
     #include "external/tinyobj_loader_c.h"      // OBJ/MTL file formats loading
@@ -63,6 +75,16 @@
     #include "external/stb_image.h"     // glTF texture images loading
 #endif
 
+// Memory-mapped files support (LoadGLTF(), LoadRLMesh())
+// NOTE: Android assets and web virtual filesystem are not regular files, file data is read instead
+#if (defined(SUPPORT_FILEFORMAT_GLTF) || defined(SUPPORT_FILEFORMAT_RLMESH)) && (defined(__unix__) || defined(__APPLE__)) && !defined(PLATFORM_ANDROID) && !defined(PLATFORM_WEB)
+    #include <sys/mman.h>       // Required for: mmap(), munmap()
+    #include <sys/stat.h>       // Required for: fstat()
+    #include <fcntl.h>          // Required for: open()
+    #include <unistd.h>         // Required for: close()
+    #define SUPPORT_FILE_MAPPING
+#endif
+
 #if defined(SUPPORT_MESH_GENERATION)
     #define PAR_SHAPES_IMPLEMENTATION
     #include "external/par_shapes.h"    // Shapes 3d parametric generation
@@ -71,30 +93,530 @@
 //----------------------------------------------------------------------------------
 // Defines and Macros
 //----------------------------------------------------------------------------------
-#define MAX_MESH_VBO    7               // Maximum number of vbo per mesh
+#define MAX_MESH_VBO    9               // Maximum number of vbo per mesh
+#define MAX_MESH_BOUNDS_CACHE   256     // Maximum number of meshes bounding boxes cached for culling
+#define MAX_TRANSPARENT_QUEUE  4096     // Maximum number of transparent draws deferred until EndMode3D()
+#define MIN_SKINNING_JOB_VERTICES 2048  // Minimum number of vertices skinned by a worker job (CPU skinning)
+#define DEFAULT_ANIMATION_FRAMERATE 30.0f   // Animation frame rate if not provided by file (GetModelAnimationPose())
+#define MAX_ANIMATION_KEY_INTERVAL  256     // Maximum number of frames between compressed animation keyframes (CompressModelAnimation())
+
+#define SQRT1_2     0.70710678f         // Rotations smallest-three quantization range: [-1/sqrt(2), 1/sqrt(2)]
+
+#define MAX_BVH_DEPTH            64     // Maximum mesh BVH depth (queries traversal stack size)
+#define MIN_BVH_LEAF_TRIANGLES    2     // Mesh BVH nodes with less triangles are not split
+#define MAX_BVH_LEAF_TRIANGLES    8     // Mesh BVH nodes with more triangles are always split (if possible)
+#define BVH_SAH_BINS             12     // Mesh BVH split candidates by axis (binned SAH)
+
+#define MESH_LRU_CACHE_SIZE      32     // Mesh vertex cache optimization simulated LRU cache size (vertices scoring)
+#define MESH_FIFO_CACHE_SIZE     16     // Mesh GPU post-transform vertex cache simulated size (FIFO), overdraw clusters and stats
+#define MESH_VERTEX_ARRAYS        8     // Mesh vertex attributes arrays welded: positions, texcoords, texcoords2, normals, tangents, colors, bone ids and weights
+
+#define MAX_TERRAIN_CHUNK_CELLS   128   // Maximum terrain chunk cells per side (full detail mesh vertices fit 16bit indices)
+#define MAX_TERRAIN_CHUNK_LOADS    16   // Maximum terrain chunks heights loaded by streaming round (worker job)
+#define TERRAIN_MIN_LOD_CELLS       4   // Terrain chunks coarsest LOD cells per side
+#define TERRAIN_UNLOAD_DISTANCE_SCALE   1.25f   // Terrain chunks unloaded further than view distance scaled (hysteresis)
+
+// Terrain chunk edges stitched to coarser neighbour chunk
+#define TERRAIN_STITCH_MIN_X        1
+#define TERRAIN_STITCH_MAX_X        2
+#define TERRAIN_STITCH_MIN_Z        4
+#define TERRAIN_STITCH_MAX_Z        8
+
+#define MAX_HEIGHTFIELD_LEVELS     32   // Maximum heightfield min/max hierarchy levels (cells groups double per level)
+
+#define MAX_CUBICMAP_CHUNK_SIZE    64   // Maximum cubicmap chunk cells per side (worst case chunk mesh vertices fit 16bit indices)
+#define MAX_TILEMAP_CHUNK_SIZE     64   // Maximum tile map chunk tiles per side (chunk mesh vertices fit 16bit indices)
+
+#define STATIC_BATCH_CHUNK_VERTICES 16384   // Static batch merged meshes vertices (spatial chunks culled separately, fit 16bit indices)
+
+#define MAX_SPATIAL_QUERY_STACK 256     // Maximum spatial index query traversal stack size (tree is balanced)
+#define MIN_SPATIAL_JOB_RAYS     64     // Minimum number of rays queried by a worker job (QuerySpatialRays())
+
+#define OBJ_STREAM_CHUNK_SIZE   (4*1024*1024)   // OBJ file text parsed by every job on every stream round
+#define OBJ_RELATIVE_INDEX      (-0x40000000)   // OBJ negative face indices base, resolved once previous chunks are merged
+#define MAX_OBJ_MESH_VERTICES   65535           // Maximum vertices by OBJ mesh (16bit indices), bigger meshes are split
+#define MAX_GEN_MESH_VERTICES   65535           // Maximum vertices by indexed generated mesh (16bit indices), bigger meshes are not indexed
+#define MAX_OBJ_JOB_TRIANGLES   131072          // Maximum triangles welded by a worker job (OBJ loading)
+#define OBJ_WELD_TABLE_SIZE     131072          // OBJ vertices welding hash table size (power of two, >2x mesh vertices)
+
+#define GLTF_OWNED_VERTICES     1       // glTF mesh vertices allocated by loader (otherwise pointing into file buffers)
+#define GLTF_OWNED_NORMALS      2       // glTF mesh normals allocated by loader
+#define GLTF_OWNED_TEXCOORDS    4       // glTF mesh texcoords allocated by loader
+#define GLTF_OWNED_INDICES      8       // glTF mesh indices allocated by loader
+
+#define RLMESH_FILE_VERSION     1       // rlmesh file format version
+#define RLMESH_DATA_ALIGNMENT   16      // rlmesh meshes data blocks alignment in file
+#define RLMESH_ARRAYS_COUNT     9       // rlmesh mesh data block arrays: vertex attributes, indices, BVH nodes and triangles
+#define RLMESH_COMPRESSION_NONE 0       // rlmesh mesh data block stored uncompressed (used in place)
+#define RLMESH_COMPRESSION_LZ4  1       // rlmesh mesh data block stored as a LZ4 block
+
+// rlmesh mesh data block arrays stored (RLMeshFileMesh.attributes)
+#define RLMESH_VERTICES         1
+#define RLMESH_TEXCOORDS        2
+#define RLMESH_TEXCOORDS2       4
+#define RLMESH_NORMALS          8
+#define RLMESH_TANGENTS         16
+#define RLMESH_COLORS           32
+#define RLMESH_INDICES          64
+#define RLMESH_BVH              128
 
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
-// ...
+// Mesh bounding box cache entry, identified by mesh vertex data
+typedef struct MeshBoundsEntry {
+    const float *vertices;      // Mesh vertex data the bounds were computed from
+    int vertexCount;            // Mesh vertex count the bounds were computed from
+    BoundingBox bounds;         // Mesh bounding box (local space)
+} MeshBoundsEntry;
+
+// Parametric surface point generation function (GenMeshParametric())
+// NOTE: u, v in [0..1] range, params are shape specific, normal must be normalized
+typedef void (*MeshSurfaceFunc)(float u, float v, const float *params, float *position, float *normal);
+
+// Procedural mesh cache entry (GenMeshCached()), identified by shape parameters
+typedef struct MeshCacheEntry {
+    int shape;                  // Mesh shape type (MeshShapeType)
+    float radius;               // Shape radius
+    float size;                 // Shape size (height for cylinder)
+    int segments;               // Shape segments (rings for spheres, slices for cylinder)
+    int sides;                  // Shape sides (slices for spheres, not used for cylinder)
+    int refCount;               // Number of references to mesh
+    Mesh mesh;                  // Shared mesh
+} MeshCacheEntry;
+
+// Mesh triangles cluster, reordered to reduce overdraw (MeshOptimize())
+typedef struct MeshCluster {
+    float key;                  // Cluster sort key: centroid distance to mesh center along cluster normal
+    int start;                  // First cluster triangle
+    int count;                  // Number of triangles
+} MeshCluster;
+
+// Mesh half-edge collapse candidate (GenMeshSimplified())
+typedef struct MeshCollapse {
+    float cost;                 // Collapse error (squared distance to merged vertices planes)
+    int from;                   // Vertex collapsed
+    int to;                     // Vertex collapsed into
+} MeshCollapse;
+
+// Model level of detail chain (Model.lods)
+typedef struct ModelLODs {
+    int levelCount;             // Number of LOD levels (full detail model meshes not included)
+    Mesh *meshes;               // LOD meshes, level l meshes start at (l - 1)*model.meshCount
+    float *errors;              // LOD levels simplification error (model space distance)
+    BoundingBox bounds;         // Model meshes bounds (LOD selection view depth)
+} ModelLODs;
+
+// Terrain chunk streaming state
+typedef enum { TERRAIN_CHUNK_EMPTY = 0, TERRAIN_CHUNK_LOADING, TERRAIN_CHUNK_RESIDENT } TerrainChunkState;
+
+// Terrain chunk, heights kept in RAM and current LOD mesh in VRAM while resident
+typedef struct TerrainChunk {
+    int state;                  // Streaming state (TerrainChunkState)
+    float *heights;             // Full detail heights with one sample border ((chunkCells + 3)^2)
+    float minHeight;            // Minimum chunk height (culling bounds)
+    float maxHeight;            // Maximum chunk height (culling bounds)
+    float distance;             // Distance to view on last update
+    int targetLod;              // LOD selected on last update
+    int lod;                    // Mesh LOD (-1 if no mesh)
+    int stitch;                 // Mesh edges stitched to coarser neighbours (TERRAIN_STITCH_* flags)
+    Mesh mesh;                  // Chunk mesh (GPU data only)
+} TerrainChunk;
+
+// Terrain internal data (Terrain.terrainData)
+typedef struct TerrainData {
+    TiledImage heightmap;       // Heights source (not owned)
+    float heightScale;          // Heights scale (terrain size.y)
+    int chunkCells;             // Chunk cells per side
+    int chunksX;                // Number of chunks along X
+    int chunksZ;                // Number of chunks along Z
+    TerrainChunk *chunks;       // Chunks array (chunksX*chunksZ)
+    int loadChunks[MAX_TERRAIN_CHUNK_LOADS];        // Chunks being loaded, nearest first
+    float *loadHeights[MAX_TERRAIN_CHUNK_LOADS];    // Chunks heights loaded (worker job output)
+    int loadCount;              // Number of chunks being loaded
+    int pending;                // Streaming job pending counter
+} TerrainData;
+
+// Heightfield min/max heights hierarchy (Heightfield.levelsData)
+// NOTE: Level 0 stores cells bounds, every next level groups 2x2 cells of previous level
+typedef struct HeightfieldLevels {
+    int levelCount;                             // Number of levels (last level is a single group)
+    int levelWidth[MAX_HEIGHTFIELD_LEVELS];     // Groups along X by level
+    int levelLength[MAX_HEIGHTFIELD_LEVELS];    // Groups along Z by level
+    float *bounds[MAX_HEIGHTFIELD_LEVELS];      // Groups min/max heights pairs by level
+} HeightfieldLevels;
+
+// Cubicmap chunk faces merged into rectangles (greedy meshing)
+typedef enum {
+    CUBICMAP_FACE_WALL = 0,     // Wall top and bottom
+    CUBICMAP_FACE_FLOOR,        // Floor and ceiling
+    CUBICMAP_FACE_POS_X,        // Wall side facing +X
+    CUBICMAP_FACE_NEG_X,        // Wall side facing -X
+    CUBICMAP_FACE_POS_Z,        // Wall side facing +Z
+    CUBICMAP_FACE_NEG_Z         // Wall side facing -Z
+} CubicmapFace;
+
+// Cubicmap faces rectangle (cells)
+typedef struct CubicmapRect {
+    int x, z;                   // Rectangle first cell
+    int width, height;          // Rectangle cells along X and Z
+    int face;                   // Rectangle faces (CubicmapFace)
+} CubicmapRect;
+
+// Cubicmap internal data (Cubicmap.cubicmapData)
+typedef struct CubicmapData {
+    unsigned char *cells;       // Cells type (CubicmapCellType), width*height
+    int chunksX;                // Number of chunks along X
+    int chunksZ;                // Number of chunks along Z
+    Mesh *chunks;               // Chunks meshes (no faces if vertexCount is 0)
+    bool *dirty;                // Chunks to rebuild on next draw
+} CubicmapData;
+
+// Tile map chunk, one quad by tile (empty tiles are degenerated quads), so a tile change only updates its vertices
+typedef struct TileMapChunk {
+    Mesh mesh;                  // Chunk mesh (not loaded if vertexCount is 0, chunks without tiles are loaded on first tile)
+    int tileCount;              // Number of not empty tiles
+    int dirtyStart;             // First chunk tile changed since last upload (-1 if none)
+    int dirtyEnd;               // Last chunk tile changed since last upload
+} TileMapChunk;
+
+// Tile map internal data (TileMap.tileMapData)
+typedef struct TileMapData {
+    int *tiles;                 // Tiles index (-1 for empty tile), width*height
+    int chunksX;                // Number of chunks along X
+    int chunksY;                // Number of chunks along Y
+    TileMapChunk *chunks;       // Chunks meshes and changed tiles
+    Material material;          // Default material, tileset as diffuse map
+} TileMapData;
+
+// Static batch mesh instance (added, not built yet)
+typedef struct StaticBatchInstance {
+    Mesh mesh;                  // Instance mesh (CPU data referenced until built)
+    Matrix transform;           // Instance transform (world space)
+    int material;               // Instance material index (StaticBatch.materials)
+    unsigned int code;          // Instance bounds center spatial code (Morton order, building only)
+} StaticBatchInstance;
+
+// Static batch internal data (StaticBatch.batchData)
+typedef struct StaticBatchData {
+    StaticBatchInstance *instances; // Instances added since last build
+    int instanceCount;          // Number of instances added
+    int instanceCapacity;       // Instances array capacity
+} StaticBatchData;
+
+// Transparent queue item type
+typedef enum { TRANSPARENT_MESH = 0, TRANSPARENT_BILLBOARD } TransparentItemType;
+
+// Transparent queue item, deferred draw sorted by view depth
+typedef struct TransparentItem {
+    int type;                   // Item type: mesh or billboard (TransparentItemType)
+    unsigned int stateKey;      // Render state key (shader and texture), groups draws with same depth
+    Color tint;                 // Mesh diffuse color (premultiplied by tint) or billboard tint
+    Mesh mesh;                  // Mesh to draw (TRANSPARENT_MESH)
+    Material material;          // Mesh material (TRANSPARENT_MESH), maps are referenced, not copied
+    Matrix transform;           // Mesh transform (TRANSPARENT_MESH)
+    unsigned int textureId;     // Billboard texture id (TRANSPARENT_BILLBOARD)
+    float vertices[4*3];        // Billboard quad corners (TRANSPARENT_BILLBOARD)
+    float texcoords[4*2];       // Billboard quad texcoords (TRANSPARENT_BILLBOARD)
+} TransparentItem;
+
+// Transparent queue, items are sorted back-to-front on flush
+typedef struct TransparentQueue {
+    bool active;                // Queue is open, DrawModelEx()/DrawBillboardRec() calls are deferred
+    int count;                  // Number of items queued
+    TransparentItem *items;     // Items queued (MAX_TRANSPARENT_QUEUE)
+    float *depths;              // Items view depth (distance to camera)
+    unsigned int *keys;         // Radix sort keys (2 buffers)
+    unsigned int *order;        // Radix sort items indices (2 buffers)
+} TransparentQueue;
+
+// CPU skinning job, skins a range of mesh vertices
+typedef struct SkinningJob {
+    Mesh *mesh;                 // Mesh to skin (animated vertex data is updated)
+    const float *palette;       // Bones matrices, column-major (16 floats per bone)
+    int boneCount;              // Number of bones in palette
+    int start;                  // First vertex to skin
+    int end;                    // Last vertex to skin (not included)
+} SkinningJob;
+
+// Compressed animation track type, every bone has three tracks
+typedef enum { ANIMATION_TRACK_TRANSLATION = 0, ANIMATION_TRACK_ROTATION, ANIMATION_TRACK_SCALE } AnimationTrackType;
+
+// Compressed animation track, bone translation, rotation or scale keyframes
+// NOTE: Translation/scale keyframes are quantized to 16 bit in track range, rotations smallest-three quantized (48 bit)
+typedef struct AnimationTrack {
+    int keyCount;               // Number of keyframes (1: constant track, value not quantized)
+    unsigned int *keyFrames;    // Keyframes frame index (ascending, first and last frames are always keyframes)
+    unsigned short *keyValues;  // Keyframes quantized values (3 per keyframe)
+    Vector3 offset;             // Quantization range minimum (translation, scale)
+    Vector3 range;              // Quantization range size (translation, scale)
+    Quaternion constant;        // Constant track value (vectors stored in xyz)
+} AnimationTrack;
+
+// Compressed animation data (ModelAnimation.tracks)
+typedef struct AnimationTracks {
+    AnimationTrack *tracks;     // Bones tracks (translation, rotation and scale by bone)
+    unsigned int *keyFrames;    // Keyframes frame indices (all tracks)
+    unsigned short *keyValues;  // Keyframes quantized values (all tracks)
+} AnimationTracks;
+
+// Mesh BVH node, inner nodes children are stored consecutively
+typedef struct MeshBVHNode {
+    Vector3 min;                // Node bounds minimum vertex (mesh space)
+    Vector3 max;                // Node bounds maximum vertex (mesh space)
+    int start;                  // Leaf node: first triangle, inner node: first child node
+    int count;                  // Leaf node: number of triangles, inner node: 0
+} MeshBVHNode;
+
+// Mesh bounding volume hierarchy (Mesh.bvh)
+typedef struct MeshBVH {
+    int nodeCount;              // Number of nodes (root node first)
+    MeshBVHNode *nodes;         // Nodes array
+    int triangleCount;          // Number of triangles
+    Vector3 *triangles;         // Triangles vertices sorted by leaf (3 vertices per triangle)
+} MeshBVH;
+
+// Spatial index tree node (leaves are entries)
+typedef struct SpatialNode {
+    BoundingBox bounds;         // Node bounds (leaves: entry box enlarged by margin)
+    BoundingBox entryBox;       // Entry box (leaves)
+    int parent;                 // Parent node (free nodes: next free node)
+    int child1;                 // First child node (-1 for leaves)
+    int child2;                 // Second child node (-1 for leaves)
+    int height;                 // Node height (leaves: 0, free nodes: -1)
+    int userId;                 // Entry user id (leaves)
+} SpatialNode;
+
+// Spatial index dynamic bounding boxes tree (SpatialIndex.treeData)
+typedef struct SpatialTree {
+    SpatialNode *nodes;         // Nodes array, entries ids are leaves nodes indices
+    int capacity;               // Nodes array capacity
+    int nodeCount;              // Number of nodes used
+    int root;                   // Root node (-1 if empty)
+    int freeList;               // First free node (-1 if no free nodes)
+    float margin;               // Entries boxes enlargement (avoids tree updates on small movements)
+} SpatialTree;
+
+// Spatial index rays query job, nearest entry by ray for a range of rays
+typedef struct SpatialRaysJob {
+    const SpatialTree *tree;    // Tree queried
+    const Ray *rays;            // Rays array
+    float maxDistance;          // Maximum hit distance along rays
+    int *userIds;               // Nearest entries user ids by ray (output)
+    float *distances;           // Nearest entries distances by ray (output, optional)
+    int start;                  // First ray to query
+    int end;                    // Last ray to query (not included)
+} SpatialRaysJob;
+
+// OBJ loading growable array
+typedef struct OBJArray {
+    void *data;                 // Elements data
+    int count;                  // Number of elements
+    int capacity;               // Elements capacity
+} OBJArray;
+
+// OBJ loading text chunk parsing job (complete lines)
+typedef struct OBJChunkJob {
+    const char *text;           // Chunk text
+    int length;                 // Chunk text length
+    OBJArray positions;         // Vertices positions parsed (3 floats)
+    OBJArray texcoords;         // Vertices texcoords parsed (2 floats, y flipped)
+    OBJArray normals;           // Vertices normals parsed (3 floats)
+    OBJArray triangles;         // Triangles parsed (3 corners: position, texcoord and normal indices)
+    OBJArray materials;         // Material changes (2 ints: first triangle, name offset in chunk text)
+    int mtllib;                 // Materials library name offset in chunk text (-1 if not found)
+} OBJChunkJob;
+
+// OBJ loading vertices welding job (same material triangles range)
+typedef struct OBJMeshJob {
+    const OBJArray *positions;  // File vertices positions
+    const OBJArray *texcoords;  // File vertices texcoords
+    const OBJArray *normals;    // File vertices normals
+    const int *triangles;       // File triangles corners indices
+    const int *order;           // Triangles sorted by material
+    int start;                  // First sorted triangle to weld
+    int end;                    // Last sorted triangle to weld (not included)
+    int material;               // Triangles material
+    OBJArray meshes;            // Indexed meshes generated (output)
+} OBJMeshJob;
+
+// Model file data (glTF, rlmesh), memory-mapped if possible
+typedef struct MappedFileData {
+    void *data;                 // File data
+    size_t size;                // File data size
+    bool mapped;                // File data is memory-mapped (otherwise allocated)
+    bool packed;                // File data is owned by mounted pack (used in place)
+} MappedFileData;
+
+// rlmesh file format (raylib binary mesh cache, little-endian):
+//   RLMeshFileHeader
+//   RLMeshFileMap[materialCount*mapCount]  Materials maps color and value (textures are not stored)
+//   RLMeshFileMesh[meshCount]              Meshes info
+//   Meshes data blocks (RLMESH_DATA_ALIGNMENT aligned, optionally LZ4 compressed), arrays in file order:
+//     vertices, texcoords, texcoords2, normals, tangents, colors, indices (4 bytes aligned), BVH nodes, BVH triangles
+typedef struct RLMeshFileHeader {
+    char id[4];                 // File identifier: "rMSH"
+    unsigned int version;       // File format version (RLMESH_FILE_VERSION)
+    unsigned int meshCount;     // Number of meshes
+    unsigned int materialCount; // Number of materials
+    unsigned int mapCount;      // Number of maps by material
+    unsigned int reserved[3];   // Reserved for future use
+} RLMeshFileHeader;
+
+// rlmesh material map
+typedef struct RLMeshFileMap {
+    unsigned char color[4];     // Map color (RGBA)
+    float value;                // Map value
+} RLMeshFileMap;
+
+// rlmesh mesh info
+typedef struct RLMeshFileMesh {
+    unsigned int vertexCount;   // Number of vertices
+    unsigned int triangleCount; // Number of triangles
+    unsigned int attributes;    // Arrays stored in data block (RLMESH_* flags)
+    unsigned int material;      // Mesh material index
+    float bounds[6];            // Mesh bounding box (min and max vertices)
+    unsigned int bvhNodeCount;  // Number of BVH nodes (RLMESH_BVH)
+    unsigned int bvhTriangleCount;  // Number of BVH triangles (RLMESH_BVH)
+    unsigned int compression;   // Data block compression (RLMESH_COMPRESSION_*)
+    unsigned int dataOffset;    // Data block offset in file
+    unsigned int dataSize;      // Data block size in file
+    unsigned int dataRawSize;   // Data block size uncompressed
+} RLMeshFileMesh;
 
 //----------------------------------------------------------------------------------
 // Global Variables Definition
 //----------------------------------------------------------------------------------
-// ...
+static bool modelCulling = true;    // Skip meshes outside view frustum on DrawModel()/DrawModelEx()
+static float modelLODThreshold = 1.0f;  // Maximum model LOD simplification error on screen (pixels)
+static bool modelKeepMeshData = false;  // Keep glTF and rlmesh meshes data in RAM (CPU) after GPU upload
+static int modelMeshFormat = MESH_FORMAT_DEFAULT;   // Loaded models meshes vertex attributes GPU storage formats
+static MeshBoundsEntry meshBoundsCache[MAX_MESH_BOUNDS_CACHE] = { 0 };  // Meshes bounding boxes (direct-mapped by vertex data)
+static TransparentQueue transparentQueue = { 0 };   // Transparent draws deferred until EndMode3D()
+#if defined(SUPPORT_MESH_GENERATION)
+static MeshCacheEntry *meshCache = NULL;    // Procedural meshes shared by shape parameters (GenMeshCached())
+static int meshCacheCount = 0;              // Procedural meshes cache entries count
+static int meshCacheCapacity = 0;           // Procedural meshes cache entries allocated
+#endif
 
 //----------------------------------------------------------------------------------
 // Module specific Functions Declaration
 //----------------------------------------------------------------------------------
 #if defined(SUPPORT_FILEFORMAT_OBJ)
 static Model LoadOBJ(const char *fileName);     // Load OBJ mesh data
+static void *PushOBJArray(OBJArray *array, int count, int size);    // Add elements to OBJ parsing array
+static int GetOBJNameIndex(OBJArray *names, const char *name);      // Get OBJ name index (added if not found)
+static const char *ParseOBJFloat(const char *text, float *value);   // Parse OBJ float value
+static const char *ParseOBJIndex(const char *text, int chunkCount, int *index);    // Parse OBJ face vertex attribute index
+static void OBJChunkJobRun(void *data);         // Worker job: parse OBJ text chunk
+static void OBJMeshJobRun(void *data);          // Worker job: weld OBJ triangles range vertices into indexed meshes
+static Mesh GenOBJMesh(const float *vertices, const float *texcoords, const float *normals, int vertexCount, const unsigned short *indices, int indexCount);  // Generate OBJ indexed mesh
 #endif
 #if defined(SUPPORT_FILEFORMAT_IQM)
 static Model LoadIQM(const char *fileName);     // Load IQM mesh data
 #endif
 #if defined(SUPPORT_FILEFORMAT_GLTF)
 static Model LoadGLTF(const char *fileName);    // Load GLTF mesh data
+static const unsigned char *GetGLTFAccessorPointer(const cgltf_accessor *accessor);  // Get glTF accessor data in buffer
+static float *LoadGLTFAccessorFloats(const cgltf_accessor *accessor, int components, bool *owned);     // Load glTF accessor floats (in place if packed)
+static void UnindexGLTFMesh(Mesh *mesh, unsigned char *owned, const cgltf_accessor *indices);  // Unindex glTF mesh vertex data
+static void KeepGLTFMeshData(Mesh *mesh, unsigned char owned);    // Copy glTF mesh data pointing into file buffers
+#endif
+#if defined(SUPPORT_FILEFORMAT_RLMESH)
+static Model LoadRLMesh(const char *fileName);  // Load rlmesh file data (binary mesh cache)
+static bool ExportRLMesh(const char *fileName, const Mesh *meshes, int meshCount, const Material *materials, int materialCount, const int *meshMaterial, bool compressed);  // Export meshes to rlmesh file
+static unsigned long long GetRLMeshArraysSizes(const RLMeshFileMesh *info, unsigned long long *sizes);    // Get rlmesh data block arrays sizes
+#endif
+#if defined(SUPPORT_FILEFORMAT_GLTF) || defined(SUPPORT_FILEFORMAT_RLMESH)
+static bool LoadMappedFileData(const char *fileName, MappedFileData *file);    // Load model file data (memory-mapped if possible)
+static void UnloadMappedFileData(MappedFileData file);     // Unload model file data
 #endif
+static MeshBoundsEntry *GetMeshBoundsEntry(const float *vertices);  // Get mesh bounds cache entry for vertex data
+static bool IsMeshVisible(Mesh mesh, Matrix transform);   // Check mesh cached bounding box against view frustum
+static TransparentItem *AddTransparentItem(int type, Vector3 position);  // Add item to transparent queue (NULL if not open or full)
+static void SortTransparentQueue(void);                 // Sort transparent queue back-to-front (radix sort)
+static void UpdateModelsPoses(const Model *models, const Transform *const *poses, const int *boneCounts, int count);   // Skin models poses on CPU (worker threads)
+static Transform LerpTransform(Transform t1, Transform t2, float amount);   // Interpolate transforms (rotation slerp, shortest path)
+static Quaternion GetTrackPoseValue(Transform pose, int type);                  // Get animation track value for a bone pose
+static float GetTrackValueError(int type, Quaternion v1, Quaternion v2);        // Get error between animation track values
+static Quaternion LerpTrackValue(int type, Quaternion v1, Quaternion v2, float amount);   // Interpolate animation track values
+static void EncodeTrackValue(const AnimationTrack *track, int type, Quaternion value, unsigned short *encoded);  // Quantize animation track value
+static Quaternion DecodeTrackValue(const AnimationTrack *track, int type, const unsigned short *encoded);       // Dequantize animation track value
+static int CompressAnimationTrack(Transform **framePoses, int frameCount, int bone, int type, float tolerance, AnimationTrack *track);   // Compress bone animation track
+static Quaternion SampleAnimationTrack(const AnimationTrack *track, int type, float position);   // Sample animation track at frame position
+static Transform SampleAnimationBone(const AnimationTracks *data, int bone, float position);    // Sample compressed animation bone at frame position
+static const Transform *GetAnimationFramePose(ModelAnimation anim, int frame, Transform *buffer);  // Get animation frame pose (decompressed into buffer if required)
+static void SkinningJobRun(void *data);                 // Worker job: skin mesh vertices range on CPU (up to 4 bones by vertex)
+static int GetMeshTriangleCount(Mesh mesh);             // Get mesh triangles count (indexed or not)
+static void GetMeshTriangle(Mesh mesh, int index, Vector3 *triangle);  // Get mesh triangle vertices
+static void BuildMeshBVHNode(MeshBVH *bvh, int index, int *order, const float *bounds, const float *centroids, int start, int count, int depth);  // Build mesh BVH node (binned SAH split)
+static float GetBoxArea(const float *min, const float *max);            // Get box surface area
+static void UnloadMeshBVH(Mesh *mesh);                  // Unload mesh BVH data
+static void LoadMeshBoundsBVH(Mesh *mesh, BoundingBox bounds);  // Load mesh bounds-only BVH (root node, no triangles)
+static int SimulateMeshVertexCache(const unsigned short *indices, int indexCount, int vertexCount, unsigned char *triangleMisses);  // Simulate GPU vertex cache, returns cache misses
+static float GetMeshVertexCacheScore(int cachePosition, int liveTriangles);    // Get vertex score for vertex cache optimization
+static void OptimizeMeshVertexCache(unsigned short *indices, int indexCount, int vertexCount);  // Reorder triangles for vertex cache efficiency
+static int CompareMeshClusters(const void *a, const void *b);  // Compare mesh overdraw clusters by sort key
+static void OptimizeMeshOverdraw(unsigned short *indices, int indexCount, const float *vertices, int vertexCount);  // Reorder triangles clusters to reduce overdraw
+static int WeldMeshVertices(const Mesh *mesh, int *remap);  // Weld mesh duplicated vertices, returns unique vertices count
+static void RemapMeshVertices(Mesh *mesh, const int *remap, int newCount);     // Remap mesh vertex arrays
+static int SimplifyMeshIndices(unsigned short *indices, int indexCount, const float *vertices, int vertexCount, int targetCount, float *error);  // Simplify mesh indices (quadric error edge collapse)
+static int CompareMeshCollapses(const void *a, const void *b);  // Compare mesh collapses by error
+static int GetModelLODLevel(Model model, Matrix transform);     // Get model LOD level to draw with transform (screen-space error)
+static void UnloadModelLODs(Model *model);              // Unload model LODs meshes
+static Mesh GenTerrainChunkMesh(Terrain terrain, int index, int lod, int stitch);  // Generate terrain chunk mesh at LOD (edges stitched)
+static void LoadTerrainChunksJob(void *data);           // Worker job: load terrain chunks heights requested
+static unsigned char *LoadCubicmapCells(Image cubicmap);  // Load cubicmap cells type from image pixels
+static int GenCubicmapRects(unsigned char *mask, int width, int height, bool mergeX, bool mergeZ, int face, CubicmapRect *rects);  // Merge mask cells into rectangles (greedy), mask is cleared
+static Mesh GenCubicmapMesh(const unsigned char *cells, int width, int height, Vector3 cubeSize, int originX, int originZ, int sizeX, int sizeZ);  // Generate cubicmap region mesh (CPU data only)
+static void UpdateCubicmapChunk(Cubicmap cubicmap, int index);  // Rebuild cubicmap chunk mesh (uploaded to GPU)
+static void AddCubicmapFace(Mesh *mesh, const Vector3 *corners, Vector3 normal, Vector3 cubeSize);  // Add cubicmap quad face to mesh (corners in cells units)
+static void UpdateTileMapChunk(TileMap map, int index);     // Upload tile map chunk changed tiles (chunk mesh loaded on first upload)
+static void SetTileMapQuad(TileMap map, Mesh *mesh, int quad, int x, int y);    // Set tile map chunk mesh quad vertex data for tile
+static int GetStaticBatchMaterial(StaticBatch *batch, Material material);  // Get static batch material index (added if not found)
+static void AddStaticBatchChunk(StaticBatch *batch, const StaticBatchInstance *instances, int count);  // Merge instances (same material) into world space mesh
+static int CompareStaticBatchInstances(const void *a, const void *b);  // Compare static batch instances by material and spatial code
+static unsigned int GetMortonCode(Vector3 position, BoundingBox bounds);  // Get position spatial code inside bounds (Morton order, 10 bits by axis)
+static bool GetRayBoxDistance(Vector3 origin, Vector3 invDir, Vector3 min, Vector3 max, float maxDistance, float *distance);  // Get ray entry distance into box
+static void GetHeightfieldGroupBox(Heightfield heightfield, int level, int x, int z, Vector3 *min, Vector3 *max);  // Get heightfield hierarchy group bounding box
+#if defined(SUPPORT_MESH_GENERATION)
+static Mesh GenMeshParametric(MeshSurfaceFunc func, const float *params, int slices, int stacks, bool poles, int extraVertices, int extraTriangles);  // Generate parametric surface indexed mesh (CPU data only)
+static void AddGenMeshTriangle(Mesh *mesh, bool wide, int a, int b, int c);     // Add generated mesh triangle indices (16bit or 32bit)
+static void UploadGeneratedMesh(Mesh *mesh);    // Upload generated mesh, not indexed if too many vertices for 16bit indices
+static void GetSphereSurfacePoint(float u, float v, const float *params, float *position, float *normal);      // Get sphere surface point (MeshSurfaceFunc)
+static void GetCylinderSurfacePoint(float u, float v, const float *params, float *position, float *normal);    // Get cylinder surface point (MeshSurfaceFunc)
+static void GetTorusSurfacePoint(float u, float v, const float *params, float *position, float *normal);       // Get torus surface point (MeshSurfaceFunc)
+static void GetKnotSurfacePoint(float u, float v, const float *params, float *position, float *normal);        // Get trefoil knot surface point (MeshSurfaceFunc)
+#endif
+static BoundingBox TransformBoundingBox(BoundingBox box, Matrix transform);  // Get bounding box of transformed box
+static BoundingBox GetSphereBoundingBox(Vector3 center, float radius);  // Get sphere bounding box
+static Vector3 GetClosestPointTriangle(Vector3 point, Vector3 p1, Vector3 p2, Vector3 p3);  // Get closest point on triangle to point
+static void GetCollisionSphereTriangle(Vector3 center, Vector3 p1, Vector3 p2, Vector3 p3, RayHitInfo *result);  // Update sphere collision info with triangle
+static void GetCollisionBoxTriangle(Vector3 center, Vector3 extents, Vector3 p1, Vector3 p2, Vector3 p3, RayHitInfo *result);  // Update box collision info with triangle
+static int AllocateSpatialNode(SpatialTree *tree);      // Allocate spatial tree node
+static void FreeSpatialNode(SpatialTree *tree, int id);  // Free spatial tree node
+static bool IsSpatialEntryValid(const void *treeData, int entry);   // Check spatial tree entry id is a valid leaf
+static BoundingBox GetBoxesUnion(BoundingBox box1, BoundingBox box2);   // Get union of bounding boxes
+static float GetBoundingBoxArea(BoundingBox box);       // Get bounding box surface area
+static void InsertSpatialLeaf(SpatialTree *tree, int leaf);     // Insert leaf node in spatial tree
+static void RemoveSpatialLeaf(SpatialTree *tree, int leaf);     // Remove leaf node from spatial tree
+static void RefitSpatialTree(SpatialTree *tree, int index);     // Update spatial tree nodes up to root (balanced)
+static int BalanceSpatialNode(SpatialTree *tree, int index);    // Balance spatial tree node (rotation)
+static int QuerySpatialTree(const SpatialTree *tree, bool (*check)(BoundingBox box, const void *shape), const void *shape, int minEntry, int *userIds, int maxCount);  // Query spatial tree entries
+static bool CheckSpatialBox(BoundingBox box, const void *shape);        // Check spatial query box overlap
+static bool CheckSpatialSphere(BoundingBox box, const void *shape);     // Check spatial query sphere overlap
+static bool CheckSpatialRay(BoundingBox box, const void *shape);        // Check spatial query ray crossing
+static bool CheckSpatialFrustum(BoundingBox box, const void *shape);    // Check spatial query frustum visibility
+static void SpatialRaysJobRun(void *data);              // Worker job: query nearest spatial entries for a range of rays
+static int StoreBatchHits(int start, unsigned int mask, unsigned int *hitMask, int *hitIndices, int hitCount);  // Store batched collision checks hits
+#if defined(MODELS_SIMD_NEON)
+static unsigned int GetLanesMask(uint32x4_t lanes);     // Get NEON comparison lanes as bits mask
+#endif
+
+//----------------------------------------------------------------------------------
+// Module Functions Declaration (used by other modules)
+//----------------------------------------------------------------------------------
+void FlushTransparentQueue(void);                       // [Module: core] Draw transparent queue items, called on EndMode3D()
 
 //----------------------------------------------------------------------------------
 // Module Functions Definition
@@ -154,6 +676,63 @@ void DrawCube(Vector3 position, float width, float height, float length, Color c
     float y = 0.0f;
     float z = 0.0f;
 
+    // NOTE: Vertices are directly scaled on definition, submitted in bulk (rlVertex3fv())
+    const float vertices[36*3] = {
+        // Front face
+        x - width/2, y - height/2, z + length/2,  // Bottom Left
+        x + width/2, y - height/2, z + length/2,  // Bottom Right
+        x - width/2, y + height/2, z + length/2,  // Top Left
+
+        x + width/2, y + height/2, z + length/2,  // Top Right
+        x - width/2, y + height/2, z + length/2,  // Top Left
+        x + width/2, y - height/2, z + length/2,  // Bottom Right
+
+        // Back face
+        x - width/2, y - height/2, z - length/2,  // Bottom Left
+        x - width/2, y + height/2, z - length/2,  // Top Left
+        x + width/2, y - height/2, z - length/2,  // Bottom Right
+
+        x + width/2, y + height/2, z - length/2,  // Top Right
+        x + width/2, y - height/2, z - length/2,  // Bottom Right
+        x - width/2, y + height/2, z - length/2,  // Top Left
+
+        // Top face
+        x - width/2, y + height/2, z - length/2,  // Top Left
+        x - width/2, y + height/2, z + length/2,  // Bottom Left
+        x + width/2, y + height/2, z + length/2,  // Bottom Right
+
+        x + width/2, y + height/2, z - length/2,  // Top Right
+        x - width/2, y + height/2, z - length/2,  // Top Left
+        x + width/2, y + height/2, z + length/2,  // Bottom Right
+
+        // Bottom face
+        x - width/2, y - height/2, z - length/2,  // Top Left
+        x + width/2, y - height/2, z + length/2,  // Bottom Right
+        x - width/2, y - height/2, z + length/2,  // Bottom Left
+
+        x + width/2, y - height/2, z - length/2,  // Top Right
+        x + width/2, y - height/2, z + length/2,  // Bottom Right
+        x - width/2, y - height/2, z - length/2,  // Top Left
+
+        // Right face
+        x + width/2, y - height/2, z - length/2,  // Bottom Right
+        x + width/2, y + height/2, z - length/2,  // Top Right
+        x + width/2, y + height/2, z + length/2,  // Top Left
+
+        x + width/2, y - height/2, z + length/2,  // Bottom Left
+        x + width/2, y - height/2, z - length/2,  // Bottom Right
+        x + width/2, y + height/2, z + length/2,  // Top Left
+
+        // Left face
+        x - width/2, y - height/2, z - length/2,  // Bottom Right
+        x - width/2, y + height/2, z + length/2,  // Top Left
+        x - width/2, y + height/2, z - length/2,  // Top Right
+
+        x - width/2, y - height/2, z + length/2,  // Bottom Left
+        x - width/2, y + height/2, z + length/2,  // Top Left
+        x - width/2, y - height/2, z - length/2   // Bottom Right
+    };
+
     if (rlCheckBufferLimit(36)) rlglDraw();
 
     rlPushMatrix();
@@ -165,59 +744,7 @@ void DrawCube(Vector3 position, float width, float height, float length, Color c
         rlBegin(RL_TRIANGLES);
             rlColor4ub(color.r, color.g, color.b, color.a);
 
-            // Front face
-            rlVertex3f(x - width/2, y - height/2, z + length/2);  // Bottom Left
-            rlVertex3f(x + width/2, y - height/2, z + length/2);  // Bottom Right
-            rlVertex3f(x - width/2, y + height/2, z + length/2);  // Top Left
-
-            rlVertex3f(x + width/2, y + height/2, z + length/2);  // Top Right
-            rlVertex3f(x - width/2, y + height/2, z + length/2);  // Top Left
-            rlVertex3f(x + width/2, y - height/2, z + length/2);  // Bottom Right
-
-            // Back face
-            rlVertex3f(x - width/2, y - height/2, z - length/2);  // Bottom Left
-            rlVertex3f(x - width/2, y + height/2, z - length/2);  // Top Left
-            rlVertex3f(x + width/2, y - height/2, z - length/2);  // Bottom Right
-
-            rlVertex3f(x + width/2, y + height/2, z - length/2);  // Top Right
-            rlVertex3f(x + width/2, y - height/2, z - length/2);  // Bottom Right
-            rlVertex3f(x - width/2, y + height/2, z - length/2);  // Top Left
-
-            // Top face
-            rlVertex3f(x - width/2, y + height/2, z - length/2);  // Top Left
-            rlVertex3f(x - width/2, y + height/2, z + length/2);  // Bottom Left
-            rlVertex3f(x + width/2, y + height/2, z + length/2);  // Bottom Right
-
-            rlVertex3f(x + width/2, y + height/2, z - length/2);  // Top Right
-            rlVertex3f(x - width/2, y + height/2, z - length/2);  // Top Left
-            rlVertex3f(x + width/2, y + height/2, z + length/2);  // Bottom Right
-
-            // Bottom face
-            rlVertex3f(x - width/2, y - height/2, z - length/2);  // Top Left
-            rlVertex3f(x + width/2, y - height/2, z + length/2);  // Bottom Right
-            rlVertex3f(x - width/2, y - height/2, z + length/2);  // Bottom Left
-
-            rlVertex3f(x + width/2, y - height/2, z - length/2);  // Top Right
-            rlVertex3f(x + width/2, y - height/2, z + length/2);  // Bottom Right
-            rlVertex3f(x - width/2, y - height/2, z - length/2);  // Top Left
-
-            // Right face
-            rlVertex3f(x + width/2, y - height/2, z - length/2);  // Bottom Right
-            rlVertex3f(x + width/2, y + height/2, z - length/2);  // Top Right
-            rlVertex3f(x + width/2, y + height/2, z + length/2);  // Top Left
-
-            rlVertex3f(x + width/2, y - height/2, z + length/2);  // Bottom Left
-            rlVertex3f(x + width/2, y - height/2, z - length/2);  // Bottom Right
-            rlVertex3f(x + width/2, y + height/2, z + length/2);  // Top Left
-
-            // Left face
-            rlVertex3f(x - width/2, y - height/2, z - length/2);  // Bottom Right
-            rlVertex3f(x - width/2, y + height/2, z + length/2);  // Top Left
-            rlVertex3f(x - width/2, y + height/2, z - length/2);  // Top Right
-
-            rlVertex3f(x - width/2, y - height/2, z + length/2);  // Bottom Left
-            rlVertex3f(x - width/2, y + height/2, z + length/2);  // Top Left
-            rlVertex3f(x - width/2, y - height/2, z - length/2);  // Bottom Right
+            rlVertex3fv(vertices, 36);
         rlEnd();
     rlPopMatrix();
 }
@@ -388,27 +915,30 @@ void DrawSphereEx(Vector3 centerPos, float radius, int rings, int slices, Color
 
             for (int i = 0; i < (rings + 2); i++)
             {
+                // Ring trigonometry computed once per ring, vertex submitted in bulk per slice
+                float ringCos0 = cosf(DEG2RAD*(270+(180/(rings + 1))*i));
+                float ringSin0 = sinf(DEG2RAD*(270+(180/(rings + 1))*i));
+                float ringCos1 = cosf(DEG2RAD*(270+(180/(rings + 1))*(i+1)));
+                float ringSin1 = sinf(DEG2RAD*(270+(180/(rings + 1))*(i+1)));
+
                 for (int j = 0; j < slices; j++)
                 {
-                    rlVertex3f(cosf(DEG2RAD*(270+(180/(rings + 1))*i))*sinf(DEG2RAD*(j*360/slices)),
-                               sinf(DEG2RAD*(270+(180/(rings + 1))*i)),
-                               cosf(DEG2RAD*(270+(180/(rings + 1))*i))*cosf(DEG2RAD*(j*360/slices)));
-                    rlVertex3f(cosf(DEG2RAD*(270+(180/(rings + 1))*(i+1)))*sinf(DEG2RAD*((j+1)*360/slices)),
-                               sinf(DEG2RAD*(270+(180/(rings + 1))*(i+1))),
-                               cosf(DEG2RAD*(270+(180/(rings + 1))*(i+1)))*cosf(DEG2RAD*((j+1)*360/slices)));
-                    rlVertex3f(cosf(DEG2RAD*(270+(180/(rings + 1))*(i+1)))*sinf(DEG2RAD*(j*360/slices)),
-                               sinf(DEG2RAD*(270+(180/(rings + 1))*(i+1))),
-                               cosf(DEG2RAD*(270+(180/(rings + 1))*(i+1)))*cosf(DEG2RAD*(j*360/slices)));
-
-                    rlVertex3f(cosf(DEG2RAD*(270+(180/(rings + 1))*i))*sinf(DEG2RAD*(j*360/slices)),
-                               sinf(DEG2RAD*(270+(180/(rings + 1))*i)),
-                               cosf(DEG2RAD*(270+(180/(rings + 1))*i))*cosf(DEG2RAD*(j*360/slices)));
-                    rlVertex3f(cosf(DEG2RAD*(270+(180/(rings + 1))*(i)))*sinf(DEG2RAD*((j+1)*360/slices)),
-                               sinf(DEG2RAD*(270+(180/(rings + 1))*(i))),
-                               cosf(DEG2RAD*(270+(180/(rings + 1))*(i)))*cosf(DEG2RAD*((j+1)*360/slices)));
-                    rlVertex3f(cosf(DEG2RAD*(270+(180/(rings + 1))*(i+1)))*sinf(DEG2RAD*((j+1)*360/slices)),
-                               sinf(DEG2RAD*(270+(180/(rings + 1))*(i+1))),
-                               cosf(DEG2RAD*(270+(180/(rings + 1))*(i+1)))*cosf(DEG2RAD*((j+1)*360/slices)));
+                    float sliceSin0 = sinf(DEG2RAD*(j*360/slices));
+                    float sliceCos0 = cosf(DEG2RAD*(j*360/slices));
+                    float sliceSin1 = sinf(DEG2RAD*((j+1)*360/slices));
+                    float sliceCos1 = cosf(DEG2RAD*((j+1)*360/slices));
+
+                    const float vertices[6*3] = {
+                        ringCos0*sliceSin0, ringSin0, ringCos0*sliceCos0,
+                        ringCos1*sliceSin1, ringSin1, ringCos1*sliceCos1,
+                        ringCos1*sliceSin0, ringSin1, ringCos1*sliceCos0,
+
+                        ringCos0*sliceSin0, ringSin0, ringCos0*sliceCos0,
+                        ringCos0*sliceSin1, ringSin0, ringCos0*sliceCos1,
+                        ringCos1*sliceSin1, ringSin1, ringCos1*sliceCos1
+                    };
+
+                    rlVertex3fv(vertices, 6);
                 }
             }
         rlEnd();
@@ -658,6 +1188,9 @@ Model LoadModel(const char *fileName)
 #if defined(SUPPORT_FILEFORMAT_GLTF)
     if (IsFileExtension(fileName, ".gltf") || IsFileExtension(fileName, ".glb")) model = LoadGLTF(fileName);
 #endif
+#if defined(SUPPORT_FILEFORMAT_RLMESH)
+    if (IsFileExtension(fileName, ".rlmesh")) model = LoadRLMesh(fileName);
+#endif
 
     // Make sure model transform is set to identity matrix!
     model.transform = MatrixIdentity();
@@ -676,7 +1209,15 @@ Model LoadModel(const char *fileName)
     else
     {
         // Upload vertex data to GPU (static mesh)
-        for (int i = 0; i < model.meshCount; i++) rlLoadMesh(&model.meshes[i], false);
+        // NOTE: Meshes already uploaded by loader (glTF) are skipped
+        for (int i = 0; i < model.meshCount; i++)
+        {
+            if ((model.meshes[i].vaoId == 0) && (model.meshes[i].vboId[0] == 0))
+            {
+                model.meshes[i].vertexFormat = modelMeshFormat;
+                rlLoadMesh(&model.meshes[i], false);
+            }
+        }
     }
 
     if (model.materialCount == 0)
@@ -717,9 +1258,37 @@ Model LoadModelFromMesh(Mesh mesh)
     return model;
 }
 
+// Load model from files shared with previous loads of same file (not modified since)
+// NOTE: Cached models should be unloaded with UnloadModelCached(), data is unloaded with last reference
+Model LoadModelCached(const char *fileName)
+{
+    Model *cached = (Model *)AcquireCachedAsset(ASSET_MODEL, fileName, NULL);
+
+    if (cached != NULL) return *cached;
+
+    Model model = LoadModel(fileName);
+
+    if (model.meshes != NULL) AddCachedAsset(ASSET_MODEL, fileName, NULL, &model, sizeof(Model), (unsigned long long)(size_t)model.meshes, NULL);
+
+    return model;
+}
+
+// Release cached model reference, model is unloaded with last reference
+// NOTE: Models not cached are unloaded directly
+void UnloadModelCached(Model model)
+{
+    Model cached = { 0 };
+    int result = ReleaseCachedAsset(ASSET_MODEL, (unsigned long long)(size_t)model.meshes, &cached, sizeof(Model));
+
+    if (result == 1) UnloadModel(cached);
+    else if (result == -1) UnloadModel(model);
+}
+
 // Unload model from memory (RAM and/or VRAM)
 void UnloadModel(Model model)
 {
+    UnloadModelLODs(&model);
+
     for (int i = 0; i < model.meshCount; i++) UnloadMesh(model.meshes[i]);
 
     // As the user could be sharing shaders and textures between models,
@@ -738,6 +1307,84 @@ void UnloadModel(Model model)
     TraceLog(LOG_INFO, "Unloaded model data from RAM and VRAM");
 }
 
+// Export model meshes and materials to file (rlmesh binary mesh cache, optionally LZ4 compressed)
+// NOTE: Meshes data must be available in RAM (CPU), material textures are not exported
+void ExportModel(Model model, const char *fileName, bool compressed)
+{
+    bool success = false;
+
+#if defined(SUPPORT_FILEFORMAT_RLMESH)
+    if (IsFileExtension(fileName, ".rlmesh")) success = ExportRLMesh(fileName, model.meshes, model.meshCount, model.materials, model.materialCount, model.meshMaterial, compressed);
+#endif
+
+    if (success) TraceLog(LOG_INFO, "Model exported successfully: %s", fileName);
+    else TraceLog(LOG_WARNING, "Model could not be exported.");
+}
+
+// Generate model level of detail chain, every level keeps ratio of previous level triangles (GenMeshSimplified())
+// NOTE: Level drawn by DrawModel()/DrawModelEx() is selected by its simplification error projected on screen,
+// see SetModelLODThreshold(). Meshes data must be available in RAM (CPU), animated models are not supported
+void GenModelLODs(Model *model, int levels, float ratio)
+{
+    if ((model == NULL) || (model->meshCount <= 0) || (levels <= 0)) return;
+
+    if (model->boneCount > 0)
+    {
+        TraceLog(LOG_WARNING, "Model LODs not supported for animated models");
+        return;
+    }
+
+    for (int i = 0; i < model->meshCount; i++)
+    {
+        if (model->meshes[i].vertices == NULL)
+        {
+            TraceLog(LOG_WARNING, "Model meshes data not available in RAM (CPU), LODs can not be generated (SetModelKeepMeshData())");
+            return;
+        }
+    }
+
+    UnloadModelLODs(model);
+
+    ModelLODs *lods = (ModelLODs *)RL_CALLOC(1, sizeof(ModelLODs));
+    lods->meshes = (Mesh *)RL_CALLOC(levels*model->meshCount, sizeof(Mesh));
+    lods->errors = (float *)RL_CALLOC(levels, sizeof(float));
+    lods->bounds = MeshBoundingBox(model->meshes[0]);
+
+    for (int i = 1; i < model->meshCount; i++) lods->bounds = GetBoxesUnion(lods->bounds, MeshBoundingBox(model->meshes[i]));
+
+    int triangleCount = 0;
+    for (int i = 0; i < model->meshCount; i++) triangleCount += GetMeshTriangleCount(model->meshes[i]);
+
+    for (int level = 0; level < levels; level++)
+    {
+        const Mesh *source = (level == 0)? model->meshes : &lods->meshes[(level - 1)*model->meshCount];
+        Mesh *meshes = &lods->meshes[level*model->meshCount];
+        int levelTriangleCount = 0;
+        float levelError = 0.0f;
+
+        for (int i = 0; i < model->meshCount; i++)
+        {
+            float error = 0.0f;
+            meshes[i] = GenMeshSimplified(source[i], ratio, &error);
+
+            levelTriangleCount += meshes[i].triangleCount;
+            if (error > levelError) levelError = error;
+        }
+
+        // NOTE: Level error is accumulated, every level is simplified from previous one
+        lods->errors[level] = ((level > 0)? lods->errors[level - 1] : 0.0f) + levelError;
+        lods->levelCount++;
+
+        TraceLog(LOG_INFO, "Model LOD %i generated: %i triangles (error: %f)", level + 1, levelTriangleCount, lods->errors[level]);
+
+        // Stop once meshes can not be simplified further (borders and seams are kept)
+        if (levelTriangleCount >= triangleCount*0.95f) break;
+        triangleCount = levelTriangleCount;
+    }
+
+    model->lods = lods;
+}
+
 // Load meshes from model file
 Mesh *LoadMeshes(const char *fileName, int *meshCount)
 {
@@ -753,10 +1400,77 @@ Mesh *LoadMeshes(const char *fileName, int *meshCount)
 // Unload mesh from memory (RAM and/or VRAM)
 void UnloadMesh(Mesh mesh)
 {
+    // Invalidate cached bounding box, vertex data memory could be reused by another mesh
+    MeshBoundsEntry *entry = GetMeshBoundsEntry(mesh.vertices);
+    if ((entry != NULL) && (entry->vertices == mesh.vertices)) entry->vertices = NULL;
+
+    UnloadMeshBVH(&mesh);
+
     rlUnloadMesh(mesh);
     RL_FREE(mesh.vboId);
 }
 
+// Unload mesh vertex data from RAM (CPU), mesh is kept in VRAM (GPU) for drawing
+// NOTE: Mesh bounds are kept for culling (MeshBoundingBox()), collision queries use mesh BVH if keepCollision (built if required).
+// Skinned meshes keep vertex data required to be animated, animated vertex data is only unloaded if skinned on GPU
+void UnloadMeshCPUData(Mesh *mesh, bool keepCollision)
+{
+    if ((mesh == NULL) || (mesh->vertices == NULL)) return;
+
+    if (rlGetVersion() == OPENGL_11)
+    {
+        TraceLog(LOG_WARNING, "Mesh vertex data required in RAM (CPU) to be drawn on OpenGL 1.1, not unloaded");
+        return;
+    }
+
+    if ((mesh->vboId == NULL) || (mesh->vboId[0] == 0))
+    {
+        TraceLog(LOG_WARNING, "Mesh not uploaded to VRAM (GPU), vertex data not unloaded");
+        return;
+    }
+
+    bool skinned = (mesh->boneIds != NULL) && (mesh->boneWeights != NULL);
+    BoundingBox bounds = MeshBoundingBox(*mesh);
+
+    if (keepCollision && (mesh->bvh == NULL)) MeshBuildBVH(mesh);
+    else if (!keepCollision) UnloadMeshBVH(mesh);
+
+    // Invalidate cached bounding box, vertex data memory could be reused by another mesh
+    MeshBoundsEntry *entry = GetMeshBoundsEntry(mesh->vertices);
+    if ((entry != NULL) && (entry->vertices == mesh->vertices)) entry->vertices = NULL;
+
+    if (!skinned)
+    {
+        RL_FREE(mesh->vertices);
+        RL_FREE(mesh->normals);
+        mesh->vertices = NULL;
+        mesh->normals = NULL;
+
+        // Bounds kept in BVH root node if no collision BVH available
+        if (mesh->bvh == NULL) LoadMeshBoundsBVH(mesh, bounds);
+    }
+
+    RL_FREE(mesh->texcoords);
+    RL_FREE(mesh->texcoords2);
+    RL_FREE(mesh->tangents);
+    RL_FREE(mesh->colors);
+    RL_FREE(mesh->indices);
+    mesh->texcoords = NULL;
+    mesh->texcoords2 = NULL;
+    mesh->tangents = NULL;
+    mesh->colors = NULL;
+    mesh->indices = NULL;
+
+    // NOTE: Skinned meshes not uploaded for GPU skinning (no bone attributes) are skinned on CPU
+    if (!skinned || (mesh->vboId[7] != 0))
+    {
+        RL_FREE(mesh->animVertices);
+        RL_FREE(mesh->animNormals);
+        mesh->animVertices = NULL;
+        mesh->animNormals = NULL;
+    }
+}
+
 // Export mesh data to file
 void ExportMesh(Mesh mesh, const char *fileName)
 {
@@ -807,6 +1521,9 @@ void ExportMesh(Mesh mesh, const char *fileName)
 
         success = true;
     }
+#if defined(SUPPORT_FILEFORMAT_RLMESH)
+    else if (IsFileExtension(fileName, ".rlmesh")) success = ExportRLMesh(fileName, &mesh, 1, NULL, 0, NULL, false);
+#endif
     else if (IsFileExtension(fileName, ".raw")) { }   // TODO: Support additional file formats to export mesh vertex data
 
     if (success) TraceLog(LOG_INFO, "Mesh exported successfully: %s", fileName);
@@ -982,7 +1699,8 @@ ModelAnimation *LoadModelAnimations(const char *filename, int *animCount)
         animations[a].boneCount = iqm.num_poses;
         animations[a].bones = RL_MALLOC(iqm.num_poses*sizeof(BoneInfo));
         animations[a].framePoses = RL_MALLOC(anim[a].num_frames*sizeof(Transform *));
-        //animations[a].framerate = anim.framerate;     // TODO: Use framerate?
+        animations[a].frameRate = (anim[a].framerate > 0.0f)? anim[a].framerate : DEFAULT_ANIMATION_FRAMERATE;
+        animations[a].tracks = NULL;
 
         for (int j = 0; j < iqm.num_poses; j++)
         {
@@ -1108,74 +1826,304 @@ ModelAnimation *LoadModelAnimations(const char *filename, int *animCount)
 }
 
 // Update model animated vertex data (positions and normals) for a given frame
-// NOTE: Updated data is uploaded to GPU
+// NOTE: Updated data is uploaded to GPU, vertices are skinned on CPU (up to 4 bones by vertex)
 void UpdateModelAnimation(Model model, ModelAnimation anim, int frame)
 {
-    if ((anim.frameCount > 0) && (anim.bones != NULL) && (anim.framePoses != NULL))
+    UpdateModelsAnimation(&model, &anim, &frame, 1);
+}
+
+// Update multiple models animated vertex data for given frames (one animation and frame per model)
+// NOTE: Bones matrices are computed once per model, meshes vertices are skinned on worker threads (SetWorkerThreads())
+// and uploaded to GPU by calling thread
+void UpdateModelsAnimation(const Model *models, const ModelAnimation *anims, const int *frames, int count)
+{
+    if ((models == NULL) || (anims == NULL) || (frames == NULL) || (count <= 0)) return;
+
+    BeginProfileZone("UpdateModelsAnimation");
+
+    const Transform **poses = (const Transform **)RL_CALLOC(count, sizeof(Transform *));
+    int *boneCounts = (int *)RL_CALLOC(count, sizeof(int));
+
+    // Compressed animations frames are decompressed into a shared pose buffer
+    int bufferSize = 0;
+    for (int i = 0; i < count; i++) if (anims[i].framePoses == NULL) bufferSize += anims[i].boneCount;
+
+    Transform *buffer = (Transform *)RL_MALLOC(((bufferSize > 0)? bufferSize : 1)*sizeof(Transform));
+    int bufferOffset = 0;
+
+    for (int i = 0; i < count; i++)
+    {
+        if ((anims[i].frameCount <= 0) || (anims[i].bones == NULL) || ((anims[i].framePoses == NULL) && (anims[i].tracks == NULL))) continue;
+
+        int frame = (frames[i] >= anims[i].frameCount)? frames[i]%anims[i].frameCount : frames[i];
+
+        poses[i] = GetAnimationFramePose(anims[i], frame, buffer + bufferOffset);
+        boneCounts[i] = anims[i].boneCount;
+
+        if (anims[i].framePoses == NULL) bufferOffset += anims[i].boneCount;
+    }
+
+    UpdateModelsPoses(models, poses, boneCounts, count);
+
+    RL_FREE(buffer);
+    RL_FREE(boneCounts);
+    RL_FREE(poses);
+    EndProfileZone();
+}
+
+// Update model animation bones matrices for a given frame, meshes are skinned on GPU when drawn
+// NOTE: Models drawn with default shader use GetShaderSkinning() shader, custom shaders must skin vertices
+// (vertexBoneIds, vertexBoneWeights and boneMatrices). If GPU skinning is not available, meshes are skinned on CPU
+void UpdateModelAnimationBones(Model model, ModelAnimation anim, int frame)
+{
+    if ((anim.frameCount > 0) && (anim.bones != NULL) && ((anim.framePoses != NULL) || (anim.tracks != NULL)))
     {
         if (frame >= anim.frameCount) frame = frame%anim.frameCount;
 
-        for (int m = 0; m < model.meshCount; m++)
+        Transform *buffer = (anim.framePoses == NULL)? (Transform *)RL_MALLOC(anim.boneCount*sizeof(Transform)) : NULL;
+
+        UpdateModelPoseBones(model, GetAnimationFramePose(anim, frame, buffer), anim.boneCount);
+
+        RL_FREE(buffer);
+    }
+}
+
+// Get model animation pose at given time (seconds), bones transformations interpolated between keyframes
+// NOTE: pose must hold anim.boneCount transforms, time out of animation range is wrapped (loop) or clamped
+void GetModelAnimationPose(ModelAnimation anim, float time, bool loop, Transform *pose)
+{
+    if ((anim.frameCount <= 0) || ((anim.framePoses == NULL) && (anim.tracks == NULL)) || (pose == NULL)) return;
+
+    float frameRate = (anim.frameRate > 0.0f)? anim.frameRate : DEFAULT_ANIMATION_FRAMERATE;
+    float position = time*frameRate;
+
+    if (loop)
+    {
+        position = fmodf(position, (float)anim.frameCount);
+        if (position < 0.0f) position += (float)anim.frameCount;
+    }
+    else if (position < 0.0f) position = 0.0f;
+    else if (position > (float)(anim.frameCount - 1)) position = (float)(anim.frameCount - 1);
+
+    int frame = (int)position;
+    if (frame >= anim.frameCount) frame = anim.frameCount - 1;      // Float rounding on wrapped negative time
+
+    // NOTE: Looped animations interpolate last keyframe to first one
+    int nextFrame = ((frame + 1) < anim.frameCount)? (frame + 1) : (loop? 0 : frame);
+    float amount = position - (float)frame;
+
+    if (anim.framePoses != NULL)
+    {
+        for (int i = 0; i < anim.boneCount; i++) pose[i] = LerpTransform(anim.framePoses[frame][i], anim.framePoses[nextFrame][i], amount);
+    }
+    else
+    {
+        // NOTE: Compressed tracks are sampled at position, loop wrapping interpolates last and first frames samples
+        const AnimationTracks *data = (const AnimationTracks *)anim.tracks;
+
+        if (nextFrame >= frame)
+        {
+            for (int i = 0; i < anim.boneCount; i++) pose[i] = SampleAnimationBone(data, i, position);
+        }
+        else
         {
-            Vector3 animVertex = { 0 };
-            Vector3 animNormal = { 0 };
+            for (int i = 0; i < anim.boneCount; i++) pose[i] = LerpTransform(SampleAnimationBone(data, i, (float)frame), SampleAnimationBone(data, i, (float)nextFrame), amount);
+        }
+    }
+}
+
+// Blend two animation poses (cross-fade), blend 0.0f returns pose1 and 1.0f returns pose2
+// NOTE: result can be one of the input poses
+void BlendModelAnimationPoses(const Transform *pose1, const Transform *pose2, int boneCount, float blend, Transform *result)
+{
+    if ((pose1 == NULL) || (pose2 == NULL) || (result == NULL)) return;
 
-            Vector3 inTranslation = { 0 };
-            Quaternion inRotation = { 0 };
-            Vector3 inScale = { 0 };
+    for (int i = 0; i < boneCount; i++) result[i] = LerpTransform(pose1[i], pose2[i], blend);
+}
 
-            Vector3 outTranslation = { 0 };
-            Quaternion outRotation = { 0 };
-            Vector3 outScale = { 0 };
+// Add animation layer to pose, layer difference from reference pose (usually layer first frame) is applied scaled by weight
+// NOTE: Poses are model space bones transformations, result can be one of the input poses
+void AddModelAnimationPose(const Transform *pose, const Transform *additive, const Transform *reference, int boneCount, float weight, Transform *result)
+{
+    if ((pose == NULL) || (additive == NULL) || (reference == NULL) || (result == NULL)) return;
 
-            int vCounter = 0;
-            int boneCounter = 0;
-            int boneId = 0;
+    Transform identity = { Vector3Zero(), QuaternionIdentity(), Vector3One() };
 
-            for (int i = 0; i < model.meshes[m].vertexCount; i++)
-            {
-                boneId = model.meshes[m].boneIds[boneCounter];
-                inTranslation = model.bindPose[boneId].translation;
-                inRotation = model.bindPose[boneId].rotation;
-                inScale = model.bindPose[boneId].scale;
-                outTranslation = anim.framePoses[frame][boneId].translation;
-                outRotation = anim.framePoses[frame][boneId].rotation;
-                outScale = anim.framePoses[frame][boneId].scale;
+    for (int i = 0; i < boneCount; i++)
+    {
+        Transform layer = { 0 };
+
+        layer.translation = Vector3Subtract(additive[i].translation, reference[i].translation);
+        layer.rotation = QuaternionMultiply(additive[i].rotation, QuaternionInvert(reference[i].rotation));
+        layer.scale.x = (reference[i].scale.x != 0.0f)? additive[i].scale.x/reference[i].scale.x : 1.0f;
+        layer.scale.y = (reference[i].scale.y != 0.0f)? additive[i].scale.y/reference[i].scale.y : 1.0f;
+        layer.scale.z = (reference[i].scale.z != 0.0f)? additive[i].scale.z/reference[i].scale.z : 1.0f;
+
+        layer = LerpTransform(identity, layer, weight);
+
+        Transform base = pose[i];
+        result[i].translation = Vector3Add(base.translation, layer.translation);
+        result[i].rotation = QuaternionNormalize(QuaternionMultiply(layer.rotation, base.rotation));
+        result[i].scale = Vector3Multiply(base.scale, layer.scale);
+    }
+}
+
+// Get model bones transformations matrices (bone palette) for an animation pose, from model bind pose
+// NOTE: Bind pose vertex v is transformed as: rotation*(v*scale - bindTranslation) + translation,
+// where rotation = poseRotation*inverse(bindRotation), boneMatrices must hold min(model.boneCount, boneCount) matrices
+void GetModelPoseBones(Model model, const Transform *pose, int boneCount, Matrix *boneMatrices)
+{
+    if ((pose == NULL) || (boneMatrices == NULL) || (model.bindPose == NULL)) return;
+
+    if (boneCount > model.boneCount) boneCount = model.boneCount;
+
+    for (int i = 0; i < boneCount; i++)
+    {
+        Transform bind = model.bindPose[i];
+
+        Matrix matScale = MatrixScale(pose[i].scale.x, pose[i].scale.y, pose[i].scale.z);
+        Matrix matBind = MatrixTranslate(-bind.translation.x, -bind.translation.y, -bind.translation.z);
+        // NOTE: QuaternionToMatrix() result is transposed to match Vector3RotateByQuaternion() rotation
+        Matrix matRotation = MatrixTranspose(QuaternionToMatrix(QuaternionMultiply(pose[i].rotation, QuaternionInvert(bind.rotation))));
+        Matrix matTranslation = MatrixTranslate(pose[i].translation.x, pose[i].translation.y, pose[i].translation.z);
+
+        boneMatrices[i] = MatrixMultiply(MatrixMultiply(MatrixMultiply(matScale, matBind), matRotation), matTranslation);
+    }
+}
+
+// Update model animated vertex data (positions and normals) for an animation pose (GetModelAnimationPose())
+// NOTE: Updated data is uploaded to GPU, vertices are skinned on CPU (up to 4 bones by vertex)
+void UpdateModelPose(Model model, const Transform *pose, int boneCount)
+{
+    UpdateModelsPoses(&model, &pose, &boneCount, 1);
+}
+
+// Update model bones matrices for an animation pose (GetModelAnimationPose()), meshes are skinned on GPU when drawn
+// NOTE: If GPU skinning is not available, meshes are skinned on CPU (UpdateModelPose())
+void UpdateModelPoseBones(Model model, const Transform *pose, int boneCount)
+{
+    if ((pose == NULL) || (boneCount <= 0)) return;
+
+    if (boneCount > model.boneCount) boneCount = model.boneCount;
+
+    // NOTE: Model is skinned on CPU if any mesh can not be skinned on GPU (bones vertex attributes not uploaded)
+    bool gpuSkinning = (GetShaderSkinning().id > 0) && (boneCount <= MAX_SHADER_BONES);
+
+    for (int m = 0; m < model.meshCount; m++)
+    {
+        Mesh *mesh = &model.meshes[m];
+        if ((mesh->boneIds != NULL) && (mesh->boneWeights != NULL) && ((mesh->vboId == NULL) || (mesh->vboId[7] == 0))) gpuSkinning = false;
+    }
+
+    if (!gpuSkinning)
+    {
+        UpdateModelPose(model, pose, boneCount);
+        return;
+    }
+
+    Matrix *boneMatrices = (Matrix *)RL_MALLOC(boneCount*sizeof(Matrix));
+    GetModelPoseBones(model, pose, boneCount, boneMatrices);
 
-                // Vertices processing
-                // NOTE: We use meshes.vertices (default vertex position) to calculate meshes.animVertices (animated vertex position)
-                animVertex = (Vector3){ model.meshes[m].vertices[vCounter], model.meshes[m].vertices[vCounter + 1], model.meshes[m].vertices[vCounter + 2] };
-                animVertex = Vector3Multiply(animVertex, outScale);
-                animVertex = Vector3Subtract(animVertex, inTranslation);
-                animVertex = Vector3RotateByQuaternion(animVertex, QuaternionMultiply(outRotation, QuaternionInvert(inRotation)));
-                animVertex = Vector3Add(animVertex, outTranslation);
-                model.meshes[m].animVertices[vCounter] = animVertex.x;
-                model.meshes[m].animVertices[vCounter + 1] = animVertex.y;
-                model.meshes[m].animVertices[vCounter + 2] = animVertex.z;
+    for (int m = 0; m < model.meshCount; m++)
+    {
+        Mesh *mesh = &model.meshes[m];
 
-                // Normals processing
-                // NOTE: We use meshes.baseNormals (default normal) to calculate meshes.normals (animated normals)
-                animNormal = (Vector3){ model.meshes[m].normals[vCounter], model.meshes[m].normals[vCounter + 1], model.meshes[m].normals[vCounter + 2] };
-                animNormal = Vector3RotateByQuaternion(animNormal, QuaternionMultiply(outRotation, QuaternionInvert(inRotation)));
-                model.meshes[m].animNormals[vCounter] = animNormal.x;
-                model.meshes[m].animNormals[vCounter + 1] = animNormal.y;
-                model.meshes[m].animNormals[vCounter + 2] = animNormal.z;
-                vCounter += 3;
+        if ((mesh->boneIds != NULL) && (mesh->boneWeights != NULL))
+        {
+            if (mesh->boneMatrices == NULL) mesh->boneMatrices = (Matrix *)RL_MALLOC(boneCount*sizeof(Matrix));
 
-                boneCounter += 4;
+            // Mesh not skinned on GPU yet (maybe skinned on CPU), bind pose vertex data must be restored
+            if (mesh->boneCount == 0)
+            {
+                rlUpdateBuffer(mesh->vboId[0], mesh->vertices, mesh->vertexCount*3*sizeof(float));
+                if (mesh->normals != NULL) rlUpdateBuffer(mesh->vboId[2], mesh->normals, mesh->vertexCount*3*sizeof(float));
             }
 
-            // Upload new vertex data to GPU for model drawing
-            rlUpdateBuffer(model.meshes[m].vboId[0], model.meshes[m].animVertices, model.meshes[m].vertexCount*3*sizeof(float));    // Update vertex position
-            rlUpdateBuffer(model.meshes[m].vboId[2], model.meshes[m].animNormals, model.meshes[m].vertexCount*3*sizeof(float));     // Update vertex normals
+            memcpy(mesh->boneMatrices, boneMatrices, boneCount*sizeof(Matrix));
+            mesh->boneCount = boneCount;
         }
     }
+
+    RL_FREE(boneMatrices);
+}
+
+// Compress model animation data, frame poses are replaced by bones keyframes tracks
+// NOTE: Constant tracks are folded, keyframes interpolated within tolerance are removed and kept keyframes are quantized
+// (translation/scale 16 bit by component, rotation smallest-three 48 bit). Tolerance is maximum error allowed by track:
+// translation distance (world units), rotation angle (radians) and scale components
+bool CompressModelAnimation(ModelAnimation *anim, float tolerance)
+{
+    if ((anim == NULL) || (anim->framePoses == NULL) || (anim->frameCount <= 0) || (anim->boneCount <= 0)) return false;
+
+    int trackCount = anim->boneCount*3;
+    AnimationTracks *data = (AnimationTracks *)RL_CALLOC(1, sizeof(AnimationTracks));
+
+    // NOTE: Keyframes pools are allocated for worst case (all frames keyframes), shrinked once tracks are compressed
+    data->tracks = (AnimationTrack *)RL_CALLOC(trackCount, sizeof(AnimationTrack));
+    data->keyFrames = (unsigned int *)RL_MALLOC(trackCount*anim->frameCount*sizeof(unsigned int));
+    data->keyValues = (unsigned short *)RL_MALLOC(trackCount*anim->frameCount*3*sizeof(unsigned short));
+
+    int keyCount = 0;
+
+    for (int i = 0; i < trackCount; i++)
+    {
+        AnimationTrack *track = &data->tracks[i];
+        track->keyFrames = data->keyFrames + keyCount;
+        track->keyValues = data->keyValues + keyCount*3;
+        track->keyCount = CompressAnimationTrack(anim->framePoses, anim->frameCount, i/3, i%3, tolerance, track);
+
+        if (track->keyCount > 1) keyCount += track->keyCount;
+    }
+
+    // Shrink keyframes pools and update tracks pointers
+    unsigned int *keyFrames = (unsigned int *)RL_MALLOC(((keyCount > 0)? keyCount : 1)*sizeof(unsigned int));
+    unsigned short *keyValues = (unsigned short *)RL_MALLOC(((keyCount > 0)? keyCount : 1)*3*sizeof(unsigned short));
+    memcpy(keyFrames, data->keyFrames, keyCount*sizeof(unsigned int));
+    memcpy(keyValues, data->keyValues, keyCount*3*sizeof(unsigned short));
+
+    for (int i = 0; i < trackCount; i++)
+    {
+        AnimationTrack *track = &data->tracks[i];
+        track->keyFrames = keyFrames + (track->keyFrames - data->keyFrames);
+        track->keyValues = keyValues + (track->keyValues - data->keyValues);
+    }
+
+    RL_FREE(data->keyFrames);
+    RL_FREE(data->keyValues);
+    data->keyFrames = keyFrames;
+    data->keyValues = keyValues;
+
+    int uncompressedSize = anim->frameCount*(anim->boneCount*sizeof(Transform) + sizeof(Transform *));
+    int compressedSize = sizeof(AnimationTracks) + trackCount*sizeof(AnimationTrack) + keyCount*(sizeof(unsigned int) + 3*sizeof(unsigned short));
+
+    TraceLog(LOG_INFO, "Animation compressed: %i frames, %i bones, %i keyframes (%i bytes -> %i bytes)", anim->frameCount, anim->boneCount, keyCount, uncompressedSize, compressedSize);
+
+    for (int i = 0; i < anim->frameCount; i++) RL_FREE(anim->framePoses[i]);
+    RL_FREE(anim->framePoses);
+
+    anim->framePoses = NULL;
+    anim->tracks = data;
+
+    return true;
 }
 
 // Unload animation data
 void UnloadModelAnimation(ModelAnimation anim)
 {
-    for (int i = 0; i < anim.frameCount; i++) RL_FREE(anim.framePoses[i]);
+    if (anim.framePoses != NULL)
+    {
+        for (int i = 0; i < anim.frameCount; i++) RL_FREE(anim.framePoses[i]);
+    }
+
+    if (anim.tracks != NULL)
+    {
+        AnimationTracks *data = (AnimationTracks *)anim.tracks;
+
+        RL_FREE(data->tracks);
+        RL_FREE(data->keyFrames);
+        RL_FREE(data->keyValues);
+        RL_FREE(data);
+    }
 
     RL_FREE(anim.bones);
     RL_FREE(anim.framePoses);
@@ -1567,38 +2515,10 @@ par_shapes_mesh* par_shapes_create_icosahedron();       // 20 sides polyhedron
 // Generate sphere mesh (standard sphere)
 RLAPI Mesh GenMeshSphere(float radius, int rings, int slices)
 {
-    Mesh mesh = { 0 };
-    mesh.vboId = (unsigned int *)RL_CALLOC(MAX_MESH_VBO, sizeof(unsigned int));
-
-    par_shapes_mesh *sphere = par_shapes_create_parametric_sphere(slices, rings);
-    par_shapes_scale(sphere, radius, radius, radius);
-    // NOTE: Soft normals are computed internally
-
-    mesh.vertices = (float *)RL_MALLOC(sphere->ntriangles*3*3*sizeof(float));
-    mesh.texcoords = (float *)RL_MALLOC(sphere->ntriangles*3*2*sizeof(float));
-    mesh.normals = (float *)RL_MALLOC(sphere->ntriangles*3*3*sizeof(float));
-
-    mesh.vertexCount = sphere->ntriangles*3;
-    mesh.triangleCount = sphere->ntriangles;
-
-    for (int k = 0; k < mesh.vertexCount; k++)
-    {
-        mesh.vertices[k*3] = sphere->points[sphere->triangles[k]*3];
-        mesh.vertices[k*3 + 1] = sphere->points[sphere->triangles[k]*3 + 1];
-        mesh.vertices[k*3 + 2] = sphere->points[sphere->triangles[k]*3 + 2];
-
-        mesh.normals[k*3] = sphere->normals[sphere->triangles[k]*3];
-        mesh.normals[k*3 + 1] = sphere->normals[sphere->triangles[k]*3 + 1];
-        mesh.normals[k*3 + 2] = sphere->normals[sphere->triangles[k]*3 + 2];
-
-        mesh.texcoords[k*2] = sphere->tcoords[sphere->triangles[k]*2];
-        mesh.texcoords[k*2 + 1] = sphere->tcoords[sphere->triangles[k]*2 + 1];
-    }
-
-    par_shapes_free_mesh(sphere);
+    float params[2] = { radius, 2.0f*PI };
+    Mesh mesh = GenMeshParametric(GetSphereSurfacePoint, params, slices, rings, true, 0, 0);
 
-    // Upload vertex data to GPU (static mesh)
-    rlLoadMesh(&mesh, false);
+    UploadGeneratedMesh(&mesh);
 
     return mesh;
 }
@@ -1606,97 +2526,59 @@ RLAPI Mesh GenMeshSphere(float radius, int rings, int slices)
 // Generate hemi-sphere mesh (half sphere, no bottom cap)
 RLAPI Mesh GenMeshHemiSphere(float radius, int rings, int slices)
 {
-    Mesh mesh = { 0 };
-    mesh.vboId = (unsigned int *)RL_CALLOC(MAX_MESH_VBO, sizeof(unsigned int));
+    float params[2] = { radius, PI };
+    Mesh mesh = GenMeshParametric(GetSphereSurfacePoint, params, slices, rings, true, 0, 0);
 
-    par_shapes_mesh *sphere = par_shapes_create_hemisphere(slices, rings);
-    par_shapes_scale(sphere, radius, radius, radius);
-    // NOTE: Soft normals are computed internally
+    UploadGeneratedMesh(&mesh);
 
-    mesh.vertices = (float *)RL_MALLOC(sphere->ntriangles*3*3*sizeof(float));
-    mesh.texcoords = (float *)RL_MALLOC(sphere->ntriangles*3*2*sizeof(float));
-    mesh.normals = (float *)RL_MALLOC(sphere->ntriangles*3*3*sizeof(float));
+    return mesh;
+}
 
-    mesh.vertexCount = sphere->ntriangles*3;
-    mesh.triangleCount = sphere->ntriangles;
+// Generate cylinder mesh
+Mesh GenMeshCylinder(float radius, float height, int slices)
+{
+    if (slices < 3) slices = 3;
 
-    for (int k = 0; k < mesh.vertexCount; k++)
+    // Cylinder body sits on the Y=0 plane, 8 stacked rings along height
+    // NOTE: Top and bottom caps (disks) are appended after body vertices
+    float params[2] = { radius, height };
+    Mesh mesh = GenMeshParametric(GetCylinderSurfacePoint, params, slices, 8, false, 2*(slices + 1), 2*slices);
+    bool wide = ((9*(slices + 1) + 2*(slices + 1)) > MAX_GEN_MESH_VERTICES);
+
+    for (int cap = 0; cap < 2; cap++)
     {
-        mesh.vertices[k*3] = sphere->points[sphere->triangles[k]*3];
-        mesh.vertices[k*3 + 1] = sphere->points[sphere->triangles[k]*3 + 1];
-        mesh.vertices[k*3 + 2] = sphere->points[sphere->triangles[k]*3 + 2];
+        int first = mesh.vertexCount;
+        float y = (cap == 0)? height : 0.0f;
+        float ny = (cap == 0)? 1.0f : -1.0f;
+        float texcoord = (cap == 0)? 0.0f : 0.95f;      // Same caps texcoords as previous generation
 
-        mesh.normals[k*3] = sphere->normals[sphere->triangles[k]*3];
-        mesh.normals[k*3 + 1] = sphere->normals[sphere->triangles[k]*3 + 1];
-        mesh.normals[k*3 + 2] = sphere->normals[sphere->triangles[k]*3 + 2];
+        for (int i = 0; i < (slices + 1); i++)
+        {
+            // First cap vertex is disk center, disk points go around counter-clockwise seen from outside
+            float theta = (float)(i - 1)*2.0f*PI/slices;
+            float x = (i == 0)? 0.0f : radius*cosf(theta);
+            float z = (i == 0)? 0.0f : -radius*sinf(theta);
 
-        mesh.texcoords[k*2] = sphere->tcoords[sphere->triangles[k]*2];
-        mesh.texcoords[k*2 + 1] = sphere->tcoords[sphere->triangles[k]*2 + 1];
-    }
+            if (cap == 1) x = -x;
 
-    par_shapes_free_mesh(sphere);
+            mesh.vertices[(first + i)*3] = x;
+            mesh.vertices[(first + i)*3 + 1] = y;
+            mesh.vertices[(first + i)*3 + 2] = z;
 
-    // Upload vertex data to GPU (static mesh)
-    rlLoadMesh(&mesh, false);
+            mesh.normals[(first + i)*3] = 0.0f;
+            mesh.normals[(first + i)*3 + 1] = ny;
+            mesh.normals[(first + i)*3 + 2] = 0.0f;
 
-    return mesh;
-}
+            mesh.texcoords[(first + i)*2] = texcoord;
+            mesh.texcoords[(first + i)*2 + 1] = texcoord;
+        }
 
-// Generate cylinder mesh
-Mesh GenMeshCylinder(float radius, float height, int slices)
-{
-    Mesh mesh = { 0 };
-    mesh.vboId = (unsigned int *)RL_CALLOC(MAX_MESH_VBO, sizeof(unsigned int));
-
-    // Instance a cylinder that sits on the Z=0 plane using the given tessellation
-    // levels across the UV domain.  Think of "slices" like a number of pizza
-    // slices, and "stacks" like a number of stacked rings.
-    // Height and radius are both 1.0, but they can easily be changed with par_shapes_scale
-    par_shapes_mesh *cylinder = par_shapes_create_cylinder(slices, 8);
-    par_shapes_scale(cylinder, radius, radius, height);
-    par_shapes_rotate(cylinder, -PI/2.0f, (float[]){ 1, 0, 0 });
-
-    // Generate an orientable disk shape (top cap)
-    par_shapes_mesh *capTop = par_shapes_create_disk(radius, slices, (float[]){ 0, 0, 0 }, (float[]){ 0, 0, 1 });
-    capTop->tcoords = PAR_MALLOC(float, 2*capTop->npoints);
-    for (int i = 0; i < 2*capTop->npoints; i++) capTop->tcoords[i] = 0.0f;
-    par_shapes_rotate(capTop, -PI/2.0f, (float[]){ 1, 0, 0 });
-    par_shapes_translate(capTop, 0, height, 0);
-
-    // Generate an orientable disk shape (bottom cap)
-    par_shapes_mesh *capBottom = par_shapes_create_disk(radius, slices, (float[]){ 0, 0, 0 }, (float[]){ 0, 0, -1 });
-    capBottom->tcoords = PAR_MALLOC(float, 2*capBottom->npoints);
-    for (int i = 0; i < 2*capBottom->npoints; i++) capBottom->tcoords[i] = 0.95f;
-    par_shapes_rotate(capBottom, PI/2.0f, (float[]){ 1, 0, 0 });
-
-    par_shapes_merge_and_free(cylinder, capTop);
-    par_shapes_merge_and_free(cylinder, capBottom);
-
-    mesh.vertices = (float *)RL_MALLOC(cylinder->ntriangles*3*3*sizeof(float));
-    mesh.texcoords = (float *)RL_MALLOC(cylinder->ntriangles*3*2*sizeof(float));
-    mesh.normals = (float *)RL_MALLOC(cylinder->ntriangles*3*3*sizeof(float));
-
-    mesh.vertexCount = cylinder->ntriangles*3;
-    mesh.triangleCount = cylinder->ntriangles;
-
-    for (int k = 0; k < mesh.vertexCount; k++)
-    {
-        mesh.vertices[k*3] = cylinder->points[cylinder->triangles[k]*3];
-        mesh.vertices[k*3 + 1] = cylinder->points[cylinder->triangles[k]*3 + 1];
-        mesh.vertices[k*3 + 2] = cylinder->points[cylinder->triangles[k]*3 + 2];
-
-        mesh.normals[k*3] = cylinder->normals[cylinder->triangles[k]*3];
-        mesh.normals[k*3 + 1] = cylinder->normals[cylinder->triangles[k]*3 + 1];
-        mesh.normals[k*3 + 2] = cylinder->normals[cylinder->triangles[k]*3 + 2];
+        for (int i = 0; i < slices; i++) AddGenMeshTriangle(&mesh, wide, first, first + 1 + i, first + 1 + (i + 1)%slices);
 
-        mesh.texcoords[k*2] = cylinder->tcoords[cylinder->triangles[k]*2];
-        mesh.texcoords[k*2 + 1] = cylinder->tcoords[cylinder->triangles[k]*2 + 1];
+        mesh.vertexCount += (slices + 1);
     }
 
-    par_shapes_free_mesh(cylinder);
-
-    // Upload vertex data to GPU (static mesh)
-    rlLoadMesh(&mesh, false);
+    UploadGeneratedMesh(&mesh);
 
     return mesh;
 }
@@ -1704,42 +2586,14 @@ Mesh GenMeshCylinder(float radius, float height, int slices)
 // Generate torus mesh
 Mesh GenMeshTorus(float radius, float size, int radSeg, int sides)
 {
-    Mesh mesh = { 0 };
-    mesh.vboId = (unsigned int *)RL_CALLOC(MAX_MESH_VBO, sizeof(unsigned int));
-
     if (radius > 1.0f) radius = 1.0f;
     else if (radius < 0.1f) radius = 0.1f;
 
-    // Create a donut that sits on the Z=0 plane with the specified inner radius
-    // The outer radius can be controlled with par_shapes_scale
-    par_shapes_mesh *torus = par_shapes_create_torus(radSeg, sides, radius);
-    par_shapes_scale(torus, size/2, size/2, size/2);
+    // Donut sits on the Z=0 plane with the specified inner radius, outer radius is size/2
+    float params[2] = { radius, size/2 };
+    Mesh mesh = GenMeshParametric(GetTorusSurfacePoint, params, radSeg, sides, false, 0, 0);
 
-    mesh.vertices = (float *)RL_MALLOC(torus->ntriangles*3*3*sizeof(float));
-    mesh.texcoords = (float *)RL_MALLOC(torus->ntriangles*3*2*sizeof(float));
-    mesh.normals = (float *)RL_MALLOC(torus->ntriangles*3*3*sizeof(float));
-
-    mesh.vertexCount = torus->ntriangles*3;
-    mesh.triangleCount = torus->ntriangles;
-
-    for (int k = 0; k < mesh.vertexCount; k++)
-    {
-        mesh.vertices[k*3] = torus->points[torus->triangles[k]*3];
-        mesh.vertices[k*3 + 1] = torus->points[torus->triangles[k]*3 + 1];
-        mesh.vertices[k*3 + 2] = torus->points[torus->triangles[k]*3 + 2];
-
-        mesh.normals[k*3] = torus->normals[torus->triangles[k]*3];
-        mesh.normals[k*3 + 1] = torus->normals[torus->triangles[k]*3 + 1];
-        mesh.normals[k*3 + 2] = torus->normals[torus->triangles[k]*3 + 2];
-
-        mesh.texcoords[k*2] = torus->tcoords[torus->triangles[k]*2];
-        mesh.texcoords[k*2 + 1] = torus->tcoords[torus->triangles[k]*2 + 1];
-    }
-
-    par_shapes_free_mesh(torus);
-
-    // Upload vertex data to GPU (static mesh)
-    rlLoadMesh(&mesh, false);
+    UploadGeneratedMesh(&mesh);
 
     return mesh;
 }
@@ -1747,44 +2601,96 @@ Mesh GenMeshTorus(float radius, float size, int radSeg, int sides)
 // Generate trefoil knot mesh
 Mesh GenMeshKnot(float radius, float size, int radSeg, int sides)
 {
-    Mesh mesh = { 0 };
-    mesh.vboId = (unsigned int *)RL_CALLOC(MAX_MESH_VBO, sizeof(unsigned int));
-
     if (radius > 3.0f) radius = 3.0f;
     else if (radius < 0.5f) radius = 0.5f;
 
-    par_shapes_mesh *knot = par_shapes_create_trefoil_knot(radSeg, sides, radius);
-    par_shapes_scale(knot, size, size, size);
+    float params[2] = { radius, size };
+    Mesh mesh = GenMeshParametric(GetKnotSurfacePoint, params, radSeg, sides, false, 0, 0);
 
-    mesh.vertices = (float *)RL_MALLOC(knot->ntriangles*3*3*sizeof(float));
-    mesh.texcoords = (float *)RL_MALLOC(knot->ntriangles*3*2*sizeof(float));
-    mesh.normals = (float *)RL_MALLOC(knot->ntriangles*3*3*sizeof(float));
+    UploadGeneratedMesh(&mesh);
 
-    mesh.vertexCount = knot->ntriangles*3;
-    mesh.triangleCount = knot->ntriangles;
+    return mesh;
+}
 
-    for (int k = 0; k < mesh.vertexCount; k++)
+// Generate procedural mesh shared between identical shape requests
+// NOTE: Mesh is generated and uploaded once, next requests with same shape and parameters
+// reuse it (reference counted), useful to instance many primitives (i.e. level generation)
+Mesh GenMeshCached(int shape, float radius, float size, int segments, int sides)
+{
+    for (int i = 0; i < meshCacheCount; i++)
     {
-        mesh.vertices[k*3] = knot->points[knot->triangles[k]*3];
-        mesh.vertices[k*3 + 1] = knot->points[knot->triangles[k]*3 + 1];
-        mesh.vertices[k*3 + 2] = knot->points[knot->triangles[k]*3 + 2];
+        MeshCacheEntry *entry = &meshCache[i];
+
+        if ((entry->shape == shape) && (entry->radius == radius) && (entry->size == size) &&
+            (entry->segments == segments) && (entry->sides == sides))
+        {
+            entry->refCount++;
+            return entry->mesh;
+        }
+    }
 
-        mesh.normals[k*3] = knot->normals[knot->triangles[k]*3];
-        mesh.normals[k*3 + 1] = knot->normals[knot->triangles[k]*3 + 1];
-        mesh.normals[k*3 + 2] = knot->normals[knot->triangles[k]*3 + 2];
+    Mesh mesh = { 0 };
 
-        mesh.texcoords[k*2] = knot->tcoords[knot->triangles[k]*2];
-        mesh.texcoords[k*2 + 1] = knot->tcoords[knot->triangles[k]*2 + 1];
+    switch (shape)
+    {
+        case MESH_SHAPE_SPHERE: mesh = GenMeshSphere(radius, segments, sides); break;
+        case MESH_SHAPE_HEMISPHERE: mesh = GenMeshHemiSphere(radius, segments, sides); break;
+        case MESH_SHAPE_CYLINDER: mesh = GenMeshCylinder(radius, size, segments); break;
+        case MESH_SHAPE_TORUS: mesh = GenMeshTorus(radius, size, segments, sides); break;
+        case MESH_SHAPE_KNOT: mesh = GenMeshKnot(radius, size, segments, sides); break;
+        default: TraceLog(LOG_WARNING, "MESH: Procedural shape type not supported: %i", shape); return mesh;
     }
 
-    par_shapes_free_mesh(knot);
+    if (meshCacheCount >= meshCacheCapacity)
+    {
+        int capacity = (meshCacheCapacity == 0)? 16 : meshCacheCapacity*2;
+        MeshCacheEntry *cache = (MeshCacheEntry *)RL_REALLOC(meshCache, capacity*sizeof(MeshCacheEntry));
 
-    // Upload vertex data to GPU (static mesh)
-    rlLoadMesh(&mesh, false);
+        // Mesh is still valid if cache could not grow, just not shared
+        if (cache == NULL) return mesh;
+
+        meshCache = cache;
+        meshCacheCapacity = capacity;
+    }
+
+    meshCache[meshCacheCount] = (MeshCacheEntry){ shape, radius, size, segments, sides, 1, mesh };
+    meshCacheCount++;
 
     return mesh;
 }
 
+// Unload procedural mesh generated with GenMeshCached()
+// NOTE: Mesh is only unloaded from memory (RAM and VRAM) when no other reference uses it
+void UnloadMeshCached(Mesh mesh)
+{
+    for (int i = 0; i < meshCacheCount; i++)
+    {
+        if (meshCache[i].mesh.vboId != mesh.vboId) continue;
+
+        meshCache[i].refCount--;
+
+        if (meshCache[i].refCount <= 0)
+        {
+            UnloadMesh(meshCache[i].mesh);
+
+            meshCache[i] = meshCache[meshCacheCount - 1];
+            meshCacheCount--;
+
+            if (meshCacheCount == 0)
+            {
+                RL_FREE(meshCache);
+                meshCache = NULL;
+                meshCacheCapacity = 0;
+            }
+        }
+
+        return;
+    }
+
+    // Mesh not shared, generated with GenMesh*()
+    UnloadMesh(mesh);
+}
+
 // Generate a mesh from heightmap
 // NOTE: Vertex data is uploaded to GPU
 Mesh GenMeshHeightmap(Image heightmap, Vector3 size)
@@ -2256,1423 +3162,7237 @@ Mesh GenMeshCubicmap(Image cubicmap, Vector3 cubeSize)
 
     return mesh;
 }
-#endif      // SUPPORT_MESH_GENERATION
 
-// Compute mesh bounding box limits
-// NOTE: minVertex and maxVertex should be transformed by model transform matrix
-BoundingBox MeshBoundingBox(Mesh mesh)
+// Generate a cubes mesh from pixel data, coplanar faces merged into rectangles (greedy meshing), indexed
+// NOTE: Texture coordinates are in cells units (texture repeated by cell, not the GenMeshCubicmap() atlas layout),
+// walls sides facing any non-wall cell are generated. Vertex data is uploaded to GPU
+Mesh GenMeshCubicmapGreedy(Image cubicmap, Vector3 cubeSize)
 {
-    // Get min and max vertex to construct bounds (AABB)
-    Vector3 minVertex = { 0 };
-    Vector3 maxVertex = { 0 };
+    unsigned char *cells = LoadCubicmapCells(cubicmap);
 
-    if (mesh.vertices != NULL)
+    if (cells == NULL) return (Mesh){ 0 };
+
+    Mesh mesh = GenCubicmapMesh(cells, cubicmap.width, cubicmap.height, cubeSize, 0, 0, cubicmap.width, cubicmap.height);
+
+    RL_FREE(cells);
+
+    // NOTE: Mesh indices are 16bit, bigger maps must be loaded by chunks (LoadCubicmap())
+    if (mesh.vertexCount > 65536)
     {
-        minVertex = (Vector3){ mesh.vertices[0], mesh.vertices[1], mesh.vertices[2] };
-        maxVertex = (Vector3){ mesh.vertices[0], mesh.vertices[1], mesh.vertices[2] };
+        TraceLog(LOG_WARNING, "Cubicmap mesh vertices (%i) exceed 16bit indices, use LoadCubicmap() chunks", mesh.vertexCount);
 
-        for (int i = 1; i < mesh.vertexCount; i++)
-        {
-            minVertex = Vector3Min(minVertex, (Vector3){ mesh.vertices[i*3], mesh.vertices[i*3 + 1], mesh.vertices[i*3 + 2] });
-            maxVertex = Vector3Max(maxVertex, (Vector3){ mesh.vertices[i*3], mesh.vertices[i*3 + 1], mesh.vertices[i*3 + 2] });
-        }
+        RL_FREE(mesh.vertices);
+        RL_FREE(mesh.texcoords);
+        RL_FREE(mesh.normals);
+        RL_FREE(mesh.indices);
+
+        return (Mesh){ 0 };
     }
 
-    // Create the bounding box
-    BoundingBox box = { 0 };
-    box.min = minVertex;
-    box.max = maxVertex;
+    // Upload vertex data to GPU (static mesh)
+    mesh.vboId = (unsigned int *)RL_CALLOC(MAX_MESH_VBO, sizeof(unsigned int));
+    rlLoadMesh(&mesh, false);
 
-    return box;
+    return mesh;
 }
+#endif      // SUPPORT_MESH_GENERATION
 
-// Compute mesh tangents
-// NOTE: To calculate mesh tangents and binormals we need mesh vertex positions and texture coordinates
-// Implementation base don: https://answers.unity.com/questions/7789/calculating-tangents-vector4.html
-void MeshTangents(Mesh *mesh)
+// Load terrain from tiled heightmap, chunks of chunkCells*chunkCells cells (one vertex by pixel) are streamed around view
+// NOTE: Heightmap must be kept loaded until terrain is unloaded. Heights are heightmap first channel for float formats,
+// gray level normalized otherwise, scaled by size.y. Chunks LOD and streaming are updated by UpdateTerrain()
+Terrain LoadTerrain(TiledImage heightmap, Vector3 size, int chunkCells)
 {
-    if (mesh->tangents == NULL) mesh->tangents = (float *)RL_MALLOC(mesh->vertexCount*4*sizeof(float));
-    else TraceLog(LOG_WARNING, "Mesh tangents already exist");
-
-    Vector3 *tan1 = (Vector3 *)RL_MALLOC(mesh->vertexCount*sizeof(Vector3));
-    Vector3 *tan2 = (Vector3 *)RL_MALLOC(mesh->vertexCount*sizeof(Vector3));
+    Terrain terrain = { 0 };
 
-    for (int i = 0; i < mesh->vertexCount; i += 3)
+    if ((heightmap.tilesData == NULL) || (heightmap.width < 2) || (heightmap.height < 2))
     {
-        // Get triangle vertices
-        Vector3 v1 = { mesh->vertices[(i + 0)*3 + 0], mesh->vertices[(i + 0)*3 + 1], mesh->vertices[(i + 0)*3 + 2] };
-        Vector3 v2 = { mesh->vertices[(i + 1)*3 + 0], mesh->vertices[(i + 1)*3 + 1], mesh->vertices[(i + 1)*3 + 2] };
-        Vector3 v3 = { mesh->vertices[(i + 2)*3 + 0], mesh->vertices[(i + 2)*3 + 1], mesh->vertices[(i + 2)*3 + 2] };
+        TraceLog(LOG_WARNING, "Terrain heightmap not valid, terrain could not be loaded");
+        return terrain;
+    }
 
-        // Get triangle texcoords
-        Vector2 uv1 = { mesh->texcoords[(i + 0)*2 + 0], mesh->texcoords[(i + 0)*2 + 1] };
-        Vector2 uv2 = { mesh->texcoords[(i + 1)*2 + 0], mesh->texcoords[(i + 1)*2 + 1] };
-        Vector2 uv3 = { mesh->texcoords[(i + 2)*2 + 0], mesh->texcoords[(i + 2)*2 + 1] };
+    // NOTE: Chunk full detail mesh vertices must fit 16bit indices
+    if ((chunkCells < (TERRAIN_MIN_LOD_CELLS*2)) || (chunkCells > MAX_TERRAIN_CHUNK_CELLS) || ((chunkCells & (chunkCells - 1)) != 0))
+    {
+        TraceLog(LOG_WARNING, "Terrain chunk cells must be a power of two between %i and %i, %i used", TERRAIN_MIN_LOD_CELLS*2, MAX_TERRAIN_CHUNK_CELLS, 64);
+        chunkCells = 64;
+    }
 
-        float x1 = v2.x - v1.x;
-        float y1 = v2.y - v1.y;
-        float z1 = v2.z - v1.z;
-        float x2 = v3.x - v1.x;
-        float y2 = v3.y - v1.y;
-        float z2 = v3.z - v1.z;
+    TerrainData *data = (TerrainData *)RL_CALLOC(1, sizeof(TerrainData));
+    data->heightmap = heightmap;
+    data->heightScale = size.y;
+    data->chunkCells = chunkCells;
+    data->chunksX = (heightmap.width - 1 + chunkCells - 1)/chunkCells;
+    data->chunksZ = (heightmap.height - 1 + chunkCells - 1)/chunkCells;
+    data->chunks = (TerrainChunk *)RL_CALLOC(data->chunksX*data->chunksZ, sizeof(TerrainChunk));
 
-        float s1 = uv2.x - uv1.x;
-        float t1 = uv2.y - uv1.y;
-        float s2 = uv3.x - uv1.x;
-        float t2 = uv3.y - uv1.y;
+    for (int i = 0; i < data->chunksX*data->chunksZ; i++) data->chunks[i].lod = -1;
 
-        float div = s1*t2 - s2*t1;
-        float r = (div == 0.0f)? 0.0f : 1.0f/div;
+    terrain.size = size;
+    terrain.chunkCells = chunkCells;
+    terrain.chunksX = data->chunksX;
+    terrain.chunksZ = data->chunksZ;
+    terrain.lodCount = 1;
 
-        Vector3 sdir = { (t2*x1 - t1*x2)*r, (t2*y1 - t1*y2)*r, (t2*z1 - t1*z2)*r };
-        Vector3 tdir = { (s1*x2 - s2*x1)*r, (s1*y2 - s2*y1)*r, (s1*z2 - s2*z1)*r };
+    for (int cells = chunkCells; cells > TERRAIN_MIN_LOD_CELLS; cells /= 2) terrain.lodCount++;
 
-        tan1[i + 0] = sdir;
-        tan1[i + 1] = sdir;
-        tan1[i + 2] = sdir;
+    // Default LOD distances: LOD 1 at two chunks distance, furthest LOD up to view distance
+    terrain.lodDistance = 2.0f*chunkCells*size.x/(heightmap.width - 1);
+    terrain.viewDistance = terrain.lodDistance*(1 << (terrain.lodCount - 1));
+    terrain.material = LoadMaterialDefault();
+    terrain.terrainData = data;
 
-        tan2[i + 0] = tdir;
-        tan2[i + 1] = tdir;
-        tan2[i + 2] = tdir;
-    }
+    TraceLog(LOG_INFO, "Terrain loaded successfully (%ix%i - %ix%i chunks, %i LODs)", heightmap.width, heightmap.height, data->chunksX, data->chunksZ, terrain.lodCount);
 
-    // Compute tangents considering normals
-    for (int i = 0; i < mesh->vertexCount; ++i)
-    {
-        Vector3 normal = { mesh->normals[i*3 + 0], mesh->normals[i*3 + 1], mesh->normals[i*3 + 2] };
-        Vector3 tangent = tan1[i];
+    return terrain;
+}
 
-        // TODO: Review, not sure if tangent computation is right, just used reference proposed maths...
-    #if defined(COMPUTE_TANGENTS_METHOD_01)
-        Vector3 tmp = Vector3Subtract(tangent, Vector3Scale(normal, Vector3DotProduct(normal, tangent)));
-        tmp = Vector3Normalize(tmp);
-        mesh->tangents[i*4 + 0] = tmp.x;
-        mesh->tangents[i*4 + 1] = tmp.y;
-        mesh->tangents[i*4 + 2] = tmp.z;
-        mesh->tangents[i*4 + 3] = 1.0f;
-    #else
-        Vector3OrthoNormalize(&normal, &tangent);
-        mesh->tangents[i*4 + 0] = tangent.x;
-        mesh->tangents[i*4 + 1] = tangent.y;
-        mesh->tangents[i*4 + 2] = tangent.z;
-        mesh->tangents[i*4 + 3] = (Vector3DotProduct(Vector3CrossProduct(normal, tangent), tan2[i]) < 0.0f)? -1.0f : 1.0f;
-    #endif
-    }
+// Unload terrain chunks data (RAM and VRAM), chunks being loaded are waited for
+// NOTE: Terrain heightmap is not unloaded, material maps are released but not its shader and textures
+void UnloadTerrain(Terrain terrain)
+{
+    TerrainData *data = (TerrainData *)terrain.terrainData;
 
-    RL_FREE(tan1);
-    RL_FREE(tan2);
+    if (data == NULL) return;
 
-    // Load a new tangent attributes buffer
-    mesh->vboId[LOC_VERTEX_TANGENT] = rlLoadAttribBuffer(mesh->vaoId, LOC_VERTEX_TANGENT, mesh->tangents, mesh->vertexCount*4*sizeof(float), false);
+    WaitWorkerJobs(&data->pending);
 
-    TraceLog(LOG_INFO, "Tangents computed for mesh");
-}
+    for (int i = 0; i < data->loadCount; i++) RL_FREE(data->loadHeights[i]);
 
-// Compute mesh binormals (aka bitangent)
-void MeshBinormals(Mesh *mesh)
-{
-    for (int i = 0; i < mesh->vertexCount; i++)
+    for (int i = 0; i < data->chunksX*data->chunksZ; i++)
     {
-        //Vector3 normal = { mesh->normals[i*3 + 0], mesh->normals[i*3 + 1], mesh->normals[i*3 + 2] };
-        //Vector3 tangent = { mesh->tangents[i*4 + 0], mesh->tangents[i*4 + 1], mesh->tangents[i*4 + 2] };
-        //Vector3 binormal = Vector3Scale(Vector3CrossProduct(normal, tangent), mesh->tangents[i*4 + 3]);
-        
-        // TODO: Register computed binormal in mesh->binormal?
+        if (data->chunks[i].lod >= 0) UnloadMesh(data->chunks[i].mesh);
+        RL_FREE(data->chunks[i].heights);
     }
+
+    RL_FREE(terrain.material.maps);
+    RL_FREE(data->chunks);
+    RL_FREE(data);
 }
 
-// Draw a model (with texture if set)
-void DrawModel(Model model, Vector3 position, float scale, Color tint)
+// Update terrain around view position (world space): chunks LOD selected by distance (neighbours differ one LOD
+// at most, edges facing coarser chunks are stitched), chunks inside view distance requested and further ones unloaded
+// NOTE: Requested chunks heights are loaded asynchronously (worker thread), nearest ones first, they are drawn once loaded
+void UpdateTerrain(Terrain terrain, Vector3 viewPosition)
 {
-    Vector3 vScale = { scale, scale, scale };
-    Vector3 rotationAxis = { 0.0f, 1.0f, 0.0f };
+    TerrainData *data = (TerrainData *)terrain.terrainData;
 
-    DrawModelEx(model, position, rotationAxis, 0.0f, vScale, tint);
-}
+    if (data == NULL) return;
 
-// Draw a model with extended parameters
-void DrawModelEx(Model model, Vector3 position, Vector3 rotationAxis, float rotationAngle, Vector3 scale, Color tint)
-{
-    // Calculate transformation matrix from function parameters
-    // Get transform matrix (rotation -> scale -> translation)
-    Matrix matScale = MatrixScale(scale.x, scale.y, scale.z);
-    Matrix matRotation = MatrixRotate(rotationAxis, rotationAngle*DEG2RAD);
-    Matrix matTranslation = MatrixTranslate(position.x, position.y, position.z);
+    // Loaded chunks heights become resident
+    if ((data->loadCount > 0) && (GetWorkerJobsPending(&data->pending) == 0))
+    {
+        for (int i = 0; i < data->loadCount; i++)
+        {
+            TerrainChunk *chunk = &data->chunks[data->loadChunks[i]];
+            chunk->heights = data->loadHeights[i];
+            chunk->state = (chunk->heights != NULL)? TERRAIN_CHUNK_RESIDENT : TERRAIN_CHUNK_EMPTY;
 
-    Matrix matTransform = MatrixMultiply(MatrixMultiply(matScale, matRotation), matTranslation);
+            if (chunk->heights != NULL)
+            {
+                chunk->minHeight = chunk->maxHeight = chunk->heights[0];
 
-    // Combine model transformation matrix (model.transform) with matrix generated by function parameters (matTransform)
-    model.transform = MatrixMultiply(model.transform, matTransform);
+                for (int h = 1; h < (data->chunkCells + 3)*(data->chunkCells + 3); h++)
+                {
+                    chunk->minHeight = fminf(chunk->minHeight, chunk->heights[h]);
+                    chunk->maxHeight = fmaxf(chunk->maxHeight, chunk->heights[h]);
+                }
+            }
+        }
 
-    for (int i = 0; i < model.meshCount; i++)
-    {
-        // TODO: Review color + tint premultiplication mechanism
-        Color color = model.materials[model.meshMaterial[i]].maps[MAP_DIFFUSE].color;
-        
-        Color colorTint = WHITE;
-        colorTint.r = (((float)color.r/255.0)*((float)tint.r/255.0))*255;
-        colorTint.g = (((float)color.g/255.0)*((float)tint.g/255.0))*255;
-        colorTint.b = (((float)color.b/255.0)*((float)tint.b/255.0))*255;
-        colorTint.a = (((float)color.a/255.0)*((float)tint.a/255.0))*255;
-        
-        model.materials[model.meshMaterial[i]].maps[MAP_DIFFUSE].color = colorTint;
-        rlDrawMesh(model.meshes[i], model.materials[model.meshMaterial[i]], model.transform);
-        model.materials[model.meshMaterial[i]].maps[MAP_DIFFUSE].color = color;
+        data->loadCount = 0;
     }
-}
 
-// Draw a model wires (with texture if set)
-void DrawModelWires(Model model, Vector3 position, float scale, Color tint)
-{
-    rlEnableWireMode();
+    Vector3 view = Vector3Subtract(viewPosition, terrain.position);
+    float cellSizeX = terrain.size.x/(data->heightmap.width - 1);
+    float cellSizeZ = terrain.size.z/(data->heightmap.height - 1);
+    int chunkCount = data->chunksX*data->chunksZ;
 
-    DrawModel(model, position, scale, tint);
+    // Chunks distance to view and LOD by distance (LOD distance doubles for every level)
+    for (int i = 0; i < chunkCount; i++)
+    {
+        TerrainChunk *chunk = &data->chunks[i];
+        float minX = (i%data->chunksX)*data->chunkCells*cellSizeX;
+        float minZ = (i/data->chunksX)*data->chunkCells*cellSizeZ;
+        float minY = (chunk->state == TERRAIN_CHUNK_RESIDENT)? chunk->minHeight : 0.0f;
+        float maxY = (chunk->state == TERRAIN_CHUNK_RESIDENT)? chunk->maxHeight : terrain.size.y;
 
-    rlDisableWireMode();
-}
+        float dx = fmaxf(fmaxf(minX - view.x, view.x - (minX + data->chunkCells*cellSizeX)), 0.0f);
+        float dy = fmaxf(fmaxf(minY - view.y, view.y - maxY), 0.0f);
+        float dz = fmaxf(fmaxf(minZ - view.z, view.z - (minZ + data->chunkCells*cellSizeZ)), 0.0f);
 
-// Draw a model wires (with texture if set) with extended parameters
-void DrawModelWiresEx(Model model, Vector3 position, Vector3 rotationAxis, float rotationAngle, Vector3 scale, Color tint)
-{
-    rlEnableWireMode();
+        chunk->distance = sqrtf(dx*dx + dy*dy + dz*dz);
+        chunk->targetLod = 0;
 
-    DrawModelEx(model, position, rotationAxis, rotationAngle, scale, tint);
+        for (float distance = terrain.lodDistance; (chunk->distance >= distance) && (chunk->targetLod < (terrain.lodCount - 1)); distance *= 2.0f) chunk->targetLod++;
 
-    rlDisableWireMode();
-}
+        // Chunks far from view are unloaded (hysteresis avoids reloading chunks on view distance limit)
+        if ((chunk->state == TERRAIN_CHUNK_RESIDENT) && (chunk->distance > terrain.viewDistance*TERRAIN_UNLOAD_DISTANCE_SCALE))
+        {
+            if (chunk->lod >= 0) UnloadMesh(chunk->mesh);
+            RL_FREE(chunk->heights);
 
-// Draw a billboard
-void DrawBillboard(Camera camera, Texture2D texture, Vector3 center, float size, Color tint)
-{
-    Rectangle sourceRec = { 0.0f, 0.0f, (float)texture.width, (float)texture.height };
+            chunk->heights = NULL;
+            chunk->mesh = (Mesh){ 0 };
+            chunk->lod = -1;
+            chunk->state = TERRAIN_CHUNK_EMPTY;
+        }
+    }
 
-    DrawBillboardRec(camera, texture, sourceRec, center, size, tint);
-}
+    // Neighbour chunks LOD differ one level at most, required by edges stitching
+    for (bool changed = true; changed; )
+    {
+        changed = false;
 
-// Draw a billboard (part of a texture defined by a rectangle)
-void DrawBillboardRec(Camera camera, Texture2D texture, Rectangle sourceRec, Vector3 center, float size, Color tint)
-{
-    // NOTE: Billboard size will maintain sourceRec aspect ratio, size will represent billboard width
-    Vector2 sizeRatio = { size, size*(float)sourceRec.height/sourceRec.width };
+        for (int i = 0; i < chunkCount; i++)
+        {
+            int x = i%data->chunksX;
+            int z = i/data->chunksX;
+            int neighbours[4] = { (x > 0)? i - 1 : -1, (x < (data->chunksX - 1))? i + 1 : -1, (z > 0)? i - data->chunksX : -1, (z < (data->chunksZ - 1))? i + data->chunksX : -1 };
 
-    Matrix matView = MatrixLookAt(camera.position, camera.target, camera.up);
+            for (int n = 0; n < 4; n++)
+            {
+                if ((neighbours[n] >= 0) && (data->chunks[i].targetLod > (data->chunks[neighbours[n]].targetLod + 1)))
+                {
+                    data->chunks[i].targetLod = data->chunks[neighbours[n]].targetLod + 1;
+                    changed = true;
+                }
+            }
+        }
+    }
 
-    Vector3 right = { matView.m0, matView.m4, matView.m8 };
-    //Vector3 up = { matView.m1, matView.m5, matView.m9 };
+    // Resident chunks meshes rebuilt if LOD or stitched edges changed
+    for (int i = 0; i < chunkCount; i++)
+    {
+        TerrainChunk *chunk = &data->chunks[i];
 
-    // NOTE: Billboard locked on axis-Y
-    Vector3 up = { 0.0f, 1.0f, 0.0f };
-/*
-    a-------b
-    |       |
-    |   *   |
-    |       |
-    d-------c
-*/
-    right = Vector3Scale(right, sizeRatio.x/2);
-    up = Vector3Scale(up, sizeRatio.y/2);
+        if (chunk->state != TERRAIN_CHUNK_RESIDENT) continue;
 
-    Vector3 p1 = Vector3Add(right, up);
-    Vector3 p2 = Vector3Subtract(right, up);
+        int x = i%data->chunksX;
+        int z = i/data->chunksX;
+        int stitch = 0;
 
-    Vector3 a = Vector3Subtract(center, p2);
-    Vector3 b = Vector3Add(center, p1);
-    Vector3 c = Vector3Add(center, p2);
-    Vector3 d = Vector3Subtract(center, p1);
+        if ((x > 0) && (data->chunks[i - 1].targetLod > chunk->targetLod)) stitch |= TERRAIN_STITCH_MIN_X;
+        if ((x < (data->chunksX - 1)) && (data->chunks[i + 1].targetLod > chunk->targetLod)) stitch |= TERRAIN_STITCH_MAX_X;
+        if ((z > 0) && (data->chunks[i - data->chunksX].targetLod > chunk->targetLod)) stitch |= TERRAIN_STITCH_MIN_Z;
+        if ((z < (data->chunksZ - 1)) && (data->chunks[i + data->chunksX].targetLod > chunk->targetLod)) stitch |= TERRAIN_STITCH_MAX_Z;
 
-    if (rlCheckBufferLimit(4)) rlglDraw();
+        if ((chunk->lod != chunk->targetLod) || (chunk->stitch != stitch))
+        {
+            if (chunk->lod >= 0) UnloadMesh(chunk->mesh);
 
-    rlEnableTexture(texture.id);
+            chunk->mesh = GenTerrainChunkMesh(terrain, i, chunk->targetLod, stitch);
+            chunk->lod = chunk->targetLod;
+            chunk->stitch = stitch;
+        }
+    }
 
-    rlBegin(RL_QUADS);
-        rlColor4ub(tint.r, tint.g, tint.b, tint.a);
+    // Nearest chunks inside view distance requested, loaded on next streaming round
+    if (data->loadCount == 0)
+    {
+        for (int i = 0; i < chunkCount; i++)
+        {
+            if ((data->chunks[i].state != TERRAIN_CHUNK_EMPTY) || (data->chunks[i].distance > terrain.viewDistance)) continue;
 
-        // Bottom-left corner for texture and quad
-        rlTexCoord2f((float)sourceRec.x/texture.width, (float)sourceRec.y/texture.height);
-        rlVertex3f(a.x, a.y, a.z);
+            // Requests kept sorted by distance (insertion), furthest request dropped if full
+            if ((data->loadCount == MAX_TERRAIN_CHUNK_LOADS) && (data->chunks[data->loadChunks[MAX_TERRAIN_CHUNK_LOADS - 1]].distance <= data->chunks[i].distance)) continue;
 
-        // Top-left corner for texture and quad
-        rlTexCoord2f((float)sourceRec.x/texture.width, (float)(sourceRec.y + sourceRec.height)/texture.height);
-        rlVertex3f(d.x, d.y, d.z);
+            int k = (data->loadCount < MAX_TERRAIN_CHUNK_LOADS)? data->loadCount++ : MAX_TERRAIN_CHUNK_LOADS - 1;
 
-        // Top-right corner for texture and quad
-        rlTexCoord2f((float)(sourceRec.x + sourceRec.width)/texture.width, (float)(sourceRec.y + sourceRec.height)/texture.height);
-        rlVertex3f(c.x, c.y, c.z);
+            while ((k > 0) && (data->chunks[data->loadChunks[k - 1]].distance > data->chunks[i].distance))
+            {
+                data->loadChunks[k] = data->loadChunks[k - 1];
+                k--;
+            }
 
-        // Bottom-right corner for texture and quad
-        rlTexCoord2f((float)(sourceRec.x + sourceRec.width)/texture.width, (float)sourceRec.y/texture.height);
-        rlVertex3f(b.x, b.y, b.z);
-    rlEnd();
+            data->loadChunks[k] = i;
+        }
 
-    rlDisableTexture();
+        if (data->loadCount > 0)
+        {
+            for (int i = 0; i < data->loadCount; i++)
+            {
+                data->chunks[data->loadChunks[i]].state = TERRAIN_CHUNK_LOADING;
+                data->loadHeights[i] = NULL;
+            }
+
+            SubmitWorkerJob(LoadTerrainChunksJob, data, &data->pending);
+        }
+    }
 }
 
-// Draw a bounding box with wires
-void DrawBoundingBox(BoundingBox box, Color color)
+// Draw terrain resident chunks inside view frustum
+void DrawTerrain(Terrain terrain, Color tint)
 {
-    Vector3 size;
+    TerrainData *data = (TerrainData *)terrain.terrainData;
 
-    size.x = (float)fabs(box.max.x - box.min.x);
-    size.y = (float)fabs(box.max.y - box.min.y);
-    size.z = (float)fabs(box.max.z - box.min.z);
+    if (data == NULL) return;
 
-    Vector3 center = { box.min.x + size.x/2.0f, box.min.y + size.y/2.0f, box.min.z + size.z/2.0f };
+    Matrix transform = MatrixTranslate(terrain.position.x, terrain.position.y, terrain.position.z);
+    float cellSizeX = terrain.size.x/(data->heightmap.width - 1);
+    float cellSizeZ = terrain.size.z/(data->heightmap.height - 1);
 
-    DrawCubeWires(center, size.x, size.y, size.z, color);
+    Color color = terrain.material.maps[MAP_DIFFUSE].color;
+    terrain.material.maps[MAP_DIFFUSE].color = (Color){ (unsigned char)(color.r*tint.r/255), (unsigned char)(color.g*tint.g/255), (unsigned char)(color.b*tint.b/255), (unsigned char)(color.a*tint.a/255) };
+
+    for (int i = 0; i < data->chunksX*data->chunksZ; i++)
+    {
+        const TerrainChunk *chunk = &data->chunks[i];
+
+        if (chunk->lod < 0) continue;
+
+        if (modelCulling)
+        {
+            Vector3 min = { (i%data->chunksX)*data->chunkCells*cellSizeX, chunk->minHeight, (i/data->chunksX)*data->chunkCells*cellSizeZ };
+            Vector3 max = { min.x + data->chunkCells*cellSizeX, chunk->maxHeight, min.z + data->chunkCells*cellSizeZ };
+
+            if (!rlCheckBoxInFrustum(min, max, transform)) continue;
+        }
+
+        rlDrawMesh(chunk->mesh, terrain.material, transform);
+    }
+
+    terrain.material.maps[MAP_DIFFUSE].color = color;
 }
 
-// Detect collision between two spheres
-bool CheckCollisionSpheres(Vector3 centerA, float radiusA, Vector3 centerB, float radiusB)
+// Get terrain height at world position (x, z), bilinear interpolated from resident chunks full detail heights
+// NOTE: Terrain position height is returned if position is out of terrain or its chunk is not resident
+float GetTerrainHeight(Terrain terrain, float x, float z)
 {
-    bool collision = false;
+    TerrainData *data = (TerrainData *)terrain.terrainData;
 
-    // Simple way to check for collision, just checking distance between two points
-    // Unfortunately, sqrtf() is a costly operation, so we avoid it with following solution
-    /*
-    float dx = centerA.x - centerB.x;      // X distance between centers
-    float dy = centerA.y - centerB.y;      // Y distance between centers
-    float dz = centerA.z - centerB.z;      // Z distance between centers
+    if (data == NULL) return terrain.position.y;
 
-    float distance = sqrtf(dx*dx + dy*dy + dz*dz);  // Distance between centers
+    float px = (x - terrain.position.x)/terrain.size.x*(data->heightmap.width - 1);
+    float pz = (z - terrain.position.z)/terrain.size.z*(data->heightmap.height - 1);
 
-    if (distance <= (radiusA + radiusB)) collision = true;
-    */
+    if ((px < 0.0f) || (pz < 0.0f) || (px > (data->heightmap.width - 1)) || (pz > (data->heightmap.height - 1))) return terrain.position.y;
 
-    // Check for distances squared to avoid sqrtf()
-    if (Vector3DotProduct(Vector3Subtract(centerB, centerA), Vector3Subtract(centerB, centerA)) <= (radiusA + radiusB)*(radiusA + radiusB)) collision = true;
+    int chunkX = (int)px/data->chunkCells;
+    int chunkZ = (int)pz/data->chunkCells;
 
-    return collision;
+    if (chunkX >= data->chunksX) chunkX = data->chunksX - 1;
+    if (chunkZ >= data->chunksZ) chunkZ = data->chunksZ - 1;
+
+    const TerrainChunk *chunk = &data->chunks[chunkZ*data->chunksX + chunkX];
+
+    if (chunk->state != TERRAIN_CHUNK_RESIDENT) return terrain.position.y;
+
+    // Chunk heights include one sample border
+    float cx = px - chunkX*data->chunkCells;
+    float cz = pz - chunkZ*data->chunkCells;
+    int ix = (int)cx;
+    int iz = (int)cz;
+    float fx = cx - ix;
+    float fz = cz - iz;
+    int stride = data->chunkCells + 3;
+    const float *heights = &chunk->heights[(iz + 1)*stride + ix + 1];
+
+    float height = (heights[0]*(1.0f - fx) + heights[1]*fx)*(1.0f - fz) + (heights[stride]*(1.0f - fx) + heights[stride + 1]*fx)*fz;
+
+    return terrain.position.y + height;
 }
 
-// Detect collision between two boxes
-// NOTE: Boxes are defined by two points minimum and maximum
-bool CheckCollisionBoxes(BoundingBox box1, BoundingBox box2)
+// Load heightfield from image data (heights from pixels gray value), matches GenMeshHeightmap() mesh surface
+// NOTE: Samples spacing is size/samples (same as GenMeshHeightmap()), min/max hierarchy built on load
+Heightfield LoadHeightfield(Image heightmap, Vector3 size)
 {
-    bool collision = true;
+    Heightfield heightfield = { 0 };
 
-    if ((box1.max.x >= box2.min.x) && (box1.min.x <= box2.max.x))
+    if ((heightmap.data == NULL) || (heightmap.width < 2) || (heightmap.height < 2))
     {
-        if ((box1.max.y < box2.min.y) || (box1.min.y > box2.max.y)) collision = false;
-        if ((box1.max.z < box2.min.z) || (box1.min.z > box2.max.z)) collision = false;
+        TraceLog(LOG_WARNING, "Heightmap image not valid, heightfield could not be loaded");
+        return heightfield;
     }
-    else collision = false;
 
-    return collision;
-}
+    Color *pixels = GetImageData(heightmap);
 
-// Detect collision between box and sphere
-bool CheckCollisionBoxSphere(BoundingBox box, Vector3 center, float radius)
-{
-    bool collision = false;
+    heightfield.size = size;
+    heightfield.width = heightmap.width;
+    heightfield.length = heightmap.height;
+    heightfield.heights = (float *)RL_MALLOC(heightfield.width*heightfield.length*sizeof(float));
 
-    float dmin = 0;
+    for (int i = 0; i < heightfield.width*heightfield.length; i++) heightfield.heights[i] = (float)((pixels[i].r + pixels[i].g + pixels[i].b)/3)*size.y/255.0f;
 
-    if (center.x < box.min.x) dmin += powf(center.x - box.min.x, 2);
-    else if (center.x > box.max.x) dmin += powf(center.x - box.max.x, 2);
+    RL_FREE(pixels);
 
-    if (center.y < box.min.y) dmin += powf(center.y - box.min.y, 2);
-    else if (center.y > box.max.y) dmin += powf(center.y - box.max.y, 2);
+    HeightfieldLevels *levels = (HeightfieldLevels *)RL_CALLOC(1, sizeof(HeightfieldLevels));
 
-    if (center.z < box.min.z) dmin += powf(center.z - box.min.z, 2);
-    else if (center.z > box.max.z) dmin += powf(center.z - box.max.z, 2);
+    // Level 0 bounds: cells four corners heights
+    int cellsX = heightfield.width - 1;
+    int cellsZ = heightfield.length - 1;
 
-    if (dmin <= (radius*radius)) collision = true;
+    levels->levelWidth[0] = cellsX;
+    levels->levelLength[0] = cellsZ;
+    levels->bounds[0] = (float *)RL_MALLOC(cellsX*cellsZ*2*sizeof(float));
+    levels->levelCount = 1;
 
-    return collision;
-}
+    for (int z = 0; z < cellsZ; z++)
+    {
+        for (int x = 0; x < cellsX; x++)
+        {
+            const float *heights = &heightfield.heights[z*heightfield.width + x];
+            float *bounds = &levels->bounds[0][(z*cellsX + x)*2];
 
-// Detect collision between ray and sphere
-bool CheckCollisionRaySphere(Ray ray, Vector3 center, float radius)
-{
-    bool collision = false;
+            bounds[0] = fminf(fminf(heights[0], heights[1]), fminf(heights[heightfield.width], heights[heightfield.width + 1]));
+            bounds[1] = fmaxf(fmaxf(heights[0], heights[1]), fmaxf(heights[heightfield.width], heights[heightfield.width + 1]));
+        }
+    }
 
-    Vector3 raySpherePos = Vector3Subtract(center, ray.position);
-    float distance = Vector3Length(raySpherePos);
-    float vector = Vector3DotProduct(raySpherePos, ray.direction);
-    float d = radius*radius - (distance*distance - vector*vector);
+    // Next levels bounds: 2x2 groups of previous level, until a single group covers all cells
+    while (((levels->levelWidth[levels->levelCount - 1] > 1) || (levels->levelLength[levels->levelCount - 1] > 1)) && (levels->levelCount < MAX_HEIGHTFIELD_LEVELS))
+    {
+        int level = levels->levelCount;
+        int prevWidth = levels->levelWidth[level - 1];
+        int prevLength = levels->levelLength[level - 1];
+        const float *prevBounds = levels->bounds[level - 1];
 
-    if (d >= 0.0f) collision = true;
+        levels->levelWidth[level] = (prevWidth + 1)/2;
+        levels->levelLength[level] = (prevLength + 1)/2;
+        levels->bounds[level] = (float *)RL_MALLOC(levels->levelWidth[level]*levels->levelLength[level]*2*sizeof(float));
 
-    return collision;
-}
+        for (int z = 0; z < levels->levelLength[level]; z++)
+        {
+            for (int x = 0; x < levels->levelWidth[level]; x++)
+            {
+                float minHeight = FLT_MAX;
+                float maxHeight = -FLT_MAX;
 
-// Detect collision between ray and sphere with extended parameters and collision point detection
-bool CheckCollisionRaySphereEx(Ray ray, Vector3 center, float radius, Vector3 *collisionPoint)
-{
-    bool collision = false;
+                for (int j = 2*z; (j < (2*z + 2)) && (j < prevLength); j++)
+                {
+                    for (int i = 2*x; (i < (2*x + 2)) && (i < prevWidth); i++)
+                    {
+                        minHeight = fminf(minHeight, prevBounds[(j*prevWidth + i)*2]);
+                        maxHeight = fmaxf(maxHeight, prevBounds[(j*prevWidth + i)*2 + 1]);
+                    }
+                }
 
-    Vector3 raySpherePos = Vector3Subtract(center, ray.position);
-    float distance = Vector3Length(raySpherePos);
-    float vector = Vector3DotProduct(raySpherePos, ray.direction);
-    float d = radius*radius - (distance*distance - vector*vector);
+                levels->bounds[level][(z*levels->levelWidth[level] + x)*2] = minHeight;
+                levels->bounds[level][(z*levels->levelWidth[level] + x)*2 + 1] = maxHeight;
+            }
+        }
 
-    if (d >= 0.0f) collision = true;
+        levels->levelCount++;
+    }
 
-    // Check if ray origin is inside the sphere to calculate the correct collision point
-    float collisionDistance = 0;
+    heightfield.levelsData = levels;
 
-    if (distance < radius) collisionDistance = vector + sqrtf(d);
-    else collisionDistance = vector - sqrtf(d);
+    TraceLog(LOG_INFO, "Heightfield loaded successfully (%i x %i samples, %i levels)", heightfield.width, heightfield.length, levels->levelCount);
 
-    // Calculate collision point
-    Vector3 cPoint = Vector3Add(ray.position, Vector3Scale(ray.direction, collisionDistance));
+    return heightfield;
+}
 
-    collisionPoint->x = cPoint.x;
-    collisionPoint->y = cPoint.y;
-    collisionPoint->z = cPoint.z;
+// Unload heightfield heights and hierarchy
+void UnloadHeightfield(Heightfield heightfield)
+{
+    HeightfieldLevels *levels = (HeightfieldLevels *)heightfield.levelsData;
 
-    return collision;
+    if (levels != NULL)
+    {
+        for (int i = 0; i < levels->levelCount; i++) RL_FREE(levels->bounds[i]);
+        RL_FREE(levels);
+    }
+
+    RL_FREE(heightfield.heights);
 }
 
-// Detect collision between ray and bounding box
-bool CheckCollisionRayBox(Ray ray, BoundingBox box)
+// Get heightfield height at world position (bilinear sampling)
+// NOTE: Positions outside heightfield return heightfield base height (position.y)
+float GetHeightfieldHeight(Heightfield heightfield, float x, float z)
 {
-    bool collision = false;
+    if (heightfield.heights == NULL) return heightfield.position.y;
 
-    float t[8];
-    t[0] = (box.min.x - ray.position.x)/ray.direction.x;
-    t[1] = (box.max.x - ray.position.x)/ray.direction.x;
-    t[2] = (box.min.y - ray.position.y)/ray.direction.y;
-    t[3] = (box.max.y - ray.position.y)/ray.direction.y;
-    t[4] = (box.min.z - ray.position.z)/ray.direction.z;
-    t[5] = (box.max.z - ray.position.z)/ray.direction.z;
-    t[6] = (float)fmax(fmax(fmin(t[0], t[1]), fmin(t[2], t[3])), fmin(t[4], t[5]));
-    t[7] = (float)fmin(fmin(fmax(t[0], t[1]), fmax(t[2], t[3])), fmax(t[4], t[5]));
+    float px = (x - heightfield.position.x)/heightfield.size.x*heightfield.width;
+    float pz = (z - heightfield.position.z)/heightfield.size.z*heightfield.length;
 
-    collision = !(t[7] < 0 || t[6] > t[7]);
+    if ((px < 0.0f) || (pz < 0.0f) || (px > (heightfield.width - 1)) || (pz > (heightfield.length - 1))) return heightfield.position.y;
 
-    return collision;
+    int ix = (int)px;
+    int iz = (int)pz;
+
+    // Last samples row/column sampled from previous cell
+    if (ix > (heightfield.width - 2)) ix = heightfield.width - 2;
+    if (iz > (heightfield.length - 2)) iz = heightfield.length - 2;
+
+    float fx = px - ix;
+    float fz = pz - iz;
+    int stride = heightfield.width;
+    const float *heights = &heightfield.heights[iz*stride + ix];
+
+    float height = (heights[0]*(1.0f - fx) + heights[1]*fx)*(1.0f - fz) + (heights[stride]*(1.0f - fx) + heights[stride + 1]*fx)*fz;
+
+    return heightfield.position.y + height;
 }
 
-// Get collision info between ray and model
-RayHitInfo GetCollisionRayModel(Ray ray, Model model)
+// Get collision info between ray and heightfield (GenMeshHeightmap() mesh triangles)
+// NOTE: Hierarchy groups are traversed nearest first, groups not crossed by ray (under or over their min/max
+// heights) or farther than nearest hit are skipped, only cells along ray path test their two triangles
+RayHitInfo GetCollisionRayHeightfield(Ray ray, Heightfield heightfield)
 {
     RayHitInfo result = { 0 };
 
-    for (int m = 0; m < model.meshCount; m++)
+    HeightfieldLevels *levels = (HeightfieldLevels *)heightfield.levelsData;
+
+    if (levels == NULL) return result;
+
+    Vector3 invDir = { 1.0f/ray.direction.x, 1.0f/ray.direction.y, 1.0f/ray.direction.z };
+    float cellSizeX = heightfield.size.x/heightfield.width;
+    float cellSizeZ = heightfield.size.z/heightfield.length;
+    float nearest = FLT_MAX;
+
+    // Groups stack (level, x, z), every group pushes up to four children (nearest child popped first)
+    int stack[MAX_HEIGHTFIELD_LEVELS*4][3] = { 0 };
+    float stackDistances[MAX_HEIGHTFIELD_LEVELS*4] = { 0 };
+    int stackSize = 0;
+
+    int topLevel = levels->levelCount - 1;
+
+    for (int z = 0; z < levels->levelLength[topLevel]; z++)
     {
-        // Check if meshhas vertex data on CPU for testing
-        if (model.meshes[m].vertices != NULL)
+        for (int x = 0; (x < levels->levelWidth[topLevel]) && (stackSize < (MAX_HEIGHTFIELD_LEVELS*3)); x++)
         {
-            // model->mesh.triangleCount may not be set, vertexCount is more reliable
-            int triangleCount = model.meshes[m].vertexCount/3;
+            float distance = 0.0f;
+            Vector3 min = { 0 };
+            Vector3 max = { 0 };
+            GetHeightfieldGroupBox(heightfield, topLevel, x, z, &min, &max);
 
-            // Test against all triangles in mesh
-            for (int i = 0; i < triangleCount; i++)
+            if (GetRayBoxDistance(ray.position, invDir, min, max, nearest, &distance))
             {
-                Vector3 a, b, c;
-                Vector3 *vertdata = (Vector3 *)model.meshes[m].vertices;
+                stack[stackSize][0] = topLevel;
+                stack[stackSize][1] = x;
+                stack[stackSize][2] = z;
+                stackDistances[stackSize] = distance;
+                stackSize++;
+            }
+        }
+    }
 
-                if (model.meshes[m].indices)
-                {
-                    a = vertdata[model.meshes[m].indices[i*3 + 0]];
-                    b = vertdata[model.meshes[m].indices[i*3 + 1]];
-                    c = vertdata[model.meshes[m].indices[i*3 + 2]];
-                }
-                else
-                {
-                    a = vertdata[i*3 + 0];
-                    b = vertdata[i*3 + 1];
-                    c = vertdata[i*3 + 2];
-                }
+    while (stackSize > 0)
+    {
+        stackSize--;
+        if (stackDistances[stackSize] > nearest) continue;
+
+        int level = stack[stackSize][0];
+        int x = stack[stackSize][1];
+        int z = stack[stackSize][2];
+
+        if (level == 0)
+        {
+            // Cell triangles, same vertices and winding as GenMeshHeightmap()
+            const float *heights = &heightfield.heights[z*heightfield.width + x];
+            float x0 = heightfield.position.x + x*cellSizeX;
+            float z0 = heightfield.position.z + z*cellSizeZ;
+
+            Vector3 p1 = { x0, heightfield.position.y + heights[0], z0 };
+            Vector3 p2 = { x0, heightfield.position.y + heights[heightfield.width], z0 + cellSizeZ };
+            Vector3 p3 = { x0 + cellSizeX, heightfield.position.y + heights[1], z0 };
+            Vector3 p4 = { x0 + cellSizeX, heightfield.position.y + heights[heightfield.width + 1], z0 + cellSizeZ };
 
-                a = Vector3Transform(a, model.transform);
-                b = Vector3Transform(b, model.transform);
-                c = Vector3Transform(c, model.transform);
+            RayHitInfo triHitInfo = GetCollisionRayTriangle(ray, p1, p2, p3);
+            if (triHitInfo.hit && (triHitInfo.distance < nearest)) { nearest = triHitInfo.distance; result = triHitInfo; }
 
-                RayHitInfo triHitInfo = GetCollisionRayTriangle(ray, a, b, c);
+            triHitInfo = GetCollisionRayTriangle(ray, p3, p2, p4);
+            if (triHitInfo.hit && (triHitInfo.distance < nearest)) { nearest = triHitInfo.distance; result = triHitInfo; }
+        }
+        else
+        {
+            int children[4][2] = { 0 };
+            float distances[4] = { 0 };
+            int childCount = 0;
 
-                if (triHitInfo.hit)
+            for (int j = 2*z; (j < (2*z + 2)) && (j < levels->levelLength[level - 1]); j++)
+            {
+                for (int i = 2*x; (i < (2*x + 2)) && (i < levels->levelWidth[level - 1]); i++)
                 {
-                    // Save the closest hit triangle
-                    if ((!result.hit) || (result.distance > triHitInfo.distance)) result = triHitInfo;
+                    float distance = 0.0f;
+                    Vector3 min = { 0 };
+                    Vector3 max = { 0 };
+                    GetHeightfieldGroupBox(heightfield, level - 1, i, j, &min, &max);
+
+                    if (GetRayBoxDistance(ray.position, invDir, min, max, nearest, &distance))
+                    {
+                        // Children sorted by distance (insertion)
+                        int k = childCount;
+                        while ((k > 0) && (distances[k - 1] > distance))
+                        {
+                            children[k][0] = children[k - 1][0];
+                            children[k][1] = children[k - 1][1];
+                            distances[k] = distances[k - 1];
+                            k--;
+                        }
+
+                        children[k][0] = i;
+                        children[k][1] = j;
+                        distances[k] = distance;
+                        childCount++;
+                    }
                 }
             }
+
+            // Farther children pushed first
+            for (int k = childCount - 1; k >= 0; k--)
+            {
+                stack[stackSize][0] = level - 1;
+                stack[stackSize][1] = children[k][0];
+                stack[stackSize][2] = children[k][1];
+                stackDistances[stackSize] = distances[k];
+                stackSize++;
+            }
         }
     }
 
     return result;
 }
 
-// Get collision info between ray and triangle
-// NOTE: Based on https://en.wikipedia.org/wiki/M%C3%B6ller%E2%80%93Trumbore_intersection_algorithm
-RayHitInfo GetCollisionRayTriangle(Ray ray, Vector3 p1, Vector3 p2, Vector3 p3)
+// Load cubicmap from pixel data (white pixels are walls, black pixels floors), meshed by chunks of chunkSize*chunkSize cells
+// NOTE: Chunks coplanar faces are merged (greedy meshing), changing a cell only rebuilds its chunk (and neighbour
+// chunks sharing its walls). Texture coordinates are in cells units (texture repeated by cell)
+Cubicmap LoadCubicmap(Image cubicmap, Vector3 cubeSize, int chunkSize)
 {
-    #define EPSILON 0.000001        // A small number
-
-    Vector3 edge1, edge2;
-    Vector3 p, q, tv;
-    float det, invDet, u, v, t;
-    RayHitInfo result = {0};
+    Cubicmap map = { 0 };
 
-    // Find vectors for two edges sharing V1
-    edge1 = Vector3Subtract(p2, p1);
-    edge2 = Vector3Subtract(p3, p1);
-
-    // Begin calculating determinant - also used to calculate u parameter
-    p = Vector3CrossProduct(ray.direction, edge2);
+    unsigned char *cells = LoadCubicmapCells(cubicmap);
 
-    // If determinant is near zero, ray lies in plane of triangle or ray is parallel to plane of triangle
-    det = Vector3DotProduct(edge1, p);
+    if (cells == NULL)
+    {
+        TraceLog(LOG_WARNING, "Cubicmap image not valid, cubicmap could not be loaded");
+        return map;
+    }
 
-    // Avoid culling!
-    if ((det > -EPSILON) && (det < EPSILON)) return result;
+    // NOTE: Chunk worst case mesh vertices must fit 16bit indices
+    if ((chunkSize < 1) || (chunkSize > MAX_CUBICMAP_CHUNK_SIZE))
+    {
+        TraceLog(LOG_WARNING, "Cubicmap chunk size must be between 1 and %i, %i used", MAX_CUBICMAP_CHUNK_SIZE, 32);
+        chunkSize = 32;
+    }
 
-    invDet = 1.0f/det;
+    CubicmapData *data = (CubicmapData *)RL_CALLOC(1, sizeof(CubicmapData));
+    data->cells = cells;
+    data->chunksX = (cubicmap.width + chunkSize - 1)/chunkSize;
+    data->chunksZ = (cubicmap.height + chunkSize - 1)/chunkSize;
+    data->chunks = (Mesh *)RL_CALLOC(data->chunksX*data->chunksZ, sizeof(Mesh));
+    data->dirty = (bool *)RL_CALLOC(data->chunksX*data->chunksZ, sizeof(bool));
 
-    // Calculate distance from V1 to ray origin
-    tv = Vector3Subtract(ray.position, p1);
+    map.cubeSize = cubeSize;
+    map.width = cubicmap.width;
+    map.height = cubicmap.height;
+    map.chunkSize = chunkSize;
+    map.material = LoadMaterialDefault();
+    map.cubicmapData = data;
 
-    // Calculate u parameter and test bound
-    u = Vector3DotProduct(tv, p)*invDet;
+    int vertexCount = 0;
 
-    // The intersection lies outside of the triangle
-    if ((u < 0.0f) || (u > 1.0f)) return result;
+    for (int i = 0; i < data->chunksX*data->chunksZ; i++)
+    {
+        UpdateCubicmapChunk(map, i);
+        vertexCount += data->chunks[i].vertexCount;
+    }
 
-    // Prepare to test v parameter
-    q = Vector3CrossProduct(tv, edge1);
+    TraceLog(LOG_INFO, "Cubicmap loaded successfully (%ix%i - %ix%i chunks, %i vertices)", map.width, map.height, data->chunksX, data->chunksZ, vertexCount);
 
-    // Calculate V parameter and test bound
-    v = Vector3DotProduct(ray.direction, q)*invDet;
+    return map;
+}
 
-    // The intersection lies outside of the triangle
-    if ((v < 0.0f) || ((u + v) > 1.0f)) return result;
+// Unload cubicmap cells and chunks meshes (RAM and VRAM)
+// NOTE: Material maps are released but not its shader and textures
+void UnloadCubicmap(Cubicmap cubicmap)
+{
+    CubicmapData *data = (CubicmapData *)cubicmap.cubicmapData;
 
-    t = Vector3DotProduct(edge2, q)*invDet;
+    if (data == NULL) return;
 
-    if (t > EPSILON)
+    for (int i = 0; i < data->chunksX*data->chunksZ; i++)
     {
-        // Ray hit, get hit point and normal
-        result.hit = true;
-        result.distance = t;
-        result.hit = true;
-        result.normal = Vector3Normalize(Vector3CrossProduct(edge1, edge2));
-        result.position = Vector3Add(ray.position, Vector3Scale(ray.direction, t));
+        if (data->chunks[i].vertexCount > 0) UnloadMesh(data->chunks[i]);
     }
 
-    return result;
+    RL_FREE(cubicmap.material.maps);
+    RL_FREE(data->cells);
+    RL_FREE(data->chunks);
+    RL_FREE(data->dirty);
+    RL_FREE(data);
 }
 
-// Get collision info between ray and ground plane (Y-normal plane)
-RayHitInfo GetCollisionRayGround(Ray ray, float groundHeight)
+// Set cubicmap cell type (CubicmapCellType), chunks affected are rebuilt on next DrawCubicmap()
+// NOTE: Cells on chunks borders also change neighbour chunks walls sides
+void SetCubicmapCell(Cubicmap cubicmap, int x, int z, int type)
 {
-    #define EPSILON 0.000001        // A small number
+    CubicmapData *data = (CubicmapData *)cubicmap.cubicmapData;
 
-    RayHitInfo result = { 0 };
+    if ((data == NULL) || (x < 0) || (z < 0) || (x >= cubicmap.width) || (z >= cubicmap.height)) return;
+    if ((type < CUBICMAP_CELL_EMPTY) || (type > CUBICMAP_CELL_WALL) || (data->cells[z*cubicmap.width + x] == type)) return;
 
-    if (fabs(ray.direction.y) > EPSILON)
-    {
-        float distance = (ray.position.y - groundHeight)/-ray.direction.y;
+    data->cells[z*cubicmap.width + x] = (unsigned char)type;
 
-        if (distance >= 0.0)
-        {
-            result.hit = true;
-            result.distance = distance;
-            result.normal = (Vector3){ 0.0, 1.0, 0.0 };
-            result.position = Vector3Add(ray.position, Vector3Scale(ray.direction, distance));
-        }
-    }
+    int chunkX = x/cubicmap.chunkSize;
+    int chunkZ = z/cubicmap.chunkSize;
 
-    return result;
-}
+    data->dirty[chunkZ*data->chunksX + chunkX] = true;
 
-//----------------------------------------------------------------------------------
-// Module specific Functions Definition
-//----------------------------------------------------------------------------------
+    if ((x > 0) && (((x - 1)/cubicmap.chunkSize) != chunkX)) data->dirty[chunkZ*data->chunksX + chunkX - 1] = true;
+    if ((x < (cubicmap.width - 1)) && (((x + 1)/cubicmap.chunkSize) != chunkX)) data->dirty[chunkZ*data->chunksX + chunkX + 1] = true;
+    if ((z > 0) && (((z - 1)/cubicmap.chunkSize) != chunkZ)) data->dirty[(chunkZ - 1)*data->chunksX + chunkX] = true;
+    if ((z < (cubicmap.height - 1)) && (((z + 1)/cubicmap.chunkSize) != chunkZ)) data->dirty[(chunkZ + 1)*data->chunksX + chunkX] = true;
+}
 
-#if defined(SUPPORT_FILEFORMAT_OBJ)
-// Load OBJ mesh data
-static Model LoadOBJ(const char *fileName)
+// Get cubicmap cell type (CubicmapCellType), cells out of cubicmap are empty
+int GetCubicmapCell(Cubicmap cubicmap, int x, int z)
 {
-    Model model = { 0 };
-
-    tinyobj_attrib_t attrib;
-    tinyobj_shape_t *meshes = NULL;
-    unsigned int meshCount = 0;
+    CubicmapData *data = (CubicmapData *)cubicmap.cubicmapData;
 
-    tinyobj_material_t *materials = NULL;
-    unsigned int materialCount = 0;
+    if ((data == NULL) || (x < 0) || (z < 0) || (x >= cubicmap.width) || (z >= cubicmap.height)) return CUBICMAP_CELL_EMPTY;
 
-    int dataLength = 0;
-    char *data = NULL;
+    return data->cells[z*cubicmap.width + x];
+}
 
-    // Load model data
-    FILE *objFile = fopen(fileName, "rb");
+// Draw cubicmap chunks inside view frustum, chunks with cells changed are rebuilt first
+void DrawCubicmap(Cubicmap cubicmap, Color tint)
+{
+    CubicmapData *data = (CubicmapData *)cubicmap.cubicmapData;
 
-    if (objFile != NULL)
-    {
-        fseek(objFile, 0, SEEK_END);
-        long length = ftell(objFile);   // Get file size
-        fseek(objFile, 0, SEEK_SET);    // Reset file pointer
+    if (data == NULL) return;
 
-        data = (char *)RL_MALLOC(length);
+    Matrix transform = MatrixTranslate(cubicmap.position.x, cubicmap.position.y, cubicmap.position.z);
+    float chunkWidth = cubicmap.chunkSize*cubicmap.cubeSize.x;
+    float chunkLength = cubicmap.chunkSize*cubicmap.cubeSize.z;
 
-        fread(data, length, 1, objFile);
-        dataLength = length;
-        fclose(objFile);
-    }
+    Color color = cubicmap.material.maps[MAP_DIFFUSE].color;
+    cubicmap.material.maps[MAP_DIFFUSE].color = (Color){ (unsigned char)(color.r*tint.r/255), (unsigned char)(color.g*tint.g/255), (unsigned char)(color.b*tint.b/255), (unsigned char)(color.a*tint.a/255) };
 
-    if (data != NULL)
+    for (int i = 0; i < data->chunksX*data->chunksZ; i++)
     {
-        unsigned int flags = TINYOBJ_FLAG_TRIANGULATE;
-        int ret = tinyobj_parse_obj(&attrib, &meshes, &meshCount, &materials, &materialCount, data, dataLength, flags);
+        if (data->dirty[i]) UpdateCubicmapChunk(cubicmap, i);
 
-        if (ret != TINYOBJ_SUCCESS) TraceLog(LOG_WARNING, "[%s] Model data could not be loaded", fileName);
-        else TraceLog(LOG_INFO, "[%s] Model data loaded successfully: %i meshes / %i materials", fileName, meshCount, materialCount);
-
-        // Init model meshes array
-        // TODO: Support multiple meshes... in the meantime, only one mesh is returned
-        //model.meshCount = meshCount;
-        model.meshCount = 1;
-        model.meshes = (Mesh *)RL_CALLOC(model.meshCount, sizeof(Mesh));
+        if (data->chunks[i].vertexCount == 0) continue;
 
-        // Init model materials array
-        if (materialCount > 0)
+        if (modelCulling)
         {
-            model.materialCount = materialCount;
-            model.materials = (Material *)RL_CALLOC(model.materialCount, sizeof(Material));
-        }
+            // NOTE: Cell (0, 0) is centered on cubicmap position
+            Vector3 min = { (i%data->chunksX)*chunkWidth - 0.5f*cubicmap.cubeSize.x, 0.0f, (i/data->chunksX)*chunkLength - 0.5f*cubicmap.cubeSize.z };
+            Vector3 max = { min.x + chunkWidth, cubicmap.cubeSize.y, min.z + chunkLength };
 
-        model.meshMaterial = (int *)RL_CALLOC(model.meshCount, sizeof(int));
+            if (!rlCheckBoxInFrustum(min, max, transform)) continue;
+        }
 
-        /*
-        // Multiple meshes data reference
-        // NOTE: They are provided as a faces offset
-        typedef struct {
-            char *name;         // group name or object name
-            unsigned int face_offset;
-            unsigned int length;
-        } tinyobj_shape_t;
-        */
-
-        // Init model meshes
-        for (int m = 0; m < 1; m++)
-        {
-            Mesh mesh = { 0 };
-            memset(&mesh, 0, sizeof(Mesh));
-            mesh.vertexCount = attrib.num_faces*3;
-            mesh.triangleCount = attrib.num_faces;
-            mesh.vertices = (float *)RL_CALLOC(mesh.vertexCount*3, sizeof(float));
-            mesh.texcoords = (float *)RL_CALLOC(mesh.vertexCount*2, sizeof(float));
-            mesh.normals = (float *)RL_CALLOC(mesh.vertexCount*3, sizeof(float));
-            mesh.vboId = (unsigned int *)RL_CALLOC(MAX_MESH_VBO, sizeof(unsigned int));
+        rlDrawMesh(data->chunks[i], cubicmap.material, transform);
+    }
 
-            int vCount = 0;
-            int vtCount = 0;
-            int vnCount = 0;
+    cubicmap.material.maps[MAP_DIFFUSE].color = color;
+}
 
-            for (int f = 0; f < attrib.num_faces; f++)
-            {
-                // Get indices for the face
-                tinyobj_vertex_index_t idx0 = attrib.faces[3*f + 0];
-                tinyobj_vertex_index_t idx1 = attrib.faces[3*f + 1];
-                tinyobj_vertex_index_t idx2 = attrib.faces[3*f + 2];
+// Load tile map from tiles indices (row by row, -1 for empty tile), tiles vertex data uploaded by chunks
+// NOTE: Tiles are copied (NULL tiles loads an empty map), tileset texture is referenced and not unloaded
+TileMap LoadTileMap(Texture2D tileset, int tileWidth, int tileHeight, const int *tiles, int width, int height, int chunkSize)
+{
+    TileMap map = { 0 };
 
-                // TraceLog(LOG_DEBUG, "Face %i index: v %i/%i/%i . vt %i/%i/%i . vn %i/%i/%i\n", f, idx0.v_idx, idx1.v_idx, idx2.v_idx, idx0.vt_idx, idx1.vt_idx, idx2.vt_idx, idx0.vn_idx, idx1.vn_idx, idx2.vn_idx);
+    if ((tileWidth <= 0) || (tileHeight <= 0) || (width <= 0) || (height <= 0))
+    {
+        TraceLog(LOG_WARNING, "Tile map size not valid, tile map could not be loaded");
+        return map;
+    }
 
-                // Fill vertices buffer (float) using vertex index of the face
-                for (int v = 0; v < 3; v++) { mesh.vertices[vCount + v] = attrib.vertices[idx0.v_idx*3 + v]; } vCount +=3;
-                for (int v = 0; v < 3; v++) { mesh.vertices[vCount + v] = attrib.vertices[idx1.v_idx*3 + v]; } vCount +=3;
-                for (int v = 0; v < 3; v++) { mesh.vertices[vCount + v] = attrib.vertices[idx2.v_idx*3 + v]; } vCount +=3;
+    // NOTE: Chunk mesh vertices must fit 16bit indices
+    if ((chunkSize < 1) || (chunkSize > MAX_TILEMAP_CHUNK_SIZE))
+    {
+        TraceLog(LOG_WARNING, "Tile map chunk size must be between 1 and %i, %i used", MAX_TILEMAP_CHUNK_SIZE, 32);
+        chunkSize = 32;
+    }
 
-                // Fill texcoords buffer (float) using vertex index of the face
-                // NOTE: Y-coordinate must be flipped upside-down
-                mesh.texcoords[vtCount + 0] = attrib.texcoords[idx0.vt_idx*2 + 0];
-                mesh.texcoords[vtCount + 1] = 1.0f - attrib.texcoords[idx0.vt_idx*2 + 1]; vtCount += 2;
-                mesh.texcoords[vtCount + 0] = attrib.texcoords[idx1.vt_idx*2 + 0];
-                mesh.texcoords[vtCount + 1] = 1.0f - attrib.texcoords[idx1.vt_idx*2 + 1]; vtCount += 2;
-                mesh.texcoords[vtCount + 0] = attrib.texcoords[idx2.vt_idx*2 + 0];
-                mesh.texcoords[vtCount + 1] = 1.0f - attrib.texcoords[idx2.vt_idx*2 + 1]; vtCount += 2;
+    TileMapData *data = (TileMapData *)RL_CALLOC(1, sizeof(TileMapData));
+    data->tiles = (int *)RL_MALLOC(width*height*sizeof(int));
+    data->chunksX = (width + chunkSize - 1)/chunkSize;
+    data->chunksY = (height + chunkSize - 1)/chunkSize;
+    data->chunks = (TileMapChunk *)RL_CALLOC(data->chunksX*data->chunksY, sizeof(TileMapChunk));
+    data->material = LoadMaterialDefault();
+    data->material.maps[MAP_DIFFUSE].texture = tileset;
 
-                // Fill normals buffer (float) using vertex index of the face
-                for (int v = 0; v < 3; v++) { mesh.normals[vnCount + v] = attrib.normals[idx0.vn_idx*3 + v]; } vnCount +=3;
-                for (int v = 0; v < 3; v++) { mesh.normals[vnCount + v] = attrib.normals[idx1.vn_idx*3 + v]; } vnCount +=3;
-                for (int v = 0; v < 3; v++) { mesh.normals[vnCount + v] = attrib.normals[idx2.vn_idx*3 + v]; } vnCount +=3;
-            }
+    map.tileset = tileset;
+    map.tileWidth = tileWidth;
+    map.tileHeight = tileHeight;
+    map.width = width;
+    map.height = height;
+    map.chunkSize = chunkSize;
+    map.tileMapData = data;
 
-            model.meshes[m] = mesh;                 // Assign mesh data to model
+    for (int i = 0; i < width*height; i++) data->tiles[i] = ((tiles != NULL) && (tiles[i] >= 0))? tiles[i] : -1;
 
-            // Assign mesh material for current mesh
-            model.meshMaterial[m] = attrib.material_ids[m];
+    for (int i = 0; i < data->chunksX*data->chunksY; i++) data->chunks[i].dirtyStart = -1;
 
-            // Set unfound materials to default
-            if (model.meshMaterial[m] == -1) model.meshMaterial[m] = 0;
+    for (int y = 0; y < height; y++)
+    {
+        for (int x = 0; x < width; x++)
+        {
+            if (data->tiles[y*width + x] >= 0) data->chunks[(y/chunkSize)*data->chunksX + x/chunkSize].tileCount++;
         }
+    }
+
+    int chunksLoaded = 0;
 
-        // Init model materials
-        for (int m = 0; m < materialCount; m++)
+    for (int i = 0; i < data->chunksX*data->chunksY; i++)
+    {
+        if (data->chunks[i].tileCount > 0)
         {
-            // Init material to default
-            // NOTE: Uses default shader, only MAP_DIFFUSE supported
-            model.materials[m] = LoadMaterialDefault();
+            UpdateTileMapChunk(map, i);
+            chunksLoaded++;
+        }
+    }
 
-            /*
-            typedef struct {
-                char *name;
+    TraceLog(LOG_INFO, "Tile map loaded successfully (%ix%i - %ix%i chunks, %i chunks with tiles)", width, height, data->chunksX, data->chunksY, chunksLoaded);
 
-                float ambient[3];
-                float diffuse[3];
-                float specular[3];
-                float transmittance[3];
-                float emission[3];
-                float shininess;
-                float ior;          // index of refraction
-                float dissolve;     // 1 == opaque; 0 == fully transparent
-                // illumination model (Ref: http://www.fileformat.info/format/material/)
-                int illum;
+    return map;
+}
 
-                int pad0;
+// Unload tile map tiles and chunks meshes (RAM and VRAM)
+// NOTE: Tileset texture is not unloaded
+void UnloadTileMap(TileMap map)
+{
+    TileMapData *data = (TileMapData *)map.tileMapData;
 
-                char *ambient_texname;            // map_Ka
-                char *diffuse_texname;            // map_Kd
-                char *specular_texname;           // map_Ks
-                char *specular_highlight_texname; // map_Ns
-                char *bump_texname;               // map_bump, bump
-                char *displacement_texname;       // disp
-                char *alpha_texname;              // map_d
-            } tinyobj_material_t;
-            */
+    if (data == NULL) return;
 
-            model.materials[m].maps[MAP_DIFFUSE].texture = GetTextureDefault();     // Get default texture, in case no texture is defined
+    for (int i = 0; i < data->chunksX*data->chunksY; i++)
+    {
+        if (data->chunks[i].mesh.vertexCount > 0) UnloadMesh(data->chunks[i].mesh);
+    }
 
-            if (materials[m].diffuse_texname != NULL) model.materials[m].maps[MAP_DIFFUSE].texture = LoadTexture(materials[m].diffuse_texname);  //char *diffuse_texname; // map_Kd
-            model.materials[m].maps[MAP_DIFFUSE].color = (Color){ (float)(materials[m].diffuse[0]*255.0f), (float)(materials[m].diffuse[1]*255.0f), (float)(materials[m].diffuse[2]*255.0f), 255 }; //float diffuse[3];
-            model.materials[m].maps[MAP_DIFFUSE].value = 0.0f;
+    RL_FREE(data->material.maps);
+    RL_FREE(data->tiles);
+    RL_FREE(data->chunks);
+    RL_FREE(data);
+}
 
-            if (materials[m].specular_texname != NULL) model.materials[m].maps[MAP_SPECULAR].texture = LoadTexture(materials[m].specular_texname);  //char *specular_texname; // map_Ks
-            model.materials[m].maps[MAP_SPECULAR].color = (Color){ (float)(materials[m].specular[0]*255.0f), (float)(materials[m].specular[1]*255.0f), (float)(materials[m].specular[2]*255.0f), 255 }; //float specular[3];
-            model.materials[m].maps[MAP_SPECULAR].value = 0.0f;
+// Set tile map tile index (-1 for empty tile), only changed tiles vertex data is uploaded on next DrawTileMap()
+void SetTileMapTile(TileMap map, int x, int y, int tile)
+{
+    TileMapData *data = (TileMapData *)map.tileMapData;
 
-            if (materials[m].bump_texname != NULL) model.materials[m].maps[MAP_NORMAL].texture = LoadTexture(materials[m].bump_texname);  //char *bump_texname; // map_bump, bump
-            model.materials[m].maps[MAP_NORMAL].color = WHITE;
-            model.materials[m].maps[MAP_NORMAL].value = materials[m].shininess;
+    if ((data == NULL) || (x < 0) || (y < 0) || (x >= map.width) || (y >= map.height)) return;
+    if (tile < 0) tile = -1;
 
-            model.materials[m].maps[MAP_EMISSION].color = (Color){ (float)(materials[m].emission[0]*255.0f), (float)(materials[m].emission[1]*255.0f), (float)(materials[m].emission[2]*255.0f), 255 }; //float emission[3];
+    int previous = data->tiles[y*map.width + x];
+    if (previous == tile) return;
 
-            if (materials[m].displacement_texname != NULL) model.materials[m].maps[MAP_HEIGHT].texture = LoadTexture(materials[m].displacement_texname);  //char *displacement_texname; // disp
-        }
+    data->tiles[y*map.width + x] = tile;
 
-        tinyobj_attrib_free(&attrib);
-        tinyobj_shapes_free(meshes, meshCount);
-        tinyobj_materials_free(materials, materialCount);
+    int chunkX = x/map.chunkSize;
+    int chunkY = y/map.chunkSize;
+    int sizeX = (((chunkX + 1)*map.chunkSize) <= map.width)? map.chunkSize : (map.width - chunkX*map.chunkSize);
+    int quad = (y - chunkY*map.chunkSize)*sizeX + (x - chunkX*map.chunkSize);
 
-        RL_FREE(data);
-    }
+    TileMapChunk *chunk = &data->chunks[chunkY*data->chunksX + chunkX];
 
-    // NOTE: At this point we have all model data loaded
-    TraceLog(LOG_INFO, "[%s] Model loaded successfully in RAM (CPU)", fileName);
+    if (previous < 0) chunk->tileCount++;
+    else if (tile < 0) chunk->tileCount--;
 
-    return model;
+    if (chunk->dirtyStart < 0)
+    {
+        chunk->dirtyStart = quad;
+        chunk->dirtyEnd = quad;
+    }
+    else if (quad < chunk->dirtyStart) chunk->dirtyStart = quad;
+    else if (quad > chunk->dirtyEnd) chunk->dirtyEnd = quad;
 }
-#endif
 
-#if defined(SUPPORT_FILEFORMAT_IQM)
-// Load IQM mesh data
-static Model LoadIQM(const char *fileName)
+// Get tile map tile index, tiles out of tile map are empty (-1)
+int GetTileMapTile(TileMap map, int x, int y)
 {
-    #define IQM_MAGIC       "INTERQUAKEMODEL"   // IQM file magic number
-    #define IQM_VERSION     2                   // only IQM version 2 supported
+    TileMapData *data = (TileMapData *)map.tileMapData;
 
-    #define BONE_NAME_LENGTH    32          // BoneInfo name string length
-    #define MESH_NAME_LENGTH    32          // Mesh name string length
+    if ((data == NULL) || (x < 0) || (y < 0) || (x >= map.width) || (y >= map.height)) return -1;
 
-    // IQM file structs
-    //-----------------------------------------------------------------------------------
-    typedef struct IQMHeader {
-        char magic[16];
-        unsigned int version;
-        unsigned int filesize;
-        unsigned int flags;
-        unsigned int num_text, ofs_text;
-        unsigned int num_meshes, ofs_meshes;
-        unsigned int num_vertexarrays, num_vertexes, ofs_vertexarrays;
-        unsigned int num_triangles, ofs_triangles, ofs_adjacency;
-        unsigned int num_joints, ofs_joints;
-        unsigned int num_poses, ofs_poses;
-        unsigned int num_anims, ofs_anims;
-        unsigned int num_frames, num_framechannels, ofs_frames, ofs_bounds;
-        unsigned int num_comment, ofs_comment;
-        unsigned int num_extensions, ofs_extensions;
-    } IQMHeader;
+    return data->tiles[y*map.width + x];
+}
 
-    typedef struct IQMMesh {
-        unsigned int name;
-        unsigned int material;
-        unsigned int first_vertex, num_vertexes;
-        unsigned int first_triangle, num_triangles;
-    } IQMMesh;
+// Draw tile map chunks inside view (one draw call by chunk), chunks with changed tiles are uploaded first
+// NOTE: Tile map is drawn at current 2D depth, tile (0, 0) top-left corner is placed at position
+void DrawTileMap(TileMap map, Vector2 position, Color tint)
+{
+    TileMapData *data = (TileMapData *)map.tileMapData;
 
-    typedef struct IQMTriangle {
-        unsigned int vertex[3];
-    } IQMTriangle;
+    if (data == NULL) return;
 
-    typedef struct IQMJoint {
-        unsigned int name;
-        int parent;
-        float translate[3], rotate[4], scale[3];
-    } IQMJoint;
+    rlglDraw();     // Draw batched elements first, tile map chunks are drawn directly
 
-    typedef struct IQMVertexArray {
-        unsigned int type;
-        unsigned int flags;
-        unsigned int format;
-        unsigned int size;
-        unsigned int offset;
-    } IQMVertexArray;
+    Matrix transform = MatrixTranslate(position.x, position.y, rlGetCurrentDepth());
+    float chunkWidth = (float)map.chunkSize*map.tileWidth;
+    float chunkHeight = (float)map.chunkSize*map.tileHeight;
 
-    // NOTE: Below IQM structures are not used but listed for reference
-    /*
-    typedef struct IQMAdjacency {
-        unsigned int triangle[3];
-    } IQMAdjacency;
+    data->material.maps[MAP_DIFFUSE].color = tint;
 
-    typedef struct IQMPose {
-        int parent;
-        unsigned int mask;
-        float channeloffset[10];
-        float channelscale[10];
-    } IQMPose;
+    for (int i = 0; i < data->chunksX*data->chunksY; i++)
+    {
+        if (data->chunks[i].dirtyStart >= 0) UpdateTileMapChunk(map, i);
 
-    typedef struct IQMAnim {
-        unsigned int name;
-        unsigned int first_frame, num_frames;
-        float framerate;
-        unsigned int flags;
-    } IQMAnim;
+        if (data->chunks[i].tileCount == 0) continue;
 
-    typedef struct IQMBounds {
-        float bbmin[3], bbmax[3];
-        float xyradius, radius;
-    } IQMBounds;
-    */
-    //-----------------------------------------------------------------------------------
+        if (modelCulling)
+        {
+            Vector3 min = { (i%data->chunksX)*chunkWidth, (i/data->chunksX)*chunkHeight, 0.0f };
+            Vector3 max = { min.x + chunkWidth, min.y + chunkHeight, 0.0f };
 
-    // IQM vertex data types
-    enum {
-        IQM_POSITION     = 0,
-        IQM_TEXCOORD     = 1,
-        IQM_NORMAL       = 2,
-        IQM_TANGENT      = 3,       // NOTE: Tangents unused by default
-        IQM_BLENDINDEXES = 4,
-        IQM_BLENDWEIGHTS = 5,
-        IQM_COLOR        = 6,       // NOTE: Vertex colors unused by default
-        IQM_CUSTOM       = 0x10     // NOTE: Custom vertex values unused by default
-    };
+            if (!rlCheckBoxInFrustum(min, max, transform)) continue;
+        }
 
-    Model model = { 0 };
+        rlDrawMesh(data->chunks[i].mesh, data->material, transform);
+    }
+}
 
-    FILE *iqmFile;
-    IQMHeader iqm;
+// Load empty static batch, meshes instances are added (AddStaticBatchMesh(), AddStaticBatchModel()) and built before drawing
+StaticBatch LoadStaticBatch(void)
+{
+    StaticBatch batch = { 0 };
+    batch.batchData = RL_CALLOC(1, sizeof(StaticBatchData));
 
-    IQMMesh *imesh;
-    IQMTriangle *tri;
-    IQMVertexArray *va;
-    IQMJoint *ijoint;
+    return batch;
+}
 
-    float *vertex = NULL;
-    float *normal = NULL;
-    float *text = NULL;
-    char *blendi = NULL;
-    unsigned char *blendw = NULL;
+// Unload static batch merged meshes
+// NOTE: Added meshes and materials are not unloaded, they are owned by caller
+void UnloadStaticBatch(StaticBatch batch)
+{
+    StaticBatchData *data = (StaticBatchData *)batch.batchData;
 
-    iqmFile = fopen(fileName, "rb");
+    for (int i = 0; i < batch.meshCount; i++) UnloadMesh(batch.meshes[i]);
 
-    if (iqmFile == NULL)
-    {
-        TraceLog(LOG_WARNING, "[%s] IQM file could not be opened", fileName);
-        return model;
-    }
+    RL_FREE(batch.meshes);
+    RL_FREE(batch.bounds);
+    RL_FREE(batch.meshMaterial);
+    RL_FREE(batch.materials);
 
-    fread(&iqm,sizeof(IQMHeader), 1, iqmFile);  // Read IQM header
+    if (data != NULL) RL_FREE(data->instances);
+    RL_FREE(data);
+}
 
-    if (strncmp(iqm.magic, IQM_MAGIC, sizeof(IQM_MAGIC)))
+// Add mesh instance to static batch, merged on next BuildStaticBatch()
+// NOTE: Mesh CPU data is referenced (not copied), it must be available until batch is built
+void AddStaticBatchMesh(StaticBatch *batch, Mesh mesh, Material material, Matrix transform)
+{
+    if ((batch == NULL) || (batch->batchData == NULL)) return;
+
+    if ((mesh.vertices == NULL) || (mesh.texcoords == NULL) || (mesh.vertexCount <= 0))
     {
-        TraceLog(LOG_WARNING, "[%s] IQM file does not seem to be valid", fileName);
-        fclose(iqmFile);
-        return model;
+        TraceLog(LOG_WARNING, "Mesh vertex data not available in RAM (CPU), mesh not added to static batch");
+        return;
     }
 
-    if (iqm.version != IQM_VERSION)
+    StaticBatchData *data = (StaticBatchData *)batch->batchData;
+
+    if (data->instanceCount >= data->instanceCapacity)
     {
-        TraceLog(LOG_WARNING, "[%s] IQM file version is not supported (%i).", fileName, iqm.version);
-        fclose(iqmFile);
-        return model;
+        data->instanceCapacity = (data->instanceCapacity > 0)? data->instanceCapacity*2 : 64;
+        data->instances = (StaticBatchInstance *)RL_REALLOC(data->instances, data->instanceCapacity*sizeof(StaticBatchInstance));
     }
 
-    // Meshes data processing
-    imesh = RL_MALLOC(sizeof(IQMMesh)*iqm.num_meshes);
-    fseek(iqmFile, iqm.ofs_meshes, SEEK_SET);
-    fread(imesh, sizeof(IQMMesh)*iqm.num_meshes, 1, iqmFile);
+    StaticBatchInstance *instance = &data->instances[data->instanceCount];
+    instance->mesh = mesh;
+    instance->transform = transform;
+    instance->material = GetStaticBatchMaterial(batch, material);
+    instance->code = 0;
 
-    model.meshCount = iqm.num_meshes;
-    model.meshes = RL_CALLOC(model.meshCount, sizeof(Mesh));
+    data->instanceCount++;
+}
 
-    char name[MESH_NAME_LENGTH] = { 0 };
+// Add model meshes instance to static batch (model transform applied first)
+void AddStaticBatchModel(StaticBatch *batch, Model model, Matrix transform)
+{
+    Matrix matTransform = MatrixMultiply(model.transform, transform);
 
-    for (int i = 0; i < model.meshCount; i++)
-    {
-        fseek(iqmFile, iqm.ofs_text + imesh[i].name, SEEK_SET);
-        fread(name, sizeof(char)*MESH_NAME_LENGTH, 1, iqmFile);     // Mesh name not used...
-        model.meshes[i].vertexCount = imesh[i].num_vertexes;
+    for (int i = 0; i < model.meshCount; i++) AddStaticBatchMesh(batch, model.meshes[i], model.materials[model.meshMaterial[i]], matTransform);
+}
 
-        model.meshes[i].vertices = RL_CALLOC(model.meshes[i].vertexCount*3, sizeof(float));       // Default vertex positions
-        model.meshes[i].normals = RL_CALLOC(model.meshes[i].vertexCount*3, sizeof(float));        // Default vertex normals
-        model.meshes[i].texcoords = RL_CALLOC(model.meshes[i].vertexCount*2, sizeof(float));      // Default vertex texcoords
+// Merge added instances by material into world space meshes, uploaded to GPU
+// NOTE: Instances are sorted by material and spatial order (Morton code of bounds center), merged meshes are
+// spatially compact chunks culled separately. Merged meshes CPU data is only kept if requested (SetModelKeepMeshData())
+void BuildStaticBatch(StaticBatch *batch)
+{
+    if ((batch == NULL) || (batch->batchData == NULL)) return;
 
-        model.meshes[i].boneIds = RL_CALLOC(model.meshes[i].vertexCount*4, sizeof(float));        // Up-to 4 bones supported!
-        model.meshes[i].boneWeights = RL_CALLOC(model.meshes[i].vertexCount*4, sizeof(float));    // Up-to 4 bones supported!
+    StaticBatchData *data = (StaticBatchData *)batch->batchData;
+    if (data->instanceCount == 0) return;
 
-        model.meshes[i].triangleCount = imesh[i].num_triangles;
-        model.meshes[i].indices = RL_CALLOC(model.meshes[i].triangleCount*3, sizeof(unsigned short));
+    // Instances bounds centers (world space) and all instances bounds
+    Vector3 *centers = (Vector3 *)RL_MALLOC(data->instanceCount*sizeof(Vector3));
+    BoundingBox bounds = { { FLT_MAX, FLT_MAX, FLT_MAX }, { -FLT_MAX, -FLT_MAX, -FLT_MAX } };
 
-        // Animated verted data, what we actually process for rendering
-        // NOTE: Animated vertex should be re-uploaded to GPU (if not using GPU skinning)
-        model.meshes[i].animVertices = RL_CALLOC(model.meshes[i].vertexCount*3, sizeof(float));
-        model.meshes[i].animNormals = RL_CALLOC(model.meshes[i].vertexCount*3, sizeof(float));
+    for (int i = 0; i < data->instanceCount; i++)
+    {
+        BoundingBox box = TransformBoundingBox(MeshBoundingBox(data->instances[i].mesh), data->instances[i].transform);
 
-        model.meshes[i].vboId = (unsigned int *)RL_CALLOC(MAX_MESH_VBO, sizeof(unsigned int));
+        centers[i] = Vector3Scale(Vector3Add(box.min, box.max), 0.5f);
+        bounds.min = Vector3Min(bounds.min, centers[i]);
+        bounds.max = Vector3Max(bounds.max, centers[i]);
     }
 
-    // Triangles data processing
-    tri = RL_MALLOC(iqm.num_triangles*sizeof(IQMTriangle));
-    fseek(iqmFile, iqm.ofs_triangles, SEEK_SET);
-    fread(tri, iqm.num_triangles*sizeof(IQMTriangle), 1, iqmFile);
+    for (int i = 0; i < data->instanceCount; i++) data->instances[i].code = GetMortonCode(centers[i], bounds);
 
-    for (int m = 0; m < model.meshCount; m++)
+    RL_FREE(centers);
+
+    qsort(data->instances, data->instanceCount, sizeof(StaticBatchInstance), CompareStaticBatchInstances);
+
+    // Consecutive instances with same material merged until chunk vertices are filled
+    int meshCount = batch->meshCount;
+
+    for (int start = 0, end = 0; start < data->instanceCount; start = end)
     {
-        int tcounter = 0;
+        int vertexCount = 0;
 
-        for (int i = imesh[m].first_triangle; i < (imesh[m].first_triangle + imesh[m].num_triangles); i++)
+        for (end = start; end < data->instanceCount; end++)
         {
-            // IQM triangles are stored counter clockwise, but raylib sets opengl to clockwise drawing, so we swap them around
-            model.meshes[m].indices[tcounter + 2] = tri[i].vertex[0] - imesh[m].first_vertex;
-            model.meshes[m].indices[tcounter + 1] = tri[i].vertex[1] - imesh[m].first_vertex;
-            model.meshes[m].indices[tcounter] = tri[i].vertex[2] - imesh[m].first_vertex;
-            tcounter += 3;
+            if (data->instances[end].material != data->instances[start].material) break;
+            if ((end > start) && ((vertexCount + data->instances[end].mesh.vertexCount) > STATIC_BATCH_CHUNK_VERTICES)) break;
+
+            vertexCount += data->instances[end].mesh.vertexCount;
         }
+
+        AddStaticBatchChunk(batch, &data->instances[start], end - start);
     }
 
-    // Vertex arrays data processing
-    va = RL_MALLOC(iqm.num_vertexarrays*sizeof(IQMVertexArray));
-    fseek(iqmFile, iqm.ofs_vertexarrays, SEEK_SET);
-    fread(va, iqm.num_vertexarrays*sizeof(IQMVertexArray), 1, iqmFile);
+    TraceLog(LOG_INFO, "Static batch built: %i instances merged into %i meshes", data->instanceCount, batch->meshCount - meshCount);
 
-    for (int i = 0; i < iqm.num_vertexarrays; i++)
+    data->instanceCount = 0;
+}
+
+// Draw static batch merged meshes inside view frustum
+// NOTE: Merged meshes are ordered by material, consecutive draws only change vertex buffers
+void DrawStaticBatch(StaticBatch batch, Color tint)
+{
+    Matrix transform = MatrixIdentity();
+
+    for (int i = 0; i < batch.meshCount; i++)
     {
-        switch (va[i].type)
-        {
-            case IQM_POSITION:
-            {
-                vertex = RL_MALLOC(iqm.num_vertexes*3*sizeof(float));
-                fseek(iqmFile, va[i].offset, SEEK_SET);
-                fread(vertex, iqm.num_vertexes*3*sizeof(float), 1, iqmFile);
+        if (modelCulling && !rlCheckBoxInFrustum(batch.bounds[i].min, batch.bounds[i].max, transform)) continue;
 
-                for (int m = 0; m < iqm.num_meshes; m++)
-                {
+        Material material = batch.materials[batch.meshMaterial[i]];
+        Color color = material.maps[MAP_DIFFUSE].color;
+
+        material.maps[MAP_DIFFUSE].color = (Color){ (unsigned char)(color.r*tint.r/255), (unsigned char)(color.g*tint.g/255), (unsigned char)(color.b*tint.b/255), (unsigned char)(color.a*tint.a/255) };
+        rlDrawMesh(batch.meshes[i], material, transform);
+        material.maps[MAP_DIFFUSE].color = color;
+    }
+}
+
+// Compute mesh bounding box limits
+// NOTE: minVertex and maxVertex should be transformed by model transform matrix
+BoundingBox MeshBoundingBox(Mesh mesh)
+{
+    // Get min and max vertex to construct bounds (AABB)
+    Vector3 minVertex = { 0 };
+    Vector3 maxVertex = { 0 };
+
+    if (mesh.vertices != NULL)
+    {
+        minVertex = (Vector3){ mesh.vertices[0], mesh.vertices[1], mesh.vertices[2] };
+        maxVertex = (Vector3){ mesh.vertices[0], mesh.vertices[1], mesh.vertices[2] };
+
+        int i = 1;
+
+#if defined(MODELS_SIMD_SSE) || defined(MODELS_SIMD_NEON)
+        if (mesh.vertexCount >= 4)
+        {
+            // Four vertices (12 floats) loaded as three vectors, lanes components are (x, y, z, x), (y, z, x, y), (z, x, y, z)
+            float lanesMin[12] = { 0 };
+            float lanesMax[12] = { 0 };
+    #if defined(MODELS_SIMD_SSE)
+            __m128 min0 = _mm_loadu_ps(mesh.vertices), min1 = _mm_loadu_ps(mesh.vertices + 4), min2 = _mm_loadu_ps(mesh.vertices + 8);
+            __m128 max0 = min0, max1 = min1, max2 = min2;
+
+            for (i = 4; i + 4 <= mesh.vertexCount; i += 4)
+            {
+                __m128 v0 = _mm_loadu_ps(mesh.vertices + i*3);
+                __m128 v1 = _mm_loadu_ps(mesh.vertices + i*3 + 4);
+                __m128 v2 = _mm_loadu_ps(mesh.vertices + i*3 + 8);
+
+                min0 = _mm_min_ps(min0, v0); max0 = _mm_max_ps(max0, v0);
+                min1 = _mm_min_ps(min1, v1); max1 = _mm_max_ps(max1, v1);
+                min2 = _mm_min_ps(min2, v2); max2 = _mm_max_ps(max2, v2);
+            }
+
+            _mm_storeu_ps(lanesMin, min0); _mm_storeu_ps(lanesMin + 4, min1); _mm_storeu_ps(lanesMin + 8, min2);
+            _mm_storeu_ps(lanesMax, max0); _mm_storeu_ps(lanesMax + 4, max1); _mm_storeu_ps(lanesMax + 8, max2);
+    #else
+            float32x4_t min0 = vld1q_f32(mesh.vertices), min1 = vld1q_f32(mesh.vertices + 4), min2 = vld1q_f32(mesh.vertices + 8);
+            float32x4_t max0 = min0, max1 = min1, max2 = min2;
+
+            for (i = 4; i + 4 <= mesh.vertexCount; i += 4)
+            {
+                float32x4_t v0 = vld1q_f32(mesh.vertices + i*3);
+                float32x4_t v1 = vld1q_f32(mesh.vertices + i*3 + 4);
+                float32x4_t v2 = vld1q_f32(mesh.vertices + i*3 + 8);
+
+                min0 = vminq_f32(min0, v0); max0 = vmaxq_f32(max0, v0);
+                min1 = vminq_f32(min1, v1); max1 = vmaxq_f32(max1, v1);
+                min2 = vminq_f32(min2, v2); max2 = vmaxq_f32(max2, v2);
+            }
+
+            vst1q_f32(lanesMin, min0); vst1q_f32(lanesMin + 4, min1); vst1q_f32(lanesMin + 8, min2);
+            vst1q_f32(lanesMax, max0); vst1q_f32(lanesMax + 4, max1); vst1q_f32(lanesMax + 8, max2);
+    #endif
+            for (int l = 0; l < 12; l += 3)
+            {
+                minVertex = Vector3Min(minVertex, (Vector3){ lanesMin[l], lanesMin[l + 1], lanesMin[l + 2] });
+                maxVertex = Vector3Max(maxVertex, (Vector3){ lanesMax[l], lanesMax[l + 1], lanesMax[l + 2] });
+            }
+        }
+#endif
+
+        // Remaining vertices (or all vertices without SIMD support)
+        for (; i < mesh.vertexCount; i++)
+        {
+            minVertex = Vector3Min(minVertex, (Vector3){ mesh.vertices[i*3], mesh.vertices[i*3 + 1], mesh.vertices[i*3 + 2] });
+            maxVertex = Vector3Max(maxVertex, (Vector3){ mesh.vertices[i*3], mesh.vertices[i*3 + 1], mesh.vertices[i*3 + 2] });
+        }
+    }
+    else if ((mesh.bvh != NULL) && (((MeshBVH *)mesh.bvh)->nodeCount > 0))
+    {
+        // Mesh without CPU data keeps its bounds in BVH root node (UnloadMeshCPUData())
+        minVertex = ((MeshBVH *)mesh.bvh)->nodes[0].min;
+        maxVertex = ((MeshBVH *)mesh.bvh)->nodes[0].max;
+    }
+
+    // Create the bounding box
+    BoundingBox box = { 0 };
+    box.min = minVertex;
+    box.max = maxVertex;
+
+    return box;
+}
+
+// Compute mesh tangents
+// NOTE: To calculate mesh tangents and binormals we need mesh vertex positions and texture coordinates
+// Implementation base don: https://answers.unity.com/questions/7789/calculating-tangents-vector4.html
+void MeshTangents(Mesh *mesh)
+{
+    if (mesh->tangents == NULL) mesh->tangents = (float *)RL_MALLOC(mesh->vertexCount*4*sizeof(float));
+    else TraceLog(LOG_WARNING, "Mesh tangents already exist");
+
+    Vector3 *tan1 = (Vector3 *)RL_MALLOC(mesh->vertexCount*sizeof(Vector3));
+    Vector3 *tan2 = (Vector3 *)RL_MALLOC(mesh->vertexCount*sizeof(Vector3));
+
+    for (int i = 0; i < mesh->vertexCount; i += 3)
+    {
+        // Get triangle vertices
+        Vector3 v1 = { mesh->vertices[(i + 0)*3 + 0], mesh->vertices[(i + 0)*3 + 1], mesh->vertices[(i + 0)*3 + 2] };
+        Vector3 v2 = { mesh->vertices[(i + 1)*3 + 0], mesh->vertices[(i + 1)*3 + 1], mesh->vertices[(i + 1)*3 + 2] };
+        Vector3 v3 = { mesh->vertices[(i + 2)*3 + 0], mesh->vertices[(i + 2)*3 + 1], mesh->vertices[(i + 2)*3 + 2] };
+
+        // Get triangle texcoords
+        Vector2 uv1 = { mesh->texcoords[(i + 0)*2 + 0], mesh->texcoords[(i + 0)*2 + 1] };
+        Vector2 uv2 = { mesh->texcoords[(i + 1)*2 + 0], mesh->texcoords[(i + 1)*2 + 1] };
+        Vector2 uv3 = { mesh->texcoords[(i + 2)*2 + 0], mesh->texcoords[(i + 2)*2 + 1] };
+
+        float x1 = v2.x - v1.x;
+        float y1 = v2.y - v1.y;
+        float z1 = v2.z - v1.z;
+        float x2 = v3.x - v1.x;
+        float y2 = v3.y - v1.y;
+        float z2 = v3.z - v1.z;
+
+        float s1 = uv2.x - uv1.x;
+        float t1 = uv2.y - uv1.y;
+        float s2 = uv3.x - uv1.x;
+        float t2 = uv3.y - uv1.y;
+
+        float div = s1*t2 - s2*t1;
+        float r = (div == 0.0f)? 0.0f : 1.0f/div;
+
+        Vector3 sdir = { (t2*x1 - t1*x2)*r, (t2*y1 - t1*y2)*r, (t2*z1 - t1*z2)*r };
+        Vector3 tdir = { (s1*x2 - s2*x1)*r, (s1*y2 - s2*y1)*r, (s1*z2 - s2*z1)*r };
+
+        tan1[i + 0] = sdir;
+        tan1[i + 1] = sdir;
+        tan1[i + 2] = sdir;
+
+        tan2[i + 0] = tdir;
+        tan2[i + 1] = tdir;
+        tan2[i + 2] = tdir;
+    }
+
+    // Compute tangents considering normals
+    for (int i = 0; i < mesh->vertexCount; ++i)
+    {
+        Vector3 normal = { mesh->normals[i*3 + 0], mesh->normals[i*3 + 1], mesh->normals[i*3 + 2] };
+        Vector3 tangent = tan1[i];
+
+        // TODO: Review, not sure if tangent computation is right, just used reference proposed maths...
+    #if defined(COMPUTE_TANGENTS_METHOD_01)
+        Vector3 tmp = Vector3Subtract(tangent, Vector3Scale(normal, Vector3DotProduct(normal, tangent)));
+        tmp = Vector3Normalize(tmp);
+        mesh->tangents[i*4 + 0] = tmp.x;
+        mesh->tangents[i*4 + 1] = tmp.y;
+        mesh->tangents[i*4 + 2] = tmp.z;
+        mesh->tangents[i*4 + 3] = 1.0f;
+    #else
+        Vector3OrthoNormalize(&normal, &tangent);
+        mesh->tangents[i*4 + 0] = tangent.x;
+        mesh->tangents[i*4 + 1] = tangent.y;
+        mesh->tangents[i*4 + 2] = tangent.z;
+        mesh->tangents[i*4 + 3] = (Vector3DotProduct(Vector3CrossProduct(normal, tangent), tan2[i]) < 0.0f)? -1.0f : 1.0f;
+    #endif
+    }
+
+    RL_FREE(tan1);
+    RL_FREE(tan2);
+
+    // Load a new tangent attributes buffer
+    mesh->vboId[LOC_VERTEX_TANGENT] = rlLoadAttribBuffer(mesh->vaoId, LOC_VERTEX_TANGENT, mesh->tangents, mesh->vertexCount*4*sizeof(float), false);
+
+    TraceLog(LOG_INFO, "Tangents computed for mesh");
+}
+
+// Compute mesh binormals (aka bitangent)
+void MeshBinormals(Mesh *mesh)
+{
+    for (int i = 0; i < mesh->vertexCount; i++)
+    {
+        //Vector3 normal = { mesh->normals[i*3 + 0], mesh->normals[i*3 + 1], mesh->normals[i*3 + 2] };
+        //Vector3 tangent = { mesh->tangents[i*4 + 0], mesh->tangents[i*4 + 1], mesh->tangents[i*4 + 2] };
+        //Vector3 binormal = Vector3Scale(Vector3CrossProduct(normal, tangent), mesh->tangents[i*4 + 3]);
+        
+        // TODO: Register computed binormal in mesh->binormal?
+    }
+}
+
+// Build mesh bounding volume hierarchy, accelerates mesh collision queries (GetCollisionRayMesh(), GetCollisionSphereMesh(), GetCollisionBoxMesh())
+// NOTE: BVH is built from mesh vertices (bind pose for animated meshes) with binned SAH splits, must be rebuilt if vertex data changes
+void MeshBuildBVH(Mesh *mesh)
+{
+    if ((mesh == NULL) || (mesh->vertices == NULL)) return;
+
+    UnloadMeshBVH(mesh);
+
+    int triangleCount = GetMeshTriangleCount(*mesh);
+    if (triangleCount <= 0) return;
+
+    MeshBVH *bvh = (MeshBVH *)RL_CALLOC(1, sizeof(MeshBVH));
+    bvh->nodes = (MeshBVHNode *)RL_MALLOC((2*triangleCount - 1)*sizeof(MeshBVHNode));
+    bvh->triangles = (Vector3 *)RL_MALLOC(triangleCount*3*sizeof(Vector3));
+    bvh->triangleCount = triangleCount;
+
+    // Triangles bounds and centroids (building only)
+    float *bounds = (float *)RL_MALLOC(triangleCount*6*sizeof(float));
+    float *centroids = (float *)RL_MALLOC(triangleCount*3*sizeof(float));
+    int *order = (int *)RL_MALLOC(triangleCount*sizeof(int));
+
+    for (int i = 0; i < triangleCount; i++)
+    {
+        Vector3 triangle[3] = { 0 };
+        GetMeshTriangle(*mesh, i, triangle);
+
+        bounds[i*6 + 0] = fminf(triangle[0].x, fminf(triangle[1].x, triangle[2].x));
+        bounds[i*6 + 1] = fminf(triangle[0].y, fminf(triangle[1].y, triangle[2].y));
+        bounds[i*6 + 2] = fminf(triangle[0].z, fminf(triangle[1].z, triangle[2].z));
+        bounds[i*6 + 3] = fmaxf(triangle[0].x, fmaxf(triangle[1].x, triangle[2].x));
+        bounds[i*6 + 4] = fmaxf(triangle[0].y, fmaxf(triangle[1].y, triangle[2].y));
+        bounds[i*6 + 5] = fmaxf(triangle[0].z, fmaxf(triangle[1].z, triangle[2].z));
+
+        for (int k = 0; k < 3; k++) centroids[i*3 + k] = (bounds[i*6 + k] + bounds[i*6 + 3 + k])*0.5f;
+
+        order[i] = i;
+    }
+
+    bvh->nodeCount = 1;
+    BuildMeshBVHNode(bvh, 0, order, bounds, centroids, 0, triangleCount, 0);
+
+    // Triangles vertices stored in leaves order, no indices indirection on queries
+    for (int i = 0; i < triangleCount; i++) GetMeshTriangle(*mesh, order[i], &bvh->triangles[i*3]);
+
+    bvh->nodes = (MeshBVHNode *)RL_REALLOC(bvh->nodes, bvh->nodeCount*sizeof(MeshBVHNode));
+
+    RL_FREE(order);
+    RL_FREE(centroids);
+    RL_FREE(bounds);
+
+    mesh->bvh = bvh;
+
+    TraceLog(LOG_INFO, "Mesh BVH built: %i triangles, %i nodes", triangleCount, bvh->nodeCount);
+}
+
+// Optimize mesh data for GPU drawing: weld duplicated vertices, reorder triangles for post-transform
+// vertex cache and overdraw, reorder vertices for fetch locality (MeshOptimizeFlags)
+// NOTE: Mesh data must be available in RAM (CPU), mesh is uploaded again to GPU if already loaded.
+// Unindexed meshes are indexed when welded, if welded vertices fit 16bit indices
+void MeshOptimize(Mesh *mesh, int flags)
+{
+    if ((mesh == NULL) || (mesh->vertices == NULL) || (mesh->vertexCount <= 0))
+    {
+        TraceLog(LOG_WARNING, "Mesh data not available in RAM (CPU), mesh can not be optimized");
+        return;
+    }
+
+    int vertexCount = mesh->vertexCount;
+    int triangleCount = GetMeshTriangleCount(*mesh);
+    int indexCount = triangleCount*3;
+
+    if (triangleCount <= 0) return;
+
+    if (mesh->indices != NULL)
+    {
+        for (int i = 0; i < indexCount; i++)
+        {
+            if (mesh->indices[i] >= vertexCount)
+            {
+                TraceLog(LOG_WARNING, "Mesh indices out of vertex data, mesh can not be optimized");
+                return;
+            }
+        }
+    }
+
+    // Invalidate cached bounding box, vertex data is replaced
+    MeshBoundsEntry *entry = GetMeshBoundsEntry(mesh->vertices);
+    if ((entry != NULL) && (entry->vertices == mesh->vertices)) entry->vertices = NULL;
+
+    float missRatio = (mesh->indices != NULL)? (float)SimulateMeshVertexCache(mesh->indices, indexCount, vertexCount, NULL)/triangleCount : 3.0f;
+    int *remap = (int *)RL_MALLOC(vertexCount*sizeof(int));
+
+    // Weld duplicated vertices (all vertex attributes equal)
+    if (flags & MESH_OPTIMIZE_WELD)
+    {
+        int uniqueCount = WeldMeshVertices(mesh, remap);
+
+        if (uniqueCount == vertexCount) { }     // No duplicated vertices, nothing to do
+        else if ((mesh->indices == NULL) && (uniqueCount > 65536)) TraceLog(LOG_WARNING, "Mesh welded vertices (%i) do not fit 16bit indices, mesh not welded", uniqueCount);
+        else
+        {
+            if (mesh->indices == NULL)
+            {
+                mesh->indices = (unsigned short *)RL_MALLOC(indexCount*sizeof(unsigned short));
+                for (int i = 0; i < indexCount; i++) mesh->indices[i] = (unsigned short)remap[i];
+                mesh->triangleCount = triangleCount;
+            }
+            else for (int i = 0; i < indexCount; i++) mesh->indices[i] = (unsigned short)remap[mesh->indices[i]];
+
+            RemapMeshVertices(mesh, remap, uniqueCount);
+        }
+    }
+
+    // Triangles and vertices reordering requires indexed data
+    if (mesh->indices != NULL)
+    {
+        if (flags & MESH_OPTIMIZE_VERTEX_CACHE) OptimizeMeshVertexCache(mesh->indices, indexCount, mesh->vertexCount);
+        if (flags & MESH_OPTIMIZE_OVERDRAW) OptimizeMeshOverdraw(mesh->indices, indexCount, mesh->vertices, mesh->vertexCount);
+
+        // Reorder vertices by first use in indices, unreferenced vertices are removed
+        if (flags & MESH_OPTIMIZE_VERTEX_FETCH)
+        {
+            int usedCount = 0;
+            for (int i = 0; i < mesh->vertexCount; i++) remap[i] = -1;
+
+            for (int i = 0; i < indexCount; i++)
+            {
+                if (remap[mesh->indices[i]] == -1) remap[mesh->indices[i]] = usedCount++;
+                mesh->indices[i] = (unsigned short)remap[mesh->indices[i]];
+            }
+
+            RemapMeshVertices(mesh, remap, usedCount);
+        }
+    }
+
+    RL_FREE(remap);
+
+    // Upload optimized mesh data again if already loaded in GPU
+    if ((mesh->vboId != NULL) && ((mesh->vaoId > 0) || (mesh->vboId[0] > 0)))
+    {
+        for (int i = 0; i < MAX_MESH_VBO; i++) rlDeleteBuffers(mesh->vboId[i]);
+        rlDeleteVertexArrays(mesh->vaoId);
+        mesh->vaoId = 0;
+
+        rlLoadMesh(mesh, false);
+    }
+
+    float optimizedMissRatio = (mesh->indices != NULL)? (float)SimulateMeshVertexCache(mesh->indices, indexCount, mesh->vertexCount, NULL)/triangleCount : 3.0f;
+
+    TraceLog(LOG_INFO, "Mesh optimized: %i -> %i vertices, vertex cache misses by triangle (ACMR) %.2f -> %.2f", vertexCount, mesh->vertexCount, missRatio, optimizedMissRatio);
+}
+
+// Generate simplified mesh (quadric error edge collapse), ratio is the fraction of triangles kept
+// NOTE: Mesh data must be available in RAM (CPU), vertices on mesh borders or attribute seams are not
+// collapsed (no cracks). Simplification error (model space distance) is returned if error is not NULL
+Mesh GenMeshSimplified(Mesh mesh, float ratio, float *error)
+{
+    Mesh result = { 0 };
+
+    if (error != NULL) *error = 0.0f;
+
+    if ((mesh.vertices == NULL) || (mesh.vertexCount <= 0))
+    {
+        TraceLog(LOG_WARNING, "Mesh data not available in RAM (CPU), mesh can not be simplified");
+        return result;
+    }
+
+    // Copy mesh vertex data, unindexed meshes are welded to get shared vertices
+    int triangleCount = GetMeshTriangleCount(mesh);
+    const void *arrays[MESH_VERTEX_ARRAYS] = { mesh.vertices, mesh.texcoords, mesh.texcoords2, mesh.normals, mesh.tangents, mesh.colors, mesh.boneIds, mesh.boneWeights };
+    void **resultArrays[MESH_VERTEX_ARRAYS] = { (void **)&result.vertices, (void **)&result.texcoords, (void **)&result.texcoords2, (void **)&result.normals,
+                                                (void **)&result.tangents, (void **)&result.colors, (void **)&result.boneIds, (void **)&result.boneWeights };
+    const int sizes[MESH_VERTEX_ARRAYS] = { 3*sizeof(float), 2*sizeof(float), 2*sizeof(float), 3*sizeof(float), 4*sizeof(float), 4*sizeof(unsigned char), 4*sizeof(int), 4*sizeof(float) };
+
+    for (int k = 0; k < MESH_VERTEX_ARRAYS; k++)
+    {
+        if (arrays[k] != NULL) *resultArrays[k] = memcpy(RL_MALLOC(mesh.vertexCount*sizes[k]), arrays[k], mesh.vertexCount*sizes[k]);
+    }
+
+    result.vertexCount = mesh.vertexCount;
+    result.triangleCount = triangleCount;
+
+    if (mesh.indices != NULL) result.indices = (unsigned short *)memcpy(RL_MALLOC(triangleCount*3*sizeof(unsigned short)), mesh.indices, triangleCount*3*sizeof(unsigned short));
+    else MeshOptimize(&result, MESH_OPTIMIZE_WELD);
+
+    if (result.indices != NULL)
+    {
+        int targetCount = (int)(triangleCount*ratio);
+        if (targetCount < 1) targetCount = 1;
+
+        float simplifyError = 0.0f;
+        result.triangleCount = SimplifyMeshIndices(result.indices, triangleCount*3, result.vertices, result.vertexCount, targetCount*3, &simplifyError)/3;
+
+        // Unreferenced vertices removed, remaining triangles reordered for vertex cache
+        MeshOptimize(&result, MESH_OPTIMIZE_VERTEX_CACHE | MESH_OPTIMIZE_VERTEX_FETCH);
+
+        if (error != NULL) *error = simplifyError;
+
+        TraceLog(LOG_INFO, "Mesh simplified: %i -> %i triangles (error: %f)", triangleCount, result.triangleCount, simplifyError);
+    }
+    else TraceLog(LOG_WARNING, "Mesh vertices could not be indexed, mesh not simplified");
+
+    // Upload vertex data to GPU (static mesh)
+    result.vboId = (unsigned int *)RL_CALLOC(MAX_MESH_VBO, sizeof(unsigned int));
+    rlLoadMesh(&result, false);
+
+    return result;
+}
+
+// Draw a model (with texture if set)
+void DrawModel(Model model, Vector3 position, float scale, Color tint)
+{
+    Vector3 vScale = { scale, scale, scale };
+    Vector3 rotationAxis = { 0.0f, 1.0f, 0.0f };
+
+    DrawModelEx(model, position, rotationAxis, 0.0f, vScale, tint);
+}
+
+// Draw a model with extended parameters
+void DrawModelEx(Model model, Vector3 position, Vector3 rotationAxis, float rotationAngle, Vector3 scale, Color tint)
+{
+    // Calculate transformation matrix from function parameters
+    // Get transform matrix (rotation -> scale -> translation)
+    Matrix matScale = MatrixScale(scale.x, scale.y, scale.z);
+    Matrix matRotation = MatrixRotate(rotationAxis, rotationAngle*DEG2RAD);
+    Matrix matTranslation = MatrixTranslate(position.x, position.y, position.z);
+
+    Matrix matTransform = MatrixMultiply(MatrixMultiply(matScale, matRotation), matTranslation);
+
+    // Combine model transformation matrix (model.transform) with matrix generated by function parameters (matTransform)
+    model.transform = MatrixMultiply(model.transform, matTransform);
+
+    // Level of detail meshes selected by simplification error on screen (GenModelLODs())
+    int level = GetModelLODLevel(model, model.transform);
+    Mesh *meshes = (level > 0)? &((ModelLODs *)model.lods)->meshes[(level - 1)*model.meshCount] : model.meshes;
+
+    for (int i = 0; i < model.meshCount; i++)
+    {
+        // TODO: Review color + tint premultiplication mechanism
+        Color color = model.materials[model.meshMaterial[i]].maps[MAP_DIFFUSE].color;
+        
+        Color colorTint = WHITE;
+        colorTint.r = (((float)color.r/255.0)*((float)tint.r/255.0))*255;
+        colorTint.g = (((float)color.g/255.0)*((float)tint.g/255.0))*255;
+        colorTint.b = (((float)color.b/255.0)*((float)tint.b/255.0))*255;
+        colorTint.a = (((float)color.a/255.0)*((float)tint.a/255.0))*255;
+        
+        if (modelCulling && !IsMeshVisible(meshes[i], model.transform)) continue;
+
+        if (transparentQueue.active)
+        {
+            // NOTE: Mesh depth measured at its bounds center if cached, at transform origin otherwise
+            Vector3 center = { 0.0f, 0.0f, 0.0f };
+            MeshBoundsEntry *entry = GetMeshBoundsEntry(meshes[i].vertices);
+
+            if ((entry != NULL) && (entry->vertices == meshes[i].vertices) && (entry->vertexCount == meshes[i].vertexCount))
+            {
+                center = Vector3Scale(Vector3Add(entry->bounds.min, entry->bounds.max), 0.5f);
+            }
+            else if ((meshes[i].vertices == NULL) && (meshes[i].bvh != NULL))
+            {
+                BoundingBox bounds = MeshBoundingBox(meshes[i]);
+                center = Vector3Scale(Vector3Add(bounds.min, bounds.max), 0.5f);
+            }
+
+            TransparentItem *item = AddTransparentItem(TRANSPARENT_MESH, Vector3Transform(center, model.transform));
+
+            if (item != NULL)
+            {
+                Material material = model.materials[model.meshMaterial[i]];
+
+                item->stateKey = material.shader.id*31 + material.maps[MAP_DIFFUSE].texture.id;
+                item->tint = colorTint;
+                item->mesh = meshes[i];
+                item->material = material;
+                item->transform = model.transform;
+                continue;
+            }
+        }
+
+        model.materials[model.meshMaterial[i]].maps[MAP_DIFFUSE].color = colorTint;
+        rlDrawMesh(meshes[i], model.materials[model.meshMaterial[i]], model.transform);
+        model.materials[model.meshMaterial[i]].maps[MAP_DIFFUSE].color = color;
+    }
+}
+
+// Draw a model wires (with texture if set)
+void DrawModelWires(Model model, Vector3 position, float scale, Color tint)
+{
+    rlEnableWireMode();
+
+    DrawModel(model, position, scale, tint);
+
+    rlDisableWireMode();
+}
+
+// Draw a model wires (with texture if set) with extended parameters
+void DrawModelWiresEx(Model model, Vector3 position, Vector3 rotationAxis, float rotationAngle, Vector3 scale, Color tint)
+{
+    rlEnableWireMode();
+
+    DrawModelEx(model, position, rotationAxis, rotationAngle, scale, tint);
+
+    rlDisableWireMode();
+}
+
+// Draw multiple mesh instances with material and different transforms
+// NOTE: Shader must provide per-instance transform attribute (instanceTransform) to use hardware instancing
+void DrawMeshInstanced(Mesh mesh, Material material, const Matrix *transforms, int instances)
+{
+    rlDrawMeshInstanced(mesh, material, transforms, instances);
+}
+
+// Set models frustum culling, meshes outside view are skipped on DrawModel()/DrawModelEx() (enabled by default)
+// NOTE: Disable it if shaders displace vertex positions further than mesh bounds
+void SetModelCulling(bool enabled)
+{
+    modelCulling = enabled;
+}
+
+// Set models LOD selection threshold, coarsest LOD level with simplification error on screen under threshold is drawn (1 pixel by default)
+void SetModelLODThreshold(float pixels)
+{
+    modelLODThreshold = pixels;
+}
+
+// Set glTF and rlmesh meshes data kept in RAM (CPU) after GPU upload (disabled by default)
+// NOTE: Meshes without CPU data can be drawn but not culled, exported or used on collision checks
+void SetModelKeepMeshData(bool keep)
+{
+    modelKeepMeshData = keep;
+}
+
+// Set loaded models meshes vertex attributes GPU storage formats (MeshVertexFormat flags, full floats by default)
+// NOTE: Combined with SetModelKeepMeshData(false) meshes vertex data is only kept in VRAM (GPU) in compact formats
+void SetModelMeshFormat(int formats)
+{
+    modelMeshFormat = formats;
+}
+
+// Get mesh instances inside view frustum, visible transforms are copied to visibleTransforms (returns count)
+// NOTE: visibleTransforms can be the same array as transforms, visible instances are compacted in place
+int GetVisibleInstances(Mesh mesh, const Matrix *transforms, int instances, Matrix *visibleTransforms)
+{
+    int count = 0;
+
+    for (int i = 0; i < instances; i++)
+    {
+        if (IsMeshVisible(mesh, transforms[i]))
+        {
+            visibleTransforms[count] = transforms[i];
+            count++;
+        }
+    }
+
+    return count;
+}
+
+// Begin transparent queue, DrawModelEx() and DrawBillboard*() calls are deferred and drawn
+// back-to-front (sorted by view depth) on EndMode3D()
+// NOTE: Models materials and textures must be kept loaded until EndMode3D()
+void BeginTransparentQueue(void)
+{
+    if (transparentQueue.items == NULL)
+    {
+        transparentQueue.items = (TransparentItem *)RL_MALLOC(MAX_TRANSPARENT_QUEUE*sizeof(TransparentItem));
+        transparentQueue.depths = (float *)RL_MALLOC(MAX_TRANSPARENT_QUEUE*sizeof(float));
+        transparentQueue.keys = (unsigned int *)RL_MALLOC(2*MAX_TRANSPARENT_QUEUE*sizeof(unsigned int));
+        transparentQueue.order = (unsigned int *)RL_MALLOC(2*MAX_TRANSPARENT_QUEUE*sizeof(unsigned int));
+    }
+
+    transparentQueue.active = true;
+}
+
+// End transparent queue, following draws are not deferred (queued items are still drawn on EndMode3D())
+void EndTransparentQueue(void)
+{
+    transparentQueue.active = false;
+}
+
+// Draw transparent queue items back-to-front and clear queue
+// NOTE: Consecutive billboards are accumulated in the same render batch,
+// meshes with same depth are grouped by render state (shader and texture)
+void FlushTransparentQueue(void)
+{
+    transparentQueue.active = false;
+
+    if (transparentQueue.count == 0) return;
+
+    SortTransparentQueue();
+
+    bool billboardsPending = false;
+
+    for (int i = 0; i < transparentQueue.count; i++)
+    {
+        TransparentItem *item = &transparentQueue.items[transparentQueue.order[i]];
+
+        if (item->type == TRANSPARENT_BILLBOARD)
+        {
+            if (rlCheckBufferLimit(4)) rlglDraw();
+
+            rlEnableTexture(item->textureId);
+
+            rlBegin(RL_QUADS);
+                rlColor4ub(item->tint.r, item->tint.g, item->tint.b, item->tint.a);
+                rlQuadBatch(item->vertices, item->texcoords, NULL, 1);
+            rlEnd();
+
+            rlDisableTexture();
+
+            billboardsPending = true;
+        }
+        else
+        {
+            // NOTE: Meshes are drawn directly, pending billboards behind them must be drawn first
+            if (billboardsPending) rlglDraw();
+            billboardsPending = false;
+
+            Color color = item->material.maps[MAP_DIFFUSE].color;
+
+            item->material.maps[MAP_DIFFUSE].color = item->tint;
+            rlDrawMesh(item->mesh, item->material, item->transform);
+            item->material.maps[MAP_DIFFUSE].color = color;
+        }
+    }
+
+    transparentQueue.count = 0;
+}
+
+// Draw a billboard
+void DrawBillboard(Camera camera, Texture2D texture, Vector3 center, float size, Color tint)
+{
+    Rectangle sourceRec = { 0.0f, 0.0f, (float)texture.width, (float)texture.height };
+
+    DrawBillboardRec(camera, texture, sourceRec, center, size, tint);
+}
+
+// Draw a billboard (part of a texture defined by a rectangle)
+void DrawBillboardRec(Camera camera, Texture2D texture, Rectangle sourceRec, Vector3 center, float size, Color tint)
+{
+    // NOTE: Billboard size will maintain sourceRec aspect ratio, size will represent billboard width
+    Vector2 sizeRatio = { size, size*(float)sourceRec.height/sourceRec.width };
+
+    Matrix matView = GetCameraMatrix(camera);   // Cached view matrix (camera used on BeginMode3D())
+
+    Vector3 right = { matView.m0, matView.m4, matView.m8 };
+    //Vector3 up = { matView.m1, matView.m5, matView.m9 };
+
+    // NOTE: Billboard locked on axis-Y
+    Vector3 up = { 0.0f, 1.0f, 0.0f };
+/*
+    a-------b
+    |       |
+    |   *   |
+    |       |
+    d-------c
+*/
+    right = Vector3Scale(right, sizeRatio.x/2);
+    up = Vector3Scale(up, sizeRatio.y/2);
+
+    Vector3 p1 = Vector3Add(right, up);
+    Vector3 p2 = Vector3Subtract(right, up);
+
+    Vector3 a = Vector3Subtract(center, p2);
+    Vector3 b = Vector3Add(center, p1);
+    Vector3 c = Vector3Add(center, p2);
+    Vector3 d = Vector3Subtract(center, p1);
+
+    TransparentItem *item = AddTransparentItem(TRANSPARENT_BILLBOARD, center);
+
+    if (item != NULL)
+    {
+        // NOTE: Same vertex order and texcoords than direct drawing below
+        const float u0 = (float)sourceRec.x/texture.width;
+        const float u1 = (float)(sourceRec.x + sourceRec.width)/texture.width;
+        const float v0 = (float)sourceRec.y/texture.height;
+        const float v1 = (float)(sourceRec.y + sourceRec.height)/texture.height;
+
+        const float vertices[4*3] = { a.x, a.y, a.z, d.x, d.y, d.z, c.x, c.y, c.z, b.x, b.y, b.z };
+        const float texcoords[4*2] = { u0, v0, u0, v1, u1, v1, u1, v0 };
+
+        item->stateKey = texture.id;
+        item->tint = tint;
+        item->textureId = texture.id;
+        memcpy(item->vertices, vertices, sizeof(vertices));
+        memcpy(item->texcoords, texcoords, sizeof(texcoords));
+        return;
+    }
+
+    if (rlCheckBufferLimit(4)) rlglDraw();
+
+    rlEnableTexture(texture.id);
+
+    rlBegin(RL_QUADS);
+        rlColor4ub(tint.r, tint.g, tint.b, tint.a);
+
+        // Bottom-left corner for texture and quad
+        rlTexCoord2f((float)sourceRec.x/texture.width, (float)sourceRec.y/texture.height);
+        rlVertex3f(a.x, a.y, a.z);
+
+        // Top-left corner for texture and quad
+        rlTexCoord2f((float)sourceRec.x/texture.width, (float)(sourceRec.y + sourceRec.height)/texture.height);
+        rlVertex3f(d.x, d.y, d.z);
+
+        // Top-right corner for texture and quad
+        rlTexCoord2f((float)(sourceRec.x + sourceRec.width)/texture.width, (float)(sourceRec.y + sourceRec.height)/texture.height);
+        rlVertex3f(c.x, c.y, c.z);
+
+        // Bottom-right corner for texture and quad
+        rlTexCoord2f((float)(sourceRec.x + sourceRec.width)/texture.width, (float)sourceRec.y/texture.height);
+        rlVertex3f(b.x, b.y, b.z);
+    rlEnd();
+
+    rlDisableTexture();
+}
+
+// Draw a set of billboards texture, quads facing camera (locked on axis-Y)
+// NOTE: Billboards are drawn in one call in set order, they are not depth sorted with transparent items
+void DrawBillboardSet(Camera camera, Texture2D texture, BillboardSet billboards)
+{
+    if ((billboards.count <= 0) || (billboards.positions == NULL) || (billboards.sizes == NULL)) return;
+
+    Matrix matView = MatrixLookAt(camera.position, camera.target, camera.up);
+
+    Vector3 right = { matView.m0, matView.m4, matView.m8 };
+    Vector3 up = { 0.0f, 1.0f, 0.0f };
+
+    rlDrawBillboards(texture, billboards.positions, billboards.sizes, billboards.colors, billboards.sources, billboards.count, right, up);
+}
+
+// Draw a bounding box with wires
+void DrawBoundingBox(BoundingBox box, Color color)
+{
+    Vector3 size;
+
+    size.x = (float)fabs(box.max.x - box.min.x);
+    size.y = (float)fabs(box.max.y - box.min.y);
+    size.z = (float)fabs(box.max.z - box.min.z);
+
+    Vector3 center = { box.min.x + size.x/2.0f, box.min.y + size.y/2.0f, box.min.z + size.z/2.0f };
+
+    DrawCubeWires(center, size.x, size.y, size.z, color);
+}
+
+// Detect collision between two spheres
+bool CheckCollisionSpheres(Vector3 centerA, float radiusA, Vector3 centerB, float radiusB)
+{
+    bool collision = false;
+
+    // Simple way to check for collision, just checking distance between two points
+    // Unfortunately, sqrtf() is a costly operation, so we avoid it with following solution
+    /*
+    float dx = centerA.x - centerB.x;      // X distance between centers
+    float dy = centerA.y - centerB.y;      // Y distance between centers
+    float dz = centerA.z - centerB.z;      // Z distance between centers
+
+    float distance = sqrtf(dx*dx + dy*dy + dz*dz);  // Distance between centers
+
+    if (distance <= (radiusA + radiusB)) collision = true;
+    */
+
+    // Check for distances squared to avoid sqrtf()
+    if (Vector3DotProduct(Vector3Subtract(centerB, centerA), Vector3Subtract(centerB, centerA)) <= (radiusA + radiusB)*(radiusA + radiusB)) collision = true;
+
+    return collision;
+}
+
+// Detect collision between two boxes
+// NOTE: Boxes are defined by two points minimum and maximum
+bool CheckCollisionBoxes(BoundingBox box1, BoundingBox box2)
+{
+    bool collision = true;
+
+    if ((box1.max.x >= box2.min.x) && (box1.min.x <= box2.max.x))
+    {
+        if ((box1.max.y < box2.min.y) || (box1.min.y > box2.max.y)) collision = false;
+        if ((box1.max.z < box2.min.z) || (box1.min.z > box2.max.z)) collision = false;
+    }
+    else collision = false;
+
+    return collision;
+}
+
+// Detect collision between box and sphere
+bool CheckCollisionBoxSphere(BoundingBox box, Vector3 center, float radius)
+{
+    bool collision = false;
+
+    float dmin = 0;
+
+    if (center.x < box.min.x) dmin += powf(center.x - box.min.x, 2);
+    else if (center.x > box.max.x) dmin += powf(center.x - box.max.x, 2);
+
+    if (center.y < box.min.y) dmin += powf(center.y - box.min.y, 2);
+    else if (center.y > box.max.y) dmin += powf(center.y - box.max.y, 2);
+
+    if (center.z < box.min.z) dmin += powf(center.z - box.min.z, 2);
+    else if (center.z > box.max.z) dmin += powf(center.z - box.max.z, 2);
+
+    if (dmin <= (radius*radius)) collision = true;
+
+    return collision;
+}
+
+// Detect collision between ray and sphere
+bool CheckCollisionRaySphere(Ray ray, Vector3 center, float radius)
+{
+    bool collision = false;
+
+    Vector3 raySpherePos = Vector3Subtract(center, ray.position);
+    float distance = Vector3Length(raySpherePos);
+    float vector = Vector3DotProduct(raySpherePos, ray.direction);
+    float d = radius*radius - (distance*distance - vector*vector);
+
+    if (d >= 0.0f) collision = true;
+
+    return collision;
+}
+
+// Detect collision between ray and spheres set (batched), returns number of spheres hit
+// NOTE: hitMask (optional) must hold (spheres.count + 31)/32 values, hitIndices (optional) must hold spheres.count values
+int CheckCollisionRaySphereBatch(Ray ray, SphereSet spheres, unsigned int *hitMask, int *hitIndices)
+{
+    if (hitMask != NULL) memset(hitMask, 0, ((spheres.count + 31)/32)*sizeof(unsigned int));
+
+    int hitCount = 0;
+    int i = 0;
+
+#if defined(MODELS_SIMD_SSE)
+    __m128 posX = _mm_set1_ps(ray.position.x), posY = _mm_set1_ps(ray.position.y), posZ = _mm_set1_ps(ray.position.z);
+    __m128 dirX = _mm_set1_ps(ray.direction.x), dirY = _mm_set1_ps(ray.direction.y), dirZ = _mm_set1_ps(ray.direction.z);
+
+    for (; i + 4 <= spheres.count; i += 4)
+    {
+        __m128 px = _mm_sub_ps(_mm_loadu_ps(spheres.x + i), posX);
+        __m128 py = _mm_sub_ps(_mm_loadu_ps(spheres.y + i), posY);
+        __m128 pz = _mm_sub_ps(_mm_loadu_ps(spheres.z + i), posZ);
+        __m128 radius = _mm_loadu_ps(spheres.radius + i);
+
+        __m128 distance = _mm_add_ps(_mm_add_ps(_mm_mul_ps(px, px), _mm_mul_ps(py, py)), _mm_mul_ps(pz, pz));
+        __m128 vector = _mm_add_ps(_mm_add_ps(_mm_mul_ps(px, dirX), _mm_mul_ps(py, dirY)), _mm_mul_ps(pz, dirZ));
+        __m128 d = _mm_sub_ps(_mm_mul_ps(radius, radius), _mm_sub_ps(distance, _mm_mul_ps(vector, vector)));
+
+        unsigned int mask = (unsigned int)_mm_movemask_ps(_mm_cmpge_ps(d, _mm_setzero_ps()));
+        if (mask != 0) hitCount = StoreBatchHits(i, mask, hitMask, hitIndices, hitCount);
+    }
+#elif defined(MODELS_SIMD_NEON)
+    float32x4_t posX = vdupq_n_f32(ray.position.x), posY = vdupq_n_f32(ray.position.y), posZ = vdupq_n_f32(ray.position.z);
+    float32x4_t dirX = vdupq_n_f32(ray.direction.x), dirY = vdupq_n_f32(ray.direction.y), dirZ = vdupq_n_f32(ray.direction.z);
+
+    for (; i + 4 <= spheres.count; i += 4)
+    {
+        float32x4_t px = vsubq_f32(vld1q_f32(spheres.x + i), posX);
+        float32x4_t py = vsubq_f32(vld1q_f32(spheres.y + i), posY);
+        float32x4_t pz = vsubq_f32(vld1q_f32(spheres.z + i), posZ);
+        float32x4_t radius = vld1q_f32(spheres.radius + i);
+
+        float32x4_t distance = vaddq_f32(vaddq_f32(vmulq_f32(px, px), vmulq_f32(py, py)), vmulq_f32(pz, pz));
+        float32x4_t vector = vaddq_f32(vaddq_f32(vmulq_f32(px, dirX), vmulq_f32(py, dirY)), vmulq_f32(pz, dirZ));
+        float32x4_t d = vsubq_f32(vmulq_f32(radius, radius), vsubq_f32(distance, vmulq_f32(vector, vector)));
+
+        unsigned int mask = GetLanesMask(vcgeq_f32(d, vdupq_n_f32(0.0f)));
+        if (mask != 0) hitCount = StoreBatchHits(i, mask, hitMask, hitIndices, hitCount);
+    }
+#endif
+
+    // Remaining spheres (or all spheres without SIMD support)
+    for (; i < spheres.count; i++)
+    {
+        Vector3 raySpherePos = { spheres.x[i] - ray.position.x, spheres.y[i] - ray.position.y, spheres.z[i] - ray.position.z };
+        float distance = Vector3DotProduct(raySpherePos, raySpherePos);
+        float vector = Vector3DotProduct(raySpherePos, ray.direction);
+        float d = spheres.radius[i]*spheres.radius[i] - (distance - vector*vector);
+
+        if (d >= 0.0f) hitCount = StoreBatchHits(i, 1, hitMask, hitIndices, hitCount);
+    }
+
+    return hitCount;
+}
+
+// Detect collision between box and boxes set (batched), returns number of boxes hit
+// NOTE: hitMask (optional) must hold (boxes.count + 31)/32 values, hitIndices (optional) must hold boxes.count values
+int CheckCollisionBoxesBatch(BoundingBox box, BoundingBoxSet boxes, unsigned int *hitMask, int *hitIndices)
+{
+    if (hitMask != NULL) memset(hitMask, 0, ((boxes.count + 31)/32)*sizeof(unsigned int));
+
+    int hitCount = 0;
+    int i = 0;
+
+#if defined(MODELS_SIMD_SSE)
+    __m128 minX = _mm_set1_ps(box.min.x), minY = _mm_set1_ps(box.min.y), minZ = _mm_set1_ps(box.min.z);
+    __m128 maxX = _mm_set1_ps(box.max.x), maxY = _mm_set1_ps(box.max.y), maxZ = _mm_set1_ps(box.max.z);
+
+    for (; i + 4 <= boxes.count; i += 4)
+    {
+        __m128 overlapX = _mm_and_ps(_mm_cmpge_ps(maxX, _mm_loadu_ps(boxes.minX + i)), _mm_cmple_ps(minX, _mm_loadu_ps(boxes.maxX + i)));
+        __m128 overlapY = _mm_and_ps(_mm_cmpge_ps(maxY, _mm_loadu_ps(boxes.minY + i)), _mm_cmple_ps(minY, _mm_loadu_ps(boxes.maxY + i)));
+        __m128 overlapZ = _mm_and_ps(_mm_cmpge_ps(maxZ, _mm_loadu_ps(boxes.minZ + i)), _mm_cmple_ps(minZ, _mm_loadu_ps(boxes.maxZ + i)));
+
+        unsigned int mask = (unsigned int)_mm_movemask_ps(_mm_and_ps(_mm_and_ps(overlapX, overlapY), overlapZ));
+        if (mask != 0) hitCount = StoreBatchHits(i, mask, hitMask, hitIndices, hitCount);
+    }
+#elif defined(MODELS_SIMD_NEON)
+    float32x4_t minX = vdupq_n_f32(box.min.x), minY = vdupq_n_f32(box.min.y), minZ = vdupq_n_f32(box.min.z);
+    float32x4_t maxX = vdupq_n_f32(box.max.x), maxY = vdupq_n_f32(box.max.y), maxZ = vdupq_n_f32(box.max.z);
+
+    for (; i + 4 <= boxes.count; i += 4)
+    {
+        uint32x4_t overlapX = vandq_u32(vcgeq_f32(maxX, vld1q_f32(boxes.minX + i)), vcleq_f32(minX, vld1q_f32(boxes.maxX + i)));
+        uint32x4_t overlapY = vandq_u32(vcgeq_f32(maxY, vld1q_f32(boxes.minY + i)), vcleq_f32(minY, vld1q_f32(boxes.maxY + i)));
+        uint32x4_t overlapZ = vandq_u32(vcgeq_f32(maxZ, vld1q_f32(boxes.minZ + i)), vcleq_f32(minZ, vld1q_f32(boxes.maxZ + i)));
+
+        unsigned int mask = GetLanesMask(vandq_u32(vandq_u32(overlapX, overlapY), overlapZ));
+        if (mask != 0) hitCount = StoreBatchHits(i, mask, hitMask, hitIndices, hitCount);
+    }
+#endif
+
+    // Remaining boxes (or all boxes without SIMD support)
+    for (; i < boxes.count; i++)
+    {
+        if ((box.max.x >= boxes.minX[i]) && (box.min.x <= boxes.maxX[i]) &&
+            (box.max.y >= boxes.minY[i]) && (box.min.y <= boxes.maxY[i]) &&
+            (box.max.z >= boxes.minZ[i]) && (box.min.z <= boxes.maxZ[i])) hitCount = StoreBatchHits(i, 1, hitMask, hitIndices, hitCount);
+    }
+
+    return hitCount;
+}
+
+// Detect collision between ray and sphere with extended parameters and collision point detection
+bool CheckCollisionRaySphereEx(Ray ray, Vector3 center, float radius, Vector3 *collisionPoint)
+{
+    bool collision = false;
+
+    Vector3 raySpherePos = Vector3Subtract(center, ray.position);
+    float distance = Vector3Length(raySpherePos);
+    float vector = Vector3DotProduct(raySpherePos, ray.direction);
+    float d = radius*radius - (distance*distance - vector*vector);
+
+    if (d >= 0.0f) collision = true;
+
+    // Check if ray origin is inside the sphere to calculate the correct collision point
+    float collisionDistance = 0;
+
+    if (distance < radius) collisionDistance = vector + sqrtf(d);
+    else collisionDistance = vector - sqrtf(d);
+
+    // Calculate collision point
+    Vector3 cPoint = Vector3Add(ray.position, Vector3Scale(ray.direction, collisionDistance));
+
+    collisionPoint->x = cPoint.x;
+    collisionPoint->y = cPoint.y;
+    collisionPoint->z = cPoint.z;
+
+    return collision;
+}
+
+// Detect collision between ray and bounding box
+bool CheckCollisionRayBox(Ray ray, BoundingBox box)
+{
+    bool collision = false;
+
+    float t[8];
+    t[0] = (box.min.x - ray.position.x)/ray.direction.x;
+    t[1] = (box.max.x - ray.position.x)/ray.direction.x;
+    t[2] = (box.min.y - ray.position.y)/ray.direction.y;
+    t[3] = (box.max.y - ray.position.y)/ray.direction.y;
+    t[4] = (box.min.z - ray.position.z)/ray.direction.z;
+    t[5] = (box.max.z - ray.position.z)/ray.direction.z;
+    t[6] = (float)fmax(fmax(fmin(t[0], t[1]), fmin(t[2], t[3])), fmin(t[4], t[5]));
+    t[7] = (float)fmin(fmin(fmax(t[0], t[1]), fmax(t[2], t[3])), fmax(t[4], t[5]));
+
+    collision = !(t[7] < 0 || t[6] > t[7]);
+
+    return collision;
+}
+
+// Get collision info between ray and model
+// NOTE: Meshes with BVH (MeshBuildBVH()) are not tested triangle by triangle
+RayHitInfo GetCollisionRayModel(Ray ray, Model model)
+{
+    RayHitInfo result = { 0 };
+
+    for (int m = 0; m < model.meshCount; m++)
+    {
+        RayHitInfo meshHitInfo = GetCollisionRayMesh(ray, model.meshes[m], model.transform);
+
+        // Save the closest hit mesh
+        if (meshHitInfo.hit && ((!result.hit) || (result.distance > meshHitInfo.distance))) result = meshHitInfo;
+    }
+
+    return result;
+}
+
+// Get collision info between ray and mesh (nearest hit)
+// NOTE: Mesh BVH is traversed if built (MeshBuildBVH()), all mesh triangles are tested otherwise
+RayHitInfo GetCollisionRayMesh(Ray ray, Mesh mesh, Matrix transform)
+{
+    RayHitInfo result = { 0 };
+
+    MeshBVH *bvh = (MeshBVH *)mesh.bvh;
+
+    // Check if mesh has vertex data on CPU for testing
+    // NOTE: Meshes without CPU data are tested against their BVH, if kept (UnloadMeshCPUData())
+    if ((mesh.vertices == NULL) && ((bvh == NULL) || (bvh->triangleCount == 0))) return result;
+
+    if (bvh == NULL)
+    {
+        int triangleCount = GetMeshTriangleCount(mesh);
+
+        // Test against all triangles in mesh
+        for (int i = 0; i < triangleCount; i++)
+        {
+            Vector3 triangle[3] = { 0 };
+            GetMeshTriangle(mesh, i, triangle);
+
+            RayHitInfo triHitInfo = GetCollisionRayTriangle(ray, Vector3Transform(triangle[0], transform), Vector3Transform(triangle[1], transform), Vector3Transform(triangle[2], transform));
+
+            // Save the closest hit triangle
+            if (triHitInfo.hit && ((!result.hit) || (result.distance > triHitInfo.distance))) result = triHitInfo;
+        }
+
+        return result;
+    }
+
+    // Ray transformed to mesh space, direction is not normalized to keep hits distances
+    Matrix invTransform = MatrixInvert(transform);
+    Ray localRay = { 0 };
+    localRay.position = Vector3Transform(ray.position, invTransform);
+    localRay.direction = Vector3Subtract(Vector3Transform(Vector3Add(ray.position, ray.direction), invTransform), localRay.position);
+
+    Vector3 invDir = { 1.0f/localRay.direction.x, 1.0f/localRay.direction.y, 1.0f/localRay.direction.z };
+
+    float nearest = FLT_MAX;
+    int nearestTriangle = -1;
+
+    // Nodes stack, nearest child is traversed first and farther nodes are skipped once a closer hit is found
+    int stack[MAX_BVH_DEPTH + 1] = { 0 };
+    float stackDistances[MAX_BVH_DEPTH + 1] = { 0 };
+    int stackSize = 0;
+    float distance = 0.0f;
+
+    if (GetRayBoxDistance(localRay.position, invDir, bvh->nodes[0].min, bvh->nodes[0].max, nearest, &distance))
+    {
+        stack[0] = 0;
+        stackDistances[0] = distance;
+        stackSize = 1;
+    }
+
+    while (stackSize > 0)
+    {
+        stackSize--;
+        if (stackDistances[stackSize] > nearest) continue;
+
+        const MeshBVHNode *node = &bvh->nodes[stack[stackSize]];
+
+        if (node->count > 0)
+        {
+            for (int i = node->start; i < (node->start + node->count); i++)
+            {
+                RayHitInfo triHitInfo = GetCollisionRayTriangle(localRay, bvh->triangles[i*3], bvh->triangles[i*3 + 1], bvh->triangles[i*3 + 2]);
+
+                if (triHitInfo.hit && (triHitInfo.distance < nearest))
+                {
+                    nearest = triHitInfo.distance;
+                    nearestTriangle = i;
+                }
+            }
+        }
+        else
+        {
+            float distance1 = 0.0f;
+            float distance2 = 0.0f;
+            bool hit1 = GetRayBoxDistance(localRay.position, invDir, bvh->nodes[node->start].min, bvh->nodes[node->start].max, nearest, &distance1);
+            bool hit2 = GetRayBoxDistance(localRay.position, invDir, bvh->nodes[node->start + 1].min, bvh->nodes[node->start + 1].max, nearest, &distance2);
+            int child = node->start;
+
+            // Farther child pushed first, nearest child popped first
+            if (hit1 && hit2 && (distance2 < distance1))
+            {
+                stack[stackSize] = child; stackDistances[stackSize] = distance1; stackSize++;
+                stack[stackSize] = child + 1; stackDistances[stackSize] = distance2; stackSize++;
+            }
+            else
+            {
+                if (hit2) { stack[stackSize] = child + 1; stackDistances[stackSize] = distance2; stackSize++; }
+                if (hit1) { stack[stackSize] = child; stackDistances[stackSize] = distance1; stackSize++; }
+            }
+        }
+    }
+
+    if (nearestTriangle >= 0)
+    {
+        // Hit point and normal computed in world space
+        Vector3 p1 = Vector3Transform(bvh->triangles[nearestTriangle*3], transform);
+        Vector3 p2 = Vector3Transform(bvh->triangles[nearestTriangle*3 + 1], transform);
+        Vector3 p3 = Vector3Transform(bvh->triangles[nearestTriangle*3 + 2], transform);
+
+        result.hit = true;
+        result.distance = nearest;
+        result.position = Vector3Add(ray.position, Vector3Scale(ray.direction, nearest));
+        result.normal = Vector3Normalize(Vector3CrossProduct(Vector3Subtract(p2, p1), Vector3Subtract(p3, p1)));
+    }
+
+    return result;
+}
+
+// Get collision info between sphere and mesh, nearest mesh point inside sphere
+// NOTE: Hit normal points from mesh to sphere center, hit distance is distance to sphere center
+RayHitInfo GetCollisionSphereMesh(Vector3 center, float radius, Mesh mesh, Matrix transform)
+{
+    RayHitInfo result = { 0 };
+    result.distance = radius;
+
+    MeshBVH *bvh = (MeshBVH *)mesh.bvh;
+    if ((mesh.vertices == NULL) && ((bvh == NULL) || (bvh->triangleCount == 0))) return result;
+
+    if (bvh == NULL)
+    {
+        int triangleCount = GetMeshTriangleCount(mesh);
+
+        for (int i = 0; i < triangleCount; i++)
+        {
+            Vector3 triangle[3] = { 0 };
+            GetMeshTriangle(mesh, i, triangle);
+            GetCollisionSphereTriangle(center, Vector3Transform(triangle[0], transform), Vector3Transform(triangle[1], transform), Vector3Transform(triangle[2], transform), &result);
+        }
+    }
+    else
+    {
+        // NOTE: Nodes are tested against sphere bounds transformed to mesh space, bounds shrink with nearest hit
+        Matrix invTransform = MatrixInvert(transform);
+        BoundingBox bounds = TransformBoundingBox(GetSphereBoundingBox(center, radius), invTransform);
+
+        int stack[MAX_BVH_DEPTH + 1] = { 0 };
+        int stackSize = 1;
+
+        while (stackSize > 0)
+        {
+            const MeshBVHNode *node = &bvh->nodes[stack[--stackSize]];
+
+            if (!CheckCollisionBoxes(bounds, (BoundingBox){ node->min, node->max })) continue;
+
+            if (node->count > 0)
+            {
+                bool hit = result.hit;
+                float distance = result.distance;
+
+                for (int i = node->start; i < (node->start + node->count); i++)
+                {
+                    GetCollisionSphereTriangle(center, Vector3Transform(bvh->triangles[i*3], transform), Vector3Transform(bvh->triangles[i*3 + 1], transform), Vector3Transform(bvh->triangles[i*3 + 2], transform), &result);
+                }
+
+                if ((result.hit != hit) || (result.distance < distance)) bounds = TransformBoundingBox(GetSphereBoundingBox(center, result.distance), invTransform);
+            }
+            else
+            {
+                stack[stackSize++] = node->start + 1;
+                stack[stackSize++] = node->start;
+            }
+        }
+    }
+
+    if (!result.hit) result.distance = 0.0f;
+
+    return result;
+}
+
+// Get collision info between box and mesh, nearest triangle overlapping box (from box center)
+// NOTE: Hit position is triangle point nearest to box center, hit normal is triangle normal
+RayHitInfo GetCollisionBoxMesh(BoundingBox box, Mesh mesh, Matrix transform)
+{
+    RayHitInfo result = { 0 };
+    result.distance = FLT_MAX;
+
+    MeshBVH *bvh = (MeshBVH *)mesh.bvh;
+    if ((mesh.vertices == NULL) && ((bvh == NULL) || (bvh->triangleCount == 0))) return result;
+
+    Vector3 center = Vector3Scale(Vector3Add(box.min, box.max), 0.5f);
+    Vector3 extents = Vector3Scale(Vector3Subtract(box.max, box.min), 0.5f);
+
+    if (bvh == NULL)
+    {
+        int triangleCount = GetMeshTriangleCount(mesh);
+
+        for (int i = 0; i < triangleCount; i++)
+        {
+            Vector3 triangle[3] = { 0 };
+            GetMeshTriangle(mesh, i, triangle);
+            GetCollisionBoxTriangle(center, extents, Vector3Transform(triangle[0], transform), Vector3Transform(triangle[1], transform), Vector3Transform(triangle[2], transform), &result);
+        }
+    }
+    else
+    {
+        // NOTE: Nodes are tested against box bounds transformed to mesh space
+        BoundingBox bounds = TransformBoundingBox(box, MatrixInvert(transform));
+
+        int stack[MAX_BVH_DEPTH + 1] = { 0 };
+        int stackSize = 1;
+
+        while (stackSize > 0)
+        {
+            const MeshBVHNode *node = &bvh->nodes[stack[--stackSize]];
+
+            if (!CheckCollisionBoxes(bounds, (BoundingBox){ node->min, node->max })) continue;
+
+            if (node->count > 0)
+            {
+                for (int i = node->start; i < (node->start + node->count); i++)
+                {
+                    GetCollisionBoxTriangle(center, extents, Vector3Transform(bvh->triangles[i*3], transform), Vector3Transform(bvh->triangles[i*3 + 1], transform), Vector3Transform(bvh->triangles[i*3 + 2], transform), &result);
+                }
+            }
+            else
+            {
+                stack[stackSize++] = node->start + 1;
+                stack[stackSize++] = node->start;
+            }
+        }
+    }
+
+    if (!result.hit) result.distance = 0.0f;
+
+    return result;
+}
+
+// Get collision info between ray and triangle
+// NOTE: Based on https://en.wikipedia.org/wiki/M%C3%B6ller%E2%80%93Trumbore_intersection_algorithm
+RayHitInfo GetCollisionRayTriangle(Ray ray, Vector3 p1, Vector3 p2, Vector3 p3)
+{
+    #define EPSILON 0.000001        // A small number
+
+    Vector3 edge1, edge2;
+    Vector3 p, q, tv;
+    float det, invDet, u, v, t;
+    RayHitInfo result = {0};
+
+    // Find vectors for two edges sharing V1
+    edge1 = Vector3Subtract(p2, p1);
+    edge2 = Vector3Subtract(p3, p1);
+
+    // Begin calculating determinant - also used to calculate u parameter
+    p = Vector3CrossProduct(ray.direction, edge2);
+
+    // If determinant is near zero, ray lies in plane of triangle or ray is parallel to plane of triangle
+    det = Vector3DotProduct(edge1, p);
+
+    // Avoid culling!
+    if ((det > -EPSILON) && (det < EPSILON)) return result;
+
+    invDet = 1.0f/det;
+
+    // Calculate distance from V1 to ray origin
+    tv = Vector3Subtract(ray.position, p1);
+
+    // Calculate u parameter and test bound
+    u = Vector3DotProduct(tv, p)*invDet;
+
+    // The intersection lies outside of the triangle
+    if ((u < 0.0f) || (u > 1.0f)) return result;
+
+    // Prepare to test v parameter
+    q = Vector3CrossProduct(tv, edge1);
+
+    // Calculate V parameter and test bound
+    v = Vector3DotProduct(ray.direction, q)*invDet;
+
+    // The intersection lies outside of the triangle
+    if ((v < 0.0f) || ((u + v) > 1.0f)) return result;
+
+    t = Vector3DotProduct(edge2, q)*invDet;
+
+    if (t > EPSILON)
+    {
+        // Ray hit, get hit point and normal
+        result.hit = true;
+        result.distance = t;
+        result.hit = true;
+        result.normal = Vector3Normalize(Vector3CrossProduct(edge1, edge2));
+        result.position = Vector3Add(ray.position, Vector3Scale(ray.direction, t));
+    }
+
+    return result;
+}
+
+// Get collision info between ray and ground plane (Y-normal plane)
+RayHitInfo GetCollisionRayGround(Ray ray, float groundHeight)
+{
+    #define EPSILON 0.000001        // A small number
+
+    RayHitInfo result = { 0 };
+
+    if (fabs(ray.direction.y) > EPSILON)
+    {
+        float distance = (ray.position.y - groundHeight)/-ray.direction.y;
+
+        if (distance >= 0.0)
+        {
+            result.hit = true;
+            result.distance = distance;
+            result.normal = (Vector3){ 0.0, 1.0, 0.0 };
+            result.position = Vector3Add(ray.position, Vector3Scale(ray.direction, distance));
+        }
+    }
+
+    return result;
+}
+
+// Load spatial index, dynamic bounding boxes tree for broadphase collision queries
+// NOTE: Entries boxes are enlarged by margin in tree, small box movements do not update tree (UpdateSpatialEntry())
+SpatialIndex LoadSpatialIndex(float margin)
+{
+    SpatialIndex index = { 0 };
+
+    SpatialTree *tree = (SpatialTree *)RL_CALLOC(1, sizeof(SpatialTree));
+    tree->root = -1;
+    tree->freeList = -1;
+    tree->margin = (margin > 0.0f)? margin : 0.0f;
+
+    index.treeData = tree;
+
+    return index;
+}
+
+// Unload spatial index data
+void UnloadSpatialIndex(SpatialIndex index)
+{
+    SpatialTree *tree = (SpatialTree *)index.treeData;
+
+    if (tree != NULL)
+    {
+        RL_FREE(tree->nodes);
+        RL_FREE(tree);
+    }
+}
+
+// Add entry to spatial index, returns entry id (used to update or remove entry)
+// NOTE: userId is returned by queries, entry id is kept while entry is not removed
+int AddSpatialEntry(SpatialIndex *index, BoundingBox box, int userId)
+{
+    if ((index == NULL) || (index->treeData == NULL)) return -1;
+
+    SpatialTree *tree = (SpatialTree *)index->treeData;
+
+    int leaf = AllocateSpatialNode(tree);
+    SpatialNode *node = &tree->nodes[leaf];
+    node->entryBox = box;
+    node->bounds = (BoundingBox){ Vector3Subtract(box.min, (Vector3){ tree->margin, tree->margin, tree->margin }), Vector3Add(box.max, (Vector3){ tree->margin, tree->margin, tree->margin }) };
+    node->userId = userId;
+    node->height = 0;
+
+    InsertSpatialLeaf(tree, leaf);
+    index->entryCount++;
+
+    return leaf;
+}
+
+// Update spatial index entry box, returns true if entry was moved in tree
+// NOTE: Entry is only reinserted if box is not contained anymore in its node bounds (box enlarged by margin)
+bool UpdateSpatialEntry(SpatialIndex *index, int entry, BoundingBox box)
+{
+    if ((index == NULL) || !IsSpatialEntryValid(index->treeData, entry)) return false;
+
+    SpatialTree *tree = (SpatialTree *)index->treeData;
+    SpatialNode *node = &tree->nodes[entry];
+
+    node->entryBox = box;
+
+    BoundingBox bounds = node->bounds;
+    if ((box.min.x >= bounds.min.x) && (box.min.y >= bounds.min.y) && (box.min.z >= bounds.min.z) &&
+        (box.max.x <= bounds.max.x) && (box.max.y <= bounds.max.y) && (box.max.z <= bounds.max.z)) return false;
+
+    RemoveSpatialLeaf(tree, entry);
+
+    node = &tree->nodes[entry];
+    node->bounds = (BoundingBox){ Vector3Subtract(box.min, (Vector3){ tree->margin, tree->margin, tree->margin }), Vector3Add(box.max, (Vector3){ tree->margin, tree->margin, tree->margin }) };
+
+    InsertSpatialLeaf(tree, entry);
+
+    return true;
+}
+
+// Remove entry from spatial index
+void RemoveSpatialEntry(SpatialIndex *index, int entry)
+{
+    if ((index == NULL) || !IsSpatialEntryValid(index->treeData, entry)) return;
+
+    SpatialTree *tree = (SpatialTree *)index->treeData;
+
+    RemoveSpatialLeaf(tree, entry);
+    FreeSpatialNode(tree, entry);
+    index->entryCount--;
+}
+
+// Get spatial index entries overlapping box, returns number of user ids written (up to maxCount)
+int QuerySpatialBox(SpatialIndex index, BoundingBox box, int *userIds, int maxCount)
+{
+    return QuerySpatialTree((const SpatialTree *)index.treeData, CheckSpatialBox, &box, -1, userIds, maxCount);
+}
+
+// Get spatial index entries overlapping sphere, returns number of user ids written (up to maxCount)
+int QuerySpatialSphere(SpatialIndex index, Vector3 center, float radius, int *userIds, int maxCount)
+{
+    float sphere[4] = { center.x, center.y, center.z, radius };
+
+    return QuerySpatialTree((const SpatialTree *)index.treeData, CheckSpatialSphere, sphere, -1, userIds, maxCount);
+}
+
+// Get spatial index entries crossed by ray (up to maxDistance along ray), returns number of user ids written (up to maxCount)
+// NOTE: Entries are not sorted by distance, use QuerySpatialRays() to get nearest entry
+int QuerySpatialRay(SpatialIndex index, Ray ray, float maxDistance, int *userIds, int maxCount)
+{
+    float shape[7] = { ray.position.x, ray.position.y, ray.position.z, 1.0f/ray.direction.x, 1.0f/ray.direction.y, 1.0f/ray.direction.z, maxDistance };
+
+    return QuerySpatialTree((const SpatialTree *)index.treeData, CheckSpatialRay, shape, -1, userIds, maxCount);
+}
+
+// Get nearest spatial index entry crossed by every ray (up to maxDistance along ray), batched on worker threads
+// NOTE: userIds and distances (optional) must hold rayCount values, userId is -1 for rays not crossing any entry box
+void QuerySpatialRays(SpatialIndex index, const Ray *rays, int rayCount, float maxDistance, int *userIds, float *distances)
+{
+    if ((index.treeData == NULL) || (rays == NULL) || (userIds == NULL) || (rayCount <= 0)) return;
+
+    int jobRays = rayCount/((GetWorkerThreads() + 1)*4);
+    if (jobRays < MIN_SPATIAL_JOB_RAYS) jobRays = MIN_SPATIAL_JOB_RAYS;
+
+    int jobsCount = (rayCount + jobRays - 1)/jobRays;
+    SpatialRaysJob *jobs = (SpatialRaysJob *)RL_CALLOC(jobsCount, sizeof(SpatialRaysJob));
+
+    for (int i = 0; i < jobsCount; i++)
+    {
+        jobs[i].tree = (const SpatialTree *)index.treeData;
+        jobs[i].rays = rays;
+        jobs[i].maxDistance = maxDistance;
+        jobs[i].userIds = userIds;
+        jobs[i].distances = distances;
+        jobs[i].start = i*jobRays;
+        jobs[i].end = ((i + 1)*jobRays < rayCount)? (i + 1)*jobRays : rayCount;
+    }
+
+    // Calling thread runs first job and helps worker threads until all jobs finish
+    int pending = 0;
+    for (int i = 1; i < jobsCount; i++) SubmitWorkerJob(SpatialRaysJobRun, &jobs[i], &pending);
+    SpatialRaysJobRun(&jobs[0]);
+    WaitWorkerJobs(&pending);
+
+    RL_FREE(jobs);
+}
+
+// Get spatial index entries inside current view frustum (modelview and projection), returns number of user ids written (up to maxCount)
+// NOTE: Whole subtrees outside frustum are skipped, visible entries can be drawn without per model frustum tests
+int QuerySpatialFrustum(SpatialIndex index, int *userIds, int maxCount)
+{
+    Matrix matMVP = MatrixMultiply(GetMatrixModelview(), GetMatrixProjection());
+
+    // Frustum planes extracted from clip space rows: w + x, w - x, w + y, w - y, w + z, w - z
+    float rows[4][4] = {
+        { matMVP.m0, matMVP.m4, matMVP.m8, matMVP.m12 },
+        { matMVP.m1, matMVP.m5, matMVP.m9, matMVP.m13 },
+        { matMVP.m2, matMVP.m6, matMVP.m10, matMVP.m14 },
+        { matMVP.m3, matMVP.m7, matMVP.m11, matMVP.m15 }
+    };
+
+    float planes[6*4] = { 0 };
+
+    for (int i = 0; i < 6; i++)
+    {
+        float sign = (i%2 == 0)? 1.0f : -1.0f;
+        for (int k = 0; k < 4; k++) planes[i*4 + k] = rows[3][k] + sign*rows[i/2][k];
+    }
+
+    return QuerySpatialTree((const SpatialTree *)index.treeData, CheckSpatialFrustum, planes, -1, userIds, maxCount);
+}
+
+// Get spatial index overlapping entries pairs (broadphase), returns number of pairs written (up to maxPairs)
+// NOTE: userIdPairs must hold 2*maxPairs values, every pair is reported once
+int QuerySpatialPairs(SpatialIndex index, int *userIdPairs, int maxPairs)
+{
+    const SpatialTree *tree = (const SpatialTree *)index.treeData;
+    if ((tree == NULL) || (userIdPairs == NULL) || (maxPairs <= 0)) return 0;
+
+    int count = 0;
+    int *userIds = (int *)RL_MALLOC(((tree->nodeCount > 0)? tree->nodeCount : 1)*sizeof(int));
+
+    for (int i = 0; (i < tree->capacity) && (count < maxPairs); i++)
+    {
+        const SpatialNode *node = &tree->nodes[i];
+        if ((node->height != 0) || (node->child1 != -1)) continue;    // Only leaves (free nodes height is -1)
+
+        // NOTE: Only entries with greater id are reported, pairs are not duplicated
+        int overlaps = QuerySpatialTree(tree, CheckSpatialBox, &node->entryBox, i, userIds, tree->nodeCount);
+
+        for (int k = 0; (k < overlaps) && (count < maxPairs); k++)
+        {
+            userIdPairs[count*2] = node->userId;
+            userIdPairs[count*2 + 1] = userIds[k];
+            count++;
+        }
+    }
+
+    RL_FREE(userIds);
+
+    return count;
+}
+
+//----------------------------------------------------------------------------------
+// Module specific Functions Definition
+//----------------------------------------------------------------------------------
+
+#if defined(SUPPORT_FILEFORMAT_OBJ)
+// Load OBJ mesh data
+// NOTE: File is streamed in chunks parsed in parallel, faces vertex are welded into indexed meshes (one or more by material)
+static Model LoadOBJ(const char *fileName)
+{
+    Model model = { 0 };
+
+    FILE *objFile = fopen(fileName, "rb");
+
+    if (objFile == NULL)
+    {
+        TraceLog(LOG_WARNING, "[%s] OBJ file could not be opened", fileName);
+        return model;
+    }
+
+    fseek(objFile, 0, SEEK_END);
+    long fileSize = ftell(objFile);     // Get file size
+    fseek(objFile, 0, SEEK_SET);        // Reset file pointer
+
+    // Chunks parsed on every round: one for calling thread and one by worker thread
+    int jobCount = GetWorkerThreads() + 1;
+    int bufferSize = jobCount*OBJ_STREAM_CHUNK_SIZE;
+    if (fileSize < bufferSize) bufferSize = (int)fileSize;
+    if (bufferSize <= 0) bufferSize = 1;
+
+    char *buffer = (char *)RL_MALLOC(bufferSize + 1);
+    OBJChunkJob *jobs = (OBJChunkJob *)RL_CALLOC(jobCount, sizeof(OBJChunkJob));
+    for (int i = 0; i < jobCount; i++) jobs[i].mtllib = -1;
+
+    OBJArray positions = { 0 };         // Vertices positions (Vector3)
+    OBJArray texcoords = { 0 };         // Vertices texcoords (Vector2)
+    OBJArray normals = { 0 };           // Vertices normals (Vector3)
+    OBJArray triangles = { 0 };         // Triangles corners indices (position, texcoord, normal) x3
+    OBJArray triangleMaterials = { 0 }; // Triangles material name index (-1 if not defined)
+    OBJArray materialNames = { 0 };     // Material names used by faces (char *)
+    char *mtllib = NULL;                // Materials library file name
+
+    int currentMaterial = -1;
+    int carry = 0;
+    bool endOfFile = false;
+
+    while (!endOfFile)
+    {
+        int length = carry + (int)fread(buffer + carry, 1, bufferSize - carry, objFile);
+        endOfFile = (length < bufferSize) || (ftell(objFile) >= fileSize);
+
+        // Only complete lines are parsed, last line is kept for next round
+        int parsed = length;
+
+        if (!endOfFile)
+        {
+            while ((parsed > 0) && (buffer[parsed - 1] != '\n')) parsed--;
+
+            if (parsed == 0)
+            {
+                TraceLog(LOG_WARNING, "[%s] OBJ line longer than stream buffer, line truncated", fileName);
+                parsed = length;
+            }
+        }
+
+        if (parsed == length) buffer[parsed] = '\0';    // Last line might not end with line end
+
+        // Split parsed text in chunks ending on lines ends
+        int chunkStart = 0;
+
+        for (int i = 0; i < jobCount; i++)
+        {
+            int chunkEnd = (int)(((long long)parsed*(i + 1))/jobCount);
+            if (chunkEnd < chunkStart) chunkEnd = chunkStart;
+            while ((chunkEnd > chunkStart) && (chunkEnd < parsed) && (buffer[chunkEnd - 1] != '\n')) chunkEnd++;
+
+            jobs[i].text = buffer + chunkStart;
+            jobs[i].length = chunkEnd - chunkStart;
+            chunkStart = chunkEnd;
+        }
+
+        // Calling thread parses first chunk and helps worker threads until all chunks finish
+        int pending = 0;
+        for (int i = 1; i < jobCount; i++) SubmitWorkerJob(OBJChunkJobRun, &jobs[i], &pending);
+        OBJChunkJobRun(&jobs[0]);
+        WaitWorkerJobs(&pending);
+
+        // Merge chunks data in file order, chunk relative indices are resolved with previous chunks data counts
+        for (int i = 0; i < jobCount; i++)
+        {
+            OBJChunkJob *job = &jobs[i];
+            int bases[3] = { positions.count, texcoords.count, normals.count };
+
+            if (job->positions.count > 0) memcpy(PushOBJArray(&positions, job->positions.count, 3*sizeof(float)), job->positions.data, job->positions.count*3*sizeof(float));
+            if (job->texcoords.count > 0) memcpy(PushOBJArray(&texcoords, job->texcoords.count, 2*sizeof(float)), job->texcoords.data, job->texcoords.count*2*sizeof(float));
+            if (job->normals.count > 0) memcpy(PushOBJArray(&normals, job->normals.count, 3*sizeof(float)), job->normals.data, job->normals.count*3*sizeof(float));
+
+            if (job->triangles.count > 0)
+            {
+                int *corners = (int *)PushOBJArray(&triangles, job->triangles.count, 9*sizeof(int));
+                memcpy(corners, job->triangles.data, job->triangles.count*9*sizeof(int));
+
+                for (int k = 0; k < job->triangles.count*9; k++)
+                {
+                    if (corners[k] < -1) corners[k] = bases[k%3] + (corners[k] - OBJ_RELATIVE_INDEX);
+                }
+            }
+
+            // Material changes (first triangle in chunk, name offset in chunk text)
+            int *changes = (int *)job->materials.data;
+            int *materials = (int *)PushOBJArray(&triangleMaterials, job->triangles.count, sizeof(int));
+
+            for (int k = 0, t = 0; t < job->triangles.count; t++)
+            {
+                while ((k < job->materials.count) && (changes[k*2] <= t))
+                {
+                    currentMaterial = GetOBJNameIndex(&materialNames, job->text + changes[k*2 + 1]);
+                    k++;
+                }
+
+                materials[t] = currentMaterial;
+            }
+
+            // Material changes after chunk last face apply to next chunks
+            for (int k = 0; k < job->materials.count; k++)
+            {
+                if (changes[k*2] >= job->triangles.count) currentMaterial = GetOBJNameIndex(&materialNames, job->text + changes[k*2 + 1]);
+            }
+
+            if ((mtllib == NULL) && (job->mtllib >= 0))
+            {
+                int nameLength = 0;
+                const char *name = job->text + job->mtllib;
+                while ((name[nameLength] != '\n') && (name[nameLength] != '\r') && (name[nameLength] != '\0')) nameLength++;
+                while ((nameLength > 0) && ((name[nameLength - 1] == ' ') || (name[nameLength - 1] == '\t'))) nameLength--;
+
+                mtllib = (char *)RL_CALLOC(nameLength + 1, 1);
+                memcpy(mtllib, name, nameLength);
+            }
+
+            job->positions.count = 0;
+            job->texcoords.count = 0;
+            job->normals.count = 0;
+            job->triangles.count = 0;
+            job->materials.count = 0;
+            job->mtllib = -1;
+        }
+
+        // Keep incomplete last line for next round
+        carry = length - parsed;
+        if (carry > 0) memmove(buffer, buffer + parsed, carry);
+    }
+
+    fclose(objFile);
+
+    for (int i = 0; i < jobCount; i++)
+    {
+        RL_FREE(jobs[i].positions.data);
+        RL_FREE(jobs[i].texcoords.data);
+        RL_FREE(jobs[i].normals.data);
+        RL_FREE(jobs[i].triangles.data);
+        RL_FREE(jobs[i].materials.data);
+    }
+
+    RL_FREE(jobs);
+    RL_FREE(buffer);
+
+    TraceLog(LOG_INFO, "[%s] Model data loaded successfully: %i vertices / %i triangles", fileName, positions.count, triangles.count);
+
+    // Load materials library (path relative to current directory or OBJ file directory)
+    tinyobj_material_t *materials = NULL;
+    unsigned int materialCount = 0;
+
+    if (mtllib != NULL)
+    {
+        const char *objDirectory = GetDirectoryPath(fileName);
+        const char *mtlFileName = (FileExists(mtllib) || (objDirectory == NULL))? mtllib : TextFormat("%s/%s", objDirectory, mtllib);
+
+        if (tinyobj_parse_mtl_file(&materials, &materialCount, mtlFileName) != TINYOBJ_SUCCESS) TraceLog(LOG_WARNING, "[%s] Materials file could not be loaded", mtlFileName);
+        else TraceLog(LOG_INFO, "[%s] Materials data loaded successfully: %i materials", mtlFileName, materialCount);
+
+        RL_FREE(mtllib);
+    }
+
+    // Faces materials names to model materials indices (unfound materials set to default)
+    int *nameMaterials = (int *)RL_CALLOC((materialNames.count > 0)? materialNames.count : 1, sizeof(int));
+
+    for (int i = 0; i < materialNames.count; i++)
+    {
+        const char *name = ((char **)materialNames.data)[i];
+
+        for (unsigned int m = 0; m < materialCount; m++)
+        {
+            if ((materials[m].name != NULL) && (strcmp(materials[m].name, name) == 0)) { nameMaterials[i] = m; break; }
+        }
+
+        RL_FREE(((char **)materialNames.data)[i]);
+    }
+
+    // Sort triangles by material (counting sort), same material triangles are welded together
+    int groupCount = (materialCount > 0)? materialCount : 1;
+    int *groupStarts = (int *)RL_CALLOC(groupCount + 1, sizeof(int));
+    int *order = (int *)RL_MALLOC(((triangles.count > 0)? triangles.count : 1)*sizeof(int));
+    int *triangleGroups = (int *)triangleMaterials.data;
+
+    for (int t = 0; t < triangles.count; t++)
+    {
+        triangleGroups[t] = (triangleGroups[t] >= 0)? nameMaterials[triangleGroups[t]] : 0;
+        groupStarts[triangleGroups[t] + 1]++;
+    }
+
+    for (int g = 0; g < groupCount; g++) groupStarts[g + 1] += groupStarts[g];
+
+    int *groupFill = (int *)RL_MALLOC(groupCount*sizeof(int));
+    memcpy(groupFill, groupStarts, groupCount*sizeof(int));
+    for (int t = 0; t < triangles.count; t++) order[groupFill[triangleGroups[t]]++] = t;
+    RL_FREE(groupFill);
+
+    // Weld vertices on worker jobs, every material triangles split in ranges of MAX_OBJ_JOB_TRIANGLES
+    int meshJobCount = 0;
+    for (int g = 0; g < groupCount; g++) meshJobCount += (groupStarts[g + 1] - groupStarts[g] + MAX_OBJ_JOB_TRIANGLES - 1)/MAX_OBJ_JOB_TRIANGLES;
+
+    OBJMeshJob *meshJobs = (OBJMeshJob *)RL_CALLOC((meshJobCount > 0)? meshJobCount : 1, sizeof(OBJMeshJob));
+
+    for (int g = 0, j = 0; g < groupCount; g++)
+    {
+        for (int start = groupStarts[g]; start < groupStarts[g + 1]; start += MAX_OBJ_JOB_TRIANGLES, j++)
+        {
+            meshJobs[j].positions = &positions;
+            meshJobs[j].texcoords = &texcoords;
+            meshJobs[j].normals = &normals;
+            meshJobs[j].triangles = (const int *)triangles.data;
+            meshJobs[j].order = order;
+            meshJobs[j].start = start;
+            meshJobs[j].end = ((start + MAX_OBJ_JOB_TRIANGLES) < groupStarts[g + 1])? (start + MAX_OBJ_JOB_TRIANGLES) : groupStarts[g + 1];
+            meshJobs[j].material = g;
+        }
+    }
+
+    if (meshJobCount > 0)
+    {
+        int pending = 0;
+        for (int j = 1; j < meshJobCount; j++) SubmitWorkerJob(OBJMeshJobRun, &meshJobs[j], &pending);
+        OBJMeshJobRun(&meshJobs[0]);
+        WaitWorkerJobs(&pending);
+    }
+
+    // Init model meshes
+    for (int j = 0; j < meshJobCount; j++) model.meshCount += meshJobs[j].meshes.count;
+
+    if (model.meshCount > 0)
+    {
+        model.meshes = (Mesh *)RL_CALLOC(model.meshCount, sizeof(Mesh));
+        model.meshMaterial = (int *)RL_CALLOC(model.meshCount, sizeof(int));
+
+        for (int j = 0, m = 0; j < meshJobCount; j++)
+        {
+            for (int k = 0; k < meshJobs[j].meshes.count; k++, m++)
+            {
+                model.meshes[m] = ((Mesh *)meshJobs[j].meshes.data)[k];
+                model.meshMaterial[m] = meshJobs[j].material;
+            }
+        }
+    }
+
+    for (int j = 0; j < meshJobCount; j++) RL_FREE(meshJobs[j].meshes.data);
+
+    RL_FREE(meshJobs);
+    RL_FREE(order);
+    RL_FREE(groupStarts);
+    RL_FREE(nameMaterials);
+    RL_FREE(materialNames.data);
+    RL_FREE(triangleMaterials.data);
+    RL_FREE(triangles.data);
+    RL_FREE(normals.data);
+    RL_FREE(texcoords.data);
+    RL_FREE(positions.data);
+
+    // Init model materials
+    if (materialCount > 0)
+    {
+        model.materialCount = materialCount;
+        model.materials = (Material *)RL_CALLOC(model.materialCount, sizeof(Material));
+    }
+
+    for (int m = 0; m < materialCount; m++)
+    {
+        // Init material to default
+        // NOTE: Uses default shader, only MAP_DIFFUSE supported
+        model.materials[m] = LoadMaterialDefault();
+
+        model.materials[m].maps[MAP_DIFFUSE].texture = GetTextureDefault();     // Get default texture, in case no texture is defined
+
+        if (materials[m].diffuse_texname != NULL) model.materials[m].maps[MAP_DIFFUSE].texture = LoadTexture(materials[m].diffuse_texname);  //char *diffuse_texname; // map_Kd
+        model.materials[m].maps[MAP_DIFFUSE].color = (Color){ (float)(materials[m].diffuse[0]*255.0f), (float)(materials[m].diffuse[1]*255.0f), (float)(materials[m].diffuse[2]*255.0f), 255 }; //float diffuse[3];
+        model.materials[m].maps[MAP_DIFFUSE].value = 0.0f;
+
+        if (materials[m].specular_texname != NULL) model.materials[m].maps[MAP_SPECULAR].texture = LoadTexture(materials[m].specular_texname);  //char *specular_texname; // map_Ks
+        model.materials[m].maps[MAP_SPECULAR].color = (Color){ (float)(materials[m].specular[0]*255.0f), (float)(materials[m].specular[1]*255.0f), (float)(materials[m].specular[2]*255.0f), 255 }; //float specular[3];
+        model.materials[m].maps[MAP_SPECULAR].value = 0.0f;
+
+        if (materials[m].bump_texname != NULL) model.materials[m].maps[MAP_NORMAL].texture = LoadTexture(materials[m].bump_texname);  //char *bump_texname; // map_bump, bump
+        model.materials[m].maps[MAP_NORMAL].color = WHITE;
+        model.materials[m].maps[MAP_NORMAL].value = materials[m].shininess;
+
+        model.materials[m].maps[MAP_EMISSION].color = (Color){ (float)(materials[m].emission[0]*255.0f), (float)(materials[m].emission[1]*255.0f), (float)(materials[m].emission[2]*255.0f), 255 }; //float emission[3];
+
+        if (materials[m].displacement_texname != NULL) model.materials[m].maps[MAP_HEIGHT].texture = LoadTexture(materials[m].displacement_texname);  //char *displacement_texname; // disp
+    }
+
+    if (materials != NULL) tinyobj_materials_free(materials, materialCount);
+
+    // NOTE: At this point we have all model data loaded
+    TraceLog(LOG_INFO, "[%s] Model loaded successfully in RAM (CPU): %i meshes / %i materials", fileName, model.meshCount, model.materialCount);
+
+    return model;
+}
+
+// Add elements to OBJ parsing array, returns first element added
+static void *PushOBJArray(OBJArray *array, int count, int size)
+{
+    if ((array->count + count) > array->capacity)
+    {
+        int capacity = (array->capacity > 0)? array->capacity*2 : 1024;
+        while (capacity < (array->count + count)) capacity *= 2;
+
+        array->data = RL_REALLOC(array->data, (size_t)capacity*size);
+        array->capacity = capacity;
+    }
+
+    void *elements = (char *)array->data + (size_t)array->count*size;
+    array->count += count;
+
+    return elements;
+}
+
+// Get OBJ name index in names array (name added if not found), name ends on line end or space
+static int GetOBJNameIndex(OBJArray *names, const char *name)
+{
+    int length = 0;
+    while ((name[length] != '\n') && (name[length] != '\r') && (name[length] != '\0') && (name[length] != ' ') && (name[length] != '\t')) length++;
+
+    for (int i = 0; i < names->count; i++)
+    {
+        const char *current = ((char **)names->data)[i];
+        if ((strncmp(current, name, length) == 0) && (current[length] == '\0')) return i;
+    }
+
+    char *copy = (char *)RL_CALLOC(length + 1, 1);
+    memcpy(copy, name, length);
+    *(char **)PushOBJArray(names, 1, sizeof(char *)) = copy;
+
+    return names->count - 1;
+}
+
+// Parse OBJ float value (spaces skipped), returns text position after value
+// NOTE: Locale independent, faster than strtod()
+static const char *ParseOBJFloat(const char *text, float *value)
+{
+    while ((*text == ' ') || (*text == '\t')) text++;
+
+    double sign = 1.0;
+    if (*text == '-') { sign = -1.0; text++; }
+    else if (*text == '+') text++;
+
+    double number = 0.0;
+    while ((*text >= '0') && (*text <= '9')) { number = number*10.0 + (*text - '0'); text++; }
+
+    if (*text == '.')
+    {
+        text++;
+        double scale = 1.0;
+        while ((*text >= '0') && (*text <= '9')) { number = number*10.0 + (*text - '0'); scale *= 10.0; text++; }
+        number /= scale;
+    }
+
+    if ((*text == 'e') || (*text == 'E'))
+    {
+        text++;
+        int exponentSign = 1;
+        if (*text == '-') { exponentSign = -1; text++; }
+        else if (*text == '+') text++;
+
+        int exponent = 0;
+        while ((*text >= '0') && (*text <= '9')) { exponent = exponent*10 + (*text - '0'); text++; }
+        number *= pow(10.0, exponentSign*exponent);
+    }
+
+    *value = (float)(sign*number);
+
+    return text;
+}
+
+// Parse OBJ face vertex attribute index, returns text position after index
+// NOTE: Positive indices are global (0-based), negative indices are relative to chunk count (OBJ_RELATIVE_INDEX)
+static const char *ParseOBJIndex(const char *text, int chunkCount, int *index)
+{
+    int sign = 1;
+    if (*text == '-') { sign = -1; text++; }
+    else if (*text == '+') text++;
+
+    int value = 0;
+    while ((*text >= '0') && (*text <= '9')) { value = value*10 + (*text - '0'); text++; }
+
+    if (value == 0) *index = -1;
+    else if (sign > 0) *index = value - 1;
+    else *index = OBJ_RELATIVE_INDEX + chunkCount - value;
+
+    return text;
+}
+
+// Worker job: parse OBJ text chunk (complete lines)
+// NOTE: Faces are triangulated as fans, groups and objects are not split (meshes split by material)
+static void OBJChunkJobRun(void *data)
+{
+    OBJChunkJob *job = (OBJChunkJob *)data;
+
+    const char *text = job->text;
+    const char *end = job->text + job->length;
+
+    while (text < end)
+    {
+        while ((*text == ' ') || (*text == '\t')) text++;
+
+        if ((text[0] == 'v') && ((text[1] == ' ') || (text[1] == '\t')))
+        {
+            float *position = (float *)PushOBJArray(&job->positions, 1, 3*sizeof(float));
+            text = ParseOBJFloat(text + 2, &position[0]);
+            text = ParseOBJFloat(text, &position[1]);
+            text = ParseOBJFloat(text, &position[2]);
+        }
+        else if ((text[0] == 'v') && (text[1] == 't') && ((text[2] == ' ') || (text[2] == '\t')))
+        {
+            float *texcoord = (float *)PushOBJArray(&job->texcoords, 1, 2*sizeof(float));
+            text = ParseOBJFloat(text + 3, &texcoord[0]);
+            text = ParseOBJFloat(text, &texcoord[1]);
+            texcoord[1] = 1.0f - texcoord[1];   // NOTE: Y-coordinate must be flipped upside-down
+        }
+        else if ((text[0] == 'v') && (text[1] == 'n') && ((text[2] == ' ') || (text[2] == '\t')))
+        {
+            float *normal = (float *)PushOBJArray(&job->normals, 1, 3*sizeof(float));
+            text = ParseOBJFloat(text + 3, &normal[0]);
+            text = ParseOBJFloat(text, &normal[1]);
+            text = ParseOBJFloat(text, &normal[2]);
+        }
+        else if ((text[0] == 'f') && ((text[1] == ' ') || (text[1] == '\t')))
+        {
+            int first[3] = { 0 };
+            int previous[3] = { 0 };
+            int cornerCount = 0;
+
+            text++;
+
+            while (true)
+            {
+                while ((*text == ' ') || (*text == '\t')) text++;
+                if (!(((*text >= '0') && (*text <= '9')) || (*text == '-') || (*text == '+'))) break;
+
+                // Corner formats: v, v/vt, v//vn, v/vt/vn
+                int corner[3] = { -1, -1, -1 };
+                text = ParseOBJIndex(text, job->positions.count, &corner[0]);
+
+                if (*text == '/')
+                {
+                    text++;
+                    if (*text != '/') text = ParseOBJIndex(text, job->texcoords.count, &corner[1]);
+                    if (*text == '/') text = ParseOBJIndex(text + 1, job->normals.count, &corner[2]);
+                }
+
+                while ((*text != ' ') && (*text != '\t') && (*text != '\n') && (*text != '\r') && (*text != '\0')) text++;
+
+                if (cornerCount == 0) memcpy(first, corner, 3*sizeof(int));
+                else if (cornerCount >= 2)
+                {
+                    int *triangle = (int *)PushOBJArray(&job->triangles, 1, 9*sizeof(int));
+                    memcpy(triangle, first, 3*sizeof(int));
+                    memcpy(triangle + 3, previous, 3*sizeof(int));
+                    memcpy(triangle + 6, corner, 3*sizeof(int));
+                }
+
+                memcpy(previous, corner, 3*sizeof(int));
+                cornerCount++;
+            }
+        }
+        else if ((strncmp(text, "usemtl", 6) == 0) && ((text[6] == ' ') || (text[6] == '\t')))
+        {
+            text += 6;
+            while ((*text == ' ') || (*text == '\t')) text++;
+
+            int *change = (int *)PushOBJArray(&job->materials, 1, 2*sizeof(int));
+            change[0] = job->triangles.count;
+            change[1] = (int)(text - job->text);
+        }
+        else if ((job->mtllib < 0) && (strncmp(text, "mtllib", 6) == 0) && ((text[6] == ' ') || (text[6] == '\t')))
+        {
+            text += 6;
+            while ((*text == ' ') || (*text == '\t')) text++;
+
+            job->mtllib = (int)(text - job->text);
+        }
+
+        // Skip to next line
+        while ((*text != '\n') && (*text != '\0')) text++;
+        if (*text == '\0') break;
+        text++;
+    }
+}
+
+// Worker job: weld OBJ triangles range vertices into indexed meshes
+// NOTE: Meshes are split every MAX_OBJ_MESH_VERTICES vertices (16bit indices)
+static void OBJMeshJobRun(void *data)
+{
+    OBJMeshJob *job = (OBJMeshJob *)data;
+
+    int *table = (int *)RL_MALLOC(OBJ_WELD_TABLE_SIZE*sizeof(int));
+    int *keys = (int *)RL_MALLOC(MAX_OBJ_MESH_VERTICES*3*sizeof(int));
+    float *vertices = (float *)RL_MALLOC(MAX_OBJ_MESH_VERTICES*3*sizeof(float));
+    float *texcoords = (float *)RL_MALLOC(MAX_OBJ_MESH_VERTICES*2*sizeof(float));
+    float *normals = (float *)RL_MALLOC(MAX_OBJ_MESH_VERTICES*3*sizeof(float));
+    OBJArray indices = { 0 };
+    int vertexCount = 0;
+
+    const float *objPositions = (const float *)job->positions->data;
+    const float *objTexcoords = (const float *)job->texcoords->data;
+    const float *objNormals = (const float *)job->normals->data;
+
+    memset(table, 0xff, OBJ_WELD_TABLE_SIZE*sizeof(int));
+
+    for (int t = job->start; t < job->end; t++)
+    {
+        // Start new mesh if triangle vertices could not be indexed
+        if ((vertexCount + 3) > MAX_OBJ_MESH_VERTICES)
+        {
+            *(Mesh *)PushOBJArray(&job->meshes, 1, sizeof(Mesh)) = GenOBJMesh(vertices, texcoords, normals, vertexCount, (unsigned short *)indices.data, indices.count);
+            vertexCount = 0;
+            indices.count = 0;
+            memset(table, 0xff, OBJ_WELD_TABLE_SIZE*sizeof(int));
+        }
+
+        const int *triangle = job->triangles + job->order[t]*9;
+        unsigned short *triangleIndices = (unsigned short *)PushOBJArray(&indices, 3, sizeof(unsigned short));
+
+        for (int c = 0; c < 3; c++)
+        {
+            const int *key = triangle + c*3;
+
+            unsigned int hash = (unsigned int)key[0]*0x9e3779b1u + (unsigned int)key[1]*0x85ebca77u + (unsigned int)key[2]*0xc2b2ae3du;
+            hash = (hash ^ (hash >> 15))&(OBJ_WELD_TABLE_SIZE - 1);
+
+            while ((table[hash] != -1) && (memcmp(&keys[table[hash]*3], key, 3*sizeof(int)) != 0)) hash = (hash + 1)&(OBJ_WELD_TABLE_SIZE - 1);
+
+            if (table[hash] == -1)
+            {
+                // New vertex, invalid attributes indices are set to zero
+                int v = vertexCount;
+                memcpy(&keys[v*3], key, 3*sizeof(int));
+
+                if ((key[0] >= 0) && (key[0] < job->positions->count)) memcpy(&vertices[v*3], &objPositions[key[0]*3], 3*sizeof(float));
+                else memset(&vertices[v*3], 0, 3*sizeof(float));
+
+                if ((key[1] >= 0) && (key[1] < job->texcoords->count)) memcpy(&texcoords[v*2], &objTexcoords[key[1]*2], 2*sizeof(float));
+                else memset(&texcoords[v*2], 0, 2*sizeof(float));
+
+                if ((key[2] >= 0) && (key[2] < job->normals->count)) memcpy(&normals[v*3], &objNormals[key[2]*3], 3*sizeof(float));
+                else memset(&normals[v*3], 0, 3*sizeof(float));
+
+                table[hash] = vertexCount++;
+            }
+
+            triangleIndices[c] = (unsigned short)table[hash];
+        }
+    }
+
+    if (indices.count > 0) *(Mesh *)PushOBJArray(&job->meshes, 1, sizeof(Mesh)) = GenOBJMesh(vertices, texcoords, normals, vertexCount, (unsigned short *)indices.data, indices.count);
+
+    RL_FREE(indices.data);
+    RL_FREE(normals);
+    RL_FREE(texcoords);
+    RL_FREE(vertices);
+    RL_FREE(keys);
+    RL_FREE(table);
+}
+
+// Generate indexed mesh from OBJ welded vertices (data copied)
+static Mesh GenOBJMesh(const float *vertices, const float *texcoords, const float *normals, int vertexCount, const unsigned short *indices, int indexCount)
+{
+    Mesh mesh = { 0 };
+
+    mesh.vertexCount = vertexCount;
+    mesh.triangleCount = indexCount/3;
+    mesh.vertices = (float *)RL_MALLOC(vertexCount*3*sizeof(float));
+    mesh.texcoords = (float *)RL_MALLOC(vertexCount*2*sizeof(float));
+    mesh.normals = (float *)RL_MALLOC(vertexCount*3*sizeof(float));
+    mesh.indices = (unsigned short *)RL_MALLOC(indexCount*sizeof(unsigned short));
+    mesh.vboId = (unsigned int *)RL_CALLOC(MAX_MESH_VBO, sizeof(unsigned int));
+
+    memcpy(mesh.vertices, vertices, vertexCount*3*sizeof(float));
+    memcpy(mesh.texcoords, texcoords, vertexCount*2*sizeof(float));
+    memcpy(mesh.normals, normals, vertexCount*3*sizeof(float));
+    memcpy(mesh.indices, indices, indexCount*sizeof(unsigned short));
+
+    return mesh;
+}
+#endif
+
+#if defined(SUPPORT_FILEFORMAT_IQM)
+// Load IQM mesh data
+static Model LoadIQM(const char *fileName)
+{
+    #define IQM_MAGIC       "INTERQUAKEMODEL"   // IQM file magic number
+    #define IQM_VERSION     2                   // only IQM version 2 supported
+
+    #define BONE_NAME_LENGTH    32          // BoneInfo name string length
+    #define MESH_NAME_LENGTH    32          // Mesh name string length
+
+    // IQM file structs
+    //-----------------------------------------------------------------------------------
+    typedef struct IQMHeader {
+        char magic[16];
+        unsigned int version;
+        unsigned int filesize;
+        unsigned int flags;
+        unsigned int num_text, ofs_text;
+        unsigned int num_meshes, ofs_meshes;
+        unsigned int num_vertexarrays, num_vertexes, ofs_vertexarrays;
+        unsigned int num_triangles, ofs_triangles, ofs_adjacency;
+        unsigned int num_joints, ofs_joints;
+        unsigned int num_poses, ofs_poses;
+        unsigned int num_anims, ofs_anims;
+        unsigned int num_frames, num_framechannels, ofs_frames, ofs_bounds;
+        unsigned int num_comment, ofs_comment;
+        unsigned int num_extensions, ofs_extensions;
+    } IQMHeader;
+
+    typedef struct IQMMesh {
+        unsigned int name;
+        unsigned int material;
+        unsigned int first_vertex, num_vertexes;
+        unsigned int first_triangle, num_triangles;
+    } IQMMesh;
+
+    typedef struct IQMTriangle {
+        unsigned int vertex[3];
+    } IQMTriangle;
+
+    typedef struct IQMJoint {
+        unsigned int name;
+        int parent;
+        float translate[3], rotate[4], scale[3];
+    } IQMJoint;
+
+    typedef struct IQMVertexArray {
+        unsigned int type;
+        unsigned int flags;
+        unsigned int format;
+        unsigned int size;
+        unsigned int offset;
+    } IQMVertexArray;
+
+    // NOTE: Below IQM structures are not used but listed for reference
+    /*
+    typedef struct IQMAdjacency {
+        unsigned int triangle[3];
+    } IQMAdjacency;
+
+    typedef struct IQMPose {
+        int parent;
+        unsigned int mask;
+        float channeloffset[10];
+        float channelscale[10];
+    } IQMPose;
+
+    typedef struct IQMAnim {
+        unsigned int name;
+        unsigned int first_frame, num_frames;
+        float framerate;
+        unsigned int flags;
+    } IQMAnim;
+
+    typedef struct IQMBounds {
+        float bbmin[3], bbmax[3];
+        float xyradius, radius;
+    } IQMBounds;
+    */
+    //-----------------------------------------------------------------------------------
+
+    // IQM vertex data types
+    enum {
+        IQM_POSITION     = 0,
+        IQM_TEXCOORD     = 1,
+        IQM_NORMAL       = 2,
+        IQM_TANGENT      = 3,       // NOTE: Tangents unused by default
+        IQM_BLENDINDEXES = 4,
+        IQM_BLENDWEIGHTS = 5,
+        IQM_COLOR        = 6,       // NOTE: Vertex colors unused by default
+        IQM_CUSTOM       = 0x10     // NOTE: Custom vertex values unused by default
+    };
+
+    Model model = { 0 };
+
+    FILE *iqmFile;
+    IQMHeader iqm;
+
+    IQMMesh *imesh;
+    IQMTriangle *tri;
+    IQMVertexArray *va;
+    IQMJoint *ijoint;
+
+    float *vertex = NULL;
+    float *normal = NULL;
+    float *text = NULL;
+    char *blendi = NULL;
+    unsigned char *blendw = NULL;
+
+    iqmFile = fopen(fileName, "rb");
+
+    if (iqmFile == NULL)
+    {
+        TraceLog(LOG_WARNING, "[%s] IQM file could not be opened", fileName);
+        return model;
+    }
+
+    fread(&iqm,sizeof(IQMHeader), 1, iqmFile);  // Read IQM header
+
+    if (strncmp(iqm.magic, IQM_MAGIC, sizeof(IQM_MAGIC)))
+    {
+        TraceLog(LOG_WARNING, "[%s] IQM file does not seem to be valid", fileName);
+        fclose(iqmFile);
+        return model;
+    }
+
+    if (iqm.version != IQM_VERSION)
+    {
+        TraceLog(LOG_WARNING, "[%s] IQM file version is not supported (%i).", fileName, iqm.version);
+        fclose(iqmFile);
+        return model;
+    }
+
+    // Meshes data processing
+    imesh = RL_MALLOC(sizeof(IQMMesh)*iqm.num_meshes);
+    fseek(iqmFile, iqm.ofs_meshes, SEEK_SET);
+    fread(imesh, sizeof(IQMMesh)*iqm.num_meshes, 1, iqmFile);
+
+    model.meshCount = iqm.num_meshes;
+    model.meshes = RL_CALLOC(model.meshCount, sizeof(Mesh));
+
+    char name[MESH_NAME_LENGTH] = { 0 };
+
+    for (int i = 0; i < model.meshCount; i++)
+    {
+        fseek(iqmFile, iqm.ofs_text + imesh[i].name, SEEK_SET);
+        fread(name, sizeof(char)*MESH_NAME_LENGTH, 1, iqmFile);     // Mesh name not used...
+        model.meshes[i].vertexCount = imesh[i].num_vertexes;
+
+        model.meshes[i].vertices = RL_CALLOC(model.meshes[i].vertexCount*3, sizeof(float));       // Default vertex positions
+        model.meshes[i].normals = RL_CALLOC(model.meshes[i].vertexCount*3, sizeof(float));        // Default vertex normals
+        model.meshes[i].texcoords = RL_CALLOC(model.meshes[i].vertexCount*2, sizeof(float));      // Default vertex texcoords
+
+        model.meshes[i].boneIds = RL_CALLOC(model.meshes[i].vertexCount*4, sizeof(float));        // Up-to 4 bones supported!
+        model.meshes[i].boneWeights = RL_CALLOC(model.meshes[i].vertexCount*4, sizeof(float));    // Up-to 4 bones supported!
+
+        model.meshes[i].triangleCount = imesh[i].num_triangles;
+        model.meshes[i].indices = RL_CALLOC(model.meshes[i].triangleCount*3, sizeof(unsigned short));
+
+        // Animated verted data, what we actually process for rendering
+        // NOTE: Animated vertex should be re-uploaded to GPU (if not using GPU skinning)
+        model.meshes[i].animVertices = RL_CALLOC(model.meshes[i].vertexCount*3, sizeof(float));
+        model.meshes[i].animNormals = RL_CALLOC(model.meshes[i].vertexCount*3, sizeof(float));
+
+        model.meshes[i].vboId = (unsigned int *)RL_CALLOC(MAX_MESH_VBO, sizeof(unsigned int));
+    }
+
+    // Triangles data processing
+    tri = RL_MALLOC(iqm.num_triangles*sizeof(IQMTriangle));
+    fseek(iqmFile, iqm.ofs_triangles, SEEK_SET);
+    fread(tri, iqm.num_triangles*sizeof(IQMTriangle), 1, iqmFile);
+
+    for (int m = 0; m < model.meshCount; m++)
+    {
+        int tcounter = 0;
+
+        for (int i = imesh[m].first_triangle; i < (imesh[m].first_triangle + imesh[m].num_triangles); i++)
+        {
+            // IQM triangles are stored counter clockwise, but raylib sets opengl to clockwise drawing, so we swap them around
+            model.meshes[m].indices[tcounter + 2] = tri[i].vertex[0] - imesh[m].first_vertex;
+            model.meshes[m].indices[tcounter + 1] = tri[i].vertex[1] - imesh[m].first_vertex;
+            model.meshes[m].indices[tcounter] = tri[i].vertex[2] - imesh[m].first_vertex;
+            tcounter += 3;
+        }
+    }
+
+    // Vertex arrays data processing
+    va = RL_MALLOC(iqm.num_vertexarrays*sizeof(IQMVertexArray));
+    fseek(iqmFile, iqm.ofs_vertexarrays, SEEK_SET);
+    fread(va, iqm.num_vertexarrays*sizeof(IQMVertexArray), 1, iqmFile);
+
+    for (int i = 0; i < iqm.num_vertexarrays; i++)
+    {
+        switch (va[i].type)
+        {
+            case IQM_POSITION:
+            {
+                vertex = RL_MALLOC(iqm.num_vertexes*3*sizeof(float));
+                fseek(iqmFile, va[i].offset, SEEK_SET);
+                fread(vertex, iqm.num_vertexes*3*sizeof(float), 1, iqmFile);
+
+                for (int m = 0; m < iqm.num_meshes; m++)
+                {
+                    int vCounter = 0;
+                    for (int i = imesh[m].first_vertex*3; i < (imesh[m].first_vertex + imesh[m].num_vertexes)*3; i++)
+                    {
+                        model.meshes[m].vertices[vCounter] = vertex[i];
+                        model.meshes[m].animVertices[vCounter] = vertex[i];
+                        vCounter++;
+                    }
+                }
+            } break;
+            case IQM_NORMAL:
+            {
+                normal = RL_MALLOC(iqm.num_vertexes*3*sizeof(float));
+                fseek(iqmFile, va[i].offset, SEEK_SET);
+                fread(normal, iqm.num_vertexes*3*sizeof(float), 1, iqmFile);
+
+                for (int m = 0; m < iqm.num_meshes; m++)
+                {
                     int vCounter = 0;
                     for (int i = imesh[m].first_vertex*3; i < (imesh[m].first_vertex + imesh[m].num_vertexes)*3; i++)
                     {
-                        model.meshes[m].vertices[vCounter] = vertex[i];
-                        model.meshes[m].animVertices[vCounter] = vertex[i];
-                        vCounter++;
+                        model.meshes[m].normals[vCounter] = normal[i];
+                        model.meshes[m].animNormals[vCounter] = normal[i];
+                        vCounter++;
+                    }
+                }
+            } break;
+            case IQM_TEXCOORD:
+            {
+                text = RL_MALLOC(iqm.num_vertexes*2*sizeof(float));
+                fseek(iqmFile, va[i].offset, SEEK_SET);
+                fread(text, iqm.num_vertexes*2*sizeof(float), 1, iqmFile);
+
+                for (int m = 0; m < iqm.num_meshes; m++)
+                {
+                    int vCounter = 0;
+                    for (int i = imesh[m].first_vertex*2; i < (imesh[m].first_vertex + imesh[m].num_vertexes)*2; i++)
+                    {
+                        model.meshes[m].texcoords[vCounter] = text[i];
+                        vCounter++;
+                    }
+                }
+            } break;
+            case IQM_BLENDINDEXES:
+            {
+                blendi = RL_MALLOC(iqm.num_vertexes*4*sizeof(char));
+                fseek(iqmFile, va[i].offset, SEEK_SET);
+                fread(blendi, iqm.num_vertexes*4*sizeof(char), 1, iqmFile);
+
+                for (int m = 0; m < iqm.num_meshes; m++)
+                {
+                    int boneCounter = 0;
+                    for (int i = imesh[m].first_vertex*4; i < (imesh[m].first_vertex + imesh[m].num_vertexes)*4; i++)
+                    {
+                        model.meshes[m].boneIds[boneCounter] = blendi[i];
+                        boneCounter++;
+                    }
+                }
+            } break;
+            case IQM_BLENDWEIGHTS:
+            {
+                blendw = RL_MALLOC(iqm.num_vertexes*4*sizeof(unsigned char));
+                fseek(iqmFile, va[i].offset, SEEK_SET);
+                fread(blendw, iqm.num_vertexes*4*sizeof(unsigned char), 1, iqmFile);
+
+                for (int m = 0; m < iqm.num_meshes; m++)
+                {
+                    int boneCounter = 0;
+                    for (int i = imesh[m].first_vertex*4; i < (imesh[m].first_vertex + imesh[m].num_vertexes)*4; i++)
+                    {
+                        model.meshes[m].boneWeights[boneCounter] = blendw[i]/255.0f;
+                        boneCounter++;
+                    }
+                }
+            } break;
+        }
+    }
+
+    // Bones (joints) data processing
+    ijoint = RL_MALLOC(iqm.num_joints*sizeof(IQMJoint));
+    fseek(iqmFile, iqm.ofs_joints, SEEK_SET);
+    fread(ijoint, iqm.num_joints*sizeof(IQMJoint), 1, iqmFile);
+
+    model.boneCount = iqm.num_joints;
+    model.bones = RL_MALLOC(iqm.num_joints*sizeof(BoneInfo));
+    model.bindPose = RL_MALLOC(iqm.num_joints*sizeof(Transform));
+
+    for (int i = 0; i < iqm.num_joints; i++)
+    {
+        // Bones
+        model.bones[i].parent = ijoint[i].parent;
+        fseek(iqmFile, iqm.ofs_text + ijoint[i].name, SEEK_SET);
+        fread(model.bones[i].name, BONE_NAME_LENGTH*sizeof(char), 1, iqmFile);
+
+        // Bind pose (base pose)
+        model.bindPose[i].translation.x = ijoint[i].translate[0];
+        model.bindPose[i].translation.y = ijoint[i].translate[1];
+        model.bindPose[i].translation.z = ijoint[i].translate[2];
+
+        model.bindPose[i].rotation.x = ijoint[i].rotate[0];
+        model.bindPose[i].rotation.y = ijoint[i].rotate[1];
+        model.bindPose[i].rotation.z = ijoint[i].rotate[2];
+        model.bindPose[i].rotation.w = ijoint[i].rotate[3];
+
+        model.bindPose[i].scale.x = ijoint[i].scale[0];
+        model.bindPose[i].scale.y = ijoint[i].scale[1];
+        model.bindPose[i].scale.z = ijoint[i].scale[2];
+    }
+
+    // Build bind pose from parent joints
+    for (int i = 0; i < model.boneCount; i++)
+    {
+        if (model.bones[i].parent >= 0)
+        {
+            model.bindPose[i].rotation = QuaternionMultiply(model.bindPose[model.bones[i].parent].rotation, model.bindPose[i].rotation);
+            model.bindPose[i].translation = Vector3RotateByQuaternion(model.bindPose[i].translation, model.bindPose[model.bones[i].parent].rotation);
+            model.bindPose[i].translation = Vector3Add(model.bindPose[i].translation, model.bindPose[model.bones[i].parent].translation);
+            model.bindPose[i].scale = Vector3Multiply(model.bindPose[i].scale, model.bindPose[model.bones[i].parent].scale);
+        }
+    }
+
+    fclose(iqmFile);
+    RL_FREE(imesh);
+    RL_FREE(tri);
+    RL_FREE(va);
+    RL_FREE(vertex);
+    RL_FREE(normal);
+    RL_FREE(text);
+    RL_FREE(blendi);
+    RL_FREE(blendw);
+    RL_FREE(ijoint);
+
+    return model;
+}
+#endif
+
+#if defined(SUPPORT_FILEFORMAT_GLTF)
+
+// Load texture from cgltf_image
+static Texture LoadTextureFromCgltfImage(cgltf_image *image, const char *texPath, Color tint)
+{
+    Texture texture = { 0 };
+
+    if (image->uri)
+    {
+        if ((strlen(image->uri) > 5) &&
+            (image->uri[0] == 'd') &&
+            (image->uri[1] == 'a') &&
+            (image->uri[2] == 't') &&
+            (image->uri[3] == 'a') &&
+            (image->uri[4] == ':'))
+        {
+            // Data URI
+            // Format: data:<mediatype>;base64,<data>
+
+            // Find the comma
+            int i = 0;
+            while ((image->uri[i] != ',') && (image->uri[i] != 0)) i++;
+
+            if (image->uri[i] == 0) TraceLog(LOG_WARNING, "CGLTF Image: Invalid data URI");
+            else
+            {
+                // NOTE: Base64 data is decoded by cgltf
+                const char *base64 = image->uri + i + 1;
+                int length = (int)strlen(base64);
+                int size = length/4*3 - (((length > 0) && (base64[length - 1] == '='))? 1 : 0) - (((length > 1) && (base64[length - 2] == '='))? 1 : 0);
+
+                cgltf_options options = { 0 };
+                void *data = NULL;
+
+                if (cgltf_load_buffer_base64(&options, size, base64, &data) != cgltf_result_success) TraceLog(LOG_WARNING, "CGLTF Image: Invalid base64 data");
+                else
+                {
+                    int w, h;
+                    unsigned char *raw = stbi_load_from_memory(data, size, &w, &h, NULL, 4);
+                    free(data);
+
+                    Image rimage = LoadImagePro(raw, w, h, UNCOMPRESSED_R8G8B8A8);
+                    RL_FREE(raw);
+
+                    // TODO: Tint shouldn't be applied here!
+                    ImageColorTint(&rimage, tint);
+                    texture = LoadTextureFromImage(rimage);
+                    UnloadImage(rimage);
+                }
+            }
+        }
+        else
+        {
+            Image rimage = LoadImage(TextFormat("%s/%s", texPath, image->uri));
+            
+            // TODO: Tint shouldn't be applied here!
+            ImageColorTint(&rimage, tint);
+            texture = LoadTextureFromImage(rimage);
+            UnloadImage(rimage);
+        }
+    }
+    else if (image->buffer_view)
+    {
+        // NOTE: Contiguous image data is decoded in place from buffer (glb binary chunk)
+        unsigned char *data = (unsigned char *)image->buffer_view->buffer->data + image->buffer_view->offset;
+        int stride = image->buffer_view->stride ? image->buffer_view->stride : 1;
+
+        if (stride != 1)
+        {
+            data = RL_MALLOC(image->buffer_view->size);
+            int n = image->buffer_view->offset;
+
+            for (int i = 0; i < image->buffer_view->size; i++)
+            {
+                data[i] = ((unsigned char *)image->buffer_view->buffer->data)[n];
+                n += stride;
+            }
+        }
+
+        int w, h;
+        unsigned char *raw = stbi_load_from_memory(data, image->buffer_view->size, &w, &h, NULL, 4);
+        if (stride != 1) RL_FREE(data);
+
+        Image rimage = LoadImagePro(raw, w, h, UNCOMPRESSED_R8G8B8A8);
+        RL_FREE(raw);
+
+        // TODO: Tint shouldn't be applied here!
+        ImageColorTint(&rimage, tint);
+        texture = LoadTextureFromImage(rimage);
+        UnloadImage(rimage);
+    }
+    else
+    {
+        Image rimage = LoadImageEx(&tint, 1, 1);
+        texture = LoadTextureFromImage(rimage);
+        UnloadImage(rimage);
+    }
+
+    return texture;
+}
+
+// Load glTF mesh data
+static Model LoadGLTF(const char *fileName)
+{
+    /***********************************************************************************
+
+        Function implemented by Wilhem Barbier (@wbrbr)
+
+        Features:
+          - Supports .gltf and .glb files
+          - Supports embedded (base64) or external textures
+          - Loads the albedo/diffuse texture (other maps could be added)
+          - Supports multiple mesh per model and multiple primitives per model
+          - Files and external buffers are memory-mapped, meshes are uploaded to GPU from
+            buffers data (CPU copies only kept with SetModelKeepMeshData())
+          - Indexed meshes (byte/unsigned int indices converted to unsigned short)
+
+        Some restrictions (not exhaustive):
+          - Triangle-only meshes
+          - Not supported node hierarchies or transforms
+          - Only loads the diffuse texture... but not too hard to support other maps (normal, roughness/metalness...)
+          - Meshes with more than 65536 vertices and unsigned int indices are unindexed
+
+    *************************************************************************************/
+
+    Model model = { 0 };
+
+    // glTF file loading (memory-mapped if possible, glb binary chunk is used in place)
+    MappedFileData file = { 0 };
+
+    if (!LoadMappedFileData(fileName, &file))
+    {
+        TraceLog(LOG_WARNING, "[%s] glTF file could not be opened", fileName);
+        return model;
+    }
+
+    // glTF data loading
+    cgltf_options options = { 0 };
+    cgltf_data *data = NULL;
+    cgltf_result result = cgltf_parse(&options, file.data, file.size, &data);
+
+    if (result == cgltf_result_success)
+    {
+        TraceLog(LOG_INFO, "[%s][%s] Model meshes/materials: %i/%i", fileName, (data->file_type == 2)? "glb" : "gltf", data->meshes_count, data->materials_count);
+
+        // External buffers files are memory-mapped, cgltf loads remaining buffers (base64 data URIs)
+        MappedFileData *buffersFiles = (MappedFileData *)RL_CALLOC((data->buffers_count > 0)? data->buffers_count : 1, sizeof(MappedFileData));
+
+        for (int i = 0; i < data->buffers_count; i++)
+        {
+            const char *uri = data->buffers[i].uri;
+
+            if ((uri != NULL) && (strncmp(uri, "data:", 5) != 0) && (strstr(uri, "://") == NULL))
+            {
+                char *path = (char *)RL_MALLOC(strlen(fileName) + strlen(uri) + 1);
+                cgltf_combine_paths(path, fileName, uri);
+
+                if (LoadMappedFileData(path, &buffersFiles[i]) && (buffersFiles[i].size >= data->buffers[i].size)) data->buffers[i].data = buffersFiles[i].data;
+
+                RL_FREE(path);
+            }
+        }
+
+        result = cgltf_load_buffers(&options, data, fileName);
+        if (result != cgltf_result_success) TraceLog(LOG_INFO, "[%s][%s] Error loading mesh/material buffers", fileName, (data->file_type == 2)? "glb" : "gltf");
+
+        int primitivesCount = 0;
+
+        for (int i = 0; i < data->meshes_count; i++) primitivesCount += (int)data->meshes[i].primitives_count;
+
+        // Process glTF data and map to model
+        model.meshCount = primitivesCount;
+        model.meshes = RL_CALLOC(model.meshCount, sizeof(Mesh));
+        model.materialCount = data->materials_count + 1;
+        model.materials = RL_MALLOC(model.materialCount*sizeof(Material));
+        model.meshMaterial = RL_MALLOC(model.meshCount*sizeof(int));
+
+        for (int i = 0; i < model.meshCount; i++) model.meshes[i].vboId = (unsigned int *)RL_CALLOC(MAX_MESH_VBO, sizeof(unsigned int));
+
+        //For each material
+        for (int i = 0; i < model.materialCount - 1; i++)
+        {
+            model.materials[i] = LoadMaterialDefault();
+            Color tint = (Color){ 255, 255, 255, 255 };
+            const char *texPath = GetDirectoryPath(fileName);
+
+            //Ensure material follows raylib support for PBR (metallic/roughness flow)
+            if (data->materials[i].has_pbr_metallic_roughness) 
+            {
+                float roughness = data->materials[i].pbr_metallic_roughness.roughness_factor;
+                float metallic = data->materials[i].pbr_metallic_roughness.metallic_factor;
+
+                // NOTE: Material name not used for the moment
+                //if (model.materials[i].name && data->materials[i].name) strcpy(model.materials[i].name, data->materials[i].name);
+
+                // TODO: REview: shouldn't these be *255 ???
+                tint.r = (unsigned char)(data->materials[i].pbr_metallic_roughness.base_color_factor[0]*255);
+                tint.g = (unsigned char)(data->materials[i].pbr_metallic_roughness.base_color_factor[1]*255);
+                tint.b = (unsigned char)(data->materials[i].pbr_metallic_roughness.base_color_factor[2]*255);
+                tint.a = (unsigned char)(data->materials[i].pbr_metallic_roughness.base_color_factor[3]*255);
+
+                model.materials[i].maps[MAP_ROUGHNESS].color = tint;
+
+                if (data->materials[i].pbr_metallic_roughness.base_color_texture.texture) 
+                {
+                    model.materials[i].maps[MAP_ALBEDO].texture = LoadTextureFromCgltfImage(data->materials[i].pbr_metallic_roughness.base_color_texture.texture->image, texPath, tint);
+                }
+
+                // NOTE: Tint isn't need for other textures.. pass null or clear? 
+                // Just set as white, multiplying by white has no effect
+                tint = WHITE;
+
+                if (data->materials[i].pbr_metallic_roughness.metallic_roughness_texture.texture)
+                {
+                    model.materials[i].maps[MAP_ROUGHNESS].texture = LoadTextureFromCgltfImage(data->materials[i].pbr_metallic_roughness.metallic_roughness_texture.texture->image, texPath, tint);
+                }
+                model.materials[i].maps[MAP_ROUGHNESS].value = roughness;
+                model.materials[i].maps[MAP_METALNESS].value = metallic;
+
+                if (data->materials[i].normal_texture.texture) 
+                {
+                    model.materials[i].maps[MAP_NORMAL].texture = LoadTextureFromCgltfImage(data->materials[i].normal_texture.texture->image, texPath, tint);
+                }
+                
+                if (data->materials[i].occlusion_texture.texture) 
+                {
+                    model.materials[i].maps[MAP_OCCLUSION].texture = LoadTextureFromCgltfImage(data->materials[i].occlusion_texture.texture->image, texPath, tint);
+                }
+            }
+        }
+
+        model.materials[model.materialCount - 1] = LoadMaterialDefault();
+
+        int primitiveIndex = 0;
+
+        // Meshes arrays allocated by loader (GLTF_OWNED_*), other arrays point into file buffers
+        unsigned char *meshOwned = (unsigned char *)RL_CALLOC((model.meshCount > 0)? model.meshCount : 1, sizeof(unsigned char));
+
+        for (int i = 0; i < data->meshes_count; i++)
+        {
+            for (int p = 0; p < data->meshes[i].primitives_count; p++)
+            {
+                cgltf_primitive *primitive = &data->meshes[i].primitives[p];
+                Mesh *mesh = &model.meshes[primitiveIndex];
+                bool owned = false;
+
+                for (int j = 0; j < primitive->attributes_count; j++)
+                {
+                    cgltf_attribute *attribute = &primitive->attributes[j];
+
+                    if (attribute->type == cgltf_attribute_type_position)
+                    {
+                        mesh->vertexCount = (int)attribute->data->count;
+                        mesh->vertices = LoadGLTFAccessorFloats(attribute->data, 3, &owned);
+                        if (owned) meshOwned[primitiveIndex] |= GLTF_OWNED_VERTICES;
+                    }
+                    else if (attribute->type == cgltf_attribute_type_normal)
+                    {
+                        mesh->normals = LoadGLTFAccessorFloats(attribute->data, 3, &owned);
+                        if (owned) meshOwned[primitiveIndex] |= GLTF_OWNED_NORMALS;
+                    }
+                    else if ((attribute->type == cgltf_attribute_type_texcoord) && (attribute->index == 0))
+                    {
+                        // NOTE: Normalized unsigned byte/unsigned short texture coordinates are converted to float
+                        mesh->texcoords = LoadGLTFAccessorFloats(attribute->data, 2, &owned);
+                        if (owned) meshOwned[primitiveIndex] |= GLTF_OWNED_TEXCOORDS;
+                    }
+                }
+
+                // NOTE: Texture coordinates are required by rlLoadMesh()
+                if (mesh->texcoords == NULL)
+                {
+                    mesh->texcoords = (float *)RL_CALLOC(mesh->vertexCount*2, sizeof(float));
+                    meshOwned[primitiveIndex] |= GLTF_OWNED_TEXCOORDS;
+                }
+
+                cgltf_accessor *acc = primitive->indices;
+
+                if (acc)
+                {
+                    const unsigned char *indices = GetGLTFAccessorPointer(acc);
+
+                    if ((indices != NULL) && (acc->component_type == cgltf_component_type_r_16u) && (acc->stride == sizeof(unsigned short)) && (((size_t)indices%sizeof(unsigned short)) == 0))
+                    {
+                        mesh->indices = (unsigned short *)indices;
+                    }
+                    else if (mesh->vertexCount <= 65536)
+                    {
+                        // Unsigned byte/unsigned int indices converted to unsigned short
+                        mesh->indices = (unsigned short *)RL_MALLOC(acc->count*sizeof(unsigned short));
+                        for (int k = 0; k < acc->count; k++) mesh->indices[k] = (unsigned short)cgltf_accessor_read_index(acc, k);
+                        meshOwned[primitiveIndex] |= GLTF_OWNED_INDICES;
+                    }
+                    else
+                    {
+                        TraceLog(LOG_WARNING, "[%s] Mesh vertices can not be indexed with unsigned short (%i vertices), mesh is unindexed", fileName, mesh->vertexCount);
+                        UnindexGLTFMesh(mesh, &meshOwned[primitiveIndex], acc);
+                    }
+
+                    mesh->triangleCount = (int)acc->count/3;
+                }
+                else
+                {
+                    // Unindexed mesh
+                    mesh->triangleCount = mesh->vertexCount/3;
+                }
+
+                if (data->meshes[i].primitives[p].material)
+                {
+                    // Compute the offset
+                    model.meshMaterial[primitiveIndex] = data->meshes[i].primitives[p].material - data->materials;
+                }
+                else
+                {
+                    model.meshMaterial[primitiveIndex] = model.materialCount - 1;
+                }
+
+                primitiveIndex++;
+            }
+        }
+
+        // Upload meshes to GPU straight from file buffers, CPU data is only kept if requested (SetModelKeepMeshData())
+        // NOTE: OpenGL 1.1 draws meshes from CPU data, it is always kept
+        bool keepData = modelKeepMeshData || (rlGetVersion() == OPENGL_11);
+
+        for (int i = 0; i < model.meshCount; i++)
+        {
+            Mesh *mesh = &model.meshes[i];
+
+            mesh->vertexFormat = modelMeshFormat;
+            if (mesh->vertices != NULL) rlLoadMesh(mesh, false);
+
+            if (keepData) KeepGLTFMeshData(mesh, meshOwned[i]);
+            else
+            {
+                // Bounds are kept for culling
+                if ((mesh->vertices != NULL) && (mesh->bvh == NULL)) LoadMeshBoundsBVH(mesh, MeshBoundingBox(*mesh));
+
+                if (meshOwned[i] & GLTF_OWNED_VERTICES) RL_FREE(mesh->vertices);
+                if (meshOwned[i] & GLTF_OWNED_NORMALS) RL_FREE(mesh->normals);
+                if (meshOwned[i] & GLTF_OWNED_TEXCOORDS) RL_FREE(mesh->texcoords);
+                if (meshOwned[i] & GLTF_OWNED_INDICES) RL_FREE(mesh->indices);
+
+                mesh->vertices = NULL;
+                mesh->normals = NULL;
+                mesh->texcoords = NULL;
+                mesh->indices = NULL;
+            }
+        }
+
+        RL_FREE(meshOwned);
+
+        // Mapped buffers are not freed by cgltf
+        for (int i = 0; i < data->buffers_count; i++)
+        {
+            if (buffersFiles[i].data != NULL)
+            {
+                if (data->buffers[i].data == buffersFiles[i].data) data->buffers[i].data = NULL;
+                UnloadMappedFileData(buffersFiles[i]);
+            }
+        }
+
+        RL_FREE(buffersFiles);
+
+        cgltf_free(data);
+    }
+    else TraceLog(LOG_WARNING, "[%s] glTF data could not be loaded", fileName);
+
+    UnloadMappedFileData(file);
+
+    return model;
+}
+
+// Get glTF accessor first element in buffer data, NULL if not available (sparse or out of buffer)
+static const unsigned char *GetGLTFAccessorPointer(const cgltf_accessor *accessor)
+{
+    const cgltf_buffer_view *view = accessor->buffer_view;
+
+    if ((view == NULL) || accessor->is_sparse || (view->buffer->data == NULL)) return NULL;
+    if ((view->offset + view->size) > view->buffer->size) return NULL;
+    if ((accessor->count > 0) && ((accessor->offset + accessor->stride*(accessor->count - 1) + cgltf_calc_size(accessor->type, accessor->component_type)) > view->size)) return NULL;
+
+    return (const unsigned char *)view->buffer->data + view->offset + accessor->offset;
+}
+
+// Load glTF accessor floats, returns pointer into buffer data if tightly packed (owned set to false)
+// NOTE: Other components types (or strided data) are converted into allocated array (owned set to true)
+static float *LoadGLTFAccessorFloats(const cgltf_accessor *accessor, int components, bool *owned)
+{
+    const unsigned char *data = GetGLTFAccessorPointer(accessor);
+
+    if ((data != NULL) && (accessor->component_type == cgltf_component_type_r_32f) && (cgltf_num_components(accessor->type) == components) &&
+        (accessor->stride == components*sizeof(float)) && (((size_t)data%sizeof(float)) == 0))
+    {
+        *owned = false;
+        return (float *)data;
+    }
+
+    float *values = (float *)RL_CALLOC(accessor->count*components, sizeof(float));
+    for (int i = 0; i < accessor->count; i++) cgltf_accessor_read_float(accessor, i, values + i*components, components);
+
+    *owned = true;
+    return values;
+}
+
+// Unindex glTF mesh vertex data (indices not fitting unsigned short), vertex arrays are replaced by allocated ones
+static void UnindexGLTFMesh(Mesh *mesh, unsigned char *owned, const cgltf_accessor *indices)
+{
+    int vertexCount = (int)indices->count;
+    float *vertices = (float *)RL_CALLOC(vertexCount*3, sizeof(float));
+    float *normals = (mesh->normals != NULL)? (float *)RL_CALLOC(vertexCount*3, sizeof(float)) : NULL;
+    float *texcoords = (float *)RL_CALLOC(vertexCount*2, sizeof(float));
+
+    for (int i = 0; i < vertexCount; i++)
+    {
+        int index = (int)cgltf_accessor_read_index(indices, i);
+        if (index >= mesh->vertexCount) continue;
+
+        if (mesh->vertices != NULL) memcpy(&vertices[i*3], &mesh->vertices[index*3], 3*sizeof(float));
+        if (normals != NULL) memcpy(&normals[i*3], &mesh->normals[index*3], 3*sizeof(float));
+        memcpy(&texcoords[i*2], &mesh->texcoords[index*2], 2*sizeof(float));
+    }
+
+    if (*owned & GLTF_OWNED_VERTICES) RL_FREE(mesh->vertices);
+    if (*owned & GLTF_OWNED_NORMALS) RL_FREE(mesh->normals);
+    if (*owned & GLTF_OWNED_TEXCOORDS) RL_FREE(mesh->texcoords);
+
+    mesh->vertexCount = vertexCount;
+    mesh->vertices = vertices;
+    mesh->normals = normals;
+    mesh->texcoords = texcoords;
+
+    *owned |= (GLTF_OWNED_VERTICES | GLTF_OWNED_NORMALS | GLTF_OWNED_TEXCOORDS);
+}
+
+// Keep glTF mesh data in RAM (CPU), arrays pointing into file buffers are copied
+static void KeepGLTFMeshData(Mesh *mesh, unsigned char owned)
+{
+    if ((mesh->vertices != NULL) && !(owned & GLTF_OWNED_VERTICES)) mesh->vertices = (float *)memcpy(RL_MALLOC(mesh->vertexCount*3*sizeof(float)), mesh->vertices, mesh->vertexCount*3*sizeof(float));
+    if ((mesh->normals != NULL) && !(owned & GLTF_OWNED_NORMALS)) mesh->normals = (float *)memcpy(RL_MALLOC(mesh->vertexCount*3*sizeof(float)), mesh->normals, mesh->vertexCount*3*sizeof(float));
+    if ((mesh->texcoords != NULL) && !(owned & GLTF_OWNED_TEXCOORDS)) mesh->texcoords = (float *)memcpy(RL_MALLOC(mesh->vertexCount*2*sizeof(float)), mesh->texcoords, mesh->vertexCount*2*sizeof(float));
+    if ((mesh->indices != NULL) && !(owned & GLTF_OWNED_INDICES)) mesh->indices = (unsigned short *)memcpy(RL_MALLOC(mesh->triangleCount*3*sizeof(unsigned short)), mesh->indices, mesh->triangleCount*3*sizeof(unsigned short));
+}
+#endif
+
+#if defined(SUPPORT_FILEFORMAT_RLMESH)
+// Get rlmesh data block arrays sizes (file order), returns data block size
+// NOTE: Arrays sizes are 4 bytes aligned, arrays can be used in place (memory-mapped file)
+static unsigned long long GetRLMeshArraysSizes(const RLMeshFileMesh *info, unsigned long long *sizes)
+{
+    unsigned long long vertexCount = info->vertexCount;
+    unsigned int attributes = info->attributes;
+
+    sizes[0] = (attributes & RLMESH_VERTICES)? vertexCount*3*sizeof(float) : 0;
+    sizes[1] = (attributes & RLMESH_TEXCOORDS)? vertexCount*2*sizeof(float) : 0;
+    sizes[2] = (attributes & RLMESH_TEXCOORDS2)? vertexCount*2*sizeof(float) : 0;
+    sizes[3] = (attributes & RLMESH_NORMALS)? vertexCount*3*sizeof(float) : 0;
+    sizes[4] = (attributes & RLMESH_TANGENTS)? vertexCount*4*sizeof(float) : 0;
+    sizes[5] = (attributes & RLMESH_COLORS)? vertexCount*4*sizeof(unsigned char) : 0;
+    sizes[6] = (attributes & RLMESH_INDICES)? (((unsigned long long)info->triangleCount*3*sizeof(unsigned short) + 3) & ~3ULL) : 0;
+    sizes[7] = (attributes & RLMESH_BVH)? (unsigned long long)info->bvhNodeCount*sizeof(MeshBVHNode) : 0;
+    sizes[8] = (attributes & RLMESH_BVH)? (unsigned long long)info->bvhTriangleCount*3*sizeof(Vector3) : 0;
+
+    unsigned long long size = 0;
+    for (int i = 0; i < RLMESH_ARRAYS_COUNT; i++) size += sizes[i];
+
+    return size;
+}
+
+// Export meshes and materials to rlmesh file (binary mesh cache), data blocks optionally LZ4 compressed
+// NOTE: Vertex arrays are stored as uploaded to GPU (one buffer by attribute), material textures are not stored
+static bool ExportRLMesh(const char *fileName, const Mesh *meshes, int meshCount, const Material *materials, int materialCount, const int *meshMaterial, bool compressed)
+{
+    for (int i = 0; i < meshCount; i++)
+    {
+        if (meshes[i].vertices == NULL)
+        {
+            TraceLog(LOG_WARNING, "[%s] Mesh vertex data not available in RAM (CPU), rlmesh can not be exported (SetModelKeepMeshData())", fileName);
+            return false;
+        }
+    }
+
+    FILE *rlmFile = fopen(fileName, "wb");
+    if (rlmFile == NULL) return false;
+
+    RLMeshFileHeader header = { { 'r', 'M', 'S', 'H' }, RLMESH_FILE_VERSION, (unsigned int)meshCount, (unsigned int)materialCount, MAX_MATERIAL_MAPS, { 0 } };
+
+    int mapsCount = materialCount*MAX_MATERIAL_MAPS;
+    RLMeshFileMap *maps = (RLMeshFileMap *)RL_CALLOC((mapsCount > 0)? mapsCount : 1, sizeof(RLMeshFileMap));
+    RLMeshFileMesh *infos = (RLMeshFileMesh *)RL_CALLOC((meshCount > 0)? meshCount : 1, sizeof(RLMeshFileMesh));
+
+    for (int i = 0; i < materialCount; i++)
+    {
+        if (materials[i].maps == NULL) continue;
+
+        for (int m = 0; m < MAX_MATERIAL_MAPS; m++)
+        {
+            RLMeshFileMap *map = &maps[i*MAX_MATERIAL_MAPS + m];
+            map->color[0] = materials[i].maps[m].color.r;
+            map->color[1] = materials[i].maps[m].color.g;
+            map->color[2] = materials[i].maps[m].color.b;
+            map->color[3] = materials[i].maps[m].color.a;
+            map->value = materials[i].maps[m].value;
+        }
+    }
+
+    // Meshes info is written again once data blocks are written
+    fwrite(&header, sizeof(RLMeshFileHeader), 1, rlmFile);
+    fwrite(maps, sizeof(RLMeshFileMap), mapsCount, rlmFile);
+    fwrite(infos, sizeof(RLMeshFileMesh), meshCount, rlmFile);
+
+    unsigned long long offset = sizeof(RLMeshFileHeader) + (unsigned long long)mapsCount*sizeof(RLMeshFileMap) + (unsigned long long)meshCount*sizeof(RLMeshFileMesh);
+    bool success = true;
+
+    for (int i = 0; (i < meshCount) && success; i++)
+    {
+        const Mesh *mesh = &meshes[i];
+        const MeshBVH *bvh = (const MeshBVH *)mesh->bvh;
+        RLMeshFileMesh *info = &infos[i];
+
+        info->vertexCount = mesh->vertexCount;
+        info->triangleCount = (mesh->indices != NULL)? mesh->triangleCount : mesh->vertexCount/3;
+        info->attributes = RLMESH_VERTICES;
+        if (mesh->texcoords != NULL) info->attributes |= RLMESH_TEXCOORDS;
+        if (mesh->texcoords2 != NULL) info->attributes |= RLMESH_TEXCOORDS2;
+        if (mesh->normals != NULL) info->attributes |= RLMESH_NORMALS;
+        if (mesh->tangents != NULL) info->attributes |= RLMESH_TANGENTS;
+        if (mesh->colors != NULL) info->attributes |= RLMESH_COLORS;
+        if (mesh->indices != NULL) info->attributes |= RLMESH_INDICES;
+        if (bvh != NULL)
+        {
+            info->attributes |= RLMESH_BVH;
+            info->bvhNodeCount = bvh->nodeCount;
+            info->bvhTriangleCount = bvh->triangleCount;
+        }
+        info->material = ((meshMaterial != NULL) && (meshMaterial[i] >= 0))? meshMaterial[i] : 0;
+
+        BoundingBox bounds = MeshBoundingBox(*mesh);
+        info->bounds[0] = bounds.min.x;
+        info->bounds[1] = bounds.min.y;
+        info->bounds[2] = bounds.min.z;
+        info->bounds[3] = bounds.max.x;
+        info->bounds[4] = bounds.max.y;
+        info->bounds[5] = bounds.max.z;
+
+        unsigned long long sizes[RLMESH_ARRAYS_COUNT] = { 0 };
+        unsigned long long rawSize = GetRLMeshArraysSizes(info, sizes);
+
+        // NOTE: Data blocks are aligned in file, arrays are aligned in memory-mapped data
+        unsigned long long alignedOffset = (offset + RLMESH_DATA_ALIGNMENT - 1) & ~(unsigned long long)(RLMESH_DATA_ALIGNMENT - 1);
+
+        if ((rawSize > 0x7fffffff) || ((alignedOffset + rawSize) > 0xffffffff))
+        {
+            TraceLog(LOG_WARNING, "[%s] Mesh data too big for rlmesh file", fileName);
+            success = false;
+            break;
+        }
+
+        const void *arrays[RLMESH_ARRAYS_COUNT] = { mesh->vertices, mesh->texcoords, mesh->texcoords2, mesh->normals, mesh->tangents, mesh->colors,
+                                                    mesh->indices, (bvh != NULL)? bvh->nodes : NULL, (bvh != NULL)? bvh->triangles : NULL };
+
+        // NOTE: Block is zero initialized, indices padding is written as zeros
+        unsigned char *block = (unsigned char *)RL_CALLOC((rawSize > 0)? rawSize : 1, 1);
+        unsigned long long position = 0;
+
+        for (int k = 0; k < RLMESH_ARRAYS_COUNT; k++)
+        {
+            if (sizes[k] == 0) continue;
+
+            if (k == 6) memcpy(block + position, arrays[k], info->triangleCount*3*sizeof(unsigned short));
+            else memcpy(block + position, arrays[k], sizes[k]);
+
+            position += sizes[k];
+        }
+
+        const unsigned char *blockData = block;
+        unsigned char *packed = NULL;
+        info->dataSize = (unsigned int)rawSize;
+        info->dataRawSize = (unsigned int)rawSize;
+        info->compression = RLMESH_COMPRESSION_NONE;
+
+        if (compressed && (rawSize > 0))
+        {
+            int capacity = (int)(rawSize + rawSize/255 + 16);
+            packed = (unsigned char *)RL_MALLOC(capacity);
+            int packedSize = CompressLZ4(block, (int)rawSize, packed, capacity);
+
+            // NOTE: Data not reduced by compression is stored uncompressed (used in place on load)
+            if ((packedSize > 0) && ((unsigned long long)packedSize < rawSize))
+            {
+                blockData = packed;
+                info->dataSize = packedSize;
+                info->compression = RLMESH_COMPRESSION_LZ4;
+            }
+        }
+
+        static const unsigned char padding[RLMESH_DATA_ALIGNMENT] = { 0 };
+        fwrite(padding, 1, (size_t)(alignedOffset - offset), rlmFile);
+
+        info->dataOffset = (unsigned int)alignedOffset;
+        if (fwrite(blockData, 1, info->dataSize, rlmFile) != info->dataSize) success = false;
+        offset = alignedOffset + info->dataSize;
+
+        RL_FREE(packed);
+        RL_FREE(block);
+    }
+
+    if (success)
+    {
+        fseek(rlmFile, (long)(sizeof(RLMeshFileHeader) + mapsCount*sizeof(RLMeshFileMap)), SEEK_SET);
+        if (fwrite(infos, sizeof(RLMeshFileMesh), meshCount, rlmFile) != (size_t)meshCount) success = false;
+    }
+
+    fclose(rlmFile);
+
+    RL_FREE(infos);
+    RL_FREE(maps);
+
+    return success;
+}
+
+// Load rlmesh file (binary mesh cache), meshes are uploaded to GPU straight from memory-mapped file data
+// NOTE: Meshes data is only kept in RAM (CPU) if requested (SetModelKeepMeshData()), BVH data is always kept
+static Model LoadRLMesh(const char *fileName)
+{
+    Model model = { 0 };
+
+    MappedFileData file = { 0 };
+
+    if (!LoadMappedFileData(fileName, &file))
+    {
+        TraceLog(LOG_WARNING, "[%s] rlmesh file could not be opened", fileName);
+        return model;
+    }
+
+    const unsigned char *fileData = (const unsigned char *)file.data;
+
+    RLMeshFileHeader header = { 0 };
+    if (file.size >= sizeof(RLMeshFileHeader)) memcpy(&header, fileData, sizeof(RLMeshFileHeader));
+
+    unsigned long long mapsSize = (unsigned long long)header.materialCount*header.mapCount*sizeof(RLMeshFileMap);
+    unsigned long long infosSize = (unsigned long long)header.meshCount*sizeof(RLMeshFileMesh);
+
+    if ((memcmp(header.id, "rMSH", 4) != 0) || (header.version != RLMESH_FILE_VERSION) ||
+        ((sizeof(RLMeshFileHeader) + mapsSize + infosSize) > file.size))
+    {
+        TraceLog(LOG_WARNING, "[%s] rlmesh file not valid", fileName);
+        UnloadMappedFileData(file);
+        return model;
+    }
+
+    // NOTE: File info is copied, packed files data could not be aligned
+    RLMeshFileMap *maps = (RLMeshFileMap *)RL_MALLOC((mapsSize > 0)? mapsSize : 1);
+    RLMeshFileMesh *infos = (RLMeshFileMesh *)RL_MALLOC((infosSize > 0)? infosSize : 1);
+    memcpy(maps, fileData + sizeof(RLMeshFileHeader), (size_t)mapsSize);
+    memcpy(infos, fileData + sizeof(RLMeshFileHeader) + mapsSize, (size_t)infosSize);
+
+    bool valid = true;
+
+    for (unsigned int i = 0; (i < header.meshCount) && valid; i++)
+    {
+        unsigned long long sizes[RLMESH_ARRAYS_COUNT] = { 0 };
+        unsigned long long rawSize = GetRLMeshArraysSizes(&infos[i], sizes);
+
+        if (!(infos[i].attributes & RLMESH_VERTICES) || (infos[i].compression > RLMESH_COMPRESSION_LZ4) ||
+            (rawSize != infos[i].dataRawSize) || ((infos[i].compression == RLMESH_COMPRESSION_NONE) && (infos[i].dataSize != rawSize)) ||
+            (((unsigned long long)infos[i].dataOffset + infos[i].dataSize) > file.size)) valid = false;
+    }
+
+    if (valid)
+    {
+        bool keepData = modelKeepMeshData || (rlGetVersion() == OPENGL_11);
+
+        model.meshCount = header.meshCount;
+        model.meshes = (Mesh *)RL_CALLOC((model.meshCount > 0)? model.meshCount : 1, sizeof(Mesh));
+        model.meshMaterial = (int *)RL_CALLOC((model.meshCount > 0)? model.meshCount : 1, sizeof(int));
+
+        for (int i = 0; i < model.meshCount; i++)
+        {
+            const RLMeshFileMesh *info = &infos[i];
+            const unsigned char *block = fileData + info->dataOffset;
+            unsigned char *buffer = NULL;
+
+            Mesh *mesh = &model.meshes[i];
+            mesh->vboId = (unsigned int *)RL_CALLOC(MAX_MESH_VBO, sizeof(unsigned int));
+            model.meshMaterial[i] = (info->material < header.materialCount)? info->material : 0;
+
+            if (info->compression == RLMESH_COMPRESSION_LZ4)
+            {
+                buffer = (unsigned char *)RL_MALLOC((info->dataRawSize > 0)? info->dataRawSize : 1);
+
+                if (DecompressLZ4(block, info->dataSize, buffer, info->dataRawSize) != (int)info->dataRawSize)
+                {
+                    TraceLog(LOG_WARNING, "[%s] rlmesh mesh %i data could not be decompressed", fileName, i);
+                    RL_FREE(buffer);
+                    continue;
+                }
+
+                block = buffer;
+            }
+
+            unsigned long long sizes[RLMESH_ARRAYS_COUNT] = { 0 };
+            GetRLMeshArraysSizes(info, sizes);
+
+            void **arrays[7] = { (void **)&mesh->vertices, (void **)&mesh->texcoords, (void **)&mesh->texcoords2, (void **)&mesh->normals,
+                                 (void **)&mesh->tangents, (void **)&mesh->colors, (void **)&mesh->indices };
+            const unsigned char *bvhData[2] = { NULL };
+            unsigned long long position = 0;
+
+            for (int k = 0; k < RLMESH_ARRAYS_COUNT; k++)
+            {
+                if (sizes[k] == 0) continue;
+
+                if (k < 7) *arrays[k] = (void *)(block + position);
+                else bvhData[k - 7] = block + position;
+
+                position += sizes[k];
+            }
+
+            mesh->vertexCount = info->vertexCount;
+            mesh->triangleCount = info->triangleCount;
+
+            if (info->attributes & RLMESH_BVH)
+            {
+                MeshBVH *bvh = (MeshBVH *)RL_CALLOC(1, sizeof(MeshBVH));
+                bvh->nodeCount = info->bvhNodeCount;
+                bvh->nodes = (MeshBVHNode *)RL_MALLOC((sizes[7] > 0)? sizes[7] : 1);
+                bvh->triangleCount = info->bvhTriangleCount;
+                bvh->triangles = (Vector3 *)RL_MALLOC((sizes[8] > 0)? sizes[8] : 1);
+                if (sizes[7] > 0) memcpy(bvh->nodes, bvhData[0], sizes[7]);
+                if (sizes[8] > 0) memcpy(bvh->triangles, bvhData[1], sizes[8]);
+                mesh->bvh = bvh;
+            }
+
+            mesh->vertexFormat = modelMeshFormat;
+            rlLoadMesh(mesh, false);
+
+            for (int k = 0; k < 7; k++)
+            {
+                if (*arrays[k] == NULL) continue;
+
+                // NOTE: Indices padding is not copied, mesh arrays are allocated separately
+                size_t size = (k == 6)? mesh->triangleCount*3*sizeof(unsigned short) : (size_t)sizes[k];
+                *arrays[k] = keepData? memcpy(RL_MALLOC(size), *arrays[k], size) : NULL;
+            }
+
+            RL_FREE(buffer);
+
+            // Stored bounds are used for culling, bounds are not computed again from vertex data
+            MeshBoundsEntry *entry = GetMeshBoundsEntry(mesh->vertices);
+
+            if (entry != NULL)
+            {
+                entry->vertices = mesh->vertices;
+                entry->vertexCount = mesh->vertexCount;
+                entry->bounds = (BoundingBox){ { info->bounds[0], info->bounds[1], info->bounds[2] }, { info->bounds[3], info->bounds[4], info->bounds[5] } };
+            }
+            else if (mesh->bvh == NULL)
+            {
+                // Mesh without CPU data keeps stored bounds in BVH root node
+                LoadMeshBoundsBVH(mesh, (BoundingBox){ { info->bounds[0], info->bounds[1], info->bounds[2] }, { info->bounds[3], info->bounds[4], info->bounds[5] } });
+            }
+        }
+
+        if (header.materialCount > 0)
+        {
+            model.materialCount = header.materialCount;
+            model.materials = (Material *)RL_CALLOC(model.materialCount, sizeof(Material));
+
+            int mapCount = (header.mapCount < MAX_MATERIAL_MAPS)? header.mapCount : MAX_MATERIAL_MAPS;
+
+            for (int i = 0; i < model.materialCount; i++)
+            {
+                model.materials[i] = LoadMaterialDefault();
+
+                for (int m = 0; m < mapCount; m++)
+                {
+                    const RLMeshFileMap *map = &maps[i*header.mapCount + m];
+                    model.materials[i].maps[m].color = (Color){ map->color[0], map->color[1], map->color[2], map->color[3] };
+                    model.materials[i].maps[m].value = map->value;
+                }
+            }
+        }
+
+        TraceLog(LOG_INFO, "[%s] rlmesh file loaded successfully: %i meshes, %i materials", fileName, model.meshCount, model.materialCount);
+    }
+    else TraceLog(LOG_WARNING, "[%s] rlmesh file meshes data not valid", fileName);
+
+    RL_FREE(infos);
+    RL_FREE(maps);
+
+    UnloadMappedFileData(file);
+
+    return model;
+}
+#endif
+
+#if defined(SUPPORT_FILEFORMAT_GLTF) || defined(SUPPORT_FILEFORMAT_RLMESH)
+// Load model file data, memory-mapped if possible (packed files are used in place)
+static bool LoadMappedFileData(const char *fileName, MappedFileData *file)
+{
+    *file = (MappedFileData){ 0 };
+
+#if defined(SUPPORT_PACK_FILES)
+    unsigned int packedSize = 0;
+    file->data = (void *)GetPackedFileData(fileName, &packedSize);
+
+    if (file->data != NULL)
+    {
+        file->size = packedSize;
+        file->packed = true;
+        return true;
+    }
+#endif
+
+#if defined(SUPPORT_FILE_MAPPING)
+    int fd = open(fileName, O_RDONLY);
+
+    if (fd >= 0)
+    {
+        struct stat fileStats = { 0 };
+
+        if ((fstat(fd, &fileStats) == 0) && (fileStats.st_size > 0))
+        {
+            void *data = mmap(NULL, (size_t)fileStats.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+
+            if (data != MAP_FAILED)
+            {
+                file->data = data;
+                file->size = (size_t)fileStats.st_size;
+                file->mapped = true;
+            }
+        }
+
+        close(fd);      // NOTE: Mapping remains valid after closing file descriptor
+
+        if (file->data != NULL) return true;
+    }
+#endif
+
+    FILE *dataFile = fopen(fileName, "rb");
+
+    if (dataFile != NULL)
+    {
+        fseek(dataFile, 0, SEEK_END);
+        long size = ftell(dataFile);
+        fseek(dataFile, 0, SEEK_SET);
+
+        if (size > 0)
+        {
+            file->data = RL_MALLOC(size);
+
+            if (fread(file->data, 1, size, dataFile) == (size_t)size) file->size = (size_t)size;
+            else { RL_FREE(file->data); file->data = NULL; }
+        }
+
+        fclose(dataFile);
+    }
+
+    return (file->data != NULL);
+}
+
+// Unload model file data
+static void UnloadMappedFileData(MappedFileData file)
+{
+    // NOTE: Packed files data is owned by mounted pack
+    if ((file.data == NULL) || file.packed) return;
+
+#if defined(SUPPORT_FILE_MAPPING)
+    if (file.mapped) munmap(file.data, file.size);
+    else RL_FREE(file.data);
+#else
+    RL_FREE(file.data);
+#endif
+}
+#endif
+
+// Get mesh bounds cache entry for vertex data (direct-mapped by address)
+static MeshBoundsEntry *GetMeshBoundsEntry(const float *vertices)
+{
+    if (vertices == NULL) return NULL;
+
+    // NOTE: Lower address bits are discarded, allocations are aligned
+    unsigned long long address = (unsigned long long)(size_t)vertices;
+
+    return &meshBoundsCache[((address >> 4) ^ (address >> 12))%MAX_MESH_BOUNDS_CACHE];
+}
+
+// Check mesh bounding box against current view frustum
+// NOTE: Mesh bounds are computed once and cached by vertex data, animated meshes are never culled
+// because bind pose bounds could not contain animated vertices
+static bool IsMeshVisible(Mesh mesh, Matrix transform)
+{
+    if ((mesh.animVertices != NULL) || (mesh.boneIds != NULL) || (mesh.vertexCount <= 0)) return true;
+
+    // Meshes without CPU data use bounds kept in BVH (UnloadMeshCPUData())
+    if (mesh.vertices == NULL)
+    {
+        if (mesh.bvh == NULL) return true;
+
+        BoundingBox bounds = MeshBoundingBox(mesh);
+        return rlCheckBoxInFrustum(bounds.min, bounds.max, transform);
+    }
+
+    MeshBoundsEntry *entry = GetMeshBoundsEntry(mesh.vertices);
+    if (entry == NULL) return true;
+
+    if ((entry->vertices != mesh.vertices) || (entry->vertexCount != mesh.vertexCount))
+    {
+        entry->vertices = mesh.vertices;
+        entry->vertexCount = mesh.vertexCount;
+        entry->bounds = MeshBoundingBox(mesh);
+    }
+
+    return rlCheckBoxInFrustum(entry->bounds.min, entry->bounds.max, transform);
+}
+
+// Add item to transparent queue, item view depth is computed with current modelview matrix
+// NOTE: If queue is not open or full, NULL is returned and item must be drawn directly
+static TransparentItem *AddTransparentItem(int type, Vector3 position)
+{
+    if (!transparentQueue.active) return NULL;
+
+    if (transparentQueue.count >= MAX_TRANSPARENT_QUEUE)
+    {
+        TraceLog(LOG_WARNING, "Transparent queue full (%i), item drawn unsorted", MAX_TRANSPARENT_QUEUE);
+        return NULL;
+    }
+
+    Matrix modelview = GetMatrixModelview();
+
+    TransparentItem *item = &transparentQueue.items[transparentQueue.count];
+    item->type = type;
+
+    // Distance to camera along view direction (view space looks down -Z)
+    transparentQueue.depths[transparentQueue.count] = -(modelview.m2*position.x + modelview.m6*position.y + modelview.m10*position.z + modelview.m14);
+    transparentQueue.count++;
+
+    return item;
+}
+
+// Sort transparent queue back-to-front, sorted items indices are stored in transparentQueue.order
+// NOTE: LSD radix sort (8 bit digits) is stable: render state key is sorted first so items
+// with same depth keep grouped by state, then depth is sorted (farthest first)
+static void SortTransparentQueue(void)
+{
+    const int count = transparentQueue.count;
+
+    unsigned int *keys = transparentQueue.keys;
+    unsigned int *keysTemp = transparentQueue.keys + MAX_TRANSPARENT_QUEUE;
+    unsigned int *order = transparentQueue.order;
+    unsigned int *orderTemp = transparentQueue.order + MAX_TRANSPARENT_QUEUE;
+
+    for (int i = 0; i < count; i++)
+    {
+        unsigned int bits = 0;
+        memcpy(&bits, &transparentQueue.depths[i], sizeof(float));
+
+        // Map float bits to unsigned order, then invert to sort farthest first
+        bits = (bits & 0x80000000)? ~bits : (bits | 0x80000000);
+
+        keys[i] = ~bits;
+        order[i] = i;
+    }
+
+    // First pass: render state key (lowest 8 bits), depth keys are moved along
+    unsigned int histogram[256] = { 0 };
+
+    for (int i = 0; i < count; i++) histogram[transparentQueue.items[i].stateKey & 0xff]++;
+    for (unsigned int i = 0, sum = 0; i < 256; i++) { unsigned int h = histogram[i]; histogram[i] = sum; sum += h; }
+    for (int i = 0; i < count; i++)
+    {
+        unsigned int dst = histogram[transparentQueue.items[i].stateKey & 0xff]++;
+        orderTemp[dst] = order[i];
+        keysTemp[dst] = keys[i];
+    }
+
+    unsigned int *swap = order; order = orderTemp; orderTemp = swap;
+    swap = keys; keys = keysTemp; keysTemp = swap;
+
+    // Depth key passes (32 bit, 4 passes), result ends in transparentQueue.order
+    for (int shift = 0; shift < 32; shift += 8)
+    {
+        memset(histogram, 0, sizeof(histogram));
+
+        for (int i = 0; i < count; i++) histogram[(keys[i] >> shift) & 0xff]++;
+        for (unsigned int i = 0, sum = 0; i < 256; i++) { unsigned int h = histogram[i]; histogram[i] = sum; sum += h; }
+        for (int i = 0; i < count; i++)
+        {
+            unsigned int dst = histogram[(keys[i] >> shift) & 0xff]++;
+            orderTemp[dst] = order[i];
+            keysTemp[dst] = keys[i];
+        }
+
+        swap = order; order = orderTemp; orderTemp = swap;
+        swap = keys; keys = keysTemp; keysTemp = swap;
+    }
+
+    // NOTE: Odd number of passes, sorted indices end in second buffer
+    if (order != transparentQueue.order) memcpy(transparentQueue.order, order, count*sizeof(unsigned int));
+}
+
+// Skin models poses on CPU, models bones palettes are computed once and vertices skinned on worker threads
+// NOTE: Models with NULL pose are not skinned, GPU buffers are updated by calling thread
+static void UpdateModelsPoses(const Model *models, const Transform *const *poses, const int *boneCounts, int count)
+{
+    // Get models bones palettes (column-major matrices) and skinned vertices count
+    int *paletteOffsets = (int *)RL_MALLOC(count*sizeof(int));
+    int paletteSize = 0;
+    int totalVertices = 0;
+
+    for (int i = 0; i < count; i++)
+    {
+        paletteOffsets[i] = -1;
+
+        if ((poses[i] == NULL) || (boneCounts[i] <= 0)) continue;
+
+        paletteOffsets[i] = paletteSize;
+        paletteSize += ((models[i].boneCount < boneCounts[i])? models[i].boneCount : boneCounts[i])*16;
+
+        for (int m = 0; m < models[i].meshCount; m++)
+        {
+            const Mesh *mesh = &models[i].meshes[m];
+            if ((mesh->boneIds != NULL) && (mesh->boneWeights != NULL) && (mesh->animVertices != NULL)) totalVertices += mesh->vertexCount;
+        }
+    }
+
+    // NOTE: Extra zeroed matrix keeps palettes of models without bones valid (invalid influences read first matrix)
+    float *palette = (float *)RL_CALLOC(paletteSize + 16, sizeof(float));
+    Matrix *boneMatrices = NULL;
+    int boneMatricesCount = 0;
+
+    for (int i = 0; i < count; i++)
+    {
+        if (paletteOffsets[i] < 0) continue;
+
+        int boneCount = (models[i].boneCount < boneCounts[i])? models[i].boneCount : boneCounts[i];
+
+        if (boneCount > boneMatricesCount)
+        {
+            boneMatrices = (Matrix *)RL_REALLOC(boneMatrices, boneCount*sizeof(Matrix));
+            boneMatricesCount = boneCount;
+        }
+
+        GetModelPoseBones(models[i], poses[i], boneCount, boneMatrices);
+
+        for (int b = 0; b < boneCount; b++) memcpy(palette + paletteOffsets[i] + b*16, MatrixToFloat(boneMatrices[b]), 16*sizeof(float));
+    }
+
+    RL_FREE(boneMatrices);
+
+    // Split meshes vertices in jobs, jobs are sized to balance work between worker threads
+    int threads = GetWorkerThreads() + 1;
+    int jobVertices = totalVertices/(threads*4);
+    if (jobVertices < MIN_SKINNING_JOB_VERTICES) jobVertices = MIN_SKINNING_JOB_VERTICES;
+
+    int maxJobs = 0;
+    for (int i = 0; i < count; i++)
+    {
+        if (paletteOffsets[i] < 0) continue;
+        for (int m = 0; m < models[i].meshCount; m++) maxJobs += (models[i].meshes[m].vertexCount + jobVertices - 1)/jobVertices;
+    }
+
+    SkinningJob *jobs = (SkinningJob *)RL_CALLOC((maxJobs > 0)? maxJobs : 1, sizeof(SkinningJob));
+    int jobsCount = 0;
+
+    for (int i = 0; i < count; i++)
+    {
+        if (paletteOffsets[i] < 0) continue;
+
+        int boneCount = (models[i].boneCount < boneCounts[i])? models[i].boneCount : boneCounts[i];
+
+        for (int m = 0; m < models[i].meshCount; m++)
+        {
+            Mesh *mesh = &models[i].meshes[m];
+
+            if ((mesh->boneIds == NULL) || (mesh->boneWeights == NULL) || (mesh->animVertices == NULL)) continue;
+
+            for (int start = 0; start < mesh->vertexCount; start += jobVertices)
+            {
+                SkinningJob *job = &jobs[jobsCount++];
+                job->mesh = mesh;
+                job->palette = palette + paletteOffsets[i];
+                job->boneCount = boneCount;
+                job->start = start;
+                job->end = ((start + jobVertices) < mesh->vertexCount)? (start + jobVertices) : mesh->vertexCount;
+            }
+        }
+    }
+
+    // Skin vertices, calling thread runs first job and helps worker threads until all jobs finish
+    int pending = 0;
+    for (int i = 1; i < jobsCount; i++) SubmitWorkerJob(SkinningJobRun, &jobs[i], &pending);
+    if (jobsCount > 0) SkinningJobRun(&jobs[0]);
+    WaitWorkerJobs(&pending);
+
+    // Upload new vertex data to GPU for model drawing
+    for (int i = 0; i < jobsCount; i++)
+    {
+        Mesh *mesh = jobs[i].mesh;
+
+        if (jobs[i].start > 0) continue;    // Mesh uploaded once (on its first job)
+
+        rlUpdateBuffer(mesh->vboId[0], mesh->animVertices, mesh->vertexCount*3*sizeof(float));    // Update vertex position
+        if ((mesh->normals != NULL) && (mesh->animNormals != NULL)) rlUpdateBuffer(mesh->vboId[2], mesh->animNormals, mesh->vertexCount*3*sizeof(float));   // Update vertex normals
+
+        mesh->boneCount = 0;    // Mesh skinned on CPU, no GPU skinning when drawn
+    }
+
+    RL_FREE(jobs);
+    RL_FREE(palette);
+    RL_FREE(paletteOffsets);
+}
+
+// Interpolate transforms, rotation interpolated on shortest path
+static Transform LerpTransform(Transform t1, Transform t2, float amount)
+{
+    Transform result = { 0 };
+
+    // NOTE: Quaternions q and -q are same rotation, negative dot means long path interpolation
+    Quaternion q2 = t2.rotation;
+    if ((t1.rotation.x*q2.x + t1.rotation.y*q2.y + t1.rotation.z*q2.z + t1.rotation.w*q2.w) < 0.0f) q2 = (Quaternion){ -q2.x, -q2.y, -q2.z, -q2.w };
+
+    result.translation = Vector3Lerp(t1.translation, t2.translation, amount);
+    result.rotation = QuaternionNormalize(QuaternionSlerp(t1.rotation, q2, amount));
+    result.scale = Vector3Lerp(t1.scale, t2.scale, amount);
+
+    return result;
+}
+
+// Get animation track value for a bone frame pose, vectors are stored in quaternion xyz
+static Quaternion GetTrackPoseValue(Transform pose, int type)
+{
+    Quaternion value = { 0 };
+
+    if (type == ANIMATION_TRACK_ROTATION) value = pose.rotation;
+    else if (type == ANIMATION_TRACK_TRANSLATION) value = (Quaternion){ pose.translation.x, pose.translation.y, pose.translation.z, 0.0f };
+    else value = (Quaternion){ pose.scale.x, pose.scale.y, pose.scale.z, 0.0f };
+
+    return value;
+}
+
+// Get error between two animation track values (translation distance, rotation angle, scale maximum component difference)
+static float GetTrackValueError(int type, Quaternion v1, Quaternion v2)
+{
+    float error = 0.0f;
+
+    if (type == ANIMATION_TRACK_ROTATION)
+    {
+        // NOTE: Angle computed from quaternions chord distance, acos() of quaternions dot is inaccurate for small angles
+        if ((v1.x*v2.x + v1.y*v2.y + v1.z*v2.z + v1.w*v2.w) < 0.0f) v2 = (Quaternion){ -v2.x, -v2.y, -v2.z, -v2.w };
+
+        float chord = sqrtf((v1.x - v2.x)*(v1.x - v2.x) + (v1.y - v2.y)*(v1.y - v2.y) + (v1.z - v2.z)*(v1.z - v2.z) + (v1.w - v2.w)*(v1.w - v2.w));
+        error = 4.0f*asinf((chord < 2.0f)? chord*0.5f : 1.0f);
+    }
+    else if (type == ANIMATION_TRACK_TRANSLATION) error = sqrtf((v1.x - v2.x)*(v1.x - v2.x) + (v1.y - v2.y)*(v1.y - v2.y) + (v1.z - v2.z)*(v1.z - v2.z));
+    else error = fmaxf(fabsf(v1.x - v2.x), fmaxf(fabsf(v1.y - v2.y), fabsf(v1.z - v2.z)));
+
+    return error;
+}
+
+// Interpolate animation track values, same interpolation as LerpTransform()
+static Quaternion LerpTrackValue(int type, Quaternion v1, Quaternion v2, float amount)
+{
+    Quaternion result = { 0 };
+
+    if (type == ANIMATION_TRACK_ROTATION)
+    {
+        if ((v1.x*v2.x + v1.y*v2.y + v1.z*v2.z + v1.w*v2.w) < 0.0f) v2 = (Quaternion){ -v2.x, -v2.y, -v2.z, -v2.w };
+        result = QuaternionNormalize(QuaternionSlerp(v1, v2, amount));
+    }
+    else result = QuaternionLerp(v1, v2, amount);
+
+    return result;
+}
+
+// Quantize animation track value (3 unsigned shorts)
+// NOTE: Rotations use smallest-three encoding: largest component is dropped (made positive) and recomputed on decoding,
+// other components are quantized to 15 bit, dropped component index is stored on first two values high bits
+static void EncodeTrackValue(const AnimationTrack *track, int type, Quaternion value, unsigned short *encoded)
+{
+    if (type == ANIMATION_TRACK_ROTATION)
+    {
+        float q[4] = { value.x, value.y, value.z, value.w };
+        int largest = 0;
+
+        for (int i = 1; i < 4; i++) if (fabsf(q[i]) > fabsf(q[largest])) largest = i;
+
+        float sign = (q[largest] < 0.0f)? -1.0f : 1.0f;
+
+        for (int i = 0, k = 0; i < 4; i++)
+        {
+            if (i == largest) continue;
+
+            float normalized = (q[i]*sign + SQRT1_2)/(2.0f*SQRT1_2);
+            if (normalized < 0.0f) normalized = 0.0f;
+            else if (normalized > 1.0f) normalized = 1.0f;
+
+            encoded[k++] = (unsigned short)(normalized*32767.0f + 0.5f);
+        }
+
+        encoded[0] |= (unsigned short)((largest & 1) << 15);
+        encoded[1] |= (unsigned short)((largest >> 1) << 15);
+    }
+    else
+    {
+        float v[3] = { value.x, value.y, value.z };
+        float offset[3] = { track->offset.x, track->offset.y, track->offset.z };
+        float range[3] = { track->range.x, track->range.y, track->range.z };
+
+        for (int i = 0; i < 3; i++) encoded[i] = (range[i] > 0.0f)? (unsigned short)((v[i] - offset[i])/range[i]*65535.0f + 0.5f) : 0;
+    }
+}
+
+// Dequantize animation track value
+static Quaternion DecodeTrackValue(const AnimationTrack *track, int type, const unsigned short *encoded)
+{
+    Quaternion result = { 0 };
+
+    if (type == ANIMATION_TRACK_ROTATION)
+    {
+        int largest = ((encoded[0] >> 15) & 1) | (((encoded[1] >> 15) & 1) << 1);
+        float q[4] = { 0 };
+        float sum = 0.0f;
+
+        for (int i = 0, k = 0; i < 4; i++)
+        {
+            if (i == largest) continue;
+
+            q[i] = (float)(encoded[k++] & 0x7fff)/32767.0f*(2.0f*SQRT1_2) - SQRT1_2;
+            sum += q[i]*q[i];
+        }
+
+        q[largest] = sqrtf((sum < 1.0f)? (1.0f - sum) : 0.0f);
+        result = (Quaternion){ q[0], q[1], q[2], q[3] };
+    }
+    else
+    {
+        result.x = track->offset.x + (float)encoded[0]/65535.0f*track->range.x;
+        result.y = track->offset.y + (float)encoded[1]/65535.0f*track->range.y;
+        result.z = track->offset.z + (float)encoded[2]/65535.0f*track->range.z;
+    }
+
+    return result;
+}
+
+// Compress bone animation track (translation, rotation or scale), returns number of keyframes (1 for constant track)
+// NOTE: Keyframes are reduced greedily, a segment is extended while interpolation between its quantized end keyframes reproduces
+// every frame within tolerance. Poses are model space, bones errors are not accumulated through the skeleton hierarchy
+static int CompressAnimationTrack(Transform **framePoses, int frameCount, int bone, int type, float tolerance, AnimationTrack *track)
+{
+    Quaternion first = GetTrackPoseValue(framePoses[0][bone], type);
+
+    // Constant track folding, value is kept unquantized
+    bool constant = true;
+    for (int f = 1; (f < frameCount) && constant; f++)
+    {
+        if (GetTrackValueError(type, first, GetTrackPoseValue(framePoses[f][bone], type)) > tolerance) constant = false;
+    }
+
+    track->constant = first;
+    if (constant) return 1;
+
+    // Quantization range (translation, scale)
+    if (type != ANIMATION_TRACK_ROTATION)
+    {
+        Vector3 min = { first.x, first.y, first.z };
+        Vector3 max = min;
+
+        for (int f = 1; f < frameCount; f++)
+        {
+            Quaternion v = GetTrackPoseValue(framePoses[f][bone], type);
+            min = (Vector3){ fminf(min.x, v.x), fminf(min.y, v.y), fminf(min.z, v.z) };
+            max = (Vector3){ fmaxf(max.x, v.x), fmaxf(max.y, v.y), fmaxf(max.z, v.z) };
+        }
+
+        track->offset = min;
+        track->range = Vector3Subtract(max, min);
+    }
+
+    int keyCount = 0;
+    int key = 0;
+
+    track->keyFrames[keyCount] = 0;
+    EncodeTrackValue(track, type, first, track->keyValues);
+    keyCount++;
+
+    while (key < (frameCount - 1))
+    {
+        Quaternion start = DecodeTrackValue(track, type, track->keyValues + (keyCount - 1)*3);
+        int next = key + 1;
+
+        // Extend segment while intermediate frames are reproduced within tolerance
+        for (int end = key + 2; (end < frameCount) && ((end - key) <= MAX_ANIMATION_KEY_INTERVAL); end++)
+        {
+            unsigned short encoded[3] = { 0 };
+            EncodeTrackValue(track, type, GetTrackPoseValue(framePoses[end][bone], type), encoded);
+            Quaternion endValue = DecodeTrackValue(track, type, encoded);
+
+            bool valid = true;
+            for (int f = key + 1; (f < end) && valid; f++)
+            {
+                Quaternion value = LerpTrackValue(type, start, endValue, (float)(f - key)/(float)(end - key));
+                if (GetTrackValueError(type, value, GetTrackPoseValue(framePoses[f][bone], type)) > tolerance) valid = false;
+            }
+
+            if (valid) next = end;
+            else break;
+        }
+
+        track->keyFrames[keyCount] = next;
+        EncodeTrackValue(track, type, GetTrackPoseValue(framePoses[next][bone], type), track->keyValues + keyCount*3);
+        keyCount++;
+        key = next;
+    }
+
+    return keyCount;
+}
+
+// Sample animation track at frame position, keyframes interpolated
+static Quaternion SampleAnimationTrack(const AnimationTrack *track, int type, float position)
+{
+    if (track->keyCount <= 1) return track->constant;
+
+    // Binary search last keyframe before position
+    int low = 0;
+    int high = track->keyCount - 1;
+
+    while ((high - low) > 1)
+    {
+        int mid = (low + high)/2;
+        if ((float)track->keyFrames[mid] <= position) low = mid;
+        else high = mid;
+    }
+
+    float length = (float)(track->keyFrames[high] - track->keyFrames[low]);
+    float amount = (position - (float)track->keyFrames[low])/length;
+    if (amount < 0.0f) amount = 0.0f;
+    else if (amount > 1.0f) amount = 1.0f;
+
+    Quaternion v1 = DecodeTrackValue(track, type, track->keyValues + low*3);
+    Quaternion v2 = DecodeTrackValue(track, type, track->keyValues + high*3);
+
+    return LerpTrackValue(type, v1, v2, amount);
+}
+
+// Sample compressed animation bone transformation at frame position
+static Transform SampleAnimationBone(const AnimationTracks *data, int bone, float position)
+{
+    Transform result = { 0 };
+
+    Quaternion translation = SampleAnimationTrack(&data->tracks[bone*3 + ANIMATION_TRACK_TRANSLATION], ANIMATION_TRACK_TRANSLATION, position);
+    Quaternion scale = SampleAnimationTrack(&data->tracks[bone*3 + ANIMATION_TRACK_SCALE], ANIMATION_TRACK_SCALE, position);
+
+    result.translation = (Vector3){ translation.x, translation.y, translation.z };
+    result.rotation = SampleAnimationTrack(&data->tracks[bone*3 + ANIMATION_TRACK_ROTATION], ANIMATION_TRACK_ROTATION, position);
+    result.scale = (Vector3){ scale.x, scale.y, scale.z };
+
+    return result;
+}
+
+// Get animation frame pose, compressed animations are decompressed into pose buffer
+static const Transform *GetAnimationFramePose(ModelAnimation anim, int frame, Transform *buffer)
+{
+    if (anim.framePoses != NULL) return anim.framePoses[frame];
+
+    for (int i = 0; i < anim.boneCount; i++) buffer[i] = SampleAnimationBone((const AnimationTracks *)anim.tracks, i, (float)frame);
+
+    return buffer;
+}
+
+// Worker job: skin mesh vertices range on CPU (up to 4 bones weighted by vertex)
+// NOTE: Bones matrices are blended by vertex weights and applied once to position and normal (linear blend skinning),
+// vertices without weights are transformed by first bone
+static void SkinningJobRun(void *data)
+{
+    SkinningJob *job = (SkinningJob *)data;
+
+    Mesh *mesh = job->mesh;
+    const float *palette = job->palette;
+    const float identity[16] = { 1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f };
+    bool normals = (mesh->normals != NULL) && (mesh->animNormals != NULL);
+
+    for (int i = job->start; i < job->end; i++)
+    {
+        const int *boneIds = mesh->boneIds + i*4;
+        const float *boneWeights = mesh->boneWeights + i*4;
+        const float *vertex = mesh->vertices + i*3;
+        const float *normal = normals? (mesh->normals + i*3) : NULL;
+
+        // Get vertex influences, invalid influences get zero weight (always 4 influences blended, no branches)
+        // NOTE: Vertex without weights uses first bone (or no transformation)
+        const float *matrices[4] = { 0 };
+        float weights[4] = { 0 };
+        float totalWeight = 0.0f;
+
+        for (int k = 0; k < 4; k++)
+        {
+            // NOTE: Influence selected with masks, branches would be mispredicted on vertex weights changes
+            int valid = (boneWeights[k] > 0.0f) & ((unsigned int)boneIds[k] < (unsigned int)job->boneCount);
+
+            matrices[k] = palette + (boneIds[k] & -valid)*16;
+            weights[k] = boneWeights[k]*(float)valid;
+            totalWeight += weights[k];
+        }
+
+        if (totalWeight == 0.0f)
+        {
+            matrices[0] = ((boneIds[0] >= 0) && (boneIds[0] < job->boneCount))? (palette + boneIds[0]*16) : identity;
+            weights[0] = 1.0f;
+        }
+
+        float animVertex[4] = { 0 };
+        float animNormal[4] = { 0 };
+
+#if defined(MODELS_SIMD_SSE)
+        // Blend bones matrices columns
+        __m128 weight = _mm_set1_ps(weights[0]);
+        __m128 col0 = _mm_mul_ps(_mm_loadu_ps(matrices[0]), weight);
+        __m128 col1 = _mm_mul_ps(_mm_loadu_ps(matrices[0] + 4), weight);
+        __m128 col2 = _mm_mul_ps(_mm_loadu_ps(matrices[0] + 8), weight);
+        __m128 col3 = _mm_mul_ps(_mm_loadu_ps(matrices[0] + 12), weight);
+
+        for (int k = 1; k < 4; k++)
+        {
+            weight = _mm_set1_ps(weights[k]);
+            col0 = _mm_add_ps(col0, _mm_mul_ps(_mm_loadu_ps(matrices[k]), weight));
+            col1 = _mm_add_ps(col1, _mm_mul_ps(_mm_loadu_ps(matrices[k] + 4), weight));
+            col2 = _mm_add_ps(col2, _mm_mul_ps(_mm_loadu_ps(matrices[k] + 8), weight));
+            col3 = _mm_add_ps(col3, _mm_mul_ps(_mm_loadu_ps(matrices[k] + 12), weight));
+        }
+
+        __m128 rotated = _mm_add_ps(_mm_add_ps(_mm_mul_ps(col0, _mm_set1_ps(vertex[0])), _mm_mul_ps(col1, _mm_set1_ps(vertex[1]))), _mm_mul_ps(col2, _mm_set1_ps(vertex[2])));
+        _mm_storeu_ps(animVertex, _mm_add_ps(rotated, col3));
+
+        if (normals) _mm_storeu_ps(animNormal, _mm_add_ps(_mm_add_ps(_mm_mul_ps(col0, _mm_set1_ps(normal[0])), _mm_mul_ps(col1, _mm_set1_ps(normal[1]))), _mm_mul_ps(col2, _mm_set1_ps(normal[2]))));
+#elif defined(MODELS_SIMD_NEON)
+        // Blend bones matrices columns
+        float32x4_t col0 = vmulq_n_f32(vld1q_f32(matrices[0]), weights[0]);
+        float32x4_t col1 = vmulq_n_f32(vld1q_f32(matrices[0] + 4), weights[0]);
+        float32x4_t col2 = vmulq_n_f32(vld1q_f32(matrices[0] + 8), weights[0]);
+        float32x4_t col3 = vmulq_n_f32(vld1q_f32(matrices[0] + 12), weights[0]);
+
+        for (int k = 1; k < 4; k++)
+        {
+            col0 = vmlaq_n_f32(col0, vld1q_f32(matrices[k]), weights[k]);
+            col1 = vmlaq_n_f32(col1, vld1q_f32(matrices[k] + 4), weights[k]);
+            col2 = vmlaq_n_f32(col2, vld1q_f32(matrices[k] + 8), weights[k]);
+            col3 = vmlaq_n_f32(col3, vld1q_f32(matrices[k] + 12), weights[k]);
+        }
+
+        vst1q_f32(animVertex, vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(col3, col0, vertex[0]), col1, vertex[1]), col2, vertex[2]));
+
+        if (normals) vst1q_f32(animNormal, vmlaq_n_f32(vmlaq_n_f32(vmulq_n_f32(col0, normal[0]), col1, normal[1]), col2, normal[2]));
+#else
+        // Blend bones matrices (column-major)
+        float mat[16] = { 0 };
+
+        for (int k = 0; k < 4; k++)
+        {
+            for (int c = 0; c < 16; c++) mat[c] += matrices[k][c]*weights[k];
+        }
+
+        for (int c = 0; c < 3; c++)
+        {
+            animVertex[c] = mat[c]*vertex[0] + mat[4 + c]*vertex[1] + mat[8 + c]*vertex[2] + mat[12 + c];
+            if (normals) animNormal[c] = mat[c]*normal[0] + mat[4 + c]*normal[1] + mat[8 + c]*normal[2];
+        }
+#endif
+        mesh->animVertices[i*3] = animVertex[0];
+        mesh->animVertices[i*3 + 1] = animVertex[1];
+        mesh->animVertices[i*3 + 2] = animVertex[2];
+
+        if (normals)
+        {
+            // NOTE: Blended normal could be not unit length (bones scaling or weights blending)
+            float length = sqrtf(animNormal[0]*animNormal[0] + animNormal[1]*animNormal[1] + animNormal[2]*animNormal[2]);
+            if (length > 0.0f) length = 1.0f/length;
+
+            mesh->animNormals[i*3] = animNormal[0]*length;
+            mesh->animNormals[i*3 + 1] = animNormal[1]*length;
+            mesh->animNormals[i*3 + 2] = animNormal[2]*length;
+        }
+    }
+}
+
+// Get mesh triangles count, indexed meshes use triangleCount (vertexCount/3 otherwise)
+static int GetMeshTriangleCount(Mesh mesh)
+{
+    if (mesh.vertices == NULL) return 0;     // Mesh data not kept in RAM (CPU)
+
+    int triangleCount = mesh.vertexCount/3;
+
+    if ((mesh.indices != NULL) && (mesh.triangleCount > 0)) triangleCount = mesh.triangleCount;
+
+    return triangleCount;
+}
+
+// Get mesh triangle vertices (mesh space)
+static void GetMeshTriangle(Mesh mesh, int index, Vector3 *triangle)
+{
+    Vector3 *vertdata = (Vector3 *)mesh.vertices;
+
+    if (mesh.indices != NULL)
+    {
+        triangle[0] = vertdata[mesh.indices[index*3 + 0]];
+        triangle[1] = vertdata[mesh.indices[index*3 + 1]];
+        triangle[2] = vertdata[mesh.indices[index*3 + 2]];
+    }
+    else
+    {
+        triangle[0] = vertdata[index*3 + 0];
+        triangle[1] = vertdata[index*3 + 1];
+        triangle[2] = vertdata[index*3 + 2];
+    }
+}
+
+// Build mesh BVH node for a range of triangles (order), node is split by best binned SAH cost
+// NOTE: Both children nodes are allocated consecutively, bounds and centroids are indexed by triangle
+static void BuildMeshBVHNode(MeshBVH *bvh, int index, int *order, const float *bounds, const float *centroids, int start, int count, int depth)
+{
+    float min[3] = { FLT_MAX, FLT_MAX, FLT_MAX };
+    float max[3] = { -FLT_MAX, -FLT_MAX, -FLT_MAX };
+    float centroidMin[3] = { FLT_MAX, FLT_MAX, FLT_MAX };
+    float centroidMax[3] = { -FLT_MAX, -FLT_MAX, -FLT_MAX };
+
+    for (int i = start; i < (start + count); i++)
+    {
+        const float *triBounds = bounds + order[i]*6;
+        const float *centroid = centroids + order[i]*3;
+
+        for (int k = 0; k < 3; k++)
+        {
+            min[k] = fminf(min[k], triBounds[k]);
+            max[k] = fmaxf(max[k], triBounds[3 + k]);
+            centroidMin[k] = fminf(centroidMin[k], centroid[k]);
+            centroidMax[k] = fmaxf(centroidMax[k], centroid[k]);
+        }
+    }
+
+    MeshBVHNode *node = &bvh->nodes[index];
+    node->min = (Vector3){ min[0], min[1], min[2] };
+    node->max = (Vector3){ max[0], max[1], max[2] };
+    node->start = start;
+    node->count = count;
+
+    if ((count <= MIN_BVH_LEAF_TRIANGLES) || (depth >= MAX_BVH_DEPTH)) return;
+
+    // Find best split (SAH cost), triangles are binned by centroid on every axis
+    int bestAxis = -1;
+    int bestBin = 0;
+    float bestCost = FLT_MAX;
+
+    for (int axis = 0; axis < 3; axis++)
+    {
+        float extent = centroidMax[axis] - centroidMin[axis];
+        if (extent <= 0.0f) continue;
+
+        int binCounts[BVH_SAH_BINS] = { 0 };
+        float binMin[BVH_SAH_BINS][3];
+        float binMax[BVH_SAH_BINS][3];
+
+        for (int b = 0; b < BVH_SAH_BINS; b++)
+        {
+            for (int k = 0; k < 3; k++) { binMin[b][k] = FLT_MAX; binMax[b][k] = -FLT_MAX; }
+        }
+
+        float scale = (float)BVH_SAH_BINS/extent;
+
+        for (int i = start; i < (start + count); i++)
+        {
+            int b = (int)((centroids[order[i]*3 + axis] - centroidMin[axis])*scale);
+            if (b >= BVH_SAH_BINS) b = BVH_SAH_BINS - 1;
+
+            const float *triBounds = bounds + order[i]*6;
+            binCounts[b]++;
+
+            for (int k = 0; k < 3; k++)
+            {
+                binMin[b][k] = fminf(binMin[b][k], triBounds[k]);
+                binMax[b][k] = fmaxf(binMax[b][k], triBounds[3 + k]);
+            }
+        }
+
+        // Right side areas and counts swept from last bin
+        float rightAreas[BVH_SAH_BINS] = { 0 };
+        int rightCounts[BVH_SAH_BINS] = { 0 };
+        float sweepMin[3] = { FLT_MAX, FLT_MAX, FLT_MAX };
+        float sweepMax[3] = { -FLT_MAX, -FLT_MAX, -FLT_MAX };
+        int sweepCount = 0;
+
+        for (int b = BVH_SAH_BINS - 1; b > 0; b--)
+        {
+            for (int k = 0; k < 3; k++) { sweepMin[k] = fminf(sweepMin[k], binMin[b][k]); sweepMax[k] = fmaxf(sweepMax[k], binMax[b][k]); }
+            sweepCount += binCounts[b];
+
+            rightCounts[b] = sweepCount;
+            rightAreas[b] = (sweepCount > 0)? GetBoxArea(sweepMin, sweepMax) : 0.0f;
+        }
+
+        // Left side swept from first bin, split cost evaluated before every bin
+        for (int k = 0; k < 3; k++) { sweepMin[k] = FLT_MAX; sweepMax[k] = -FLT_MAX; }
+        sweepCount = 0;
+
+        for (int b = 1; b < BVH_SAH_BINS; b++)
+        {
+            for (int k = 0; k < 3; k++) { sweepMin[k] = fminf(sweepMin[k], binMin[b - 1][k]); sweepMax[k] = fmaxf(sweepMax[k], binMax[b - 1][k]); }
+            sweepCount += binCounts[b - 1];
+
+            if ((sweepCount == 0) || (rightCounts[b] == 0)) continue;
+
+            float cost = (sweepCount*GetBoxArea(sweepMin, sweepMax)) + (rightCounts[b]*rightAreas[b]);
+
+            if (cost < bestCost)
+            {
+                bestCost = cost;
+                bestAxis = axis;
+                bestBin = b;
+            }
+        }
+    }
+
+    int mid = start + count/2;
+
+    if (bestAxis >= 0)
+    {
+        // NOTE: SAH cost relative to node area, one triangle test is considered as costly as one node test
+        float area = GetBoxArea(min, max);
+        float splitCost = 1.0f + ((area > 0.0f)? bestCost/area : (float)count);
+
+        if ((splitCost >= (float)count) && (count <= MAX_BVH_LEAF_TRIANGLES)) return;
+
+        // Partition triangles by split bin
+        float scale = (float)BVH_SAH_BINS/(centroidMax[bestAxis] - centroidMin[bestAxis]);
+        int left = start;
+        int right = start + count - 1;
+
+        while (left <= right)
+        {
+            int b = (int)((centroids[order[left]*3 + bestAxis] - centroidMin[bestAxis])*scale);
+            if (b >= BVH_SAH_BINS) b = BVH_SAH_BINS - 1;
+
+            if (b < bestBin) left++;
+            else
+            {
+                int temp = order[left];
+                order[left] = order[right];
+                order[right] = temp;
+                right--;
+            }
+        }
+
+        if ((left > start) && (left < (start + count))) mid = left;
+    }
+    else if (count <= MAX_BVH_LEAF_TRIANGLES) return;   // Triangles centroids overlap, split would not separate them
+
+    int child = bvh->nodeCount;
+    bvh->nodeCount += 2;
+
+    node->start = child;
+    node->count = 0;
+
+    BuildMeshBVHNode(bvh, child, order, bounds, centroids, start, mid - start, depth + 1);
+    BuildMeshBVHNode(bvh, child + 1, order, bounds, centroids, mid, start + count - mid, depth + 1);
+}
+
+// Get box surface area (SAH cost)
+static float GetBoxArea(const float *min, const float *max)
+{
+    float dx = max[0] - min[0];
+    float dy = max[1] - min[1];
+    float dz = max[2] - min[2];
+
+    return 2.0f*(dx*dy + dy*dz + dz*dx);
+}
+
+// Unload mesh BVH data (if built)
+static void UnloadMeshBVH(Mesh *mesh)
+{
+    MeshBVH *bvh = (MeshBVH *)mesh->bvh;
+
+    if (bvh != NULL)
+    {
+        RL_FREE(bvh->nodes);
+        RL_FREE(bvh->triangles);
+        RL_FREE(bvh);
+
+        mesh->bvh = NULL;
+    }
+}
+
+// Load mesh bounds-only BVH: root node keeps mesh bounds, no triangles for collision queries
+// NOTE: Used by meshes without CPU data (UnloadMeshCPUData()), culling and MeshBoundingBox() use root node bounds
+static void LoadMeshBoundsBVH(Mesh *mesh, BoundingBox bounds)
+{
+    UnloadMeshBVH(mesh);
+
+    MeshBVH *bvh = (MeshBVH *)RL_CALLOC(1, sizeof(MeshBVH));
+    bvh->nodeCount = 1;
+    bvh->nodes = (MeshBVHNode *)RL_CALLOC(1, sizeof(MeshBVHNode));
+    bvh->nodes[0].min = bounds.min;
+    bvh->nodes[0].max = bounds.max;
+
+    mesh->bvh = bvh;
+}
+
+// Simulate GPU post-transform vertex cache (FIFO) on indices, returns total cache misses
+// NOTE: Misses by triangle (0..3) are optionally stored in triangleMisses
+static int SimulateMeshVertexCache(const unsigned short *indices, int indexCount, int vertexCount, unsigned char *triangleMisses)
+{
+    unsigned int *stamps = (unsigned int *)RL_CALLOC(vertexCount, sizeof(unsigned int));
+    unsigned int time = MESH_FIFO_CACHE_SIZE + 1;
+    int misses = 0;
+
+    for (int i = 0; i < indexCount; i += 3)
+    {
+        int triangleMiss = 0;
+
+        for (int c = 0; c < 3; c++)
+        {
+            // Vertex is in cache if pushed less than MESH_FIFO_CACHE_SIZE misses ago
+            if ((time - stamps[indices[i + c]]) > MESH_FIFO_CACHE_SIZE)
+            {
+                stamps[indices[i + c]] = time++;
+                triangleMiss++;
+            }
+        }
+
+        if (triangleMisses != NULL) triangleMisses[i/3] = (unsigned char)triangleMiss;
+        misses += triangleMiss;
+    }
+
+    RL_FREE(stamps);
+
+    return misses;
+}
+
+// Get vertex score for vertex cache optimization (Forsyth), based on cache position and remaining triangles
+// REF: https://tomforsyth1000.github.io/papers/fast_vert_cache_opt.html
+static float GetMeshVertexCacheScore(int cachePosition, int liveTriangles)
+{
+    if (liveTriangles == 0) return -1.0f;   // No triangles left to draw using this vertex
+
+    float score = 0.0f;
+
+    // Vertices used by last triangle get a fixed score, so the triangle is not reused right away
+    if (cachePosition >= 3) score = powf(1.0f - (float)(cachePosition - 3)/(MESH_LRU_CACHE_SIZE - 3), 1.5f);
+    else if (cachePosition >= 0) score = 0.75f;
+
+    // Boost vertices with few triangles left, so they are finished and removed
+    score += 2.0f/sqrtf((float)liveTriangles);
+
+    return score;
+}
+
+// Reorder triangles for post-transform vertex cache efficiency (Forsyth linear-speed algorithm)
+// NOTE: Next triangle is the best scored one using vertices in simulated LRU cache
+static void OptimizeMeshVertexCache(unsigned short *indices, int indexCount, int vertexCount)
+{
+    int triangleCount = indexCount/3;
+
+    int *liveTriangles = (int *)RL_CALLOC(vertexCount, sizeof(int));
+    int *offsets = (int *)RL_MALLOC((vertexCount + 1)*sizeof(int));
+    int *adjacency = (int *)RL_MALLOC(indexCount*sizeof(int));
+    int *cachePosition = (int *)RL_MALLOC(vertexCount*sizeof(int));
+    float *vertexScore = (float *)RL_MALLOC(vertexCount*sizeof(float));
+    unsigned char *emitted = (unsigned char *)RL_CALLOC(triangleCount, sizeof(unsigned char));
+    unsigned short *result = (unsigned short *)RL_MALLOC(indexCount*sizeof(unsigned short));
+
+    // Vertices triangles adjacency lists, live triangles are kept at lists start
+    for (int i = 0; i < indexCount; i++) liveTriangles[indices[i]]++;
+
+    offsets[0] = 0;
+    for (int v = 0; v < vertexCount; v++) offsets[v + 1] = offsets[v] + liveTriangles[v];
+    for (int v = 0; v < vertexCount; v++) liveTriangles[v] = 0;
+
+    for (int i = 0; i < indexCount; i++)
+    {
+        int v = indices[i];
+        adjacency[offsets[v] + liveTriangles[v]++] = i/3;
+    }
+
+    for (int v = 0; v < vertexCount; v++)
+    {
+        cachePosition[v] = -1;
+        vertexScore[v] = GetMeshVertexCacheScore(-1, liveTriangles[v]);
+    }
+
+    int cache[MESH_LRU_CACHE_SIZE + 3] = { 0 };
+    int cacheCount = 0;
+    int nextTriangle = 0;       // Next not emitted triangle in input order, used if cache has no candidates
+    int best = -1;
+
+    for (int t = 0; t < triangleCount; t++)
+    {
+        if (best < 0)
+        {
+            while (emitted[nextTriangle]) nextTriangle++;
+            best = nextTriangle;
+        }
+
+        const unsigned short *triangle = &indices[best*3];
+        memcpy(&result[t*3], triangle, 3*sizeof(unsigned short));
+        emitted[best] = 1;
+
+        // Remove triangle from its vertices live triangles
+        for (int c = 0; c < 3; c++)
+        {
+            int v = triangle[c];
+            int *list = &adjacency[offsets[v]];
+
+            for (int k = 0; k < liveTriangles[v]; k++)
+            {
+                if (list[k] == best)
+                {
+                    list[k] = list[liveTriangles[v] - 1];
+                    list[liveTriangles[v] - 1] = best;
+                    liveTriangles[v]--;
+                    break;
+                }
+            }
+        }
+
+        // Triangle vertices are moved to cache front, vertices pushed out of cache are scored as well
+        int newCache[MESH_LRU_CACHE_SIZE + 3] = { 0 };
+        int newCount = 0;
+
+        for (int c = 0; c < 3; c++)
+        {
+            if ((c > 0) && (triangle[c] == triangle[0])) continue;
+            if ((c > 1) && (triangle[c] == triangle[1])) continue;
+            newCache[newCount++] = triangle[c];
+        }
+
+        for (int k = 0; k < cacheCount; k++)
+        {
+            if ((cache[k] != triangle[0]) && (cache[k] != triangle[1]) && (cache[k] != triangle[2])) newCache[newCount++] = cache[k];
+        }
+
+        for (int k = 0; k < newCount; k++)
+        {
+            int v = newCache[k];
+            cachePosition[v] = (k < MESH_LRU_CACHE_SIZE)? k : -1;
+            vertexScore[v] = GetMeshVertexCacheScore(cachePosition[v], liveTriangles[v]);
+        }
+
+        // Rescore cached vertices live triangles, best one is next triangle
+        float bestScore = -1.0f;
+        best = -1;
+
+        for (int k = 0; k < newCount; k++)
+        {
+            int v = newCache[k];
+
+            for (int i = 0; i < liveTriangles[v]; i++)
+            {
+                int candidate = adjacency[offsets[v] + i];
+                float score = vertexScore[indices[candidate*3]] + vertexScore[indices[candidate*3 + 1]] + vertexScore[indices[candidate*3 + 2]];
+
+                if (score > bestScore)
+                {
+                    bestScore = score;
+                    best = candidate;
+                }
+            }
+        }
+
+        cacheCount = (newCount < MESH_LRU_CACHE_SIZE)? newCount : MESH_LRU_CACHE_SIZE;
+        memcpy(cache, newCache, cacheCount*sizeof(int));
+    }
+
+    memcpy(indices, result, indexCount*sizeof(unsigned short));
+
+    RL_FREE(result);
+    RL_FREE(emitted);
+    RL_FREE(vertexScore);
+    RL_FREE(cachePosition);
+    RL_FREE(adjacency);
+    RL_FREE(offsets);
+    RL_FREE(liveTriangles);
+}
+
+// Compare mesh overdraw clusters by sort key (descending), ties keep indices order
+static int CompareMeshClusters(const void *a, const void *b)
+{
+    const MeshCluster *cluster1 = (const MeshCluster *)a;
+    const MeshCluster *cluster2 = (const MeshCluster *)b;
+
+    if (cluster1->key > cluster2->key) return -1;
+    if (cluster1->key < cluster2->key) return 1;
+
+    return cluster1->start - cluster2->start;
+}
+
+// Reorder triangles clusters to reduce overdraw, keeping vertex cache efficiency inside clusters
+// NOTE: Triangles order is split into clusters where vertex cache restarts (all triangle vertices miss),
+// clusters facing outwards from mesh center are drawn first, occluding clusters behind them
+// REF: Sander, Nehab, Barczak - Fast Triangle Reordering for Vertex Locality and Reduced Overdraw (2007)
+static void OptimizeMeshOverdraw(unsigned short *indices, int indexCount, const float *vertices, int vertexCount)
+{
+    int triangleCount = indexCount/3;
+    if (triangleCount <= 1) return;
+
+    unsigned char *triangleMisses = (unsigned char *)RL_MALLOC(triangleCount*sizeof(unsigned char));
+    SimulateMeshVertexCache(indices, indexCount, vertexCount, triangleMisses);
+
+    MeshCluster *clusters = (MeshCluster *)RL_MALLOC(triangleCount*sizeof(MeshCluster));
+    int clusterCount = 0;
+
+    for (int t = 0; t < triangleCount; t++)
+    {
+        if ((t == 0) || (triangleMisses[t] == 3)) clusters[clusterCount++] = (MeshCluster){ 0.0f, t, 0 };
+        clusters[clusterCount - 1].count++;
+    }
+
+    RL_FREE(triangleMisses);
+
+    if (clusterCount > 1)
+    {
+        const Vector3 *positions = (const Vector3 *)vertices;
+        Vector3 center = { 0.0f, 0.0f, 0.0f };
+
+        for (int v = 0; v < vertexCount; v++) center = Vector3Add(center, positions[v]);
+        center = Vector3Scale(center, 1.0f/vertexCount);
+
+        for (int i = 0; i < clusterCount; i++)
+        {
+            // Cluster centroid and area weighted normal
+            Vector3 centroid = { 0.0f, 0.0f, 0.0f };
+            Vector3 normal = { 0.0f, 0.0f, 0.0f };
+
+            for (int t = clusters[i].start; t < (clusters[i].start + clusters[i].count); t++)
+            {
+                Vector3 p1 = positions[indices[t*3]];
+                Vector3 p2 = positions[indices[t*3 + 1]];
+                Vector3 p3 = positions[indices[t*3 + 2]];
+
+                centroid = Vector3Add(centroid, Vector3Add(p1, Vector3Add(p2, p3)));
+                normal = Vector3Add(normal, Vector3CrossProduct(Vector3Subtract(p2, p1), Vector3Subtract(p3, p1)));
+            }
+
+            centroid = Vector3Scale(centroid, 1.0f/(clusters[i].count*3));
+            clusters[i].key = Vector3DotProduct(Vector3Subtract(centroid, center), Vector3Normalize(normal));
+        }
+
+        qsort(clusters, clusterCount, sizeof(MeshCluster), CompareMeshClusters);
+
+        unsigned short *result = (unsigned short *)RL_MALLOC(indexCount*sizeof(unsigned short));
+
+        for (int i = 0, t = 0; i < clusterCount; i++)
+        {
+            memcpy(&result[t*3], &indices[clusters[i].start*3], clusters[i].count*3*sizeof(unsigned short));
+            t += clusters[i].count;
+        }
+
+        memcpy(indices, result, indexCount*sizeof(unsigned short));
+        RL_FREE(result);
+    }
+
+    RL_FREE(clusters);
+}
+
+// Weld mesh vertices with all attributes equal, returns unique vertices count
+// NOTE: Vertex remap table is filled with new vertex index, unique vertices keep first use order
+static int WeldMeshVertices(const Mesh *mesh, int *remap)
+{
+    const void *arrays[MESH_VERTEX_ARRAYS] = { mesh->vertices, mesh->texcoords, mesh->texcoords2, mesh->normals, mesh->tangents, mesh->colors, mesh->boneIds, mesh->boneWeights };
+    const int sizes[MESH_VERTEX_ARRAYS] = { 3*sizeof(float), 2*sizeof(float), 2*sizeof(float), 3*sizeof(float), 4*sizeof(float), 4*sizeof(unsigned char), 4*sizeof(int), 4*sizeof(float) };
+
+    int tableSize = 1;
+    while (tableSize < mesh->vertexCount*2) tableSize *= 2;
+
+    int *table = (int *)RL_MALLOC(tableSize*sizeof(int));
+    memset(table, 0xff, tableSize*sizeof(int));
+
+    const unsigned int *positions = (const unsigned int *)mesh->vertices;
+    int uniqueCount = 0;
+
+    for (int i = 0; i < mesh->vertexCount; i++)
+    {
+        // NOTE: Vertices are hashed by position bits, remaining attributes are only compared
+        unsigned int hash = positions[i*3]*0x9e3779b1u + positions[i*3 + 1]*0x85ebca77u + positions[i*3 + 2]*0xc2b2ae3du;
+        hash = (hash ^ (hash >> 15))&(tableSize - 1);
+
+        while (table[hash] != -1)
+        {
+            int j = table[hash];
+            bool equal = true;
+
+            for (int k = 0; (k < MESH_VERTEX_ARRAYS) && equal; k++)
+            {
+                if (arrays[k] != NULL) equal = (memcmp((const unsigned char *)arrays[k] + i*sizes[k], (const unsigned char *)arrays[k] + j*sizes[k], sizes[k]) == 0);
+            }
+
+            if (equal) break;
+
+            hash = (hash + 1)&(tableSize - 1);
+        }
+
+        if (table[hash] == -1)
+        {
+            table[hash] = i;
+            remap[i] = uniqueCount++;
+        }
+        else remap[i] = remap[table[hash]];
+    }
+
+    RL_FREE(table);
+
+    return uniqueCount;
+}
+
+// Remap mesh vertex arrays (old vertex i moved to remap[i], -1 if removed), arrays are reallocated
+static void RemapMeshVertices(Mesh *mesh, const int *remap, int newCount)
+{
+    void **arrays[MESH_VERTEX_ARRAYS + 2] = { (void **)&mesh->vertices, (void **)&mesh->texcoords, (void **)&mesh->texcoords2, (void **)&mesh->normals, (void **)&mesh->tangents,
+                                              (void **)&mesh->colors, (void **)&mesh->boneIds, (void **)&mesh->boneWeights, (void **)&mesh->animVertices, (void **)&mesh->animNormals };
+    const int sizes[MESH_VERTEX_ARRAYS + 2] = { 3*sizeof(float), 2*sizeof(float), 2*sizeof(float), 3*sizeof(float), 4*sizeof(float), 4*sizeof(unsigned char),
+                                                4*sizeof(int), 4*sizeof(float), 3*sizeof(float), 3*sizeof(float) };
+
+    for (int k = 0; k < (MESH_VERTEX_ARRAYS + 2); k++)
+    {
+        const unsigned char *data = (const unsigned char *)*arrays[k];
+        if (data == NULL) continue;
+
+        unsigned char *remapped = (unsigned char *)RL_MALLOC(newCount*sizes[k]);
+
+        for (int i = 0; i < mesh->vertexCount; i++)
+        {
+            if (remap[i] >= 0) memcpy(remapped + remap[i]*sizes[k], data + i*sizes[k], sizes[k]);
+        }
+
+        RL_FREE(*arrays[k]);
+        *arrays[k] = remapped;
+    }
+
+    mesh->vertexCount = newCount;
+}
+
+// Simplify mesh indices down to target indices count (quadric error edge collapse), returns indices count
+// NOTE: Vertices are collapsed into a neighbour vertex (half-edge collapse), so vertex attributes are kept.
+// Collapses are done in passes, sorted by error, every vertex is collapsed or collapsed into once by pass
+// REF: Garland, Heckbert - Surface Simplification Using Quadric Error Metrics (1997)
+static int SimplifyMeshIndices(unsigned short *indices, int indexCount, const float *vertices, int vertexCount, int targetCount, float *error)
+{
+    const Vector3 *positions = (const Vector3 *)vertices;
+
+    // Vertex quadrics: plane equation products (a*a, a*b, a*c, a*d, b*b, b*c, b*d, c*c, c*d, d*d) and weight, area weighted
+    double *quadrics = (double *)RL_CALLOC(vertexCount*11, sizeof(double));
+    unsigned char *locked = (unsigned char *)RL_CALLOC(vertexCount, sizeof(unsigned char));
+    int *remap = (int *)RL_MALLOC(vertexCount*sizeof(int));
+    int *offsets = (int *)RL_MALLOC((vertexCount + 1)*sizeof(int));
+    int *adjacency = (int *)RL_MALLOC(indexCount*sizeof(int));
+    unsigned char *collapsed = (unsigned char *)RL_MALLOC(vertexCount*sizeof(unsigned char));
+    MeshCollapse *collapses = (MeshCollapse *)RL_MALLOC(indexCount*2*sizeof(MeshCollapse));
+
+    for (int i = 0; i < indexCount; i += 3)
+    {
+        Vector3 p1 = positions[indices[i]];
+        Vector3 normal = Vector3CrossProduct(Vector3Subtract(positions[indices[i + 1]], p1), Vector3Subtract(positions[indices[i + 2]], p1));
+        float area = Vector3Length(normal);
+
+        if (area <= 0.0f) continue;
+
+        normal = Vector3Scale(normal, 1.0f/area);
+        double plane[4] = { normal.x, normal.y, normal.z, -Vector3DotProduct(normal, p1) };
+        double products[11] = { plane[0]*plane[0], plane[0]*plane[1], plane[0]*plane[2], plane[0]*plane[3], plane[1]*plane[1],
+                                plane[1]*plane[2], plane[1]*plane[3], plane[2]*plane[2], plane[2]*plane[3], plane[3]*plane[3], 1.0 };
+
+        for (int c = 0; c < 3; c++)
+        {
+            for (int k = 0; k < 11; k++) quadrics[indices[i + c]*11 + k] += products[k]*area;
+        }
+    }
+
+    // Lock vertices sharing position with other vertices (attribute seams)
+    int tableSize = 1;
+    while (tableSize < vertexCount*2) tableSize *= 2;
+
+    int *table = (int *)RL_MALLOC(tableSize*sizeof(int));
+    memset(table, 0xff, tableSize*sizeof(int));
+
+    for (int v = 0; v < vertexCount; v++)
+    {
+        const unsigned int *bits = (const unsigned int *)&vertices[v*3];
+        unsigned int hash = bits[0]*0x9e3779b1u + bits[1]*0x85ebca77u + bits[2]*0xc2b2ae3du;
+        hash = (hash ^ (hash >> 15))&(tableSize - 1);
+
+        while ((table[hash] != -1) && (memcmp(&vertices[table[hash]*3], &vertices[v*3], 3*sizeof(float)) != 0)) hash = (hash + 1)&(tableSize - 1);
+
+        if (table[hash] == -1) table[hash] = v;
+        else locked[v] = locked[table[hash]] = 1;
+    }
+
+    RL_FREE(table);
+
+    float maxError = 0.0f;
+    bool bordersLocked = false;
+
+    while (indexCount > targetCount)
+    {
+        // Vertices triangles adjacency
+        memset(offsets, 0, (vertexCount + 1)*sizeof(int));
+        for (int i = 0; i < indexCount; i++) offsets[indices[i] + 1]++;
+        for (int v = 0; v < vertexCount; v++) offsets[v + 1] += offsets[v];
+        for (int i = 0; i < indexCount; i++) adjacency[offsets[indices[i]]++] = i/3;
+        for (int v = vertexCount; v > 0; v--) offsets[v] = offsets[v - 1];
+        offsets[0] = 0;
+
+        // Lock border vertices (edge with no opposite edge in adjacent triangles), once
+        if (!bordersLocked)
+        {
+            for (int v = 0; v < vertexCount; v++)
+            {
+                for (int a = offsets[v]; (a < offsets[v + 1]) && !locked[v]; a++)
+                {
+                    const unsigned short *triangle = &indices[adjacency[a]*3];
+                    int next = (triangle[0] == v)? triangle[1] : ((triangle[1] == v)? triangle[2] : triangle[0]);
+                    bool opposite = false;
+
+                    for (int b = offsets[v]; (b < offsets[v + 1]) && !opposite; b++)
+                    {
+                        const unsigned short *other = &indices[adjacency[b]*3];
+                        int prev = (other[0] == v)? other[2] : ((other[1] == v)? other[0] : other[1]);
+                        opposite = (prev == next);
                     }
+
+                    if (!opposite) locked[v] = 1;
+                }
+            }
+
+            bordersLocked = true;
+        }
+
+        // Collapse candidates: triangle edges from not locked vertices, sorted by error
+        int collapseCount = 0;
+
+        for (int i = 0; i < indexCount; i++)
+        {
+            int from = indices[i];
+            int to = indices[(i%3 == 2)? (i - 2) : (i + 1)];
+
+            for (int e = 0; e < 2; e++)
+            {
+                if (!locked[from] && (from != to))
+                {
+                    const double *q1 = &quadrics[from*11];
+                    const double *q2 = &quadrics[to*11];
+                    double q[11] = { 0 };
+                    for (int k = 0; k < 11; k++) q[k] = q1[k] + q2[k];
+
+                    double x = positions[to].x, y = positions[to].y, z = positions[to].z;
+                    double cost = q[0]*x*x + 2*q[1]*x*y + 2*q[2]*x*z + 2*q[3]*x + q[4]*y*y + 2*q[5]*y*z + 2*q[6]*y + q[7]*z*z + 2*q[8]*z + q[9];
+
+                    collapses[collapseCount++] = (MeshCollapse){ (q[10] > 0.0)? (float)fmax(cost/q[10], 0.0) : 0.0f, from, to };
+                }
+
+                int temp = from;
+                from = to;
+                to = temp;
+            }
+        }
+
+        qsort(collapses, collapseCount, sizeof(MeshCollapse), CompareMeshCollapses);
+
+        // Every collapse removes two triangles (manifold), no more than a third of triangles by pass
+        int collapseLimit = (indexCount - targetCount)/6;
+        if (collapseLimit > indexCount/9) collapseLimit = indexCount/9;
+        if (collapseLimit < 1) collapseLimit = 1;
+
+        int collapsedCount = 0;
+
+        for (int v = 0; v < vertexCount; v++) remap[v] = v;
+        memset(collapsed, 0, vertexCount*sizeof(unsigned char));
+
+        for (int c = 0; (c < collapseCount) && (collapsedCount < collapseLimit); c++)
+        {
+            int from = collapses[c].from;
+            int to = collapses[c].to;
+
+            if (collapsed[from] || collapsed[to]) continue;
+
+            // Reject collapses flipping adjacent triangles
+            bool flipped = false;
+
+            for (int a = offsets[from]; (a < offsets[from + 1]) && !flipped; a++)
+            {
+                const unsigned short *triangle = &indices[adjacency[a]*3];
+                int corners[3] = { remap[triangle[0]], remap[triangle[1]], remap[triangle[2]] };
+
+                if ((corners[0] == to) || (corners[1] == to) || (corners[2] == to)) continue;
+
+                Vector3 p[3] = { positions[corners[0]], positions[corners[1]], positions[corners[2]] };
+                Vector3 normal = Vector3CrossProduct(Vector3Subtract(p[1], p[0]), Vector3Subtract(p[2], p[0]));
+
+                for (int k = 0; k < 3; k++) if (corners[k] == from) p[k] = positions[to];
+
+                Vector3 collapsedNormal = Vector3CrossProduct(Vector3Subtract(p[1], p[0]), Vector3Subtract(p[2], p[0]));
+                flipped = (Vector3DotProduct(normal, collapsedNormal) <= 0.0f);
+            }
+
+            if (flipped) continue;
+
+            remap[from] = to;
+            collapsed[from] = collapsed[to] = 1;
+            for (int k = 0; k < 11; k++) quadrics[to*11 + k] += quadrics[from*11 + k];
+
+            if (collapses[c].cost > maxError) maxError = collapses[c].cost;
+            collapsedCount++;
+        }
+
+        if (collapsedCount == 0) break;
+
+        // Remap indices, degenerated triangles are removed
+        int count = 0;
+
+        for (int i = 0; i < indexCount; i += 3)
+        {
+            int v1 = remap[indices[i]];
+            int v2 = remap[indices[i + 1]];
+            int v3 = remap[indices[i + 2]];
+
+            if ((v1 == v2) || (v2 == v3) || (v3 == v1)) continue;
+
+            indices[count++] = (unsigned short)v1;
+            indices[count++] = (unsigned short)v2;
+            indices[count++] = (unsigned short)v3;
+        }
+
+        indexCount = count;
+    }
+
+    RL_FREE(collapses);
+    RL_FREE(collapsed);
+    RL_FREE(adjacency);
+    RL_FREE(offsets);
+    RL_FREE(remap);
+    RL_FREE(locked);
+    RL_FREE(quadrics);
+
+    *error = sqrtf(maxError);
+
+    return indexCount;
+}
+
+// Compare mesh collapses by error (ascending)
+static int CompareMeshCollapses(const void *a, const void *b)
+{
+    const MeshCollapse *collapse1 = (const MeshCollapse *)a;
+    const MeshCollapse *collapse2 = (const MeshCollapse *)b;
+
+    if (collapse1->cost < collapse2->cost) return -1;
+    if (collapse1->cost > collapse2->cost) return 1;
+
+    return 0;
+}
+
+// Get model LOD level to draw with transform, level simplification error projected on screen must be under threshold
+// NOTE: Level 0 is full detail model meshes, view depth is measured to nearest model bounds point (bounding sphere)
+static int GetModelLODLevel(Model model, Matrix transform)
+{
+    const ModelLODs *lods = (const ModelLODs *)model.lods;
+    if ((lods == NULL) || (lods->levelCount == 0)) return 0;
+
+    Matrix projection = GetMatrixProjection();
+    Matrix modelview = GetMatrixModelview();
+
+    // Transform scale is the longest basis vector, errors and radius are scaled by it
+    float scale = fmaxf(Vector3Length((Vector3){ transform.m0, transform.m1, transform.m2 }),
+                  fmaxf(Vector3Length((Vector3){ transform.m4, transform.m5, transform.m6 }), Vector3Length((Vector3){ transform.m8, transform.m9, transform.m10 })));
+
+    Vector3 center = Vector3Transform(Vector3Scale(Vector3Add(lods->bounds.min, lods->bounds.max), 0.5f), transform);
+    float radius = Vector3Distance(lods->bounds.min, lods->bounds.max)*0.5f*scale;
+
+    // Pixels by world unit at view depth (perspective) or for any depth (orthographic)
+    float pixelsPerUnit = projection.m5*GetScreenHeight()*0.5f;
+
+    if (projection.m11 != 0.0f)
+    {
+        float depth = -(modelview.m2*center.x + modelview.m6*center.y + modelview.m10*center.z + modelview.m14) - radius;
+        if (depth <= 0.0f) return 0;
+
+        pixelsPerUnit /= depth;
+    }
+
+    for (int level = lods->levelCount; level > 0; level--)
+    {
+        if ((lods->errors[level - 1]*scale*pixelsPerUnit) <= modelLODThreshold) return level;
+    }
+
+    return 0;
+}
+
+// Unload model LODs meshes
+static void UnloadModelLODs(Model *model)
+{
+    ModelLODs *lods = (ModelLODs *)model->lods;
+
+    if (lods != NULL)
+    {
+        for (int i = 0; i < lods->levelCount*model->meshCount; i++) UnloadMesh(lods->meshes[i]);
+
+        RL_FREE(lods->meshes);
+        RL_FREE(lods->errors);
+        RL_FREE(lods);
+
+        model->lods = NULL;
+    }
+}
+
+// Generate terrain chunk mesh at LOD (one vertex every 2^lod heights), edges facing coarser chunks are stitched
+// NOTE: Stitched edges odd vertices are merged into previous even vertex (degenerated triangles removed), so edge
+// matches coarser chunk edge. Normals are computed from full detail heights, mesh data is released after upload
+static Mesh GenTerrainChunkMesh(Terrain terrain, int index, int lod, int stitch)
+{
+    const TerrainData *data = (const TerrainData *)terrain.terrainData;
+    const float *heights = data->chunks[index].heights;
+
+    int step = 1 << lod;
+    int cells = data->chunkCells >> lod;
+    int side = cells + 1;
+    int stride = data->chunkCells + 3;
+    int originX = (index%data->chunksX)*data->chunkCells;
+    int originZ = (index/data->chunksX)*data->chunkCells;
+    int mapMaxX = data->heightmap.width - 1;
+    int mapMaxZ = data->heightmap.height - 1;
+    float cellSizeX = terrain.size.x/mapMaxX;
+    float cellSizeZ = terrain.size.z/mapMaxZ;
+
+    Mesh mesh = { 0 };
+    mesh.vertexCount = side*side;
+    mesh.vertices = (float *)RL_MALLOC(mesh.vertexCount*3*sizeof(float));
+    mesh.normals = (float *)RL_MALLOC(mesh.vertexCount*3*sizeof(float));
+    mesh.texcoords = (float *)RL_MALLOC(mesh.vertexCount*2*sizeof(float));
+    mesh.indices = (unsigned short *)RL_MALLOC(cells*cells*6*sizeof(unsigned short));
+    mesh.vboId = (unsigned int *)RL_CALLOC(MAX_MESH_VBO, sizeof(unsigned int));
+
+    for (int j = 0, v = 0; j < side; j++)
+    {
+        for (int i = 0; i < side; i++, v++)
+        {
+            int x = i*step;
+            int z = j*step;
+            const float *height = &heights[(z + 1)*stride + x + 1];
+
+            // NOTE: Chunks over heightmap limits are clamped (zero area triangles out of terrain)
+            int mapX = (originX + x < mapMaxX)? originX + x : mapMaxX;
+            int mapZ = (originZ + z < mapMaxZ)? originZ + z : mapMaxZ;
+
+            mesh.vertices[v*3] = mapX*cellSizeX;
+            mesh.vertices[v*3 + 1] = height[0];
+            mesh.vertices[v*3 + 2] = mapZ*cellSizeZ;
+
+            Vector3 normal = { (height[-1] - height[1])/(2.0f*cellSizeX), 1.0f, (height[-stride] - height[stride])/(2.0f*cellSizeZ) };
+            normal = Vector3Normalize(normal);
+
+            mesh.normals[v*3] = normal.x;
+            mesh.normals[v*3 + 1] = normal.y;
+            mesh.normals[v*3 + 2] = normal.z;
+
+            mesh.texcoords[v*2] = (float)mapX/mapMaxX;
+            mesh.texcoords[v*2 + 1] = (float)mapZ/mapMaxZ;
+        }
+    }
+
+    int count = 0;
+
+    for (int j = 0; j < cells; j++)
+    {
+        for (int i = 0; i < cells; i++)
+        {
+            // Cell corners: (i, j), (i, j + 1), (i + 1, j), (i + 1, j + 1)
+            int corners[4][2] = { { i, j }, { i, j + 1 }, { i + 1, j }, { i + 1, j + 1 } };
+
+            for (int c = 0; c < 4; c++)
+            {
+                if ((corners[c][0]%2 == 1) && (((corners[c][1] == 0) && (stitch & TERRAIN_STITCH_MIN_Z)) || ((corners[c][1] == cells) && (stitch & TERRAIN_STITCH_MAX_Z)))) corners[c][0]--;
+                if ((corners[c][1]%2 == 1) && (((corners[c][0] == 0) && (stitch & TERRAIN_STITCH_MIN_X)) || ((corners[c][0] == cells) && (stitch & TERRAIN_STITCH_MAX_X)))) corners[c][1]--;
+            }
+
+            const int triangles[2][3] = { { 0, 1, 2 }, { 2, 1, 3 } };
+
+            for (int t = 0; t < 2; t++)
+            {
+                const int *c1 = corners[triangles[t][0]];
+                const int *c2 = corners[triangles[t][1]];
+                const int *c3 = corners[triangles[t][2]];
+
+                // Skip triangles degenerated by stitching (zero area on grid)
+                if (((c2[0] - c1[0])*(c3[1] - c1[1]) - (c2[1] - c1[1])*(c3[0] - c1[0])) == 0) continue;
+
+                mesh.indices[count++] = (unsigned short)(c1[1]*side + c1[0]);
+                mesh.indices[count++] = (unsigned short)(c2[1]*side + c2[0]);
+                mesh.indices[count++] = (unsigned short)(c3[1]*side + c3[0]);
+            }
+        }
+    }
+
+    mesh.triangleCount = count/3;
+
+    // Upload vertex data to GPU (static mesh), only GPU data is kept
+    // NOTE: OpenGL 1.1 draws meshes from RAM (CPU) data
+    rlLoadMesh(&mesh, false);
+
+    if (rlGetVersion() != OPENGL_11)
+    {
+        RL_FREE(mesh.vertices);
+        RL_FREE(mesh.normals);
+        RL_FREE(mesh.texcoords);
+        RL_FREE(mesh.indices);
+
+        mesh.vertices = NULL;
+        mesh.normals = NULL;
+        mesh.texcoords = NULL;
+        mesh.indices = NULL;
+    }
+
+    return mesh;
+}
+
+// Worker job: load terrain chunks heights requested, with one sample border (normals computed across chunks)
+// NOTE: Heights outside heightmap are clamped to heightmap limits, heights are NULL if chunk region could not be read
+static void LoadTerrainChunksJob(void *data)
+{
+    TerrainData *terrainData = (TerrainData *)data;
+    TiledImage heightmap = terrainData->heightmap;
+    int cells = terrainData->chunkCells;
+    int stride = cells + 3;
+
+    for (int i = 0; i < terrainData->loadCount; i++)
+    {
+        int originX = (terrainData->loadChunks[i]%terrainData->chunksX)*cells;
+        int originZ = (terrainData->loadChunks[i]/terrainData->chunksX)*cells;
+
+        // NOTE: Region is clipped by GetTiledImageRegion() to heightmap limits
+        int x0 = (originX > 0)? originX - 1 : 0;
+        int z0 = (originZ > 0)? originZ - 1 : 0;
+        Image region = GetTiledImageRegion(heightmap, (Rectangle){ (float)(originX - 1), (float)(originZ - 1), (float)stride, (float)stride });
+
+        if (region.data == NULL) continue;
+
+        float *values = (float *)RL_MALLOC(region.width*region.height*sizeof(float));
+
+        if ((region.format == UNCOMPRESSED_R32) || (region.format == UNCOMPRESSED_R32G32B32) || (region.format == UNCOMPRESSED_R32G32B32A32))
+        {
+            int channels = (region.format == UNCOMPRESSED_R32)? 1 : ((region.format == UNCOMPRESSED_R32G32B32)? 3 : 4);
+            for (int p = 0; p < region.width*region.height; p++) values[p] = ((float *)region.data)[p*channels];
+        }
+        else
+        {
+            Color *pixels = GetImageData(region);
+            for (int p = 0; p < region.width*region.height; p++) values[p] = (pixels[p].r + pixels[p].g + pixels[p].b)/(3.0f*255.0f);
+            RL_FREE(pixels);
+        }
+
+        float *heights = (float *)RL_MALLOC(stride*stride*sizeof(float));
+
+        for (int z = 0; z < stride; z++)
+        {
+            int mapZ = originZ - 1 + z;
+            if (mapZ < 0) mapZ = 0;
+            else if (mapZ > (heightmap.height - 1)) mapZ = heightmap.height - 1;
+
+            for (int x = 0; x < stride; x++)
+            {
+                int mapX = originX - 1 + x;
+                if (mapX < 0) mapX = 0;
+                else if (mapX > (heightmap.width - 1)) mapX = heightmap.width - 1;
+
+                heights[z*stride + x] = values[(mapZ - z0)*region.width + (mapX - x0)]*terrainData->heightScale;
+            }
+        }
+
+        RL_FREE(values);
+        UnloadImage(region);
+
+        terrainData->loadHeights[i] = heights;
+    }
+}
+
+// Load cubicmap cells type from image pixels: white pixels are walls, black pixels floors, any other color is empty
+static unsigned char *LoadCubicmapCells(Image cubicmap)
+{
+    if ((cubicmap.data == NULL) || (cubicmap.width < 1) || (cubicmap.height < 1)) return NULL;
+
+    Color *pixels = GetImageData(cubicmap);
+    unsigned char *cells = (unsigned char *)RL_MALLOC(cubicmap.width*cubicmap.height*sizeof(unsigned char));
+
+    for (int i = 0; i < cubicmap.width*cubicmap.height; i++)
+    {
+        if ((pixels[i].r == 255) && (pixels[i].g == 255) && (pixels[i].b == 255)) cells[i] = CUBICMAP_CELL_WALL;
+        else if ((pixels[i].r == 0) && (pixels[i].g == 0) && (pixels[i].b == 0)) cells[i] = CUBICMAP_CELL_FLOOR;
+        else cells[i] = CUBICMAP_CELL_EMPTY;
+    }
+
+    RL_FREE(pixels);
+
+    return cells;
+}
+
+// Merge mask cells into rectangles (greedy meshing): rows extended along X first, then along Z while full rows match
+// NOTE: Mask cells are cleared once merged, returns number of rectangles added
+static int GenCubicmapRects(unsigned char *mask, int width, int height, bool mergeX, bool mergeZ, int face, CubicmapRect *rects)
+{
+    int count = 0;
+
+    for (int z = 0; z < height; z++)
+    {
+        for (int x = 0; x < width; x++)
+        {
+            if (!mask[z*width + x]) continue;
+
+            int rectWidth = 1;
+            int rectHeight = 1;
+
+            if (mergeX) while (((x + rectWidth) < width) && mask[z*width + x + rectWidth]) rectWidth++;
+
+            if (mergeZ)
+            {
+                for (bool full = true; full && ((z + rectHeight) < height); )
+                {
+                    for (int i = 0; (i < rectWidth) && full; i++) full = mask[(z + rectHeight)*width + x + i];
+                    if (full) rectHeight++;
                 }
-            } break;
-            case IQM_NORMAL:
+            }
+
+            for (int j = 0; j < rectHeight; j++) memset(&mask[(z + j)*width + x], 0, rectWidth);
+
+            rects[count] = (CubicmapRect){ x, z, rectWidth, rectHeight, face };
+            count++;
+        }
+    }
+
+    return count;
+}
+
+// Generate cubicmap region mesh, faces merged into rectangles by plane (greedy meshing), indexed quads
+// NOTE: Walls sides are generated facing non-wall cells (cubicmap limits included), neighbour cells out of
+// region are checked (region meshes match). Mesh data is not uploaded to GPU, vertexCount is 0 if no faces
+static Mesh GenCubicmapMesh(const unsigned char *cells, int width, int height, Vector3 cubeSize, int originX, int originZ, int sizeX, int sizeZ)
+{
+    Mesh mesh = { 0 };
+
+    unsigned char *masks[6] = { 0 };
+    int rectCount = 0;
+
+    for (int f = 0; f < 6; f++) masks[f] = (unsigned char *)RL_CALLOC(sizeX*sizeZ, sizeof(unsigned char));
+
+    // Faces masks by plane, rectangles merged later by mask
+    for (int z = 0; z < sizeZ; z++)
+    {
+        for (int x = 0; x < sizeX; x++)
+        {
+            int mapX = originX + x;
+            int mapZ = originZ + z;
+            int cell = cells[mapZ*width + mapX];
+
+            if (cell == CUBICMAP_CELL_FLOOR) masks[CUBICMAP_FACE_FLOOR][z*sizeX + x] = 1;
+            else if (cell == CUBICMAP_CELL_WALL)
+            {
+                masks[CUBICMAP_FACE_WALL][z*sizeX + x] = 1;
+                masks[CUBICMAP_FACE_POS_X][z*sizeX + x] = (mapX == (width - 1)) || (cells[mapZ*width + mapX + 1] != CUBICMAP_CELL_WALL);
+                masks[CUBICMAP_FACE_NEG_X][z*sizeX + x] = (mapX == 0) || (cells[mapZ*width + mapX - 1] != CUBICMAP_CELL_WALL);
+                masks[CUBICMAP_FACE_POS_Z][z*sizeX + x] = (mapZ == (height - 1)) || (cells[(mapZ + 1)*width + mapX] != CUBICMAP_CELL_WALL);
+                masks[CUBICMAP_FACE_NEG_Z][z*sizeX + x] = (mapZ == 0) || (cells[(mapZ - 1)*width + mapX] != CUBICMAP_CELL_WALL);
+                rectCount += 5;
+            }
+
+            if (cell == CUBICMAP_CELL_FLOOR) rectCount++;
+        }
+    }
+
+    // NOTE: Rectangles never exceed masks cells, one by cell at most
+    CubicmapRect *rects = (CubicmapRect *)RL_MALLOC(((rectCount > 0)? rectCount : 1)*sizeof(CubicmapRect));
+    rectCount = 0;
+
+    // Floors and walls tops are merged on both axis, walls sides only along their plane
+    rectCount += GenCubicmapRects(masks[CUBICMAP_FACE_WALL], sizeX, sizeZ, true, true, CUBICMAP_FACE_WALL, &rects[rectCount]);
+    rectCount += GenCubicmapRects(masks[CUBICMAP_FACE_FLOOR], sizeX, sizeZ, true, true, CUBICMAP_FACE_FLOOR, &rects[rectCount]);
+    rectCount += GenCubicmapRects(masks[CUBICMAP_FACE_POS_X], sizeX, sizeZ, false, true, CUBICMAP_FACE_POS_X, &rects[rectCount]);
+    rectCount += GenCubicmapRects(masks[CUBICMAP_FACE_NEG_X], sizeX, sizeZ, false, true, CUBICMAP_FACE_NEG_X, &rects[rectCount]);
+    rectCount += GenCubicmapRects(masks[CUBICMAP_FACE_POS_Z], sizeX, sizeZ, true, false, CUBICMAP_FACE_POS_Z, &rects[rectCount]);
+    rectCount += GenCubicmapRects(masks[CUBICMAP_FACE_NEG_Z], sizeX, sizeZ, true, false, CUBICMAP_FACE_NEG_Z, &rects[rectCount]);
+
+    for (int f = 0; f < 6; f++) RL_FREE(masks[f]);
+
+    // Floors and walls rectangles are two quads (top and bottom), walls sides one quad
+    int quadCount = 0;
+    for (int i = 0; i < rectCount; i++) quadCount += (rects[i].face <= CUBICMAP_FACE_FLOOR)? 2 : 1;
+
+    if (quadCount > 0)
+    {
+        mesh.vertices = (float *)RL_MALLOC(quadCount*4*3*sizeof(float));
+        mesh.texcoords = (float *)RL_MALLOC(quadCount*4*2*sizeof(float));
+        mesh.normals = (float *)RL_MALLOC(quadCount*4*3*sizeof(float));
+        mesh.indices = (unsigned short *)RL_MALLOC(quadCount*6*sizeof(unsigned short));
+
+        for (int i = 0; i < rectCount; i++)
+        {
+            // Rectangle limits in cells units (cell edges)
+            float x0 = (float)(originX + rects[i].x);
+            float z0 = (float)(originZ + rects[i].z);
+            float x1 = x0 + rects[i].width;
+            float z1 = z0 + rects[i].height;
+
+            // NOTE: Quads corners are counter-clockwise seen from normal side
+            Vector3 up[4] = { { x0, 1.0f, z0 }, { x0, 1.0f, z1 }, { x1, 1.0f, z1 }, { x1, 1.0f, z0 } };
+            Vector3 down[4] = { { x0, 0.0f, z0 }, { x1, 0.0f, z0 }, { x1, 0.0f, z1 }, { x0, 0.0f, z1 } };
+
+            switch (rects[i].face)
+            {
+                case CUBICMAP_FACE_WALL:
+                {
+                    AddCubicmapFace(&mesh, up, (Vector3){ 0.0f, 1.0f, 0.0f }, cubeSize);
+                    AddCubicmapFace(&mesh, down, (Vector3){ 0.0f, -1.0f, 0.0f }, cubeSize);
+                } break;
+                case CUBICMAP_FACE_FLOOR:
+                {
+                    // Floor faces up (bottom), ceiling faces down (top)
+                    for (int c = 0; c < 4; c++) { up[c].y = 0.0f; down[c].y = 1.0f; }
+
+                    AddCubicmapFace(&mesh, up, (Vector3){ 0.0f, 1.0f, 0.0f }, cubeSize);
+                    AddCubicmapFace(&mesh, down, (Vector3){ 0.0f, -1.0f, 0.0f }, cubeSize);
+                } break;
+                case CUBICMAP_FACE_POS_X:
+                {
+                    Vector3 corners[4] = { { x1, 0.0f, z0 }, { x1, 1.0f, z0 }, { x1, 1.0f, z1 }, { x1, 0.0f, z1 } };
+                    AddCubicmapFace(&mesh, corners, (Vector3){ 1.0f, 0.0f, 0.0f }, cubeSize);
+                } break;
+                case CUBICMAP_FACE_NEG_X:
+                {
+                    Vector3 corners[4] = { { x0, 0.0f, z0 }, { x0, 0.0f, z1 }, { x0, 1.0f, z1 }, { x0, 1.0f, z0 } };
+                    AddCubicmapFace(&mesh, corners, (Vector3){ -1.0f, 0.0f, 0.0f }, cubeSize);
+                } break;
+                case CUBICMAP_FACE_POS_Z:
+                {
+                    Vector3 corners[4] = { { x0, 0.0f, z1 }, { x1, 0.0f, z1 }, { x1, 1.0f, z1 }, { x0, 1.0f, z1 } };
+                    AddCubicmapFace(&mesh, corners, (Vector3){ 0.0f, 0.0f, 1.0f }, cubeSize);
+                } break;
+                case CUBICMAP_FACE_NEG_Z:
+                {
+                    Vector3 corners[4] = { { x0, 0.0f, z0 }, { x0, 1.0f, z0 }, { x1, 1.0f, z0 }, { x1, 0.0f, z0 } };
+                    AddCubicmapFace(&mesh, corners, (Vector3){ 0.0f, 0.0f, -1.0f }, cubeSize);
+                } break;
+                default: break;
+            }
+        }
+    }
+
+    RL_FREE(rects);
+
+    return mesh;
+}
+
+// Add cubicmap quad face to mesh (two indexed triangles), corners in cells units (cell edges, height 0..1)
+// NOTE: Texture coordinates are corners cells units projected on face plane (texture repeated by cell)
+static void AddCubicmapFace(Mesh *mesh, const Vector3 *corners, Vector3 normal, Vector3 cubeSize)
+{
+    int base = mesh->vertexCount;
+
+    for (int c = 0; c < 4; c++)
+    {
+        // NOTE: Cells are centered on cells coordinates, as GenMeshCubicmap()
+        mesh->vertices[(base + c)*3] = (corners[c].x - 0.5f)*cubeSize.x;
+        mesh->vertices[(base + c)*3 + 1] = corners[c].y*cubeSize.y;
+        mesh->vertices[(base + c)*3 + 2] = (corners[c].z - 0.5f)*cubeSize.z;
+
+        mesh->normals[(base + c)*3] = normal.x;
+        mesh->normals[(base + c)*3 + 1] = normal.y;
+        mesh->normals[(base + c)*3 + 2] = normal.z;
+
+        Vector2 texcoord = { corners[c].x, 1.0f - corners[c].y };
+        if (normal.y != 0.0f) texcoord = (Vector2){ corners[c].x, corners[c].z };
+        else if (normal.x != 0.0f) texcoord.x = corners[c].z;
+
+        mesh->texcoords[(base + c)*2] = texcoord.x;
+        mesh->texcoords[(base + c)*2 + 1] = texcoord.y;
+    }
+
+    unsigned short *indices = &mesh->indices[mesh->triangleCount*3];
+    indices[0] = (unsigned short)base;
+    indices[1] = (unsigned short)(base + 1);
+    indices[2] = (unsigned short)(base + 2);
+    indices[3] = (unsigned short)base;
+    indices[4] = (unsigned short)(base + 2);
+    indices[5] = (unsigned short)(base + 3);
+
+    mesh->vertexCount += 4;
+    mesh->triangleCount += 2;
+}
+
+// Rebuild cubicmap chunk mesh from current cells, previous mesh unloaded, new one uploaded to GPU
+static void UpdateCubicmapChunk(Cubicmap cubicmap, int index)
+{
+    CubicmapData *data = (CubicmapData *)cubicmap.cubicmapData;
+
+    if (data->chunks[index].vertexCount > 0) UnloadMesh(data->chunks[index]);
+
+    int originX = (index%data->chunksX)*cubicmap.chunkSize;
+    int originZ = (index/data->chunksX)*cubicmap.chunkSize;
+    int sizeX = ((originX + cubicmap.chunkSize) <= cubicmap.width)? cubicmap.chunkSize : (cubicmap.width - originX);
+    int sizeZ = ((originZ + cubicmap.chunkSize) <= cubicmap.height)? cubicmap.chunkSize : (cubicmap.height - originZ);
+
+    Mesh mesh = GenCubicmapMesh(data->cells, cubicmap.width, cubicmap.height, cubicmap.cubeSize, originX, originZ, sizeX, sizeZ);
+
+    if (mesh.vertexCount > 0)
+    {
+        mesh.vboId = (unsigned int *)RL_CALLOC(MAX_MESH_VBO, sizeof(unsigned int));
+        rlLoadMesh(&mesh, false);
+    }
+
+    data->chunks[index] = mesh;
+    data->dirty[index] = false;
+}
+
+// Upload tile map chunk changed tiles vertex data, chunk mesh is generated and loaded on first upload
+static void UpdateTileMapChunk(TileMap map, int index)
+{
+    TileMapData *data = (TileMapData *)map.tileMapData;
+    TileMapChunk *chunk = &data->chunks[index];
+
+    int originX = (index%data->chunksX)*map.chunkSize;
+    int originY = (index/data->chunksX)*map.chunkSize;
+    int sizeX = ((originX + map.chunkSize) <= map.width)? map.chunkSize : (map.width - originX);
+    int sizeY = ((originY + map.chunkSize) <= map.height)? map.chunkSize : (map.height - originY);
+
+    if (chunk->mesh.vertexCount == 0)
+    {
+        // Chunks without tiles are not loaded until a tile is set
+        if (chunk->tileCount == 0)
+        {
+            chunk->dirtyStart = -1;
+            return;
+        }
+
+        Mesh mesh = { 0 };
+        mesh.vertexCount = sizeX*sizeY*4;
+        mesh.triangleCount = sizeX*sizeY*2;
+        mesh.vertices = (float *)RL_MALLOC(mesh.vertexCount*3*sizeof(float));
+        mesh.texcoords = (float *)RL_MALLOC(mesh.vertexCount*2*sizeof(float));
+        mesh.indices = (unsigned short *)RL_MALLOC(mesh.triangleCount*3*sizeof(unsigned short));
+
+        for (int i = 0; i < sizeX*sizeY; i++)
+        {
+            SetTileMapQuad(map, &mesh, i, originX + i%sizeX, originY + i/sizeX);
+
+            mesh.indices[i*6] = (unsigned short)(i*4);
+            mesh.indices[i*6 + 1] = (unsigned short)(i*4 + 1);
+            mesh.indices[i*6 + 2] = (unsigned short)(i*4 + 2);
+            mesh.indices[i*6 + 3] = (unsigned short)(i*4);
+            mesh.indices[i*6 + 4] = (unsigned short)(i*4 + 2);
+            mesh.indices[i*6 + 5] = (unsigned short)(i*4 + 3);
+        }
+
+        mesh.vboId = (unsigned int *)RL_CALLOC(MAX_MESH_VBO, sizeof(unsigned int));
+        rlLoadMesh(&mesh, false);
+
+        chunk->mesh = mesh;
+    }
+    else
+    {
+        // Only changed tiles range is uploaded
+        for (int i = chunk->dirtyStart; i <= chunk->dirtyEnd; i++) SetTileMapQuad(map, &chunk->mesh, i, originX + i%sizeX, originY + i/sizeX);
+
+        rlUpdateMeshRange(chunk->mesh, chunk->dirtyStart*4, (chunk->dirtyEnd - chunk->dirtyStart + 1)*4);
+    }
+
+    chunk->dirtyStart = -1;
+}
+
+// Set tile map chunk mesh quad vertex data (positions and texcoords) for tile at x, y
+// NOTE: Quad vertex order is the same as batched textures quads (top-left, bottom-left, bottom-right, top-right)
+static void SetTileMapQuad(TileMap map, Mesh *mesh, int quad, int x, int y)
+{
+    TileMapData *data = (TileMapData *)map.tileMapData;
+
+    int tile = data->tiles[y*map.width + x];
+    float *vertices = mesh->vertices + quad*12;
+    float *texcoords = mesh->texcoords + quad*8;
+
+    float left = (float)x*map.tileWidth;
+    float top = (float)y*map.tileHeight;
+    float right = left;
+    float bottom = top;
+    float u0 = 0.0f, v0 = 0.0f, u1 = 0.0f, v1 = 0.0f;
+
+    // Empty tiles are degenerated quads (zero area, no fragments)
+    if ((tile >= 0) && (map.tileset.width > 0) && (map.tileset.height > 0))
+    {
+        int columns = map.tileset.width/map.tileWidth;
+        if (columns < 1) columns = 1;
+
+        right = left + map.tileWidth;
+        bottom = top + map.tileHeight;
+
+        u0 = (float)((tile%columns)*map.tileWidth)/map.tileset.width;
+        v0 = (float)((tile/columns)*map.tileHeight)/map.tileset.height;
+        u1 = u0 + (float)map.tileWidth/map.tileset.width;
+        v1 = v0 + (float)map.tileHeight/map.tileset.height;
+    }
+
+    float quadVertices[12] = { left, top, 0.0f, left, bottom, 0.0f, right, bottom, 0.0f, right, top, 0.0f };
+    float quadTexcoords[8] = { u0, v0, u0, v1, u1, v1, u1, v0 };
+
+    memcpy(vertices, quadVertices, sizeof(quadVertices));
+    memcpy(texcoords, quadTexcoords, sizeof(quadTexcoords));
+}
+
+// Get static batch material index, materials with same shader and maps are shared (added if not found)
+static int GetStaticBatchMaterial(StaticBatch *batch, Material material)
+{
+    for (int i = 0; i < batch->materialCount; i++)
+    {
+        Material current = batch->materials[i];
+        bool equal = (current.shader.id == material.shader.id);
+
+        if (equal && (current.maps != material.maps))
+        {
+            if ((current.maps == NULL) || (material.maps == NULL)) equal = false;
+
+            for (int k = 0; equal && (k < MAX_MATERIAL_MAPS); k++)
             {
-                normal = RL_MALLOC(iqm.num_vertexes*3*sizeof(float));
-                fseek(iqmFile, va[i].offset, SEEK_SET);
-                fread(normal, iqm.num_vertexes*3*sizeof(float), 1, iqmFile);
+                equal = (current.maps[k].texture.id == material.maps[k].texture.id) && (current.maps[k].value == material.maps[k].value) &&
+                        (memcmp(&current.maps[k].color, &material.maps[k].color, sizeof(Color)) == 0);
+            }
+        }
 
-                for (int m = 0; m < iqm.num_meshes; m++)
-                {
-                    int vCounter = 0;
-                    for (int i = imesh[m].first_vertex*3; i < (imesh[m].first_vertex + imesh[m].num_vertexes)*3; i++)
-                    {
-                        model.meshes[m].normals[vCounter] = normal[i];
-                        model.meshes[m].animNormals[vCounter] = normal[i];
-                        vCounter++;
-                    }
-                }
-            } break;
-            case IQM_TEXCOORD:
+        if (equal) return i;
+    }
+
+    batch->materials = (Material *)RL_REALLOC(batch->materials, (batch->materialCount + 1)*sizeof(Material));
+    batch->materials[batch->materialCount] = material;
+    batch->materialCount++;
+
+    return batch->materialCount - 1;
+}
+
+// Merge static batch instances (same material) into world space mesh, uploaded to GPU
+// NOTE: Attributes missing on some instances get default values, mirrored instances get triangles winding flipped
+static void AddStaticBatchChunk(StaticBatch *batch, const StaticBatchInstance *instances, int count)
+{
+    Mesh mesh = { 0 };
+    bool hasNormals = false;
+    bool hasColors = false;
+    bool hasTangents = false;
+    bool hasTexcoords2 = false;
+
+    for (int i = 0; i < count; i++)
+    {
+        mesh.vertexCount += instances[i].mesh.vertexCount;
+        mesh.triangleCount += GetMeshTriangleCount(instances[i].mesh);
+
+        if (instances[i].mesh.normals != NULL) hasNormals = true;
+        if (instances[i].mesh.colors != NULL) hasColors = true;
+        if (instances[i].mesh.tangents != NULL) hasTangents = true;
+        if (instances[i].mesh.texcoords2 != NULL) hasTexcoords2 = true;
+    }
+
+    mesh.vertices = (float *)RL_MALLOC(mesh.vertexCount*3*sizeof(float));
+    mesh.texcoords = (float *)RL_MALLOC(mesh.vertexCount*2*sizeof(float));
+    mesh.indices = (unsigned short *)RL_MALLOC(mesh.triangleCount*3*sizeof(unsigned short));
+    if (hasNormals) mesh.normals = (float *)RL_MALLOC(mesh.vertexCount*3*sizeof(float));
+    if (hasColors) mesh.colors = (unsigned char *)RL_MALLOC(mesh.vertexCount*4*sizeof(unsigned char));
+    if (hasTangents) mesh.tangents = (float *)RL_MALLOC(mesh.vertexCount*4*sizeof(float));
+    if (hasTexcoords2) mesh.texcoords2 = (float *)RL_CALLOC(mesh.vertexCount*2, sizeof(float));
+
+    BoundingBox bounds = { { FLT_MAX, FLT_MAX, FLT_MAX }, { -FLT_MAX, -FLT_MAX, -FLT_MAX } };
+    int vertexOffset = 0;
+    int triangleOffset = 0;
+
+    for (int i = 0; i < count; i++)
+    {
+        Mesh source = instances[i].mesh;
+        Matrix transform = instances[i].transform;
+        Matrix normalMatrix = MatrixTranspose(MatrixInvert(transform));
+        bool mirrored = (MatrixDeterminant(transform) < 0.0f);
+
+        for (int v = 0; v < source.vertexCount; v++)
+        {
+            int k = vertexOffset + v;
+            Vector3 position = Vector3Transform((Vector3){ source.vertices[v*3], source.vertices[v*3 + 1], source.vertices[v*3 + 2] }, transform);
+
+            mesh.vertices[k*3] = position.x;
+            mesh.vertices[k*3 + 1] = position.y;
+            mesh.vertices[k*3 + 2] = position.z;
+            bounds.min = Vector3Min(bounds.min, position);
+            bounds.max = Vector3Max(bounds.max, position);
+
+            mesh.texcoords[k*2] = source.texcoords[v*2];
+            mesh.texcoords[k*2 + 1] = source.texcoords[v*2 + 1];
+
+            if (hasNormals)
             {
-                text = RL_MALLOC(iqm.num_vertexes*2*sizeof(float));
-                fseek(iqmFile, va[i].offset, SEEK_SET);
-                fread(text, iqm.num_vertexes*2*sizeof(float), 1, iqmFile);
+                Vector3 normal = { 0.0f, 1.0f, 0.0f };
 
-                for (int m = 0; m < iqm.num_meshes; m++)
+                if (source.normals != NULL)
                 {
-                    int vCounter = 0;
-                    for (int i = imesh[m].first_vertex*2; i < (imesh[m].first_vertex + imesh[m].num_vertexes)*2; i++)
-                    {
-                        model.meshes[m].texcoords[vCounter] = text[i];
-                        vCounter++;
-                    }
+                    Vector3 n = { source.normals[v*3], source.normals[v*3 + 1], source.normals[v*3 + 2] };
+                    normal = Vector3Normalize((Vector3){ normalMatrix.m0*n.x + normalMatrix.m4*n.y + normalMatrix.m8*n.z,
+                                                         normalMatrix.m1*n.x + normalMatrix.m5*n.y + normalMatrix.m9*n.z,
+                                                         normalMatrix.m2*n.x + normalMatrix.m6*n.y + normalMatrix.m10*n.z });
                 }
-            } break;
-            case IQM_BLENDINDEXES:
+
+                mesh.normals[k*3] = normal.x;
+                mesh.normals[k*3 + 1] = normal.y;
+                mesh.normals[k*3 + 2] = normal.z;
+            }
+
+            if (hasColors)
             {
-                blendi = RL_MALLOC(iqm.num_vertexes*4*sizeof(char));
-                fseek(iqmFile, va[i].offset, SEEK_SET);
-                fread(blendi, iqm.num_vertexes*4*sizeof(char), 1, iqmFile);
+                if (source.colors != NULL) memcpy(&mesh.colors[k*4], &source.colors[v*4], 4);
+                else memset(&mesh.colors[k*4], 255, 4);
+            }
 
-                for (int m = 0; m < iqm.num_meshes; m++)
-                {
-                    int boneCounter = 0;
-                    for (int i = imesh[m].first_vertex*4; i < (imesh[m].first_vertex + imesh[m].num_vertexes)*4; i++)
-                    {
-                        model.meshes[m].boneIds[boneCounter] = blendi[i];
-                        boneCounter++;
-                    }
-                }
-            } break;
-            case IQM_BLENDWEIGHTS:
+            if (hasTangents)
             {
-                blendw = RL_MALLOC(iqm.num_vertexes*4*sizeof(unsigned char));
-                fseek(iqmFile, va[i].offset, SEEK_SET);
-                fread(blendw, iqm.num_vertexes*4*sizeof(unsigned char), 1, iqmFile);
+                Vector3 tangent = { 1.0f, 0.0f, 0.0f };
+                float handedness = 1.0f;
 
-                for (int m = 0; m < iqm.num_meshes; m++)
+                if (source.tangents != NULL)
                 {
-                    int boneCounter = 0;
-                    for (int i = imesh[m].first_vertex*4; i < (imesh[m].first_vertex + imesh[m].num_vertexes)*4; i++)
-                    {
-                        model.meshes[m].boneWeights[boneCounter] = blendw[i]/255.0f;
-                        boneCounter++;
-                    }
+                    Vector3 t = { source.tangents[v*4], source.tangents[v*4 + 1], source.tangents[v*4 + 2] };
+                    tangent = Vector3Normalize((Vector3){ transform.m0*t.x + transform.m4*t.y + transform.m8*t.z,
+                                                          transform.m1*t.x + transform.m5*t.y + transform.m9*t.z,
+                                                          transform.m2*t.x + transform.m6*t.y + transform.m10*t.z });
+                    handedness = mirrored? -source.tangents[v*4 + 3] : source.tangents[v*4 + 3];
                 }
-            } break;
+
+                mesh.tangents[k*4] = tangent.x;
+                mesh.tangents[k*4 + 1] = tangent.y;
+                mesh.tangents[k*4 + 2] = tangent.z;
+                mesh.tangents[k*4 + 3] = handedness;
+            }
+
+            if ((hasTexcoords2) && (source.texcoords2 != NULL))
+            {
+                mesh.texcoords2[k*2] = source.texcoords2[v*2];
+                mesh.texcoords2[k*2 + 1] = source.texcoords2[v*2 + 1];
+            }
+        }
+
+        int triangleCount = GetMeshTriangleCount(source);
+
+        for (int t = 0; t < triangleCount; t++)
+        {
+            unsigned short *triangle = &mesh.indices[(triangleOffset + t)*3];
+
+            for (int c = 0; c < 3; c++) triangle[c] = (unsigned short)(vertexOffset + ((source.indices != NULL)? source.indices[t*3 + c] : t*3 + c));
+
+            if (mirrored)
+            {
+                unsigned short index = triangle[1];
+                triangle[1] = triangle[2];
+                triangle[2] = index;
+            }
         }
+
+        vertexOffset += source.vertexCount;
+        triangleOffset += triangleCount;
     }
 
-    // Bones (joints) data processing
-    ijoint = RL_MALLOC(iqm.num_joints*sizeof(IQMJoint));
-    fseek(iqmFile, iqm.ofs_joints, SEEK_SET);
-    fread(ijoint, iqm.num_joints*sizeof(IQMJoint), 1, iqmFile);
+    mesh.vboId = (unsigned int *)RL_CALLOC(MAX_MESH_VBO, sizeof(unsigned int));
+    rlLoadMesh(&mesh, false);
 
-    model.boneCount = iqm.num_joints;
-    model.bones = RL_MALLOC(iqm.num_joints*sizeof(BoneInfo));
-    model.bindPose = RL_MALLOC(iqm.num_joints*sizeof(Transform));
+    if (!modelKeepMeshData) UnloadMeshCPUData(&mesh, false);
 
-    for (int i = 0; i < iqm.num_joints; i++)
+    batch->meshes = (Mesh *)RL_REALLOC(batch->meshes, (batch->meshCount + 1)*sizeof(Mesh));
+    batch->bounds = (BoundingBox *)RL_REALLOC(batch->bounds, (batch->meshCount + 1)*sizeof(BoundingBox));
+    batch->meshMaterial = (int *)RL_REALLOC(batch->meshMaterial, (batch->meshCount + 1)*sizeof(int));
+
+    batch->meshes[batch->meshCount] = mesh;
+    batch->bounds[batch->meshCount] = bounds;
+    batch->meshMaterial[batch->meshCount] = instances[0].material;
+    batch->meshCount++;
+}
+
+// Compare static batch instances by material and spatial code
+static int CompareStaticBatchInstances(const void *a, const void *b)
+{
+    const StaticBatchInstance *instanceA = (const StaticBatchInstance *)a;
+    const StaticBatchInstance *instanceB = (const StaticBatchInstance *)b;
+
+    if (instanceA->material != instanceB->material) return (instanceA->material < instanceB->material)? -1 : 1;
+    if (instanceA->code != instanceB->code) return (instanceA->code < instanceB->code)? -1 : 1;
+
+    return 0;
+}
+
+// Get position spatial code inside bounds, positions close in space get close codes (Morton order, 10 bits by axis)
+static unsigned int GetMortonCode(Vector3 position, BoundingBox bounds)
+{
+    float values[3] = { position.x, position.y, position.z };
+    float min[3] = { bounds.min.x, bounds.min.y, bounds.min.z };
+    float max[3] = { bounds.max.x, bounds.max.y, bounds.max.z };
+    unsigned int code = 0;
+
+    for (int axis = 0; axis < 3; axis++)
     {
-        // Bones
-        model.bones[i].parent = ijoint[i].parent;
-        fseek(iqmFile, iqm.ofs_text + ijoint[i].name, SEEK_SET);
-        fread(model.bones[i].name, BONE_NAME_LENGTH*sizeof(char), 1, iqmFile);
+        float size = max[axis] - min[axis];
+        unsigned int cell = (size > 0.0f)? (unsigned int)((values[axis] - min[axis])/size*1023.0f) : 0;
+        if (cell > 1023) cell = 1023;
 
-        // Bind pose (base pose)
-        model.bindPose[i].translation.x = ijoint[i].translate[0];
-        model.bindPose[i].translation.y = ijoint[i].translate[1];
-        model.bindPose[i].translation.z = ijoint[i].translate[2];
+        // Cell bits interleaved every third bit
+        for (int bit = 0; bit < 10; bit++) code |= ((cell >> bit) & 1u) << (bit*3 + axis);
+    }
 
-        model.bindPose[i].rotation.x = ijoint[i].rotate[0];
-        model.bindPose[i].rotation.y = ijoint[i].rotate[1];
-        model.bindPose[i].rotation.z = ijoint[i].rotate[2];
-        model.bindPose[i].rotation.w = ijoint[i].rotate[3];
+    return code;
+}
 
-        model.bindPose[i].scale.x = ijoint[i].scale[0];
-        model.bindPose[i].scale.y = ijoint[i].scale[1];
-        model.bindPose[i].scale.z = ijoint[i].scale[2];
+// Get ray entry distance into box (slabs test), ray direction inverse is provided
+// NOTE: Box is hit if entry distance is not farther than maxDistance
+static bool GetRayBoxDistance(Vector3 origin, Vector3 invDir, Vector3 min, Vector3 max, float maxDistance, float *distance)
+{
+    float tx1 = (min.x - origin.x)*invDir.x;
+    float tx2 = (max.x - origin.x)*invDir.x;
+    float ty1 = (min.y - origin.y)*invDir.y;
+    float ty2 = (max.y - origin.y)*invDir.y;
+    float tz1 = (min.z - origin.z)*invDir.z;
+    float tz2 = (max.z - origin.z)*invDir.z;
+
+    float tmin = fmaxf(fmaxf(fminf(tx1, tx2), fminf(ty1, ty2)), fminf(tz1, tz2));
+    float tmax = fminf(fminf(fmaxf(tx1, tx2), fmaxf(ty1, ty2)), fmaxf(tz1, tz2));
+
+    *distance = tmin;
+
+    return (tmax >= fmaxf(tmin, 0.0f)) && (tmin <= maxDistance);
+}
+
+// Get heightfield hierarchy group bounding box (world space)
+static void GetHeightfieldGroupBox(Heightfield heightfield, int level, int x, int z, Vector3 *min, Vector3 *max)
+{
+    const HeightfieldLevels *levels = (const HeightfieldLevels *)heightfield.levelsData;
+    const float *bounds = &levels->bounds[level][(z*levels->levelWidth[level] + x)*2];
+
+    // Group cells range, last groups clamped to heightfield cells
+    int cellX0 = x << level;
+    int cellZ0 = z << level;
+    int cellX1 = (x + 1) << level;
+    int cellZ1 = (z + 1) << level;
+
+    if (cellX1 > (heightfield.width - 1)) cellX1 = heightfield.width - 1;
+    if (cellZ1 > (heightfield.length - 1)) cellZ1 = heightfield.length - 1;
+
+    float cellSizeX = heightfield.size.x/heightfield.width;
+    float cellSizeZ = heightfield.size.z/heightfield.length;
+
+    *min = (Vector3){ heightfield.position.x + cellX0*cellSizeX, heightfield.position.y + bounds[0], heightfield.position.z + cellZ0*cellSizeZ };
+    *max = (Vector3){ heightfield.position.x + cellX1*cellSizeX, heightfield.position.y + bounds[1], heightfield.position.z + cellZ1*cellSizeZ };
+}
+
+#if defined(SUPPORT_MESH_GENERATION)
+// Generate parametric surface indexed mesh, grid of (slices + 1)*(stacks + 1) vertices
+// NOTE: Same vertex layout, texcoords and triangles as par_shapes_create_parametric(), but vertex data
+// is written once into mesh arrays and normals are analytic (no welding); poles degenerated triangles are skipped.
+// Arrays are allocated for extra vertices/triangles, appended by caller, vertexCount/triangleCount only count grid
+static Mesh GenMeshParametric(MeshSurfaceFunc func, const float *params, int slices, int stacks, bool poles, int extraVertices, int extraTriangles)
+{
+    Mesh mesh = { 0 };
+    mesh.vboId = (unsigned int *)RL_CALLOC(MAX_MESH_VBO, sizeof(unsigned int));
+
+    if (slices < 3) slices = 3;
+    if (stacks < 1) stacks = 1;
+
+    int vertexCount = (slices + 1)*(stacks + 1) + extraVertices;
+    int triangleCount = 2*slices*stacks + extraTriangles;
+
+    mesh.vertices = (float *)RL_MALLOC(vertexCount*3*sizeof(float));
+    mesh.normals = (float *)RL_MALLOC(vertexCount*3*sizeof(float));
+    mesh.texcoords = (float *)RL_MALLOC(vertexCount*2*sizeof(float));
+
+    // NOTE: Indices are stored as 32bit if too many vertices for 16bit indices, mesh is not indexed on upload
+    if (vertexCount > MAX_GEN_MESH_VERTICES) mesh.indices = (unsigned short *)RL_MALLOC(triangleCount*3*sizeof(unsigned int));
+    else mesh.indices = (unsigned short *)RL_MALLOC(triangleCount*3*sizeof(unsigned short));
+
+    for (int stack = 0; stack < (stacks + 1); stack++)
+    {
+        float u = (float)stack/stacks;
+
+        for (int slice = 0; slice < (slices + 1); slice++)
+        {
+            float v = (float)slice/slices;
+            int k = mesh.vertexCount;
+
+            func(u, v, params, &mesh.vertices[k*3], &mesh.normals[k*3]);
+            mesh.texcoords[k*2] = u;
+            mesh.texcoords[k*2 + 1] = v;
+
+            mesh.vertexCount++;
+        }
     }
 
-    // Build bind pose from parent joints
-    for (int i = 0; i < model.boneCount; i++)
+    bool wide = (vertexCount > MAX_GEN_MESH_VERTICES);
+
+    for (int stack = 0, base = 0; stack < stacks; stack++, base += (slices + 1))
     {
-        if (model.bones[i].parent >= 0)
+        for (int slice = 0; slice < slices; slice++)
         {
-            model.bindPose[i].rotation = QuaternionMultiply(model.bindPose[model.bones[i].parent].rotation, model.bindPose[i].rotation);
-            model.bindPose[i].translation = Vector3RotateByQuaternion(model.bindPose[i].translation, model.bindPose[model.bones[i].parent].rotation);
-            model.bindPose[i].translation = Vector3Add(model.bindPose[i].translation, model.bindPose[model.bones[i].parent].translation);
-            model.bindPose[i].scale = Vector3Multiply(model.bindPose[i].scale, model.bindPose[model.bones[i].parent].scale);
+            int a = base + slice;               // Current stack vertex
+            int b = a + slices + 1;             // Next stack vertex
+
+            // First stack first triangle and last stack second triangle collapse on poles
+            if (!poles || (stack > 0)) AddGenMeshTriangle(&mesh, wide, b, a + 1, a);
+            if (!poles || (stack < (stacks - 1))) AddGenMeshTriangle(&mesh, wide, b, b + 1, a + 1);
         }
     }
 
-    fclose(iqmFile);
-    RL_FREE(imesh);
-    RL_FREE(tri);
-    RL_FREE(va);
-    RL_FREE(vertex);
-    RL_FREE(normal);
-    RL_FREE(text);
-    RL_FREE(blendi);
-    RL_FREE(blendw);
-    RL_FREE(ijoint);
+    return mesh;
+}
 
-    return model;
+// Add generated mesh triangle, indices stored as 32bit if wide
+static void AddGenMeshTriangle(Mesh *mesh, bool wide, int a, int b, int c)
+{
+    int k = mesh->triangleCount*3;
+
+    if (wide)
+    {
+        unsigned int *indices = (unsigned int *)mesh->indices;
+        indices[k] = a;
+        indices[k + 1] = b;
+        indices[k + 2] = c;
+    }
+    else
+    {
+        mesh->indices[k] = (unsigned short)a;
+        mesh->indices[k + 1] = (unsigned short)b;
+        mesh->indices[k + 2] = (unsigned short)c;
+    }
+
+    mesh->triangleCount++;
+}
+
+// Upload generated mesh vertex data to GPU (static mesh)
+// NOTE: Meshes with too many vertices for 16bit indices (32bit indices generated) are unindexed first
+static void UploadGeneratedMesh(Mesh *mesh)
+{
+    if (mesh->vertexCount > MAX_GEN_MESH_VERTICES)
+    {
+        const unsigned int *indices = (const unsigned int *)mesh->indices;
+        int vertexCount = mesh->triangleCount*3;
+
+        float *vertices = (float *)RL_MALLOC(vertexCount*3*sizeof(float));
+        float *normals = (float *)RL_MALLOC(vertexCount*3*sizeof(float));
+        float *texcoords = (float *)RL_MALLOC(vertexCount*2*sizeof(float));
+
+        for (int k = 0; k < vertexCount; k++)
+        {
+            memcpy(&vertices[k*3], &mesh->vertices[indices[k]*3], 3*sizeof(float));
+            memcpy(&normals[k*3], &mesh->normals[indices[k]*3], 3*sizeof(float));
+            memcpy(&texcoords[k*2], &mesh->texcoords[indices[k]*2], 2*sizeof(float));
+        }
+
+        RL_FREE(mesh->vertices);
+        RL_FREE(mesh->normals);
+        RL_FREE(mesh->texcoords);
+        RL_FREE(mesh->indices);
+
+        mesh->vertices = vertices;
+        mesh->normals = normals;
+        mesh->texcoords = texcoords;
+        mesh->indices = NULL;
+        mesh->vertexCount = vertexCount;
+    }
+
+    rlLoadMesh(mesh, false);
+}
+
+// Get sphere surface point, params: radius, longitude range (2*PI for sphere, PI for hemisphere)
+static void GetSphereSurfacePoint(float u, float v, const float *params, float *position, float *normal)
+{
+    float phi = u*PI;
+    float theta = v*params[1];
+
+    normal[0] = cosf(theta)*sinf(phi);
+    normal[1] = sinf(theta)*sinf(phi);
+    normal[2] = cosf(phi);
+
+    position[0] = normal[0]*params[0];
+    position[1] = normal[1]*params[0];
+    position[2] = normal[2]*params[0];
+}
+
+// Get cylinder surface point, params: radius, height
+// NOTE: Cylinder axis is Y, from 0 to height
+static void GetCylinderSurfacePoint(float u, float v, const float *params, float *position, float *normal)
+{
+    float theta = v*2.0f*PI;
+
+    normal[0] = sinf(theta);
+    normal[1] = 0.0f;
+    normal[2] = -cosf(theta);
+
+    position[0] = normal[0]*params[0];
+    position[1] = u*params[1];
+    position[2] = normal[2]*params[0];
+}
+
+// Get torus surface point, params: minor radius (major radius is 1), scale
+static void GetTorusSurfacePoint(float u, float v, const float *params, float *position, float *normal)
+{
+    float theta = u*2.0f*PI;
+    float phi = v*2.0f*PI;
+    float beta = 1.0f + params[0]*cosf(phi);
+
+    normal[0] = cosf(theta)*cosf(phi);
+    normal[1] = sinf(theta)*cosf(phi);
+    normal[2] = sinf(phi);
+
+    position[0] = cosf(theta)*beta*params[1];
+    position[1] = sinf(theta)*beta*params[1];
+    position[2] = sinf(phi)*params[0]*params[1];
+}
+
+// Get trefoil knot surface point, params: tube radius (x0.1), scale
+// NOTE: Tube is swept along the knot curve, normal is the tube section direction
+static void GetKnotSurfacePoint(float u, float v, const float *params, float *position, float *normal)
+{
+    const float a = 0.5f;
+    const float b = 0.3f;
+    const float c = 0.5f;
+    const float d = params[0]*0.1f;
+
+    float t = (1.0f - u)*4.0f*PI;
+    float phi = v*2.0f*PI;
+    float r = a + b*cosf(1.5f*t);
+
+    // Curve tangent (q), curve normal (qn) and binormal (w)
+    Vector3 q = Vector3Normalize((Vector3){ -1.5f*b*sinf(1.5f*t)*cosf(t) - r*sinf(t), -1.5f*b*sinf(1.5f*t)*sinf(t) + r*cosf(t), 1.5f*c*cosf(1.5f*t) });
+    Vector3 qn = Vector3Normalize((Vector3){ q.y, -q.x, 0.0f });
+    Vector3 w = Vector3CrossProduct(q, qn);
+
+    normal[0] = qn.x*cosf(phi) + w.x*sinf(phi);
+    normal[1] = qn.y*cosf(phi) + w.y*sinf(phi);
+    normal[2] = w.z*sinf(phi);
+
+    position[0] = (r*cosf(t) + d*normal[0])*params[1];
+    position[1] = (r*sinf(t) + d*normal[1])*params[1];
+    position[2] = (c*sinf(1.5f*t) + d*normal[2])*params[1];
 }
 #endif
 
-#if defined(SUPPORT_FILEFORMAT_GLTF)
+// Get bounding box of transformed box (transformed box corners contained)
+static BoundingBox TransformBoundingBox(BoundingBox box, Matrix transform)
+{
+    Vector3 center = Vector3Transform(Vector3Scale(Vector3Add(box.min, box.max), 0.5f), transform);
+    Vector3 extents = Vector3Scale(Vector3Subtract(box.max, box.min), 0.5f);
 
-static const unsigned char base64Table[] = {
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 62, 0, 0, 0, 63, 52, 53,
-    54, 55, 56, 57, 58, 59, 60, 61, 0, 0,
-    0, 0, 0, 0, 0, 0, 1, 2, 3, 4,
-    5, 6, 7, 8, 9, 10, 11, 12, 13, 14,
-    15, 16, 17, 18, 19, 20, 21, 22, 23, 24,
-    25, 0, 0, 0, 0, 0, 0, 26, 27, 28,
-    29, 30, 31, 32, 33, 34, 35, 36, 37, 38,
-    39, 40, 41, 42, 43, 44, 45, 46, 47, 48,
-    49, 50, 51
-};
+    Vector3 size = { 0 };
+    size.x = fabsf(transform.m0)*extents.x + fabsf(transform.m4)*extents.y + fabsf(transform.m8)*extents.z;
+    size.y = fabsf(transform.m1)*extents.x + fabsf(transform.m5)*extents.y + fabsf(transform.m9)*extents.z;
+    size.z = fabsf(transform.m2)*extents.x + fabsf(transform.m6)*extents.y + fabsf(transform.m10)*extents.z;
+
+    BoundingBox result = { Vector3Subtract(center, size), Vector3Add(center, size) };
+
+    return result;
+}
+
+// Get sphere bounding box
+static BoundingBox GetSphereBoundingBox(Vector3 center, float radius)
+{
+    BoundingBox result = { 0 };
+
+    result.min = (Vector3){ center.x - radius, center.y - radius, center.z - radius };
+    result.max = (Vector3){ center.x + radius, center.y + radius, center.z + radius };
+
+    return result;
+}
+
+// Get closest point on triangle to point
+// NOTE: Based on Real-Time Collision Detection (Christer Ericson), ClosestPtPointTriangle()
+static Vector3 GetClosestPointTriangle(Vector3 point, Vector3 p1, Vector3 p2, Vector3 p3)
+{
+    Vector3 ab = Vector3Subtract(p2, p1);
+    Vector3 ac = Vector3Subtract(p3, p1);
+    Vector3 ap = Vector3Subtract(point, p1);
+
+    // Vertex region outside p1
+    float d1 = Vector3DotProduct(ab, ap);
+    float d2 = Vector3DotProduct(ac, ap);
+    if ((d1 <= 0.0f) && (d2 <= 0.0f)) return p1;
+
+    // Vertex region outside p2
+    Vector3 bp = Vector3Subtract(point, p2);
+    float d3 = Vector3DotProduct(ab, bp);
+    float d4 = Vector3DotProduct(ac, bp);
+    if ((d3 >= 0.0f) && (d4 <= d3)) return p2;
+
+    // Edge region p1-p2
+    float vc = d1*d4 - d3*d2;
+    if ((vc <= 0.0f) && (d1 >= 0.0f) && (d3 <= 0.0f)) return Vector3Add(p1, Vector3Scale(ab, d1/(d1 - d3)));
+
+    // Vertex region outside p3
+    Vector3 cp = Vector3Subtract(point, p3);
+    float d5 = Vector3DotProduct(ab, cp);
+    float d6 = Vector3DotProduct(ac, cp);
+    if ((d6 >= 0.0f) && (d5 <= d6)) return p3;
+
+    // Edge region p1-p3
+    float vb = d5*d2 - d1*d6;
+    if ((vb <= 0.0f) && (d2 >= 0.0f) && (d6 <= 0.0f)) return Vector3Add(p1, Vector3Scale(ac, d2/(d2 - d6)));
+
+    // Edge region p2-p3
+    float va = d3*d6 - d5*d4;
+    if ((va <= 0.0f) && ((d4 - d3) >= 0.0f) && ((d5 - d6) >= 0.0f)) return Vector3Add(p2, Vector3Scale(Vector3Subtract(p3, p2), (d4 - d3)/((d4 - d3) + (d5 - d6))));
+
+    // Face region
+    float denom = 1.0f/(va + vb + vc);
+
+    return Vector3Add(p1, Vector3Add(Vector3Scale(ab, vb*denom), Vector3Scale(ac, vc*denom)));
+}
+
+// Update sphere collision info with triangle, nearest point is kept if inside sphere (result distance)
+static void GetCollisionSphereTriangle(Vector3 center, Vector3 p1, Vector3 p2, Vector3 p3, RayHitInfo *result)
+{
+    Vector3 point = GetClosestPointTriangle(center, p1, p2, p3);
+    float distance = Vector3Distance(center, point);
+
+    if ((distance <= result->distance) && (!result->hit || (distance < result->distance)))
+    {
+        result->hit = true;
+        result->distance = distance;
+        result->position = point;
+
+        if (distance > 0.0f) result->normal = Vector3Scale(Vector3Subtract(center, point), 1.0f/distance);
+        else result->normal = Vector3Normalize(Vector3CrossProduct(Vector3Subtract(p2, p1), Vector3Subtract(p3, p1)));
+    }
+}
+
+// Update box collision info with triangle, triangle is kept if it overlaps box and it is nearer to box center
+// NOTE: Separating axis test based on Tomas Akenine-Moller triangle-box overlap test
+static void GetCollisionBoxTriangle(Vector3 center, Vector3 extents, Vector3 p1, Vector3 p2, Vector3 p3, RayHitInfo *result)
+{
+    Vector3 v[3] = { Vector3Subtract(p1, center), Vector3Subtract(p2, center), Vector3Subtract(p3, center) };
+    Vector3 edges[3] = { Vector3Subtract(v[1], v[0]), Vector3Subtract(v[2], v[1]), Vector3Subtract(v[0], v[2]) };
+    Vector3 axes[3] = { { 1.0f, 0.0f, 0.0f }, { 0.0f, 1.0f, 0.0f }, { 0.0f, 0.0f, 1.0f } };
+
+    // Box axes
+    if ((fmaxf(v[0].x, fmaxf(v[1].x, v[2].x)) < -extents.x) || (fminf(v[0].x, fminf(v[1].x, v[2].x)) > extents.x)) return;
+    if ((fmaxf(v[0].y, fmaxf(v[1].y, v[2].y)) < -extents.y) || (fminf(v[0].y, fminf(v[1].y, v[2].y)) > extents.y)) return;
+    if ((fmaxf(v[0].z, fmaxf(v[1].z, v[2].z)) < -extents.z) || (fminf(v[0].z, fminf(v[1].z, v[2].z)) > extents.z)) return;
+
+    // Triangle plane
+    Vector3 normal = Vector3CrossProduct(edges[0], edges[1]);
+    float planeRadius = extents.x*fabsf(normal.x) + extents.y*fabsf(normal.y) + extents.z*fabsf(normal.z);
+    if (fabsf(Vector3DotProduct(normal, v[0])) > planeRadius) return;
+
+    // Box axes and triangle edges cross products
+    for (int i = 0; i < 3; i++)
+    {
+        for (int j = 0; j < 3; j++)
+        {
+            Vector3 axis = Vector3CrossProduct(axes[i], edges[j]);
+
+            float d0 = Vector3DotProduct(v[0], axis);
+            float d1 = Vector3DotProduct(v[1], axis);
+            float d2 = Vector3DotProduct(v[2], axis);
+            float radius = extents.x*fabsf(axis.x) + extents.y*fabsf(axis.y) + extents.z*fabsf(axis.z);
+
+            if ((fminf(d0, fminf(d1, d2)) > radius) || (fmaxf(d0, fmaxf(d1, d2)) < -radius)) return;
+        }
+    }
+
+    Vector3 point = GetClosestPointTriangle(center, p1, p2, p3);
+    float distance = Vector3Distance(center, point);
+
+    if (!result->hit || (distance < result->distance))
+    {
+        result->hit = true;
+        result->distance = distance;
+        result->position = point;
+        result->normal = Vector3Normalize(normal);
+    }
+}
 
-static int GetSizeBase64(char *input)
+// Allocate spatial tree node (free nodes list, nodes array grows if required)
+// NOTE: Nodes array can be reallocated, nodes pointers must be retrieved again
+static int AllocateSpatialNode(SpatialTree *tree)
 {
-    int size = 0;
-
-    for (int i = 0; input[4*i] != 0; i++)
+    if (tree->freeList == -1)
     {
-        if (input[4*i + 3] == '=')
+        int capacity = (tree->capacity > 0)? tree->capacity*2 : 16;
+        tree->nodes = (SpatialNode *)RL_REALLOC(tree->nodes, capacity*sizeof(SpatialNode));
+
+        for (int i = tree->capacity; i < capacity; i++)
         {
-            if (input[4*i + 2] == '=') size += 1;
-            else size += 2;
+            tree->nodes[i].parent = (i < (capacity - 1))? (i + 1) : -1;
+            tree->nodes[i].height = -1;
         }
-        else size += 3;
+
+        tree->freeList = tree->capacity;
+        tree->capacity = capacity;
     }
 
-    return size;
+    int id = tree->freeList;
+    SpatialNode *node = &tree->nodes[id];
+    tree->freeList = node->parent;
+
+    node->parent = -1;
+    node->child1 = -1;
+    node->child2 = -1;
+    node->height = 0;
+    node->userId = -1;
+
+    tree->nodeCount++;
+
+    return id;
 }
 
-static unsigned char *DecodeBase64(char *input, int *size)
+// Free spatial tree node (added to free nodes list)
+static void FreeSpatialNode(SpatialTree *tree, int id)
 {
-    *size = GetSizeBase64(input);
+    tree->nodes[id].parent = tree->freeList;
+    tree->nodes[id].height = -1;
+    tree->freeList = id;
+    tree->nodeCount--;
+}
 
-    unsigned char *buf = (unsigned char *)RL_MALLOC(*size);
-    for (int i = 0; i < *size/3; i++)
-    {
-        unsigned char a = base64Table[(int)input[4*i]];
-        unsigned char b = base64Table[(int)input[4*i + 1]];
-        unsigned char c = base64Table[(int)input[4*i + 2]];
-        unsigned char d = base64Table[(int)input[4*i + 3]];
+// Check spatial tree entry id is a valid leaf
+static bool IsSpatialEntryValid(const void *treeData, int entry)
+{
+    const SpatialTree *tree = (const SpatialTree *)treeData;
 
-        buf[3*i] = (a << 2) | (b >> 4);
-        buf[3*i + 1] = (b << 4) | (c >> 2);
-        buf[3*i + 2] = (c << 6) | d;
-    }
+    return (tree != NULL) && (entry >= 0) && (entry < tree->capacity) && (tree->nodes[entry].height == 0) && (tree->nodes[entry].child1 == -1);
+}
 
-    if (*size%3 == 1)
-    {
-        int n = *size/3;
-        unsigned char a = base64Table[(int)input[4*n]];
-        unsigned char b = base64Table[(int)input[4*n + 1]];
-        buf[*size - 1] = (a << 2) | (b >> 4);
-    }
-    else if (*size%3 == 2)
-    {
-        int n = *size/3;
-        unsigned char a = base64Table[(int)input[4*n]];
-        unsigned char b = base64Table[(int)input[4*n + 1]];
-        unsigned char c = base64Table[(int)input[4*n + 2]];
-        buf[*size - 2] = (a << 2) | (b >> 4);
-        buf[*size - 1] = (b << 4) | (c >> 2);
-    }
-    return buf;
+// Get union of bounding boxes
+static BoundingBox GetBoxesUnion(BoundingBox box1, BoundingBox box2)
+{
+    BoundingBox result = { Vector3Min(box1.min, box2.min), Vector3Max(box1.max, box2.max) };
+
+    return result;
 }
 
-// Load texture from cgltf_image
-static Texture LoadTextureFromCgltfImage(cgltf_image *image, const char *texPath, Color tint)
+// Get bounding box surface area, cost used for spatial tree insertion
+static float GetBoundingBoxArea(BoundingBox box)
 {
-    Texture texture = { 0 };
+    Vector3 size = Vector3Subtract(box.max, box.min);
 
-    if (image->uri)
+    return 2.0f*(size.x*size.y + size.y*size.z + size.z*size.x);
+}
+
+// Insert leaf node in spatial tree, sibling is chosen by minimum surface area cost and tree is balanced up to root
+// NOTE: Based on Box2D dynamic tree (Erin Catto)
+static void InsertSpatialLeaf(SpatialTree *tree, int leaf)
+{
+    if (tree->root == -1)
     {
-        if ((strlen(image->uri) > 5) &&
-            (image->uri[0] == 'd') &&
-            (image->uri[1] == 'a') &&
-            (image->uri[2] == 't') &&
-            (image->uri[3] == 'a') &&
-            (image->uri[4] == ':'))
-        {
-            // Data URI
-            // Format: data:<mediatype>;base64,<data>
+        tree->root = leaf;
+        tree->nodes[leaf].parent = -1;
+        return;
+    }
 
-            // Find the comma
-            int i = 0;
-            while ((image->uri[i] != ',') && (image->uri[i] != 0)) i++;
+    // Find best sibling, descend while children cost is lower than creating a new parent here
+    BoundingBox leafBounds = tree->nodes[leaf].bounds;
+    int index = tree->root;
 
-            if (image->uri[i] == 0) TraceLog(LOG_WARNING, "CGLTF Image: Invalid data URI");
-            else
-            {
-                int size;
-                unsigned char *data = DecodeBase64(image->uri + i + 1, &size);
+    while (tree->nodes[index].child1 != -1)
+    {
+        const SpatialNode *node = &tree->nodes[index];
 
-                int w, h;
-                unsigned char *raw = stbi_load_from_memory(data, size, &w, &h, NULL, 4);
+        float area = GetBoundingBoxArea(node->bounds);
+        float combinedArea = GetBoundingBoxArea(GetBoxesUnion(node->bounds, leafBounds));
 
-                Image rimage = LoadImagePro(raw, w, h, UNCOMPRESSED_R8G8B8A8);
-                
-                // TODO: Tint shouldn't be applied here!
-                ImageColorTint(&rimage, tint);
-                texture = LoadTextureFromImage(rimage);
-                UnloadImage(rimage);
-            }
-        }
-        else
+        float cost = 2.0f*combinedArea;                         // Cost of new parent for this node and leaf
+        float inheritanceCost = 2.0f*(combinedArea - area);     // Minimum cost of pushing leaf further down
+
+        float childCosts[2] = { 0 };
+        int children[2] = { node->child1, node->child2 };
+
+        for (int i = 0; i < 2; i++)
         {
-            Image rimage = LoadImage(TextFormat("%s/%s", texPath, image->uri));
-            
-            // TODO: Tint shouldn't be applied here!
-            ImageColorTint(&rimage, tint);
-            texture = LoadTextureFromImage(rimage);
-            UnloadImage(rimage);
+            const SpatialNode *child = &tree->nodes[children[i]];
+            float childArea = GetBoundingBoxArea(GetBoxesUnion(child->bounds, leafBounds));
+
+            if (child->child1 == -1) childCosts[i] = childArea + inheritanceCost;
+            else childCosts[i] = (childArea - GetBoundingBoxArea(child->bounds)) + inheritanceCost;
         }
+
+        if ((cost < childCosts[0]) && (cost < childCosts[1])) break;
+
+        index = (childCosts[0] < childCosts[1])? children[0] : children[1];
     }
-    else if (image->buffer_view)
+
+    int sibling = index;
+
+    // Create new parent for sibling and leaf
+    int oldParent = tree->nodes[sibling].parent;
+    int newParent = AllocateSpatialNode(tree);
+
+    tree->nodes[newParent].parent = oldParent;
+    tree->nodes[newParent].bounds = GetBoxesUnion(leafBounds, tree->nodes[sibling].bounds);
+    tree->nodes[newParent].height = tree->nodes[sibling].height + 1;
+    tree->nodes[newParent].child1 = sibling;
+    tree->nodes[newParent].child2 = leaf;
+
+    if (oldParent != -1)
     {
-        unsigned char *data = RL_MALLOC(image->buffer_view->size);
-        int n = image->buffer_view->offset;
-        int stride = image->buffer_view->stride ? image->buffer_view->stride : 1;
+        if (tree->nodes[oldParent].child1 == sibling) tree->nodes[oldParent].child1 = newParent;
+        else tree->nodes[oldParent].child2 = newParent;
+    }
+    else tree->root = newParent;
 
-        for (int i = 0; i < image->buffer_view->size; i++)
-        {
-            data[i] = ((unsigned char *)image->buffer_view->buffer->data)[n];
-            n += stride;
-        }
+    tree->nodes[sibling].parent = newParent;
+    tree->nodes[leaf].parent = newParent;
 
-        int w, h;
-        unsigned char *raw = stbi_load_from_memory(data, image->buffer_view->size, &w, &h, NULL, 4);
-        free(data);
+    // Walk back up the tree fixing heights and bounds
+    RefitSpatialTree(tree, tree->nodes[leaf].parent);
+}
 
-        Image rimage = LoadImagePro(raw, w, h, UNCOMPRESSED_R8G8B8A8);
-        free(raw);
+// Remove leaf node from spatial tree, its parent is replaced by leaf sibling
+static void RemoveSpatialLeaf(SpatialTree *tree, int leaf)
+{
+    if (leaf == tree->root)
+    {
+        tree->root = -1;
+        return;
+    }
 
-        // TODO: Tint shouldn't be applied here!
-        ImageColorTint(&rimage, tint);
-        texture = LoadTextureFromImage(rimage);
-        UnloadImage(rimage);
+    int parent = tree->nodes[leaf].parent;
+    int grandParent = tree->nodes[parent].parent;
+    int sibling = (tree->nodes[parent].child1 == leaf)? tree->nodes[parent].child2 : tree->nodes[parent].child1;
+
+    if (grandParent != -1)
+    {
+        if (tree->nodes[grandParent].child1 == parent) tree->nodes[grandParent].child1 = sibling;
+        else tree->nodes[grandParent].child2 = sibling;
+
+        tree->nodes[sibling].parent = grandParent;
+        FreeSpatialNode(tree, parent);
+
+        RefitSpatialTree(tree, grandParent);
     }
     else
     {
-        Image rimage = LoadImageEx(&tint, 1, 1);
-        texture = LoadTextureFromImage(rimage);
-        UnloadImage(rimage);
+        tree->root = sibling;
+        tree->nodes[sibling].parent = -1;
+        FreeSpatialNode(tree, parent);
     }
 
-    return texture;
+    tree->nodes[leaf].parent = -1;
 }
 
-// Load glTF mesh data
-static Model LoadGLTF(const char *fileName)
+// Update spatial tree nodes heights and bounds from node up to root, nodes are balanced on the way
+static void RefitSpatialTree(SpatialTree *tree, int index)
 {
-    /***********************************************************************************
-
-        Function implemented by Wilhem Barbier (@wbrbr)
-
-        Features:
-          - Supports .gltf and .glb files
-          - Supports embedded (base64) or external textures
-          - Loads the albedo/diffuse texture (other maps could be added)
-          - Supports multiple mesh per model and multiple primitives per model
+    while (index != -1)
+    {
+        index = BalanceSpatialNode(tree, index);
 
-        Some restrictions (not exhaustive):
-          - Triangle-only meshes
-          - Not supported node hierarchies or transforms
-          - Only loads the diffuse texture... but not too hard to support other maps (normal, roughness/metalness...)
-          - Only supports unsigned short indices (no byte/unsigned int)
-          - Only supports float for texture coordinates (no byte/unsigned short)
+        SpatialNode *node = &tree->nodes[index];
+        const SpatialNode *child1 = &tree->nodes[node->child1];
+        const SpatialNode *child2 = &tree->nodes[node->child2];
 
-    *************************************************************************************/
+        node->height = 1 + ((child1->height > child2->height)? child1->height : child2->height);
+        node->bounds = GetBoxesUnion(child1->bounds, child2->bounds);
 
-    #define LOAD_ACCESSOR(type, nbcomp, acc, dst) \
-    { \
-        int n = 0; \
-        type* buf = (type*)acc->buffer_view->buffer->data+acc->buffer_view->offset/sizeof(type)+acc->offset/sizeof(type); \
-        for (int k = 0; k < acc->count; k++) {\
-            for (int l = 0; l < nbcomp; l++) {\
-                dst[nbcomp*k+l] = buf[n+l];\
-            }\
-            n += acc->stride/sizeof(type);\
-        }\
+        index = node->parent;
     }
+}
 
-    Model model = { 0 };
+// Balance spatial tree node, higher child is rotated up if children heights differ by more than one
+// NOTE: Returns node index at balanced node position
+static int BalanceSpatialNode(SpatialTree *tree, int iA)
+{
+    SpatialNode *nodes = tree->nodes;
+    SpatialNode *A = &nodes[iA];
+
+    if ((A->child1 == -1) || (A->height < 2)) return iA;
 
-    // glTF file loading
-    FILE *gltfFile = fopen(fileName, "rb");
+    int iB = A->child1;
+    int iC = A->child2;
+    int balance = nodes[iC].height - nodes[iB].height;
 
-    if (gltfFile == NULL)
+    if ((balance > 1) || (balance < -1))
     {
-        TraceLog(LOG_WARNING, "[%s] glTF file could not be opened", fileName);
-        return model;
-    }
+        // Rotate higher child (iUp) up, iOther stays as A child
+        int iUp = (balance > 1)? iC : iB;
+        int iOther = (balance > 1)? iB : iC;
+        SpatialNode *up = &nodes[iUp];
 
-    fseek(gltfFile, 0, SEEK_END);
-    int size = ftell(gltfFile);
-    fseek(gltfFile, 0, SEEK_SET);
+        int iF = up->child1;
+        int iG = up->child2;
 
-    void *buffer = RL_MALLOC(size);
-    fread(buffer, size, 1, gltfFile);
+        // Swap A and up
+        up->child1 = iA;
+        up->parent = A->parent;
+        A->parent = iUp;
 
-    fclose(gltfFile);
+        if (up->parent != -1)
+        {
+            if (nodes[up->parent].child1 == iA) nodes[up->parent].child1 = iUp;
+            else nodes[up->parent].child2 = iUp;
+        }
+        else tree->root = iUp;
 
-    // glTF data loading
-    cgltf_options options = { 0 };
-    cgltf_data *data = NULL;
-    cgltf_result result = cgltf_parse(&options, buffer, size, &data);
+        // Higher grandchild stays with up, lower one moves to A
+        int iKeep = (nodes[iF].height > nodes[iG].height)? iF : iG;
+        int iMove = (iKeep == iF)? iG : iF;
 
-    if (result == cgltf_result_success)
-    {
-        TraceLog(LOG_INFO, "[%s][%s] Model meshes/materials: %i/%i", fileName, (data->file_type == 2)? "glb" : "gltf", data->meshes_count, data->materials_count);
+        up->child2 = iKeep;
+        if (balance > 1) A->child2 = iMove;
+        else A->child1 = iMove;
+        nodes[iMove].parent = iA;
 
-        // Read data buffers
-        result = cgltf_load_buffers(&options, data, fileName);
-        if (result != cgltf_result_success) TraceLog(LOG_INFO, "[%s][%s] Error loading mesh/material buffers", fileName, (data->file_type == 2)? "glb" : "gltf");
+        A->bounds = GetBoxesUnion(nodes[iOther].bounds, nodes[iMove].bounds);
+        up->bounds = GetBoxesUnion(A->bounds, nodes[iKeep].bounds);
 
-        int primitivesCount = 0;
+        A->height = 1 + ((nodes[iOther].height > nodes[iMove].height)? nodes[iOther].height : nodes[iMove].height);
+        up->height = 1 + ((A->height > nodes[iKeep].height)? A->height : nodes[iKeep].height);
 
-        for (int i = 0; i < data->meshes_count; i++) primitivesCount += (int)data->meshes[i].primitives_count;
+        return iUp;
+    }
 
-        // Process glTF data and map to model
-        model.meshCount = primitivesCount;
-        model.meshes = RL_CALLOC(model.meshCount, sizeof(Mesh));
-        model.materialCount = data->materials_count + 1;
-        model.materials = RL_MALLOC(model.materialCount*sizeof(Material));
-        model.meshMaterial = RL_MALLOC(model.meshCount*sizeof(int));
+    return iA;
+}
 
-        for (int i = 0; i < model.meshCount; i++) model.meshes[i].vboId = (unsigned int *)RL_CALLOC(MAX_MESH_VBO, sizeof(unsigned int));
+// Query spatial tree entries, nodes are traversed while shape test passes
+// NOTE: Leaves are tested with entry box (not enlarged), only leaves with id greater than minEntry are reported
+static int QuerySpatialTree(const SpatialTree *tree, bool (*check)(BoundingBox box, const void *shape), const void *shape, int minEntry, int *userIds, int maxCount)
+{
+    if ((tree == NULL) || (tree->root == -1) || (userIds == NULL) || (maxCount <= 0)) return 0;
 
-        //For each material
-        for (int i = 0; i < model.materialCount - 1; i++)
-        {
-            model.materials[i] = LoadMaterialDefault();
-            Color tint = (Color){ 255, 255, 255, 255 };
-            const char *texPath = GetDirectoryPath(fileName);
+    int stack[MAX_SPATIAL_QUERY_STACK] = { 0 };
+    int stackSize = 1;
+    int count = 0;
 
-            //Ensure material follows raylib support for PBR (metallic/roughness flow)
-            if (data->materials[i].has_pbr_metallic_roughness) 
+    stack[0] = tree->root;
+
+    while ((stackSize > 0) && (count < maxCount))
+    {
+        int index = stack[--stackSize];
+        const SpatialNode *node = &tree->nodes[index];
+
+        if (node->child1 == -1)
+        {
+            if ((index > minEntry) && check(node->entryBox, shape)) userIds[count++] = node->userId;
+        }
+        else if (check(node->bounds, shape))
+        {
+            if ((stackSize + 2) > MAX_SPATIAL_QUERY_STACK)
             {
-                float roughness = data->materials[i].pbr_metallic_roughness.roughness_factor;
-                float metallic = data->materials[i].pbr_metallic_roughness.metallic_factor;
+                TraceLog(LOG_WARNING, "Spatial index query stack overflow (%i), query results incomplete", MAX_SPATIAL_QUERY_STACK);
+                break;
+            }
 
-                // NOTE: Material name not used for the moment
-                //if (model.materials[i].name && data->materials[i].name) strcpy(model.materials[i].name, data->materials[i].name);
+            stack[stackSize++] = node->child2;
+            stack[stackSize++] = node->child1;
+        }
+    }
 
-                // TODO: REview: shouldn't these be *255 ???
-                tint.r = (unsigned char)(data->materials[i].pbr_metallic_roughness.base_color_factor[0]*255);
-                tint.g = (unsigned char)(data->materials[i].pbr_metallic_roughness.base_color_factor[1]*255);
-                tint.b = (unsigned char)(data->materials[i].pbr_metallic_roughness.base_color_factor[2]*255);
-                tint.a = (unsigned char)(data->materials[i].pbr_metallic_roughness.base_color_factor[3]*255);
+    return count;
+}
 
-                model.materials[i].maps[MAP_ROUGHNESS].color = tint;
+// Check spatial query box overlap (shape: BoundingBox)
+static bool CheckSpatialBox(BoundingBox box, const void *shape)
+{
+    return CheckCollisionBoxes(box, *(const BoundingBox *)shape);
+}
 
-                if (data->materials[i].pbr_metallic_roughness.base_color_texture.texture) 
-                {
-                    model.materials[i].maps[MAP_ALBEDO].texture = LoadTextureFromCgltfImage(data->materials[i].pbr_metallic_roughness.base_color_texture.texture->image, texPath, tint);
-                }
+// Check spatial query sphere overlap (shape: center xyz and radius)
+static bool CheckSpatialSphere(BoundingBox box, const void *shape)
+{
+    const float *sphere = (const float *)shape;
 
-                // NOTE: Tint isn't need for other textures.. pass null or clear? 
-                // Just set as white, multiplying by white has no effect
-                tint = WHITE;
+    return CheckCollisionBoxSphere(box, (Vector3){ sphere[0], sphere[1], sphere[2] }, sphere[3]);
+}
 
-                if (data->materials[i].pbr_metallic_roughness.metallic_roughness_texture.texture)
-                {
-                    model.materials[i].maps[MAP_ROUGHNESS].texture = LoadTextureFromCgltfImage(data->materials[i].pbr_metallic_roughness.metallic_roughness_texture.texture->image, texPath, tint);
-                }
-                model.materials[i].maps[MAP_ROUGHNESS].value = roughness;
-                model.materials[i].maps[MAP_METALNESS].value = metallic;
+// Check spatial query ray crossing (shape: ray origin xyz, ray direction inverse xyz and maximum distance)
+static bool CheckSpatialRay(BoundingBox box, const void *shape)
+{
+    const float *ray = (const float *)shape;
+    float distance = 0.0f;
 
-                if (data->materials[i].normal_texture.texture) 
-                {
-                    model.materials[i].maps[MAP_NORMAL].texture = LoadTextureFromCgltfImage(data->materials[i].normal_texture.texture->image, texPath, tint);
-                }
-                
-                if (data->materials[i].occlusion_texture.texture) 
-                {
-                    model.materials[i].maps[MAP_OCCLUSION].texture = LoadTextureFromCgltfImage(data->materials[i].occlusion_texture.texture->image, texPath, tint);
-                }
-            }
-        }
+    return GetRayBoxDistance((Vector3){ ray[0], ray[1], ray[2] }, (Vector3){ ray[3], ray[4], ray[5] }, box.min, box.max, ray[6], &distance);
+}
 
-        model.materials[model.materialCount - 1] = LoadMaterialDefault();
+// Check spatial query frustum visibility (shape: 6 planes, 4 coefficients by plane)
+static bool CheckSpatialFrustum(BoundingBox box, const void *shape)
+{
+    const float *planes = (const float *)shape;
 
-        int primitiveIndex = 0;
+    for (int i = 0; i < 6; i++)
+    {
+        const float *plane = planes + i*4;
 
-        for (int i = 0; i < data->meshes_count; i++)
-        {
-            for (int p = 0; p < data->meshes[i].primitives_count; p++)
-            {
-                for (int j = 0; j < data->meshes[i].primitives[p].attributes_count; j++)
-                {
-                    if (data->meshes[i].primitives[p].attributes[j].type == cgltf_attribute_type_position)
-                    {
-                        cgltf_accessor *acc = data->meshes[i].primitives[p].attributes[j].data;
-                        model.meshes[primitiveIndex].vertexCount = acc->count;
-                        model.meshes[primitiveIndex].vertices = RL_MALLOC(sizeof(float)*model.meshes[primitiveIndex].vertexCount*3);
+        // Box corner furthest along plane normal, if it is outside the whole box is outside
+        float x = (plane[0] >= 0.0f)? box.max.x : box.min.x;
+        float y = (plane[1] >= 0.0f)? box.max.y : box.min.y;
+        float z = (plane[2] >= 0.0f)? box.max.z : box.min.z;
 
-                        LOAD_ACCESSOR(float, 3, acc, model.meshes[primitiveIndex].vertices)
-                    }
-                    else if (data->meshes[i].primitives[p].attributes[j].type == cgltf_attribute_type_normal)
-                    {
-                        cgltf_accessor *acc = data->meshes[i].primitives[p].attributes[j].data;
-                        model.meshes[primitiveIndex].normals = RL_MALLOC(sizeof(float)*acc->count*3);
+        if ((plane[0]*x + plane[1]*y + plane[2]*z + plane[3]) < 0.0f) return false;
+    }
 
-                        LOAD_ACCESSOR(float, 3, acc, model.meshes[primitiveIndex].normals)
-                    }
-                    else if (data->meshes[i].primitives[p].attributes[j].type == cgltf_attribute_type_texcoord)
-                    {
-                        cgltf_accessor *acc = data->meshes[i].primitives[p].attributes[j].data;
+    return true;
+}
 
-                        if (acc->component_type == cgltf_component_type_r_32f)
-                        {
-                            model.meshes[primitiveIndex].texcoords = RL_MALLOC(sizeof(float)*acc->count*2);
-                            LOAD_ACCESSOR(float, 2, acc, model.meshes[primitiveIndex].texcoords)
-                        }
-                        else
-                        {
-                            // TODO: Support normalized unsigned byte/unsigned short texture coordinates
-                            TraceLog(LOG_WARNING, "[%s] Texture coordinates must be float", fileName);
-                        }
-                    }
-                }
+// Worker job: get nearest spatial tree entry crossed by every ray in range
+// NOTE: Nearest child is traversed first and farther nodes are skipped once a closer entry is found
+static void SpatialRaysJobRun(void *data)
+{
+    SpatialRaysJob *job = (SpatialRaysJob *)data;
+    const SpatialTree *tree = job->tree;
+
+    for (int r = job->start; r < job->end; r++)
+    {
+        Vector3 origin = job->rays[r].position;
+        Vector3 invDir = { 1.0f/job->rays[r].direction.x, 1.0f/job->rays[r].direction.y, 1.0f/job->rays[r].direction.z };
 
-                cgltf_accessor *acc = data->meshes[i].primitives[p].indices;
+        float nearest = job->maxDistance;
+        int nearestId = -1;
+        float distance = 0.0f;
 
-                if (acc)
+        int stack[MAX_SPATIAL_QUERY_STACK] = { 0 };
+        float stackDistances[MAX_SPATIAL_QUERY_STACK] = { 0 };
+        int stackSize = 0;
+
+        if ((tree->root != -1) && GetRayBoxDistance(origin, invDir, tree->nodes[tree->root].bounds.min, tree->nodes[tree->root].bounds.max, nearest, &distance))
+        {
+            stack[0] = tree->root;
+            stackDistances[0] = distance;
+            stackSize = 1;
+        }
+
+        while (stackSize > 0)
+        {
+            stackSize--;
+            if (stackDistances[stackSize] > nearest) continue;
+
+            const SpatialNode *node = &tree->nodes[stack[stackSize]];
+
+            if (node->child1 == -1)
+            {
+                // NOTE: Ray starting inside entry box hits at distance 0
+                if (GetRayBoxDistance(origin, invDir, node->entryBox.min, node->entryBox.max, nearest, &distance))
                 {
-                    if (acc->component_type == cgltf_component_type_r_16u)
-                    {
-                        model.meshes[primitiveIndex].triangleCount = acc->count/3;
-                        model.meshes[primitiveIndex].indices = RL_MALLOC(sizeof(unsigned short)*model.meshes[primitiveIndex].triangleCount*3);
-                        LOAD_ACCESSOR(unsigned short, 1, acc, model.meshes[primitiveIndex].indices)
-                    }
-                    else
+                    if (distance < 0.0f) distance = 0.0f;
+
+                    if ((nearestId == -1) || (distance < nearest))
                     {
-                        // TODO: Support unsigned byte/unsigned int
-                        TraceLog(LOG_WARNING, "[%s] Indices must be unsigned short", fileName);
+                        nearest = distance;
+                        nearestId = node->userId;
                     }
                 }
-                else
-                {
-                    // Unindexed mesh
-                    model.meshes[primitiveIndex].triangleCount = model.meshes[primitiveIndex].vertexCount/3;
-                }
+            }
+            else if ((stackSize + 2) <= MAX_SPATIAL_QUERY_STACK)
+            {
+                float distance1 = 0.0f;
+                float distance2 = 0.0f;
+                bool hit1 = GetRayBoxDistance(origin, invDir, tree->nodes[node->child1].bounds.min, tree->nodes[node->child1].bounds.max, nearest, &distance1);
+                bool hit2 = GetRayBoxDistance(origin, invDir, tree->nodes[node->child2].bounds.min, tree->nodes[node->child2].bounds.max, nearest, &distance2);
 
-                if (data->meshes[i].primitives[p].material)
+                // Farther child pushed first, nearest child popped first
+                if (hit1 && hit2 && (distance2 < distance1))
                 {
-                    // Compute the offset
-                    model.meshMaterial[primitiveIndex] = data->meshes[i].primitives[p].material - data->materials;
+                    stack[stackSize] = node->child1; stackDistances[stackSize] = distance1; stackSize++;
+                    stack[stackSize] = node->child2; stackDistances[stackSize] = distance2; stackSize++;
                 }
                 else
                 {
-                    model.meshMaterial[primitiveIndex] = model.materialCount - 1;;
+                    if (hit2) { stack[stackSize] = node->child2; stackDistances[stackSize] = distance2; stackSize++; }
+                    if (hit1) { stack[stackSize] = node->child1; stackDistances[stackSize] = distance1; stackSize++; }
                 }
-
-                primitiveIndex++;
             }
         }
 
-        cgltf_free(data);
+        job->userIds[r] = nearestId;
+        if (job->distances != NULL) job->distances[r] = (nearestId != -1)? nearest : 0.0f;
     }
-    else TraceLog(LOG_WARNING, "[%s] glTF data could not be loaded", fileName);
+}
 
-    RL_FREE(buffer);
+// Store batched collision checks hits (mask bits from start index), returns updated hits count
+// NOTE: SIMD masks start at multiples of 4, never crossing a hitMask value
+static int StoreBatchHits(int start, unsigned int mask, unsigned int *hitMask, int *hitIndices, int hitCount)
+{
+    if (hitMask != NULL) hitMask[start/32] |= (mask << (start%32));
 
-    return model;
+    for (int lane = 0; mask != 0; lane++, mask >>= 1)
+    {
+        if (mask & 1)
+        {
+            if (hitIndices != NULL) hitIndices[hitCount] = start + lane;
+            hitCount++;
+        }
+    }
+
+    return hitCount;
+}
+
+#if defined(MODELS_SIMD_NEON)
+// Get NEON comparison lanes as bits mask (same as SSE _mm_movemask_ps())
+static unsigned int GetLanesMask(uint32x4_t lanes)
+{
+    const uint32_t laneBits[4] = { 1, 2, 4, 8 };
+    uint32x4_t bits = vandq_u32(lanes, vld1q_u32(laneBits));
+    uint32x2_t sum = vadd_u32(vget_low_u32(bits), vget_high_u32(bits));
+
+    return vget_lane_u32(sum, 0) | vget_lane_u32(sum, 1);
 }
 #endif
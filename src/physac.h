@@ -33,13 +33,24 @@
 *       Traces log messages when creating and destroying physics bodies and detects errors in physics
 *       calculations and reference exceptions; it is useful for debug purposes
 *
+*   #define PHYSAC_MAX_BODIES
+*   #define PHYSAC_MAX_MANIFOLDS
+*       Default initial capacities of physics bodies and manifolds storage, used by InitPhysics().
+*       Storage grows when exceeded; use InitPhysicsEx() to set capacities at runtime.
+*
+*   #define PHYSAC_MAX_VERTICES
+*       Max vertices per polygon shape, stored inline in every physics body (24 by default).
+*
 *   #define PHYSAC_MALLOC()
+*   #define PHYSAC_REALLOC()
 *   #define PHYSAC_FREE()
-*       You can define your own malloc/free implementation replacing stdlib.h malloc()/free() functions.
-*       Otherwise it will include stdlib.h and use the C standard library malloc()/free() function.
+*       You can define your own malloc/realloc/free implementation replacing stdlib.h functions.
+*       Memory is only requested when storage is initialized or grows, never during physics steps.
 *
 *
 *   NOTE 1: Physac requires multi-threading, when InitPhysics() a second thread is created to manage physics calculations.
+*           Physics thread sleeps between fixed steps. Use GetPhysicsBodyPosition() and GetPhysicsShapeVertex() to read
+*           bodies from main thread, they return state published by last completed step.
 *   NOTE 2: Physac requires static C library linkage to avoid dependency on MinGW DLL (-static -lpthread)
 *
 *   Use the following code to compile:
@@ -91,20 +102,39 @@
 //----------------------------------------------------------------------------------
 // Defines and Macros
 //----------------------------------------------------------------------------------
-#define     PHYSAC_MAX_BODIES               64
-#define     PHYSAC_MAX_MANIFOLDS            4096
-#define     PHYSAC_MAX_VERTICES             24
+#if !defined(PHYSAC_MAX_BODIES)
+    #define PHYSAC_MAX_BODIES               64
+#endif
+#if !defined(PHYSAC_MAX_MANIFOLDS)
+    #define PHYSAC_MAX_MANIFOLDS            4096
+#endif
+#if !defined(PHYSAC_MAX_VERTICES)
+    #define PHYSAC_MAX_VERTICES             24
+#endif
 #define     PHYSAC_CIRCLE_VERTICES          24
 
-#define     PHYSAC_COLLISION_ITERATIONS     100
+#define     PHYSAC_COLLISION_ITERATIONS     100         // Max impulse solver iterations per step (default, see SetPhysicsSolverIterations())
+#define     PHYSAC_SOLVER_TOLERANCE         0.00005f    // Velocity change that stops island iterations early (pixels/ms)
+#define     PHYSAC_CONTACT_MATCH_DISTANCE   2.0f        // Max distance to previous step contact to warm start it (pixels)
 #define     PHYSAC_PENETRATION_ALLOWANCE    0.05f
 #define     PHYSAC_PENETRATION_CORRECTION   0.4f
 
+#define     PHYSAC_SLEEP_VELOCITY           0.04f       // Max linear velocity of a resting body (pixels/ms)
+#define     PHYSAC_SLEEP_ANGULAR_VELOCITY   0.0005f     // Max angular velocity of a resting body (radians/ms)
+#define     PHYSAC_SLEEP_TIME               500.0f      // Time an island must rest before sleeping (ms)
+
 #define     PHYSAC_PI                       3.14159265358979323846
 #define     PHYSAC_DEG2RAD                  (PHYSAC_PI/180.0f)
 
-#define     PHYSAC_MALLOC(size)             malloc(size)
-#define     PHYSAC_FREE(ptr)                free(ptr)
+#if !defined(PHYSAC_MALLOC)
+    #define PHYSAC_MALLOC(size)             malloc(size)
+#endif
+#if !defined(PHYSAC_REALLOC)
+    #define PHYSAC_REALLOC(ptr, size)       realloc(ptr, size)
+#endif
+#if !defined(PHYSAC_FREE)
+    #define PHYSAC_FREE(ptr)                free(ptr)
+#endif
 
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
@@ -170,6 +200,8 @@ typedef struct PhysicsBodyData {
     bool useGravity;                            // Apply gravity force to dynamics
     bool isGrounded;                            // Physics grounded on other body state
     bool freezeOrient;                          // Physics rotation constraint
+    bool isSleeping;                            // Physics sleeping state (skipped by dynamics until woken)
+    float sleepTime;                            // Time the body has been resting, in milliseconds
     PhysicsShape shape;                         // Physics body shape information (type, radius, vertices, normals)
 } PhysicsBodyData;
 
@@ -181,11 +213,33 @@ typedef struct PhysicsManifoldData {
     Vector2 normal;                             // Normal direction vector from 'a' to 'b'
     Vector2 contacts[2];                        // Points of contact during collision
     unsigned int contactsCount;                 // Current collision number of contacts
+    float normalImpulses[2];                    // Accumulated normal impulse of contacts (warm started from previous step)
+    float tangentImpulses[2];                   // Accumulated friction impulse of contacts (warm started from previous step)
+    float velocityBiases[2];                    // Contacts target separating velocity from restitution
     float restitution;                          // Mixed restitution during collision
     float dynamicFriction;                      // Mixed dynamic friction during collision
     float staticFriction;                       // Mixed static friction during collision
 } PhysicsManifoldData, *PhysicsManifold;
 
+typedef struct PhysicsRay {
+    Vector2 origin;                             // Ray origin position
+    Vector2 direction;                          // Ray direction (normalized by queries)
+    float length;                               // Ray max length
+} PhysicsRay;
+
+typedef struct PhysicsRaycastHit {
+    PhysicsBody body;                           // Physics body hit (NULL if ray hit nothing)
+    Vector2 point;                              // Hit position
+    Vector2 normal;                             // Hit body surface normal
+    float distance;                             // Distance from ray origin to hit position
+} PhysicsRaycastHit;
+
+typedef struct PhysicsConfig {
+    unsigned int maxBodies;                     // Initial bodies capacity, storage grows in blocks of this size
+    unsigned int maxManifolds;                  // Initial manifolds capacity, storage doubles when exceeded
+    unsigned int workersCount;                  // Worker threads helping physics thread on every step (ignored with PHYSAC_NO_THREADS, limited to raylib worker threads)
+} PhysicsConfig;
+
 #if defined(__cplusplus)
 extern "C" {                                    // Prevents name mangling of functions
 #endif
@@ -194,8 +248,10 @@ extern "C" {                                    // Prevents name mangling of fun
 // Module Functions Declaration
 //----------------------------------------------------------------------------------
 PHYSACDEF void InitPhysics(void);                                                                           // Initializes physics values, pointers and creates physics loop thread
+PHYSACDEF void InitPhysicsEx(PhysicsConfig config);                                                         // Initializes physics with custom storage capacities and worker threads count
 PHYSACDEF void RunPhysicsStep(void);                                                                        // Run physics step, to be used if PHYSICS_NO_THREADS is set in your main loop
 PHYSACDEF void SetPhysicsTimeStep(double delta);                                                            // Sets physics fixed time step in milliseconds. 1.666666 by default
+PHYSACDEF void SetPhysicsSolverIterations(int iterations);                                                  // Sets max collision solver iterations per step. PHYSAC_COLLISION_ITERATIONS by default
 PHYSACDEF bool IsPhysicsEnabled(void);                                                                      // Returns true if physics thread is currently enabled
 PHYSACDEF void SetPhysicsGravity(float x, float y);                                                         // Sets physics global gravity force
 PHYSACDEF PhysicsBody CreatePhysicsBodyCircle(Vector2 pos, float radius, float density);                    // Creates a new circle physics body with generic parameters
@@ -209,9 +265,17 @@ PHYSACDEF PhysicsBody GetPhysicsBody(int index);
 PHYSACDEF int GetPhysicsShapeType(int index);                                                               // Returns the physics body shape type (PHYSICS_CIRCLE or PHYSICS_POLYGON)
 PHYSACDEF int GetPhysicsShapeVerticesCount(int index);                                                      // Returns the amount of vertices of a physics body shape
 PHYSACDEF Vector2 GetPhysicsShapeVertex(PhysicsBody body, int vertex);                                      // Returns transformed position of a body shape (body position + vertex transformed position)
+PHYSACDEF Vector2 GetPhysicsBodyPosition(PhysicsBody body);                                                 // Returns physics body position computed by last step (safe to read while physics thread runs)
 PHYSACDEF void SetPhysicsBodyRotation(PhysicsBody body, float radians);                                     // Sets physics body shape transform based on radians parameter
+PHYSACDEF PhysicsRaycastHit PhysicsRaycast(PhysicsRay ray);                                                 // Returns closest physics body hit by a ray
+PHYSACDEF void PhysicsRaycastBatch(const PhysicsRay *rays, int count, PhysicsRaycastHit *hits);             // Casts multiple rays, hits array must hold count results
+PHYSACDEF int PhysicsQueryAABB(Vector2 min, Vector2 max, PhysicsBody *results, int maxResults);             // Finds physics bodies which bounds overlap an area, returns results count
+PHYSACDEF int PhysicsQueryPoint(Vector2 point, PhysicsBody *results, int maxResults);                       // Finds physics bodies shapes containing a point, returns results count
 PHYSACDEF void DestroyPhysicsBody(PhysicsBody body);                                                        // Unitializes and destroy a physics body
 PHYSACDEF void ResetPhysics(void);                                                                          // Destroys created physics bodies and manifolds and resets global values
+PHYSACDEF unsigned int GetPhysicsStateSize(void);                                                           // Returns size in bytes required to save current physics world state
+PHYSACDEF unsigned int SavePhysicsState(void *buffer);                                                      // Saves physics world state into a buffer, returns bytes written
+PHYSACDEF bool LoadPhysicsState(const void *buffer);                                                        // Restores physics world state saved by SavePhysicsState()
 PHYSACDEF void ClosePhysics(void);                                                                          // Unitializes physics pointers and closes physics loop thread
 
 #if defined(__cplusplus)
@@ -229,27 +293,34 @@ PHYSACDEF void ClosePhysics(void);
 #if defined(PHYSAC_IMPLEMENTATION)
 
 #if !defined(PHYSAC_NO_THREADS)
-    #include <pthread.h>            // Required for: pthread_t, pthread_create()
+    #include <pthread.h>            // Required for: pthread_t, pthread_create(), pthread_mutex_t
+#endif
+
+// Step tasks run on raylib shared worker threads (ParallelFor()), own worker threads only on standalone mode
+#if !defined(PHYSAC_STANDALONE) && !defined(PHYSAC_NO_THREADS)
+    #define PHYSAC_SHARED_WORKERS
 #endif
 
 #if defined(PHYSAC_DEBUG)
     #include <stdio.h>              // Required for: printf()
 #endif
 
-#include <stdlib.h>                 // Required for: malloc(), free(), srand(), rand()
+#include <stdlib.h>                 // Required for: malloc(), realloc(), free(), srand()
+#include <string.h>                 // Required for: memmove(), memset(), memcpy()
 #include <math.h>                   // Required for: cosf(), sinf(), fabs(), sqrtf()
-#include <stdint.h>                 // Required for: uint64_t
+#include <stdint.h>                 // Required for: uint64_t, uintptr_t
 
 #if !defined(PHYSAC_STANDALONE)
     #include "raymath.h"            // Required for: Vector2Add(), Vector2Subtract()
 #endif
 
 // Time management functionality
-#include <time.h>                   // Required for: time(), clock_gettime()
+#include <time.h>                   // Required for: time(), clock_gettime(), nanosleep()
 #if defined(_WIN32)
     // Functions required to query time on Windows
     int __stdcall QueryPerformanceCounter(unsigned long long int *lpPerformanceCount);
     int __stdcall QueryPerformanceFrequency(unsigned long long int *lpFrequency);
+    void __stdcall Sleep(unsigned long msTimeout);
 #elif defined(__linux__)
     #if _POSIX_C_SOURCE < 199309L
         #undef _POSIX_C_SOURCE
@@ -269,6 +340,43 @@ PHYSACDEF void ClosePhysics(void);
 #define     PHYSAC_EPSILON              0.000001f
 #define     PHYSAC_K                    1.0f/3.0f
 #define     PHYSAC_VECTOR_ZERO          (Vector2){ 0.0f, 0.0f }
+#define     PHYSAC_PARALLEL_MIN_ITEMS   64          // Min items count to split a step task between worker threads
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+typedef struct PhysicsPair {
+    PhysicsBody bodyA;                          // Pair first physics body (creation order)
+    PhysicsBody bodyB;                          // Pair second physics body
+    PhysicsManifoldData manifold;               // Narrowphase collision result
+} PhysicsPair;
+
+typedef struct PhysicsStateHeader {
+    double accumulator;                         // Physics time step accumulator
+    double deltaTime;                           // Physics fixed time step
+    Vector2 gravity;                            // Physics world gravity force
+    unsigned int size;                          // Total state size in bytes (header included)
+    unsigned int stepsCount;                    // Total physics steps processed
+    unsigned int bodiesCount;                   // Physics bodies counter
+    unsigned int bodiesCapacity;                // Physics bodies storage capacity when saved
+    unsigned int freeIdsCount;                  // Physics bodies available ids counter
+    unsigned int manifoldsCount;                // Physics last step manifolds counter (warm start contacts)
+    unsigned int sweepCount;                    // Physics bodies counter when sweep order was generated
+    unsigned int solverIterations;              // Physics max collision solver iterations per step
+} PhysicsStateHeader;
+
+typedef struct PhysicsBodyState {
+    bool published;                             // State was published by a physics step since body creation
+    Vector2 position;                           // Physics body position
+    Mat2 transform;                             // Physics body shape transform
+} PhysicsBodyState;
+
+typedef struct PhysicsQueryEntry {
+    PhysicsBody body;                           // Physics body reference
+    PhysicsBodyState state;                     // Physics body state tested by queries
+    Vector2 boundsMin;                          // Physics body bounds min corner
+    Vector2 boundsMax;                          // Physics body bounds max corner
+} PhysicsQueryEntry;
 
 //----------------------------------------------------------------------------------
 // Global Variables Definition
@@ -276,8 +384,8 @@ PHYSACDEF void ClosePhysics(void);
 #if !defined(PHYSAC_NO_THREADS)
 static pthread_t physicsThreadId;                           // Physics thread id
 #endif
-static unsigned int usedMemory = 0;                         // Total allocated dynamic memory
-static bool physicsThreadEnabled = false;                   // Physics thread enabled state
+static unsigned int usedMemory = 0;                         // Total used bodies storage memory
+static volatile bool physicsThreadEnabled = false;          // Physics thread enabled state
 static double baseTime = 0.0;                               // Offset time for MONOTONIC clock
 static double startTime = 0.0;                              // Start time in milliseconds
 static double deltaTime = 1.0/60.0/10.0 * 1000;             // Delta time used for physics steps, in milliseconds
@@ -287,22 +395,109 @@ static uint64_t frequency = 0;                              // Hi-res clock freq
 static double accumulator = 0.0;                            // Physics time step delta time accumulator
 static unsigned int stepsCount = 0;                         // Total physics steps processed
 static Vector2 gravityForce = { 0.0f, 9.81f };              // Physics world gravity force
-static PhysicsBody bodies[PHYSAC_MAX_BODIES];               // Physics bodies pointers array
+static PhysicsBodyData **bodiesBlocks = NULL;               // Physics bodies data blocks, indexed by body id (blocks never move)
+static unsigned int bodiesBlocksCount = 0;                  // Physics bodies data blocks counter
+static unsigned int bodiesBlockSize = PHYSAC_MAX_BODIES;    // Physics bodies per data block
+static unsigned int bodiesCapacity = 0;                     // Physics bodies storage capacity
+static unsigned int bodiesVersion = 1;                      // Physics bodies version, changes when bodies are created, destroyed or rotated
+static PhysicsQueryEntry *queryEntries = NULL;              // Physics bodies sorted by bounds min x, used by queries
+static unsigned int queryEntriesCount = 0;                  // Physics query entries counter
+static unsigned int queryStepsCount = 0;                    // Physics steps counter when query entries were built
+static unsigned int queryBodiesVersion = 0;                 // Physics bodies version when query entries were built
+static unsigned int *freeBodyIds = NULL;                    // Physics bodies available ids stack
+static unsigned int freeBodyIdsCount = 0;                   // Physics bodies available ids counter
+static PhysicsBody *bodies = NULL;                          // Physics bodies pointers array
 static unsigned int physicsBodiesCount = 0;                 // Physics world current bodies counter
-static PhysicsManifold contacts[PHYSAC_MAX_MANIFOLDS];      // Physics bodies pointers array
+static PhysicsManifoldData *contacts = NULL;                // Physics manifolds data array (reset every step)
+static PhysicsManifoldData *previousContacts = NULL;        // Physics previous step manifolds, used to warm start contacts
+static unsigned int previousManifoldsCount = 0;             // Physics previous step manifolds counter
+static unsigned int *previousTable = NULL;                  // Physics previous step manifolds hash table by bodies ids (index + 1, 0 is empty)
+static unsigned int previousTableSize = 0;                  // Physics previous step manifolds hash table size
+static unsigned int solverIterations = PHYSAC_COLLISION_ITERATIONS; // Physics max collision solver iterations per step
+static unsigned int manifoldsCapacity = 0;                  // Physics manifolds storage capacity
 static unsigned int physicsManifoldsCount = 0;              // Physics world current manifolds counter
+static Vector2 *boundsMin = NULL;                           // Physics bodies bounding boxes min corners (broadphase)
+static Vector2 *boundsMax = NULL;                           // Physics bodies bounding boxes max corners (broadphase)
+static int *sweepOrder = NULL;                              // Physics bodies indices sorted by bounds min x (broadphase)
+static unsigned int *islandParent = NULL;                   // Physics bodies island parent ids (indexed by body id)
+static float *islandSleepTime = NULL;                       // Physics islands min resting time (indexed by root body id)
+static Vector2 *sleepPosition = NULL;                       // Physics bodies position when put to sleep (indexed by body id)
+static unsigned int *islandOffset = NULL;                   // Physics islands first manifold position (indexed by root body id)
+static unsigned int *manifoldIsland = NULL;                 // Physics manifolds island root id
+static unsigned int *islandManifolds = NULL;                // Physics manifolds indices sorted by island
+static unsigned int sweepCount = 0;                         // Physics bodies counter when sweep order was generated
+static PhysicsPair *pairs = NULL;                           // Physics broadphase candidate pairs (solved by narrowphase)
+static unsigned int pairsCapacity = 0;                      // Physics candidate pairs storage capacity
+static unsigned int physicsPairsCount = 0;                  // Physics current step candidate pairs counter
+
+#if !defined(PHYSAC_NO_THREADS)
+static unsigned int workersCount = 0;                       // Physics worker threads counter
+#if !defined(PHYSAC_SHARED_WORKERS)
+static pthread_t *workerThreads = NULL;                     // Physics worker threads ids
+static pthread_mutex_t workersMutex;                        // Physics workers tasks synchronization mutex
+static pthread_cond_t workersStart;                         // Physics workers new task condition
+static pthread_cond_t workersDone;                          // Physics workers task completed condition
+static unsigned int workersGeneration = 0;                  // Physics workers task counter, changes every new task
+static unsigned int workersPending = 0;                     // Physics workers still running current task
+static bool workersExit = false;                            // Physics workers exit request
+#endif
+static PhysicsBodyState *bodiesStates[2] = { NULL, NULL };  // Physics bodies published states double buffer (indexed by body id)
+static unsigned int statesFront = 0;                        // Physics bodies states buffer read by user thread
+static unsigned int publishedStepsCount = 0;                // Physics steps counter when states were published
+static pthread_mutex_t statesMutex = PTHREAD_MUTEX_INITIALIZER; // Physics bodies states buffers swap mutex
+#endif
+static void (*physicsTask)(int start, int end) = NULL;      // Physics step task being run (by physics thread and workers)
+static int physicsTaskCount = 0;                            // Physics step task items count
+static unsigned int physicsTaskParts = 1;                   // Physics step task parts (one per thread)
 
 //----------------------------------------------------------------------------------
 // Module Internal Functions Declaration
 //----------------------------------------------------------------------------------
 static int FindAvailableBodyIndex();                                                                        // Finds a valid index for a new physics body initialization
+static bool GrowPhysicsBodies(void);                                                                        // Adds a new data block to physics bodies storage
+static bool ResizePhysicsManifolds(unsigned int capacity);                                                  // Sets physics manifolds storage capacity
+static bool GrowPhysicsPairs(void);                                                                         // Doubles physics candidate pairs storage capacity
+static void UnloadPhysicsStorage(void);                                                                     // Frees physics bodies and manifolds storage
+static PhysicsBody GetPhysicsBodyById(unsigned int id);                                                     // Returns physics body data of a body id
 static PolygonData CreateRandomPolygon(float radius, int sides);                                            // Creates a random polygon shape with max vertex distance from polygon pivot
 static PolygonData CreateRectanglePolygon(Vector2 pos, Vector2 size);                                       // Creates a rectangle polygon shape based on a min and max positions
 static void *PhysicsLoop(void *arg);                                                                        // Physics loop thread function
+static void WaitPhysicsTime(double ms);                                                                     // Sleeps physics thread for some milliseconds
+static void PublishPhysicsBodies(void);                                                                     // Publishes physics bodies state computed by last steps to user thread
+static PhysicsBodyState GetPhysicsBodyState(PhysicsBody body);                                              // Returns physics body published state
+static void UpdatePhysicsQueries(void);                                                                     // Builds physics query entries from bodies state of last step
+static int ComparePhysicsQueryEntries(const void *a, const void *b);                                        // Compares physics query entries bounds min x (qsort)
+static PhysicsRaycastHit RaycastPhysicsQueries(PhysicsRay ray);                                             // Returns closest physics query entry hit by a ray
+static bool RaycastPhysicsEntry(PhysicsQueryEntry *entry, Vector2 origin, Vector2 direction, float length, PhysicsRaycastHit *hit); // Checks ray against a physics query entry shape
+static bool CheckPhysicsEntryPoint(PhysicsQueryEntry *entry, Vector2 point);                                // Checks if a point is inside a physics query entry shape
 static void PhysicsStep(void);                                                                              // Physics steps calculations (dynamics, collisions and position corrections)
-static int FindAvailableManifoldIndex();                                                                    // Finds a valid index for a new manifold initialization
+static void UpdatePhysicsBounds(void);                                                                      // Updates physics bodies bounding boxes and sorts them along x axis (broadphase)
+static void AddPhysicsPair(PhysicsBody a, PhysicsBody b);                                                   // Adds two physics bodies with overlapping bounds to narrowphase candidate pairs
+static void StorePhysicsPairs(void);                                                                        // Stores candidate pairs in contact as manifolds and updates bodies state
+static void GetPhysicsBodyBounds(PhysicsBody body, Vector2 *boundMin, Vector2 *boundMax);                   // Computes physics body axis aligned bounding box
+static void GetPhysicsStateBounds(PhysicsBody body, PhysicsBodyState state, Vector2 *boundMin, Vector2 *boundMax); // Computes physics body axis aligned bounding box at a given state
+static void BuildPhysicsIslands(void);                                                                      // Groups bodies in contact into islands and sorts manifolds by island
+static void UpdatePhysicsSleeping(void);                                                                    // Puts to sleep islands which bodies have been resting enough time
+static unsigned int FindIslandRoot(unsigned int id);                                                        // Finds island root id of a physics body id
+static void WakePhysicsBody(PhysicsBody body);                                                              // Wakes up a sleeping physics body
+static int FindIslandEnd(int start);                                                                        // Finds the end position of an island in island sorted manifolds
+
+static void RunPhysicsTask(void (*task)(int start, int end), int count);                                   // Runs a step task, split between physics thread and workers
+static void RunPhysicsTaskPart(unsigned int part);                                                          // Runs a part of current step task
+#if defined(PHYSAC_SHARED_WORKERS)
+static void RunPhysicsTaskParts(void *data, int start, int end);                                            // Runs a range of current step task parts (ParallelFor() body)
+#elif !defined(PHYSAC_NO_THREADS)
+static void InitPhysicsWorkers(unsigned int count);                                                         // Creates physics worker threads
+static void ClosePhysicsWorkers(void);                                                                      // Stops and joins physics worker threads
+static void *PhysicsWorkerLoop(void *arg);                                                                  // Physics worker thread function
+#endif
+static void SolvePhysicsPairsTask(int start, int end);                                                      // Step task: solves narrowphase of candidate pairs
+static void IntegratePhysicsForcesTask(int start, int end);                                                 // Step task: integrates forces of physics bodies
+static void InitializePhysicsManifoldsTask(int start, int end);                                             // Step task: initializes physics manifolds
+static void IntegratePhysicsImpulsesTask(int start, int end);                                               // Step task: integrates collisions impulses of islands
+static void IntegratePhysicsVelocityTask(int start, int end);                                               // Step task: integrates velocity of physics bodies
+static void CorrectPhysicsPositionsTask(int start, int end);                                                // Step task: corrects positions of islands
 static PhysicsManifold CreatePhysicsManifold(PhysicsBody a, PhysicsBody b);                                 // Creates a new physics manifold to solve collision
-static void DestroyPhysicsManifold(PhysicsManifold manifold);                                               // Unitializes and destroys a physics manifold
 static void SolvePhysicsManifold(PhysicsManifold manifold);                                                 // Solves a created physics manifold between two physics bodies
 static void SolveCircleToCircle(PhysicsManifold manifold);                                                  // Solves collision between two circle shape physics bodies
 static void SolveCircleToPolygon(PhysicsManifold manifold);                                                 // Solves collision between a circle to a polygon shape physics bodies
@@ -310,7 +505,10 @@ static void SolvePolygonToCircle(PhysicsManifold manifold);
 static void SolvePolygonToPolygon(PhysicsManifold manifold);                                                // Solves collision between two polygons shape physics bodies
 static void IntegratePhysicsForces(PhysicsBody body);                                                       // Integrates physics forces into velocity
 static void InitializePhysicsManifolds(PhysicsManifold manifold);                                           // Initializes physics manifolds to solve collisions
-static void IntegratePhysicsImpulses(PhysicsManifold manifold);                                             // Integrates physics collisions impulses to solve collisions
+static void WarmStartPhysicsManifold(PhysicsManifold manifold);                                             // Applies physics manifold contacts impulses accumulated in previous step
+static float IntegratePhysicsImpulses(PhysicsManifold manifold);                                            // Integrates physics collisions impulses to solve collisions, returns max velocity change
+static void StorePreviousManifolds(void);                                                                   // Keeps current manifolds as previous step ones and indexes them by bodies ids
+static PhysicsManifold FindPreviousManifold(PhysicsBody a, PhysicsBody b);                                  // Finds previous step manifold between two physics bodies
 static void IntegratePhysicsVelocity(PhysicsBody body);                                                     // Integrates physics velocity into position and forces
 static void CorrectPhysicsPositions(PhysicsManifold manifold);                                              // Corrects physics bodies positions based on manifolds collision information
 static float FindAxisLeastPenetration(int *faceIndex, PhysicsShape shapeA, PhysicsShape shapeB);            // Finds polygon shapes axis least penetration
@@ -346,20 +544,48 @@ static inline Vector2 Mat2MultiplyVector2(Mat2 matrix, Vector2 vector);
 // Initializes physics values, pointers and creates physics loop thread
 PHYSACDEF void InitPhysics(void)
 {
+    InitPhysicsEx((PhysicsConfig){ PHYSAC_MAX_BODIES, PHYSAC_MAX_MANIFOLDS, 0 });
+}
+
+// Initializes physics with custom bodies and manifolds storage capacities
+PHYSACDEF void InitPhysicsEx(PhysicsConfig config)
+{
+    // Allocate initial storage, it grows later if capacities are exceeded
+    if (bodiesBlocksCount == 0)
+    {
+        bodiesBlockSize = ((config.maxBodies > 0) ? config.maxBodies : PHYSAC_MAX_BODIES);
+        GrowPhysicsBodies();
+    }
+
+    if (manifoldsCapacity < config.maxManifolds) ResizePhysicsManifolds(config.maxManifolds);
+
     #if !defined(PHYSAC_NO_THREADS)
-        // NOTE: if defined, user will need to create a thread for PhysicsThread function manually
-        // Create physics thread using POSIXS thread libraries
-        pthread_create(&physicsThreadId, NULL, &PhysicsLoop, NULL);
+        // Create worker threads, every step task is split between them and physics thread
+        #if defined(PHYSAC_SHARED_WORKERS)
+            workersCount = config.workersCount;
+            if (workersCount > (unsigned int)GetWorkerThreads()) workersCount = (unsigned int)GetWorkerThreads();
+        #else
+            if ((config.workersCount > 0) && (workersCount == 0)) InitPhysicsWorkers(config.workersCount);
+        #endif
+
     #endif
 
     // Initialize high resolution timer
+    // NOTE: Timer and accumulator must be ready before physics thread runs its first step
     InitTimer();
+    accumulator = 0.0;
+
+    #if !defined(PHYSAC_NO_THREADS)
+        // NOTE: if defined, user will need to create a thread for PhysicsThread function manually
+        // Create physics thread using POSIXS thread libraries
+        // NOTE: Enabled state is set before thread creation, so ClosePhysics() can not be missed by the thread
+        physicsThreadEnabled = true;
+        if (pthread_create(&physicsThreadId, NULL, &PhysicsLoop, NULL) != 0) physicsThreadEnabled = false;
+    #endif
 
     #if defined(PHYSAC_DEBUG)
         printf("[PHYSAC] physics module initialized successfully\n");
     #endif
-
-    accumulator = 0.0;
 }
 
 // Returns true if physics thread is currently enabled
@@ -385,12 +611,14 @@ PHYSACDEF PhysicsBody CreatePhysicsBodyCircle(Vector2 pos, float radius, float d
 // Creates a new rectangle physics body with generic parameters
 PHYSACDEF PhysicsBody CreatePhysicsBodyRectangle(Vector2 pos, float width, float height, float density)
 {
-    PhysicsBody newBody = (PhysicsBody)PHYSAC_MALLOC(sizeof(PhysicsBodyData));
-    usedMemory += sizeof(PhysicsBodyData);
+    PhysicsBody newBody = NULL;
 
     int newId = FindAvailableBodyIndex();
     if (newId != -1)
     {
+        newBody = GetPhysicsBodyById(newId);
+        usedMemory += sizeof(PhysicsBodyData);
+
         // Initialize new body with generic values
         newBody->id = newId;
         newBody->enabled = true;
@@ -453,6 +681,8 @@ PHYSACDEF PhysicsBody CreatePhysicsBodyRectangle(Vector2 pos, float width, float
         newBody->useGravity = true;
         newBody->isGrounded = false;
         newBody->freezeOrient = false;
+        newBody->isSleeping = false;
+        newBody->sleepTime = 0.0f;
 
         // Add new body to bodies pointers array and update bodies count
         bodies[physicsBodiesCount] = newBody;
@@ -463,7 +693,7 @@ PHYSACDEF PhysicsBody CreatePhysicsBodyRectangle(Vector2 pos, float width, float
         #endif
     }
     #if defined(PHYSAC_DEBUG)
-        else printf("[PHYSAC] new physics body creation failed because there is any available id to use\n");
+        else printf("[PHYSAC] new physics body creation failed because bodies storage could not grow\n");
     #endif
 
     return newBody;
@@ -472,12 +702,14 @@ PHYSACDEF PhysicsBody CreatePhysicsBodyRectangle(Vector2 pos, float width, float
 // Creates a new polygon physics body with generic parameters
 PHYSACDEF PhysicsBody CreatePhysicsBodyPolygon(Vector2 pos, float radius, int sides, float density)
 {
-    PhysicsBody newBody = (PhysicsBody)PHYSAC_MALLOC(sizeof(PhysicsBodyData));
-    usedMemory += sizeof(PhysicsBodyData);
+    PhysicsBody newBody = NULL;
 
     int newId = FindAvailableBodyIndex();
     if (newId != -1)
     {
+        newBody = GetPhysicsBodyById(newId);
+        usedMemory += sizeof(PhysicsBodyData);
+
         // Initialize new body with generic values
         newBody->id = newId;
         newBody->enabled = true;
@@ -539,6 +771,8 @@ PHYSACDEF PhysicsBody CreatePhysicsBodyPolygon(Vector2 pos, float radius, int si
         newBody->useGravity = true;
         newBody->isGrounded = false;
         newBody->freezeOrient = false;
+        newBody->isSleeping = false;
+        newBody->sleepTime = 0.0f;
 
         // Add new body to bodies pointers array and update bodies count
         bodies[physicsBodiesCount] = newBody;
@@ -549,7 +783,7 @@ PHYSACDEF PhysicsBody CreatePhysicsBodyPolygon(Vector2 pos, float radius, int si
         #endif
     }
     #if defined(PHYSAC_DEBUG)
-        else printf("[PHYSAC] new physics body creation failed because there is any available id to use\n");
+        else printf("[PHYSAC] new physics body creation failed because bodies storage could not grow\n");
     #endif
 
     return newBody;
@@ -558,13 +792,21 @@ PHYSACDEF PhysicsBody CreatePhysicsBodyPolygon(Vector2 pos, float radius, int si
 // Adds a force to a physics body
 PHYSACDEF void PhysicsAddForce(PhysicsBody body, Vector2 force)
 {
-    if (body != NULL) body->force = Vector2Add(body->force, force);
+    if (body != NULL)
+    {
+        body->force = Vector2Add(body->force, force);
+        WakePhysicsBody(body);
+    }
 }
 
 // Adds an angular force to a physics body
 PHYSACDEF void PhysicsAddTorque(PhysicsBody body, float amount)
 {
-    if (body != NULL) body->torque += amount;
+    if (body != NULL)
+    {
+        body->torque += amount;
+        WakePhysicsBody(body);
+    }
 }
 
 // Shatters a polygon shape physics body to little physics bodies with explosion force
@@ -604,7 +846,7 @@ PHYSACDEF void PhysicsShatter(PhysicsBody body, Vector2 position, float force)
             {
                 int count = vertexData.vertexCount;
                 Vector2 bodyPos = body->position;
-                Vector2 *vertices = (Vector2*)malloc(sizeof(Vector2) * count);
+                Vector2 vertices[PHYSAC_MAX_VERTICES];
                 Mat2 trans = body->shape.transform;
                 for (int i = 0; i < count; i++) vertices[i] = vertexData.positions[i];
 
@@ -619,6 +861,7 @@ PHYSACDEF void PhysicsShatter(PhysicsBody body, Vector2 position, float force)
                     Vector2 offset = Vector2Subtract(center, bodyPos);
 
                     PhysicsBody newBody = CreatePhysicsBodyPolygon(center, 10, 3, 10);     // Create polygon physics body with relevant values
+                    if (newBody == NULL) break;
 
                     PolygonData newData = { 0 };
                     newData.vertexCount = 3;
@@ -696,8 +939,6 @@ PHYSACDEF void PhysicsShatter(PhysicsBody body, Vector2 position, float force)
                     // Apply force to new physics body
                     PhysicsAddForce(newBody, forceDirection);
                 }
-
-                free(vertices);
             }
         }
     }
@@ -792,17 +1033,20 @@ PHYSACDEF Vector2 GetPhysicsShapeVertex(PhysicsBody body, int vertex)
 
     if (body != NULL)
     {
+        // NOTE: Published state is used, so a shape is not drawn half way through a physics step
+        PhysicsBodyState state = GetPhysicsBodyState(body);
+
         switch (body->shape.type)
         {
             case PHYSICS_CIRCLE:
             {
-                position.x = body->position.x + cosf(360.0f/PHYSAC_CIRCLE_VERTICES*vertex*PHYSAC_DEG2RAD)*body->shape.radius;
-                position.y = body->position.y + sinf(360.0f/PHYSAC_CIRCLE_VERTICES*vertex*PHYSAC_DEG2RAD)*body->shape.radius;
+                position.x = state.position.x + cosf(360.0f/PHYSAC_CIRCLE_VERTICES*vertex*PHYSAC_DEG2RAD)*body->shape.radius;
+                position.y = state.position.y + sinf(360.0f/PHYSAC_CIRCLE_VERTICES*vertex*PHYSAC_DEG2RAD)*body->shape.radius;
             } break;
             case PHYSICS_POLYGON:
             {
                 PolygonData vertexData = body->shape.vertexData;
-                position = Vector2Add(body->position, Mat2MultiplyVector2(body->shape.transform, vertexData.positions[vertex]));
+                position = Vector2Add(state.position, Mat2MultiplyVector2(state.transform, vertexData.positions[vertex]));
             } break;
             default: break;
         }
@@ -814,6 +1058,19 @@ PHYSACDEF Vector2 GetPhysicsShapeVertex(PhysicsBody body, int vertex)
     return position;
 }
 
+// Returns physics body position computed by last step (safe to read while physics thread runs)
+PHYSACDEF Vector2 GetPhysicsBodyPosition(PhysicsBody body)
+{
+    Vector2 position = { 0.0f, 0.0f };
+
+    if (body != NULL) position = GetPhysicsBodyState(body).position;
+    #if defined(PHYSAC_DEBUG)
+    else printf("[PHYSAC] error when trying to get a null reference physics body");
+    #endif
+
+    return position;
+}
+
 // Sets physics body shape transform based on radians parameter
 PHYSACDEF void SetPhysicsBodyRotation(PhysicsBody body, float radians)
 {
@@ -822,7 +1079,81 @@ PHYSACDEF void SetPhysicsBodyRotation(PhysicsBody body, float radians)
         body->orient = radians;
 
         if (body->shape.type == PHYSICS_POLYGON) body->shape.transform = Mat2Radians(radians);
+
+        WakePhysicsBody(body);
+        bodiesVersion++;
+    }
+}
+
+// Returns closest physics body hit by a ray
+// NOTE: Queries test bodies as computed by last step, rays starting inside a shape do not hit it
+PHYSACDEF PhysicsRaycastHit PhysicsRaycast(PhysicsRay ray)
+{
+    UpdatePhysicsQueries();
+
+    return RaycastPhysicsQueries(ray);
+}
+
+// Casts multiple rays, hits array must hold count results
+PHYSACDEF void PhysicsRaycastBatch(const PhysicsRay *rays, int count, PhysicsRaycastHit *hits)
+{
+    if ((rays == NULL) || (hits == NULL)) return;
+
+    UpdatePhysicsQueries();
+
+    for (int i = 0; i < count; i++) hits[i] = RaycastPhysicsQueries(rays[i]);
+}
+
+// Finds physics bodies which bounds overlap an area, returns results count
+PHYSACDEF int PhysicsQueryAABB(Vector2 min, Vector2 max, PhysicsBody *results, int maxResults)
+{
+    int count = 0;
+
+    if ((results == NULL) || (maxResults <= 0)) return count;
+
+    UpdatePhysicsQueries();
+
+    for (int i = 0; i < queryEntriesCount; i++)
+    {
+        PhysicsQueryEntry *entry = &queryEntries[i];
+
+        // Entries are sorted by min x, no later entry can overlap the area
+        if (entry->boundsMin.x > max.x) break;
+        if ((entry->boundsMax.x < min.x) || (entry->boundsMax.y < min.y) || (entry->boundsMin.y > max.y)) continue;
+
+        results[count] = entry->body;
+        count++;
+
+        if (count == maxResults) break;
+    }
+
+    return count;
+}
+
+// Finds physics bodies shapes containing a point, returns results count
+PHYSACDEF int PhysicsQueryPoint(Vector2 point, PhysicsBody *results, int maxResults)
+{
+    int count = 0;
+
+    if ((results == NULL) || (maxResults <= 0)) return count;
+
+    UpdatePhysicsQueries();
+
+    for (int i = 0; i < queryEntriesCount; i++)
+    {
+        PhysicsQueryEntry *entry = &queryEntries[i];
+
+        if (entry->boundsMin.x > point.x) break;
+        if ((entry->boundsMax.x < point.x) || (entry->boundsMax.y < point.y) || (entry->boundsMin.y > point.y)) continue;
+        if (!CheckPhysicsEntryPoint(entry, point)) continue;
+
+        results[count] = entry->body;
+        count++;
+
+        if (count == maxResults) break;
     }
+
+    return count;
 }
 
 // Unitializes and destroys a physics body
@@ -833,7 +1164,8 @@ PHYSACDEF void DestroyPhysicsBody(PhysicsBody body)
         int id = body->id;
         int index = -1;
 
-        for (int i = 0; i < physicsBodiesCount; i++)
+        // NOTE: Search from last created body, recently created bodies are usually destroyed first
+        for (int i = physicsBodiesCount - 1; i >= 0; i--)
         {
             if (bodies[i]->id == id)
             {
@@ -850,16 +1182,35 @@ PHYSACDEF void DestroyPhysicsBody(PhysicsBody body)
             return;     // Prevent access to index -1
         }
 
-        // Free body allocated memory
-        PHYSAC_FREE(body);
+        // Wake up sleeping bodies touching destroyed body, they could be resting on it
+        Vector2 boundMin = { 0.0f, 0.0f };
+        Vector2 boundMax = { 0.0f, 0.0f };
+        GetPhysicsBodyBounds(body, &boundMin, &boundMax);
+
+        for (int i = 0; i < physicsBodiesCount; i++)
+        {
+            if (!bodies[i]->isSleeping) continue;
+
+            Vector2 otherMin = { 0.0f, 0.0f };
+            Vector2 otherMax = { 0.0f, 0.0f };
+            GetPhysicsBodyBounds(bodies[i], &otherMin, &otherMax);
+
+            if ((otherMin.x <= boundMax.x + PHYSAC_PENETRATION_ALLOWANCE) && (boundMin.x <= otherMax.x + PHYSAC_PENETRATION_ALLOWANCE) &&
+                (otherMin.y <= boundMax.y + PHYSAC_PENETRATION_ALLOWANCE) && (boundMin.y <= otherMax.y + PHYSAC_PENETRATION_ALLOWANCE)) WakePhysicsBody(bodies[i]);
+        }
+
+        // Return body id to available ids stack
+        freeBodyIds[freeBodyIdsCount] = id;
+        freeBodyIdsCount++;
         usedMemory -= sizeof(PhysicsBodyData);
         bodies[index] = NULL;
 
         // Reorder physics bodies pointers array and its catched index
-        for (int i = index; i < physicsBodiesCount; i++)
-        {
-            if ((i + 1) < physicsBodiesCount) bodies[i] = bodies[i + 1];
-        }
+        memmove(bodies + index, bodies + index + 1, (physicsBodiesCount - index - 1)*sizeof(PhysicsBody));
+
+        // Current manifolds could reference destroyed body, they must not warm start next step contacts
+        physicsManifoldsCount = 0;
+        bodiesVersion++;
 
         // Update physics bodies count
         physicsBodiesCount--;
@@ -876,62 +1227,209 @@ PHYSACDEF void DestroyPhysicsBody(PhysicsBody body)
 // Destroys created physics bodies and manifolds and resets global values
 PHYSACDEF void ResetPhysics(void)
 {
-    // Unitialize physics bodies dynamic memory allocations
+    // Return physics bodies ids to available ids stack
     for (int i = physicsBodiesCount - 1; i >= 0; i--)
     {
-        PhysicsBody body = bodies[i];
-
-        if (body != NULL)
+        if (bodies[i] != NULL)
         {
-            PHYSAC_FREE(body);
+            freeBodyIds[freeBodyIdsCount] = bodies[i]->id;
+            freeBodyIdsCount++;
             bodies[i] = NULL;
             usedMemory -= sizeof(PhysicsBodyData);
         }
     }
 
     physicsBodiesCount = 0;
+    bodiesVersion++;
+
+    // Reset physics manifolds pool
+    physicsManifoldsCount = 0;
+    previousManifoldsCount = 0;
+
+    #if defined(PHYSAC_DEBUG)
+        printf("[PHYSAC] physics module reset successfully\n");
+    #endif
+}
+
+// Returns size in bytes required to save current physics world state
+PHYSACDEF unsigned int GetPhysicsStateSize(void)
+{
+    return sizeof(PhysicsStateHeader) + physicsBodiesCount*(sizeof(PhysicsBodyData) + sizeof(Vector2) + sizeof(unsigned int) + sizeof(int)) +
+           physicsManifoldsCount*(sizeof(PhysicsManifoldData) + 2*sizeof(unsigned int)) + freeBodyIdsCount*sizeof(unsigned int);
+}
+
+// Saves physics world state into a buffer, returns bytes written
+// NOTE: Buffer must hold GetPhysicsStateSize() bytes, state is a flat blob that can be copied around freely.
+// Layout: header, bodies data, manifolds, sleep positions, bodies ids, sweep order, manifolds bodies ids, available ids
+PHYSACDEF unsigned int SavePhysicsState(void *buffer)
+{
+    if (buffer == NULL) return 0;
+
+    unsigned char *data = (unsigned char *)buffer;
+    PhysicsStateHeader header = { 0 };
+    header.accumulator = accumulator;
+    header.deltaTime = deltaTime;
+    header.gravity = gravityForce;
+    header.size = GetPhysicsStateSize();
+    header.stepsCount = stepsCount;
+    header.bodiesCount = physicsBodiesCount;
+    header.bodiesCapacity = bodiesCapacity;
+    header.freeIdsCount = freeBodyIdsCount;
+    header.manifoldsCount = physicsManifoldsCount;
+    header.sweepCount = sweepCount;
+    header.solverIterations = solverIterations;
+
+    memcpy(data, &header, sizeof(PhysicsStateHeader));
+    data += sizeof(PhysicsStateHeader);
 
-    // Unitialize physics manifolds dynamic memory allocations
-    for (int i = physicsManifoldsCount - 1; i >= 0; i--)
+    for (int i = 0; i < physicsBodiesCount; i++)
     {
-        PhysicsManifold manifold = contacts[i];
+        memcpy(data, bodies[i], sizeof(PhysicsBodyData));
+        data += sizeof(PhysicsBodyData);
+    }
 
-        if (manifold != NULL)
-        {
-            PHYSAC_FREE(manifold);
-            contacts[i] = NULL;
-            usedMemory -= sizeof(PhysicsManifoldData);
-        }
+    memcpy(data, contacts, physicsManifoldsCount*sizeof(PhysicsManifoldData));
+    data += physicsManifoldsCount*sizeof(PhysicsManifoldData);
+
+    for (int i = 0; i < physicsBodiesCount; i++)
+    {
+        memcpy(data, &sleepPosition[bodies[i]->id], sizeof(Vector2));
+        data += sizeof(Vector2);
     }
 
-    physicsManifoldsCount = 0;
+    for (int i = 0; i < physicsBodiesCount; i++)
+    {
+        memcpy(data, &bodies[i]->id, sizeof(unsigned int));
+        data += sizeof(unsigned int);
+    }
 
-    #if defined(PHYSAC_DEBUG)
-        printf("[PHYSAC] physics module reset successfully\n");
+    memcpy(data, sweepOrder, physicsBodiesCount*sizeof(int));
+    data += physicsBodiesCount*sizeof(int);
+
+    // Manifolds reference bodies by pointer, ids are saved to remap them on load
+    for (int i = 0; i < physicsManifoldsCount; i++)
+    {
+        memcpy(data, &contacts[i].bodyA->id, sizeof(unsigned int));
+        memcpy(data + sizeof(unsigned int), &contacts[i].bodyB->id, sizeof(unsigned int));
+        data += 2*sizeof(unsigned int);
+    }
+
+    memcpy(data, freeBodyIds, freeBodyIdsCount*sizeof(unsigned int));
+
+    return header.size;
+}
+
+// Restores physics world state saved by SavePhysicsState()
+// NOTE: Must not be called while physics thread is running a step, use PHYSAC_NO_THREADS for rollback
+PHYSACDEF bool LoadPhysicsState(const void *buffer)
+{
+    if (buffer == NULL) return false;
+
+    const unsigned char *data = (const unsigned char *)buffer;
+    PhysicsStateHeader header = { 0 };
+    memcpy(&header, data, sizeof(PhysicsStateHeader));
+    data += sizeof(PhysicsStateHeader);
+
+    // Make room for saved bodies ids and manifolds, storage never shrinks so this is a no-op in the same session
+    while (bodiesCapacity < header.bodiesCapacity)
+    {
+        if (!GrowPhysicsBodies()) return false;
+    }
+
+    if ((header.manifoldsCount > manifoldsCapacity) && !ResizePhysicsManifolds(header.manifoldsCount)) return false;
+
+    accumulator = header.accumulator;
+    deltaTime = header.deltaTime;
+    gravityForce = header.gravity;
+    stepsCount = header.stepsCount;
+    physicsBodiesCount = header.bodiesCount;
+    physicsManifoldsCount = header.manifoldsCount;
+    sweepCount = header.sweepCount;
+    solverIterations = header.solverIterations;
+    usedMemory = physicsBodiesCount*sizeof(PhysicsBodyData);
+    bodiesVersion++;
+
+    const unsigned char *bodiesData = data;
+    const unsigned char *manifoldsData = bodiesData + physicsBodiesCount*sizeof(PhysicsBodyData);
+    const unsigned char *sleepData = manifoldsData + physicsManifoldsCount*sizeof(PhysicsManifoldData);
+    const unsigned char *idsData = sleepData + physicsBodiesCount*sizeof(Vector2);
+    const unsigned char *sweepData = idsData + physicsBodiesCount*sizeof(unsigned int);
+    const unsigned char *pairsData = sweepData + physicsBodiesCount*sizeof(int);
+    const unsigned char *freeIdsData = pairsData + physicsManifoldsCount*2*sizeof(unsigned int);
+
+    for (int i = 0; i < physicsBodiesCount; i++)
+    {
+        unsigned int id = 0;
+        memcpy(&id, idsData + i*sizeof(unsigned int), sizeof(unsigned int));
+
+        PhysicsBody body = GetPhysicsBodyById(id);
+        memcpy(body, bodiesData + i*sizeof(PhysicsBodyData), sizeof(PhysicsBodyData));
+        memcpy(&sleepPosition[id], sleepData + i*sizeof(Vector2), sizeof(Vector2));
+        body->shape.body = body;
+        bodies[i] = body;
+
+    #if !defined(PHYSAC_NO_THREADS)
+        bodiesStates[0][id].published = false;
+        bodiesStates[1][id].published = false;
     #endif
+    }
+
+    memcpy(sweepOrder, sweepData, physicsBodiesCount*sizeof(int));
+    memcpy(contacts, manifoldsData, physicsManifoldsCount*sizeof(PhysicsManifoldData));
+
+    for (int i = 0; i < physicsManifoldsCount; i++)
+    {
+        unsigned int ids[2] = { 0 };
+        memcpy(ids, pairsData + i*2*sizeof(unsigned int), 2*sizeof(unsigned int));
+        contacts[i].bodyA = GetPhysicsBodyById(ids[0]);
+        contacts[i].bodyB = GetPhysicsBodyById(ids[1]);
+    }
+
+    // Ids added to storage after state was saved go to the bottom of the stack, in the order storage growth would push them
+    freeBodyIdsCount = 0;
+
+    for (unsigned int id = bodiesCapacity; id > header.bodiesCapacity; id--)
+    {
+        freeBodyIds[freeBodyIdsCount] = id - 1;
+        freeBodyIdsCount++;
+    }
+
+    memcpy(freeBodyIds + freeBodyIdsCount, freeIdsData, header.freeIdsCount*sizeof(unsigned int));
+    freeBodyIdsCount += header.freeIdsCount;
+
+    return true;
 }
 
 // Unitializes physics pointers and exits physics loop thread
 PHYSACDEF void ClosePhysics(void)
 {
-    // Exit physics loop thread
-    physicsThreadEnabled = false;
-
     #if !defined(PHYSAC_NO_THREADS)
-        pthread_join(physicsThreadId, NULL);
+        // Exit physics loop thread
+        if (physicsThreadEnabled)
+        {
+            physicsThreadEnabled = false;
+            pthread_join(physicsThreadId, NULL);
+        }
+
+        #if defined(PHYSAC_SHARED_WORKERS)
+            workersCount = 0;
+        #else
+            ClosePhysicsWorkers();
+        #endif
     #endif
 
-    // Unitialize physics manifolds dynamic memory allocations
-    for (int i = physicsManifoldsCount - 1; i >= 0; i--) DestroyPhysicsManifold(contacts[i]);
+    // Reset physics manifolds
+    physicsManifoldsCount = 0;
 
-    // Unitialize physics bodies dynamic memory allocations
+    // Destroy physics bodies, last created first to avoid reordering pointers array
     for (int i = physicsBodiesCount - 1; i >= 0; i--) DestroyPhysicsBody(bodies[i]);
 
     #if defined(PHYSAC_DEBUG)
         if (physicsBodiesCount > 0 || usedMemory != 0) printf("[PHYSAC] physics module closed with %i still allocated bodies [MEMORY: %i bytes]\n", physicsBodiesCount, usedMemory);
-        else if (physicsManifoldsCount > 0 || usedMemory != 0) printf("[PHYSAC] physics module closed with %i still allocated manifolds [MEMORY: %i bytes]\n", physicsManifoldsCount, usedMemory);
         else printf("[PHYSAC] physics module closed successfully\n");
     #endif
+
+    UnloadPhysicsStorage();
 }
 
 //----------------------------------------------------------------------------------
@@ -941,29 +1439,201 @@ PHYSACDEF void ClosePhysics(void)
 static int FindAvailableBodyIndex()
 {
     int index = -1;
-    for (int i = 0; i < PHYSAC_MAX_BODIES; i++)
+
+    // Get a new storage block if all ids are in use
+    if ((freeBodyIdsCount == 0) && !GrowPhysicsBodies()) return index;
+
+    freeBodyIdsCount--;
+    index = freeBodyIds[freeBodyIdsCount];
+    bodiesVersion++;
+
+#if !defined(PHYSAC_NO_THREADS)
+    // Id could have been used by a destroyed body, its published states are not valid anymore
+    bodiesStates[0][index].published = false;
+    bodiesStates[1][index].published = false;
+#endif
+
+    return index;
+}
+
+// Adds a new data block to physics bodies storage
+// NOTE: Existing blocks are never moved, so physics bodies references remain valid
+static bool GrowPhysicsBodies(void)
+{
+    unsigned int newCapacity = bodiesCapacity + bodiesBlockSize;
+
+    PhysicsBodyData **newBlocks = (PhysicsBodyData **)PHYSAC_REALLOC(bodiesBlocks, (bodiesBlocksCount + 1)*sizeof(PhysicsBodyData *));
+    if (newBlocks == NULL) return false;
+    bodiesBlocks = newBlocks;
+
+    PhysicsBodyData *newBlock = (PhysicsBodyData *)PHYSAC_MALLOC(bodiesBlockSize*sizeof(PhysicsBodyData));
+    if (newBlock == NULL) return false;
+
+    // Per-body arrays grow to new capacity, pointers are only updated on success
+    PhysicsBody *newBodies = (PhysicsBody *)PHYSAC_REALLOC(bodies, newCapacity*sizeof(PhysicsBody));
+    if (newBodies != NULL) bodies = newBodies;
+    unsigned int *newFreeIds = (unsigned int *)PHYSAC_REALLOC(freeBodyIds, newCapacity*sizeof(unsigned int));
+    if (newFreeIds != NULL) freeBodyIds = newFreeIds;
+    Vector2 *newBoundsMin = (Vector2 *)PHYSAC_REALLOC(boundsMin, newCapacity*sizeof(Vector2));
+    if (newBoundsMin != NULL) boundsMin = newBoundsMin;
+    Vector2 *newBoundsMax = (Vector2 *)PHYSAC_REALLOC(boundsMax, newCapacity*sizeof(Vector2));
+    if (newBoundsMax != NULL) boundsMax = newBoundsMax;
+    int *newSweepOrder = (int *)PHYSAC_REALLOC(sweepOrder, newCapacity*sizeof(int));
+    if (newSweepOrder != NULL) sweepOrder = newSweepOrder;
+    unsigned int *newIslandParent = (unsigned int *)PHYSAC_REALLOC(islandParent, newCapacity*sizeof(unsigned int));
+    if (newIslandParent != NULL) islandParent = newIslandParent;
+    float *newIslandSleepTime = (float *)PHYSAC_REALLOC(islandSleepTime, newCapacity*sizeof(float));
+    if (newIslandSleepTime != NULL) islandSleepTime = newIslandSleepTime;
+    Vector2 *newSleepPosition = (Vector2 *)PHYSAC_REALLOC(sleepPosition, newCapacity*sizeof(Vector2));
+    if (newSleepPosition != NULL) sleepPosition = newSleepPosition;
+    unsigned int *newIslandOffset = (unsigned int *)PHYSAC_REALLOC(islandOffset, newCapacity*sizeof(unsigned int));
+    if (newIslandOffset != NULL) islandOffset = newIslandOffset;
+    PhysicsQueryEntry *newQueryEntries = (PhysicsQueryEntry *)PHYSAC_REALLOC(queryEntries, newCapacity*sizeof(PhysicsQueryEntry));
+    if (newQueryEntries != NULL) queryEntries = newQueryEntries;
+    bool statesGrown = true;
+#if !defined(PHYSAC_NO_THREADS)
+    for (int i = 0; i < 2; i++)
     {
-        int currentId = i;
+        PhysicsBodyState *newStates = (PhysicsBodyState *)PHYSAC_REALLOC(bodiesStates[i], newCapacity*sizeof(PhysicsBodyState));
+        if (newStates != NULL) bodiesStates[i] = newStates;
+        else statesGrown = false;
+    }
+#endif
 
-        // Check if current id already exist in other physics body
-        for (int k = 0; k < physicsBodiesCount; k++)
-        {
-            if (bodies[k]->id == currentId)
-            {
-                currentId++;
-                break;
-            }
-        }
+    if ((newBodies == NULL) || (newFreeIds == NULL) || (newBoundsMin == NULL) || (newBoundsMax == NULL) || (newSweepOrder == NULL) ||
+        (newIslandParent == NULL) || (newIslandSleepTime == NULL) || (newSleepPosition == NULL) || (newIslandOffset == NULL) || (newQueryEntries == NULL) || !statesGrown)
+    {
+    #if defined(PHYSAC_DEBUG)
+        printf("[PHYSAC] physics bodies storage could not grow to %i bodies\n", newCapacity);
+    #endif
+        PHYSAC_FREE(newBlock);
+        return false;
+    }
 
-        // If it is not used, use it as new physics body id
-        if (currentId == i)
-        {
-            index = i;
-            break;
-        }
+    bodiesBlocks[bodiesBlocksCount] = newBlock;
+    bodiesBlocksCount++;
+
+    // Push new ids in reverse order, so lower ids are used first
+    for (unsigned int id = newCapacity; id > bodiesCapacity; id--)
+    {
+        freeBodyIds[freeBodyIdsCount] = id - 1;
+        freeBodyIdsCount++;
     }
 
-    return index;
+    bodiesCapacity = newCapacity;
+
+    #if defined(PHYSAC_DEBUG)
+        printf("[PHYSAC] physics bodies storage capacity set to %i bodies\n", bodiesCapacity);
+    #endif
+
+    return true;
+}
+
+// Sets physics manifolds storage capacity
+static bool ResizePhysicsManifolds(unsigned int capacity)
+{
+    PhysicsManifoldData *newContacts = (PhysicsManifoldData *)PHYSAC_REALLOC(contacts, capacity*sizeof(PhysicsManifoldData));
+    if (newContacts != NULL) contacts = newContacts;
+    PhysicsManifoldData *newPreviousContacts = (PhysicsManifoldData *)PHYSAC_REALLOC(previousContacts, capacity*sizeof(PhysicsManifoldData));
+    if (newPreviousContacts != NULL) previousContacts = newPreviousContacts;
+    unsigned int *newManifoldIsland = (unsigned int *)PHYSAC_REALLOC(manifoldIsland, capacity*sizeof(unsigned int));
+    if (newManifoldIsland != NULL) manifoldIsland = newManifoldIsland;
+    unsigned int *newIslandManifolds = (unsigned int *)PHYSAC_REALLOC(islandManifolds, capacity*sizeof(unsigned int));
+    if (newIslandManifolds != NULL) islandManifolds = newIslandManifolds;
+
+    if ((newContacts == NULL) || (newPreviousContacts == NULL) || (newManifoldIsland == NULL) || (newIslandManifolds == NULL))
+    {
+    #if defined(PHYSAC_DEBUG)
+        printf("[PHYSAC] physics manifolds storage could not grow to %i manifolds\n", capacity);
+    #endif
+        return false;
+    }
+
+    manifoldsCapacity = capacity;
+
+    #if defined(PHYSAC_DEBUG)
+        printf("[PHYSAC] physics manifolds storage capacity set to %i manifolds\n", manifoldsCapacity);
+    #endif
+
+    return true;
+}
+
+// Doubles physics candidate pairs storage capacity
+static bool GrowPhysicsPairs(void)
+{
+    unsigned int newCapacity = ((pairsCapacity > 0) ? pairsCapacity*2 : PHYSAC_MAX_MANIFOLDS);
+
+    PhysicsPair *newPairs = (PhysicsPair *)PHYSAC_REALLOC(pairs, newCapacity*sizeof(PhysicsPair));
+    if (newPairs == NULL) return false;
+
+    pairs = newPairs;
+    pairsCapacity = newCapacity;
+
+    return true;
+}
+
+// Frees physics bodies and manifolds storage
+static void UnloadPhysicsStorage(void)
+{
+    for (unsigned int i = 0; i < bodiesBlocksCount; i++) PHYSAC_FREE(bodiesBlocks[i]);
+
+    PHYSAC_FREE(bodiesBlocks);
+    PHYSAC_FREE(bodies);
+    PHYSAC_FREE(freeBodyIds);
+    PHYSAC_FREE(boundsMin);
+    PHYSAC_FREE(boundsMax);
+    PHYSAC_FREE(sweepOrder);
+    PHYSAC_FREE(islandParent);
+    PHYSAC_FREE(islandSleepTime);
+    PHYSAC_FREE(sleepPosition);
+    PHYSAC_FREE(islandOffset);
+    PHYSAC_FREE(queryEntries);
+    PHYSAC_FREE(contacts);
+    PHYSAC_FREE(previousContacts);
+    PHYSAC_FREE(previousTable);
+    PHYSAC_FREE(manifoldIsland);
+    PHYSAC_FREE(islandManifolds);
+    PHYSAC_FREE(pairs);
+#if !defined(PHYSAC_NO_THREADS)
+    PHYSAC_FREE(bodiesStates[0]);
+    PHYSAC_FREE(bodiesStates[1]);
+    bodiesStates[0] = NULL;
+    bodiesStates[1] = NULL;
+#endif
+
+    bodiesBlocks = NULL;
+    bodiesBlocksCount = 0;
+    bodiesCapacity = 0;
+    bodies = NULL;
+    freeBodyIds = NULL;
+    freeBodyIdsCount = 0;
+    boundsMin = NULL;
+    boundsMax = NULL;
+    sweepOrder = NULL;
+    sweepCount = 0;
+    islandParent = NULL;
+    islandSleepTime = NULL;
+    sleepPosition = NULL;
+    islandOffset = NULL;
+    queryEntries = NULL;
+    queryEntriesCount = 0;
+    queryBodiesVersion = 0;
+    contacts = NULL;
+    previousContacts = NULL;
+    previousManifoldsCount = 0;
+    previousTable = NULL;
+    previousTableSize = 0;
+    manifoldIsland = NULL;
+    islandManifolds = NULL;
+    manifoldsCapacity = 0;
+    pairs = NULL;
+    pairsCapacity = 0;
+}
+
+// Returns physics body data of a body id
+static PhysicsBody GetPhysicsBodyById(unsigned int id)
+{
+    return &bodiesBlocks[id/bodiesBlockSize][id%bodiesBlockSize];
 }
 
 // Creates a random polygon shape with max vertex distance from polygon pivot
@@ -1024,124 +1694,778 @@ static void *PhysicsLoop(void *arg)
         printf("[PHYSAC] physics thread created successfully\n");
     #endif
 
-    // Initialize physics loop thread values
-    physicsThreadEnabled = true;
-
     // Physics update loop
     while (physicsThreadEnabled)
     {
         RunPhysicsStep();
+
+        // Sleep until next fixed step is due, instead of spinning a full core
+        double wait = deltaTime - accumulator - (GetCurrentTime() - startTime);
+        if (wait > 0.0) WaitPhysicsTime(wait);
     }
 
     return NULL;
 }
 
-// Physics steps calculations (dynamics, collisions and position corrections)
-static void PhysicsStep(void)
+// Sleeps physics thread for some milliseconds
+static void WaitPhysicsTime(double ms)
 {
-    // Update current steps count
-    stepsCount++;
+#if defined(_WIN32)
+    // NOTE: Sleep() resolution is 1 ms, remaining time is caught up by next step accumulator
+    Sleep((unsigned long)ms);
+#else
+    struct timespec req = { 0 };
+    req.tv_sec = (time_t)(ms/1000.0);
+    req.tv_nsec = (long)((ms - req.tv_sec*1000.0)*1000000.0);
 
-    // Clear previous generated collisions information
-    for (int i = physicsManifoldsCount - 1; i >= 0; i--)
-    {
-        PhysicsManifold manifold = contacts[i];
-        if (manifold != NULL) DestroyPhysicsManifold(manifold);
-    }
+    nanosleep(&req, NULL);
+#endif
+}
+
+// Publishes physics bodies state computed by last steps to user thread
+// NOTE: States are written to back buffer while user thread reads front buffer, then buffers are swapped
+static void PublishPhysicsBodies(void)
+{
+#if !defined(PHYSAC_NO_THREADS)
+    PhysicsBodyState *back = bodiesStates[1 - statesFront];
 
-    // Reset physics bodies grounded state
     for (int i = 0; i < physicsBodiesCount; i++)
     {
         PhysicsBody body = bodies[i];
-        body->isGrounded = false;
+        back[body->id].published = true;
+        back[body->id].position = body->position;
+        back[body->id].transform = body->shape.transform;
     }
 
-    // Generate new collision information
-    for (int i = 0; i < physicsBodiesCount; i++)
-    {
-        PhysicsBody bodyA = bodies[i];
+    pthread_mutex_lock(&statesMutex);
+    statesFront = 1 - statesFront;
+    publishedStepsCount = stepsCount;
+    pthread_mutex_unlock(&statesMutex);
+#endif
+}
 
-        if (bodyA != NULL)
-        {
-            for (int j = i + 1; j < physicsBodiesCount; j++)
-            {
-                PhysicsBody bodyB = bodies[j];
+// Returns physics body published state
+// NOTE: Without physics thread, state is read directly from physics body
+static PhysicsBodyState GetPhysicsBodyState(PhysicsBody body)
+{
+    PhysicsBodyState state = { 0 };
 
-                if (bodyB != NULL)
-                {
-                    if ((bodyA->inverseMass == 0) && (bodyB->inverseMass == 0)) continue;
+#if !defined(PHYSAC_NO_THREADS)
+    pthread_mutex_lock(&statesMutex);
+    state = bodiesStates[statesFront][body->id];
+    pthread_mutex_unlock(&statesMutex);
 
-                    PhysicsManifold manifold = CreatePhysicsManifold(bodyA, bodyB);
-                    SolvePhysicsManifold(manifold);
+    if (state.published) return state;
+#endif
 
-                    if (manifold->contactsCount > 0)
-                    {
-                        // Create a new manifold with same information as previously solved manifold and add it to the manifolds pool last slot
-                        PhysicsManifold newManifold = CreatePhysicsManifold(bodyA, bodyB);
-                        newManifold->penetration = manifold->penetration;
-                        newManifold->normal = manifold->normal;
-                        newManifold->contacts[0] = manifold->contacts[0];
-                        newManifold->contacts[1] = manifold->contacts[1];
-                        newManifold->contactsCount = manifold->contactsCount;
-                        newManifold->restitution = manifold->restitution;
-                        newManifold->dynamicFriction = manifold->dynamicFriction;
-                        newManifold->staticFriction = manifold->staticFriction;
-                    }
-                }
+    // Body was created after last published step
+    state.position = body->position;
+    state.transform = body->shape.transform;
+
+    return state;
+}
+
+// Builds physics query entries from bodies state of last step
+// NOTE: Entries are only rebuilt after a new step or when bodies changed, batched queries share them
+static void UpdatePhysicsQueries(void)
+{
+    unsigned int steps = stepsCount;
+
+#if !defined(PHYSAC_NO_THREADS)
+    pthread_mutex_lock(&statesMutex);
+    steps = publishedStepsCount;
+    pthread_mutex_unlock(&statesMutex);
+#endif
+
+    if ((steps == queryStepsCount) && (bodiesVersion == queryBodiesVersion)) return;
+
+    for (int i = 0; i < physicsBodiesCount; i++)
+    {
+        PhysicsQueryEntry *entry = &queryEntries[i];
+        entry->body = bodies[i];
+        entry->state = GetPhysicsBodyState(bodies[i]);
+        GetPhysicsStateBounds(bodies[i], entry->state, &entry->boundsMin, &entry->boundsMax);
+    }
+
+    queryEntriesCount = physicsBodiesCount;
+    qsort(queryEntries, queryEntriesCount, sizeof(PhysicsQueryEntry), ComparePhysicsQueryEntries);
+
+    queryStepsCount = steps;
+    queryBodiesVersion = bodiesVersion;
+}
+
+// Compares physics query entries bounds min x (qsort)
+static int ComparePhysicsQueryEntries(const void *a, const void *b)
+{
+    float minA = ((const PhysicsQueryEntry *)a)->boundsMin.x;
+    float minB = ((const PhysicsQueryEntry *)b)->boundsMin.x;
+
+    return ((minA > minB) - (minA < minB));
+}
+
+// Returns closest physics query entry hit by a ray
+static PhysicsRaycastHit RaycastPhysicsQueries(PhysicsRay ray)
+{
+    PhysicsRaycastHit result = { 0 };
+
+    Vector2 direction = ray.direction;
+    MathNormalize(&direction);
+
+    if ((ray.length <= 0.0f) || ((direction.x == 0.0f) && (direction.y == 0.0f))) return result;
+
+    float length = ray.length;
+    Vector2 end = { ray.origin.x + direction.x*length, ray.origin.y + direction.y*length };
+    Vector2 rayMin = { min(ray.origin.x, end.x), min(ray.origin.y, end.y) };
+    Vector2 rayMax = { max(ray.origin.x, end.x), max(ray.origin.y, end.y) };
+
+    for (int i = 0; i < queryEntriesCount; i++)
+    {
+        PhysicsQueryEntry *entry = &queryEntries[i];
+
+        // Entries are sorted by min x, no later entry can overlap ray bounds
+        if (entry->boundsMin.x > rayMax.x) break;
+        if ((entry->boundsMax.x < rayMin.x) || (entry->boundsMax.y < rayMin.y) || (entry->boundsMin.y > rayMax.y)) continue;
+
+        PhysicsRaycastHit hit = { 0 };
+
+        if (RaycastPhysicsEntry(entry, ray.origin, direction, length, &hit))
+        {
+            result = hit;
+
+            // Shorten ray to closest hit, farther entries are skipped
+            length = hit.distance;
+            end = hit.point;
+            rayMin = (Vector2){ min(ray.origin.x, end.x), min(ray.origin.y, end.y) };
+            rayMax = (Vector2){ max(ray.origin.x, end.x), max(ray.origin.y, end.y) };
+        }
+    }
+
+    return result;
+}
+
+// Checks ray against a physics query entry shape
+static bool RaycastPhysicsEntry(PhysicsQueryEntry *entry, Vector2 origin, Vector2 direction, float length, PhysicsRaycastHit *hit)
+{
+    PhysicsShape *shape = &entry->body->shape;
+    float distance = 0.0f;
+    Vector2 normal = { 0.0f, 0.0f };
+
+    if (shape->type == PHYSICS_CIRCLE)
+    {
+        Vector2 offset = Vector2Subtract(origin, entry->state.position);
+        float b = MathDot(offset, direction);
+        float c = MathLenSqr(offset) - shape->radius*shape->radius;
+
+        // Ray starts outside circle and points away from it
+        if ((c > 0.0f) && (b > 0.0f)) return false;
+
+        float discriminant = b*b - c;
+        if (discriminant < 0.0f) return false;
+
+        distance = -b - sqrtf(discriminant);
+        if ((distance < 0.0f) || (distance > length)) return false;
+
+        normal = (Vector2){ offset.x + direction.x*distance, offset.y + direction.y*distance };
+        MathNormalize(&normal);
+    }
+    else
+    {
+        // Clip ray against every polygon face in body local space
+        Mat2 transpose = Mat2Transpose(entry->state.transform);
+        Vector2 localOrigin = Mat2MultiplyVector2(transpose, Vector2Subtract(origin, entry->state.position));
+        Vector2 localDirection = Mat2MultiplyVector2(transpose, direction);
+        PolygonData *data = &shape->vertexData;
+
+        float lower = 0.0f;
+        float upper = length;
+        int face = -1;
+
+        for (int i = 0; i < data->vertexCount; i++)
+        {
+            float numerator = MathDot(data->normals[i], Vector2Subtract(data->positions[i], localOrigin));
+            float denominator = MathDot(data->normals[i], localDirection);
+
+            if (denominator == 0.0f)
+            {
+                if (numerator < 0.0f) return false;
+            }
+            else if ((denominator < 0.0f) && (numerator < lower*denominator))
+            {
+                lower = numerator/denominator;
+                face = i;
             }
+            else if ((denominator > 0.0f) && (numerator < upper*denominator)) upper = numerator/denominator;
+
+            if (upper < lower) return false;
         }
+
+        // No entering face means ray starts inside polygon
+        if (face < 0) return false;
+
+        distance = lower;
+        normal = Mat2MultiplyVector2(entry->state.transform, data->normals[face]);
     }
 
-    // Integrate forces to physics bodies
+    hit->body = entry->body;
+    hit->point = (Vector2){ origin.x + direction.x*distance, origin.y + direction.y*distance };
+    hit->normal = normal;
+    hit->distance = distance;
+
+    return true;
+}
+
+// Checks if a point is inside a physics query entry shape
+static bool CheckPhysicsEntryPoint(PhysicsQueryEntry *entry, Vector2 point)
+{
+    PhysicsShape *shape = &entry->body->shape;
+
+    if (shape->type == PHYSICS_CIRCLE) return (DistSqr(point, entry->state.position) <= shape->radius*shape->radius);
+
+    // Point is inside polygon if it is behind every face
+    Vector2 localPoint = Mat2MultiplyVector2(Mat2Transpose(entry->state.transform), Vector2Subtract(point, entry->state.position));
+
+    for (int i = 0; i < shape->vertexData.vertexCount; i++)
+    {
+        if (MathDot(shape->vertexData.normals[i], Vector2Subtract(localPoint, shape->vertexData.positions[i])) > 0.0f) return false;
+    }
+
+    return true;
+}
+
+// Physics steps calculations (dynamics, collisions and position corrections)
+static void PhysicsStep(void)
+{
+    // Update current steps count
+    stepsCount++;
+
+    // Clear previous generated collisions information, keeping it to warm start matching contacts
+    StorePreviousManifolds();
+    physicsManifoldsCount = 0;
+
+    // Reset physics bodies grounded state
+    // NOTE: Sleeping bodies keep their state, they are not tested against other resting bodies
     for (int i = 0; i < physicsBodiesCount; i++)
     {
         PhysicsBody body = bodies[i];
-        if (body != NULL) IntegratePhysicsForces(body);
+
+        // Wake up sleeping bodies which position or velocity was set by user
+        if (body->isSleeping && ((body->velocity.x != 0.0f) || (body->velocity.y != 0.0f) || (body->angularVelocity != 0.0f) ||
+            (body->position.x != sleepPosition[body->id].x) || (body->position.y != sleepPosition[body->id].y))) WakePhysicsBody(body);
+
+        if (!body->isSleeping) body->isGrounded = false;
     }
 
-    // Initialize physics manifolds to solve collisions
-    for (int i = 0; i < physicsManifoldsCount; i++)
+    // Generate new collision information
+    // NOTE: Sweep and prune broadphase, only bodies with overlapping bounds reach narrowphase
+    UpdatePhysicsBounds();
+    physicsPairsCount = 0;
+
+    for (int i = 0; i < physicsBodiesCount; i++)
     {
-        PhysicsManifold manifold = contacts[i];
-        if (manifold != NULL) InitializePhysicsManifolds(manifold);
+        int indexA = sweepOrder[i];
+
+        for (int j = i + 1; j < physicsBodiesCount; j++)
+        {
+            int indexB = sweepOrder[j];
+
+            // Bodies are sorted by min x, no later body can overlap current one
+            if (boundsMin[indexB].x > boundsMax[indexA].x) break;
+            if ((boundsMin[indexB].y > boundsMax[indexA].y) || (boundsMin[indexA].y > boundsMax[indexB].y)) continue;
+
+            // Keep bodies creation order inside the pair, manifold normal direction depends on it
+            if (indexA < indexB) AddPhysicsPair(bodies[indexA], bodies[indexB]);
+            else AddPhysicsPair(bodies[indexB], bodies[indexA]);
+        }
     }
 
+    // Solve candidate pairs in parallel, contacts are stored in pairs order to keep steps deterministic
+    RunPhysicsTask(SolvePhysicsPairsTask, physicsPairsCount);
+    StorePhysicsPairs();
+
+    // Islands do not share any dynamic body, so they are solved in parallel with same result as in sequence
+    BuildPhysicsIslands();
+
+    // Integrate forces to physics bodies
+    RunPhysicsTask(IntegratePhysicsForcesTask, physicsBodiesCount);
+
+    // Initialize physics manifolds to solve collisions
+    RunPhysicsTask(InitializePhysicsManifoldsTask, physicsManifoldsCount);
+
     // Integrate physics collisions impulses to solve collisions
-    for (int i = 0; i < PHYSAC_COLLISION_ITERATIONS; i++)
+    RunPhysicsTask(IntegratePhysicsImpulsesTask, physicsManifoldsCount);
+
+    // Integrate velocity to physics bodies
+    RunPhysicsTask(IntegratePhysicsVelocityTask, physicsBodiesCount);
+
+    // Correct physics bodies positions based on manifolds collision information
+    RunPhysicsTask(CorrectPhysicsPositionsTask, physicsManifoldsCount);
+
+    // Clear physics bodies forces
+    for (int i = 0; i < physicsBodiesCount; i++)
+    {
+        PhysicsBody body = bodies[i];
+        if (body != NULL)
+        {
+            body->force = PHYSAC_VECTOR_ZERO;
+            body->torque = 0.0f;
+        }
+    }
+
+    // Put to sleep islands of bodies which have been resting enough time
+    UpdatePhysicsSleeping();
+}
+
+// Updates physics bodies bounding boxes and sorts them along x axis (broadphase)
+static void UpdatePhysicsBounds(void)
+{
+    for (int i = 0; i < physicsBodiesCount; i++) GetPhysicsBodyBounds(bodies[i], &boundsMin[i], &boundsMax[i]);
+
+    // Reset sweep order when bodies were created or destroyed, otherwise reuse previous step order
+    if (sweepCount != physicsBodiesCount)
+    {
+        for (int i = 0; i < physicsBodiesCount; i++) sweepOrder[i] = i;
+        sweepCount = physicsBodiesCount;
+    }
+
+    // Insertion sort by bounds min x, bodies move little between steps so order is almost sorted already
+    for (int i = 1; i < physicsBodiesCount; i++)
     {
-        for (int j = 0; j < physicsManifoldsCount; j++)
+        int index = sweepOrder[i];
+        int j = i - 1;
+
+        while ((j >= 0) && (boundsMin[sweepOrder[j]].x > boundsMin[index].x))
         {
-            PhysicsManifold manifold = contacts[i];
-            if (manifold != NULL) IntegratePhysicsImpulses(manifold);
+            sweepOrder[j + 1] = sweepOrder[j];
+            j--;
         }
+
+        sweepOrder[j + 1] = index;
     }
+}
 
-    // Integrate velocity to physics bodies
+// Computes physics body axis aligned bounding box
+static void GetPhysicsBodyBounds(PhysicsBody body, Vector2 *boundMin, Vector2 *boundMax)
+{
+    PhysicsBodyState state = { true, body->position, body->shape.transform };
+    GetPhysicsStateBounds(body, state, boundMin, boundMax);
+}
+
+// Computes physics body axis aligned bounding box at a given state
+static void GetPhysicsStateBounds(PhysicsBody body, PhysicsBodyState state, Vector2 *boundMin, Vector2 *boundMax)
+{
+    if (body->shape.type == PHYSICS_CIRCLE)
+    {
+        *boundMin = (Vector2){ state.position.x - body->shape.radius, state.position.y - body->shape.radius };
+        *boundMax = (Vector2){ state.position.x + body->shape.radius, state.position.y + body->shape.radius };
+    }
+    else
+    {
+        *boundMin = (Vector2){ PHYSAC_FLT_MAX, PHYSAC_FLT_MAX };
+        *boundMax = (Vector2){ -PHYSAC_FLT_MAX, -PHYSAC_FLT_MAX };
+
+        for (int k = 0; k < body->shape.vertexData.vertexCount; k++)
+        {
+            Vector2 vertex = Vector2Add(state.position, Mat2MultiplyVector2(state.transform, body->shape.vertexData.positions[k]));
+
+            boundMin->x = min(boundMin->x, vertex.x);
+            boundMin->y = min(boundMin->y, vertex.y);
+            boundMax->x = max(boundMax->x, vertex.x);
+            boundMax->y = max(boundMax->y, vertex.y);
+        }
+    }
+}
+
+// Adds two physics bodies with overlapping bounds to narrowphase candidate pairs
+static void AddPhysicsPair(PhysicsBody a, PhysicsBody b)
+{
+    if ((a == NULL) || (b == NULL)) return;
+    if ((a->inverseMass == 0) && (b->inverseMass == 0)) return;
+
+    // Sleeping bodies are only tested against awake moving bodies
+    bool movingA = (!a->isSleeping && a->enabled && (a->inverseMass != 0));
+    bool movingB = (!b->isSleeping && b->enabled && (b->inverseMass != 0));
+    if ((a->isSleeping && !movingB) || (b->isSleeping && !movingA)) return;
+
+    if ((physicsPairsCount >= pairsCapacity) && !GrowPhysicsPairs())
+    {
+    #if defined(PHYSAC_DEBUG)
+        printf("[PHYSAC] physics candidate pairs storage could not grow\n");
+    #endif
+        return;
+    }
+
+    pairs[physicsPairsCount].bodyA = a;
+    pairs[physicsPairsCount].bodyB = b;
+    physicsPairsCount++;
+}
+
+// Stores candidate pairs in contact as manifolds and updates bodies state
+// NOTE: Narrowphase does not modify bodies, so it can run in parallel; bodies state is updated here in pairs order
+static void StorePhysicsPairs(void)
+{
+    for (int i = 0; i < physicsPairsCount; i++)
+    {
+        PhysicsBody a = pairs[i].bodyA;
+        PhysicsBody b = pairs[i].bodyB;
+        PhysicsManifold manifold = &pairs[i].manifold;
+
+        // Update physics body grounded state if normal direction is down and grounded state is not set yet in previous manifolds
+        // NOTE: Solvers could swap manifold bodies, circles contacts also update first body state
+        if ((a->shape.type == PHYSICS_CIRCLE) && (b->shape.type == PHYSICS_CIRCLE) && (manifold->contactsCount > 0) && !a->isGrounded) a->isGrounded = (manifold->normal.y < 0);
+        if (!manifold->bodyB->isGrounded) manifold->bodyB->isGrounded = (manifold->normal.y < 0);
+
+        if (manifold->contactsCount > 0)
+        {
+            // Moving body hit a sleeping one, wake it up to respond to contact
+            WakePhysicsBody(a);
+            WakePhysicsBody(b);
+
+            PhysicsManifold newManifold = CreatePhysicsManifold(a, b);
+            if (newManifold == NULL) return;
+
+            newManifold->penetration = manifold->penetration;
+            newManifold->normal = manifold->normal;
+            newManifold->contacts[0] = manifold->contacts[0];
+            newManifold->contacts[1] = manifold->contacts[1];
+            newManifold->contactsCount = manifold->contactsCount;
+            newManifold->restitution = manifold->restitution;
+            newManifold->dynamicFriction = manifold->dynamicFriction;
+            newManifold->staticFriction = manifold->staticFriction;
+        }
+    }
+}
+
+// Groups bodies in contact into islands and sorts manifolds by island
+// NOTE: Static and disabled bodies do not link islands, a crate pile resting on the ground is independent of other piles
+static void BuildPhysicsIslands(void)
+{
+    // Every body starts in its own island
     for (int i = 0; i < physicsBodiesCount; i++)
     {
-        PhysicsBody body = bodies[i];
-        if (body != NULL) IntegratePhysicsVelocity(body);
+        islandParent[bodies[i]->id] = bodies[i]->id;
+        islandOffset[bodies[i]->id] = 0;
     }
 
-    // Correct physics bodies positions based on manifolds collision information
+    // Merge islands of dynamic bodies in contact
     for (int i = 0; i < physicsManifoldsCount; i++)
     {
-        PhysicsManifold manifold = contacts[i];
-        if (manifold != NULL) CorrectPhysicsPositions(manifold);
+        PhysicsBody bodyA = contacts[i].bodyA;
+        PhysicsBody bodyB = contacts[i].bodyB;
+
+        if (!bodyA->enabled || (bodyA->inverseMass == 0.0f) || !bodyB->enabled || (bodyB->inverseMass == 0.0f)) continue;
+
+        unsigned int rootA = FindIslandRoot(bodyA->id);
+        unsigned int rootB = FindIslandRoot(bodyB->id);
+        if (rootA != rootB) islandParent[rootB] = rootA;
     }
 
-    // Clear physics bodies forces
+    // Count manifolds of every island, a manifold belongs to the island of its dynamic bodies
+    for (int i = 0; i < physicsManifoldsCount; i++)
+    {
+        PhysicsBody body = contacts[i].bodyA;
+        if (!body->enabled || (body->inverseMass == 0.0f)) body = contacts[i].bodyB;
+
+        manifoldIsland[i] = FindIslandRoot(body->id);
+        islandOffset[manifoldIsland[i]]++;
+    }
+
+    // Sort manifolds by island, islands follow bodies creation order and manifolds keep their order inside islands
+    unsigned int offset = 0;
+
+    for (int i = 0; i < physicsBodiesCount; i++)
+    {
+        unsigned int count = islandOffset[bodies[i]->id];
+        islandOffset[bodies[i]->id] = offset;
+        offset += count;
+    }
+
+    for (int i = 0; i < physicsManifoldsCount; i++)
+    {
+        islandManifolds[islandOffset[manifoldIsland[i]]] = i;
+        islandOffset[manifoldIsland[i]]++;
+    }
+}
+
+// Puts to sleep islands which bodies have been resting enough time
+// NOTE: Islands are the ones built by BuildPhysicsIslands() in current step
+static void UpdatePhysicsSleeping(void)
+{
+    // Update resting time of awake dynamic bodies
     for (int i = 0; i < physicsBodiesCount; i++)
     {
         PhysicsBody body = bodies[i];
-        if (body != NULL)
+        islandSleepTime[body->id] = PHYSAC_FLT_MAX;
+
+        if (body->isSleeping || !body->enabled || (body->inverseMass == 0.0f)) continue;
+
+        if ((MathLenSqr(body->velocity) < PHYSAC_SLEEP_VELOCITY*PHYSAC_SLEEP_VELOCITY) && (fabs(body->angularVelocity) < PHYSAC_SLEEP_ANGULAR_VELOCITY)) body->sleepTime += deltaTime;
+        else body->sleepTime = 0.0f;
+    }
+
+    // An island rests as long as its least resting body
+    for (int i = 0; i < physicsBodiesCount; i++)
+    {
+        PhysicsBody body = bodies[i];
+        if (body->isSleeping || !body->enabled || (body->inverseMass == 0.0f)) continue;
+
+        unsigned int root = FindIslandRoot(body->id);
+        islandSleepTime[root] = min(islandSleepTime[root], body->sleepTime);
+    }
+
+    for (int i = 0; i < physicsBodiesCount; i++)
+    {
+        PhysicsBody body = bodies[i];
+        if (body->isSleeping || !body->enabled || (body->inverseMass == 0.0f)) continue;
+
+        if (islandSleepTime[FindIslandRoot(body->id)] >= PHYSAC_SLEEP_TIME)
         {
-            body->force = PHYSAC_VECTOR_ZERO;
-            body->torque = 0.0f;
+            body->isSleeping = true;
+            body->velocity = PHYSAC_VECTOR_ZERO;
+            body->angularVelocity = 0.0f;
+            sleepPosition[body->id] = body->position;
         }
     }
 }
 
+// Finds island root id of a physics body id
+static unsigned int FindIslandRoot(unsigned int id)
+{
+    while (islandParent[id] != id)
+    {
+        islandParent[id] = islandParent[islandParent[id]];      // Path halving
+        id = islandParent[id];
+    }
+
+    return id;
+}
+
+// Wakes up a sleeping physics body
+static void WakePhysicsBody(PhysicsBody body)
+{
+    if (body->isSleeping)
+    {
+        body->isSleeping = false;
+        body->sleepTime = 0.0f;
+    }
+}
+
+// Finds the end position of an island in island sorted manifolds
+static int FindIslandEnd(int start)
+{
+    int end = start + 1;
+    while ((end < physicsManifoldsCount) && (manifoldIsland[islandManifolds[end]] == manifoldIsland[islandManifolds[start]])) end++;
+
+    return end;
+}
+
+// Runs a step task, split between physics thread and workers
+// NOTE: Every thread gets a fixed part of items, results do not depend on threads timing
+static void RunPhysicsTask(void (*task)(int start, int end), int count)
+{
+    physicsTask = task;
+    physicsTaskCount = count;
+    physicsTaskParts = 1;
+
+#if !defined(PHYSAC_NO_THREADS)
+    if ((workersCount > 0) && (count >= PHYSAC_PARALLEL_MIN_ITEMS))
+    {
+        physicsTaskParts = workersCount + 1;
+
+    #if defined(PHYSAC_SHARED_WORKERS)
+        // NOTE: One part per chunk, parts are fixed so results do not depend on which thread runs them
+        ParallelFor(RunPhysicsTaskParts, NULL, (int)physicsTaskParts, 1);
+    #else
+        pthread_mutex_lock(&workersMutex);
+        workersPending = workersCount;
+        workersGeneration++;
+        pthread_cond_broadcast(&workersStart);
+        pthread_mutex_unlock(&workersMutex);
+
+        RunPhysicsTaskPart(0);
+
+        pthread_mutex_lock(&workersMutex);
+        while (workersPending > 0) pthread_cond_wait(&workersDone, &workersMutex);
+        pthread_mutex_unlock(&workersMutex);
+    #endif
+
+        return;
+    }
+#endif
+
+    RunPhysicsTaskPart(0);
+}
+
+// Runs a part of current step task
+static void RunPhysicsTaskPart(unsigned int part)
+{
+    int start = (int)((long long)physicsTaskCount*part/physicsTaskParts);
+    int end = (int)((long long)physicsTaskCount*(part + 1)/physicsTaskParts);
+
+    if (start < end) physicsTask(start, end);
+}
+
+#if defined(PHYSAC_SHARED_WORKERS)
+// Runs a range of current step task parts, called by raylib shared worker threads
+static void RunPhysicsTaskParts(void *data, int start, int end)
+{
+    for (int part = start; part < end; part++) RunPhysicsTaskPart((unsigned int)part);
+}
+#elif !defined(PHYSAC_NO_THREADS)
+// Creates physics worker threads
+static void InitPhysicsWorkers(unsigned int count)
+{
+    workerThreads = (pthread_t *)PHYSAC_MALLOC(count*sizeof(pthread_t));
+    if (workerThreads == NULL) return;
+
+    pthread_mutex_init(&workersMutex, NULL);
+    pthread_cond_init(&workersStart, NULL);
+    pthread_cond_init(&workersDone, NULL);
+    workersGeneration = 0;
+    workersExit = false;
+
+    for (unsigned int i = 0; i < count; i++)
+    {
+        // NOTE: Worker part index is passed as thread argument, part 0 is run by physics thread
+        if (pthread_create(&workerThreads[workersCount], NULL, &PhysicsWorkerLoop, (void *)(uintptr_t)(i + 1)) != 0) break;
+        workersCount++;
+    }
+
+    #if defined(PHYSAC_DEBUG)
+        printf("[PHYSAC] physics worker threads created successfully [COUNT: %i]\n", workersCount);
+    #endif
+}
+
+// Stops and joins physics worker threads
+static void ClosePhysicsWorkers(void)
+{
+    if (workerThreads == NULL) return;
+
+    pthread_mutex_lock(&workersMutex);
+    workersExit = true;
+    pthread_cond_broadcast(&workersStart);
+    pthread_mutex_unlock(&workersMutex);
+
+    for (unsigned int i = 0; i < workersCount; i++) pthread_join(workerThreads[i], NULL);
+
+    pthread_cond_destroy(&workersDone);
+    pthread_cond_destroy(&workersStart);
+    pthread_mutex_destroy(&workersMutex);
+
+    PHYSAC_FREE(workerThreads);
+    workerThreads = NULL;
+    workersCount = 0;
+}
+
+// Physics worker thread function
+static void *PhysicsWorkerLoop(void *arg)
+{
+    unsigned int part = (unsigned int)(uintptr_t)arg;
+    unsigned int generation = 0;
+
+    pthread_mutex_lock(&workersMutex);
+
+    while (true)
+    {
+        while (!workersExit && (workersGeneration == generation)) pthread_cond_wait(&workersStart, &workersMutex);
+        if (workersExit) break;
+
+        generation = workersGeneration;
+        pthread_mutex_unlock(&workersMutex);
+
+        // Task parts count could be lower than workers count for small tasks
+        if (part < physicsTaskParts) RunPhysicsTaskPart(part);
+
+        pthread_mutex_lock(&workersMutex);
+        workersPending--;
+        if (workersPending == 0) pthread_cond_signal(&workersDone);
+    }
+
+    pthread_mutex_unlock(&workersMutex);
+
+    return NULL;
+}
+#endif
+
+// Step task: solves narrowphase of candidate pairs
+static void SolvePhysicsPairsTask(int start, int end)
+{
+    for (int i = start; i < end; i++)
+    {
+        PhysicsManifold manifold = &pairs[i].manifold;
+
+        *manifold = (PhysicsManifoldData){ 0 };
+        manifold->bodyA = pairs[i].bodyA;
+        manifold->bodyB = pairs[i].bodyB;
+
+        SolvePhysicsManifold(manifold);
+    }
+}
+
+// Step task: integrates forces of physics bodies
+static void IntegratePhysicsForcesTask(int start, int end)
+{
+    for (int i = start; i < end; i++) IntegratePhysicsForces(bodies[i]);
+}
+
+// Step task: initializes physics manifolds
+static void InitializePhysicsManifoldsTask(int start, int end)
+{
+    for (int i = start; i < end; i++) InitializePhysicsManifolds(&contacts[i]);
+}
+
+// Step task: integrates collisions impulses of islands
+// NOTE: Islands starting in task part are fully solved by it, even if they continue in next part
+static void IntegratePhysicsImpulsesTask(int start, int end)
+{
+    int i = start;
+    while ((i > 0) && (i < end) && (manifoldIsland[islandManifolds[i]] == manifoldIsland[islandManifolds[i - 1]])) i++;
+
+    while (i < end)
+    {
+        int islandEnd = FindIslandEnd(i);
+
+        for (int j = i; j < islandEnd; j++) WarmStartPhysicsManifold(&contacts[islandManifolds[j]]);
+
+        for (int k = 0; k < solverIterations; k++)
+        {
+            float maxChange = 0.0f;
+
+            for (int j = i; j < islandEnd; j++)
+            {
+                float change = IntegratePhysicsImpulses(&contacts[islandManifolds[j]]);
+                if (change > maxChange) maxChange = change;
+            }
+
+            // Island converged, more iterations would barely change its bodies velocities
+            if (maxChange < PHYSAC_SOLVER_TOLERANCE) break;
+        }
+
+        i = islandEnd;
+    }
+}
+
+// Step task: integrates velocity of physics bodies
+static void IntegratePhysicsVelocityTask(int start, int end)
+{
+    for (int i = start; i < end; i++) IntegratePhysicsVelocity(bodies[i]);
+}
+
+// Step task: corrects positions of islands
+static void CorrectPhysicsPositionsTask(int start, int end)
+{
+    int i = start;
+    while ((i > 0) && (i < end) && (manifoldIsland[islandManifolds[i]] == manifoldIsland[islandManifolds[i - 1]])) i++;
+
+    while (i < end)
+    {
+        int islandEnd = FindIslandEnd(i);
+
+        for (int j = i; j < islandEnd; j++) CorrectPhysicsPositions(&contacts[islandManifolds[j]]);
+
+        i = islandEnd;
+    }
+}
+
 // Wrapper to ensure PhysicsStep is run with at a fixed time step
 PHYSACDEF void RunPhysicsStep(void)
 {
@@ -1155,6 +2479,8 @@ PHYSACDEF void RunPhysicsStep(void)
     accumulator += delta;
 
     // Fixed time stepping loop
+    bool stepped = (accumulator >= deltaTime);
+
     while (accumulator >= deltaTime)
     {
 #ifdef PHYSAC_DEBUG
@@ -1165,6 +2491,9 @@ PHYSACDEF void RunPhysicsStep(void)
         accumulator -= deltaTime;
     }
 
+    // Publish bodies state once all due steps are done
+    if (stepped) PublishPhysicsBodies();
+
     // Record the starting of this frame
     startTime = currentTime;
 }
@@ -1174,46 +2503,24 @@ PHYSACDEF void SetPhysicsTimeStep(double delta)
     deltaTime = delta;
 }
 
-// Finds a valid index for a new manifold initialization
-static int FindAvailableManifoldIndex()
+// Sets max collision solver iterations per step
+// NOTE: Islands stop iterating earlier once their contacts converge
+PHYSACDEF void SetPhysicsSolverIterations(int iterations)
 {
-    int index = -1;
-    for (int i = 0; i < PHYSAC_MAX_MANIFOLDS; i++)
-    {
-        int currentId = i;
-
-        // Check if current id already exist in other physics body
-        for (int k = 0; k < physicsManifoldsCount; k++)
-        {
-            if (contacts[k]->id == currentId)
-            {
-                currentId++;
-                break;
-            }
-        }
-
-        // If it is not used, use it as new physics body id
-        if (currentId == i)
-        {
-            index = i;
-            break;
-        }
-    }
-
-    return index;
+    solverIterations = ((iterations > 0) ? iterations : 1);
 }
 
 // Creates a new physics manifold to solve collision
 static PhysicsManifold CreatePhysicsManifold(PhysicsBody a, PhysicsBody b)
 {
-    PhysicsManifold newManifold = (PhysicsManifold)PHYSAC_MALLOC(sizeof(PhysicsManifoldData));
-    usedMemory += sizeof(PhysicsManifoldData);
+    PhysicsManifold newManifold = NULL;
 
-    int newId = FindAvailableManifoldIndex();
-    if (newId != -1)
+    if ((physicsManifoldsCount < manifoldsCapacity) || ResizePhysicsManifolds((manifoldsCapacity > 0) ? manifoldsCapacity*2 : PHYSAC_MAX_MANIFOLDS))
     {
+        newManifold = &contacts[physicsManifoldsCount];
+
         // Initialize new manifold with generic values
-        newManifold->id = newId;
+        newManifold->id = physicsManifoldsCount;
         newManifold->bodyA = a;
         newManifold->bodyB = b;
         newManifold->penetration = 0;
@@ -1225,61 +2532,16 @@ static PhysicsManifold CreatePhysicsManifold(PhysicsBody a, PhysicsBody b)
         newManifold->dynamicFriction = 0.0f;
         newManifold->staticFriction = 0.0f;
 
-        // Add new body to bodies pointers array and update bodies count
-        contacts[physicsManifoldsCount] = newManifold;
+        // Update manifolds pool used count
         physicsManifoldsCount++;
     }
     #if defined(PHYSAC_DEBUG)
-        else printf("[PHYSAC] new physics manifold creation failed because there is any available id to use\n");
+        else printf("[PHYSAC] new physics manifold creation failed because manifolds storage could not grow\n");
     #endif
 
     return newManifold;
 }
 
-// Unitializes and destroys a physics manifold
-static void DestroyPhysicsManifold(PhysicsManifold manifold)
-{
-    if (manifold != NULL)
-    {
-        int id = manifold->id;
-        int index = -1;
-
-        for (int i = 0; i < physicsManifoldsCount; i++)
-        {
-            if (contacts[i]->id == id)
-            {
-                index = i;
-                break;
-            }
-        }
-
-        if (index == -1)
-        {
-        #if defined(PHYSAC_DEBUG)
-            printf("[PHYSAC] Not possible to manifold id %i in pointers array\n", id);
-        #endif
-            return;     // Prevent access to index -1
-        }      
-
-        // Free manifold allocated memory
-        PHYSAC_FREE(manifold);
-        usedMemory -= sizeof(PhysicsManifoldData);
-        contacts[index] = NULL;
-
-        // Reorder physics manifolds pointers array and its catched index
-        for (int i = index; i < physicsManifoldsCount; i++)
-        {
-            if ((i + 1) < physicsManifoldsCount) contacts[i] = contacts[i + 1];
-        }
-
-        // Update physics manifolds count
-        physicsManifoldsCount--;
-    }
-    #if defined(PHYSAC_DEBUG)
-        else printf("[PHYSAC] error trying to destroy a null referenced manifold\n");
-    #endif
-}
-
 // Solves a created physics manifold between two physics bodies
 static void SolvePhysicsManifold(PhysicsManifold manifold)
 {
@@ -1305,9 +2567,6 @@ static void SolvePhysicsManifold(PhysicsManifold manifold)
         } break;
         default: break;
     }
-
-    // Update physics body grounded state if normal direction is down and grounded state is not set yet in previous manifolds
-    if (!manifold->bodyB->isGrounded) manifold->bodyB->isGrounded = (manifold->normal.y < 0);
 }
 
 // Solves collision between two circle shape physics bodies
@@ -1346,9 +2605,6 @@ static void SolveCircleToCircle(PhysicsManifold manifold)
         manifold->normal = (Vector2){ normal.x/distance, normal.y/distance }; // Faster than using MathNormalize() due to sqrt is already performed
         manifold->contacts[0] = (Vector2){ manifold->normal.x*bodyA->shape.radius + bodyA->position.x, manifold->normal.y*bodyA->shape.radius + bodyA->position.y };
     }
-
-    // Update physics body grounded state if normal direction is down
-    if (!bodyA->isGrounded) bodyA->isGrounded = (manifold->normal.y < 0);
 }
 
 // Solves collision between a circle to a polygon shape physics bodies
@@ -1562,7 +2818,7 @@ static void SolvePolygonToPolygon(PhysicsManifold manifold)
 // Integrates physics forces into velocity
 static void IntegratePhysicsForces(PhysicsBody body)
 {
-    if ((body == NULL) || (body->inverseMass == 0.0f) || !body->enabled) return;
+    if ((body == NULL) || (body->inverseMass == 0.0f) || !body->enabled || body->isSleeping) return;
 
     body->velocity.x += (body->force.x*body->inverseMass)*(deltaTime/2.0);
     body->velocity.y += (body->force.y*body->inverseMass)*(deltaTime/2.0);
@@ -1606,24 +2862,96 @@ static void InitializePhysicsManifolds(PhysicsManifold manifold)
         // The idea is if the only thing moving this object is gravity, then the collision should be performed without any restitution
         if (MathLenSqr(radiusV) < (MathLenSqr((Vector2){ gravityForce.x*deltaTime/1000, gravityForce.y*deltaTime/1000 }) + PHYSAC_EPSILON)) manifold->restitution = 0;
     }
+
+    PhysicsManifold previous = FindPreviousManifold(bodyA, bodyB);
+
+    for (int i = 0; i < manifold->contactsCount; i++)
+    {
+        Vector2 radiusA = Vector2Subtract(manifold->contacts[i], bodyA->position);
+        Vector2 radiusB = Vector2Subtract(manifold->contacts[i], bodyB->position);
+
+        Vector2 radiusV = { 0.0f, 0.0f };
+        radiusV.x = bodyB->velocity.x + MathCross(bodyB->angularVelocity, radiusB).x - bodyA->velocity.x - MathCross(bodyA->angularVelocity, radiusA).x;
+        radiusV.y = bodyB->velocity.y + MathCross(bodyB->angularVelocity, radiusB).y - bodyA->velocity.y - MathCross(bodyA->angularVelocity, radiusA).y;
+
+        // Restitution is applied once to approaching velocity, instead of every solver iteration
+        float contactVelocity = MathDot(radiusV, manifold->normal);
+        manifold->velocityBiases[i] = ((contactVelocity < 0.0f) ? -manifold->restitution*contactVelocity : 0.0f);
+
+        // Reuse accumulated impulses of a previous step contact close to this one
+        manifold->normalImpulses[i] = 0.0f;
+        manifold->tangentImpulses[i] = 0.0f;
+
+        if (previous != NULL)
+        {
+            for (int j = 0; j < previous->contactsCount; j++)
+            {
+                if (DistSqr(previous->contacts[j], manifold->contacts[i]) < PHYSAC_CONTACT_MATCH_DISTANCE*PHYSAC_CONTACT_MATCH_DISTANCE)
+                {
+                    manifold->normalImpulses[i] = previous->normalImpulses[j];
+                    manifold->tangentImpulses[i] = previous->tangentImpulses[j];
+                    break;
+                }
+            }
+        }
+    }
 }
 
-// Integrates physics collisions impulses to solve collisions
-static void IntegratePhysicsImpulses(PhysicsManifold manifold)
+// Applies physics manifold contacts impulses accumulated in previous step
+static void WarmStartPhysicsManifold(PhysicsManifold manifold)
 {
     PhysicsBody bodyA = manifold->bodyA;
     PhysicsBody bodyB = manifold->bodyB;
 
     if ((bodyA == NULL) || (bodyB == NULL)) return;
 
+    Vector2 tangent = { manifold->normal.y, -manifold->normal.x };
+
+    for (int i = 0; i < manifold->contactsCount; i++)
+    {
+        Vector2 radiusA = Vector2Subtract(manifold->contacts[i], bodyA->position);
+        Vector2 radiusB = Vector2Subtract(manifold->contacts[i], bodyB->position);
+
+        Vector2 impulseV = { 0.0f, 0.0f };
+        impulseV.x = manifold->normal.x*manifold->normalImpulses[i] + tangent.x*manifold->tangentImpulses[i];
+        impulseV.y = manifold->normal.y*manifold->normalImpulses[i] + tangent.y*manifold->tangentImpulses[i];
+
+        if (bodyA->enabled && (bodyA->inverseMass != 0.0f))
+        {
+            bodyA->velocity.x += bodyA->inverseMass*(-impulseV.x);
+            bodyA->velocity.y += bodyA->inverseMass*(-impulseV.y);
+            if (!bodyA->freezeOrient) bodyA->angularVelocity += bodyA->inverseInertia*MathCrossVector2(radiusA, (Vector2){ -impulseV.x, -impulseV.y });
+        }
+
+        if (bodyB->enabled && (bodyB->inverseMass != 0.0f))
+        {
+            bodyB->velocity.x += bodyB->inverseMass*(impulseV.x);
+            bodyB->velocity.y += bodyB->inverseMass*(impulseV.y);
+            if (!bodyB->freezeOrient) bodyB->angularVelocity += bodyB->inverseInertia*MathCrossVector2(radiusB, impulseV);
+        }
+    }
+}
+
+// Integrates physics collisions impulses to solve collisions, returns max velocity change
+// NOTE: Impulses are accumulated and clamped per contact, so they can be reused to warm start next step
+static float IntegratePhysicsImpulses(PhysicsManifold manifold)
+{
+    PhysicsBody bodyA = manifold->bodyA;
+    PhysicsBody bodyB = manifold->bodyB;
+    float maxChange = 0.0f;
+
+    if ((bodyA == NULL) || (bodyB == NULL)) return maxChange;
+
     // Early out and positional correct if both objects have infinite mass
     if (fabs(bodyA->inverseMass + bodyB->inverseMass) <= PHYSAC_EPSILON)
     {
         bodyA->velocity = PHYSAC_VECTOR_ZERO;
         bodyB->velocity = PHYSAC_VECTOR_ZERO;
-        return;
+        return maxChange;
     }
 
+    Vector2 tangent = { manifold->normal.y, -manifold->normal.x };
+
     for (int i = 0; i < manifold->contactsCount; i++)
     {
         // Calculate radius from center of mass to contact
@@ -1638,30 +2966,30 @@ static void IntegratePhysicsImpulses(PhysicsManifold manifold)
         // Relative velocity along the normal
         float contactVelocity = MathDot(radiusV, manifold->normal);
 
-        // Do not resolve if velocities are separating
-        if (contactVelocity > 0.0f) return;
-
         float raCrossN = MathCrossVector2(radiusA, manifold->normal);
         float rbCrossN = MathCrossVector2(radiusB, manifold->normal);
 
         float inverseMassSum = bodyA->inverseMass + bodyB->inverseMass + (raCrossN*raCrossN)*bodyA->inverseInertia + (rbCrossN*rbCrossN)*bodyB->inverseInertia;
 
-        // Calculate impulse scalar value
-        float impulse = -(1.0f + manifold->restitution)*contactVelocity;
-        impulse /= inverseMassSum;
-        impulse /= (float)manifold->contactsCount;
+        // Calculate impulse scalar value, accumulated impulse can only push bodies apart
+        float impulse = (manifold->velocityBiases[i] - contactVelocity)/inverseMassSum;
+        float previousImpulse = manifold->normalImpulses[i];
+        manifold->normalImpulses[i] = (((previousImpulse + impulse) > 0.0f) ? (previousImpulse + impulse) : 0.0f);
+        impulse = manifold->normalImpulses[i] - previousImpulse;
+
+        if (fabs(impulse)*inverseMassSum > maxChange) maxChange = fabs(impulse)*inverseMassSum;
 
         // Apply impulse to each physics body
         Vector2 impulseV = { manifold->normal.x*impulse, manifold->normal.y*impulse };
 
-        if (bodyA->enabled)
+        if (bodyA->enabled && (bodyA->inverseMass != 0.0f))
         {
             bodyA->velocity.x += bodyA->inverseMass*(-impulseV.x);
             bodyA->velocity.y += bodyA->inverseMass*(-impulseV.y);
             if (!bodyA->freezeOrient) bodyA->angularVelocity += bodyA->inverseInertia*MathCrossVector2(radiusA, (Vector2){ -impulseV.x, -impulseV.y });
         }
 
-        if (bodyB->enabled)
+        if (bodyB->enabled && (bodyB->inverseMass != 0.0f))
         {
             bodyB->velocity.x += bodyB->inverseMass*(impulseV.x);
             bodyB->velocity.y += bodyB->inverseMass*(impulseV.y);
@@ -1672,26 +3000,33 @@ static void IntegratePhysicsImpulses(PhysicsManifold manifold)
         radiusV.x = bodyB->velocity.x + MathCross(bodyB->angularVelocity, radiusB).x - bodyA->velocity.x - MathCross(bodyA->angularVelocity, radiusA).x;
         radiusV.y = bodyB->velocity.y + MathCross(bodyB->angularVelocity, radiusB).y - bodyA->velocity.y - MathCross(bodyA->angularVelocity, radiusA).y;
 
-        Vector2 tangent = { radiusV.x - (manifold->normal.x*MathDot(radiusV, manifold->normal)), radiusV.y - (manifold->normal.y*MathDot(radiusV, manifold->normal)) };
-        MathNormalize(&tangent);
+        float raCrossT = MathCrossVector2(radiusA, tangent);
+        float rbCrossT = MathCrossVector2(radiusB, tangent);
+
+        float tangentMassSum = bodyA->inverseMass + bodyB->inverseMass + (raCrossT*raCrossT)*bodyA->inverseInertia + (rbCrossT*rbCrossT)*bodyB->inverseInertia;
 
         // Calculate impulse tangent magnitude
-        float impulseTangent = -MathDot(radiusV, tangent);
-        impulseTangent /= inverseMassSum;
-        impulseTangent /= (float)manifold->contactsCount;
+        float impulseTangent = -MathDot(radiusV, tangent)/tangentMassSum;
+
+        // Apply coulumb's law, contact sticks until static friction limit and then slides with dynamic friction
+        float previousTangent = manifold->tangentImpulses[i];
+        float accumulatedTangent = previousTangent + impulseTangent;
 
-        float absImpulseTangent = fabs(impulseTangent);
+        if (fabs(accumulatedTangent) > manifold->normalImpulses[i]*manifold->staticFriction)
+        {
+            float maxTangent = manifold->normalImpulses[i]*manifold->dynamicFriction;
+            accumulatedTangent = ((accumulatedTangent > 0.0f) ? maxTangent : -maxTangent);
+        }
 
-        // Don't apply tiny friction impulses
-        if (absImpulseTangent <= PHYSAC_EPSILON) return;
+        manifold->tangentImpulses[i] = accumulatedTangent;
+        impulseTangent = accumulatedTangent - previousTangent;
 
-        // Apply coulumb's law
-        Vector2 tangentImpulse = { 0.0f, 0.0f };
-        if (absImpulseTangent < impulse*manifold->staticFriction) tangentImpulse = (Vector2){ tangent.x*impulseTangent, tangent.y*impulseTangent };
-        else tangentImpulse = (Vector2){ tangent.x*-impulse*manifold->dynamicFriction, tangent.y*-impulse*manifold->dynamicFriction };
+        if (fabs(impulseTangent)*tangentMassSum > maxChange) maxChange = fabs(impulseTangent)*tangentMassSum;
 
         // Apply friction impulse
-        if (bodyA->enabled)
+        Vector2 tangentImpulse = { tangent.x*impulseTangent, tangent.y*impulseTangent };
+
+        if (bodyA->enabled && (bodyA->inverseMass != 0.0f))
         {
             bodyA->velocity.x += bodyA->inverseMass*(-tangentImpulse.x);
             bodyA->velocity.y += bodyA->inverseMass*(-tangentImpulse.y);
@@ -1699,7 +3034,7 @@ static void IntegratePhysicsImpulses(PhysicsManifold manifold)
             if (!bodyA->freezeOrient) bodyA->angularVelocity += bodyA->inverseInertia*MathCrossVector2(radiusA, (Vector2){ -tangentImpulse.x, -tangentImpulse.y });
         }
 
-        if (bodyB->enabled)
+        if (bodyB->enabled && (bodyB->inverseMass != 0.0f))
         {
             bodyB->velocity.x += bodyB->inverseMass*(tangentImpulse.x);
             bodyB->velocity.y += bodyB->inverseMass*(tangentImpulse.y);
@@ -1707,12 +3042,68 @@ static void IntegratePhysicsImpulses(PhysicsManifold manifold)
             if (!bodyB->freezeOrient) bodyB->angularVelocity += bodyB->inverseInertia*MathCrossVector2(radiusB, tangentImpulse);
         }
     }
+
+    return maxChange;
+}
+
+// Keeps current manifolds as previous step ones and indexes them by bodies ids
+static void StorePreviousManifolds(void)
+{
+    PhysicsManifoldData *previous = previousContacts;
+    previousContacts = contacts;
+    contacts = previous;
+    previousManifoldsCount = physicsManifoldsCount;
+
+    // Hash table is kept at most half full, so probing sequences are short
+    if ((previousManifoldsCount*2 > previousTableSize) || (previousTable == NULL))
+    {
+        unsigned int newSize = ((previousTableSize > 0) ? previousTableSize : PHYSAC_MAX_MANIFOLDS);
+        while (previousManifoldsCount*2 > newSize) newSize *= 2;
+
+        unsigned int *newTable = (unsigned int *)PHYSAC_REALLOC(previousTable, newSize*sizeof(unsigned int));
+
+        if (newTable == NULL)
+        {
+            // Contacts are not warm started this step
+            previousManifoldsCount = 0;
+            return;
+        }
+
+        previousTable = newTable;
+        previousTableSize = newSize;
+    }
+
+    memset(previousTable, 0, previousTableSize*sizeof(unsigned int));
+
+    for (int i = 0; i < previousManifoldsCount; i++)
+    {
+        unsigned int slot = (previousContacts[i].bodyA->id*73856093u ^ previousContacts[i].bodyB->id*19349663u)%previousTableSize;
+        while (previousTable[slot] != 0) slot = (slot + 1)%previousTableSize;
+        previousTable[slot] = i + 1;
+    }
+}
+
+// Finds previous step manifold between two physics bodies
+static PhysicsManifold FindPreviousManifold(PhysicsBody a, PhysicsBody b)
+{
+    if (previousManifoldsCount == 0) return NULL;
+
+    unsigned int slot = (a->id*73856093u ^ b->id*19349663u)%previousTableSize;
+
+    while (previousTable[slot] != 0)
+    {
+        PhysicsManifold previous = &previousContacts[previousTable[slot] - 1];
+        if ((previous->bodyA->id == a->id) && (previous->bodyB->id == b->id)) return previous;
+        slot = (slot + 1)%previousTableSize;
+    }
+
+    return NULL;
 }
 
 // Integrates physics velocity into position and forces
 static void IntegratePhysicsVelocity(PhysicsBody body)
 {
-    if ((body == NULL) ||!body->enabled) return;
+    if ((body == NULL) || !body->enabled || body->isSleeping) return;
 
     body->position.x += body->velocity.x*deltaTime;
     body->position.y += body->velocity.y*deltaTime;
@@ -1735,13 +3126,13 @@ static void CorrectPhysicsPositions(PhysicsManifold manifold)
     correction.x = (max(manifold->penetration - PHYSAC_PENETRATION_ALLOWANCE, 0.0f)/(bodyA->inverseMass + bodyB->inverseMass))*manifold->normal.x*PHYSAC_PENETRATION_CORRECTION;
     correction.y = (max(manifold->penetration - PHYSAC_PENETRATION_ALLOWANCE, 0.0f)/(bodyA->inverseMass + bodyB->inverseMass))*manifold->normal.y*PHYSAC_PENETRATION_CORRECTION;
 
-    if (bodyA->enabled)
+    if (bodyA->enabled && (bodyA->inverseMass != 0.0f))
     {
         bodyA->position.x -= correction.x*bodyA->inverseMass;
         bodyA->position.y -= correction.y*bodyA->inverseMass;
     }
 
-    if (bodyB->enabled)
+    if (bodyB->enabled && (bodyB->inverseMass != 0.0f))
     {
         bodyB->position.x += correction.x*bodyB->inverseMass;
         bodyB->position.y += correction.y*bodyB->inverseMass;
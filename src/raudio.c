@@ -69,6 +69,7 @@
     #include "raudio.h"
     #include <stdarg.h>         // Required for: va_list, va_start(), vfprintf(), va_end()
 #else
+    #define RL_MEMORY_TAG   MEMORY_TAG_AUDIO    // Module allocations subsystem (GetMemoryStats())
     #include "raylib.h"         // Declares module functions
 
 // Check if config flags have been externally provided on compilation line
@@ -86,6 +87,7 @@
 #include <stdlib.h>             // Required for: malloc(), free()
 #include <string.h>             // Required for: strcmp(), strncmp()
 #include <stdio.h>              // Required for: FILE, fopen(), fclose(), fread()
+#include <math.h>               // Required for: sinf(), cosf(), powf(), expf(), log10f(), sqrtf(), fmaxf()
 
 #if defined(SUPPORT_FILEFORMAT_OGG)
     #define STB_VORBIS_IMPLEMENTATION
@@ -105,18 +107,46 @@
 #if defined(SUPPORT_FILEFORMAT_FLAC)
     #define DR_FLAC_IMPLEMENTATION
     #define DR_FLAC_NO_WIN32_IO
+    #define DRFLAC_MALLOC RL_MALLOC         // Decoded samples are freed with RL_FREE() on UnloadWave()
+    #define DRFLAC_REALLOC RL_REALLOC
+    #define DRFLAC_FREE RL_FREE
     #include "external/dr_flac.h"       // FLAC loading functions
 #endif
 
 #if defined(SUPPORT_FILEFORMAT_MP3)
     #define DR_MP3_IMPLEMENTATION
+    #define DRMP3_MALLOC RL_MALLOC          // Decoded samples are freed with RL_FREE() on UnloadWave()
+    #define DRMP3_REALLOC RL_REALLOC
+    #define DRMP3_FREE RL_FREE
     #include "external/dr_mp3.h"        // MP3 loading functions
 #endif
 
+// Sounds data can be mapped from file (WAV data already in device format)
+#if defined(SUPPORT_FILEFORMAT_WAV) && !defined(PLATFORM_ANDROID) && !defined(__EMSCRIPTEN__)
+    #if defined(_WIN32)
+        #define RAUDIO_MAPPED_FILES     // NOTE: Required windows.h is included by miniaudio
+    #elif defined(__unix__) || defined(__APPLE__)
+        #include <sys/mman.h>           // Required for: mmap(), munmap()
+        #include <sys/stat.h>           // Required for: fstat()
+        #include <fcntl.h>              // Required for: open()
+        #include <unistd.h>             // Required for: close()
+        #define RAUDIO_MAPPED_FILES
+    #endif
+#endif
+
 #if defined(_MSC_VER)
     #undef bool
 #endif
 
+// SIMD instructions used on audio mixing (MixAudioFrames(), ClampAudioFrames())
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 1))
+    #include <xmmintrin.h>      // Required for: SSE intrinsics
+    #define RAUDIO_SIMD_SSE
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+    #include <arm_neon.h>       // Required for: NEON intrinsics
+    #define RAUDIO_SIMD_NEON
+#endif
+
 //----------------------------------------------------------------------------------
 // Defines and Macros
 //----------------------------------------------------------------------------------
@@ -125,6 +155,14 @@
 // standard double-buffering system, a 4096 samples buffer has been chosen, it should be enough
 // In case of music-stalls, just increase this number
 #define AUDIO_BUFFER_SIZE        4096       // PCM data samples (i.e. 16bit, Mono: 8Kb)
+#define AUDIO_SUBBUFFERS_COUNT      2       // Default audio stream sub-buffers (double-buffering)
+#define MAX_AUDIO_SUBBUFFERS        8       // Max audio stream sub-buffers (InitAudioStreamEx())
+
+#define MAX_MUSIC_STREAMS          32       // Max music streams loaded at the same time (streaming thread)
+#define MUSIC_STREAM_THREAD_SLEEP   5       // Music streaming thread sleep between buffers refills (milliseconds)
+#define MAX_MUSIC_MODULE_CACHE_SIZE (64*1024*1024)  // Max module pre-rendered data size (bytes), longer modules are rendered on playing
+#define MUSIC_MODULE_RENDER_BLOCK   4096    // Module frames rendered by block on pre-rendering thread
+#define MUSIC_MODULE_CACHE_MARGIN   48000   // Module frames pre-rendered ahead of playback before playing from cache (1 second)
 
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
@@ -142,6 +180,22 @@ typedef enum {
     MUSIC_MODULE_MOD
 } MusicContextType;
 
+// Music module pre-rendered cache (SetMusicModuleCache())
+// NOTE: A second module context renders the whole module on a background thread, playback module context
+// is rendered until pre-rendered data gets far enough ahead, then music is played from pre-rendered data
+typedef struct MusicModuleCache {
+    void *module;                   // Music module context played (cache key)
+    void *renderer;                 // Module context pre-rendering data (render thread)
+    int type;                       // Module type (MUSIC_MODULE_XM or MUSIC_MODULE_MOD)
+    short *data;                    // Pre-rendered data (16 bit stereo)
+    unsigned int frameCount;        // Module length in frames
+    volatile unsigned int framesRendered;   // Frames pre-rendered (written by render thread)
+    unsigned int cursor;            // Playback position in frames
+    bool playing;                   // Music played from pre-rendered data
+    volatile bool cancel;           // Pre-rendering cancel requested (module unloaded)
+    ma_thread thread;               // Pre-rendering thread
+} MusicModuleCache;
+
 #if defined(RAUDIO_STANDALONE)
 typedef enum {
     LOG_ALL,
@@ -167,6 +221,11 @@ typedef enum {
 static Wave LoadWAV(const char *fileName);              // Load WAV file
 static int SaveWAV(Wave wave, const char *fileName);    // Save wave data as WAV file
 #endif
+#if defined(RAUDIO_MAPPED_FILES)
+static unsigned char *MapAudioFile(const char *fileName, unsigned int *size);    // Map file into memory (read-only)
+static void UnmapAudioFile(unsigned char *data, unsigned int size);             // Unmap file from memory
+static Sound LoadSoundMappedWAV(const char *fileName);  // Load sound from WAV file mapped into memory (device format data only)
+#endif
 #if defined(SUPPORT_FILEFORMAT_OGG)
 static Wave LoadOGG(const char *fileName);              // Load OGG file
 #endif
@@ -187,12 +246,73 @@ void TraceLog(int msgType, const char *text, ...);              // Show trace lo
 //----------------------------------------------------------------------------------
 #define DEVICE_FORMAT       ma_format_f32
 #define DEVICE_CHANNELS     2
-#define DEVICE_SAMPLE_RATE  44100
-
-#define MAX_AUDIO_BUFFER_POOL_CHANNELS 16
+#define DEVICE_SAMPLE_RATE  44100      // Default device sample rate (InitAudioDeviceEx() can set another one)
+
+#define MAX_AUDIO_BUFFER_POOL_CHANNELS 16      // Default max voices mixed (SetAudioVoicesLimit())
+#define MAX_AUDIO_VOICES_MIXED      64      // Max voices mixed at the same time (voices pool buffers)
+#define MAX_AUDIO_VOICES            256     // Max voices playing (mixed and virtual)
+#define AUDIO_VOICE_CULL_VOLUME     0.001f  // Voices under this audible volume are not mixed (virtual)
+#define AUDIO_COMMAND_QUEUE_SIZE    256     // Audio commands queue size (game thread -> audio thread), must be power of two
+#define MAX_AUDIO_DECODERS          16      // Max compressed sounds decoded at the same time (audio thread)
+#define MAX_AUDIO_CONVERSION_THREADS 4      // Max threads converting waves at the same time (WaveFormatBatch())
+#define MAX_AUDIO_CONVERSION_CACHE  64      // Max converted waves data cached (SetAudioConversionCache())
+#define MAX_AUDIO_BUSES             8       // Max mixing buses, bus 0 is master bus
+#define MAX_AUDIO_BUS_EFFECTS       4       // Max effects by bus (processed in order)
+#define MAX_AUDIO_DELAY_TIME        2.0f    // Max delay effect time (seconds)
+#define AUDIO_MIX_BLOCK_SIZE        512     // Frames mixed by block, buses effects are processed once by block
+#define AUDIO_DUCKER_KEY_LEVEL      0.01f   // Ducker key bus level considered active
+#define AUDIO_EFFECT_ATTACK_TIME    0.005f  // Compressor and ducker attack time (seconds)
+#define MAX_AUDIO_EMITTERS          256     // Max spatial emitters (streams and mixed voices positioned)
+#define AUDIO_SPEED_OF_SOUND        343.3f  // Speed of sound (world units by second), doppler effect
+#define AUDIO_DOPPLER_MAX_RATIO     2.0f    // Max doppler pitch ratio (min ratio is its inverse)
 
 typedef enum { AUDIO_BUFFER_USAGE_STATIC = 0, AUDIO_BUFFER_USAGE_STREAM } AudioBufferUsage;
 
+// Audio data conversion source (ConvertAudioFrames())
+typedef struct AudioConversionData {
+    const unsigned char *data;  // Source data
+    ma_uint32 frameSize;        // Source frame size in bytes
+    ma_uint32 frameCount;       // Source frames count
+    ma_uint32 frameCursor;      // Source frames read
+} AudioConversionData;
+
+// Converted audio data cache entry, keyed by source data and formats
+typedef struct AudioConversionCache {
+    unsigned int hash;          // Source data hash (FNV-1a)
+    unsigned int dataSize;      // Source data size in bytes
+    ma_format formatIn;         // Source format
+    ma_uint32 channelsIn;       // Source channels
+    ma_uint32 sampleRateIn;     // Source sample rate
+    ma_format formatOut;        // Converted format
+    ma_uint32 channelsOut;      // Converted channels
+    ma_uint32 sampleRateOut;    // Converted sample rate
+    int quality;                // Conversion quality (AudioConversionQuality)
+    void *data;                 // Converted data (NULL if entry is free)
+    ma_uint32 frameCount;       // Converted frames count
+} AudioConversionCache;
+
+// Waves conversion job (WaveFormatBatch())
+typedef struct AudioConversionJob {
+    Wave *waves;                // Waves array
+    int count;                  // Waves count
+    int first;                  // First wave converted by job
+    int step;                   // Waves step between job waves (jobs count)
+    int sampleRate;             // Target sample rate
+    int sampleSize;             // Target sample size
+    int channels;               // Target channels
+} AudioConversionJob;
+
+// Compressed sound decoder type (LoadSoundCompressed())
+typedef enum { AUDIO_DECODER_NONE = 0, AUDIO_DECODER_OGG, AUDIO_DECODER_FLAC, AUDIO_DECODER_MP3 } AudioDecoderType;
+
+// Audio data shared by sound instances (LoadSoundAlias()), released with last instance
+typedef struct AudioData {
+    unsigned char *data;    // Sound data (device format or encoded file data for compressed sounds)
+    unsigned int dataSize;  // Sound data size in bytes (compressed and mapped sounds)
+    unsigned int refCount;  // Sound instances referencing data
+    bool mapped;            // Sound data is a read-only file mapping (WAV file data)
+} AudioData;
+
 // Audio buffer structure
 // NOTE: Slightly different logic is used when feeding data to the
 // playback device depending on whether or not data is streamed
@@ -204,15 +324,38 @@ struct rAudioBuffer {
 
     bool playing;           // Audio buffer state: AUDIO_PLAYING
     bool paused;            // Audio buffer state: AUDIO_PAUSED
+    bool mixPlaying;        // Audio buffer mixing state (audio thread): AUDIO_PLAYING
+    bool mixPaused;         // Audio buffer mixing state (audio thread): AUDIO_PAUSED
+    float mixVolume;        // Audio buffer mixing volume (audio thread), ramped to mixVolumeTarget on next mixing
+    float mixVolumeTarget;  // Audio buffer mixing volume requested (audio thread)
     bool looping;           // Audio buffer looping, always true for AudioStreams
     int usage;              // Audio buffer usage mode: STATIC or STREAM
-
-    bool isSubBufferProcessed[2];       // SubBuffer processed (virtual double buffer)
+    int mixBus;             // Audio buffer mixing bus (audio thread), 0 for master bus
+    int emitter;            // Audio buffer spatial emitter (game thread), -1 if not positioned
+    int mixEmitter;         // Audio buffer spatial emitter mixed (audio thread), -1 if not positioned
+    float mixGain[DEVICE_CHANNELS];     // Audio buffer spatial gains applied on last mixing (audio thread)
+    float mixPitch;         // Audio buffer pitch (audio thread), doppler ratio is applied over it
+    float mixDoppler;       // Audio buffer doppler ratio applied (audio thread)
+    bool positioned;        // Sound positioned, voices played are spatial (game thread)
+    float position[3];      // Sound emitter position (game thread)
+    float velocity[3];      // Sound emitter velocity (game thread)
+    int priority;           // Sound voices priority (higher priority voices are mixed first)
+    int maxInstances;       // Sound voices max instances (0 for unlimited)
+
+    bool isSubBufferProcessed[MAX_AUDIO_SUBBUFFERS];    // SubBuffer processed (virtual multi-buffer)
+    unsigned int subBufferCount;        // Sub-buffers in use (2 for double-buffering)
+    unsigned int underrunCount;         // Stream underruns (playing with no sub-buffer ready)
+    bool isStarving;                    // Stream currently starving (underrun already counted)
     unsigned int frameCursorPos;        // Frame cursor position
     unsigned int bufferSizeInFrames;    // Total buffer size in frames
     unsigned int totalFramesProcessed;  // Total frames processed in this buffer (required for play timming)
 
     unsigned char *buffer;              // Data buffer, on music stream keeps filling
+    AudioData *shared;                  // Shared data buffer (sounds), NULL if data buffer is owned
+    int decoderType;                    // Compressed sound decoder type (AUDIO_DECODER_NONE if data is decoded)
+    void *decoder;                      // Compressed sound decoder, decodes shared data on mixing (audio thread)
+    AudioStreamCallback callback;       // Audio stream callback, fills stream data on mixing (audio thread)
+    void *callbackData;                 // Audio stream callback user data (audio thread)
 
     rAudioBuffer *next;     // Next audio buffer on the list
     rAudioBuffer *prev;     // Previous audio buffer on the list
@@ -220,6 +363,104 @@ struct rAudioBuffer {
 
 #define AudioBuffer rAudioBuffer        // HACK: To avoid CoreAudio (macOS) symbol collision
 
+// Audio command type, game thread requests applied by audio thread
+typedef enum {
+    AUDIO_COMMAND_TRACK = 0,        // Track audio buffer (add to mixing list)
+    AUDIO_COMMAND_UNTRACK,          // Untrack audio buffer (remove from mixing list)
+    AUDIO_COMMAND_PLAY,             // Play audio buffer from start
+    AUDIO_COMMAND_CONTINUE,         // Play audio buffer from current frame cursor position
+    AUDIO_COMMAND_PLAY_SOURCE,      // Play source audio buffer data from frame (voices pool)
+    AUDIO_COMMAND_STOP,             // Stop audio buffer
+    AUDIO_COMMAND_PAUSE,            // Pause audio buffer
+    AUDIO_COMMAND_RESUME,           // Resume audio buffer
+    AUDIO_COMMAND_VOLUME,           // Set audio buffer volume
+    AUDIO_COMMAND_PITCH,            // Set audio buffer output sample rate (pitch)
+    AUDIO_COMMAND_BUS,              // Set audio buffer mixing bus
+    AUDIO_COMMAND_BUS_VOLUME,       // Set bus volume
+    AUDIO_COMMAND_BUS_EFFECT,       // Set bus effect (type, parameters and delay line), added if new
+    AUDIO_COMMAND_BUS_CLEAR,        // Remove bus effects
+    AUDIO_COMMAND_EMITTER,          // Set audio buffer spatial emitter (slot and position), mixed with emitter gains
+    AUDIO_COMMAND_CALLBACK          // Set audio stream callback, stream data is pulled on mixing
+} AudioCommandType;
+
+// Audio command, queued by game thread
+typedef struct AudioCommand {
+    int type;               // Command type (AudioCommandType)
+    AudioBuffer *buffer;    // Audio buffer
+    AudioBuffer *source;    // Source audio buffer (AUDIO_COMMAND_PLAY_SOURCE)
+    float value;            // Command value (volume, sample rate)
+    unsigned int frame;     // Command frame cursor position (AUDIO_COMMAND_PLAY_SOURCE) or bus index (bus commands)
+    int effect;             // Bus effect index (AUDIO_COMMAND_BUS_EFFECT)
+    int effectType;         // Bus effect type (AudioEffectType)
+    float params[3];        // Bus effect parameters
+    float *data;            // Bus effect delay line (allocated by game thread)
+    unsigned int dataSize;  // Bus effect delay line size in frames
+    AudioStreamCallback callback;   // Audio stream callback (NULL to restore queued data)
+    void *userData;         // Audio stream callback user data
+} AudioCommand;
+
+// Bus effect state (audio thread)
+typedef struct AudioEffect {
+    int type;               // Effect type (AudioEffectType)
+    float params[3];        // Effect parameters
+    float b0, b1, b2, a1, a2;           // Biquad filter coefficients (normalized)
+    float z1[DEVICE_CHANNELS];          // Biquad filter state (transposed direct form II)
+    float z2[DEVICE_CHANNELS];          // Biquad filter state (transposed direct form II)
+    float *delayLine;       // Delay line (interleaved frames)
+    unsigned int delaySize;             // Delay line size in frames
+    unsigned int delayFrames;           // Delay time in frames
+    unsigned int delayCursor;           // Delay line write position
+    float threshold;        // Compressor threshold (linear)
+    float attack;           // Compressor and ducker envelope attack coefficient (by frame)
+    float release;          // Compressor and ducker envelope release coefficient (by frame)
+    float envelope;         // Compressor envelope or ducker gain
+} AudioEffect;
+
+// Mixing bus (audio thread), sounds mixed into a bus are processed by bus effects and mixed into master bus
+typedef struct AudioBus {
+    float volume;           // Bus volume requested
+    float mixVolume;        // Bus volume applied on last mixing, ramped to volume
+    int effectsCount;       // Bus effects count
+    AudioEffect effects[MAX_AUDIO_BUS_EFFECTS];     // Bus effects (processed in order)
+    float level;            // Bus peak level on last block (before effects), ducker key
+    bool mixed;             // Bus received audio on current block
+} AudioBus;
+
+// Audio voice, sound instance played by voices manager
+// NOTE: Only most audible voices are mixed (using a pool buffer), others are virtual:
+// their playback position is tracked with mixing frames counter but they are not mixed
+typedef struct AudioVoice {
+    AudioBuffer *source;        // Sound audio buffer played (NULL for free voices)
+    int pool;                   // Pool buffer mixing voice (-1 for virtual voices)
+    float volume;               // Voice volume
+    float distance;             // Voice emitter distance to listener
+    bool spatial;               // Voice positioned, distance computed from listener and mixed panned
+    float position[3];          // Voice emitter position (spatial voices)
+    float velocity[3];          // Voice emitter velocity (spatial voices)
+    float audibility;           // Voice audible volume (voice and sound volume, distance attenuation)
+    unsigned int startFrame;    // Mixing frames counter on voice start (playback position)
+    unsigned int generation;    // Voice slot generation (voices ids are not reused)
+} AudioVoice;
+
+// Spatial audio state, listener and emitters (stored by components, processed in batch by mixer)
+// NOTE: Game thread writes its copy, it is published once by frame (UpdateAudioSpatial()),
+// audio thread takes published copy and computes all emitters gains and doppler ratios
+typedef struct AudioSpatial {
+    float listenerPosition[3];          // Listener position
+    float listenerRight[3];             // Listener right direction (normalized), pan axis
+    float listenerVelocity[3];          // Listener velocity
+    float minDistance;                  // Distance with no attenuation
+    float maxDistance;                  // Distance with full attenuation (0.0f: no distance attenuation)
+    float dopplerFactor;                // Doppler effect scale (0.0f: no doppler)
+    int emittersCount;                  // Emitters slots in use range
+    float positionX[MAX_AUDIO_EMITTERS];
+    float positionY[MAX_AUDIO_EMITTERS];
+    float positionZ[MAX_AUDIO_EMITTERS];
+    float velocityX[MAX_AUDIO_EMITTERS];
+    float velocityY[MAX_AUDIO_EMITTERS];
+    float velocityZ[MAX_AUDIO_EMITTERS];
+} AudioSpatial;
+
 // Audio buffers are tracked in a linked list
 static AudioBuffer *firstAudioBuffer = NULL;    // Pointer to first AudioBuffer in the list
 static AudioBuffer *lastAudioBuffer = NULL;     // Pointer to last AudioBuffer in the list
@@ -227,20 +468,141 @@ static AudioBuffer *lastAudioBuffer = NULL;     // Pointer to last AudioBuffer i
 // miniaudio global variables
 static ma_context context;                      // miniaudio context data
 static ma_device device;                        // miniaudio device
-static ma_mutex audioLock;                      // miniaudio mutex lock
 static bool isAudioInitialized = false;         // Check if audio device is initialized
+static unsigned int deviceSampleRate = DEVICE_SAMPLE_RATE;  // Device sample rate, sounds are converted to it on loading
 static float masterVolume = 1.0f;               // Master volume (multiplied on output mixing)
-
-// Multi channel playback global variables
-static AudioBuffer *audioBufferPool[MAX_AUDIO_BUFFER_POOL_CHANNELS] = { 0 };         // Multichannel AudioBuffer pointers pool
-static unsigned int audioBufferPoolCounter = 0;                                      // AudioBuffer pointers pool counter
-static unsigned int audioBufferPoolChannels[MAX_AUDIO_BUFFER_POOL_CHANNELS] = { 0 }; // AudioBuffer pool channels
+static float mixMasterVolume = 1.0f;            // Master volume applied on last mixing (audio thread), ramped to masterVolume
+
+// Mixing buses global variables
+static AudioBus audioBuses[MAX_AUDIO_BUSES] = { 0 };    // Mixing buses state (audio thread)
+static float audioBusFrames[MAX_AUDIO_BUSES][AUDIO_MIX_BLOCK_SIZE*DEVICE_CHANNELS] = { 0 };   // Buses mixing block (audio thread)
+static int audioBusEffectsCount[MAX_AUDIO_BUSES] = { 0 };                           // Buses effects added (game thread)
+static int audioBusEffectsType[MAX_AUDIO_BUSES][MAX_AUDIO_BUS_EFFECTS] = { 0 };     // Buses effects types (game thread)
+static float *audioBusEffectsData[MAX_AUDIO_BUSES][MAX_AUDIO_BUS_EFFECTS] = { 0 };  // Buses effects delay lines (game thread, released on clear)
+static unsigned int audioBusEffectsDataSize[MAX_AUDIO_BUSES][MAX_AUDIO_BUS_EFFECTS] = { 0 };  // Buses effects delay lines size in frames
+
+// Spatial audio global variables
+static AudioSpatial audioSpatial = { { 0 }, { 1.0f, 0.0f, 0.0f }, { 0 }, 0.0f, 0.0f, 1.0f, 0 };   // Listener and emitters (game thread)
+static AudioSpatial audioSpatialShared = { 0 };     // Listener and emitters published (read by audio thread while pending)
+static volatile bool audioSpatialPending = false;   // Published copy not taken by audio thread yet (game thread must not write it)
+static AudioSpatial mixSpatial = { { 0 }, { 1.0f, 0.0f, 0.0f }, { 0 }, 0.0f, 0.0f, 1.0f, 0 };     // Listener and emitters mixed (audio thread)
+static float mixEmittersGain[DEVICE_CHANNELS][MAX_AUDIO_EMITTERS] = { 0 };  // Emitters channels gains, attenuation and pan (audio thread)
+static float mixEmittersDoppler[MAX_AUDIO_EMITTERS] = { 0 };                // Emitters doppler pitch ratios (audio thread)
+static bool audioEmittersUsed[MAX_AUDIO_EMITTERS] = { 0 };                  // Emitters slots in use (game thread)
+
+// Audio commands queue, single producer (game thread) single consumer (audio thread) ring buffer
+// NOTE: Audio thread owns tracked buffers list and mixing state, it never waits on game thread
+static AudioCommand audioCommands[AUDIO_COMMAND_QUEUE_SIZE] = { 0 };   // Audio commands ring buffer
+static volatile unsigned int audioCommandsWritten = 0;                 // Audio commands queued (written by game thread)
+static volatile unsigned int audioCommandsRead = 0;                    // Audio commands applied (written by audio thread)
+static ma_mutex audioCommandsLock;              // Audio commands producers lock (game and music streaming threads), audio thread never locks
+
+// Music streaming thread global variables
+static Music musicStreams[MAX_MUSIC_STREAMS] = { 0 };   // Music streams loaded (buffers refilled by streaming thread)
+static ma_mutex musicStreamsLock;               // Music streams (decoders) lock, shared by game and music streaming threads
+static ma_thread musicStreamThread;             // Music streaming thread
+static volatile bool musicStreamThreadRunning = false;  // Music streaming thread running (UpdateMusicStream() is not required)
+static bool musicStreamLocksReady = false;      // Music streaming locks initialized
+static float musicStreamBufferTime = 0.0f;      // Audio streams buffer length (seconds), 0.0f for default (AUDIO_BUFFER_SIZE)
+static MusicModuleCache *musicModuleCaches[MAX_MUSIC_STREAMS] = { 0 };  // Music modules pre-rendered caches (shared with streaming thread)
+static bool musicModuleCacheEnabled = false;    // Music modules loaded are pre-rendered (SetMusicModuleCache())
+
+// Multi channel playback global variables (voices manager)
+static AudioBuffer *audioBufferPool[MAX_AUDIO_VOICES_MIXED] = { 0 };     // Voices mixing AudioBuffer pointers pool (created on first use)
+static int audioBufferPoolVoice[MAX_AUDIO_VOICES_MIXED] = { 0 };         // Voice slot + 1 mixed by pool buffer (0 if pool buffer is free)
+static AudioVoice audioVoices[MAX_AUDIO_VOICES] = { 0 };                 // Voices playing (mixed or virtual)
+static int audioVoicesLimit = MAX_AUDIO_BUFFER_POOL_CHANNELS;            // Max voices mixed
+static float voicesMinDistance = 0.0f;          // Voices distance with no attenuation
+static float voicesMaxDistance = 0.0f;          // Voices distance with full attenuation (0.0f: no distance attenuation)
+static volatile unsigned int mixFramesCounter = 0;  // Frames mixed since device start (written by audio thread), voices clock
+static int mixDecodersActive = 0;               // Compressed sounds decoders mixing (audio thread)
+
+// Audio statistics global variables
+// NOTE: Mixing counters are written by audio thread, game thread requests their reset (GetAudioStats())
+static ma_timer audioStatsTimer;                // Audio statistics timer (initialized with audio device)
+static volatile bool audioStatsReset = false;   // Mixing counters reset requested (applied by audio thread)
+static float mixStatsTimeMin = 0.0f;            // Audio callback min time (audio thread)
+static float mixStatsTimeMax = 0.0f;            // Audio callback max time (audio thread)
+static float mixStatsTimeTotal = 0.0f;          // Audio callbacks total time (audio thread)
+static float mixStatsPeriod = 0.0f;             // Audio callback period (audio thread), last callback frames duration
+static unsigned int mixStatsCallbacks = 0;      // Audio callbacks counted (audio thread)
+static int mixStatsBuffers = 0;                 // Audio buffers mixed on last callback (audio thread)
+static volatile unsigned int mixStatsUnderruns = 0;     // Streams underruns since device start (audio thread)
+static unsigned int audioStatsUnderruns = 0;    // Streams underruns on last GetAudioStats() (game thread)
+static float audioStatsWaitTime = 0.0f;         // Producers time waiting on audio thread (commands queue full, commands applied) and locks
+static unsigned int audioStatsWaits = 0;        // Producers waits counted
+
+// Audio data conversion global variables
+static int audioConversionQuality = AUDIO_CONVERSION_LINEAR;   // Sample rate conversion quality (AudioConversionQuality)
+static AudioConversionCache *audioConversionCache = NULL;      // Converted data cache (NULL if disabled)
+static int audioConversionCacheNext = 0;        // Next cache entry replaced when cache is full
+static ma_mutex audioConversionLock;            // Conversion cache lock, only used while conversion threads run
+static bool audioConversionLockReady = false;   // Conversion threads running (cache must be locked)
 
 // miniaudio functions declaration
 static void OnLog(ma_context *pContext, ma_device *pDevice, ma_uint32 logLevel, const char *message);
 static void OnSendAudioDataToDevice(ma_device *pDevice, void *pFramesOut, const void *pFramesInput, ma_uint32 frameCount);
 static ma_uint32 OnAudioBufferDSPRead(ma_pcm_converter *pDSP, void *pFramesOut, ma_uint32 frameCount, void *pUserData);
-static void MixAudioFrames(float *framesOut, const float *framesIn, ma_uint32 frameCount, float localVolume);
+static void MixAudioFrames(float *framesOut, const float *framesIn, ma_uint32 frameCount, ma_uint32 channels, float startVolume, float endVolume);
+static void MixAudioBlock(float *framesOut, ma_uint32 frameCount);   // Mix playing buffers block into buses, process buses effects (audio thread)
+static void ScaleAudioFrames(float *frames, ma_uint32 frameCount, ma_uint32 channels, float startGain, float endGain);  // Scale frames by gain ramp
+static float GetAudioFramesPeak(const float *frames, ma_uint32 sampleCount);  // Get frames peak level (max absolute sample)
+static void MixAudioFramesPanned(float *framesOut, const float *framesIn, ma_uint32 frameCount, const float *startGain, const float *endGain);  // Mix stereo frames by channels gains ramp
+static void ClampAudioFrames(float *frames, ma_uint32 sampleCount);
+
+// Audio commands functions declaration
+static void PushAudioCommand(int type, AudioBuffer *buffer, AudioBuffer *source, float value, unsigned int frame);  // Queue audio command (applied directly if audio device is not running)
+static void QueueAudioCommand(AudioCommand command);    // Queue audio command (applied directly if audio device is not running)
+static void ProcessAudioCommands(void);                 // Apply queued audio commands (audio thread)
+static void ProcessAudioCommand(AudioCommand command);  // Apply audio command
+static void WaitAudioCommands(void);                    // Wait for queued audio commands to be applied
+static void StopAudioBufferMixing(AudioBuffer *buffer); // Stop audio buffer mixing (audio thread)
+static void ReleaseAudioData(AudioData *shared);        // Release shared audio data reference (data released with last reference)
+
+// Mixing buses functions declaration
+static void SetAudioEffectParams(AudioEffect *effect, const float *params);   // Set bus effect parameters, coefficients computed (audio thread)
+static void ProcessAudioEffect(AudioEffect *effect, float *frames, ma_uint32 frameCount);  // Process bus effect on frames block (audio thread)
+static void PushAudioBusEffect(int bus, int effect, int type, float param0, float param1, float param2);    // Queue bus effect set command
+static void ResetAudioBuses(void);                      // Reset buses (effects removed, volumes reset), audio thread must be stopped
+
+// Spatial audio functions declaration
+static int AttachAudioEmitter(AudioBuffer *buffer, const float *position, const float *velocity);  // Attach spatial emitter to audio buffer, position set (returns emitter slot)
+static void DetachAudioEmitter(AudioBuffer *buffer);    // Detach spatial emitter from audio buffer (mixed not panned again)
+static void ComputeAudioEmitters(int first, int last);  // Compute emitters gains and doppler ratios in batch (audio thread)
+static void ApplyAudioDoppler(AudioBuffer *buffer, float doppler);     // Apply doppler ratio to audio buffer pitch (audio thread)
+static float GetAudioSpatialDistance(const float *position);           // Get position distance to listener (game thread)
+static void SyncAudioVoiceEmitter(int slot);            // Sync mixed voice emitter with voice position (pool buffer)
+
+// Music streaming functions declaration
+static Music *GetMusicStream(AudioBuffer *buffer);      // Get loaded music stream state from its audio buffer (NULL if not found)
+static void ResetMusicStream(Music music);              // Reset music decoder to music start
+static void UpdateMusicStreamBuffers(Music *music);     // Refill music stream processed buffers with decoded data
+static ma_thread_result MA_THREADCALL MusicStreamThread(void *data);   // Music streaming thread, refills playing music streams buffers
+static MusicModuleCache *LoadMusicModuleCache(Music music, const char *fileName);  // Load music module pre-rendered cache, pre-rendering thread started
+static void UnloadMusicModuleCache(MusicModuleCache *cache);           // Unload music module pre-rendered cache, pre-rendering thread stopped
+static MusicModuleCache *GetMusicModuleCache(void *module);            // Get music module pre-rendered cache (NULL if module is not pre-rendered)
+static bool ReadMusicModuleCache(MusicModuleCache *cache, short *pcm, unsigned int frameCount);    // Read music module frames from cache (false if module must be rendered)
+static ma_thread_result MA_THREADCALL MusicModuleCacheThread(void *data);  // Music module pre-rendering thread
+
+// Audio data conversion functions declaration
+static ma_uint32 OnAudioConversionRead(ma_pcm_converter *pDSP, void *pFramesOut, ma_uint32 frameCount, void *pUserData);   // Conversion source read callback
+static ma_uint32 ConvertAudioFrames(void *framesOut, ma_format formatOut, ma_uint32 channelsOut, ma_uint32 sampleRateOut,
+                                    const void *framesIn, ma_format formatIn, ma_uint32 channelsIn, ma_uint32 sampleRateIn, ma_uint32 frameCountIn);  // Convert frames (NULL output to get frames count)
+static ma_thread_result MA_THREADCALL WaveFormatThread(void *data);    // Waves conversion thread (WaveFormatBatch())
+
+// Compressed sounds functions declaration
+static void *OpenAudioDecoder(int type, const unsigned char *data, unsigned int dataSize, unsigned int *channels, unsigned int *sampleRate, unsigned int *frameCount);  // Open decoder on encoded data
+static void CloseAudioDecoder(int type, void *decoder);                 // Close decoder (encoded data is not released)
+static void SeekAudioDecoderStart(int type, void *decoder);             // Seek decoder to data start
+static ma_uint32 ReadAudioDecoderFrames(int type, void *decoder, ma_uint32 channels, float *framesOut, ma_uint32 frameCount);   // Decode frames (float)
+
+// Voices manager functions declaration
+static int GetAudioVoice(int voice);                    // Get voice slot from voice id (-1 if voice is not playing)
+static float GetAudioVoiceAudibility(const AudioVoice *voice);     // Get voice audible volume
+static bool CheckAudioVoicePrecedence(int priority, float audibility, const AudioVoice *voice);  // Check if voice parameters take precedence over voice
+static int FindWeakestAudioVoice(AudioBuffer *source);  // Find voice with lowest priority and audibility (of a sound if source not NULL)
+static void StopAudioVoice(int slot);                   // Stop voice (pool buffer is released)
+static int CompareAudioVoices(const void *a, const void *b);  // Compare voices slots precedence (qsort() callback)
 
 // AudioBuffer management functions declaration
 // NOTE: Those functions are not exposed by raylib... for the moment
@@ -276,87 +638,233 @@ static void OnSendAudioDataToDevice(ma_device *pDevice, void *pFramesOut, const
 {
     (void)pDevice;
 
+    double startTime = ma_timer_get_time_in_seconds(&audioStatsTimer);
+
     // Mixing is basically just an accumulation, we need to initialize the output buffer to 0
     memset(pFramesOut, 0, frameCount*pDevice->playback.channels*ma_get_bytes_per_sample(pDevice->playback.format));
 
-    // Using a mutex here for thread-safety which makes things not real-time
-    // This is unlikely to be necessary for this project, but may want to consider how you might want to avoid this
-    ma_mutex_lock(&audioLock);
+    // Game thread requests are applied before mixing, no lock required (audio thread never waits)
+    ProcessAudioCommands();
+
+    // Listener and emitters published are taken, all emitters gains are computed at once
+    if (audioSpatialPending)
+    {
+        ma_memory_barrier();    // Published copy is read after the flag
+        memcpy(&mixSpatial, &audioSpatialShared, sizeof(AudioSpatial));
+        ma_memory_barrier();
+        audioSpatialPending = false;
+
+        ComputeAudioEmitters(0, mixSpatial.emittersCount);
+    }
+
+    // Mixing is done by blocks, buses effects are processed once by block
+    for (ma_uint32 framesMixed = 0; framesMixed < frameCount; framesMixed += AUDIO_MIX_BLOCK_SIZE)
+    {
+        ma_uint32 blockFrames = ((frameCount - framesMixed) < AUDIO_MIX_BLOCK_SIZE)? (frameCount - framesMixed) : AUDIO_MIX_BLOCK_SIZE;
+
+        MixAudioBlock((float *)pFramesOut + framesMixed*device.playback.channels, blockFrames);
+    }
+
+    mixFramesCounter += frameCount;
+
+    // Mixed voices could exceed output range
+    ClampAudioFrames((float *)pFramesOut, frameCount*device.playback.channels);
+
+    // Audio callback statistics, mixing time (milliseconds) compared with callback period
+    float time = (float)((ma_timer_get_time_in_seconds(&audioStatsTimer) - startTime)*1000.0);
+
+    if (audioStatsReset || (mixStatsCallbacks == 0))
+    {
+        mixStatsTimeMin = time;
+        mixStatsTimeMax = time;
+        mixStatsTimeTotal = 0.0f;
+        mixStatsCallbacks = 0;
+        audioStatsReset = false;
+    }
+
+    if (time < mixStatsTimeMin) mixStatsTimeMin = time;
+    if (time > mixStatsTimeMax) mixStatsTimeMax = time;
+    mixStatsTimeTotal += time;
+    mixStatsCallbacks++;
+    mixStatsPeriod = (float)frameCount*1000.0f/(float)deviceSampleRate;
+
+    mixStatsBuffers = 0;
+    for (AudioBuffer *audioBuffer = firstAudioBuffer; audioBuffer != NULL; audioBuffer = audioBuffer->next)
+    {
+        if (audioBuffer->mixPlaying && !audioBuffer->mixPaused) mixStatsBuffers++;
+    }
+}
+
+// Mix playing buffers block into buses, process buses effects (audio thread)
+// NOTE: framesOut (master bus) is initially filled with zeros
+static void MixAudioBlock(float *framesOut, ma_uint32 frameCount)
+{
+    float master = masterVolume;
+
+    for (int i = 1; i < MAX_AUDIO_BUSES; i++) audioBuses[i].mixed = false;
+
+    for (AudioBuffer *audioBuffer = firstAudioBuffer; audioBuffer != NULL; audioBuffer = audioBuffer->next)
     {
-        for (AudioBuffer *audioBuffer = firstAudioBuffer; audioBuffer != NULL; audioBuffer = audioBuffer->next)
+        // Ignore stopped or paused sounds
+        if (!audioBuffer->mixPlaying || audioBuffer->mixPaused) continue;
+
+        ma_uint32 framesRead = 0;
+
+        // Buffers on a bus are mixed into bus block, master volume is applied on bus mixing
+        AudioBus *bus = &audioBuses[audioBuffer->mixBus];
+        float *busFrames = (audioBuffer->mixBus == 0)? framesOut : audioBusFrames[audioBuffer->mixBus];
+        float busMaster = (audioBuffer->mixBus == 0)? master : 1.0f;
+
+        if ((audioBuffer->mixBus != 0) && !bus->mixed)
+        {
+            memset(busFrames, 0, frameCount*DEVICE_CHANNELS*sizeof(float));
+            bus->mixed = true;
+        }
+
+        // NOTE: Volume changes are ramped on first frames read, avoids clicks on sudden volume changes
+        float volume = audioBuffer->mixVolume*((audioBuffer->mixBus == 0)? mixMasterVolume : 1.0f);
+
+        // Positioned buffers are panned, emitter gains changes are ramped like volume
+        bool panned = (audioBuffer->mixEmitter != -1);
+        float gain[DEVICE_CHANNELS] = { 0 };
+
+        if (panned)
+        {
+            for (int c = 0; c < DEVICE_CHANNELS; c++) gain[c] = mixEmittersGain[c][audioBuffer->mixEmitter];
+            ApplyAudioDoppler(audioBuffer, mixEmittersDoppler[audioBuffer->mixEmitter]);
+        }
+
+        while (1)
         {
-            // Ignore stopped or paused sounds
-            if (!audioBuffer->playing || audioBuffer->paused) continue;
+            if (framesRead > frameCount)
+            {
+                TraceLog(LOG_DEBUG, "Mixed too many frames from audio buffer");
+                break;
+            }
 
-            ma_uint32 framesRead = 0;
+            if (framesRead == frameCount) break;
 
-            while (1)
+            // Just read as much data as we can from the stream
+            ma_uint32 framesToRead = (frameCount - framesRead);
+
+            while (framesToRead > 0)
             {
-                if (framesRead > frameCount)
+                float tempBuffer[1024]; // 512 frames for stereo
+
+                ma_uint32 framesToReadRightNow = framesToRead;
+                if (framesToReadRightNow > sizeof(tempBuffer)/sizeof(tempBuffer[0])/DEVICE_CHANNELS)
                 {
-                    TraceLog(LOG_DEBUG, "Mixed too many frames from audio buffer");
-                    break;
+                    framesToReadRightNow = sizeof(tempBuffer)/sizeof(tempBuffer[0])/DEVICE_CHANNELS;
                 }
 
-                if (framesRead == frameCount) break;
-
-                // Just read as much data as we can from the stream
-                ma_uint32 framesToRead = (frameCount - framesRead);
+                ma_uint32 framesJustRead = 0;
 
-                while (framesToRead > 0)
+                // Callback streams in device format (no pitch) write straight into mixing block, converter is skipped
+                if ((audioBuffer->callback != NULL) &&
+                    (audioBuffer->dsp.formatConverterIn.config.formatIn == DEVICE_FORMAT) &&
+                    (audioBuffer->dsp.formatConverterIn.config.channels == DEVICE_CHANNELS) &&
+                    (audioBuffer->dsp.src.config.sampleRateIn == audioBuffer->dsp.src.config.sampleRateOut))
                 {
-                    float tempBuffer[1024]; // 512 frames for stereo
+                    audioBuffer->callback(tempBuffer, framesToReadRightNow, audioBuffer->callbackData);
+                    framesJustRead = framesToReadRightNow;
+                }
+                else framesJustRead = (ma_uint32)ma_pcm_converter_read(&audioBuffer->dsp, tempBuffer, framesToReadRightNow);
+                if (framesJustRead > 0)
+                {
+                    float *framesMix = busFrames + (framesRead*DEVICE_CHANNELS);
+                    float *framesIn  = tempBuffer;
 
-                    ma_uint32 framesToReadRightNow = framesToRead;
-                    if (framesToReadRightNow > sizeof(tempBuffer)/sizeof(tempBuffer[0])/DEVICE_CHANNELS)
-                    {
-                        framesToReadRightNow = sizeof(tempBuffer)/sizeof(tempBuffer[0])/DEVICE_CHANNELS;
-                    }
+                    float targetVolume = audioBuffer->mixVolumeTarget*busMaster;
 
-                    ma_uint32 framesJustRead = (ma_uint32)ma_pcm_converter_read(&audioBuffer->dsp, tempBuffer, framesToReadRightNow);
-                    if (framesJustRead > 0)
+                    if (panned)
                     {
-                        float *framesOut = (float *)pFramesOut + (framesRead*device.playback.channels);
-                        float *framesIn  = tempBuffer;
+                        float startGain[DEVICE_CHANNELS] = { 0 };
+                        float endGain[DEVICE_CHANNELS] = { 0 };
 
-                        MixAudioFrames(framesOut, framesIn, framesJustRead, audioBuffer->volume);
+                        for (int c = 0; c < DEVICE_CHANNELS; c++)
+                        {
+                            startGain[c] = audioBuffer->mixGain[c]*volume;
+                            endGain[c] = gain[c]*targetVolume;
+                            audioBuffer->mixGain[c] = gain[c];
+                        }
 
-                        framesToRead -= framesJustRead;
-                        framesRead += framesJustRead;
+                        MixAudioFramesPanned(framesMix, framesIn, framesJustRead, startGain, endGain);
                     }
-                    
-                    if (!audioBuffer->playing)
+                    else MixAudioFrames(framesMix, framesIn, framesJustRead, DEVICE_CHANNELS, volume, targetVolume);
+
+                    volume = targetVolume;
+
+                    framesToRead -= framesJustRead;
+                    framesRead += framesJustRead;
+                }
+                
+                if (!audioBuffer->mixPlaying)
+                {
+                    framesRead = frameCount;
+                    break;
+                }
+
+                // If we weren't able to read all the frames we requested, break
+                if (framesJustRead < framesToReadRightNow)
+                {
+                    if (!audioBuffer->looping)
                     {
-                        framesRead = frameCount;
+                        StopAudioBufferMixing(audioBuffer);
                         break;
                     }
-
-                    // If we weren't able to read all the frames we requested, break
-                    if (framesJustRead < framesToReadRightNow)
+                    else
                     {
-                        if (!audioBuffer->looping)
-                        {
-                            StopAudioBuffer(audioBuffer);
-                            break;
-                        }
-                        else
-                        {
-                            // Should never get here, but just for safety,
-                            // move the cursor position back to the start and continue the loop
-                            audioBuffer->frameCursorPos = 0;
-                            continue;
-                        }
+                        // Should never get here, but just for safety,
+                        // move the cursor position back to the start and continue the loop
+                        audioBuffer->frameCursorPos = 0;
+                        continue;
                     }
                 }
-
-                // If for some reason we weren't able to read every frame we'll need to break from the loop
-                // Not doing this could theoretically put us into an infinite loop
-                if (framesToRead > 0) break;
             }
+
+            // If for some reason we weren't able to read every frame we'll need to break from the loop
+            // Not doing this could theoretically put us into an infinite loop
+            if (framesToRead > 0) break;
+        }
+
+        audioBuffer->mixVolume = audioBuffer->mixVolumeTarget;
+    }
+
+    // Buses levels are measured before effects (ducker keys)
+    for (int i = 1; i < MAX_AUDIO_BUSES; i++)
+    {
+        AudioBus *bus = &audioBuses[i];
+
+        // NOTE: Buses with effects are processed without input, effects tails (delay) keep ringing
+        if (!bus->mixed && (bus->effectsCount > 0))
+        {
+            memset(audioBusFrames[i], 0, frameCount*DEVICE_CHANNELS*sizeof(float));
+            bus->mixed = true;
+        }
+
+        bus->level = bus->mixed? GetAudioFramesPeak(audioBusFrames[i], frameCount*DEVICE_CHANNELS) : 0.0f;
+    }
+
+    // Buses effects are processed once by bus, then buses are mixed into master bus
+    for (int i = 1; i < MAX_AUDIO_BUSES; i++)
+    {
+        AudioBus *bus = &audioBuses[i];
+
+        if (bus->mixed)
+        {
+            for (int e = 0; e < bus->effectsCount; e++) ProcessAudioEffect(&bus->effects[e], audioBusFrames[i], frameCount);
+
+            MixAudioFrames(framesOut, audioBusFrames[i], frameCount, DEVICE_CHANNELS, bus->mixVolume*mixMasterVolume, bus->volume*master);
         }
+
+        bus->mixVolume = bus->volume;
     }
 
-    ma_mutex_unlock(&audioLock);
+    // Master bus effects
+    audioBuses[0].level = GetAudioFramesPeak(framesOut, frameCount*DEVICE_CHANNELS);
+    for (int e = 0; e < audioBuses[0].effectsCount; e++) ProcessAudioEffect(&audioBuses[0].effects[e], framesOut, frameCount);
+
+    mixMasterVolume = master;
 }
 
 // DSP read from audio buffer callback function
@@ -364,10 +872,44 @@ static ma_uint32 OnAudioBufferDSPRead(ma_pcm_converter *pDSP, void *pFramesOut,
 {
     AudioBuffer *audioBuffer = (AudioBuffer *)pUserData;
 
-    ma_uint32 subBufferSizeInFrames = (audioBuffer->bufferSizeInFrames > 1)? audioBuffer->bufferSizeInFrames/2 : audioBuffer->bufferSizeInFrames;
+    // Callback streams data is requested on the fly, sub-buffers are not used
+    if (audioBuffer->callback != NULL)
+    {
+        audioBuffer->callback(pFramesOut, frameCount, audioBuffer->callbackData);
+        return frameCount;
+    }
+
+    // Compressed sounds are decoded on the fly, data is read from decoder
+    if (audioBuffer->decoder != NULL)
+    {
+        ma_uint32 channels = audioBuffer->dsp.formatConverterIn.config.channels;
+        ma_uint32 framesRead = 0;
+
+        while (framesRead < frameCount)
+        {
+            ma_uint32 framesDecoded = ReadAudioDecoderFrames(audioBuffer->decoderType, audioBuffer->decoder, channels, (float *)pFramesOut + framesRead*channels, frameCount - framesRead);
+            framesRead += framesDecoded;
+
+            if (framesRead < frameCount)
+            {
+                // End of data reached, decoder is restarted for looping buffers
+                if (audioBuffer->looping && (framesDecoded > 0)) SeekAudioDecoderStart(audioBuffer->decoderType, audioBuffer->decoder);
+                else
+                {
+                    memset((float *)pFramesOut + framesRead*channels, 0, (frameCount - framesRead)*channels*sizeof(float));
+                    break;
+                }
+            }
+        }
+
+        return framesRead;
+    }
+
+    ma_uint32 subBufferCount = audioBuffer->subBufferCount;
+    ma_uint32 subBufferSizeInFrames = (audioBuffer->bufferSizeInFrames >= subBufferCount)? audioBuffer->bufferSizeInFrames/subBufferCount : audioBuffer->bufferSizeInFrames;
     ma_uint32 currentSubBufferIndex = audioBuffer->frameCursorPos/subBufferSizeInFrames;
 
-    if (currentSubBufferIndex > 1)
+    if (currentSubBufferIndex >= subBufferCount)
     {
         TraceLog(LOG_DEBUG, "Frame cursor position moved too far forward in audio stream");
         return 0;
@@ -375,9 +917,8 @@ static ma_uint32 OnAudioBufferDSPRead(ma_pcm_converter *pDSP, void *pFramesOut,
 
     // Another thread can update the processed state of buffers so
     // we just take a copy here to try and avoid potential synchronization problems
-    bool isSubBufferProcessed[2];
-    isSubBufferProcessed[0] = audioBuffer->isSubBufferProcessed[0];
-    isSubBufferProcessed[1] = audioBuffer->isSubBufferProcessed[1];
+    bool isSubBufferProcessed[MAX_AUDIO_SUBBUFFERS];
+    for (ma_uint32 i = 0; i < subBufferCount; i++) isSubBufferProcessed[i] = audioBuffer->isSubBufferProcessed[i];
 
     ma_uint32 frameSizeInBytes = ma_get_bytes_per_sample(audioBuffer->dsp.formatConverterIn.config.formatIn)*audioBuffer->dsp.formatConverterIn.config.channels;
 
@@ -425,12 +966,12 @@ static ma_uint32 OnAudioBufferDSPRead(ma_pcm_converter *pDSP, void *pFramesOut,
             audioBuffer->isSubBufferProcessed[currentSubBufferIndex] = true;
             isSubBufferProcessed[currentSubBufferIndex] = true;
 
-            currentSubBufferIndex = (currentSubBufferIndex + 1)%2;
+            currentSubBufferIndex = (currentSubBufferIndex + 1)%subBufferCount;
 
             // We need to break from this loop if we're not looping
             if (!audioBuffer->looping)
             {
-                StopAudioBuffer(audioBuffer);
+                StopAudioBufferMixing(audioBuffer);
                 break;
             }
         }
@@ -438,6 +979,18 @@ static ma_uint32 OnAudioBufferDSPRead(ma_pcm_converter *pDSP, void *pFramesOut,
 
     // Zero-fill excess
     ma_uint32 totalFramesRemaining = (frameCount - framesRead);
+
+    // Stream underrun, counted once until stream gets data again
+    if (audioBuffer->usage == AUDIO_BUFFER_USAGE_STREAM)
+    {
+        if ((totalFramesRemaining > 0) && !audioBuffer->isStarving)
+        {
+            audioBuffer->underrunCount++;
+            mixStatsUnderruns++;
+        }
+        audioBuffer->isStarving = (totalFramesRemaining > 0);
+    }
+
     if (totalFramesRemaining > 0)
     {
         memset((unsigned char *)pFramesOut + (framesRead*frameSizeInBytes), 0, totalFramesRemaining*frameSizeInBytes);
@@ -453,928 +1006,3088 @@ static ma_uint32 OnAudioBufferDSPRead(ma_pcm_converter *pDSP, void *pFramesOut,
 
 // This is the main mixing function. Mixing is pretty simple in this project - it's just an accumulation.
 // NOTE: framesOut is both an input and an output. It will be initially filled with zeros outside of this function.
-static void MixAudioFrames(float *framesOut, const float *framesIn, ma_uint32 frameCount, float localVolume)
+// Volume goes linearly from startVolume (first frame) to endVolume (last frame), frames are interleaved (any channels)
+static void MixAudioFrames(float *framesOut, const float *framesIn, ma_uint32 frameCount, ma_uint32 channels, float startVolume, float endVolume)
 {
-    for (ma_uint32 iFrame = 0; iFrame < frameCount; ++iFrame)
+    ma_uint32 sampleCount = frameCount*channels;
+    ma_uint32 i = 0;
+
+    if (startVolume == endVolume)
+    {
+        // Constant volume, samples processed 4 by 4 whatever the channels
+#if defined(RAUDIO_SIMD_SSE)
+        __m128 volume = _mm_set1_ps(startVolume);
+
+        for (; (i + 4) <= sampleCount; i += 4) _mm_storeu_ps(framesOut + i, _mm_add_ps(_mm_loadu_ps(framesOut + i), _mm_mul_ps(_mm_loadu_ps(framesIn + i), volume)));
+#elif defined(RAUDIO_SIMD_NEON)
+        float32x4_t volume = vdupq_n_f32(startVolume);
+
+        for (; (i + 4) <= sampleCount; i += 4) vst1q_f32(framesOut + i, vmlaq_f32(vld1q_f32(framesOut + i), vld1q_f32(framesIn + i), volume));
+#endif
+        for (; i < sampleCount; i++) framesOut[i] += framesIn[i]*startVolume;
+    }
+    else
     {
-        for (ma_uint32 iChannel = 0; iChannel < device.playback.channels; ++iChannel)
+        // Volume ramp, volume step by frame
+        float step = (endVolume - startVolume)/(float)frameCount;
+
+#if defined(RAUDIO_SIMD_SSE) || defined(RAUDIO_SIMD_NEON)
+        // NOTE: Mono and stereo ramps are vectorized (4 samples are 4 or 2 frames), other channels are not
+        if ((channels == 1) || (channels == 2))
         {
-            float *frameOut = framesOut + (iFrame*device.playback.channels);
-            const float *frameIn  = framesIn  + (iFrame*device.playback.channels);
+            ma_uint32 framesByVector = 4/channels;
+            float lanes[4] = { 0 };
+            for (int lane = 0; lane < 4; lane++) lanes[lane] = startVolume + step*(float)(lane/channels);
+
+    #if defined(RAUDIO_SIMD_SSE)
+            __m128 volume = _mm_loadu_ps(lanes);
+            __m128 volumeStep = _mm_set1_ps(step*framesByVector);
+
+            for (; (i + 4) <= sampleCount; i += 4)
+            {
+                _mm_storeu_ps(framesOut + i, _mm_add_ps(_mm_loadu_ps(framesOut + i), _mm_mul_ps(_mm_loadu_ps(framesIn + i), volume)));
+                volume = _mm_add_ps(volume, volumeStep);
+            }
+    #else
+            float32x4_t volume = vld1q_f32(lanes);
+            float32x4_t volumeStep = vdupq_n_f32(step*framesByVector);
 
-            frameOut[iChannel] += (frameIn[iChannel]*masterVolume*localVolume);
+            for (; (i + 4) <= sampleCount; i += 4)
+            {
+                vst1q_f32(framesOut + i, vmlaq_f32(vld1q_f32(framesOut + i), vld1q_f32(framesIn + i), volume));
+                volume = vaddq_f32(volume, volumeStep);
+            }
+    #endif
         }
+#endif
+        for (; i < sampleCount; i++) framesOut[i] += framesIn[i]*(startVolume + step*(float)(i/channels));
     }
 }
 
-// Initialise the multichannel buffer pool
-static void InitAudioBufferPool()
+// Clamp mixed samples to output range [-1.0f..1.0f]
+static void ClampAudioFrames(float *frames, ma_uint32 sampleCount)
 {
-    // Dummy buffers
-    for (int i = 0; i < MAX_AUDIO_BUFFER_POOL_CHANNELS; i++)
+    ma_uint32 i = 0;
+
+#if defined(RAUDIO_SIMD_SSE)
+    __m128 minValue = _mm_set1_ps(-1.0f);
+    __m128 maxValue = _mm_set1_ps(1.0f);
+
+    for (; (i + 4) <= sampleCount; i += 4) _mm_storeu_ps(frames + i, _mm_min_ps(_mm_max_ps(_mm_loadu_ps(frames + i), minValue), maxValue));
+#elif defined(RAUDIO_SIMD_NEON)
+    float32x4_t minValue = vdupq_n_f32(-1.0f);
+    float32x4_t maxValue = vdupq_n_f32(1.0f);
+
+    for (; (i + 4) <= sampleCount; i += 4) vst1q_f32(frames + i, vminq_f32(vmaxq_f32(vld1q_f32(frames + i), minValue), maxValue));
+#endif
+    for (; i < sampleCount; i++)
     {
-        audioBufferPool[i] = InitAudioBuffer(DEVICE_FORMAT, DEVICE_CHANNELS, DEVICE_SAMPLE_RATE, 0, AUDIO_BUFFER_USAGE_STATIC);
+        if (frames[i] < -1.0f) frames[i] = -1.0f;
+        else if (frames[i] > 1.0f) frames[i] = 1.0f;
     }
 }
 
-// Close the audio buffers pool
-static void CloseAudioBufferPool()
+// Scale frames by gain, gain goes linearly from startGain (first frame) to endGain (last frame)
+static void ScaleAudioFrames(float *frames, ma_uint32 frameCount, ma_uint32 channels, float startGain, float endGain)
 {
-    for (int i = 0; i < MAX_AUDIO_BUFFER_POOL_CHANNELS; i++) 
+    ma_uint32 sampleCount = frameCount*channels;
+    ma_uint32 i = 0;
+    float step = (endGain - startGain)/(float)frameCount;
+
+#if defined(RAUDIO_SIMD_SSE) || defined(RAUDIO_SIMD_NEON)
+    // NOTE: Mono and stereo ramps are vectorized (4 samples are 4 or 2 frames), other channels are not
+    if ((channels == 1) || (channels == 2))
     {
-        RL_FREE(audioBufferPool[i]->buffer);
-        RL_FREE(audioBufferPool[i]);
+        ma_uint32 framesByVector = 4/channels;
+        float lanes[4] = { 0 };
+        for (int lane = 0; lane < 4; lane++) lanes[lane] = startGain + step*(float)(lane/channels);
+
+    #if defined(RAUDIO_SIMD_SSE)
+        __m128 gain = _mm_loadu_ps(lanes);
+        __m128 gainStep = _mm_set1_ps(step*framesByVector);
+
+        for (; (i + 4) <= sampleCount; i += 4)
+        {
+            _mm_storeu_ps(frames + i, _mm_mul_ps(_mm_loadu_ps(frames + i), gain));
+            gain = _mm_add_ps(gain, gainStep);
+        }
+    #else
+        float32x4_t gain = vld1q_f32(lanes);
+        float32x4_t gainStep = vdupq_n_f32(step*framesByVector);
+
+        for (; (i + 4) <= sampleCount; i += 4)
+        {
+            vst1q_f32(frames + i, vmulq_f32(vld1q_f32(frames + i), gain));
+            gain = vaddq_f32(gain, gainStep);
+        }
+    #endif
     }
+#endif
+    for (; i < sampleCount; i++) frames[i] *= (startGain + step*(float)(i/channels));
 }
 
-//----------------------------------------------------------------------------------
-// Module Functions Definition - Audio Device initialization and Closing
-//----------------------------------------------------------------------------------
-// Initialize audio device
-void InitAudioDevice(void)
+// Mix stereo frames into output by channels gains ramp (spatial emitters)
+// NOTE: Gains step by frame, two frames processed at once on SIMD path
+static void MixAudioFramesPanned(float *framesOut, const float *framesIn, ma_uint32 frameCount, const float *startGain, const float *endGain)
 {
-    // Init audio context
-    ma_context_config contextConfig = ma_context_config_init();
-    contextConfig.logCallback = OnLog;
+    float stepLeft = (endGain[0] - startGain[0])/(float)frameCount;
+    float stepRight = (endGain[1] - startGain[1])/(float)frameCount;
+    ma_uint32 i = 0;
 
-    ma_result result = ma_context_init(NULL, 0, &contextConfig, &context);
-    if (result != MA_SUCCESS)
+#if defined(RAUDIO_SIMD_SSE)
+    __m128 gain = _mm_setr_ps(startGain[0], startGain[1], startGain[0] + stepLeft, startGain[1] + stepRight);
+    __m128 step = _mm_setr_ps(2.0f*stepLeft, 2.0f*stepRight, 2.0f*stepLeft, 2.0f*stepRight);
+
+    for (; (i + 2) <= frameCount; i += 2)
     {
-        TraceLog(LOG_ERROR, "Failed to initialize audio context");
-        return;
+        _mm_storeu_ps(framesOut + i*2, _mm_add_ps(_mm_loadu_ps(framesOut + i*2), _mm_mul_ps(_mm_loadu_ps(framesIn + i*2), gain)));
+        gain = _mm_add_ps(gain, step);
     }
+#elif defined(RAUDIO_SIMD_NEON)
+    float gainInit[4] = { startGain[0], startGain[1], startGain[0] + stepLeft, startGain[1] + stepRight };
+    float stepInit[4] = { 2.0f*stepLeft, 2.0f*stepRight, 2.0f*stepLeft, 2.0f*stepRight };
+    float32x4_t gain = vld1q_f32(gainInit);
+    float32x4_t step = vld1q_f32(stepInit);
 
-    // Init audio device
-    // NOTE: Using the default device. Format is floating point because it simplifies mixing.
-    ma_device_config config = ma_device_config_init(ma_device_type_playback);
-    config.playback.pDeviceID = NULL;  // NULL for the default playback device.
-    config.playback.format    = DEVICE_FORMAT;
-    config.playback.channels  = DEVICE_CHANNELS;
-    config.capture.pDeviceID  = NULL;  // NULL for the default capture device.
-    config.capture.format     = ma_format_s16;
-    config.capture.channels   = 1;
-    config.sampleRate         = DEVICE_SAMPLE_RATE;
-    config.dataCallback       = OnSendAudioDataToDevice;
-    config.pUserData          = NULL;
+    for (; (i + 2) <= frameCount; i += 2)
+    {
+        vst1q_f32(framesOut + i*2, vmlaq_f32(vld1q_f32(framesOut + i*2), vld1q_f32(framesIn + i*2), gain));
+        gain = vaddq_f32(gain, step);
+    }
+#endif
+    for (; i < frameCount; i++)
+    {
+        framesOut[i*2] += framesIn[i*2]*(startGain[0] + stepLeft*(float)i);
+        framesOut[i*2 + 1] += framesIn[i*2 + 1]*(startGain[1] + stepRight*(float)i);
+    }
+}
 
-    result = ma_device_init(&context, &config, &device);
-    if (result != MA_SUCCESS)
+// Get frames peak level (max absolute sample)
+static float GetAudioFramesPeak(const float *frames, ma_uint32 sampleCount)
+{
+    float peak = 0.0f;
+    ma_uint32 i = 0;
+
+#if defined(RAUDIO_SIMD_SSE)
+    __m128 signMask = _mm_set1_ps(-0.0f);
+    __m128 peaks = _mm_setzero_ps();
+
+    for (; (i + 4) <= sampleCount; i += 4) peaks = _mm_max_ps(peaks, _mm_andnot_ps(signMask, _mm_loadu_ps(frames + i)));
+
+    float lanes[4];
+    _mm_storeu_ps(lanes, peaks);
+    for (int lane = 0; lane < 4; lane++) if (lanes[lane] > peak) peak = lanes[lane];
+#elif defined(RAUDIO_SIMD_NEON)
+    float32x4_t peaks = vdupq_n_f32(0.0f);
+
+    for (; (i + 4) <= sampleCount; i += 4) peaks = vmaxq_f32(peaks, vabsq_f32(vld1q_f32(frames + i)));
+
+    float lanes[4];
+    vst1q_f32(lanes, peaks);
+    for (int lane = 0; lane < 4; lane++) if (lanes[lane] > peak) peak = lanes[lane];
+#endif
+    for (; i < sampleCount; i++) if (fabsf(frames[i]) > peak) peak = fabsf(frames[i]);
+
+    return peak;
+}
+
+// Queue audio command, applied by audio thread before next mixing
+// NOTE: If audio device is not running, command is applied directly
+static void PushAudioCommand(int type, AudioBuffer *buffer, AudioBuffer *source, float value, unsigned int frame)
+{
+    AudioCommand command = { type, buffer, source, value, frame };
+
+    QueueAudioCommand(command);
+}
+
+// Queue audio command, applied by audio thread before next mixing
+// NOTE: If audio device is not running, command is applied directly
+static void QueueAudioCommand(AudioCommand command)
+{
+    if (!isAudioInitialized)
     {
-        TraceLog(LOG_ERROR, "Failed to initialize audio playback device");
-        ma_context_uninit(&context);
+        ProcessAudioCommand(command);
         return;
     }
 
-    // Keep the device running the whole time. May want to consider doing something a bit smarter and only have the device running
-    // while there's at least one sound being played.
-    result = ma_device_start(&device);
-    if (result != MA_SUCCESS)
+    // NOTE: Music streaming thread also queues commands (loops), producers are serialized
+    bool locked = musicStreamLocksReady;
+    double startTime = ma_timer_get_time_in_seconds(&audioStatsTimer);
+    bool waited = locked;
+
+    if (locked) ma_mutex_lock(&audioCommandsLock);
+
+    // Queue full, wait for audio thread to apply some commands (game thread, never happens on audio thread)
+    while ((audioCommandsWritten - audioCommandsRead) >= AUDIO_COMMAND_QUEUE_SIZE)
     {
-        TraceLog(LOG_ERROR, "Failed to start audio playback device");
-        ma_device_uninit(&device);
-        ma_context_uninit(&context);
-        return;
+        ma_sleep(1);
+        waited = true;
     }
 
-    // Mixing happens on a seperate thread which means we need to synchronize. I'm using a mutex here to make things simple, but may
-    // want to look at something a bit smarter later on to keep everything real-time, if that's necessary.
-    if (ma_mutex_init(&context, &audioLock) != MA_SUCCESS)
+    // Producers waits are counted while producers lock is held (or single producer)
+    if (waited)
     {
-        TraceLog(LOG_ERROR, "Failed to create mutex for audio mixing");
-        ma_device_uninit(&device);
-        ma_context_uninit(&context);
-        return;
+        audioStatsWaitTime += (float)((ma_timer_get_time_in_seconds(&audioStatsTimer) - startTime)*1000.0);
+        audioStatsWaits++;
     }
 
-    TraceLog(LOG_INFO, "Audio device initialized successfully");
-    TraceLog(LOG_INFO, "Audio backend: miniaudio / %s", ma_get_backend_name(context.backend));
-    TraceLog(LOG_INFO, "Audio format: %s -> %s", ma_get_format_name(device.playback.format), ma_get_format_name(device.playback.internalFormat));
-    TraceLog(LOG_INFO, "Audio channels: %d -> %d", device.playback.channels, device.playback.internalChannels);
-    TraceLog(LOG_INFO, "Audio sample rate: %d -> %d", device.sampleRate, device.playback.internalSampleRate);
-    TraceLog(LOG_INFO, "Audio buffer size: %d", device.playback.internalBufferSizeInFrames);
+    audioCommands[audioCommandsWritten & (AUDIO_COMMAND_QUEUE_SIZE - 1)] = command;
 
-    InitAudioBufferPool();
-    TraceLog(LOG_INFO, "Audio multichannel pool size: %i", MAX_AUDIO_BUFFER_POOL_CHANNELS);
+    ma_memory_barrier();        // Command (and buffer data) must be visible before it is published
+    audioCommandsWritten++;
 
-    isAudioInitialized = true;
+    if (locked) ma_mutex_unlock(&audioCommandsLock);
 }
 
-// Close the audio device for all contexts
-void CloseAudioDevice(void)
+// Apply queued audio commands (audio thread)
+static void ProcessAudioCommands(void)
 {
-    if (isAudioInitialized)
-    {
-        ma_mutex_uninit(&audioLock);
-        ma_device_uninit(&device);
-        ma_context_uninit(&context);
+    unsigned int written = audioCommandsWritten;
+    ma_memory_barrier();        // Commands published are read after the counter
 
-        CloseAudioBufferPool();
+    while (audioCommandsRead != written)
+    {
+        ProcessAudioCommand(audioCommands[audioCommandsRead & (AUDIO_COMMAND_QUEUE_SIZE - 1)]);
 
-        TraceLog(LOG_INFO, "Audio device closed successfully");
+        ma_memory_barrier();    // Command slot is released once applied
+        audioCommandsRead++;
     }
-    else TraceLog(LOG_WARNING, "Could not close audio device because it is not currently initialized");
 }
 
-// Check if device has been initialized successfully
-bool IsAudioDeviceReady(void)
+// Apply audio command
+// NOTE: Visible state (playing, paused) is set by game thread when command is queued,
+// it is set again here so last command queued always defines it
+static void ProcessAudioCommand(AudioCommand command)
 {
-    return isAudioInitialized;
-}
+    AudioBuffer *buffer = command.buffer;
 
-// Set master volume (listener)
-void SetMasterVolume(float volume)
-{
-    if (volume < 0.0f) volume = 0.0f;
-    else if (volume > 1.0f) volume = 1.0f;
+    switch (command.type)
+    {
+        case AUDIO_COMMAND_TRACK:
+        {
+            if (firstAudioBuffer == NULL) firstAudioBuffer = buffer;
+            else
+            {
+                lastAudioBuffer->next = buffer;
+                buffer->prev = lastAudioBuffer;
+            }
 
-    masterVolume = volume;
-}
+            lastAudioBuffer = buffer;
+        } break;
+        case AUDIO_COMMAND_UNTRACK:
+        {
+            if (buffer->mixPlaying && (buffer->decoder != NULL)) StopAudioBufferMixing(buffer);     // Decoder released
 
-//----------------------------------------------------------------------------------
-// Module Functions Definition - Audio Buffer management
-//----------------------------------------------------------------------------------
+            if (buffer->prev == NULL) firstAudioBuffer = buffer->next;
+            else buffer->prev->next = buffer->next;
 
-// Initialize a new audio buffer (filled with silence)
-AudioBuffer *InitAudioBuffer(ma_format format, ma_uint32 channels, ma_uint32 sampleRate, ma_uint32 bufferSizeInFrames, int usage)
-{
-    AudioBuffer *audioBuffer = (AudioBuffer *)RL_CALLOC(1, sizeof(AudioBuffer));
-
-    if (audioBuffer == NULL)
-    {
-        TraceLog(LOG_ERROR, "InitAudioBuffer() : Failed to allocate memory for audio buffer");
-        return NULL;
-    }
-    
-    audioBuffer->buffer = RL_CALLOC(bufferSizeInFrames*channels*ma_get_bytes_per_sample(format), 1);
+            if (buffer->next == NULL) lastAudioBuffer = buffer->prev;
+            else buffer->next->prev = buffer->prev;
 
-    // Audio data runs through a format converter
-    ma_pcm_converter_config dspConfig;
-    memset(&dspConfig, 0, sizeof(dspConfig));
-    dspConfig.formatIn = format;
-    dspConfig.formatOut = DEVICE_FORMAT;
-    dspConfig.channelsIn = channels;
-    dspConfig.channelsOut = DEVICE_CHANNELS;
-    dspConfig.sampleRateIn = sampleRate;
-    dspConfig.sampleRateOut = DEVICE_SAMPLE_RATE;
-    dspConfig.onRead = OnAudioBufferDSPRead;        // Callback on data reading
-    dspConfig.pUserData = audioBuffer;              // Audio data pointer
-    dspConfig.allowDynamicSampleRate = true;        // Required for pitch shifting
+            buffer->prev = NULL;
+            buffer->next = NULL;
+        } break;
+        case AUDIO_COMMAND_PLAY_SOURCE:
+        {
+            buffer->mixVolume = command.value;
+            buffer->mixVolumeTarget = command.value;
+            buffer->pitch = command.source->pitch;
+            buffer->looping = command.source->looping;
+            buffer->usage = command.source->usage;
+            buffer->mixBus = command.source->mixBus;
+            buffer->subBufferCount = command.source->subBufferCount;
+            for (unsigned int i = 0; i < buffer->subBufferCount; i++) buffer->isSubBufferProcessed[i] = false;
+            buffer->bufferSizeInFrames = command.source->bufferSizeInFrames;
+            buffer->buffer = command.source->buffer;
+            buffer->frameCursorPos = (buffer->bufferSizeInFrames > 0)? command.frame%buffer->bufferSizeInFrames : 0;
+            buffer->mixPlaying = true;
+            buffer->mixPaused = false;
+            buffer->playing = true;
+            buffer->paused = false;
+        } break;
+        case AUDIO_COMMAND_PLAY:
+        {
+            buffer->frameCursorPos = 0;
+            if (buffer->decoder != NULL) SeekAudioDecoderStart(buffer->decoderType, buffer->decoder);
+        }   // Fallthrough, play from cursor
+        case AUDIO_COMMAND_CONTINUE:
+        {
+            if ((buffer->decoder != NULL) && !buffer->mixPlaying)
+            {
+                // Compressed sounds are not played if decoders budget is exhausted
+                if (mixDecodersActive >= MAX_AUDIO_DECODERS)
+                {
+                    buffer->playing = false;
+                    buffer->paused = false;
+                    break;
+                }
 
-    ma_result result = ma_pcm_converter_init(&dspConfig, &audioBuffer->dsp);
+                mixDecodersActive++;
+            }
 
-    if (result != MA_SUCCESS)
-    {
-        TraceLog(LOG_ERROR, "InitAudioBuffer() : Failed to create data conversion pipeline");
-        RL_FREE(audioBuffer);
-        return NULL;
-    }
+            if (!buffer->mixPlaying) buffer->mixVolume = buffer->mixVolumeTarget;     // No volume ramp on playing start
+            buffer->mixPlaying = true;
+            buffer->mixPaused = false;
+            buffer->playing = true;
+            buffer->paused = false;
+        } break;
+        case AUDIO_COMMAND_STOP:
+        {
+            StopAudioBufferMixing(buffer);
+            buffer->paused = false;
+        } break;
+        case AUDIO_COMMAND_PAUSE: buffer->mixPaused = true; buffer->paused = true; break;
+        case AUDIO_COMMAND_RESUME: buffer->mixPaused = false; buffer->paused = false; break;
+        case AUDIO_COMMAND_VOLUME: buffer->mixVolumeTarget = command.value; break;
+        case AUDIO_COMMAND_PITCH:
+        {
+            buffer->mixPitch = (float)deviceSampleRate/command.value;
+            ma_pcm_converter_set_output_sample_rate(&buffer->dsp, (ma_uint32)((float)deviceSampleRate/(buffer->mixPitch*buffer->mixDoppler)));
+        } break;
+        case AUDIO_COMMAND_BUS: buffer->mixBus = (int)command.frame; break;
+        case AUDIO_COMMAND_BUS_VOLUME: audioBuses[command.frame].volume = command.value; break;
+        case AUDIO_COMMAND_BUS_EFFECT:
+        {
+            AudioBus *bus = &audioBuses[command.frame];
+            AudioEffect *effect = &bus->effects[command.effect];
 
-    // Init audio buffer values
-    audioBuffer->volume = 1.0f;
-    audioBuffer->pitch = 1.0f;
-    audioBuffer->playing = false;
-    audioBuffer->paused = false;
-    audioBuffer->looping = false;
-    audioBuffer->usage = usage;
-    audioBuffer->frameCursorPos = 0;
-    audioBuffer->bufferSizeInFrames = bufferSizeInFrames;
+            // New effect state is reset, parameters are just updated on existing effect
+            if ((command.effect >= bus->effectsCount) || (effect->type != command.effectType))
+            {
+                memset(effect, 0, sizeof(AudioEffect));
+                effect->type = command.effectType;
+                effect->envelope = (effect->type == AUDIO_EFFECT_DUCKER)? 1.0f : 0.0f;
+                effect->delayLine = command.data;
+                effect->delaySize = command.dataSize;
+                if (command.effect >= bus->effectsCount) bus->effectsCount = command.effect + 1;
+            }
 
-    // Buffers should be marked as processed by default so that a call to
-    // UpdateAudioStream() immediately after initialization works correctly
-    audioBuffer->isSubBufferProcessed[0] = true;
-    audioBuffer->isSubBufferProcessed[1] = true;
+            SetAudioEffectParams(effect, command.params);
+        } break;
+        case AUDIO_COMMAND_BUS_CLEAR: audioBuses[command.frame].effectsCount = 0; break;
+        case AUDIO_COMMAND_EMITTER:
+        {
+            // NOTE: Emitter position comes with the command, gains are right from first mixing (slots are reused)
+            buffer->mixEmitter = (int)command.frame - 1;
 
-    // Track audio buffer to linked list next position
-    TrackAudioBuffer(audioBuffer);
+            if (buffer->mixEmitter != -1)
+            {
+                int emitter = buffer->mixEmitter;
 
-    return audioBuffer;
-}
+                mixSpatial.positionX[emitter] = command.params[0];
+                mixSpatial.positionY[emitter] = command.params[1];
+                mixSpatial.positionZ[emitter] = command.params[2];
+                mixSpatial.velocityX[emitter] = 0.0f;
+                mixSpatial.velocityY[emitter] = 0.0f;
+                mixSpatial.velocityZ[emitter] = 0.0f;
 
-// Delete an audio buffer
-void CloseAudioBuffer(AudioBuffer *buffer)
-{
-    if (buffer != NULL)
-    {
-        UntrackAudioBuffer(buffer);
-        RL_FREE(buffer->buffer);
-        RL_FREE(buffer);
+                ComputeAudioEmitters(emitter, emitter + 1);
+                for (int c = 0; c < DEVICE_CHANNELS; c++) buffer->mixGain[c] = mixEmittersGain[c][emitter];
+            }
+            else ApplyAudioDoppler(buffer, 1.0f);
+        } break;
+        case AUDIO_COMMAND_CALLBACK:
+        {
+            buffer->callback = command.callback;
+            buffer->callbackData = command.userData;
+            buffer->isStarving = false;
+        } break;
+        default: break;
     }
-    else TraceLog(LOG_ERROR, "CloseAudioBuffer() : No audio buffer");
 }
 
-// Check if an audio buffer is playing
-bool IsAudioBufferPlaying(AudioBuffer *buffer)
+// Wait for queued audio commands to be applied (game thread)
+// NOTE: Required before releasing or rewriting data read by audio thread
+static void WaitAudioCommands(void)
 {
-    bool result = false;
+    if (!isAudioInitialized || (audioCommandsRead == audioCommandsWritten)) return;
 
-    if (buffer != NULL) result = (buffer->playing && !buffer->paused);
-    else TraceLog(LOG_WARNING, "IsAudioBufferPlaying() : No audio buffer");
+    double startTime = ma_timer_get_time_in_seconds(&audioStatsTimer);
 
-    return result;
+    while (isAudioInitialized && (audioCommandsRead != audioCommandsWritten)) ma_sleep(1);
+
+    // NOTE: Producers lock protects waits counters from music streaming thread
+    if (musicStreamLocksReady) ma_mutex_lock(&audioCommandsLock);
+    audioStatsWaitTime += (float)((ma_timer_get_time_in_seconds(&audioStatsTimer) - startTime)*1000.0);
+    audioStatsWaits++;
+    if (musicStreamLocksReady) ma_mutex_unlock(&audioCommandsLock);
 }
 
-// Play an audio buffer
-// NOTE: Buffer is restarted to the start.
-// Use PauseAudioBuffer() and ResumeAudioBuffer() if the playback position should be maintained.
-void PlayAudioBuffer(AudioBuffer *buffer)
+// Stop audio buffer mixing (audio thread)
+// NOTE: Called on stop command or when a non-looping buffer ends
+static void StopAudioBufferMixing(AudioBuffer *buffer)
 {
-    if (buffer != NULL)
-    {
-        buffer->playing = true;
-        buffer->paused = false;
-        buffer->frameCursorPos = 0;
-    }
-    else TraceLog(LOG_ERROR, "PlayAudioBuffer() : No audio buffer");
+    if (buffer->mixPlaying && (buffer->decoder != NULL)) mixDecodersActive--;
+
+    buffer->mixPlaying = false;
+    buffer->mixPaused = false;
+    buffer->playing = false;
+    buffer->frameCursorPos = 0;
+    for (unsigned int i = 0; i < buffer->subBufferCount; i++) buffer->isSubBufferProcessed[i] = true;
 }
 
-// Stop an audio buffer
-void StopAudioBuffer(AudioBuffer *buffer)
+// Release shared audio data reference (data released with last reference)
+static void ReleaseAudioData(AudioData *shared)
 {
-    if (buffer != NULL)
+    shared->refCount--;
+
+    if (shared->refCount == 0)
     {
-        if (IsAudioBufferPlaying(buffer))
-        {
-            buffer->playing = false;
-            buffer->paused = false;
-            buffer->frameCursorPos = 0;
-            buffer->totalFramesProcessed = 0;
-            buffer->isSubBufferProcessed[0] = true;
-            buffer->isSubBufferProcessed[1] = true;
-        }
+#if defined(RAUDIO_MAPPED_FILES)
+        if (shared->mapped) UnmapAudioFile(shared->data, shared->dataSize);
+        else
+#endif
+        RL_FREE(shared->data);
+        RL_FREE(shared);
     }
-    else TraceLog(LOG_ERROR, "StopAudioBuffer() : No audio buffer");
 }
 
-// Pause an audio buffer
-void PauseAudioBuffer(AudioBuffer *buffer)
+// Queue bus effect set command
+static void PushAudioBusEffect(int bus, int effect, int type, float param0, float param1, float param2)
 {
-    if (buffer != NULL) buffer->paused = true;
-    else TraceLog(LOG_ERROR, "PauseAudioBuffer() : No audio buffer");
-}
+    AudioCommand command = { AUDIO_COMMAND_BUS_EFFECT, NULL, NULL, 0.0f, (unsigned int)bus };
 
-// Resume an audio buffer
-void ResumeAudioBuffer(AudioBuffer *buffer)
-{
-    if (buffer != NULL) buffer->paused = false;
-    else TraceLog(LOG_ERROR, "ResumeAudioBuffer() : No audio buffer");
-}
+    command.effect = effect;
+    command.effectType = type;
+    command.params[0] = param0;
+    command.params[1] = param1;
+    command.params[2] = param2;
+    command.data = audioBusEffectsData[bus][effect];
+    command.dataSize = audioBusEffectsDataSize[bus][effect];
 
-// Set volume for an audio buffer
-void SetAudioBufferVolume(AudioBuffer *buffer, float volume)
-{
-    if (buffer != NULL) buffer->volume = volume;
-    else TraceLog(LOG_WARNING, "SetAudioBufferVolume() : No audio buffer");
+    QueueAudioCommand(command);
 }
 
-// Set pitch for an audio buffer
-void SetAudioBufferPitch(AudioBuffer *buffer, float pitch)
+// Reset buses (effects removed, volumes reset), audio thread must be stopped
+static void ResetAudioBuses(void)
 {
-    if (buffer != NULL)
+    for (int i = 0; i < MAX_AUDIO_BUSES; i++)
     {
-        float pitchMul = pitch/buffer->pitch;
+        for (int e = 0; e < audioBusEffectsCount[i]; e++) RL_FREE(audioBusEffectsData[i][e]);
 
-        // Pitching is just an adjustment of the sample rate.
-        // Note that this changes the duration of the sound:
-        //  - higher pitches will make the sound faster
-        //  - lower pitches make it slower
-        ma_uint32 newOutputSampleRate = (ma_uint32)((float)buffer->dsp.src.config.sampleRateOut/pitchMul);
-        buffer->pitch *= (float)buffer->dsp.src.config.sampleRateOut/newOutputSampleRate;
+        audioBusEffectsCount[i] = 0;
+        memset(audioBusEffectsData[i], 0, sizeof(audioBusEffectsData[i]));
+        memset(audioBusEffectsDataSize[i], 0, sizeof(audioBusEffectsDataSize[i]));
 
-        ma_pcm_converter_set_output_sample_rate(&buffer->dsp, newOutputSampleRate);
+        memset(&audioBuses[i], 0, sizeof(AudioBus));
+        audioBuses[i].volume = 1.0f;
+        audioBuses[i].mixVolume = 1.0f;
     }
-    else TraceLog(LOG_WARNING, "SetAudioBufferPitch() : No audio buffer");
 }
 
-// Track audio buffer to linked list next position
-void TrackAudioBuffer(AudioBuffer *buffer)
+// Set bus effect parameters, coefficients computed (audio thread)
+static void SetAudioEffectParams(AudioEffect *effect, const float *params)
 {
-    ma_mutex_lock(&audioLock);
+    for (int i = 0; i < 3; i++) effect->params[i] = params[i];
+
+    switch (effect->type)
     {
-        if (firstAudioBuffer == NULL) firstAudioBuffer = buffer;
-        else
+        case AUDIO_EFFECT_LOWPASS:
+        case AUDIO_EFFECT_HIGHPASS:
         {
-            lastAudioBuffer->next = buffer;
-            buffer->prev = lastAudioBuffer;
-        }
+            // Biquad filter coefficients (RBJ audio EQ cookbook), params: cutoff frequency (Hz), resonance (Q)
+            float cutoff = params[0];
+            float q = (params[1] > 0.0f)? params[1] : 0.7071f;
+
+            if (cutoff < 10.0f) cutoff = 10.0f;
+            else if (cutoff > 0.45f*deviceSampleRate) cutoff = 0.45f*deviceSampleRate;
+
+            float w0 = 2.0f*3.14159265358979323846f*cutoff/deviceSampleRate;
+            float cosw0 = cosf(w0);
+            float alpha = sinf(w0)/(2.0f*q);
+            float a0 = 1.0f + alpha;
+
+            if (effect->type == AUDIO_EFFECT_LOWPASS)
+            {
+                effect->b0 = (1.0f - cosw0)/2.0f/a0;
+                effect->b1 = (1.0f - cosw0)/a0;
+                effect->b2 = effect->b0;
+            }
+            else
+            {
+                effect->b0 = (1.0f + cosw0)/2.0f/a0;
+                effect->b1 = -(1.0f + cosw0)/a0;
+                effect->b2 = effect->b0;
+            }
+
+            effect->a1 = -2.0f*cosw0/a0;
+            effect->a2 = (1.0f - alpha)/a0;
+        } break;
+        case AUDIO_EFFECT_DELAY:
+        {
+            // Params: delay time (seconds), feedback [0.0..0.95], wet mix [0.0..1.0]
+            unsigned int delayFrames = (params[0] > 0.0f)? (unsigned int)(params[0]*deviceSampleRate) : 1;
 
-        lastAudioBuffer = buffer;
+            if (delayFrames < 1) delayFrames = 1;
+            if (delayFrames >= effect->delaySize) delayFrames = (effect->delaySize > 1)? effect->delaySize - 1 : 1;
+
+            effect->delayFrames = delayFrames;
+            effect->params[1] = (params[1] < 0.0f)? 0.0f : ((params[1] > 0.95f)? 0.95f : params[1]);
+            effect->params[2] = (params[2] < 0.0f)? 0.0f : ((params[2] > 1.0f)? 1.0f : params[2]);
+        } break;
+        case AUDIO_EFFECT_COMPRESSOR:
+        {
+            // Params: threshold (dB), ratio (>= 1.0), release time (seconds)
+            effect->threshold = powf(10.0f, params[0]/20.0f);
+            effect->params[1] = (params[1] < 1.0f)? 1.0f : params[1];
+            effect->attack = expf(-1.0f/(AUDIO_EFFECT_ATTACK_TIME*deviceSampleRate));
+            effect->release = expf(-1.0f/(((params[2] > 0.001f)? params[2] : 0.001f)*deviceSampleRate));
+        } break;
+        case AUDIO_EFFECT_DUCKER:
+        {
+            // Params: key bus index, depth (gain reduction [0.0..1.0]), release time (seconds)
+            effect->params[0] = ((params[0] >= 0.0f) && (params[0] < MAX_AUDIO_BUSES))? params[0] : 0.0f;
+            effect->params[1] = (params[1] < 0.0f)? 0.0f : ((params[1] > 1.0f)? 1.0f : params[1]);
+            effect->attack = expf(-1.0f/(AUDIO_EFFECT_ATTACK_TIME*deviceSampleRate));
+            effect->release = expf(-1.0f/(((params[2] > 0.001f)? params[2] : 0.001f)*deviceSampleRate));
+        } break;
+        default: break;
     }
-    ma_mutex_unlock(&audioLock);
 }
 
-// Untrack audio buffer from linked list
-void UntrackAudioBuffer(AudioBuffer *buffer)
+// Process bus effect on frames block (audio thread)
+static void ProcessAudioEffect(AudioEffect *effect, float *frames, ma_uint32 frameCount)
 {
-    ma_mutex_lock(&audioLock);
+    switch (effect->type)
     {
-        if (buffer->prev == NULL) firstAudioBuffer = buffer->next;
-        else buffer->prev->next = buffer->next;
+        case AUDIO_EFFECT_LOWPASS:
+        case AUDIO_EFFECT_HIGHPASS:
+        {
+            // NOTE: Recursive filter, frames processed in order, channels state kept in registers
+            for (int c = 0; c < DEVICE_CHANNELS; c++)
+            {
+                float b0 = effect->b0, b1 = effect->b1, b2 = effect->b2, a1 = effect->a1, a2 = effect->a2;
+                float z1 = effect->z1[c], z2 = effect->z2[c];
 
-        if (buffer->next == NULL) lastAudioBuffer = buffer->prev;
-        else buffer->next->prev = buffer->prev;
+                for (ma_uint32 i = c; i < frameCount*DEVICE_CHANNELS; i += DEVICE_CHANNELS)
+                {
+                    float x = frames[i];
+                    float y = b0*x + z1;
 
-        buffer->prev = NULL;
-        buffer->next = NULL;
-    }
-    ma_mutex_unlock(&audioLock);
-}
+                    z1 = b1*x - a1*y + z2;
+                    z2 = b2*x - a2*y;
+                    frames[i] = y;
+                }
 
-//----------------------------------------------------------------------------------
-// Module Functions Definition - Sounds loading and playing (.WAV)
-//----------------------------------------------------------------------------------
+                effect->z1[c] = z1;
+                effect->z2[c] = z2;
+            }
+        } break;
+        case AUDIO_EFFECT_DELAY:
+        {
+            if (effect->delayLine == NULL) break;
 
-// Load wave data from file
-Wave LoadWave(const char *fileName)
-{
-    Wave wave = { 0 };
+            float feedback = effect->params[1];
+            float mix = effect->params[2];
 
-    if (false) { }
-#if defined(SUPPORT_FILEFORMAT_WAV)
-    else if (IsFileExtension(fileName, ".wav")) wave = LoadWAV(fileName);
-#endif
-#if defined(SUPPORT_FILEFORMAT_OGG)
-    else if (IsFileExtension(fileName, ".ogg")) wave = LoadOGG(fileName);
-#endif
-#if defined(SUPPORT_FILEFORMAT_FLAC)
-    else if (IsFileExtension(fileName, ".flac")) wave = LoadFLAC(fileName);
-#endif
-#if defined(SUPPORT_FILEFORMAT_MP3)
-    else if (IsFileExtension(fileName, ".mp3")) wave = LoadMP3(fileName);
-#endif
-    else TraceLog(LOG_WARNING, "[%s] Audio fileformat not supported, it can't be loaded", fileName);
+            for (ma_uint32 i = 0; i < frameCount; i++)
+            {
+                unsigned int readCursor = (effect->delayCursor + effect->delaySize - effect->delayFrames)%effect->delaySize;
 
-    return wave;
-}
+                for (int c = 0; c < DEVICE_CHANNELS; c++)
+                {
+                    float x = frames[i*DEVICE_CHANNELS + c];
+                    float delayed = effect->delayLine[readCursor*DEVICE_CHANNELS + c];
 
-// Load sound from file
-// NOTE: The entire file is loaded to memory to be played (no-streaming)
-Sound LoadSound(const char *fileName)
-{
-    Wave wave = LoadWave(fileName);
+                    effect->delayLine[effect->delayCursor*DEVICE_CHANNELS + c] = x + delayed*feedback;
+                    frames[i*DEVICE_CHANNELS + c] = x + delayed*mix;
+                }
 
-    Sound sound = LoadSoundFromWave(wave);
+                effect->delayCursor = (effect->delayCursor + 1)%effect->delaySize;
+            }
+        } break;
+        case AUDIO_EFFECT_COMPRESSOR:
+        {
+            float exponent = 1.0f/effect->params[1] - 1.0f;
 
-    UnloadWave(wave);       // Sound is loaded, we can unload wave
+            for (ma_uint32 i = 0; i < frameCount; i++)
+            {
+                float peak = 0.0f;
+                for (int c = 0; c < DEVICE_CHANNELS; c++) if (fabsf(frames[i*DEVICE_CHANNELS + c]) > peak) peak = fabsf(frames[i*DEVICE_CHANNELS + c]);
 
-    return sound;
+                float coeff = (peak > effect->envelope)? effect->attack : effect->release;
+                effect->envelope = peak + coeff*(effect->envelope - peak);
+
+                if (effect->envelope > effect->threshold)
+                {
+                    float gain = powf(effect->envelope/effect->threshold, exponent);
+                    for (int c = 0; c < DEVICE_CHANNELS; c++) frames[i*DEVICE_CHANNELS + c] *= gain;
+                }
+            }
+        } break;
+        case AUDIO_EFFECT_DUCKER:
+        {
+            // Gain is smoothed by block and applied as a ramp
+            bool keyActive = (audioBuses[(int)effect->params[0]].level > AUDIO_DUCKER_KEY_LEVEL);
+            float target = keyActive? (1.0f - effect->params[1]) : 1.0f;
+            float coeff = powf((target < effect->envelope)? effect->attack : effect->release, (float)frameCount);
+            float gain = target + coeff*(effect->envelope - target);
+
+            ScaleAudioFrames(frames, frameCount, DEVICE_CHANNELS, effect->envelope, gain);
+            effect->envelope = gain;
+        } break;
+        default: break;
+    }
 }
 
-// Load sound from wave data
-// NOTE: Wave data must be unallocated manually
-Sound LoadSoundFromWave(Wave wave)
+// Attach spatial emitter to audio buffer and set its position, returns emitter slot (-1 if no slot available)
+// NOTE: Emitter position is published on next UpdateAudioSpatial(), first one is sent with attach command
+static int AttachAudioEmitter(AudioBuffer *buffer, const float *position, const float *velocity)
 {
-    Sound sound = { 0 };
+    int emitter = buffer->emitter;
 
-    if (wave.data != NULL)
+    if (emitter == -1)
     {
-        // When using miniaudio we need to do our own mixing.
-        // To simplify this we need convert the format of each sound to be consistent with
-        // the format used to open the playback device. We can do this two ways:
-        //
-        //   1) Convert the whole sound in one go at load time (here).
-        //   2) Convert the audio data in chunks at mixing time.
-        //
-        // First option has been selected, format conversion is done on the loading stage.
-        // The downside is that it uses more memory if the original sound is u8 or s16.
-        ma_format formatIn  = ((wave.sampleSize == 8)? ma_format_u8 : ((wave.sampleSize == 16)? ma_format_s16 : ma_format_f32));
-        ma_uint32 frameCountIn = wave.sampleCount/wave.channels;
+        emitter = 0;
+        while ((emitter < MAX_AUDIO_EMITTERS) && audioEmittersUsed[emitter]) emitter++;
 
-        ma_uint32 frameCount = (ma_uint32)ma_convert_frames(NULL, DEVICE_FORMAT, DEVICE_CHANNELS, DEVICE_SAMPLE_RATE, NULL, formatIn, wave.channels, wave.sampleRate, frameCountIn);
-        if (frameCount == 0) TraceLog(LOG_WARNING, "LoadSoundFromWave() : Failed to get frame count for format conversion");
+        if (emitter == MAX_AUDIO_EMITTERS)
+        {
+            TraceLog(LOG_WARNING, "Spatial emitters limit reached (%i), audio buffer is not positioned", MAX_AUDIO_EMITTERS);
+            return -1;
+        }
 
-        AudioBuffer *audioBuffer = InitAudioBuffer(DEVICE_FORMAT, DEVICE_CHANNELS, DEVICE_SAMPLE_RATE, frameCount, AUDIO_BUFFER_USAGE_STATIC);
-        if (audioBuffer == NULL) TraceLog(LOG_WARNING, "LoadSoundFromWave() : Failed to create audio buffer");
+        audioEmittersUsed[emitter] = true;
+        if (emitter >= audioSpatial.emittersCount) audioSpatial.emittersCount = emitter + 1;
+        buffer->emitter = emitter;
 
-        frameCount = (ma_uint32)ma_convert_frames(audioBuffer->buffer, audioBuffer->dsp.formatConverterIn.config.formatIn, audioBuffer->dsp.formatConverterIn.config.channels, audioBuffer->dsp.src.config.sampleRateIn, wave.data, formatIn, wave.channels, wave.sampleRate, frameCountIn);
-        if (frameCount == 0) TraceLog(LOG_WARNING, "LoadSoundFromWave() : Format conversion failed");
+        AudioCommand command = { AUDIO_COMMAND_EMITTER, buffer, NULL, 0.0f, (unsigned int)emitter + 1 };
+        for (int i = 0; i < 3; i++) command.params[i] = position[i];
 
-        sound.sampleCount = frameCount*DEVICE_CHANNELS;
-        sound.stream.sampleRate = DEVICE_SAMPLE_RATE;
-        sound.stream.sampleSize = 32;
-        sound.stream.channels = DEVICE_CHANNELS;
-        sound.stream.buffer = audioBuffer;
+        QueueAudioCommand(command);
     }
 
-    return sound;
+    audioSpatial.positionX[emitter] = position[0];
+    audioSpatial.positionY[emitter] = position[1];
+    audioSpatial.positionZ[emitter] = position[2];
+    audioSpatial.velocityX[emitter] = velocity[0];
+    audioSpatial.velocityY[emitter] = velocity[1];
+    audioSpatial.velocityZ[emitter] = velocity[2];
+
+    return emitter;
 }
 
-// Unload wave data
-void UnloadWave(Wave wave)
+// Detach spatial emitter from audio buffer, buffer is mixed not panned again
+static void DetachAudioEmitter(AudioBuffer *buffer)
 {
-    if (wave.data != NULL) RL_FREE(wave.data);
+    if (buffer->emitter == -1) return;
 
-    TraceLog(LOG_INFO, "Unloaded wave data from RAM");
+    audioEmittersUsed[buffer->emitter] = false;
+    while ((audioSpatial.emittersCount > 0) && !audioEmittersUsed[audioSpatial.emittersCount - 1]) audioSpatial.emittersCount--;
+    buffer->emitter = -1;
+
+    PushAudioCommand(AUDIO_COMMAND_EMITTER, buffer, NULL, 0.0f, 0);
 }
 
-// Unload sound
-void UnloadSound(Sound sound)
+// Compute emitters gains and doppler ratios in batch from listener and emitters mixed (audio thread)
+// NOTE: Emitters components are stored by arrays and emitters are independent, loop is vectorizable
+static void ComputeAudioEmitters(int first, int last)
 {
-    CloseAudioBuffer(sound.stream.buffer);
+    const AudioSpatial *spatial = &mixSpatial;
+    float range = spatial->maxDistance - spatial->minDistance;
+    float factor = spatial->dopplerFactor;
 
-    TraceLog(LOG_INFO, "Unloaded sound data from RAM");
+    for (int i = first; i < last; i++)
+    {
+        float dx = spatial->positionX[i] - spatial->listenerPosition[0];
+        float dy = spatial->positionY[i] - spatial->listenerPosition[1];
+        float dz = spatial->positionZ[i] - spatial->listenerPosition[2];
+        float distance = sqrtf(dx*dx + dy*dy + dz*dz);
+        float invDistance = (distance > 0.0001f)? 1.0f/distance : 0.0f;
+
+        // Distance attenuation, linear from minDistance (1.0) to maxDistance (0.0), same as voices audibility
+        float attenuation = 1.0f;
+        if (spatial->maxDistance > 0.0f)
+        {
+            attenuation = (range > 0.0f)? 1.0f - (distance - spatial->minDistance)/range : ((distance <= spatial->minDistance)? 1.0f : 0.0f);
+            attenuation = (attenuation < 0.0f)? 0.0f : ((attenuation > 1.0f)? 1.0f : attenuation);
+        }
+
+        // Constant power panning, emitter direction projected on listener right axis
+        float pan = (dx*spatial->listenerRight[0] + dy*spatial->listenerRight[1] + dz*spatial->listenerRight[2])*invDistance;
+        pan = (pan < -1.0f)? -1.0f : ((pan > 1.0f)? 1.0f : pan);
+
+        mixEmittersGain[0][i] = attenuation*sqrtf(0.5f*(1.0f - pan));
+        mixEmittersGain[1][i] = attenuation*sqrtf(0.5f*(1.0f + pan));
+
+        // Doppler ratio, listener and emitter velocities projected on listener to emitter direction
+        float listenerSpeed = factor*(spatial->listenerVelocity[0]*dx + spatial->listenerVelocity[1]*dy + spatial->listenerVelocity[2]*dz)*invDistance;
+        float emitterSpeed = factor*(spatial->velocityX[i]*dx + spatial->velocityY[i]*dy + spatial->velocityZ[i]*dz)*invDistance;
+        float doppler = (AUDIO_SPEED_OF_SOUND + listenerSpeed)/fmaxf(AUDIO_SPEED_OF_SOUND + emitterSpeed, 0.0001f);
+
+        mixEmittersDoppler[i] = (doppler < 1.0f/AUDIO_DOPPLER_MAX_RATIO)? 1.0f/AUDIO_DOPPLER_MAX_RATIO : ((doppler > AUDIO_DOPPLER_MAX_RATIO)? AUDIO_DOPPLER_MAX_RATIO : doppler);
+    }
 }
 
-// Update sound buffer with new data
-void UpdateSound(Sound sound, const void *data, int samplesCount)
+// Apply doppler ratio to audio buffer pitch, converter is only updated on output sample rate change (audio thread)
+static void ApplyAudioDoppler(AudioBuffer *buffer, float doppler)
 {
-    AudioBuffer *audioBuffer = sound.stream.buffer;
+    ma_uint32 sampleRate = (ma_uint32)((float)deviceSampleRate/(buffer->mixPitch*doppler));
 
-    if (audioBuffer != NULL)
-    {
-        StopAudioBuffer(audioBuffer);
+    if (sampleRate != (ma_uint32)((float)deviceSampleRate/(buffer->mixPitch*buffer->mixDoppler))) ma_pcm_converter_set_output_sample_rate(&buffer->dsp, sampleRate);
 
-        // TODO: May want to lock/unlock this since this data buffer is read at mixing time
-        memcpy(audioBuffer->buffer, data, samplesCount*audioBuffer->dsp.formatConverterIn.config.channels*ma_get_bytes_per_sample(audioBuffer->dsp.formatConverterIn.config.formatIn));
-    }
-    else TraceLog(LOG_ERROR, "UpdateSound() : Invalid sound - no audio buffer");
+    buffer->mixDoppler = doppler;
 }
 
-// Export wave data to file
-void ExportWave(Wave wave, const char *fileName)
+// Get position distance to listener (game thread)
+static float GetAudioSpatialDistance(const float *position)
 {
-    bool success = false;
+    float dx = position[0] - audioSpatial.listenerPosition[0];
+    float dy = position[1] - audioSpatial.listenerPosition[1];
+    float dz = position[2] - audioSpatial.listenerPosition[2];
 
-    if (false) { }
-#if defined(SUPPORT_FILEFORMAT_WAV)
-    else if (IsFileExtension(fileName, ".wav")) success = SaveWAV(wave, fileName);
-#endif
-    else if (IsFileExtension(fileName, ".raw"))
+    return sqrtf(dx*dx + dy*dy + dz*dz);
+}
+
+// Sync mixed voice emitter with voice position, pool buffer emitter is attached or detached
+static void SyncAudioVoiceEmitter(int slot)
+{
+    AudioVoice *voice = &audioVoices[slot];
+    AudioBuffer *buffer = audioBufferPool[voice->pool];
+
+    if (voice->spatial) AttachAudioEmitter(buffer, voice->position, voice->velocity);
+    else DetachAudioEmitter(buffer);
+}
+
+// Get voice slot from voice id (-1 if voice is not playing)
+static int GetAudioVoice(int voice)
+{
+    if (voice < 0) return -1;
+
+    int slot = voice%MAX_AUDIO_VOICES;
+
+    if ((audioVoices[slot].source == NULL) || (audioVoices[slot].generation != (unsigned int)(voice/MAX_AUDIO_VOICES))) return -1;
+
+    return slot;
+}
+
+// Get voice audible volume (voice and sound volume, distance attenuation)
+static float GetAudioVoiceAudibility(const AudioVoice *voice)
+{
+    float attenuation = 1.0f;
+
+    if ((voicesMaxDistance > 0.0f) && (voice->distance > voicesMinDistance))
     {
-        // Export raw sample data (without header)
-        // NOTE: It's up to the user to track wave parameters
-        FILE *rawFile = fopen(fileName, "wb");
-        success = fwrite(wave.data, wave.sampleCount*wave.channels*wave.sampleSize/8, 1, rawFile);
-        fclose(rawFile);
+        if (voice->distance >= voicesMaxDistance) attenuation = 0.0f;
+        else attenuation = 1.0f - (voice->distance - voicesMinDistance)/(voicesMaxDistance - voicesMinDistance);
     }
 
-    if (success) TraceLog(LOG_INFO, "Wave exported successfully: %s", fileName);
-    else TraceLog(LOG_WARNING, "Wave could not be exported.");
+    return voice->volume*voice->source->volume*attenuation;
 }
 
-// Export wave sample data to code (.h)
-void ExportWaveAsCode(Wave wave, const char *fileName)
+// Check if voice parameters (priority, audibility) take precedence over voice
+static bool CheckAudioVoicePrecedence(int priority, float audibility, const AudioVoice *voice)
 {
-    #define BYTES_TEXT_PER_LINE     20
+    if (priority != voice->source->priority) return (priority > voice->source->priority);
 
-    char varFileName[256] = { 0 };
-    int dataSize = wave.sampleCount*wave.channels*wave.sampleSize/8;
+    return (audibility > voice->audibility);
+}
 
-    FILE *txtFile = fopen(fileName, "wt");
+// Find voice with lowest priority and audibility (of a sound if source not NULL)
+static int FindWeakestAudioVoice(AudioBuffer *source)
+{
+    int weakest = -1;
 
-    if (txtFile != NULL)
+    for (int i = 0; i < MAX_AUDIO_VOICES; i++)
     {
-        fprintf(txtFile, "\n//////////////////////////////////////////////////////////////////////////////////\n");
-        fprintf(txtFile, "//                                                                              //\n");
-        fprintf(txtFile, "// WaveAsCode exporter v1.0 - Wave data exported as an array of bytes           //\n");
-        fprintf(txtFile, "//                                                                              //\n");
-        fprintf(txtFile, "// more info and bugs-report:  github.com/raysan5/raylib                        //\n");
-        fprintf(txtFile, "// feedback and support:       ray[at]raylib.com                                //\n");
-        fprintf(txtFile, "//                                                                              //\n");
-        fprintf(txtFile, "// Copyright (c) 2018 Ramon Santamaria (@raysan5)                               //\n");
-        fprintf(txtFile, "//                                                                              //\n");
-        fprintf(txtFile, "//////////////////////////////////////////////////////////////////////////////////\n\n");
+        const AudioVoice *voice = &audioVoices[i];
+        if ((voice->source == NULL) || ((source != NULL) && (voice->source != source))) continue;
 
-#if !defined(RAUDIO_STANDALONE)
-        // Get file name from path and convert variable name to uppercase
-        strcpy(varFileName, GetFileNameWithoutExt(fileName));
-        for (int i = 0; varFileName[i] != '\0'; i++) if (varFileName[i] >= 'a' && varFileName[i] <= 'z') { varFileName[i] = varFileName[i] - 32; }
-#else
-        strcpy(varFileName, fileName);
-#endif
+        if ((weakest == -1) || CheckAudioVoicePrecedence(audioVoices[weakest].source->priority, audioVoices[weakest].audibility, voice)) weakest = i;
+    }
 
-        fprintf(txtFile, "// Wave data information\n");
-        fprintf(txtFile, "#define %s_SAMPLE_COUNT     %i\n", varFileName, wave.sampleCount);
-        fprintf(txtFile, "#define %s_SAMPLE_RATE      %i\n", varFileName, wave.sampleRate);
-        fprintf(txtFile, "#define %s_SAMPLE_SIZE      %i\n", varFileName, wave.sampleSize);
-        fprintf(txtFile, "#define %s_CHANNELS         %i\n\n", varFileName, wave.channels);
+    return weakest;
+}
 
-        // Write byte data as hexadecimal text
-        fprintf(txtFile, "static unsigned char %s_DATA[%i] = { ", varFileName, dataSize);
-        for (int i = 0; i < dataSize - 1; i++) fprintf(txtFile, ((i%BYTES_TEXT_PER_LINE == 0)? "0x%x,\n" : "0x%x, "), ((unsigned char *)wave.data)[i]);
-        fprintf(txtFile, "0x%x };\n", ((unsigned char *)wave.data)[dataSize - 1]);
+// Stop voice (pool buffer is released)
+static void StopAudioVoice(int slot)
+{
+    AudioVoice *voice = &audioVoices[slot];
 
-        fclose(txtFile);
+    if (voice->pool != -1)
+    {
+        StopAudioBuffer(audioBufferPool[voice->pool]);
+        audioBufferPoolVoice[voice->pool] = 0;
     }
+
+    voice->source = NULL;
+    voice->pool = -1;
 }
 
-// Play a sound
-void PlaySound(Sound sound)
+// Compare voices slots precedence, highest priority and audibility first (qsort() callback)
+static int CompareAudioVoices(const void *a, const void *b)
 {
-    PlayAudioBuffer(sound.stream.buffer);
+    const AudioVoice *voiceA = &audioVoices[*(const int *)a];
+    const AudioVoice *voiceB = &audioVoices[*(const int *)b];
+
+    if (CheckAudioVoicePrecedence(voiceA->source->priority, voiceA->audibility, voiceB)) return -1;
+    if (CheckAudioVoicePrecedence(voiceB->source->priority, voiceB->audibility, voiceA)) return 1;
+
+    return (*(const int *)a - *(const int *)b);
 }
 
-// Play a sound in the multichannel buffer pool
-void PlaySoundMulti(Sound sound)
+// Initialise the multichannel buffer pool
+// NOTE: Default voices limit buffers are created, more are created if voices limit is increased
+static void InitAudioBufferPool()
 {
-    int index = -1;
-    unsigned int oldAge = 0;
-    int oldIndex = -1;
-
-    // find the first non playing pool entry
+    // Dummy buffers, data is set by played sounds
     for (int i = 0; i < MAX_AUDIO_BUFFER_POOL_CHANNELS; i++)
     {
-        if (audioBufferPoolChannels[i] > oldAge)
-        {
-            oldAge = audioBufferPoolChannels[i];
-            oldIndex = i;
-        }
+        audioBufferPool[i] = InitAudioBuffer(DEVICE_FORMAT, DEVICE_CHANNELS, deviceSampleRate, 0, AUDIO_BUFFER_USAGE_STATIC);
+        RL_FREE(audioBufferPool[i]->buffer);
+        audioBufferPool[i]->buffer = NULL;
+    }
+}
 
-        if (!IsAudioBufferPlaying(audioBufferPool[i]))
-        {
-            index = i;
-            break;
-        }
+// Close the audio buffers pool
+static void CloseAudioBufferPool()
+{
+    // NOTE: Pool buffers data is owned by played sounds
+    for (int i = 0; i < MAX_AUDIO_VOICES_MIXED; i++) 
+    {
+        if (audioBufferPool[i] == NULL) continue;
+
+        UntrackAudioBuffer(audioBufferPool[i]);
+        RL_FREE(audioBufferPool[i]);
+        audioBufferPool[i] = NULL;
     }
 
-    // If no none playing pool members can be index choose the oldest
-    if (index == -1)
+    memset(audioVoices, 0, sizeof(audioVoices));
+    memset(audioBufferPoolVoice, 0, sizeof(audioBufferPoolVoice));
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition - Audio Device initialization and Closing
+//----------------------------------------------------------------------------------
+// Initialize audio device
+void InitAudioDevice(void)
+{
+    AudioDeviceConfig config = { 0 };
+
+    InitAudioDeviceEx(config);
+}
+
+// Initialize audio device with configuration (sample rate, periods, share mode and backend)
+// NOTE: Zero values use defaults, sounds must be loaded after device initialization (converted to device sample rate)
+void InitAudioDeviceEx(AudioDeviceConfig deviceConfig)
+{
+    // Backends in AudioBackend order, AUDIO_BACKEND_DEFAULT lets miniaudio try them by platform priority
+    static const ma_backend backends[] = {
+        ma_backend_wasapi, ma_backend_dsound, ma_backend_winmm, ma_backend_coreaudio, ma_backend_sndio, ma_backend_audio4, ma_backend_oss,
+        ma_backend_pulseaudio, ma_backend_alsa, ma_backend_jack, ma_backend_aaudio, ma_backend_opensl, ma_backend_webaudio, ma_backend_null
+    };
+
+    if (isAudioInitialized)
     {
-        TraceLog(LOG_WARNING,"pool age %i ended a sound early no room in buffer pool", audioBufferPoolCounter);
+        TraceLog(LOG_WARNING, "Audio device already initialized");
+        return;
+    }
 
-        if (oldIndex == -1)
-        {
-            // Shouldn't be able to get here... but just in case something odd happens!
-            TraceLog(LOG_ERROR,"sound buffer pool couldn't determine oldest buffer not playing sound");
+    const ma_backend *backend = NULL;
+    if ((deviceConfig.backend > AUDIO_BACKEND_DEFAULT) && (deviceConfig.backend <= (int)(sizeof(backends)/sizeof(backends[0])))) backend = &backends[deviceConfig.backend - 1];
+    else if (deviceConfig.backend != AUDIO_BACKEND_DEFAULT) TraceLog(LOG_WARNING, "InitAudioDeviceEx() : Invalid audio backend (%i), using default", deviceConfig.backend);
 
-            return;
-        }
+    deviceSampleRate = (deviceConfig.sampleRate > 0)? deviceConfig.sampleRate : DEVICE_SAMPLE_RATE;
 
-        index = oldIndex;
+    // Init audio context
+    ma_context_config contextConfig = ma_context_config_init();
+    contextConfig.logCallback = OnLog;
 
-        // Just in case...
-        StopAudioBuffer(audioBufferPool[index]);
+    ma_result result = ma_context_init(backend, (backend != NULL)? 1 : 0, &contextConfig, &context);
+    if (result != MA_SUCCESS)
+    {
+        TraceLog(LOG_ERROR, "Failed to initialize audio context");
+        return;
     }
 
-    // Experimentally mutex lock doesn't seem to be needed this makes sense
-    // as audioBufferPool[index] isn't playing and the only stuff we're copying
-    // shouldn't be changing...
+    // Init audio device
+    // NOTE: Using the default device. Format is floating point because it simplifies mixing.
+    ma_device_config config = ma_device_config_init(ma_device_type_playback);
+    config.playback.pDeviceID = NULL;  // NULL for the default playback device.
+    config.playback.format    = DEVICE_FORMAT;
+    config.playback.channels  = DEVICE_CHANNELS;
+    config.capture.pDeviceID  = NULL;  // NULL for the default capture device.
+    config.capture.format     = ma_format_s16;
+    config.capture.channels   = 1;
+    config.sampleRate         = deviceSampleRate;
+    config.dataCallback       = OnSendAudioDataToDevice;
+    config.pUserData          = NULL;
 
-    audioBufferPoolChannels[index] = audioBufferPoolCounter;
-    audioBufferPoolCounter++;
+    // NOTE: miniaudio buffer size is the whole device buffer (all periods), zero values use backend defaults
+    if (deviceConfig.periodCount > 0) config.periods = deviceConfig.periodCount;
+    if (deviceConfig.periodSize > 0) config.bufferSizeInFrames = deviceConfig.periodSize*((deviceConfig.periodCount > 0)? deviceConfig.periodCount : MA_DEFAULT_PERIODS);
+    if (deviceConfig.exclusive) config.playback.shareMode = ma_share_mode_exclusive;
 
-    audioBufferPool[index]->volume = sound.stream.buffer->volume;
-    audioBufferPool[index]->pitch = sound.stream.buffer->pitch;
-    audioBufferPool[index]->looping = sound.stream.buffer->looping;
-    audioBufferPool[index]->usage = sound.stream.buffer->usage;
-    audioBufferPool[index]->isSubBufferProcessed[0] = false;
-    audioBufferPool[index]->isSubBufferProcessed[1] = false;
-    audioBufferPool[index]->bufferSizeInFrames = sound.stream.buffer->bufferSizeInFrames;
-    audioBufferPool[index]->buffer = sound.stream.buffer->buffer;
+    result = ma_device_init(&context, &config, &device);
 
-    PlayAudioBuffer(audioBufferPool[index]);
-}
+    // Exclusive mode is not available on every backend, shared mode is used instead
+    if ((result != MA_SUCCESS) && deviceConfig.exclusive)
+    {
+        TraceLog(LOG_WARNING, "Audio device exclusive mode not available, using shared mode");
+        config.playback.shareMode = ma_share_mode_shared;
+        result = ma_device_init(&context, &config, &device);
+    }
 
-// Stop any sound played with PlaySoundMulti()
-void StopSoundMulti(void)
-{
-    for (int i = 0; i < MAX_AUDIO_BUFFER_POOL_CHANNELS; i++) StopAudioBuffer(audioBufferPool[i]);
-}
+    if (result != MA_SUCCESS)
+    {
+        TraceLog(LOG_ERROR, "Failed to initialize audio playback device");
+        ma_context_uninit(&context);
+        return;
+    }
 
-// Get number of sounds playing in the multichannel buffer pool
-int GetSoundsPlaying(void)
-{
-    int counter = 0;
+    ResetAudioBuses();
 
-    for (int i = 0; i < MAX_AUDIO_BUFFER_POOL_CHANNELS; i++)
+    // Statistics counters restart with device
+    ma_timer_init(&audioStatsTimer);
+    mixStatsCallbacks = 0;
+    mixStatsUnderruns = 0;
+    audioStatsUnderruns = 0;
+    audioStatsWaitTime = 0.0f;
+    audioStatsWaits = 0;
+
+    // Keep the device running the whole time. May want to consider doing something a bit smarter and only have the device running
+    // while there's at least one sound being played.
+    result = ma_device_start(&device);
+    if (result != MA_SUCCESS)
     {
-        if (IsAudioBufferPlaying(audioBufferPool[i])) counter++;
+        TraceLog(LOG_ERROR, "Failed to start audio playback device");
+        ma_device_uninit(&device);
+        ma_context_uninit(&context);
+        return;
     }
 
-    return counter;
-}
+    // Mixing happens on a seperate thread, from now on audio buffers state changes are queued (PushAudioCommand())
+    isAudioInitialized = true;
 
-// Pause a sound
-void PauseSound(Sound sound)
-{
-    PauseAudioBuffer(sound.stream.buffer);
+    TraceLog(LOG_INFO, "Audio device initialized successfully");
+    TraceLog(LOG_INFO, "Audio backend: miniaudio / %s", ma_get_backend_name(context.backend));
+    TraceLog(LOG_INFO, "Audio format: %s -> %s", ma_get_format_name(device.playback.format), ma_get_format_name(device.playback.internalFormat));
+    TraceLog(LOG_INFO, "Audio channels: %d -> %d", device.playback.channels, device.playback.internalChannels);
+    TraceLog(LOG_INFO, "Audio sample rate: %d -> %d", device.sampleRate, device.playback.internalSampleRate);
+    TraceLog(LOG_INFO, "Audio buffer size: %d (%d periods)", device.playback.internalBufferSizeInFrames, device.playback.internalPeriods);
+
+    InitAudioBufferPool();
+    TraceLog(LOG_INFO, "Audio multichannel pool size: %i", MAX_AUDIO_BUFFER_POOL_CHANNELS);
 }
 
-// Resume a paused sound
-void ResumeSound(Sound sound)
+// Close the audio device for all contexts
+void CloseAudioDevice(void)
 {
-    ResumeAudioBuffer(sound.stream.buffer);
+    if (isAudioInitialized)
+    {
+        SetMusicStreamThread(false, 0.0f);
+
+        ma_device_uninit(&device);
+        ma_context_uninit(&context);
+
+        // Audio thread is stopped, pending commands are applied and next ones are applied directly
+        isAudioInitialized = false;
+        ProcessAudioCommands();
+
+        if (musicStreamLocksReady)
+        {
+            ma_mutex_uninit(&audioCommandsLock);
+            ma_mutex_uninit(&musicStreamsLock);
+            musicStreamLocksReady = false;
+        }
+
+        CloseAudioBufferPool();
+        ResetAudioBuses();
+        audioSpatialPending = false;
+
+        TraceLog(LOG_INFO, "Audio device closed successfully");
+    }
+    else TraceLog(LOG_WARNING, "Could not close audio device because it is not currently initialized");
 }
 
-// Stop reproducing a sound
-void StopSound(Sound sound)
+// Check if device has been initialized successfully
+bool IsAudioDeviceReady(void)
 {
-    StopAudioBuffer(sound.stream.buffer);
+    return isAudioInitialized;
 }
 
-// Check if a sound is playing
-bool IsSoundPlaying(Sound sound)
+// Get audio statistics measured since last call (mixing time, buffers and voices mixed, underruns, waits)
+// NOTE: Mixing counters are read while audio thread updates them, values are approximate
+AudioStats GetAudioStats(void)
 {
-    return IsAudioBufferPlaying(sound.stream.buffer);
+    AudioStats stats = { 0 };
+
+    if (!isAudioInitialized) return stats;
+
+    unsigned int callbacks = mixStatsCallbacks;
+
+    stats.callbackTimeMin = mixStatsTimeMin;
+    stats.callbackTimeMax = mixStatsTimeMax;
+    stats.callbackTimeAvg = (callbacks > 0)? mixStatsTimeTotal/(float)callbacks : 0.0f;
+    stats.callbackPeriod = mixStatsPeriod;
+    stats.callbackCount = (int)callbacks;
+    stats.buffersMixed = mixStatsBuffers;
+
+    for (int i = 0; i < MAX_AUDIO_VOICES; i++)
+    {
+        if (audioVoices[i].source == NULL) continue;
+
+        if (audioVoices[i].pool != -1) stats.voicesMixed++;
+        else stats.voicesVirtual++;
+    }
+
+    unsigned int underruns = mixStatsUnderruns;
+    stats.streamUnderruns = (int)(underruns - audioStatsUnderruns);
+    audioStatsUnderruns = underruns;
+
+    if (musicStreamLocksReady) ma_mutex_lock(&audioCommandsLock);
+    stats.waitTime = audioStatsWaitTime;
+    stats.waitCount = (int)audioStatsWaits;
+    audioStatsWaitTime = 0.0f;
+    audioStatsWaits = 0;
+    if (musicStreamLocksReady) ma_mutex_unlock(&audioCommandsLock);
+
+    // Mixing time counters are reset by audio thread on next callback
+    audioStatsReset = true;
+
+    return stats;
 }
 
-// Set volume for a sound
-void SetSoundVolume(Sound sound, float volume)
+// Set master volume (listener)
+void SetMasterVolume(float volume)
 {
-    SetAudioBufferVolume(sound.stream.buffer, volume);
+    if (volume < 0.0f) volume = 0.0f;
+    else if (volume > 1.0f) volume = 1.0f;
+
+    masterVolume = volume;
 }
 
-// Set pitch for a sound
-void SetSoundPitch(Sound sound, float pitch)
+// Set bus volume, bus 0 is master bus (SetMasterVolume())
+void SetAudioBusVolume(int bus, float volume)
 {
-    SetAudioBufferPitch(sound.stream.buffer, pitch);
+    if ((bus < 0) || (bus >= MAX_AUDIO_BUSES)) TraceLog(LOG_WARNING, "SetAudioBusVolume() : Invalid bus index (%i)", bus);
+    else if (bus == 0) SetMasterVolume(volume);
+    else
+    {
+        AudioCommand command = { AUDIO_COMMAND_BUS_VOLUME, NULL, NULL, (volume > 0.0f)? volume : 0.0f, (unsigned int)bus };
+        QueueAudioCommand(command);
+    }
 }
 
-// Convert wave data to desired format
-void WaveFormat(Wave *wave, int sampleRate, int sampleSize, int channels)
+// Add bus effect, returns effect index (-1 if effect can't be added)
+// NOTE: Effects are processed in order on audio thread, once by bus, parameters depend on effect type (AudioEffectType)
+int AddAudioBusEffect(int bus, int type, float param0, float param1, float param2)
 {
-    ma_format formatIn  = ((wave->sampleSize == 8)? ma_format_u8 : ((wave->sampleSize == 16)? ma_format_s16 : ma_format_f32));
-    ma_format formatOut = ((      sampleSize == 8)? ma_format_u8 : ((      sampleSize == 16)? ma_format_s16 : ma_format_f32));
-
-    ma_uint32 frameCountIn = wave->sampleCount;  // Is wave->sampleCount actually the frame count? That terminology needs to change, if so.
+    if ((bus < 0) || (bus >= MAX_AUDIO_BUSES))
+    {
+        TraceLog(LOG_WARNING, "AddAudioBusEffect() : Invalid bus index (%i)", bus);
+        return -1;
+    }
 
-    ma_uint32 frameCount = (ma_uint32)ma_convert_frames(NULL, formatOut, channels, sampleRate, NULL, formatIn, wave->channels, wave->sampleRate, frameCountIn);
-    if (frameCount == 0)
+    if (audioBusEffectsCount[bus] >= MAX_AUDIO_BUS_EFFECTS)
     {
-        TraceLog(LOG_ERROR, "WaveFormat() : Failed to get frame count for format conversion.");
-        return;
+        TraceLog(LOG_WARNING, "AddAudioBusEffect() : Bus %i effects limit reached (%i)", bus, MAX_AUDIO_BUS_EFFECTS);
+        return -1;
     }
 
-    void *data = RL_MALLOC(frameCount*channels*(sampleSize/8));
+    int effect = audioBusEffectsCount[bus];
 
-    frameCount = (ma_uint32)ma_convert_frames(data, formatOut, channels, sampleRate, wave->data, formatIn, wave->channels, wave->sampleRate, frameCountIn);
-    if (frameCount == 0)
+    audioBusEffectsType[bus][effect] = type;
+    audioBusEffectsCount[bus]++;
+
+    // Delay line is allocated for requested time, time can't be increased later
+    if (type == AUDIO_EFFECT_DELAY)
     {
-        TraceLog(LOG_ERROR, "WaveFormat() : Format conversion failed.");
-        return;
+        float time = (param0 < MAX_AUDIO_DELAY_TIME)? param0 : MAX_AUDIO_DELAY_TIME;
+        unsigned int delaySize = (unsigned int)(time*deviceSampleRate) + 1;
+
+        audioBusEffectsData[bus][effect] = (float *)RL_CALLOC(delaySize*DEVICE_CHANNELS, sizeof(float));
+        audioBusEffectsDataSize[bus][effect] = delaySize;
     }
 
-    wave->sampleCount = frameCount;
-    wave->sampleSize = sampleSize;
-    wave->sampleRate = sampleRate;
-    wave->channels = channels;
-    RL_FREE(wave->data);
-    wave->data = data;
+    PushAudioBusEffect(bus, effect, type, param0, param1, param2);
+
+    return effect;
 }
 
-// Copy a wave to a new wave
-Wave WaveCopy(Wave wave)
+// Set bus effect parameters
+void SetAudioBusEffect(int bus, int effect, float param0, float param1, float param2)
 {
-    Wave newWave = { 0 };
-
-    newWave.data = RL_MALLOC(wave.sampleCount*wave.sampleSize/8*wave.channels);
+    if ((bus < 0) || (bus >= MAX_AUDIO_BUSES) || (effect < 0) || (effect >= audioBusEffectsCount[bus])) TraceLog(LOG_WARNING, "SetAudioBusEffect() : Invalid bus effect");
+    else PushAudioBusEffect(bus, effect, audioBusEffectsType[bus][effect], param0, param1, param2);
+}
 
-    if (newWave.data != NULL)
+// Remove bus effects
+void ClearAudioBusEffects(int bus)
+{
+    if ((bus < 0) || (bus >= MAX_AUDIO_BUSES))
+    {
+        TraceLog(LOG_WARNING, "ClearAudioBusEffects() : Invalid bus index (%i)", bus);
+        return;
+    }
+
+    AudioCommand command = { AUDIO_COMMAND_BUS_CLEAR, NULL, NULL, 0.0f, (unsigned int)bus };
+    QueueAudioCommand(command);
+    WaitAudioCommands();        // Delay lines must not be processed anymore
+
+    for (int i = 0; i < audioBusEffectsCount[bus]; i++)
+    {
+        RL_FREE(audioBusEffectsData[bus][i]);
+        audioBusEffectsData[bus][i] = NULL;
+        audioBusEffectsDataSize[bus][i] = 0;
+    }
+
+    audioBusEffectsCount[bus] = 0;
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition - Audio Buffer management
+//----------------------------------------------------------------------------------
+
+// Initialize a new audio buffer (filled with silence)
+AudioBuffer *InitAudioBuffer(ma_format format, ma_uint32 channels, ma_uint32 sampleRate, ma_uint32 bufferSizeInFrames, int usage)
+{
+    AudioBuffer *audioBuffer = (AudioBuffer *)RL_CALLOC(1, sizeof(AudioBuffer));
+
+    if (audioBuffer == NULL)
+    {
+        TraceLog(LOG_ERROR, "InitAudioBuffer() : Failed to allocate memory for audio buffer");
+        return NULL;
+    }
+    
+    audioBuffer->buffer = RL_CALLOC(bufferSizeInFrames*channels*ma_get_bytes_per_sample(format), 1);
+
+    // Audio data runs through a format converter
+    ma_pcm_converter_config dspConfig;
+    memset(&dspConfig, 0, sizeof(dspConfig));
+    dspConfig.formatIn = format;
+    dspConfig.formatOut = DEVICE_FORMAT;
+    dspConfig.channelsIn = channels;
+    dspConfig.channelsOut = DEVICE_CHANNELS;
+    dspConfig.sampleRateIn = sampleRate;
+    dspConfig.sampleRateOut = deviceSampleRate;
+    dspConfig.onRead = OnAudioBufferDSPRead;        // Callback on data reading
+    dspConfig.pUserData = audioBuffer;              // Audio data pointer
+    dspConfig.allowDynamicSampleRate = true;        // Required for pitch shifting
+
+    ma_result result = ma_pcm_converter_init(&dspConfig, &audioBuffer->dsp);
+
+    if (result != MA_SUCCESS)
+    {
+        TraceLog(LOG_ERROR, "InitAudioBuffer() : Failed to create data conversion pipeline");
+        RL_FREE(audioBuffer);
+        return NULL;
+    }
+
+    // Init audio buffer values
+    audioBuffer->volume = 1.0f;
+    audioBuffer->pitch = 1.0f;
+    audioBuffer->playing = false;
+    audioBuffer->paused = false;
+    audioBuffer->mixPlaying = false;
+    audioBuffer->mixPaused = false;
+    audioBuffer->mixVolume = 1.0f;
+    audioBuffer->mixVolumeTarget = 1.0f;
+    audioBuffer->emitter = -1;
+    audioBuffer->mixEmitter = -1;
+    audioBuffer->mixPitch = 1.0f;
+    audioBuffer->mixDoppler = 1.0f;
+    audioBuffer->looping = false;
+    audioBuffer->usage = usage;
+    audioBuffer->frameCursorPos = 0;
+    audioBuffer->bufferSizeInFrames = bufferSizeInFrames;
+    audioBuffer->subBufferCount = AUDIO_SUBBUFFERS_COUNT;
+    audioBuffer->underrunCount = 0;
+    audioBuffer->isStarving = false;
+
+    // Buffers should be marked as processed by default so that a call to
+    // UpdateAudioStream() immediately after initialization works correctly
+    for (int i = 0; i < MAX_AUDIO_SUBBUFFERS; i++) audioBuffer->isSubBufferProcessed[i] = true;
+
+    // Track audio buffer to linked list next position
+    TrackAudioBuffer(audioBuffer);
+
+    return audioBuffer;
+}
+
+// Delete an audio buffer
+void CloseAudioBuffer(AudioBuffer *buffer)
+{
+    if (buffer != NULL)
+    {
+        DetachAudioEmitter(buffer);
+        UntrackAudioBuffer(buffer);
+        WaitAudioCommands();        // Buffer must not be mixed anymore
+
+        if (buffer->decoder != NULL) CloseAudioDecoder(buffer->decoderType, buffer->decoder);
+
+        // Shared data is released with last sound instance
+        if (buffer->shared != NULL) ReleaseAudioData(buffer->shared);
+        else RL_FREE(buffer->buffer);
+
+        RL_FREE(buffer);
+    }
+    else TraceLog(LOG_ERROR, "CloseAudioBuffer() : No audio buffer");
+}
+
+// Check if an audio buffer is playing
+bool IsAudioBufferPlaying(AudioBuffer *buffer)
+{
+    bool result = false;
+
+    if (buffer != NULL) result = (buffer->playing && !buffer->paused);
+    else TraceLog(LOG_WARNING, "IsAudioBufferPlaying() : No audio buffer");
+
+    return result;
+}
+
+// Play an audio buffer
+// NOTE: Buffer is restarted to the start.
+// Use PauseAudioBuffer() and ResumeAudioBuffer() if the playback position should be maintained.
+void PlayAudioBuffer(AudioBuffer *buffer)
+{
+    if (buffer != NULL)
+    {
+        buffer->playing = true;
+        buffer->paused = false;
+
+        PushAudioCommand(AUDIO_COMMAND_PLAY, buffer, NULL, 0.0f, 0);
+    }
+    else TraceLog(LOG_ERROR, "PlayAudioBuffer() : No audio buffer");
+}
+
+// Stop an audio buffer
+void StopAudioBuffer(AudioBuffer *buffer)
+{
+    if (buffer != NULL)
+    {
+        if (IsAudioBufferPlaying(buffer))
+        {
+            buffer->playing = false;
+            buffer->paused = false;
+            buffer->totalFramesProcessed = 0;
+
+            PushAudioCommand(AUDIO_COMMAND_STOP, buffer, NULL, 0.0f, 0);
+        }
+    }
+    else TraceLog(LOG_ERROR, "StopAudioBuffer() : No audio buffer");
+}
+
+// Pause an audio buffer
+void PauseAudioBuffer(AudioBuffer *buffer)
+{
+    if (buffer != NULL)
+    {
+        buffer->paused = true;
+        PushAudioCommand(AUDIO_COMMAND_PAUSE, buffer, NULL, 0.0f, 0);
+    }
+    else TraceLog(LOG_ERROR, "PauseAudioBuffer() : No audio buffer");
+}
+
+// Resume an audio buffer
+void ResumeAudioBuffer(AudioBuffer *buffer)
+{
+    if (buffer != NULL)
+    {
+        buffer->paused = false;
+        PushAudioCommand(AUDIO_COMMAND_RESUME, buffer, NULL, 0.0f, 0);
+    }
+    else TraceLog(LOG_ERROR, "ResumeAudioBuffer() : No audio buffer");
+}
+
+// Set volume for an audio buffer
+void SetAudioBufferVolume(AudioBuffer *buffer, float volume)
+{
+    if (buffer != NULL)
+    {
+        buffer->volume = volume;
+        PushAudioCommand(AUDIO_COMMAND_VOLUME, buffer, NULL, volume, 0);
+    }
+    else TraceLog(LOG_WARNING, "SetAudioBufferVolume() : No audio buffer");
+}
+
+// Set pitch for an audio buffer
+void SetAudioBufferPitch(AudioBuffer *buffer, float pitch)
+{
+    if (buffer != NULL)
+    {
+        // Pitching is just an adjustment of the sample rate.
+        // Note that this changes the duration of the sound:
+        //  - higher pitches will make the sound faster
+        //  - lower pitches make it slower
+        // NOTE: Converter is owned by audio thread, output sample rate is computed from device sample rate
+        // (pitch*outputSampleRate is always device sample rate) and applied by audio thread
+        ma_uint32 newOutputSampleRate = (ma_uint32)((float)deviceSampleRate/pitch);
+        buffer->pitch = (float)deviceSampleRate/newOutputSampleRate;
+
+        PushAudioCommand(AUDIO_COMMAND_PITCH, buffer, NULL, (float)newOutputSampleRate, 0);
+    }
+    else TraceLog(LOG_WARNING, "SetAudioBufferPitch() : No audio buffer");
+}
+
+// Track audio buffer to linked list next position
+// NOTE: Linked list is owned by audio thread, buffer is tracked before next mixing
+void TrackAudioBuffer(AudioBuffer *buffer)
+{
+    PushAudioCommand(AUDIO_COMMAND_TRACK, buffer, NULL, 0.0f, 0);
+}
+
+// Untrack audio buffer from linked list
+// NOTE: Buffer is untracked before next mixing, use WaitAudioCommands() before releasing it
+void UntrackAudioBuffer(AudioBuffer *buffer)
+{
+    PushAudioCommand(AUDIO_COMMAND_UNTRACK, buffer, NULL, 0.0f, 0);
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition - Sounds loading and playing (.WAV)
+//----------------------------------------------------------------------------------
+
+// Load wave data from file
+Wave LoadWave(const char *fileName)
+{
+    Wave wave = { 0 };
+
+    if (false) { }
+#if defined(SUPPORT_FILEFORMAT_WAV)
+    else if (IsFileExtension(fileName, ".wav")) wave = LoadWAV(fileName);
+#endif
+#if defined(SUPPORT_FILEFORMAT_OGG)
+    else if (IsFileExtension(fileName, ".ogg")) wave = LoadOGG(fileName);
+#endif
+#if defined(SUPPORT_FILEFORMAT_FLAC)
+    else if (IsFileExtension(fileName, ".flac")) wave = LoadFLAC(fileName);
+#endif
+#if defined(SUPPORT_FILEFORMAT_MP3)
+    else if (IsFileExtension(fileName, ".mp3")) wave = LoadMP3(fileName);
+#endif
+    else TraceLog(LOG_WARNING, "[%s] Audio fileformat not supported, it can't be loaded", fileName);
+
+    return wave;
+}
+
+// Load sound from file
+// NOTE: The entire file is loaded to memory to be played (no-streaming)
+Sound LoadSound(const char *fileName)
+{
+#if defined(RAUDIO_MAPPED_FILES)
+    // WAV data already in device format is not loaded, file is mapped into memory
+    if (IsFileExtension(fileName, ".wav"))
+    {
+        Sound sound = LoadSoundMappedWAV(fileName);
+        if (sound.stream.buffer != NULL) return sound;
+    }
+#endif
+
+    Wave wave = LoadWave(fileName);
+
+    Sound sound = LoadSoundFromWave(wave);
+
+    UnloadWave(wave);       // Sound is loaded, we can unload wave
+
+    return sound;
+}
+
+// Load sound from wave data
+// NOTE: Wave data must be unallocated manually
+Sound LoadSoundFromWave(Wave wave)
+{
+    Sound sound = { 0 };
+
+    if (wave.data != NULL)
+    {
+        // When using miniaudio we need to do our own mixing.
+        // To simplify this we need convert the format of each sound to be consistent with
+        // the format used to open the playback device. We can do this two ways:
+        //
+        //   1) Convert the whole sound in one go at load time (here).
+        //   2) Convert the audio data in chunks at mixing time.
+        //
+        // First option has been selected, format conversion is done on the loading stage.
+        // The downside is that it uses more memory if the original sound is u8 or s16.
+        ma_format formatIn  = ((wave.sampleSize == 8)? ma_format_u8 : ((wave.sampleSize == 16)? ma_format_s16 : ma_format_f32));
+        ma_uint32 frameCountIn = wave.sampleCount/wave.channels;
+
+        ma_uint32 frameCount = ConvertAudioFrames(NULL, DEVICE_FORMAT, DEVICE_CHANNELS, deviceSampleRate, NULL, formatIn, wave.channels, wave.sampleRate, frameCountIn);
+        if (frameCount == 0) TraceLog(LOG_WARNING, "LoadSoundFromWave() : Failed to get frame count for format conversion");
+
+        AudioBuffer *audioBuffer = InitAudioBuffer(DEVICE_FORMAT, DEVICE_CHANNELS, deviceSampleRate, frameCount, AUDIO_BUFFER_USAGE_STATIC);
+        if (audioBuffer == NULL) TraceLog(LOG_WARNING, "LoadSoundFromWave() : Failed to create audio buffer");
+
+        frameCount = ConvertAudioFrames(audioBuffer->buffer, DEVICE_FORMAT, DEVICE_CHANNELS, deviceSampleRate, wave.data, formatIn, wave.channels, wave.sampleRate, frameCountIn);
+        if (frameCount == 0) TraceLog(LOG_WARNING, "LoadSoundFromWave() : Format conversion failed");
+
+        // Sound data can be shared by sound instances (LoadSoundAlias())
+        audioBuffer->shared = (AudioData *)RL_CALLOC(1, sizeof(AudioData));
+        audioBuffer->shared->data = audioBuffer->buffer;
+        audioBuffer->shared->dataSize = frameCount*DEVICE_CHANNELS*ma_get_bytes_per_sample(DEVICE_FORMAT);
+        audioBuffer->shared->refCount = 1;
+
+        sound.sampleCount = frameCount*DEVICE_CHANNELS;
+        sound.stream.sampleRate = deviceSampleRate;
+        sound.stream.sampleSize = 32;
+        sound.stream.channels = DEVICE_CHANNELS;
+        sound.stream.buffer = audioBuffer;
+    }
+
+    return sound;
+}
+
+// Load compressed sound from file (OGG, FLAC, MP3), encoded data is kept in memory and decoded on playing
+// NOTE: Sounds decoded at the same time are limited (MAX_AUDIO_DECODERS), not supported formats are fully loaded (LoadSound())
+Sound LoadSoundCompressed(const char *fileName)
+{
+    Sound sound = { 0 };
+    int type = AUDIO_DECODER_NONE;
+
+    if (false) { }
+#if defined(SUPPORT_FILEFORMAT_OGG)
+    else if (IsFileExtension(fileName, ".ogg")) type = AUDIO_DECODER_OGG;
+#endif
+#if defined(SUPPORT_FILEFORMAT_FLAC)
+    else if (IsFileExtension(fileName, ".flac")) type = AUDIO_DECODER_FLAC;
+#endif
+#if defined(SUPPORT_FILEFORMAT_MP3)
+    else if (IsFileExtension(fileName, ".mp3")) type = AUDIO_DECODER_MP3;
+#endif
+
+    if (type == AUDIO_DECODER_NONE)
+    {
+        TraceLog(LOG_INFO, "[%s] Audio fileformat can't be decoded on playing, sound fully loaded", fileName);
+        return LoadSound(fileName);
+    }
+
+    FILE *file = fopen(fileName, "rb");
+
+    if (file == NULL)
+    {
+        TraceLog(LOG_WARNING, "[%s] Compressed sound file could not be opened", fileName);
+        return sound;
+    }
+
+    fseek(file, 0, SEEK_END);
+    unsigned int dataSize = (unsigned int)ftell(file);
+    fseek(file, 0, SEEK_SET);
+
+    unsigned char *data = (unsigned char *)RL_MALLOC(dataSize);
+    unsigned int bytesRead = (unsigned int)fread(data, 1, dataSize, file);
+    fclose(file);
+
+    unsigned int channels = 0;
+    unsigned int sampleRate = 0;
+    unsigned int frameCount = 0;
+    void *decoder = (bytesRead == dataSize)? OpenAudioDecoder(type, data, dataSize, &channels, &sampleRate, &frameCount) : NULL;
+
+    if (decoder == NULL)
+    {
+        TraceLog(LOG_WARNING, "[%s] Compressed sound data could not be decoded", fileName);
+        RL_FREE(data);
+        return sound;
+    }
+
+    AudioBuffer *audioBuffer = InitAudioBuffer(ma_format_f32, channels, sampleRate, 0, AUDIO_BUFFER_USAGE_STATIC);
+
+    if (audioBuffer == NULL)
+    {
+        TraceLog(LOG_WARNING, "LoadSoundCompressed() : Failed to create audio buffer");
+        CloseAudioDecoder(type, decoder);
+        RL_FREE(data);
+        return sound;
+    }
+
+    RL_FREE(audioBuffer->buffer);
+
+    // Encoded data can be shared by sound instances (LoadSoundAlias()), every instance has its own decoder
+    audioBuffer->shared = (AudioData *)RL_CALLOC(1, sizeof(AudioData));
+    audioBuffer->shared->data = data;
+    audioBuffer->shared->dataSize = dataSize;
+    audioBuffer->shared->refCount = 1;
+    audioBuffer->buffer = data;
+    audioBuffer->bufferSizeInFrames = frameCount;
+    audioBuffer->decoderType = type;
+    audioBuffer->decoder = decoder;
+
+    sound.sampleCount = frameCount*channels;
+    sound.stream.sampleRate = sampleRate;
+    sound.stream.sampleSize = 32;
+    sound.stream.channels = channels;
+    sound.stream.buffer = audioBuffer;
+
+    TraceLog(LOG_INFO, "[%s] Compressed sound loaded successfully (%i Hz, %s, %i bytes encoded)", fileName, sampleRate, (channels == 1)? "Mono" : "Stereo", dataSize);
+
+    return sound;
+}
+
+// Load sound instance sharing source sound data, instance has its own playing state, volume and pitch
+// NOTE: Data is not copied, it is released when last instance is unloaded (UnloadSound())
+Sound LoadSoundAlias(Sound source)
+{
+    Sound sound = { 0 };
+
+    if ((source.stream.buffer != NULL) && (source.stream.buffer->shared != NULL))
+    {
+        AudioBuffer *audioBuffer = InitAudioBuffer(source.stream.buffer->dsp.formatConverterIn.config.formatIn, source.stream.buffer->dsp.formatConverterIn.config.channels,
+                                                   source.stream.buffer->dsp.src.config.sampleRateIn, 0, AUDIO_BUFFER_USAGE_STATIC);
+
+        if (audioBuffer == NULL)
+        {
+            TraceLog(LOG_WARNING, "LoadSoundAlias() : Failed to create audio buffer");
+            return sound;
+        }
+
+        RL_FREE(audioBuffer->buffer);
+
+        // Compressed sound instances decode shared encoded data with their own decoder
+        if (source.stream.buffer->decoder != NULL)
+        {
+            unsigned int channels = 0, sampleRate = 0, frameCount = 0;
+
+            audioBuffer->decoderType = source.stream.buffer->decoderType;
+            audioBuffer->decoder = OpenAudioDecoder(audioBuffer->decoderType, source.stream.buffer->shared->data, source.stream.buffer->shared->dataSize, &channels, &sampleRate, &frameCount);
+
+            if (audioBuffer->decoder == NULL)
+            {
+                TraceLog(LOG_WARNING, "LoadSoundAlias() : Failed to create compressed sound decoder");
+                audioBuffer->buffer = NULL;
+                CloseAudioBuffer(audioBuffer);
+                return sound;
+            }
+        }
+
+        audioBuffer->shared = source.stream.buffer->shared;
+        audioBuffer->shared->refCount++;
+        audioBuffer->buffer = source.stream.buffer->buffer;   // NOTE: Mapped data starts at data chunk, not at shared data start
+        audioBuffer->bufferSizeInFrames = source.stream.buffer->bufferSizeInFrames;
+        audioBuffer->subBufferCount = source.stream.buffer->subBufferCount;
+        audioBuffer->priority = source.stream.buffer->priority;
+        audioBuffer->maxInstances = source.stream.buffer->maxInstances;
+
+        sound = source;
+        sound.stream.buffer = audioBuffer;
+    }
+    else TraceLog(LOG_WARNING, "LoadSoundAlias() : Invalid source sound");
+
+    return sound;
+}
+
+// Unload wave data
+void UnloadWave(Wave wave)
+{
+    if (wave.data != NULL) RL_FREE(wave.data);
+
+    TraceLog(LOG_INFO, "Unloaded wave data from RAM");
+}
+
+// Unload sound
+void UnloadSound(Sound sound)
+{
+    // Voices playing sound data are stopped
+    for (int i = 0; i < MAX_AUDIO_VOICES; i++)
+    {
+        if ((audioVoices[i].source != NULL) && (audioVoices[i].source == sound.stream.buffer)) StopAudioVoice(i);
+    }
+
+    CloseAudioBuffer(sound.stream.buffer);
+
+    TraceLog(LOG_INFO, "Unloaded sound data from RAM");
+}
+
+// Update sound buffer with new data
+void UpdateSound(Sound sound, const void *data, int samplesCount)
+{
+    AudioBuffer *audioBuffer = sound.stream.buffer;
+
+    if ((audioBuffer != NULL) && (audioBuffer->decoder != NULL)) TraceLog(LOG_WARNING, "UpdateSound() : Compressed sound data can't be updated");
+    else if (audioBuffer != NULL)
+    {
+        StopAudioBuffer(audioBuffer);
+        WaitAudioCommands();        // Data buffer is read at mixing time, buffer must be stopped
+
+        // Data shared with other sound instances (or mapped from file) is not modified, sound gets its own data copy
+        if ((audioBuffer->shared != NULL) && ((audioBuffer->shared->refCount > 1) || audioBuffer->shared->mapped))
+        {
+            unsigned int dataSize = audioBuffer->bufferSizeInFrames*audioBuffer->dsp.formatConverterIn.config.channels*ma_get_bytes_per_sample(audioBuffer->dsp.formatConverterIn.config.formatIn);
+
+            AudioData *shared = (AudioData *)RL_CALLOC(1, sizeof(AudioData));
+            shared->data = (unsigned char *)RL_MALLOC(dataSize);
+            shared->dataSize = dataSize;
+            shared->refCount = 1;
+            memcpy(shared->data, audioBuffer->buffer, dataSize);
+
+            ReleaseAudioData(audioBuffer->shared);
+            audioBuffer->shared = shared;
+            audioBuffer->buffer = shared->data;
+        }
+
+        memcpy(audioBuffer->buffer, data, samplesCount*audioBuffer->dsp.formatConverterIn.config.channels*ma_get_bytes_per_sample(audioBuffer->dsp.formatConverterIn.config.formatIn));
+    }
+    else TraceLog(LOG_ERROR, "UpdateSound() : Invalid sound - no audio buffer");
+}
+
+// Export wave data to file
+void ExportWave(Wave wave, const char *fileName)
+{
+    bool success = false;
+
+    if (false) { }
+#if defined(SUPPORT_FILEFORMAT_WAV)
+    else if (IsFileExtension(fileName, ".wav")) success = SaveWAV(wave, fileName);
+#endif
+    else if (IsFileExtension(fileName, ".raw"))
+    {
+        // Export raw sample data (without header)
+        // NOTE: It's up to the user to track wave parameters
+        FILE *rawFile = fopen(fileName, "wb");
+        success = fwrite(wave.data, wave.sampleCount*wave.channels*wave.sampleSize/8, 1, rawFile);
+        fclose(rawFile);
+    }
+
+    if (success) TraceLog(LOG_INFO, "Wave exported successfully: %s", fileName);
+    else TraceLog(LOG_WARNING, "Wave could not be exported.");
+}
+
+// Export wave sample data to code (.h)
+void ExportWaveAsCode(Wave wave, const char *fileName)
+{
+    #define BYTES_TEXT_PER_LINE     20
+
+    char varFileName[256] = { 0 };
+    int dataSize = wave.sampleCount*wave.channels*wave.sampleSize/8;
+
+    FILE *txtFile = fopen(fileName, "wt");
+
+    if (txtFile != NULL)
+    {
+        fprintf(txtFile, "\n//////////////////////////////////////////////////////////////////////////////////\n");
+        fprintf(txtFile, "//                                                                              //\n");
+        fprintf(txtFile, "// WaveAsCode exporter v1.0 - Wave data exported as an array of bytes           //\n");
+        fprintf(txtFile, "//                                                                              //\n");
+        fprintf(txtFile, "// more info and bugs-report:  github.com/raysan5/raylib                        //\n");
+        fprintf(txtFile, "// feedback and support:       ray[at]raylib.com                                //\n");
+        fprintf(txtFile, "//                                                                              //\n");
+        fprintf(txtFile, "// Copyright (c) 2018 Ramon Santamaria (@raysan5)                               //\n");
+        fprintf(txtFile, "//                                                                              //\n");
+        fprintf(txtFile, "//////////////////////////////////////////////////////////////////////////////////\n\n");
+
+#if !defined(RAUDIO_STANDALONE)
+        // Get file name from path and convert variable name to uppercase
+        strcpy(varFileName, GetFileNameWithoutExt(fileName));
+        for (int i = 0; varFileName[i] != '\0'; i++) if (varFileName[i] >= 'a' && varFileName[i] <= 'z') { varFileName[i] = varFileName[i] - 32; }
+#else
+        strcpy(varFileName, fileName);
+#endif
+
+        fprintf(txtFile, "// Wave data information\n");
+        fprintf(txtFile, "#define %s_SAMPLE_COUNT     %i\n", varFileName, wave.sampleCount);
+        fprintf(txtFile, "#define %s_SAMPLE_RATE      %i\n", varFileName, wave.sampleRate);
+        fprintf(txtFile, "#define %s_SAMPLE_SIZE      %i\n", varFileName, wave.sampleSize);
+        fprintf(txtFile, "#define %s_CHANNELS         %i\n\n", varFileName, wave.channels);
+
+        // Write byte data as hexadecimal text
+        fprintf(txtFile, "static unsigned char %s_DATA[%i] = { ", varFileName, dataSize);
+        for (int i = 0; i < dataSize - 1; i++) fprintf(txtFile, ((i%BYTES_TEXT_PER_LINE == 0)? "0x%x,\n" : "0x%x, "), ((unsigned char *)wave.data)[i]);
+        fprintf(txtFile, "0x%x };\n", ((unsigned char *)wave.data)[dataSize - 1]);
+
+        fclose(txtFile);
+    }
+}
+
+// Play a sound
+void PlaySound(Sound sound)
+{
+    PlayAudioBuffer(sound.stream.buffer);
+}
+
+// Play a sound in the multichannel buffer pool
+// NOTE: Sound is played on a new voice (see PlaySoundVoice())
+void PlaySoundMulti(Sound sound)
+{
+    PlaySoundVoice(sound, 1.0f, 0.0f);
+}
+
+// Stop any sound played with PlaySoundMulti()
+void StopSoundMulti(void)
+{
+    for (int i = 0; i < MAX_AUDIO_VOICES; i++)
+    {
+        if (audioVoices[i].source != NULL) StopAudioVoice(i);
+    }
+}
+
+// Get number of sounds playing in the multichannel buffer pool
+// NOTE: Mixed and virtual voices are counted
+int GetSoundsPlaying(void)
+{
+    int counter = 0;
+
+    UpdateAudioVoices();
+
+    for (int i = 0; i < MAX_AUDIO_VOICES; i++)
+    {
+        if (audioVoices[i].source != NULL) counter++;
+    }
+
+    return counter;
+}
+
+// Set max voices mixed at the same time, less audible voices are virtual (not mixed)
+void SetAudioVoicesLimit(int maxVoices)
+{
+    if (maxVoices < 1) maxVoices = 1;
+    else if (maxVoices > MAX_AUDIO_VOICES_MIXED) maxVoices = MAX_AUDIO_VOICES_MIXED;
+
+    audioVoicesLimit = maxVoices;
+}
+
+// Set voices distance attenuation range, voices volume goes linearly from 1.0 (minDistance) to 0.0 (maxDistance)
+// NOTE: Voices beyond maxDistance are virtual (not mixed), use maxDistance 0.0f for no distance attenuation
+void SetAudioVoicesDistance(float minDistance, float maxDistance)
+{
+    voicesMinDistance = minDistance;
+    voicesMaxDistance = maxDistance;
+}
+
+// Set sound voices priority and max instances (voices playing sound at the same time, 0 for unlimited)
+void SetSoundPriority(Sound sound, int priority, int maxInstances)
+{
+    if (sound.stream.buffer != NULL)
+    {
+        sound.stream.buffer->priority = priority;
+        sound.stream.buffer->maxInstances = (maxInstances > 0)? maxInstances : 0;
+    }
+    else TraceLog(LOG_WARNING, "SetSoundPriority() : No audio buffer");
+}
+
+// Play sound on a new voice, returns voice id (-1 if not played)
+// NOTE: When voices or sound instances are exhausted, voice with lowest priority and audibility is stopped
+// if new voice takes precedence, otherwise new voice is not played
+int PlaySoundVoice(Sound sound, float volume, float distance)
+{
+    AudioBuffer *source = sound.stream.buffer;
+
+    if (source == NULL)
+    {
+        TraceLog(LOG_WARNING, "PlaySoundVoice() : No audio buffer");
+        return -1;
+    }
+
+    if (source->decoder != NULL)
+    {
+        TraceLog(LOG_WARNING, "PlaySoundVoice() : Compressed sounds can't be played on voices, use LoadSoundAlias() instances");
+        return -1;
+    }
+
+    UpdateAudioVoices();
+
+    AudioVoice candidate = { 0 };
+    candidate.source = source;
+    candidate.volume = volume;
+    candidate.distance = distance;
+
+    // Voices of a positioned sound are spatial, distance is computed from listener
+    if (source->positioned)
+    {
+        candidate.spatial = true;
+        memcpy(candidate.position, source->position, sizeof(candidate.position));
+        memcpy(candidate.velocity, source->velocity, sizeof(candidate.velocity));
+        candidate.distance = GetAudioSpatialDistance(candidate.position);
+    }
+
+    float audibility = GetAudioVoiceAudibility(&candidate);
+
+    if (source->maxInstances > 0)
+    {
+        int instances = 0;
+        for (int i = 0; i < MAX_AUDIO_VOICES; i++) if (audioVoices[i].source == source) instances++;
+
+        if (instances >= source->maxInstances)
+        {
+            int weakest = FindWeakestAudioVoice(source);
+
+            if (!CheckAudioVoicePrecedence(source->priority, audibility, &audioVoices[weakest])) return -1;
+            StopAudioVoice(weakest);
+        }
+    }
+
+    int slot = -1;
+    for (int i = 0; (i < MAX_AUDIO_VOICES) && (slot == -1); i++) if (audioVoices[i].source == NULL) slot = i;
+
+    if (slot == -1)
+    {
+        int weakest = FindWeakestAudioVoice(NULL);
+
+        if (!CheckAudioVoicePrecedence(source->priority, audibility, &audioVoices[weakest])) return -1;
+        StopAudioVoice(weakest);
+        slot = weakest;
+    }
+
+    AudioVoice *voice = &audioVoices[slot];
+    voice->source = source;
+    voice->pool = -1;
+    voice->volume = volume;
+    voice->distance = candidate.distance;
+    voice->spatial = candidate.spatial;
+    memcpy(voice->position, candidate.position, sizeof(voice->position));
+    memcpy(voice->velocity, candidate.velocity, sizeof(voice->velocity));
+    voice->audibility = audibility;
+    voice->startFrame = mixFramesCounter;
+    voice->generation = (voice->generation + 1)%(0x7fffffff/MAX_AUDIO_VOICES);
+
+    // Voice is mixed now if it is audible enough
+    UpdateAudioVoices();
+
+    return voice->generation*MAX_AUDIO_VOICES + slot;
+}
+
+// Set voice volume (applied on next UpdateAudioVoices())
+void SetVoiceVolume(int voice, float volume)
+{
+    int slot = GetAudioVoice(voice);
+    if (slot != -1) audioVoices[slot].volume = volume;
+}
+
+// Set voice emitter position and velocity, voice is spatial (panned and attenuated by mixer)
+// NOTE: Distance to listener is computed from position, mixed voice emitter is updated on UpdateAudioSpatial()
+void SetVoicePosition(int voice, Vector3 position, Vector3 velocity)
+{
+    int slot = GetAudioVoice(voice);
+
+    if (slot != -1)
+    {
+        AudioVoice *current = &audioVoices[slot];
+
+        current->spatial = true;
+        current->position[0] = position.x;
+        current->position[1] = position.y;
+        current->position[2] = position.z;
+        current->velocity[0] = velocity.x;
+        current->velocity[1] = velocity.y;
+        current->velocity[2] = velocity.z;
+        current->distance = GetAudioSpatialDistance(current->position);
+
+        if (current->pool != -1)
+        {
+            AudioBuffer *buffer = audioBufferPool[current->pool];
+            float volume = current->volume*current->source->volume;
+
+            SyncAudioVoiceEmitter(slot);
+            if (buffer->volume != volume) SetAudioBufferVolume(buffer, volume);
+        }
+    }
+}
+
+// Set voice emitter distance to listener (applied on next UpdateAudioVoices())
+void SetVoiceDistance(int voice, float distance)
+{
+    int slot = GetAudioVoice(voice);
+    if (slot != -1) audioVoices[slot].distance = distance;
+}
+
+// Stop voice
+void StopVoice(int voice)
+{
+    int slot = GetAudioVoice(voice);
+    if (slot != -1) StopAudioVoice(slot);
+}
+
+// Check if voice is playing (mixed or virtual)
+bool IsVoicePlaying(int voice)
+{
+    int slot = GetAudioVoice(voice);
+    if (slot == -1) return false;
+
+    const AudioVoice *current = &audioVoices[slot];
+
+    if (current->pool != -1) return audioBufferPool[current->pool]->playing;
+    else return (current->source->looping || ((mixFramesCounter - current->startFrame) < current->source->bufferSizeInFrames));
+}
+
+// Check if voice is virtual (playing, not mixed)
+bool IsVoiceVirtual(int voice)
+{
+    int slot = GetAudioVoice(voice);
+
+    return ((slot != -1) && (audioVoices[slot].pool == -1));
+}
+
+// Update voices: ended voices are released, voices with highest priority and audibility are mixed (up to voices limit)
+// NOTE: Virtual voices playback position is tracked, they continue from it when mixed again
+void UpdateAudioVoices(void)
+{
+    int order[MAX_AUDIO_VOICES] = { 0 };
+    int count = 0;
+    unsigned int framesCounter = mixFramesCounter;
+
+    for (int i = 0; i < MAX_AUDIO_VOICES; i++)
+    {
+        AudioVoice *voice = &audioVoices[i];
+        if (voice->source == NULL) continue;
+
+        // Release ended voices
+        if (voice->pool != -1)
+        {
+            if (!audioBufferPool[voice->pool]->playing)
+            {
+                StopAudioVoice(i);
+                continue;
+            }
+        }
+        else if (!voice->source->looping && ((framesCounter - voice->startFrame) >= voice->source->bufferSizeInFrames))
+        {
+            StopAudioVoice(i);
+            continue;
+        }
+
+        if (voice->spatial) voice->distance = GetAudioSpatialDistance(voice->position);
+
+        voice->audibility = GetAudioVoiceAudibility(voice);
+        order[count++] = i;
+    }
+
+    qsort(order, count, sizeof(int), CompareAudioVoices);
+
+    // Voices not mixed anymore release their pool buffer first
+    for (int i = 0; i < count; i++)
+    {
+        AudioVoice *voice = &audioVoices[order[i]];
+        bool mixed = (i < audioVoicesLimit) && (voice->audibility > AUDIO_VOICE_CULL_VOLUME);
+
+        if (!mixed && (voice->pool != -1))
+        {
+            StopAudioBuffer(audioBufferPool[voice->pool]);
+            audioBufferPoolVoice[voice->pool] = 0;
+            voice->pool = -1;
+        }
+    }
+
+    for (int i = 0; (i < count) && (i < audioVoicesLimit); i++)
+    {
+        AudioVoice *voice = &audioVoices[order[i]];
+        if (voice->audibility <= AUDIO_VOICE_CULL_VOLUME) break;
+
+        // NOTE: Spatial voices distance attenuation is applied by mixer (emitter gains)
+        float volume = voice->spatial? voice->volume*voice->source->volume : voice->audibility;
+
+        if (voice->pool == -1)
+        {
+            int pool = 0;
+            while ((pool < MAX_AUDIO_VOICES_MIXED) && (audioBufferPoolVoice[pool] != 0)) pool++;
+            if (pool == MAX_AUDIO_VOICES_MIXED) break;
+
+            if (audioBufferPool[pool] == NULL)
+            {
+                audioBufferPool[pool] = InitAudioBuffer(DEVICE_FORMAT, DEVICE_CHANNELS, deviceSampleRate, 0, AUDIO_BUFFER_USAGE_STATIC);
+                if (audioBufferPool[pool] == NULL) break;
+
+                RL_FREE(audioBufferPool[pool]->buffer);
+                audioBufferPool[pool]->buffer = NULL;
+            }
+
+            audioBufferPoolVoice[pool] = order[i] + 1;
+            voice->pool = pool;
+
+            // Pool buffer emitter is set before playing, spatial voice is panned from first mixing
+            SyncAudioVoiceEmitter(order[i]);
+
+            // NOTE: Pool buffer could still be mixed (stop command queued), sound data is set by audio thread
+            AudioBuffer *buffer = audioBufferPool[pool];
+            buffer->volume = volume;
+            buffer->playing = true;
+            buffer->paused = false;
+
+            PushAudioCommand(AUDIO_COMMAND_PLAY_SOURCE, buffer, voice->source, volume, framesCounter - voice->startFrame);
+        }
+        else if (audioBufferPool[voice->pool]->volume != volume) SetAudioBufferVolume(audioBufferPool[voice->pool], volume);
+    }
+}
+
+// Set listener position, orientation (forward and up directions) and velocity, spatial audio
+// NOTE: Applied on next UpdateAudioSpatial()
+void SetAudioListener(Vector3 position, Vector3 forward, Vector3 up, Vector3 velocity)
+{
+    // Listener right direction is the pan axis: cross(forward, up)
+    float right[3] = { forward.y*up.z - forward.z*up.y, forward.z*up.x - forward.x*up.z, forward.x*up.y - forward.y*up.x };
+    float length = sqrtf(right[0]*right[0] + right[1]*right[1] + right[2]*right[2]);
+
+    if (length > 0.0001f) for (int i = 0; i < 3; i++) audioSpatial.listenerRight[i] = right[i]/length;
+    else TraceLog(LOG_WARNING, "SetAudioListener() : Invalid listener orientation, forward and up directions are parallel");
+
+    audioSpatial.listenerPosition[0] = position.x;
+    audioSpatial.listenerPosition[1] = position.y;
+    audioSpatial.listenerPosition[2] = position.z;
+    audioSpatial.listenerVelocity[0] = velocity.x;
+    audioSpatial.listenerVelocity[1] = velocity.y;
+    audioSpatial.listenerVelocity[2] = velocity.z;
+}
+
+// Set doppler effect scale (1.0f is physical doppler, 0.0f disables it)
+void SetAudioDopplerFactor(float factor)
+{
+    audioSpatial.dopplerFactor = (factor < 0.0f)? 0.0f : factor;
+}
+
+// Update spatial audio: listener and emitters positions set since last update are applied together
+// NOTE: Mixer computes all emitters gains at once, no per emitter synchronization with audio thread.
+// If audio thread has not taken last update yet (no mixing since), this one is skipped, next one applies it
+void UpdateAudioSpatial(void)
+{
+    // Mixed spatial voices emitters follow voices positions
+    for (int i = 0; i < MAX_AUDIO_VOICES; i++)
+    {
+        if ((audioVoices[i].source != NULL) && (audioVoices[i].pool != -1) && audioVoices[i].spatial) SyncAudioVoiceEmitter(i);
+    }
+
+    // Distance attenuation range is shared with voices audibility
+    audioSpatial.minDistance = voicesMinDistance;
+    audioSpatial.maxDistance = voicesMaxDistance;
+
+    if (!isAudioInitialized)
+    {
+        memcpy(&mixSpatial, &audioSpatial, sizeof(AudioSpatial));
+        ComputeAudioEmitters(0, mixSpatial.emittersCount);
+    }
+    else if (!audioSpatialPending)
+    {
+        memcpy(&audioSpatialShared, &audioSpatial, sizeof(AudioSpatial));
+        ma_memory_barrier();    // Published copy must be visible before the flag
+        audioSpatialPending = true;
+    }
+}
+
+// Pause a sound
+void PauseSound(Sound sound)
+{
+    PauseAudioBuffer(sound.stream.buffer);
+}
+
+// Resume a paused sound
+void ResumeSound(Sound sound)
+{
+    ResumeAudioBuffer(sound.stream.buffer);
+}
+
+// Stop reproducing a sound
+void StopSound(Sound sound)
+{
+    StopAudioBuffer(sound.stream.buffer);
+}
+
+// Check if a sound is playing
+bool IsSoundPlaying(Sound sound)
+{
+    return IsAudioBufferPlaying(sound.stream.buffer);
+}
+
+// Set volume for a sound
+void SetSoundVolume(Sound sound, float volume)
+{
+    SetAudioBufferVolume(sound.stream.buffer, volume);
+}
+
+// Set sound emitter position and velocity, voices played are spatial (panned and attenuated by mixer)
+// NOTE: Voices playing the sound follow the new position
+void SetSoundPosition(Sound sound, Vector3 position, Vector3 velocity)
+{
+    AudioBuffer *buffer = sound.stream.buffer;
+
+    if (buffer == NULL)
+    {
+        TraceLog(LOG_WARNING, "SetSoundPosition() : No audio buffer");
+        return;
+    }
+
+    buffer->positioned = true;
+    buffer->position[0] = position.x;
+    buffer->position[1] = position.y;
+    buffer->position[2] = position.z;
+    buffer->velocity[0] = velocity.x;
+    buffer->velocity[1] = velocity.y;
+    buffer->velocity[2] = velocity.z;
+
+    for (int i = 0; i < MAX_AUDIO_VOICES; i++)
+    {
+        if (audioVoices[i].source == buffer)
+        {
+            audioVoices[i].spatial = true;
+            memcpy(audioVoices[i].position, buffer->position, sizeof(buffer->position));
+            memcpy(audioVoices[i].velocity, buffer->velocity, sizeof(buffer->velocity));
+        }
+    }
+}
+
+// Set mixing bus for a sound (0 is master bus)
+void SetSoundBus(Sound sound, int bus)
+{
+    if ((bus < 0) || (bus >= MAX_AUDIO_BUSES)) TraceLog(LOG_WARNING, "SetSoundBus() : Invalid bus index (%i)", bus);
+    else if (sound.stream.buffer != NULL) PushAudioCommand(AUDIO_COMMAND_BUS, sound.stream.buffer, NULL, 0.0f, (unsigned int)bus);
+}
+
+// Set pitch for a sound
+void SetSoundPitch(Sound sound, float pitch)
+{
+    SetAudioBufferPitch(sound.stream.buffer, pitch);
+}
+
+// Convert wave data to desired format
+void WaveFormat(Wave *wave, int sampleRate, int sampleSize, int channels)
+{
+    ma_format formatIn  = ((wave->sampleSize == 8)? ma_format_u8 : ((wave->sampleSize == 16)? ma_format_s16 : ma_format_f32));
+    ma_format formatOut = ((      sampleSize == 8)? ma_format_u8 : ((      sampleSize == 16)? ma_format_s16 : ma_format_f32));
+
+    ma_uint32 frameCountIn = wave->sampleCount;  // Is wave->sampleCount actually the frame count? That terminology needs to change, if so.
+
+    ma_uint32 frameCount = ConvertAudioFrames(NULL, formatOut, channels, sampleRate, NULL, formatIn, wave->channels, wave->sampleRate, frameCountIn);
+    if (frameCount == 0)
+    {
+        TraceLog(LOG_ERROR, "WaveFormat() : Failed to get frame count for format conversion.");
+        return;
+    }
+
+    void *data = RL_MALLOC(frameCount*channels*(sampleSize/8));
+
+    frameCount = ConvertAudioFrames(data, formatOut, channels, sampleRate, wave->data, formatIn, wave->channels, wave->sampleRate, frameCountIn);
+    if (frameCount == 0)
+    {
+        TraceLog(LOG_ERROR, "WaveFormat() : Format conversion failed.");
+        RL_FREE(data);
+        return;
+    }
+
+    wave->sampleCount = frameCount;
+    wave->sampleSize = sampleSize;
+    wave->sampleRate = sampleRate;
+    wave->channels = channels;
+    RL_FREE(wave->data);
+    wave->data = data;
+}
+
+// Convert waves data to desired format, waves are converted by worker threads
+// NOTE: Waves are converted on calling thread if audio device is not initialized
+void WaveFormatBatch(Wave *waves, int count, int sampleRate, int sampleSize, int channels)
+{
+    int threadsCount = (count < MAX_AUDIO_CONVERSION_THREADS)? count : MAX_AUDIO_CONVERSION_THREADS;
+
+    if ((threadsCount > 1) && isAudioInitialized && (ma_mutex_init(&context, &audioConversionLock) == MA_SUCCESS))
+    {
+        ma_thread threads[MAX_AUDIO_CONVERSION_THREADS] = { 0 };
+        AudioConversionJob jobs[MAX_AUDIO_CONVERSION_THREADS] = { 0 };
+        bool threadsRunning[MAX_AUDIO_CONVERSION_THREADS] = { 0 };
+
+        audioConversionLockReady = true;
+
+        for (int i = 0; i < threadsCount; i++)
+        {
+            jobs[i] = (AudioConversionJob){ waves, count, i, threadsCount, sampleRate, sampleSize, channels };
+
+            // NOTE: First job is run by calling thread
+            if (i > 0) threadsRunning[i] = (ma_thread_create(&context, &threads[i], WaveFormatThread, &jobs[i]) == MA_SUCCESS);
+        }
+
+        WaveFormatThread(&jobs[0]);
+
+        for (int i = 1; i < threadsCount; i++)
+        {
+            if (threadsRunning[i]) ma_thread_wait(&threads[i]);
+            else WaveFormatThread(&jobs[i]);      // Thread could not be created, job run by calling thread
+        }
+
+        audioConversionLockReady = false;
+        ma_mutex_uninit(&audioConversionLock);
+    }
+    else
+    {
+        for (int i = 0; i < count; i++) WaveFormat(&waves[i], sampleRate, sampleSize, channels);
+    }
+}
+
+// Set audio conversion quality (sample rate conversion), linear by default
+void SetAudioConversionQuality(int quality)
+{
+    audioConversionQuality = (quality == AUDIO_CONVERSION_SINC)? AUDIO_CONVERSION_SINC : AUDIO_CONVERSION_LINEAR;
+}
+
+// Set converted waves data cache, same data converted again to same format is just copied
+// NOTE: Cached data is released when cache is disabled
+void SetAudioConversionCache(bool enabled)
+{
+    if (enabled && (audioConversionCache == NULL))
+    {
+        audioConversionCache = (AudioConversionCache *)RL_CALLOC(MAX_AUDIO_CONVERSION_CACHE, sizeof(AudioConversionCache));
+        audioConversionCacheNext = 0;
+    }
+    else if (!enabled && (audioConversionCache != NULL))
+    {
+        for (int i = 0; i < MAX_AUDIO_CONVERSION_CACHE; i++) RL_FREE(audioConversionCache[i].data);
+
+        RL_FREE(audioConversionCache);
+        audioConversionCache = NULL;
+    }
+}
+
+// Copy a wave to a new wave
+Wave WaveCopy(Wave wave)
+{
+    Wave newWave = { 0 };
+
+    newWave.data = RL_MALLOC(wave.sampleCount*wave.sampleSize/8*wave.channels);
+
+    if (newWave.data != NULL)
     {
         // NOTE: Size must be provided in bytes
         memcpy(newWave.data, wave.data, wave.sampleCount*wave.channels*wave.sampleSize/8);
 
-        newWave.sampleCount = wave.sampleCount;
-        newWave.sampleRate = wave.sampleRate;
-        newWave.sampleSize = wave.sampleSize;
-        newWave.channels = wave.channels;
-    }
+        newWave.sampleCount = wave.sampleCount;
+        newWave.sampleRate = wave.sampleRate;
+        newWave.sampleSize = wave.sampleSize;
+        newWave.channels = wave.channels;
+    }
+
+    return newWave;
+}
+
+// Crop a wave to defined samples range
+// NOTE: Security check in case of out-of-range
+void WaveCrop(Wave *wave, int initSample, int finalSample)
+{
+    if ((initSample >= 0) && (initSample < finalSample) &&
+        (finalSample > 0) && ((unsigned int)finalSample < wave->sampleCount))
+    {
+        int sampleCount = finalSample - initSample;
+
+        void *data = RL_MALLOC(sampleCount*wave->sampleSize/8*wave->channels);
+
+        memcpy(data, (unsigned char *)wave->data + (initSample*wave->channels*wave->sampleSize/8), sampleCount*wave->channels*wave->sampleSize/8);
+
+        RL_FREE(wave->data);
+        wave->data = data;
+    }
+    else TraceLog(LOG_WARNING, "Wave crop range out of bounds");
+}
+
+// Get samples data from wave as a floats array
+// NOTE: Returned sample values are normalized to range [-1..1]
+float *GetWaveData(Wave wave)
+{
+    float *samples = (float *)RL_MALLOC(wave.sampleCount*wave.channels*sizeof(float));
+
+    for (unsigned int i = 0; i < wave.sampleCount; i++)
+    {
+        for (unsigned int j = 0; j < wave.channels; j++)
+        {
+            if (wave.sampleSize == 8) samples[wave.channels*i + j] = (float)(((unsigned char *)wave.data)[wave.channels*i + j] - 127)/256.0f;
+            else if (wave.sampleSize == 16) samples[wave.channels*i + j] = (float)((short *)wave.data)[wave.channels*i + j]/32767.0f;
+            else if (wave.sampleSize == 32) samples[wave.channels*i + j] = ((float *)wave.data)[wave.channels*i + j];
+        }
+    }
+
+    return samples;
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition - Music loading and stream playing (.OGG)
+//----------------------------------------------------------------------------------
+
+// Load music stream from file
+Music LoadMusicStream(const char *fileName)
+{
+    Music music = { 0 };
+    bool musicLoaded = false;
+
+    if (false) { }
+#if defined(SUPPORT_FILEFORMAT_OGG)
+    else if (IsFileExtension(fileName, ".ogg"))
+    {
+        // Open ogg audio stream
+        music.ctxData = stb_vorbis_open_filename(fileName, NULL, NULL);
+
+        if (music.ctxData != NULL)
+        {
+            music.ctxType = MUSIC_AUDIO_OGG;
+            stb_vorbis_info info = stb_vorbis_get_info((stb_vorbis *)music.ctxData);  // Get Ogg file info
+
+            // OGG bit rate defaults to 16 bit, it's enough for compressed format
+            music.stream = InitAudioStream(info.sample_rate, 16, info.channels);
+            music.sampleCount = (unsigned int)stb_vorbis_stream_length_in_samples((stb_vorbis *)music.ctxData)*info.channels;
+            music.loopCount = 0;   // Infinite loop by default
+            musicLoaded = true;
+        }
+    }
+#endif
+#if defined(SUPPORT_FILEFORMAT_FLAC)
+    else if (IsFileExtension(fileName, ".flac"))
+    {
+        music.ctxData = drflac_open_file(fileName);
+
+        if (music.ctxData != NULL)
+        {
+            music.ctxType = MUSIC_AUDIO_FLAC;
+            drflac *ctxFlac = (drflac *)music.ctxData;
+
+            music.stream = InitAudioStream(ctxFlac->sampleRate, ctxFlac->bitsPerSample, ctxFlac->channels);
+            music.sampleCount = (unsigned int)ctxFlac->totalSampleCount;
+            music.loopCount = 0;   // Infinite loop by default
+            musicLoaded = true;
+        }
+    }
+#endif
+#if defined(SUPPORT_FILEFORMAT_MP3)
+    else if (IsFileExtension(fileName, ".mp3"))
+    {
+        drmp3 *ctxMp3 = RL_MALLOC(sizeof(drmp3));
+        music.ctxData = ctxMp3;
+
+        int result = drmp3_init_file(ctxMp3, fileName, NULL);
+
+        if (result > 0)
+        {
+            music.ctxType = MUSIC_AUDIO_MP3;
+
+            music.stream = InitAudioStream(ctxMp3->sampleRate, 32, ctxMp3->channels);
+            music.sampleCount = drmp3_get_pcm_frame_count(ctxMp3)*ctxMp3->channels;
+            music.loopCount = 0;   // Infinite loop by default
+            musicLoaded = true;
+        }
+    }
+#endif
+#if defined(SUPPORT_FILEFORMAT_XM)
+    else if (IsFileExtension(fileName, ".xm"))
+    {
+        jar_xm_context_t *ctxXm = NULL;
+
+        int result = jar_xm_create_context_from_file(&ctxXm, 48000, fileName);
+
+        if (result == 0)    // XM context created successfully
+        {
+            music.ctxType = MUSIC_MODULE_XM;
+            jar_xm_set_max_loop_count(ctxXm, 0);    // Set infinite number of loops
+
+            // NOTE: Only stereo is supported for XM
+            music.stream = InitAudioStream(48000, 16, 2);
+            music.sampleCount = (unsigned int)jar_xm_get_remaining_samples(ctxXm);
+            music.loopCount = 0;   // Infinite loop by default
+            jar_xm_reset(ctxXm);   // make sure we start at the beginning of the song
+            musicLoaded = true;
+
+            music.ctxData = ctxXm;
+        }
+    }
+#endif
+#if defined(SUPPORT_FILEFORMAT_MOD)
+    else if (IsFileExtension(fileName, ".mod"))
+    {
+        jar_mod_context_t *ctxMod = RL_MALLOC(sizeof(jar_mod_context_t));
+        music.ctxData = ctxMod;
+
+        jar_mod_init(ctxMod);
+        int result = jar_mod_load_file(ctxMod, fileName);
+
+        if (result > 0)
+        {
+            music.ctxType = MUSIC_MODULE_MOD;
+
+            // NOTE: Only stereo is supported for MOD
+            music.stream = InitAudioStream(48000, 16, 2);
+            music.sampleCount = (unsigned int)jar_mod_max_samples(ctxMod);
+            music.loopCount = 0;   // Infinite loop by default
+            musicLoaded = true;
+        }
+    }
+#endif
+
+    if (!musicLoaded)
+    {
+        if (false) { }
+    #if defined(SUPPORT_FILEFORMAT_OGG)
+        else if (music.ctxType == MUSIC_AUDIO_OGG) stb_vorbis_close((stb_vorbis *)music.ctxData);
+    #endif
+    #if defined(SUPPORT_FILEFORMAT_FLAC)
+        else if (music.ctxType == MUSIC_AUDIO_FLAC) drflac_free((drflac *)music.ctxData);
+    #endif
+    #if defined(SUPPORT_FILEFORMAT_MP3)
+        else if (music.ctxType == MUSIC_AUDIO_MP3) { drmp3_uninit((drmp3 *)music.ctxData); RL_FREE(music.ctxData); }
+    #endif
+    #if defined(SUPPORT_FILEFORMAT_XM)
+        else if (music.ctxType == MUSIC_MODULE_XM) jar_xm_free_context((jar_xm_context_t *)music.ctxData);
+    #endif
+    #if defined(SUPPORT_FILEFORMAT_MOD)
+        else if (music.ctxType == MUSIC_MODULE_MOD) { jar_mod_unload((jar_mod_context_t *)music.ctxData); RL_FREE(music.ctxData); }
+    #endif
+
+        TraceLog(LOG_WARNING, "[%s] Music file could not be opened", fileName);
+    }
+    else
+    {
+        // Show some music stream info
+        TraceLog(LOG_INFO, "[%s] Music file successfully loaded:", fileName);
+        TraceLog(LOG_INFO, "   Total samples: %i", music.sampleCount);
+        TraceLog(LOG_INFO, "   Sample rate: %i Hz", music.stream.sampleRate);
+        TraceLog(LOG_INFO, "   Sample size: %i bits", music.stream.sampleSize);
+        TraceLog(LOG_INFO, "   Channels: %i (%s)", music.stream.channels, (music.stream.channels == 1)? "Mono" : (music.stream.channels == 2)? "Stereo" : "Multi");
+
+        // Modules are pre-rendered if enabled, cache is registered with music stream
+        MusicModuleCache *cache = NULL;
+        if (musicModuleCacheEnabled && ((music.ctxType == MUSIC_MODULE_XM) || (music.ctxType == MUSIC_MODULE_MOD))) cache = LoadMusicModuleCache(music, fileName);
+
+        // Register music stream state (loops count), refilled by streaming thread if enabled
+        if (musicStreamLocksReady) ma_mutex_lock(&musicStreamsLock);
+
+        Music *stream = GetMusicStream(NULL);
+        if (stream != NULL) *stream = music;
+        else TraceLog(LOG_WARNING, "[%s] Music streams limit reached, music must be updated with UpdateMusicStream()", fileName);
+
+        for (int i = 0; (i < MAX_MUSIC_STREAMS) && (cache != NULL); i++)
+        {
+            if (musicModuleCaches[i] == NULL)
+            {
+                musicModuleCaches[i] = cache;
+                cache = NULL;
+            }
+        }
+
+        if (musicStreamLocksReady) ma_mutex_unlock(&musicStreamsLock);
+
+        // NOTE: Caches limit is the music streams limit, module is rendered on playing
+        if (cache != NULL) UnloadMusicModuleCache(cache);
+    }
+
+    return music;
+}
+
+// Unload music stream
+void UnloadMusicStream(Music music)
+{
+    // Music stream is unregistered before its decoder is released
+    if (musicStreamLocksReady) ma_mutex_lock(&musicStreamsLock);
+
+    Music *stream = GetMusicStream(music.stream.buffer);
+    if (stream != NULL) memset(stream, 0, sizeof(Music));
+
+    MusicModuleCache *cache = NULL;
+    for (int i = 0; i < MAX_MUSIC_STREAMS; i++)
+    {
+        if ((musicModuleCaches[i] != NULL) && (musicModuleCaches[i]->module == music.ctxData))
+        {
+            cache = musicModuleCaches[i];
+            musicModuleCaches[i] = NULL;
+        }
+    }
+
+    if (musicStreamLocksReady) ma_mutex_unlock(&musicStreamsLock);
+
+    // NOTE: Pre-rendering thread is stopped before its module context is released
+    if (cache != NULL) UnloadMusicModuleCache(cache);
+
+    CloseAudioStream(music.stream);
+
+    if (false) { }
+#if defined(SUPPORT_FILEFORMAT_OGG)
+    else if (music.ctxType == MUSIC_AUDIO_OGG) stb_vorbis_close((stb_vorbis *)music.ctxData);
+#endif
+#if defined(SUPPORT_FILEFORMAT_FLAC)
+    else if (music.ctxType == MUSIC_AUDIO_FLAC) drflac_free((drflac *)music.ctxData);
+#endif
+#if defined(SUPPORT_FILEFORMAT_MP3)
+    else if (music.ctxType == MUSIC_AUDIO_MP3) { drmp3_uninit((drmp3 *)music.ctxData); RL_FREE(music.ctxData); }
+#endif
+#if defined(SUPPORT_FILEFORMAT_XM)
+    else if (music.ctxType == MUSIC_MODULE_XM) jar_xm_free_context((jar_xm_context_t *)music.ctxData);
+#endif
+#if defined(SUPPORT_FILEFORMAT_MOD)
+    else if (music.ctxType == MUSIC_MODULE_MOD) { jar_mod_unload((jar_mod_context_t *)music.ctxData); RL_FREE(music.ctxData); }
+#endif
+}
+
+// Start music playing (open stream)
+void PlayMusicStream(Music music)
+{
+    AudioBuffer *audioBuffer = music.stream.buffer;
+
+    if (audioBuffer != NULL)
+    {
+        // For music streams, we need to make sure we maintain the frame cursor position
+        // This is a hack for this section of code in UpdateMusicStream()
+        // NOTE: In case window is minimized, music stream is stopped, just make sure to
+        // play again on window restore: if (IsMusicPlaying(music)) PlayMusicStream(music);
+        audioBuffer->playing = true;
+        audioBuffer->paused = false;
+
+        PushAudioCommand(AUDIO_COMMAND_CONTINUE, audioBuffer, NULL, 0.0f, 0);
+    }
+    else TraceLog(LOG_ERROR, "PlayMusicStream() : No audio buffer");
+
+}
+
+// Pause music playing
+void PauseMusicStream(Music music)
+{
+    PauseAudioStream(music.stream);
+}
+
+// Resume music playing
+void ResumeMusicStream(Music music)
+{
+    ResumeAudioStream(music.stream);
+}
+
+// Stop music playing (close stream)
+void StopMusicStream(Music music)
+{
+    StopAudioStream(music.stream);
+
+    if (musicStreamLocksReady) ma_mutex_lock(&musicStreamsLock);
+    ResetMusicStream(music);
+    if (musicStreamLocksReady) ma_mutex_unlock(&musicStreamsLock);
+}
+
+// Update (re-fill) music buffers if data already processed
+// NOTE: Not required if music streaming thread is enabled (SetMusicStreamThread())
+void UpdateMusicStream(Music music)
+{
+    if (musicStreamThreadRunning) return;
+
+#if defined(SUPPORT_PROFILER) && !defined(RAUDIO_STANDALONE)
+    BeginProfileZone("UpdateMusicStream");
+#endif
+
+    // Registered state is used if available (keeps loops count)
+    Music *stream = GetMusicStream(music.stream.buffer);
+
+    if (stream != NULL) UpdateMusicStreamBuffers(stream);
+    else UpdateMusicStreamBuffers(&music);
+
+#if defined(SUPPORT_PROFILER) && !defined(RAUDIO_STANDALONE)
+    EndProfileZone();
+#endif
+}
+
+// Check if any music is playing
+bool IsMusicPlaying(Music music)
+{
+    return IsAudioStreamPlaying(music.stream);
+}
+
+// Set volume for music
+void SetMusicVolume(Music music, float volume)
+{
+    SetAudioStreamVolume(music.stream, volume);
+}
+
+// Set pitch for music
+void SetMusicPitch(Music music, float pitch)
+{
+    SetAudioStreamPitch(music.stream, pitch);
+}
+
+// Set mixing bus for music (0 is master bus)
+void SetMusicBus(Music music, int bus)
+{
+    SetAudioStreamBus(music.stream, bus);
+}
+
+// Set music emitter position and velocity, music is spatial (panned and attenuated by mixer)
+void SetMusicPosition(Music music, Vector3 position, Vector3 velocity)
+{
+    SetAudioStreamPosition(music.stream, position, velocity);
+}
+
+// Set music loop count (loop repeats)
+// NOTE: If set to 0, means infinite loop
+void SetMusicLoopCount(Music music, int count)
+{
+    if (musicStreamLocksReady) ma_mutex_lock(&musicStreamsLock);
+
+    Music *stream = GetMusicStream(music.stream.buffer);
+    if (stream != NULL) stream->loopCount = count;
+
+    if (musicStreamLocksReady) ma_mutex_unlock(&musicStreamsLock);
+}
+
+// Set tracker modules (XM, MOD) pre-rendered on loading by a background thread, played from pre-rendered data
+// NOTE: Applies to modules loaded after this call, pre-rendered data takes 16 bit stereo PCM size (~11 MB by minute)
+void SetMusicModuleCache(bool enabled)
+{
+    musicModuleCacheEnabled = enabled;
+}
+
+// Set music streams buffers refilled by a background thread (UpdateMusicStream() is not required)
+// NOTE: bufferTime defines audio streams buffer length (seconds) for streams loaded after this call, 0.0f for default
+void SetMusicStreamThread(bool enabled, float bufferTime)
+{
+    musicStreamBufferTime = (bufferTime > 0.0f)? bufferTime : 0.0f;
+
+    if (enabled && !musicStreamThreadRunning)
+    {
+        if (!isAudioInitialized)
+        {
+            TraceLog(LOG_WARNING, "SetMusicStreamThread() : Audio device must be initialized");
+            return;
+        }
+
+        if (!musicStreamLocksReady)
+        {
+            if ((ma_mutex_init(&context, &audioCommandsLock) != MA_SUCCESS) || (ma_mutex_init(&context, &musicStreamsLock) != MA_SUCCESS))
+            {
+                TraceLog(LOG_WARNING, "SetMusicStreamThread() : Failed to create music streaming locks");
+                return;
+            }
+
+            musicStreamLocksReady = true;
+        }
+
+        musicStreamThreadRunning = true;
+
+        if (ma_thread_create(&context, &musicStreamThread, MusicStreamThread, NULL) != MA_SUCCESS)
+        {
+            musicStreamThreadRunning = false;
+            TraceLog(LOG_WARNING, "SetMusicStreamThread() : Failed to create music streaming thread");
+        }
+        else TraceLog(LOG_INFO, "Music streaming thread started");
+    }
+    else if (!enabled && musicStreamThreadRunning)
+    {
+        musicStreamThreadRunning = false;
+        ma_thread_wait(&musicStreamThread);
+
+        TraceLog(LOG_INFO, "Music streaming thread stopped");
+    }
+}
+
+// Get music time length (in seconds)
+float GetMusicTimeLength(Music music)
+{
+    float totalSeconds = 0.0f;
+
+    totalSeconds = (float)music.sampleCount/(music.stream.sampleRate*music.stream.channels);
+
+    return totalSeconds;
+}
+
+// Get music stream underruns count (music played with no data ready)
+unsigned int GetMusicUnderruns(Music music)
+{
+    return GetAudioStreamUnderruns(music.stream);
+}
+
+// Get current music time played (in seconds)
+float GetMusicTimePlayed(Music music)
+{
+    float secondsPlayed = 0.0f;
+
+    //ma_uint32 frameSizeInBytes = ma_get_bytes_per_sample(music.stream.buffer->dsp.formatConverterIn.config.formatIn)*music.stream.buffer->dsp.formatConverterIn.config.channels;
+    unsigned int samplesPlayed = music.stream.buffer->totalFramesProcessed*music.stream.channels;
+    secondsPlayed = (float)samplesPlayed/(music.stream.sampleRate*music.stream.channels);
+
+    return secondsPlayed;
+}
+
+// Init audio stream (to stream audio pcm data)
+AudioStream InitAudioStream(unsigned int sampleRate, unsigned int sampleSize, unsigned int channels)
+{
+    unsigned int subBufferSize = AUDIO_BUFFER_SIZE;
+
+    // Buffer length can be defined (music streaming thread), stream is double-buffered
+    if (musicStreamBufferTime > 0.0f) subBufferSize = (unsigned int)(musicStreamBufferTime*sampleRate/AUDIO_SUBBUFFERS_COUNT);
+
+    return InitAudioStreamEx(sampleRate, sampleSize, channels, subBufferSize, AUDIO_SUBBUFFERS_COUNT);
+}
+
+// Init audio stream with custom buffering (to stream audio pcm data)
+// NOTE: Latency is about subBufferSize*subBufferCount frames, more sub-buffers are more robust to slow frames
+AudioStream InitAudioStreamEx(unsigned int sampleRate, unsigned int sampleSize, unsigned int channels, unsigned int subBufferSize, unsigned int subBufferCount)
+{
+    AudioStream stream = { 0 };
+
+    stream.sampleRate = sampleRate;
+    stream.sampleSize = sampleSize;
+    stream.channels = channels;
+
+    ma_format formatIn = ((stream.sampleSize == 8)? ma_format_u8 : ((stream.sampleSize == 16)? ma_format_s16 : ma_format_f32));
+
+    if (subBufferCount < 2) subBufferCount = 2;
+    else if (subBufferCount > MAX_AUDIO_SUBBUFFERS)
+    {
+        TraceLog(LOG_WARNING, "InitAudioStreamEx() : Sub-buffers count limited to %i", MAX_AUDIO_SUBBUFFERS);
+        subBufferCount = MAX_AUDIO_SUBBUFFERS;
+    }
+
+    // The size of a streaming buffer must be at least double the size of a period
+    unsigned int periodSize = device.playback.internalBufferSizeInFrames/device.playback.internalPeriods;
+
+    if (subBufferSize == 0) subBufferSize = AUDIO_BUFFER_SIZE;
+    if (subBufferSize < periodSize) subBufferSize = periodSize;
+
+    stream.buffer = InitAudioBuffer(formatIn, stream.channels, stream.sampleRate, subBufferSize*subBufferCount, AUDIO_BUFFER_USAGE_STREAM);
+
+    if (stream.buffer != NULL)
+    {
+        stream.buffer->subBufferCount = subBufferCount;
+        stream.buffer->looping = true;    // Always loop for streaming buffers
+        TraceLog(LOG_INFO, "Audio stream loaded successfully (%i Hz, %i bit, %s, %i x %i frames)", stream.sampleRate, stream.sampleSize, (stream.channels == 1)? "Mono" : "Stereo", subBufferCount, subBufferSize);
+    }
+    else TraceLog(LOG_ERROR, "InitAudioStreamEx() : Failed to create audio buffer");
+
+    return stream;
+}
+
+// Close audio stream and free memory
+void CloseAudioStream(AudioStream stream)
+{
+    CloseAudioBuffer(stream.buffer);
+
+    TraceLog(LOG_INFO, "Unloaded audio stream data");
+}
+
+// Update audio stream buffers with data
+// NOTE 1: Only updates one buffer of the stream source: unqueue -> update -> queue
+// NOTE 2: To unqueue a buffer it needs to be processed: IsAudioStreamProcessed()
+void UpdateAudioStream(AudioStream stream, const void *data, int samplesCount)
+{
+    AudioBuffer *audioBuffer = stream.buffer;
+
+    if (audioBuffer != NULL)
+    {
+        if (IsAudioStreamProcessed(stream))
+        {
+            ma_uint32 subBufferToUpdate = 0;
+            ma_uint32 subBufferCount = audioBuffer->subBufferCount;
+            ma_uint32 subBufferSizeInFrames = audioBuffer->bufferSizeInFrames/subBufferCount;
+            ma_uint32 currentSubBufferIndex = audioBuffer->frameCursorPos/subBufferSizeInFrames;
+
+            if (audioBuffer->isSubBufferProcessed[currentSubBufferIndex])
+            {
+                // All buffers are available for updating (queued ones are always played from cursor).
+                // Update the first one and make sure the cursor is moved back to the front.
+                subBufferToUpdate = 0;
+                audioBuffer->frameCursorPos = 0;
+            }
+            else
+            {
+                // Update the first processed sub-buffer after the queued ones, keeping playing order
+                for (ma_uint32 i = 1; i < subBufferCount; i++)
+                {
+                    subBufferToUpdate = (currentSubBufferIndex + i)%subBufferCount;
+                    if (audioBuffer->isSubBufferProcessed[subBufferToUpdate]) break;
+                }
+            }
+
+            unsigned char *subBuffer = audioBuffer->buffer + ((subBufferSizeInFrames*stream.channels*(stream.sampleSize/8))*subBufferToUpdate);
+
+            // TODO: Get total frames processed on this buffer... DOES NOT WORK.
+            audioBuffer->totalFramesProcessed += subBufferSizeInFrames;
+
+            // Does this API expect a whole buffer to be updated in one go?
+            // Assuming so, but if not will need to change this logic.
+            if (subBufferSizeInFrames >= (ma_uint32)samplesCount/stream.channels)
+            {
+                ma_uint32 framesToWrite = subBufferSizeInFrames;
+
+                if (framesToWrite > ((ma_uint32)samplesCount/stream.channels)) framesToWrite = (ma_uint32)samplesCount/stream.channels;
+
+                ma_uint32 bytesToWrite = framesToWrite*stream.channels*(stream.sampleSize/8);
+                memcpy(subBuffer, data, bytesToWrite);
+
+                // Any leftover frames should be filled with zeros.
+                ma_uint32 leftoverFrameCount = subBufferSizeInFrames - framesToWrite;
+
+                if (leftoverFrameCount > 0) memset(subBuffer + bytesToWrite, 0, leftoverFrameCount*stream.channels*(stream.sampleSize/8));
+
+                audioBuffer->isSubBufferProcessed[subBufferToUpdate] = false;
+            }
+            else TraceLog(LOG_ERROR, "UpdateAudioStream() : Attempting to write too many frames to buffer");
+        }
+        else TraceLog(LOG_ERROR, "UpdateAudioStream() : Audio buffer not available for updating");
+    }
+    else TraceLog(LOG_ERROR, "UpdateAudioStream() : No audio buffer");
+}
+
+// Check if any audio stream buffers requires refill
+bool IsAudioStreamProcessed(AudioStream stream)
+{
+    if (stream.buffer == NULL)
+    {
+        TraceLog(LOG_ERROR, "IsAudioStreamProcessed() : No audio buffer");
+        return false;
+    }
+
+    for (unsigned int i = 0; i < stream.buffer->subBufferCount; i++) if (stream.buffer->isSubBufferProcessed[i]) return true;
+
+    return false;
+}
+
+// Get audio stream underruns count (stream played with no data ready)
+unsigned int GetAudioStreamUnderruns(AudioStream stream)
+{
+    if (stream.buffer == NULL)
+    {
+        TraceLog(LOG_ERROR, "GetAudioStreamUnderruns() : No audio buffer");
+        return 0;
+    }
+
+    return stream.buffer->underrunCount;
+}
+
+// Set audio stream callback, called from audio thread to fill stream data when it is mixed (pull model)
+// NOTE: Callback gets frames in stream format, in device format (32 bit, stereo, 44100 Hz) it writes straight into mixing block.
+// Stream queued data (UpdateAudioStream()) is not played while a callback is set, use NULL callback to restore it
+void SetAudioStreamCallback(AudioStream stream, AudioStreamCallback callback, void *userData)
+{
+    if (stream.buffer == NULL)
+    {
+        TraceLog(LOG_WARNING, "SetAudioStreamCallback() : No audio buffer");
+        return;
+    }
+
+    AudioCommand command = { AUDIO_COMMAND_CALLBACK, stream.buffer, NULL, 0.0f, 0 };
+    command.callback = callback;
+    command.userData = userData;
+
+    QueueAudioCommand(command);
+}
+
+// Play audio stream
+void PlayAudioStream(AudioStream stream)
+{
+    PlayAudioBuffer(stream.buffer);
+}
+
+// Play audio stream
+void PauseAudioStream(AudioStream stream)
+{
+    PauseAudioBuffer(stream.buffer);
+}
 
-    return newWave;
+// Resume audio stream playing
+void ResumeAudioStream(AudioStream stream)
+{
+    ResumeAudioBuffer(stream.buffer);
 }
 
-// Crop a wave to defined samples range
-// NOTE: Security check in case of out-of-range
-void WaveCrop(Wave *wave, int initSample, int finalSample)
+// Check if audio stream is playing.
+bool IsAudioStreamPlaying(AudioStream stream)
 {
-    if ((initSample >= 0) && (initSample < finalSample) &&
-        (finalSample > 0) && ((unsigned int)finalSample < wave->sampleCount))
-    {
-        int sampleCount = finalSample - initSample;
+    return IsAudioBufferPlaying(stream.buffer);
+}
 
-        void *data = RL_MALLOC(sampleCount*wave->sampleSize/8*wave->channels);
+// Stop audio stream
+void StopAudioStream(AudioStream stream)
+{
+    StopAudioBuffer(stream.buffer);
+}
 
-        memcpy(data, (unsigned char *)wave->data + (initSample*wave->channels*wave->sampleSize/8), sampleCount*wave->channels*wave->sampleSize/8);
+void SetAudioStreamVolume(AudioStream stream, float volume)
+{
+    SetAudioBufferVolume(stream.buffer, volume);
+}
 
-        RL_FREE(wave->data);
-        wave->data = data;
-    }
-    else TraceLog(LOG_WARNING, "Wave crop range out of bounds");
+void SetAudioStreamPitch(AudioStream stream, float pitch)
+{
+    SetAudioBufferPitch(stream.buffer, pitch);
 }
 
-// Get samples data from wave as a floats array
-// NOTE: Returned sample values are normalized to range [-1..1]
-float *GetWaveData(Wave wave)
+// Set mixing bus for audio stream (0 is master bus)
+void SetAudioStreamBus(AudioStream stream, int bus)
 {
-    float *samples = (float *)RL_MALLOC(wave.sampleCount*wave.channels*sizeof(float));
+    if ((bus < 0) || (bus >= MAX_AUDIO_BUSES)) TraceLog(LOG_WARNING, "SetAudioStreamBus() : Invalid bus index (%i)", bus);
+    else if (stream.buffer != NULL) PushAudioCommand(AUDIO_COMMAND_BUS, stream.buffer, NULL, 0.0f, (unsigned int)bus);
+}
 
-    for (unsigned int i = 0; i < wave.sampleCount; i++)
+// Set audio stream emitter position and velocity, stream is spatial (panned and attenuated by mixer)
+// NOTE: First position is applied directly, next ones on UpdateAudioSpatial()
+void SetAudioStreamPosition(AudioStream stream, Vector3 position, Vector3 velocity)
+{
+    if (stream.buffer != NULL)
     {
-        for (unsigned int j = 0; j < wave.channels; j++)
-        {
-            if (wave.sampleSize == 8) samples[wave.channels*i + j] = (float)(((unsigned char *)wave.data)[wave.channels*i + j] - 127)/256.0f;
-            else if (wave.sampleSize == 16) samples[wave.channels*i + j] = (float)((short *)wave.data)[wave.channels*i + j]/32767.0f;
-            else if (wave.sampleSize == 32) samples[wave.channels*i + j] = ((float *)wave.data)[wave.channels*i + j];
-        }
-    }
+        float emitterPosition[3] = { position.x, position.y, position.z };
+        float emitterVelocity[3] = { velocity.x, velocity.y, velocity.z };
 
-    return samples;
+        AttachAudioEmitter(stream.buffer, emitterPosition, emitterVelocity);
+    }
+    else TraceLog(LOG_WARNING, "SetAudioStreamPosition() : No audio buffer");
 }
 
 //----------------------------------------------------------------------------------
-// Module Functions Definition - Music loading and stream playing (.OGG)
+// Module specific Functions Definition
 //----------------------------------------------------------------------------------
 
-// Load music stream from file
-Music LoadMusicStream(const char *fileName)
+// Load music module pre-rendered cache, a second module context is pre-rendered by a background thread
+// NOTE: Returns NULL if module can't be pre-rendered, module is rendered on playing
+static MusicModuleCache *LoadMusicModuleCache(Music music, const char *fileName)
 {
-    Music music = { 0 };
-    bool musicLoaded = false;
-
-    if (false) { }
-#if defined(SUPPORT_FILEFORMAT_OGG)
-    else if (IsFileExtension(fileName, ".ogg"))
-    {
-        // Open ogg audio stream
-        music.ctxData = stb_vorbis_open_filename(fileName, NULL, NULL);
-
-        if (music.ctxData != NULL)
-        {
-            music.ctxType = MUSIC_AUDIO_OGG;
-            stb_vorbis_info info = stb_vorbis_get_info((stb_vorbis *)music.ctxData);  // Get Ogg file info
+    if (!isAudioInitialized) return NULL;
 
-            // OGG bit rate defaults to 16 bit, it's enough for compressed format
-            music.stream = InitAudioStream(info.sample_rate, 16, info.channels);
-            music.sampleCount = (unsigned int)stb_vorbis_stream_length_in_samples((stb_vorbis *)music.ctxData)*info.channels;
-            music.loopCount = 0;   // Infinite loop by default
-            musicLoaded = true;
-        }
-    }
-#endif
-#if defined(SUPPORT_FILEFORMAT_FLAC)
-    else if (IsFileExtension(fileName, ".flac"))
+    if ((unsigned long long)music.sampleCount*2*sizeof(short) > MAX_MUSIC_MODULE_CACHE_SIZE)
     {
-        music.ctxData = drflac_open_file(fileName);
-
-        if (music.ctxData != NULL)
-        {
-            music.ctxType = MUSIC_AUDIO_FLAC;
-            drflac *ctxFlac = (drflac *)music.ctxData;
-
-            music.stream = InitAudioStream(ctxFlac->sampleRate, ctxFlac->bitsPerSample, ctxFlac->channels);
-            music.sampleCount = (unsigned int)ctxFlac->totalSampleCount;
-            music.loopCount = 0;   // Infinite loop by default
-            musicLoaded = true;
-        }
+        TraceLog(LOG_WARNING, "[%s] Module too long to be pre-rendered, rendered on playing", fileName);
+        return NULL;
     }
-#endif
-#if defined(SUPPORT_FILEFORMAT_MP3)
-    else if (IsFileExtension(fileName, ".mp3"))
-    {
-        drmp3 *ctxMp3 = RL_MALLOC(sizeof(drmp3));
-        music.ctxData = ctxMp3;
 
-        int result = drmp3_init_file(ctxMp3, fileName, NULL);
-
-        if (result > 0)
-        {
-            music.ctxType = MUSIC_AUDIO_MP3;
+    void *renderer = NULL;
 
-            music.stream = InitAudioStream(ctxMp3->sampleRate, 32, ctxMp3->channels);
-            music.sampleCount = drmp3_get_pcm_frame_count(ctxMp3)*ctxMp3->channels;
-            music.loopCount = 0;   // Infinite loop by default
-            musicLoaded = true;
-        }
-    }
-#endif
 #if defined(SUPPORT_FILEFORMAT_XM)
-    else if (IsFileExtension(fileName, ".xm"))
+    if (music.ctxType == MUSIC_MODULE_XM)
     {
         jar_xm_context_t *ctxXm = NULL;
-
-        int result = jar_xm_create_context_from_file(&ctxXm, 48000, fileName);
-
-        if (result == 0)    // XM context created successfully
+        if (jar_xm_create_context_from_file(&ctxXm, 48000, fileName) == 0)
         {
-            music.ctxType = MUSIC_MODULE_XM;
-            jar_xm_set_max_loop_count(ctxXm, 0);    // Set infinite number of loops
-
-            // NOTE: Only stereo is supported for XM
-            music.stream = InitAudioStream(48000, 16, 2);
-            music.sampleCount = (unsigned int)jar_xm_get_remaining_samples(ctxXm);
-            music.loopCount = 0;   // Infinite loop by default
-            jar_xm_reset(ctxXm);   // make sure we start at the beginning of the song
-            musicLoaded = true;
-
-            music.ctxData = ctxXm;
+            jar_xm_set_max_loop_count(ctxXm, 0);
+            jar_xm_reset(ctxXm);
+            renderer = ctxXm;
         }
     }
 #endif
 #if defined(SUPPORT_FILEFORMAT_MOD)
-    else if (IsFileExtension(fileName, ".mod"))
+    if (music.ctxType == MUSIC_MODULE_MOD)
     {
         jar_mod_context_t *ctxMod = RL_MALLOC(sizeof(jar_mod_context_t));
-        music.ctxData = ctxMod;
-
         jar_mod_init(ctxMod);
-        int result = jar_mod_load_file(ctxMod, fileName);
-
-        if (result > 0)
-        {
-            music.ctxType = MUSIC_MODULE_MOD;
 
-            // NOTE: Only stereo is supported for MOD
-            music.stream = InitAudioStream(48000, 16, 2);
-            music.sampleCount = (unsigned int)jar_mod_max_samples(ctxMod);
-            music.loopCount = 0;   // Infinite loop by default
-            musicLoaded = true;
-        }
+        if (jar_mod_load_file(ctxMod, fileName) > 0) renderer = ctxMod;
+        else RL_FREE(ctxMod);
     }
 #endif
 
-    if (!musicLoaded)
+    MusicModuleCache *cache = (renderer != NULL)? (MusicModuleCache *)RL_CALLOC(1, sizeof(MusicModuleCache)) : NULL;
+    if (cache != NULL) cache->data = (short *)RL_MALLOC(music.sampleCount*2*sizeof(short));
+
+    if ((cache == NULL) || (cache->data == NULL))
     {
-        if (false) { }
-    #if defined(SUPPORT_FILEFORMAT_OGG)
-        else if (music.ctxType == MUSIC_AUDIO_OGG) stb_vorbis_close((stb_vorbis *)music.ctxData);
-    #endif
-    #if defined(SUPPORT_FILEFORMAT_FLAC)
-        else if (music.ctxType == MUSIC_AUDIO_FLAC) drflac_free((drflac *)music.ctxData);
-    #endif
-    #if defined(SUPPORT_FILEFORMAT_MP3)
-        else if (music.ctxType == MUSIC_AUDIO_MP3) { drmp3_uninit((drmp3 *)music.ctxData); RL_FREE(music.ctxData); }
-    #endif
+        TraceLog(LOG_WARNING, "[%s] Module could not be pre-rendered, rendered on playing", fileName);
+
     #if defined(SUPPORT_FILEFORMAT_XM)
-        else if (music.ctxType == MUSIC_MODULE_XM) jar_xm_free_context((jar_xm_context_t *)music.ctxData);
+        if ((renderer != NULL) && (music.ctxType == MUSIC_MODULE_XM)) jar_xm_free_context((jar_xm_context_t *)renderer);
     #endif
     #if defined(SUPPORT_FILEFORMAT_MOD)
-        else if (music.ctxType == MUSIC_MODULE_MOD) { jar_mod_unload((jar_mod_context_t *)music.ctxData); RL_FREE(music.ctxData); }
+        if ((renderer != NULL) && (music.ctxType == MUSIC_MODULE_MOD)) { jar_mod_unload((jar_mod_context_t *)renderer); RL_FREE(renderer); }
     #endif
+        if (cache != NULL) RL_FREE(cache);
 
-        TraceLog(LOG_WARNING, "[%s] Music file could not be opened", fileName);
+        return NULL;
     }
-    else
+
+    cache->module = music.ctxData;
+    cache->renderer = renderer;
+    cache->type = music.ctxType;
+    cache->frameCount = music.sampleCount;
+
+    if (ma_thread_create(&context, &cache->thread, MusicModuleCacheThread, cache) != MA_SUCCESS)
     {
-        // Show some music stream info
-        TraceLog(LOG_INFO, "[%s] Music file successfully loaded:", fileName);
-        TraceLog(LOG_INFO, "   Total samples: %i", music.sampleCount);
-        TraceLog(LOG_INFO, "   Sample rate: %i Hz", music.stream.sampleRate);
-        TraceLog(LOG_INFO, "   Sample size: %i bits", music.stream.sampleSize);
-        TraceLog(LOG_INFO, "   Channels: %i (%s)", music.stream.channels, (music.stream.channels == 1)? "Mono" : (music.stream.channels == 2)? "Stereo" : "Multi");
+        TraceLog(LOG_WARNING, "[%s] Module pre-rendering thread could not be created", fileName);
+
+        cache->framesRendered = cache->frameCount;  // Nothing to wait for on unloading
+        cache->cancel = true;
+        UnloadMusicModuleCache(cache);
+
+        return NULL;
     }
 
-    return music;
+    TraceLog(LOG_INFO, "[%s] Module pre-rendering started (%i KB)", fileName, (int)(music.sampleCount*2*sizeof(short)/1024));
+
+    return cache;
 }
 
-// Unload music stream
-void UnloadMusicStream(Music music)
+// Unload music module pre-rendered cache, pre-rendering thread is stopped and its module context released
+static void UnloadMusicModuleCache(MusicModuleCache *cache)
 {
-    CloseAudioStream(music.stream);
+    if (!cache->cancel)
+    {
+        cache->cancel = true;
+        ma_thread_wait(&cache->thread);
+    }
 
-    if (false) { }
-#if defined(SUPPORT_FILEFORMAT_OGG)
-    else if (music.ctxType == MUSIC_AUDIO_OGG) stb_vorbis_close((stb_vorbis *)music.ctxData);
-#endif
-#if defined(SUPPORT_FILEFORMAT_FLAC)
-    else if (music.ctxType == MUSIC_AUDIO_FLAC) drflac_free((drflac *)music.ctxData);
-#endif
-#if defined(SUPPORT_FILEFORMAT_MP3)
-    else if (music.ctxType == MUSIC_AUDIO_MP3) { drmp3_uninit((drmp3 *)music.ctxData); RL_FREE(music.ctxData); }
-#endif
 #if defined(SUPPORT_FILEFORMAT_XM)
-    else if (music.ctxType == MUSIC_MODULE_XM) jar_xm_free_context((jar_xm_context_t *)music.ctxData);
+    if (cache->type == MUSIC_MODULE_XM) jar_xm_free_context((jar_xm_context_t *)cache->renderer);
 #endif
 #if defined(SUPPORT_FILEFORMAT_MOD)
-    else if (music.ctxType == MUSIC_MODULE_MOD) { jar_mod_unload((jar_mod_context_t *)music.ctxData); RL_FREE(music.ctxData); }
+    if (cache->type == MUSIC_MODULE_MOD) { jar_mod_unload((jar_mod_context_t *)cache->renderer); RL_FREE(cache->renderer); }
 #endif
+
+    RL_FREE(cache->data);
+    RL_FREE(cache);
 }
 
-// Start music playing (open stream)
-void PlayMusicStream(Music music)
+// Get music module pre-rendered cache (NULL if module is not pre-rendered)
+static MusicModuleCache *GetMusicModuleCache(void *module)
 {
-    AudioBuffer *audioBuffer = music.stream.buffer;
+    for (int i = 0; i < MAX_MUSIC_STREAMS; i++)
+    {
+        if ((musicModuleCaches[i] != NULL) && (musicModuleCaches[i]->module == module)) return musicModuleCaches[i];
+    }
 
-    if (audioBuffer != NULL)
+    return NULL;
+}
+
+// Read music module frames from pre-rendered cache, returns false if frames must be rendered by module context
+// NOTE: Playback position is tracked in both cases, module context is not used anymore once cache is read
+static bool ReadMusicModuleCache(MusicModuleCache *cache, short *pcm, unsigned int frameCount)
+{
+    if (cache == NULL) return false;
+
+    unsigned int framesRendered = cache->framesRendered;
+    ma_memory_barrier();        // Pre-rendered data is read after the counter
+
+    // Pre-rendered data is played once it is far enough ahead (or complete), pre-rendering thread keeps it ahead
+    if (!cache->playing) cache->playing = ((framesRendered == cache->frameCount) || (framesRendered >= (cache->cursor + frameCount + MUSIC_MODULE_CACHE_MARGIN)));
+
+    if (cache->playing)
     {
-        // For music streams, we need to make sure we maintain the frame cursor position
-        // This is a hack for this section of code in UpdateMusicStream()
-        // NOTE: In case window is minimized, music stream is stopped, just make sure to
-        // play again on window restore: if (IsMusicPlaying(music)) PlayMusicStream(music);
-        ma_uint32 frameCursorPos = audioBuffer->frameCursorPos;
-        PlayAudioStream(music.stream);  // WARNING: This resets the cursor position.
-        audioBuffer->frameCursorPos = frameCursorPos;
+        // NOTE: Should never happen, pre-rendering is faster than playback
+        while ((cache->cursor + frameCount) > framesRendered)
+        {
+            ma_sleep(1);
+            framesRendered = cache->framesRendered;
+            ma_memory_barrier();
+        }
+
+        memcpy(pcm, cache->data + cache->cursor*2, frameCount*2*sizeof(short));
     }
-    else TraceLog(LOG_ERROR, "PlayMusicStream() : No audio buffer");
 
+    cache->cursor += frameCount;
+
+    return cache->playing;
 }
 
-// Pause music playing
-void PauseMusicStream(Music music)
+// Music module pre-rendering thread, whole module is rendered by blocks
+static ma_thread_result MA_THREADCALL MusicModuleCacheThread(void *data)
 {
-    PauseAudioStream(music.stream);
+    MusicModuleCache *cache = (MusicModuleCache *)data;
+
+    while (!cache->cancel && (cache->framesRendered < cache->frameCount))
+    {
+        unsigned int framesRendered = cache->framesRendered;
+        unsigned int frameCount = ((cache->frameCount - framesRendered) < MUSIC_MODULE_RENDER_BLOCK)? (cache->frameCount - framesRendered) : MUSIC_MODULE_RENDER_BLOCK;
+        short *pcm = cache->data + framesRendered*2;
+
+    #if defined(SUPPORT_FILEFORMAT_XM)
+        if (cache->type == MUSIC_MODULE_XM) jar_xm_generate_samples_16bit((jar_xm_context_t *)cache->renderer, pcm, frameCount);
+    #endif
+    #if defined(SUPPORT_FILEFORMAT_MOD)
+        if (cache->type == MUSIC_MODULE_MOD) jar_mod_fillbuffer((jar_mod_context_t *)cache->renderer, pcm, frameCount, 0);
+    #endif
+
+        ma_memory_barrier();    // Pre-rendered data must be visible before the counter
+        cache->framesRendered = framesRendered + frameCount;
+    }
+
+    return (ma_thread_result)0;
 }
 
-// Resume music playing
-void ResumeMusicStream(Music music)
+// Get loaded music stream state from its audio buffer (NULL if not found)
+// NOTE: Use NULL buffer to get a free music stream slot
+static Music *GetMusicStream(AudioBuffer *buffer)
 {
-    ResumeAudioStream(music.stream);
+    if (buffer == NULL)
+    {
+        for (int i = 0; i < MAX_MUSIC_STREAMS; i++) if (musicStreams[i].stream.buffer == NULL) return &musicStreams[i];
+    }
+    else
+    {
+        for (int i = 0; i < MAX_MUSIC_STREAMS; i++) if (musicStreams[i].stream.buffer == buffer) return &musicStreams[i];
+    }
+
+    return NULL;
 }
 
-// Stop music playing (close stream)
-void StopMusicStream(Music music)
+// Reset music decoder to music start
+static void ResetMusicStream(Music music)
 {
-    StopAudioStream(music.stream);
+    MusicModuleCache *cache = GetMusicModuleCache(music.ctxData);
+    if (cache != NULL) cache->cursor = 0;
 
-    // Restart music context
     switch (music.ctxType)
     {
 #if defined(SUPPORT_FILEFORMAT_OGG)
@@ -1396,34 +4109,38 @@ void StopMusicStream(Music music)
     }
 }
 
-// Update (re-fill) music buffers if data already processed
-void UpdateMusicStream(Music music)
+// Refill music stream processed buffers with decoded data
+// NOTE: Called by game thread (UpdateMusicStream()) or music streaming thread, decoder is not locked here
+static void UpdateMusicStreamBuffers(Music *music)
 {
     bool streamEnding = false;
 
-    unsigned int subBufferSizeInFrames = music.stream.buffer->bufferSizeInFrames/2;
+    unsigned int subBufferSizeInFrames = music->stream.buffer->bufferSizeInFrames/music->stream.buffer->subBufferCount;
 
     // NOTE: Using dynamic allocation because it could require more than 16KB
-    void *pcm = RL_CALLOC(subBufferSizeInFrames*music.stream.channels*music.stream.sampleSize/8, 1);
+    void *pcm = RL_CALLOC(subBufferSizeInFrames*music->stream.channels*music->stream.sampleSize/8, 1);
 
     int samplesCount = 0;    // Total size of data streamed in L+R samples for xm floats, individual L or R for ogg shorts
 
+    // Pre-rendered modules are read from cache once it is ahead of playback
+    MusicModuleCache *cache = GetMusicModuleCache(music->ctxData);
+
     // TODO: Get the sampleLeft using totalFramesProcessed... but first, get total frames processed correctly...
-    //ma_uint32 frameSizeInBytes = ma_get_bytes_per_sample(music.stream.buffer->dsp.formatConverterIn.config.formatIn)*music.stream.buffer->dsp.formatConverterIn.config.channels;
-    int sampleLeft = music.sampleCount - (music.stream.buffer->totalFramesProcessed*music.stream.channels);
+    //ma_uint32 frameSizeInBytes = ma_get_bytes_per_sample(music->stream.buffer->dsp.formatConverterIn.config.formatIn)*music->stream.buffer->dsp.formatConverterIn.config.channels;
+    int sampleLeft = music->sampleCount - (music->stream.buffer->totalFramesProcessed*music->stream.channels);
 
-    while (IsAudioStreamProcessed(music.stream))
+    while (IsAudioStreamProcessed(music->stream))
     {
-        if ((sampleLeft/music.stream.channels) >= subBufferSizeInFrames) samplesCount = subBufferSizeInFrames*music.stream.channels;
+        if ((sampleLeft/music->stream.channels) >= subBufferSizeInFrames) samplesCount = subBufferSizeInFrames*music->stream.channels;
         else samplesCount = sampleLeft;
 
-        switch (music.ctxType)
+        switch (music->ctxType)
         {
         #if defined(SUPPORT_FILEFORMAT_OGG)
             case MUSIC_AUDIO_OGG:
             {
                 // NOTE: Returns the number of samples to process (be careful! we ask for number of shorts!)
-                stb_vorbis_get_samples_short_interleaved((stb_vorbis *)music.ctxData, music.stream.channels, (short *)pcm, samplesCount);
+                stb_vorbis_get_samples_short_interleaved((stb_vorbis *)music->ctxData, music->stream.channels, (short *)pcm, samplesCount);
 
             } break;
         #endif
@@ -1431,7 +4148,7 @@ void UpdateMusicStream(Music music)
             case MUSIC_AUDIO_FLAC:
             {
                 // NOTE: Returns the number of samples to process (not required)
-                drflac_read_pcm_frames_s16((drflac *)music.ctxData, samplesCount, (short *)pcm);
+                drflac_read_pcm_frames_s16((drflac *)music->ctxData, samplesCount, (short *)pcm);
 
             } break;
         #endif
@@ -1439,7 +4156,7 @@ void UpdateMusicStream(Music music)
             case MUSIC_AUDIO_MP3:
             {
                 // NOTE: samplesCount, actually refers to framesCount and returns the number of frames processed
-                drmp3_read_pcm_frames_f32((drmp3 *)music.ctxData, samplesCount/music.stream.channels, (float *)pcm);
+                drmp3_read_pcm_frames_f32((drmp3 *)music->ctxData, samplesCount/music->stream.channels, (float *)pcm);
 
             } break;
         #endif
@@ -1447,22 +4164,22 @@ void UpdateMusicStream(Music music)
             case MUSIC_MODULE_XM:
             {
                 // NOTE: Internally this function considers 2 channels generation, so samplesCount/2
-                jar_xm_generate_samples_16bit((jar_xm_context_t *)music.ctxData, (short *)pcm, samplesCount/2);
+                if (!ReadMusicModuleCache(cache, (short *)pcm, samplesCount/2)) jar_xm_generate_samples_16bit((jar_xm_context_t *)music->ctxData, (short *)pcm, samplesCount/2);
             } break;
         #endif
         #if defined(SUPPORT_FILEFORMAT_MOD)
             case MUSIC_MODULE_MOD:
             {
                 // NOTE: 3rd parameter (nbsample) specify the number of stereo 16bits samples you want, so sampleCount/2
-                jar_mod_fillbuffer((jar_mod_context_t *)music.ctxData, (short *)pcm, samplesCount/2, 0);
+                if (!ReadMusicModuleCache(cache, (short *)pcm, samplesCount/2)) jar_mod_fillbuffer((jar_mod_context_t *)music->ctxData, (short *)pcm, samplesCount/2, 0);
             } break;
         #endif
             default: break;
         }
 
-        UpdateAudioStream(music.stream, pcm, samplesCount);
+        UpdateAudioStream(music->stream, pcm, samplesCount);
 
-        if ((music.ctxType == MUSIC_MODULE_XM) || (music.ctxType == MUSIC_MODULE_MOD))
+        if ((music->ctxType == MUSIC_MODULE_XM) || (music->ctxType == MUSIC_MODULE_MOD))
         {
             if (samplesCount > 1) sampleLeft -= samplesCount/2;
             else sampleLeft -= samplesCount;
@@ -1482,220 +4199,273 @@ void UpdateMusicStream(Music music)
     // Reset audio stream for looping
     if (streamEnding)
     {
-        StopMusicStream(music);        // Stop music (and reset)
+        StopAudioStream(music->stream);
+        ResetMusicStream(*music);      // Stop music (and reset)
 
         // Decrease loopCount to stop when required
-        if (music.loopCount > 1)
+        if (music->loopCount > 1)
         {
-            music.loopCount--;         // Decrease loop count
-            PlayMusicStream(music);    // Play again
+            music->loopCount--;         // Decrease loop count
+            PlayMusicStream(*music);    // Play again
         }
-        else if (music.loopCount == 0) PlayMusicStream(music);
+        else if (music->loopCount == 0) PlayMusicStream(*music);
     }
-    else
+    else if (!musicStreamThreadRunning)
     {
         // NOTE: In case window is minimized, music stream is stopped,
         // just make sure to play again on window restore
-        if (IsMusicPlaying(music)) PlayMusicStream(music);
+        if (IsMusicPlaying(*music)) PlayMusicStream(*music);
     }
 }
 
-// Check if any music is playing
-bool IsMusicPlaying(Music music)
-{
-    return IsAudioStreamPlaying(music.stream);
-}
-
-// Set volume for music
-void SetMusicVolume(Music music, float volume)
+// Music streaming thread, refills playing music streams buffers
+static ma_thread_result MA_THREADCALL MusicStreamThread(void *data)
 {
-    SetAudioStreamVolume(music.stream, volume);
-}
+    (void)data;
 
-// Set pitch for music
-void SetMusicPitch(Music music, float pitch)
-{
-    SetAudioStreamPitch(music.stream, pitch);
-}
+    while (musicStreamThreadRunning)
+    {
+        ma_mutex_lock(&musicStreamsLock);
 
-// Set music loop count (loop repeats)
-// NOTE: If set to 0, means infinite loop
-void SetMusicLoopCount(Music music, int count)
-{
-    music.loopCount = count;
-}
+        for (int i = 0; i < MAX_MUSIC_STREAMS; i++)
+        {
+            if ((musicStreams[i].stream.buffer != NULL) && IsMusicPlaying(musicStreams[i])) UpdateMusicStreamBuffers(&musicStreams[i]);
+        }
 
-// Get music time length (in seconds)
-float GetMusicTimeLength(Music music)
-{
-    float totalSeconds = 0.0f;
+        ma_mutex_unlock(&musicStreamsLock);
 
-    totalSeconds = (float)music.sampleCount/(music.stream.sampleRate*music.stream.channels);
+        ma_sleep(MUSIC_STREAM_THREAD_SLEEP);
+    }
 
-    return totalSeconds;
+    return (ma_thread_result)0;
 }
 
-// Get current music time played (in seconds)
-float GetMusicTimePlayed(Music music)
+// Conversion source read callback, zeros are fed past source end (resampler last frames)
+static ma_uint32 OnAudioConversionRead(ma_pcm_converter *pDSP, void *pFramesOut, ma_uint32 frameCount, void *pUserData)
 {
-    float secondsPlayed = 0.0f;
+    (void)pDSP;
 
-    //ma_uint32 frameSizeInBytes = ma_get_bytes_per_sample(music.stream.buffer->dsp.formatConverterIn.config.formatIn)*music.stream.buffer->dsp.formatConverterIn.config.channels;
-    unsigned int samplesPlayed = music.stream.buffer->totalFramesProcessed*music.stream.channels;
-    secondsPlayed = (float)samplesPlayed/(music.stream.sampleRate*music.stream.channels);
+    AudioConversionData *conversion = (AudioConversionData *)pUserData;
 
-    return secondsPlayed;
-}
+    ma_uint32 framesLeft = conversion->frameCount - conversion->frameCursor;
+    ma_uint32 framesToRead = (frameCount < framesLeft)? frameCount : framesLeft;
 
-// Init audio stream (to stream audio pcm data)
-AudioStream InitAudioStream(unsigned int sampleRate, unsigned int sampleSize, unsigned int channels)
-{
-    AudioStream stream = { 0 };
+    memcpy(pFramesOut, conversion->data + conversion->frameCursor*conversion->frameSize, framesToRead*conversion->frameSize);
+    memset((unsigned char *)pFramesOut + framesToRead*conversion->frameSize, 0, (frameCount - framesToRead)*conversion->frameSize);
 
-    stream.sampleRate = sampleRate;
-    stream.sampleSize = sampleSize;
-    stream.channels = channels;
+    conversion->frameCursor += framesToRead;
 
-    ma_format formatIn = ((stream.sampleSize == 8)? ma_format_u8 : ((stream.sampleSize == 16)? ma_format_s16 : ma_format_f32));
+    return frameCount;
+}
 
-    // The size of a streaming buffer must be at least double the size of a period
-    unsigned int periodSize = device.playback.internalBufferSizeInFrames/device.playback.internalPeriods;
-    unsigned int subBufferSize = AUDIO_BUFFER_SIZE;
+// Convert frames (NULL output to get frames count), returns frames converted
+// NOTE: Sample rate conversion quality is defined by SetAudioConversionQuality(), converted data is cached if enabled
+static ma_uint32 ConvertAudioFrames(void *framesOut, ma_format formatOut, ma_uint32 channelsOut, ma_uint32 sampleRateOut,
+                                    const void *framesIn, ma_format formatIn, ma_uint32 channelsIn, ma_uint32 sampleRateIn, ma_uint32 frameCountIn)
+{
+    if (frameCountIn == 0) return 0;
 
-    if (subBufferSize < periodSize) subBufferSize = periodSize;
+    ma_uint32 frameCountOut = (ma_uint32)ma_calculate_frame_count_after_src(sampleRateOut, sampleRateIn, frameCountIn);
+    if (framesOut == NULL) return frameCountOut;
 
-    stream.buffer = InitAudioBuffer(formatIn, stream.channels, stream.sampleRate, subBufferSize*2, AUDIO_BUFFER_USAGE_STREAM);
+    ma_uint32 frameSizeIn = ma_get_bytes_per_frame(formatIn, channelsIn);
+    ma_uint32 frameSizeOut = ma_get_bytes_per_frame(formatOut, channelsOut);
 
-    if (stream.buffer != NULL)
+    // Data already in desired format is just copied
+    if ((formatIn == formatOut) && (channelsIn == channelsOut) && (sampleRateIn == sampleRateOut))
     {
-        stream.buffer->looping = true;    // Always loop for streaming buffers
-        TraceLog(LOG_INFO, "Audio stream loaded successfully (%i Hz, %i bit, %s)", stream.sampleRate, stream.sampleSize, (stream.channels == 1)? "Mono" : "Stereo");
+        memcpy(framesOut, framesIn, frameCountIn*frameSizeIn);
+        return frameCountIn;
     }
-    else TraceLog(LOG_ERROR, "InitAudioStream() : Failed to create audio buffer");
 
-    return stream;
-}
+    // Look for same data already converted to same format
+    unsigned int hash = 2166136261u;
+    AudioConversionCache key = { 0 };
 
-// Close audio stream and free memory
-void CloseAudioStream(AudioStream stream)
-{
-    CloseAudioBuffer(stream.buffer);
+    if (audioConversionCache != NULL)
+    {
+        const unsigned char *bytes = (const unsigned char *)framesIn;
+        for (unsigned int i = 0; i < frameCountIn*frameSizeIn; i++) hash = (hash ^ bytes[i])*16777619u;
 
-    TraceLog(LOG_INFO, "Unloaded audio stream data");
-}
+        key = (AudioConversionCache){ hash, frameCountIn*frameSizeIn, formatIn, channelsIn, sampleRateIn, formatOut, channelsOut, sampleRateOut, audioConversionQuality, NULL, frameCountOut };
 
-// Update audio stream buffers with data
-// NOTE 1: Only updates one buffer of the stream source: unqueue -> update -> queue
-// NOTE 2: To unqueue a buffer it needs to be processed: IsAudioStreamProcessed()
-void UpdateAudioStream(AudioStream stream, const void *data, int samplesCount)
-{
-    AudioBuffer *audioBuffer = stream.buffer;
+        bool found = false;
 
-    if (audioBuffer != NULL)
-    {
-        if (audioBuffer->isSubBufferProcessed[0] || audioBuffer->isSubBufferProcessed[1])
+        if (audioConversionLockReady) ma_mutex_lock(&audioConversionLock);
+
+        for (int i = 0; (i < MAX_AUDIO_CONVERSION_CACHE) && !found; i++)
         {
-            ma_uint32 subBufferToUpdate = 0;
+            AudioConversionCache *entry = &audioConversionCache[i];
 
-            if (audioBuffer->isSubBufferProcessed[0] && audioBuffer->isSubBufferProcessed[1])
-            {
-                // Both buffers are available for updating.
-                // Update the first one and make sure the cursor is moved back to the front.
-                subBufferToUpdate = 0;
-                audioBuffer->frameCursorPos = 0;
-            }
-            else
+            if ((entry->data != NULL) && (entry->hash == key.hash) && (entry->dataSize == key.dataSize) && (entry->quality == key.quality) &&
+                (entry->formatIn == formatIn) && (entry->channelsIn == channelsIn) && (entry->sampleRateIn == sampleRateIn) &&
+                (entry->formatOut == formatOut) && (entry->channelsOut == channelsOut) && (entry->sampleRateOut == sampleRateOut))
             {
-                // Just update whichever sub-buffer is processed.
-                subBufferToUpdate = (audioBuffer->isSubBufferProcessed[0])? 0 : 1;
+                memcpy(framesOut, entry->data, entry->frameCount*frameSizeOut);
+                found = true;
             }
+        }
 
-            ma_uint32 subBufferSizeInFrames = audioBuffer->bufferSizeInFrames/2;
-            unsigned char *subBuffer = audioBuffer->buffer + ((subBufferSizeInFrames*stream.channels*(stream.sampleSize/8))*subBufferToUpdate);
+        if (audioConversionLockReady) ma_mutex_unlock(&audioConversionLock);
 
-            // TODO: Get total frames processed on this buffer... DOES NOT WORK.
-            audioBuffer->totalFramesProcessed += subBufferSizeInFrames;
+        if (found) return frameCountOut;
+    }
 
-            // Does this API expect a whole buffer to be updated in one go?
-            // Assuming so, but if not will need to change this logic.
-            if (subBufferSizeInFrames >= (ma_uint32)samplesCount/stream.channels)
-            {
-                ma_uint32 framesToWrite = subBufferSizeInFrames;
+    AudioConversionData conversion = { (const unsigned char *)framesIn, frameSizeIn, frameCountIn, 0 };
 
-                if (framesToWrite > ((ma_uint32)samplesCount/stream.channels)) framesToWrite = (ma_uint32)samplesCount/stream.channels;
+    ma_pcm_converter_config config = ma_pcm_converter_config_init(formatIn, channelsIn, sampleRateIn, formatOut, channelsOut, sampleRateOut, OnAudioConversionRead, &conversion);
+    config.srcAlgorithm = (audioConversionQuality == AUDIO_CONVERSION_SINC)? ma_src_algorithm_sinc : ma_src_algorithm_linear;
 
-                ma_uint32 bytesToWrite = framesToWrite*stream.channels*(stream.sampleSize/8);
-                memcpy(subBuffer, data, bytesToWrite);
+    ma_pcm_converter converter;
+    if (ma_pcm_converter_init(&config, &converter) != MA_SUCCESS) return 0;
 
-                // Any leftover frames should be filled with zeros.
-                ma_uint32 leftoverFrameCount = subBufferSizeInFrames - framesToWrite;
+    ma_uint32 framesRead = (ma_uint32)ma_pcm_converter_read(&converter, framesOut, frameCountOut);
+    if (framesRead < frameCountOut) memset((unsigned char *)framesOut + framesRead*frameSizeOut, 0, (frameCountOut - framesRead)*frameSizeOut);
 
-                if (leftoverFrameCount > 0) memset(subBuffer + bytesToWrite, 0, leftoverFrameCount*stream.channels*(stream.sampleSize/8));
+    // Store converted data, oldest entry is replaced when cache is full
+    if (audioConversionCache != NULL)
+    {
+        key.data = RL_MALLOC(frameCountOut*frameSizeOut);
+        memcpy(key.data, framesOut, frameCountOut*frameSizeOut);
 
-                audioBuffer->isSubBufferProcessed[subBufferToUpdate] = false;
-            }
-            else TraceLog(LOG_ERROR, "UpdateAudioStream() : Attempting to write too many frames to buffer");
-        }
-        else TraceLog(LOG_ERROR, "UpdateAudioStream() : Audio buffer not available for updating");
-    }
-    else TraceLog(LOG_ERROR, "UpdateAudioStream() : No audio buffer");
-}
+        if (audioConversionLockReady) ma_mutex_lock(&audioConversionLock);
 
-// Check if any audio stream buffers requires refill
-bool IsAudioStreamProcessed(AudioStream stream)
-{
-    if (stream.buffer == NULL)
-    {
-        TraceLog(LOG_ERROR, "IsAudioStreamProcessed() : No audio buffer");
-        return false;
+        AudioConversionCache *entry = &audioConversionCache[audioConversionCacheNext];
+        RL_FREE(entry->data);
+        *entry = key;
+        audioConversionCacheNext = (audioConversionCacheNext + 1)%MAX_AUDIO_CONVERSION_CACHE;
+
+        if (audioConversionLockReady) ma_mutex_unlock(&audioConversionLock);
     }
 
-    return (stream.buffer->isSubBufferProcessed[0] || stream.buffer->isSubBufferProcessed[1]);
+    return frameCountOut;
 }
 
-// Play audio stream
-void PlayAudioStream(AudioStream stream)
+// Waves conversion thread (WaveFormatBatch())
+static ma_thread_result MA_THREADCALL WaveFormatThread(void *data)
 {
-    PlayAudioBuffer(stream.buffer);
-}
+    AudioConversionJob *job = (AudioConversionJob *)data;
 
-// Play audio stream
-void PauseAudioStream(AudioStream stream)
-{
-    PauseAudioBuffer(stream.buffer);
-}
+    for (int i = job->first; i < job->count; i += job->step) WaveFormat(&job->waves[i], job->sampleRate, job->sampleSize, job->channels);
 
-// Resume audio stream playing
-void ResumeAudioStream(AudioStream stream)
-{
-    ResumeAudioBuffer(stream.buffer);
+    return (ma_thread_result)0;
 }
 
-// Check if audio stream is playing.
-bool IsAudioStreamPlaying(AudioStream stream)
+// Open decoder on encoded data (data must be kept while decoder is used)
+static void *OpenAudioDecoder(int type, const unsigned char *data, unsigned int dataSize, unsigned int *channels, unsigned int *sampleRate, unsigned int *frameCount)
 {
-    return IsAudioBufferPlaying(stream.buffer);
+    void *decoder = NULL;
+
+    switch (type)
+    {
+    #if defined(SUPPORT_FILEFORMAT_OGG)
+        case AUDIO_DECODER_OGG:
+        {
+            stb_vorbis *ctxOgg = stb_vorbis_open_memory(data, (int)dataSize, NULL, NULL);
+
+            if (ctxOgg != NULL)
+            {
+                stb_vorbis_info info = stb_vorbis_get_info(ctxOgg);
+
+                *channels = info.channels;
+                *sampleRate = info.sample_rate;
+                *frameCount = stb_vorbis_stream_length_in_samples(ctxOgg);
+                decoder = ctxOgg;
+            }
+        } break;
+    #endif
+    #if defined(SUPPORT_FILEFORMAT_FLAC)
+        case AUDIO_DECODER_FLAC:
+        {
+            drflac *ctxFlac = drflac_open_memory(data, dataSize);
+
+            if (ctxFlac != NULL)
+            {
+                *channels = ctxFlac->channels;
+                *sampleRate = ctxFlac->sampleRate;
+                *frameCount = (unsigned int)ctxFlac->totalPCMFrameCount;
+                decoder = ctxFlac;
+            }
+        } break;
+    #endif
+    #if defined(SUPPORT_FILEFORMAT_MP3)
+        case AUDIO_DECODER_MP3:
+        {
+            drmp3 *ctxMp3 = (drmp3 *)RL_MALLOC(sizeof(drmp3));
+
+            if (drmp3_init_memory(ctxMp3, data, dataSize, NULL))
+            {
+                *channels = ctxMp3->channels;
+                *sampleRate = ctxMp3->sampleRate;
+                *frameCount = (unsigned int)drmp3_get_pcm_frame_count(ctxMp3);
+                decoder = ctxMp3;
+            }
+            else RL_FREE(ctxMp3);
+        } break;
+    #endif
+        default: break;
+    }
+
+    return decoder;
 }
 
-// Stop audio stream
-void StopAudioStream(AudioStream stream)
+// Close decoder (encoded data is not released)
+static void CloseAudioDecoder(int type, void *decoder)
 {
-    StopAudioBuffer(stream.buffer);
+    switch (type)
+    {
+    #if defined(SUPPORT_FILEFORMAT_OGG)
+        case AUDIO_DECODER_OGG: stb_vorbis_close((stb_vorbis *)decoder); break;
+    #endif
+    #if defined(SUPPORT_FILEFORMAT_FLAC)
+        case AUDIO_DECODER_FLAC: drflac_close((drflac *)decoder); break;
+    #endif
+    #if defined(SUPPORT_FILEFORMAT_MP3)
+        case AUDIO_DECODER_MP3: drmp3_uninit((drmp3 *)decoder); RL_FREE(decoder); break;
+    #endif
+        default: break;
+    }
 }
 
-void SetAudioStreamVolume(AudioStream stream, float volume)
+// Seek decoder to data start
+static void SeekAudioDecoderStart(int type, void *decoder)
 {
-    SetAudioBufferVolume(stream.buffer, volume);
+    switch (type)
+    {
+    #if defined(SUPPORT_FILEFORMAT_OGG)
+        case AUDIO_DECODER_OGG: stb_vorbis_seek_start((stb_vorbis *)decoder); break;
+    #endif
+    #if defined(SUPPORT_FILEFORMAT_FLAC)
+        case AUDIO_DECODER_FLAC: drflac_seek_to_pcm_frame((drflac *)decoder, 0); break;
+    #endif
+    #if defined(SUPPORT_FILEFORMAT_MP3)
+        case AUDIO_DECODER_MP3: drmp3_seek_to_pcm_frame((drmp3 *)decoder, 0); break;
+    #endif
+        default: break;
+    }
 }
 
-void SetAudioStreamPitch(AudioStream stream, float pitch)
+// Decode frames (float), returns frames decoded (less than requested at data end)
+static ma_uint32 ReadAudioDecoderFrames(int type, void *decoder, ma_uint32 channels, float *framesOut, ma_uint32 frameCount)
 {
-    SetAudioBufferPitch(stream.buffer, pitch);
-}
+    ma_uint32 framesRead = 0;
 
-//----------------------------------------------------------------------------------
-// Module specific Functions Definition
-//----------------------------------------------------------------------------------
+    switch (type)
+    {
+    #if defined(SUPPORT_FILEFORMAT_OGG)
+        case AUDIO_DECODER_OGG: framesRead = (ma_uint32)stb_vorbis_get_samples_float_interleaved((stb_vorbis *)decoder, channels, framesOut, frameCount*channels); break;
+    #endif
+    #if defined(SUPPORT_FILEFORMAT_FLAC)
+        case AUDIO_DECODER_FLAC: framesRead = (ma_uint32)drflac_read_pcm_frames_f32((drflac *)decoder, frameCount, framesOut); break;
+    #endif
+    #if defined(SUPPORT_FILEFORMAT_MP3)
+        case AUDIO_DECODER_MP3: framesRead = (ma_uint32)drmp3_read_pcm_frames_f32((drmp3 *)decoder, frameCount, framesOut); break;
+    #endif
+        default: break;
+    }
+
+    return framesRead;
+}
 
 #if defined(SUPPORT_FILEFORMAT_WAV)
 // Load WAV file into Wave structure
@@ -1985,6 +4755,156 @@ static Wave LoadMP3(const char *fileName)
 }
 #endif
 
+#if defined(RAUDIO_MAPPED_FILES)
+// Map file into memory (read-only)
+static unsigned char *MapAudioFile(const char *fileName, unsigned int *size)
+{
+    unsigned char *data = NULL;
+    *size = 0;
+
+#if defined(_WIN32)
+    HANDLE file = CreateFileA(fileName, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+
+    if (file != INVALID_HANDLE_VALUE)
+    {
+        DWORD fileSize = GetFileSize(file, NULL);
+        HANDLE mapping = (fileSize > 0)? CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL) : NULL;
+
+        if (mapping != NULL)
+        {
+            // NOTE: Mapped view keeps file mapping alive, handles can be closed
+            data = (unsigned char *)MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+            if (data != NULL) *size = (unsigned int)fileSize;
+
+            CloseHandle(mapping);
+        }
+
+        CloseHandle(file);
+    }
+#else
+    int file = open(fileName, O_RDONLY);
+
+    if (file != -1)
+    {
+        struct stat fileInfo;
+
+        if ((fstat(file, &fileInfo) == 0) && (fileInfo.st_size > 0))
+        {
+            void *mapping = mmap(NULL, (size_t)fileInfo.st_size, PROT_READ, MAP_PRIVATE, file, 0);
+
+            if (mapping != MAP_FAILED)
+            {
+                data = (unsigned char *)mapping;
+                *size = (unsigned int)fileInfo.st_size;
+            }
+        }
+
+        close(file);
+    }
+#endif
+
+    return data;
+}
+
+// Unmap file from memory
+static void UnmapAudioFile(unsigned char *data, unsigned int size)
+{
+#if defined(_WIN32)
+    (void)size;
+    UnmapViewOfFile(data);
+#else
+    munmap(data, size);
+#endif
+}
+
+// Load sound from WAV file mapped into memory, sound data points to file data chunk (no copy)
+// NOTE: Only 32bit float data in device format (channels and sample rate) can be mapped, empty sound returned otherwise
+static Sound LoadSoundMappedWAV(const char *fileName)
+{
+    Sound sound = { 0 };
+
+    unsigned int fileSize = 0;
+    unsigned char *fileData = MapAudioFile(fileName, &fileSize);
+
+    if (fileData == NULL) return sound;
+
+    unsigned char *samples = NULL;
+    unsigned int samplesSize = 0;
+    bool deviceFormat = false;
+
+    // Check for RIFF and WAVE tags, then look for fmt and data chunks
+    if ((fileSize >= 12) && (strncmp((char *)fileData, "RIFF", 4) == 0) && (strncmp((char *)fileData + 8, "WAVE", 4) == 0))
+    {
+        unsigned int offset = 12;
+
+        while ((offset + 8) <= fileSize)
+        {
+            unsigned char *chunk = fileData + offset;
+            unsigned int chunkSize = chunk[4] | (chunk[5] << 8) | (chunk[6] << 16) | ((unsigned int)chunk[7] << 24);
+
+            if (chunkSize > (fileSize - offset - 8)) break;
+
+            if ((strncmp((char *)chunk, "fmt ", 4) == 0) && (chunkSize >= 16))
+            {
+                unsigned int audioFormat = chunk[8] | (chunk[9] << 8);
+                unsigned int channels = chunk[10] | (chunk[11] << 8);
+                unsigned int sampleRate = chunk[12] | (chunk[13] << 8) | (chunk[14] << 16) | ((unsigned int)chunk[15] << 24);
+                unsigned int bitsPerSample = chunk[22] | (chunk[23] << 8);
+
+                // NOTE: Format 3 is IEEE float data
+                deviceFormat = ((audioFormat == 3) && (bitsPerSample == 32) && (channels == DEVICE_CHANNELS) && (sampleRate == deviceSampleRate));
+            }
+            else if (strncmp((char *)chunk, "data", 4) == 0)
+            {
+                samples = chunk + 8;
+                samplesSize = chunkSize;
+                break;
+            }
+
+            offset += 8 + chunkSize + (chunkSize & 1);      // Chunks are padded to even size
+        }
+    }
+
+    // Data must be float aligned to be read directly
+    if (!deviceFormat || (samples == NULL) || (((size_t)samples & 3) != 0))
+    {
+        UnmapAudioFile(fileData, fileSize);
+        return sound;
+    }
+
+    ma_uint32 frameCount = samplesSize/(DEVICE_CHANNELS*sizeof(float));
+
+    AudioBuffer *audioBuffer = InitAudioBuffer(DEVICE_FORMAT, DEVICE_CHANNELS, deviceSampleRate, 0, AUDIO_BUFFER_USAGE_STATIC);
+
+    if (audioBuffer == NULL)
+    {
+        UnmapAudioFile(fileData, fileSize);
+        return sound;
+    }
+
+    RL_FREE(audioBuffer->buffer);
+
+    // Mapped data is shared by sound instances (LoadSoundAlias()), unmapped with last instance
+    audioBuffer->shared = (AudioData *)RL_CALLOC(1, sizeof(AudioData));
+    audioBuffer->shared->data = fileData;
+    audioBuffer->shared->dataSize = fileSize;
+    audioBuffer->shared->refCount = 1;
+    audioBuffer->shared->mapped = true;
+    audioBuffer->buffer = samples;
+    audioBuffer->bufferSizeInFrames = frameCount;
+
+    sound.sampleCount = frameCount*DEVICE_CHANNELS;
+    sound.stream.sampleRate = deviceSampleRate;
+    sound.stream.sampleSize = 32;
+    sound.stream.channels = DEVICE_CHANNELS;
+    sound.stream.buffer = audioBuffer;
+
+    TraceLog(LOG_INFO, "[%s] WAV file mapped successfully (%i Hz, %i bit, %s)", fileName, sound.stream.sampleRate, sound.stream.sampleSize, (sound.stream.channels == 1)? "Mono" : "Stereo");
+
+    return sound;
+}
+#endif
+
 // Some required functions for audio standalone module version
 #if defined(RAUDIO_STANDALONE)
 // Check file extension
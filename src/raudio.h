@@ -63,6 +63,9 @@
 #ifndef RL_CALLOC
     #define RL_CALLOC(n,sz)     calloc(n,sz)
 #endif
+#ifndef RL_REALLOC
+    #define RL_REALLOC(n,sz)    realloc(n,sz)
+#endif
 #ifndef RL_FREE
     #define RL_FREE(p)          free(p)
 #endif
@@ -78,6 +81,13 @@
     #endif
 #endif
 
+// Vector3 type (spatial audio positions)
+typedef struct Vector3 {
+    float x;
+    float y;
+    float z;
+} Vector3;
+
 // Wave type, defines audio wave data
 typedef struct Wave {
     unsigned int sampleCount;       // Total number of samples
@@ -117,6 +127,67 @@ typedef struct Music {
     AudioStream stream;             // Audio stream
 } Music;
 
+// Audio statistics, measured since last GetAudioStats() call
+typedef struct AudioStats {
+    float callbackTimeMin;      // Audio callback (mixing) min time (milliseconds)
+    float callbackTimeAvg;      // Audio callback (mixing) average time (milliseconds)
+    float callbackTimeMax;      // Audio callback (mixing) max time (milliseconds)
+    float callbackPeriod;       // Audio callback period (milliseconds), mixing time budget
+    int callbackCount;          // Audio callbacks measured
+    int buffersMixed;           // Audio buffers mixed on last callback (streams, music and voices)
+    int voicesMixed;            // Voices playing mixed (using a pool buffer)
+    int voicesVirtual;          // Voices playing virtual (not mixed)
+    int streamUnderruns;        // Audio streams and music underruns (played with no data ready)
+    float waitTime;             // Time waiting on audio thread (commands queue full or applied) and audio locks (milliseconds)
+    int waitCount;              // Waits on audio thread and audio locks
+} AudioStats;
+
+// Audio device configuration (InitAudioDeviceEx()), zero values use defaults
+typedef struct AudioDeviceConfig {
+    unsigned int sampleRate;        // Device sample rate (default: 44100 Hz)
+    unsigned int periodSize;        // Device period size in frames, lower is less latency (default: backend default)
+    unsigned int periodCount;       // Device periods count (default: backend default)
+    bool exclusive;                 // Exclusive mode, lower latency if backend supports it (shared mode otherwise)
+    int backend;                    // Audio backend (AudioBackend)
+} AudioDeviceConfig;
+
+// Audio conversion quality (SetAudioConversionQuality())
+typedef enum {
+    AUDIO_CONVERSION_LINEAR = 0,    // Linear sample rate conversion (fast)
+    AUDIO_CONVERSION_SINC           // Sinc sample rate conversion (high quality)
+} AudioConversionQuality;
+
+// Audio bus effect types (AddAudioBusEffect())
+typedef enum {
+    AUDIO_EFFECT_LOWPASS = 0,       // Lowpass biquad filter (params: cutoff Hz, resonance Q)
+    AUDIO_EFFECT_HIGHPASS,          // Highpass biquad filter (params: cutoff Hz, resonance Q)
+    AUDIO_EFFECT_DELAY,             // Delay with feedback (params: time seconds, feedback, wet mix)
+    AUDIO_EFFECT_COMPRESSOR,        // Dynamic range compressor (params: threshold dB, ratio, release seconds)
+    AUDIO_EFFECT_DUCKER             // Gain reduction while key bus is playing (params: key bus, depth, release seconds)
+} AudioEffectType;
+
+// Audio backends (InitAudioDeviceEx())
+typedef enum {
+    AUDIO_BACKEND_DEFAULT = 0,      // Platform default backends, by priority
+    AUDIO_BACKEND_WASAPI,
+    AUDIO_BACKEND_DSOUND,
+    AUDIO_BACKEND_WINMM,
+    AUDIO_BACKEND_COREAUDIO,
+    AUDIO_BACKEND_SNDIO,
+    AUDIO_BACKEND_AUDIO4,
+    AUDIO_BACKEND_OSS,
+    AUDIO_BACKEND_PULSEAUDIO,
+    AUDIO_BACKEND_ALSA,
+    AUDIO_BACKEND_JACK,
+    AUDIO_BACKEND_AAUDIO,
+    AUDIO_BACKEND_OPENSL,
+    AUDIO_BACKEND_WEBAUDIO,
+    AUDIO_BACKEND_NULL              // No output device (silent)
+} AudioBackend;
+
+// Audio stream callback, fills stream data from audio thread (SetAudioStreamCallback())
+typedef void (*AudioStreamCallback)(void *bufferData, unsigned int frames, void *userData);
+
 #ifdef __cplusplus
 extern "C" {            // Prevents name mangling of functions
 #endif
@@ -132,14 +203,22 @@ extern "C" {            // Prevents name mangling of functions
 
 // Audio device management functions
 void InitAudioDevice(void);                                     // Initialize audio device and context
+void InitAudioDeviceEx(AudioDeviceConfig config);               // Initialize audio device with configuration (sample rate, periods, share mode, backend)
 void CloseAudioDevice(void);                                    // Close the audio device and context
 bool IsAudioDeviceReady(void);                                  // Check if audio device has been initialized successfully
+AudioStats GetAudioStats(void);                                 // Get audio statistics since last call (mixing time, voices, underruns, waits)
 void SetMasterVolume(float volume);                             // Set master volume (listener)
+void SetAudioBusVolume(int bus, float volume);                  // Set bus volume (bus 0 is master bus)
+int AddAudioBusEffect(int bus, int type, float param0, float param1, float param2); // Add bus effect, returns effect index (processed on audio thread)
+void SetAudioBusEffect(int bus, int effect, float param0, float param1, float param2); // Set bus effect parameters
+void ClearAudioBusEffects(int bus);                             // Remove bus effects
 
 // Wave/Sound loading/unloading functions
 Wave LoadWave(const char *fileName);                            // Load wave data from file
 Sound LoadSound(const char *fileName);                          // Load sound from file
 Sound LoadSoundFromWave(Wave wave);                             // Load sound from wave data
+Sound LoadSoundCompressed(const char *fileName);                // Load compressed sound from file, decoded on playing (OGG, FLAC, MP3)
+Sound LoadSoundAlias(Sound source);                             // Load sound instance sharing source sound data
 void UpdateSound(Sound sound, const void *data, int samplesCount);// Update sound buffer with new data
 void UnloadWave(Wave wave);                                     // Unload wave data
 void UnloadSound(Sound sound);                                  // Unload sound
@@ -154,10 +233,29 @@ void ResumeSound(Sound sound);                                  // Resume a paus
 void PlaySoundMulti(Sound sound);                               // Play a sound (using multichannel buffer pool)
 void StopSoundMulti(void);                                      // Stop any sound playing (using multichannel buffer pool)
 int GetSoundsPlaying(void);                                     // Get number of sounds playing in the multichannel
+void SetAudioVoicesLimit(int maxVoices);                        // Set max voices mixed at the same time (others are virtual)
+void SetAudioVoicesDistance(float minDistance, float maxDistance); // Set voices distance attenuation range
+void SetSoundPriority(Sound sound, int priority, int maxInstances); // Set sound voices priority and max instances (0 for unlimited)
+int PlaySoundVoice(Sound sound, float volume, float distance);  // Play sound on a new voice, returns voice id (-1 if not played)
+void SetVoiceVolume(int voice, float volume);                   // Set voice volume
+void SetVoiceDistance(int voice, float distance);               // Set voice emitter distance to listener
+void SetVoicePosition(int voice, Vector3 position, Vector3 velocity); // Set voice emitter position and velocity (spatial voice)
+void StopVoice(int voice);                                      // Stop voice
+bool IsVoicePlaying(int voice);                                 // Check if voice is playing (mixed or virtual)
+bool IsVoiceVirtual(int voice);                                 // Check if voice is virtual (playing, not mixed)
+void UpdateAudioVoices(void);                                   // Update voices (release ended voices, mix most audible ones)
+void SetAudioListener(Vector3 position, Vector3 forward, Vector3 up, Vector3 velocity); // Set listener position, orientation and velocity (spatial audio)
+void SetAudioDopplerFactor(float factor);                       // Set doppler effect scale (0.0f disables it)
+void UpdateAudioSpatial(void);                                  // Update spatial audio (listener and emitters positions applied together)
 bool IsSoundPlaying(Sound sound);                               // Check if a sound is currently playing
 void SetSoundVolume(Sound sound, float volume);                 // Set volume for a sound (1.0 is max level)
 void SetSoundPitch(Sound sound, float pitch);                   // Set pitch for a sound (1.0 is base level)
+void SetSoundBus(Sound sound, int bus);                         // Set mixing bus for a sound (0 is master bus)
+void SetSoundPosition(Sound sound, Vector3 position, Vector3 velocity); // Set sound emitter position and velocity (voices played are spatial)
 void WaveFormat(Wave *wave, int sampleRate, int sampleSize, int channels);  // Convert wave data to desired format
+void WaveFormatBatch(Wave *waves, int count, int sampleRate, int sampleSize, int channels); // Convert waves data to desired format (worker threads)
+void SetAudioConversionQuality(int quality);                    // Set audio conversion quality (sample rate conversion)
+void SetAudioConversionCache(bool enabled);                     // Set converted waves data cache (same data converted only once)
 Wave WaveCopy(Wave wave);                                       // Copy a wave to a new wave
 void WaveCrop(Wave *wave, int initSample, int finalSample);     // Crop a wave to defined samples range
 float *GetWaveData(Wave wave);                                  // Get samples data from wave as a floats array
@@ -173,15 +271,23 @@ void ResumeMusicStream(Music music);                            // Resume playin
 bool IsMusicPlaying(Music music);                               // Check if music is playing
 void SetMusicVolume(Music music, float volume);                 // Set volume for music (1.0 is max level)
 void SetMusicPitch(Music music, float pitch);                   // Set pitch for a music (1.0 is base level)
+void SetMusicBus(Music music, int bus);                         // Set mixing bus for music (0 is master bus)
+void SetMusicPosition(Music music, Vector3 position, Vector3 velocity); // Set music emitter position and velocity (spatial music)
 void SetMusicLoopCount(Music music, int count);                 // Set music loop count (loop repeats)
+void SetMusicStreamThread(bool enabled, float bufferTime);      // Set music streams refilled by a background thread (no UpdateMusicStream() required)
+void SetMusicModuleCache(bool enabled);                         // Set tracker modules (XM, MOD) pre-rendered on loading, played from PCM cache
 float GetMusicTimeLength(Music music);                          // Get music time length (in seconds)
 float GetMusicTimePlayed(Music music);                          // Get current music time played (in seconds)
+unsigned int GetMusicUnderruns(Music music);                    // Get music stream underruns count (music played with no data ready)
 
 // AudioStream management functions
 AudioStream InitAudioStream(unsigned int sampleRate, unsigned int sampleSize, unsigned int channels); // Init audio stream (to stream raw audio pcm data)
+AudioStream InitAudioStreamEx(unsigned int sampleRate, unsigned int sampleSize, unsigned int channels, unsigned int subBufferSize, unsigned int subBufferCount); // Init audio stream with custom buffering (sub-buffer frames and count)
 void UpdateAudioStream(AudioStream stream, const void *data, int samplesCount); // Update audio stream buffers with data
 void CloseAudioStream(AudioStream stream);                      // Close audio stream and free memory
 bool IsAudioStreamProcessed(AudioStream stream);                // Check if any audio stream buffers requires refill
+unsigned int GetAudioStreamUnderruns(AudioStream stream);       // Get audio stream underruns count (stream played with no data ready)
+void SetAudioStreamCallback(AudioStream stream, AudioStreamCallback callback, void *userData); // Set audio stream callback, data pulled from audio thread (NULL to restore queued data)
 void PlayAudioStream(AudioStream stream);                       // Play audio stream
 void PauseAudioStream(AudioStream stream);                      // Pause audio stream
 void ResumeAudioStream(AudioStream stream);                     // Resume audio stream
@@ -189,6 +295,8 @@ bool IsAudioStreamPlaying(AudioStream stream);                  // Check if audi
 void StopAudioStream(AudioStream stream);                       // Stop audio stream
 void SetAudioStreamVolume(AudioStream stream, float volume);    // Set volume for audio stream (1.0 is max level)
 void SetAudioStreamPitch(AudioStream stream, float pitch);      // Set pitch for audio stream (1.0 is base level)
+void SetAudioStreamBus(AudioStream stream, int bus);            // Set mixing bus for audio stream (0 is master bus)
+void SetAudioStreamPosition(AudioStream stream, Vector3 position, Vector3 velocity); // Set audio stream emitter position and velocity (spatial stream)
 
 #ifdef __cplusplus
 }
@@ -98,19 +98,27 @@
 #define RAD2DEG (180.0f/PI)
 
 #define MAX_TOUCH_POINTS        10      // Maximum number of touch points supported
+#define MAX_FRAME_TIME_BUCKETS  80      // Frame time histogram buckets (GetFrameTimeHistogram())
+#define FRAME_TIME_BUCKET_SIZE  0.5f    // Frame time histogram bucket size (milliseconds)
+#define MAX_MEMORY_TAGS         8       // Memory allocations subsystem tags (MemoryTag)
 
 // Allow custom memory allocators
+// NOTE: By default allocations go through the runtime memory allocator (SetMemoryAllocator()),
+// tagged with RL_MEMORY_TAG subsystem for memory usage reporting (GetMemoryStats())
+#ifndef RL_MEMORY_TAG
+    #define RL_MEMORY_TAG       MEMORY_TAG_USER
+#endif
 #ifndef RL_MALLOC
-    #define RL_MALLOC(sz)       malloc(sz)
+    #define RL_MALLOC(sz)       MemAllocTagged(sz, RL_MEMORY_TAG)
 #endif
 #ifndef RL_CALLOC
-    #define RL_CALLOC(n,sz)     calloc(n,sz)
+    #define RL_CALLOC(n,sz)     MemCallocTagged(n, sz, RL_MEMORY_TAG)
 #endif
 #ifndef RL_REALLOC
-    #define RL_REALLOC(n,sz)    realloc(n,sz)
+    #define RL_REALLOC(n,sz)    MemReallocTagged(n, sz, RL_MEMORY_TAG)
 #endif
 #ifndef RL_FREE
-    #define RL_FREE(p)          free(p)
+    #define RL_FREE(p)          MemFree(p)
 #endif
 
 // NOTE: MSC C++ compiler does not support compound literals (C99 feature)
@@ -225,6 +233,16 @@ typedef struct Image {
     int format;             // Data format (PixelFormat type)
 } Image;
 
+// TiledImage type, pixels data is read from file by tiles on demand (images bigger than memory)
+typedef struct TiledImage {
+    int width;              // Image base width
+    int height;             // Image base height
+    int format;             // Data format (PixelFormat type, uncompressed only)
+    int mipmaps;            // Mipmap levels available in file (only base level is read by tiles)
+    int tileSize;           // Tiles size in pixels
+    void *tilesData;        // Tiles cache and file data (internal)
+} TiledImage;
+
 // Texture2D type
 // NOTE: Data stored in GPU memory
 typedef struct Texture2D {
@@ -282,6 +300,19 @@ typedef struct Font {
 
 #define SpriteFont Font     // SpriteFont type fallback, defaults to Font
 
+// Text layout type, pre-generated glyph quads for text redrawn without changes
+typedef struct TextLayout {
+    Font font;              // Font used by layout (quads texture coordinates reference its atlas)
+    char *text;             // Layout text (copy)
+    float fontSize;         // Layout font size
+    float spacing;          // Layout characters spacing
+    int quadsCount;         // Number of glyph quads
+    float *vertices;        // Glyph quads positions (XYZ, 4 vertex per quad), relative to layout origin
+    float *texcoords;       // Glyph quads texture coordinates (UV, 4 vertex per quad)
+    Vector2 size;           // Layout size (same as MeasureTextEx())
+    unsigned int version;   // Font atlas version when layout was built (dynamic fonts)
+} TextLayout;
+
 // Camera type, defines a camera position/orientation in 3d space
 typedef struct Camera3D {
     Vector3 position;       // Camera position
@@ -293,6 +324,16 @@ typedef struct Camera3D {
 
 typedef Camera3D Camera;    // Camera type fallback, defaults to Camera3D
 
+// Camera matrices type, camera transforms and view frustum (world space)
+// NOTE: Frustum planes (a, b, c, d) are normalized, point inside if (a*x + b*y + c*z + d) >= 0
+typedef struct CameraMatrices {
+    Matrix view;                // View matrix (camera look at)
+    Matrix projection;          // Projection matrix (perspective or orthographic)
+    Matrix viewProjection;      // View*projection matrix (world to clip space)
+    Matrix invViewProjection;   // Inverse view*projection matrix (clip to world space)
+    Vector4 planes[6];          // Frustum planes: left, right, bottom, top, near, far
+} CameraMatrices;
+
 // Camera2D type, defines a 2d camera
 typedef struct Camera2D {
     Vector2 offset;         // Camera offset (displacement from target)
@@ -319,12 +360,19 @@ typedef struct Mesh {
     // Animation vertex data
     float *animVertices;    // Animated vertex positions (after bones transformations)
     float *animNormals;     // Animated normals (after bones transformations)
-    int *boneIds;           // Vertex bone ids, up to 4 bones influence by vertex (skinning)
-    float *boneWeights;     // Vertex bone weight, up to 4 bones influence by vertex (skinning)
+    int *boneIds;           // Vertex bone ids, up to 4 bones influence by vertex (skinning) (shader-location = 6)
+    float *boneWeights;     // Vertex bone weight, up to 4 bones influence by vertex (skinning) (shader-location = 7)
+    int boneCount;          // Number of bone matrices for GPU skinning (0 if mesh is not skinned on GPU)
+    Matrix *boneMatrices;   // Bones transformations for GPU skinning (UpdateModelAnimationBones())
+
+    // Collision data
+    void *bvh;              // Bounding volume hierarchy for collision queries (MeshBuildBVH())
 
     // OpenGL identifiers
     unsigned int vaoId;     // OpenGL Vertex Array Object id
     unsigned int *vboId;    // OpenGL Vertex Buffer Objects id (default vertex data)
+    void *stream;           // Dynamic mesh GPU buffers copies state, cycled across frames (rlLoadMesh() dynamic)
+    int vertexFormat;       // Vertex attributes GPU storage formats (MeshVertexFormat flags, requested before rlLoadMesh())
 } Mesh;
 
 // Shader type (generic)
@@ -347,6 +395,28 @@ typedef struct Material {
     float *params;          // Material generic parameters (if required)
 } Material;
 
+// VirtualTexture type, texture bigger than VRAM, visible pages are streamed from file into a pages cache texture
+// NOTE: Material maps: MAP_DIFFUSE (fallback), MAP_SPECULAR (page table), MAP_NORMAL (pages cache), see SetMaterialVirtualTexture()
+typedef struct VirtualTexture {
+    int width;                  // Virtual texture width
+    int height;                 // Virtual texture height
+    int pageSize;               // Page size in pixels
+    Texture2D pageTable;        // Page table texture, one texel per page (cache page position, resident flag)
+    Texture2D pageCache;        // Physical pages cache texture
+    Texture2D fallback;         // Low resolution texture (sampled for non resident pages)
+    RenderTexture2D feedback;   // Feedback render texture (visible pages)
+    Shader shader;              // Shader sampling virtual texture (page table and pages cache)
+    Shader feedbackShader;      // Shader writing visible pages into feedback render texture
+    void *vtData;               // Virtual texture internal data (tiled image, pages state)
+} VirtualTexture;
+
+// PostProcess type, effects chain applied to scene render target, ping-pong render targets managed internally
+// NOTE: Consecutive per-pixel effects are merged into a single generated shader pass
+typedef struct PostProcess {
+    RenderTexture2D target;     // Scene render target (draw scene with BeginTextureMode(post.target))
+    void *ppData;               // Post-processing internal data (effects, passes shaders)
+} PostProcess;
+
 // Transformation properties
 typedef struct Transform {
     Vector3 translation;    // Translation
@@ -375,6 +445,9 @@ typedef struct Model {
     int boneCount;          // Number of bones
     BoneInfo *bones;        // Bones information (skeleton)
     Transform *bindPose;    // Bones base transformation (pose)
+
+    // Level of detail data
+    void *lods;             // Level of detail meshes chain (GenModelLODs())
 } Model;
 
 // Model animation
@@ -383,9 +456,57 @@ typedef struct ModelAnimation {
     BoneInfo *bones;        // Bones information (skeleton)
 
     int frameCount;         // Number of animation frames
-    Transform **framePoses; // Poses array by frame
+    float frameRate;        // Animation frames per second (time-based sampling)
+    Transform **framePoses; // Poses array by frame (NULL if compressed)
+    void *tracks;           // Compressed bones keyframes tracks (CompressModelAnimation())
 } ModelAnimation;
 
+// Terrain type, heightmap terrain streamed by chunks around view, chunks LOD by distance (geomipmapping)
+typedef struct Terrain {
+    Vector3 position;       // Terrain position (minimum corner)
+    Vector3 size;           // Terrain size (world units)
+    int chunkCells;         // Chunk cells per side at full detail (power of two)
+    int chunksX;            // Number of chunks along X
+    int chunksZ;            // Number of chunks along Z
+    int lodCount;           // Number of chunks LOD levels
+    float lodDistance;      // View distance to chunks drawn at LOD 1, distance doubles for every next LOD
+    float viewDistance;     // View distance to chunks streamed in, further chunks are unloaded
+    Material material;      // Terrain material (texture coordinates cover whole terrain)
+    void *terrainData;      // Terrain internal data (heightmap source, chunks state)
+} Terrain;
+
+// Heightfield type, heightmap samples grid with min/max heights hierarchy (terrain ray and height queries)
+typedef struct Heightfield {
+    Vector3 position;       // Heightfield position (minimum corner, same as heightmap model position)
+    Vector3 size;           // Heightfield size (world units, same as GenMeshHeightmap() size)
+    int width;              // Number of height samples along X
+    int length;             // Number of height samples along Z
+    float *heights;         // Height samples (world units, relative to position)
+    void *levelsData;       // Min/max heights hierarchy (cells groups by level)
+} Heightfield;
+
+// Cubicmap type, cells grid (walls and floors) meshed by chunks, cells can be changed at runtime
+typedef struct Cubicmap {
+    Vector3 position;       // Cubicmap position (cell (0, 0) floor center, as GenMeshCubicmap() mesh)
+    Vector3 cubeSize;       // Cells cube size (world units)
+    int width;              // Cubicmap width (cells along X)
+    int height;             // Cubicmap height (cells along Z)
+    int chunkSize;          // Chunk cells per side, chunk mesh is rebuilt when one of its cells changes
+    Material material;      // Cubicmap material (texture repeated by cell)
+    void *cubicmapData;     // Cubicmap internal data (cells, chunks meshes)
+} Cubicmap;
+
+// Tile map type, tiles grid drawn from tileset texture, tiles vertex data uploaded once by chunks (static buffers)
+typedef struct TileMap {
+    Texture2D tileset;      // Tileset texture, tiles stored by rows (tile 0 is top-left tile)
+    int tileWidth;          // Tile width (pixels)
+    int tileHeight;         // Tile height (pixels)
+    int width;              // Tile map width (tiles)
+    int height;             // Tile map height (tiles)
+    int chunkSize;          // Chunk tiles per side, only chunks inside view are drawn
+    void *tileMapData;      // Tile map internal data (tiles, chunks meshes)
+} TileMap;
+
 // Ray type (useful for raycast)
 typedef struct Ray {
     Vector3 position;       // Ray position (origin)
@@ -400,12 +521,81 @@ typedef struct RayHitInfo {
     Vector3 normal;         // Surface normal of hit
 } RayHitInfo;
 
+// Spatial index, dynamic bounding boxes tree (broadphase collision queries)
+typedef struct SpatialIndex {
+    int entryCount;         // Number of entries
+    void *treeData;         // Tree internal data (nodes)
+} SpatialIndex;
+
+// Spatial grid, hashed uniform grid of rectangles and circles (2d broadphase collision queries)
+typedef struct SpatialGrid {
+    int entryCount;         // Number of entries
+    void *gridData;         // Grid internal data (hashed cells)
+} SpatialGrid;
+
+// Rectangles set (structure of arrays), batched collision checks
+typedef struct RectangleSet {
+    int count;              // Number of rectangles
+    float *x;               // Rectangles top-left corner x
+    float *y;               // Rectangles top-left corner y
+    float *width;           // Rectangles width
+    float *height;          // Rectangles height
+} RectangleSet;
+
+// Circles set (structure of arrays), batched collision checks
+typedef struct CircleSet {
+    int count;              // Number of circles
+    float *x;               // Circles center x
+    float *y;               // Circles center y
+    float *radius;          // Circles radius
+} CircleSet;
+
+// Spheres set (structure of arrays), batched collision checks
+typedef struct SphereSet {
+    int count;              // Number of spheres
+    float *x;               // Spheres center x
+    float *y;               // Spheres center y
+    float *z;               // Spheres center z
+    float *radius;          // Spheres radius
+} SphereSet;
+
+// Bounding boxes set (structure of arrays), batched collision checks
+typedef struct BoundingBoxSet {
+    int count;              // Number of boxes
+    float *minX;            // Minimum vertex x
+    float *minY;            // Minimum vertex y
+    float *minZ;            // Minimum vertex z
+    float *maxX;            // Maximum vertex x
+    float *maxY;            // Maximum vertex y
+    float *maxZ;            // Maximum vertex z
+} BoundingBoxSet;
+
+// Billboards set (structure of arrays), drawn in one call by DrawBillboardSet()
+typedef struct BillboardSet {
+    int count;              // Number of billboards
+    Vector3 *positions;     // Billboards center position
+    Vector2 *sizes;         // Billboards size (width, height)
+    Color *colors;          // Billboards tint color (optional, WHITE if NULL)
+    Rectangle *sources;     // Billboards texture source rectangle (optional, full texture if NULL)
+} BillboardSet;
+
 // Bounding box type
 typedef struct BoundingBox {
     Vector3 min;            // Minimum vertex box-corner
     Vector3 max;            // Maximum vertex box-corner
 } BoundingBox;
 
+// Static batch type, static meshes instances merged by material into world space meshes (spatial chunks)
+typedef struct StaticBatch {
+    int meshCount;          // Number of merged meshes
+    Mesh *meshes;           // Merged meshes (world space vertex data)
+    BoundingBox *bounds;    // Merged meshes bounds (world space)
+    int *meshMaterial;      // Merged meshes material index
+    int materialCount;      // Number of materials
+    Material *materials;    // Materials (shared with added instances, not unloaded)
+    void *batchData;        // Static batch internal data (instances added, not built yet)
+} StaticBatch;
+
 // Wave type, defines audio wave data
 typedef struct Wave {
     unsigned int sampleCount;       // Total number of samples
@@ -445,6 +635,138 @@ typedef struct Music {
     AudioStream stream;             // Audio stream
 } Music;
 
+// Render statistics, counted by rlgl every frame
+typedef struct RenderStats {
+    int drawCalls;              // Draw calls issued (internal batch draws and meshes)
+    int vertexCount;            // Vertices drawn (internal batch and meshes)
+    int batchFlushes;           // Internal batch flushes with vertex data to draw
+    int flushesBufferFull;      // Batch flushes forced by vertex buffer full (MAX_BATCH_ELEMENTS)
+    int flushesTextureChange;   // Batch flushes forced on texture change by draw calls limit (MAX_DRAWCALL_REGISTERED)
+    int flushesModeChange;      // Batch flushes forced on draw mode change by draw calls limit (MAX_DRAWCALL_REGISTERED)
+    int flushesStateChange;     // Batch flushes requested on state change (shader, blending, render target, matrices...)
+    int textureBinds;           // Textures bound for drawing
+    int shaderSwitches;         // Shader program changes for drawing
+    int uploadedBytes;          // Vertex data uploaded to GPU buffers (in bytes)
+    int attribUpdates;          // Vertex attributes pointers set (without VAO support, redundant ones are skipped)
+} RenderStats;
+
+// Memory usage, of one allocations subsystem or GPU resources kind
+typedef struct MemoryUsage {
+    unsigned long long bytes;       // Memory in use (in bytes)
+    unsigned long long peakBytes;   // Peak memory in use (in bytes)
+    unsigned int count;             // Allocations (or GPU objects) alive
+    unsigned int totalCount;        // Allocations (or GPU objects) made since program start
+} MemoryUsage;
+
+// Memory usage statistics (GetMemoryStats())
+// NOTE: GPU memory is estimated from resources formats and sizes, drivers can use more
+typedef struct MemoryStats {
+    MemoryUsage heap;               // CPU memory allocated by raylib memory allocator (all subsystems)
+    MemoryUsage tags[MAX_MEMORY_TAGS];  // CPU memory by subsystem (MemoryTag)
+    MemoryUsage video;              // GPU memory (all resources)
+    MemoryUsage videoTextures;      // GPU memory used by textures, cubemaps and render textures attachments
+    MemoryUsage videoBuffers;       // GPU memory used by meshes and internal vertex buffers
+} MemoryStats;
+
+// Input event, timestamped and queued when received (GetInputEvent())
+typedef struct InputEvent {
+    int type;                   // Input event type (InputEventType)
+    double time;                // Event time in seconds (GetTime() clock)
+    int code;                   // Key, codepoint, mouse button, gamepad button or axis, touch point id
+    int device;                 // Gamepad number (0 for other devices)
+    Vector2 value;              // Mouse or touch position, mouse wheel move, gamepad axis value (x)
+} InputEvent;
+
+// Frame time histogram, measured since last GetFrameTimeHistogram() call
+typedef struct FrameTimeHistogram {
+    int buckets[MAX_FRAME_TIME_BUCKETS];    // Frames count per frame time bucket, last bucket counts longer frames
+    int frameCount;             // Frames measured
+    float frameTimeMin;         // Frame time min (milliseconds)
+    float frameTimeAvg;         // Frame time average (milliseconds)
+    float frameTimeMax;         // Frame time max (milliseconds)
+    float targetTime;           // Target frame time (milliseconds), 0 if not set
+    int framesLate;             // Frames over target time by more than 1 ms
+    int framesWaited;           // Frames waiting for target time
+    float waitErrorAvg;         // Waited time over requested average (milliseconds)
+    float waitErrorMax;         // Waited time over requested max (milliseconds)
+} FrameTimeHistogram;
+
+// CPU profile zone statistics, measured over last frame (GetProfileZones())
+typedef struct ProfileZoneStats {
+    const char *name;           // Zone name (as provided to BeginProfileZone())
+    int thread;                 // Thread index (registration order, main thread is usually 0)
+    int depth;                  // Zone nesting depth on its thread
+    int calls;                  // Zone calls ended during frame
+    float start;                // First call start time from frame start (milliseconds)
+    float time;                 // Total time of all calls (milliseconds)
+    float timeMax;              // Max time of one call (milliseconds)
+} ProfileZoneStats;
+
+// Random numbers generator state (xoshiro128**), one state per thread or system
+typedef struct RandomState {
+    unsigned int s[4];          // Generator state words (never all zero)
+} RandomState;
+
+// Audio statistics, measured since last GetAudioStats() call
+typedef struct AudioStats {
+    float callbackTimeMin;      // Audio callback (mixing) min time (milliseconds)
+    float callbackTimeAvg;      // Audio callback (mixing) average time (milliseconds)
+    float callbackTimeMax;      // Audio callback (mixing) max time (milliseconds)
+    float callbackPeriod;       // Audio callback period (milliseconds), mixing time budget
+    int callbackCount;          // Audio callbacks measured
+    int buffersMixed;           // Audio buffers mixed on last callback (streams, music and voices)
+    int voicesMixed;            // Voices playing mixed (using a pool buffer)
+    int voicesVirtual;          // Voices playing virtual (not mixed)
+    int streamUnderruns;        // Audio streams and music underruns (played with no data ready)
+    float waitTime;             // Time waiting on audio thread (commands queue full or applied) and audio locks (milliseconds)
+    int waitCount;              // Waits on audio thread and audio locks
+} AudioStats;
+
+// Audio device configuration (InitAudioDeviceEx()), zero values use defaults
+typedef struct AudioDeviceConfig {
+    unsigned int sampleRate;        // Device sample rate (default: 44100 Hz)
+    unsigned int periodSize;        // Device period size in frames, lower is less latency (default: backend default)
+    unsigned int periodCount;       // Device periods count (default: backend default)
+    bool exclusive;                 // Exclusive mode, lower latency if backend supports it (shared mode otherwise)
+    int backend;                    // Audio backend (AudioBackend)
+} AudioDeviceConfig;
+
+// Directory opened for reading entries one by one (OpenDirectory())
+typedef struct Directory {
+    bool recursive;             // Subdirectories entries are read too (depth first)
+    void *ctxData;              // Directory reading internal data (open directories, filters)
+} Directory;
+
+// Directory entry, name and path are valid until next entry is read
+typedef struct DirectoryEntry {
+    const char *name;           // Entry file name
+    const char *path;           // Entry path (opened directory path included)
+    bool isDirectory;           // Entry is a directory
+    long long size;             // File size in bytes (0 for directories)
+    long modTime;               // Modification time (last write time)
+    int depth;                  // Subdirectory depth (0 for opened directory entries)
+} DirectoryEntry;
+
+// File change event, queued for watched files and directories (WatchFile())
+typedef struct FileChangeEvent {
+    int watch;                  // Watch id (WatchFile())
+    int type;                   // Change type (FileChangeType)
+    const char *fileName;       // Changed file path, valid until next event is read
+} FileChangeEvent;
+
+// Compression stream, data compressed (or decompressed) incrementally by blocks
+typedef struct CompressStream {
+    int codec;                  // Compression codec (CompressionCodec)
+    bool decompress;            // Stream decompresses data (compresses otherwise)
+    void *ctxData;              // Stream internal data (pending input and output)
+} CompressStream;
+
+// Command list, drawing commands recorded once and drawn multiple times
+typedef struct CommandList {
+    struct RenderBatch *batch;  // Render batch with recorded vertex data and draw calls (rlgl)
+    bool dirty;                 // Command list requires to be recorded again
+} CommandList;
+
 // Head-Mounted-Display device parameters
 typedef struct VrDeviceInfo {
     int hResolution;                // HMD horizontal resolution in pixels
@@ -473,7 +795,8 @@ typedef enum {
     FLAG_WINDOW_HIDDEN      = 128,  // Set to create the window initially hidden
     FLAG_WINDOW_ALWAYS_RUN  = 256,  // Set to allow windows running while minimized
     FLAG_MSAA_4X_HINT       = 32,   // Set to try enabling MSAA 4X
-    FLAG_VSYNC_HINT         = 64    // Set to try enabling V-Sync on GPU
+    FLAG_VSYNC_HINT         = 64,   // Set to try enabling V-Sync on GPU
+    FLAG_SUSTAINED_PERFORMANCE = 512    // Set to request sustained performance mode (Android), steady clocks instead of thermal throttling
 } ConfigFlag;
 
 // Trace log type
@@ -488,6 +811,22 @@ typedef enum {
     LOG_NONE            // Disable logging
 } TraceLogType;
 
+// Frame pacing modes (SetFramePacing())
+typedef enum {
+    FRAME_PACING_SLEEP = 0,     // Sleep remaining frame time (low CPU usage, sleep granularity jitter)
+    FRAME_PACING_HYBRID,        // Sleep in steps while over calibrated margin, spin the rest (precise)
+    FRAME_PACING_BUSY,          // Spin remaining frame time (precise, one CPU core busy)
+    FRAME_PACING_DISPLAY        // Present frames on display vsync (Android Choreographer and presentation time), sleep otherwise
+} FramePacingMode;
+
+// Screen projected points flags (GetWorldToScreenBatch())
+// NOTE: Used for bit masks
+typedef enum {
+    SCREEN_POINT_VISIBLE    = 0,    // Point projected inside screen
+    SCREEN_POINT_BEHIND     = 1,    // Point behind camera (closer than near plane), screen position not valid
+    SCREEN_POINT_OFFSCREEN  = 2     // Point in front of camera but outside screen
+} ScreenPointFlag;
+
 // Keyboard keys
 typedef enum {
     // Alphanumeric keys
@@ -678,6 +1017,24 @@ typedef enum {
     GAMEPAD_AXIS_RIGHT_TRIGGER      // [1..-1] (pressure-level)
 } GamepadAxis;
 
+// Input event types (GetInputEvent())
+typedef enum {
+    INPUT_EVENT_KEY_DOWN = 0,           // Key pressed (code: key)
+    INPUT_EVENT_KEY_UP,                 // Key released (code: key)
+    INPUT_EVENT_KEY_REPEAT,             // Key autorepeat (code: key)
+    INPUT_EVENT_CHAR,                   // Character input (code: unicode codepoint)
+    INPUT_EVENT_MOUSE_BUTTON_DOWN,      // Mouse button pressed (code: button, value: position)
+    INPUT_EVENT_MOUSE_BUTTON_UP,        // Mouse button released (code: button, value: position)
+    INPUT_EVENT_MOUSE_MOVE,             // Mouse moved (value: position)
+    INPUT_EVENT_MOUSE_WHEEL,            // Mouse wheel moved (value: wheel move x, y)
+    INPUT_EVENT_GAMEPAD_BUTTON_DOWN,    // Gamepad button pressed (code: button, device: gamepad)
+    INPUT_EVENT_GAMEPAD_BUTTON_UP,      // Gamepad button released (code: button, device: gamepad)
+    INPUT_EVENT_GAMEPAD_AXIS,           // Gamepad axis moved (code: axis, device: gamepad, value.x: axis value)
+    INPUT_EVENT_TOUCH_DOWN,             // Touch point down (code: touch point id, value: position)
+    INPUT_EVENT_TOUCH_UP,               // Touch point up (code: touch point id, value: position)
+    INPUT_EVENT_TOUCH_MOVE              // Touch point moved (code: touch point id, value: position)
+} InputEventType;
+
 // Shader location point type
 typedef enum {
     LOC_VERTEX_POSITION = 0,
@@ -704,7 +1061,11 @@ typedef enum {
     LOC_MAP_CUBEMAP,
     LOC_MAP_IRRADIANCE,
     LOC_MAP_PREFILTER,
-    LOC_MAP_BRDF
+    LOC_MAP_BRDF,
+    LOC_VERTEX_INSTANCE_TX,
+    LOC_VERTEX_BONEIDS,
+    LOC_VERTEX_BONEWEIGHTS,
+    LOC_MATRIX_BONES
 } ShaderLocationIndex;
 
 #define LOC_MAP_DIFFUSE      LOC_MAP_ALBEDO
@@ -801,14 +1162,16 @@ typedef enum {
 typedef enum {
     FONT_DEFAULT = 0,       // Default font generation, anti-aliased
     FONT_BITMAP,            // Bitmap font generation, no anti-aliasing
-    FONT_SDF                // SDF font generation, requires external shader
+    FONT_SDF,               // SDF font generation, requires external shader
+    FONT_MSDF               // MSDF (multi-channel SDF) font generation, requires MSDF shader (LoadShaderMsdf())
 } FontType;
 
 // Color blending modes (pre-defined)
 typedef enum {
     BLEND_ALPHA = 0,        // Blend textures considering alpha (default)
     BLEND_ADDITIVE,         // Blend textures adding colors
-    BLEND_MULTIPLIED        // Blend textures multiplying colors
+    BLEND_MULTIPLIED,       // Blend textures multiplying colors
+    BLEND_ALPHA_TARGET      // Blend textures considering alpha into transparent render target (alpha channel accumulated)
 } BlendMode;
 
 // Gestures type
@@ -824,7 +1187,8 @@ typedef enum {
     GESTURE_SWIPE_UP    = 64,
     GESTURE_SWIPE_DOWN  = 128,
     GESTURE_PINCH_IN    = 256,
-    GESTURE_PINCH_OUT   = 512
+    GESTURE_PINCH_OUT   = 512,
+    GESTURE_MULTI_DRAG  = 1024      // Three or more touch points moving together
 } GestureType;
 
 // Camera system modes
@@ -849,8 +1213,130 @@ typedef enum {
     NPT_3PATCH_HORIZONTAL   // Npatch defined by 3x1 tiles
 } NPatchType;
 
+// Mesh optimization flags (MeshOptimize())
+typedef enum {
+    MESH_OPTIMIZE_WELD          = 1,    // Weld duplicated vertices (unindexed meshes get indexed)
+    MESH_OPTIMIZE_VERTEX_CACHE  = 2,    // Reorder triangles for post-transform vertex cache efficiency
+    MESH_OPTIMIZE_OVERDRAW      = 4,    // Reorder triangles clusters to reduce overdraw
+    MESH_OPTIMIZE_VERTEX_FETCH  = 8,    // Reorder vertices by first use (unreferenced vertices removed)
+    MESH_OPTIMIZE_ALL           = 15
+} MeshOptimizeFlags;
+
+// Cubicmap cell types (cubicmap image: white pixels are walls, black pixels floors)
+typedef enum {
+    CUBICMAP_CELL_EMPTY = 0,        // No geometry
+    CUBICMAP_CELL_FLOOR,            // Floor and ceiling
+    CUBICMAP_CELL_WALL              // Cube (walls facing non-wall cells)
+} CubicmapCellType;
+
+// Mesh vertex attributes GPU storage formats (flags), full floats by default
+// NOTE: Formats are requested before mesh upload, unsupported formats fallback to floats
+typedef enum {
+    MESH_FORMAT_DEFAULT = 0,                // Full floats for all attributes
+    MESH_FORMAT_POSITION_HALF = 1,          // Positions stored as half floats (XYZ1, 8 bytes)
+    MESH_FORMAT_TEXCOORD_SNORM16 = 2,       // Texcoords and texcoords2 stored as signed normalized shorts (UV in [-1..1] range)
+    MESH_FORMAT_NORMAL_PACKED = 4,          // Normals and tangents stored as signed normalized 10:10:10:2 (4 bytes)
+    MESH_FORMAT_COMPACT = 7                 // All compact formats
+} MeshVertexFormat;
+
+// Procedural mesh shapes (GenMeshCached())
+typedef enum {
+    MESH_SHAPE_SPHERE = 0,          // Sphere: radius, segments (rings), sides (slices)
+    MESH_SHAPE_HEMISPHERE,          // Half-sphere: radius, segments (rings), sides (slices)
+    MESH_SHAPE_CYLINDER,            // Cylinder: radius, size (height), segments (slices)
+    MESH_SHAPE_TORUS,               // Torus: radius, size, segments (radSeg), sides
+    MESH_SHAPE_KNOT                 // Trefoil knot: radius, size, segments (radSeg), sides
+} MeshShapeType;
+
+// Shapes render modes (SetShapesRenderMode())
+typedef enum {
+    SHAPES_RENDER_TESSELLATED = 0,  // Shapes tessellated on CPU into render batch
+    SHAPES_RENDER_SDF               // Curved shapes and thick lines drawn as one quad evaluated on GPU (signed distance field)
+} ShapesRenderMode;
+
+// Path joins types (DrawPolylineEx())
+typedef enum {
+    LINE_JOIN_MITER = 0,    // Segments extended to meet (beveled if too long)
+    LINE_JOIN_BEVEL,        // Segments outer corners joined by a straight edge
+    LINE_JOIN_ROUND         // Segments joined by an arc
+} LineJoinType;
+
+// Path caps types (DrawPolylineEx())
+typedef enum {
+    LINE_CAP_BUTT = 0,      // Path ends at end points
+    LINE_CAP_SQUARE,        // Path extended half thickness past end points
+    LINE_CAP_ROUND          // Path ends with half circles
+} LineCapType;
+
+// Audio conversion quality (SetAudioConversionQuality())
+typedef enum {
+    AUDIO_CONVERSION_LINEAR = 0,    // Linear sample rate conversion (fast)
+    AUDIO_CONVERSION_SINC           // Sinc sample rate conversion (high quality)
+} AudioConversionQuality;
+
+// Audio bus effect types (AddAudioBusEffect())
+typedef enum {
+    AUDIO_EFFECT_LOWPASS = 0,       // Lowpass biquad filter (params: cutoff Hz, resonance Q)
+    AUDIO_EFFECT_HIGHPASS,          // Highpass biquad filter (params: cutoff Hz, resonance Q)
+    AUDIO_EFFECT_DELAY,             // Delay with feedback (params: time seconds, feedback, wet mix)
+    AUDIO_EFFECT_COMPRESSOR,        // Dynamic range compressor (params: threshold dB, ratio, release seconds)
+    AUDIO_EFFECT_DUCKER             // Gain reduction while key bus is playing (params: key bus, depth, release seconds)
+} AudioEffectType;
+
+// Audio backends (InitAudioDeviceEx())
+typedef enum {
+    AUDIO_BACKEND_DEFAULT = 0,      // Platform default backends, by priority
+    AUDIO_BACKEND_WASAPI,
+    AUDIO_BACKEND_DSOUND,
+    AUDIO_BACKEND_WINMM,
+    AUDIO_BACKEND_COREAUDIO,
+    AUDIO_BACKEND_SNDIO,
+    AUDIO_BACKEND_AUDIO4,
+    AUDIO_BACKEND_OSS,
+    AUDIO_BACKEND_PULSEAUDIO,
+    AUDIO_BACKEND_ALSA,
+    AUDIO_BACKEND_JACK,
+    AUDIO_BACKEND_AAUDIO,
+    AUDIO_BACKEND_OPENSL,
+    AUDIO_BACKEND_WEBAUDIO,
+    AUDIO_BACKEND_NULL              // No output device (silent)
+} AudioBackend;
+
+// File change types (GetFileChangeEvent())
+typedef enum {
+    FILE_CHANGE_MODIFIED = 0,       // File written (or directory modified, if no watch backend available)
+    FILE_CHANGE_CREATED,            // File created (or moved into watched directory)
+    FILE_CHANGE_DELETED             // File deleted (or moved out of watched directory)
+} FileChangeType;
+
+// Data compression codecs
+typedef enum {
+    COMPRESSION_DEFLATE = 0,        // DEFLATE (zlib stream), better ratio
+    COMPRESSION_LZ4                 // LZ4 block, much faster compression and decompression
+} CompressionCodec;
+
+// Memory allocations subsystem, used for memory usage reporting (GetMemoryStats())
+typedef enum {
+    MEMORY_TAG_USER = 0,            // Program allocations (MemAlloc(), RL_MALLOC() out of raylib)
+    MEMORY_TAG_CORE,                // Core and utils: files data, internal buffers, scratch memory
+    MEMORY_TAG_RLGL,                // rlgl: render batch, readbacks, shaders data
+    MEMORY_TAG_TEXTURES,            // Images data
+    MEMORY_TAG_TEXT,                // Fonts and text
+    MEMORY_TAG_MODELS,              // Meshes, materials and animations
+    MEMORY_TAG_AUDIO                // Waves, sounds and music
+} MemoryTag;
+
 // Callbacks to be implemented by users
 typedef void (*TraceLogCallback)(int logType, const char *text, va_list args);
+typedef void (*LoadImageCallback)(int index, const char *fileName, Image image, void *userData);
+typedef void (*LoadFileDataCallback)(const char *fileName, unsigned char *data, unsigned int bytesRead, void *userData);
+typedef void (*AudioStreamCallback)(void *bufferData, unsigned int frames, void *userData);
+typedef void (*FixedUpdateCallback)(float deltaTime, void *userData);
+typedef void (*JobFunc)(void *data);
+typedef void (*ParallelForFunc)(void *data, int start, int end);
+typedef void *(*MemAllocCallback)(unsigned int size, void *userData);
+typedef void *(*MemReallocCallback)(void *ptr, unsigned int size, void *userData);
+typedef void (*MemFreeCallback)(void *ptr, void *userData);
 
 #if defined(__cplusplus)
 extern "C" {            // Prevents name mangling of functions
@@ -883,6 +1369,10 @@ RLAPI void SetWindowMonitor(int monitor);                         // Set monitor
 RLAPI void SetWindowMinSize(int width, int height);               // Set window minimum dimensions (for FLAG_WINDOW_RESIZABLE)
 RLAPI void SetWindowSize(int width, int height);                  // Set window dimensions
 RLAPI void *GetWindowHandle(void);                                // Get native window handle
+RLAPI bool InitLoaderContext(void);                               // Initialize graphics context for a resources loader thread (shared with window context)
+RLAPI void CloseLoaderContext(void);                              // Close loader thread graphics context
+RLAPI void BeginLoaderContext(void);                              // Make loader context current on calling thread (textures, shaders, meshes loading)
+RLAPI void EndLoaderContext(void);                                // Wait loader GPU work completion (fence) and release context from calling thread
 RLAPI int GetScreenWidth(void);                                   // Get current screen width
 RLAPI int GetScreenHeight(void);                                  // Get current screen height
 RLAPI int GetMonitorCount(void);                                  // Get number of connected monitors
@@ -914,22 +1404,58 @@ RLAPI void BeginTextureMode(RenderTexture2D target);              // Initializes
 RLAPI void EndTextureMode(void);                                  // Ends drawing to render texture
 RLAPI void BeginScissorMode(int x, int y, int width, int height); // Begin scissor mode (define screen area for following drawing)
 RLAPI void EndScissorMode(void);                                  // End scissor mode
+RLAPI void EnableDynamicResolution(float targetFrameTime, float minScale);// Enable drawing to internal render target scaled from measured GPU frame time (0: target FPS time)
+RLAPI void DisableDynamicResolution(void);                        // Disable dynamic resolution, drawing directly to screen
+RLAPI float GetResolutionScale(void);                             // Get current dynamic resolution scale (1.0f if disabled)
+
+// Command lists functions (retained drawing)
+RLAPI CommandList LoadCommandList(int elements);                  // Load command list, elements (quads) capacity (0 for default capacity)
+RLAPI void UnloadCommandList(CommandList list);                   // Unload command list
+RLAPI void BeginCommandList(CommandList *list);                   // Begin recording drawing commands into command list (previous commands are discarded)
+RLAPI void EndCommandList(void);                                  // End recording drawing commands
+RLAPI void DrawCommandList(CommandList list, Matrix transform);   // Draw command list with a transform, recorded commands are kept
+RLAPI void SetCommandListDirty(CommandList *list);                // Mark command list to be recorded again
+RLAPI bool IsCommandListDirty(CommandList list);                  // Check if command list requires to be recorded
 
 // Screen-space-related functions
 RLAPI Ray GetMouseRay(Vector2 mousePosition, Camera camera);      // Returns a ray trace from mouse position
 RLAPI Matrix GetCameraMatrix(Camera camera);                      // Returns camera transform matrix (view matrix)
 RLAPI Matrix GetCameraMatrix2D(Camera2D camera);                  // Returns camera 2d transform matrix
+RLAPI CameraMatrices GetCameraMatrices(Camera camera);            // Returns camera matrices and frustum planes for current render size (cached)
 RLAPI Vector2 GetWorldToScreen(Vector3 position, Camera camera);  // Returns the screen space position for a 3d world space position
 RLAPI Vector2 GetWorldToScreenEx(Vector3 position, Camera camera, int width, int height); // Returns size position for a 3d world space position
+RLAPI int GetWorldToScreenBatch(const Vector3 *in, Vector2 *out, int count, Camera camera, unsigned char *flags); // Returns screen space positions for 3d world space positions, returns visible points count
 RLAPI Vector2 GetWorldToScreen2D(Vector2 position, Camera2D camera); // Returns the screen space position for a 2d camera world space position
 RLAPI Vector2 GetScreenToWorld2D(Vector2 position, Camera2D camera); // Returns the world space position for a 2d camera screen space position
 
 // Timing-related functions
 RLAPI void SetTargetFPS(int fps);                                 // Set target FPS (maximum)
+RLAPI void SetSwapInterval(int interval);                         // Set buffers swap interval (0: no V-Sync, 1: V-Sync, -1: adaptive V-Sync)
+RLAPI void SetInputLateLatching(bool enabled);                    // Set input polling after frame wait, just before next frame update (lower latency)
 RLAPI int GetFPS(void);                                           // Returns current FPS
 RLAPI float GetFrameTime(void);                                   // Returns time in seconds for last frame drawn
+RLAPI void SetFramePacing(int mode);                              // Set frame pacing mode used to wait for target FPS (FramePacingMode)
+RLAPI FrameTimeHistogram GetFrameTimeHistogram(void);             // Get frame time histogram measured since last call
+RLAPI int AddFixedUpdate(FixedUpdateCallback callback, float rate, void *userData); // Add fixed-rate update callback (updates per second) called on BeginDrawing(), returns id
+RLAPI void RemoveFixedUpdate(int id);                             // Remove fixed-rate update callback
+RLAPI void SetFixedUpdateMaxSteps(int maxSteps);                  // Set max fixed update steps per frame, exceeding time is dropped (default: 5)
+RLAPI float GetFixedUpdateAlpha(int id);                          // Get fixed update interpolation alpha [0..1] for drawing
+RLAPI int GetFixedUpdateStepsDropped(int id);                     // Get fixed update steps dropped by max steps clamping (counter is reset)
+RLAPI void EnableEventWaiting(void);                              // Enable waiting for events on EndDrawing(), frame loop runs on events only
+RLAPI void DisableEventWaiting(void);                             // Disable waiting for events on EndDrawing(), automatic events polling
+RLAPI void SetEventWaitingTimeout(float seconds);                 // Set max time waiting for events in seconds (0 to wait without timeout)
+RLAPI void RequestRedraw(void);                                   // Request a redraw, next frame doesn't wait for events (any thread)
 RLAPI double GetTime(void);                                       // Returns elapsed time in seconds since InitWindow()
 
+// Profiler functions
+RLAPI void EnableProfiler(void);                                  // Enable CPU profile zones recording (statistics collected on EndDrawing())
+RLAPI void DisableProfiler(void);                                 // Disable CPU profile zones recording
+RLAPI bool IsProfilerEnabled(void);                               // Check if CPU profile zones recording is enabled
+RLAPI void BeginProfileZone(const char *name);                    // Begin CPU profile zone on calling thread (nestable, name must remain valid)
+RLAPI void EndProfileZone(void);                                  // End CPU profile zone on calling thread
+RLAPI const ProfileZoneStats *GetProfileZones(int *count);        // Get CPU profile zones statistics of last frame
+RLAPI bool ExportProfileTrace(const char *fileName);              // Export recorded CPU profile zones as Chrome trace events (JSON)
+
 // Color-related functions
 RLAPI int ColorToInt(Color color);                                // Returns hexadecimal value for a Color
 RLAPI Vector4 ColorNormalize(Color color);                        // Returns color normalized as float [0..1]
@@ -944,9 +1470,38 @@ RLAPI void SetConfigFlags(unsigned int flags);                    // Setup windo
 RLAPI void SetTraceLogLevel(int logType);                         // Set the current threshold (minimum) log level
 RLAPI void SetTraceLogExit(int logType);                          // Set the exit threshold (minimum) log level
 RLAPI void SetTraceLogCallback(TraceLogCallback callback);        // Set a trace log callback to enable custom logging
+RLAPI void SetTraceLogAsync(bool enabled);                        // Set trace log messages written on a background thread (rate limited, repeated messages merged)
+RLAPI void SetWorkerThreads(int count);                           // Set number of worker threads for internal jobs (0: disabled, -1: cores count - 1)
+RLAPI int GetWorkerThreads(void);                                 // Get number of worker threads available for internal jobs
+RLAPI void SubmitJob(JobFunc func, void *data, int *counter);     // Submit job to shared worker threads, counter (optional) decremented once done
+RLAPI void WaitJob(int *counter);                                 // Wait for jobs sharing counter to finish (calling thread runs queued jobs)
+RLAPI bool IsJobDone(int *counter);                               // Check if jobs sharing counter are finished (non-blocking)
+RLAPI void ParallelFor(ParallelForFunc func, void *data, int count, int chunkSize); // Run loop body on [0, count) in chunks on worker threads (chunkSize 0: automatic)
+RLAPI void SetAssetsHotReload(bool enabled);                      // Set cached assets hot reload on files modification (development)
 RLAPI void TraceLog(int logType, const char *text, ...);          // Show trace log messages (LOG_DEBUG, LOG_INFO, LOG_WARNING, LOG_ERROR)
 RLAPI void TakeScreenshot(const char *fileName);                  // Takes a screenshot of current screen (saved a .png)
+RLAPI void SetGifRecordingOptions(int downscale, bool fixedPalette); // Set GIF recording options: frames downscale divider, palette reused across frames
 RLAPI int GetRandomValue(int min, int max);                       // Returns a random value between min and max (both included)
+RLAPI void SetRandomSeed(unsigned int seed);                      // Set the seed of GetRandomValue() generator
+RLAPI RandomState LoadRandomState(unsigned long long seed);       // Load random generator state from seed (xoshiro128**, deterministic on every platform)
+RLAPI unsigned int GetRandomUInt(RandomState *state);             // Get random 32 bit value from generator state
+RLAPI int GetRandomInt(RandomState *state, int min, int max);     // Get random integer between min and max (both included, unbiased)
+RLAPI float GetRandomFloat(RandomState *state, float min, float max); // Get random float between min (included) and max (excluded)
+RLAPI void GetRandomInts(RandomState *state, int *values, int count, int min, int max); // Fill array with random integers between min and max (both included, unbiased)
+RLAPI void GetRandomFloats(RandomState *state, float *values, int count, float min, float max); // Fill array with random floats between min (included) and max (excluded)
+
+// Memory management functions
+// NOTE: Memory returned by raylib functions must be freed with MemFree() (or the matching Unload*() function)
+RLAPI void SetMemoryAllocator(MemAllocCallback allocCallback, MemReallocCallback reallocCallback, MemFreeCallback freeCallback, void *userData); // Set memory allocator (NULL: standard library), set it before any allocation, callbacks must be thread-safe
+RLAPI void *MemAlloc(unsigned int size);                          // Allocate memory with raylib memory allocator
+RLAPI void *MemCalloc(unsigned int count, unsigned int size);     // Allocate memory initialized to zero with raylib memory allocator
+RLAPI void *MemRealloc(void *ptr, unsigned int size);             // Reallocate memory allocated with raylib memory allocator
+RLAPI void MemFree(void *ptr);                                    // Free memory allocated with raylib memory allocator
+RLAPI void *MemAllocScratch(unsigned int size);                   // Allocate scratch memory, released at the end of the frame (EndDrawing()), main thread only
+RLAPI void *MemAllocTagged(unsigned int size, int tag);           // Allocate memory accounted to a subsystem (MemoryTag)
+RLAPI void *MemCallocTagged(unsigned int count, unsigned int size, int tag); // Allocate memory initialized to zero accounted to a subsystem (MemoryTag)
+RLAPI void *MemReallocTagged(void *ptr, unsigned int size, int tag);    // Reallocate memory, new allocations accounted to a subsystem (MemoryTag)
+RLAPI MemoryStats GetMemoryStats(void);                           // Get memory usage statistics, current and peak by subsystem, GPU memory estimated
 
 // Files management functions
 RLAPI bool FileExists(const char *fileName);                      // Check if file exists
@@ -958,20 +1513,46 @@ RLAPI const char *GetFileNameWithoutExt(const char *filePath);    // Get filenam
 RLAPI const char *GetDirectoryPath(const char *filePath);         // Get full path for a given fileName with path (uses static string)
 RLAPI const char *GetPrevDirectoryPath(const char *dirPath);      // Get previous directory path for a given path (uses static string)
 RLAPI const char *GetWorkingDirectory(void);                      // Get current working directory (uses static string)
-RLAPI char **GetDirectoryFiles(const char *dirPath, int *count);  // Get filenames in a directory path (memory should be freed)
+RLAPI char **GetDirectoryFiles(const char *dirPath, int *count);  // Get filenames in a directory path (memory should be freed with ClearDirectoryFiles())
 RLAPI void ClearDirectoryFiles(void);                             // Clear directory files paths buffers (free memory)
+RLAPI Directory OpenDirectory(const char *dirPath, const char *filter, bool recursive); // Open directory to read entries, filter files by extensions (i.e. ".png;.jpg", NULL for all)
+RLAPI bool ReadDirectoryEntry(Directory dir, DirectoryEntry *entry); // Read next directory entry, returns false when no more entries
+RLAPI void CloseDirectory(Directory dir);                         // Close directory opened for reading entries
 RLAPI bool ChangeDirectory(const char *dir);                      // Change working directory, returns true if success
 RLAPI bool IsFileDropped(void);                                   // Check if a file has been dropped into window
 RLAPI char **GetDroppedFiles(int *count);                         // Get dropped files names (memory should be freed)
 RLAPI void ClearDroppedFiles(void);                               // Clear dropped files paths buffer (free memory)
 RLAPI long GetFileModTime(const char *fileName);                  // Get file modification time (last write time)
+RLAPI bool MountPackFile(const char *fileName, const char *mountPath);  // Mount pack file, packed files are read by file loaders at mount path (read-only)
+RLAPI void UnmountPackFile(const char *fileName);                 // Unmount pack file (NULL: last mounted)
+RLAPI int WatchFile(const char *path);                            // Watch file or directory changes, returns watch id (0 if failed)
+RLAPI void UnwatchFile(int watch);                                // Stop watching file or directory changes
+RLAPI bool GetFileChangeEvent(FileChangeEvent *event);            // Get next file change queued on PollInputEvents(), returns false if none
+RLAPI void LoadFileDataAsync(const char *fileName, LoadFileDataCallback callback, void *userData); // Load file data on a worker thread, callback called on PollInputEvents() when read
+RLAPI int GetFileDataAsyncPending(void);                          // Get number of files requested asynchronously not delivered yet
+RLAPI void UnloadFileData(unsigned char *data);                   // Unload file data loaded asynchronously
 
 RLAPI unsigned char *CompressData(unsigned char *data, int dataLength, int *compDataLength);        // Compress data (DEFLATE algorythm)
 RLAPI unsigned char *DecompressData(unsigned char *compData, int compDataLength, int *dataLength);  // Decompress data (DEFLATE algorythm)
+RLAPI int GetCompressDataBound(int dataLength, int codec);                                          // Get compressed data max size, output buffer size always enough
+RLAPI int CompressDataEx(const unsigned char *data, int dataLength, unsigned char *compData, int compDataCapacity, int codec); // Compress data into provided buffer, returns compressed size (0 if failed)
+RLAPI int DecompressDataEx(const unsigned char *compData, int compDataLength, unsigned char *data, int dataCapacity, int codec); // Decompress data into provided buffer, returns data size (-1 if failed)
+RLAPI CompressStream LoadCompressStream(int codec, bool decompress);                                // Load compression stream (data compressed or decompressed by blocks)
+RLAPI void UnloadCompressStream(CompressStream stream);                                             // Unload compression stream
+RLAPI bool UpdateCompressStream(CompressStream stream, const unsigned char *data, int dataLength);  // Feed data to compression stream, returns false on malformed compressed data
+RLAPI void FlushCompressStream(CompressStream stream);                                              // Compress data fed not compressed yet (partial block)
+RLAPI int ReadCompressStream(CompressStream stream, unsigned char *buffer, int bufferSize);         // Read compression stream output available, returns bytes read
 
 // Persistent storage management
-RLAPI void StorageSaveValue(int position, int value);             // Save integer value to storage file (to defined position)
-RLAPI int StorageLoadValue(int position);                         // Load integer value from storage file (from defined position)
+RLAPI void StorageSaveValue(int position, int value);             // Save integer value to storage (to defined position)
+RLAPI int StorageLoadValue(int position);                         // Load integer value from storage (from defined position)
+RLAPI void StorageSaveInt(const char *key, int value);            // Save integer value to storage (keyed)
+RLAPI int StorageLoadInt(const char *key, int defaultValue);      // Load integer value from storage (keyed), default value if not found
+RLAPI void StorageSaveFloat(const char *key, float value);        // Save float value to storage (keyed)
+RLAPI float StorageLoadFloat(const char *key, float defaultValue); // Load float value from storage (keyed), default value if not found
+RLAPI void StorageSaveString(const char *key, const char *text);  // Save string value to storage (keyed)
+RLAPI const char *StorageLoadString(const char *key, const char *defaultValue); // Load string value from storage (keyed), default value if not found
+RLAPI bool StorageFlush(void);                                    // Write storage values modified to storage file (atomic, also on CloseWindow())
 
 RLAPI void OpenURL(const char *url);                              // Open URL with default system browser (if available)
 
@@ -986,6 +1567,9 @@ RLAPI bool IsKeyReleased(int key);                            // Detect if a key
 RLAPI bool IsKeyUp(int key);                                  // Detect if a key is NOT being pressed
 RLAPI void SetExitKey(int key);                               // Set a custom key to exit program (default is ESC)
 RLAPI int GetKeyPressed(void);                                // Get key pressed, call it multiple times for chars queued
+RLAPI bool GetInputEvent(InputEvent *event);                  // Get next queued input event (key, mouse, gamepad, touch), false if queue empty
+RLAPI void ClearInputEvents(void);                            // Clear queued input events
+RLAPI int GetInputEventsDropped(void);                        // Get input events dropped on full queue (counter is reset)
 
 // Input-related functions: gamepads
 RLAPI bool IsGamepadAvailable(int gamepad);                   // Detect if a gamepad is available
@@ -1030,6 +1614,7 @@ RLAPI Vector2 GetGestureDragVector(void);                     // Get gesture dra
 RLAPI float GetGestureDragAngle(void);                        // Get gesture drag angle
 RLAPI Vector2 GetGesturePinchVector(void);                    // Get gesture pinch delta
 RLAPI float GetGesturePinchAngle(void);                       // Get gesture pinch angle
+RLAPI Vector2 GetGestureMultiDragVector(void);                // Get gesture multi points drag vector (3 or more touch points)
 
 //------------------------------------------------------------------------------------
 // Camera System Functions (Module: camera)
@@ -1049,11 +1634,14 @@ RLAPI void SetCameraMoveControls(int frontKey, int backKey, int rightKey, int le
 // Basic shapes drawing functions
 RLAPI void DrawPixel(int posX, int posY, Color color);                                                   // Draw a pixel
 RLAPI void DrawPixelV(Vector2 position, Color color);                                                    // Draw a pixel (Vector version)
+RLAPI void DrawPixels(const Vector2 *points, const Color *colors, int count);                            // Draw multiple pixels in one call (colors optional)
+RLAPI void DrawPointSprites(Texture2D texture, const Vector2 *positions, const Color *colors, int count, float size); // Draw multiple point sprites, size in pixels (colors optional)
 RLAPI void DrawLine(int startPosX, int startPosY, int endPosX, int endPosY, Color color);                // Draw a line
 RLAPI void DrawLineV(Vector2 startPos, Vector2 endPos, Color color);                                     // Draw a line (Vector version)
 RLAPI void DrawLineEx(Vector2 startPos, Vector2 endPos, float thick, Color color);                       // Draw a line defining thickness
 RLAPI void DrawLineBezier(Vector2 startPos, Vector2 endPos, float thick, Color color);                   // Draw a line using cubic-bezier curves in-out
 RLAPI void DrawLineStrip(Vector2 *points, int numPoints, Color color);                                   // Draw lines sequence
+RLAPI void DrawPolylineEx(const Vector2 *points, int pointsCount, float thick, int joinType, int capType, Color color); // Draw lines sequence with thickness, joins and caps (LineJoinType, LineCapType)
 RLAPI void DrawCircle(int centerX, int centerY, float radius, Color color);                              // Draw a color-filled circle
 RLAPI void DrawCircleSector(Vector2 center, float radius, int startAngle, int endAngle, int segments, Color color);     // Draw a piece of a circle
 RLAPI void DrawCircleSectorLines(Vector2 center, float radius, int startAngle, int endAngle, int segments, Color color);    // Draw circle sector outline
@@ -1079,18 +1667,37 @@ RLAPI void DrawTriangleFan(Vector2 *points, int numPoints, Color color);
 RLAPI void DrawTriangleStrip(Vector2 *points, int pointsCount, Color color);                             // Draw a triangle strip defined by points
 RLAPI void DrawPoly(Vector2 center, int sides, float radius, float rotation, Color color);               // Draw a regular polygon (Vector version)
 RLAPI void DrawPolyLines(Vector2 center, int sides, float radius, float rotation, Color color);          // Draw a polygon outline of n sides
+RLAPI int *LoadPolygonTriangles(const Vector2 *points, int pointsCount, const int *holes, int holesCount, int *trianglesCount); // Load concave polygon with holes triangles indices (ear clipping)
+RLAPI void UnloadPolygonTriangles(int *indices);                                                        // Unload polygon triangles indices loaded with LoadPolygonTriangles()
+RLAPI void DrawPolygonTriangles(const Vector2 *points, const int *indices, int trianglesCount, Color color);    // Draw polygon triangles (indexed points)
 
 RLAPI void SetShapesTexture(Texture2D texture, Rectangle source);                                        // Define default texture used to draw shapes
+RLAPI void SetShapesRenderMode(int mode);                                                                // Define shapes render mode (ShapesRenderMode)
+RLAPI void SetShapesTessellationError(float maxError);                                                   // Define max error (in pixels) for automatic curve segments (segments < 4)
 
 // Basic shapes collision detection functions
 RLAPI bool CheckCollisionRecs(Rectangle rec1, Rectangle rec2);                                           // Check collision between two rectangles
 RLAPI bool CheckCollisionCircles(Vector2 center1, float radius1, Vector2 center2, float radius2);        // Check collision between two circles
+RLAPI int CheckCollisionRecsBatch(Rectangle rec, RectangleSet recs, unsigned int *hitMask, int *hitIndices);    // Check collision between rectangle and rectangles set, returns hits count
+RLAPI int CheckCollisionCirclesBatch(Vector2 center, float radius, CircleSet circles, unsigned int *hitMask, int *hitIndices);  // Check collision between circle and circles set, returns hits count
 RLAPI bool CheckCollisionCircleRec(Vector2 center, float radius, Rectangle rec);                         // Check collision between circle and rectangle
 RLAPI Rectangle GetCollisionRec(Rectangle rec1, Rectangle rec2);                                         // Get collision rectangle for two rectangles collision
 RLAPI bool CheckCollisionPointRec(Vector2 point, Rectangle rec);                                         // Check if point is inside rectangle
 RLAPI bool CheckCollisionPointCircle(Vector2 point, Vector2 center, float radius);                       // Check if point is inside circle
 RLAPI bool CheckCollisionPointTriangle(Vector2 point, Vector2 p1, Vector2 p2, Vector2 p3);               // Check if point is inside a triangle
 
+// Spatial grid functions (broadphase collision queries for many rectangles and circles)
+RLAPI SpatialGrid LoadSpatialGrid(float cellSize);                                                       // Load spatial grid (hashed uniform grid) for rectangles and circles
+RLAPI void UnloadSpatialGrid(SpatialGrid grid);                                                          // Unload spatial grid data
+RLAPI int AddSpatialGridRec(SpatialGrid *grid, Rectangle rec, int userId);                               // Add rectangle entry to spatial grid, returns entry id
+RLAPI int AddSpatialGridCircle(SpatialGrid *grid, Vector2 center, float radius, int userId);             // Add circle entry to spatial grid, returns entry id
+RLAPI bool UpdateSpatialGridRec(SpatialGrid *grid, int entry, Rectangle rec);                            // Update spatial grid rectangle entry, returns true if entry moved to other cells
+RLAPI bool UpdateSpatialGridCircle(SpatialGrid *grid, int entry, Vector2 center, float radius);          // Update spatial grid circle entry, returns true if entry moved to other cells
+RLAPI void RemoveSpatialGridEntry(SpatialGrid *grid, int entry);                                         // Remove entry from spatial grid
+RLAPI int QuerySpatialGridRec(SpatialGrid grid, Rectangle rec, int *userIds, int maxCount);              // Get entries overlapping rectangle
+RLAPI int QuerySpatialGridCircle(SpatialGrid grid, Vector2 center, float radius, int *userIds, int maxCount); // Get entries overlapping circle
+RLAPI int QuerySpatialGridPairs(SpatialGrid grid, int *userIdPairs, int maxPairs);                       // Get overlapping entries pairs
+
 //------------------------------------------------------------------------------------
 // Texture Loading and Drawing Functions (Module: textures)
 //------------------------------------------------------------------------------------
@@ -1100,22 +1707,59 @@ RLAPI Image LoadImage(const char *fileName);
 RLAPI Image LoadImageEx(Color *pixels, int width, int height);                                           // Load image from Color array data (RGBA - 32bit)
 RLAPI Image LoadImagePro(void *data, int width, int height, int format);                                 // Load image from raw data with parameters
 RLAPI Image LoadImageRaw(const char *fileName, int width, int height, int format, int headerSize);       // Load image from RAW file data
+RLAPI Image LoadImageMapped(const char *fileName);                                                       // Load image from file, GPU compressed data is memory-mapped (not copied)
+RLAPI void LoadImagesAsync(const char **fileNames, int count, LoadImageCallback callback, void *userData); // Load images on worker threads, callback called on EndDrawing() for every image loaded
+RLAPI int GetImagesAsyncPending(void);                                                                   // Get number of images requested asynchronously not delivered yet
+RLAPI TiledImage LoadTiledImage(const char *fileName);                                                   // Load tiled image from file (uncompressed KTX), pixels read by tiles on demand
+RLAPI TiledImage LoadTiledImageRaw(const char *fileName, int width, int height, int format, int headerSize); // Load tiled image from RAW file data
+RLAPI void UnloadTiledImage(TiledImage image);                                                           // Unload tiled image (cached tiles and file)
+RLAPI Image GetTiledImageRegion(TiledImage image, Rectangle rec);                                        // Get image region from tiled image, only overlapping tiles are loaded
+RLAPI bool ExportTiledImageMipmaps(TiledImage image, const char *fileName);                              // Export tiled image with full mipmaps chain to KTX file (bounded memory)
 RLAPI void ExportImage(Image image, const char *fileName);                                               // Export image data to file
+RLAPI void SetImageExportFast(bool fast);                                                                // Set fast PNG export (single filter and fast compression, bigger files)
 RLAPI void ExportImageAsCode(Image image, const char *fileName);                                         // Export image as code file defining an array of bytes
 RLAPI Texture2D LoadTexture(const char *fileName);                                                       // Load texture from file into GPU memory (VRAM)
+RLAPI Texture2D LoadTextureCached(const char *fileName);                                                 // Load texture from file shared with previous loads (cached, reference counted)
+RLAPI Texture2D LoadTextureProgressive(const char *fileName);                                            // Load texture from file uploading smallest mipmaps first, larger mipmaps uploaded on next frames
 RLAPI Texture2D LoadTextureFromImage(Image image);                                                       // Load texture from image data
 RLAPI TextureCubemap LoadTextureCubemap(Image image, int layoutType);                                    // Load cubemap from image, multiple image cubemap layouts supported
+RLAPI Texture2D LoadTextureArray(Image *layers, int count);                                              // Load texture array from images (same size and format), one layer per image
 RLAPI RenderTexture2D LoadRenderTexture(int width, int height);                                          // Load texture for rendering (framebuffer)
 RLAPI void UnloadImage(Image image);                                                                     // Unload image from CPU memory (RAM)
 RLAPI void UnloadTexture(Texture2D texture);                                                             // Unload texture from GPU memory (VRAM)
+RLAPI void UnloadTextureCached(Texture2D texture);                                                       // Release cached texture, unloaded with last reference
 RLAPI void UnloadRenderTexture(RenderTexture2D target);                                                  // Unload render texture from GPU memory (VRAM)
+RLAPI RenderTexture2D GetPooledRenderTexture(int width, int height);                                     // Get a transient render texture from pool, reused by size (no unloading required)
+RLAPI void ReleasePooledRenderTexture(RenderTexture2D target);                                           // Return a transient render texture to pool
+RLAPI VirtualTexture LoadVirtualTexture(const char *fileName, int cacheSize);                            // Load virtual texture from tiled KTX file, pages cache of cacheSize*cacheSize pages
+RLAPI void UnloadVirtualTexture(VirtualTexture vt);                                                      // Unload virtual texture (GPU textures, shaders and file)
+RLAPI void BeginVirtualTextureFeedback(VirtualTexture vt);                                               // Begin feedback pass, draw virtual textured models with vt.feedbackShader
+RLAPI void EndVirtualTextureFeedback(VirtualTexture vt);                                                 // End feedback pass, visible pages not resident are requested
+RLAPI void UpdateVirtualTexture(VirtualTexture vt);                                                      // Update virtual texture, pages loaded are uploaded and next pages requested are loaded asynchronously
+RLAPI void SetMaterialVirtualTexture(Material *material, VirtualTexture vt);                             // Set material shader and maps to sample virtual texture
+RLAPI PostProcess LoadPostProcess(int width, int height);                                                // Load post-processing chain (scene render target of given size)
+RLAPI void UnloadPostProcess(PostProcess post);                                                          // Unload post-processing chain (render target and generated shaders)
+RLAPI int AddPostEffect(PostProcess post, const char *fsCode);                                           // Add per-pixel effect, GLSL code defines: vec4 effect(vec4 color, vec2 texCoord)
+RLAPI int AddPostEffectShader(PostProcess post, Shader shader);                                          // Add full pass effect shader (i.e. neighbour texels sampling), never merged
+RLAPI void SetPostEffectValue(PostProcess post, int effect, const char *uniformName, const void *value, int uniformType); // Set effect shader uniform value
+RLAPI void DrawPostProcess(PostProcess post);                                                            // Draw scene render target through effects chain, last pass draws to current framebuffer
 RLAPI Color *GetImageData(Image image);                                                                  // Get pixel data from image as a Color struct array
 RLAPI Vector4 *GetImageDataNormalized(Image image);                                                      // Get pixel data from image as Vector4 array (float normalized)
 RLAPI Rectangle GetImageAlphaBorder(Image image, float threshold);                                       // Get image alpha border rectangle
 RLAPI int GetPixelDataSize(int width, int height, int format);                                           // Get pixel data size in bytes (image or texture)
 RLAPI Image GetTextureData(Texture2D texture);                                                           // Get pixel data from GPU texture and return an Image
+RLAPI bool GetTextureDataEx(Texture2D texture, Image *image);                                            // Get pixel data from GPU texture into an existing Image (data reused if size and format match)
 RLAPI Image GetScreenData(void);                                                                         // Get pixel data from screen buffer and return an Image (screenshot)
+RLAPI unsigned int RequestRenderTextureData(RenderTexture2D target);                                     // Request render texture pixel data reading without waiting for GPU, returns request id (0 if not available)
+RLAPI Image GetRenderTextureDataAsync(RenderTexture2D target, unsigned int requestId, bool wait);        // Get requested render texture pixel data (image data NULL if not ready yet)
 RLAPI void UpdateTexture(Texture2D texture, const void *pixels);                                         // Update GPU texture with new data
+RLAPI void UpdateTextureAsync(Texture2D texture, const void *pixels);                                    // Update GPU texture with new data, GPU copy is not waited (pixels can be reused on return)
+RLAPI bool IsTextureUpdated(Texture2D texture);                                                          // Check if texture asynchronous updates are completed
+RLAPI void SetTextureMemoryBudget(unsigned int bytes);                                                   // Set textures VRAM budget, least recently used textures loaded from file are evicted (0: no budget)
+RLAPI unsigned int GetTextureMemoryUsage(void);                                                          // Get VRAM used by loaded textures (resident data)
+RLAPI bool IsTextureResident(Texture2D texture);                                                         // Check if texture data is in VRAM (not evicted)
+RLAPI void SetTextureUploadBudget(unsigned int bytes);                                                   // Set bytes uploaded per frame by progressive textures (LoadTextureProgressive()), 0: no limit
+RLAPI bool IsTextureComplete(Texture2D texture);                                                         // Check if texture all mipmap levels are uploaded (LoadTextureProgressive())
 
 // Image manipulation functions
 RLAPI Image ImageCopy(Image image);                                                                      // Create an image duplicate (useful for transformations)
@@ -1133,6 +1777,7 @@ RLAPI void ImageResizeCanvas(Image *image, int newWidth, int newHeight, int offs
 RLAPI void ImageMipmaps(Image *image);                                                                   // Generate all mipmap levels for a provided image
 RLAPI void ImageDither(Image *image, int rBpp, int gBpp, int bBpp, int aBpp);                            // Dither image data to 16bpp or lower (Floyd-Steinberg dithering)
 RLAPI Color *ImageExtractPalette(Image image, int maxPaletteSize, int *extractCount);                    // Extract color palette from image to maximum size (memory should be freed)
+RLAPI Color *ImageQuantizePalette(Image image, int maxPaletteSize, int *colorsCount);                   // Quantize image colors to palette of maximum size, median cut (memory should be freed)
 RLAPI Image ImageText(const char *text, int fontSize, Color color);                                      // Create an image from text (default font)
 RLAPI Image ImageTextEx(Font font, const char *text, float fontSize, float spacing, Color tint);         // Create an image from text (custom sprite font)
 RLAPI void ImageDraw(Image *dst, Image src, Rectangle srcRec, Rectangle dstRec, Color tint);             // Draw a source image within a destination image (tint applied to source)
@@ -1173,6 +1818,7 @@ RLAPI void DrawTextureEx(Texture2D texture, Vector2 position, float rotation, fl
 RLAPI void DrawTextureRec(Texture2D texture, Rectangle sourceRec, Vector2 position, Color tint);         // Draw a part of a texture defined by a rectangle
 RLAPI void DrawTextureQuad(Texture2D texture, Vector2 tiling, Vector2 offset, Rectangle quad, Color tint);  // Draw texture quad with tiling and offset parameters
 RLAPI void DrawTexturePro(Texture2D texture, Rectangle sourceRec, Rectangle destRec, Vector2 origin, float rotation, Color tint);       // Draw a part of a texture defined by a rectangle with 'pro' parameters
+RLAPI void DrawTextureLayer(Texture2D texture, int layer, Rectangle sourceRec, Rectangle destRec, Vector2 origin, float rotation, Color tint);  // Draw a part of a texture array layer with 'pro' parameters
 RLAPI void DrawTextureNPatch(Texture2D texture, NPatchInfo nPatchInfo, Rectangle destRec, Vector2 origin, float rotation, Color tint);  // Draws a texture (or part of it) that stretches or shrinks nicely
 
 //------------------------------------------------------------------------------------
@@ -1182,20 +1828,34 @@ RLAPI void DrawTextureNPatch(Texture2D texture, NPatchInfo nPatchInfo, Rectangle
 // Font loading/unloading functions
 RLAPI Font GetFontDefault(void);                                                            // Get the default Font
 RLAPI Font LoadFont(const char *fileName);                                                  // Load font from file into GPU memory (VRAM)
+RLAPI Font LoadFontCached(const char *fileName);                                            // Load font from file shared with previous loads (cached, reference counted)
 RLAPI Font LoadFontEx(const char *fileName, int fontSize, int *fontChars, int charsCount);  // Load font from file with extended parameters
+RLAPI Font LoadFontDynamic(const char *fileName, int fontSize, int atlasSize);              // Load font from TTF file, glyphs rasterized on first use into a dynamic atlas
+RLAPI Font LoadFontMsdf(const char *fileName, int fontSize, int *fontChars, int charsCount); // Load font from TTF file with MSDF glyphs (sharp at any size, cached if cache directory set)
+RLAPI void SetFontCacheDirectory(const char *dirPath);                                      // Set generated fonts cache directory (NULL to disable)
+RLAPI Shader LoadShaderMsdf(void);                                                          // Load MSDF fonts rendering shader (unload with UnloadShader())
 RLAPI Font LoadFontFromImage(Image image, Color key, int firstChar);                        // Load font from Image (XNA style)
+RLAPI Font LoadFontBinary(const char *fileName);                                            // Load font from binary file (atlas and metrics, no rasterization)
+RLAPI bool ExportFontBinary(Font font, const char *fileName);                               // Export font as binary file (atlas and metrics)
 RLAPI CharInfo *LoadFontData(const char *fileName, int fontSize, int *fontChars, int charsCount, int type); // Load font data for further use
 RLAPI Image GenImageFontAtlas(const CharInfo *chars, Rectangle **recs, int charsCount, int fontSize, int padding, int packMethod);  // Generate image font atlas using chars info
 RLAPI void UnloadFont(Font font);                                                           // Unload Font from GPU memory (VRAM)
+RLAPI void UnloadFontCached(Font font);                                                     // Release cached font, unloaded with last reference
 
 // Text drawing functions
 RLAPI void DrawFPS(int posX, int posY);                                                     // Shows current FPS
+RLAPI void DrawProfiler(int posX, int posY);                                                // Shows CPU profile zones of last frame (EnableProfiler())
 RLAPI void DrawText(const char *text, int posX, int posY, int fontSize, Color color);       // Draw text (using default font)
 RLAPI void DrawTextEx(Font font, const char *text, Vector2 position, float fontSize, float spacing, Color tint);                // Draw text using font and additional parameters
 RLAPI void DrawTextRec(Font font, const char *text, Rectangle rec, float fontSize, float spacing, bool wordWrap, Color tint);   // Draw text using font inside rectangle limits
 RLAPI void DrawTextRecEx(Font font, const char *text, Rectangle rec, float fontSize, float spacing, bool wordWrap, Color tint,
                          int selectStart, int selectLength, Color selectTint, Color selectBackTint); // Draw text using font inside rectangle limits with support for text selection
 RLAPI void DrawTextCodepoint(Font font, int codepoint, Vector2 position, float scale, Color tint);   // Draw one character (codepoint)
+RLAPI RenderTexture2D LoadRenderTextureText(Font font, const char *text, float fontSize, float spacing, Color tint);  // Load render texture with text drawn on GPU (no CPU pixels, see RequestRenderTextureData())
+RLAPI TextLayout CreateTextLayout(Font font, const char *text, float fontSize, float spacing);  // Create text layout (glyph quads generated once)
+RLAPI void UpdateTextLayout(TextLayout *layout, const char *text);                          // Update text layout, regenerated only if text changes
+RLAPI void UnloadTextLayout(TextLayout layout);                                             // Unload text layout data
+RLAPI void DrawTextLayout(TextLayout layout, Vector2 position, Color tint);                 // Draw text layout (glyph quads copied into render batch)
 
 // Text misc. functions
 RLAPI int MeasureText(const char *text, int fontSize);                                      // Measure string width for default font
@@ -1204,6 +1864,7 @@ RLAPI int GetGlyphIndex(Font font, int codepoint);
 
 // Text strings management functions (no utf8 strings, only byte chars)
 // NOTE: Some strings allocate memory internally for returned strings, just be careful!
+// NOTE: Returned static strings are kept per thread (thread-local buffers)
 RLAPI bool TextIsEqual(const char *text1, const char *text2);                               // Check if two text string are equal
 RLAPI unsigned int TextLength(const char *text);                                            // Get text length, checks for '\0' ending
 RLAPI const char *TextFormat(const char *text, ...);                                        // Text formatting with variables (sprintf style)
@@ -1220,8 +1881,23 @@ RLAPI const char *TextToPascal(const char *text);                     // Get Pas
 RLAPI int TextToInteger(const char *text);                            // Get integer value from text (negative values not supported)
 RLAPI char *TextToUtf8(int *codepoints, int length);                  // Encode text codepoint into utf8 text (memory must be freed!)
 
+// Text strings management functions writing into provided buffers (no memory allocated, no static buffers)
+// NOTE: bufferSize includes '\0' ending, results are truncated to fit provided buffer
+RLAPI char *TextFormatEx(char *buffer, int bufferSize, const char *text, ...);                                  // Text formatting with variables into buffer
+RLAPI char *TextSubtextEx(char *buffer, int bufferSize, const char *text, int position, int length);            // Get a piece of a text string into buffer
+RLAPI char *TextReplaceEx(char *buffer, int bufferSize, const char *text, const char *replace, const char *by); // Replace text string into buffer
+RLAPI char *TextInsertEx(char *buffer, int bufferSize, const char *text, const char *insert, int position);     // Insert text in a position into buffer
+RLAPI char *TextJoinEx(char *buffer, int bufferSize, const char **textList, int count, const char *delimiter);  // Join text strings with delimiter into buffer
+RLAPI int TextSplitEx(char *buffer, int bufferSize, const char **result, int maxCount, const char *text, char delimiter);  // Split text into buffer, returns number of strings
+RLAPI void TextAppendEx(char *buffer, int bufferSize, int *position, const char *append, int length);          // Append text bytes at position and move cursor (no '\0' added)
+RLAPI char *TextToUpperEx(char *buffer, int bufferSize, const char *text);                                      // Get upper case version of string into buffer
+RLAPI char *TextToLowerEx(char *buffer, int bufferSize, const char *text);                                      // Get lower case version of string into buffer
+
 // UTF8 text strings management functions
 RLAPI int *GetCodepoints(const char *text, int *count);               // Get all codepoints in a string, codepoints count returned by parameters
+RLAPI int GetCodepointsEx(const char *text, int *codepoints, int maxCount);    // Get all codepoints in a string into provided array (up to maxCount), returns codepoints count
+RLAPI int *LoadCodepoints(const char *text, int *count);              // Load all codepoints in a string, no length limit (memory must be freed!)
+RLAPI void UnloadCodepoints(int *codepoints);                         // Unload codepoints data loaded with LoadCodepoints()
 RLAPI int GetCodepointsCount(const char *text);                       // Get total number of characters (codepoints) in a UTF8 encoded string
 RLAPI int GetNextCodepoint(const char *text, int *bytesProcessed);    // Returns next codepoint in a UTF8 encoded string; 0x3f('?') is returned on failure
 RLAPI const char *CodepointToUtf8(int codepoint, int *byteLength);    // Encode codepoint into utf8 text (char array length returned as parameter)
@@ -1255,13 +1931,20 @@ RLAPI void DrawGizmo(Vector3 position);
 
 // Model loading/unloading functions
 RLAPI Model LoadModel(const char *fileName);                                                            // Load model from files (meshes and materials)
+RLAPI Model LoadModelCached(const char *fileName);                                                      // Load model from files shared with previous loads (cached, reference counted)
 RLAPI Model LoadModelFromMesh(Mesh mesh);                                                               // Load model from generated mesh (default material)
 RLAPI void UnloadModel(Model model);                                                                    // Unload model from memory (RAM and/or VRAM)
+RLAPI void UnloadModelCached(Model model);                                                              // Release cached model, unloaded with last reference
+RLAPI void SetModelKeepMeshData(bool keep);                                                             // Set glTF and rlmesh meshes data kept in RAM (CPU) after GPU upload (disabled by default)
+RLAPI void SetModelMeshFormat(int formats);                                                             // Set loaded models meshes vertex attributes GPU storage formats (MeshVertexFormat flags)
+RLAPI void ExportModel(Model model, const char *fileName, bool compressed);                             // Export model meshes and materials to file (.rlmesh), optionally LZ4 compressed
+RLAPI void GenModelLODs(Model *model, int levels, float ratio);                                         // Generate model level of detail chain, every level keeps ratio of previous level triangles
 
 // Mesh loading/unloading functions
 RLAPI Mesh *LoadMeshes(const char *fileName, int *meshCount);                                           // Load meshes from model file
 RLAPI void ExportMesh(Mesh mesh, const char *fileName);                                                 // Export mesh data to file
 RLAPI void UnloadMesh(Mesh mesh);                                                                       // Unload mesh from memory (RAM and/or VRAM)
+RLAPI void UnloadMeshCPUData(Mesh *mesh, bool keepCollision);                                          // Unload mesh vertex data from RAM (CPU), bounds and optionally collision BVH are kept
 
 // Material loading/unloading functions
 RLAPI Material *LoadMaterials(const char *fileName, int *materialCount);                                // Load materials from model file
@@ -1273,6 +1956,15 @@ RLAPI void SetModelMeshMaterial(Model *model, int meshId, int materialId);
 // Model animations loading/unloading functions
 RLAPI ModelAnimation *LoadModelAnimations(const char *fileName, int *animsCount);                       // Load model animations from file
 RLAPI void UpdateModelAnimation(Model model, ModelAnimation anim, int frame);                           // Update model animation pose
+RLAPI void UpdateModelsAnimation(const Model *models, const ModelAnimation *anims, const int *frames, int count); // Update multiple models animation poses (skinned on worker threads)
+RLAPI void UpdateModelAnimationBones(Model model, ModelAnimation anim, int frame);                      // Update model animation bones matrices (GPU skinning, CPU skinned if not supported)
+RLAPI void GetModelAnimationPose(ModelAnimation anim, float time, bool loop, Transform *pose);          // Get model animation pose at time (seconds), keyframes interpolated
+RLAPI void BlendModelAnimationPoses(const Transform *pose1, const Transform *pose2, int boneCount, float blend, Transform *result);    // Blend two animation poses (cross-fade)
+RLAPI void AddModelAnimationPose(const Transform *pose, const Transform *additive, const Transform *reference, int boneCount, float weight, Transform *result);  // Add animation layer to pose (additive difference from reference)
+RLAPI void GetModelPoseBones(Model model, const Transform *pose, int boneCount, Matrix *boneMatrices);  // Get model bones matrices (bone palette) for an animation pose
+RLAPI void UpdateModelPose(Model model, const Transform *pose, int boneCount);                          // Update model animated vertex data for an animation pose (CPU skinning)
+RLAPI void UpdateModelPoseBones(Model model, const Transform *pose, int boneCount);                     // Update model bones matrices for an animation pose (GPU skinning, CPU skinned if not supported)
+RLAPI bool CompressModelAnimation(ModelAnimation *anim, float tolerance);                               // Compress animation data (keyframes reduced within tolerance and quantized)
 RLAPI void UnloadModelAnimation(ModelAnimation anim);                                                   // Unload animation data
 RLAPI bool IsModelAnimationValid(Model model, ModelAnimation anim);                                     // Check model animation skeleton match
 
@@ -1287,20 +1979,68 @@ RLAPI Mesh GenMeshTorus(float radius, float size, int radSeg, int sides);
 RLAPI Mesh GenMeshKnot(float radius, float size, int radSeg, int sides);                                // Generate trefoil knot mesh
 RLAPI Mesh GenMeshHeightmap(Image heightmap, Vector3 size);                                             // Generate heightmap mesh from image data
 RLAPI Mesh GenMeshCubicmap(Image cubicmap, Vector3 cubeSize);                                           // Generate cubes-based map mesh from image data
+RLAPI Mesh GenMeshCubicmapGreedy(Image cubicmap, Vector3 cubeSize);                                     // Generate cubes-based map mesh from image data, coplanar faces merged (indexed)
+RLAPI Mesh GenMeshCached(int shape, float radius, float size, int segments, int sides);                  // Generate procedural mesh (MeshShapeType), shared by identical shape parameters
+RLAPI void UnloadMeshCached(Mesh mesh);                                                                 // Release procedural mesh from GenMeshCached(), unloaded with last reference
+
+// Terrain functions (heightmap chunks streamed around view)
+RLAPI Terrain LoadTerrain(TiledImage heightmap, Vector3 size, int chunkCells);                           // Load terrain from tiled heightmap, chunks streamed around view (UpdateTerrain())
+RLAPI void UnloadTerrain(Terrain terrain);                                                              // Unload terrain chunks data (heightmap is not unloaded)
+RLAPI void UpdateTerrain(Terrain terrain, Vector3 viewPosition);                                        // Update terrain chunks LOD and streaming around view position (chunks loaded asynchronously)
+RLAPI void DrawTerrain(Terrain terrain, Color tint);                                                    // Draw terrain resident chunks inside view frustum
+RLAPI float GetTerrainHeight(Terrain terrain, float x, float z);                                        // Get terrain height at world position (resident chunks only)
+
+// Heightfield functions (heightmap mesh ray and height queries, no triangles tested outside ray path)
+RLAPI Heightfield LoadHeightfield(Image heightmap, Vector3 size);                                       // Load heightfield from image data, matches GenMeshHeightmap() mesh surface
+RLAPI void UnloadHeightfield(Heightfield heightfield);                                                  // Unload heightfield heights and hierarchy
+RLAPI float GetHeightfieldHeight(Heightfield heightfield, float x, float z);                            // Get heightfield height at world position (bilinear sampling)
+RLAPI RayHitInfo GetCollisionRayHeightfield(Ray ray, Heightfield heightfield);                          // Get collision info between ray and heightfield (min/max hierarchy traversal)
+
+// Cubicmap functions (cells grid meshed by chunks, cells editable)
+RLAPI Cubicmap LoadCubicmap(Image cubicmap, Vector3 cubeSize, int chunkSize);                           // Load cubicmap from image data, meshed by chunks (coplanar faces merged)
+RLAPI void UnloadCubicmap(Cubicmap cubicmap);                                                           // Unload cubicmap cells and chunks meshes
+RLAPI void SetCubicmapCell(Cubicmap cubicmap, int x, int z, int type);                                  // Set cubicmap cell type (CubicmapCellType), affected chunks rebuilt on next draw
+RLAPI int GetCubicmapCell(Cubicmap cubicmap, int x, int z);                                             // Get cubicmap cell type (CubicmapCellType)
+
+// Tile map functions (tiles grid uploaded by chunks, tiles editable)
+RLAPI TileMap LoadTileMap(Texture2D tileset, int tileWidth, int tileHeight, const int *tiles, int width, int height, int chunkSize);  // Load tile map from tiles indices (-1 for empty tile), uploaded by chunks
+RLAPI void UnloadTileMap(TileMap map);                                                                  // Unload tile map tiles and chunks meshes (tileset is not unloaded)
+RLAPI void SetTileMapTile(TileMap map, int x, int y, int tile);                                         // Set tile map tile index (-1 for empty tile), changed tiles uploaded on next draw
+RLAPI int GetTileMapTile(TileMap map, int x, int y);                                                    // Get tile map tile index (-1 for empty tile)
+RLAPI void DrawTileMap(TileMap map, Vector2 position, Color tint);                                      // Draw tile map chunks inside view (changed tiles uploaded first)
+
+// Static batch functions (static meshes instances merged by material)
+RLAPI StaticBatch LoadStaticBatch(void);                                                                // Load empty static batch, meshes instances are added and built before drawing
+RLAPI void UnloadStaticBatch(StaticBatch batch);                                                        // Unload static batch merged meshes (added meshes and materials are not unloaded)
+RLAPI void AddStaticBatchMesh(StaticBatch *batch, Mesh mesh, Material material, Matrix transform);      // Add mesh instance to static batch (mesh CPU data required until built)
+RLAPI void AddStaticBatchModel(StaticBatch *batch, Model model, Matrix transform);                      // Add model meshes instance to static batch (model transform applied first)
+RLAPI void BuildStaticBatch(StaticBatch *batch);                                                        // Merge added instances by material into world space meshes (uploaded to GPU)
+RLAPI void DrawStaticBatch(StaticBatch batch, Color tint);                                              // Draw static batch merged meshes inside view frustum
+RLAPI void DrawCubicmap(Cubicmap cubicmap, Color tint);                                                 // Draw cubicmap chunks inside view frustum (changed chunks rebuilt)
 
 // Mesh manipulation functions
 RLAPI BoundingBox MeshBoundingBox(Mesh mesh);                                                           // Compute mesh bounding box limits
 RLAPI void MeshTangents(Mesh *mesh);                                                                    // Compute mesh tangents
 RLAPI void MeshBinormals(Mesh *mesh);                                                                   // Compute mesh binormals
+RLAPI void MeshBuildBVH(Mesh *mesh);                                                                    // Build mesh bounding volume hierarchy (accelerates mesh collision queries)
+RLAPI void MeshOptimize(Mesh *mesh, int flags);                                                         // Optimize mesh data for GPU drawing: welding, vertex cache, overdraw and fetch reordering (MeshOptimizeFlags)
+RLAPI Mesh GenMeshSimplified(Mesh mesh, float ratio, float *error);                                     // Generate simplified mesh (quadric error edge collapse), ratio of triangles kept
 
 // Model drawing functions
 RLAPI void DrawModel(Model model, Vector3 position, float scale, Color tint);                           // Draw a model (with texture if set)
 RLAPI void DrawModelEx(Model model, Vector3 position, Vector3 rotationAxis, float rotationAngle, Vector3 scale, Color tint); // Draw a model with extended parameters
 RLAPI void DrawModelWires(Model model, Vector3 position, float scale, Color tint);                      // Draw a model wires (with texture if set)
 RLAPI void DrawModelWiresEx(Model model, Vector3 position, Vector3 rotationAxis, float rotationAngle, Vector3 scale, Color tint); // Draw a model wires (with texture if set) with extended parameters
+RLAPI void DrawMeshInstanced(Mesh mesh, Material material, const Matrix *transforms, int instances);    // Draw multiple mesh instances with material and different transforms
+RLAPI void SetModelCulling(bool enabled);                                                               // Set models frustum culling, meshes outside view are not drawn (enabled by default)
+RLAPI void SetModelLODThreshold(float pixels);                                                          // Set models LOD selection threshold, maximum simplification error on screen (1 pixel by default)
+RLAPI int GetVisibleInstances(Mesh mesh, const Matrix *transforms, int instances, Matrix *visibleTransforms);  // Get mesh instances inside view frustum, returns visible instances count
+RLAPI void BeginTransparentQueue(void);                                                                 // Begin transparent queue, models and billboards drawn sorted back-to-front on EndMode3D()
+RLAPI void EndTransparentQueue(void);                                                                   // End transparent queue, following draws are not deferred
 RLAPI void DrawBoundingBox(BoundingBox box, Color color);                                               // Draw bounding box (wires)
 RLAPI void DrawBillboard(Camera camera, Texture2D texture, Vector3 center, float size, Color tint);     // Draw a billboard texture
 RLAPI void DrawBillboardRec(Camera camera, Texture2D texture, Rectangle sourceRec, Vector3 center, float size, Color tint); // Draw a billboard texture defined by sourceRec
+RLAPI void DrawBillboardSet(Camera camera, Texture2D texture, BillboardSet billboards);                  // Draw a set of billboards texture (quads expanded on GPU, not sorted)
 
 // Collision detection functions
 RLAPI bool CheckCollisionSpheres(Vector3 centerA, float radiusA, Vector3 centerB, float radiusB);       // Detect collision between two spheres
@@ -1308,11 +2048,29 @@ RLAPI bool CheckCollisionBoxes(BoundingBox box1, BoundingBox box2);
 RLAPI bool CheckCollisionBoxSphere(BoundingBox box, Vector3 center, float radius);                      // Detect collision between box and sphere
 RLAPI bool CheckCollisionRaySphere(Ray ray, Vector3 center, float radius);                              // Detect collision between ray and sphere
 RLAPI bool CheckCollisionRaySphereEx(Ray ray, Vector3 center, float radius, Vector3 *collisionPoint);   // Detect collision between ray and sphere, returns collision point
+RLAPI int CheckCollisionRaySphereBatch(Ray ray, SphereSet spheres, unsigned int *hitMask, int *hitIndices);     // Detect collision between ray and spheres set, returns hits count
+RLAPI int CheckCollisionBoxesBatch(BoundingBox box, BoundingBoxSet boxes, unsigned int *hitMask, int *hitIndices);  // Detect collision between box and boxes set, returns hits count
 RLAPI bool CheckCollisionRayBox(Ray ray, BoundingBox box);                                              // Detect collision between ray and box
 RLAPI RayHitInfo GetCollisionRayModel(Ray ray, Model model);                                            // Get collision info between ray and model
+RLAPI RayHitInfo GetCollisionRayMesh(Ray ray, Mesh mesh, Matrix transform);                             // Get collision info between ray and mesh (nearest hit)
+RLAPI RayHitInfo GetCollisionSphereMesh(Vector3 center, float radius, Mesh mesh, Matrix transform);     // Get collision info between sphere and mesh (nearest mesh point)
+RLAPI RayHitInfo GetCollisionBoxMesh(BoundingBox box, Mesh mesh, Matrix transform);                     // Get collision info between box and mesh (nearest overlapping triangle)
 RLAPI RayHitInfo GetCollisionRayTriangle(Ray ray, Vector3 p1, Vector3 p2, Vector3 p3);                  // Get collision info between ray and triangle
 RLAPI RayHitInfo GetCollisionRayGround(Ray ray, float groundHeight);                                    // Get collision info between ray and ground plane (Y-normal plane)
 
+// Spatial index functions (broadphase collision queries)
+RLAPI SpatialIndex LoadSpatialIndex(float margin);                                                      // Load spatial index (dynamic bounding boxes tree), boxes enlarged by margin
+RLAPI void UnloadSpatialIndex(SpatialIndex index);                                                      // Unload spatial index data
+RLAPI int AddSpatialEntry(SpatialIndex *index, BoundingBox box, int userId);                            // Add entry to spatial index, returns entry id
+RLAPI bool UpdateSpatialEntry(SpatialIndex *index, int entry, BoundingBox box);                         // Update spatial index entry box, returns true if entry moved in tree
+RLAPI void RemoveSpatialEntry(SpatialIndex *index, int entry);                                          // Remove entry from spatial index
+RLAPI int QuerySpatialBox(SpatialIndex index, BoundingBox box, int *userIds, int maxCount);             // Get entries overlapping box
+RLAPI int QuerySpatialSphere(SpatialIndex index, Vector3 center, float radius, int *userIds, int maxCount);  // Get entries overlapping sphere
+RLAPI int QuerySpatialRay(SpatialIndex index, Ray ray, float maxDistance, int *userIds, int maxCount);  // Get entries crossed by ray
+RLAPI void QuerySpatialRays(SpatialIndex index, const Ray *rays, int rayCount, float maxDistance, int *userIds, float *distances);  // Get nearest entry crossed by every ray (batched)
+RLAPI int QuerySpatialFrustum(SpatialIndex index, int *userIds, int maxCount);                          // Get entries inside current view frustum
+RLAPI int QuerySpatialPairs(SpatialIndex index, int *userIdPairs, int maxPairs);                        // Get overlapping entries pairs
+
 //------------------------------------------------------------------------------------
 // Shaders System Functions (Module: rlgl)
 // NOTE: This functions are useless when using OpenGL 1.1
@@ -1323,8 +2081,12 @@ RLAPI char *LoadText(const char *fileName);                               // Loa
 RLAPI Shader LoadShader(const char *vsFileName, const char *fsFileName);  // Load shader from files and bind default locations
 RLAPI Shader LoadShaderCode(const char *vsCode, const char *fsCode);                  // Load shader from code strings and bind default locations
 RLAPI void UnloadShader(Shader shader);                                   // Unload shader from GPU memory (VRAM)
+RLAPI Shader LoadShaderCached(const char *vsFileName, const char *fsFileName);  // Load shader from files shared with previous loads (cached, reference counted)
+RLAPI void UnloadShaderCached(Shader shader);                             // Release cached shader, unloaded with last reference
+RLAPI void SetShaderCacheDirectory(const char *dirPath);                  // Set shader program binaries cache directory (NULL to disable)
 
 RLAPI Shader GetShaderDefault(void);                                      // Get default shader
+RLAPI Shader GetShaderSkinning(void);                                     // Get default skinning shader (used instead of default shader for GPU skinned meshes)
 RLAPI Texture2D GetTextureDefault(void);                                  // Get default texture
 
 // Shader configuration functions
@@ -1333,6 +2095,10 @@ RLAPI void SetShaderValue(Shader shader, int uniformLoc, const void *value, int
 RLAPI void SetShaderValueV(Shader shader, int uniformLoc, const void *value, int uniformType, int count);   // Set shader uniform value vector
 RLAPI void SetShaderValueMatrix(Shader shader, int uniformLoc, Matrix mat);         // Set shader uniform value (matrix 4x4)
 RLAPI void SetShaderValueTexture(Shader shader, int uniformLoc, Texture2D texture); // Set shader uniform value for texture
+RLAPI unsigned int LoadShaderBlock(const char *blockName, const void *data, int size);    // Load uniform block buffer shared by all shaders (OpenGL 3.3)
+RLAPI void UpdateShaderBlock(unsigned int blockId, const void *data, int size, int offset); // Update uniform block buffer data
+RLAPI void UnloadShaderBlock(unsigned int blockId);                       // Unload uniform block buffer
+RLAPI void SetShaderBlocks(Shader shader);                                // Bind frame and loaded uniform blocks to shader
 RLAPI void SetMatrixProjection(Matrix proj);                              // Set a custom projection matrix (replaces internal projection matrix)
 RLAPI void SetMatrixModelview(Matrix view);                               // Set a custom modelview matrix (replaces internal modelview matrix)
 RLAPI Matrix GetMatrixModelview(void);                                    // Get internal modelview matrix
@@ -1344,6 +2110,8 @@ RLAPI Texture2D GenTextureCubemap(Shader shader, Texture2D map, int size);
 RLAPI Texture2D GenTextureIrradiance(Shader shader, Texture2D cubemap, int size);   // Generate irradiance texture using cubemap data
 RLAPI Texture2D GenTexturePrefilter(Shader shader, Texture2D cubemap, int size);    // Generate prefilter texture using cubemap data
 RLAPI Texture2D GenTextureBRDF(Shader shader, int size);                  // Generate BRDF texture
+RLAPI bool ExportTextureIBL(Texture2D texture, bool isCubemap, const char *fileName);   // Export generated IBL texture (cubemap or BRDF LUT, all mipmaps) to KTX file
+RLAPI Texture2D LoadTextureIBL(const char *fileName);                     // Load IBL texture from KTX file (cubemap if file stores 6 faces)
 
 // Shading begin/end functions
 RLAPI void BeginShaderMode(Shader shader);                                // Begin custom shader drawing
@@ -1351,6 +2119,9 @@ RLAPI void EndShaderMode(void);                                           // End
 RLAPI void BeginBlendMode(int mode);                                      // Begin blending mode (alpha, additive, multiplied)
 RLAPI void EndBlendMode(void);                                            // End blending mode (reset to default: alpha blending)
 
+// Render statistics functions
+RLAPI RenderStats GetRenderStats(void);                                   // Get render statistics of last frame (draw calls, vertices, batch flushes...)
+
 // VR control functions
 RLAPI void InitVrSimulator(void);                       // Init VR simulator for selected device parameters
 RLAPI void CloseVrSimulator(void);                      // Close VR simulator for current device
@@ -1367,14 +2138,22 @@ RLAPI void EndVrDrawing(void);                          // End VR simulator ster
 
 // Audio device management functions
 RLAPI void InitAudioDevice(void);                                     // Initialize audio device and context
+RLAPI void InitAudioDeviceEx(AudioDeviceConfig config);               // Initialize audio device with configuration (sample rate, periods, share mode, backend)
 RLAPI void CloseAudioDevice(void);                                    // Close the audio device and context
 RLAPI bool IsAudioDeviceReady(void);                                  // Check if audio device has been initialized successfully
+RLAPI AudioStats GetAudioStats(void);                                 // Get audio statistics since last call (mixing time, voices, underruns, waits)
 RLAPI void SetMasterVolume(float volume);                             // Set master volume (listener)
+RLAPI void SetAudioBusVolume(int bus, float volume);                  // Set bus volume (bus 0 is master bus)
+RLAPI int AddAudioBusEffect(int bus, int type, float param0, float param1, float param2); // Add bus effect, returns effect index (processed on audio thread)
+RLAPI void SetAudioBusEffect(int bus, int effect, float param0, float param1, float param2); // Set bus effect parameters
+RLAPI void ClearAudioBusEffects(int bus);                             // Remove bus effects
 
 // Wave/Sound loading/unloading functions
 RLAPI Wave LoadWave(const char *fileName);                            // Load wave data from file
 RLAPI Sound LoadSound(const char *fileName);                          // Load sound from file
 RLAPI Sound LoadSoundFromWave(Wave wave);                             // Load sound from wave data
+RLAPI Sound LoadSoundCompressed(const char *fileName);                // Load compressed sound from file, decoded on playing (OGG, FLAC, MP3)
+RLAPI Sound LoadSoundAlias(Sound source);                             // Load sound instance sharing source sound data
 RLAPI void UpdateSound(Sound sound, const void *data, int samplesCount);// Update sound buffer with new data
 RLAPI void UnloadWave(Wave wave);                                     // Unload wave data
 RLAPI void UnloadSound(Sound sound);                                  // Unload sound
@@ -1389,10 +2168,29 @@ RLAPI void ResumeSound(Sound sound);                                  // Resume
 RLAPI void PlaySoundMulti(Sound sound);                               // Play a sound (using multichannel buffer pool)
 RLAPI void StopSoundMulti(void);                                      // Stop any sound playing (using multichannel buffer pool)
 RLAPI int GetSoundsPlaying(void);                                     // Get number of sounds playing in the multichannel
+RLAPI void SetAudioVoicesLimit(int maxVoices);                        // Set max voices mixed at the same time (others are virtual)
+RLAPI void SetAudioVoicesDistance(float minDistance, float maxDistance); // Set voices distance attenuation range
+RLAPI void SetSoundPriority(Sound sound, int priority, int maxInstances); // Set sound voices priority and max instances (0 for unlimited)
+RLAPI int PlaySoundVoice(Sound sound, float volume, float distance);  // Play sound on a new voice, returns voice id (-1 if not played)
+RLAPI void SetVoiceVolume(int voice, float volume);                   // Set voice volume
+RLAPI void SetVoiceDistance(int voice, float distance);               // Set voice emitter distance to listener
+RLAPI void SetVoicePosition(int voice, Vector3 position, Vector3 velocity); // Set voice emitter position and velocity (spatial voice)
+RLAPI void StopVoice(int voice);                                      // Stop voice
+RLAPI bool IsVoicePlaying(int voice);                                 // Check if voice is playing (mixed or virtual)
+RLAPI bool IsVoiceVirtual(int voice);                                 // Check if voice is virtual (playing, not mixed)
+RLAPI void UpdateAudioVoices(void);                                   // Update voices (release ended voices, mix most audible ones)
+RLAPI void SetAudioListener(Vector3 position, Vector3 forward, Vector3 up, Vector3 velocity); // Set listener position, orientation and velocity (spatial audio)
+RLAPI void SetAudioDopplerFactor(float factor);                       // Set doppler effect scale (0.0f disables it)
+RLAPI void UpdateAudioSpatial(void);                                  // Update spatial audio (listener and emitters positions applied together)
 RLAPI bool IsSoundPlaying(Sound sound);                               // Check if a sound is currently playing
 RLAPI void SetSoundVolume(Sound sound, float volume);                 // Set volume for a sound (1.0 is max level)
 RLAPI void SetSoundPitch(Sound sound, float pitch);                   // Set pitch for a sound (1.0 is base level)
+RLAPI void SetSoundBus(Sound sound, int bus);                         // Set mixing bus for a sound (0 is master bus)
+RLAPI void SetSoundPosition(Sound sound, Vector3 position, Vector3 velocity); // Set sound emitter position and velocity (voices played are spatial)
 RLAPI void WaveFormat(Wave *wave, int sampleRate, int sampleSize, int channels);  // Convert wave data to desired format
+RLAPI void WaveFormatBatch(Wave *waves, int count, int sampleRate, int sampleSize, int channels); // Convert waves data to desired format (worker threads)
+RLAPI void SetAudioConversionQuality(int quality);                    // Set audio conversion quality (sample rate conversion)
+RLAPI void SetAudioConversionCache(bool enabled);                     // Set converted waves data cache (same data converted only once)
 RLAPI Wave WaveCopy(Wave wave);                                       // Copy a wave to a new wave
 RLAPI void WaveCrop(Wave *wave, int initSample, int finalSample);     // Crop a wave to defined samples range
 RLAPI float *GetWaveData(Wave wave);                                  // Get samples data from wave as a floats array
@@ -1408,15 +2206,23 @@ RLAPI void ResumeMusicStream(Music music);                            // Resume
 RLAPI bool IsMusicPlaying(Music music);                               // Check if music is playing
 RLAPI void SetMusicVolume(Music music, float volume);                 // Set volume for music (1.0 is max level)
 RLAPI void SetMusicPitch(Music music, float pitch);                   // Set pitch for a music (1.0 is base level)
+RLAPI void SetMusicBus(Music music, int bus);                         // Set mixing bus for music (0 is master bus)
+RLAPI void SetMusicPosition(Music music, Vector3 position, Vector3 velocity); // Set music emitter position and velocity (spatial music)
 RLAPI void SetMusicLoopCount(Music music, int count);                 // Set music loop count (loop repeats)
+RLAPI void SetMusicStreamThread(bool enabled, float bufferTime);      // Set music streams refilled by a background thread (no UpdateMusicStream() required)
+RLAPI void SetMusicModuleCache(bool enabled);                         // Set tracker modules (XM, MOD) pre-rendered on loading, played from PCM cache
 RLAPI float GetMusicTimeLength(Music music);                          // Get music time length (in seconds)
 RLAPI float GetMusicTimePlayed(Music music);                          // Get current music time played (in seconds)
+RLAPI unsigned int GetMusicUnderruns(Music music);                    // Get music stream underruns count (music played with no data ready)
 
 // AudioStream management functions
 RLAPI AudioStream InitAudioStream(unsigned int sampleRate, unsigned int sampleSize, unsigned int channels); // Init audio stream (to stream raw audio pcm data)
+RLAPI AudioStream InitAudioStreamEx(unsigned int sampleRate, unsigned int sampleSize, unsigned int channels, unsigned int subBufferSize, unsigned int subBufferCount); // Init audio stream with custom buffering (sub-buffer frames and count)
 RLAPI void UpdateAudioStream(AudioStream stream, const void *data, int samplesCount); // Update audio stream buffers with data
 RLAPI void CloseAudioStream(AudioStream stream);                      // Close audio stream and free memory
 RLAPI bool IsAudioStreamProcessed(AudioStream stream);                // Check if any audio stream buffers requires refill
+RLAPI unsigned int GetAudioStreamUnderruns(AudioStream stream);       // Get audio stream underruns count (stream played with no data ready)
+RLAPI void SetAudioStreamCallback(AudioStream stream, AudioStreamCallback callback, void *userData); // Set audio stream callback, data pulled from audio thread (NULL to restore queued data)
 RLAPI void PlayAudioStream(AudioStream stream);                       // Play audio stream
 RLAPI void PauseAudioStream(AudioStream stream);                      // Pause audio stream
 RLAPI void ResumeAudioStream(AudioStream stream);                     // Resume audio stream
@@ -1424,6 +2230,8 @@ RLAPI bool IsAudioStreamPlaying(AudioStream stream);                  // Check i
 RLAPI void StopAudioStream(AudioStream stream);                       // Stop audio stream
 RLAPI void SetAudioStreamVolume(AudioStream stream, float volume);    // Set volume for audio stream (1.0 is max level)
 RLAPI void SetAudioStreamPitch(AudioStream stream, float pitch);      // Set pitch for audio stream (1.0 is base level)
+RLAPI void SetAudioStreamBus(AudioStream stream, int bus);            // Set mixing bus for audio stream (0 is master bus)
+RLAPI void SetAudioStreamPosition(AudioStream stream, Vector3 position, Vector3 velocity); // Set audio stream emitter position and velocity (spatial stream)
 
 //------------------------------------------------------------------------------------
 // Network (Module: network)
@@ -17,6 +17,12 @@
 *       Avoid raylib.h header inclusion in this file.
 *       Vector3 and Matrix data types are defined internally in raymath module.
 *
+*   #define RAYMATH_SIMD
+*       Use SSE (x86) or NEON (ARM) instructions on matrix and quaternion hot functions:
+*       MatrixMultiply(), MatrixInvert(), QuaternionMultiply() and batch functions
+*       (Vector3TransformArray(), Vector3TransformSoA(), Vector3BoundsSoA(), LerpArray()...).
+*       API and data layout are the same, scalar code is used if target does not support them.
+*
 *
 *   LICENSE: zlib/libpng
 *
@@ -86,6 +92,17 @@
     #define RAD2DEG (180.0f/PI)
 #endif
 
+// SIMD instructions used on matrix and quaternion functions (optional)
+#if defined(RAYMATH_SIMD)
+    #if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 1))
+        #include <xmmintrin.h>      // Required for: SSE intrinsics
+        #define RAYMATH_SIMD_SSE
+    #elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+        #include <arm_neon.h>       // Required for: NEON intrinsics
+        #define RAYMATH_SIMD_NEON
+    #endif
+#endif
+
 // Return float vector for Matrix
 #ifndef MatrixToFloat
     #define MatrixToFloat(mat) (MatrixToFloatV(mat).v)
@@ -154,6 +171,32 @@ RMDEF float Lerp(float start, float end, float amount)
     return start + amount*(end - start);
 }
 
+// Calculate linear interpolation between two arrays of floats, dst can be the same array as start or end
+// NOTE: Useful on structure of arrays data, every component array interpolated separately
+RMDEF void LerpArray(float *dst, const float *start, const float *end, int count, float amount)
+{
+    int i = 0;
+
+#if defined(RAYMATH_SIMD_SSE)
+    __m128 t = _mm_set1_ps(amount);
+
+    for (; i + 4 <= count; i += 4)
+    {
+        __m128 a = _mm_loadu_ps(start + i);
+        _mm_storeu_ps(dst + i, _mm_add_ps(a, _mm_mul_ps(t, _mm_sub_ps(_mm_loadu_ps(end + i), a))));
+    }
+#elif defined(RAYMATH_SIMD_NEON)
+    for (; i + 4 <= count; i += 4)
+    {
+        float32x4_t a = vld1q_f32(start + i);
+        vst1q_f32(dst + i, vmlaq_n_f32(a, vsubq_f32(vld1q_f32(end + i), a), amount));
+    }
+#endif
+
+    // Remaining values (or all values without SIMD support)
+    for (; i < count; i++) dst[i] = start[i] + amount*(end[i] - start[i]);
+}
+
 //----------------------------------------------------------------------------------
 // Module Functions Definition - Vector2 math
 //----------------------------------------------------------------------------------
@@ -424,6 +467,7 @@ RMDEF void Vector3OrthoNormalize(Vector3 *v1, Vector3 *v2)
 RMDEF Vector3 Vector3Transform(Vector3 v, Matrix mat)
 {
     Vector3 result = { 0 };
+
     float x = v.x;
     float y = v.y;
     float z = v.z;
@@ -435,6 +479,154 @@ RMDEF Vector3 Vector3Transform(Vector3 v, Matrix mat)
     return result;
 }
 
+// Transforms an array of Vector3 by a given Matrix, dst can be the same array as src
+RMDEF void Vector3TransformArray(Vector3 *dst, const Vector3 *src, int count, Matrix mat)
+{
+#if defined(RAYMATH_SIMD_SSE)
+    __m128 col0 = _mm_setr_ps(mat.m0, mat.m1, mat.m2, mat.m3);
+    __m128 col1 = _mm_setr_ps(mat.m4, mat.m5, mat.m6, mat.m7);
+    __m128 col2 = _mm_setr_ps(mat.m8, mat.m9, mat.m10, mat.m11);
+    __m128 col3 = _mm_setr_ps(mat.m12, mat.m13, mat.m14, mat.m15);
+
+    for (int i = 0; i < count; i++)
+    {
+        __m128 vec = _mm_add_ps(_mm_add_ps(_mm_mul_ps(col0, _mm_set1_ps(src[i].x)), _mm_mul_ps(col1, _mm_set1_ps(src[i].y))),
+                                _mm_add_ps(_mm_mul_ps(col2, _mm_set1_ps(src[i].z)), col3));
+
+        // NOTE: Only XYZ stored, a 4 floats store would overwrite next vector
+        _mm_storel_pi((__m64 *)&dst[i].x, vec);
+        _mm_store_ss(&dst[i].z, _mm_movehl_ps(vec, vec));
+    }
+#elif defined(RAYMATH_SIMD_NEON)
+    float32x4x4_t cols = vld4q_f32((const float *)&mat);
+
+    for (int i = 0; i < count; i++)
+    {
+        float32x4_t vec = vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(cols.val[3], cols.val[0], src[i].x), cols.val[1], src[i].y), cols.val[2], src[i].z);
+
+        // NOTE: Only XYZ stored, a 4 floats store would overwrite next vector
+        vst1_f32(&dst[i].x, vget_low_f32(vec));
+        dst[i].z = vgetq_lane_f32(vec, 2);
+    }
+#else
+    for (int i = 0; i < count; i++) dst[i] = Vector3Transform(src[i], mat);
+#endif
+}
+
+// Transforms positions stored as separate x, y, z arrays by a given Matrix (in place)
+RMDEF void Vector3TransformSoA(float *x, float *y, float *z, int count, Matrix mat)
+{
+    int i = 0;
+
+#if defined(RAYMATH_SIMD_SSE)
+    __m128 m0 = _mm_set1_ps(mat.m0), m4 = _mm_set1_ps(mat.m4), m8 = _mm_set1_ps(mat.m8), m12 = _mm_set1_ps(mat.m12);
+    __m128 m1 = _mm_set1_ps(mat.m1), m5 = _mm_set1_ps(mat.m5), m9 = _mm_set1_ps(mat.m9), m13 = _mm_set1_ps(mat.m13);
+    __m128 m2 = _mm_set1_ps(mat.m2), m6 = _mm_set1_ps(mat.m6), m10 = _mm_set1_ps(mat.m10), m14 = _mm_set1_ps(mat.m14);
+
+    for (; i + 4 <= count; i += 4)
+    {
+        __m128 vx = _mm_loadu_ps(x + i), vy = _mm_loadu_ps(y + i), vz = _mm_loadu_ps(z + i);
+
+        _mm_storeu_ps(x + i, _mm_add_ps(_mm_add_ps(_mm_mul_ps(m0, vx), _mm_mul_ps(m4, vy)), _mm_add_ps(_mm_mul_ps(m8, vz), m12)));
+        _mm_storeu_ps(y + i, _mm_add_ps(_mm_add_ps(_mm_mul_ps(m1, vx), _mm_mul_ps(m5, vy)), _mm_add_ps(_mm_mul_ps(m9, vz), m13)));
+        _mm_storeu_ps(z + i, _mm_add_ps(_mm_add_ps(_mm_mul_ps(m2, vx), _mm_mul_ps(m6, vy)), _mm_add_ps(_mm_mul_ps(m10, vz), m14)));
+    }
+#elif defined(RAYMATH_SIMD_NEON)
+    float32x4_t m12 = vdupq_n_f32(mat.m12), m13 = vdupq_n_f32(mat.m13), m14 = vdupq_n_f32(mat.m14);
+
+    for (; i + 4 <= count; i += 4)
+    {
+        float32x4_t vx = vld1q_f32(x + i), vy = vld1q_f32(y + i), vz = vld1q_f32(z + i);
+
+        vst1q_f32(x + i, vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(m12, vx, mat.m0), vy, mat.m4), vz, mat.m8));
+        vst1q_f32(y + i, vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(m13, vx, mat.m1), vy, mat.m5), vz, mat.m9));
+        vst1q_f32(z + i, vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(m14, vx, mat.m2), vy, mat.m6), vz, mat.m10));
+    }
+#endif
+
+    // Remaining positions (or all positions without SIMD support)
+    for (; i < count; i++)
+    {
+        float vx = x[i], vy = y[i], vz = z[i];
+
+        x[i] = mat.m0*vx + mat.m4*vy + mat.m8*vz + mat.m12;
+        y[i] = mat.m1*vx + mat.m5*vy + mat.m9*vz + mat.m13;
+        z[i] = mat.m2*vx + mat.m6*vy + mat.m10*vz + mat.m14;
+    }
+}
+
+// Transforms normals stored as separate x, y, z arrays by a given Matrix (in place), result normalized
+// NOTE: Translation is ignored, use MatrixTranspose(MatrixInvert(mat)) for matrices with non-uniform scale
+RMDEF void Vector3TransformNormalSoA(float *x, float *y, float *z, int count, Matrix mat)
+{
+    int i = 0;
+
+#if defined(RAYMATH_SIMD_SSE)
+    __m128 m0 = _mm_set1_ps(mat.m0), m4 = _mm_set1_ps(mat.m4), m8 = _mm_set1_ps(mat.m8);
+    __m128 m1 = _mm_set1_ps(mat.m1), m5 = _mm_set1_ps(mat.m5), m9 = _mm_set1_ps(mat.m9);
+    __m128 m2 = _mm_set1_ps(mat.m2), m6 = _mm_set1_ps(mat.m6), m10 = _mm_set1_ps(mat.m10);
+    __m128 one = _mm_set1_ps(1.0f);
+
+    for (; i + 4 <= count; i += 4)
+    {
+        __m128 vx = _mm_loadu_ps(x + i), vy = _mm_loadu_ps(y + i), vz = _mm_loadu_ps(z + i);
+
+        __m128 nx = _mm_add_ps(_mm_add_ps(_mm_mul_ps(m0, vx), _mm_mul_ps(m4, vy)), _mm_mul_ps(m8, vz));
+        __m128 ny = _mm_add_ps(_mm_add_ps(_mm_mul_ps(m1, vx), _mm_mul_ps(m5, vy)), _mm_mul_ps(m9, vz));
+        __m128 nz = _mm_add_ps(_mm_add_ps(_mm_mul_ps(m2, vx), _mm_mul_ps(m6, vy)), _mm_mul_ps(m10, vz));
+
+        // Zero length normals are kept as they are (same as Vector3Normalize())
+        __m128 length = _mm_sqrt_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(nx, nx), _mm_mul_ps(ny, ny)), _mm_mul_ps(nz, nz)));
+        __m128 valid = _mm_cmpgt_ps(length, _mm_setzero_ps());
+        __m128 ilength = _mm_or_ps(_mm_and_ps(valid, _mm_div_ps(one, length)), _mm_andnot_ps(valid, one));
+
+        _mm_storeu_ps(x + i, _mm_mul_ps(nx, ilength));
+        _mm_storeu_ps(y + i, _mm_mul_ps(ny, ilength));
+        _mm_storeu_ps(z + i, _mm_mul_ps(nz, ilength));
+    }
+#elif defined(RAYMATH_SIMD_NEON)
+    float32x4_t one = vdupq_n_f32(1.0f);
+
+    for (; i + 4 <= count; i += 4)
+    {
+        float32x4_t vx = vld1q_f32(x + i), vy = vld1q_f32(y + i), vz = vld1q_f32(z + i);
+
+        float32x4_t nx = vmlaq_n_f32(vmlaq_n_f32(vmulq_n_f32(vx, mat.m0), vy, mat.m4), vz, mat.m8);
+        float32x4_t ny = vmlaq_n_f32(vmlaq_n_f32(vmulq_n_f32(vx, mat.m1), vy, mat.m5), vz, mat.m9);
+        float32x4_t nz = vmlaq_n_f32(vmlaq_n_f32(vmulq_n_f32(vx, mat.m2), vy, mat.m6), vz, mat.m10);
+
+        // Reciprocal square root estimate refined with two Newton-Raphson steps (no division on ARMv7 NEON)
+        float32x4_t lengthSqr = vmlaq_f32(vmlaq_f32(vmulq_f32(nx, nx), ny, ny), nz, nz);
+        float32x4_t ilength = vrsqrteq_f32(lengthSqr);
+        ilength = vmulq_f32(ilength, vrsqrtsq_f32(vmulq_f32(lengthSqr, ilength), ilength));
+        ilength = vmulq_f32(ilength, vrsqrtsq_f32(vmulq_f32(lengthSqr, ilength), ilength));
+
+        // Zero length normals are kept as they are (same as Vector3Normalize())
+        ilength = vbslq_f32(vcgtq_f32(lengthSqr, vdupq_n_f32(0.0f)), ilength, one);
+
+        vst1q_f32(x + i, vmulq_f32(nx, ilength));
+        vst1q_f32(y + i, vmulq_f32(ny, ilength));
+        vst1q_f32(z + i, vmulq_f32(nz, ilength));
+    }
+#endif
+
+    // Remaining normals (or all normals without SIMD support)
+    for (; i < count; i++)
+    {
+        float vx = x[i], vy = y[i], vz = z[i];
+        float nx = mat.m0*vx + mat.m4*vy + mat.m8*vz;
+        float ny = mat.m1*vx + mat.m5*vy + mat.m9*vz;
+        float nz = mat.m2*vx + mat.m6*vy + mat.m10*vz;
+
+        float length = sqrtf(nx*nx + ny*ny + nz*nz);
+        float ilength = (length > 0.0f)? 1.0f/length : 1.0f;
+
+        x[i] = nx*ilength;
+        y[i] = ny*ilength;
+        z[i] = nz*ilength;
+    }
+}
+
 // Transform a vector by quaternion rotation
 RMDEF Vector3 Vector3RotateByQuaternion(Vector3 v, Quaternion q)
 {
@@ -501,6 +693,81 @@ RMDEF Vector3 Vector3Max(Vector3 v1, Vector3 v2)
     return result;
 }
 
+// Get min and max values of points stored as separate x, y, z arrays (axis aligned bounds)
+// NOTE: min and max are set to zero if there are no points
+RMDEF void Vector3BoundsSoA(const float *x, const float *y, const float *z, int count, Vector3 *min, Vector3 *max)
+{
+    float lo[3] = { 0 };
+    float hi[3] = { 0 };
+
+    if (count > 0)
+    {
+        const float *values[3] = { x, y, z };
+        int i = 1;
+
+        for (int k = 0; k < 3; k++) { lo[k] = values[k][0]; hi[k] = values[k][0]; }
+
+#if defined(RAYMATH_SIMD_SSE) || defined(RAYMATH_SIMD_NEON)
+        if (count >= 4)
+        {
+            float laneMin[4] = { 0 };
+            float laneMax[4] = { 0 };
+
+            for (int k = 0; k < 3; k++)
+            {
+                const float *v = values[k];
+    #if defined(RAYMATH_SIMD_SSE)
+                __m128 vmin = _mm_loadu_ps(v);
+                __m128 vmax = vmin;
+
+                for (i = 4; i + 4 <= count; i += 4)
+                {
+                    __m128 value = _mm_loadu_ps(v + i);
+                    vmin = _mm_min_ps(vmin, value);
+                    vmax = _mm_max_ps(vmax, value);
+                }
+
+                _mm_storeu_ps(laneMin, vmin);
+                _mm_storeu_ps(laneMax, vmax);
+    #else
+                float32x4_t vmin = vld1q_f32(v);
+                float32x4_t vmax = vmin;
+
+                for (i = 4; i + 4 <= count; i += 4)
+                {
+                    float32x4_t value = vld1q_f32(v + i);
+                    vmin = vminq_f32(vmin, value);
+                    vmax = vmaxq_f32(vmax, value);
+                }
+
+                vst1q_f32(laneMin, vmin);
+                vst1q_f32(laneMax, vmax);
+    #endif
+                for (int l = 0; l < 4; l++)
+                {
+                    if (laneMin[l] < lo[k]) lo[k] = laneMin[l];
+                    if (laneMax[l] > hi[k]) hi[k] = laneMax[l];
+                }
+            }
+        }
+#endif
+
+        // Remaining points (or all points without SIMD support)
+        for (; i < count; i++)
+        {
+            if (x[i] < lo[0]) lo[0] = x[i];
+            if (x[i] > hi[0]) hi[0] = x[i];
+            if (y[i] < lo[1]) lo[1] = y[i];
+            if (y[i] > hi[1]) hi[1] = y[i];
+            if (z[i] < lo[2]) lo[2] = z[i];
+            if (z[i] > hi[2]) hi[2] = z[i];
+        }
+    }
+
+    *min = (Vector3){ lo[0], lo[1], lo[2] };
+    *max = (Vector3){ hi[0], hi[1], hi[2] };
+}
+
 // Compute barycenter coordinates (u, v, w) for point p with respect to triangle (a, b, c)
 // NOTE: Assumes P is on the plane of the triangle
 RMDEF Vector3 Vector3Barycenter(Vector3 p, Vector3 a, Vector3 b, Vector3 c)
@@ -601,6 +868,69 @@ RMDEF Matrix MatrixInvert(Matrix mat)
 {
     Matrix result = { 0 };
 
+#if defined(RAYMATH_SIMD_SSE)
+    // NOTE: Inverted by 2x2 blocks, M = | A B |, blocks packed as (m00, m01, m10, m11) in vectors
+    //                                   | C D |
+    // inverse blocks are computed from adjugates (A#), inverse transposed is inverse of transposed
+    #define RM_SHUFFLE(a, b, x, y, z, w)    _mm_shuffle_ps(a, b, _MM_SHUFFLE(w, z, y, x))
+    #define RM_SWIZZLE(a, x, y, z, w)       _mm_shuffle_ps(a, a, _MM_SHUFFLE(w, z, y, x))
+    #define RM_MAT2MUL(a, b)                _mm_add_ps(_mm_mul_ps(a, RM_SWIZZLE(b, 0, 3, 0, 3)), _mm_mul_ps(RM_SWIZZLE(a, 1, 0, 3, 2), RM_SWIZZLE(b, 2, 1, 2, 1)))
+    #define RM_MAT2ADJMUL(a, b)             _mm_sub_ps(_mm_mul_ps(RM_SWIZZLE(a, 3, 3, 0, 0), b), _mm_mul_ps(RM_SWIZZLE(a, 1, 1, 2, 2), RM_SWIZZLE(b, 2, 3, 0, 1)))
+    #define RM_MAT2MULADJ(a, b)             _mm_sub_ps(_mm_mul_ps(a, RM_SWIZZLE(b, 3, 0, 3, 0)), _mm_mul_ps(RM_SWIZZLE(a, 1, 0, 3, 2), RM_SWIZZLE(b, 2, 1, 2, 1)))
+
+    union { Matrix mat; __m128 rows[4]; } m = { mat }, res;
+    __m128 row0 = m.rows[0];
+    __m128 row1 = m.rows[1];
+    __m128 row2 = m.rows[2];
+    __m128 row3 = m.rows[3];
+
+    __m128 a = _mm_movelh_ps(row0, row1);
+    __m128 b = _mm_movehl_ps(row1, row0);
+    __m128 c = _mm_movelh_ps(row2, row3);
+    __m128 d = _mm_movehl_ps(row3, row2);
+
+    // Blocks determinants (|A|, |B|, |C|, |D|)
+    __m128 detSub = _mm_sub_ps(_mm_mul_ps(RM_SHUFFLE(row0, row2, 0, 2, 0, 2), RM_SHUFFLE(row1, row3, 1, 3, 1, 3)),
+                               _mm_mul_ps(RM_SHUFFLE(row0, row2, 1, 3, 1, 3), RM_SHUFFLE(row1, row3, 0, 2, 0, 2)));
+    __m128 detA = RM_SWIZZLE(detSub, 0, 0, 0, 0);
+    __m128 detB = RM_SWIZZLE(detSub, 1, 1, 1, 1);
+    __m128 detC = RM_SWIZZLE(detSub, 2, 2, 2, 2);
+    __m128 detD = RM_SWIZZLE(detSub, 3, 3, 3, 3);
+
+    __m128 dc = RM_MAT2ADJMUL(d, c);        // D#*C
+    __m128 ab = RM_MAT2ADJMUL(a, b);        // A#*B
+
+    __m128 x = _mm_sub_ps(_mm_mul_ps(detD, a), RM_MAT2MUL(b, dc));       // X# = |D|*A - B*(D#*C)
+    __m128 w = _mm_sub_ps(_mm_mul_ps(detA, d), RM_MAT2MUL(c, ab));       // W# = |A|*D - C*(A#*B)
+    __m128 y = _mm_sub_ps(_mm_mul_ps(detB, c), RM_MAT2MULADJ(d, ab));    // Y# = |B|*C - D*(A#*B)#
+    __m128 z = _mm_sub_ps(_mm_mul_ps(detC, b), RM_MAT2MULADJ(a, dc));    // Z# = |C|*B - A*(D#*C)#
+
+    // |M| = |A|*|D| + |B|*|C| - tr((A#*B)*(D#*C))
+    __m128 tr = _mm_mul_ps(ab, RM_SWIZZLE(dc, 0, 2, 1, 3));
+    tr = _mm_add_ps(tr, _mm_movehl_ps(tr, tr));
+    tr = _mm_add_ps(tr, RM_SWIZZLE(tr, 1, 1, 1, 1));
+    __m128 detM = _mm_sub_ps(_mm_add_ps(_mm_mul_ps(detA, detD), _mm_mul_ps(detB, detC)), RM_SWIZZLE(tr, 0, 0, 0, 0));
+
+    __m128 invDetM = _mm_div_ps(_mm_setr_ps(1.0f, -1.0f, -1.0f, 1.0f), detM);
+
+    x = _mm_mul_ps(x, invDetM);
+    y = _mm_mul_ps(y, invDetM);
+    z = _mm_mul_ps(z, invDetM);
+    w = _mm_mul_ps(w, invDetM);
+
+    // Adjugates are applied on store shuffle
+    res.rows[0] = RM_SHUFFLE(x, y, 3, 1, 3, 1);
+    res.rows[1] = RM_SHUFFLE(x, y, 2, 0, 2, 0);
+    res.rows[2] = RM_SHUFFLE(z, w, 3, 1, 3, 1);
+    res.rows[3] = RM_SHUFFLE(z, w, 2, 0, 2, 0);
+    result = res.mat;
+
+    #undef RM_SHUFFLE
+    #undef RM_SWIZZLE
+    #undef RM_MAT2MUL
+    #undef RM_MAT2ADJMUL
+    #undef RM_MAT2MULADJ
+#else
     // Cache the matrix values (speed optimization)
     float a00 = mat.m0, a01 = mat.m1, a02 = mat.m2, a03 = mat.m3;
     float a10 = mat.m4, a11 = mat.m5, a12 = mat.m6, a13 = mat.m7;
@@ -639,6 +969,7 @@ RMDEF Matrix MatrixInvert(Matrix mat)
     result.m13 = (a00*b09 - a01*b07 + a02*b06)*invDet;
     result.m14 = (-a30*b03 + a31*b01 - a32*b00)*invDet;
     result.m15 = (a20*b03 - a21*b01 + a22*b00)*invDet;
+#endif
 
     return result;
 }
@@ -879,6 +1210,31 @@ RMDEF Matrix MatrixMultiply(Matrix left, Matrix right)
 {
     Matrix result = { 0 };
 
+#if defined(RAYMATH_SIMD_SSE)
+    // NOTE: Result memory rows are combinations of left memory rows, weighted by right memory rows values
+    union { Matrix mat; __m128 rows[4]; } l = { left }, r = { right }, res;
+
+    res.rows[0] = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_shuffle_ps(r.rows[0], r.rows[0], _MM_SHUFFLE(0, 0, 0, 0)), l.rows[0]), _mm_mul_ps(_mm_shuffle_ps(r.rows[0], r.rows[0], _MM_SHUFFLE(1, 1, 1, 1)), l.rows[1])),
+                             _mm_add_ps(_mm_mul_ps(_mm_shuffle_ps(r.rows[0], r.rows[0], _MM_SHUFFLE(2, 2, 2, 2)), l.rows[2]), _mm_mul_ps(_mm_shuffle_ps(r.rows[0], r.rows[0], _MM_SHUFFLE(3, 3, 3, 3)), l.rows[3])));
+    res.rows[1] = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_shuffle_ps(r.rows[1], r.rows[1], _MM_SHUFFLE(0, 0, 0, 0)), l.rows[0]), _mm_mul_ps(_mm_shuffle_ps(r.rows[1], r.rows[1], _MM_SHUFFLE(1, 1, 1, 1)), l.rows[1])),
+                             _mm_add_ps(_mm_mul_ps(_mm_shuffle_ps(r.rows[1], r.rows[1], _MM_SHUFFLE(2, 2, 2, 2)), l.rows[2]), _mm_mul_ps(_mm_shuffle_ps(r.rows[1], r.rows[1], _MM_SHUFFLE(3, 3, 3, 3)), l.rows[3])));
+    res.rows[2] = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_shuffle_ps(r.rows[2], r.rows[2], _MM_SHUFFLE(0, 0, 0, 0)), l.rows[0]), _mm_mul_ps(_mm_shuffle_ps(r.rows[2], r.rows[2], _MM_SHUFFLE(1, 1, 1, 1)), l.rows[1])),
+                             _mm_add_ps(_mm_mul_ps(_mm_shuffle_ps(r.rows[2], r.rows[2], _MM_SHUFFLE(2, 2, 2, 2)), l.rows[2]), _mm_mul_ps(_mm_shuffle_ps(r.rows[2], r.rows[2], _MM_SHUFFLE(3, 3, 3, 3)), l.rows[3])));
+    res.rows[3] = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_shuffle_ps(r.rows[3], r.rows[3], _MM_SHUFFLE(0, 0, 0, 0)), l.rows[0]), _mm_mul_ps(_mm_shuffle_ps(r.rows[3], r.rows[3], _MM_SHUFFLE(1, 1, 1, 1)), l.rows[1])),
+                             _mm_add_ps(_mm_mul_ps(_mm_shuffle_ps(r.rows[3], r.rows[3], _MM_SHUFFLE(2, 2, 2, 2)), l.rows[2]), _mm_mul_ps(_mm_shuffle_ps(r.rows[3], r.rows[3], _MM_SHUFFLE(3, 3, 3, 3)), l.rows[3])));
+
+    result = res.mat;
+#elif defined(RAYMATH_SIMD_NEON)
+    // NOTE: Result memory rows are combinations of left memory rows, weighted by right memory rows values
+    union { Matrix mat; float32x4_t rows[4]; } l = { left }, res;
+
+    res.rows[0] = vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(vmulq_n_f32(l.rows[0], right.m0), l.rows[1], right.m4), l.rows[2], right.m8), l.rows[3], right.m12);
+    res.rows[1] = vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(vmulq_n_f32(l.rows[0], right.m1), l.rows[1], right.m5), l.rows[2], right.m9), l.rows[3], right.m13);
+    res.rows[2] = vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(vmulq_n_f32(l.rows[0], right.m2), l.rows[1], right.m6), l.rows[2], right.m10), l.rows[3], right.m14);
+    res.rows[3] = vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(vmulq_n_f32(l.rows[0], right.m3), l.rows[1], right.m7), l.rows[2], right.m11), l.rows[3], right.m15);
+
+    result = res.mat;
+#else
     result.m0 = left.m0*right.m0 + left.m1*right.m4 + left.m2*right.m8 + left.m3*right.m12;
     result.m1 = left.m0*right.m1 + left.m1*right.m5 + left.m2*right.m9 + left.m3*right.m13;
     result.m2 = left.m0*right.m2 + left.m1*right.m6 + left.m2*right.m10 + left.m3*right.m14;
@@ -895,10 +1251,18 @@ RMDEF Matrix MatrixMultiply(Matrix left, Matrix right)
     result.m13 = left.m12*right.m1 + left.m13*right.m5 + left.m14*right.m9 + left.m15*right.m13;
     result.m14 = left.m12*right.m2 + left.m13*right.m6 + left.m14*right.m10 + left.m15*right.m14;
     result.m15 = left.m12*right.m3 + left.m13*right.m7 + left.m14*right.m11 + left.m15*right.m15;
+#endif
 
     return result;
 }
 
+// Multiplies an array of matrices by a given matrix (dst[i] = src[i]*mat), dst can be the same array as src
+RMDEF void MatrixMultiplyArray(Matrix *dst, const Matrix *src, int count, Matrix mat)
+{
+    // NOTE: MatrixMultiply() is inlined, right matrix is kept in registers for all matrices
+    for (int i = 0; i < count; i++) dst[i] = MatrixMultiply(src[i], mat);
+}
+
 // Returns perspective projection matrix
 RMDEF Matrix MatrixFrustum(double left, double right, double bottom, double top, double near, double far)
 {
@@ -1091,6 +1455,30 @@ RMDEF Quaternion QuaternionMultiply(Quaternion q1, Quaternion q2)
 {
     Quaternion result = { 0 };
 
+    // NOTE: SIMD versions compute result = q1.w*q2 + q1.x*(w, -z, y, -x) + q1.y*(z, w, -x, -y) + q1.z*(-y, x, w, -z), with q2 components
+#if defined(RAYMATH_SIMD_SSE)
+    union { Quaternion quat; __m128 v; } b = { q2 }, res;
+    __m128 q = b.v;
+    __m128 qwzyx = _mm_mul_ps(_mm_shuffle_ps(q, q, _MM_SHUFFLE(0, 1, 2, 3)), _mm_setr_ps(1.0f, -1.0f, 1.0f, -1.0f));
+    __m128 qzwxy = _mm_mul_ps(_mm_shuffle_ps(q, q, _MM_SHUFFLE(1, 0, 3, 2)), _mm_setr_ps(1.0f, 1.0f, -1.0f, -1.0f));
+    __m128 qyxwz = _mm_mul_ps(_mm_shuffle_ps(q, q, _MM_SHUFFLE(2, 3, 0, 1)), _mm_setr_ps(-1.0f, 1.0f, 1.0f, -1.0f));
+
+    res.v = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_set1_ps(q1.w), q), _mm_mul_ps(_mm_set1_ps(q1.x), qwzyx)),
+                       _mm_add_ps(_mm_mul_ps(_mm_set1_ps(q1.y), qzwxy), _mm_mul_ps(_mm_set1_ps(q1.z), qyxwz)));
+    result = res.quat;
+#elif defined(RAYMATH_SIMD_NEON)
+    const float signs[3][4] = { { 1.0f, -1.0f, 1.0f, -1.0f }, { 1.0f, 1.0f, -1.0f, -1.0f }, { -1.0f, 1.0f, 1.0f, -1.0f } };
+
+    union { Quaternion quat; float32x4_t v; } b = { q2 }, res;
+    float32x4_t q = b.v;
+    float32x4_t qyxwz = vrev64q_f32(q);
+    float32x4_t qwzyx = vmulq_f32(vcombine_f32(vget_high_f32(qyxwz), vget_low_f32(qyxwz)), vld1q_f32(signs[0]));
+    float32x4_t qzwxy = vmulq_f32(vcombine_f32(vget_high_f32(q), vget_low_f32(q)), vld1q_f32(signs[1]));
+    qyxwz = vmulq_f32(qyxwz, vld1q_f32(signs[2]));
+
+    res.v = vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(vmulq_n_f32(q, q1.w), qwzyx, q1.x), qzwxy, q1.y), qyxwz, q1.z);
+    result = res.quat;
+#else
     float qax = q1.x, qay = q1.y, qaz = q1.z, qaw = q1.w;
     float qbx = q2.x, qby = q2.y, qbz = q2.z, qbw = q2.w;
 
@@ -1098,6 +1486,7 @@ RMDEF Quaternion QuaternionMultiply(Quaternion q1, Quaternion q2)
     result.y = qay*qbw + qaw*qby + qaz*qbx - qax*qbz;
     result.z = qaz*qbw + qaw*qbz + qax*qby - qay*qbx;
     result.w = qaw*qbw - qax*qbx - qay*qby - qaz*qbz;
+#endif
 
     return result;
 }
@@ -1160,6 +1549,13 @@ RMDEF Quaternion QuaternionSlerp(Quaternion q1, Quaternion q2, float amount)
     return result;
 }
 
+// Calculates spherical linear interpolation between two arrays of quaternions, dst can be the same array as q1 or q2
+// NOTE: Useful to blend animation poses, bones rotations interpolated with same amount
+RMDEF void QuaternionSlerpArray(Quaternion *dst, const Quaternion *q1, const Quaternion *q2, int count, float amount)
+{
+    for (int i = 0; i < count; i++) dst[i] = QuaternionSlerp(q1[i], q2[i], amount);
+}
+
 // Calculate quaternion based on the rotation from one vector to another
 RMDEF Quaternion QuaternionFromVector3ToVector3(Vector3 from, Vector3 to)
 {
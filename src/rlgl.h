@@ -32,6 +32,41 @@
 *   #define SUPPORT_VR_SIMULATOR
 *       Support VR simulation functionality (stereo rendering)
 *
+*   #define SUPPORT_VR_SINGLE_PASS
+*       Draw both VR stereo eyes with a single instanced draw call per batch draw, eye matrix is selected
+*       by gl_InstanceID and eye half of the framebuffer by a clip space offset (plus a clip distance)
+*       NOTE: Requires SUPPORT_VR_SIMULATOR, only OpenGL 3.3 Core and default shader batch draws
+*
+*   #define SUPPORT_BATCH_INTERLEAVED
+*       Store default batch vertex data interleaved (position + texcoord + color) in a single VBO,
+*       only one buffer upload is required per batch draw and only one buffer is bound on draw
+*
+*   #define SUPPORT_BATCH_MULTITEXTURE
+*       Bind up to MAX_BATCH_TEXTURE_UNITS textures per draw call on separate texture units and
+*       select the unit per vertex, so interleaved texture usage does not split the batch
+*       NOTE: Requires SUPPORT_BATCH_INTERLEAVED, only used with the default shader
+*
+*   #define SUPPORT_BATCH_STREAMING
+*       Stream default batch vertex data through a ring of buffers (MAX_BATCH_BUFFERING) using
+*       glMapBufferRange() guarded by fences, persistent-mapped if ARB_buffer_storage is available
+*       NOTE: Only OpenGL 3.3 Core, other backends fallback to glBufferSubData() uploads
+*
+*   #define SUPPORT_BATCH_TEXTURE_ARRAYS
+*       Allow batch draws to sample a texture array (rlEnableTextureArray()), array layer is selected
+*       per vertex (rlTexLayer()) so sprites from many frames/tiles are drawn in a single draw call
+*       NOTE: Requires SUPPORT_BATCH_INTERLEAVED, only OpenGL 3.3 Core (not OpenGL 2.1)
+*
+*   #define SUPPORT_THREADED_RECORDING
+*       Keep active render batch and matrix stack per thread, so worker threads can record vertex data
+*       into their own render batches (rlLoadRenderBatch()), merged/drawn later on the GL context thread
+*       NOTE: Thread-local variables access could be slower, only enable it if required
+*
+*   #define SUPPORT_FRAME_CAPTURE
+*       Allow capturing one frame render commands to a file (rlCaptureFrame()): batch flushes vertex
+*       data, meshes draws, state changes and shader uniforms, plus referenced textures and meshes data,
+*       so the frame can be replayed and profiled offline (benchmarks/rlgl_replay.c)
+*       NOTE: Only OpenGL 3.3 and ES2, frame capture is slow, it is intended for profiling only
+*
 *   DEPENDENCIES:
 *       raymath     - 3D math functionality (Vector3, Matrix, Quaternion)
 *       GLAD        - OpenGL extensions loading (OpenGL 3.3 Core only)
@@ -119,11 +154,48 @@
     #define GRAPHICS_API_OPENGL_33
 #endif
 
+// Batch multitexturing stores texture unit per vertex, it requires interleaved vertex data
+#if defined(SUPPORT_BATCH_MULTITEXTURE) && !defined(SUPPORT_BATCH_INTERLEAVED)
+    #undef SUPPORT_BATCH_MULTITEXTURE
+#endif
+
+// Batch streaming requires OpenGL 3.3 Core functionality: glMapBufferRange(), fence sync objects
+#if defined(SUPPORT_BATCH_STREAMING) && !defined(GRAPHICS_API_OPENGL_33)
+    #undef SUPPORT_BATCH_STREAMING
+#endif
+
+// Batch texture arrays require OpenGL 3.0 functionality (sampler2DArray) and a per-vertex layer index
+#if defined(SUPPORT_BATCH_TEXTURE_ARRAYS) && (!defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_21) || !defined(SUPPORT_BATCH_INTERLEAVED))
+    #undef SUPPORT_BATCH_TEXTURE_ARRAYS
+#endif
+
+// Single pass stereo requires OpenGL 3.3 Core functionality: gl_InstanceID, gl_ClipDistance
+#if defined(SUPPORT_VR_SINGLE_PASS) && (!defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_21) || !defined(SUPPORT_VR_SIMULATOR))
+    #undef SUPPORT_VR_SINGLE_PASS
+#endif
+
+// Thread-local storage qualifier
+#if defined(_MSC_VER)
+    #define RL_TLS __declspec(thread)
+#elif defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 201112L) && !defined(__STDC_NO_THREADS__)
+    #define RL_TLS _Thread_local
+#else
+    #define RL_TLS __thread
+#endif
+
+// Recording state variables storage, thread-local with SUPPORT_THREADED_RECORDING
+#if defined(SUPPORT_THREADED_RECORDING)
+    #define RL_THREAD_LOCAL RL_TLS
+#else
+    #define RL_THREAD_LOCAL
+#endif
+
 //----------------------------------------------------------------------------------
 // Defines and Macros
 //----------------------------------------------------------------------------------
+#ifndef MAX_BATCH_ELEMENTS
 #if defined(GRAPHICS_API_OPENGL_11) || defined(GRAPHICS_API_OPENGL_33)
-    // This is the maximum amount of elements (quads) per batch
+    // This is the default amount of elements (quads) per batch, it can be changed with rlSetBatchElements()
     // NOTE: Be careful with text, every letter maps to a quad
     #define MAX_BATCH_ELEMENTS            8192
 #elif defined(GRAPHICS_API_OPENGL_ES2)
@@ -131,12 +203,26 @@
     // NOTE: On HTML5 (emscripten) this is allocated on heap, by default it's only 16MB!...just take care...
     #define MAX_BATCH_ELEMENTS            2048
 #endif
+#endif
 
 #ifndef MAX_BATCH_BUFFERING
-    #define MAX_BATCH_BUFFERING              1      // Max number of buffers for batching (multi-buffering)
+    #if defined(SUPPORT_BATCH_STREAMING) && !defined(GRAPHICS_API_OPENGL_21)
+        #define MAX_BATCH_BUFFERING          3      // Max number of buffers for batching (multi-buffering)
+    #else
+        #define MAX_BATCH_BUFFERING          1      // Max number of buffers for batching (multi-buffering)
+    #endif
+#endif
+#ifndef MAX_MESH_BUFFERING
+    #define MAX_MESH_BUFFERING               3      // Max number of GPU copies of dynamic meshes vertex data (cycled across frames)
+#endif
+#ifndef MAX_BATCH_SHAPES_SDF
+    #define MAX_BATCH_SHAPES_SDF          2048      // Max SDF shapes queued before drawing them (rlDrawShapeSDF())
 #endif
 #define MAX_MATRIX_STACK_SIZE               32      // Max size of Matrix stack
 #define MAX_DRAWCALL_REGISTERED            256      // Max draws by state changes (mode, texture)
+#ifndef MAX_BATCH_TEXTURE_UNITS
+    #define MAX_BATCH_TEXTURE_UNITS          8      // Max texture units bound per draw (SUPPORT_BATCH_MULTITEXTURE)
+#endif
 
 #ifndef DEFAULT_NEAR_CULL_DISTANCE
     #define DEFAULT_NEAR_CULL_DISTANCE    0.01      // Default near cull distance
@@ -145,9 +231,36 @@
     #define DEFAULT_FAR_CULL_DISTANCE   1000.0      // Default far cull distance
 #endif
 
+#ifndef MAX_GPU_ZONES
+    #define MAX_GPU_ZONES                   32      // Maximum number of GPU timing zones per frame (rlBeginGpuZone())
+#endif
+#ifndef MAX_UNIFORM_BLOCKS
+    #define MAX_UNIFORM_BLOCKS               8      // Maximum number of user uniform blocks (LoadShaderBlock())
+#endif
+#ifndef MAX_TEXTURE_UPLOADS
+    #define MAX_TEXTURE_UPLOADS              4      // Maximum number of asynchronous texture uploads in flight (rlUpdateTextureAsync())
+#endif
+#ifndef MAX_SCREEN_READBACKS
+    #define MAX_SCREEN_READBACKS             3      // Maximum number of asynchronous screen readbacks in flight (rlReadScreenPixelsAsync())
+#endif
+#ifndef MAX_RENDER_TEXTURE_POOL
+    #define MAX_RENDER_TEXTURE_POOL         16      // Maximum number of render textures kept by pool (rlGetPooledRenderTexture())
+#endif
+#ifndef RENDER_TEXTURE_POOL_IDLE_FRAMES
+    #define RENDER_TEXTURE_POOL_IDLE_FRAMES 120     // Frames a released pooled render texture is kept before unloading it
+#endif
+
 // Shader and material limits
 #define MAX_SHADER_LOCATIONS                32      // Maximum number of predefined locations stored in shader struct
 #define MAX_MATERIAL_MAPS                   12      // Maximum number of texture maps stored in shader struct
+#define MAX_VERTEX_ATTRIBS_CACHED           16      // Maximum vertex attributes tracked without VAO support (GL ES 2.0 guarantees 8)
+#ifndef MAX_SHADER_BONES
+  #if defined(GRAPHICS_API_OPENGL_ES2)
+    #define MAX_SHADER_BONES                30      // Maximum number of bone matrices for GPU skinning (ES2 guarantees 128 vertex uniform vectors)
+  #else
+    #define MAX_SHADER_BONES               128      // Maximum number of bone matrices for GPU skinning
+  #endif
+#endif
 
 // Texture parameters (equivalent to OpenGL defines)
 #define RL_TEXTURE_WRAP_S               0x2802      // GL_TEXTURE_WRAP_S
@@ -174,6 +287,7 @@
 #define RL_TEXTURE                      0x1702      // GL_TEXTURE
 
 // Primitive assembly draw modes
+#define RL_POINTS                       0x0000      // GL_POINTS
 #define RL_LINES                        0x0001      // GL_LINES
 #define RL_TRIANGLES                    0x0004      // GL_TRIANGLES
 #define RL_QUADS                        0x0007      // GL_QUADS
@@ -185,6 +299,139 @@ typedef enum { OPENGL_11 = 1, OPENGL_21, OPENGL_33, OPENGL_ES_20 } GlVersion;
 
 typedef unsigned char byte;
 
+// GPU timing zone result, measured by rlBeginGpuZone()/rlEndGpuZone()
+typedef struct GpuZoneTime {
+    const char *name;           // Zone name (as provided to rlBeginGpuZone())
+    int depth;                  // Zone nesting level (0 for top level zones)
+    float time;                 // GPU time spent on zone commands (in milliseconds)
+} GpuZoneTime;
+
+// Memory barriers, make compute shaders writes visible to following commands (rlMemoryBarrier())
+// NOTE: Values match OpenGL barrier bits, they can be combined
+typedef enum {
+    BARRIER_VERTEX_ATTRIB = 0x0001,     // Vertex attributes read from written buffers (i.e. mesh vertex buffers)
+    BARRIER_INDEX = 0x0002,             // Indices read from written buffers
+    BARRIER_UNIFORM = 0x0004,           // Uniform blocks read from written buffers
+    BARRIER_TEXTURE_FETCH = 0x0008,     // Textures sampled after image writes
+    BARRIER_IMAGE_ACCESS = 0x0020,      // Images load/store after image writes
+    BARRIER_BUFFER_UPDATE = 0x0200,     // Buffers read/updated from CPU (rlReadShaderBuffer(), rlUpdateShaderBuffer())
+    BARRIER_SHADER_STORAGE = 0x2000,    // Shader storage buffers load/store after buffer writes
+    BARRIER_ALL = 0x7fffffff            // All previous writes
+} MemoryBarrierType;
+
+// Texture used for drawing callback (rlEnableTexture(), mesh material maps), i.e. residency tracking
+typedef void (*rlTextureUseCallback)(unsigned int id);
+
+// Render batch type (opaque), vertex buffers and draw calls filled by rlgl vertex functions
+typedef struct RenderBatch RenderBatch;
+
+// Frame capture file (rlCaptureFrame()): CaptureHeader followed by commands,
+// every command is stored as: type (int, CaptureCommandType), data size (int), data
+#define CAPTURE_FILE_VERSION    2
+
+// Frame capture commands
+typedef enum {
+    CAPTURE_TEXTURE = 0,        // Texture first referenced: CaptureTexture
+    CAPTURE_MESH,               // Mesh first referenced: CaptureMesh, vertex data arrays (CaptureMesh.dataFlags)
+    CAPTURE_BATCH,              // Batch flush: CaptureBatch, CaptureVertex array, CaptureDraw array
+    CAPTURE_DRAW_MESH,          // Mesh draw: CaptureMeshDraw, instances transforms (Matrix array, if instanced)
+    CAPTURE_STATE,              // State change: CaptureState
+    CAPTURE_UNIFORM             // Shader uniform value: CaptureUniform, value data
+} CaptureCommandType;
+
+// Frame capture state changes
+typedef enum {
+    CAPTURE_STATE_DEPTH_TEST = 0,   // values[0]: enabled
+    CAPTURE_STATE_BACKFACE_CULLING, // values[0]: enabled
+    CAPTURE_STATE_SCISSOR_TEST,     // values[0]: enabled
+    CAPTURE_STATE_SCISSOR,          // values: x, y, width, height
+    CAPTURE_STATE_WIRE_MODE,        // values[0]: enabled
+    CAPTURE_STATE_BLEND_MODE,       // values[0]: blend mode
+    CAPTURE_STATE_VIEWPORT,         // values: x, y, width, height
+    CAPTURE_STATE_RENDER_TEXTURE,   // values: framebuffer id (0 for default framebuffer), width, height (0 if unknown)
+    CAPTURE_STATE_CLEAR_COLOR,      // values: r, g, b, a
+    CAPTURE_STATE_CLEAR             // Screen buffers cleared (color and depth)
+} CaptureStateType;
+
+// Frame capture mesh data arrays flags (stored in this order)
+typedef enum {
+    CAPTURE_MESH_VERTICES = 1,      // Positions, 3 floats per vertex
+    CAPTURE_MESH_TEXCOORDS = 2,     // Texture coordinates, 2 floats per vertex
+    CAPTURE_MESH_NORMALS = 4,       // Normals, 3 floats per vertex
+    CAPTURE_MESH_COLORS = 8,        // Colors, 4 unsigned char per vertex
+    CAPTURE_MESH_INDICES = 16       // Indices, 3 unsigned short per triangle
+} CaptureMeshDataFlags;
+
+typedef struct CaptureHeader {
+    char id[4];                 // Capture file identifier: "rlFC"
+    int version;                // Capture file version (CAPTURE_FILE_VERSION)
+    int width;                  // Default framebuffer width
+    int height;                 // Default framebuffer height
+    unsigned int defaultTextureId;  // Default texture id (shapes drawing)
+    unsigned int defaultShaderId;   // Default shader program id
+} CaptureHeader;
+
+typedef struct CaptureTexture {
+    unsigned int id;            // Texture id
+    int width;                  // Texture width (0 if unknown)
+    int height;                 // Texture height (0 if unknown)
+} CaptureTexture;
+
+typedef struct CaptureMesh {
+    unsigned int id;            // Mesh id (vertex array id or vertex buffer id)
+    int vertexCount;            // Number of vertices
+    int triangleCount;          // Number of triangles
+    int dataFlags;              // Vertex data arrays stored (CaptureMeshDataFlags)
+} CaptureMesh;
+
+typedef struct CaptureVertex {
+    float position[3];          // Vertex position (transformed by rlgl internal transform)
+    float texcoord[2];          // Vertex texture coordinates
+    unsigned char color[4];     // Vertex color
+} CaptureVertex;
+
+typedef struct CaptureDraw {
+    int mode;                   // Drawing mode: RL_LINES, RL_TRIANGLES, RL_QUADS
+    int vertexCount;            // Number of vertices of the draw
+    int vertexAlignment;        // Number of padding vertices after the draw vertices
+    unsigned int textureId;     // Texture id
+    int blendMode;              // Blending mode
+    int scissorTest;            // Scissor test enabled
+    int scissor[4];             // Scissor rectangle: x, y, width, height
+} CaptureDraw;
+
+typedef struct CaptureBatch {
+    unsigned int shaderId;      // Shader program id
+    Matrix modelview;           // Modelview matrix
+    Matrix projection;          // Projection matrix
+    int vertexCount;            // Number of vertices (padding vertices included)
+    int drawsCount;             // Number of draw calls
+} CaptureBatch;
+
+typedef struct CaptureMeshDraw {
+    unsigned int meshId;        // Mesh id (CaptureMesh)
+    unsigned int shaderId;      // Shader program id
+    unsigned int textureIds[MAX_MATERIAL_MAPS]; // Material maps texture ids
+    unsigned char color[4];     // Material diffuse color
+    Matrix transform;           // Mesh transform
+    Matrix modelview;           // Modelview matrix (view with rlgl internal transform)
+    Matrix projection;          // Projection matrix
+    int instances;              // Number of instances (0 if not instanced), transforms stored after
+} CaptureMeshDraw;
+
+typedef struct CaptureState {
+    int state;                  // State changed (CaptureStateType)
+    int values[4];              // State values
+} CaptureState;
+
+typedef struct CaptureUniform {
+    unsigned int shaderId;      // Shader program id
+    int location;               // Uniform location
+    int type;                   // Uniform type (ShaderUniformDataType, -1 for matrix)
+    int count;                  // Number of values
+    int size;                   // Value data size in bytes
+} CaptureUniform;
+
 #if defined(RLGL_STANDALONE)
     #ifndef __cplusplus
     // Boolean type
@@ -199,6 +446,14 @@ typedef unsigned char byte;
         unsigned char a;
     } Color;
 
+    // Rectangle type
+    typedef struct Rectangle {
+        float x;
+        float y;
+        float width;
+        float height;
+    } Rectangle;
+
     // Texture2D type
     // NOTE: Data stored in GPU memory
     typedef struct Texture2D {
@@ -241,12 +496,19 @@ typedef unsigned char byte;
         // Animation vertex data
         float *animVertices;    // Animated vertex positions (after bones transformations)
         float *animNormals;     // Animated normals (after bones transformations)
-        int *boneIds;           // Vertex bone ids, up to 4 bones influence by vertex (skinning)
-        float *boneWeights;     // Vertex bone weight, up to 4 bones influence by vertex (skinning)
+        int *boneIds;           // Vertex bone ids, up to 4 bones influence by vertex (skinning) (shader-location = 6)
+        float *boneWeights;     // Vertex bone weight, up to 4 bones influence by vertex (skinning) (shader-location = 7)
+        int boneCount;          // Number of bone matrices for GPU skinning (0 if mesh is not skinned on GPU)
+        Matrix *boneMatrices;   // Bones transformations for GPU skinning (UpdateModelAnimationBones())
+
+        // Collision data
+        void *bvh;              // Bounding volume hierarchy for collision queries (MeshBuildBVH())
 
         // OpenGL identifiers
         unsigned int vaoId;     // OpenGL Vertex Array Object id
-        unsigned int *vboId;    // OpenGL Vertex Buffer Objects id (7 types of vertex data)
+        unsigned int *vboId;    // OpenGL Vertex Buffer Objects id (9 types of vertex data)
+        void *stream;           // Dynamic mesh GPU buffers copies state, cycled across frames (rlLoadMesh() dynamic)
+        int vertexFormat;       // Vertex attributes GPU storage formats (MeshVertexFormat flags, requested before rlLoadMesh())
     } Mesh;
 
     // Shader and material limits
@@ -281,6 +543,29 @@ typedef unsigned char byte;
         float fovy;             // Camera field-of-view apperture in Y (degrees)
     } Camera;
 
+    // Render statistics, counted by rlgl every frame
+    typedef struct RenderStats {
+        int drawCalls;              // Draw calls issued (internal batch draws and meshes)
+        int vertexCount;            // Vertices drawn (internal batch and meshes)
+        int batchFlushes;           // Internal batch flushes with vertex data to draw
+        int flushesBufferFull;      // Batch flushes forced by vertex buffer full (MAX_BATCH_ELEMENTS)
+        int flushesTextureChange;   // Batch flushes forced on texture change by draw calls limit (MAX_DRAWCALL_REGISTERED)
+        int flushesModeChange;      // Batch flushes forced on draw mode change by draw calls limit (MAX_DRAWCALL_REGISTERED)
+        int flushesStateChange;     // Batch flushes requested on state change (shader, blending, render target, matrices...)
+        int textureBinds;           // Textures bound for drawing
+        int shaderSwitches;         // Shader program changes for drawing
+        int uploadedBytes;          // Vertex data uploaded to GPU buffers (in bytes)
+        int attribUpdates;          // Vertex attributes pointers set (without VAO support, redundant ones are skipped)
+    } RenderStats;
+
+    // Memory usage, of GPU resources kind
+    typedef struct MemoryUsage {
+        unsigned long long bytes;       // Memory in use (in bytes)
+        unsigned long long peakBytes;   // Peak memory in use (in bytes)
+        unsigned int count;             // Objects alive
+        unsigned int totalCount;        // Objects loaded since program start
+    } MemoryUsage;
+
     // Head-Mounted-Display device parameters
     typedef struct VrDeviceInfo {
         int hResolution;                // HMD horizontal resolution in pixels
@@ -358,7 +643,8 @@ typedef unsigned char byte;
     typedef enum {
         BLEND_ALPHA = 0,
         BLEND_ADDITIVE,
-        BLEND_MULTIPLIED
+        BLEND_MULTIPLIED,
+        BLEND_ALPHA_TARGET
     } BlendMode;
 
     // Shader location point type
@@ -387,7 +673,11 @@ typedef unsigned char byte;
         LOC_MAP_CUBEMAP,
         LOC_MAP_IRRADIANCE,
         LOC_MAP_PREFILTER,
-        LOC_MAP_BRDF
+        LOC_MAP_BRDF,
+        LOC_VERTEX_INSTANCE_TX,
+        LOC_VERTEX_BONEIDS,
+        LOC_VERTEX_BONEWEIGHTS,
+        LOC_MATRIX_BONES
     } ShaderLocationIndex;
 
     // Shader uniform data types
@@ -403,6 +693,15 @@ typedef unsigned char byte;
         UNIFORM_SAMPLER2D
     } ShaderUniformDataType;
 
+    // Mesh vertex attributes GPU storage formats (flags)
+    typedef enum {
+        MESH_FORMAT_DEFAULT = 0,
+        MESH_FORMAT_POSITION_HALF = 1,
+        MESH_FORMAT_TEXCOORD_SNORM16 = 2,
+        MESH_FORMAT_NORMAL_PACKED = 4,
+        MESH_FORMAT_COMPACT = 7
+    } MeshVertexFormat;
+
     #define LOC_MAP_DIFFUSE      LOC_MAP_ALBEDO
     #define LOC_MAP_SPECULAR     LOC_MAP_METALNESS
 
@@ -457,12 +756,19 @@ RLAPI void rlNormal3f(float x, float y, float z);     // Define one vertex (norm
 RLAPI void rlColor4ub(byte r, byte g, byte b, byte a);    // Define one vertex (color) - 4 byte
 RLAPI void rlColor3f(float x, float y, float z);          // Define one vertex (color) - 3 float
 RLAPI void rlColor4f(float x, float y, float z, float w); // Define one vertex (color) - 4 float
+RLAPI void rlTexLayer(int layer);                         // Define texture array layer for next vertices (rlEnableTextureArray())
+RLAPI void rlVertex3fv(const float *vertices, int count); // Define multiple vertex (position) - 3 float per vertex
+RLAPI void rlQuadBatch(const float *vertices, const float *texcoords, const unsigned char *colors, int quadCount);  // Define multiple quads vertex data (position, texcoords and colors optional)
+RLAPI void rlVertexBatch(const float *vertices, const float *texcoords, const unsigned char *colors, int count);    // Define multiple vertex data, any draw mode (position, texcoords and colors optional)
+RLAPI void rlSetPointSize(float size);                    // Set points size in pixels (RL_POINTS drawing)
+RLAPI bool rlDrawShapeSDF(Vector2 center, Vector2 halfSize, float rotation, float radius, float thickness, Color color);  // Queue a 2D rounded box shape evaluated on GPU (one quad), returns false if not supported
 
 //------------------------------------------------------------------------------------
 // Functions Declaration - OpenGL equivalent functions (common to 1.1, 3.3+, ES2)
 // NOTE: This functions are used to completely abstract raylib code from OpenGL layer
 //------------------------------------------------------------------------------------
 RLAPI void rlEnableTexture(unsigned int id);                  // Enable texture usage
+RLAPI void rlEnableTextureArray(unsigned int id);             // Enable texture array usage, layer selected per vertex with rlTexLayer()
 RLAPI void rlDisableTexture(void);                            // Disable texture usage
 RLAPI void rlTextureParameters(unsigned int id, int param, int value); // Set texture parameters (filter, wrap)
 RLAPI void rlEnableRenderTexture(unsigned int id);            // Enable render texture (fbo)
@@ -476,6 +782,9 @@ RLAPI void rlDisableScissorTest(void);                        // Disable scissor
 RLAPI void rlScissor(int x, int y, int width, int height);    // Scissor test
 RLAPI void rlEnableWireMode(void);                            // Enable wire mode
 RLAPI void rlDisableWireMode(void);                           // Disable wire mode
+RLAPI void rlEnableDrawSorting(void);                         // Enable draw calls sorting and merging (by layer, texture, mode) before batch draw
+RLAPI void rlDisableDrawSorting(void);                        // Disable draw calls sorting, submit them in order (default)
+RLAPI void rlSetDrawLayer(int layer);                         // Set layer for next draw calls, lower layers are drawn first when sorting
 RLAPI void rlDeleteTextures(unsigned int id);                 // Delete OpenGL texture from GPU
 RLAPI void rlDeleteRenderTextures(RenderTexture2D target);    // Delete render textures (fbo) from GPU
 RLAPI void rlDeleteShader(unsigned int id);                   // Delete OpenGL shader program from GPU
@@ -495,34 +804,93 @@ RLAPI void rlglDraw(void);                            // Update and draw default
 
 RLAPI int rlGetVersion(void);                         // Returns current OpenGL version
 RLAPI bool rlCheckBufferLimit(int vCount);            // Check internal buffer overflow for a given number of vertex
+RLAPI void rlSetBatchElements(int elements);          // Set internal batch capacity (elements/quads), reloads internal buffers
+RLAPI int rlGetBatchElements(void);                   // Get internal batch capacity (elements/quads)
+RLAPI float rlGetCurrentDepth(void);                  // Get depth value used by next 2D vertex (rlVertex2f())
+RLAPI RenderBatch *rlLoadRenderBatch(int elements);   // Load render batch (elements/quads), its vertex data is kept until reset
+RLAPI void rlUnloadRenderBatch(RenderBatch *batch);   // Unload render batch
+RLAPI void rlSetRenderBatchActive(RenderBatch *batch);    // Set render batch receiving vertex data (NULL for default batch)
+RLAPI void rlDrawRenderBatch(RenderBatch *batch);     // Draw render batch vertex data
+RLAPI void rlResetRenderBatch(RenderBatch *batch);    // Reset render batch vertex data and draw calls
+RLAPI void rlMergeRenderBatch(RenderBatch *batch);    // Append render batch vertex data and draw calls to active batch
 RLAPI void rlSetDebugMarker(const char *text);        // Set debug marker for analysis
+RLAPI void rlBeginGpuZone(const char *name);          // Begin GPU timing zone (nestable, name must remain valid)
+RLAPI void rlEndGpuZone(void);                        // End GPU timing zone
+RLAPI void rlUpdateGpuZones(void);                    // Swap GPU timing zones frame and collect available results (called by EndDrawing())
+RLAPI const GpuZoneTime *rlGetGpuZones(int *count);   // Get GPU timing zones results of latest measured frame
+RLAPI void rlUpdateRenderStats(void);                 // Store current frame render statistics and reset counters (called by EndDrawing())
+RLAPI void rlCaptureFrame(const char *fileName);      // Capture next frame render commands to file (SUPPORT_FRAME_CAPTURE, replay: rlgl_replay)
+RLAPI void rlGetVideoMemoryUsage(MemoryUsage *textures, MemoryUsage *buffers);    // Get GPU memory usage of textures and buffers (estimated from formats and sizes)
+RLAPI void rlUpdateMeshFences(void);                  // Place frame fence for dynamic meshes buffers copies and move to next frame (called by EndDrawing())
+RLAPI void rlSetFrameTime(float time);                // Set frame uniform block time value (called by BeginDrawing())
 RLAPI void rlLoadExtensions(void *loader);            // Load OpenGL extensions
+RLAPI void rlBeginLoaderContext(void);                // Set calling thread as resources loader (shared context current), render state is not modified
+RLAPI void rlEndLoaderContext(void);                  // Wait loader thread GPU commands completion (fence), resources can be used on render thread
+RLAPI bool rlIsLoaderContext(void);                   // Check if calling thread is a resources loader
 RLAPI Vector3 rlUnproject(Vector3 source, Matrix proj, Matrix view);  // Get world coordinates from screen coordinates
+RLAPI bool rlCheckBoxInFrustum(Vector3 min, Vector3 max, Matrix transform);  // Check if box (local space) is inside current view frustum after transform
 
 // Textures data management
+RLAPI bool rlIsTextureFormatSupported(int format);                      // Check if texture (pixel) format can be loaded in GPU
+RLAPI int rlGetPreferredCompressedFormat(bool alpha);                   // Get best GPU compressed format supported (-1 if none)
 RLAPI unsigned int rlLoadTexture(void *data, int width, int height, int format, int mipmapCount); // Load texture in GPU
 RLAPI unsigned int rlLoadTextureDepth(int width, int height, int bits, bool useRenderBuffer);     // Load depth texture/renderbuffer (to be attached to fbo)
 RLAPI unsigned int rlLoadTextureCubemap(void *data, int size, int format);                        // Load texture cubemap
+RLAPI unsigned int rlLoadTextureArray(void *data, int width, int height, int layers, int format);   // Load texture array (layers data packed consecutively)
 RLAPI void rlUpdateTexture(unsigned int id, int width, int height, int format, const void *data); // Update GPU texture with new data
+RLAPI void rlUpdateTextureRec(unsigned int id, int offsetX, int offsetY, int width, int height, int format, const void *data);  // Update GPU texture rectangle with new data
+RLAPI void rlUpdateTextureMipmap(unsigned int id, int level, int offsetY, int width, int height, int format, const void *data);  // Update GPU texture mipmap level rows (compressed formats: whole level)
+RLAPI void rlSetTextureMipmapRange(unsigned int id, int baseLevel, int maxLevel);  // Set texture mipmap levels sampled (OpenGL 3.3 only)
+RLAPI void rlUpdateTextureAsync(unsigned int id, int width, int height, int format, const void *data);  // Update GPU texture with new data through pixel buffer (no waiting for GPU copy)
+RLAPI bool rlIsTextureUpdated(unsigned int id);                           // Check if texture asynchronous updates are completed
 RLAPI void rlGetGlTextureFormats(int format, unsigned int *glInternalFormat, unsigned int *glFormat, unsigned int *glType);  // Get OpenGL internal formats
 RLAPI void rlUnloadTexture(unsigned int id);                              // Unload texture from GPU memory
+RLAPI void rlReleaseTextureStorage(unsigned int id, int mipmapCount);     // Release texture data from GPU memory, texture id is kept (1x1 white texel)
+RLAPI bool rlReloadTexture(unsigned int id, void *data, int width, int height, int format, int mipmapCount);  // Reload texture data into existing texture id (released or resized)
+RLAPI void rlSetTextureUseCallback(rlTextureUseCallback callback);        // Set callback called before a texture is used for drawing
 
 RLAPI void rlGenerateMipmaps(Texture2D *texture);                         // Generate mipmap data for selected texture
+RLAPI void rlGenNextMipmap(const unsigned char *srcData, int srcWidth, int srcHeight, int channels, unsigned char *dstData);  // Generate next mipmap level data on CPU (box filter, 8 bit channels)
 RLAPI void *rlReadTexturePixels(Texture2D texture);                       // Read texture pixel data
+RLAPI bool rlReadTexturePixelsEx(Texture2D texture, void *pixels);        // Read texture pixel data into provided buffer (texture format size, RGBA on OpenGL ES 2.0)
 RLAPI unsigned char *rlReadScreenPixels(int width, int height);           // Read screen pixel data (color buffer)
+RLAPI unsigned int rlReadScreenPixelsAsync(int width, int height);        // Request screen pixel data reading without waiting for GPU, returns request id (0 if not available)
+RLAPI unsigned char *rlGetScreenPixelsAsync(unsigned int requestId, bool wait);  // Get requested screen pixel data (NULL if not ready yet)
+RLAPI unsigned int rlReadFramebufferPixelsAsync(unsigned int id, int width, int height);  // Request framebuffer (fbo) pixel data reading without waiting for GPU, read with rlGetScreenPixelsAsync()
 
 // Render texture management (fbo)
 RLAPI RenderTexture2D rlLoadRenderTexture(int width, int height, int format, int depthBits, bool useDepthTexture);    // Load a render texture (with color and depth attachments)
 RLAPI void rlRenderTextureAttach(RenderTexture target, unsigned int id, int attachType);  // Attach texture/renderbuffer to an fbo
 RLAPI bool rlRenderTextureComplete(RenderTexture target);                 // Verify render texture is complete
+RLAPI RenderTexture2D rlGetPooledRenderTexture(int width, int height, int format, int depthBits, bool useDepthTexture);  // Get a transient render texture from pool (loaded if no free one matches)
+RLAPI void rlReleasePooledRenderTexture(RenderTexture2D target);          // Return a transient render texture to pool
+RLAPI void rlUpdateRenderTexturePool(void);                               // Unload pooled render textures not used for a while (called by EndDrawing())
 
 // Vertex data management
 RLAPI void rlLoadMesh(Mesh *mesh, bool dynamic);                          // Upload vertex data into GPU and provided VAO/VBO ids
+RLAPI void rlLoadMeshVertexArray(Mesh *mesh);                             // Load vertex array (VAO) of mesh uploaded on loader context (render thread)
 RLAPI void rlUpdateMesh(Mesh mesh, int buffer, int num);                  // Update vertex or index data on GPU (upload new data to one buffer)
 RLAPI void rlUpdateMeshAt(Mesh mesh, int buffer, int num, int index);     // Update vertex or index data on GPU, at index
+RLAPI void rlUpdateMeshRange(Mesh mesh, int index, int count);            // Update all vertex attributes data on GPU for vertices range
 RLAPI void rlDrawMesh(Mesh mesh, Material material, Matrix transform);    // Draw a 3d mesh with material and transform
+RLAPI void rlDrawMeshInstanced(Mesh mesh, Material material, const Matrix *transforms, int instances); // Draw multiple mesh instances with material and different transforms
+RLAPI void rlDrawBillboards(Texture2D texture, const Vector3 *positions, const Vector2 *sizes, const Color *colors, const Rectangle *sources, int count, Vector3 right, Vector3 up); // Draw billboards quads facing right/up axis (expanded on GPU if instancing supported)
 RLAPI void rlUnloadMesh(Mesh mesh);                                       // Unload mesh data from CPU and GPU
 
+// Compute shaders and shader storage buffers management (OpenGL 4.3 required)
+// NOTE: Any GPU buffer can be bound as shader storage buffer, i.e. mesh vertex buffers written by compute shaders
+RLAPI bool rlIsComputeSupported(void);                                    // Check if compute shaders and shader storage buffers are supported
+RLAPI unsigned int rlLoadComputeShader(const char *csCode);               // Load compute shader program from code string (returns program id, 0 on failure)
+RLAPI void rlUnloadComputeShader(unsigned int id);                        // Unload compute shader program
+RLAPI void rlDispatchCompute(unsigned int id, unsigned int groupsX, unsigned int groupsY, unsigned int groupsZ);  // Dispatch compute shader program work groups
+RLAPI void rlMemoryBarrier(int barriers);                                 // Wait compute shaders writes visible to following commands (MemoryBarrierType flags)
+RLAPI unsigned int rlLoadShaderBuffer(int size, const void *data, bool dynamic);  // Load shader storage buffer (SSBO), data can be NULL
+RLAPI void rlUpdateShaderBuffer(unsigned int id, const void *data, int size, int offset);  // Update shader storage buffer data (at offset in bytes)
+RLAPI void rlReadShaderBuffer(unsigned int id, void *dest, int size, int offset);  // Read shader storage buffer data (waits for GPU)
+RLAPI void rlBindShaderBuffer(unsigned int id, int index);                // Bind buffer to shader storage binding point (layout(binding = index))
+RLAPI void rlUnloadShaderBuffer(unsigned int id);                         // Unload shader storage buffer
+RLAPI void rlBindImageTexture(unsigned int id, int index, int format, bool readOnly);  // Bind texture (level 0) to image unit for compute shaders load/store
+
 // NOTE: There is a set of shader related functions that are available to end user,
 // to avoid creating function wrappers through core module, they have been directly declared in raylib.h
 
@@ -536,8 +904,10 @@ RLAPI char *LoadText(const char *fileName);                               // Loa
 RLAPI Shader LoadShader(const char *vsFileName, const char *fsFileName);  // Load shader from files and bind default locations
 RLAPI Shader LoadShaderCode(const char *vsCode, const char *fsCode);                  // Load shader from code strings and bind default locations
 RLAPI void UnloadShader(Shader shader);                                   // Unload shader from GPU memory (VRAM)
+RLAPI void SetShaderCacheDirectory(const char *dirPath);                  // Set shader program binaries cache directory (NULL to disable)
 
 RLAPI Shader GetShaderDefault(void);                                      // Get default shader
+RLAPI Shader GetShaderSkinning(void);                                     // Get default skinning shader (used instead of default shader for GPU skinned meshes)
 RLAPI Texture2D GetTextureDefault(void);                                  // Get default texture
 
 // Shader configuration functions
@@ -545,6 +915,10 @@ RLAPI int GetShaderLocation(Shader shader, const char *uniformName);
 RLAPI void SetShaderValue(Shader shader, int uniformLoc, const void *value, int uniformType);               // Set shader uniform value
 RLAPI void SetShaderValueV(Shader shader, int uniformLoc, const void *value, int uniformType, int count);   // Set shader uniform value vector
 RLAPI void SetShaderValueMatrix(Shader shader, int uniformLoc, Matrix mat);       // Set shader uniform value (matrix 4x4)
+RLAPI unsigned int LoadShaderBlock(const char *blockName, const void *data, int size);    // Load uniform block buffer shared by all shaders (OpenGL 3.3)
+RLAPI void UpdateShaderBlock(unsigned int blockId, const void *data, int size, int offset); // Update uniform block buffer data
+RLAPI void UnloadShaderBlock(unsigned int blockId);                       // Unload uniform block buffer
+RLAPI void SetShaderBlocks(Shader shader);                                // Bind frame and loaded uniform blocks to shader
 RLAPI void SetMatrixProjection(Matrix proj);                              // Set a custom projection matrix (replaces internal projection matrix)
 RLAPI void SetMatrixModelview(Matrix view);                               // Set a custom modelview matrix (replaces internal modelview matrix)
 RLAPI Matrix GetMatrixModelview(void);                                    // Get internal modelview matrix
@@ -555,6 +929,8 @@ RLAPI Texture2D GenTextureCubemap(Shader shader, Texture2D map, int size);
 RLAPI Texture2D GenTextureIrradiance(Shader shader, Texture2D cubemap, int size);   // Generate irradiance texture using cubemap data
 RLAPI Texture2D GenTexturePrefilter(Shader shader, Texture2D cubemap, int size);    // Generate prefilter texture using cubemap data
 RLAPI Texture2D GenTextureBRDF(Shader shader, int size);                  // Generate BRDF texture using cubemap data
+RLAPI bool ExportTextureIBL(Texture2D texture, bool isCubemap, const char *fileName);   // Export generated IBL texture (cubemap or BRDF LUT, all mipmaps) to KTX file
+RLAPI Texture2D LoadTextureIBL(const char *fileName);                     // Load IBL texture from KTX file (cubemap if file stores 6 faces)
 
 // Shading begin/end functions
 RLAPI void BeginShaderMode(Shader shader);              // Begin custom shader drawing
@@ -562,6 +938,9 @@ RLAPI void EndShaderMode(void);                         // End custom shader dra
 RLAPI void BeginBlendMode(int mode);                    // Begin blending mode (alpha, additive, multiplied)
 RLAPI void EndBlendMode(void);                          // End blending mode (reset to default: alpha blending)
 
+// Render statistics functions
+RLAPI RenderStats GetRenderStats(void);                 // Get render statistics of last frame (draw calls, vertices, batch flushes...)
+
 // VR control functions
 RLAPI void InitVrSimulator(void);                       // Init VR simulator for selected device parameters
 RLAPI void CloseVrSimulator(void);                      // Close VR simulator for current device
@@ -597,10 +976,37 @@ RLAPI int GetPixelDataSize(int width, int height, int format);// Get pixel data
     #endif
 #endif
 
+// NOTE: config.h defines again batch flags that could have been disabled on header, check them again
+#if defined(SUPPORT_BATCH_MULTITEXTURE) && !defined(SUPPORT_BATCH_INTERLEAVED)
+    #undef SUPPORT_BATCH_MULTITEXTURE
+#endif
+#if defined(SUPPORT_BATCH_STREAMING) && !defined(GRAPHICS_API_OPENGL_33)
+    #undef SUPPORT_BATCH_STREAMING
+#endif
+#if defined(SUPPORT_BATCH_TEXTURE_ARRAYS) && (!defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_21) || !defined(SUPPORT_BATCH_INTERLEAVED))
+    #undef SUPPORT_BATCH_TEXTURE_ARRAYS
+#endif
+#if defined(SUPPORT_FRAME_CAPTURE) && defined(GRAPHICS_API_OPENGL_11)
+    #undef SUPPORT_FRAME_CAPTURE
+#endif
+#if defined(SUPPORT_VR_SINGLE_PASS) && (!defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_21) || !defined(SUPPORT_VR_SIMULATOR))
+    #undef SUPPORT_VR_SINGLE_PASS
+#endif
+
 #include <stdio.h>                  // Required for: fopen(), fclose(), fread()... [Used only on LoadText()]
 #include <stdlib.h>                 // Required for: malloc(), free(), rand()
 #include <string.h>                 // Required for: strcmp(), strlen(), strtok() [Used only in extensions loading]
 #include <math.h>                   // Required for: atan2()
+#include <stddef.h>                 // Required for: offsetof() [Used by SUPPORT_BATCH_INTERLEAVED and rlDrawBillboards()]
+
+// SIMD instructions used to transform vertex in bulk (rlVertex3fv(), rlQuadBatch())
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 1))
+    #include <xmmintrin.h>          // Required for: SSE intrinsics
+    #define RLGL_SIMD_SSE
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+    #include <arm_neon.h>           // Required for: NEON intrinsics
+    #define RLGL_SIMD_NEON
+#endif
 
 #if !defined(RLGL_STANDALONE)
     #include "raymath.h"            // Required for: Vector3 and Matrix functions
@@ -659,6 +1065,21 @@ RLAPI int GetPixelDataSize(int width, int height, int format);// Get pixel data
 //----------------------------------------------------------------------------------
 // Defines and Macros
 //----------------------------------------------------------------------------------
+// GPU memory tracking is shared with resources loader thread, protected by a spin lock
+#if defined(_MSC_VER)
+    #include <intrin.h>                 // Required for: _InterlockedExchange()
+    #define VIDEO_MEMORY_LOCK()         while (_InterlockedExchange(&videoMemoryLock, 1) != 0) { }
+    #define VIDEO_MEMORY_UNLOCK()       _InterlockedExchange(&videoMemoryLock, 0)
+#else
+    #define VIDEO_MEMORY_LOCK()         while (__sync_lock_test_and_set(&videoMemoryLock, 1) != 0) { }
+    #define VIDEO_MEMORY_UNLOCK()       __sync_lock_release(&videoMemoryLock)
+#endif
+
+// GPU memory tracking resources kinds, every kind is a different OpenGL object names space
+#define VIDEO_MEMORY_TEXTURE            0
+#define VIDEO_MEMORY_RENDERBUFFER       1
+#define VIDEO_MEMORY_BUFFER             2
+
 #ifndef GL_SHADING_LANGUAGE_VERSION
     #define GL_SHADING_LANGUAGE_VERSION         0x8B8C
 #endif
@@ -705,10 +1126,46 @@ RLAPI int GetPixelDataSize(int width, int height, int format);// Get pixel data
     #define GL_TEXTURE_MAX_ANISOTROPY_EXT       0x84FE
 #endif
 
+#ifndef GL_PROGRAM_BINARY_LENGTH
+    #define GL_PROGRAM_BINARY_LENGTH            0x8741
+#endif
+#ifndef GL_NUM_PROGRAM_BINARY_FORMATS
+    #define GL_NUM_PROGRAM_BINARY_FORMATS       0x87FE
+#endif
+
+#ifndef GL_HALF_FLOAT
+    #define GL_HALF_FLOAT                       0x140B
+#endif
+
+#ifndef GL_COMPUTE_SHADER
+    #define GL_COMPUTE_SHADER                   0x91B9
+#endif
+#ifndef GL_SHADER_STORAGE_BUFFER
+    #define GL_SHADER_STORAGE_BUFFER            0x90D2
+#endif
+#ifndef GL_MAX_COMPUTE_WORK_GROUP_COUNT
+    #define GL_MAX_COMPUTE_WORK_GROUP_COUNT     0x91BE
+#endif
+#ifndef GL_POINT_SPRITE
+    #define GL_POINT_SPRITE                     0x8861
+#endif
+#ifndef GL_PROGRAM_POINT_SIZE
+    #define GL_PROGRAM_POINT_SIZE               0x8642
+#endif
+#ifndef GL_HALF_FLOAT_OES
+    #define GL_HALF_FLOAT_OES                   0x8D61
+#endif
+#ifndef GL_INT_2_10_10_10_REV
+    #define GL_INT_2_10_10_10_REV               0x8D9F
+#endif
+
 #if defined(GRAPHICS_API_OPENGL_11)
     #define GL_UNSIGNED_SHORT_5_6_5             0x8363
     #define GL_UNSIGNED_SHORT_5_5_5_1           0x8034
     #define GL_UNSIGNED_SHORT_4_4_4_4           0x8033
+    #ifndef GL_GENERATE_MIPMAP
+        #define GL_GENERATE_MIPMAP              0x8191
+    #endif
 #endif
 
 #if defined(GRAPHICS_API_OPENGL_21)
@@ -729,43 +1186,247 @@ RLAPI int GetPixelDataSize(int width, int height, int format);// Get pixel data
 #define DEFAULT_ATTRIB_COLOR_NAME       "vertexColor"       // shader-location = 3
 #define DEFAULT_ATTRIB_TANGENT_NAME     "vertexTangent"     // shader-location = 4
 #define DEFAULT_ATTRIB_TEXCOORD2_NAME   "vertexTexCoord2"   // shader-location = 5
+#define DEFAULT_ATTRIB_TEXUNIT_NAME     "vertexTexUnit"     // shader-location = 6 (only default shader, SUPPORT_BATCH_MULTITEXTURE)
+#define DEFAULT_ATTRIB_TEXLAYER_NAME    "vertexTexLayer"    // shader-location = 7 (texture array layer, SUPPORT_BATCH_TEXTURE_ARRAYS)
+#define DEFAULT_ATTRIB_INSTANCE_TX_NAME "instanceTransform" // shader-location = queried (mat4 per instance, uses 4 locations)
+#define DEFAULT_ATTRIB_BONEIDS_NAME     "vertexBoneIds"     // shader-location = 6 (skinned meshes, SUPPORT_GPU_SKINNING)
+#define DEFAULT_ATTRIB_BONEWEIGHTS_NAME "vertexBoneWeights" // shader-location = 7 (skinned meshes, SUPPORT_GPU_SKINNING)
+#define DEFAULT_UNIFORM_BONES_NAME      "boneMatrices"      // mat4 array, up to MAX_SHADER_BONES (skinned meshes)
+
+// Default uniform block name on shader, shared frame values (view, projection, time)
+#define DEFAULT_BLOCK_FRAME_NAME        "FrameData"         // binding point = 0 (user blocks use next binding points)
+
+#if defined(SUPPORT_FRAME_CAPTURE)
+    #define MAX_CAPTURE_RESOURCES       1024    // Maximum textures and meshes tracked by captured frame (data captured once)
+
+    // State change recorded on frame capture (if capturing)
+    #define CAPTURE_STATE(state, v0, v1, v2, v3)    WriteCaptureState(state, v0, v1, v2, v3)
+#else
+    #define CAPTURE_STATE(state, v0, v1, v2, v3)
+#endif
 
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
 
+#if defined(SUPPORT_BATCH_INTERLEAVED)
+// Interleaved vertex data for default buffers (24 bytes per vertex)
+typedef struct BatchVertex {
+    float position[3];          // vertex position (XYZ - 3 components per vertex) (shader-location = 0)
+    float texcoord[2];          // vertex texture coordinates (UV - 2 components per vertex) (shader-location = 1)
+    unsigned char color[4];     // vertex colors (RGBA - 4 components per vertex) (shader-location = 3)
+#if defined(SUPPORT_BATCH_MULTITEXTURE) || defined(SUPPORT_BATCH_TEXTURE_ARRAYS)
+    unsigned char texUnit;      // vertex texture unit index in draw textures (shader-location = 6)
+    unsigned char padding;      // NOTE: Keeps vertex size aligned to 4 bytes
+    unsigned short texLayer;    // vertex texture array layer (shader-location = 7)
+#endif
+} BatchVertex;
+#endif
+
 // Dynamic vertex buffers (position + texcoords + colors + indices arrays)
 typedef struct DynamicBuffer {
     int vCounter;               // vertex position counter to process (and draw) from full buffer
     int tcCounter;              // vertex texcoord counter to process (and draw) from full buffer
     int cCounter;               // vertex color counter to process (and draw) from full buffer
+#if defined(SUPPORT_BATCH_INTERLEAVED)
+    BatchVertex *elements;      // vertex data interleaved (position + texcoord + color)
+#else
     float *vertices;            // vertex position (XYZ - 3 components per vertex) (shader-location = 0)
     float *texcoords;           // vertex texture coordinates (UV - 2 components per vertex) (shader-location = 1)
     unsigned char *colors;      // vertex colors (RGBA - 4 components per vertex) (shader-location = 3)
+#endif
 #if defined(GRAPHICS_API_OPENGL_11) || defined(GRAPHICS_API_OPENGL_33)
     unsigned int *indices;      // vertex indices (in case vertex data comes indexed) (6 indices per quad)
 #elif defined(GRAPHICS_API_OPENGL_ES2)
-    unsigned short *indices;    // vertex indices (in case vertex data comes indexed) (6 indices per quad)
-                                // NOTE: 6*2 byte = 12 byte, not alignment problem!
+    void *indices;              // vertex indices (in case vertex data comes indexed) (6 indices per quad)
+                                // NOTE: unsigned short by default, unsigned int if batch requires it (indexUint)
 #endif
     unsigned int vaoId;         // OpenGL Vertex Array Object id
     unsigned int vboId[4];      // OpenGL Vertex Buffer Objects id (4 types of vertex data)
+                                // NOTE: Interleaved vertex data only uses vboId[0] and vboId[3] (indices)
+#if defined(GRAPHICS_API_OPENGL_33)
+    GLsync fence;               // Fence placed after last draw using this buffer (streaming mode)
+    void *mapped[3];            // Persistent-mapped pointers for vertex buffers (streaming mode)
+#endif
 } DynamicBuffer;
 
+#if defined(SUPPORT_BATCH_STREAMING)
+// Default batch buffers streaming mode
+typedef enum {
+    BATCH_STREAM_SUBDATA = 0,   // Upload data with glBufferSubData() (default, all backends)
+    BATCH_STREAM_MAP_RANGE,     // Upload data with glMapBufferRange(), unsynchronized or orphaning
+    BATCH_STREAM_PERSISTENT     // Write vertex data directly into persistent-mapped buffers
+} BatchStreamMode;
+#endif
+
+// Internal batch flush reason (render statistics)
+typedef enum {
+    FLUSH_STATE_CHANGE = 0,     // Flush requested by user or on state change (default)
+    FLUSH_BUFFER_FULL,          // Vertex buffer is full
+    FLUSH_TEXTURE_CHANGE,       // Draw calls limit reached on texture change
+    FLUSH_MODE_CHANGE           // Draw calls limit reached on draw mode change
+} FlushReason;
+
 // Draw call type
 typedef struct DrawCall {
     int mode;                   // Drawing mode: LINES, TRIANGLES, QUADS
     int vertexCount;            // Number of vertex of the draw
     int vertexAlignment;        // Number of vertex required for index alignment (LINES, TRIANGLES)
+    int layer;                  // Draw layer, used as primary sorting key (rlEnableDrawSorting())
     //unsigned int vaoId;         // Vertex array id to be used on the draw
     //unsigned int shaderId;      // Shader id to be used on the draw
     unsigned int textureId;     // Texture id to be used on the draw
-                                // TODO: Support additional texture units?
+#if defined(SUPPORT_BATCH_MULTITEXTURE)
+    unsigned int textureIds[MAX_BATCH_TEXTURE_UNITS];   // Texture ids bound to consecutive units (textureIds[0] = textureId)
+    int textureCount;           // Number of texture units used by the draw
+#endif
+#if defined(SUPPORT_BATCH_TEXTURE_ARRAYS)
+    bool textureArray;          // Texture id is a texture array (GL_TEXTURE_2D_ARRAY), layer defined per vertex
+#endif
+    int blendMode;              // Blending mode of the draw (BeginBlendMode())
+    bool scissorTest;           // Scissor test enabled on the draw
+    int scissor[4];             // Scissor rectangle of the draw: x, y, width, height
 
     //Matrix projection;        // Projection matrix for this draw
     //Matrix modelview;         // Modelview matrix for this draw
 } DrawCall;
 
+// Render batch type, vertex data and draw calls
+// NOTE: Default batch is drawn and reset on every rlglDraw(), user batches (retained)
+// keep their vertex data until reset, so they can be drawn multiple times
+struct RenderBatch {
+    int buffersCount;           // Number of vertex buffers (multi-buffering support)
+    int currentBuffer;          // Current buffer tracking in case of multi-buffering
+    int elements;               // Batch capacity, elements (quads) per buffer
+    DynamicBuffer *vertexBuffer;    // Dynamic buffer(s) for vertex data
+    DrawCall *draws;            // Draw calls array, depends on textureId
+    int drawsCounter;           // Draw calls counter
+    float currentDepth;         // Current depth value for next draw
+    bool retained;              // Vertex data is kept after drawing (user batches)
+    int uploadedCount;          // Vertex count already uploaded to GPU buffers (retained batches)
+#if defined(GRAPHICS_API_OPENGL_ES2)
+    bool indexUint;             // Batch uses 32 bit indices (more than 16384 elements)
+#endif
+};
+
+#if defined(GRAPHICS_API_OPENGL_33)
+// Texture upload type, pixel buffer used for asynchronous texture updates
+typedef struct TextureUpload {
+    unsigned int pboId;         // Pixel unpack buffer id
+    int size;                   // Pixel unpack buffer size in bytes
+    unsigned int textureId;     // Texture being updated from buffer (0 if none)
+    GLsync fence;               // Fence placed after texture update command
+} TextureUpload;
+
+// Screen readback type, pixel buffer used for asynchronous screen pixels reading
+typedef struct ScreenReadback {
+    unsigned int pboId;         // Pixel pack buffer id
+    int size;                   // Pixel pack buffer size in bytes
+    unsigned int requestId;     // Readback request id (0 if buffer is free)
+    int width;                  // Readback width
+    int height;                 // Readback height
+    bool alpha;                 // Keep alpha channel (framebuffer readback), screen readbacks are opaque
+    GLsync fence;               // Fence placed after glReadPixels() command
+} ScreenReadback;
+
+// Dynamic mesh buffers state (Mesh.stream), every mesh buffer stores MAX_MESH_BUFFERING copies of its data
+// NOTE: Updates are written to a copy GPU is not reading (no implicit sync), copy i starts at vertex i*vertexCapacity
+typedef struct MeshStream {
+    int vertexCapacity;         // Vertices by buffer copy
+    int triangleCapacity;       // Triangles by index buffer copy
+    int current;                // Buffer copy drawn (last updated)
+    bool drawn;                 // Current copy drawn since last update, next update moves to next copy
+    unsigned int drawFrame[MAX_MESH_BUFFERING];         // Last frame drawing every copy
+    int pendingStart[MAX_MESH_BUFFERING][7];    // Range updated on other copies, not yet on this copy (by buffer: vertex attributes and indices)
+    int pendingEnd[MAX_MESH_BUFFERING][7];
+} MeshStream;
+#endif
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+// Billboard per-instance data (rlDrawBillboards()), quad corners are expanded in vertex shader
+typedef struct BillboardInstance {
+    float position[3];          // Billboard center position
+    float size[2];              // Billboard size (width, height)
+    unsigned char color[4];     // Billboard tint color (normalized on attribute fetch)
+    float texcoords[4];         // Billboard texcoords rectangle (u0, v0, u1, v1)
+} BillboardInstance;
+
+// Shape SDF per-instance data (rlDrawShapeSDF()), rounded box evaluated in fragment shader
+typedef struct ShapeSDFInstance {
+    float position[3];          // Shape center position (z: 2D depth)
+    float size[2];              // Shape half size (box half width, half height)
+    float axis[2];              // Shape rotation (cos, sin)
+    float params[2];            // Shape corner radius and outline thickness (0 for filled shape)
+    unsigned char color[4];     // Shape color (normalized on attribute fetch)
+} ShapeSDFInstance;
+#endif
+
+// Pooled render texture type, transient render targets reused by (width, height, format, depth)
+typedef struct PooledRenderTexture {
+    RenderTexture2D target;     // Render texture (fbo with color and depth attachments)
+    int width;                  // Render texture width (pool key)
+    int height;                 // Render texture height (pool key)
+    int format;                 // Color attachment pixel format (pool key)
+    int depthBits;              // Depth attachment bits, 0 for no depth (pool key)
+    bool depthTexture;          // Depth attachment requested as texture (pool key)
+    bool inUse;                 // Render texture checked out (rlGetPooledRenderTexture())
+    unsigned int lastFrame;     // Pool frame when render texture was last used
+} PooledRenderTexture;
+
+// Shader program binary file header (shader cache)
+typedef struct ShaderBinaryHeader {
+    char id[4];                 // File identifier: "rlSB"
+    unsigned int hashLow;       // Shader sources and driver hash (low 32 bits)
+    unsigned int hashHigh;      // Shader sources and driver hash (high 32 bits)
+    unsigned int format;        // Program binary format (driver specific)
+    int size;                   // Program binary size in bytes
+} ShaderBinaryHeader;
+
+// Frame uniform block data type, shared by all shaders declaring DEFAULT_BLOCK_FRAME_NAME block
+// NOTE: Layout must match GLSL std140 block:
+//      layout(std140) uniform FrameData { mat4 view; mat4 projection; float time; };
+typedef struct FrameBlockData {
+    float matView[16];          // View matrix (internal modelview)
+    float matProjection[16];    // Projection matrix
+    float time;                 // Time in seconds (set on BeginDrawing())
+    float padding[3];           // Padding to vec4 size (std140)
+} FrameBlockData;
+
+// User uniform block type, buffer bound to all shaders declaring the block name
+typedef struct UniformBlock {
+    unsigned int id;            // Uniform buffer id (0 if slot is free)
+    char name[64];              // Uniform block name on shader
+} UniformBlock;
+
+// Mesh drawing state type, bound GL state kept between consecutive mesh draws
+// NOTE: State is released (unbound) by ReleaseMeshState() before any other rlgl GL state change
+typedef struct MeshDrawState {
+    bool active;                // State is bound (not released yet)
+    unsigned int shaderId;      // Shader program bound
+    unsigned int vertexId;      // Vertex array bound (VAO id or mesh vertex position VBO id)
+    unsigned int textureIds[MAX_MATERIAL_MAPS]; // Texture ids bound per texture unit
+    unsigned int samplersSet;   // Texture units already set to shader samplers (bit mask)
+    bool colorsSet;             // Material colors uniforms already set
+    Color colDiffuse;           // Material diffuse color uniform value
+    Color colSpecular;          // Material specular color uniform value
+    bool matricesSet;           // View and projection matrices uniforms already set
+    Matrix matView;             // View matrix uniform value
+    Matrix matProjection;       // Projection matrix uniform value
+} MeshDrawState;
+
+// Vertex attribute state type, emulates vertex array state when VAO is not supported
+// NOTE: Only attributes set by SetVertexAttrib() are known (valid), others are always set
+typedef struct VertexAttribState {
+    bool valid;                 // Attribute state is known
+    bool enabled;               // Attribute array enabled
+    unsigned int buffer;        // Buffer bound to attribute
+    int size;                   // Attribute components
+    int type;                   // Attribute components type
+    bool normalized;            // Attribute components normalized
+    int stride;                 // Attribute stride (in bytes)
+    const void *pointer;        // Attribute offset on buffer
+} VertexAttribState;
+
 #if defined(SUPPORT_VR_SIMULATOR)
 // VR Stereo rendering configuration for simulator
 typedef struct VrStereoConfig {
@@ -781,30 +1442,61 @@ typedef struct VrStereoConfig {
 // Global Variables Definition
 //----------------------------------------------------------------------------------
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-static Matrix stack[MAX_MATRIX_STACK_SIZE] = { 0 }; // Matrix stack for push/pop
-static int stackCounter = 0;                // Matrix stack counter
+// NOTE: Recording state (RL_THREAD_LOCAL) is kept per thread with SUPPORT_THREADED_RECORDING
+static RL_THREAD_LOCAL Matrix stack[MAX_MATRIX_STACK_SIZE] = { 0 }; // Matrix stack for push/pop
+static RL_THREAD_LOCAL int stackCounter = 0;    // Matrix stack counter
 static Matrix modelview = { 0 };            // Default modelview matrix
 static Matrix projection = { 0 };           // Default projection matrix
-static Matrix *currentMatrix = NULL;        // Current matrix pointer
-static int currentMatrixMode = -1;          // Current matrix mode
-static float currentDepth = -1.0f;          // Current depth value 
+static RL_THREAD_LOCAL Matrix *currentMatrix = NULL;    // Current matrix pointer
+static RL_THREAD_LOCAL int currentMatrixMode = -1;      // Current matrix mode
 
-// Default dynamic buffer for elements data
+// Default render batch for elements data
 // NOTE: A multi-buffering system is supported
-static DynamicBuffer vertexData[MAX_BATCH_BUFFERING] = { 0 };
-static int currentBuffer = 0;               // Current buffer tracking
+static RenderBatch defaultBatch = { 0 };
+static RL_THREAD_LOCAL RenderBatch *currentBatch = NULL;    // Render batch receiving vertex data (rlSetRenderBatchActive())
 
-static Matrix transformMatrix = { 0 };      // Transform matrix to be used with rlTranslate, rlRotate, rlScale
-static bool useTransformMatrix = false;     // Use transform matrix against vertex (if required)
+static RL_THREAD_LOCAL Matrix transformMatrix = { 0 };      // Transform matrix to be used with rlTranslate, rlRotate, rlScale
+static RL_THREAD_LOCAL bool useTransformMatrix = false;     // Use transform matrix against vertex (if required)
 
-static DrawCall *draws = NULL;              // Draw calls array
-static int drawsCounter = 0;                // Draw calls counter
+static int batchElements = MAX_BATCH_ELEMENTS;  // Default batch capacity, elements (quads) per buffer
+static bool drawSorting = false;            // Sort and merge draw calls before batch draw
+static RL_THREAD_LOCAL int currentDrawLayer = 0;            // Draw layer for next draw calls
+static bool scissorTest = false;            // Scissor test enabled for next draw calls
+static int scissorRect[4] = { 0 };          // Scissor rectangle for next draw calls: x, y, width, height
+static DynamicBuffer sortBuffer = { 0 };    // Vertex data scratch buffer for draw calls sorting
+static int sortBufferElements = 0;          // Vertex data scratch buffer capacity, elements (quads)
+static DrawCall *sortDraws = NULL;          // Draw calls scratch array for draw calls sorting
+
+#if defined(SUPPORT_BATCH_MULTITEXTURE)
+static int batchTextureUnits = 1;           // Texture units available per draw call (limited by GPU)
+static RL_THREAD_LOCAL int currentTextureUnit = 0;          // Texture unit of current texture in current draw call
+#endif
+#if defined(SUPPORT_BATCH_TEXTURE_ARRAYS)
+static RL_THREAD_LOCAL int currentTexLayer = 0;             // Texture array layer for next vertices (rlTexLayer())
+static RL_THREAD_LOCAL bool textureArrayRequest = false;    // Next rlEnableTexture() texture is an array (rlEnableTextureArray())
+static Shader defaultArrayShader = { 0 };   // Default shader variant sampling texture arrays (sampler2DArray)
+#endif
+#if defined(SUPPORT_GPU_SKINNING)
+static Shader defaultSkinShader = { 0 };    // Default shader variant skinning vertices by bone matrices (meshes drawn with default shader)
+#endif
+static Shader defaultPointShader = { 0 };   // Default shader variant for points draws (point size, texture sampled by point coordinates)
+static int defaultPointSizeLoc = -1;        // Default points shader point size location
+#if defined(SUPPORT_VR_SINGLE_PASS)
+static Shader defaultStereoShader = { 0 };  // Default shader variant drawing both VR eyes per draw call (eye by gl_InstanceID)
+#endif
+static float pointSize = 1.0f;              // Points size in pixels (rlSetPointSize())
 
 static unsigned int defaultTextureId = 0;   // Default texture used on shapes/poly drawing (required by shader)
 static unsigned int defaultVShaderId = 0;   // Default vertex shader id (used by default shader program)
 static unsigned int defaultFShaderId = 0;   // Default fragment shader Id (used by default shader program)
 static Shader defaultShader = { 0 };        // Basic shader, support vertex color and diffuse texture
 static Shader currentShader = { 0 };        // Shader to be used on rendering (by default, defaultShader)
+static MeshDrawState meshState = { 0 };     // Mesh drawing state cache, avoids redundant GL calls between meshes
+static VertexAttribState vertexAttribs[MAX_VERTEX_ATTRIBS_CACHED] = { 0 };  // Vertex attributes state cache (no VAO support)
+static RL_TLS bool loaderThread = false;    // Calling thread loads resources on a shared context (rlBeginLoaderContext())
+
+static PooledRenderTexture renderTexturePool[MAX_RENDER_TEXTURE_POOL] = { 0 };  // Transient render textures pool
+static unsigned int renderTexturePoolFrame = 0; // Pool frames counter (rlUpdateRenderTexturePool())
 
 // Extensions supported flags
 static bool vaoSupported = false;           // VAO support (OpenGL ES2 could not support VAO extension)
@@ -819,14 +1511,113 @@ static bool texDepthSupported = false;      // Depth textures supported
 static bool texMirrorClampSupported = false;// Clamp mirror wrap mode supported
 static bool texAnisoFilterSupported = false;// Anisotropic texture filtering support
 static bool debugMarkerSupported = false;   // Debug marker support
+static bool instancingSupported = false;    // Instanced drawing support (glDrawElementsInstanced(), glVertexAttribDivisor())
+static bool halfFloatAttribSupported = false;// Half float vertex attributes support
+static bool packedAttribSupported = false;  // Packed 10:10:10:2 vertex attributes support (GL_INT_2_10_10_10_REV)
+#if defined(GRAPHICS_API_OPENGL_33)
+static bool mapBufferRangeSupported = false;// glMapBufferRange() and fence sync objects support
+static bool texArraySupported = false;      // Texture arrays support (GL_TEXTURE_2D_ARRAY)
+#endif
+#if defined(SUPPORT_BATCH_STREAMING)
+static bool bufferStorageSupported = false; // Immutable buffer storage support (persistent mapping)
+static int batchStreamMode = BATCH_STREAM_SUBDATA;  // Default batch buffers streaming mode
+#endif
 static int maxDepthBits = 16;               // Maximum bits for depth component
 static float maxAnisotropicLevel = 0.0f;    // Maximum anisotropy level supported (minimum is 2.0f)
 
+static bool programBinarySupported = false; // Program binaries support (glGetProgramBinary(), glProgramBinary())
+static char shaderCachePath[512] = { 0 };   // Shader program binaries cache directory (empty if disabled)
+
+static unsigned int instanceVboId = 0;      // Per-instance transforms buffer (used by rlDrawMeshInstanced())
+#if defined(GRAPHICS_API_OPENGL_ES2)
+static unsigned int readbackFramebufferId = 0;  // Framebuffer to attach textures for pixels readback (rlReadTexturePixels())
+#endif
+static int instanceBufferCapacity = 0;      // Per-instance transforms buffer capacity (in instances)
+
+static Shader billboardShader = { 0 };      // Billboards shader, loaded on first rlDrawBillboards() (locs set even if loading failed)
+static int billboardLocs[6] = { 0 };        // Billboards shader locations: right, up, instance position, size, color, texcoords
+static unsigned int billboardVaoId = 0;     // Billboards vertex array (quad corners and per-instance buffers)
+static unsigned int billboardVboId[2] = { 0 };  // Billboards buffers: quad corners, per-instance data
+static int billboardBufferCapacity = 0;     // Billboards per-instance buffer capacity (in billboards)
+
+static Shader shapeSDFShader = { 0 };       // SDF shapes shader, loaded on first rlDrawShapeSDF() (locs set even if loading failed)
+static int shapeSDFLocs[6] = { 0 };         // SDF shapes shader locations: viewport size, instance position, size, axis, params, color
+static unsigned int shapeSDFVaoId = 0;      // SDF shapes vertex array (quad corners and per-instance buffers)
+static unsigned int shapeSDFVboId[2] = { 0 };   // SDF shapes buffers: quad corners, per-instance data
+static ShapeSDFInstance *shapeSDFInstances = NULL;  // SDF shapes queued for drawing (MAX_BATCH_SHAPES_SDF)
+static int shapeSDFCount = 0;               // SDF shapes queued counter
+
+#if defined(GRAPHICS_API_OPENGL_33)
+// GPU timing zones, double buffered: one frame is recorded while previous frame results are collected
+static bool timerQuerySupported = false;    // Timer queries support (GL_TIMESTAMP)
+static GpuZoneTime gpuZones[2][MAX_GPU_ZONES] = { 0 };  // GPU timing zones recorded per frame
+static unsigned int gpuZonesQueries[2][MAX_GPU_ZONES][2] = { 0 };   // GPU timing zones begin/end timestamp queries
+static int gpuZonesCount[2] = { 0 };        // GPU timing zones counter per frame
+static int gpuZonesFrame = 0;               // GPU timing zones frame being recorded (0 or 1)
+static int gpuZonesStack[MAX_GPU_ZONES] = { 0 };    // Open zones indices (-1 if zone was not recorded)
+static int gpuZonesDepth = 0;               // Open zones counter (current nesting level)
+static GpuZoneTime gpuZoneTimes[MAX_GPU_ZONES] = { 0 };     // GPU timing zones results (latest measured frame)
+static int gpuZoneTimesCount = 0;           // GPU timing zones results counter
+
+// Uniform blocks, buffers shared by all shaders (binding point 0 is frame block)
+static bool uboSupported = false;           // Uniform buffer objects support (GL_UNIFORM_BUFFER)
+static bool computeSupported = false;       // Compute shaders and shader storage buffers support (GL_COMPUTE_SHADER, GL_SHADER_STORAGE_BUFFER)
+static unsigned int frameBlockId = 0;       // Frame uniform block buffer id
+static FrameBlockData frameBlock = { 0 };   // Frame uniform block data (last uploaded)
+static bool frameBlockDirty = true;         // Frame uniform block data requires upload
+static UniformBlock uniformBlocks[MAX_UNIFORM_BLOCKS] = { 0 };  // User uniform blocks (binding point = index + 1)
+
+// Asynchronous texture uploads, ring of pixel unpack buffers
+static TextureUpload textureUploads[MAX_TEXTURE_UPLOADS] = { 0 };  // Pixel buffers ring (rlUpdateTextureAsync())
+static int currentTextureUpload = 0;        // Next pixel buffer to be used
+
+// Asynchronous screen readbacks, pixel pack buffers
+static ScreenReadback screenReadbacks[MAX_SCREEN_READBACKS] = { 0 };   // Pixel buffers (rlReadScreenPixelsAsync())
+static unsigned int screenReadbacksCounter = 0; // Readback requests counter (used as request id)
+
+// Dynamic meshes buffers copies, frames fences ring
+static GLsync meshFrameFences[MAX_MESH_BUFFERING] = { 0 };  // Fences placed at end of last frames
+static unsigned int meshFenceFrames[MAX_MESH_BUFFERING] = { 0 };  // Frame guarded by every fence
+static unsigned int meshFrame = 1;          // Current frame (dynamic meshes copies drawn)
+static unsigned int meshFrameCompleted = 0; // Last frame known to be completed by GPU
+static int meshStreamCount = 0;             // Number of dynamic meshes loaded with buffers copies
+#endif
+
+#if defined(GRAPHICS_API_OPENGL_ES2)
+static bool elementIndexUintSupported = false;  // 32 bit indices support (OES_element_index_uint)
+static bool contextES3 = false;                 // OpenGL ES 3.0 context (WebGL 2.0), ES2 features available as core
+#endif
+
 #if defined(GRAPHICS_API_OPENGL_ES2)
 // NOTE: VAO functionality is exposed through extensions (OES)
 static PFNGLGENVERTEXARRAYSOESPROC glGenVertexArrays;        // Entry point pointer to function glGenVertexArrays()
 static PFNGLBINDVERTEXARRAYOESPROC glBindVertexArray;        // Entry point pointer to function glBindVertexArray()
 static PFNGLDELETEVERTEXARRAYSOESPROC glDeleteVertexArrays;  // Entry point pointer to function glDeleteVertexArrays()
+
+// NOTE: Instancing functionality is exposed through extensions (EXT/ANGLE)
+static PFNGLDRAWARRAYSINSTANCEDEXTPROC glDrawArraysInstanced;        // Entry point pointer to function glDrawArraysInstanced()
+static PFNGLDRAWELEMENTSINSTANCEDEXTPROC glDrawElementsInstanced;    // Entry point pointer to function glDrawElementsInstanced()
+static PFNGLVERTEXATTRIBDIVISOREXTPROC glVertexAttribDivisor;        // Entry point pointer to function glVertexAttribDivisor()
+
+// NOTE: Program binaries functionality is exposed through extension (OES)
+static PFNGLGETPROGRAMBINARYOESPROC glGetProgramBinary;     // Entry point pointer to function glGetProgramBinary()
+static PFNGLPROGRAMBINARYOESPROC glProgramBinary;           // Entry point pointer to function glProgramBinary()
+#endif
+
+#if defined(GRAPHICS_API_OPENGL_33) && !defined(__APPLE__)
+// NOTE: Program binaries are core since OpenGL 4.1 (GL_ARB_get_program_binary), not included in glad
+typedef void (APIENTRYP PFNGLGETPROGRAMBINARYPROC)(GLuint program, GLsizei bufSize, GLsizei *length, GLenum *binaryFormat, void *binary);
+typedef void (APIENTRYP PFNGLPROGRAMBINARYPROC)(GLuint program, GLenum binaryFormat, const void *binary, GLsizei length);
+static PFNGLGETPROGRAMBINARYPROC glGetProgramBinary = NULL;  // Entry point pointer to function glGetProgramBinary()
+static PFNGLPROGRAMBINARYPROC glProgramBinary = NULL;        // Entry point pointer to function glProgramBinary()
+
+// NOTE: Compute shaders (OpenGL 4.3) and image load/store (OpenGL 4.2) are not included in glad
+typedef void (APIENTRYP PFNGLDISPATCHCOMPUTEPROC)(GLuint numGroupsX, GLuint numGroupsY, GLuint numGroupsZ);
+typedef void (APIENTRYP PFNGLMEMORYBARRIERPROC)(GLbitfield barriers);
+typedef void (APIENTRYP PFNGLBINDIMAGETEXTUREPROC)(GLuint unit, GLuint texture, GLint level, GLboolean layered, GLint layer, GLenum access, GLenum format);
+static PFNGLDISPATCHCOMPUTEPROC glDispatchCompute = NULL;    // Entry point pointer to function glDispatchCompute()
+static PFNGLMEMORYBARRIERPROC glMemoryBarrier = NULL;        // Entry point pointer to function glMemoryBarrier()
+static PFNGLBINDIMAGETEXTUREPROC glBindImageTexture = NULL;  // Entry point pointer to function glBindImageTexture()
 #endif
 
 #if defined(SUPPORT_VR_SIMULATOR)
@@ -841,39 +1632,146 @@ static bool vrStereoRender = false;         // VR stereo rendering enabled/disab
 #endif  // GRAPHICS_API_OPENGL_33 || GRAPHICS_API_OPENGL_ES2
 
 static int blendMode = 0;                   // Track current blending mode
+static rlTextureUseCallback textureUseCallback = NULL;  // Texture used for drawing callback (rlSetTextureUseCallback())
+
+#if defined(GRAPHICS_API_OPENGL_11)
+static bool autoMipmapSupported = false;    // Automatic mipmaps generation support (GL_GENERATE_MIPMAP)
+#endif
+
+// Render statistics
+static RenderStats renderStats = { 0 };     // Render statistics of current frame
+static RenderStats renderStatsFrame = { 0 };    // Render statistics of last frame (GetRenderStats())
+
+// GPU memory tracking (rlGetVideoMemoryUsage())
+// NOTE: Resources sizes are indexed by object id, 0 means object is not tracked
+static unsigned int *videoMemorySizes[3] = { 0 };       // Resources sizes by kind (VIDEO_MEMORY_TEXTURE, VIDEO_MEMORY_RENDERBUFFER, VIDEO_MEMORY_BUFFER)
+static unsigned int videoMemoryCapacity[3] = { 0 };     // Resources sizes arrays capacity (object ids)
+static MemoryUsage videoMemoryUsage[2] = { 0 };         // Textures (and renderbuffers) and buffers memory usage
+static volatile long videoMemoryLock = 0;               // Tracking lock (resources loaded from loader thread)
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+static RL_THREAD_LOCAL int flushReason = FLUSH_STATE_CHANGE;    // Reason of next internal batch flush
+static unsigned int renderStatsShaderId = 0;    // Last shader program used for drawing (shader switches)
+#endif
 
 // Default framebuffer size
 static int framebufferWidth = 0;            // Default framebuffer width
 static int framebufferHeight = 0;           // Default framebuffer height
 
+#if defined(SUPPORT_FRAME_CAPTURE)
+// Frame capture (rlCaptureFrame())
+static char captureFileName[512] = { 0 };   // Frame capture requested file, capture starts on next frame
+static FILE *captureFile = NULL;            // Frame capture file, only open while frame is captured
+static int captureCommandsCount = 0;        // Commands captured on current frame
+static unsigned int captureTextureIds[MAX_CAPTURE_RESOURCES] = { 0 };  // Textures already captured on current frame
+static int captureTexturesCount = 0;        // Textures already captured count
+static unsigned int captureMeshIds[MAX_CAPTURE_RESOURCES] = { 0 };     // Meshes already captured on current frame
+static int captureMeshesCount = 0;          // Meshes already captured count
+#endif
+
 //----------------------------------------------------------------------------------
 // Module specific Functions Declaration
 //----------------------------------------------------------------------------------
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
 static unsigned int CompileShader(const char *shaderStr, int type);     // Compile custom shader and return shader id
 static unsigned int LoadShaderProgram(unsigned int vShaderId, unsigned int fShaderId);  // Load custom shader program
+static unsigned long long GetShaderCacheHash(const char *vsCode, const char *fsCode);   // Get shader sources and driver hash (shader cache key)
+static unsigned int LoadShaderBinary(unsigned long long hash);  // Load shader program from cached binary (0 if not available or invalid)
+static void SaveShaderBinary(unsigned int program, unsigned long long hash);    // Save shader program binary into cache
 
 static Shader LoadShaderDefault(void);      // Load default shader (just vertex positioning and texture coloring)
 static void SetShaderDefaultLocations(Shader *shader); // Bind default shader locations (attributes and uniforms)
 static void UnloadShaderDefault(void);      // Unload default shader
-
-static void LoadBuffersDefault(void);       // Load default internal buffers
-static void UpdateBuffersDefault(void);     // Update default internal buffers (VAOs/VBOs) with vertex data
-static void DrawBuffersDefault(void);       // Draw default internal buffers vertex data
-static void UnloadBuffersDefault(void);     // Unload default internal buffers vertex data from CPU and GPU
+#if defined(SUPPORT_BATCH_TEXTURE_ARRAYS)
+static Shader LoadShaderArrayDefault(void); // Load default texture array shader (sampler2DArray, layer by vertex)
+#endif
+#if defined(SUPPORT_GPU_SKINNING)
+static Shader LoadShaderSkinDefault(void);  // Load default skinning shader (bone matrices blended by vertex weights)
+#endif
+static Shader LoadShaderPointDefault(void); // Load default points shader (point size, texture sampled by point coordinates)
+#if defined(SUPPORT_VR_SINGLE_PASS)
+static Shader LoadShaderStereoDefault(void);    // Load default stereo shader (both eyes per draw call, eye by gl_InstanceID)
+#endif
+static Shader LoadShaderBillboard(void);    // Load billboards shader (quad corners expanded by per-instance position, size, color and texcoords)
+static Shader LoadShaderShapeSDF(void);     // Load SDF shapes shader (rounded box distance evaluated by fragment, antialiased edges)
+static void DrawShapesSDF(void);            // Draw queued SDF shapes (one instanced draw call)
+
+static void LoadBatchBuffers(RenderBatch *batch, int buffersCount, int elements);  // Load render batch buffers and draw calls
+static void UpdateBatchBuffers(RenderBatch *batch);     // Update render batch buffers (VAOs/VBOs) with vertex data
+static void DrawBatchBuffers(RenderBatch *batch);       // Draw render batch buffers vertex data
+static void ResetBatch(RenderBatch *batch);             // Reset render batch vertex data and draw calls
+static void UnloadBatchBuffers(RenderBatch *batch);     // Unload render batch buffers vertex data from CPU and GPU
+static void SortDrawCalls(RenderBatch *batch);          // Sort and merge registered draw calls, reordering vertex data
+static void SplitDrawCall(void);                        // Start a new draw call keeping current draw call state (if current one has vertex)
+static void SetDrawCallState(DrawCall *draw);           // Set draw call render state to current state (blend mode and scissor)
+static bool IsDrawStateEqual(const DrawCall *a, const DrawCall *b);     // Check if two draw calls use the same render state
+static void UpdateDrawState(int mode, bool scissor, int x, int y, int width, int height);  // Update current render state, splitting draw call if required
+static void ApplyDrawState(const DrawCall *draw, DrawCall *glState);    // Apply draw call render state, only state different from GL state
+static void CopyBufferVertices(DynamicBuffer *dst, int dstOffset, const DynamicBuffer *src, int srcOffset, int count);  // Copy vertex data between buffers
+static void EnableMeshMaterial(Mesh mesh, Material material);  // Enable shader, material values, texture maps and mesh buffers
+static void LoadMeshBuffer(unsigned int id, GLenum target, int size, const void *data, int copies, int drawHint);  // Load bound mesh buffer data (all copies)
+static void UpdateMeshBuffer(Mesh mesh, int buffer, int index, int count);  // Update mesh buffer range from CPU data (next copy if dynamic)
+static const unsigned char *GetMeshBufferData(Mesh mesh, int buffer, int *size);  // Get mesh CPU data for buffer and its element size
+static int GetMeshAttribFormat(int vertexFormat, int buffer, int *components, int *type, bool *normalized);  // Get mesh vertex attribute GPU format (returns vertex size)
+static void SetMeshVertexAttrib(unsigned int location, unsigned int id, int buffer, int vertexFormat);  // Set mesh vertex buffer attribute, considering storage format
+static void SetVertexAttrib(unsigned int index, unsigned int buffer, int size, int type, bool normalized, int stride, const void *pointer);  // Set and enable vertex attribute (only changes if VAO not supported)
+static void DisableVertexAttrib(unsigned int index);    // Disable vertex attribute array (only if enabled when VAO not supported)
+static void ResetVertexAttribs(unsigned int buffer);    // Forget cached vertex attributes using buffer (0 for all)
+static void LoadMeshVertexBuffer(Mesh mesh, int buffer, int copies, int drawHint);  // Load bound mesh vertex buffer data, packed to mesh storage format
+static void *PackMeshVertexData(Mesh mesh, int buffer, int index, int count);  // Pack mesh vertex attribute range to compact format (NULL if stored as floats)
+static unsigned short FloatToHalf(float value);     // Convert float to half float
+#if defined(GRAPHICS_API_OPENGL_ES2)
+static float HalfToFloat(unsigned short value);     // Convert half float to float
+#endif
+static void DrawMeshBuffers(Mesh mesh, int instances);  // Draw mesh buffers (current copy if dynamic)
+static void AddBatchVertices(const float *vertices, const float *texcoords, const unsigned char *colors, int count);  // Add multiple vertex to current batch
+static void TransformPositions(float *dst, int dstStride, const float *src, int count, const Matrix *mat);  // Transform positions by matrix (SIMD if available)
+#if defined(SUPPORT_BATCH_STREAMING)
+static void *LoadBufferPersistent(int dataSize, const void *data);  // Load immutable storage for bound buffer and map it
+static void UploadBufferStream(DynamicBuffer *buffer, int vbo, int dataSize, const void *data); // Upload vertex data to streamed buffer
+static bool IsBufferFenceSignaled(DynamicBuffer *buffer);   // Check if GPU is done with buffer (no blocking)
+static void WaitBufferFence(DynamicBuffer *buffer);         // Wait until GPU is done with buffer
+#endif
 
 static void GenDrawCube(void);              // Generate and draw cube
 static void GenDrawQuad(void);              // Generate and draw quad
 
+#if defined(SUPPORT_FRAME_CAPTURE)
+static void StartFrameCapture(void);        // Open requested frame capture file and write initial state
+static void EndFrameCapture(void);          // Close frame capture file
+static void WriteCaptureCommand(int type, int size);    // Write capture command header, command data is written next
+static void GetCaptureTextureSize(unsigned int id, int *width, int *height);    // Get texture size for frame capture
+static void WriteCaptureTexture(unsigned int id);       // Write texture info (only first reference on frame)
+static unsigned int WriteCaptureMesh(Mesh mesh);        // Write mesh vertex data (only first reference on frame), returns mesh id
+static void WriteCaptureBatch(RenderBatch *batch);      // Write batch flush: matrices, shader, vertex data and draw calls
+static void WriteCaptureMeshDraw(Mesh mesh, Material material, Matrix transform, const Matrix *transforms, int instances);  // Write mesh draw
+static void WriteCaptureState(int state, int v0, int v1, int v2, int v3);   // Write render state change
+static void WriteCaptureUniform(unsigned int shaderId, int location, int type, int count, const void *value, int size);  // Write shader uniform value
+#endif
+
 #if defined(SUPPORT_VR_SIMULATOR)
 static void SetStereoView(int eye, Matrix matProjection, Matrix matModelView);  // Set internal projection and modelview matrix depending on eye
+#if defined(SUPPORT_VR_SINGLE_PASS)
+static void SetStereoViewSinglePass(Shader shader, Matrix matModelView);        // Set both eyes model-view-projection matrices and full framebuffer viewport
+#endif
 #endif
 
 #endif  // GRAPHICS_API_OPENGL_33 || GRAPHICS_API_OPENGL_ES2
 
+static void ReleaseMeshState(void);         // Unbind mesh drawing state kept by EnableMeshMaterial()
+static void SetBlendFunction(int mode);     // Set GL blending function for blend mode
+static void SetMeshVertexArray(Mesh mesh);  // Set mesh buffers vertex attributes on bound vertex array (or current state)
+static unsigned char *FlipScreenPixels(const unsigned char *screenData, int width, int height, bool alpha);    // Flip screen pixel data vertically (framebuffer origin is bottom left)
+#if defined(GRAPHICS_API_OPENGL_33)
+static void UpdateFrameBlock(void);         // Upload frame uniform block data (only if changed)
+static bool WaitMeshFrame(unsigned int frame);  // Wait until GPU completes frame, false if frame is not ended
+static void UploadMeshStreamRange(Mesh mesh, int buffer, int copy, int start, int end, bool unsynchronized);  // Upload mesh buffer range to buffer copy
+#endif
+
+static void TrackVideoMemory(int kind, unsigned int id, unsigned int size);    // Track GPU memory of resource (size of reloaded resource is replaced)
+static void UntrackVideoMemory(int kind, unsigned int id);  // Untrack GPU memory of unloaded resource
+
 #if defined(GRAPHICS_API_OPENGL_11)
-static int GenerateMipmaps(unsigned char *data, int baseWidth, int baseHeight);
-static Color *GenNextMipmap(Color *srcData, int srcWidth, int srcHeight);
+static int GenerateMipmaps(unsigned char **data, int baseWidth, int baseHeight);
 #endif
 
 //----------------------------------------------------------------------------------
@@ -1028,6 +1926,7 @@ void rlOrtho(double left, double right, double bottom, double top, double znear,
 void rlViewport(int x, int y, int width, int height)
 {
     glViewport(x, y, width, height);
+    CAPTURE_STATE(CAPTURE_STATE_VIEWPORT, x, y, width, height);
 }
 
 //----------------------------------------------------------------------------------
@@ -1041,6 +1940,7 @@ void rlBegin(int mode)
 {
     switch (mode)
     {
+        case RL_POINTS: glBegin(GL_POINTS); break;
         case RL_LINES: glBegin(GL_LINES); break;
         case RL_TRIANGLES: glBegin(GL_TRIANGLES); break;
         case RL_QUADS: glBegin(GL_QUADS); break;
@@ -1057,44 +1957,74 @@ void rlNormal3f(float x, float y, float z) { glNormal3f(x, y, z); }
 void rlColor4ub(byte r, byte g, byte b, byte a) { glColor4ub(r, g, b, a); }
 void rlColor3f(float x, float y, float z) { glColor3f(x, y, z); }
 void rlColor4f(float x, float y, float z, float w) { glColor4f(x, y, z, w); }
+void rlVertex3fv(const float *vertices, int count) { for (int i = 0; i < count; i++) glVertex3fv(vertices + i*3); }
+void rlQuadBatch(const float *vertices, const float *texcoords, const unsigned char *colors, int quadCount) { rlVertexBatch(vertices, texcoords, colors, quadCount*4); }
+void rlVertexBatch(const float *vertices, const float *texcoords, const unsigned char *colors, int count)
+{
+    for (int i = 0; i < count; i++)
+    {
+        if (texcoords != NULL) glTexCoord2fv(texcoords + i*2);
+        if (colors != NULL) glColor4ubv(colors + i*4);
+        glVertex3fv(vertices + i*3);
+    }
+}
+void rlSetPointSize(float size) { glPointSize(size); }
 
 #elif defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
 
 // Initialize drawing mode (how to organize vertex)
 void rlBegin(int mode)
 {
-    // Draw mode can be RL_LINES, RL_TRIANGLES and RL_QUADS
+    // Draw queued SDF shapes first, keeping drawing order
+    if ((shapeSDFCount > 0) && !currentBatch->retained) DrawShapesSDF();
+
+    // Draw mode can be RL_POINTS, RL_LINES, RL_TRIANGLES and RL_QUADS
     // NOTE: In all three cases, vertex are accumulated over default internal vertex buffer
-    if (draws[drawsCounter - 1].mode != mode)
+    if (currentBatch->draws[currentBatch->drawsCounter - 1].mode != mode)
     {
-        if (draws[drawsCounter - 1].vertexCount > 0)
+        if (currentBatch->draws[currentBatch->drawsCounter - 1].vertexCount > 0)
         {
             // Make sure current draws[i].vertexCount is aligned a multiple of 4,
             // that way, following QUADS drawing will keep aligned with index processing
             // It implies adding some extra alignment vertex at the end of the draw,
             // those vertex are not processed but they are considered as an additional offset
             // for the next set of vertex to be drawn
-            if (draws[drawsCounter - 1].mode == RL_LINES) draws[drawsCounter - 1].vertexAlignment = ((draws[drawsCounter - 1].vertexCount < 4)? draws[drawsCounter - 1].vertexCount : draws[drawsCounter - 1].vertexCount%4);
-            else if (draws[drawsCounter - 1].mode == RL_TRIANGLES) draws[drawsCounter - 1].vertexAlignment = ((draws[drawsCounter - 1].vertexCount < 4)? 1 : (4 - (draws[drawsCounter - 1].vertexCount%4)));
+            if (currentBatch->draws[currentBatch->drawsCounter - 1].mode == RL_LINES) currentBatch->draws[currentBatch->drawsCounter - 1].vertexAlignment = ((currentBatch->draws[currentBatch->drawsCounter - 1].vertexCount < 4)? currentBatch->draws[currentBatch->drawsCounter - 1].vertexCount : currentBatch->draws[currentBatch->drawsCounter - 1].vertexCount%4);
+            else if (currentBatch->draws[currentBatch->drawsCounter - 1].mode == RL_TRIANGLES) currentBatch->draws[currentBatch->drawsCounter - 1].vertexAlignment = ((currentBatch->draws[currentBatch->drawsCounter - 1].vertexCount < 4)? 1 : (4 - (currentBatch->draws[currentBatch->drawsCounter - 1].vertexCount%4)));
+            else if (currentBatch->draws[currentBatch->drawsCounter - 1].mode == RL_POINTS) currentBatch->draws[currentBatch->drawsCounter - 1].vertexAlignment = (4 - (currentBatch->draws[currentBatch->drawsCounter - 1].vertexCount%4))%4;
 
-            else draws[drawsCounter - 1].vertexAlignment = 0;
+            else currentBatch->draws[currentBatch->drawsCounter - 1].vertexAlignment = 0;
 
-            if (rlCheckBufferLimit(draws[drawsCounter - 1].vertexAlignment)) rlglDraw();
+            if (rlCheckBufferLimit(currentBatch->draws[currentBatch->drawsCounter - 1].vertexAlignment)) rlglDraw();
             else
             {
-                vertexData[currentBuffer].vCounter += draws[drawsCounter - 1].vertexAlignment;
-                vertexData[currentBuffer].cCounter += draws[drawsCounter - 1].vertexAlignment;
-                vertexData[currentBuffer].tcCounter += draws[drawsCounter - 1].vertexAlignment;
+                currentBatch->vertexBuffer[currentBatch->currentBuffer].vCounter += currentBatch->draws[currentBatch->drawsCounter - 1].vertexAlignment;
+                currentBatch->vertexBuffer[currentBatch->currentBuffer].cCounter += currentBatch->draws[currentBatch->drawsCounter - 1].vertexAlignment;
+                currentBatch->vertexBuffer[currentBatch->currentBuffer].tcCounter += currentBatch->draws[currentBatch->drawsCounter - 1].vertexAlignment;
 
-                drawsCounter++;
+                currentBatch->drawsCounter++;
             }
         }
 
-        if (drawsCounter >= MAX_DRAWCALL_REGISTERED) rlglDraw();
+        if (currentBatch->drawsCounter >= MAX_DRAWCALL_REGISTERED)
+        {
+            flushReason = FLUSH_MODE_CHANGE;
+            rlglDraw();
+        }
 
-        draws[drawsCounter - 1].mode = mode;
-        draws[drawsCounter - 1].vertexCount = 0;
-        draws[drawsCounter - 1].textureId = defaultTextureId;
+        currentBatch->draws[currentBatch->drawsCounter - 1].mode = mode;
+        currentBatch->draws[currentBatch->drawsCounter - 1].vertexCount = 0;
+        currentBatch->draws[currentBatch->drawsCounter - 1].textureId = defaultTextureId;
+        currentBatch->draws[currentBatch->drawsCounter - 1].layer = currentDrawLayer;
+        SetDrawCallState(&currentBatch->draws[currentBatch->drawsCounter - 1]);
+#if defined(SUPPORT_BATCH_MULTITEXTURE)
+        currentBatch->draws[currentBatch->drawsCounter - 1].textureIds[0] = defaultTextureId;
+        currentBatch->draws[currentBatch->drawsCounter - 1].textureCount = 1;
+        currentTextureUnit = 0;
+#endif
+#if defined(SUPPORT_BATCH_TEXTURE_ARRAYS)
+        currentBatch->draws[currentBatch->drawsCounter - 1].textureArray = false;
+#endif
     }
 }
 
@@ -1105,30 +2035,40 @@ void rlEnd(void)
     // NOTE: In OpenGL 1.1, one glColor call can be made for all the subsequent glVertex calls
 
     // Make sure colors count match vertex count
-    if (vertexData[currentBuffer].vCounter != vertexData[currentBuffer].cCounter)
+    if (currentBatch->vertexBuffer[currentBatch->currentBuffer].vCounter != currentBatch->vertexBuffer[currentBatch->currentBuffer].cCounter)
     {
-        int addColors = vertexData[currentBuffer].vCounter - vertexData[currentBuffer].cCounter;
+        int addColors = currentBatch->vertexBuffer[currentBatch->currentBuffer].vCounter - currentBatch->vertexBuffer[currentBatch->currentBuffer].cCounter;
 
         for (int i = 0; i < addColors; i++)
         {
-            vertexData[currentBuffer].colors[4*vertexData[currentBuffer].cCounter] = vertexData[currentBuffer].colors[4*vertexData[currentBuffer].cCounter - 4];
-            vertexData[currentBuffer].colors[4*vertexData[currentBuffer].cCounter + 1] = vertexData[currentBuffer].colors[4*vertexData[currentBuffer].cCounter - 3];
-            vertexData[currentBuffer].colors[4*vertexData[currentBuffer].cCounter + 2] = vertexData[currentBuffer].colors[4*vertexData[currentBuffer].cCounter - 2];
-            vertexData[currentBuffer].colors[4*vertexData[currentBuffer].cCounter + 3] = vertexData[currentBuffer].colors[4*vertexData[currentBuffer].cCounter - 1];
-            vertexData[currentBuffer].cCounter++;
+#if defined(SUPPORT_BATCH_INTERLEAVED)
+            BatchVertex *elements = currentBatch->vertexBuffer[currentBatch->currentBuffer].elements;
+            memcpy(elements[currentBatch->vertexBuffer[currentBatch->currentBuffer].cCounter].color, elements[currentBatch->vertexBuffer[currentBatch->currentBuffer].cCounter - 1].color, 4);
+#else
+            currentBatch->vertexBuffer[currentBatch->currentBuffer].colors[4*currentBatch->vertexBuffer[currentBatch->currentBuffer].cCounter] = currentBatch->vertexBuffer[currentBatch->currentBuffer].colors[4*currentBatch->vertexBuffer[currentBatch->currentBuffer].cCounter - 4];
+            currentBatch->vertexBuffer[currentBatch->currentBuffer].colors[4*currentBatch->vertexBuffer[currentBatch->currentBuffer].cCounter + 1] = currentBatch->vertexBuffer[currentBatch->currentBuffer].colors[4*currentBatch->vertexBuffer[currentBatch->currentBuffer].cCounter - 3];
+            currentBatch->vertexBuffer[currentBatch->currentBuffer].colors[4*currentBatch->vertexBuffer[currentBatch->currentBuffer].cCounter + 2] = currentBatch->vertexBuffer[currentBatch->currentBuffer].colors[4*currentBatch->vertexBuffer[currentBatch->currentBuffer].cCounter - 2];
+            currentBatch->vertexBuffer[currentBatch->currentBuffer].colors[4*currentBatch->vertexBuffer[currentBatch->currentBuffer].cCounter + 3] = currentBatch->vertexBuffer[currentBatch->currentBuffer].colors[4*currentBatch->vertexBuffer[currentBatch->currentBuffer].cCounter - 1];
+#endif
+            currentBatch->vertexBuffer[currentBatch->currentBuffer].cCounter++;
         }
     }
 
     // Make sure texcoords count match vertex count
-    if (vertexData[currentBuffer].vCounter != vertexData[currentBuffer].tcCounter)
+    if (currentBatch->vertexBuffer[currentBatch->currentBuffer].vCounter != currentBatch->vertexBuffer[currentBatch->currentBuffer].tcCounter)
     {
-        int addTexCoords = vertexData[currentBuffer].vCounter - vertexData[currentBuffer].tcCounter;
+        int addTexCoords = currentBatch->vertexBuffer[currentBatch->currentBuffer].vCounter - currentBatch->vertexBuffer[currentBatch->currentBuffer].tcCounter;
 
         for (int i = 0; i < addTexCoords; i++)
         {
-            vertexData[currentBuffer].texcoords[2*vertexData[currentBuffer].tcCounter] = 0.0f;
-            vertexData[currentBuffer].texcoords[2*vertexData[currentBuffer].tcCounter + 1] = 0.0f;
-            vertexData[currentBuffer].tcCounter++;
+#if defined(SUPPORT_BATCH_INTERLEAVED)
+            currentBatch->vertexBuffer[currentBatch->currentBuffer].elements[currentBatch->vertexBuffer[currentBatch->currentBuffer].tcCounter].texcoord[0] = 0.0f;
+            currentBatch->vertexBuffer[currentBatch->currentBuffer].elements[currentBatch->vertexBuffer[currentBatch->currentBuffer].tcCounter].texcoord[1] = 0.0f;
+#else
+            currentBatch->vertexBuffer[currentBatch->currentBuffer].texcoords[2*currentBatch->vertexBuffer[currentBatch->currentBuffer].tcCounter] = 0.0f;
+            currentBatch->vertexBuffer[currentBatch->currentBuffer].texcoords[2*currentBatch->vertexBuffer[currentBatch->currentBuffer].tcCounter + 1] = 0.0f;
+#endif
+            currentBatch->vertexBuffer[currentBatch->currentBuffer].tcCounter++;
         }
     }
 
@@ -1137,16 +2077,18 @@ void rlEnd(void)
     // NOTE: Depth increment is dependant on rlOrtho(): z-near and z-far values,
     // as well as depth buffer bit-depth (16bit or 24bit or 32bit)
     // Correct increment formula would be: depthInc = (zfar - znear)/pow(2, bits)
-    currentDepth += (1.0f/20000.0f);
+    currentBatch->currentDepth += (1.0f/20000.0f);
 
     // Verify internal buffers limits
     // NOTE: This check is combined with usage of rlCheckBufferLimit()
-    if ((vertexData[currentBuffer].vCounter) >= (MAX_BATCH_ELEMENTS*4 - 4))
+    if ((currentBatch->vertexBuffer[currentBatch->currentBuffer].vCounter) >= (currentBatch->elements*4 - 4))
     {
         // WARNING: If we are between rlPushMatrix() and rlPopMatrix() and we need to force a rlglDraw(),
         // we need to call rlPopMatrix() before to recover *currentMatrix (modelview) for the next forced draw call!
         // If we have multiple matrix pushed, it will require "stackCounter" pops before launching the draw
-        for (int i = stackCounter; i >= 0; i--) rlPopMatrix();
+        // NOTE: Retained batches are not drawn on overflow (rlglDraw() just resets them), matrix stack is kept
+        if (!currentBatch->retained) for (int i = stackCounter; i >= 0; i--) rlPopMatrix();
+        flushReason = FLUSH_BUFFER_FULL;
         rlglDraw();
     }
 }
@@ -1160,38 +2102,89 @@ void rlVertex3f(float x, float y, float z)
     // Transform provided vector if required
     if (useTransformMatrix) vec = Vector3Transform(vec, transformMatrix);
 
-    // Verify that MAX_BATCH_ELEMENTS limit not reached
-    if (vertexData[currentBuffer].vCounter < (MAX_BATCH_ELEMENTS*4))
+    // Verify that batch elements limit not reached
+    if (currentBatch->vertexBuffer[currentBatch->currentBuffer].vCounter < (currentBatch->elements*4))
     {
-        vertexData[currentBuffer].vertices[3*vertexData[currentBuffer].vCounter] = vec.x;
-        vertexData[currentBuffer].vertices[3*vertexData[currentBuffer].vCounter + 1] = vec.y;
-        vertexData[currentBuffer].vertices[3*vertexData[currentBuffer].vCounter + 2] = vec.z;
-        vertexData[currentBuffer].vCounter++;
+#if defined(SUPPORT_BATCH_INTERLEAVED)
+        float *position = currentBatch->vertexBuffer[currentBatch->currentBuffer].elements[currentBatch->vertexBuffer[currentBatch->currentBuffer].vCounter].position;
+        position[0] = vec.x;
+        position[1] = vec.y;
+        position[2] = vec.z;
+#if defined(SUPPORT_BATCH_MULTITEXTURE)
+        currentBatch->vertexBuffer[currentBatch->currentBuffer].elements[currentBatch->vertexBuffer[currentBatch->currentBuffer].vCounter].texUnit = (unsigned char)currentTextureUnit;
+#endif
+#if defined(SUPPORT_BATCH_TEXTURE_ARRAYS)
+        currentBatch->vertexBuffer[currentBatch->currentBuffer].elements[currentBatch->vertexBuffer[currentBatch->currentBuffer].vCounter].texLayer = (unsigned short)currentTexLayer;
+#endif
+#else
+        currentBatch->vertexBuffer[currentBatch->currentBuffer].vertices[3*currentBatch->vertexBuffer[currentBatch->currentBuffer].vCounter] = vec.x;
+        currentBatch->vertexBuffer[currentBatch->currentBuffer].vertices[3*currentBatch->vertexBuffer[currentBatch->currentBuffer].vCounter + 1] = vec.y;
+        currentBatch->vertexBuffer[currentBatch->currentBuffer].vertices[3*currentBatch->vertexBuffer[currentBatch->currentBuffer].vCounter + 2] = vec.z;
+#endif
+        currentBatch->vertexBuffer[currentBatch->currentBuffer].vCounter++;
+
+        currentBatch->draws[currentBatch->drawsCounter - 1].vertexCount++;
+    }
+    else TraceLog(LOG_ERROR, "Batch elements overflow (%i)", currentBatch->elements);
+}
+
+// Define multiple vertex (position), 3 float per vertex (XYZ)
+// NOTE: Same result as rlVertex3f() per vertex, but batch limits are checked once and
+// transform matrix (if required) is applied in bulk, colors and texcoords are completed on rlEnd()
+void rlVertex3fv(const float *vertices, int count)
+{
+    AddBatchVertices(vertices, NULL, NULL, count);
+}
+
+// Define multiple quads vertex data, 4 vertex per quad: position (XYZ), texcoords (UV) and colors (RGBA)
+// NOTE: Requires rlBegin(RL_QUADS), texcoords and colors are optional (NULL), completed on rlEnd() if not provided
+void rlQuadBatch(const float *vertices, const float *texcoords, const unsigned char *colors, int quadCount)
+{
+    AddBatchVertices(vertices, texcoords, colors, quadCount*4);
+}
 
-        draws[drawsCounter - 1].vertexCount++;
+// Define multiple vertex data (position, texcoords and colors optional), any draw mode
+// NOTE: Texcoords and colors not provided are completed on rlEnd() (same as rlQuadBatch())
+void rlVertexBatch(const float *vertices, const float *texcoords, const unsigned char *colors, int count)
+{
+    AddBatchVertices(vertices, texcoords, colors, count);
+}
+
+// Set points size in pixels, used by RL_POINTS draws with default shader
+// NOTE: Batch is drawn if size changes, all points in a draw call share the same size
+void rlSetPointSize(float size)
+{
+    if (size != pointSize)
+    {
+        rlglDraw();
+        pointSize = size;
     }
-    else TraceLog(LOG_ERROR, "MAX_BATCH_ELEMENTS overflow");
 }
 
 // Define one vertex (position)
 void rlVertex2f(float x, float y)
 {
-    rlVertex3f(x, y, currentDepth);
+    rlVertex3f(x, y, currentBatch->currentDepth);
 }
 
 // Define one vertex (position)
 void rlVertex2i(int x, int y)
 {
-    rlVertex3f((float)x, (float)y, currentDepth);
+    rlVertex3f((float)x, (float)y, currentBatch->currentDepth);
 }
 
 // Define one vertex (texture coordinate)
 // NOTE: Texture coordinates are limited to QUADS only
 void rlTexCoord2f(float x, float y)
 {
-    vertexData[currentBuffer].texcoords[2*vertexData[currentBuffer].tcCounter] = x;
-    vertexData[currentBuffer].texcoords[2*vertexData[currentBuffer].tcCounter + 1] = y;
-    vertexData[currentBuffer].tcCounter++;
+#if defined(SUPPORT_BATCH_INTERLEAVED)
+    currentBatch->vertexBuffer[currentBatch->currentBuffer].elements[currentBatch->vertexBuffer[currentBatch->currentBuffer].tcCounter].texcoord[0] = x;
+    currentBatch->vertexBuffer[currentBatch->currentBuffer].elements[currentBatch->vertexBuffer[currentBatch->currentBuffer].tcCounter].texcoord[1] = y;
+#else
+    currentBatch->vertexBuffer[currentBatch->currentBuffer].texcoords[2*currentBatch->vertexBuffer[currentBatch->currentBuffer].tcCounter] = x;
+    currentBatch->vertexBuffer[currentBatch->currentBuffer].texcoords[2*currentBatch->vertexBuffer[currentBatch->currentBuffer].tcCounter + 1] = y;
+#endif
+    currentBatch->vertexBuffer[currentBatch->currentBuffer].tcCounter++;
 }
 
 // Define one vertex (normal)
@@ -1204,11 +2197,19 @@ void rlNormal3f(float x, float y, float z)
 // Define one vertex (color)
 void rlColor4ub(byte x, byte y, byte z, byte w)
 {
-    vertexData[currentBuffer].colors[4*vertexData[currentBuffer].cCounter] = x;
-    vertexData[currentBuffer].colors[4*vertexData[currentBuffer].cCounter + 1] = y;
-    vertexData[currentBuffer].colors[4*vertexData[currentBuffer].cCounter + 2] = z;
-    vertexData[currentBuffer].colors[4*vertexData[currentBuffer].cCounter + 3] = w;
-    vertexData[currentBuffer].cCounter++;
+#if defined(SUPPORT_BATCH_INTERLEAVED)
+    unsigned char *color = currentBatch->vertexBuffer[currentBatch->currentBuffer].elements[currentBatch->vertexBuffer[currentBatch->currentBuffer].cCounter].color;
+    color[0] = x;
+    color[1] = y;
+    color[2] = z;
+    color[3] = w;
+#else
+    currentBatch->vertexBuffer[currentBatch->currentBuffer].colors[4*currentBatch->vertexBuffer[currentBatch->currentBuffer].cCounter] = x;
+    currentBatch->vertexBuffer[currentBatch->currentBuffer].colors[4*currentBatch->vertexBuffer[currentBatch->currentBuffer].cCounter + 1] = y;
+    currentBatch->vertexBuffer[currentBatch->currentBuffer].colors[4*currentBatch->vertexBuffer[currentBatch->currentBuffer].cCounter + 2] = z;
+    currentBatch->vertexBuffer[currentBatch->currentBuffer].colors[4*currentBatch->vertexBuffer[currentBatch->currentBuffer].cCounter + 3] = w;
+#endif
+    currentBatch->vertexBuffer[currentBatch->currentBuffer].cCounter++;
 }
 
 // Define one vertex (color)
@@ -1225,6 +2226,15 @@ void rlColor3f(float x, float y, float z)
 
 #endif
 
+// Define texture array layer for next vertices
+// NOTE: Only used by draws with a texture array enabled (rlEnableTextureArray())
+void rlTexLayer(int layer)
+{
+#if defined(SUPPORT_BATCH_TEXTURE_ARRAYS)
+    currentTexLayer = layer;
+#endif
+}
+
 //----------------------------------------------------------------------------------
 // Module Functions Definition - OpenGL equivalent functions (common to 1.1, 3.3+, ES2)
 //----------------------------------------------------------------------------------
@@ -1232,45 +2242,113 @@ void rlColor3f(float x, float y, float z)
 // Enable texture usage
 void rlEnableTexture(unsigned int id)
 {
+    // NOTE: Callback could reload texture data before it is bound (residency tracking)
+    if (textureUseCallback != NULL) textureUseCallback(id);
+
 #if defined(GRAPHICS_API_OPENGL_11)
     glEnable(GL_TEXTURE_2D);
     glBindTexture(GL_TEXTURE_2D, id);
 #endif
 
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    if (draws[drawsCounter - 1].textureId != id)
+#if defined(SUPPORT_BATCH_TEXTURE_ARRAYS)
+    bool textureArray = textureArrayRequest;    // Texture array draws are never mixed with 2D textures
+    textureArrayRequest = false;
+#endif
+#if defined(SUPPORT_BATCH_MULTITEXTURE)
+    // Try to keep current draw call, selecting one of its texture units or registering a new one
+    // NOTE: Custom shaders only sample texture0, so every texture change requires a new draw call
+    if ((currentShader.id == defaultShader.id) && (currentBatch->draws[currentBatch->drawsCounter - 1].vertexCount > 0)
+#if defined(SUPPORT_BATCH_TEXTURE_ARRAYS)
+        && !textureArray && !currentBatch->draws[currentBatch->drawsCounter - 1].textureArray
+#endif
+        )
+    {
+        DrawCall *draw = &currentBatch->draws[currentBatch->drawsCounter - 1];
+
+        for (int i = 0; i < draw->textureCount; i++)
+        {
+            if (draw->textureIds[i] == id)
+            {
+                currentTextureUnit = i;
+                return;
+            }
+        }
+
+        if (draw->textureCount < batchTextureUnits)
+        {
+            draw->textureIds[draw->textureCount] = id;
+            currentTextureUnit = draw->textureCount;
+            draw->textureCount++;
+            return;
+        }
+    }
+#endif
+    if ((currentBatch->draws[currentBatch->drawsCounter - 1].textureId != id)
+#if defined(SUPPORT_BATCH_TEXTURE_ARRAYS)
+        || (currentBatch->draws[currentBatch->drawsCounter - 1].textureArray != textureArray)
+#endif
+        )
     {
-        if (draws[drawsCounter - 1].vertexCount > 0)
+        if (currentBatch->draws[currentBatch->drawsCounter - 1].vertexCount > 0)
         {
             // Make sure current draws[i].vertexCount is aligned a multiple of 4,
             // that way, following QUADS drawing will keep aligned with index processing
             // It implies adding some extra alignment vertex at the end of the draw,
             // those vertex are not processed but they are considered as an additional offset
             // for the next set of vertex to be drawn
-            if (draws[drawsCounter - 1].mode == RL_LINES) draws[drawsCounter - 1].vertexAlignment = ((draws[drawsCounter - 1].vertexCount < 4)? draws[drawsCounter - 1].vertexCount : draws[drawsCounter - 1].vertexCount%4);
-            else if (draws[drawsCounter - 1].mode == RL_TRIANGLES) draws[drawsCounter - 1].vertexAlignment = ((draws[drawsCounter - 1].vertexCount < 4)? 1 : (4 - (draws[drawsCounter - 1].vertexCount%4)));
+            if (currentBatch->draws[currentBatch->drawsCounter - 1].mode == RL_LINES) currentBatch->draws[currentBatch->drawsCounter - 1].vertexAlignment = ((currentBatch->draws[currentBatch->drawsCounter - 1].vertexCount < 4)? currentBatch->draws[currentBatch->drawsCounter - 1].vertexCount : currentBatch->draws[currentBatch->drawsCounter - 1].vertexCount%4);
+            else if (currentBatch->draws[currentBatch->drawsCounter - 1].mode == RL_TRIANGLES) currentBatch->draws[currentBatch->drawsCounter - 1].vertexAlignment = ((currentBatch->draws[currentBatch->drawsCounter - 1].vertexCount < 4)? 1 : (4 - (currentBatch->draws[currentBatch->drawsCounter - 1].vertexCount%4)));
+            else if (currentBatch->draws[currentBatch->drawsCounter - 1].mode == RL_POINTS) currentBatch->draws[currentBatch->drawsCounter - 1].vertexAlignment = (4 - (currentBatch->draws[currentBatch->drawsCounter - 1].vertexCount%4))%4;
 
-            else draws[drawsCounter - 1].vertexAlignment = 0;
+            else currentBatch->draws[currentBatch->drawsCounter - 1].vertexAlignment = 0;
 
-            if (rlCheckBufferLimit(draws[drawsCounter - 1].vertexAlignment)) rlglDraw();
+            if (rlCheckBufferLimit(currentBatch->draws[currentBatch->drawsCounter - 1].vertexAlignment)) rlglDraw();
             else
             {
-                vertexData[currentBuffer].vCounter += draws[drawsCounter - 1].vertexAlignment;
-                vertexData[currentBuffer].cCounter += draws[drawsCounter - 1].vertexAlignment;
-                vertexData[currentBuffer].tcCounter += draws[drawsCounter - 1].vertexAlignment;
+                currentBatch->vertexBuffer[currentBatch->currentBuffer].vCounter += currentBatch->draws[currentBatch->drawsCounter - 1].vertexAlignment;
+                currentBatch->vertexBuffer[currentBatch->currentBuffer].cCounter += currentBatch->draws[currentBatch->drawsCounter - 1].vertexAlignment;
+                currentBatch->vertexBuffer[currentBatch->currentBuffer].tcCounter += currentBatch->draws[currentBatch->drawsCounter - 1].vertexAlignment;
 
-                drawsCounter++;
+                currentBatch->drawsCounter++;
             }
         }
 
-        if (drawsCounter >= MAX_DRAWCALL_REGISTERED) rlglDraw();
+        if (currentBatch->drawsCounter >= MAX_DRAWCALL_REGISTERED)
+        {
+            flushReason = FLUSH_TEXTURE_CHANGE;
+            rlglDraw();
+        }
 
-        draws[drawsCounter - 1].textureId = id;
-        draws[drawsCounter - 1].vertexCount = 0;
+        currentBatch->draws[currentBatch->drawsCounter - 1].textureId = id;
+        currentBatch->draws[currentBatch->drawsCounter - 1].vertexCount = 0;
+        currentBatch->draws[currentBatch->drawsCounter - 1].layer = currentDrawLayer;
+        SetDrawCallState(&currentBatch->draws[currentBatch->drawsCounter - 1]);
+#if defined(SUPPORT_BATCH_MULTITEXTURE)
+        currentBatch->draws[currentBatch->drawsCounter - 1].textureIds[0] = id;
+        currentBatch->draws[currentBatch->drawsCounter - 1].textureCount = 1;
+        currentTextureUnit = 0;
+#endif
+#if defined(SUPPORT_BATCH_TEXTURE_ARRAYS)
+        currentBatch->draws[currentBatch->drawsCounter - 1].textureArray = textureArray;
+#endif
     }
 #endif
 }
 
+// Enable texture array usage
+// NOTE: Array layer is defined per vertex with rlTexLayer(), so sprites from
+// multiple layers (animation frames, tiles) keep the same draw call
+void rlEnableTextureArray(unsigned int id)
+{
+#if defined(SUPPORT_BATCH_TEXTURE_ARRAYS)
+    textureArrayRequest = true;
+    rlEnableTexture(id);
+#else
+    TraceLog(LOG_WARNING, "TEXTURE: [ID %i] Texture arrays not supported by batch", id);
+#endif
+}
+
 // Disable texture usage
 void rlDisableTexture(void)
 {
@@ -1280,13 +2358,19 @@ void rlDisableTexture(void)
 #else
     // NOTE: If quads batch limit is reached,
     // we force a draw call and next batch starts
-    if (vertexData[currentBuffer].vCounter >= (MAX_BATCH_ELEMENTS*4)) rlglDraw();
+    if (currentBatch->vertexBuffer[currentBatch->currentBuffer].vCounter >= (currentBatch->elements*4))
+    {
+        flushReason = FLUSH_BUFFER_FULL;
+        rlglDraw();
+    }
 #endif
 }
 
 // Set texture parameters (wrap mode/filter mode)
 void rlTextureParameters(unsigned int id, int param, int value)
 {
+    ReleaseMeshState();
+
     glBindTexture(GL_TEXTURE_2D, id);
 
     switch (param)
@@ -1329,6 +2413,7 @@ void rlEnableRenderTexture(unsigned int id)
 {
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
     glBindFramebuffer(GL_FRAMEBUFFER, id);
+    CAPTURE_STATE(CAPTURE_STATE_RENDER_TEXTURE, id, 0, 0, 0);
 
     //glDisable(GL_CULL_FACE);    // Allow double side drawing for texture flipping
     //glCullFace(GL_FRONT);
@@ -1340,6 +2425,7 @@ void rlDisableRenderTexture(void)
 {
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
     glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    CAPTURE_STATE(CAPTURE_STATE_RENDER_TEXTURE, 0, 0, 0, 0);
 
     //glEnable(GL_CULL_FACE);
     //glCullFace(GL_BACK);
@@ -1347,25 +2433,47 @@ void rlDisableRenderTexture(void)
 }
 
 // Enable depth test
-void rlEnableDepthTest(void) { glEnable(GL_DEPTH_TEST); }
+void rlEnableDepthTest(void) { glEnable(GL_DEPTH_TEST); CAPTURE_STATE(CAPTURE_STATE_DEPTH_TEST, 1, 0, 0, 0); }
 
 // Disable depth test
-void rlDisableDepthTest(void) { glDisable(GL_DEPTH_TEST); }
+void rlDisableDepthTest(void) { glDisable(GL_DEPTH_TEST); CAPTURE_STATE(CAPTURE_STATE_DEPTH_TEST, 0, 0, 0, 0); }
 
 // Enable backface culling
-void rlEnableBackfaceCulling(void) { glEnable(GL_CULL_FACE); }
+void rlEnableBackfaceCulling(void) { glEnable(GL_CULL_FACE); CAPTURE_STATE(CAPTURE_STATE_BACKFACE_CULLING, 1, 0, 0, 0); }
 
 // Disable backface culling
-void rlDisableBackfaceCulling(void) { glDisable(GL_CULL_FACE); }
+void rlDisableBackfaceCulling(void) { glDisable(GL_CULL_FACE); CAPTURE_STATE(CAPTURE_STATE_BACKFACE_CULLING, 0, 0, 0, 0); }
 
 // Enable scissor test
-RLAPI void rlEnableScissorTest(void) { glEnable(GL_SCISSOR_TEST); }
+// NOTE: Scissor state is registered per draw call, batch is not flushed
+RLAPI void rlEnableScissorTest(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    UpdateDrawState(blendMode, true, scissorRect[0], scissorRect[1], scissorRect[2], scissorRect[3]);
+#endif
+    glEnable(GL_SCISSOR_TEST);
+    CAPTURE_STATE(CAPTURE_STATE_SCISSOR_TEST, 1, 0, 0, 0);
+}
 
 // Disable scissor test
-RLAPI void rlDisableScissorTest(void) { glDisable(GL_SCISSOR_TEST); }
+RLAPI void rlDisableScissorTest(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    UpdateDrawState(blendMode, false, scissorRect[0], scissorRect[1], scissorRect[2], scissorRect[3]);
+#endif
+    glDisable(GL_SCISSOR_TEST);
+    CAPTURE_STATE(CAPTURE_STATE_SCISSOR_TEST, 0, 0, 0, 0);
+}
 
 // Scissor test
-RLAPI void rlScissor(int x, int y, int width, int height) { glScissor(x, y, width, height); }
+RLAPI void rlScissor(int x, int y, int width, int height)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    UpdateDrawState(blendMode, scissorTest, x, y, width, height);
+#endif
+    glScissor(x, y, width, height);
+    CAPTURE_STATE(CAPTURE_STATE_SCISSOR, x, y, width, height);
+}
 
 // Enable wire mode
 void rlEnableWireMode(void)
@@ -1374,6 +2482,7 @@ void rlEnableWireMode(void)
     // NOTE: glPolygonMode() not available on OpenGL ES
     glPolygonMode(GL_FRONT_AND_BACK, GL_LINE);
 #endif
+    CAPTURE_STATE(CAPTURE_STATE_WIRE_MODE, 1, 0, 0, 0);
 }
 
 // Disable wire mode
@@ -1382,24 +2491,65 @@ void rlDisableWireMode(void)
 #if defined (GRAPHICS_API_OPENGL_11) || defined(GRAPHICS_API_OPENGL_33)
     // NOTE: glPolygonMode() not available on OpenGL ES
     glPolygonMode(GL_FRONT_AND_BACK, GL_FILL);
+#endif
+    CAPTURE_STATE(CAPTURE_STATE_WIRE_MODE, 0, 0, 0, 0);
+}
+
+// Enable draw calls sorting and merging before batch draw
+// NOTE: Draw calls in the same layer could be reordered (grouped by texture and mode),
+// use it only if draw order inside a layer does not matter (i.e. no overlapping transparencies)
+void rlEnableDrawSorting(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    drawSorting = true;
+#endif
+}
+
+// Disable draw calls sorting, submit them in order
+void rlDisableDrawSorting(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    drawSorting = false;
+#endif
+}
+
+// Set layer for next draw calls
+// NOTE: Only used when draw calls sorting is enabled, lower layers are drawn first
+void rlSetDrawLayer(int layer)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (currentDrawLayer != layer)
+    {
+        SplitDrawCall();
+
+        currentBatch->draws[currentBatch->drawsCounter - 1].layer = layer;
+        currentDrawLayer = layer;
+    }
 #endif
 }
 
 // Unload texture from GPU memory
 void rlDeleteTextures(unsigned int id)
 {
+    ReleaseMeshState();
+
     if (id > 0) glDeleteTextures(1, &id);
+    UntrackVideoMemory(VIDEO_MEMORY_TEXTURE, id);
 }
 
 // Unload render texture from GPU memory
 void rlDeleteRenderTextures(RenderTexture2D target)
 {
+    ReleaseMeshState();
+
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
     if (target.texture.id > 0) glDeleteTextures(1, &target.texture.id);
+    UntrackVideoMemory(VIDEO_MEMORY_TEXTURE, target.texture.id);
     if (target.depth.id > 0)
     {
         if (target.depthTexture) glDeleteTextures(1, &target.depth.id);
         else glDeleteRenderbuffers(1, &target.depth.id);
+        UntrackVideoMemory(target.depthTexture? VIDEO_MEMORY_TEXTURE : VIDEO_MEMORY_RENDERBUFFER, target.depth.id);
     }
 
     if (target.id > 0) glDeleteFramebuffers(1, &target.id);
@@ -1411,6 +2561,8 @@ void rlDeleteRenderTextures(RenderTexture2D target)
 // Unload shader from GPU memory
 void rlDeleteShader(unsigned int id)
 {
+    ReleaseMeshState();
+
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
     if (id != 0) glDeleteProgram(id);
 #endif
@@ -1419,6 +2571,8 @@ void rlDeleteShader(unsigned int id)
 // Unload vertex data (VAO) from GPU memory
 void rlDeleteVertexArrays(unsigned int id)
 {
+    ReleaseMeshState();
+
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
     if (vaoSupported)
     {
@@ -1431,10 +2585,14 @@ void rlDeleteVertexArrays(unsigned int id)
 // Unload vertex data (VBO) from GPU memory
 void rlDeleteBuffers(unsigned int id)
 {
+    ReleaseMeshState();
+
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
     if (id != 0)
     {
         glDeleteBuffers(1, &id);
+        UntrackVideoMemory(VIDEO_MEMORY_BUFFER, id);
+        ResetVertexAttribs(id);
         if (!vaoSupported) TraceLog(LOG_INFO, "[VBO ID %i] Unloaded model vertex data from VRAM (GPU)", id);
     }
 #endif
@@ -1450,6 +2608,7 @@ void rlClearColor(byte r, byte g, byte b, byte a)
     float ca = (float)a/255;
 
     glClearColor(cr, cg, cb, ca);
+    CAPTURE_STATE(CAPTURE_STATE_CLEAR_COLOR, r, g, b, a);
 }
 
 // Clear used screen buffers (color and depth)
@@ -1457,14 +2616,19 @@ void rlClearScreenBuffers(void)
 {
     glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);     // Clear used buffers: Color and Depth (Depth is used for 3D)
     //glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT | GL_STENCIL_BUFFER_BIT);     // Stencil buffer not used...
+    CAPTURE_STATE(CAPTURE_STATE_CLEAR, 0, 0, 0, 0);
 }
 
 // Update GPU buffer with new data
 void rlUpdateBuffer(int bufferId, void *data, int dataSize)
 {
+    ReleaseMeshState();
+
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
     glBindBuffer(GL_ARRAY_BUFFER, bufferId);
     glBufferSubData(GL_ARRAY_BUFFER, 0, dataSize, data);
+
+    renderStats.uploadedBytes += dataSize;
 #endif
 }
 
@@ -1504,6 +2668,17 @@ void rlglInit(int width, int height)
 
     // NOTE: We don't need that much data on screen... right now...
 
+#if defined(GRAPHICS_API_OPENGL_11)
+    // Check automatic mipmaps generation support (core since OpenGL 1.4, GL_SGIS_generate_mipmap)
+    const char *glVersion = (const char *)glGetString(GL_VERSION);
+    const char *glExtensions = (const char *)glGetString(GL_EXTENSIONS);
+
+    if ((glVersion != NULL) && ((glVersion[0] > '1') || ((glVersion[0] == '1') && (glVersion[1] == '.') && (glVersion[2] >= '4')))) autoMipmapSupported = true;
+    if ((glExtensions != NULL) && (strstr(glExtensions, "GL_SGIS_generate_mipmap") != NULL)) autoMipmapSupported = true;
+
+    if (autoMipmapSupported) TraceLog(LOG_INFO, "[EXTENSION] Automatic mipmaps generation supported");
+#endif
+
     // TODO: Automatize extensions loading using rlLoadExtensions() and GLAD
     // Actually, when rlglInit() is called in InitWindow() in core.c,
     // OpenGL required extensions have already been loaded (PLATFORM_DESKTOP)
@@ -1521,11 +2696,57 @@ void rlglInit(int width, int height)
     texFloatSupported = true;
     texDepthSupported = true;
 
-    // We get a list of available extensions and we check for some of them (compressed textures)
-    // NOTE: We don't need to check again supported extensions but we do (GLAD already dealt with that)
-    glGetIntegerv(GL_NUM_EXTENSIONS, &numExt);
+    // Instanced drawing (glDrawElementsInstanced() and glVertexAttribDivisor()) and timer queries are core since OpenGL 3.3
+    #if !defined(__APPLE__)
+    instancingSupported = GLAD_GL_VERSION_3_3;
+    timerQuerySupported = GLAD_GL_VERSION_3_3;
+    #elif !defined(GRAPHICS_API_OPENGL_21)
+    instancingSupported = true;
+    timerQuerySupported = true;
+    #endif
 
-    // Allocate numExt strings pointers
+    // Half float vertex attributes are core since OpenGL 3.0 and packed 10:10:10:2 attributes since OpenGL 3.3
+    #if !defined(__APPLE__)
+    halfFloatAttribSupported = GLAD_GL_VERSION_3_0;
+    packedAttribSupported = GLAD_GL_VERSION_3_3;
+    #elif !defined(GRAPHICS_API_OPENGL_21)
+    halfFloatAttribSupported = true;
+    packedAttribSupported = true;
+    #endif
+
+    // Uniform buffer objects are core since OpenGL 3.1
+    #if !defined(__APPLE__)
+    uboSupported = GLAD_GL_VERSION_3_1;
+    #elif !defined(GRAPHICS_API_OPENGL_21)
+    uboSupported = true;
+    #endif
+
+    // glMapBufferRange() is core since OpenGL 3.0 and fence sync objects since OpenGL 3.2
+    #if !defined(__APPLE__)
+    mapBufferRangeSupported = GLAD_GL_VERSION_3_2;
+    #elif !defined(GRAPHICS_API_OPENGL_21)
+    mapBufferRangeSupported = true;
+    #endif
+
+    // Texture arrays (GL_TEXTURE_2D_ARRAY, sampler2DArray) are core since OpenGL 3.0
+    #if !defined(__APPLE__)
+    texArraySupported = GLAD_GL_VERSION_3_0;
+    #elif !defined(GRAPHICS_API_OPENGL_21)
+    texArraySupported = true;
+    #endif
+
+    // Compute shaders and shader storage buffers are core since OpenGL 4.3 (entry points loaded by rlLoadExtensions())
+    // NOTE: macOS OpenGL is limited to 4.1, compute shaders are not available
+    #if !defined(__APPLE__)
+    computeSupported = ((GLVersion.major > 4) || ((GLVersion.major == 4) && (GLVersion.minor >= 3))) &&
+                       (glDispatchCompute != NULL) && (glMemoryBarrier != NULL) && (glBindImageTexture != NULL);
+    #endif
+
+    // We get a list of available extensions and we check for some of them (compressed textures)
+    // NOTE: We don't need to check again supported extensions but we do (GLAD already dealt with that)
+    glGetIntegerv(GL_NUM_EXTENSIONS, &numExt);
+
+    // Allocate numExt strings pointers
     const char **extList = RL_MALLOC(sizeof(const char *)*numExt);
 
     // Get extensions strings
@@ -1588,12 +2809,49 @@ void rlglInit(int width, int height)
         // Check texture float support
         if (strcmp(extList[i], (const char *)"GL_OES_texture_float") == 0) texFloatSupported = true;
 
+        // Check half float vertex attributes support
+        if (strcmp(extList[i], (const char *)"GL_OES_vertex_half_float") == 0) halfFloatAttribSupported = true;
+
         // Check depth texture support
         if ((strcmp(extList[i], (const char *)"GL_OES_depth_texture") == 0) ||
             (strcmp(extList[i], (const char *)"GL_WEBGL_depth_texture") == 0)) texDepthSupported = true;
 
         if (strcmp(extList[i], (const char *)"GL_OES_depth24") == 0) maxDepthBits = 24;
         if (strcmp(extList[i], (const char *)"GL_OES_depth32") == 0) maxDepthBits = 32;
+
+        // Check 32 bit indices support
+        if (strcmp(extList[i], (const char *)"GL_OES_element_index_uint") == 0) elementIndexUintSupported = true;
+
+        // Check instanced drawing support
+        if ((strcmp(extList[i], (const char *)"GL_EXT_instanced_arrays") == 0) ||
+            (strcmp(extList[i], (const char *)"GL_ANGLE_instanced_arrays") == 0))
+        {
+            const char *suffix = (extList[i][3] == 'E')? "EXT" : "ANGLE";
+            char procName[64] = { 0 };
+
+            sprintf(procName, "glDrawArraysInstanced%s", suffix);
+            glDrawArraysInstanced = (PFNGLDRAWARRAYSINSTANCEDEXTPROC)eglGetProcAddress(procName);
+            sprintf(procName, "glDrawElementsInstanced%s", suffix);
+            glDrawElementsInstanced = (PFNGLDRAWELEMENTSINSTANCEDEXTPROC)eglGetProcAddress(procName);
+            sprintf(procName, "glVertexAttribDivisor%s", suffix);
+            glVertexAttribDivisor = (PFNGLVERTEXATTRIBDIVISOREXTPROC)eglGetProcAddress(procName);
+
+            if ((glDrawArraysInstanced != NULL) && (glDrawElementsInstanced != NULL) && (glVertexAttribDivisor != NULL)) instancingSupported = true;
+        }
+
+        // Check program binaries support
+        if (strcmp(extList[i], (const char *)"GL_OES_get_program_binary") == 0)
+        {
+            glGetProgramBinary = (PFNGLGETPROGRAMBINARYOESPROC)eglGetProcAddress("glGetProgramBinaryOES");
+            glProgramBinary = (PFNGLPROGRAMBINARYOESPROC)eglGetProcAddress("glProgramBinaryOES");
+
+            if ((glGetProgramBinary != NULL) && (glProgramBinary != NULL)) programBinarySupported = true;
+        }
+#endif
+#if defined(GRAPHICS_API_OPENGL_33) && !defined(__APPLE__)
+        // Check program binaries support (entry points loaded by rlLoadExtensions())
+        if ((strcmp(extList[i], (const char *)"GL_ARB_get_program_binary") == 0) &&
+            (glGetProgramBinary != NULL) && (glProgramBinary != NULL)) programBinarySupported = true;
 #endif
         // DDS texture compression support
         if ((strcmp(extList[i], (const char *)"GL_EXT_texture_compression_s3tc") == 0) ||
@@ -1625,6 +2883,11 @@ void rlglInit(int width, int height)
 
         // Debug marker support
         if (strcmp(extList[i], (const char *)"GL_EXT_debug_marker") == 0) debugMarkerSupported = true;
+
+#if defined(SUPPORT_BATCH_STREAMING) && defined(GRAPHICS_API_OPENGL_33) && !defined(__APPLE__)
+        // Immutable buffer storage support (core since OpenGL 4.4)
+        if (strcmp(extList[i], (const char *)"GL_ARB_buffer_storage") == 0) bufferStorageSupported = true;
+#endif
     }
 
     // Free extensions pointers
@@ -1633,6 +2896,42 @@ void rlglInit(int width, int height)
 #if defined(GRAPHICS_API_OPENGL_ES2)
     RL_FREE(extensionsDup);    // Duplicated string must be deallocated
 
+    // Check OpenGL ES 3.0 context (WebGL 2.0 on emscripten), extensions promoted to core are not listed
+    // NOTE: Version string format: "OpenGL ES 3.0 <vendor-specific>" or "OpenGL ES 3.0 (WebGL 2.0 ...)"
+    const char *version = (const char *)glGetString(GL_VERSION);
+    if ((version != NULL) && (strncmp(version, "OpenGL ES 3", 11) == 0)) contextES3 = true;
+
+    if (contextES3)
+    {
+        if (!vaoSupported)
+        {
+            glGenVertexArrays = (PFNGLGENVERTEXARRAYSOESPROC)eglGetProcAddress("glGenVertexArrays");
+            glBindVertexArray = (PFNGLBINDVERTEXARRAYOESPROC)eglGetProcAddress("glBindVertexArray");
+            glDeleteVertexArrays = (PFNGLDELETEVERTEXARRAYSOESPROC)eglGetProcAddress("glDeleteVertexArrays");
+
+            if ((glGenVertexArrays != NULL) && (glBindVertexArray != NULL) && (glDeleteVertexArrays != NULL)) vaoSupported = true;
+        }
+
+        if (!instancingSupported)
+        {
+            glDrawArraysInstanced = (PFNGLDRAWARRAYSINSTANCEDEXTPROC)eglGetProcAddress("glDrawArraysInstanced");
+            glDrawElementsInstanced = (PFNGLDRAWELEMENTSINSTANCEDEXTPROC)eglGetProcAddress("glDrawElementsInstanced");
+            glVertexAttribDivisor = (PFNGLVERTEXATTRIBDIVISOREXTPROC)eglGetProcAddress("glVertexAttribDivisor");
+
+            if ((glDrawArraysInstanced != NULL) && (glDrawElementsInstanced != NULL) && (glVertexAttribDivisor != NULL)) instancingSupported = true;
+        }
+
+        // NOTE: Float textures are not enabled, ES3 requires sized internal formats (GL_RGBA32F) not used by ES2 code path
+        texNPOTSupported = true;
+        texDepthSupported = true;
+        elementIndexUintSupported = true;
+        halfFloatAttribSupported = true;
+        packedAttribSupported = true;
+        if (maxDepthBits < 24) maxDepthBits = 24;
+
+        TraceLog(LOG_INFO, "[EXTENSION] OpenGL ES 3.0 context detected, core features enabled on ES2 code path");
+    }
+
     if (vaoSupported) TraceLog(LOG_INFO, "[EXTENSION] VAO extension detected, VAO functions initialized successfully");
     else TraceLog(LOG_WARNING, "[EXTENSION] VAO extension not found, VAO usage not supported");
 
@@ -1640,6 +2939,9 @@ void rlglInit(int width, int height)
     else TraceLog(LOG_WARNING, "[EXTENSION] NPOT textures extension not found, limited NPOT support (no-mipmaps, no-repeat)");
 #endif
 
+    if (instancingSupported) TraceLog(LOG_INFO, "[EXTENSION] Instanced drawing supported");
+    else TraceLog(LOG_WARNING, "[EXTENSION] Instanced drawing not supported, instances drawn one by one");
+
     if (texCompDXTSupported) TraceLog(LOG_INFO, "[EXTENSION] DXT compressed textures supported");
     if (texCompETC1Supported) TraceLog(LOG_INFO, "[EXTENSION] ETC1 compressed textures supported");
     if (texCompETC2Supported) TraceLog(LOG_INFO, "[EXTENSION] ETC2/EAC compressed textures supported");
@@ -1651,6 +2953,34 @@ void rlglInit(int width, int height)
 
     if (debugMarkerSupported) TraceLog(LOG_INFO, "[EXTENSION] Debug Marker supported");
 
+    // NOTE: Some drivers expose the extension but no binary formats
+    if (programBinarySupported)
+    {
+        GLint binaryFormats = 0;
+        glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &binaryFormats);
+        if (binaryFormats <= 0) programBinarySupported = false;
+    }
+
+    if (programBinarySupported) TraceLog(LOG_INFO, "[EXTENSION] Program binaries supported, shader cache available");
+#if defined(GRAPHICS_API_OPENGL_33)
+    if (uboSupported) TraceLog(LOG_INFO, "[EXTENSION] Uniform buffer objects supported");
+    if (texArraySupported) TraceLog(LOG_INFO, "[EXTENSION] Texture arrays supported");
+    if (computeSupported) TraceLog(LOG_INFO, "[EXTENSION] Compute shaders and shader storage buffers supported");
+#endif
+
+#if defined(SUPPORT_BATCH_STREAMING)
+    // Choose best streaming mode available for default internal buffers
+    // NOTE: Multi-buffering is required to avoid waiting on the buffer the GPU is currently reading
+    if (mapBufferRangeSupported && (MAX_BATCH_BUFFERING > 1))
+    {
+        if (bufferStorageSupported) batchStreamMode = BATCH_STREAM_PERSISTENT;
+        else batchStreamMode = BATCH_STREAM_MAP_RANGE;
+    }
+
+    if (batchStreamMode == BATCH_STREAM_PERSISTENT) TraceLog(LOG_INFO, "[EXTENSION] Buffer storage supported, batch streaming using persistent-mapped buffers (%i)", MAX_BATCH_BUFFERING);
+    else if (batchStreamMode == BATCH_STREAM_MAP_RANGE) TraceLog(LOG_INFO, "Batch streaming using mapped buffer ranges (%i)", MAX_BATCH_BUFFERING);
+#endif
+
     // Initialize buffers, default shaders and default textures
     //----------------------------------------------------------
     // Init default white texture
@@ -1660,32 +2990,59 @@ void rlglInit(int width, int height)
     if (defaultTextureId != 0) TraceLog(LOG_INFO, "[TEX ID %i] Base white texture loaded successfully", defaultTextureId);
     else TraceLog(LOG_WARNING, "Base white texture could not be loaded");
 
+#if defined(SUPPORT_BATCH_MULTITEXTURE)
+    // Get texture units available for batch multitexturing
+    int maxTextureUnits = 0;
+    glGetIntegerv(GL_MAX_TEXTURE_IMAGE_UNITS, &maxTextureUnits);
+    batchTextureUnits = (maxTextureUnits < MAX_BATCH_TEXTURE_UNITS)? maxTextureUnits : MAX_BATCH_TEXTURE_UNITS;
+    if (batchTextureUnits < 1) batchTextureUnits = 1;
+
+    TraceLog(LOG_INFO, "Batch multitexturing using %i texture units per draw", batchTextureUnits);
+#endif
+
     // Init default Shader (customized for GL 3.3 and ES2)
     defaultShader = LoadShaderDefault();
     currentShader = defaultShader;
 
-    // Init default vertex arrays buffers
-    LoadBuffersDefault();
+#if defined(SUPPORT_BATCH_TEXTURE_ARRAYS)
+    // Init default texture array shader, used by batch draws with texture arrays
+    if (texArraySupported) defaultArrayShader = LoadShaderArrayDefault();
+#endif
+
+#if defined(SUPPORT_GPU_SKINNING)
+    // Init default skinning shader, used by GPU skinned meshes drawn with default shader
+    defaultSkinShader = LoadShaderSkinDefault();
+#endif
 
-    // Init transformations matrix accumulator
-    transformMatrix = MatrixIdentity();
+    // Init default points shader, used by batch points draws with default shader
+    defaultPointShader = LoadShaderPointDefault();
 
-    // Init draw calls tracking system
-    draws = (DrawCall *)RL_MALLOC(sizeof(DrawCall)*MAX_DRAWCALL_REGISTERED);
+#if defined(SUPPORT_VR_SINGLE_PASS)
+    // Init default stereo shader, used by batch draws while VR stereo rendering (single pass)
+    if (instancingSupported) defaultStereoShader = LoadShaderStereoDefault();
+#endif
 
-    for (int i = 0; i < MAX_DRAWCALL_REGISTERED; i++)
+#if defined(GRAPHICS_API_OPENGL_33)
+    // Init frame uniform block buffer, bound to binding point 0
+    // NOTE: Shaders declaring the block get it bound on loading (SetShaderDefaultLocations())
+    if (uboSupported)
     {
-        draws[i].mode = RL_QUADS;
-        draws[i].vertexCount = 0;
-        draws[i].vertexAlignment = 0;
-        //draws[i].vaoId = 0;
-        //draws[i].shaderId = 0;
-        draws[i].textureId = defaultTextureId;
-        //draws[i].projection = MatrixIdentity();
-        //draws[i].modelview = MatrixIdentity();
+        glGenBuffers(1, &frameBlockId);
+        glBindBuffer(GL_UNIFORM_BUFFER, frameBlockId);
+        glBufferData(GL_UNIFORM_BUFFER, sizeof(FrameBlockData), &frameBlock, GL_DYNAMIC_DRAW);
+        glBindBuffer(GL_UNIFORM_BUFFER, 0);
+        glBindBufferBase(GL_UNIFORM_BUFFER, 0, frameBlockId);
+        frameBlockDirty = true;
     }
+#endif
+
+    // Init default render batch: vertex arrays buffers and draw calls tracking system
+    LoadBatchBuffers(&defaultBatch, MAX_BATCH_BUFFERING, batchElements);
+    batchElements = defaultBatch.elements;
+    currentBatch = &defaultBatch;
 
-    drawsCounter = 1;
+    // Init transformations matrix accumulator
+    transformMatrix = MatrixIdentity();
 
     // Init internal matrix stack (emulating OpenGL 1.1)
     for (int i = 0; i < MAX_MATRIX_STACK_SIZE; i++) stack[i] = MatrixIdentity();
@@ -1733,27 +3090,167 @@ void rlglInit(int width, int height)
 // Vertex Buffer Object deinitialization (memory free)
 void rlglClose(void)
 {
+    ReleaseMeshState();
+
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
     UnloadShaderDefault();              // Unload default shader
-    UnloadBuffersDefault();             // Unload default buffers
+    UnloadBatchBuffers(&defaultBatch);  // Unload default render batch
+    currentBatch = NULL;
+    ResetVertexAttribs(0);              // Forget vertex attributes state, buffers are unloaded
     glDeleteTextures(1, &defaultTextureId); // Unload default texture
+    UntrackVideoMemory(VIDEO_MEMORY_TEXTURE, defaultTextureId);
+    if (instanceVboId != 0) glDeleteBuffers(1, &instanceVboId);    // Unload per-instance transforms buffer
+
+    // Unload billboards shader and buffers
+    if (billboardShader.id > 0) glDeleteProgram(billboardShader.id);
+    RL_FREE(billboardShader.locs);
+    billboardShader = (Shader){ 0 };
+    if (billboardVaoId != 0) glDeleteVertexArrays(1, &billboardVaoId);
+    if (billboardVboId[0] != 0) glDeleteBuffers(2, billboardVboId);
+    billboardVaoId = 0;
+    billboardVboId[0] = 0;
+    billboardVboId[1] = 0;
+    billboardBufferCapacity = 0;
+
+    // Unload SDF shapes shader and buffers
+    if (shapeSDFShader.id > 0) glDeleteProgram(shapeSDFShader.id);
+    RL_FREE(shapeSDFShader.locs);
+    shapeSDFShader = (Shader){ 0 };
+    if (shapeSDFVaoId != 0) glDeleteVertexArrays(1, &shapeSDFVaoId);
+    if (shapeSDFVboId[0] != 0) glDeleteBuffers(2, shapeSDFVboId);
+    shapeSDFVaoId = 0;
+    shapeSDFVboId[0] = 0;
+    shapeSDFVboId[1] = 0;
+    RL_FREE(shapeSDFInstances);
+    shapeSDFInstances = NULL;
+    shapeSDFCount = 0;
+#if defined(GRAPHICS_API_OPENGL_ES2)
+    if (readbackFramebufferId != 0) glDeleteFramebuffers(1, &readbackFramebufferId);   // Unload pixels readback framebuffer
+    readbackFramebufferId = 0;
+#endif
+
+    // Unload pooled render textures
+    for (int i = 0; i < MAX_RENDER_TEXTURE_POOL; i++)
+    {
+        if (renderTexturePool[i].target.id != 0) rlDeleteRenderTextures(renderTexturePool[i].target);
+        renderTexturePool[i] = (PooledRenderTexture){ 0 };
+    }
+
+#if defined(GRAPHICS_API_OPENGL_33)
+    // Unload GPU timing zones queries
+    if (gpuZonesQueries[0][0][0] != 0) glDeleteQueries(2*MAX_GPU_ZONES*2, &gpuZonesQueries[0][0][0]);
+
+    // Unload asynchronous texture uploads pixel buffers
+    for (int i = 0; i < MAX_TEXTURE_UPLOADS; i++)
+    {
+        if (textureUploads[i].fence != NULL) glDeleteSync(textureUploads[i].fence);
+        if (textureUploads[i].pboId != 0) glDeleteBuffers(1, &textureUploads[i].pboId);
+        textureUploads[i] = (TextureUpload){ 0 };
+    }
+
+    // Unload asynchronous screen readbacks pixel buffers
+    for (int i = 0; i < MAX_SCREEN_READBACKS; i++)
+    {
+        if (screenReadbacks[i].fence != NULL) glDeleteSync(screenReadbacks[i].fence);
+        if (screenReadbacks[i].pboId != 0) glDeleteBuffers(1, &screenReadbacks[i].pboId);
+        screenReadbacks[i] = (ScreenReadback){ 0 };
+    }
+
+    // Delete dynamic meshes frames fences
+    for (int i = 0; i < MAX_MESH_BUFFERING; i++)
+    {
+        if (meshFrameFences[i] != NULL) glDeleteSync(meshFrameFences[i]);
+        meshFrameFences[i] = NULL;
+    }
+
+    // Unload frame and user uniform blocks buffers
+    if (frameBlockId != 0) glDeleteBuffers(1, &frameBlockId);
+    frameBlockId = 0;
+    for (int i = 0; i < MAX_UNIFORM_BLOCKS; i++)
+    {
+        if (uniformBlocks[i].id != 0) glDeleteBuffers(1, &uniformBlocks[i].id);
+        uniformBlocks[i].id = 0;
+    }
+#endif
 
     TraceLog(LOG_INFO, "[TEX ID %i] Unloaded texture data (base white texture) from VRAM", defaultTextureId);
 
-    RL_FREE(draws);
+    // Free draw calls sorting scratch buffers
+#if defined(SUPPORT_BATCH_INTERLEAVED)
+    RL_FREE(sortBuffer.elements);
+#else
+    RL_FREE(sortBuffer.vertices);
+    RL_FREE(sortBuffer.texcoords);
+    RL_FREE(sortBuffer.colors);
 #endif
+    RL_FREE(sortDraws);
+    sortDraws = NULL;
+    sortBufferElements = 0;
+#endif
+
+    // Free GPU memory tracking sizes, usage is kept for reporting after close
+    for (int i = 0; i < 3; i++)
+    {
+        RL_FREE(videoMemorySizes[i]);
+        videoMemorySizes[i] = NULL;
+        videoMemoryCapacity[i] = 0;
+    }
 }
 
 // Update and draw internal buffers
 void rlglDraw(void)
 {
+#if defined(SUPPORT_PROFILER) && !defined(RLGL_STANDALONE)
+    BeginProfileZone("rlglDraw");
+#endif
+
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    // Only process data if we have data to process
-    if (vertexData[currentBuffer].vCounter > 0)
+    if (currentBatch->retained)
     {
-        UpdateBuffersDefault();
-        DrawBuffersDefault();       // NOTE: Stereo rendering is checked inside
+        // NOTE: Retained batches are only drawn on request (rlDrawRenderBatch()),
+        // if batch is full, recorded data is discarded to keep recording
+        // WARNING: No GL calls allowed here, threads recording their own batch also get here
+        if ((flushReason != FLUSH_STATE_CHANGE) || (currentBatch->drawsCounter >= MAX_DRAWCALL_REGISTERED))
+        {
+            TraceLog(LOG_WARNING, "Render batch is full (%i elements), recorded data discarded", currentBatch->elements);
+            ResetBatch(currentBatch);
+        }
+    }
+    else
+    {
+        ReleaseMeshState();
+
+        // Only process data if we have data to process
+        if (currentBatch->vertexBuffer[currentBatch->currentBuffer].vCounter > 0)
+        {
+            renderStats.batchFlushes++;
+
+            switch (flushReason)
+            {
+                case FLUSH_BUFFER_FULL: renderStats.flushesBufferFull++; break;
+                case FLUSH_TEXTURE_CHANGE: renderStats.flushesTextureChange++; break;
+                case FLUSH_MODE_CHANGE: renderStats.flushesModeChange++; break;
+                default: renderStats.flushesStateChange++; break;
+            }
+
+            if (drawSorting && (currentBatch->drawsCounter > 1)) SortDrawCalls(currentBatch);
+
+            UpdateBatchBuffers(currentBatch);
+            DrawBatchBuffers(currentBatch);     // NOTE: Stereo rendering is checked inside
+            ResetBatch(currentBatch);
+        }
+
+        // NOTE: SDF shapes are only queued while batch is empty, drawing order is kept
+        if (shapeSDFCount > 0) DrawShapesSDF();
     }
+
+    flushReason = FLUSH_STATE_CHANGE;
+#else
+    ReleaseMeshState();
+#endif
+
+#if defined(SUPPORT_PROFILER) && !defined(RLGL_STANDALONE)
+    EndProfileZone();
 #endif
 }
 
@@ -1780,969 +3277,5169 @@ bool rlCheckBufferLimit(int vCount)
 {
     bool overflow = false;
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    if ((vertexData[currentBuffer].vCounter + vCount) >= (MAX_BATCH_ELEMENTS*4)) overflow = true;
+    if ((currentBatch->vertexBuffer[currentBatch->currentBuffer].vCounter + vCount) >= (currentBatch->elements*4))
+    {
+        overflow = true;
+        flushReason = FLUSH_BUFFER_FULL;    // NOTE: Overflow is expected to be followed by rlglDraw()
+    }
 #endif
     return overflow;
 }
 
-// Set debug marker
-void rlSetDebugMarker(const char *text)
+// Set internal batch capacity (elements/quads)
+// NOTE: If called before rlglInit(), initial buffers are created with that capacity,
+// otherwise current batch is drawn and internal buffers are reloaded
+void rlSetBatchElements(int elements)
 {
-#if defined(GRAPHICS_API_OPENGL_33)
-    if (debugMarkerSupported) glInsertEventMarkerEXT(0, text);
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if ((elements <= 0) || (elements == batchElements)) return;
+
+    if (defaultBatch.draws != NULL)
+    {
+        if (currentBatch == &defaultBatch) rlglDraw();
+
+        UnloadBatchBuffers(&defaultBatch);
+        LoadBatchBuffers(&defaultBatch, MAX_BATCH_BUFFERING, elements);
+        batchElements = defaultBatch.elements;
+    }
+    else batchElements = elements;
+
+    TraceLog(LOG_INFO, "Internal batch capacity set to %i elements", batchElements);
 #endif
 }
 
-// Load OpenGL extensions
-// NOTE: External loader function could be passed as a pointer
-void rlLoadExtensions(void *loader)
+// Get internal batch capacity (elements/quads)
+int rlGetBatchElements(void)
 {
-#if defined(GRAPHICS_API_OPENGL_33)
-    // NOTE: glad is generated and contains only required OpenGL 3.3 Core extensions (and lower versions)
-    #if !defined(__APPLE__)
-        if (!gladLoadGLLoader((GLADloadproc)loader)) TraceLog(LOG_WARNING, "GLAD: Cannot load OpenGL extensions");
-        else TraceLog(LOG_INFO, "GLAD: OpenGL extensions loaded successfully");
-
-        #if defined(GRAPHICS_API_OPENGL_21)
-        if (GLAD_GL_VERSION_2_1) TraceLog(LOG_INFO, "OpenGL 2.1 profile supported");
-        #elif defined(GRAPHICS_API_OPENGL_33)
-        if (GLAD_GL_VERSION_3_3) TraceLog(LOG_INFO, "OpenGL 3.3 Core profile supported");
-        else TraceLog(LOG_ERROR, "OpenGL 3.3 Core profile not supported");
-        #endif
-    #endif
-
-    // With GLAD, we can check if an extension is supported using the GLAD_GL_xxx booleans
-    //if (GLAD_GL_ARB_vertex_array_object) // Use GL_ARB_vertex_array_object
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    return batchElements;
+#else
+    return MAX_BATCH_ELEMENTS;
 #endif
 }
 
-// Get world coordinates from screen coordinates
-Vector3 rlUnproject(Vector3 source, Matrix proj, Matrix view)
+// Get depth value used by next 2D vertex (rlVertex2f())
+// NOTE: Useful to define 2D vertex data in bulk (rlQuadBatch()) at same depth as rlVertex2f()
+float rlGetCurrentDepth(void)
 {
-    Vector3 result = { 0.0f, 0.0f, 0.0f };
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    return currentBatch->currentDepth;
+#else
+    return 0.0f;
+#endif
+}
 
-    // Calculate unproject matrix (multiply view patrix by projection matrix) and invert it
-    Matrix matViewProj = MatrixMultiply(view, proj);
-    matViewProj = MatrixInvert(matViewProj);
+// Load render batch, vertex data is kept after drawing, until batch is reset
+// NOTE: Vertex data is recorded with rlgl vertex functions while batch is active
+RenderBatch *rlLoadRenderBatch(int elements)
+{
+    RenderBatch *batch = NULL;
 
-    // Create quaternion from source point
-    Quaternion quat = { source.x, source.y, source.z, 1.0f };
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (elements <= 0) elements = MAX_BATCH_ELEMENTS;
 
-    // Multiply quat point by unproject matrix
-    quat = QuaternionTransform(quat, matViewProj);
+    ReleaseMeshState();
 
-    // Normalized world points in vectors
-    result.x = quat.x/quat.w;
-    result.y = quat.y/quat.w;
-    result.z = quat.z/quat.w;
+    batch = (RenderBatch *)RL_CALLOC(1, sizeof(RenderBatch));
+    LoadBatchBuffers(batch, 1, elements);
+    batch->retained = true;
+#endif
 
-    return result;
+    return batch;
 }
 
-// Convert image data to OpenGL texture (returns OpenGL valid Id)
-unsigned int rlLoadTexture(void *data, int width, int height, int format, int mipmapCount)
+// Unload render batch
+// NOTE: If batch is active, default batch is set active
+void rlUnloadRenderBatch(RenderBatch *batch)
 {
-    glBindTexture(GL_TEXTURE_2D, 0);    // Free any old binding
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if ((batch == NULL) || (batch == &defaultBatch)) return;
 
-    unsigned int id = 0;
+    if (currentBatch == batch) currentBatch = &defaultBatch;
 
-    // Check texture format support by OpenGL 1.1 (compressed textures not supported)
-#if defined(GRAPHICS_API_OPENGL_11)
-    if (format >= COMPRESSED_DXT1_RGB)
-    {
-        TraceLog(LOG_WARNING, "OpenGL 1.1 does not support GPU compressed texture formats");
-        return id;
-    }
-#else
-    if ((!texCompDXTSupported) && ((format == COMPRESSED_DXT1_RGB) || (format == COMPRESSED_DXT1_RGBA) ||
-        (format == COMPRESSED_DXT3_RGBA) || (format == COMPRESSED_DXT5_RGBA)))
-    {
-        TraceLog(LOG_WARNING, "DXT compressed texture format not supported");
-        return id;
-    }
+    ReleaseMeshState();
+
+    UnloadBatchBuffers(batch);
+    RL_FREE(batch);
+#endif
+}
+
+// Set render batch receiving vertex data (NULL for default batch)
+// NOTE: Default batch is drawn before changing active batch to keep drawing order
+// NOTE: With SUPPORT_THREADED_RECORDING, active batch and matrix stack are per thread, worker threads
+// can record into their own batch (never the default one) after setting it active, then the
+// batch can be drawn or merged (rlMergeRenderBatch()) on the GL context thread
+void rlSetRenderBatchActive(RenderBatch *batch)
+{
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    if ((!texCompETC1Supported) && (format == COMPRESSED_ETC1_RGB))
+    if (batch == NULL) batch = &defaultBatch;
+
+    if (batch != currentBatch)
     {
-        TraceLog(LOG_WARNING, "ETC1 compressed texture format not supported");
-        return id;
+        if (currentBatch != NULL) rlglDraw();
+        else
+        {
+            // First batch set active on this thread, init thread recording state
+            // NOTE: Matrix stack transformations are applied to vertex on recording (rlPushMatrix()),
+            // internal modelview/projection matrices are not thread-local, only GL context thread should modify them
+            transformMatrix = MatrixIdentity();
+            currentMatrix = &modelview;
+            currentMatrixMode = RL_MODELVIEW;
+        }
+
+        currentBatch = batch;
+#if defined(SUPPORT_BATCH_MULTITEXTURE)
+        // Current draw texture unit is set again on next rlEnableTexture()
+        currentTextureUnit = 0;
+#endif
     }
+#endif
+}
 
-    if ((!texCompETC2Supported) && ((format == COMPRESSED_ETC2_RGB) || (format == COMPRESSED_ETC2_EAC_RGBA)))
+// Draw render batch vertex data
+// NOTE: Default batch is drawn and reset (same as rlglDraw()), user batches keep their vertex data
+// and are drawn with current shader and matrices (modelview/projection), vertex data is only
+// uploaded to GPU when it changed since previous draw
+void rlDrawRenderBatch(RenderBatch *batch)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (batch == NULL) batch = &defaultBatch;
+
+    // Draw default batch pending data first (if active)
+    rlglDraw();
+
+    if (batch->retained && (batch->vertexBuffer[batch->currentBuffer].vCounter > 0))
     {
-        TraceLog(LOG_WARNING, "ETC2 compressed texture format not supported");
-        return id;
+        UpdateBatchBuffers(batch);
+        DrawBatchBuffers(batch);
     }
+#endif
+}
 
-    if ((!texCompPVRTSupported) && ((format == COMPRESSED_PVRT_RGB) || (format == COMPRESSED_PVRT_RGBA)))
+// Append render batch vertex data and draw calls to active batch
+// NOTE: Used to merge batches recorded by other threads on the GL context thread, batch is not modified
+void rlMergeRenderBatch(RenderBatch *batch)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if ((batch == NULL) || (batch == currentBatch)) return;
+
+    const DynamicBuffer *src = &batch->vertexBuffer[batch->currentBuffer];
+
+    // Batches bigger than active batch capacity can not be merged, just draw them
+    if (src->vCounter >= (currentBatch->elements*4 - 4))
     {
-        TraceLog(LOG_WARNING, "PVRT compressed texture format not supported");
-        return id;
+        rlDrawRenderBatch(batch);
+        return;
     }
 
-    if ((!texCompASTCSupported) && ((format == COMPRESSED_ASTC_4x4_RGBA) || (format == COMPRESSED_ASTC_8x8_RGBA)))
+    for (int i = 0, offset = 0; i < batch->drawsCounter; i++)
     {
-        TraceLog(LOG_WARNING, "ASTC compressed texture format not supported");
-        return id;
-    }
-#endif
-#endif      // GRAPHICS_API_OPENGL_11
+        const DrawCall *draw = &batch->draws[i];
 
-    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+        if (draw->vertexCount > 0)
+        {
+            DrawCall *last = &currentBatch->draws[currentBatch->drawsCounter - 1];
 
-    glGenTextures(1, &id);              // Generate texture id
+            if (last->vertexCount > 0)
+            {
+                // Make sure current draw vertexCount is aligned a multiple of 4 (same as rlBegin())
+                if (last->mode == RL_LINES) last->vertexAlignment = ((last->vertexCount < 4)? last->vertexCount : last->vertexCount%4);
+                else if (last->mode == RL_TRIANGLES) last->vertexAlignment = ((last->vertexCount < 4)? 1 : (4 - (last->vertexCount%4)));
+                else if (last->mode == RL_POINTS) last->vertexAlignment = (4 - (last->vertexCount%4))%4;
+                else last->vertexAlignment = 0;
 
-#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    //glActiveTexture(GL_TEXTURE0);     // If not defined, using GL_TEXTURE0 by default (shader texture)
-#endif
+                if (rlCheckBufferLimit(last->vertexAlignment + draw->vertexCount) || (currentBatch->drawsCounter >= MAX_DRAWCALL_REGISTERED)) rlglDraw();
+                else
+                {
+                    currentBatch->vertexBuffer[currentBatch->currentBuffer].vCounter += last->vertexAlignment;
+                    currentBatch->vertexBuffer[currentBatch->currentBuffer].cCounter += last->vertexAlignment;
+                    currentBatch->vertexBuffer[currentBatch->currentBuffer].tcCounter += last->vertexAlignment;
 
-    glBindTexture(GL_TEXTURE_2D, id);
+                    currentBatch->drawsCounter++;
+                }
+            }
+            else if (rlCheckBufferLimit(draw->vertexCount)) rlglDraw();
 
-    int mipWidth = width;
-    int mipHeight = height;
-    int mipOffset = 0;          // Mipmap data offset
+            DynamicBuffer *dst = &currentBatch->vertexBuffer[currentBatch->currentBuffer];
 
-    TraceLog(LOG_DEBUG, "Load texture from data memory address: 0x%x", data);
+            currentBatch->draws[currentBatch->drawsCounter - 1] = *draw;
+            currentBatch->draws[currentBatch->drawsCounter - 1].vertexAlignment = 0;
+            SetDrawCallState(&currentBatch->draws[currentBatch->drawsCounter - 1]);     // Merged draws use active render state
 
-    // Load the different mipmap levels
-    for (int i = 0; i < mipmapCount; i++)
-    {
-        unsigned int mipSize = GetPixelDataSize(mipWidth, mipHeight, format);
+            CopyBufferVertices(dst, dst->vCounter, src, offset, draw->vertexCount);
 
-        unsigned int glInternalFormat, glFormat, glType;
-        rlGetGlTextureFormats(format, &glInternalFormat, &glFormat, &glType);
-
-        TraceLog(LOG_DEBUG, "Load mipmap level %i (%i x %i), size: %i, offset: %i", i, mipWidth, mipHeight, mipSize, mipOffset);
-
-        if (glInternalFormat != -1)
-        {
-            if (format < COMPRESSED_DXT1_RGB) glTexImage2D(GL_TEXTURE_2D, i, glInternalFormat, mipWidth, mipHeight, 0, glFormat, glType, (unsigned char *)data + mipOffset);
-        #if !defined(GRAPHICS_API_OPENGL_11)
-            else glCompressedTexImage2D(GL_TEXTURE_2D, i, glInternalFormat, mipWidth, mipHeight, 0, mipSize, (unsigned char *)data + mipOffset);
-        #endif
-
-        #if defined(GRAPHICS_API_OPENGL_33)
-            if (format == UNCOMPRESSED_GRAYSCALE)
-            {
-                GLint swizzleMask[] = { GL_RED, GL_RED, GL_RED, GL_ONE };
-                glTexParameteriv(GL_TEXTURE_2D, GL_TEXTURE_SWIZZLE_RGBA, swizzleMask);
-            }
-            else if (format == UNCOMPRESSED_GRAY_ALPHA)
-            {
-            #if defined(GRAPHICS_API_OPENGL_21)
-                GLint swizzleMask[] = { GL_RED, GL_RED, GL_RED, GL_ALPHA };
-            #elif defined(GRAPHICS_API_OPENGL_33)
-                GLint swizzleMask[] = { GL_RED, GL_RED, GL_RED, GL_GREEN };
-            #endif
-                glTexParameteriv(GL_TEXTURE_2D, GL_TEXTURE_SWIZZLE_RGBA, swizzleMask);
-            }
-        #endif
+            dst->vCounter += draw->vertexCount;
+            dst->cCounter += draw->vertexCount;
+            dst->tcCounter += draw->vertexCount;
         }
 
-        mipWidth /= 2;
-        mipHeight /= 2;
-        mipOffset += mipSize;
-
-        // Security check for NPOT textures
-        if (mipWidth < 1) mipWidth = 1;
-        if (mipHeight < 1) mipHeight = 1;
+        offset += (draw->vertexCount + draw->vertexAlignment);
     }
 
-    // Texture parameters configuration
-    // NOTE: glTexParameteri does NOT affect texture uploading, just the way it's used
-#if defined(GRAPHICS_API_OPENGL_ES2)
-    // NOTE: OpenGL ES 2.0 with no GL_OES_texture_npot support (i.e. WebGL) has limited NPOT support, so CLAMP_TO_EDGE must be used
-    if (texNPOTSupported)
-    {
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);       // Set texture to repeat on x-axis
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);       // Set texture to repeat on y-axis
-    }
-    else
-    {
-        // NOTE: If using negative texture coordinates (LoadOBJ()), it does not work!
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);       // Set texture to clamp on x-axis
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);       // Set texture to clamp on y-axis
-    }
-#else
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);       // Set texture to repeat on x-axis
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);       // Set texture to repeat on y-axis
+#if defined(SUPPORT_BATCH_MULTITEXTURE)
+    currentTextureUnit = 0;
+#endif
 #endif
+}
 
-    // Magnification and minification filters
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);  // Alternative: GL_LINEAR
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);  // Alternative: GL_LINEAR
+// Reset render batch vertex data and draw calls
+void rlResetRenderBatch(RenderBatch *batch)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (batch == NULL) batch = &defaultBatch;
 
+    ResetBatch(batch);
+#endif
+}
+
+// Set debug marker
+void rlSetDebugMarker(const char *text)
+{
 #if defined(GRAPHICS_API_OPENGL_33)
-    if (mipmapCount > 1)
-    {
-        // Activate Trilinear filtering if mipmaps are available
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
-    }
+    if (debugMarkerSupported) glInsertEventMarkerEXT(0, text);
 #endif
+}
 
-    // At this point we have the texture loaded in GPU and texture parameters configured
+// Begin GPU timing zone
+// NOTE: Internal buffers are drawn at zone begin and end, so batched commands are measured in the right zone.
+// Zones can be nested, name is not copied, it must remain valid until results are read (i.e. string literal)
+void rlBeginGpuZone(const char *name)
+{
+#if defined(GRAPHICS_API_OPENGL_33)
+    if (!timerQuerySupported || (gpuZonesDepth >= MAX_GPU_ZONES)) return;
 
-    // NOTE: If mipmaps were not in data, they are not generated automatically
+    int index = -1;
 
-    // Unbind current texture
-    glBindTexture(GL_TEXTURE_2D, 0);
+    if (gpuZonesCount[gpuZonesFrame] < MAX_GPU_ZONES)
+    {
+        // Queries are generated on first use, all of them at once
+        if (gpuZonesQueries[0][0][0] == 0) glGenQueries(2*MAX_GPU_ZONES*2, &gpuZonesQueries[0][0][0]);
 
-    if (id > 0) TraceLog(LOG_INFO, "[TEX ID %i] Texture created successfully (%ix%i - %i mipmaps)", id, width, height, mipmapCount);
-    else TraceLog(LOG_WARNING, "Texture could not be created");
+        rlglDraw();
 
-    return id;
+        index = gpuZonesCount[gpuZonesFrame];
+        gpuZones[gpuZonesFrame][index].name = name;
+        gpuZones[gpuZonesFrame][index].depth = gpuZonesDepth;
+        gpuZones[gpuZonesFrame][index].time = 0.0f;
+        glQueryCounter(gpuZonesQueries[gpuZonesFrame][index][0], GL_TIMESTAMP);
+
+        gpuZonesCount[gpuZonesFrame]++;
+    }
+    else TraceLog(LOG_WARNING, "GPU timing zone [%s] not recorded, MAX_GPU_ZONES reached", name);
+
+    gpuZonesStack[gpuZonesDepth] = index;
+    gpuZonesDepth++;
+#endif
 }
 
-// Load depth texture/renderbuffer (to be attached to fbo)
-// WARNING: OpenGL ES 2.0 requires GL_OES_depth_texture/WEBGL_depth_texture extensions
-unsigned int rlLoadTextureDepth(int width, int height, int bits, bool useRenderBuffer)
+// End GPU timing zone
+void rlEndGpuZone(void)
 {
-    unsigned int id = 0;
-
-#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    unsigned int glInternalFormat = GL_DEPTH_COMPONENT16;
+#if defined(GRAPHICS_API_OPENGL_33)
+    if (!timerQuerySupported || (gpuZonesDepth <= 0)) return;
 
-    if ((bits != 16) && (bits != 24) && (bits != 32)) bits = 16;
+    gpuZonesDepth--;
+    int index = gpuZonesStack[gpuZonesDepth];
 
-    if (bits == 24)
+    if (index >= 0)
     {
-#if defined(GRAPHICS_API_OPENGL_33)
-        glInternalFormat = GL_DEPTH_COMPONENT24;
-#elif defined(GRAPHICS_API_OPENGL_ES2)
-        if (maxDepthBits >= 24) glInternalFormat = GL_DEPTH_COMPONENT24_OES;
-#endif
+        rlglDraw();
+
+        glQueryCounter(gpuZonesQueries[gpuZonesFrame][index][1], GL_TIMESTAMP);
     }
+#endif
+}
 
-    if (bits == 32)
-    {
+// Swap GPU timing zones frame and collect available results
+// NOTE: Results of previous frame are only read if GPU is done with them (no stall),
+// otherwise previous results are kept and that frame measure is lost
+void rlUpdateGpuZones(void)
+{
 #if defined(GRAPHICS_API_OPENGL_33)
-        glInternalFormat = GL_DEPTH_COMPONENT32;
-#elif defined(GRAPHICS_API_OPENGL_ES2)
-        if (maxDepthBits == 32) glInternalFormat = GL_DEPTH_COMPONENT32_OES;
-#endif
-    }
+    if (!timerQuerySupported) return;
 
-    if (!useRenderBuffer && texDepthSupported)
+    if (gpuZonesDepth > 0)
     {
-        glGenTextures(1, &id);
-        glBindTexture(GL_TEXTURE_2D, id);
-        glTexImage2D(GL_TEXTURE_2D, 0, glInternalFormat, width, height, 0, GL_DEPTH_COMPONENT, GL_UNSIGNED_INT, NULL);
-
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+        TraceLog(LOG_WARNING, "GPU timing zones not closed at frame end (%i), rlEndGpuZone() missing", gpuZonesDepth);
 
-        glBindTexture(GL_TEXTURE_2D, 0);
+        while (gpuZonesDepth > 0) rlEndGpuZone();
     }
-    else
+
+    gpuZonesFrame = 1 - gpuZonesFrame;
+
+    // Collect results of frame recorded before the one just finished
+    int count = gpuZonesCount[gpuZonesFrame];
+
+    if (count > 0)
     {
-        // Create the renderbuffer that will serve as the depth attachment for the framebuffer
-        // NOTE: A renderbuffer is simpler than a texture and could offer better performance on embedded devices
-        glGenRenderbuffers(1, &id);
-        glBindRenderbuffer(GL_RENDERBUFFER, id);
-        glRenderbufferStorage(GL_RENDERBUFFER, glInternalFormat, width, height);
+        GLuint available = 1;
 
-        glBindRenderbuffer(GL_RENDERBUFFER, 0);
+        // NOTE: Nested zones end before their parent, so all end queries are checked
+        for (int i = 0; (i < count) && available; i++) glGetQueryObjectuiv(gpuZonesQueries[gpuZonesFrame][i][1], GL_QUERY_RESULT_AVAILABLE, &available);
+
+        if (available)
+        {
+            for (int i = 0; i < count; i++)
+            {
+                GLuint64 timeBegin = 0;
+                GLuint64 timeEnd = 0;
+
+                glGetQueryObjectui64v(gpuZonesQueries[gpuZonesFrame][i][0], GL_QUERY_RESULT, &timeBegin);
+                glGetQueryObjectui64v(gpuZonesQueries[gpuZonesFrame][i][1], GL_QUERY_RESULT, &timeEnd);
+
+                gpuZoneTimes[i] = gpuZones[gpuZonesFrame][i];
+                gpuZoneTimes[i].time = (float)((double)(timeEnd - timeBegin)/1000000.0);
+            }
+
+            gpuZoneTimesCount = count;
+        }
     }
+
+    gpuZonesCount[gpuZonesFrame] = 0;
 #endif
+}
 
-    return id;
+// Get GPU timing zones results of latest measured frame
+const GpuZoneTime *rlGetGpuZones(int *count)
+{
+#if defined(GRAPHICS_API_OPENGL_33)
+    if (count != NULL) *count = gpuZoneTimesCount;
+    return gpuZoneTimes;
+#else
+    if (count != NULL) *count = 0;
+    return NULL;
+#endif
 }
 
-// Load texture cubemap
-// NOTE: Cubemap data is expected to be 6 images in a single column,
-// expected the following convention: +X, -X, +Y, -Y, +Z, -Z
-unsigned int rlLoadTextureCubemap(void *data, int size, int format)
+// Store current frame render statistics and reset counters
+void rlUpdateRenderStats(void)
 {
-    unsigned int cubemapId = 0;
-    unsigned int dataSize = GetPixelDataSize(size, size, format);
+    renderStatsFrame = renderStats;
+    memset(&renderStats, 0, sizeof(RenderStats));
 
-#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    glGenTextures(1, &cubemapId);
-    glBindTexture(GL_TEXTURE_CUBE_MAP, cubemapId);
+#if defined(SUPPORT_FRAME_CAPTURE)
+    if (captureFile != NULL) EndFrameCapture();
+#endif
+}
 
-    unsigned int glInternalFormat, glFormat, glType;
-    rlGetGlTextureFormats(format, &glInternalFormat, &glFormat, &glType);
+// Capture next frame render commands to file, capture starts on BeginDrawing() and ends on EndDrawing()
+// NOTE: Frame can be replayed and profiled offline with rlgl_replay tool (benchmarks)
+void rlCaptureFrame(const char *fileName)
+{
+#if defined(SUPPORT_FRAME_CAPTURE)
+    strncpy(captureFileName, fileName, sizeof(captureFileName) - 1);
+#else
+    TraceLog(LOG_WARNING, "Frame capture not supported (SUPPORT_FRAME_CAPTURE)");
+#endif
+}
 
-    if (glInternalFormat != -1)
+// Get GPU memory usage of textures (render textures attachments included) and buffers
+// NOTE: Sizes are estimated from resources formats and sizes, driver padding and mipmaps
+// generated by GPU are not considered
+void rlGetVideoMemoryUsage(MemoryUsage *textures, MemoryUsage *buffers)
+{
+    VIDEO_MEMORY_LOCK();
+    if (textures != NULL) *textures = videoMemoryUsage[0];
+    if (buffers != NULL) *buffers = videoMemoryUsage[1];
+    VIDEO_MEMORY_UNLOCK();
+}
+
+// Place frame fence for dynamic meshes buffers copies and move to next frame (called by EndDrawing())
+// NOTE: Buffers copies drawn on a frame are updated again once its fence is signaled, fence placed
+// MAX_MESH_BUFFERING frames ago is replaced, so that frame is waited for (rarely blocks)
+void rlUpdateMeshFences(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33)
+    if (!mapBufferRangeSupported) return;
+
+    if (meshStreamCount > 0)
     {
-        // Load cubemap faces
-        for (unsigned int i = 0; i < 6; i++)
-        {
-            if (format < COMPRESSED_DXT1_RGB) glTexImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_X + i, 0, glInternalFormat, size, size, 0, glFormat, glType, (unsigned char *)data + i*dataSize);
-#if !defined(GRAPHICS_API_OPENGL_11)
-            else glCompressedTexImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_X + i, 0, glInternalFormat, size, size, 0, dataSize, (unsigned char *)data + i*dataSize);
+        int index = meshFrame%MAX_MESH_BUFFERING;
+
+        if (meshFrameFences[index] != NULL) WaitMeshFrame(meshFenceFrames[index]);
+
+        meshFrameFences[index] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+        meshFenceFrames[index] = meshFrame;
+    }
+
+    meshFrame++;
 #endif
+}
+
+// Set frame uniform block time value (called by BeginDrawing())
+void rlSetFrameTime(float time)
+{
 #if defined(GRAPHICS_API_OPENGL_33)
-            if (format == UNCOMPRESSED_GRAYSCALE)
-            {
-                GLint swizzleMask[] = { GL_RED, GL_RED, GL_RED, GL_ONE };
-                glTexParameteriv(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_SWIZZLE_RGBA, swizzleMask);
-            }
-            else if (format == UNCOMPRESSED_GRAY_ALPHA)
-            {
-#if defined(GRAPHICS_API_OPENGL_21)
-                GLint swizzleMask[] = { GL_RED, GL_RED, GL_RED, GL_ALPHA };
-#elif defined(GRAPHICS_API_OPENGL_33)
-                GLint swizzleMask[] = { GL_RED, GL_RED, GL_RED, GL_GREEN };
+    if (frameBlock.time != time)
+    {
+        frameBlock.time = time;
+        frameBlockDirty = true;
+    }
 #endif
-                glTexParameteriv(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_SWIZZLE_RGBA, swizzleMask);
-            }
+#if defined(SUPPORT_FRAME_CAPTURE)
+    if ((captureFileName[0] != '\0') && (captureFile == NULL)) StartFrameCapture();
 #endif
-        }
-    }
+}
 
-    // Set cubemap texture sampling parameters
-    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
-    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+// Load OpenGL extensions
+// NOTE: External loader function could be passed as a pointer
+void rlLoadExtensions(void *loader)
+{
 #if defined(GRAPHICS_API_OPENGL_33)
-    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_R, GL_CLAMP_TO_EDGE);  // Flag not supported on OpenGL ES 2.0
-#endif
+    // NOTE: glad is generated and contains only required OpenGL 3.3 Core extensions (and lower versions)
+    #if !defined(__APPLE__)
+        if (!gladLoadGLLoader((GLADloadproc)loader)) TraceLog(LOG_WARNING, "GLAD: Cannot load OpenGL extensions");
+        else TraceLog(LOG_INFO, "GLAD: OpenGL extensions loaded successfully");
 
-    glBindTexture(GL_TEXTURE_CUBE_MAP, 0);
+        #if defined(GRAPHICS_API_OPENGL_21)
+        if (GLAD_GL_VERSION_2_1) TraceLog(LOG_INFO, "OpenGL 2.1 profile supported");
+        #elif defined(GRAPHICS_API_OPENGL_33)
+        if (GLAD_GL_VERSION_3_3) TraceLog(LOG_INFO, "OpenGL 3.3 Core profile supported");
+        else TraceLog(LOG_ERROR, "OpenGL 3.3 Core profile not supported");
+        #endif
+    #endif
+
+    // With GLAD, we can check if an extension is supported using the GLAD_GL_xxx booleans
+    //if (GLAD_GL_ARB_vertex_array_object) // Use GL_ARB_vertex_array_object
+
+    #if !defined(__APPLE__)
+    // Load program binaries entry points, support is checked on rlglInit() (GL_ARB_get_program_binary)
+    glGetProgramBinary = (PFNGLGETPROGRAMBINARYPROC)((GLADloadproc)loader)("glGetProgramBinary");
+    glProgramBinary = (PFNGLPROGRAMBINARYPROC)((GLADloadproc)loader)("glProgramBinary");
+
+    // Load compute shaders entry points, support is checked on rlglInit() (OpenGL 4.3)
+    glDispatchCompute = (PFNGLDISPATCHCOMPUTEPROC)((GLADloadproc)loader)("glDispatchCompute");
+    glMemoryBarrier = (PFNGLMEMORYBARRIERPROC)((GLADloadproc)loader)("glMemoryBarrier");
+    glBindImageTexture = (PFNGLBINDIMAGETEXTUREPROC)((GLADloadproc)loader)("glBindImageTexture");
+    #endif
 #endif
+}
 
-    return cubemapId;
+// Set calling thread as resources loader, a context sharing objects with render context must be current
+// NOTE: Textures, shaders and meshes buffers can be loaded, render thread state (batch, mesh state) is not
+// modified, meshes vertex arrays must be loaded on render thread (rlLoadMeshVertexArray())
+void rlBeginLoaderContext(void)
+{
+    loaderThread = true;
 }
 
-// Update already loaded texture in GPU with new data
-// NOTE: We don't know safely if internal texture format is the expected one...
-void rlUpdateTexture(unsigned int id, int width, int height, int format, const void *data)
+// Wait loader thread GPU commands completion, loaded resources can be used on render thread after it
+// NOTE: Objects modified in a context are visible in other contexts once commands are completed
+// and objects are bound again, fence is waited on loader thread so render thread never stalls
+void rlEndLoaderContext(void)
 {
-    glBindTexture(GL_TEXTURE_2D, id);
+    if (!loaderThread) return;
 
-    unsigned int glInternalFormat, glFormat, glType;
-    rlGetGlTextureFormats(format, &glInternalFormat, &glFormat, &glType);
+#if defined(GRAPHICS_API_OPENGL_33) && !defined(GRAPHICS_API_OPENGL_21)
+    GLsync fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, GL_TIMEOUT_IGNORED);
+    glDeleteSync(fence);
+#else
+    glFinish();     // No fences available, wait for all commands completion
+#endif
 
-    if ((glInternalFormat != -1) && (format < COMPRESSED_DXT1_RGB))
-    {
-        glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, width, height, glFormat, glType, (unsigned char *)data);
-    }
-    else TraceLog(LOG_WARNING, "Texture format updating not supported");
+    loaderThread = false;
 }
 
-// Get OpenGL internal formats and data type from raylib PixelFormat
-void rlGetGlTextureFormats(int format, unsigned int *glInternalFormat, unsigned int *glFormat, unsigned int *glType)
+// Check if calling thread is a resources loader
+bool rlIsLoaderContext(void)
 {
-    *glInternalFormat = -1;
-    *glFormat = -1;
-    *glType = -1;
+    return loaderThread;
+}
 
-    switch (format)
-    {
-    #if defined(GRAPHICS_API_OPENGL_11) || defined(GRAPHICS_API_OPENGL_21) || defined(GRAPHICS_API_OPENGL_ES2)
-        // NOTE: on OpenGL ES 2.0 (WebGL), internalFormat must match format and options allowed are: GL_LUMINANCE, GL_RGB, GL_RGBA
-        case UNCOMPRESSED_GRAYSCALE: *glInternalFormat = GL_LUMINANCE; *glFormat = GL_LUMINANCE; *glType = GL_UNSIGNED_BYTE; break;
-        case UNCOMPRESSED_GRAY_ALPHA: *glInternalFormat = GL_LUMINANCE_ALPHA; *glFormat = GL_LUMINANCE_ALPHA; *glType = GL_UNSIGNED_BYTE; break;
-        case UNCOMPRESSED_R5G6B5: *glInternalFormat = GL_RGB; *glFormat = GL_RGB; *glType = GL_UNSIGNED_SHORT_5_6_5; break;
-        case UNCOMPRESSED_R8G8B8: *glInternalFormat = GL_RGB; *glFormat = GL_RGB; *glType = GL_UNSIGNED_BYTE; break;
-        case UNCOMPRESSED_R5G5B5A1: *glInternalFormat = GL_RGBA; *glFormat = GL_RGBA; *glType = GL_UNSIGNED_SHORT_5_5_5_1; break;
-        case UNCOMPRESSED_R4G4B4A4: *glInternalFormat = GL_RGBA; *glFormat = GL_RGBA; *glType = GL_UNSIGNED_SHORT_4_4_4_4; break;
-        case UNCOMPRESSED_R8G8B8A8: *glInternalFormat = GL_RGBA; *glFormat = GL_RGBA; *glType = GL_UNSIGNED_BYTE; break;
-        #if !defined(GRAPHICS_API_OPENGL_11)
-        case UNCOMPRESSED_R32: if (texFloatSupported) *glInternalFormat = GL_LUMINANCE; *glFormat = GL_LUMINANCE; *glType = GL_FLOAT; break;   // NOTE: Requires extension OES_texture_float
-        case UNCOMPRESSED_R32G32B32: if (texFloatSupported) *glInternalFormat = GL_RGB; *glFormat = GL_RGB; *glType = GL_FLOAT; break;         // NOTE: Requires extension OES_texture_float
-        case UNCOMPRESSED_R32G32B32A32: if (texFloatSupported) *glInternalFormat = GL_RGBA; *glFormat = GL_RGBA; *glType = GL_FLOAT; break;    // NOTE: Requires extension OES_texture_float
-        #endif
-    #elif defined(GRAPHICS_API_OPENGL_33)
-        case UNCOMPRESSED_GRAYSCALE: *glInternalFormat = GL_R8; *glFormat = GL_RED; *glType = GL_UNSIGNED_BYTE; break;
-        case UNCOMPRESSED_GRAY_ALPHA: *glInternalFormat = GL_RG8; *glFormat = GL_RG; *glType = GL_UNSIGNED_BYTE; break;
-        case UNCOMPRESSED_R5G6B5: *glInternalFormat = GL_RGB565; *glFormat = GL_RGB; *glType = GL_UNSIGNED_SHORT_5_6_5; break;
-        case UNCOMPRESSED_R8G8B8: *glInternalFormat = GL_RGB8; *glFormat = GL_RGB; *glType = GL_UNSIGNED_BYTE; break;
-        case UNCOMPRESSED_R5G5B5A1: *glInternalFormat = GL_RGB5_A1; *glFormat = GL_RGBA; *glType = GL_UNSIGNED_SHORT_5_5_5_1; break;
-        case UNCOMPRESSED_R4G4B4A4: *glInternalFormat = GL_RGBA4; *glFormat = GL_RGBA; *glType = GL_UNSIGNED_SHORT_4_4_4_4; break;
-        case UNCOMPRESSED_R8G8B8A8: *glInternalFormat = GL_RGBA8; *glFormat = GL_RGBA; *glType = GL_UNSIGNED_BYTE; break;
-        case UNCOMPRESSED_R32: if (texFloatSupported) *glInternalFormat = GL_R32F; *glFormat = GL_RED; *glType = GL_FLOAT; break;
-        case UNCOMPRESSED_R32G32B32: if (texFloatSupported) *glInternalFormat = GL_RGB32F; *glFormat = GL_RGB; *glType = GL_FLOAT; break;
-        case UNCOMPRESSED_R32G32B32A32: if (texFloatSupported) *glInternalFormat = GL_RGBA32F; *glFormat = GL_RGBA; *glType = GL_FLOAT; break;
-    #endif
-        #if !defined(GRAPHICS_API_OPENGL_11)
-        case COMPRESSED_DXT1_RGB: if (texCompDXTSupported) *glInternalFormat = GL_COMPRESSED_RGB_S3TC_DXT1_EXT; break;
-        case COMPRESSED_DXT1_RGBA: if (texCompDXTSupported) *glInternalFormat = GL_COMPRESSED_RGBA_S3TC_DXT1_EXT; break;
-        case COMPRESSED_DXT3_RGBA: if (texCompDXTSupported) *glInternalFormat = GL_COMPRESSED_RGBA_S3TC_DXT3_EXT; break;
-        case COMPRESSED_DXT5_RGBA: if (texCompDXTSupported) *glInternalFormat = GL_COMPRESSED_RGBA_S3TC_DXT5_EXT; break;
-        case COMPRESSED_ETC1_RGB: if (texCompETC1Supported) *glInternalFormat = GL_ETC1_RGB8_OES; break;                      // NOTE: Requires OpenGL ES 2.0 or OpenGL 4.3
-        case COMPRESSED_ETC2_RGB: if (texCompETC2Supported) *glInternalFormat = GL_COMPRESSED_RGB8_ETC2; break;               // NOTE: Requires OpenGL ES 3.0 or OpenGL 4.3
-        case COMPRESSED_ETC2_EAC_RGBA: if (texCompETC2Supported) *glInternalFormat = GL_COMPRESSED_RGBA8_ETC2_EAC; break;     // NOTE: Requires OpenGL ES 3.0 or OpenGL 4.3
-        case COMPRESSED_PVRT_RGB: if (texCompPVRTSupported) *glInternalFormat = GL_COMPRESSED_RGB_PVRTC_4BPPV1_IMG; break;    // NOTE: Requires PowerVR GPU
-        case COMPRESSED_PVRT_RGBA: if (texCompPVRTSupported) *glInternalFormat = GL_COMPRESSED_RGBA_PVRTC_4BPPV1_IMG; break;  // NOTE: Requires PowerVR GPU
-        case COMPRESSED_ASTC_4x4_RGBA: if (texCompASTCSupported) *glInternalFormat = GL_COMPRESSED_RGBA_ASTC_4x4_KHR; break;  // NOTE: Requires OpenGL ES 3.1 or OpenGL 4.3
-        case COMPRESSED_ASTC_8x8_RGBA: if (texCompASTCSupported) *glInternalFormat = GL_COMPRESSED_RGBA_ASTC_8x8_KHR; break;  // NOTE: Requires OpenGL ES 3.1 or OpenGL 4.3
-        #endif
-        default: TraceLog(LOG_WARNING, "Texture format not supported"); break;
-    }
-}
-
-// Unload texture from GPU memory
-void rlUnloadTexture(unsigned int id)
-{
-    if (id > 0) glDeleteTextures(1, &id);
-}
-
-// Load a texture to be used for rendering (fbo with default color and depth attachments)
-// NOTE: If colorFormat or depthBits are no supported, no attachment is done
-RenderTexture2D rlLoadRenderTexture(int width, int height, int format, int depthBits, bool useDepthTexture)
+// Get world coordinates from screen coordinates
+Vector3 rlUnproject(Vector3 source, Matrix proj, Matrix view)
 {
-    RenderTexture2D target = { 0 };
-
-#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    if (useDepthTexture && texDepthSupported) target.depthTexture = true;
-
-    // Create the framebuffer object
-    glGenFramebuffers(1, &target.id);
-    glBindFramebuffer(GL_FRAMEBUFFER, target.id);
-
-    // Create fbo color texture attachment
-    //-----------------------------------------------------------------------------------------------------
-    if ((format != -1) && (format < COMPRESSED_DXT1_RGB))
-    {
-        // WARNING: Some texture formats are not supported for fbo color attachment
-        target.texture.id = rlLoadTexture(NULL, width, height, format, 1);
-        target.texture.width = width;
-        target.texture.height = height;
-        target.texture.format = format;
-        target.texture.mipmaps = 1;
-    }
-    //-----------------------------------------------------------------------------------------------------
+    Vector3 result = { 0.0f, 0.0f, 0.0f };
 
-    // Create fbo depth renderbuffer/texture
-    //-----------------------------------------------------------------------------------------------------
-    if (depthBits > 0)
-    {
-        target.depth.id = rlLoadTextureDepth(width, height, depthBits, !useDepthTexture);
-        target.depth.width = width;
-        target.depth.height = height;
-        target.depth.format = 19;       //DEPTH_COMPONENT_24BIT?
-        target.depth.mipmaps = 1;
-    }
-    //-----------------------------------------------------------------------------------------------------
+    // Calculate unproject matrix (multiply view patrix by projection matrix) and invert it
+    Matrix matViewProj = MatrixMultiply(view, proj);
+    matViewProj = MatrixInvert(matViewProj);
 
-    // Attach color texture and depth renderbuffer to FBO
-    //-----------------------------------------------------------------------------------------------------
-    rlRenderTextureAttach(target, target.texture.id, 0);    // COLOR attachment
-    rlRenderTextureAttach(target, target.depth.id, 1);      // DEPTH attachment
-    //-----------------------------------------------------------------------------------------------------
+    // Create quaternion from source point
+    Quaternion quat = { source.x, source.y, source.z, 1.0f };
 
-    // Check if fbo is complete with attachments (valid)
-    //-----------------------------------------------------------------------------------------------------
-    if (rlRenderTextureComplete(target)) TraceLog(LOG_INFO, "[FBO ID %i] Framebuffer object created successfully", target.id);
-    //-----------------------------------------------------------------------------------------------------
+    // Multiply quat point by unproject matrix
+    quat = QuaternionTransform(quat, matViewProj);
 
-    glBindFramebuffer(GL_FRAMEBUFFER, 0);
-#endif
+    // Normalized world points in vectors
+    result.x = quat.x/quat.w;
+    result.y = quat.y/quat.w;
+    result.z = quat.z/quat.w;
 
-    return target;
+    return result;
 }
 
-// Attach color buffer texture to an fbo (unloads previous attachment)
-// NOTE: Attach type: 0-Color, 1-Depth renderbuffer, 2-Depth texture
-void rlRenderTextureAttach(RenderTexture2D target, unsigned int id, int attachType)
+// Check if box (defined in local space) is inside current view frustum after transform
+// NOTE: Frustum planes are extracted from transform*modelview*projection matrix (clip space), so box
+// is tested in its local space and any affine transform is supported without transforming its corners.
+// Test is conservative: boxes close to the frustum corners could be reported as visible
+bool rlCheckBoxInFrustum(Vector3 min, Vector3 max, Matrix transform)
 {
-#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    glBindFramebuffer(GL_FRAMEBUFFER, target.id);
+#if defined(GRAPHICS_API_OPENGL_11)
+    Matrix matMVP = MatrixMultiply(MatrixMultiply(transform, GetMatrixModelview()), GetMatrixProjection());
+#else
+#if defined(SUPPORT_VR_SIMULATOR)
+    if (vrStereoRender) return true;    // Every eye uses a different frustum
+#endif
+    Matrix matMVP = MatrixMultiply(MatrixMultiply(transform, MatrixMultiply(transformMatrix, modelview)), projection);
+#endif
 
-    if (attachType == 0) glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, id, 0);
-    else if (attachType == 1)
+    // Clip space coordinates rows: clip = matMVP*vertex
+    float rows[4][4] = {
+        { matMVP.m0, matMVP.m4, matMVP.m8, matMVP.m12 },
+        { matMVP.m1, matMVP.m5, matMVP.m9, matMVP.m13 },
+        { matMVP.m2, matMVP.m6, matMVP.m10, matMVP.m14 },
+        { matMVP.m3, matMVP.m7, matMVP.m11, matMVP.m15 }
+    };
+
+    // Frustum planes: w + x, w - x, w + y, w - y, w + z, w - z (point inside if all >= 0)
+    for (int i = 0; i < 6; i++)
     {
-        if (target.depthTexture) glFramebufferTexture2D(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_TEXTURE_2D, id, 0);
-        else glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_RENDERBUFFER, id);
+        float sign = (i%2 == 0)? 1.0f : -1.0f;
+        float a = rows[3][0] + sign*rows[i/2][0];
+        float b = rows[3][1] + sign*rows[i/2][1];
+        float c = rows[3][2] + sign*rows[i/2][2];
+        float d = rows[3][3] + sign*rows[i/2][3];
+
+        // Box corner furthest along plane normal, if it is outside the whole box is outside
+        float x = (a >= 0.0f)? max.x : min.x;
+        float y = (b >= 0.0f)? max.y : min.y;
+        float z = (c >= 0.0f)? max.z : min.z;
+
+        if ((a*x + b*y + c*z + d) < 0.0f) return false;
     }
 
-    glBindFramebuffer(GL_FRAMEBUFFER, 0);
-#endif
+    return true;
 }
 
-// Verify render texture is complete
-bool rlRenderTextureComplete(RenderTexture target)
+// Convert image data to OpenGL texture (returns OpenGL valid Id)
+// Check if texture (pixel) format can be loaded in GPU (same checks than rlLoadTexture())
+bool rlIsTextureFormatSupported(int format)
 {
-    bool result = false;
-
-#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    glBindFramebuffer(GL_FRAMEBUFFER, target.id);
+    bool supported = true;
 
-    GLenum status = glCheckFramebufferStatus(GL_FRAMEBUFFER);
-
-    if (status != GL_FRAMEBUFFER_COMPLETE)
+#if defined(GRAPHICS_API_OPENGL_11)
+    if (format >= COMPRESSED_DXT1_RGB) supported = false;
+#else
+    switch (format)
     {
-        switch (status)
-        {
-            case GL_FRAMEBUFFER_UNSUPPORTED: TraceLog(LOG_WARNING, "Framebuffer is unsupported"); break;
-            case GL_FRAMEBUFFER_INCOMPLETE_ATTACHMENT: TraceLog(LOG_WARNING, "Framebuffer has incomplete attachment"); break;
-#if defined(GRAPHICS_API_OPENGL_ES2)
-            case GL_FRAMEBUFFER_INCOMPLETE_DIMENSIONS: TraceLog(LOG_WARNING, "Framebuffer has incomplete dimensions"); break;
-#endif
-            case GL_FRAMEBUFFER_INCOMPLETE_MISSING_ATTACHMENT: TraceLog(LOG_WARNING, "Framebuffer has a missing attachment"); break;
-            default: break;
-        }
+        case COMPRESSED_DXT1_RGB:
+        case COMPRESSED_DXT1_RGBA:
+        case COMPRESSED_DXT3_RGBA:
+        case COMPRESSED_DXT5_RGBA: supported = texCompDXTSupported; break;
+    #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+        case COMPRESSED_ETC1_RGB: supported = texCompETC1Supported; break;
+        case COMPRESSED_ETC2_RGB:
+        case COMPRESSED_ETC2_EAC_RGBA: supported = texCompETC2Supported; break;
+        case COMPRESSED_PVRT_RGB:
+        case COMPRESSED_PVRT_RGBA: supported = texCompPVRTSupported; break;
+        case COMPRESSED_ASTC_4x4_RGBA:
+        case COMPRESSED_ASTC_8x8_RGBA: supported = texCompASTCSupported; break;
+    #endif
+        default: break;
     }
+#endif
 
-    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    return supported;
+}
 
-    result = (status == GL_FRAMEBUFFER_COMPLETE);
-#endif
+// Get best GPU compressed format supported, useful to select between texture assets variants
+// NOTE: ASTC is preferred (best quality), then DXT and ETC2 (on desktop, ETC2 could be emulated by driver)
+int rlGetPreferredCompressedFormat(bool alpha)
+{
+    int format = -1;
 
-    return result;
+    if (rlIsTextureFormatSupported(COMPRESSED_ASTC_4x4_RGBA)) format = COMPRESSED_ASTC_4x4_RGBA;
+    else if (rlIsTextureFormatSupported(COMPRESSED_DXT1_RGB)) format = alpha? COMPRESSED_DXT5_RGBA : COMPRESSED_DXT1_RGB;
+    else if (rlIsTextureFormatSupported(COMPRESSED_ETC2_RGB)) format = alpha? COMPRESSED_ETC2_EAC_RGBA : COMPRESSED_ETC2_RGB;
+    else if (!alpha && rlIsTextureFormatSupported(COMPRESSED_ETC1_RGB)) format = COMPRESSED_ETC1_RGB;
+
+    return format;
 }
 
-// Generate mipmap data for selected texture
-void rlGenerateMipmaps(Texture2D *texture)
+unsigned int rlLoadTexture(void *data, int width, int height, int format, int mipmapCount)
 {
-    glBindTexture(GL_TEXTURE_2D, texture->id);
+    ReleaseMeshState();
 
-    // Check if texture is power-of-two (POT)
-    bool texIsPOT = false;
+    glBindTexture(GL_TEXTURE_2D, 0);    // Free any old binding
 
-    if (((texture->width > 0) && ((texture->width & (texture->width - 1)) == 0)) &&
-        ((texture->height > 0) && ((texture->height & (texture->height - 1)) == 0))) texIsPOT = true;
+    unsigned int id = 0;
 
+    // Check texture format support by OpenGL 1.1 (compressed textures not supported)
 #if defined(GRAPHICS_API_OPENGL_11)
-    if (texIsPOT)
+    if (format >= COMPRESSED_DXT1_RGB)
     {
-        // WARNING: Manual mipmap generation only works for RGBA 32bit textures!
-        if (texture->format == UNCOMPRESSED_R8G8B8A8)
-        {
-            // Retrieve texture data from VRAM
-            void *data = rlReadTexturePixels(*texture);
+        TraceLog(LOG_WARNING, "OpenGL 1.1 does not support GPU compressed texture formats");
+        return id;
+    }
+#else
+    if ((!texCompDXTSupported) && ((format == COMPRESSED_DXT1_RGB) || (format == COMPRESSED_DXT1_RGBA) ||
+        (format == COMPRESSED_DXT3_RGBA) || (format == COMPRESSED_DXT5_RGBA)))
+    {
+        TraceLog(LOG_WARNING, "DXT compressed texture format not supported");
+        return id;
+    }
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if ((!texCompETC1Supported) && (format == COMPRESSED_ETC1_RGB))
+    {
+        TraceLog(LOG_WARNING, "ETC1 compressed texture format not supported");
+        return id;
+    }
 
-            // NOTE: data size is reallocated to fit mipmaps data
-            // NOTE: CPU mipmap generation only supports RGBA 32bit data
-            int mipmapCount = GenerateMipmaps(data, texture->width, texture->height);
+    if ((!texCompETC2Supported) && ((format == COMPRESSED_ETC2_RGB) || (format == COMPRESSED_ETC2_EAC_RGBA)))
+    {
+        TraceLog(LOG_WARNING, "ETC2 compressed texture format not supported");
+        return id;
+    }
 
-            int size = texture->width*texture->height*4;
-            int offset = size;
+    if ((!texCompPVRTSupported) && ((format == COMPRESSED_PVRT_RGB) || (format == COMPRESSED_PVRT_RGBA)))
+    {
+        TraceLog(LOG_WARNING, "PVRT compressed texture format not supported");
+        return id;
+    }
 
-            int mipWidth = texture->width/2;
-            int mipHeight = texture->height/2;
+    if ((!texCompASTCSupported) && ((format == COMPRESSED_ASTC_4x4_RGBA) || (format == COMPRESSED_ASTC_8x8_RGBA)))
+    {
+        TraceLog(LOG_WARNING, "ASTC compressed texture format not supported");
+        return id;
+    }
+#endif
+#endif      // GRAPHICS_API_OPENGL_11
 
-            // Load the mipmaps
-            for (int level = 1; level < mipmapCount; level++)
-            {
-                glTexImage2D(GL_TEXTURE_2D, level, GL_RGBA8, mipWidth, mipHeight, 0, GL_RGBA, GL_UNSIGNED_BYTE, (unsigned char *)data + offset);
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
 
-                size = mipWidth*mipHeight*4;
-                offset += size;
+    glGenTextures(1, &id);              // Generate texture id
 
-                mipWidth /= 2;
-                mipHeight /= 2;
-            }
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    //glActiveTexture(GL_TEXTURE0);     // If not defined, using GL_TEXTURE0 by default (shader texture)
+#endif
 
-            texture->mipmaps = mipmapCount + 1;
-            RL_FREE(data); // Once mipmaps have been generated and data has been uploaded to GPU VRAM, we can discard RAM data
+    glBindTexture(GL_TEXTURE_2D, id);
 
-            TraceLog(LOG_WARNING, "[TEX ID %i] Mipmaps [%i] generated manually on CPU side", texture->id, texture->mipmaps);
-        }
-        else TraceLog(LOG_WARNING, "[TEX ID %i] Mipmaps could not be generated for texture format", texture->id);
-    }
-#elif defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    if ((texIsPOT) || (texNPOTSupported))
+    int mipWidth = width;
+    int mipHeight = height;
+    int mipOffset = 0;          // Mipmap data offset
+
+    TraceLog(LOG_DEBUG, "Load texture from data memory address: 0x%x", data);
+
+    // Load the different mipmap levels
+    for (int i = 0; i < mipmapCount; i++)
     {
-        //glHint(GL_GENERATE_MIPMAP_HINT, GL_DONT_CARE);   // Hint for mipmaps generation algorythm: GL_FASTEST, GL_NICEST, GL_DONT_CARE
-        glGenerateMipmap(GL_TEXTURE_2D);    // Generate mipmaps automatically
-        TraceLog(LOG_INFO, "[TEX ID %i] Mipmaps generated automatically", texture->id);
+        unsigned int mipSize = GetPixelDataSize(mipWidth, mipHeight, format);
 
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);   // Activate Trilinear filtering for mipmaps
+        unsigned int glInternalFormat, glFormat, glType;
+        rlGetGlTextureFormats(format, &glInternalFormat, &glFormat, &glType);
 
-        #define MIN(a,b) (((a)<(b))?(a):(b))
-        #define MAX(a,b) (((a)>(b))?(a):(b))
+        TraceLog(LOG_DEBUG, "Load mipmap level %i (%i x %i), size: %i, offset: %i", i, mipWidth, mipHeight, mipSize, mipOffset);
 
-        texture->mipmaps =  1 + (int)floor(log(MAX(texture->width, texture->height))/log(2));
-    }
-#endif
-    else TraceLog(LOG_WARNING, "[TEX ID %i] Mipmaps can not be generated", texture->id);
-
-    glBindTexture(GL_TEXTURE_2D, 0);
-}
+        // NOTE: NULL data only allocates mipmap levels storage, data is provided later (rlUpdateTextureMipmap())
+        unsigned char *mipData = (data != NULL)? (unsigned char *)data + mipOffset : NULL;
 
-// Upload vertex data into a VAO (if supported) and VBO
-void rlLoadMesh(Mesh *mesh, bool dynamic)
-{
-    if (mesh->vaoId > 0)
-    {
-        // Check if mesh has already been loaded in GPU
-        TraceLog(LOG_WARNING, "Trying to re-load an already loaded mesh");
-        return;
-    }
+        if (glInternalFormat != -1)
+        {
+            if (format < COMPRESSED_DXT1_RGB) glTexImage2D(GL_TEXTURE_2D, i, glInternalFormat, mipWidth, mipHeight, 0, glFormat, glType, mipData);
+        #if !defined(GRAPHICS_API_OPENGL_11)
+            else glCompressedTexImage2D(GL_TEXTURE_2D, i, glInternalFormat, mipWidth, mipHeight, 0, mipSize, mipData);
+        #endif
 
-    mesh->vaoId = 0;        // Vertex Array Object
-    mesh->vboId[0] = 0;     // Vertex positions VBO
-    mesh->vboId[1] = 0;     // Vertex texcoords VBO
-    mesh->vboId[2] = 0;     // Vertex normals VBO
-    mesh->vboId[3] = 0;     // Vertex colors VBO
-    mesh->vboId[4] = 0;     // Vertex tangents VBO
-    mesh->vboId[5] = 0;     // Vertex texcoords2 VBO
-    mesh->vboId[6] = 0;     // Vertex indices VBO
+        #if defined(GRAPHICS_API_OPENGL_33)
+            if (format == UNCOMPRESSED_GRAYSCALE)
+            {
+                GLint swizzleMask[] = { GL_RED, GL_RED, GL_RED, GL_ONE };
+                glTexParameteriv(GL_TEXTURE_2D, GL_TEXTURE_SWIZZLE_RGBA, swizzleMask);
+            }
+            else if (format == UNCOMPRESSED_GRAY_ALPHA)
+            {
+            #if defined(GRAPHICS_API_OPENGL_21)
+                GLint swizzleMask[] = { GL_RED, GL_RED, GL_RED, GL_ALPHA };
+            #elif defined(GRAPHICS_API_OPENGL_33)
+                GLint swizzleMask[] = { GL_RED, GL_RED, GL_RED, GL_GREEN };
+            #endif
+                glTexParameteriv(GL_TEXTURE_2D, GL_TEXTURE_SWIZZLE_RGBA, swizzleMask);
+            }
+        #endif
+        }
 
-#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    int drawHint = GL_STATIC_DRAW;
-    if (dynamic) drawHint = GL_DYNAMIC_DRAW;
+        mipWidth /= 2;
+        mipHeight /= 2;
+        mipOffset += mipSize;
 
-    if (vaoSupported)
-    {
-        // Initialize Quads VAO (Buffer A)
-        glGenVertexArrays(1, &mesh->vaoId);
-        glBindVertexArray(mesh->vaoId);
+        // Security check for NPOT textures
+        if (mipWidth < 1) mipWidth = 1;
+        if (mipHeight < 1) mipHeight = 1;
     }
 
-    // NOTE: Attributes must be uploaded considering default locations points
-
-    // Enable vertex attributes: position (shader-location = 0)
-    glGenBuffers(1, &mesh->vboId[0]);
-    glBindBuffer(GL_ARRAY_BUFFER, mesh->vboId[0]);
-    glBufferData(GL_ARRAY_BUFFER, sizeof(float)*3*mesh->vertexCount, mesh->vertices, drawHint);
-    glVertexAttribPointer(0, 3, GL_FLOAT, 0, 0, 0);
-    glEnableVertexAttribArray(0);
-
-    // Enable vertex attributes: texcoords (shader-location = 1)
-    glGenBuffers(1, &mesh->vboId[1]);
-    glBindBuffer(GL_ARRAY_BUFFER, mesh->vboId[1]);
-    glBufferData(GL_ARRAY_BUFFER, sizeof(float)*2*mesh->vertexCount, mesh->texcoords, drawHint);
-    glVertexAttribPointer(1, 2, GL_FLOAT, 0, 0, 0);
-    glEnableVertexAttribArray(1);
-
-    // Enable vertex attributes: normals (shader-location = 2)
-    if (mesh->normals != NULL)
+    // Texture parameters configuration
+    // NOTE: glTexParameteri does NOT affect texture uploading, just the way it's used
+#if defined(GRAPHICS_API_OPENGL_ES2)
+    // NOTE: OpenGL ES 2.0 with no GL_OES_texture_npot support (i.e. WebGL) has limited NPOT support, so CLAMP_TO_EDGE must be used
+    if (texNPOTSupported)
     {
-        glGenBuffers(1, &mesh->vboId[2]);
-        glBindBuffer(GL_ARRAY_BUFFER, mesh->vboId[2]);
-        glBufferData(GL_ARRAY_BUFFER, sizeof(float)*3*mesh->vertexCount, mesh->normals, drawHint);
-        glVertexAttribPointer(2, 3, GL_FLOAT, 0, 0, 0);
-        glEnableVertexAttribArray(2);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);       // Set texture to repeat on x-axis
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);       // Set texture to repeat on y-axis
     }
     else
     {
-        // Default color vertex attribute set to WHITE
-        glVertexAttrib3f(2, 1.0f, 1.0f, 1.0f);
-        glDisableVertexAttribArray(2);
+        // NOTE: If using negative texture coordinates (LoadOBJ()), it does not work!
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);       // Set texture to clamp on x-axis
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);       // Set texture to clamp on y-axis
     }
+#else
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);       // Set texture to repeat on x-axis
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);       // Set texture to repeat on y-axis
+#endif
 
-    // Default color vertex attribute (shader-location = 3)
-    if (mesh->colors != NULL)
-    {
-        glGenBuffers(1, &mesh->vboId[3]);
-        glBindBuffer(GL_ARRAY_BUFFER, mesh->vboId[3]);
-        glBufferData(GL_ARRAY_BUFFER, sizeof(unsigned char)*4*mesh->vertexCount, mesh->colors, drawHint);
-        glVertexAttribPointer(3, 4, GL_UNSIGNED_BYTE, GL_TRUE, 0, 0);
-        glEnableVertexAttribArray(3);
-    }
-    else
-    {
-        // Default color vertex attribute set to WHITE
-        glVertexAttrib4f(3, 1.0f, 1.0f, 1.0f, 1.0f);
-        glDisableVertexAttribArray(3);
-    }
+    // Magnification and minification filters
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);  // Alternative: GL_LINEAR
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);  // Alternative: GL_LINEAR
 
-    // Default tangent vertex attribute (shader-location = 4)
-    if (mesh->tangents != NULL)
-    {
-        glGenBuffers(1, &mesh->vboId[4]);
-        glBindBuffer(GL_ARRAY_BUFFER, mesh->vboId[4]);
-        glBufferData(GL_ARRAY_BUFFER, sizeof(float)*4*mesh->vertexCount, mesh->tangents, drawHint);
-        glVertexAttribPointer(4, 4, GL_FLOAT, 0, 0, 0);
-        glEnableVertexAttribArray(4);
-    }
-    else
+    if (mipmapCount > 1)
     {
-        // Default tangents vertex attribute
-        glVertexAttrib4f(4, 0.0f, 0.0f, 0.0f, 0.0f);
-        glDisableVertexAttribArray(4);
+        // Activate Trilinear filtering if mipmaps are available
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
     }
 
-    // Default texcoord2 vertex attribute (shader-location = 5)
-    if (mesh->texcoords2 != NULL)
-    {
-        glGenBuffers(1, &mesh->vboId[5]);
-        glBindBuffer(GL_ARRAY_BUFFER, mesh->vboId[5]);
-        glBufferData(GL_ARRAY_BUFFER, sizeof(float)*2*mesh->vertexCount, mesh->texcoords2, drawHint);
-        glVertexAttribPointer(5, 2, GL_FLOAT, 0, 0, 0);
-        glEnableVertexAttribArray(5);
-    }
-    else
+    // At this point we have the texture loaded in GPU and texture parameters configured
+
+    // NOTE: If mipmaps were not in data, they are not generated automatically
+
+    // Unbind current texture
+    glBindTexture(GL_TEXTURE_2D, 0);
+
+    TrackVideoMemory(VIDEO_MEMORY_TEXTURE, id, mipOffset);
+
+    if (id > 0) TraceLog(LOG_INFO, "[TEX ID %i] Texture created successfully (%ix%i - %i mipmaps)", id, width, height, mipmapCount);
+    else TraceLog(LOG_WARNING, "Texture could not be created");
+
+    return id;
+}
+
+// Load depth texture/renderbuffer (to be attached to fbo)
+// WARNING: OpenGL ES 2.0 requires GL_OES_depth_texture/WEBGL_depth_texture extensions
+unsigned int rlLoadTextureDepth(int width, int height, int bits, bool useRenderBuffer)
+{
+    ReleaseMeshState();
+
+    unsigned int id = 0;
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    unsigned int glInternalFormat = GL_DEPTH_COMPONENT16;
+
+    if ((bits != 16) && (bits != 24) && (bits != 32)) bits = 16;
+
+    if (bits == 24)
     {
-        // Default texcoord2 vertex attribute
-        glVertexAttrib2f(5, 0.0f, 0.0f);
-        glDisableVertexAttribArray(5);
+#if defined(GRAPHICS_API_OPENGL_33)
+        glInternalFormat = GL_DEPTH_COMPONENT24;
+#elif defined(GRAPHICS_API_OPENGL_ES2)
+        if (maxDepthBits >= 24) glInternalFormat = GL_DEPTH_COMPONENT24_OES;
+#endif
     }
 
-    if (mesh->indices != NULL)
+    if (bits == 32)
     {
-        glGenBuffers(1, &mesh->vboId[6]);
-        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, mesh->vboId[6]);
-        glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(unsigned short)*mesh->triangleCount*3, mesh->indices, drawHint);
+#if defined(GRAPHICS_API_OPENGL_33)
+        glInternalFormat = GL_DEPTH_COMPONENT32;
+#elif defined(GRAPHICS_API_OPENGL_ES2)
+        if (maxDepthBits == 32) glInternalFormat = GL_DEPTH_COMPONENT32_OES;
+#endif
     }
 
-    if (vaoSupported)
+    if (!useRenderBuffer && texDepthSupported)
     {
-        if (mesh->vaoId > 0) TraceLog(LOG_INFO, "[VAO ID %i] Mesh uploaded successfully to VRAM (GPU)", mesh->vaoId);
-        else TraceLog(LOG_WARNING, "Mesh could not be uploaded to VRAM (GPU)");
+        glGenTextures(1, &id);
+        glBindTexture(GL_TEXTURE_2D, id);
+        glTexImage2D(GL_TEXTURE_2D, 0, glInternalFormat, width, height, 0, GL_DEPTH_COMPONENT, GL_UNSIGNED_INT, NULL);
+
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+
+        glBindTexture(GL_TEXTURE_2D, 0);
+
+        TrackVideoMemory(VIDEO_MEMORY_TEXTURE, id, width*height*bits/8);
     }
     else
     {
-        TraceLog(LOG_INFO, "[VBOs] Mesh uploaded successfully to VRAM (GPU)");
+        // Create the renderbuffer that will serve as the depth attachment for the framebuffer
+        // NOTE: A renderbuffer is simpler than a texture and could offer better performance on embedded devices
+        glGenRenderbuffers(1, &id);
+        glBindRenderbuffer(GL_RENDERBUFFER, id);
+        glRenderbufferStorage(GL_RENDERBUFFER, glInternalFormat, width, height);
+
+        glBindRenderbuffer(GL_RENDERBUFFER, 0);
+
+        TrackVideoMemory(VIDEO_MEMORY_RENDERBUFFER, id, width*height*bits/8);
     }
 #endif
+
+    return id;
 }
 
-// Load a new attributes buffer
-unsigned int rlLoadAttribBuffer(unsigned int vaoId, int shaderLoc, void *buffer, int size, bool dynamic)
+// Load texture cubemap
+// NOTE: Cubemap data is expected to be 6 images in a single column,
+// expected the following convention: +X, -X, +Y, -Y, +Z, -Z
+unsigned int rlLoadTextureCubemap(void *data, int size, int format)
 {
-    unsigned int id = 0;
+    ReleaseMeshState();
+
+    unsigned int cubemapId = 0;
+    unsigned int dataSize = GetPixelDataSize(size, size, format);
 
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    int drawHint = GL_STATIC_DRAW;
-    if (dynamic) drawHint = GL_DYNAMIC_DRAW;
+    glGenTextures(1, &cubemapId);
+    glBindTexture(GL_TEXTURE_CUBE_MAP, cubemapId);
 
-    if (vaoSupported) glBindVertexArray(vaoId);
+    unsigned int glInternalFormat, glFormat, glType;
+    rlGetGlTextureFormats(format, &glInternalFormat, &glFormat, &glType);
 
-    glGenBuffers(1, &id);
-    glBindBuffer(GL_ARRAY_BUFFER, id);
-    glBufferData(GL_ARRAY_BUFFER, size, buffer, drawHint);
-    glVertexAttribPointer(shaderLoc, 2, GL_FLOAT, 0, 0, 0);
-    glEnableVertexAttribArray(shaderLoc);
+    if (glInternalFormat != -1)
+    {
+        // Load cubemap faces
+        for (unsigned int i = 0; i < 6; i++)
+        {
+            if (format < COMPRESSED_DXT1_RGB) glTexImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_X + i, 0, glInternalFormat, size, size, 0, glFormat, glType, (unsigned char *)data + i*dataSize);
+#if !defined(GRAPHICS_API_OPENGL_11)
+            else glCompressedTexImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_X + i, 0, glInternalFormat, size, size, 0, dataSize, (unsigned char *)data + i*dataSize);
+#endif
+#if defined(GRAPHICS_API_OPENGL_33)
+            if (format == UNCOMPRESSED_GRAYSCALE)
+            {
+                GLint swizzleMask[] = { GL_RED, GL_RED, GL_RED, GL_ONE };
+                glTexParameteriv(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_SWIZZLE_RGBA, swizzleMask);
+            }
+            else if (format == UNCOMPRESSED_GRAY_ALPHA)
+            {
+#if defined(GRAPHICS_API_OPENGL_21)
+                GLint swizzleMask[] = { GL_RED, GL_RED, GL_RED, GL_ALPHA };
+#elif defined(GRAPHICS_API_OPENGL_33)
+                GLint swizzleMask[] = { GL_RED, GL_RED, GL_RED, GL_GREEN };
+#endif
+                glTexParameteriv(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_SWIZZLE_RGBA, swizzleMask);
+            }
+#endif
+        }
+    }
 
-    if (vaoSupported) glBindVertexArray(0);
+    // Set cubemap texture sampling parameters
+    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+#if defined(GRAPHICS_API_OPENGL_33)
+    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_R, GL_CLAMP_TO_EDGE);  // Flag not supported on OpenGL ES 2.0
 #endif
 
-    return id;
-}
+    glBindTexture(GL_TEXTURE_CUBE_MAP, 0);
 
-// Update vertex or index data on GPU (upload new data to one buffer)
-void rlUpdateMesh(Mesh mesh, int buffer, int num)
-{
-    rlUpdateMeshAt(mesh, buffer, num, 0);
+    TrackVideoMemory(VIDEO_MEMORY_TEXTURE, cubemapId, 6*dataSize);
+#endif
+
+    return cubemapId;
 }
 
-// Update vertex or index data on GPU, at index
-// WARNING: error checking is in place that will cause the data to not be
-//          updated if offset + size exceeds what the buffer can hold
-void rlUpdateMeshAt(Mesh mesh, int buffer, int num, int index)
+// Load texture array (all layers same size and format)
+// NOTE: Layers data is expected packed consecutively, one layer after another
+unsigned int rlLoadTextureArray(void *data, int width, int height, int layers, int format)
 {
-#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    // Activate mesh VAO
-    if (vaoSupported) glBindVertexArray(mesh.vaoId);
+    unsigned int id = 0;
 
-    switch (buffer)
+#if defined(GRAPHICS_API_OPENGL_33)
+    if (!texArraySupported)
     {
-        case 0:     // Update vertices (vertex position)
-        {
-            glBindBuffer(GL_ARRAY_BUFFER, mesh.vboId[0]);
-            if (index == 0 && num >= mesh.vertexCount) glBufferData(GL_ARRAY_BUFFER, sizeof(float)*3*num, mesh.vertices, GL_DYNAMIC_DRAW);
-            else if (index + num >= mesh.vertexCount) break;
-            else glBufferSubData(GL_ARRAY_BUFFER, sizeof(float)*3*index, sizeof(float)*3*num, mesh.vertices);
+        TraceLog(LOG_WARNING, "Texture arrays not supported");
+        return id;
+    }
 
-        } break;
-        case 1:     // Update texcoords (vertex texture coordinates)
-        {
-            glBindBuffer(GL_ARRAY_BUFFER, mesh.vboId[1]);
-            if (index == 0 && num >= mesh.vertexCount) glBufferData(GL_ARRAY_BUFFER, sizeof(float)*2*num, mesh.texcoords, GL_DYNAMIC_DRAW);
-            else if (index + num >= mesh.vertexCount) break;
-            else glBufferSubData(GL_ARRAY_BUFFER, sizeof(float)*2*index, sizeof(float)*2*num, mesh.texcoords);
+    ReleaseMeshState();
 
-        } break;
-        case 2:     // Update normals (vertex normals)
-        {
-            glBindBuffer(GL_ARRAY_BUFFER, mesh.vboId[2]);
-            if (index == 0 && num >= mesh.vertexCount) glBufferData(GL_ARRAY_BUFFER, sizeof(float)*3*num, mesh.normals, GL_DYNAMIC_DRAW);
-            else if (index + num >= mesh.vertexCount) break;
-            else glBufferSubData(GL_ARRAY_BUFFER, sizeof(float)*3*index, sizeof(float)*3*num, mesh.normals);
+    unsigned int dataSize = GetPixelDataSize(width, height, format);
+    unsigned int glInternalFormat, glFormat, glType;
+    rlGetGlTextureFormats(format, &glInternalFormat, &glFormat, &glType);
 
-        } break;
-        case 3:     // Update colors (vertex colors)
-        {
-            glBindBuffer(GL_ARRAY_BUFFER, mesh.vboId[3]);
-            if (index == 0 && num >= mesh.vertexCount) glBufferData(GL_ARRAY_BUFFER, sizeof(float)*4*num, mesh.colors, GL_DYNAMIC_DRAW);
-            else if (index + num >= mesh.vertexCount) break;
-            else glBufferSubData(GL_ARRAY_BUFFER, sizeof(unsigned char)*4*index, sizeof(unsigned char)*4*num, mesh.colors);
+    if (glInternalFormat == -1)
+    {
+        TraceLog(LOG_WARNING, "Texture array format not supported (%i)", format);
+        return id;
+    }
 
-        } break;
-        case 4:     // Update tangents (vertex tangents)
-        {
-            glBindBuffer(GL_ARRAY_BUFFER, mesh.vboId[4]);
-            if (index == 0 && num >= mesh.vertexCount) glBufferData(GL_ARRAY_BUFFER, sizeof(float)*4*num, mesh.tangents, GL_DYNAMIC_DRAW);
-            else if (index + num >= mesh.vertexCount) break;
-            else glBufferSubData(GL_ARRAY_BUFFER, sizeof(float)*4*index, sizeof(float)*4*num, mesh.tangents);
-        } break;
-        case 5:     // Update texcoords2 (vertex second texture coordinates)
-        {
-            glBindBuffer(GL_ARRAY_BUFFER, mesh.vboId[5]);
-            if (index == 0 && num >= mesh.vertexCount) glBufferData(GL_ARRAY_BUFFER, sizeof(float)*2*num, mesh.texcoords2, GL_DYNAMIC_DRAW);
-            else if (index + num >= mesh.vertexCount) break;
-            else glBufferSubData(GL_ARRAY_BUFFER, sizeof(float)*2*index, sizeof(float)*2*num, mesh.texcoords2);
-        } break;
-        case 6:     // Update indices (triangle index buffer)
-        {
-            // the * 3 is because each triangle has 3 indices
-            unsigned short *indices = mesh.indices;
-            glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, mesh.vboId[6]);
-            if (index == 0 && num >= mesh.triangleCount)
-                glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(*indices)*num*3, indices, GL_DYNAMIC_DRAW);
-            else if (index + num >= mesh.triangleCount)
-                break;
-            else
-                glBufferSubData(GL_ELEMENT_ARRAY_BUFFER, sizeof(*indices)*index*3, sizeof(*indices)*num*3, indices);
-        } break;
-        default: break;
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+
+    glGenTextures(1, &id);
+    glBindTexture(GL_TEXTURE_2D_ARRAY, id);
+
+    if (format < COMPRESSED_DXT1_RGB) glTexImage3D(GL_TEXTURE_2D_ARRAY, 0, glInternalFormat, width, height, layers, 0, glFormat, glType, data);
+    else glCompressedTexImage3D(GL_TEXTURE_2D_ARRAY, 0, glInternalFormat, width, height, layers, 0, dataSize*layers, data);
+
+    if (format == UNCOMPRESSED_GRAYSCALE)
+    {
+        GLint swizzleMask[] = { GL_RED, GL_RED, GL_RED, GL_ONE };
+        glTexParameteriv(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_SWIZZLE_RGBA, swizzleMask);
+    }
+    else if (format == UNCOMPRESSED_GRAY_ALPHA)
+    {
+        GLint swizzleMask[] = { GL_RED, GL_RED, GL_RED, GL_GREEN };
+        glTexParameteriv(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_SWIZZLE_RGBA, swizzleMask);
     }
 
-    // Unbind the current VAO
-    if (vaoSupported) glBindVertexArray(0);
+    // Set texture array sampling parameters
+    // NOTE: Clamp to edge avoids sampling opposite border on sprites edges
+    glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
 
-    // Another option would be using buffer mapping...
-    //mesh.vertices = glMapBuffer(GL_ARRAY_BUFFER, GL_READ_WRITE);
-    // Now we can modify vertices
-    //glUnmapBuffer(GL_ARRAY_BUFFER);
+    glBindTexture(GL_TEXTURE_2D_ARRAY, 0);
+
+    TrackVideoMemory(VIDEO_MEMORY_TEXTURE, id, dataSize*layers);
+
+    if (id > 0) TraceLog(LOG_INFO, "[TEX ID %i] Texture array created successfully (%ix%i - %i layers)", id, width, height, layers);
+    else TraceLog(LOG_WARNING, "Texture array could not be created");
+#else
+    TraceLog(LOG_WARNING, "Texture arrays not supported on OpenGL 1.1 and OpenGL ES 2.0");
 #endif
+
+    return id;
 }
 
-// Draw a 3d mesh with material and transform
-void rlDrawMesh(Mesh mesh, Material material, Matrix transform)
+// Update already loaded texture in GPU with new data
+// NOTE: We don't know safely if internal texture format is the expected one...
+void rlUpdateTexture(unsigned int id, int width, int height, int format, const void *data)
 {
-#if defined(GRAPHICS_API_OPENGL_11)
-    glEnable(GL_TEXTURE_2D);
-    glBindTexture(GL_TEXTURE_2D, material.maps[MAP_DIFFUSE].texture.id);
+    ReleaseMeshState();
 
-    // NOTE: On OpenGL 1.1 we use Vertex Arrays to draw model
-    glEnableClientState(GL_VERTEX_ARRAY);                   // Enable vertex array
-    glEnableClientState(GL_TEXTURE_COORD_ARRAY);            // Enable texture coords array
-    if (mesh.normals != NULL) glEnableClientState(GL_NORMAL_ARRAY);     // Enable normals array
-    if (mesh.colors != NULL) glEnableClientState(GL_COLOR_ARRAY);       // Enable colors array
+    glBindTexture(GL_TEXTURE_2D, id);
 
-    glVertexPointer(3, GL_FLOAT, 0, mesh.vertices);         // Pointer to vertex coords array
-    glTexCoordPointer(2, GL_FLOAT, 0, mesh.texcoords);      // Pointer to texture coords array
-    if (mesh.normals != NULL) glNormalPointer(GL_FLOAT, 0, mesh.normals);           // Pointer to normals array
-    if (mesh.colors != NULL) glColorPointer(4, GL_UNSIGNED_BYTE, 0, mesh.colors);   // Pointer to colors array
+    unsigned int glInternalFormat, glFormat, glType;
+    rlGetGlTextureFormats(format, &glInternalFormat, &glFormat, &glType);
 
-    rlPushMatrix();
-        rlMultMatrixf(MatrixToFloat(transform));
-        rlColor4ub(material.maps[MAP_DIFFUSE].color.r, material.maps[MAP_DIFFUSE].color.g, material.maps[MAP_DIFFUSE].color.b, material.maps[MAP_DIFFUSE].color.a);
+    if ((glInternalFormat != -1) && (format < COMPRESSED_DXT1_RGB))
+    {
+        glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, width, height, glFormat, glType, (unsigned char *)data);
+    }
+    else TraceLog(LOG_WARNING, "Texture format updating not supported");
+}
 
-        if (mesh.indices != NULL) glDrawElements(GL_TRIANGLES, mesh.triangleCount*3, GL_UNSIGNED_SHORT, mesh.indices);
-        else glDrawArrays(GL_TRIANGLES, 0, mesh.vertexCount);
-    rlPopMatrix();
+// Update GPU texture rectangle with new data
+void rlUpdateTextureRec(unsigned int id, int offsetX, int offsetY, int width, int height, int format, const void *data)
+{
+    ReleaseMeshState();
 
-    glDisableClientState(GL_VERTEX_ARRAY);                  // Disable vertex array
-    glDisableClientState(GL_TEXTURE_COORD_ARRAY);           // Disable texture coords array
-    if (mesh.normals != NULL) glDisableClientState(GL_NORMAL_ARRAY);    // Disable normals array
-    if (mesh.colors != NULL) glDisableClientState(GL_NORMAL_ARRAY);     // Disable colors array
+    glBindTexture(GL_TEXTURE_2D, id);
 
-    glDisable(GL_TEXTURE_2D);
+    unsigned int glInternalFormat, glFormat, glType;
+    rlGetGlTextureFormats(format, &glInternalFormat, &glFormat, &glType);
+
+    if ((glInternalFormat != -1) && (format < COMPRESSED_DXT1_RGB))
+    {
+        glTexSubImage2D(GL_TEXTURE_2D, 0, offsetX, offsetY, width, height, glFormat, glType, (unsigned char *)data);
+    }
+    else TraceLog(LOG_WARNING, "Texture format updating not supported");
+}
+
+// Update GPU texture mipmap level rows with new data, width and height are level rows size
+// NOTE: Compressed formats can only be updated as a whole level (offsetY = 0, height = level height)
+void rlUpdateTextureMipmap(unsigned int id, int level, int offsetY, int width, int height, int format, const void *data)
+{
+    ReleaseMeshState();
+
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+    glBindTexture(GL_TEXTURE_2D, id);
+
+    unsigned int glInternalFormat, glFormat, glType;
+    rlGetGlTextureFormats(format, &glInternalFormat, &glFormat, &glType);
+
+    if ((glInternalFormat != -1) && (format < COMPRESSED_DXT1_RGB))
+    {
+        glTexSubImage2D(GL_TEXTURE_2D, level, 0, offsetY, width, height, glFormat, glType, (unsigned char *)data);
+    }
+#if !defined(GRAPHICS_API_OPENGL_11)
+    else if ((glInternalFormat != -1) && (offsetY == 0))
+    {
+        glCompressedTexSubImage2D(GL_TEXTURE_2D, level, 0, 0, width, height, glInternalFormat, GetPixelDataSize(width, height, format), data);
+    }
+#endif
+    else TraceLog(LOG_WARNING, "Texture format updating not supported");
+
+    glBindTexture(GL_TEXTURE_2D, 0);
+}
+
+// Set texture mipmap levels sampled, levels outside range are not accessed (can be undefined)
+// NOTE: Not supported on OpenGL 1.1 and ES 2.0, all levels are sampled
+void rlSetTextureMipmapRange(unsigned int id, int baseLevel, int maxLevel)
+{
+#if defined(GRAPHICS_API_OPENGL_33)
+    ReleaseMeshState();
+
+    glBindTexture(GL_TEXTURE_2D, id);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_BASE_LEVEL, baseLevel);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, maxLevel);
     glBindTexture(GL_TEXTURE_2D, 0);
 #endif
+}
 
-#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    // Bind shader program
-    glUseProgram(material.shader.id);
+// Update GPU texture with new data through pixel buffer
+// NOTE: Data is copied into a mapped pixel buffer and GPU copies it into texture asynchronously,
+// use rlIsTextureUpdated() to check completion, falls back to rlUpdateTexture() if not supported
+void rlUpdateTextureAsync(unsigned int id, int width, int height, int format, const void *data)
+{
+#if defined(GRAPHICS_API_OPENGL_33)
+    unsigned int glInternalFormat, glFormat, glType;
+    rlGetGlTextureFormats(format, &glInternalFormat, &glFormat, &glType);
 
-    // Matrices and other values required by shader
-    //-----------------------------------------------------
-    // Calculate and send to shader model matrix (used by PBR shader)
-    if (material.shader.locs[LOC_MATRIX_MODEL] != -1) SetShaderValueMatrix(material.shader, material.shader.locs[LOC_MATRIX_MODEL], transform);
+    if (mapBufferRangeSupported && (glInternalFormat != -1) && (format < COMPRESSED_DXT1_RGB))
+    {
+        ReleaseMeshState();
 
-    // Upload to shader material.colDiffuse
-    if (material.shader.locs[LOC_COLOR_DIFFUSE] != -1)
-        glUniform4f(material.shader.locs[LOC_COLOR_DIFFUSE], (float)material.maps[MAP_DIFFUSE].color.r/255.0f,
-                                                           (float)material.maps[MAP_DIFFUSE].color.g/255.0f,
-                                                           (float)material.maps[MAP_DIFFUSE].color.b/255.0f,
-                                                           (float)material.maps[MAP_DIFFUSE].color.a/255.0f);
+        int size = GetPixelDataSize(width, height, format);
+        TextureUpload *upload = &textureUploads[currentTextureUpload];
 
-    // Upload to shader material.colSpecular (if available)
-    if (material.shader.locs[LOC_COLOR_SPECULAR] != -1)
-        glUniform4f(material.shader.locs[LOC_COLOR_SPECULAR], (float)material.maps[MAP_SPECULAR].color.r/255.0f,
-                                                               (float)material.maps[MAP_SPECULAR].color.g/255.0f,
-                                                               (float)material.maps[MAP_SPECULAR].color.b/255.0f,
-                                                               (float)material.maps[MAP_SPECULAR].color.a/255.0f);
+        // Wait for previous upload using this buffer (only if all buffers in ring are in flight)
+        if (upload->fence != NULL)
+        {
+            GLbitfield flags = GL_SYNC_FLUSH_COMMANDS_BIT;
 
-    if (material.shader.locs[LOC_MATRIX_VIEW] != -1) SetShaderValueMatrix(material.shader, material.shader.locs[LOC_MATRIX_VIEW], modelview);
-    if (material.shader.locs[LOC_MATRIX_PROJECTION] != -1) SetShaderValueMatrix(material.shader, material.shader.locs[LOC_MATRIX_PROJECTION], projection);
+            while (true)
+            {
+                GLenum result = glClientWaitSync(upload->fence, flags, 1000000);  // 1 ms timeout (in nanoseconds)
 
-    // At this point the modelview matrix just contains the view matrix (camera)
-    // That's because BeginMode3D() sets it an no model-drawing function modifies it, all use rlPushMatrix() and rlPopMatrix()
-    Matrix matView = modelview;         // View matrix (camera)
-    Matrix matProjection = projection;  // Projection matrix (perspective)
+                if ((result == GL_ALREADY_SIGNALED) || (result == GL_CONDITION_SATISFIED) || (result == GL_WAIT_FAILED)) break;
 
-    // TODO: Consider possible transform matrices in the stack
-    // Is this the right order? or should we start with the first stored matrix instead of the last one?
-    //Matrix matStackTransform = MatrixIdentity();
-    //for (int i = stackCounter; i > 0; i--) matStackTransform = MatrixMultiply(stack[i], matStackTransform);
+                flags = 0;  // Commands only need to be flushed once
+            }
 
-    // Transform to camera-space coordinates
-    Matrix matModelView = MatrixMultiply(transform, MatrixMultiply(transformMatrix, matView));
-    //-----------------------------------------------------
+            glDeleteSync(upload->fence);
+            upload->fence = NULL;
+        }
 
-    // Bind active texture maps (if available)
-    for (int i = 0; i < MAX_MATERIAL_MAPS; i++)
+        if (upload->pboId == 0) glGenBuffers(1, &upload->pboId);
+        glBindBuffer(GL_PIXEL_UNPACK_BUFFER, upload->pboId);
+
+        // NOTE: Buffer storage is only reallocated if required size grows
+        if (size > upload->size)
+        {
+            glBufferData(GL_PIXEL_UNPACK_BUFFER, size, NULL, GL_STREAM_DRAW);
+            upload->size = size;
+        }
+
+        // NOTE: Buffer is not used by GPU anymore (fence signaled), unsynchronized mapping is safe
+        void *mapped = glMapBufferRange(GL_PIXEL_UNPACK_BUFFER, 0, size, GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_RANGE_BIT | GL_MAP_UNSYNCHRONIZED_BIT);
+
+        if (mapped != NULL)
+        {
+            memcpy(mapped, data, size);
+            glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER);
+
+            // NOTE: With a pixel unpack buffer bound, data pointer is an offset into buffer
+            glBindTexture(GL_TEXTURE_2D, id);
+            glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, width, height, glFormat, glType, (void *)0);
+            glBindTexture(GL_TEXTURE_2D, 0);
+
+            upload->textureId = id;
+            upload->fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+
+            renderStats.uploadedBytes += size;
+        }
+        else TraceLog(LOG_WARNING, "[TEX ID %i] Pixel buffer could not be mapped, texture not updated", id);
+
+        glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+
+        currentTextureUpload = (currentTextureUpload + 1)%MAX_TEXTURE_UPLOADS;
+    }
+    else rlUpdateTexture(id, width, height, format, data);
+#else
+    rlUpdateTexture(id, width, height, format, data);
+#endif
+}
+
+// Check if texture asynchronous updates are completed (no blocking)
+// NOTE: Texture can be used for drawing anytime, GL orders the copy before the draw
+bool rlIsTextureUpdated(unsigned int id)
+{
+    bool updated = true;
+
+#if defined(GRAPHICS_API_OPENGL_33)
+    for (int i = 0; i < MAX_TEXTURE_UPLOADS; i++)
     {
-        if (material.maps[i].texture.id > 0)
+        if ((textureUploads[i].textureId == id) && (textureUploads[i].fence != NULL))
         {
-            glActiveTexture(GL_TEXTURE0 + i);
-            if ((i == MAP_IRRADIANCE) || (i == MAP_PREFILTER) || (i == MAP_CUBEMAP)) glBindTexture(GL_TEXTURE_CUBE_MAP, material.maps[i].texture.id);
-            else glBindTexture(GL_TEXTURE_2D, material.maps[i].texture.id);
+            GLenum result = glClientWaitSync(textureUploads[i].fence, 0, 0);
+
+            if ((result == GL_ALREADY_SIGNALED) || (result == GL_CONDITION_SATISFIED))
+            {
+                glDeleteSync(textureUploads[i].fence);
+                textureUploads[i].fence = NULL;
+                textureUploads[i].textureId = 0;
+            }
+            else updated = false;
+        }
+    }
+#endif
+
+    return updated;
+}
+
+// Get OpenGL internal formats and data type from raylib PixelFormat
+void rlGetGlTextureFormats(int format, unsigned int *glInternalFormat, unsigned int *glFormat, unsigned int *glType)
+{
+    *glInternalFormat = -1;
+    *glFormat = -1;
+    *glType = -1;
+
+    switch (format)
+    {
+    #if defined(GRAPHICS_API_OPENGL_11) || defined(GRAPHICS_API_OPENGL_21) || defined(GRAPHICS_API_OPENGL_ES2)
+        // NOTE: on OpenGL ES 2.0 (WebGL), internalFormat must match format and options allowed are: GL_LUMINANCE, GL_RGB, GL_RGBA
+        case UNCOMPRESSED_GRAYSCALE: *glInternalFormat = GL_LUMINANCE; *glFormat = GL_LUMINANCE; *glType = GL_UNSIGNED_BYTE; break;
+        case UNCOMPRESSED_GRAY_ALPHA: *glInternalFormat = GL_LUMINANCE_ALPHA; *glFormat = GL_LUMINANCE_ALPHA; *glType = GL_UNSIGNED_BYTE; break;
+        case UNCOMPRESSED_R5G6B5: *glInternalFormat = GL_RGB; *glFormat = GL_RGB; *glType = GL_UNSIGNED_SHORT_5_6_5; break;
+        case UNCOMPRESSED_R8G8B8: *glInternalFormat = GL_RGB; *glFormat = GL_RGB; *glType = GL_UNSIGNED_BYTE; break;
+        case UNCOMPRESSED_R5G5B5A1: *glInternalFormat = GL_RGBA; *glFormat = GL_RGBA; *glType = GL_UNSIGNED_SHORT_5_5_5_1; break;
+        case UNCOMPRESSED_R4G4B4A4: *glInternalFormat = GL_RGBA; *glFormat = GL_RGBA; *glType = GL_UNSIGNED_SHORT_4_4_4_4; break;
+        case UNCOMPRESSED_R8G8B8A8: *glInternalFormat = GL_RGBA; *glFormat = GL_RGBA; *glType = GL_UNSIGNED_BYTE; break;
+        #if !defined(GRAPHICS_API_OPENGL_11)
+        case UNCOMPRESSED_R32: if (texFloatSupported) *glInternalFormat = GL_LUMINANCE; *glFormat = GL_LUMINANCE; *glType = GL_FLOAT; break;   // NOTE: Requires extension OES_texture_float
+        case UNCOMPRESSED_R32G32B32: if (texFloatSupported) *glInternalFormat = GL_RGB; *glFormat = GL_RGB; *glType = GL_FLOAT; break;         // NOTE: Requires extension OES_texture_float
+        case UNCOMPRESSED_R32G32B32A32: if (texFloatSupported) *glInternalFormat = GL_RGBA; *glFormat = GL_RGBA; *glType = GL_FLOAT; break;    // NOTE: Requires extension OES_texture_float
+        #endif
+    #elif defined(GRAPHICS_API_OPENGL_33)
+        case UNCOMPRESSED_GRAYSCALE: *glInternalFormat = GL_R8; *glFormat = GL_RED; *glType = GL_UNSIGNED_BYTE; break;
+        case UNCOMPRESSED_GRAY_ALPHA: *glInternalFormat = GL_RG8; *glFormat = GL_RG; *glType = GL_UNSIGNED_BYTE; break;
+        case UNCOMPRESSED_R5G6B5: *glInternalFormat = GL_RGB565; *glFormat = GL_RGB; *glType = GL_UNSIGNED_SHORT_5_6_5; break;
+        case UNCOMPRESSED_R8G8B8: *glInternalFormat = GL_RGB8; *glFormat = GL_RGB; *glType = GL_UNSIGNED_BYTE; break;
+        case UNCOMPRESSED_R5G5B5A1: *glInternalFormat = GL_RGB5_A1; *glFormat = GL_RGBA; *glType = GL_UNSIGNED_SHORT_5_5_5_1; break;
+        case UNCOMPRESSED_R4G4B4A4: *glInternalFormat = GL_RGBA4; *glFormat = GL_RGBA; *glType = GL_UNSIGNED_SHORT_4_4_4_4; break;
+        case UNCOMPRESSED_R8G8B8A8: *glInternalFormat = GL_RGBA8; *glFormat = GL_RGBA; *glType = GL_UNSIGNED_BYTE; break;
+        case UNCOMPRESSED_R32: if (texFloatSupported) *glInternalFormat = GL_R32F; *glFormat = GL_RED; *glType = GL_FLOAT; break;
+        case UNCOMPRESSED_R32G32B32: if (texFloatSupported) *glInternalFormat = GL_RGB32F; *glFormat = GL_RGB; *glType = GL_FLOAT; break;
+        case UNCOMPRESSED_R32G32B32A32: if (texFloatSupported) *glInternalFormat = GL_RGBA32F; *glFormat = GL_RGBA; *glType = GL_FLOAT; break;
+    #endif
+        #if !defined(GRAPHICS_API_OPENGL_11)
+        case COMPRESSED_DXT1_RGB: if (texCompDXTSupported) *glInternalFormat = GL_COMPRESSED_RGB_S3TC_DXT1_EXT; break;
+        case COMPRESSED_DXT1_RGBA: if (texCompDXTSupported) *glInternalFormat = GL_COMPRESSED_RGBA_S3TC_DXT1_EXT; break;
+        case COMPRESSED_DXT3_RGBA: if (texCompDXTSupported) *glInternalFormat = GL_COMPRESSED_RGBA_S3TC_DXT3_EXT; break;
+        case COMPRESSED_DXT5_RGBA: if (texCompDXTSupported) *glInternalFormat = GL_COMPRESSED_RGBA_S3TC_DXT5_EXT; break;
+        case COMPRESSED_ETC1_RGB: if (texCompETC1Supported) *glInternalFormat = GL_ETC1_RGB8_OES; break;                      // NOTE: Requires OpenGL ES 2.0 or OpenGL 4.3
+        case COMPRESSED_ETC2_RGB: if (texCompETC2Supported) *glInternalFormat = GL_COMPRESSED_RGB8_ETC2; break;               // NOTE: Requires OpenGL ES 3.0 or OpenGL 4.3
+        case COMPRESSED_ETC2_EAC_RGBA: if (texCompETC2Supported) *glInternalFormat = GL_COMPRESSED_RGBA8_ETC2_EAC; break;     // NOTE: Requires OpenGL ES 3.0 or OpenGL 4.3
+        case COMPRESSED_PVRT_RGB: if (texCompPVRTSupported) *glInternalFormat = GL_COMPRESSED_RGB_PVRTC_4BPPV1_IMG; break;    // NOTE: Requires PowerVR GPU
+        case COMPRESSED_PVRT_RGBA: if (texCompPVRTSupported) *glInternalFormat = GL_COMPRESSED_RGBA_PVRTC_4BPPV1_IMG; break;  // NOTE: Requires PowerVR GPU
+        case COMPRESSED_ASTC_4x4_RGBA: if (texCompASTCSupported) *glInternalFormat = GL_COMPRESSED_RGBA_ASTC_4x4_KHR; break;  // NOTE: Requires OpenGL ES 3.1 or OpenGL 4.3
+        case COMPRESSED_ASTC_8x8_RGBA: if (texCompASTCSupported) *glInternalFormat = GL_COMPRESSED_RGBA_ASTC_8x8_KHR; break;  // NOTE: Requires OpenGL ES 3.1 or OpenGL 4.3
+        #endif
+        default: TraceLog(LOG_WARNING, "Texture format not supported"); break;
+    }
+}
+
+// Unload texture from GPU memory
+void rlUnloadTexture(unsigned int id)
+{
+    ReleaseMeshState();
+
+    if (id > 0) glDeleteTextures(1, &id);
+    UntrackVideoMemory(VIDEO_MEMORY_TEXTURE, id);
+}
+
+// Release texture data from GPU memory, texture id and parameters are kept
+// NOTE: Level 0 is replaced by a 1x1 white texel and other mipmap levels are emptied,
+// data can be uploaded again with rlReloadTexture() and texture remains valid meanwhile
+void rlReleaseTextureStorage(unsigned int id, int mipmapCount)
+{
+    if (id == 0) return;
+
+    ReleaseMeshState();
+
+    unsigned char texel[4] = { 255, 255, 255, 255 };
+
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+    glBindTexture(GL_TEXTURE_2D, id);
+
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, 1, 1, 0, GL_RGBA, GL_UNSIGNED_BYTE, texel);
+    for (int i = 1; i < mipmapCount; i++) glTexImage2D(GL_TEXTURE_2D, i, GL_RGBA, 0, 0, 0, GL_RGBA, GL_UNSIGNED_BYTE, NULL);
+
+    glBindTexture(GL_TEXTURE_2D, 0);
+
+    TrackVideoMemory(VIDEO_MEMORY_TEXTURE, id, sizeof(texel));
+}
+
+// Reload texture data into an existing texture id, all mipmap levels are specified again
+// NOTE: Texture parameters (filter, wrap, swizzle) are kept, they belong to texture object
+bool rlReloadTexture(unsigned int id, void *data, int width, int height, int format, int mipmapCount)
+{
+    unsigned int glInternalFormat, glFormat, glType;
+    rlGetGlTextureFormats(format, &glInternalFormat, &glFormat, &glType);
+
+    if ((id == 0) || (data == NULL) || (glInternalFormat == -1)) return false;
+#if defined(GRAPHICS_API_OPENGL_11)
+    if (format >= COMPRESSED_DXT1_RGB) return false;
+#endif
+
+    ReleaseMeshState();
+
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+    glBindTexture(GL_TEXTURE_2D, id);
+
+    int mipWidth = width;
+    int mipHeight = height;
+    int mipOffset = 0;          // Mipmap data offset
+
+    for (int i = 0; i < mipmapCount; i++)
+    {
+        unsigned int mipSize = GetPixelDataSize(mipWidth, mipHeight, format);
+
+        if (format < COMPRESSED_DXT1_RGB) glTexImage2D(GL_TEXTURE_2D, i, glInternalFormat, mipWidth, mipHeight, 0, glFormat, glType, (unsigned char *)data + mipOffset);
+    #if !defined(GRAPHICS_API_OPENGL_11)
+        else glCompressedTexImage2D(GL_TEXTURE_2D, i, glInternalFormat, mipWidth, mipHeight, 0, mipSize, (unsigned char *)data + mipOffset);
+    #endif
+
+        mipWidth /= 2;
+        mipHeight /= 2;
+        mipOffset += mipSize;
+
+        // Security check for NPOT textures
+        if (mipWidth < 1) mipWidth = 1;
+        if (mipHeight < 1) mipHeight = 1;
+    }
+
+    glBindTexture(GL_TEXTURE_2D, 0);
+
+    TrackVideoMemory(VIDEO_MEMORY_TEXTURE, id, mipOffset);
+
+    return true;
+}
+
+// Set callback called before a texture is used for drawing (NULL to disable)
+// NOTE: Called from rlEnableTexture() and for every mesh material map, it could reload texture data
+void rlSetTextureUseCallback(rlTextureUseCallback callback)
+{
+    textureUseCallback = callback;
+}
+
+// Load a texture to be used for rendering (fbo with default color and depth attachments)
+// NOTE: If colorFormat or depthBits are no supported, no attachment is done
+RenderTexture2D rlLoadRenderTexture(int width, int height, int format, int depthBits, bool useDepthTexture)
+{
+    ReleaseMeshState();
+
+    RenderTexture2D target = { 0 };
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (useDepthTexture && texDepthSupported) target.depthTexture = true;
+
+    // Create the framebuffer object
+    glGenFramebuffers(1, &target.id);
+    glBindFramebuffer(GL_FRAMEBUFFER, target.id);
+
+    // Create fbo color texture attachment
+    //-----------------------------------------------------------------------------------------------------
+    if ((format != -1) && (format < COMPRESSED_DXT1_RGB))
+    {
+        // WARNING: Some texture formats are not supported for fbo color attachment
+        target.texture.id = rlLoadTexture(NULL, width, height, format, 1);
+        target.texture.width = width;
+        target.texture.height = height;
+        target.texture.format = format;
+        target.texture.mipmaps = 1;
+    }
+    //-----------------------------------------------------------------------------------------------------
+
+    // Create fbo depth renderbuffer/texture
+    //-----------------------------------------------------------------------------------------------------
+    if (depthBits > 0)
+    {
+        target.depth.id = rlLoadTextureDepth(width, height, depthBits, !useDepthTexture);
+        target.depth.width = width;
+        target.depth.height = height;
+        target.depth.format = 19;       //DEPTH_COMPONENT_24BIT?
+        target.depth.mipmaps = 1;
+    }
+    //-----------------------------------------------------------------------------------------------------
+
+    // Attach color texture and depth renderbuffer to FBO
+    //-----------------------------------------------------------------------------------------------------
+    rlRenderTextureAttach(target, target.texture.id, 0);    // COLOR attachment
+    rlRenderTextureAttach(target, target.depth.id, 1);      // DEPTH attachment
+    //-----------------------------------------------------------------------------------------------------
+
+    // Check if fbo is complete with attachments (valid)
+    //-----------------------------------------------------------------------------------------------------
+    if (rlRenderTextureComplete(target)) TraceLog(LOG_INFO, "[FBO ID %i] Framebuffer object created successfully", target.id);
+    //-----------------------------------------------------------------------------------------------------
+
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+#endif
+
+    return target;
+}
+
+// Attach color buffer texture to an fbo (unloads previous attachment)
+// NOTE: Attach type: 0-Color, 1-Depth renderbuffer, 2-Depth texture
+void rlRenderTextureAttach(RenderTexture2D target, unsigned int id, int attachType)
+{
+    ReleaseMeshState();
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    glBindFramebuffer(GL_FRAMEBUFFER, target.id);
+
+    if (attachType == 0) glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, id, 0);
+    else if (attachType == 1)
+    {
+        if (target.depthTexture) glFramebufferTexture2D(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_TEXTURE_2D, id, 0);
+        else glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_RENDERBUFFER, id);
+    }
+
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+#endif
+}
+
+// Verify render texture is complete
+bool rlRenderTextureComplete(RenderTexture target)
+{
+    ReleaseMeshState();
+
+    bool result = false;
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    glBindFramebuffer(GL_FRAMEBUFFER, target.id);
+
+    GLenum status = glCheckFramebufferStatus(GL_FRAMEBUFFER);
+
+    if (status != GL_FRAMEBUFFER_COMPLETE)
+    {
+        switch (status)
+        {
+            case GL_FRAMEBUFFER_UNSUPPORTED: TraceLog(LOG_WARNING, "Framebuffer is unsupported"); break;
+            case GL_FRAMEBUFFER_INCOMPLETE_ATTACHMENT: TraceLog(LOG_WARNING, "Framebuffer has incomplete attachment"); break;
+#if defined(GRAPHICS_API_OPENGL_ES2)
+            case GL_FRAMEBUFFER_INCOMPLETE_DIMENSIONS: TraceLog(LOG_WARNING, "Framebuffer has incomplete dimensions"); break;
+#endif
+            case GL_FRAMEBUFFER_INCOMPLETE_MISSING_ATTACHMENT: TraceLog(LOG_WARNING, "Framebuffer has a missing attachment"); break;
+            default: break;
+        }
+    }
+
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+
+    result = (status == GL_FRAMEBUFFER_COMPLETE);
+#endif
+
+    return result;
+}
+
+// Get a transient render texture from pool, a free one with same size, format and depth is reused
+// NOTE: Render texture must be returned with rlReleasePooledRenderTexture(), its contents are undefined
+RenderTexture2D rlGetPooledRenderTexture(int width, int height, int format, int depthBits, bool useDepthTexture)
+{
+    RenderTexture2D target = { 0 };
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    int emptyIndex = -1;    // First empty pool slot
+    int unusedIndex = -1;   // Least recently used free render texture (replaced if pool has no empty slots)
+
+    for (int i = 0; i < MAX_RENDER_TEXTURE_POOL; i++)
+    {
+        PooledRenderTexture *pooled = &renderTexturePool[i];
+
+        if (pooled->target.id == 0)
+        {
+            if (emptyIndex == -1) emptyIndex = i;
+        }
+        else if (!pooled->inUse)
+        {
+            if ((pooled->width == width) && (pooled->height == height) && (pooled->format == format) &&
+                (pooled->depthBits == depthBits) && (pooled->depthTexture == useDepthTexture))
+            {
+                pooled->inUse = true;
+                pooled->lastFrame = renderTexturePoolFrame;
+                return pooled->target;
+            }
+
+            if ((unusedIndex == -1) || (pooled->lastFrame < renderTexturePool[unusedIndex].lastFrame)) unusedIndex = i;
+        }
+    }
+
+    target = rlLoadRenderTexture(width, height, format, depthBits, useDepthTexture);
+
+    int index = (emptyIndex != -1)? emptyIndex : unusedIndex;
+
+    if (index == -1)
+    {
+        // NOTE: Render texture is not tracked by pool, it is unloaded on release
+        TraceLog(LOG_WARNING, "[FBO ID %i] Render textures pool is full (%i in use), render texture not pooled", target.id, MAX_RENDER_TEXTURE_POOL);
+        return target;
+    }
+
+    if (renderTexturePool[index].target.id != 0) rlDeleteRenderTextures(renderTexturePool[index].target);
+
+    renderTexturePool[index] = (PooledRenderTexture){ target, width, height, format, depthBits, useDepthTexture, true, renderTexturePoolFrame };
+#endif
+
+    return target;
+}
+
+// Return a transient render texture to pool, it can be reused on next rlGetPooledRenderTexture()
+void rlReleasePooledRenderTexture(RenderTexture2D target)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (target.id == 0) return;
+
+    for (int i = 0; i < MAX_RENDER_TEXTURE_POOL; i++)
+    {
+        if (renderTexturePool[i].target.id == target.id)
+        {
+            renderTexturePool[i].inUse = false;
+            renderTexturePool[i].lastFrame = renderTexturePoolFrame;
+            return;
+        }
+    }
+
+    // Render texture was not pooled (pool was full)
+    rlDeleteRenderTextures(target);
+#endif
+}
+
+// Unload pooled render textures not used for RENDER_TEXTURE_POOL_IDLE_FRAMES frames
+// NOTE: Targets for previous resolutions are freed after a resolution change
+void rlUpdateRenderTexturePool(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    renderTexturePoolFrame++;
+
+    for (int i = 0; i < MAX_RENDER_TEXTURE_POOL; i++)
+    {
+        PooledRenderTexture *pooled = &renderTexturePool[i];
+
+        if ((pooled->target.id != 0) && !pooled->inUse && ((renderTexturePoolFrame - pooled->lastFrame) > RENDER_TEXTURE_POOL_IDLE_FRAMES))
+        {
+            rlDeleteRenderTextures(pooled->target);
+            *pooled = (PooledRenderTexture){ 0 };
+        }
+    }
+#endif
+}
+
+// Generate mipmap data for selected texture
+void rlGenerateMipmaps(Texture2D *texture)
+{
+    ReleaseMeshState();
+
+    glBindTexture(GL_TEXTURE_2D, texture->id);
+
+    // Check if texture is power-of-two (POT)
+    bool texIsPOT = false;
+
+    if (((texture->width > 0) && ((texture->width & (texture->width - 1)) == 0)) &&
+        ((texture->height > 0) && ((texture->height & (texture->height - 1)) == 0))) texIsPOT = true;
+
+#if defined(GRAPHICS_API_OPENGL_11)
+    unsigned int glInternalFormat, glFormat, glType;
+    rlGetGlTextureFormats(texture->format, &glInternalFormat, &glFormat, &glType);
+
+    if (texIsPOT && autoMipmapSupported && (glInternalFormat != -1) && (texture->format < COMPRESSED_DXT1_RGB))
+    {
+        // Retrieve texture data from VRAM
+        void *data = rlReadTexturePixels(*texture);
+
+        // NOTE: Mipmaps are generated by driver when base level is updated
+        glBindTexture(GL_TEXTURE_2D, texture->id);
+        glTexParameteri(GL_TEXTURE_2D, GL_GENERATE_MIPMAP, GL_TRUE);
+        glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+        glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, texture->width, texture->height, glFormat, glType, data);
+        glTexParameteri(GL_TEXTURE_2D, GL_GENERATE_MIPMAP, GL_FALSE);
+
+        RL_FREE(data);
+
+        texture->mipmaps = 1 + (int)floor(log((texture->width > texture->height)? texture->width : texture->height)/log(2));
+        TraceLog(LOG_INFO, "[TEX ID %i] Mipmaps generated automatically", texture->id);
+    }
+    else if (texIsPOT)
+    {
+        // WARNING: Manual mipmap generation only works for RGBA 32bit textures!
+        if (texture->format == UNCOMPRESSED_R8G8B8A8)
+        {
+            // Retrieve texture data from VRAM
+            unsigned char *data = (unsigned char *)rlReadTexturePixels(*texture);
+
+            // NOTE: data size is reallocated to fit mipmaps data
+            // NOTE: CPU mipmap generation only supports RGBA 32bit data
+            int mipmapCount = GenerateMipmaps(&data, texture->width, texture->height);
+
+            int offset = texture->width*texture->height*4;
+
+            int mipWidth = texture->width;
+            int mipHeight = texture->height;
+
+            // Load the mipmaps
+            glBindTexture(GL_TEXTURE_2D, texture->id);
+            glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+
+            for (int level = 1; level < mipmapCount; level++)
+            {
+                mipWidth = (mipWidth > 1)? mipWidth/2 : 1;
+                mipHeight = (mipHeight > 1)? mipHeight/2 : 1;
+
+                glTexImage2D(GL_TEXTURE_2D, level, GL_RGBA8, mipWidth, mipHeight, 0, GL_RGBA, GL_UNSIGNED_BYTE, data + offset);
+
+                offset += mipWidth*mipHeight*4;
+            }
+
+            texture->mipmaps = mipmapCount;
+            RL_FREE(data); // Once mipmaps have been generated and data has been uploaded to GPU VRAM, we can discard RAM data
+
+            TraceLog(LOG_WARNING, "[TEX ID %i] Mipmaps [%i] generated manually on CPU side", texture->id, texture->mipmaps);
+        }
+        else TraceLog(LOG_WARNING, "[TEX ID %i] Mipmaps could not be generated for texture format", texture->id);
+    }
+
+    if (texture->mipmaps > 1)
+    {
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);   // Activate Trilinear filtering for mipmaps
+    }
+#elif defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if ((texIsPOT) || (texNPOTSupported))
+    {
+        //glHint(GL_GENERATE_MIPMAP_HINT, GL_DONT_CARE);   // Hint for mipmaps generation algorythm: GL_FASTEST, GL_NICEST, GL_DONT_CARE
+        glGenerateMipmap(GL_TEXTURE_2D);    // Generate mipmaps automatically
+        TraceLog(LOG_INFO, "[TEX ID %i] Mipmaps generated automatically", texture->id);
+
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);   // Activate Trilinear filtering for mipmaps
+
+        #define MIN(a,b) (((a)<(b))?(a):(b))
+        #define MAX(a,b) (((a)>(b))?(a):(b))
+
+        texture->mipmaps =  1 + (int)floor(log(MAX(texture->width, texture->height))/log(2));
+    }
+#endif
+    else TraceLog(LOG_WARNING, "[TEX ID %i] Mipmaps can not be generated", texture->id);
+
+    glBindTexture(GL_TEXTURE_2D, 0);
+}
+
+// Generate next mipmap level data on CPU (box filter)
+// NOTE: Only 8 bit per channel data supported, dstData size must be max(srcWidth/2, 1)*max(srcHeight/2, 1)*channels,
+// plain byte loops without per-pixel branches or format conversions, so compiler can vectorize them
+void rlGenNextMipmap(const unsigned char *srcData, int srcWidth, int srcHeight, int channels, unsigned char *dstData)
+{
+    int width = (srcWidth > 1)? srcWidth/2 : 1;
+    int height = (srcHeight > 1)? srcHeight/2 : 1;
+    int srcLineSize = srcWidth*channels;
+    int lineSize = width*channels;
+
+    for (int y = 0; y < height; y++)
+    {
+        const unsigned char *row0 = srcData + 2*y*srcLineSize;
+        const unsigned char *row1 = (srcHeight > 1)? (row0 + srcLineSize) : row0;
+        unsigned char *dst = dstData + y*lineSize;
+
+        if (srcWidth > 1)
+        {
+            for (int x = 0; x < width; x++)
+            {
+                const unsigned char *p0 = row0 + 2*x*channels;
+                const unsigned char *p1 = row1 + 2*x*channels;
+
+                for (int c = 0; c < channels; c++) dst[x*channels + c] = (unsigned char)((p0[c] + p0[c + channels] + p1[c] + p1[c + channels] + 2) >> 2);
+            }
+        }
+        else
+        {
+            for (int c = 0; c < channels; c++) dst[c] = (unsigned char)((row0[c] + row1[c] + 1) >> 1);
+        }
+    }
+}
+
+// Upload vertex data into a VAO (if supported) and VBO
+void rlLoadMesh(Mesh *mesh, bool dynamic)
+{
+    ReleaseMeshState();
+
+    if (mesh->vaoId > 0)
+    {
+        // Check if mesh has already been loaded in GPU
+        TraceLog(LOG_WARNING, "Trying to re-load an already loaded mesh");
+        return;
+    }
+
+    mesh->vaoId = 0;        // Vertex Array Object
+    mesh->stream = NULL;    // Dynamic mesh buffers copies state
+    mesh->vboId[0] = 0;     // Vertex positions VBO
+    mesh->vboId[1] = 0;     // Vertex texcoords VBO
+    mesh->vboId[2] = 0;     // Vertex normals VBO
+    mesh->vboId[3] = 0;     // Vertex colors VBO
+    mesh->vboId[4] = 0;     // Vertex tangents VBO
+    mesh->vboId[5] = 0;     // Vertex texcoords2 VBO
+    mesh->vboId[6] = 0;     // Vertex indices VBO
+    mesh->vboId[7] = 0;     // Vertex bone ids VBO
+    mesh->vboId[8] = 0;     // Vertex bone weights VBO
+
+#if defined(GRAPHICS_API_OPENGL_11)
+    mesh->vertexFormat = MESH_FORMAT_DEFAULT;   // Vertex arrays draw CPU data (floats)
+#endif
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    int drawHint = GL_STATIC_DRAW;
+    if (dynamic) drawHint = GL_DYNAMIC_DRAW;
+
+    // Compact vertex attributes storage formats, only for static meshes (dynamic meshes buffers get floats uploaded)
+    // NOTE: Skinned meshes keep float positions and normals, CPU skinning uploads floats (UpdateModelAnimation())
+    int vertexFormat = mesh->vertexFormat;
+    if (dynamic) vertexFormat = MESH_FORMAT_DEFAULT;
+    if (!halfFloatAttribSupported || (mesh->boneIds != NULL)) vertexFormat &= ~MESH_FORMAT_POSITION_HALF;
+    if (!packedAttribSupported || (mesh->boneIds != NULL) || (mesh->normals == NULL)) vertexFormat &= ~MESH_FORMAT_NORMAL_PACKED;
+
+    if (vertexFormat & MESH_FORMAT_TEXCOORD_SNORM16)
+    {
+        // Signed normalized texcoords only store [-1..1] range
+        bool inRange = true;
+        for (int i = 0; (i < mesh->vertexCount*2) && inRange; i++)
+        {
+            if ((mesh->texcoords != NULL) && ((mesh->texcoords[i] < -1.0f) || (mesh->texcoords[i] > 1.0f))) inRange = false;
+            if ((mesh->texcoords2 != NULL) && ((mesh->texcoords2[i] < -1.0f) || (mesh->texcoords2[i] > 1.0f))) inRange = false;
+        }
+
+        if (!inRange)
+        {
+            TraceLog(LOG_WARNING, "Mesh texcoords out of [-1..1] range, stored as floats");
+            vertexFormat &= ~MESH_FORMAT_TEXCOORD_SNORM16;
+        }
+    }
+
+    mesh->vertexFormat = vertexFormat;
+
+    // Dynamic meshes buffers store several copies of vertex data, updates are written
+    // to a copy GPU is not reading, avoiding implicit synchronization (stalls)
+    // NOTE: Meshes uploaded on a loader context keep one copy, frame fences belong to render thread
+    int copies = 1;
+#if defined(GRAPHICS_API_OPENGL_33)
+    if (dynamic && mapBufferRangeSupported && (MAX_MESH_BUFFERING > 1) && !loaderThread) copies = MAX_MESH_BUFFERING;
+#endif
+
+    // NOTE: Vertex arrays are not shared between contexts, meshes uploaded on a loader context
+    // only get their buffers, vertex array is loaded on render thread (rlLoadMeshVertexArray())
+    if (vaoSupported && !loaderThread)
+    {
+        // Initialize Quads VAO (Buffer A)
+        glGenVertexArrays(1, &mesh->vaoId);
+        glBindVertexArray(mesh->vaoId);
+    }
+
+    // NOTE: Attributes must be uploaded considering default locations points
+
+    // Vertex positions buffer (shader-location = 0)
+    glGenBuffers(1, &mesh->vboId[0]);
+    glBindBuffer(GL_ARRAY_BUFFER, mesh->vboId[0]);
+    LoadMeshVertexBuffer(*mesh, 0, copies, drawHint);
+
+    // Vertex texcoords buffer (shader-location = 1)
+    glGenBuffers(1, &mesh->vboId[1]);
+    glBindBuffer(GL_ARRAY_BUFFER, mesh->vboId[1]);
+    LoadMeshVertexBuffer(*mesh, 1, copies, drawHint);
+
+    // Vertex normals buffer (shader-location = 2)
+    if (mesh->normals != NULL)
+    {
+        glGenBuffers(1, &mesh->vboId[2]);
+        glBindBuffer(GL_ARRAY_BUFFER, mesh->vboId[2]);
+        LoadMeshVertexBuffer(*mesh, 2, copies, drawHint);
+    }
+
+    // Vertex colors buffer (shader-location = 3)
+    if (mesh->colors != NULL)
+    {
+        glGenBuffers(1, &mesh->vboId[3]);
+        glBindBuffer(GL_ARRAY_BUFFER, mesh->vboId[3]);
+        LoadMeshBuffer(mesh->vboId[3], GL_ARRAY_BUFFER, sizeof(unsigned char)*4*mesh->vertexCount, mesh->colors, copies, drawHint);
+    }
+
+    // Vertex tangents buffer (shader-location = 4)
+    if (mesh->tangents != NULL)
+    {
+        glGenBuffers(1, &mesh->vboId[4]);
+        glBindBuffer(GL_ARRAY_BUFFER, mesh->vboId[4]);
+        LoadMeshVertexBuffer(*mesh, 4, copies, drawHint);
+    }
+
+    // Vertex texcoords2 buffer (shader-location = 5)
+    if (mesh->texcoords2 != NULL)
+    {
+        glGenBuffers(1, &mesh->vboId[5]);
+        glBindBuffer(GL_ARRAY_BUFFER, mesh->vboId[5]);
+        LoadMeshVertexBuffer(*mesh, 5, copies, drawHint);
+    }
+
+#if defined(SUPPORT_GPU_SKINNING)
+    // Vertex bone ids and weights buffers (shader-location = 6, 7)
+    // NOTE: Bone ids are uploaded as unsigned bytes (converted to float by GPU), GPU skinning requires up to MAX_SHADER_BONES (< 256)
+    if ((mesh->boneIds != NULL) && (mesh->boneWeights != NULL))
+    {
+        unsigned char *boneIds = (unsigned char *)RL_MALLOC(mesh->vertexCount*4);
+        for (int i = 0; i < mesh->vertexCount*4; i++) boneIds[i] = (unsigned char)((mesh->boneIds[i] < 255)? mesh->boneIds[i] : 255);
+
+        glGenBuffers(1, &mesh->vboId[7]);
+        glBindBuffer(GL_ARRAY_BUFFER, mesh->vboId[7]);
+        LoadMeshBuffer(mesh->vboId[7], GL_ARRAY_BUFFER, sizeof(unsigned char)*4*mesh->vertexCount, boneIds, copies, GL_STATIC_DRAW);
+
+        RL_FREE(boneIds);
+
+        glGenBuffers(1, &mesh->vboId[8]);
+        glBindBuffer(GL_ARRAY_BUFFER, mesh->vboId[8]);
+        LoadMeshBuffer(mesh->vboId[8], GL_ARRAY_BUFFER, sizeof(float)*4*mesh->vertexCount, mesh->boneWeights, copies, GL_STATIC_DRAW);
+    }
+#endif
+
+    if (mesh->indices != NULL)
+    {
+        // NOTE: Element array binding is vertex array state, without vertex array bound (loader context)
+        // indices are uploaded through array buffer target, buffers data is not tied to a target
+        unsigned int indexTarget = loaderThread? GL_ARRAY_BUFFER : GL_ELEMENT_ARRAY_BUFFER;
+
+        glGenBuffers(1, &mesh->vboId[6]);
+        glBindBuffer(indexTarget, mesh->vboId[6]);
+        LoadMeshBuffer(mesh->vboId[6], indexTarget, sizeof(unsigned short)*mesh->triangleCount*3, mesh->indices, copies, drawHint);
+    }
+
+    if (!loaderThread) SetMeshVertexArray(*mesh);
+
+#if defined(GRAPHICS_API_OPENGL_33)
+    if (copies > 1)
+    {
+        MeshStream *stream = (MeshStream *)RL_CALLOC(1, sizeof(MeshStream));
+        stream->vertexCapacity = mesh->vertexCount;
+        stream->triangleCapacity = mesh->triangleCount;
+        mesh->stream = stream;
+        meshStreamCount++;
+    }
+#endif
+
+    if (vaoSupported && !loaderThread)
+    {
+        if (mesh->vaoId > 0) TraceLog(LOG_INFO, "[VAO ID %i] Mesh uploaded successfully to VRAM (GPU)", mesh->vaoId);
+        else TraceLog(LOG_WARNING, "Mesh could not be uploaded to VRAM (GPU)");
+    }
+    else
+    {
+        TraceLog(LOG_INFO, "[VBOs] Mesh uploaded successfully to VRAM (GPU)");
+    }
+#endif
+}
+
+// Load vertex array (VAO) of mesh uploaded on a loader context
+// NOTE: Vertex arrays are not shared between contexts, it must be called on render thread before mesh drawing
+void rlLoadMeshVertexArray(Mesh *mesh)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if ((mesh->vaoId > 0) || (mesh->vboId[0] == 0)) return;
+
+    if (loaderThread)
+    {
+        TraceLog(LOG_WARNING, "Mesh vertex array can not be loaded on loader context");
+        return;
+    }
+
+    ReleaseMeshState();
+
+    if (vaoSupported)
+    {
+        glGenVertexArrays(1, &mesh->vaoId);
+        glBindVertexArray(mesh->vaoId);
+    }
+
+    // NOTE: Without vertex arrays support attributes are set again on drawing, default values are set here
+    SetMeshVertexArray(*mesh);
+
+    if (mesh->vaoId > 0) TraceLog(LOG_INFO, "[VAO ID %i] Mesh vertex array loaded successfully", mesh->vaoId);
+#endif
+}
+
+// Load a new attributes buffer
+unsigned int rlLoadAttribBuffer(unsigned int vaoId, int shaderLoc, void *buffer, int size, bool dynamic)
+{
+    ReleaseMeshState();
+
+    unsigned int id = 0;
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    int drawHint = GL_STATIC_DRAW;
+    if (dynamic) drawHint = GL_DYNAMIC_DRAW;
+
+    if (vaoSupported) glBindVertexArray(vaoId);
+
+    glGenBuffers(1, &id);
+    glBindBuffer(GL_ARRAY_BUFFER, id);
+    glBufferData(GL_ARRAY_BUFFER, size, buffer, drawHint);
+    TrackVideoMemory(VIDEO_MEMORY_BUFFER, id, size);
+    SetVertexAttrib(shaderLoc, id, 2, GL_FLOAT, false, 0, 0);
+
+    if (vaoSupported) glBindVertexArray(0);
+#endif
+
+    return id;
+}
+
+// Update vertex or index data on GPU (upload new data to one buffer)
+void rlUpdateMesh(Mesh mesh, int buffer, int num)
+{
+    rlUpdateMeshAt(mesh, buffer, num, 0);
+}
+
+// Update vertex or index data on GPU, at index
+// WARNING: error checking is in place that will cause the data to not be
+//          updated if offset + size exceeds what the buffer can hold
+void rlUpdateMeshAt(Mesh mesh, int buffer, int num, int index)
+{
+    ReleaseMeshState();
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    // Activate mesh VAO
+    if (vaoSupported) glBindVertexArray(mesh.vaoId);
+
+    // Dynamic meshes buffers copies keep their size, data is written to next copy
+    // NOTE: Compact storage formats buffers keep their size too, data is packed on upload
+    if ((mesh.stream != NULL) || (mesh.vertexFormat != MESH_FORMAT_DEFAULT))
+    {
+        UpdateMeshBuffer(mesh, buffer, index, num);
+
+        if (vaoSupported) glBindVertexArray(0);
+        return;
+    }
+
+    switch (buffer)
+    {
+        case 0:     // Update vertices (vertex position)
+        {
+            glBindBuffer(GL_ARRAY_BUFFER, mesh.vboId[0]);
+            if (index == 0 && num >= mesh.vertexCount) glBufferData(GL_ARRAY_BUFFER, sizeof(float)*3*num, mesh.vertices, GL_DYNAMIC_DRAW);
+            else if (index + num >= mesh.vertexCount) break;
+            else glBufferSubData(GL_ARRAY_BUFFER, sizeof(float)*3*index, sizeof(float)*3*num, mesh.vertices);
+
+        } break;
+        case 1:     // Update texcoords (vertex texture coordinates)
+        {
+            glBindBuffer(GL_ARRAY_BUFFER, mesh.vboId[1]);
+            if (index == 0 && num >= mesh.vertexCount) glBufferData(GL_ARRAY_BUFFER, sizeof(float)*2*num, mesh.texcoords, GL_DYNAMIC_DRAW);
+            else if (index + num >= mesh.vertexCount) break;
+            else glBufferSubData(GL_ARRAY_BUFFER, sizeof(float)*2*index, sizeof(float)*2*num, mesh.texcoords);
+
+        } break;
+        case 2:     // Update normals (vertex normals)
+        {
+            glBindBuffer(GL_ARRAY_BUFFER, mesh.vboId[2]);
+            if (index == 0 && num >= mesh.vertexCount) glBufferData(GL_ARRAY_BUFFER, sizeof(float)*3*num, mesh.normals, GL_DYNAMIC_DRAW);
+            else if (index + num >= mesh.vertexCount) break;
+            else glBufferSubData(GL_ARRAY_BUFFER, sizeof(float)*3*index, sizeof(float)*3*num, mesh.normals);
+
+        } break;
+        case 3:     // Update colors (vertex colors)
+        {
+            glBindBuffer(GL_ARRAY_BUFFER, mesh.vboId[3]);
+            if (index == 0 && num >= mesh.vertexCount) glBufferData(GL_ARRAY_BUFFER, sizeof(float)*4*num, mesh.colors, GL_DYNAMIC_DRAW);
+            else if (index + num >= mesh.vertexCount) break;
+            else glBufferSubData(GL_ARRAY_BUFFER, sizeof(unsigned char)*4*index, sizeof(unsigned char)*4*num, mesh.colors);
+
+        } break;
+        case 4:     // Update tangents (vertex tangents)
+        {
+            glBindBuffer(GL_ARRAY_BUFFER, mesh.vboId[4]);
+            if (index == 0 && num >= mesh.vertexCount) glBufferData(GL_ARRAY_BUFFER, sizeof(float)*4*num, mesh.tangents, GL_DYNAMIC_DRAW);
+            else if (index + num >= mesh.vertexCount) break;
+            else glBufferSubData(GL_ARRAY_BUFFER, sizeof(float)*4*index, sizeof(float)*4*num, mesh.tangents);
+        } break;
+        case 5:     // Update texcoords2 (vertex second texture coordinates)
+        {
+            glBindBuffer(GL_ARRAY_BUFFER, mesh.vboId[5]);
+            if (index == 0 && num >= mesh.vertexCount) glBufferData(GL_ARRAY_BUFFER, sizeof(float)*2*num, mesh.texcoords2, GL_DYNAMIC_DRAW);
+            else if (index + num >= mesh.vertexCount) break;
+            else glBufferSubData(GL_ARRAY_BUFFER, sizeof(float)*2*index, sizeof(float)*2*num, mesh.texcoords2);
+        } break;
+        case 6:     // Update indices (triangle index buffer)
+        {
+            // the * 3 is because each triangle has 3 indices
+            unsigned short *indices = mesh.indices;
+            glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, mesh.vboId[6]);
+            if (index == 0 && num >= mesh.triangleCount)
+                glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(*indices)*num*3, indices, GL_DYNAMIC_DRAW);
+            else if (index + num >= mesh.triangleCount)
+                break;
+            else
+                glBufferSubData(GL_ELEMENT_ARRAY_BUFFER, sizeof(*indices)*index*3, sizeof(*indices)*num*3, indices);
+        } break;
+        default: break;
+    }
+
+    // Unbind the current VAO
+    if (vaoSupported) glBindVertexArray(0);
+
+    // Another option would be using buffer mapping...
+    //mesh.vertices = glMapBuffer(GL_ARRAY_BUFFER, GL_READ_WRITE);
+    // Now we can modify vertices
+    //glUnmapBuffer(GL_ARRAY_BUFFER);
+#endif
+}
+
+// Update all vertex attributes data on GPU (positions, texcoords, normals, colors, tangents, texcoords2) for vertices range
+// NOTE: Data is read from mesh arrays at index, dynamic meshes (rlLoadMesh() dynamic) write it to a buffers copy
+// GPU is not reading, so thousands of meshes can be updated every frame without implicit synchronization
+void rlUpdateMeshRange(Mesh mesh, int index, int count)
+{
+    ReleaseMeshState();
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (vaoSupported) glBindVertexArray(mesh.vaoId);
+
+    for (int buffer = 0; buffer < 6; buffer++) UpdateMeshBuffer(mesh, buffer, index, count);
+
+    if (vaoSupported) glBindVertexArray(0);
+#endif
+}
+
+// Draw a 3d mesh with material and transform
+void rlDrawMesh(Mesh mesh, Material material, Matrix transform)
+{
+#if defined(GRAPHICS_API_OPENGL_11)
+    if (textureUseCallback != NULL) textureUseCallback(material.maps[MAP_DIFFUSE].texture.id);
+
+    glEnable(GL_TEXTURE_2D);
+    glBindTexture(GL_TEXTURE_2D, material.maps[MAP_DIFFUSE].texture.id);
+
+    // NOTE: On OpenGL 1.1 we use Vertex Arrays to draw model
+    glEnableClientState(GL_VERTEX_ARRAY);                   // Enable vertex array
+    glEnableClientState(GL_TEXTURE_COORD_ARRAY);            // Enable texture coords array
+    if (mesh.normals != NULL) glEnableClientState(GL_NORMAL_ARRAY);     // Enable normals array
+    if (mesh.colors != NULL) glEnableClientState(GL_COLOR_ARRAY);       // Enable colors array
+
+    glVertexPointer(3, GL_FLOAT, 0, mesh.vertices);         // Pointer to vertex coords array
+    glTexCoordPointer(2, GL_FLOAT, 0, mesh.texcoords);      // Pointer to texture coords array
+    if (mesh.normals != NULL) glNormalPointer(GL_FLOAT, 0, mesh.normals);           // Pointer to normals array
+    if (mesh.colors != NULL) glColorPointer(4, GL_UNSIGNED_BYTE, 0, mesh.colors);   // Pointer to colors array
+
+    rlPushMatrix();
+        rlMultMatrixf(MatrixToFloat(transform));
+        rlColor4ub(material.maps[MAP_DIFFUSE].color.r, material.maps[MAP_DIFFUSE].color.g, material.maps[MAP_DIFFUSE].color.b, material.maps[MAP_DIFFUSE].color.a);
+
+        if (mesh.indices != NULL) glDrawElements(GL_TRIANGLES, mesh.triangleCount*3, GL_UNSIGNED_SHORT, mesh.indices);
+        else glDrawArrays(GL_TRIANGLES, 0, mesh.vertexCount);
+    rlPopMatrix();
+
+    renderStats.drawCalls++;
+    renderStats.vertexCount += mesh.vertexCount;
+
+    glDisableClientState(GL_VERTEX_ARRAY);                  // Disable vertex array
+    glDisableClientState(GL_TEXTURE_COORD_ARRAY);           // Disable texture coords array
+    if (mesh.normals != NULL) glDisableClientState(GL_NORMAL_ARRAY);    // Disable normals array
+    if (mesh.colors != NULL) glDisableClientState(GL_NORMAL_ARRAY);     // Disable colors array
+
+    glDisable(GL_TEXTURE_2D);
+    glBindTexture(GL_TEXTURE_2D, 0);
+#endif
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+#if defined(SUPPORT_GPU_SKINNING)
+    // GPU skinned mesh drawn with default shader uses default skinning shader
+    if ((mesh.boneCount > 0) && (material.shader.id == defaultShader.id) && (defaultSkinShader.id > 0)) material.shader = defaultSkinShader;
+#endif
+#if defined(SUPPORT_FRAME_CAPTURE)
+    if (captureFile != NULL) WriteCaptureMeshDraw(mesh, material, transform, NULL, 0);
+#endif
+
+    // Bind shader program, material values, texture maps and mesh vertex buffers
+    EnableMeshMaterial(mesh, material);
+
+    // Calculate and send to shader model matrix (used by PBR shader)
+    if (material.shader.locs[LOC_MATRIX_MODEL] != -1) glUniformMatrix4fv(material.shader.locs[LOC_MATRIX_MODEL], 1, false, MatrixToFloat(transform));
+
+    // At this point the modelview matrix just contains the view matrix (camera)
+    // That's because BeginMode3D() sets it an no model-drawing function modifies it, all use rlPushMatrix() and rlPopMatrix()
+    Matrix matView = modelview;         // View matrix (camera)
+    Matrix matProjection = projection;  // Projection matrix (perspective)
+
+    // TODO: Consider possible transform matrices in the stack
+    // Is this the right order? or should we start with the first stored matrix instead of the last one?
+    //Matrix matStackTransform = MatrixIdentity();
+    //for (int i = stackCounter; i > 0; i--) matStackTransform = MatrixMultiply(stack[i], matStackTransform);
+
+    // Transform to camera-space coordinates
+    Matrix matModelView = MatrixMultiply(transform, MatrixMultiply(transformMatrix, matView));
+
+    int eyesCount = 1;
+#if defined(SUPPORT_VR_SIMULATOR)
+    if (vrStereoRender) eyesCount = 2;
+#endif
+
+    for (int eye = 0; eye < eyesCount; eye++)
+    {
+        if (eyesCount == 1) modelview = matModelView;
+        #if defined(SUPPORT_VR_SIMULATOR)
+        else SetStereoView(eye, matProjection, matModelView);
+        #endif
+
+        // Calculate model-view-projection matrix (MVP)
+        Matrix matMVP = MatrixMultiply(modelview, projection);        // Transform to screen-space coordinates
+
+        // Send combined model-view-projection matrix to shader
+        glUniformMatrix4fv(material.shader.locs[LOC_MATRIX_MVP], 1, false, MatrixToFloat(matMVP));
+
+        // Draw call!
+        DrawMeshBuffers(mesh, 0);
+
+        renderStats.drawCalls++;
+        renderStats.vertexCount += mesh.vertexCount;
+    }
+
+    // NOTE: Texture maps, mesh vertex buffers and shader program are kept bound for next mesh draw,
+    // they are unbound by ReleaseMeshState() when any other rlgl function requires it
+
+    // Restore projection/modelview matrices
+    // NOTE: In stereo rendering matrices are being modified to fit every eye
+    projection = matProjection;
+    modelview = matView;
+#endif
+}
+
+// Draw multiple instances of a 3d mesh with material and a transform per instance
+// NOTE: Instances transforms are sent to shader as a per-instance mat4 attribute (LOC_VERTEX_INSTANCE_TX),
+// shader must compute: mvp*instanceTransform*vec4(vertexPosition, 1.0), LOC_MATRIX_MODEL is not updated per instance.
+// If instancing is not supported or shader does not provide the attribute, mesh is drawn once per transform
+void rlDrawMeshInstanced(Mesh mesh, Material material, const Matrix *transforms, int instances)
+{
+    if ((transforms == NULL) || (instances <= 0)) return;
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    int instanceLoc = material.shader.locs[LOC_VERTEX_INSTANCE_TX];
+
+    if (instancingSupported && (instanceLoc != -1))
+    {
+#if defined(SUPPORT_FRAME_CAPTURE)
+        if (captureFile != NULL) WriteCaptureMeshDraw(mesh, material, MatrixIdentity(), transforms, instances);
+#endif
+        // Upload instances transforms to per-instance buffer (column-major, 16 floats per instance)
+        if (instanceVboId == 0) glGenBuffers(1, &instanceVboId);
+
+        float *instanceData = (float *)RL_MALLOC(instances*16*sizeof(float));
+        for (int i = 0; i < instances; i++) memcpy(instanceData + i*16, MatrixToFloat(transforms[i]), 16*sizeof(float));
+
+        glBindBuffer(GL_ARRAY_BUFFER, instanceVboId);
+
+        // NOTE: Buffer is orphaned when it needs to grow, avoiding implicit sync with previous draws
+        if (instances > instanceBufferCapacity)
+        {
+            glBufferData(GL_ARRAY_BUFFER, instances*16*sizeof(float), instanceData, GL_STREAM_DRAW);
+            instanceBufferCapacity = instances;
+        }
+        else
+        {
+            glBufferData(GL_ARRAY_BUFFER, instanceBufferCapacity*16*sizeof(float), NULL, GL_STREAM_DRAW);
+            glBufferSubData(GL_ARRAY_BUFFER, 0, instances*16*sizeof(float), instanceData);
+        }
+
+        RL_FREE(instanceData);
+
+        renderStats.uploadedBytes += instances*16*sizeof(float);
+
+        // Bind shader program, material values, texture maps and mesh vertex buffers
+        EnableMeshMaterial(mesh, material);
+
+        // Bind per-instance buffer: mat4 attribute uses 4 consecutive vec4 locations
+        for (int i = 0; i < 4; i++)
+        {
+            SetVertexAttrib(instanceLoc + i, instanceVboId, 4, GL_FLOAT, false, 16*sizeof(float), (void *)(i*4*sizeof(float)));
+            glVertexAttribDivisor(instanceLoc + i, 1);
+        }
+        glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+        Matrix matView = modelview;         // View matrix (camera)
+        Matrix matProjection = projection;  // Projection matrix (perspective)
+
+        // Transform to camera-space coordinates (instance transform is applied in shader)
+        Matrix matModelView = MatrixMultiply(transformMatrix, matView);
+
+        int eyesCount = 1;
+#if defined(SUPPORT_VR_SIMULATOR)
+        if (vrStereoRender) eyesCount = 2;
+#endif
+
+        for (int eye = 0; eye < eyesCount; eye++)
+        {
+            if (eyesCount == 1) modelview = matModelView;
+            #if defined(SUPPORT_VR_SIMULATOR)
+            else SetStereoView(eye, matProjection, matModelView);
+            #endif
+
+            // Calculate model-view-projection matrix (MVP)
+            Matrix matMVP = MatrixMultiply(modelview, projection);        // Transform to screen-space coordinates
+
+            // Send combined model-view-projection matrix to shader
+            glUniformMatrix4fv(material.shader.locs[LOC_MATRIX_MVP], 1, false, MatrixToFloat(matMVP));
+
+            // Draw call! (all instances at once)
+            DrawMeshBuffers(mesh, instances);
+
+            renderStats.drawCalls++;
+            renderStats.vertexCount += mesh.vertexCount*instances;
+        }
+
+        // Reset per-instance attributes
+        // NOTE: When using VAO, attributes state is stored in mesh VAO, it must be left as it was
+        for (int i = 0; i < 4; i++)
+        {
+            glVertexAttribDivisor(instanceLoc + i, 0);
+            DisableVertexAttrib(instanceLoc + i);
+        }
+
+        // NOTE: Texture maps, mesh vertex buffers and shader program are kept bound for next mesh draw
+
+        // Restore projection/modelview matrices
+        projection = matProjection;
+        modelview = matView;
+
+        return;
+    }
+#endif
+
+    // Fallback: draw mesh once per instance transform
+    for (int i = 0; i < instances; i++) rlDrawMesh(mesh, material, transforms[i]);
+}
+
+// Draw billboards quads, centered at positions and facing right/up axis
+// NOTE: When instancing is supported, only one small struct by billboard is uploaded and
+// quads are expanded in vertex shader, otherwise quads are expanded on CPU into render batch
+void rlDrawBillboards(Texture2D texture, const Vector3 *positions, const Vector2 *sizes, const Color *colors, const Rectangle *sources, int count, Vector3 right, Vector3 up)
+{
+    if ((positions == NULL) || (sizes == NULL) || (count <= 0)) return;
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    // NOTE: Retained batches only record vertex data, billboards are expanded into batch
+    bool instanced = instancingSupported && !currentBatch->retained;
+
+    if (instanced && (billboardShader.locs == NULL)) billboardShader = LoadShaderBillboard();
+
+    if (instanced && (billboardShader.id > 0))
+    {
+        // Draw pending batch vertex data first, keeping drawing order
+        rlglDraw();
+
+        if (billboardVboId[0] == 0)
+        {
+            // Quad corners, drawn as triangle strip (counter-clockwise facing camera)
+            const float corners[4*2] = { -0.5f, -0.5f, 0.5f, -0.5f, -0.5f, 0.5f, 0.5f, 0.5f };
+
+            if (vaoSupported) glGenVertexArrays(1, &billboardVaoId);
+            glGenBuffers(2, billboardVboId);
+            glBindBuffer(GL_ARRAY_BUFFER, billboardVboId[0]);
+            glBufferData(GL_ARRAY_BUFFER, sizeof(corners), corners, GL_STATIC_DRAW);
+        }
+
+        // Fill per-instance data, texcoords rectangle normalized by texture size
+        BillboardInstance *instances = (BillboardInstance *)RL_MALLOC(count*sizeof(BillboardInstance));
+
+        for (int i = 0; i < count; i++)
+        {
+            BillboardInstance *instance = &instances[i];
+
+            instance->position[0] = positions[i].x;
+            instance->position[1] = positions[i].y;
+            instance->position[2] = positions[i].z;
+            instance->size[0] = sizes[i].x;
+            instance->size[1] = sizes[i].y;
+
+            if (colors != NULL) memcpy(instance->color, &colors[i], 4);
+            else memset(instance->color, 255, 4);
+
+            if (sources != NULL)
+            {
+                instance->texcoords[0] = sources[i].x/texture.width;
+                instance->texcoords[1] = sources[i].y/texture.height;
+                instance->texcoords[2] = (sources[i].x + sources[i].width)/texture.width;
+                instance->texcoords[3] = (sources[i].y + sources[i].height)/texture.height;
+            }
+            else
+            {
+                instance->texcoords[0] = 0.0f;
+                instance->texcoords[1] = 0.0f;
+                instance->texcoords[2] = 1.0f;
+                instance->texcoords[3] = 1.0f;
+            }
+        }
+
+        glBindBuffer(GL_ARRAY_BUFFER, billboardVboId[1]);
+
+        // NOTE: Buffer is orphaned when it needs to grow, avoiding implicit sync with previous draws
+        if (count > billboardBufferCapacity)
+        {
+            glBufferData(GL_ARRAY_BUFFER, count*sizeof(BillboardInstance), instances, GL_STREAM_DRAW);
+            billboardBufferCapacity = count;
+        }
+        else
+        {
+            glBufferData(GL_ARRAY_BUFFER, billboardBufferCapacity*sizeof(BillboardInstance), NULL, GL_STREAM_DRAW);
+            glBufferSubData(GL_ARRAY_BUFFER, 0, count*sizeof(BillboardInstance), instances);
+        }
+
+        RL_FREE(instances);
+
+        renderStats.uploadedBytes += count*sizeof(BillboardInstance);
+
+        glUseProgram(billboardShader.id);
+
+        glActiveTexture(GL_TEXTURE0);
+        glBindTexture(GL_TEXTURE_2D, texture.id);
+        glUniform1i(billboardShader.locs[LOC_MAP_DIFFUSE], 0);
+
+        glUniform3f(billboardLocs[0], right.x, right.y, right.z);
+        glUniform3f(billboardLocs[1], up.x, up.y, up.z);
+
+        // Bind quad corners (per-vertex) and billboards data (per-instance)
+        if (vaoSupported) glBindVertexArray(billboardVaoId);
+
+        SetVertexAttrib(billboardShader.locs[LOC_VERTEX_POSITION], billboardVboId[0], 2, GL_FLOAT, false, 0, 0);
+        SetVertexAttrib(billboardLocs[2], billboardVboId[1], 3, GL_FLOAT, false, sizeof(BillboardInstance), (void *)offsetof(BillboardInstance, position));
+        SetVertexAttrib(billboardLocs[3], billboardVboId[1], 2, GL_FLOAT, false, sizeof(BillboardInstance), (void *)offsetof(BillboardInstance, size));
+        SetVertexAttrib(billboardLocs[4], billboardVboId[1], 4, GL_UNSIGNED_BYTE, true, sizeof(BillboardInstance), (void *)offsetof(BillboardInstance, color));
+        SetVertexAttrib(billboardLocs[5], billboardVboId[1], 4, GL_FLOAT, false, sizeof(BillboardInstance), (void *)offsetof(BillboardInstance, texcoords));
+
+        for (int i = 2; i < 6; i++) glVertexAttribDivisor(billboardLocs[i], 1);
+
+        Matrix matView = modelview;         // View matrix (camera)
+        Matrix matProjection = projection;  // Projection matrix (perspective)
+
+        // Transform to camera-space coordinates (billboards positions are in world-space)
+        Matrix matModelView = MatrixMultiply(transformMatrix, matView);
+
+        int eyesCount = 1;
+#if defined(SUPPORT_VR_SIMULATOR)
+        if (vrStereoRender) eyesCount = 2;
+#endif
+
+        for (int eye = 0; eye < eyesCount; eye++)
+        {
+            if (eyesCount == 1) modelview = matModelView;
+            #if defined(SUPPORT_VR_SIMULATOR)
+            else SetStereoView(eye, matProjection, matModelView);
+            #endif
+
+            // Calculate model-view-projection matrix (MVP)
+            Matrix matMVP = MatrixMultiply(modelview, projection);        // Transform to screen-space coordinates
+
+            glUniformMatrix4fv(billboardShader.locs[LOC_MATRIX_MVP], 1, false, MatrixToFloat(matMVP));
+
+            // Draw call! (all billboards at once)
+            glDrawArraysInstanced(GL_TRIANGLE_STRIP, 0, 4, count);
+
+            renderStats.drawCalls++;
+            renderStats.vertexCount += 4*count;
+        }
+
+        // Reset per-instance attributes, billboards vertex array keeps its own state
+        if (vaoSupported) glBindVertexArray(0);
+        else
+        {
+            for (int i = 2; i < 6; i++)
+            {
+                glVertexAttribDivisor(billboardLocs[i], 0);
+                DisableVertexAttrib(billboardLocs[i]);
+            }
+        }
+
+        glBindBuffer(GL_ARRAY_BUFFER, 0);
+        glBindTexture(GL_TEXTURE_2D, 0);
+        glUseProgram(0);
+
+        // Restore projection/modelview matrices
+        projection = matProjection;
+        modelview = matView;
+
+        return;
+    }
+#endif
+
+    // Fallback: expand billboards quads into render batch
+    for (int i = 0; i < count; i++)
+    {
+        Color color = (colors != NULL)? colors[i] : (Color){ 255, 255, 255, 255 };
+        Rectangle source = (sources != NULL)? sources[i] : (Rectangle){ 0.0f, 0.0f, (float)texture.width, (float)texture.height };
+
+        const float u0 = source.x/texture.width;
+        const float u1 = (source.x + source.width)/texture.width;
+        const float v0 = source.y/texture.height;
+        const float v1 = (source.y + source.height)/texture.height;
+
+        Vector3 r = { right.x*sizes[i].x/2, right.y*sizes[i].x/2, right.z*sizes[i].x/2 };
+        Vector3 u = { up.x*sizes[i].y/2, up.y*sizes[i].y/2, up.z*sizes[i].y/2 };
+        Vector3 c = positions[i];
+
+        if (rlCheckBufferLimit(4)) rlglDraw();
+
+        rlEnableTexture(texture.id);
+
+        rlBegin(RL_QUADS);
+            rlColor4ub(color.r, color.g, color.b, color.a);
+
+            // Top-left, bottom-left, bottom-right and top-right corners
+            rlTexCoord2f(u0, v0);
+            rlVertex3f(c.x - r.x + u.x, c.y - r.y + u.y, c.z - r.z + u.z);
+            rlTexCoord2f(u0, v1);
+            rlVertex3f(c.x - r.x - u.x, c.y - r.y - u.y, c.z - r.z - u.z);
+            rlTexCoord2f(u1, v1);
+            rlVertex3f(c.x + r.x - u.x, c.y + r.y - u.y, c.z + r.z - u.z);
+            rlTexCoord2f(u1, v0);
+            rlVertex3f(c.x + r.x + u.x, c.y + r.y + u.y, c.z + r.z + u.z);
+        rlEnd();
+    }
+
+    rlDisableTexture();
+}
+
+// Queue a 2D rounded box shape (circles, rings, rounded rectangles, thick lines), evaluated on GPU
+// NOTE: Every shape is one instanced quad, its distance field is evaluated by fragment shader with
+// antialiased edges, thickness > 0 draws only the outline (inwards), returns false if not supported
+bool rlDrawShapeSDF(Vector2 center, Vector2 halfSize, float rotation, float radius, float thickness, Color color)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    // NOTE: Retained batches only record vertex data, shapes must be tessellated
+    if (!instancingSupported || currentBatch->retained) return false;
+
+    if (shapeSDFShader.locs == NULL) shapeSDFShader = LoadShaderShapeSDF();
+    if (shapeSDFShader.id == 0) return false;
+
+    if (shapeSDFInstances == NULL) shapeSDFInstances = (ShapeSDFInstance *)RL_MALLOC(MAX_BATCH_SHAPES_SDF*sizeof(ShapeSDFInstance));
+
+    // Draw pending batch vertex data first, keeping drawing order
+    if (currentBatch->vertexBuffer[currentBatch->currentBuffer].vCounter > 0) rlglDraw();
+    if (shapeSDFCount >= MAX_BATCH_SHAPES_SDF) DrawShapesSDF();
+
+    Vector2 axis = { cosf(rotation*DEG2RAD), sinf(rotation*DEG2RAD) };
+    float scale = 1.0f;
+
+    // Shapes are drawn after matrix is popped, transform is applied here (uniform scale expected)
+    if (useTransformMatrix)
+    {
+        Vector3 position = Vector3Transform((Vector3){ center.x, center.y, 0.0f }, transformMatrix);
+        Vector2 transformed = { transformMatrix.m0*axis.x + transformMatrix.m4*axis.y, transformMatrix.m1*axis.x + transformMatrix.m5*axis.y };
+
+        scale = sqrtf(transformed.x*transformed.x + transformed.y*transformed.y);
+        if (scale > 0.0f) axis = (Vector2){ transformed.x/scale, transformed.y/scale };
+        center = (Vector2){ position.x, position.y };
+    }
+
+    ShapeSDFInstance *instance = &shapeSDFInstances[shapeSDFCount];
+
+    instance->position[0] = center.x;
+    instance->position[1] = center.y;
+    instance->position[2] = currentBatch->currentDepth;
+    instance->size[0] = halfSize.x*scale;
+    instance->size[1] = halfSize.y*scale;
+    instance->axis[0] = axis.x;
+    instance->axis[1] = axis.y;
+    instance->params[0] = radius*scale;
+    instance->params[1] = thickness*scale;
+    memcpy(instance->color, &color, 4);
+
+    shapeSDFCount++;
+
+    // NOTE: Same depth increment than rlEnd(), shapes are ordered with 2D vertex data
+    currentBatch->currentDepth += (1.0f/20000.0f);
+
+    return true;
+#else
+    return false;
+#endif
+}
+
+// Unload mesh data from CPU and GPU
+void rlUnloadMesh(Mesh mesh)
+{
+    ReleaseMeshState();
+
+    RL_FREE(mesh.vertices);
+    RL_FREE(mesh.texcoords);
+    RL_FREE(mesh.normals);
+    RL_FREE(mesh.colors);
+    RL_FREE(mesh.tangents);
+    RL_FREE(mesh.texcoords2);
+    RL_FREE(mesh.indices);
+
+    RL_FREE(mesh.animVertices);
+    RL_FREE(mesh.animNormals);
+    RL_FREE(mesh.boneWeights);
+    RL_FREE(mesh.boneIds);
+    RL_FREE(mesh.boneMatrices);
+
+    rlDeleteBuffers(mesh.vboId[0]);   // vertex
+    rlDeleteBuffers(mesh.vboId[1]);   // texcoords
+    rlDeleteBuffers(mesh.vboId[2]);   // normals
+    rlDeleteBuffers(mesh.vboId[3]);   // colors
+    rlDeleteBuffers(mesh.vboId[4]);   // tangents
+    rlDeleteBuffers(mesh.vboId[5]);   // texcoords2
+    rlDeleteBuffers(mesh.vboId[6]);   // indices
+    rlDeleteBuffers(mesh.vboId[7]);   // bone ids
+    rlDeleteBuffers(mesh.vboId[8]);   // bone weights
+
+    rlDeleteVertexArrays(mesh.vaoId);
+
+#if defined(GRAPHICS_API_OPENGL_33)
+    if (mesh.stream != NULL) meshStreamCount--;
+#endif
+    RL_FREE(mesh.stream);
+}
+
+// Check if compute shaders and shader storage buffers are supported (OpenGL 4.3)
+bool rlIsComputeSupported(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33)
+    return computeSupported;
+#else
+    return false;
+#endif
+}
+
+// Load compute shader program from code string
+// NOTE: Uniforms can be set with SetShaderValue() functions using a shader with returned program id
+unsigned int rlLoadComputeShader(const char *csCode)
+{
+    unsigned int program = 0;
+
+#if defined(GRAPHICS_API_OPENGL_33) && !defined(__APPLE__)
+    if (!computeSupported)
+    {
+        TraceLog(LOG_WARNING, "Compute shaders not supported, shader not loaded");
+        return 0;
+    }
+
+    ReleaseMeshState();
+
+    unsigned int shaderId = CompileShader(csCode, GL_COMPUTE_SHADER);
+
+    GLint success = 0;
+    program = glCreateProgram();
+    glAttachShader(program, shaderId);
+    glLinkProgram(program);
+    glDeleteShader(shaderId);
+
+    glGetProgramiv(program, GL_LINK_STATUS, &success);
+
+    if (success == GL_FALSE)
+    {
+        TraceLog(LOG_WARNING, "[SHDR ID %i] Failed to link compute shader program...", program);
+
+        int maxLength = 0;
+        int length;
+
+        glGetProgramiv(program, GL_INFO_LOG_LENGTH, &maxLength);
+
+#if defined(_MSC_VER)
+        char *log = RL_MALLOC(maxLength);
+#else
+        char log[maxLength];
+#endif
+        glGetProgramInfoLog(program, maxLength, &length, log);
+
+        TraceLog(LOG_INFO, "%s", log);
+
+#if defined(_MSC_VER)
+        RL_FREE(log);
+#endif
+        glDeleteProgram(program);
+
+        program = 0;
+    }
+    else TraceLog(LOG_INFO, "[SHDR ID %i] Compute shader program loaded successfully", program);
+#endif
+
+    return program;
+}
+
+// Unload compute shader program
+void rlUnloadComputeShader(unsigned int id)
+{
+    if (id == 0) return;
+
+    rlDeleteShader(id);
+    TraceLog(LOG_INFO, "[SHDR ID %i] Unloaded compute shader program data", id);
+}
+
+// Dispatch compute shader program work groups
+// NOTE: Results written to buffers or images require rlMemoryBarrier() before being used
+void rlDispatchCompute(unsigned int id, unsigned int groupsX, unsigned int groupsY, unsigned int groupsZ)
+{
+#if defined(GRAPHICS_API_OPENGL_33) && !defined(__APPLE__)
+    if (!computeSupported || (id == 0)) return;
+
+    // NOTE: Batched vertex data is drawn first, it could use buffers or textures written by compute shader
+    if (!loaderThread) rlglDraw();
+    ReleaseMeshState();
+
+    glUseProgram(id);
+    glDispatchCompute(groupsX, groupsY, groupsZ);
+    glUseProgram(0);
+#endif
+}
+
+// Wait compute shaders writes to be visible to following commands (MemoryBarrierType flags)
+void rlMemoryBarrier(int barriers)
+{
+#if defined(GRAPHICS_API_OPENGL_33) && !defined(__APPLE__)
+    if (computeSupported) glMemoryBarrier((GLbitfield)barriers);
+#endif
+}
+
+// Load shader storage buffer (SSBO), buffer is zero filled if no data is provided
+// NOTE: Dynamic buffers are expected to be updated from CPU frequently, otherwise data is written and read by GPU
+unsigned int rlLoadShaderBuffer(int size, const void *data, bool dynamic)
+{
+    unsigned int id = 0;
+
+#if defined(GRAPHICS_API_OPENGL_33) && !defined(__APPLE__)
+    if (!computeSupported)
+    {
+        TraceLog(LOG_WARNING, "Shader storage buffers not supported, buffer not loaded");
+        return 0;
+    }
+
+    void *zeros = NULL;
+    if (data == NULL) data = zeros = RL_CALLOC(size, 1);
+
+    glGenBuffers(1, &id);
+    glBindBuffer(GL_SHADER_STORAGE_BUFFER, id);
+    glBufferData(GL_SHADER_STORAGE_BUFFER, size, data, dynamic? GL_DYNAMIC_DRAW : GL_DYNAMIC_COPY);
+    glBindBuffer(GL_SHADER_STORAGE_BUFFER, 0);
+
+    RL_FREE(zeros);
+
+    TrackVideoMemory(VIDEO_MEMORY_BUFFER, id, size);
+    renderStats.uploadedBytes += size;
+
+    TraceLog(LOG_INFO, "[SSBO ID %i] Shader storage buffer loaded successfully (%i bytes)", id, size);
+#endif
+
+    return id;
+}
+
+// Update shader storage buffer data (at offset in bytes)
+void rlUpdateShaderBuffer(unsigned int id, const void *data, int size, int offset)
+{
+#if defined(GRAPHICS_API_OPENGL_33) && !defined(__APPLE__)
+    if (!computeSupported || (id == 0)) return;
+
+    glBindBuffer(GL_SHADER_STORAGE_BUFFER, id);
+    glBufferSubData(GL_SHADER_STORAGE_BUFFER, offset, size, data);
+    glBindBuffer(GL_SHADER_STORAGE_BUFFER, 0);
+
+    renderStats.uploadedBytes += size;
+#endif
+}
+
+// Read shader storage buffer data (at offset in bytes)
+// NOTE: Waits for GPU commands writing the buffer, BARRIER_BUFFER_UPDATE is required after compute shader writes
+void rlReadShaderBuffer(unsigned int id, void *dest, int size, int offset)
+{
+#if defined(GRAPHICS_API_OPENGL_33) && !defined(__APPLE__)
+    if (!computeSupported || (id == 0)) return;
+
+    glBindBuffer(GL_SHADER_STORAGE_BUFFER, id);
+    glGetBufferSubData(GL_SHADER_STORAGE_BUFFER, offset, size, dest);
+    glBindBuffer(GL_SHADER_STORAGE_BUFFER, 0);
+#endif
+}
+
+// Bind buffer to shader storage binding point, buffer can be any GPU buffer (i.e. mesh vertex buffer)
+void rlBindShaderBuffer(unsigned int id, int index)
+{
+#if defined(GRAPHICS_API_OPENGL_33) && !defined(__APPLE__)
+    if (computeSupported) glBindBufferBase(GL_SHADER_STORAGE_BUFFER, index, id);
+#endif
+}
+
+// Unload shader storage buffer
+void rlUnloadShaderBuffer(unsigned int id)
+{
+#if defined(GRAPHICS_API_OPENGL_33) && !defined(__APPLE__)
+    if (id == 0) return;
+
+    glDeleteBuffers(1, &id);
+    UntrackVideoMemory(VIDEO_MEMORY_BUFFER, id);
+
+    TraceLog(LOG_INFO, "[SSBO ID %i] Unloaded shader storage buffer data from VRAM (GPU)", id);
+#endif
+}
+
+// Bind texture (level 0) to image unit for compute shaders load/store (layout(binding = index))
+// NOTE: Image load/store does not support 3 channels formats
+void rlBindImageTexture(unsigned int id, int index, int format, bool readOnly)
+{
+#if defined(GRAPHICS_API_OPENGL_33) && !defined(__APPLE__)
+    if (!computeSupported) return;
+
+    unsigned int glInternalFormat, glFormat, glType;
+    rlGetGlTextureFormats(format, &glInternalFormat, &glFormat, &glType);
+
+    if ((glInternalFormat == GL_R8) || (glInternalFormat == GL_RG8) || (glInternalFormat == GL_RGBA8) ||
+        (glInternalFormat == GL_R32F) || (glInternalFormat == GL_RGBA32F))
+    {
+        glBindImageTexture(index, id, 0, GL_FALSE, 0, readOnly? GL_READ_ONLY : GL_READ_WRITE, glInternalFormat);
+    }
+    else TraceLog(LOG_WARNING, "[TEX ID %i] Texture format not supported for image load/store", id);
+#endif
+}
+
+// Read screen pixel data (color buffer)
+unsigned char *rlReadScreenPixels(int width, int height)
+{
+    ReleaseMeshState();
+
+    unsigned char *screenData = (unsigned char *)RL_CALLOC(width*height*4, sizeof(unsigned char));
+
+    // NOTE 1: glReadPixels returns image flipped vertically -> (0,0) is the bottom left corner of the framebuffer
+    // NOTE 2: We are getting alpha channel! Be careful, it can be transparent if not cleared properly!
+    glReadPixels(0, 0, width, height, GL_RGBA, GL_UNSIGNED_BYTE, screenData);
+
+    unsigned char *imgData = FlipScreenPixels(screenData, width, height, false);
+
+    RL_FREE(screenData);
+
+    return imgData;     // NOTE: image data should be freed
+}
+
+// Request screen pixel data reading into a pixel buffer, GPU copy is not waited
+// NOTE: Returns 0 if not supported or all buffers are in flight, rlReadScreenPixels() should be used instead
+unsigned int rlReadScreenPixelsAsync(int width, int height)
+{
+    unsigned int requestId = 0;
+
+#if defined(GRAPHICS_API_OPENGL_33)
+    if (!mapBufferRangeSupported) return 0;
+
+    ScreenReadback *readback = NULL;
+    for (int i = 0; i < MAX_SCREEN_READBACKS; i++)
+    {
+        if (screenReadbacks[i].requestId == 0) { readback = &screenReadbacks[i]; break; }
+    }
+
+    if (readback == NULL) return 0;
+
+    ReleaseMeshState();
+
+    int size = width*height*4;
+
+    if (readback->pboId == 0) glGenBuffers(1, &readback->pboId);
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, readback->pboId);
+
+    // NOTE: Buffer storage is only reallocated if required size grows
+    if (size > readback->size)
+    {
+        glBufferData(GL_PIXEL_PACK_BUFFER, size, NULL, GL_STREAM_READ);
+        readback->size = size;
+    }
+
+    // NOTE: With a pixel pack buffer bound, data pointer is an offset into buffer
+    glPixelStorei(GL_PACK_ALIGNMENT, 1);
+    glReadPixels(0, 0, width, height, GL_RGBA, GL_UNSIGNED_BYTE, (void *)0);
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+    readback->fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    readback->width = width;
+    readback->height = height;
+    readback->alpha = false;
+
+    screenReadbacksCounter++;
+    if (screenReadbacksCounter == 0) screenReadbacksCounter++;  // Id 0 is reserved (no request)
+    readback->requestId = screenReadbacksCounter;
+
+    requestId = readback->requestId;
+#endif
+
+    return requestId;
+}
+
+// Request framebuffer (fbo) pixel data reading into a pixel buffer, GPU copy is not waited
+// NOTE: Current framebuffer binding is kept, data is got with rlGetScreenPixelsAsync() (flipped, top-left origin)
+unsigned int rlReadFramebufferPixelsAsync(unsigned int id, int width, int height)
+{
+    unsigned int requestId = 0;
+
+#if defined(GRAPHICS_API_OPENGL_33)
+    GLint currentId = 0;
+    glGetIntegerv(GL_READ_FRAMEBUFFER_BINDING, &currentId);
+
+    glBindFramebuffer(GL_READ_FRAMEBUFFER, id);
+    requestId = rlReadScreenPixelsAsync(width, height);
+    glBindFramebuffer(GL_READ_FRAMEBUFFER, currentId);
+
+    // NOTE: Framebuffer alpha channel is kept (i.e. render textures with transparent background)
+    for (int i = 0; i < MAX_SCREEN_READBACKS; i++)
+    {
+        if ((requestId != 0) && (screenReadbacks[i].requestId == requestId)) screenReadbacks[i].alpha = true;
+    }
+#endif
+
+    return requestId;
+}
+
+// Get requested screen pixel data (flipped, RGBA), NULL if GPU copy is not done yet
+// NOTE: Request is released once data is returned, image data should be freed
+unsigned char *rlGetScreenPixelsAsync(unsigned int requestId, bool wait)
+{
+    unsigned char *imgData = NULL;
+
+#if defined(GRAPHICS_API_OPENGL_33)
+    ScreenReadback *readback = NULL;
+    for (int i = 0; i < MAX_SCREEN_READBACKS; i++)
+    {
+        if ((requestId != 0) && (screenReadbacks[i].requestId == requestId)) { readback = &screenReadbacks[i]; break; }
+    }
+
+    if (readback == NULL) return NULL;
+
+    if (readback->fence != NULL)
+    {
+        GLbitfield flags = GL_SYNC_FLUSH_COMMANDS_BIT;
+        GLuint64 timeout = wait? 1000000 : 0;   // 1 ms timeout (in nanoseconds)
+
+        while (true)
+        {
+            GLenum result = glClientWaitSync(readback->fence, flags, timeout);
+
+            if ((result == GL_ALREADY_SIGNALED) || (result == GL_CONDITION_SATISFIED) || (result == GL_WAIT_FAILED)) break;
+            if (!wait) return NULL;
+
+            flags = 0;  // Commands only need to be flushed once
+        }
+
+        glDeleteSync(readback->fence);
+        readback->fence = NULL;
+    }
+
+    ReleaseMeshState();
+
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, readback->pboId);
+    unsigned char *screenData = (unsigned char *)glMapBufferRange(GL_PIXEL_PACK_BUFFER, 0, readback->width*readback->height*4, GL_MAP_READ_BIT);
+
+    if (screenData != NULL)
+    {
+        imgData = FlipScreenPixels(screenData, readback->width, readback->height, readback->alpha);
+        glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+    }
+    else TraceLog(LOG_WARNING, "Screen readback pixel buffer could not be mapped");
+
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+    readback->requestId = 0;
+#endif
+
+    return imgData;     // NOTE: image data should be freed
+}
+
+// Read texture pixel data
+// NOTE: Data is returned in texture format, RGBA on OpenGL ES 2.0, it should be freed
+void *rlReadTexturePixels(Texture2D texture)
+{
+    void *pixels = NULL;
+
+#if defined(GRAPHICS_API_OPENGL_ES2)
+    int size = GetPixelDataSize(texture.width, texture.height, UNCOMPRESSED_R8G8B8A8);
+#else
+    int size = GetPixelDataSize(texture.width, texture.height, texture.format);
+#endif
+
+    if (size > 0)
+    {
+        pixels = RL_MALLOC(size);
+
+        if (!rlReadTexturePixelsEx(texture, pixels))
+        {
+            RL_FREE(pixels);
+            pixels = NULL;
+        }
+    }
+
+    return pixels;
+}
+
+// Read texture pixel data into provided buffer, avoids allocations on every readback
+// NOTE: Buffer must fit texture data in texture format (RGBA on OpenGL ES 2.0)
+bool rlReadTexturePixelsEx(Texture2D texture, void *pixels)
+{
+    bool success = false;
+
+    if (pixels == NULL) return success;
+
+    ReleaseMeshState();
+
+#if defined(GRAPHICS_API_OPENGL_11) || defined(GRAPHICS_API_OPENGL_33)
+    glBindTexture(GL_TEXTURE_2D, texture.id);
+
+    // NOTE: Using texture.id, we can retrieve some texture info (but not on OpenGL ES 2.0)
+    // Possible texture info: GL_TEXTURE_RED_SIZE, GL_TEXTURE_GREEN_SIZE, GL_TEXTURE_BLUE_SIZE, GL_TEXTURE_ALPHA_SIZE
+    //int width, height, format;
+    //glGetTexLevelParameteriv(GL_TEXTURE_2D, 0, GL_TEXTURE_WIDTH, &width);
+    //glGetTexLevelParameteriv(GL_TEXTURE_2D, 0, GL_TEXTURE_HEIGHT, &height);
+    //glGetTexLevelParameteriv(GL_TEXTURE_2D, 0, GL_TEXTURE_INTERNAL_FORMAT, &format);
+
+    // NOTE: Each row written to or read from by OpenGL pixel operations like glGetTexImage are aligned to a 4 byte boundary by default, which may add some padding.
+    // Use glPixelStorei to modify padding with the GL_[UN]PACK_ALIGNMENT setting.
+    // GL_PACK_ALIGNMENT affects operations that read from OpenGL memory (glReadPixels, glGetTexImage, etc.)
+    // GL_UNPACK_ALIGNMENT affects operations that write to OpenGL memory (glTexImage, etc.)
+    glPixelStorei(GL_PACK_ALIGNMENT, 1);
+
+    unsigned int glInternalFormat, glFormat, glType;
+    rlGetGlTextureFormats(texture.format, &glInternalFormat, &glFormat, &glType);
+
+    if ((glInternalFormat != -1) && (texture.format < COMPRESSED_DXT1_RGB))
+    {
+        glGetTexImage(GL_TEXTURE_2D, 0, glFormat, glType, pixels);
+        success = true;
+    }
+    else TraceLog(LOG_WARNING, "Texture data retrieval not suported for pixel format");
+
+    glBindTexture(GL_TEXTURE_2D, 0);
+#endif
+
+#if defined(GRAPHICS_API_OPENGL_ES2)
+    // glGetTexImage() is not available on OpenGL ES 2.0
+    // Texture2D width and height are required on OpenGL ES 2.0. There is no way to get it from texture id.
+    // Two possible Options:
+    // 1 - Bind texture to color fbo attachment and glReadPixels()
+    // 2 - Create an fbo, activate it, render quad with texture, glReadPixels()
+    // We are using Option 1, just need to care for texture format on retrieval
+    // NOTE: This behaviour could be conditioned by graphic driver...
+    // NOTE: Framebuffer is created once and kept, texture is only attached for readback (no depth attachment required)
+    if (readbackFramebufferId == 0) glGenFramebuffers(1, &readbackFramebufferId);
+
+    glBindFramebuffer(GL_FRAMEBUFFER, readbackFramebufferId);
+    glBindTexture(GL_TEXTURE_2D, 0);
+
+    // Attach our texture to FBO
+    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, texture.id, 0);
+
+    if (glCheckFramebufferStatus(GL_FRAMEBUFFER) == GL_FRAMEBUFFER_COMPLETE)
+    {
+        // We read data as RGBA, readback framebuffer color format, despite binding another texture format
+        glPixelStorei(GL_PACK_ALIGNMENT, 1);
+        glReadPixels(0, 0, texture.width, texture.height, GL_RGBA, GL_UNSIGNED_BYTE, pixels);
+        success = true;
+    }
+    else TraceLog(LOG_WARNING, "Texture data retrieval not suported for pixel format");
+
+    // Detach texture, framebuffer is reused on next readback
+    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, 0, 0);
+
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+#endif
+
+    return success;
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition - Shaders Functions
+// NOTE: Those functions are exposed directly to the user in raylib.h
+//----------------------------------------------------------------------------------
+
+// Get default internal texture (white texture)
+Texture2D GetTextureDefault(void)
+{
+    Texture2D texture = { 0 };
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    texture.id = defaultTextureId;
+    texture.width = 1;
+    texture.height = 1;
+    texture.mipmaps = 1;
+    texture.format = UNCOMPRESSED_R8G8B8A8;
+#endif
+    return texture;
+}
+
+// Get default shader
+Shader GetShaderDefault(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    return defaultShader;
+#else
+    Shader shader = { 0 };
+    return shader;
+#endif
+}
+
+// Get default skinning shader
+// NOTE: Shader id is 0 if GPU skinning is not supported
+Shader GetShaderSkinning(void)
+{
+#if (defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)) && defined(SUPPORT_GPU_SKINNING)
+    return defaultSkinShader;
+#else
+    Shader shader = { 0 };
+    return shader;
+#endif
+}
+
+// Load text data from file
+// NOTE: text chars array should be freed manually
+char *LoadText(const char *fileName)
+{
+    FILE *textFile = NULL;
+    char *text = NULL;
+
+    if (fileName != NULL)
+    {
+        textFile = fopen(fileName,"rt");
+
+        if (textFile != NULL)
+        {
+            fseek(textFile, 0, SEEK_END);
+            int size = ftell(textFile);
+            fseek(textFile, 0, SEEK_SET);
+
+            if (size > 0)
+            {
+                text = (char *)RL_MALLOC(sizeof(char)*(size + 1));
+                int count = fread(text, sizeof(char), size, textFile);
+                text[count] = '\0';
+            }
+
+            fclose(textFile);
+        }
+        else TraceLog(LOG_WARNING, "[%s] Text file could not be opened", fileName);
+    }
+
+    return text;
+}
+
+// Set shader program binaries cache directory, NULL disables shader cache (default)
+// NOTE: Call after context initialization, directory must exist and be writable,
+// binaries are only valid for current GPU and driver (cache key includes both)
+void SetShaderCacheDirectory(const char *dirPath)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    shaderCachePath[0] = '\0';
+
+    if (dirPath != NULL)
+    {
+        strncpy(shaderCachePath, dirPath, sizeof(shaderCachePath) - 1);
+        shaderCachePath[sizeof(shaderCachePath) - 1] = '\0';
+
+        if (!programBinarySupported) TraceLog(LOG_WARNING, "Program binaries not supported, shader cache disabled");
+    }
+#endif
+}
+
+// Load shader from files and bind default locations
+// NOTE: If shader string is NULL, using default vertex/fragment shaders
+Shader LoadShader(const char *vsFileName, const char *fsFileName)
+{
+    Shader shader = { 0 };
+
+    // NOTE: Shader.locs is allocated by LoadShaderCode()
+
+    char *vShaderStr = NULL;
+    char *fShaderStr = NULL;
+
+    if (vsFileName != NULL) vShaderStr = LoadText(vsFileName);
+    if (fsFileName != NULL) fShaderStr = LoadText(fsFileName);
+
+    shader = LoadShaderCode(vShaderStr, fShaderStr);
+
+    if (vShaderStr != NULL) RL_FREE(vShaderStr);
+    if (fShaderStr != NULL) RL_FREE(fShaderStr);
+
+    return shader;
+}
+
+// Load shader from code strings
+// NOTE: If shader string is NULL, using default vertex/fragment shaders
+Shader LoadShaderCode(const char *vsCode, const char *fsCode)
+{
+    ReleaseMeshState();
+
+    Shader shader = { 0 };
+    shader.locs = (int *)RL_CALLOC(MAX_SHADER_LOCATIONS, sizeof(int));
+
+    // NOTE: All locations must be reseted to -1 (no location)
+    for (int i = 0; i < MAX_SHADER_LOCATIONS; i++) shader.locs[i] = -1;
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    // Try loading shader program from cached binary (if cache enabled)
+    // NOTE: On invalid or outdated binary, shader is compiled from sources and cache is updated
+    unsigned long long cacheHash = 0;
+
+    if (programBinarySupported && (shaderCachePath[0] != '\0') && ((vsCode != NULL) || (fsCode != NULL)))
+    {
+        cacheHash = GetShaderCacheHash(vsCode, fsCode);
+        shader.id = LoadShaderBinary(cacheHash);
+    }
+
+    if (shader.id > 0) SetShaderDefaultLocations(&shader);
+    else
+    {
+        unsigned int vertexShaderId = defaultVShaderId;
+        unsigned int fragmentShaderId = defaultFShaderId;
+
+        if (vsCode != NULL) vertexShaderId = CompileShader(vsCode, GL_VERTEX_SHADER);
+        if (fsCode != NULL) fragmentShaderId = CompileShader(fsCode, GL_FRAGMENT_SHADER);
+
+        if ((vertexShaderId == defaultVShaderId) && (fragmentShaderId == defaultFShaderId)) shader = defaultShader;
+        else
+        {
+            shader.id = LoadShaderProgram(vertexShaderId, fragmentShaderId);
+
+            if (vertexShaderId != defaultVShaderId) glDeleteShader(vertexShaderId);
+            if (fragmentShaderId != defaultFShaderId) glDeleteShader(fragmentShaderId);
+
+            if (shader.id == 0)
+            {
+                TraceLog(LOG_WARNING, "Custom shader could not be loaded");
+                shader = defaultShader;
+            }
+            else if (cacheHash != 0) SaveShaderBinary(shader.id, cacheHash);
+
+            // After shader loading, we TRY to set default location names
+            if (shader.id > 0) SetShaderDefaultLocations(&shader);
+        }
+    }
+
+    // Get available shader uniforms
+    // NOTE: This information is useful for debug...
+    int uniformCount = -1;
+
+    glGetProgramiv(shader.id, GL_ACTIVE_UNIFORMS, &uniformCount);
+
+    for (int i = 0; i < uniformCount; i++)
+    {
+        int namelen = -1;
+        int num = -1;
+        char name[256]; // Assume no variable names longer than 256
+        GLenum type = GL_ZERO;
+
+        // Get the name of the uniforms
+        glGetActiveUniform(shader.id, i,sizeof(name) - 1, &namelen, &num, &type, name);
+
+        name[namelen] = 0;
+
+        // Get the location of the named uniform
+        unsigned int location = glGetUniformLocation(shader.id, name);
+
+        TraceLog(LOG_DEBUG, "[SHDR ID %i] Active uniform [%s] set at location: %i", shader.id, name, location);
+    }
+#endif
+
+    return shader;
+}
+
+// Unload shader from GPU memory (VRAM)
+void UnloadShader(Shader shader)
+{
+    ReleaseMeshState();
+
+    if (shader.id > 0)
+    {
+        rlDeleteShader(shader.id);
+        TraceLog(LOG_INFO, "[SHDR ID %i] Unloaded shader program data", shader.id);
+    }
+
+    RL_FREE(shader.locs);
+}
+
+// Begin custom shader mode
+void BeginShaderMode(Shader shader)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (currentShader.id != shader.id)
+    {
+        rlglDraw();
+        currentShader = shader;
+    }
+#endif
+}
+
+// End custom shader mode (returns to default shader)
+void EndShaderMode(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    BeginShaderMode(defaultShader);
+#endif
+}
+
+// Get shader uniform location
+int GetShaderLocation(Shader shader, const char *uniformName)
+{
+    int location = -1;
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    location = glGetUniformLocation(shader.id, uniformName);
+
+    if (location == -1) TraceLog(LOG_WARNING, "[SHDR ID %i][%s] Shader uniform could not be found", shader.id, uniformName);
+    else TraceLog(LOG_INFO, "[SHDR ID %i][%s] Shader uniform set at location: %i", shader.id, uniformName, location);
+#endif
+    return location;
+}
+
+// Set shader uniform value
+void SetShaderValue(Shader shader, int uniformLoc, const void *value, int uniformType)
+{
+    SetShaderValueV(shader, uniformLoc, value, uniformType, 1);
+}
+
+// Set shader uniform value vector
+void SetShaderValueV(Shader shader, int uniformLoc, const void *value, int uniformType, int count)
+{
+    ReleaseMeshState();
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    glUseProgram(shader.id);
+
+    switch (uniformType)
+    {
+        case UNIFORM_FLOAT: glUniform1fv(uniformLoc, count, (float *)value); break;
+        case UNIFORM_VEC2: glUniform2fv(uniformLoc, count, (float *)value); break;
+        case UNIFORM_VEC3: glUniform3fv(uniformLoc, count, (float *)value); break;
+        case UNIFORM_VEC4: glUniform4fv(uniformLoc, count, (float *)value); break;
+        case UNIFORM_INT: glUniform1iv(uniformLoc, count, (int *)value); break;
+        case UNIFORM_IVEC2: glUniform2iv(uniformLoc, count, (int *)value); break;
+        case UNIFORM_IVEC3: glUniform3iv(uniformLoc, count, (int *)value); break;
+        case UNIFORM_IVEC4: glUniform4iv(uniformLoc, count, (int *)value); break;
+        case UNIFORM_SAMPLER2D: glUniform1iv(uniformLoc, count, (int *)value); break;
+        default: TraceLog(LOG_WARNING, "Shader uniform could not be set data type not recognized");
+    }
+
+#if defined(SUPPORT_FRAME_CAPTURE)
+    if ((captureFile != NULL) && (uniformType >= UNIFORM_FLOAT) && (uniformType <= UNIFORM_SAMPLER2D))
+    {
+        int components = 1;
+        if ((uniformType == UNIFORM_VEC2) || (uniformType == UNIFORM_IVEC2)) components = 2;
+        else if ((uniformType == UNIFORM_VEC3) || (uniformType == UNIFORM_IVEC3)) components = 3;
+        else if ((uniformType == UNIFORM_VEC4) || (uniformType == UNIFORM_IVEC4)) components = 4;
+
+        WriteCaptureUniform(shader.id, uniformLoc, uniformType, count, value, components*count*4);
+    }
+#endif
+
+    //glUseProgram(0);      // Avoid reseting current shader program, in case other uniforms are set
+#endif
+}
+
+
+// Set shader uniform value (matrix 4x4)
+void SetShaderValueMatrix(Shader shader, int uniformLoc, Matrix mat)
+{
+    ReleaseMeshState();
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    glUseProgram(shader.id);
+
+    glUniformMatrix4fv(uniformLoc, 1, false, MatrixToFloat(mat));
+#if defined(SUPPORT_FRAME_CAPTURE)
+    if (captureFile != NULL) WriteCaptureUniform(shader.id, uniformLoc, -1, 1, MatrixToFloat(mat), 16*sizeof(float));
+#endif
+
+    //glUseProgram(0);
+#endif
+}
+
+// Set shader uniform value for texture
+void SetShaderValueTexture(Shader shader, int uniformLoc, Texture2D texture)
+{
+    ReleaseMeshState();
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    glUseProgram(shader.id);
+
+    glUniform1i(uniformLoc, texture.id);
+#if defined(SUPPORT_FRAME_CAPTURE)
+    if (captureFile != NULL) WriteCaptureUniform(shader.id, uniformLoc, UNIFORM_SAMPLER2D, 1, &texture.id, sizeof(int));
+#endif
+
+    //glUseProgram(0);
+#endif
+}
+
+// Load uniform block buffer, shared by all shaders declaring blockName block
+// NOTE: Block is bound to shaders loaded afterwards, previously loaded shaders require SetShaderBlocks()
+unsigned int LoadShaderBlock(const char *blockName, const void *data, int size)
+{
+    unsigned int id = 0;
+
+#if defined(GRAPHICS_API_OPENGL_33)
+    if (!uboSupported)
+    {
+        TraceLog(LOG_WARNING, "Uniform blocks not supported, block [%s] not loaded", blockName);
+        return 0;
+    }
+
+    int index = -1;
+    for (int i = 0; i < MAX_UNIFORM_BLOCKS; i++)
+    {
+        if (uniformBlocks[i].id == 0) { index = i; break; }
+    }
+
+    if (index == -1)
+    {
+        TraceLog(LOG_WARNING, "Uniform blocks limit reached (MAX_UNIFORM_BLOCKS), block [%s] not loaded", blockName);
+        return 0;
+    }
+
+    glGenBuffers(1, &id);
+    glBindBuffer(GL_UNIFORM_BUFFER, id);
+    glBufferData(GL_UNIFORM_BUFFER, size, data, GL_DYNAMIC_DRAW);
+    glBindBuffer(GL_UNIFORM_BUFFER, 0);
+
+    // NOTE: Binding point 0 is reserved for frame block
+    glBindBufferBase(GL_UNIFORM_BUFFER, index + 1, id);
+
+    uniformBlocks[index].id = id;
+    strncpy(uniformBlocks[index].name, blockName, sizeof(uniformBlocks[index].name) - 1);
+    uniformBlocks[index].name[sizeof(uniformBlocks[index].name) - 1] = '\0';
+
+    renderStats.uploadedBytes += size;
+
+    TraceLog(LOG_INFO, "[UBO ID %i] Uniform block [%s] loaded successfully (binding point: %i)", id, blockName, index + 1);
+#endif
+
+    return id;
+}
+
+// Update uniform block buffer data (at offset in bytes)
+// NOTE: Data is shared by all shaders, update it once per frame instead of every shader uniform
+void UpdateShaderBlock(unsigned int blockId, const void *data, int size, int offset)
+{
+#if defined(GRAPHICS_API_OPENGL_33)
+    if (blockId == 0) return;
+
+    glBindBuffer(GL_UNIFORM_BUFFER, blockId);
+    glBufferSubData(GL_UNIFORM_BUFFER, offset, size, data);
+    glBindBuffer(GL_UNIFORM_BUFFER, 0);
+
+    renderStats.uploadedBytes += size;
+#endif
+}
+
+// Unload uniform block buffer
+void UnloadShaderBlock(unsigned int blockId)
+{
+#if defined(GRAPHICS_API_OPENGL_33)
+    for (int i = 0; i < MAX_UNIFORM_BLOCKS; i++)
+    {
+        if ((blockId != 0) && (uniformBlocks[i].id == blockId))
+        {
+            glDeleteBuffers(1, &uniformBlocks[i].id);
+            uniformBlocks[i].id = 0;
+            uniformBlocks[i].name[0] = '\0';
+
+            TraceLog(LOG_INFO, "[UBO ID %i] Unloaded uniform block data from VRAM (GPU)", blockId);
+            break;
+        }
+    }
+#endif
+}
+
+// Bind frame block and loaded uniform blocks to shader (if declared by shader)
+// NOTE: Called on shader loading, only required by shaders loaded before LoadShaderBlock()
+void SetShaderBlocks(Shader shader)
+{
+#if defined(GRAPHICS_API_OPENGL_33)
+    if (!uboSupported || (shader.id == 0)) return;
+
+    unsigned int index = glGetUniformBlockIndex(shader.id, DEFAULT_BLOCK_FRAME_NAME);
+    if (index != GL_INVALID_INDEX) glUniformBlockBinding(shader.id, index, 0);
+
+    for (int i = 0; i < MAX_UNIFORM_BLOCKS; i++)
+    {
+        if (uniformBlocks[i].id == 0) continue;
+
+        index = glGetUniformBlockIndex(shader.id, uniformBlocks[i].name);
+        if (index != GL_INVALID_INDEX) glUniformBlockBinding(shader.id, index, i + 1);
+    }
+#endif
+}
+
+// Set a custom projection matrix (replaces internal projection matrix)
+void SetMatrixProjection(Matrix proj)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    projection = proj;
+#endif
+}
+
+// Return internal projection matrix
+Matrix GetMatrixProjection(void) {
+#if defined(GRAPHICS_API_OPENGL_11)
+    float mat[16];
+    glGetFloatv(GL_PROJECTION_MATRIX,mat);
+    Matrix m;
+    m.m0  = mat[0];     m.m1  = mat[1];     m.m2  = mat[2];     m.m3  = mat[3];
+    m.m4  = mat[4];     m.m5  = mat[5];     m.m6  = mat[6];     m.m7  = mat[7];
+    m.m8  = mat[8];     m.m9  = mat[9];     m.m10 = mat[10];    m.m11 = mat[11];
+    m.m12 = mat[12];    m.m13 = mat[13];    m.m14 = mat[14];    m.m15 = mat[15];
+    return m;
+#else
+    return projection;
+#endif
+#
+}
+
+// Set a custom modelview matrix (replaces internal modelview matrix)
+void SetMatrixModelview(Matrix view)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    modelview = view;
+#endif
+}
+
+// Return internal modelview matrix
+Matrix GetMatrixModelview(void)
+{
+    Matrix matrix = MatrixIdentity();
+#if defined(GRAPHICS_API_OPENGL_11)
+    float mat[16];
+    glGetFloatv(GL_MODELVIEW_MATRIX, mat);
+    matrix.m0  = mat[0];     matrix.m1  = mat[1];     matrix.m2  = mat[2];     matrix.m3  = mat[3];
+    matrix.m4  = mat[4];     matrix.m5  = mat[5];     matrix.m6  = mat[6];     matrix.m7  = mat[7];
+    matrix.m8  = mat[8];     matrix.m9  = mat[9];     matrix.m10 = mat[10];    matrix.m11 = mat[11];
+    matrix.m12 = mat[12];    matrix.m13 = mat[13];    matrix.m14 = mat[14];    matrix.m15 = mat[15];
+#else
+    matrix = modelview;
+#endif
+    return matrix;
+}
+
+// Generate cubemap texture from HDR texture
+// TODO: OpenGL ES 2.0 does not support GL_RGB16F texture format, neither GL_DEPTH_COMPONENT24
+Texture2D GenTextureCubemap(Shader shader, Texture2D map, int size)
+{
+    ReleaseMeshState();
+
+    Texture2D cubemap = { 0 };
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    // NOTE: SetShaderDefaultLocations() already setups locations for projection and view Matrix in shader
+    // Other locations should be setup externally in shader before calling the function
+
+    // Set up depth face culling and cubemap seamless
+    glDisable(GL_CULL_FACE);
+#if defined(GRAPHICS_API_OPENGL_33)
+    glEnable(GL_TEXTURE_CUBE_MAP_SEAMLESS);     // Flag not supported on OpenGL ES 2.0
+#endif
+
+    // Setup framebuffer
+    unsigned int fbo, rbo;
+    glGenFramebuffers(1, &fbo);
+    glGenRenderbuffers(1, &rbo);
+    glBindFramebuffer(GL_FRAMEBUFFER, fbo);
+    glBindRenderbuffer(GL_RENDERBUFFER, rbo);
+#if defined(GRAPHICS_API_OPENGL_33)
+    glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH_COMPONENT24, size, size);
+#elif defined(GRAPHICS_API_OPENGL_ES2)
+    glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH_COMPONENT16, size, size);
+#endif
+    glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_RENDERBUFFER, rbo);
+
+    // Set up cubemap to render and attach to framebuffer
+    // NOTE: Faces are stored as 32 bit floating point values
+    glGenTextures(1, &cubemap.id);
+    glBindTexture(GL_TEXTURE_CUBE_MAP, cubemap.id);
+    for (unsigned int i = 0; i < 6; i++)
+    {
+#if defined(GRAPHICS_API_OPENGL_33)
+        glTexImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_X + i, 0, GL_RGB32F, size, size, 0, GL_RGB, GL_FLOAT, NULL);
+#elif defined(GRAPHICS_API_OPENGL_ES2)
+        if (texFloatSupported) glTexImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_X + i, 0, GL_RGB, size, size, 0, GL_RGB, GL_FLOAT, NULL);
+#endif
+    }
+
+    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+#if defined(GRAPHICS_API_OPENGL_33)
+    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_R, GL_CLAMP_TO_EDGE);  // Flag not supported on OpenGL ES 2.0
+#endif
+    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+
+    // Create projection and different views for each face
+    Matrix fboProjection = MatrixPerspective(90.0*DEG2RAD, 1.0, DEFAULT_NEAR_CULL_DISTANCE, DEFAULT_FAR_CULL_DISTANCE);
+    Matrix fboViews[6] = {
+        MatrixLookAt((Vector3){ 0.0f, 0.0f, 0.0f }, (Vector3){ 1.0f, 0.0f, 0.0f }, (Vector3){ 0.0f, -1.0f, 0.0f }),
+        MatrixLookAt((Vector3){ 0.0f, 0.0f, 0.0f }, (Vector3){ -1.0f, 0.0f, 0.0f }, (Vector3){ 0.0f, -1.0f, 0.0f }),
+        MatrixLookAt((Vector3){ 0.0f, 0.0f, 0.0f }, (Vector3){ 0.0f, 1.0f, 0.0f }, (Vector3){ 0.0f, 0.0f, 1.0f }),
+        MatrixLookAt((Vector3){ 0.0f, 0.0f, 0.0f }, (Vector3){ 0.0f, -1.0f, 0.0f }, (Vector3){ 0.0f, 0.0f, -1.0f }),
+        MatrixLookAt((Vector3){ 0.0f, 0.0f, 0.0f }, (Vector3){ 0.0f, 0.0f, 1.0f }, (Vector3){ 0.0f, -1.0f, 0.0f }),
+        MatrixLookAt((Vector3){ 0.0f, 0.0f, 0.0f }, (Vector3){ 0.0f, 0.0f, -1.0f }, (Vector3){ 0.0f, -1.0f, 0.0f })
+    };
+
+    // Convert HDR equirectangular environment map to cubemap equivalent
+    glUseProgram(shader.id);
+    glActiveTexture(GL_TEXTURE0);
+    glBindTexture(GL_TEXTURE_2D, map.id);
+    SetShaderValueMatrix(shader, shader.locs[LOC_MATRIX_PROJECTION], fboProjection);
+
+    // Note: don't forget to configure the viewport to the capture dimensions
+    glViewport(0, 0, size, size);
+    glBindFramebuffer(GL_FRAMEBUFFER, fbo);
+
+    for (int i = 0; i < 6; i++)
+    {
+        SetShaderValueMatrix(shader, shader.locs[LOC_MATRIX_VIEW], fboViews[i]);
+        glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_CUBE_MAP_POSITIVE_X + i, cubemap.id, 0);
+        glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+        GenDrawCube();
+    }
+
+    // Unbind framebuffer and textures
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+
+    // Reset viewport dimensions to default
+    glViewport(0, 0, framebufferWidth, framebufferHeight);
+    //glEnable(GL_CULL_FACE);
+
+    // NOTE: Texture2D is a GL_TEXTURE_CUBE_MAP, not a GL_TEXTURE_2D!
+    cubemap.width = size;
+    cubemap.height = size;
+    cubemap.mipmaps = 1;
+    cubemap.format = UNCOMPRESSED_R32G32B32;
+#endif
+    return cubemap;
+}
+
+// Generate irradiance texture using cubemap data
+// TODO: OpenGL ES 2.0 does not support GL_RGB16F texture format, neither GL_DEPTH_COMPONENT24
+Texture2D GenTextureIrradiance(Shader shader, Texture2D cubemap, int size)
+{
+    ReleaseMeshState();
+
+    Texture2D irradiance = { 0 };
+
+#if defined(GRAPHICS_API_OPENGL_33) // || defined(GRAPHICS_API_OPENGL_ES2)
+    // NOTE: SetShaderDefaultLocations() already setups locations for projection and view Matrix in shader
+    // Other locations should be setup externally in shader before calling the function
+
+    // Setup framebuffer
+    unsigned int fbo, rbo;
+    glGenFramebuffers(1, &fbo);
+    glGenRenderbuffers(1, &rbo);
+    glBindFramebuffer(GL_FRAMEBUFFER, fbo);
+    glBindRenderbuffer(GL_RENDERBUFFER, rbo);
+    glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH_COMPONENT24, size, size);
+    glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_RENDERBUFFER, rbo);
+
+    // Create an irradiance cubemap, and re-scale capture FBO to irradiance scale
+    glGenTextures(1, &irradiance.id);
+    glBindTexture(GL_TEXTURE_CUBE_MAP, irradiance.id);
+    for (unsigned int i = 0; i < 6; i++)
+    {
+        glTexImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_X + i, 0, GL_RGB16F, size, size, 0, GL_RGB, GL_FLOAT, NULL);
+    }
+
+    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_R, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+
+    // Create projection (transposed) and different views for each face
+    Matrix fboProjection = MatrixPerspective(90.0*DEG2RAD, 1.0, DEFAULT_NEAR_CULL_DISTANCE, DEFAULT_FAR_CULL_DISTANCE);
+    Matrix fboViews[6] = {
+        MatrixLookAt((Vector3){ 0.0f, 0.0f, 0.0f }, (Vector3){ 1.0f, 0.0f, 0.0f }, (Vector3){ 0.0f, -1.0f, 0.0f }),
+        MatrixLookAt((Vector3){ 0.0f, 0.0f, 0.0f }, (Vector3){ -1.0f, 0.0f, 0.0f }, (Vector3){ 0.0f, -1.0f, 0.0f }),
+        MatrixLookAt((Vector3){ 0.0f, 0.0f, 0.0f }, (Vector3){ 0.0f, 1.0f, 0.0f }, (Vector3){ 0.0f, 0.0f, 1.0f }),
+        MatrixLookAt((Vector3){ 0.0f, 0.0f, 0.0f }, (Vector3){ 0.0f, -1.0f, 0.0f }, (Vector3){ 0.0f, 0.0f, -1.0f }),
+        MatrixLookAt((Vector3){ 0.0f, 0.0f, 0.0f }, (Vector3){ 0.0f, 0.0f, 1.0f }, (Vector3){ 0.0f, -1.0f, 0.0f }),
+        MatrixLookAt((Vector3){ 0.0f, 0.0f, 0.0f }, (Vector3){ 0.0f, 0.0f, -1.0f }, (Vector3){ 0.0f, -1.0f, 0.0f })
+    };
+
+    // Solve diffuse integral by convolution to create an irradiance cubemap
+    glUseProgram(shader.id);
+    glActiveTexture(GL_TEXTURE0);
+    glBindTexture(GL_TEXTURE_CUBE_MAP, cubemap.id);
+    SetShaderValueMatrix(shader, shader.locs[LOC_MATRIX_PROJECTION], fboProjection);
+
+    // Note: don't forget to configure the viewport to the capture dimensions
+    glViewport(0, 0, size, size);
+    glBindFramebuffer(GL_FRAMEBUFFER, fbo);
+
+    for (int i = 0; i < 6; i++)
+    {
+        SetShaderValueMatrix(shader, shader.locs[LOC_MATRIX_VIEW], fboViews[i]);
+        glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_CUBE_MAP_POSITIVE_X + i, irradiance.id, 0);
+        glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+        GenDrawCube();
+    }
+
+    // Unbind framebuffer and textures
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+
+    // Reset viewport dimensions to default
+    glViewport(0, 0, framebufferWidth, framebufferHeight);
+
+    irradiance.width = size;
+    irradiance.height = size;
+    irradiance.mipmaps = 1;
+    //irradiance.format = UNCOMPRESSED_R16G16B16;
+#endif
+    return irradiance;
+}
+
+// Generate prefilter texture using cubemap data
+// TODO: OpenGL ES 2.0 does not support GL_RGB16F texture format, neither GL_DEPTH_COMPONENT24
+Texture2D GenTexturePrefilter(Shader shader, Texture2D cubemap, int size)
+{
+    ReleaseMeshState();
+
+    Texture2D prefilter = { 0 };
+
+#if defined(GRAPHICS_API_OPENGL_33) // || defined(GRAPHICS_API_OPENGL_ES2)
+    // NOTE: SetShaderDefaultLocations() already setups locations for projection and view Matrix in shader
+    // Other locations should be setup externally in shader before calling the function
+    // TODO: Locations should be taken out of this function... too shader dependant...
+    int roughnessLoc = GetShaderLocation(shader, "roughness");
+
+    // Setup framebuffer
+    unsigned int fbo, rbo;
+    glGenFramebuffers(1, &fbo);
+    glGenRenderbuffers(1, &rbo);
+    glBindFramebuffer(GL_FRAMEBUFFER, fbo);
+    glBindRenderbuffer(GL_RENDERBUFFER, rbo);
+    glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH_COMPONENT24, size, size);
+    glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_RENDERBUFFER, rbo);
+
+    // Create a prefiltered HDR environment map
+    glGenTextures(1, &prefilter.id);
+    glBindTexture(GL_TEXTURE_CUBE_MAP, prefilter.id);
+    for (unsigned int i = 0; i < 6; i++)
+    {
+        glTexImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_X + i, 0, GL_RGB16F, size, size, 0, GL_RGB, GL_FLOAT, NULL);
+    }
+
+    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_R, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
+    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+
+    // Generate mipmaps for the prefiltered HDR texture
+    glGenerateMipmap(GL_TEXTURE_CUBE_MAP);
+
+    // Create projection (transposed) and different views for each face
+    Matrix fboProjection = MatrixPerspective(90.0*DEG2RAD, 1.0, DEFAULT_NEAR_CULL_DISTANCE, DEFAULT_FAR_CULL_DISTANCE);
+    Matrix fboViews[6] = {
+        MatrixLookAt((Vector3){ 0.0f, 0.0f, 0.0f }, (Vector3){ 1.0f, 0.0f, 0.0f }, (Vector3){ 0.0f, -1.0f, 0.0f }),
+        MatrixLookAt((Vector3){ 0.0f, 0.0f, 0.0f }, (Vector3){ -1.0f, 0.0f, 0.0f }, (Vector3){ 0.0f, -1.0f, 0.0f }),
+        MatrixLookAt((Vector3){ 0.0f, 0.0f, 0.0f }, (Vector3){ 0.0f, 1.0f, 0.0f }, (Vector3){ 0.0f, 0.0f, 1.0f }),
+        MatrixLookAt((Vector3){ 0.0f, 0.0f, 0.0f }, (Vector3){ 0.0f, -1.0f, 0.0f }, (Vector3){ 0.0f, 0.0f, -1.0f }),
+        MatrixLookAt((Vector3){ 0.0f, 0.0f, 0.0f }, (Vector3){ 0.0f, 0.0f, 1.0f }, (Vector3){ 0.0f, -1.0f, 0.0f }),
+        MatrixLookAt((Vector3){ 0.0f, 0.0f, 0.0f }, (Vector3){ 0.0f, 0.0f, -1.0f }, (Vector3){ 0.0f, -1.0f, 0.0f })
+    };
+
+    // Prefilter HDR and store data into mipmap levels
+    glUseProgram(shader.id);
+    glActiveTexture(GL_TEXTURE0);
+    glBindTexture(GL_TEXTURE_CUBE_MAP, cubemap.id);
+    SetShaderValueMatrix(shader, shader.locs[LOC_MATRIX_PROJECTION], fboProjection);
+
+    glBindFramebuffer(GL_FRAMEBUFFER, fbo);
+
+    #define MAX_MIPMAP_LEVELS   5   // Max number of prefilter texture mipmaps
+
+    for (int mip = 0; mip < MAX_MIPMAP_LEVELS; mip++)
+    {
+        // Resize framebuffer according to mip-level size.
+        unsigned int mipWidth  = size*(int)powf(0.5f, (float)mip);
+        unsigned int mipHeight = size*(int)powf(0.5f, (float)mip);
+
+        glBindRenderbuffer(GL_RENDERBUFFER, rbo);
+        glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH_COMPONENT24, mipWidth, mipHeight);
+        glViewport(0, 0, mipWidth, mipHeight);
+
+        float roughness = (float)mip/(float)(MAX_MIPMAP_LEVELS - 1);
+        glUniform1f(roughnessLoc, roughness);
+
+        for (int i = 0; i < 6; i++)
+        {
+            SetShaderValueMatrix(shader, shader.locs[LOC_MATRIX_VIEW], fboViews[i]);
+            glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_CUBE_MAP_POSITIVE_X + i, prefilter.id, mip);
+            glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+            GenDrawCube();
+        }
+    }
+
+    // Unbind framebuffer and textures
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+
+    // Reset viewport dimensions to default
+    glViewport(0, 0, framebufferWidth, framebufferHeight);
+
+    prefilter.width = size;
+    prefilter.height = size;
+    prefilter.mipmaps = MAX_MIPMAP_LEVELS;  // NOTE: Only prefiltered levels, texture allocates full mipmaps chain
+    //prefilter.format = UNCOMPRESSED_R16G16B16;
+#endif
+    return prefilter;
+}
+
+// Generate BRDF texture using cubemap data
+// NOTE: OpenGL ES 2.0 does not support GL_RGB16F texture format, neither GL_DEPTH_COMPONENT24
+// TODO: Review implementation: https://github.com/HectorMF/BRDFGenerator
+Texture2D GenTextureBRDF(Shader shader, int size)
+{
+    ReleaseMeshState();
+
+    Texture2D brdf = { 0 };
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    // Generate BRDF convolution texture
+    glGenTextures(1, &brdf.id);
+    glBindTexture(GL_TEXTURE_2D, brdf.id);
+#if defined(GRAPHICS_API_OPENGL_33)
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGB32F, size, size, 0, GL_RGB, GL_FLOAT, NULL);
+#elif defined(GRAPHICS_API_OPENGL_ES2)
+    if (texFloatSupported) glTexImage2D(GL_TEXTURE_2D, 0, GL_RGB, size, size, 0, GL_RGB, GL_FLOAT, NULL);
+#endif
+
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+
+    // Render BRDF LUT into a quad using FBO
+    unsigned int fbo, rbo;
+    glGenFramebuffers(1, &fbo);
+    glGenRenderbuffers(1, &rbo);
+    glBindFramebuffer(GL_FRAMEBUFFER, fbo);
+    glBindRenderbuffer(GL_RENDERBUFFER, rbo);
+#if defined(GRAPHICS_API_OPENGL_33)
+    glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH_COMPONENT24, size, size);
+#elif defined(GRAPHICS_API_OPENGL_ES2)
+    glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH_COMPONENT16, size, size);
+#endif
+    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, brdf.id, 0);
+
+    glViewport(0, 0, size, size);
+    glUseProgram(shader.id);
+    glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+    GenDrawQuad();
+
+    // Unbind framebuffer and textures
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+
+    // Unload framebuffer but keep color texture
+    glDeleteRenderbuffers(1, &rbo);
+    glDeleteFramebuffers(1, &fbo);
+
+    // Reset viewport dimensions to default
+    glViewport(0, 0, framebufferWidth, framebufferHeight);
+
+    brdf.width = size;
+    brdf.height = size;
+    brdf.mipmaps = 1;
+    brdf.format = UNCOMPRESSED_R32G32B32;
+#endif
+    return brdf;
+}
+
+// KTX 1.1 file header (64 bytes), used for IBL textures export/import
+// NOTE: https://www.khronos.org/opengles/sdk/tools/KTX/file_format_spec/
+typedef struct IBLFileHeader {
+    unsigned char id[12];               // Identifier: "«KTX 11»\r\n\x1A\n"
+    unsigned int endianness;            // Little endian: 0x04030201
+    unsigned int glType;                // Pixel data type (GL_HALF_FLOAT)
+    unsigned int glTypeSize;            // Pixel data type size (2 bytes)
+    unsigned int glFormat;              // Pixel data format (GL_RGB)
+    unsigned int glInternalFormat;      // Texture internal format (GL_RGB16F)
+    unsigned int glBaseInternalFormat;  // Texture base internal format (GL_RGB)
+    unsigned int width;                 // Texture width
+    unsigned int height;                // Texture height
+    unsigned int depth;                 // Texture depth, 0 for 2D textures and cubemaps
+    unsigned int elements;              // Texture array elements, 0 for no array
+    unsigned int faces;                 // Cubemap faces (6), 1 for 2D textures
+    unsigned int mipmapLevels;          // Mipmap levels stored
+    unsigned int keyValueDataSize;      // Key-value data size, skipped
+} IBLFileHeader;
+
+// Export IBL texture (generated cubemap, irradiance, prefilter or BRDF LUT) to KTX file
+// NOTE: Data is stored as half float RGB (all faces and texture.mipmaps levels), so IBL maps can be
+// generated once at build time and loaded by LoadTextureIBL() skipping all rendering passes
+bool ExportTextureIBL(Texture2D texture, bool isCubemap, const char *fileName)
+{
+    bool success = false;
+
+#if defined(GRAPHICS_API_OPENGL_33)
+    ReleaseMeshState();
+
+    FILE *ktxFile = fopen(fileName, "wb");
+
+    if (ktxFile == NULL) TraceLog(LOG_WARNING, "[%s] IBL texture file could not be created", fileName);
+    else
+    {
+        int faces = isCubemap? 6 : 1;
+        int mipmaps = (texture.mipmaps > 1)? texture.mipmaps : 1;
+        GLenum target = isCubemap? GL_TEXTURE_CUBE_MAP : GL_TEXTURE_2D;
+
+        IBLFileHeader header = { { 0xAB, 'K', 'T', 'X', ' ', '1', '1', 0xBB, '\r', '\n', 0x1A, '\n' }, 0x04030201,
+            GL_HALF_FLOAT, 2, GL_RGB, GL_RGB16F, GL_RGB, texture.width, texture.height, 0, 0, faces, mipmaps, 0 };
+
+        success = (fwrite(&header, sizeof(IBLFileHeader), 1, ktxFile) == 1);
+
+        glBindTexture(target, texture.id);
+
+        // NOTE: KTX rows are 4 bytes aligned
+        glPixelStorei(GL_PACK_ALIGNMENT, 4);
+
+        for (int level = 0; (level < mipmaps) && success; level++)
+        {
+            int width = (texture.width >> level) > 0? (texture.width >> level) : 1;
+            int height = (texture.height >> level) > 0? (texture.height >> level) : 1;
+            unsigned int faceSize = ((width*3*2 + 3) & ~3)*height;
+
+            unsigned char *data = (unsigned char *)RL_MALLOC(faceSize);
+
+            success = (fwrite(&faceSize, sizeof(unsigned int), 1, ktxFile) == 1);
+
+            for (int face = 0; (face < faces) && success; face++)
+            {
+                glGetTexImage(isCubemap? (GL_TEXTURE_CUBE_MAP_POSITIVE_X + face) : GL_TEXTURE_2D, level, GL_RGB, GL_HALF_FLOAT, data);
+                success = (fwrite(data, faceSize, 1, ktxFile) == 1);
+            }
+
+            RL_FREE(data);
+        }
+
+        glPixelStorei(GL_PACK_ALIGNMENT, 1);
+        glBindTexture(target, 0);
+
+        fclose(ktxFile);
+
+        if (success) TraceLog(LOG_INFO, "[TEX ID %i] IBL texture exported successfully [%s] (%i faces, %i mipmaps)", texture.id, fileName, faces, mipmaps);
+        else TraceLog(LOG_WARNING, "[%s] IBL texture data could not be written", fileName);
+    }
+#else
+    TraceLog(LOG_WARNING, "[%s] IBL texture export requires OpenGL 3.3 (texture data readback)", fileName);
+#endif
+
+    return success;
+}
+
+// Load IBL texture from KTX file exported by ExportTextureIBL()
+// NOTE: Returned texture is a GL_TEXTURE_CUBE_MAP if file stores 6 faces, sampling parameters set as generated textures
+Texture2D LoadTextureIBL(const char *fileName)
+{
+    Texture2D texture = { 0 };
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    ReleaseMeshState();
+
+    FILE *ktxFile = fopen(fileName, "rb");
+
+    if (ktxFile == NULL)
+    {
+        TraceLog(LOG_WARNING, "[%s] IBL texture file could not be opened", fileName);
+        return texture;
+    }
+
+    IBLFileHeader header = { 0 };
+
+    if ((fread(&header, sizeof(IBLFileHeader), 1, ktxFile) != 1) || (memcmp(header.id + 1, "KTX 11", 6) != 0) ||
+        (header.endianness != 0x04030201) || (header.glType != GL_HALF_FLOAT) || (header.glFormat != GL_RGB) ||
+        ((header.faces != 1) && (header.faces != 6)) || (header.width == 0) || (header.height == 0))
+    {
+        TraceLog(LOG_WARNING, "[%s] IBL texture file not valid (half float RGB KTX required)", fileName);
+        fclose(ktxFile);
+        return texture;
+    }
+
+#if defined(GRAPHICS_API_OPENGL_ES2)
+    // NOTE: Half float data is converted to float on loading
+    if (!texFloatSupported)
+    {
+        TraceLog(LOG_WARNING, "[%s] IBL texture requires float textures support (OES_texture_float)", fileName);
+        fclose(ktxFile);
+        return texture;
+    }
+#endif
+
+    fseek(ktxFile, header.keyValueDataSize, SEEK_CUR);
+
+    bool isCubemap = (header.faces == 6);
+    int mipmaps = (header.mipmapLevels > 1)? header.mipmapLevels : 1;
+    GLenum target = isCubemap? GL_TEXTURE_CUBE_MAP : GL_TEXTURE_2D;
+    bool success = true;
+
+    glGenTextures(1, &texture.id);
+    glBindTexture(target, texture.id);
+
+    // NOTE: KTX rows are 4 bytes aligned
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+
+    for (int level = 0; (level < mipmaps) && success; level++)
+    {
+        int width = (header.width >> level) > 0? (header.width >> level) : 1;
+        int height = (header.height >> level) > 0? (header.height >> level) : 1;
+        int rowSize = (width*3*2 + 3) & ~3;
+        unsigned int faceSize = 0;
+
+        success = (fread(&faceSize, sizeof(unsigned int), 1, ktxFile) == 1) && (faceSize == (unsigned int)(rowSize*height));
+
+        unsigned char *data = success? (unsigned char *)RL_MALLOC(faceSize) : NULL;
+#if defined(GRAPHICS_API_OPENGL_ES2)
+        float *floats = success? (float *)RL_MALLOC(width*height*3*sizeof(float)) : NULL;
+#endif
+
+        for (int face = 0; (face < (int)header.faces) && success; face++)
+        {
+            success = (fread(data, faceSize, 1, ktxFile) == 1);
+            if (!success) break;
+
+            GLenum faceTarget = isCubemap? (GL_TEXTURE_CUBE_MAP_POSITIVE_X + face) : GL_TEXTURE_2D;
+#if defined(GRAPHICS_API_OPENGL_33)
+            glTexImage2D(faceTarget, level, GL_RGB16F, width, height, 0, GL_RGB, GL_HALF_FLOAT, data);
+#elif defined(GRAPHICS_API_OPENGL_ES2)
+            for (int y = 0; y < height; y++)
+            {
+                const unsigned short *row = (const unsigned short *)(data + y*rowSize);
+                for (int x = 0; x < width*3; x++) floats[y*width*3 + x] = HalfToFloat(row[x]);
+            }
+
+            glTexImage2D(faceTarget, level, GL_RGB, width, height, 0, GL_RGB, GL_FLOAT, floats);
+#endif
+        }
+
+        RL_FREE(data);
+#if defined(GRAPHICS_API_OPENGL_ES2)
+        RL_FREE(floats);
+#endif
+    }
+
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+
+    fclose(ktxFile);
+
+    if (!success)
+    {
+        TraceLog(LOG_WARNING, "[%s] IBL texture data could not be read", fileName);
+        glBindTexture(target, 0);
+        glDeleteTextures(1, &texture.id);
+        return (Texture2D){ 0 };
+    }
+
+#if defined(GRAPHICS_API_OPENGL_ES2)
+    // NOTE: OpenGL ES 2.0 requires complete mipmaps chain (no GL_TEXTURE_MAX_LEVEL),
+    // levels not stored are allocated but never sampled (prefilter only uses stored levels)
+    if (mipmaps > 1)
+    {
+        for (int level = mipmaps; ((header.width >> level) > 0) || ((header.height >> level) > 0); level++)
+        {
+            int width = (header.width >> level) > 0? (header.width >> level) : 1;
+            int height = (header.height >> level) > 0? (header.height >> level) : 1;
+
+            for (int face = 0; face < (int)header.faces; face++)
+            {
+                glTexImage2D(isCubemap? (GL_TEXTURE_CUBE_MAP_POSITIVE_X + face) : GL_TEXTURE_2D, level, GL_RGB, width, height, 0, GL_RGB, GL_FLOAT, NULL);
+            }
+        }
+    }
+#endif
+
+    glTexParameteri(target, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(target, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    glTexParameteri(target, GL_TEXTURE_MIN_FILTER, (mipmaps > 1)? GL_LINEAR_MIPMAP_LINEAR : GL_LINEAR);
+    glTexParameteri(target, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+#if defined(GRAPHICS_API_OPENGL_33)
+    glTexParameteri(target, GL_TEXTURE_MAX_LEVEL, mipmaps - 1);
+    if (isCubemap)
+    {
+        glTexParameteri(target, GL_TEXTURE_WRAP_R, GL_CLAMP_TO_EDGE);
+        glEnable(GL_TEXTURE_CUBE_MAP_SEAMLESS);     // NOTE: Enabled by GenTextureCubemap() when generating
+    }
+#endif
+
+    glBindTexture(target, 0);
+
+    // NOTE: Texture2D is a GL_TEXTURE_CUBE_MAP for cubemaps, not a GL_TEXTURE_2D!
+    texture.width = header.width;
+    texture.height = header.height;
+    texture.mipmaps = mipmaps;
+    texture.format = UNCOMPRESSED_R32G32B32;
+
+    TraceLog(LOG_INFO, "[TEX ID %i] IBL texture loaded successfully [%s] (%i faces, %i mipmaps)", texture.id, fileName, header.faces, mipmaps);
+#endif
+
+    return texture;
+}
+
+// Begin blending mode (alpha, additive, multiplied, alpha into render target)
+// NOTE: Only 4 blending modes supported, default blend mode is alpha
+void BeginBlendMode(int mode)
+{
+    if ((blendMode != mode) && (mode < 4))
+    {
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+        // NOTE: Blend mode is registered per draw call, batch is not flushed
+        UpdateDrawState(mode, scissorTest, scissorRect[0], scissorRect[1], scissorRect[2], scissorRect[3]);
+#else
+        rlglDraw();
+#endif
+        SetBlendFunction(mode);
+
+        blendMode = mode;
+        CAPTURE_STATE(CAPTURE_STATE_BLEND_MODE, mode, 0, 0, 0);
+    }
+}
+
+// End blending mode (reset to default: alpha blending)
+void EndBlendMode(void)
+{
+    BeginBlendMode(BLEND_ALPHA);
+}
+
+// Get render statistics of last frame
+// NOTE: Statistics are stored and reset on EndDrawing()
+RenderStats GetRenderStats(void)
+{
+    return renderStatsFrame;
+}
+
+#if defined(SUPPORT_VR_SIMULATOR)
+// Init VR simulator for selected device parameters
+// NOTE: It modifies the global variable: stereoFbo
+void InitVrSimulator(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    // Initialize framebuffer and textures for stereo rendering
+    // NOTE: Screen size should match HMD aspect ratio
+    stereoFbo = rlLoadRenderTexture(framebufferWidth, framebufferHeight, UNCOMPRESSED_R8G8B8A8, 24, false);
+
+    vrSimulatorReady = true;
+#else
+    TraceLog(LOG_WARNING, "VR Simulator not supported on OpenGL 1.1");
+#endif
+}
+
+// Update VR tracking (position and orientation) and camera
+// NOTE: Camera (position, target, up) gets update with head tracking information
+void UpdateVrTracking(Camera *camera)
+{
+    // TODO: Simulate 1st person camera system
+}
+
+// Close VR simulator for current device
+void CloseVrSimulator(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (vrSimulatorReady) rlDeleteRenderTextures(stereoFbo);        // Unload stereo framebuffer and texture
+#endif
+}
+
+// Set stereo rendering configuration parameters
+void SetVrConfiguration(VrDeviceInfo hmd, Shader distortion)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    // Reset vrConfig for a new values assignment
+    memset(&vrConfig, 0, sizeof(vrConfig));
+
+    // Assign distortion shader
+    vrConfig.distortionShader = distortion;
+
+    // Compute aspect ratio
+    float aspect = ((float)hmd.hResolution*0.5f)/(float)hmd.vResolution;
+
+    // Compute lens parameters
+    float lensShift = (hmd.hScreenSize*0.25f - hmd.lensSeparationDistance*0.5f)/hmd.hScreenSize;
+    float leftLensCenter[2] = { 0.25f + lensShift, 0.5f };
+    float rightLensCenter[2] = { 0.75f - lensShift, 0.5f };
+    float leftScreenCenter[2] = { 0.25f, 0.5f };
+    float rightScreenCenter[2] = { 0.75f, 0.5f };
+
+    // Compute distortion scale parameters
+    // NOTE: To get lens max radius, lensShift must be normalized to [-1..1]
+    float lensRadius = (float)fabs(-1.0f - 4.0f*lensShift);
+    float lensRadiusSq = lensRadius*lensRadius;
+    float distortionScale = hmd.lensDistortionValues[0] +
+                            hmd.lensDistortionValues[1]*lensRadiusSq +
+                            hmd.lensDistortionValues[2]*lensRadiusSq*lensRadiusSq +
+                            hmd.lensDistortionValues[3]*lensRadiusSq*lensRadiusSq*lensRadiusSq;
+
+    TraceLog(LOG_DEBUG, "VR: Distortion Scale: %f", distortionScale);
+
+    float normScreenWidth = 0.5f;
+    float normScreenHeight = 1.0f;
+    float scaleIn[2] = { 2.0f/normScreenWidth, 2.0f/normScreenHeight/aspect };
+    float scale[2] = { normScreenWidth*0.5f/distortionScale, normScreenHeight*0.5f*aspect/distortionScale };
+
+    TraceLog(LOG_DEBUG, "VR: Distortion Shader: LeftLensCenter = { %f, %f }", leftLensCenter[0], leftLensCenter[1]);
+    TraceLog(LOG_DEBUG, "VR: Distortion Shader: RightLensCenter = { %f, %f }", rightLensCenter[0], rightLensCenter[1]);
+    TraceLog(LOG_DEBUG, "VR: Distortion Shader: Scale = { %f, %f }", scale[0], scale[1]);
+    TraceLog(LOG_DEBUG, "VR: Distortion Shader: ScaleIn = { %f, %f }", scaleIn[0], scaleIn[1]);
+
+    // Fovy is normally computed with: 2*atan2(hmd.vScreenSize, 2*hmd.eyeToScreenDistance)
+    // ...but with lens distortion it is increased (see Oculus SDK Documentation)
+    //float fovy = 2.0f*atan2(hmd.vScreenSize*0.5f*distortionScale, hmd.eyeToScreenDistance);     // Really need distortionScale?
+    float fovy = 2.0f*(float)atan2(hmd.vScreenSize*0.5f, hmd.eyeToScreenDistance);
+
+    // Compute camera projection matrices
+    float projOffset = 4.0f*lensShift;      // Scaled to projection space coordinates [-1..1]
+    Matrix proj = MatrixPerspective(fovy, aspect, DEFAULT_NEAR_CULL_DISTANCE, DEFAULT_FAR_CULL_DISTANCE);
+    vrConfig.eyesProjection[0] = MatrixMultiply(proj, MatrixTranslate(projOffset, 0.0f, 0.0f));
+    vrConfig.eyesProjection[1] = MatrixMultiply(proj, MatrixTranslate(-projOffset, 0.0f, 0.0f));
+
+    // Compute camera transformation matrices
+    // NOTE: Camera movement might seem more natural if we model the head.
+    // Our axis of rotation is the base of our head, so we might want to add
+    // some y (base of head to eye level) and -z (center of head to eye protrusion) to the camera positions.
+    vrConfig.eyesViewOffset[0] = MatrixTranslate(-hmd.interpupillaryDistance*0.5f, 0.075f, 0.045f);
+    vrConfig.eyesViewOffset[1] = MatrixTranslate(hmd.interpupillaryDistance*0.5f, 0.075f, 0.045f);
+
+    // Compute eyes Viewports
+    vrConfig.eyeViewportRight[2] = hmd.hResolution/2;
+    vrConfig.eyeViewportRight[3] = hmd.vResolution;
+
+    vrConfig.eyeViewportLeft[0] = hmd.hResolution/2;
+    vrConfig.eyeViewportLeft[1] = 0;
+    vrConfig.eyeViewportLeft[2] = hmd.hResolution/2;
+    vrConfig.eyeViewportLeft[3] = hmd.vResolution;
+
+    if (vrConfig.distortionShader.id > 0)
+    {
+        // Update distortion shader with lens and distortion-scale parameters
+        SetShaderValue(vrConfig.distortionShader, GetShaderLocation(vrConfig.distortionShader, "leftLensCenter"), leftLensCenter, UNIFORM_VEC2);
+        SetShaderValue(vrConfig.distortionShader, GetShaderLocation(vrConfig.distortionShader, "rightLensCenter"), rightLensCenter, UNIFORM_VEC2);
+        SetShaderValue(vrConfig.distortionShader, GetShaderLocation(vrConfig.distortionShader, "leftScreenCenter"), leftScreenCenter, UNIFORM_VEC2);
+        SetShaderValue(vrConfig.distortionShader, GetShaderLocation(vrConfig.distortionShader, "rightScreenCenter"), rightScreenCenter, UNIFORM_VEC2);
+
+        SetShaderValue(vrConfig.distortionShader, GetShaderLocation(vrConfig.distortionShader, "scale"), scale, UNIFORM_VEC2);
+        SetShaderValue(vrConfig.distortionShader, GetShaderLocation(vrConfig.distortionShader, "scaleIn"), scaleIn, UNIFORM_VEC2);
+        SetShaderValue(vrConfig.distortionShader, GetShaderLocation(vrConfig.distortionShader, "hmdWarpParam"), hmd.lensDistortionValues, UNIFORM_VEC4);
+        SetShaderValue(vrConfig.distortionShader, GetShaderLocation(vrConfig.distortionShader, "chromaAbParam"), hmd.chromaAbCorrection, UNIFORM_VEC4);
+    }
+#endif
+}
+
+// Detect if VR simulator is running
+bool IsVrSimulatorReady(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    return vrSimulatorReady;
+#else
+    return false;
+#endif
+}
+
+// Enable/Disable VR experience (device or simulator)
+void ToggleVrMode(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    vrSimulatorReady = !vrSimulatorReady;
+
+    if (!vrSimulatorReady)
+    {
+        vrStereoRender = false;
+
+        // Reset viewport and default projection-modelview matrices
+        rlViewport(0, 0, framebufferWidth, framebufferHeight);
+        projection = MatrixOrtho(0.0, framebufferWidth, framebufferHeight, 0.0, 0.0, 1.0);
+        modelview = MatrixIdentity();
+    }
+    else vrStereoRender = true;
+#endif
+}
+
+// Begin VR drawing configuration
+void BeginVrDrawing(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (vrSimulatorReady)
+    {
+
+        rlEnableRenderTexture(stereoFbo.id);    // Setup framebuffer for stereo rendering
+        //glEnable(GL_FRAMEBUFFER_SRGB);        // Enable SRGB framebuffer (only if required)
+
+        //glViewport(0, 0, buffer.width, buffer.height);    // Useful if rendering to separate framebuffers (every eye)
+        rlClearScreenBuffers();                 // Clear current framebuffer
+
+        vrStereoRender = true;
+    }
+#endif
+}
+
+// End VR drawing process (and desktop mirror)
+void EndVrDrawing(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (vrSimulatorReady)
+    {
+        vrStereoRender = false;         // Disable stereo render
+
+        rlDisableRenderTexture();       // Unbind current framebuffer
+
+        rlClearScreenBuffers();         // Clear current framebuffer
+
+        // Set viewport to default framebuffer size (screen size)
+        rlViewport(0, 0, framebufferWidth, framebufferHeight);
+
+        // Let rlgl reconfigure internal matrices
+        rlMatrixMode(RL_PROJECTION);                            // Enable internal projection matrix
+        rlLoadIdentity();                                       // Reset internal projection matrix
+        rlOrtho(0.0, framebufferWidth, framebufferHeight, 0.0, 0.0, 1.0); // Recalculate internal projection matrix
+        rlMatrixMode(RL_MODELVIEW);                             // Enable internal modelview matrix
+        rlLoadIdentity();                                       // Reset internal modelview matrix
+
+        // Draw RenderTexture (stereoFbo) using distortion shader if available
+        if (vrConfig.distortionShader.id > 0) currentShader = vrConfig.distortionShader;
+        else currentShader = GetShaderDefault();
+
+        rlEnableTexture(stereoFbo.texture.id);
+
+        rlPushMatrix();
+            rlBegin(RL_QUADS);
+                rlColor4ub(255, 255, 255, 255);
+                rlNormal3f(0.0f, 0.0f, 1.0f);
+
+                // Bottom-left corner for texture and quad
+                rlTexCoord2f(0.0f, 1.0f);
+                rlVertex2f(0.0f, 0.0f);
+
+                // Bottom-right corner for texture and quad
+                rlTexCoord2f(0.0f, 0.0f);
+                rlVertex2f(0.0f, (float)stereoFbo.texture.height);
+
+                // Top-right corner for texture and quad
+                rlTexCoord2f(1.0f, 0.0f);
+                rlVertex2f( (float)stereoFbo.texture.width, (float)stereoFbo.texture.height);
+
+                // Top-left corner for texture and quad
+                rlTexCoord2f(1.0f, 1.0f);
+                rlVertex2f( (float)stereoFbo.texture.width, 0.0f);
+            rlEnd();
+        rlPopMatrix();
+
+        rlDisableTexture();
+
+        // Update and draw render texture fbo with distortion to backbuffer
+        UpdateBatchBuffers(currentBatch);
+        DrawBatchBuffers(currentBatch);
+        ResetBatch(currentBatch);
+
+        // Restore defaultShader
+        currentShader = defaultShader;
+
+        // Reset viewport and default projection-modelview matrices
+        rlViewport(0, 0, framebufferWidth, framebufferHeight);
+        projection = MatrixOrtho(0.0, framebufferWidth, framebufferHeight, 0.0, 0.0, 1.0);
+        modelview = MatrixIdentity();
+
+        rlDisableDepthTest();
+    }
+#endif
+}
+#endif          // SUPPORT_VR_SIMULATOR
+
+//----------------------------------------------------------------------------------
+// Module specific Functions Definition
+//----------------------------------------------------------------------------------
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+// Compile custom shader and return shader id
+static unsigned int CompileShader(const char *shaderStr, int type)
+{
+    unsigned int shader = glCreateShader(type);
+    glShaderSource(shader, 1, &shaderStr, NULL);
+
+    GLint success = 0;
+    glCompileShader(shader);
+    glGetShaderiv(shader, GL_COMPILE_STATUS, &success);
+
+    if (success != GL_TRUE)
+    {
+        TraceLog(LOG_WARNING, "[SHDR ID %i] Failed to compile shader...", shader);
+        int maxLength = 0;
+        int length;
+        glGetShaderiv(shader, GL_INFO_LOG_LENGTH, &maxLength);
+
+#if defined(_MSC_VER)
+        char *log = RL_MALLOC(maxLength);
+#else
+        char log[maxLength];
+#endif
+        glGetShaderInfoLog(shader, maxLength, &length, log);
+
+        TraceLog(LOG_INFO, "%s", log);
+
+#if defined(_MSC_VER)
+        RL_FREE(log);
+#endif
+    }
+    else TraceLog(LOG_INFO, "[SHDR ID %i] Shader compiled successfully", shader);
+
+    return shader;
+}
+
+// Load custom shader strings and return program id
+static unsigned int LoadShaderProgram(unsigned int vShaderId, unsigned int fShaderId)
+{
+    unsigned int program = 0;
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+
+    GLint success = 0;
+    program = glCreateProgram();
+
+    glAttachShader(program, vShaderId);
+    glAttachShader(program, fShaderId);
+
+    // NOTE: Default attribute shader locations must be binded before linking
+    glBindAttribLocation(program, 0, DEFAULT_ATTRIB_POSITION_NAME);
+    glBindAttribLocation(program, 1, DEFAULT_ATTRIB_TEXCOORD_NAME);
+    glBindAttribLocation(program, 2, DEFAULT_ATTRIB_NORMAL_NAME);
+    glBindAttribLocation(program, 3, DEFAULT_ATTRIB_COLOR_NAME);
+    glBindAttribLocation(program, 4, DEFAULT_ATTRIB_TANGENT_NAME);
+    glBindAttribLocation(program, 5, DEFAULT_ATTRIB_TEXCOORD2_NAME);
+#if defined(SUPPORT_BATCH_MULTITEXTURE)
+    glBindAttribLocation(program, 6, DEFAULT_ATTRIB_TEXUNIT_NAME);
+#endif
+#if defined(SUPPORT_BATCH_TEXTURE_ARRAYS)
+    glBindAttribLocation(program, 7, DEFAULT_ATTRIB_TEXLAYER_NAME);
+#endif
+#if defined(SUPPORT_GPU_SKINNING)
+    // NOTE: Bones attributes alias batch-only attributes locations, they are never used by the same program
+    glBindAttribLocation(program, 6, DEFAULT_ATTRIB_BONEIDS_NAME);
+    glBindAttribLocation(program, 7, DEFAULT_ATTRIB_BONEWEIGHTS_NAME);
+#endif
+
+    // NOTE: If some attrib name is no found on the shader, it locations becomes -1
+
+    glLinkProgram(program);
+
+    // NOTE: All uniform variables are intitialised to 0 when a program links
+
+    glGetProgramiv(program, GL_LINK_STATUS, &success);
+
+    if (success == GL_FALSE)
+    {
+        TraceLog(LOG_WARNING, "[SHDR ID %i] Failed to link shader program...", program);
+
+        int maxLength = 0;
+        int length;
+
+        glGetProgramiv(program, GL_INFO_LOG_LENGTH, &maxLength);
+
+#if defined(_MSC_VER)
+        char *log = RL_MALLOC(maxLength);
+#else
+        char log[maxLength];
+#endif
+        glGetProgramInfoLog(program, maxLength, &length, log);
+
+        TraceLog(LOG_INFO, "%s", log);
+
+#if defined(_MSC_VER)
+        RL_FREE(log);
+#endif
+        glDeleteProgram(program);
+
+        program = 0;
+    }
+    else TraceLog(LOG_INFO, "[SHDR ID %i] Shader program loaded successfully", program);
+#endif
+    return program;
+}
+
+// Hash data using FNV-1a (64 bit), continuing from provided hash
+static unsigned long long HashData(unsigned long long hash, const void *data, int size)
+{
+    const unsigned char *bytes = (const unsigned char *)data;
+
+    for (int i = 0; i < size; i++)
+    {
+        hash ^= bytes[i];
+        hash *= 1099511628211ULL;
+    }
+
+    return hash;
+}
+
+// Get shader sources and driver hash, used as shader cache key
+// NOTE: Default shaders sources are retrieved from GPU when not provided
+static unsigned long long GetShaderCacheHash(const char *vsCode, const char *fsCode)
+{
+    unsigned long long hash = 14695981039346656037ULL;
+    const char *codes[2] = { vsCode, fsCode };
+    unsigned int defaultIds[2] = { defaultVShaderId, defaultFShaderId };
+
+    for (int i = 0; i < 2; i++)
+    {
+        if (codes[i] != NULL) hash = HashData(hash, codes[i], strlen(codes[i]));
+        else
+        {
+            int length = 0;
+            glGetShaderiv(defaultIds[i], GL_SHADER_SOURCE_LENGTH, &length);
+
+            if (length > 0)
+            {
+                char *source = (char *)RL_MALLOC(length);
+                glGetShaderSource(defaultIds[i], length, NULL, source);
+                hash = HashData(hash, source, length);
+                RL_FREE(source);
+            }
+        }
+
+        hash = HashData(hash, "\n", 1);   // Separate vertex and fragment sources
+    }
+
+    // Binary depends on driver and attributes bound before linking (LoadShaderProgram())
+    const char *driver[3] = { (const char *)glGetString(GL_VENDOR), (const char *)glGetString(GL_RENDERER), (const char *)glGetString(GL_VERSION) };
+    for (int i = 0; i < 3; i++) if (driver[i] != NULL) hash = HashData(hash, driver[i], strlen(driver[i]) + 1);
+
+#if defined(SUPPORT_BATCH_MULTITEXTURE)
+    hash = HashData(hash, DEFAULT_ATTRIB_TEXUNIT_NAME, strlen(DEFAULT_ATTRIB_TEXUNIT_NAME));
+#endif
+#if defined(SUPPORT_BATCH_TEXTURE_ARRAYS)
+    hash = HashData(hash, DEFAULT_ATTRIB_TEXLAYER_NAME, strlen(DEFAULT_ATTRIB_TEXLAYER_NAME));
+#endif
+
+    return hash;
+}
+
+// Load shader program from cached binary
+// NOTE: Returns 0 if binary is not available or driver rejects it (i.e. driver updated)
+static unsigned int LoadShaderBinary(unsigned long long hash)
+{
+    unsigned int program = 0;
+
+    char fileName[600] = { 0 };
+    sprintf(fileName, "%s/%08x%08x.rlsb", shaderCachePath, (unsigned int)(hash >> 32), (unsigned int)(hash & 0xffffffff));
+
+    FILE *binFile = fopen(fileName, "rb");
+
+    if (binFile != NULL)
+    {
+        ShaderBinaryHeader header = { 0 };
+
+        if ((fread(&header, sizeof(ShaderBinaryHeader), 1, binFile) == 1) && (strncmp(header.id, "rlSB", 4) == 0) &&
+            (header.hashLow == (unsigned int)(hash & 0xffffffff)) && (header.hashHigh == (unsigned int)(hash >> 32)) && (header.size > 0))
+        {
+            void *binary = RL_MALLOC(header.size);
+
+            if (fread(binary, header.size, 1, binFile) == 1)
+            {
+                GLint success = 0;
+                program = glCreateProgram();
+
+                glProgramBinary(program, header.format, binary, header.size);
+                glGetProgramiv(program, GL_LINK_STATUS, &success);
+
+                if (success == GL_FALSE)
+                {
+                    TraceLog(LOG_WARNING, "[%s] Shader program binary rejected by driver, compiling from sources", fileName);
+                    glDeleteProgram(program);
+                    program = 0;
+                }
+                else TraceLog(LOG_INFO, "[SHDR ID %i] Shader program loaded successfully from cache", program);
+            }
+
+            RL_FREE(binary);
+        }
+        else TraceLog(LOG_WARNING, "[%s] Shader program binary not valid, compiling from sources", fileName);
+
+        fclose(binFile);
+    }
+
+    return program;
+}
+
+// Save shader program binary into cache
+static void SaveShaderBinary(unsigned int program, unsigned long long hash)
+{
+    GLint size = 0;
+    glGetProgramiv(program, GL_PROGRAM_BINARY_LENGTH, &size);
+
+    if (size <= 0) return;
+
+    ShaderBinaryHeader header = { { 'r', 'l', 'S', 'B' }, (unsigned int)(hash & 0xffffffff), (unsigned int)(hash >> 32), 0, 0 };
+    void *binary = RL_MALLOC(size);
+
+    GLenum format = 0;
+    GLsizei length = 0;
+    glGetProgramBinary(program, size, &length, &format, binary);
+
+    header.format = format;
+    header.size = length;
+
+    if (length > 0)
+    {
+        char fileName[600] = { 0 };
+        sprintf(fileName, "%s/%08x%08x.rlsb", shaderCachePath, header.hashHigh, header.hashLow);
+
+        FILE *binFile = fopen(fileName, "wb");
+
+        if (binFile != NULL)
+        {
+            fwrite(&header, sizeof(ShaderBinaryHeader), 1, binFile);
+            fwrite(binary, length, 1, binFile);
+            fclose(binFile);
+
+            TraceLog(LOG_INFO, "[SHDR ID %i] Shader program binary saved to cache [%s]", program, fileName);
+        }
+        else TraceLog(LOG_WARNING, "[%s] Shader program binary could not be saved", fileName);
+    }
+
+    RL_FREE(binary);
+}
+
+
+// Load default shader (just vertex positioning and texture coloring)
+// NOTE: This shader program is used for internal buffers
+static Shader LoadShaderDefault(void)
+{
+    Shader shader = { 0 };
+    shader.locs = (int *)RL_CALLOC(MAX_SHADER_LOCATIONS, sizeof(int));
+
+    // NOTE: All locations must be reseted to -1 (no location)
+    for (int i = 0; i < MAX_SHADER_LOCATIONS; i++) shader.locs[i] = -1;
+
+    // Vertex shader directly defined, no external file required
+    const char *defaultVShaderStr =
+#if defined(GRAPHICS_API_OPENGL_21)
+    "#version 120                       \n"
+#elif defined(GRAPHICS_API_OPENGL_ES2)
+    "#version 100                       \n"
+#endif
+#if defined(GRAPHICS_API_OPENGL_ES2) || defined(GRAPHICS_API_OPENGL_21)
+    "attribute vec3 vertexPosition;     \n"
+    "attribute vec2 vertexTexCoord;     \n"
+    "attribute vec4 vertexColor;        \n"
+    "varying vec2 fragTexCoord;         \n"
+    "varying vec4 fragColor;            \n"
+#if defined(SUPPORT_BATCH_MULTITEXTURE)
+    "attribute float vertexTexUnit;     \n"
+    "varying float fragTexUnit;         \n"
+#endif
+#elif defined(GRAPHICS_API_OPENGL_33)
+    "#version 330                       \n"
+    "in vec3 vertexPosition;            \n"
+    "in vec2 vertexTexCoord;            \n"
+    "in vec4 vertexColor;               \n"
+    "out vec2 fragTexCoord;             \n"
+    "out vec4 fragColor;                \n"
+#if defined(SUPPORT_BATCH_MULTITEXTURE)
+    "in float vertexTexUnit;            \n"
+    "out float fragTexUnit;             \n"
+#endif
+#endif
+    "uniform mat4 mvp;                  \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    fragTexCoord = vertexTexCoord; \n"
+    "    fragColor = vertexColor;       \n"
+#if defined(SUPPORT_BATCH_MULTITEXTURE)
+    "    fragTexUnit = vertexTexUnit;   \n"
+#endif
+    "    gl_Position = mvp*vec4(vertexPosition, 1.0); \n"
+    "}                                  \n";
+
+#if defined(SUPPORT_BATCH_MULTITEXTURE)
+    // Fragment shader generated for available texture units, texture unit selected by vertex
+    // NOTE: GLSL 100/120/330 only allow constant-index sampler arrays access, one branch per unit is required
+    char defaultFShaderStr[4096] = { 0 };
+    char line[128] = { 0 };
+
+    strcat(defaultFShaderStr,
+#if defined(GRAPHICS_API_OPENGL_21)
+    "#version 120                       \n"
+#elif defined(GRAPHICS_API_OPENGL_ES2)
+    "#version 100                       \n"
+    "precision mediump float;           \n"
+#endif
+#if defined(GRAPHICS_API_OPENGL_ES2) || defined(GRAPHICS_API_OPENGL_21)
+    "varying vec2 fragTexCoord;         \n"
+    "varying vec4 fragColor;            \n"
+    "varying float fragTexUnit;         \n"
+    #define DEFAULT_SHADER_TEXTURE_FUNC "texture2D"
+    #define DEFAULT_SHADER_OUTPUT       "gl_FragColor"
+#elif defined(GRAPHICS_API_OPENGL_33)
+    "#version 330                       \n"
+    "in vec2 fragTexCoord;              \n"
+    "in vec4 fragColor;                 \n"
+    "in float fragTexUnit;              \n"
+    "out vec4 finalColor;               \n"
+    #define DEFAULT_SHADER_TEXTURE_FUNC "texture"
+    #define DEFAULT_SHADER_OUTPUT       "finalColor"
+#endif
+    "uniform vec4 colDiffuse;           \n");
+
+    sprintf(line, "uniform sampler2D texture0[%i];\n", batchTextureUnits);
+    strcat(defaultFShaderStr, line);
+    strcat(defaultFShaderStr, "void main()\n{\n    int unit = int(fragTexUnit + 0.5);\n    vec4 texelColor = vec4(1.0);\n");
+
+    for (int i = 0; i < batchTextureUnits; i++)
+    {
+        sprintf(line, "    %sif (unit == %i) texelColor = " DEFAULT_SHADER_TEXTURE_FUNC "(texture0[%i], fragTexCoord);\n", (i > 0)? "else " : "", i, i);
+        strcat(defaultFShaderStr, line);
+    }
+
+    strcat(defaultFShaderStr, "    " DEFAULT_SHADER_OUTPUT " = texelColor*colDiffuse*fragColor;\n}\n");
+
+    #undef DEFAULT_SHADER_TEXTURE_FUNC
+    #undef DEFAULT_SHADER_OUTPUT
+#else
+    // Fragment shader directly defined, no external file required
+    const char *defaultFShaderStr =
+#if defined(GRAPHICS_API_OPENGL_21)
+    "#version 120                       \n"
+#elif defined(GRAPHICS_API_OPENGL_ES2)
+    "#version 100                       \n"
+    "precision mediump float;           \n"     // precision required for OpenGL ES2 (WebGL)
+#endif
+#if defined(GRAPHICS_API_OPENGL_ES2) || defined(GRAPHICS_API_OPENGL_21)
+    "varying vec2 fragTexCoord;         \n"
+    "varying vec4 fragColor;            \n"
+#elif defined(GRAPHICS_API_OPENGL_33)
+    "#version 330       \n"
+    "in vec2 fragTexCoord;              \n"
+    "in vec4 fragColor;                 \n"
+    "out vec4 finalColor;               \n"
+#endif
+    "uniform sampler2D texture0;        \n"
+    "uniform vec4 colDiffuse;           \n"
+    "void main()                        \n"
+    "{                                  \n"
+#if defined(GRAPHICS_API_OPENGL_ES2) || defined(GRAPHICS_API_OPENGL_21)
+    "    vec4 texelColor = texture2D(texture0, fragTexCoord); \n" // NOTE: texture2D() is deprecated on OpenGL 3.3 and ES 3.0
+    "    gl_FragColor = texelColor*colDiffuse*fragColor;      \n"
+#elif defined(GRAPHICS_API_OPENGL_33)
+    "    vec4 texelColor = texture(texture0, fragTexCoord);   \n"
+    "    finalColor = texelColor*colDiffuse*fragColor;        \n"
+#endif
+    "}                                  \n";
+#endif
+
+    // NOTE: Compiled vertex/fragment shaders are kept for re-use
+    defaultVShaderId = CompileShader(defaultVShaderStr, GL_VERTEX_SHADER);     // Compile default vertex shader
+    defaultFShaderId = CompileShader(defaultFShaderStr, GL_FRAGMENT_SHADER);   // Compile default fragment shader
+
+    shader.id = LoadShaderProgram(defaultVShaderId, defaultFShaderId);
+
+    if (shader.id > 0)
+    {
+        TraceLog(LOG_INFO, "[SHDR ID %i] Default shader loaded successfully", shader.id);
+
+        // Set default shader locations: attributes locations
+        shader.locs[LOC_VERTEX_POSITION] = glGetAttribLocation(shader.id, "vertexPosition");
+        shader.locs[LOC_VERTEX_TEXCOORD01] = glGetAttribLocation(shader.id, "vertexTexCoord");
+        shader.locs[LOC_VERTEX_COLOR] = glGetAttribLocation(shader.id, "vertexColor");
+
+        // Set default shader locations: uniform locations
+        shader.locs[LOC_MATRIX_MVP]  = glGetUniformLocation(shader.id, "mvp");
+        shader.locs[LOC_COLOR_DIFFUSE] = glGetUniformLocation(shader.id, "colDiffuse");
+        shader.locs[LOC_MAP_DIFFUSE] = glGetUniformLocation(shader.id, "texture0");
+
+#if defined(SUPPORT_BATCH_MULTITEXTURE)
+        // Set texture units for texture0[] samplers array (program uniforms state is kept)
+        int units[MAX_BATCH_TEXTURE_UNITS] = { 0 };
+        for (int i = 0; i < batchTextureUnits; i++) units[i] = i;
+
+        glUseProgram(shader.id);
+        glUniform1iv(shader.locs[LOC_MAP_DIFFUSE], batchTextureUnits, units);
+        glUseProgram(0);
+#endif
+
+        // NOTE: We could also use below function but in case DEFAULT_ATTRIB_* points are
+        // changed for external custom shaders, we just use direct bindings above
+        //SetShaderDefaultLocations(&shader);
+    }
+    else TraceLog(LOG_WARNING, "[SHDR ID %i] Default shader could not be loaded", shader.id);
+
+    return shader;
+}
+
+#if defined(SUPPORT_BATCH_TEXTURE_ARRAYS)
+// Load default texture array shader (same as default shader, sampling texture0 array layer by vertex)
+// NOTE: Used by batch draws with texture array enabled while default shader is active
+static Shader LoadShaderArrayDefault(void)
+{
+    Shader shader = { 0 };
+    shader.locs = (int *)RL_CALLOC(MAX_SHADER_LOCATIONS, sizeof(int));
+
+    for (int i = 0; i < MAX_SHADER_LOCATIONS; i++) shader.locs[i] = -1;
+
+    const char *arrayVShaderStr =
+    "#version 330                       \n"
+    "in vec3 vertexPosition;            \n"
+    "in vec2 vertexTexCoord;            \n"
+    "in vec4 vertexColor;               \n"
+    "in float vertexTexLayer;           \n"
+    "out vec2 fragTexCoord;             \n"
+    "out vec4 fragColor;                \n"
+    "out float fragTexLayer;            \n"
+    "uniform mat4 mvp;                  \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    fragTexCoord = vertexTexCoord; \n"
+    "    fragColor = vertexColor;       \n"
+    "    fragTexLayer = vertexTexLayer; \n"
+    "    gl_Position = mvp*vec4(vertexPosition, 1.0); \n"
+    "}                                  \n";
+
+    const char *arrayFShaderStr =
+    "#version 330                       \n"
+    "in vec2 fragTexCoord;              \n"
+    "in vec4 fragColor;                 \n"
+    "in float fragTexLayer;             \n"
+    "out vec4 finalColor;               \n"
+    "uniform sampler2DArray texture0;   \n"
+    "uniform vec4 colDiffuse;           \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    vec4 texelColor = texture(texture0, vec3(fragTexCoord, fragTexLayer)); \n"
+    "    finalColor = texelColor*colDiffuse*fragColor;        \n"
+    "}                                  \n";
+
+    unsigned int vShaderId = CompileShader(arrayVShaderStr, GL_VERTEX_SHADER);
+    unsigned int fShaderId = CompileShader(arrayFShaderStr, GL_FRAGMENT_SHADER);
+
+    shader.id = LoadShaderProgram(vShaderId, fShaderId);
+
+    // NOTE: Program keeps shaders until deleted, no re-use required
+    glDetachShader(shader.id, vShaderId);
+    glDetachShader(shader.id, fShaderId);
+    glDeleteShader(vShaderId);
+    glDeleteShader(fShaderId);
+
+    if (shader.id > 0)
+    {
+        TraceLog(LOG_INFO, "[SHDR ID %i] Default texture array shader loaded successfully", shader.id);
+
+        // NOTE: Attributes locations are fixed by LoadShaderProgram(), vertexTexLayer = 7
+        shader.locs[LOC_VERTEX_POSITION] = glGetAttribLocation(shader.id, "vertexPosition");
+        shader.locs[LOC_VERTEX_TEXCOORD01] = glGetAttribLocation(shader.id, "vertexTexCoord");
+        shader.locs[LOC_VERTEX_COLOR] = glGetAttribLocation(shader.id, "vertexColor");
+
+        shader.locs[LOC_MATRIX_MVP]  = glGetUniformLocation(shader.id, "mvp");
+        shader.locs[LOC_COLOR_DIFFUSE] = glGetUniformLocation(shader.id, "colDiffuse");
+        shader.locs[LOC_MAP_DIFFUSE] = glGetUniformLocation(shader.id, "texture0");
+    }
+    else TraceLog(LOG_WARNING, "[SHDR ID %i] Default texture array shader could not be loaded", shader.id);
+
+    return shader;
+}
+#endif
+
+#if defined(SUPPORT_GPU_SKINNING)
+// Load default skinning shader (same as default shader, vertex position transformed by weighted bones matrices)
+// NOTE: Used by GPU skinned meshes drawn with default shader
+static Shader LoadShaderSkinDefault(void)
+{
+    Shader shader = { 0 };
+    shader.locs = (int *)RL_CALLOC(MAX_SHADER_LOCATIONS, sizeof(int));
+
+    for (int i = 0; i < MAX_SHADER_LOCATIONS; i++) shader.locs[i] = -1;
+
+    char skinVShaderStr[2048] = { 0 };
+
+    sprintf(skinVShaderStr,
+#if defined(GRAPHICS_API_OPENGL_21)
+    "#version 120                       \n"
+#elif defined(GRAPHICS_API_OPENGL_ES2)
+    "#version 100                       \n"
+#endif
+#if defined(GRAPHICS_API_OPENGL_ES2) || defined(GRAPHICS_API_OPENGL_21)
+    "attribute vec3 vertexPosition;     \n"
+    "attribute vec2 vertexTexCoord;     \n"
+    "attribute vec4 vertexColor;        \n"
+    "attribute vec4 vertexBoneIds;      \n"
+    "attribute vec4 vertexBoneWeights;  \n"
+    "varying vec2 fragTexCoord;         \n"
+    "varying vec4 fragColor;            \n"
+#elif defined(GRAPHICS_API_OPENGL_33)
+    "#version 330                       \n"
+    "in vec3 vertexPosition;            \n"
+    "in vec2 vertexTexCoord;            \n"
+    "in vec4 vertexColor;               \n"
+    "in vec4 vertexBoneIds;             \n"
+    "in vec4 vertexBoneWeights;         \n"
+    "out vec2 fragTexCoord;             \n"
+    "out vec4 fragColor;                \n"
+#endif
+    "uniform mat4 mvp;                  \n"
+    "uniform mat4 boneMatrices[%i];     \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    mat4 skinMatrix = boneMatrices[int(vertexBoneIds.x)]*vertexBoneWeights.x + \n"
+    "                      boneMatrices[int(vertexBoneIds.y)]*vertexBoneWeights.y + \n"
+    "                      boneMatrices[int(vertexBoneIds.z)]*vertexBoneWeights.z + \n"
+    "                      boneMatrices[int(vertexBoneIds.w)]*vertexBoneWeights.w;  \n"
+    "    fragTexCoord = vertexTexCoord; \n"
+    "    fragColor = vertexColor;       \n"
+    "    gl_Position = mvp*skinMatrix*vec4(vertexPosition, 1.0); \n"
+    "}                                  \n", MAX_SHADER_BONES);
+
+    const char *skinFShaderStr =
+#if defined(GRAPHICS_API_OPENGL_21)
+    "#version 120                       \n"
+#elif defined(GRAPHICS_API_OPENGL_ES2)
+    "#version 100                       \n"
+    "precision mediump float;           \n"
+#endif
+#if defined(GRAPHICS_API_OPENGL_ES2) || defined(GRAPHICS_API_OPENGL_21)
+    "varying vec2 fragTexCoord;         \n"
+    "varying vec4 fragColor;            \n"
+#elif defined(GRAPHICS_API_OPENGL_33)
+    "#version 330                       \n"
+    "in vec2 fragTexCoord;              \n"
+    "in vec4 fragColor;                 \n"
+    "out vec4 finalColor;               \n"
+#endif
+    "uniform sampler2D texture0;        \n"
+    "uniform vec4 colDiffuse;           \n"
+    "void main()                        \n"
+    "{                                  \n"
+#if defined(GRAPHICS_API_OPENGL_ES2) || defined(GRAPHICS_API_OPENGL_21)
+    "    vec4 texelColor = texture2D(texture0, fragTexCoord); \n"
+    "    gl_FragColor = texelColor*colDiffuse*fragColor;      \n"
+#elif defined(GRAPHICS_API_OPENGL_33)
+    "    vec4 texelColor = texture(texture0, fragTexCoord);   \n"
+    "    finalColor = texelColor*colDiffuse*fragColor;        \n"
+#endif
+    "}                                  \n";
+
+    unsigned int vShaderId = CompileShader(skinVShaderStr, GL_VERTEX_SHADER);
+    unsigned int fShaderId = CompileShader(skinFShaderStr, GL_FRAGMENT_SHADER);
+
+    shader.id = LoadShaderProgram(vShaderId, fShaderId);
+
+    // NOTE: Program keeps shaders until deleted, no re-use required
+    glDetachShader(shader.id, vShaderId);
+    glDetachShader(shader.id, fShaderId);
+    glDeleteShader(vShaderId);
+    glDeleteShader(fShaderId);
+
+    if (shader.id > 0)
+    {
+        TraceLog(LOG_INFO, "[SHDR ID %i] Default skinning shader loaded successfully (%i bones)", shader.id, MAX_SHADER_BONES);
+
+        // NOTE: Attributes locations are fixed by LoadShaderProgram(), vertexBoneIds = 6, vertexBoneWeights = 7
+        SetShaderDefaultLocations(&shader);
+    }
+    else TraceLog(LOG_WARNING, "[SHDR ID %i] Default skinning shader could not be loaded, meshes skinned on CPU", shader.id);
+
+    return shader;
+}
+#endif
+
+// Load default points shader, default shader variant writing point size and sampling texture by point coordinates
+// NOTE: Used by batch points draws with default shader (point sprites), default shader point size is undefined on ES2
+static Shader LoadShaderPointDefault(void)
+{
+    Shader shader = { 0 };
+    shader.locs = (int *)RL_CALLOC(MAX_SHADER_LOCATIONS, sizeof(int));
+
+    for (int i = 0; i < MAX_SHADER_LOCATIONS; i++) shader.locs[i] = -1;
+
+    const char *pointVShaderStr =
+#if defined(GRAPHICS_API_OPENGL_21)
+    "#version 120                       \n"
+#elif defined(GRAPHICS_API_OPENGL_ES2)
+    "#version 100                       \n"
+#endif
+#if defined(GRAPHICS_API_OPENGL_ES2) || defined(GRAPHICS_API_OPENGL_21)
+    "attribute vec3 vertexPosition;     \n"
+    "attribute vec4 vertexColor;        \n"
+    "varying vec4 fragColor;            \n"
+#elif defined(GRAPHICS_API_OPENGL_33)
+    "#version 330                       \n"
+    "in vec3 vertexPosition;            \n"
+    "in vec4 vertexColor;               \n"
+    "out vec4 fragColor;                \n"
+#endif
+    "uniform mat4 mvp;                  \n"
+    "uniform float pointSize;           \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    fragColor = vertexColor;       \n"
+    "    gl_PointSize = pointSize;      \n"
+    "    gl_Position = mvp*vec4(vertexPosition, 1.0); \n"
+    "}                                  \n";
+
+    const char *pointFShaderStr =
+#if defined(GRAPHICS_API_OPENGL_21)
+    "#version 120                       \n"
+#elif defined(GRAPHICS_API_OPENGL_ES2)
+    "#version 100                       \n"
+    "precision mediump float;           \n"
+#endif
+#if defined(GRAPHICS_API_OPENGL_ES2) || defined(GRAPHICS_API_OPENGL_21)
+    "varying vec4 fragColor;            \n"
+#elif defined(GRAPHICS_API_OPENGL_33)
+    "#version 330                       \n"
+    "in vec4 fragColor;                 \n"
+    "out vec4 finalColor;               \n"
+#endif
+    "uniform sampler2D texture0;        \n"
+    "uniform vec4 colDiffuse;           \n"
+    "void main()                        \n"
+    "{                                  \n"
+#if defined(GRAPHICS_API_OPENGL_ES2) || defined(GRAPHICS_API_OPENGL_21)
+    "    gl_FragColor = texture2D(texture0, gl_PointCoord)*colDiffuse*fragColor; \n"
+#elif defined(GRAPHICS_API_OPENGL_33)
+    "    finalColor = texture(texture0, gl_PointCoord)*colDiffuse*fragColor;     \n"
+#endif
+    "}                                  \n";
+
+    unsigned int vShaderId = CompileShader(pointVShaderStr, GL_VERTEX_SHADER);
+    unsigned int fShaderId = CompileShader(pointFShaderStr, GL_FRAGMENT_SHADER);
+
+    shader.id = LoadShaderProgram(vShaderId, fShaderId);
+
+    // NOTE: Program keeps shaders until deleted, no re-use required
+    glDetachShader(shader.id, vShaderId);
+    glDetachShader(shader.id, fShaderId);
+    glDeleteShader(vShaderId);
+    glDeleteShader(fShaderId);
+
+    if (shader.id > 0)
+    {
+        SetShaderDefaultLocations(&shader);
+        defaultPointSizeLoc = glGetUniformLocation(shader.id, "pointSize");
+
+        TraceLog(LOG_INFO, "[SHDR ID %i] Default points shader loaded successfully", shader.id);
+    }
+    else TraceLog(LOG_WARNING, "[SHDR ID %i] Default points shader could not be loaded", shader.id);
+
+    return shader;
+}
+
+#if defined(SUPPORT_VR_SINGLE_PASS)
+// Load default stereo shader, default shader variant drawing both VR eyes per draw call (2 instances)
+// NOTE: Every eye is drawn on its framebuffer half: clip space x is scaled and offset by eye and
+// a clip distance discards geometry crossing the eyes boundary, default fragment shader is re-used
+static Shader LoadShaderStereoDefault(void)
+{
+    Shader shader = { 0 };
+    shader.locs = (int *)RL_CALLOC(MAX_SHADER_LOCATIONS, sizeof(int));
+
+    for (int i = 0; i < MAX_SHADER_LOCATIONS; i++) shader.locs[i] = -1;
+
+    const char *stereoVShaderStr =
+    "#version 330                       \n"
+    "in vec3 vertexPosition;            \n"
+    "in vec2 vertexTexCoord;            \n"
+    "in vec4 vertexColor;               \n"
+    "out vec2 fragTexCoord;             \n"
+    "out vec4 fragColor;                \n"
+#if defined(SUPPORT_BATCH_MULTITEXTURE)
+    "in float vertexTexUnit;            \n"
+    "out float fragTexUnit;             \n"
+#endif
+    "uniform mat4 mvpEyes[2];           \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    fragTexCoord = vertexTexCoord; \n"
+    "    fragColor = vertexColor;       \n"
+#if defined(SUPPORT_BATCH_MULTITEXTURE)
+    "    fragTexUnit = vertexTexUnit;   \n"
+#endif
+    "    vec4 position = mvpEyes[gl_InstanceID]*vec4(vertexPosition, 1.0); \n"
+    "    float side = (gl_InstanceID == 0)? 1.0 : -1.0; \n"
+    "    gl_ClipDistance[0] = position.w - side*position.x; \n"
+    "    position.x = 0.5*(position.x - side*position.w); \n"
+    "    gl_Position = position;        \n"
+    "}                                  \n";
+
+    unsigned int vShaderId = CompileShader(stereoVShaderStr, GL_VERTEX_SHADER);
+
+    shader.id = LoadShaderProgram(vShaderId, defaultFShaderId);
+
+    // NOTE: Default fragment shader is kept by default shader program, only detached here
+    glDetachShader(shader.id, vShaderId);
+    glDetachShader(shader.id, defaultFShaderId);
+    glDeleteShader(vShaderId);
+
+    if (shader.id > 0)
+    {
+        TraceLog(LOG_INFO, "[SHDR ID %i] Default stereo shader loaded successfully", shader.id);
+
+        shader.locs[LOC_VERTEX_POSITION] = glGetAttribLocation(shader.id, "vertexPosition");
+        shader.locs[LOC_VERTEX_TEXCOORD01] = glGetAttribLocation(shader.id, "vertexTexCoord");
+        shader.locs[LOC_VERTEX_COLOR] = glGetAttribLocation(shader.id, "vertexColor");
+
+        // NOTE: Both eyes matrices are uploaded at once to mvpEyes location
+        shader.locs[LOC_MATRIX_MVP]  = glGetUniformLocation(shader.id, "mvpEyes");
+        shader.locs[LOC_COLOR_DIFFUSE] = glGetUniformLocation(shader.id, "colDiffuse");
+        shader.locs[LOC_MAP_DIFFUSE] = glGetUniformLocation(shader.id, "texture0");
+
+#if defined(SUPPORT_BATCH_MULTITEXTURE)
+        int units[MAX_BATCH_TEXTURE_UNITS] = { 0 };
+        for (int i = 0; i < batchTextureUnits; i++) units[i] = i;
+
+        glUseProgram(shader.id);
+        glUniform1iv(shader.locs[LOC_MAP_DIFFUSE], batchTextureUnits, units);
+        glUseProgram(0);
+#endif
+    }
+    else TraceLog(LOG_WARNING, "[SHDR ID %i] Default stereo shader could not be loaded", shader.id);
+
+    return shader;
+}
+#endif
+
+// Load billboards shader, quad corners expanded by per-instance data
+// NOTE: Only used when instancing is supported (rlDrawBillboards())
+static Shader LoadShaderBillboard(void)
+{
+    Shader shader = { 0 };
+    shader.locs = (int *)RL_CALLOC(MAX_SHADER_LOCATIONS, sizeof(int));
+
+    for (int i = 0; i < MAX_SHADER_LOCATIONS; i++) shader.locs[i] = -1;
+
+    const char *billboardVShaderStr =
+#if defined(GRAPHICS_API_OPENGL_21)
+    "#version 120                       \n"
+#elif defined(GRAPHICS_API_OPENGL_ES2)
+    "#version 100                       \n"
+#endif
+#if defined(GRAPHICS_API_OPENGL_ES2) || defined(GRAPHICS_API_OPENGL_21)
+    "attribute vec2 vertexPosition;     \n"
+    "attribute vec3 instancePosition;   \n"
+    "attribute vec2 instanceSize;       \n"
+    "attribute vec4 instanceColor;      \n"
+    "attribute vec4 instanceTexCoords;  \n"
+    "varying vec2 fragTexCoord;         \n"
+    "varying vec4 fragColor;            \n"
+#elif defined(GRAPHICS_API_OPENGL_33)
+    "#version 330                       \n"
+    "in vec2 vertexPosition;            \n"
+    "in vec3 instancePosition;          \n"
+    "in vec2 instanceSize;              \n"
+    "in vec4 instanceColor;             \n"
+    "in vec4 instanceTexCoords;         \n"
+    "out vec2 fragTexCoord;             \n"
+    "out vec4 fragColor;                \n"
+#endif
+    "uniform mat4 mvp;                  \n"
+    "uniform vec3 billboardRight;       \n"
+    "uniform vec3 billboardUp;          \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    vec3 position = instancePosition + billboardRight*(vertexPosition.x*instanceSize.x) + billboardUp*(vertexPosition.y*instanceSize.y); \n"
+    "    fragTexCoord = vec2(mix(instanceTexCoords.x, instanceTexCoords.z, vertexPosition.x + 0.5), mix(instanceTexCoords.w, instanceTexCoords.y, vertexPosition.y + 0.5)); \n"
+    "    fragColor = instanceColor;     \n"
+    "    gl_Position = mvp*vec4(position, 1.0); \n"
+    "}                                  \n";
+
+    const char *billboardFShaderStr =
+#if defined(GRAPHICS_API_OPENGL_21)
+    "#version 120                       \n"
+#elif defined(GRAPHICS_API_OPENGL_ES2)
+    "#version 100                       \n"
+    "precision mediump float;           \n"
+#endif
+#if defined(GRAPHICS_API_OPENGL_ES2) || defined(GRAPHICS_API_OPENGL_21)
+    "varying vec2 fragTexCoord;         \n"
+    "varying vec4 fragColor;            \n"
+#elif defined(GRAPHICS_API_OPENGL_33)
+    "#version 330                       \n"
+    "in vec2 fragTexCoord;              \n"
+    "in vec4 fragColor;                 \n"
+    "out vec4 finalColor;               \n"
+#endif
+    "uniform sampler2D texture0;        \n"
+    "void main()                        \n"
+    "{                                  \n"
+#if defined(GRAPHICS_API_OPENGL_ES2) || defined(GRAPHICS_API_OPENGL_21)
+    "    gl_FragColor = texture2D(texture0, fragTexCoord)*fragColor; \n"
+#elif defined(GRAPHICS_API_OPENGL_33)
+    "    finalColor = texture(texture0, fragTexCoord)*fragColor;     \n"
+#endif
+    "}                                  \n";
+
+    unsigned int vShaderId = CompileShader(billboardVShaderStr, GL_VERTEX_SHADER);
+    unsigned int fShaderId = CompileShader(billboardFShaderStr, GL_FRAGMENT_SHADER);
+
+    shader.id = LoadShaderProgram(vShaderId, fShaderId);
+
+    // NOTE: Program keeps shaders until deleted, no re-use required
+    glDetachShader(shader.id, vShaderId);
+    glDetachShader(shader.id, fShaderId);
+    glDeleteShader(vShaderId);
+    glDeleteShader(fShaderId);
+
+    if (shader.id > 0)
+    {
+        // NOTE: Quad corners use vertexPosition location (0), per-instance attributes locations are assigned on linking
+        SetShaderDefaultLocations(&shader);
+
+        billboardLocs[0] = glGetUniformLocation(shader.id, "billboardRight");
+        billboardLocs[1] = glGetUniformLocation(shader.id, "billboardUp");
+        billboardLocs[2] = glGetAttribLocation(shader.id, "instancePosition");
+        billboardLocs[3] = glGetAttribLocation(shader.id, "instanceSize");
+        billboardLocs[4] = glGetAttribLocation(shader.id, "instanceColor");
+        billboardLocs[5] = glGetAttribLocation(shader.id, "instanceTexCoords");
+
+        TraceLog(LOG_INFO, "[SHDR ID %i] Billboards shader loaded successfully", shader.id);
+    }
+    else TraceLog(LOG_WARNING, "[SHDR ID %i] Billboards shader could not be loaded, billboards expanded on CPU", shader.id);
+
+    return shader;
+}
+
+// Load SDF shapes shader, quad corners expanded by per-instance center, half size and rotation
+// NOTE: Quad is expanded by one pixel (in shape units) to fit antialiased edges, fragment distance
+// to rounded box is converted to coverage by pixel size, no derivatives required
+static Shader LoadShaderShapeSDF(void)
+{
+    Shader shader = { 0 };
+    shader.locs = (int *)RL_CALLOC(MAX_SHADER_LOCATIONS, sizeof(int));
+
+    for (int i = 0; i < MAX_SHADER_LOCATIONS; i++) shader.locs[i] = -1;
+
+    const char *shapeVShaderStr =
+#if defined(GRAPHICS_API_OPENGL_21)
+    "#version 120                       \n"
+#elif defined(GRAPHICS_API_OPENGL_ES2)
+    "#version 100                       \n"
+#endif
+#if defined(GRAPHICS_API_OPENGL_ES2) || defined(GRAPHICS_API_OPENGL_21)
+    "attribute vec2 vertexPosition;     \n"
+    "attribute vec3 instancePosition;   \n"
+    "attribute vec2 instanceSize;       \n"
+    "attribute vec2 instanceAxis;       \n"
+    "attribute vec2 instanceParams;     \n"
+    "attribute vec4 instanceColor;      \n"
+    "varying vec2 fragPosition;         \n"
+    "varying vec2 fragSize;             \n"
+    "varying vec2 fragParams;           \n"
+    "varying float fragPixel;           \n"
+    "varying vec4 fragColor;            \n"
+#elif defined(GRAPHICS_API_OPENGL_33)
+    "#version 330                       \n"
+    "in vec2 vertexPosition;            \n"
+    "in vec3 instancePosition;          \n"
+    "in vec2 instanceSize;              \n"
+    "in vec2 instanceAxis;              \n"
+    "in vec2 instanceParams;            \n"
+    "in vec4 instanceColor;             \n"
+    "out vec2 fragPosition;             \n"
+    "out vec2 fragSize;                 \n"
+    "out vec2 fragParams;               \n"
+    "out float fragPixel;               \n"
+    "out vec4 fragColor;                \n"
+#endif
+    "uniform mat4 mvp;                  \n"
+    "uniform vec2 viewportSize;         \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    fragPixel = 1.0/max(length(mvp[0].xy*viewportSize*0.5), 0.0001); \n"
+    "    fragPosition = vertexPosition*(instanceSize + fragPixel); \n"
+    "    fragSize = instanceSize;       \n"
+    "    fragParams = instanceParams;   \n"
+    "    fragColor = instanceColor;     \n"
+    "    vec2 position = instancePosition.xy + vec2(fragPosition.x*instanceAxis.x - fragPosition.y*instanceAxis.y, fragPosition.x*instanceAxis.y + fragPosition.y*instanceAxis.x); \n"
+    "    gl_Position = mvp*vec4(position, instancePosition.z, 1.0); \n"
+    "}                                  \n";
+
+    const char *shapeFShaderStr =
+#if defined(GRAPHICS_API_OPENGL_21)
+    "#version 120                       \n"
+#elif defined(GRAPHICS_API_OPENGL_ES2)
+    "#version 100                       \n"
+    "precision mediump float;           \n"
+#endif
+#if defined(GRAPHICS_API_OPENGL_ES2) || defined(GRAPHICS_API_OPENGL_21)
+    "varying vec2 fragPosition;         \n"
+    "varying vec2 fragSize;             \n"
+    "varying vec2 fragParams;           \n"
+    "varying float fragPixel;           \n"
+    "varying vec4 fragColor;            \n"
+#elif defined(GRAPHICS_API_OPENGL_33)
+    "#version 330                       \n"
+    "in vec2 fragPosition;              \n"
+    "in vec2 fragSize;                  \n"
+    "in vec2 fragParams;                \n"
+    "in float fragPixel;                \n"
+    "in vec4 fragColor;                 \n"
+    "out vec4 finalColor;               \n"
+#endif
+    "void main()                        \n"
+    "{                                  \n"
+    "    vec2 q = abs(fragPosition) - fragSize + fragParams.x; \n"
+    "    float d = length(max(q, 0.0)) + min(max(q.x, q.y), 0.0) - fragParams.x; \n"
+    "    if (fragParams.y > 0.0) d = abs(d + 0.5*fragParams.y) - 0.5*fragParams.y; \n"
+    "    float alpha = clamp(0.5 - d/fragPixel, 0.0, 1.0); \n"
+#if defined(GRAPHICS_API_OPENGL_ES2) || defined(GRAPHICS_API_OPENGL_21)
+    "    gl_FragColor = vec4(fragColor.rgb, fragColor.a*alpha); \n"
+#elif defined(GRAPHICS_API_OPENGL_33)
+    "    finalColor = vec4(fragColor.rgb, fragColor.a*alpha);   \n"
+#endif
+    "}                                  \n";
+
+    unsigned int vShaderId = CompileShader(shapeVShaderStr, GL_VERTEX_SHADER);
+    unsigned int fShaderId = CompileShader(shapeFShaderStr, GL_FRAGMENT_SHADER);
+
+    shader.id = LoadShaderProgram(vShaderId, fShaderId);
+
+    // NOTE: Program keeps shaders until deleted, no re-use required
+    glDetachShader(shader.id, vShaderId);
+    glDetachShader(shader.id, fShaderId);
+    glDeleteShader(vShaderId);
+    glDeleteShader(fShaderId);
+
+    if (shader.id > 0)
+    {
+        // NOTE: Quad corners use vertexPosition location (0), per-instance attributes locations are assigned on linking
+        SetShaderDefaultLocations(&shader);
 
-            glUniform1i(material.shader.locs[LOC_MAP_DIFFUSE + i], i);
-        }
+        shapeSDFLocs[0] = glGetUniformLocation(shader.id, "viewportSize");
+        shapeSDFLocs[1] = glGetAttribLocation(shader.id, "instancePosition");
+        shapeSDFLocs[2] = glGetAttribLocation(shader.id, "instanceSize");
+        shapeSDFLocs[3] = glGetAttribLocation(shader.id, "instanceAxis");
+        shapeSDFLocs[4] = glGetAttribLocation(shader.id, "instanceParams");
+        shapeSDFLocs[5] = glGetAttribLocation(shader.id, "instanceColor");
+
+        TraceLog(LOG_INFO, "[SHDR ID %i] SDF shapes shader loaded successfully", shader.id);
     }
+    else TraceLog(LOG_WARNING, "[SHDR ID %i] SDF shapes shader could not be loaded, shapes tessellated on CPU", shader.id);
 
-    // Bind vertex array objects (or VBOs)
-    if (vaoSupported) glBindVertexArray(mesh.vaoId);
-    else
+    return shader;
+}
+
+// Draw queued SDF shapes, all shapes in one instanced draw call (by eye)
+// NOTE: Shapes are drawn with current modelview and projection, same as render batch vertex data
+static void DrawShapesSDF(void)
+{
+    if (shapeSDFVboId[0] == 0)
     {
-        // Bind mesh VBO data: vertex position (shader-location = 0)
-        glBindBuffer(GL_ARRAY_BUFFER, mesh.vboId[0]);
-        glVertexAttribPointer(material.shader.locs[LOC_VERTEX_POSITION], 3, GL_FLOAT, 0, 0, 0);
-        glEnableVertexAttribArray(material.shader.locs[LOC_VERTEX_POSITION]);
+        // Quad corners, drawn as triangle strip
+        const float corners[4*2] = { -1.0f, -1.0f, 1.0f, -1.0f, -1.0f, 1.0f, 1.0f, 1.0f };
+
+        if (vaoSupported) glGenVertexArrays(1, &shapeSDFVaoId);
+        glGenBuffers(2, shapeSDFVboId);
+        glBindBuffer(GL_ARRAY_BUFFER, shapeSDFVboId[0]);
+        glBufferData(GL_ARRAY_BUFFER, sizeof(corners), corners, GL_STATIC_DRAW);
+        glBindBuffer(GL_ARRAY_BUFFER, shapeSDFVboId[1]);
+        glBufferData(GL_ARRAY_BUFFER, MAX_BATCH_SHAPES_SDF*sizeof(ShapeSDFInstance), NULL, GL_STREAM_DRAW);
+    }
 
-        // Bind mesh VBO data: vertex texcoords (shader-location = 1)
-        glBindBuffer(GL_ARRAY_BUFFER, mesh.vboId[1]);
-        glVertexAttribPointer(material.shader.locs[LOC_VERTEX_TEXCOORD01], 2, GL_FLOAT, 0, 0, 0);
-        glEnableVertexAttribArray(material.shader.locs[LOC_VERTEX_TEXCOORD01]);
+    ReleaseMeshState();
 
-        // Bind mesh VBO data: vertex normals (shader-location = 2, if available)
-        if (material.shader.locs[LOC_VERTEX_NORMAL] != -1)
-        {
-            glBindBuffer(GL_ARRAY_BUFFER, mesh.vboId[2]);
-            glVertexAttribPointer(material.shader.locs[LOC_VERTEX_NORMAL], 3, GL_FLOAT, 0, 0, 0);
-            glEnableVertexAttribArray(material.shader.locs[LOC_VERTEX_NORMAL]);
-        }
+    // NOTE: Buffer is orphaned before every update, avoiding implicit sync with previous draws
+    glBindBuffer(GL_ARRAY_BUFFER, shapeSDFVboId[1]);
+    glBufferData(GL_ARRAY_BUFFER, MAX_BATCH_SHAPES_SDF*sizeof(ShapeSDFInstance), NULL, GL_STREAM_DRAW);
+    glBufferSubData(GL_ARRAY_BUFFER, 0, shapeSDFCount*sizeof(ShapeSDFInstance), shapeSDFInstances);
 
-        // Bind mesh VBO data: vertex colors (shader-location = 3, if available)
-        if (material.shader.locs[LOC_VERTEX_COLOR] != -1)
-        {
-            if (mesh.vboId[3] != 0)
-            {
-                glBindBuffer(GL_ARRAY_BUFFER, mesh.vboId[3]);
-                glVertexAttribPointer(material.shader.locs[LOC_VERTEX_COLOR], 4, GL_UNSIGNED_BYTE, GL_TRUE, 0, 0);
-                glEnableVertexAttribArray(material.shader.locs[LOC_VERTEX_COLOR]);
-            }
-            else
-            {
-                // Set default value for unused attribute
-                // NOTE: Required when using default shader and no VAO support
-                glVertexAttrib4f(material.shader.locs[LOC_VERTEX_COLOR], 1.0f, 1.0f, 1.0f, 1.0f);
-                glDisableVertexAttribArray(material.shader.locs[LOC_VERTEX_COLOR]);
-            }
-        }
+    renderStats.uploadedBytes += shapeSDFCount*sizeof(ShapeSDFInstance);
 
-        // Bind mesh VBO data: vertex tangents (shader-location = 4, if available)
-        if (material.shader.locs[LOC_VERTEX_TANGENT] != -1)
-        {
-            glBindBuffer(GL_ARRAY_BUFFER, mesh.vboId[4]);
-            glVertexAttribPointer(material.shader.locs[LOC_VERTEX_TANGENT], 4, GL_FLOAT, 0, 0, 0);
-            glEnableVertexAttribArray(material.shader.locs[LOC_VERTEX_TANGENT]);
-        }
+    int viewport[4] = { 0 };
+    glGetIntegerv(GL_VIEWPORT, viewport);
 
-        // Bind mesh VBO data: vertex texcoords2 (shader-location = 5, if available)
-        if (material.shader.locs[LOC_VERTEX_TEXCOORD02] != -1)
-        {
-            glBindBuffer(GL_ARRAY_BUFFER, mesh.vboId[5]);
-            glVertexAttribPointer(material.shader.locs[LOC_VERTEX_TEXCOORD02], 2, GL_FLOAT, 0, 0, 0);
-            glEnableVertexAttribArray(material.shader.locs[LOC_VERTEX_TEXCOORD02]);
-        }
+    glUseProgram(shapeSDFShader.id);
+    glUniform2f(shapeSDFLocs[0], (float)viewport[2], (float)viewport[3]);
 
-        if (mesh.indices != NULL) glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, mesh.vboId[6]);
-    }
+    // Bind quad corners (per-vertex) and shapes data (per-instance)
+    if (vaoSupported) glBindVertexArray(shapeSDFVaoId);
+
+    SetVertexAttrib(shapeSDFShader.locs[LOC_VERTEX_POSITION], shapeSDFVboId[0], 2, GL_FLOAT, false, 0, 0);
+    SetVertexAttrib(shapeSDFLocs[1], shapeSDFVboId[1], 3, GL_FLOAT, false, sizeof(ShapeSDFInstance), (void *)offsetof(ShapeSDFInstance, position));
+    SetVertexAttrib(shapeSDFLocs[2], shapeSDFVboId[1], 2, GL_FLOAT, false, sizeof(ShapeSDFInstance), (void *)offsetof(ShapeSDFInstance, size));
+    SetVertexAttrib(shapeSDFLocs[3], shapeSDFVboId[1], 2, GL_FLOAT, false, sizeof(ShapeSDFInstance), (void *)offsetof(ShapeSDFInstance, axis));
+    SetVertexAttrib(shapeSDFLocs[4], shapeSDFVboId[1], 2, GL_FLOAT, false, sizeof(ShapeSDFInstance), (void *)offsetof(ShapeSDFInstance, params));
+    SetVertexAttrib(shapeSDFLocs[5], shapeSDFVboId[1], 4, GL_UNSIGNED_BYTE, true, sizeof(ShapeSDFInstance), (void *)offsetof(ShapeSDFInstance, color));
+
+    for (int i = 1; i < 6; i++) glVertexAttribDivisor(shapeSDFLocs[i], 1);
+
+    Matrix matModelView = modelview;
+    Matrix matProjection = projection;
 
     int eyesCount = 1;
 #if defined(SUPPORT_VR_SIMULATOR)
@@ -2751,1588 +8448,2257 @@ void rlDrawMesh(Mesh mesh, Material material, Matrix transform)
 
     for (int eye = 0; eye < eyesCount; eye++)
     {
-        if (eyesCount == 1) modelview = matModelView;
         #if defined(SUPPORT_VR_SIMULATOR)
-        else SetStereoView(eye, matProjection, matModelView);
+        if (eyesCount == 2) SetStereoView(eye, matProjection, matModelView);
         #endif
 
         // Calculate model-view-projection matrix (MVP)
-        Matrix matMVP = MatrixMultiply(modelview, projection);        // Transform to screen-space coordinates
+        Matrix matMVP = MatrixMultiply(modelview, projection);
 
-        // Send combined model-view-projection matrix to shader
-        glUniformMatrix4fv(material.shader.locs[LOC_MATRIX_MVP], 1, false, MatrixToFloat(matMVP));
+        glUniformMatrix4fv(shapeSDFShader.locs[LOC_MATRIX_MVP], 1, false, MatrixToFloat(matMVP));
 
-        // Draw call!
-        if (mesh.indices != NULL) glDrawElements(GL_TRIANGLES, mesh.triangleCount*3, GL_UNSIGNED_SHORT, 0); // Indexed vertices draw
-        else glDrawArrays(GL_TRIANGLES, 0, mesh.vertexCount);
-    }
+        // Draw call! (all queued shapes at once)
+        glDrawArraysInstanced(GL_TRIANGLE_STRIP, 0, 4, shapeSDFCount);
 
-    // Unbind all binded texture maps
-    for (int i = 0; i < MAX_MATERIAL_MAPS; i++)
-    {
-        glActiveTexture(GL_TEXTURE0 + i);       // Set shader active texture
-        if ((i == MAP_IRRADIANCE) || (i == MAP_PREFILTER) || (i == MAP_CUBEMAP)) glBindTexture(GL_TEXTURE_CUBE_MAP, 0);
-        else glBindTexture(GL_TEXTURE_2D, 0);   // Unbind current active texture
+        renderStats.drawCalls++;
+        renderStats.vertexCount += 4*shapeSDFCount;
     }
 
-    // Unind vertex array objects (or VBOs)
+    // Reset per-instance attributes, shapes vertex array keeps its own state
     if (vaoSupported) glBindVertexArray(0);
     else
     {
-        glBindBuffer(GL_ARRAY_BUFFER, 0);
-        if (mesh.indices != NULL) glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+        for (int i = 1; i < 6; i++)
+        {
+            glVertexAttribDivisor(shapeSDFLocs[i], 0);
+            DisableVertexAttrib(shapeSDFLocs[i]);
+        }
     }
 
-    // Unbind shader program
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
     glUseProgram(0);
 
     // Restore projection/modelview matrices
-    // NOTE: In stereo rendering matrices are being modified to fit every eye
     projection = matProjection;
-    modelview = matView;
-#endif
+    modelview = matModelView;
+
+    shapeSDFCount = 0;
 }
 
-// Unload mesh data from CPU and GPU
-void rlUnloadMesh(Mesh mesh)
+// Get location handlers to for shader attributes and uniforms
+// NOTE: If any location is not found, loc point becomes -1
+static void SetShaderDefaultLocations(Shader *shader)
 {
-    RL_FREE(mesh.vertices);
-    RL_FREE(mesh.texcoords);
-    RL_FREE(mesh.normals);
-    RL_FREE(mesh.colors);
-    RL_FREE(mesh.tangents);
-    RL_FREE(mesh.texcoords2);
-    RL_FREE(mesh.indices);
+    // NOTE: Default shader attrib locations have been fixed before linking:
+    //          vertex position location    = 0
+    //          vertex texcoord location    = 1
+    //          vertex normal location      = 2
+    //          vertex color location       = 3
+    //          vertex tangent location     = 4
+    //          vertex texcoord2 location   = 5
+    //          vertex bone ids location    = 6 (SUPPORT_GPU_SKINNING)
+    //          vertex bone weights location = 7 (SUPPORT_GPU_SKINNING)
 
-    RL_FREE(mesh.animVertices);
-    RL_FREE(mesh.animNormals);
-    RL_FREE(mesh.boneWeights);
-    RL_FREE(mesh.boneIds);
+    // Get handles to GLSL input attibute locations
+    shader->locs[LOC_VERTEX_POSITION] = glGetAttribLocation(shader->id, DEFAULT_ATTRIB_POSITION_NAME);
+    shader->locs[LOC_VERTEX_TEXCOORD01] = glGetAttribLocation(shader->id, DEFAULT_ATTRIB_TEXCOORD_NAME);
+    shader->locs[LOC_VERTEX_TEXCOORD02] = glGetAttribLocation(shader->id, DEFAULT_ATTRIB_TEXCOORD2_NAME);
+    shader->locs[LOC_VERTEX_NORMAL] = glGetAttribLocation(shader->id, DEFAULT_ATTRIB_NORMAL_NAME);
+    shader->locs[LOC_VERTEX_TANGENT] = glGetAttribLocation(shader->id, DEFAULT_ATTRIB_TANGENT_NAME);
+    shader->locs[LOC_VERTEX_COLOR] = glGetAttribLocation(shader->id, DEFAULT_ATTRIB_COLOR_NAME);
+    shader->locs[LOC_VERTEX_INSTANCE_TX] = glGetAttribLocation(shader->id, DEFAULT_ATTRIB_INSTANCE_TX_NAME);
+    shader->locs[LOC_VERTEX_BONEIDS] = glGetAttribLocation(shader->id, DEFAULT_ATTRIB_BONEIDS_NAME);
+    shader->locs[LOC_VERTEX_BONEWEIGHTS] = glGetAttribLocation(shader->id, DEFAULT_ATTRIB_BONEWEIGHTS_NAME);
 
-    rlDeleteBuffers(mesh.vboId[0]);   // vertex
-    rlDeleteBuffers(mesh.vboId[1]);   // texcoords
-    rlDeleteBuffers(mesh.vboId[2]);   // normals
-    rlDeleteBuffers(mesh.vboId[3]);   // colors
-    rlDeleteBuffers(mesh.vboId[4]);   // tangents
-    rlDeleteBuffers(mesh.vboId[5]);   // texcoords2
-    rlDeleteBuffers(mesh.vboId[6]);   // indices
+    // Get handles to GLSL uniform locations (vertex shader)
+    shader->locs[LOC_MATRIX_MVP]  = glGetUniformLocation(shader->id, "mvp");
+    shader->locs[LOC_MATRIX_PROJECTION]  = glGetUniformLocation(shader->id, "projection");
+    shader->locs[LOC_MATRIX_VIEW]  = glGetUniformLocation(shader->id, "view");
+    shader->locs[LOC_MATRIX_BONES] = glGetUniformLocation(shader->id, DEFAULT_UNIFORM_BONES_NAME);
 
-    rlDeleteVertexArrays(mesh.vaoId);
+    // Get handles to GLSL uniform locations (fragment shader)
+    shader->locs[LOC_COLOR_DIFFUSE] = glGetUniformLocation(shader->id, "colDiffuse");
+    shader->locs[LOC_MAP_DIFFUSE] = glGetUniformLocation(shader->id, "texture0");
+    shader->locs[LOC_MAP_SPECULAR] = glGetUniformLocation(shader->id, "texture1");
+    shader->locs[LOC_MAP_NORMAL] = glGetUniformLocation(shader->id, "texture2");
+
+#if defined(GRAPHICS_API_OPENGL_33)
+    // Bind frame and user uniform blocks (if declared by shader)
+    SetShaderBlocks(*shader);
+#endif
 }
 
-// Read screen pixel data (color buffer)
-unsigned char *rlReadScreenPixels(int width, int height)
+// Unload default shader
+static void UnloadShaderDefault(void)
 {
-    unsigned char *screenData = (unsigned char *)RL_CALLOC(width*height*4, sizeof(unsigned char));
+    glUseProgram(0);
 
-    // NOTE 1: glReadPixels returns image flipped vertically -> (0,0) is the bottom left corner of the framebuffer
-    // NOTE 2: We are getting alpha channel! Be careful, it can be transparent if not cleared properly!
-    glReadPixels(0, 0, width, height, GL_RGBA, GL_UNSIGNED_BYTE, screenData);
+    glDetachShader(defaultShader.id, defaultVShaderId);
+    glDetachShader(defaultShader.id, defaultFShaderId);
+    glDeleteShader(defaultVShaderId);
+    glDeleteShader(defaultFShaderId);
 
-    // Flip image vertically!
-    unsigned char *imgData = (unsigned char *)RL_MALLOC(width*height*sizeof(unsigned char)*4);
+    glDeleteProgram(defaultShader.id);
+
+#if defined(SUPPORT_BATCH_TEXTURE_ARRAYS)
+    if (defaultArrayShader.id > 0) glDeleteProgram(defaultArrayShader.id);
+    RL_FREE(defaultArrayShader.locs);
+    defaultArrayShader = (Shader){ 0 };
+#endif
+
+#if defined(SUPPORT_GPU_SKINNING)
+    if (defaultSkinShader.id > 0) glDeleteProgram(defaultSkinShader.id);
+    RL_FREE(defaultSkinShader.locs);
+    defaultSkinShader = (Shader){ 0 };
+#endif
 
-    for (int y = height - 1; y >= 0; y--)
+    if (defaultPointShader.id > 0) glDeleteProgram(defaultPointShader.id);
+    RL_FREE(defaultPointShader.locs);
+    defaultPointShader = (Shader){ 0 };
+
+#if defined(SUPPORT_VR_SINGLE_PASS)
+    if (defaultStereoShader.id > 0) glDeleteProgram(defaultStereoShader.id);
+    RL_FREE(defaultStereoShader.locs);
+    defaultStereoShader = (Shader){ 0 };
+#endif
+}
+
+// Load render batch buffers (CPU and GPU) and draw calls
+static void LoadBatchBuffers(RenderBatch *batch, int buffersCount, int elements)
+{
+#if defined(GRAPHICS_API_OPENGL_ES2)
+    // NOTE: 16 bit indices can address up to 65536 vertex (16384 quads), bigger batches require 32 bit indices
+    batch->indexUint = false;
+
+    if (elements > 16384)
     {
-        for (int x = 0; x < (width*4); x++)
+        if (elementIndexUintSupported) batch->indexUint = true;
+        else
         {
-            imgData[((height - 1) - y)*width*4 + x] = screenData[(y*width*4) + x];  // Flip line
-
-            // Set alpha component value to 255 (no trasparent image retrieval)
-            // NOTE: Alpha value has already been applied to RGB in framebuffer, we don't need it!
-            if (((x + 1)%4) == 0) imgData[((height - 1) - y)*width*4 + x] = 255;
+            TraceLog(LOG_WARNING, "Batch elements limited to 16384, 32 bit indices not supported");
+            elements = 16384;
         }
     }
+#endif
 
-    RL_FREE(screenData);
+    batch->buffersCount = buffersCount;
+    batch->currentBuffer = 0;
+    batch->elements = elements;
+    batch->vertexBuffer = (DynamicBuffer *)RL_CALLOC(buffersCount, sizeof(DynamicBuffer));
 
-    return imgData;     // NOTE: image data should be freed
-}
+    // Initialize CPU (RAM) arrays (vertex position, texcoord, color data and indexes)
+    //--------------------------------------------------------------------------------------------
+    for (int i = 0; i < buffersCount; i++)
+    {
+#if defined(SUPPORT_BATCH_INTERLEAVED)
+        batch->vertexBuffer[i].elements = (BatchVertex *)RL_CALLOC(4*elements, sizeof(BatchVertex));   // 4 vertex by quad
+#else
+        batch->vertexBuffer[i].vertices = (float *)RL_MALLOC(sizeof(float)*3*4*elements);        // 3 float by vertex, 4 vertex by quad
+        batch->vertexBuffer[i].texcoords = (float *)RL_MALLOC(sizeof(float)*2*4*elements);       // 2 float by texcoord, 4 texcoord by quad
+        batch->vertexBuffer[i].colors = (unsigned char *)RL_MALLOC(sizeof(unsigned char)*4*4*elements);  // 4 float by color, 4 colors by quad
+#endif
+#if defined(GRAPHICS_API_OPENGL_33)
+        batch->vertexBuffer[i].indices = (unsigned int *)RL_MALLOC(sizeof(unsigned int)*6*elements);      // 6 int by quad (indices)
+#elif defined(GRAPHICS_API_OPENGL_ES2)
+        if (batch->indexUint) batch->vertexBuffer[i].indices = RL_MALLOC(sizeof(unsigned int)*6*elements);    // 6 int by quad (indices)
+        else batch->vertexBuffer[i].indices = RL_MALLOC(sizeof(unsigned short)*6*elements);                   // 6 short by quad (indices)
+#endif
 
-// Read texture pixel data
-void *rlReadTexturePixels(Texture2D texture)
-{
-    void *pixels = NULL;
+#if !defined(SUPPORT_BATCH_INTERLEAVED)
+        for (int j = 0; j < (3*4*elements); j++) batch->vertexBuffer[i].vertices[j] = 0.0f;
+        for (int j = 0; j < (2*4*elements); j++) batch->vertexBuffer[i].texcoords[j] = 0.0f;
+        for (int j = 0; j < (4*4*elements); j++) batch->vertexBuffer[i].colors[j] = 0;
+#endif
 
-#if defined(GRAPHICS_API_OPENGL_11) || defined(GRAPHICS_API_OPENGL_33)
-    glBindTexture(GL_TEXTURE_2D, texture.id);
+        int k = 0;
 
-    // NOTE: Using texture.id, we can retrieve some texture info (but not on OpenGL ES 2.0)
-    // Possible texture info: GL_TEXTURE_RED_SIZE, GL_TEXTURE_GREEN_SIZE, GL_TEXTURE_BLUE_SIZE, GL_TEXTURE_ALPHA_SIZE
-    //int width, height, format;
-    //glGetTexLevelParameteriv(GL_TEXTURE_2D, 0, GL_TEXTURE_WIDTH, &width);
-    //glGetTexLevelParameteriv(GL_TEXTURE_2D, 0, GL_TEXTURE_HEIGHT, &height);
-    //glGetTexLevelParameteriv(GL_TEXTURE_2D, 0, GL_TEXTURE_INTERNAL_FORMAT, &format);
+        // Indices can be initialized right now
+        for (int j = 0; j < (6*elements); j += 6)
+        {
+#if defined(GRAPHICS_API_OPENGL_ES2)
+            if (!batch->indexUint)
+            {
+                unsigned short *indices = (unsigned short *)batch->vertexBuffer[i].indices;
+
+                indices[j] = 4*k;
+                indices[j + 1] = 4*k + 1;
+                indices[j + 2] = 4*k + 2;
+                indices[j + 3] = 4*k;
+                indices[j + 4] = 4*k + 2;
+                indices[j + 5] = 4*k + 3;
+            }
+            else
+#endif
+            {
+                unsigned int *indices = (unsigned int *)batch->vertexBuffer[i].indices;
+
+                indices[j] = 4*k;
+                indices[j + 1] = 4*k + 1;
+                indices[j + 2] = 4*k + 2;
+                indices[j + 3] = 4*k;
+                indices[j + 4] = 4*k + 2;
+                indices[j + 5] = 4*k + 3;
+            }
 
-    // NOTE: Each row written to or read from by OpenGL pixel operations like glGetTexImage are aligned to a 4 byte boundary by default, which may add some padding.
-    // Use glPixelStorei to modify padding with the GL_[UN]PACK_ALIGNMENT setting.
-    // GL_PACK_ALIGNMENT affects operations that read from OpenGL memory (glReadPixels, glGetTexImage, etc.)
-    // GL_UNPACK_ALIGNMENT affects operations that write to OpenGL memory (glTexImage, etc.)
-    glPixelStorei(GL_PACK_ALIGNMENT, 1);
+            k++;
+        }
 
-    unsigned int glInternalFormat, glFormat, glType;
-    rlGetGlTextureFormats(texture.format, &glInternalFormat, &glFormat, &glType);
-    unsigned int size = GetPixelDataSize(texture.width, texture.height, texture.format);
+        batch->vertexBuffer[i].vCounter = 0;
+        batch->vertexBuffer[i].tcCounter = 0;
+        batch->vertexBuffer[i].cCounter = 0;
+    }
 
-    if ((glInternalFormat != -1) && (texture.format < COMPRESSED_DXT1_RGB))
+    TraceLog(LOG_INFO, "Internal buffers initialized successfully (CPU)");
+    //--------------------------------------------------------------------------------------------
+
+    // Upload to GPU (VRAM) vertex data and initialize VAOs/VBOs
+    //--------------------------------------------------------------------------------------------
+    for (int i = 0; i < buffersCount; i++)
     {
-        pixels = (unsigned char *)RL_MALLOC(size);
-        glGetTexImage(GL_TEXTURE_2D, 0, glFormat, glType, pixels);
-    }
-    else TraceLog(LOG_WARNING, "Texture data retrieval not suported for pixel format");
+        if (vaoSupported)
+        {
+            // Initialize Quads VAO
+            glGenVertexArrays(1, &batch->vertexBuffer[i].vaoId);
+            glBindVertexArray(batch->vertexBuffer[i].vaoId);
+        }
 
-    glBindTexture(GL_TEXTURE_2D, 0);
+#if defined(SUPPORT_BATCH_INTERLEAVED)
+        // Quads - Interleaved vertex buffer binding and attributes enable
+        // NOTE: Vertex position (shader-location = 0), texcoord (shader-location = 1), color (shader-location = 3)
+        glGenBuffers(1, &batch->vertexBuffer[i].vboId[0]);
+        glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[i].vboId[0]);
+#if defined(SUPPORT_BATCH_STREAMING)
+        if (batchStreamMode == BATCH_STREAM_PERSISTENT) batch->vertexBuffer[i].mapped[0] = LoadBufferPersistent(sizeof(BatchVertex)*4*elements, batch->vertexBuffer[i].elements);
+        else
+#endif
+        glBufferData(GL_ARRAY_BUFFER, sizeof(BatchVertex)*4*elements, batch->vertexBuffer[i].elements, GL_DYNAMIC_DRAW);
+        TrackVideoMemory(VIDEO_MEMORY_BUFFER, batch->vertexBuffer[i].vboId[0], sizeof(BatchVertex)*4*elements);
+        SetVertexAttrib(currentShader.locs[LOC_VERTEX_POSITION], batch->vertexBuffer[i].vboId[0], 3, GL_FLOAT, false, sizeof(BatchVertex), (void *)offsetof(BatchVertex, position));
+        SetVertexAttrib(currentShader.locs[LOC_VERTEX_TEXCOORD01], batch->vertexBuffer[i].vboId[0], 2, GL_FLOAT, false, sizeof(BatchVertex), (void *)offsetof(BatchVertex, texcoord));
+        SetVertexAttrib(currentShader.locs[LOC_VERTEX_COLOR], batch->vertexBuffer[i].vboId[0], 4, GL_UNSIGNED_BYTE, true, sizeof(BatchVertex), (void *)offsetof(BatchVertex, color));
+#if defined(SUPPORT_BATCH_MULTITEXTURE)
+        SetVertexAttrib(6, batch->vertexBuffer[i].vboId[0], 1, GL_UNSIGNED_BYTE, false, sizeof(BatchVertex), (void *)offsetof(BatchVertex, texUnit));
+#endif
+#if defined(SUPPORT_BATCH_TEXTURE_ARRAYS)
+        SetVertexAttrib(7, batch->vertexBuffer[i].vboId[0], 1, GL_UNSIGNED_SHORT, false, sizeof(BatchVertex), (void *)offsetof(BatchVertex, texLayer));
+#endif
+#else
+        // Quads - Vertex buffers binding and attributes enable
+        // Vertex position buffer (shader-location = 0)
+        glGenBuffers(1, &batch->vertexBuffer[i].vboId[0]);
+        glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[i].vboId[0]);
+#if defined(SUPPORT_BATCH_STREAMING)
+        if (batchStreamMode == BATCH_STREAM_PERSISTENT) batch->vertexBuffer[i].mapped[0] = LoadBufferPersistent(sizeof(float)*3*4*elements, batch->vertexBuffer[i].vertices);
+        else
 #endif
+        glBufferData(GL_ARRAY_BUFFER, sizeof(float)*3*4*elements, batch->vertexBuffer[i].vertices, GL_DYNAMIC_DRAW);
+        TrackVideoMemory(VIDEO_MEMORY_BUFFER, batch->vertexBuffer[i].vboId[0], sizeof(float)*3*4*elements);
+        SetVertexAttrib(currentShader.locs[LOC_VERTEX_POSITION], batch->vertexBuffer[i].vboId[0], 3, GL_FLOAT, false, 0, 0);
 
-#if defined(GRAPHICS_API_OPENGL_ES2)
-    // glGetTexImage() is not available on OpenGL ES 2.0
-    // Texture2D width and height are required on OpenGL ES 2.0. There is no way to get it from texture id.
-    // Two possible Options:
-    // 1 - Bind texture to color fbo attachment and glReadPixels()
-    // 2 - Create an fbo, activate it, render quad with texture, glReadPixels()
-    // We are using Option 1, just need to care for texture format on retrieval
-    // NOTE: This behaviour could be conditioned by graphic driver...
-    RenderTexture2D fbo = rlLoadRenderTexture(texture.width, texture.height, UNCOMPRESSED_R8G8B8A8, 16, false);
+        // Vertex texcoord buffer (shader-location = 1)
+        glGenBuffers(1, &batch->vertexBuffer[i].vboId[1]);
+        glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[i].vboId[1]);
+#if defined(SUPPORT_BATCH_STREAMING)
+        if (batchStreamMode == BATCH_STREAM_PERSISTENT) batch->vertexBuffer[i].mapped[1] = LoadBufferPersistent(sizeof(float)*2*4*elements, batch->vertexBuffer[i].texcoords);
+        else
+#endif
+        glBufferData(GL_ARRAY_BUFFER, sizeof(float)*2*4*elements, batch->vertexBuffer[i].texcoords, GL_DYNAMIC_DRAW);
+        TrackVideoMemory(VIDEO_MEMORY_BUFFER, batch->vertexBuffer[i].vboId[1], sizeof(float)*2*4*elements);
+        SetVertexAttrib(currentShader.locs[LOC_VERTEX_TEXCOORD01], batch->vertexBuffer[i].vboId[1], 2, GL_FLOAT, false, 0, 0);
 
-    glBindFramebuffer(GL_FRAMEBUFFER, fbo.id);
-    glBindTexture(GL_TEXTURE_2D, 0);
+        // Vertex color buffer (shader-location = 3)
+        glGenBuffers(1, &batch->vertexBuffer[i].vboId[2]);
+        glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[i].vboId[2]);
+#if defined(SUPPORT_BATCH_STREAMING)
+        if (batchStreamMode == BATCH_STREAM_PERSISTENT) batch->vertexBuffer[i].mapped[2] = LoadBufferPersistent(sizeof(unsigned char)*4*4*elements, batch->vertexBuffer[i].colors);
+        else
+#endif
+        glBufferData(GL_ARRAY_BUFFER, sizeof(unsigned char)*4*4*elements, batch->vertexBuffer[i].colors, GL_DYNAMIC_DRAW);
+        TrackVideoMemory(VIDEO_MEMORY_BUFFER, batch->vertexBuffer[i].vboId[2], sizeof(unsigned char)*4*4*elements);
+        SetVertexAttrib(currentShader.locs[LOC_VERTEX_COLOR], batch->vertexBuffer[i].vboId[2], 4, GL_UNSIGNED_BYTE, true, 0, 0);
+#endif
 
-    // Attach our texture to FBO
-    // NOTE: Previoust attached texture is automatically detached
-    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, texture.id, 0);
+        // Fill index buffer
+        glGenBuffers(1, &batch->vertexBuffer[i].vboId[3]);
+        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, batch->vertexBuffer[i].vboId[3]);
+#if defined(GRAPHICS_API_OPENGL_33)
+        glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(int)*6*elements, batch->vertexBuffer[i].indices, GL_STATIC_DRAW);
+        TrackVideoMemory(VIDEO_MEMORY_BUFFER, batch->vertexBuffer[i].vboId[3], sizeof(int)*6*elements);
+#elif defined(GRAPHICS_API_OPENGL_ES2)
+        glBufferData(GL_ELEMENT_ARRAY_BUFFER, (batch->indexUint? sizeof(int) : sizeof(short))*6*elements, batch->vertexBuffer[i].indices, GL_STATIC_DRAW);
+        TrackVideoMemory(VIDEO_MEMORY_BUFFER, batch->vertexBuffer[i].vboId[3], (batch->indexUint? sizeof(int) : sizeof(short))*6*elements);
+#endif
+    }
 
-    // We read data as RGBA because FBO texture is configured as RGBA, despite binding another texture format
-    pixels = (unsigned char *)RL_MALLOC(GetPixelDataSize(texture.width, texture.height, UNCOMPRESSED_R8G8B8A8));
-    glReadPixels(0, 0, texture.width, texture.height, GL_RGBA, GL_UNSIGNED_BYTE, pixels);
+    TraceLog(LOG_INFO, "Internal buffers uploaded successfully (GPU)");
 
-    // Re-attach internal FBO color texture before deleting it
-    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, fbo.texture.id, 0);
+    // Unbind the current VAO
+    if (vaoSupported) glBindVertexArray(0);
+    //--------------------------------------------------------------------------------------------
 
-    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    // Init draw calls tracking system
+    //--------------------------------------------------------------------------------------------
+    batch->draws = (DrawCall *)RL_MALLOC(sizeof(DrawCall)*MAX_DRAWCALL_REGISTERED);
 
-    // Clean up temporal fbo
-    rlDeleteRenderTextures(fbo);
-#endif
+    for (int i = 0; i < MAX_DRAWCALL_REGISTERED; i++)
+    {
+        batch->draws[i].mode = RL_QUADS;
+        batch->draws[i].vertexCount = 0;
+        batch->draws[i].vertexAlignment = 0;
+        batch->draws[i].layer = 0;
+        //batch->draws[i].vaoId = 0;
+        //batch->draws[i].shaderId = 0;
+        batch->draws[i].textureId = defaultTextureId;
+#if defined(SUPPORT_BATCH_MULTITEXTURE)
+        batch->draws[i].textureIds[0] = defaultTextureId;
+        batch->draws[i].textureCount = 1;
+#endif
+#if defined(SUPPORT_BATCH_TEXTURE_ARRAYS)
+        batch->draws[i].textureArray = false;
+#endif
+        //batch->draws[i].projection = MatrixIdentity();
+        //batch->draws[i].modelview = MatrixIdentity();
+    }
 
-    return pixels;
+    batch->drawsCounter = 1;
+    batch->currentDepth = -1.0f;
+    batch->uploadedCount = 0;
+    //--------------------------------------------------------------------------------------------
 }
 
-//----------------------------------------------------------------------------------
-// Module Functions Definition - Shaders Functions
-// NOTE: Those functions are exposed directly to the user in raylib.h
-//----------------------------------------------------------------------------------
+// Update render batch buffers (VAOs/VBOs) with vertex array data
+// NOTE: If there is not vertex data, buffers doesn't need to be updated (vertexCount > 0),
+// retained batches vertex data is only uploaded again if it changed (uploadedCount)
+static void UpdateBatchBuffers(RenderBatch *batch)
+{
+    DynamicBuffer *buffer = &batch->vertexBuffer[batch->currentBuffer];
+
+    // Update vertex buffers data
+    if ((buffer->vCounter > 0) && (buffer->vCounter != batch->uploadedCount))
+    {
+        // Activate elements VAO
+        if (vaoSupported) glBindVertexArray(buffer->vaoId);
+
+#if defined(SUPPORT_BATCH_STREAMING)
+        if (batchStreamMode != BATCH_STREAM_SUBDATA)
+        {
+            // NOTE: Persistent-mapped buffers are written directly, GPU must be done with them
+            if (batchStreamMode == BATCH_STREAM_PERSISTENT) WaitBufferFence(buffer);
+
+#if defined(SUPPORT_BATCH_INTERLEAVED)
+            UploadBufferStream(buffer, 0, sizeof(BatchVertex)*buffer->vCounter, buffer->elements);
+#else
+            UploadBufferStream(buffer, 0, sizeof(float)*3*buffer->vCounter, buffer->vertices);
+            UploadBufferStream(buffer, 1, sizeof(float)*2*buffer->vCounter, buffer->texcoords);
+            UploadBufferStream(buffer, 2, sizeof(unsigned char)*4*buffer->vCounter, buffer->colors);
+#endif
+        }
+        else
+#endif
+        {
+#if defined(SUPPORT_BATCH_INTERLEAVED)
+            // Interleaved vertex data buffer
+            glBindBuffer(GL_ARRAY_BUFFER, buffer->vboId[0]);
+            glBufferSubData(GL_ARRAY_BUFFER, 0, sizeof(BatchVertex)*buffer->vCounter, buffer->elements);
+#else
+            // Vertex positions buffer
+            glBindBuffer(GL_ARRAY_BUFFER, buffer->vboId[0]);
+            glBufferSubData(GL_ARRAY_BUFFER, 0, sizeof(float)*3*buffer->vCounter, buffer->vertices);
+            //glBufferData(GL_ARRAY_BUFFER, sizeof(float)*3*4*MAX_BATCH_ELEMENTS, buffer->vertices, GL_DYNAMIC_DRAW);  // Update all buffer
+
+            // Texture coordinates buffer
+            glBindBuffer(GL_ARRAY_BUFFER, buffer->vboId[1]);
+            glBufferSubData(GL_ARRAY_BUFFER, 0, sizeof(float)*2*buffer->vCounter, buffer->texcoords);
+            //glBufferData(GL_ARRAY_BUFFER, sizeof(float)*2*4*MAX_BATCH_ELEMENTS, buffer->texcoords, GL_DYNAMIC_DRAW); // Update all buffer
 
-// Get default internal texture (white texture)
-Texture2D GetTextureDefault(void)
-{
-    Texture2D texture = { 0 };
-#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    texture.id = defaultTextureId;
-    texture.width = 1;
-    texture.height = 1;
-    texture.mipmaps = 1;
-    texture.format = UNCOMPRESSED_R8G8B8A8;
+            // Colors buffer
+            glBindBuffer(GL_ARRAY_BUFFER, buffer->vboId[2]);
+            glBufferSubData(GL_ARRAY_BUFFER, 0, sizeof(unsigned char)*4*buffer->vCounter, buffer->colors);
+            //glBufferData(GL_ARRAY_BUFFER, sizeof(float)*4*4*MAX_BATCH_ELEMENTS, buffer->colors, GL_DYNAMIC_DRAW);    // Update all buffer
 #endif
-    return texture;
-}
+        }
 
-// Get default shader
-Shader GetShaderDefault(void)
-{
-#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    return defaultShader;
+#if defined(SUPPORT_BATCH_INTERLEAVED)
+        renderStats.uploadedBytes += sizeof(BatchVertex)*buffer->vCounter;
 #else
-    Shader shader = { 0 };
-    return shader;
+        renderStats.uploadedBytes += (sizeof(float)*3 + sizeof(float)*2 + sizeof(unsigned char)*4)*buffer->vCounter;
 #endif
+
+        // NOTE: glMapBuffer() causes sync issue.
+        // If GPU is working with this buffer, glMapBuffer() will wait(stall) until GPU to finish its job.
+        // To avoid waiting (idle), you can call first glBufferData() with NULL pointer before glMapBuffer().
+        // If you do that, the previous data in PBO will be discarded and glMapBuffer() returns a new
+        // allocated pointer immediately even if GPU is still working with the previous data.
+        // NOTE: SUPPORT_BATCH_STREAMING implements that approach using glMapBufferRange() over a ring
+        // of MAX_BATCH_BUFFERING buffers, every buffer guarded by a fence sync object
+
+        batch->uploadedCount = buffer->vCounter;
+
+        // Unbind the current VAO
+        if (vaoSupported) glBindVertexArray(0);
+    }
 }
 
-// Load text data from file
-// NOTE: text chars array should be freed manually
-char *LoadText(const char *fileName)
+// Draw render batch buffers vertex data
+static void DrawBatchBuffers(RenderBatch *batch)
 {
-    FILE *textFile = NULL;
-    char *text = NULL;
+    DynamicBuffer *buffer = &batch->vertexBuffer[batch->currentBuffer];
+    Matrix matProjection = projection;
+    Matrix matModelView = modelview;
 
-    if (fileName != NULL)
+    int eyesCount = 1;
+    int eyeInstances = 1;       // Eyes drawn by every draw call (single pass stereo)
+#if defined(SUPPORT_VR_SIMULATOR)
+    if (vrStereoRender) eyesCount = 2;
+#endif
+#if defined(SUPPORT_VR_SINGLE_PASS)
+    // Both eyes are drawn by every draw call if batch only requires default shader,
+    // points and texture arrays draws switch shader, those batches are drawn once per eye
+    if ((eyesCount == 2) && (currentShader.id == defaultShader.id) && (defaultStereoShader.id > 0))
     {
-        textFile = fopen(fileName,"rt");
+        eyeInstances = 2;
 
-        if (textFile != NULL)
+        for (int i = 0; i < batch->drawsCounter; i++)
         {
-            fseek(textFile, 0, SEEK_END);
-            int size = ftell(textFile);
-            fseek(textFile, 0, SEEK_SET);
-
-            if (size > 0)
-            {
-                text = (char *)RL_MALLOC(sizeof(char)*(size + 1));
-                int count = fread(text, sizeof(char), size, textFile);
-                text[count] = '\0';
-            }
-
-            fclose(textFile);
+            if (batch->draws[i].mode == RL_POINTS) eyeInstances = 1;
+        #if defined(SUPPORT_BATCH_TEXTURE_ARRAYS)
+            if (batch->draws[i].textureArray) eyeInstances = 1;
+        #endif
         }
-        else TraceLog(LOG_WARNING, "[%s] Text file could not be opened", fileName);
+
+        if (eyeInstances == 2) eyesCount = 1;
     }
+#endif
+#if defined(SUPPORT_FRAME_CAPTURE)
+    if ((captureFile != NULL) && (buffer->vCounter > 0)) WriteCaptureBatch(batch);
+#endif
 
-    return text;
-}
+    for (int eye = 0; eye < eyesCount; eye++)
+    {
+#if defined(SUPPORT_VR_SIMULATOR)
+        if (eyesCount == 2) SetStereoView(eye, matProjection, matModelView);
+#endif
 
-// Load shader from files and bind default locations
-// NOTE: If shader string is NULL, using default vertex/fragment shaders
-Shader LoadShader(const char *vsFileName, const char *fsFileName)
-{
-    Shader shader = { 0 };
+        // Draw buffers
+        if (buffer->vCounter > 0)
+        {
+#if defined(GRAPHICS_API_OPENGL_33)
+            UpdateFrameBlock();     // Upload frame values shared by all shaders (if changed)
+#endif
+            // Set current shader and upload current MVP matrix
+            // NOTE: Single pass stereo uses default stereo shader, it gets both eyes MVP matrices
+            Shader batchShader = currentShader;
+#if defined(SUPPORT_VR_SINGLE_PASS)
+            if (eyeInstances == 2) batchShader = defaultStereoShader;
+#endif
+            glUseProgram(batchShader.id);
 
-    // NOTE: Shader.locs is allocated by LoadShaderCode()
+            if (batchShader.id != renderStatsShaderId) renderStats.shaderSwitches++;
+            renderStatsShaderId = batchShader.id;
 
-    char *vShaderStr = NULL;
-    char *fShaderStr = NULL;
+            // Create modelview-projection matrix
+            Matrix matMVP = MatrixMultiply(modelview, projection);
 
-    if (vsFileName != NULL) vShaderStr = LoadText(vsFileName);
-    if (fsFileName != NULL) fShaderStr = LoadText(fsFileName);
+#if defined(SUPPORT_VR_SINGLE_PASS)
+            if (eyeInstances == 2)
+            {
+                SetStereoViewSinglePass(batchShader, matModelView);
+                glEnable(GL_CLIP_DISTANCE0);
+            }
+            else
+#endif
+            glUniformMatrix4fv(batchShader.locs[LOC_MATRIX_MVP], 1, false, MatrixToFloat(matMVP));
+            glUniform4f(batchShader.locs[LOC_COLOR_DIFFUSE], 1.0f, 1.0f, 1.0f, 1.0f);
+            glUniform1i(batchShader.locs[LOC_MAP_DIFFUSE], 0);    // Provided value refers to the texture unit (active)
 
-    shader = LoadShaderCode(vShaderStr, fShaderStr);
+            // TODO: Support additional texture units on custom shader
+            //if (currentShader->locs[LOC_MAP_SPECULAR] > 0) glUniform1i(currentShader.locs[LOC_MAP_SPECULAR], 1);
+            //if (currentShader->locs[LOC_MAP_NORMAL] > 0) glUniform1i(currentShader.locs[LOC_MAP_NORMAL], 2);
 
-    if (vShaderStr != NULL) RL_FREE(vShaderStr);
-    if (fShaderStr != NULL) RL_FREE(fShaderStr);
+            // NOTE: Right now additional map textures not considered for default buffers drawing
 
-    return shader;
-}
+            int vertexOffset = 0;
 
-// Load shader from code strings
-// NOTE: If shader string is NULL, using default vertex/fragment shaders
-Shader LoadShaderCode(const char *vsCode, const char *fsCode)
-{
-    Shader shader = { 0 };
-    shader.locs = (int *)RL_CALLOC(MAX_SHADER_LOCATIONS, sizeof(int));
+            if (vaoSupported) glBindVertexArray(buffer->vaoId);
+            else
+            {
+#if defined(SUPPORT_BATCH_INTERLEAVED)
+                // Bind interleaved vertex attribs: position, texcoord and color (shader-location = 0, 1, 3)
+                // NOTE: Attributes already set from previous batch draw are not set again
+                SetVertexAttrib(currentShader.locs[LOC_VERTEX_POSITION], buffer->vboId[0], 3, GL_FLOAT, false, sizeof(BatchVertex), (void *)offsetof(BatchVertex, position));
+                SetVertexAttrib(currentShader.locs[LOC_VERTEX_TEXCOORD01], buffer->vboId[0], 2, GL_FLOAT, false, sizeof(BatchVertex), (void *)offsetof(BatchVertex, texcoord));
+                SetVertexAttrib(currentShader.locs[LOC_VERTEX_COLOR], buffer->vboId[0], 4, GL_UNSIGNED_BYTE, true, sizeof(BatchVertex), (void *)offsetof(BatchVertex, color));
+#if defined(SUPPORT_BATCH_MULTITEXTURE)
+                SetVertexAttrib(6, buffer->vboId[0], 1, GL_UNSIGNED_BYTE, false, sizeof(BatchVertex), (void *)offsetof(BatchVertex, texUnit));
+#endif
+#if defined(SUPPORT_BATCH_TEXTURE_ARRAYS)
+                SetVertexAttrib(7, buffer->vboId[0], 1, GL_UNSIGNED_SHORT, false, sizeof(BatchVertex), (void *)offsetof(BatchVertex, texLayer));
+#endif
+#else
+                // Bind vertex attribs: position, texcoord and color (shader-location = 0, 1, 3)
+                // NOTE: Attributes already set from previous batch draw are not set again
+                SetVertexAttrib(currentShader.locs[LOC_VERTEX_POSITION], buffer->vboId[0], 3, GL_FLOAT, false, 0, 0);
+                SetVertexAttrib(currentShader.locs[LOC_VERTEX_TEXCOORD01], buffer->vboId[1], 2, GL_FLOAT, false, 0, 0);
+                SetVertexAttrib(currentShader.locs[LOC_VERTEX_COLOR], buffer->vboId[2], 4, GL_UNSIGNED_BYTE, true, 0, 0);
+#endif
 
-    // NOTE: All locations must be reseted to -1 (no location)
-    for (int i = 0; i < MAX_SHADER_LOCATIONS; i++) shader.locs[i] = -1;
+                glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, buffer->vboId[3]);
+            }
 
-#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    unsigned int vertexShaderId = defaultVShaderId;
-    unsigned int fragmentShaderId = defaultFShaderId;
+            glActiveTexture(GL_TEXTURE0);
+#if defined(SUPPORT_BATCH_MULTITEXTURE)
+            int maxUnitUsed = 0;    // Track texture units bound, to unbind them after drawing
+#endif
+#if defined(SUPPORT_BATCH_TEXTURE_ARRAYS)
+            unsigned int drawShaderId = currentShader.id;   // Program in use, default shader is swapped by its array variant on texture array draws
+            bool textureArrayUsed = false;
+#endif
+            // Render state of draw calls (blend mode and scissor) is only applied if it changes,
+            // GL state matches current state out of batch drawing
+            // NOTE: Retained batches are drawn with current state, they could be drawn in any state
+            DrawCall glState = { 0 };
+            SetDrawCallState(&glState);
 
-    if (vsCode != NULL) vertexShaderId = CompileShader(vsCode, GL_VERTEX_SHADER);
-    if (fsCode != NULL) fragmentShaderId = CompileShader(fsCode, GL_FRAGMENT_SHADER);
+            for (int i = 0; i < batch->drawsCounter; i++)
+            {
+                if (!batch->retained) ApplyDrawState(&batch->draws[i], &glState);
 
-    if ((vertexShaderId == defaultVShaderId) && (fragmentShaderId == defaultFShaderId)) shader = defaultShader;
-    else
-    {
-        shader.id = LoadShaderProgram(vertexShaderId, fragmentShaderId);
+#if defined(SUPPORT_BATCH_MULTITEXTURE)
+                // Bind additional textures to their units, texture unit 0 is left active
+                for (int unit = batch->draws[i].textureCount - 1; unit > 0; unit--)
+                {
+                    glActiveTexture(GL_TEXTURE0 + unit);
+                    glBindTexture(GL_TEXTURE_2D, batch->draws[i].textureIds[unit]);
+                    if (unit > maxUnitUsed) maxUnitUsed = unit;
+                }
 
-        if (vertexShaderId != defaultVShaderId) glDeleteShader(vertexShaderId);
-        if (fragmentShaderId != defaultFShaderId) glDeleteShader(fragmentShaderId);
+                if (batch->draws[i].textureCount > 1) glActiveTexture(GL_TEXTURE0);
+#endif
+#if defined(SUPPORT_BATCH_TEXTURE_ARRAYS)
+                // Default shader only samples 2D textures, texture array draws use the default array shader
+                // NOTE: Custom shaders are expected to declare a texture0 sampler matching the draw texture type
+                if ((currentShader.id == defaultShader.id) && (defaultArrayShader.id > 0))
+                {
+                    Shader drawShader = batch->draws[i].textureArray? defaultArrayShader : defaultShader;
+
+                    if (drawShader.id != drawShaderId)
+                    {
+                        glUseProgram(drawShader.id);
+                        glUniformMatrix4fv(drawShader.locs[LOC_MATRIX_MVP], 1, false, MatrixToFloat(matMVP));
+                        glUniform4f(drawShader.locs[LOC_COLOR_DIFFUSE], 1.0f, 1.0f, 1.0f, 1.0f);
+                        glUniform1i(drawShader.locs[LOC_MAP_DIFFUSE], 0);
+
+                        drawShaderId = drawShader.id;
+                        renderStatsShaderId = drawShader.id;
+                        renderStats.shaderSwitches++;
+                    }
+                }
 
-        if (shader.id == 0)
-        {
-            TraceLog(LOG_WARNING, "Custom shader could not be loaded");
-            shader = defaultShader;
-        }
+                if (batch->draws[i].textureArray)
+                {
+                    glBindTexture(GL_TEXTURE_2D_ARRAY, batch->draws[i].textureId);
+                    textureArrayUsed = true;
+                }
+                else
+#endif
+                glBindTexture(GL_TEXTURE_2D, batch->draws[i].textureId);
 
-        // After shader loading, we TRY to set default location names
-        if (shader.id > 0) SetShaderDefaultLocations(&shader);
-    }
+#if defined(SUPPORT_BATCH_MULTITEXTURE)
+                renderStats.textureBinds += batch->draws[i].textureCount;
+#else
+                renderStats.textureBinds++;
+#endif
+                renderStats.drawCalls++;
+                renderStats.vertexCount += batch->draws[i].vertexCount*eyeInstances;
 
-    // Get available shader uniforms
-    // NOTE: This information is useful for debug...
-    int uniformCount = -1;
+                // TODO: Find some way to bind additional textures --> Use global texture IDs? Register them on draw[i]?
+                //if (currentShader->locs[LOC_MAP_SPECULAR] > 0) { glActiveTexture(GL_TEXTURE1); glBindTexture(GL_TEXTURE_2D, textureUnit1_id); }
+                //if (currentShader->locs[LOC_MAP_SPECULAR] > 0) { glActiveTexture(GL_TEXTURE2); glBindTexture(GL_TEXTURE_2D, textureUnit2_id); }
 
-    glGetProgramiv(shader.id, GL_ACTIVE_UNIFORMS, &uniformCount);
+                if ((batch->draws[i].mode == RL_POINTS) && (currentShader.id == defaultShader.id) && (defaultPointShader.id > 0))
+                {
+                    // Default shader doesn't write point size, points are drawn with default points shader
+                    glUseProgram(defaultPointShader.id);
+                    glUniformMatrix4fv(defaultPointShader.locs[LOC_MATRIX_MVP], 1, false, MatrixToFloat(matMVP));
+                    glUniform4f(defaultPointShader.locs[LOC_COLOR_DIFFUSE], 1.0f, 1.0f, 1.0f, 1.0f);
+                    glUniform1i(defaultPointShader.locs[LOC_MAP_DIFFUSE], 0);
+                    glUniform1f(defaultPointSizeLoc, pointSize);
+#if defined(GRAPHICS_API_OPENGL_21)
+                    glEnable(GL_POINT_SPRITE);
+#endif
+#if defined(GRAPHICS_API_OPENGL_33)
+                    glEnable(GL_PROGRAM_POINT_SIZE);
+#endif
+                    glDrawArrays(GL_POINTS, vertexOffset, batch->draws[i].vertexCount);
+#if defined(GRAPHICS_API_OPENGL_33)
+                    glDisable(GL_PROGRAM_POINT_SIZE);
+#endif
+#if defined(GRAPHICS_API_OPENGL_21)
+                    glDisable(GL_POINT_SPRITE);
+#endif
+                    glUseProgram(currentShader.id);
+                    renderStats.shaderSwitches += 2;
+#if defined(SUPPORT_BATCH_TEXTURE_ARRAYS)
+                    drawShaderId = currentShader.id;
+#endif
+                }
+                else if ((batch->draws[i].mode == RL_POINTS) || (batch->draws[i].mode == RL_LINES) || (batch->draws[i].mode == RL_TRIANGLES))
+                {
+#if defined(SUPPORT_VR_SINGLE_PASS)
+                    if (eyeInstances == 2) glDrawArraysInstanced(batch->draws[i].mode, vertexOffset, batch->draws[i].vertexCount, 2);
+                    else
+#endif
+                    glDrawArrays(batch->draws[i].mode, vertexOffset, batch->draws[i].vertexCount);
+                }
+                else
+                {
+#if defined(SUPPORT_VR_SINGLE_PASS)
+                    if (eyeInstances == 2) glDrawElementsInstanced(GL_TRIANGLES, batch->draws[i].vertexCount/4*6, GL_UNSIGNED_INT, (GLvoid *)(sizeof(GLuint)*vertexOffset/4*6), 2);
+                    else
+#endif
+#if defined(GRAPHICS_API_OPENGL_33)
+                    // We need to define the number of indices to be processed: quadsCount*6
+                    // NOTE: The final parameter tells the GPU the offset in bytes from the
+                    // start of the index buffer to the location of the first index to process
+                    glDrawElements(GL_TRIANGLES, batch->draws[i].vertexCount/4*6, GL_UNSIGNED_INT, (GLvoid *)(sizeof(GLuint)*vertexOffset/4*6));
+#elif defined(GRAPHICS_API_OPENGL_ES2)
+                    if (batch->indexUint) glDrawElements(GL_TRIANGLES, batch->draws[i].vertexCount/4*6, GL_UNSIGNED_INT, (GLvoid *)(sizeof(GLuint)*vertexOffset/4*6));
+                    else glDrawElements(GL_TRIANGLES, batch->draws[i].vertexCount/4*6, GL_UNSIGNED_SHORT, (GLvoid *)(sizeof(GLushort)*vertexOffset/4*6));
+#endif
+                }
 
-    for (int i = 0; i < uniformCount; i++)
-    {
-        int namelen = -1;
-        int num = -1;
-        char name[256]; // Assume no variable names longer than 256
-        GLenum type = GL_ZERO;
+                vertexOffset += (batch->draws[i].vertexCount + batch->draws[i].vertexAlignment);
+            }
 
-        // Get the name of the uniforms
-        glGetActiveUniform(shader.id, i,sizeof(name) - 1, &namelen, &num, &type, name);
+            // Restore current render state
+            DrawCall current = { 0 };
+            SetDrawCallState(&current);
+            ApplyDrawState(&current, &glState);
 
-        name[namelen] = 0;
+            if (!vaoSupported)
+            {
+                glBindBuffer(GL_ARRAY_BUFFER, 0);
+                glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+            }
 
-        // Get the location of the named uniform
-        unsigned int location = glGetUniformLocation(shader.id, name);
+#if defined(SUPPORT_BATCH_MULTITEXTURE)
+            for (int unit = maxUnitUsed; unit > 0; unit--)
+            {
+                glActiveTexture(GL_TEXTURE0 + unit);
+                glBindTexture(GL_TEXTURE_2D, 0);
+            }
 
-        TraceLog(LOG_DEBUG, "[SHDR ID %i] Active uniform [%s] set at location: %i", shader.id, name, location);
-    }
+            glActiveTexture(GL_TEXTURE0);
+#endif
+            glBindTexture(GL_TEXTURE_2D, 0);    // Unbind textures
+#if defined(SUPPORT_BATCH_TEXTURE_ARRAYS)
+            if (textureArrayUsed) glBindTexture(GL_TEXTURE_2D_ARRAY, 0);
+#endif
+#if defined(SUPPORT_VR_SINGLE_PASS)
+            if (eyeInstances == 2) glDisable(GL_CLIP_DISTANCE0);
 #endif
+        }
 
-    return shader;
-}
+        if (vaoSupported) glBindVertexArray(0); // Unbind VAO
 
-// Unload shader from GPU memory (VRAM)
-void UnloadShader(Shader shader)
-{
-    if (shader.id > 0)
+        glUseProgram(0);    // Unbind shader program
+    }
+
+#if defined(SUPPORT_BATCH_STREAMING)
+    // Track when GPU is done reading current buffer, so it can be safely written again
+    if (batchStreamMode != BATCH_STREAM_SUBDATA)
     {
-        rlDeleteShader(shader.id);
-        TraceLog(LOG_INFO, "[SHDR ID %i] Unloaded shader program data", shader.id);
+        if (buffer->fence != NULL) glDeleteSync(buffer->fence);
+        buffer->fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
     }
+#endif
 
-    RL_FREE(shader.locs);
+    // Restore projection/modelview matrices
+    projection = matProjection;
+    modelview = matModelView;
 }
 
-// Begin custom shader mode
-void BeginShaderMode(Shader shader)
+// Reset render batch vertex data and draw calls, next buffer in the list is used
+static void ResetBatch(RenderBatch *batch)
 {
-#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    if (currentShader.id != shader.id)
+    // Reset vertex counters for next frame
+    batch->vertexBuffer[batch->currentBuffer].vCounter = 0;
+    batch->vertexBuffer[batch->currentBuffer].tcCounter = 0;
+    batch->vertexBuffer[batch->currentBuffer].cCounter = 0;
+    batch->uploadedCount = 0;
+
+    // Reset depth for next draw
+    batch->currentDepth = -1.0f;
+
+    // Reset draws array
+    for (int i = 0; i < MAX_DRAWCALL_REGISTERED; i++)
     {
-        rlglDraw();
-        currentShader = shader;
+        batch->draws[i].mode = RL_QUADS;
+        batch->draws[i].vertexCount = 0;
+        batch->draws[i].vertexAlignment = 0;
+        batch->draws[i].textureId = defaultTextureId;
+        batch->draws[i].layer = currentDrawLayer;
+        SetDrawCallState(&batch->draws[i]);
+#if defined(SUPPORT_BATCH_MULTITEXTURE)
+        batch->draws[i].textureIds[0] = defaultTextureId;
+        batch->draws[i].textureCount = 1;
+#endif
+#if defined(SUPPORT_BATCH_TEXTURE_ARRAYS)
+        batch->draws[i].textureArray = false;
+#endif
     }
+
+    batch->drawsCounter = 1;
+#if defined(SUPPORT_BATCH_MULTITEXTURE)
+    if (batch == currentBatch) currentTextureUnit = 0;
 #endif
+
+    // Change to next buffer in the list
+    batch->currentBuffer++;
+    if (batch->currentBuffer >= batch->buffersCount) batch->currentBuffer = 0;
 }
 
-// End custom shader mode (returns to default shader)
-void EndShaderMode(void)
+// Unload render batch buffers vertex data from CPU and GPU
+static void UnloadBatchBuffers(RenderBatch *batch)
 {
-#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    BeginShaderMode(defaultShader);
+    // Unbind everything
+    if (vaoSupported) glBindVertexArray(0);
+    DisableVertexAttrib(0);
+    DisableVertexAttrib(1);
+    DisableVertexAttrib(2);
+    DisableVertexAttrib(3);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+
+    for (int i = 0; i < batch->buffersCount; i++)
+    {
+#if defined(SUPPORT_BATCH_STREAMING)
+        // Unmap persistent buffers and delete fences
+        for (int k = 0; k < 3; k++)
+        {
+            if (batch->vertexBuffer[i].mapped[k] != NULL)
+            {
+                glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[i].vboId[k]);
+                glUnmapBuffer(GL_ARRAY_BUFFER);
+                batch->vertexBuffer[i].mapped[k] = NULL;
+            }
+        }
+
+        glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+        if (batch->vertexBuffer[i].fence != NULL) glDeleteSync(batch->vertexBuffer[i].fence);
+        batch->vertexBuffer[i].fence = NULL;
+#endif
+        // Delete VBOs from GPU (VRAM)
+        glDeleteBuffers(1, &batch->vertexBuffer[i].vboId[0]);
+        glDeleteBuffers(1, &batch->vertexBuffer[i].vboId[1]);
+        glDeleteBuffers(1, &batch->vertexBuffer[i].vboId[2]);
+        glDeleteBuffers(1, &batch->vertexBuffer[i].vboId[3]);
+        for (int k = 0; k < 4; k++)
+        {
+            UntrackVideoMemory(VIDEO_MEMORY_BUFFER, batch->vertexBuffer[i].vboId[k]);
+            ResetVertexAttribs(batch->vertexBuffer[i].vboId[k]);
+        }
+
+        // Delete VAOs from GPU (VRAM)
+        if (vaoSupported) glDeleteVertexArrays(1, &batch->vertexBuffer[i].vaoId);
+
+        // Free vertex arrays memory from CPU (RAM)
+#if defined(SUPPORT_BATCH_INTERLEAVED)
+        RL_FREE(batch->vertexBuffer[i].elements);
+#else
+        RL_FREE(batch->vertexBuffer[i].vertices);
+        RL_FREE(batch->vertexBuffer[i].texcoords);
+        RL_FREE(batch->vertexBuffer[i].colors);
 #endif
+        RL_FREE(batch->vertexBuffer[i].indices);
+    }
+
+    // Free vertex buffers and draw calls array
+    RL_FREE(batch->vertexBuffer);
+    RL_FREE(batch->draws);
+    batch->vertexBuffer = NULL;
+    batch->draws = NULL;
+    batch->drawsCounter = 0;
 }
 
-// Get shader uniform location
-int GetShaderLocation(Shader shader, const char *uniformName)
+// Check if two draw calls can be merged into one (same mode, textures and render state)
+static bool IsDrawCallCompatible(const DrawCall *a, const DrawCall *b)
 {
-    int location = -1;
-#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    location = glGetUniformLocation(shader.id, uniformName);
+    if ((a->mode != b->mode) || (a->textureId != b->textureId)) return false;
+    if (!IsDrawStateEqual(a, b)) return false;
+#if defined(SUPPORT_BATCH_TEXTURE_ARRAYS)
+    if (a->textureArray != b->textureArray) return false;
+#endif
 
-    if (location == -1) TraceLog(LOG_WARNING, "[SHDR ID %i][%s] Shader uniform could not be found", shader.id, uniformName);
-    else TraceLog(LOG_INFO, "[SHDR ID %i][%s] Shader uniform set at location: %i", shader.id, uniformName, location);
+#if defined(SUPPORT_BATCH_MULTITEXTURE)
+    if (a->textureCount != b->textureCount) return false;
+    for (int i = 1; i < a->textureCount; i++) if (a->textureIds[i] != b->textureIds[i]) return false;
 #endif
-    return location;
+
+    return true;
 }
 
-// Set shader uniform value
-void SetShaderValue(Shader shader, int uniformLoc, const void *value, int uniformType)
+// Compare draw calls sorting key: layer, texture, mode
+static int CompareDrawCalls(const DrawCall *a, const DrawCall *b)
 {
-    SetShaderValueV(shader, uniformLoc, value, uniformType, 1);
+    if (a->layer != b->layer) return (a->layer < b->layer)? -1 : 1;
+    if (a->textureId != b->textureId) return (a->textureId < b->textureId)? -1 : 1;
+#if defined(SUPPORT_BATCH_TEXTURE_ARRAYS)
+    if (a->textureArray != b->textureArray) return (a->textureArray)? 1 : -1;
+#endif
+    if (a->mode != b->mode) return (a->mode < b->mode)? -1 : 1;
+    if (a->blendMode != b->blendMode) return (a->blendMode < b->blendMode)? -1 : 1;
+    if (a->scissorTest != b->scissorTest) return (a->scissorTest)? 1 : -1;
+    if (a->scissorTest) return memcmp(a->scissor, b->scissor, 4*sizeof(int));
+
+    return 0;
 }
 
-// Set shader uniform value vector
-void SetShaderValueV(Shader shader, int uniformLoc, const void *value, int uniformType, int count)
+// Start a new draw call keeping current draw call state (mode, texture, layer, render state)
+// NOTE: Only required if current draw call has vertex, vertex count is aligned (same as rlBegin())
+static void SplitDrawCall(void)
 {
-#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    glUseProgram(shader.id);
+    DrawCall *draw = &currentBatch->draws[currentBatch->drawsCounter - 1];
 
-    switch (uniformType)
+    if (draw->vertexCount > 0)
     {
-        case UNIFORM_FLOAT: glUniform1fv(uniformLoc, count, (float *)value); break;
-        case UNIFORM_VEC2: glUniform2fv(uniformLoc, count, (float *)value); break;
-        case UNIFORM_VEC3: glUniform3fv(uniformLoc, count, (float *)value); break;
-        case UNIFORM_VEC4: glUniform4fv(uniformLoc, count, (float *)value); break;
-        case UNIFORM_INT: glUniform1iv(uniformLoc, count, (int *)value); break;
-        case UNIFORM_IVEC2: glUniform2iv(uniformLoc, count, (int *)value); break;
-        case UNIFORM_IVEC3: glUniform3iv(uniformLoc, count, (int *)value); break;
-        case UNIFORM_IVEC4: glUniform4iv(uniformLoc, count, (int *)value); break;
-        case UNIFORM_SAMPLER2D: glUniform1iv(uniformLoc, count, (int *)value); break;
-        default: TraceLog(LOG_WARNING, "Shader uniform could not be set data type not recognized");
-    }
+        if (draw->mode == RL_LINES) draw->vertexAlignment = ((draw->vertexCount < 4)? draw->vertexCount : draw->vertexCount%4);
+        else if (draw->mode == RL_TRIANGLES) draw->vertexAlignment = ((draw->vertexCount < 4)? 1 : (4 - (draw->vertexCount%4)));
+        else if (draw->mode == RL_POINTS) draw->vertexAlignment = (4 - (draw->vertexCount%4))%4;
+        else draw->vertexAlignment = 0;
 
-    //glUseProgram(0);      // Avoid reseting current shader program, in case other uniforms are set
-#endif
-}
+        if (rlCheckBufferLimit(draw->vertexAlignment)) rlglDraw();
+        else
+        {
+            currentBatch->vertexBuffer[currentBatch->currentBuffer].vCounter += draw->vertexAlignment;
+            currentBatch->vertexBuffer[currentBatch->currentBuffer].cCounter += draw->vertexAlignment;
+            currentBatch->vertexBuffer[currentBatch->currentBuffer].tcCounter += draw->vertexAlignment;
 
+            currentBatch->drawsCounter++;
 
-// Set shader uniform value (matrix 4x4)
-void SetShaderValueMatrix(Shader shader, int uniformLoc, Matrix mat)
-{
-#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    glUseProgram(shader.id);
+            // New draw call keeps current state (mode and texture)
+            currentBatch->draws[currentBatch->drawsCounter - 1] = currentBatch->draws[currentBatch->drawsCounter - 2];
+            currentBatch->draws[currentBatch->drawsCounter - 1].vertexAlignment = 0;
+        }
 
-    glUniformMatrix4fv(uniformLoc, 1, false, MatrixToFloat(mat));
+        if (currentBatch->drawsCounter >= MAX_DRAWCALL_REGISTERED) rlglDraw();
+    }
 
-    //glUseProgram(0);
-#endif
+    currentBatch->draws[currentBatch->drawsCounter - 1].vertexCount = 0;
 }
 
-// Set shader uniform value for texture
-void SetShaderValueTexture(Shader shader, int uniformLoc, Texture2D texture)
+// Set draw call render state to current state: blend mode and scissor
+static void SetDrawCallState(DrawCall *draw)
 {
-#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    glUseProgram(shader.id);
-
-    glUniform1i(uniformLoc, texture.id);
-
-    //glUseProgram(0);
-#endif
+    draw->blendMode = blendMode;
+    draw->scissorTest = scissorTest;
+    memcpy(draw->scissor, scissorRect, 4*sizeof(int));
 }
 
-// Set a custom projection matrix (replaces internal projection matrix)
-void SetMatrixProjection(Matrix proj)
+// Check if two draw calls use the same render state (scissor rectangle ignored if scissor test disabled)
+static bool IsDrawStateEqual(const DrawCall *a, const DrawCall *b)
 {
-#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    projection = proj;
-#endif
-}
+    if ((a->blendMode != b->blendMode) || (a->scissorTest != b->scissorTest)) return false;
+    if (a->scissorTest && (memcmp(a->scissor, b->scissor, 4*sizeof(int)) != 0)) return false;
 
-// Return internal projection matrix
-Matrix GetMatrixProjection(void) {
-#if defined(GRAPHICS_API_OPENGL_11)
-    float mat[16];
-    glGetFloatv(GL_PROJECTION_MATRIX,mat);
-    Matrix m;
-    m.m0  = mat[0];     m.m1  = mat[1];     m.m2  = mat[2];     m.m3  = mat[3];
-    m.m4  = mat[4];     m.m5  = mat[5];     m.m6  = mat[6];     m.m7  = mat[7];
-    m.m8  = mat[8];     m.m9  = mat[9];     m.m10 = mat[10];    m.m11 = mat[11];
-    m.m12 = mat[12];    m.m13 = mat[13];    m.m14 = mat[14];    m.m15 = mat[15];
-    return m;
-#else
-    return projection;
-#endif
-#
+    return true;
 }
 
-// Set a custom modelview matrix (replaces internal modelview matrix)
-void SetMatrixModelview(Matrix view)
+// Update current render state (blend mode and scissor) for next draw calls
+// NOTE: Draw calls register their render state, current draw call is split if its state changes,
+// so state changes do not require a batch flush (GL state is applied by DrawBatchBuffers())
+static void UpdateDrawState(int mode, bool scissor, int x, int y, int width, int height)
 {
-#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    modelview = view;
-#endif
+    DrawCall state = { 0 };
+    state.blendMode = mode;
+    state.scissorTest = scissor;
+    state.scissor[0] = x;
+    state.scissor[1] = y;
+    state.scissor[2] = width;
+    state.scissor[3] = height;
+
+    // NOTE: Draw call is split before updating state, in case batch gets flushed
+    if (!IsDrawStateEqual(&currentBatch->draws[currentBatch->drawsCounter - 1], &state)) SplitDrawCall();
+
+    blendMode = mode;
+    scissorTest = scissor;
+    memcpy(scissorRect, state.scissor, 4*sizeof(int));
+
+    SetDrawCallState(&currentBatch->draws[currentBatch->drawsCounter - 1]);
 }
 
-// Return internal modelview matrix
-Matrix GetMatrixModelview(void)
+// Apply draw call render state, only state different from current GL state is set (glState is updated)
+static void ApplyDrawState(const DrawCall *draw, DrawCall *glState)
 {
-    Matrix matrix = MatrixIdentity();
-#if defined(GRAPHICS_API_OPENGL_11)
-    float mat[16];
-    glGetFloatv(GL_MODELVIEW_MATRIX, mat);
-    matrix.m0  = mat[0];     matrix.m1  = mat[1];     matrix.m2  = mat[2];     matrix.m3  = mat[3];
-    matrix.m4  = mat[4];     matrix.m5  = mat[5];     matrix.m6  = mat[6];     matrix.m7  = mat[7];
-    matrix.m8  = mat[8];     matrix.m9  = mat[9];     matrix.m10 = mat[10];    matrix.m11 = mat[11];
-    matrix.m12 = mat[12];    matrix.m13 = mat[13];    matrix.m14 = mat[14];    matrix.m15 = mat[15];
-#else
-    matrix = modelview;
-#endif
-    return matrix;
+    if (draw->blendMode != glState->blendMode) SetBlendFunction(draw->blendMode);
+
+    if (draw->scissorTest != glState->scissorTest)
+    {
+        if (draw->scissorTest) glEnable(GL_SCISSOR_TEST);
+        else glDisable(GL_SCISSOR_TEST);
+    }
+
+    if (memcmp(draw->scissor, glState->scissor, 4*sizeof(int)) != 0) glScissor(draw->scissor[0], draw->scissor[1], draw->scissor[2], draw->scissor[3]);
+
+    *glState = *draw;
 }
 
-// Generate cubemap texture from HDR texture
-// TODO: OpenGL ES 2.0 does not support GL_RGB16F texture format, neither GL_DEPTH_COMPONENT24
-Texture2D GenTextureCubemap(Shader shader, Texture2D map, int size)
+// Add multiple vertex to current batch: positions (XYZ), texcoords (UV, optional) and colors (RGBA, optional)
+// NOTE: Vertex that do not fit in batch are discarded (same as rlVertex3f()), rlCheckBufferLimit() should be used before
+static void AddBatchVertices(const float *vertices, const float *texcoords, const unsigned char *colors, int count)
 {
-    Texture2D cubemap = { 0 };
-#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    // NOTE: SetShaderDefaultLocations() already setups locations for projection and view Matrix in shader
-    // Other locations should be setup externally in shader before calling the function
+    DynamicBuffer *buffer = &currentBatch->vertexBuffer[currentBatch->currentBuffer];
 
-    // Set up depth face culling and cubemap seamless
-    glDisable(GL_CULL_FACE);
-#if defined(GRAPHICS_API_OPENGL_33)
-    glEnable(GL_TEXTURE_CUBE_MAP_SEAMLESS);     // Flag not supported on OpenGL ES 2.0
-#endif
+    int available = currentBatch->elements*4 - buffer->vCounter;
+    if (count > available)
+    {
+        TraceLog(LOG_ERROR, "Batch elements overflow (%i)", currentBatch->elements);
+        count = available;
+    }
 
-    // Setup framebuffer
-    unsigned int fbo, rbo;
-    glGenFramebuffers(1, &fbo);
-    glGenRenderbuffers(1, &rbo);
-    glBindFramebuffer(GL_FRAMEBUFFER, fbo);
-    glBindRenderbuffer(GL_RENDERBUFFER, rbo);
-#if defined(GRAPHICS_API_OPENGL_33)
-    glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH_COMPONENT24, size, size);
-#elif defined(GRAPHICS_API_OPENGL_ES2)
-    glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH_COMPONENT16, size, size);
-#endif
-    glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_RENDERBUFFER, rbo);
+    if (count <= 0) return;
 
-    // Set up cubemap to render and attach to framebuffer
-    // NOTE: Faces are stored as 32 bit floating point values
-    glGenTextures(1, &cubemap.id);
-    glBindTexture(GL_TEXTURE_CUBE_MAP, cubemap.id);
-    for (unsigned int i = 0; i < 6; i++)
+    int start = buffer->vCounter;
+
+    // Complete previous vertex colors/texcoords (same as rlEnd()), so provided ones are aligned with positions
+    if (colors != NULL)
     {
-#if defined(GRAPHICS_API_OPENGL_33)
-        glTexImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_X + i, 0, GL_RGB32F, size, size, 0, GL_RGB, GL_FLOAT, NULL);
-#elif defined(GRAPHICS_API_OPENGL_ES2)
-        if (texFloatSupported) glTexImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_X + i, 0, GL_RGB, size, size, 0, GL_RGB, GL_FLOAT, NULL);
+        for (; buffer->cCounter < start; buffer->cCounter++)
+        {
+#if defined(SUPPORT_BATCH_INTERLEAVED)
+            if (buffer->cCounter > 0) memcpy(buffer->elements[buffer->cCounter].color, buffer->elements[buffer->cCounter - 1].color, 4);
+#else
+            if (buffer->cCounter > 0) memcpy(buffer->colors + 4*buffer->cCounter, buffer->colors + 4*(buffer->cCounter - 1), 4);
 #endif
+        }
     }
 
-    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
-    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
-#if defined(GRAPHICS_API_OPENGL_33)
-    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_R, GL_CLAMP_TO_EDGE);  // Flag not supported on OpenGL ES 2.0
+    if (texcoords != NULL)
+    {
+        for (; buffer->tcCounter < start; buffer->tcCounter++)
+        {
+#if defined(SUPPORT_BATCH_INTERLEAVED)
+            buffer->elements[buffer->tcCounter].texcoord[0] = 0.0f;
+            buffer->elements[buffer->tcCounter].texcoord[1] = 0.0f;
+#else
+            buffer->texcoords[2*buffer->tcCounter] = 0.0f;
+            buffer->texcoords[2*buffer->tcCounter + 1] = 0.0f;
 #endif
-    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+        }
+    }
 
-    // Create projection and different views for each face
-    Matrix fboProjection = MatrixPerspective(90.0*DEG2RAD, 1.0, DEFAULT_NEAR_CULL_DISTANCE, DEFAULT_FAR_CULL_DISTANCE);
-    Matrix fboViews[6] = {
-        MatrixLookAt((Vector3){ 0.0f, 0.0f, 0.0f }, (Vector3){ 1.0f, 0.0f, 0.0f }, (Vector3){ 0.0f, -1.0f, 0.0f }),
-        MatrixLookAt((Vector3){ 0.0f, 0.0f, 0.0f }, (Vector3){ -1.0f, 0.0f, 0.0f }, (Vector3){ 0.0f, -1.0f, 0.0f }),
-        MatrixLookAt((Vector3){ 0.0f, 0.0f, 0.0f }, (Vector3){ 0.0f, 1.0f, 0.0f }, (Vector3){ 0.0f, 0.0f, 1.0f }),
-        MatrixLookAt((Vector3){ 0.0f, 0.0f, 0.0f }, (Vector3){ 0.0f, -1.0f, 0.0f }, (Vector3){ 0.0f, 0.0f, -1.0f }),
-        MatrixLookAt((Vector3){ 0.0f, 0.0f, 0.0f }, (Vector3){ 0.0f, 0.0f, 1.0f }, (Vector3){ 0.0f, -1.0f, 0.0f }),
-        MatrixLookAt((Vector3){ 0.0f, 0.0f, 0.0f }, (Vector3){ 0.0f, 0.0f, -1.0f }, (Vector3){ 0.0f, -1.0f, 0.0f })
-    };
+#if defined(SUPPORT_BATCH_INTERLEAVED)
+    BatchVertex *elements = buffer->elements + start;
+    const int stride = sizeof(BatchVertex)/sizeof(float);
 
-    // Convert HDR equirectangular environment map to cubemap equivalent
-    glUseProgram(shader.id);
-    glActiveTexture(GL_TEXTURE0);
-    glBindTexture(GL_TEXTURE_2D, map.id);
-    SetShaderValueMatrix(shader, shader.locs[LOC_MATRIX_PROJECTION], fboProjection);
+    if (useTransformMatrix) TransformPositions(elements->position, stride, vertices, count, &transformMatrix);
+    else for (int i = 0; i < count; i++) memcpy(elements[i].position, vertices + i*3, 3*sizeof(float));
 
-    // Note: don't forget to configure the viewport to the capture dimensions
-    glViewport(0, 0, size, size);
-    glBindFramebuffer(GL_FRAMEBUFFER, fbo);
+    if (texcoords != NULL) for (int i = 0; i < count; i++) memcpy(elements[i].texcoord, texcoords + i*2, 2*sizeof(float));
+    if (colors != NULL) for (int i = 0; i < count; i++) memcpy(elements[i].color, colors + i*4, 4);
 
-    for (int i = 0; i < 6; i++)
+#if defined(SUPPORT_BATCH_MULTITEXTURE) || defined(SUPPORT_BATCH_TEXTURE_ARRAYS)
+    for (int i = 0; i < count; i++)
     {
-        SetShaderValueMatrix(shader, shader.locs[LOC_MATRIX_VIEW], fboViews[i]);
-        glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_CUBE_MAP_POSITIVE_X + i, cubemap.id, 0);
-        glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
-        GenDrawCube();
+    #if defined(SUPPORT_BATCH_MULTITEXTURE)
+        elements[i].texUnit = (unsigned char)currentTextureUnit;
+    #endif
+    #if defined(SUPPORT_BATCH_TEXTURE_ARRAYS)
+        elements[i].texLayer = (unsigned short)currentTexLayer;
+    #endif
     }
+#endif
+#else
+    if (useTransformMatrix) TransformPositions(buffer->vertices + 3*start, 3, vertices, count, &transformMatrix);
+    else memcpy(buffer->vertices + 3*start, vertices, 3*count*sizeof(float));
 
-    // Unbind framebuffer and textures
-    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    if (texcoords != NULL) memcpy(buffer->texcoords + 2*start, texcoords, 2*count*sizeof(float));
+    if (colors != NULL) memcpy(buffer->colors + 4*start, colors, 4*count);
+#endif
 
-    // Reset viewport dimensions to default
-    glViewport(0, 0, framebufferWidth, framebufferHeight);
-    //glEnable(GL_CULL_FACE);
+    buffer->vCounter += count;
+    if (texcoords != NULL) buffer->tcCounter = buffer->vCounter;
+    if (colors != NULL) buffer->cCounter = buffer->vCounter;
 
-    // NOTE: Texture2D is a GL_TEXTURE_CUBE_MAP, not a GL_TEXTURE_2D!
-    cubemap.width = size;
-    cubemap.height = size;
-    cubemap.mipmaps = 1;
-    cubemap.format = UNCOMPRESSED_R32G32B32;
-#endif
-    return cubemap;
+    currentBatch->draws[currentBatch->drawsCounter - 1].vertexCount += count;
 }
 
-// Generate irradiance texture using cubemap data
-// TODO: OpenGL ES 2.0 does not support GL_RGB16F texture format, neither GL_DEPTH_COMPONENT24
-Texture2D GenTextureIrradiance(Shader shader, Texture2D cubemap, int size)
+// Transform positions (XYZ) by matrix, destination positions are dstStride floats apart
+// NOTE: Same operation as Vector3Transform(), matrix columns are kept in registers for all vertex
+static void TransformPositions(float *dst, int dstStride, const float *src, int count, const Matrix *mat)
 {
-    Texture2D irradiance = { 0 };
+#if defined(RLGL_SIMD_SSE)
+    __m128 col0 = _mm_setr_ps(mat->m0, mat->m1, mat->m2, mat->m3);
+    __m128 col1 = _mm_setr_ps(mat->m4, mat->m5, mat->m6, mat->m7);
+    __m128 col2 = _mm_setr_ps(mat->m8, mat->m9, mat->m10, mat->m11);
+    __m128 col3 = _mm_setr_ps(mat->m12, mat->m13, mat->m14, mat->m15);
 
-#if defined(GRAPHICS_API_OPENGL_33) // || defined(GRAPHICS_API_OPENGL_ES2)
-    // NOTE: SetShaderDefaultLocations() already setups locations for projection and view Matrix in shader
-    // Other locations should be setup externally in shader before calling the function
+    for (int i = 0; i < count; i++, src += 3, dst += dstStride)
+    {
+        __m128 result = _mm_add_ps(_mm_add_ps(_mm_mul_ps(col0, _mm_set1_ps(src[0])), _mm_mul_ps(col1, _mm_set1_ps(src[1]))),
+                                   _mm_add_ps(_mm_mul_ps(col2, _mm_set1_ps(src[2])), col3));
 
-    // Setup framebuffer
-    unsigned int fbo, rbo;
-    glGenFramebuffers(1, &fbo);
-    glGenRenderbuffers(1, &rbo);
-    glBindFramebuffer(GL_FRAMEBUFFER, fbo);
-    glBindRenderbuffer(GL_RENDERBUFFER, rbo);
-    glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH_COMPONENT24, size, size);
-    glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_RENDERBUFFER, rbo);
+        // NOTE: Only XYZ stored, next float in destination could be other vertex attribute
+        _mm_storel_pi((__m64 *)dst, result);
+        _mm_store_ss(dst + 2, _mm_movehl_ps(result, result));
+    }
+#elif defined(RLGL_SIMD_NEON)
+    const float cols[4][4] = {
+        { mat->m0, mat->m1, mat->m2, mat->m3 },
+        { mat->m4, mat->m5, mat->m6, mat->m7 },
+        { mat->m8, mat->m9, mat->m10, mat->m11 },
+        { mat->m12, mat->m13, mat->m14, mat->m15 }
+    };
+    float32x4_t col0 = vld1q_f32(cols[0]);
+    float32x4_t col1 = vld1q_f32(cols[1]);
+    float32x4_t col2 = vld1q_f32(cols[2]);
+    float32x4_t col3 = vld1q_f32(cols[3]);
 
-    // Create an irradiance cubemap, and re-scale capture FBO to irradiance scale
-    glGenTextures(1, &irradiance.id);
-    glBindTexture(GL_TEXTURE_CUBE_MAP, irradiance.id);
-    for (unsigned int i = 0; i < 6; i++)
+    for (int i = 0; i < count; i++, src += 3, dst += dstStride)
     {
-        glTexImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_X + i, 0, GL_RGB16F, size, size, 0, GL_RGB, GL_FLOAT, NULL);
+        float32x4_t result = vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(col3, col0, src[0]), col1, src[1]), col2, src[2]);
+
+        // NOTE: Only XYZ stored, next float in destination could be other vertex attribute
+        vst1_f32(dst, vget_low_f32(result));
+        dst[2] = vgetq_lane_f32(result, 2);
     }
+#else
+    const float m0 = mat->m0, m1 = mat->m1, m2 = mat->m2;
+    const float m4 = mat->m4, m5 = mat->m5, m6 = mat->m6;
+    const float m8 = mat->m8, m9 = mat->m9, m10 = mat->m10;
+    const float m12 = mat->m12, m13 = mat->m13, m14 = mat->m14;
 
-    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
-    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
-    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_R, GL_CLAMP_TO_EDGE);
-    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    for (int i = 0; i < count; i++, src += 3, dst += dstStride)
+    {
+        float x = src[0], y = src[1], z = src[2];
 
-    // Create projection (transposed) and different views for each face
-    Matrix fboProjection = MatrixPerspective(90.0*DEG2RAD, 1.0, DEFAULT_NEAR_CULL_DISTANCE, DEFAULT_FAR_CULL_DISTANCE);
-    Matrix fboViews[6] = {
-        MatrixLookAt((Vector3){ 0.0f, 0.0f, 0.0f }, (Vector3){ 1.0f, 0.0f, 0.0f }, (Vector3){ 0.0f, -1.0f, 0.0f }),
-        MatrixLookAt((Vector3){ 0.0f, 0.0f, 0.0f }, (Vector3){ -1.0f, 0.0f, 0.0f }, (Vector3){ 0.0f, -1.0f, 0.0f }),
-        MatrixLookAt((Vector3){ 0.0f, 0.0f, 0.0f }, (Vector3){ 0.0f, 1.0f, 0.0f }, (Vector3){ 0.0f, 0.0f, 1.0f }),
-        MatrixLookAt((Vector3){ 0.0f, 0.0f, 0.0f }, (Vector3){ 0.0f, -1.0f, 0.0f }, (Vector3){ 0.0f, 0.0f, -1.0f }),
-        MatrixLookAt((Vector3){ 0.0f, 0.0f, 0.0f }, (Vector3){ 0.0f, 0.0f, 1.0f }, (Vector3){ 0.0f, -1.0f, 0.0f }),
-        MatrixLookAt((Vector3){ 0.0f, 0.0f, 0.0f }, (Vector3){ 0.0f, 0.0f, -1.0f }, (Vector3){ 0.0f, -1.0f, 0.0f })
-    };
+        dst[0] = m0*x + m4*y + m8*z + m12;
+        dst[1] = m1*x + m5*y + m9*z + m13;
+        dst[2] = m2*x + m6*y + m10*z + m14;
+    }
+#endif
+}
 
-    // Solve diffuse integral by convolution to create an irradiance cubemap
-    glUseProgram(shader.id);
-    glActiveTexture(GL_TEXTURE0);
-    glBindTexture(GL_TEXTURE_CUBE_MAP, cubemap.id);
-    SetShaderValueMatrix(shader, shader.locs[LOC_MATRIX_PROJECTION], fboProjection);
+// Copy vertex data range between dynamic buffers
+static void CopyBufferVertices(DynamicBuffer *dst, int dstOffset, const DynamicBuffer *src, int srcOffset, int count)
+{
+#if defined(SUPPORT_BATCH_INTERLEAVED)
+    memcpy(dst->elements + dstOffset, src->elements + srcOffset, sizeof(BatchVertex)*count);
+#else
+    memcpy(dst->vertices + 3*dstOffset, src->vertices + 3*srcOffset, sizeof(float)*3*count);
+    memcpy(dst->texcoords + 2*dstOffset, src->texcoords + 2*srcOffset, sizeof(float)*2*count);
+    memcpy(dst->colors + 4*dstOffset, src->colors + 4*srcOffset, sizeof(unsigned char)*4*count);
+#endif
+}
+
+// Sort and merge registered draw calls, reordering vertex data
+// NOTE: Shader and blending mode changes already force a batch draw, so they are constant
+
+#if defined(GRAPHICS_API_OPENGL_33)
+// Upload frame uniform block data: current view and projection matrices and time
+// NOTE: Buffer is only updated if values changed, all shaders declaring the block share it
+static void UpdateFrameBlock(void)
+{
+    if (frameBlockId == 0) return;
+
+    float16 matView = MatrixToFloatV(modelview);
+    float16 matProjection = MatrixToFloatV(projection);
+
+    if (frameBlockDirty || (memcmp(frameBlock.matView, matView.v, sizeof(frameBlock.matView)) != 0) ||
+        (memcmp(frameBlock.matProjection, matProjection.v, sizeof(frameBlock.matProjection)) != 0))
+    {
+        memcpy(frameBlock.matView, matView.v, sizeof(frameBlock.matView));
+        memcpy(frameBlock.matProjection, matProjection.v, sizeof(frameBlock.matProjection));
+
+        glBindBuffer(GL_UNIFORM_BUFFER, frameBlockId);
+        glBufferSubData(GL_UNIFORM_BUFFER, 0, sizeof(FrameBlockData), &frameBlock);
+        glBindBuffer(GL_UNIFORM_BUFFER, 0);
+
+        renderStats.uploadedBytes += sizeof(FrameBlockData);
+        frameBlockDirty = false;
+    }
+}
+#endif
 
-    // Note: don't forget to configure the viewport to the capture dimensions
-    glViewport(0, 0, size, size);
-    glBindFramebuffer(GL_FRAMEBUFFER, fbo);
+#if defined(GRAPHICS_API_OPENGL_33)
+// Wait until GPU completes frame (dynamic meshes buffers copies drawn on it can be written)
+// NOTE: Returns false if frame is not ended yet (its fence is not placed), completed frames are not waited again
+static bool WaitMeshFrame(unsigned int frame)
+{
+    if (frame <= meshFrameCompleted) return true;
+    if (frame >= meshFrame) return false;
 
-    for (int i = 0; i < 6; i++)
+    // NOTE: Frames without fence did not draw dynamic meshes
+    for (int i = 0; i < MAX_MESH_BUFFERING; i++)
     {
-        SetShaderValueMatrix(shader, shader.locs[LOC_MATRIX_VIEW], fboViews[i]);
-        glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_CUBE_MAP_POSITIVE_X + i, irradiance.id, 0);
-        glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
-        GenDrawCube();
-    }
+        if ((meshFrameFences[i] != NULL) && (meshFenceFrames[i] <= frame))
+        {
+            GLbitfield flags = GL_SYNC_FLUSH_COMMANDS_BIT;
 
-    // Unbind framebuffer and textures
-    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+            while (true)
+            {
+                GLenum result = glClientWaitSync(meshFrameFences[i], flags, 1000000);  // 1 ms timeout (in nanoseconds)
 
-    // Reset viewport dimensions to default
-    glViewport(0, 0, framebufferWidth, framebufferHeight);
+                if ((result == GL_ALREADY_SIGNALED) || (result == GL_CONDITION_SATISFIED) || (result == GL_WAIT_FAILED)) break;
 
-    irradiance.width = size;
-    irradiance.height = size;
-    irradiance.mipmaps = 1;
-    //irradiance.format = UNCOMPRESSED_R16G16B16;
-#endif
-    return irradiance;
+                flags = 0;  // Commands only need to be flushed once
+            }
+
+            glDeleteSync(meshFrameFences[i]);
+            meshFrameFences[i] = NULL;
+        }
+    }
+
+    meshFrameCompleted = frame;
+
+    return true;
 }
 
-// Generate prefilter texture using cubemap data
-// TODO: OpenGL ES 2.0 does not support GL_RGB16F texture format, neither GL_DEPTH_COMPONENT24
-Texture2D GenTexturePrefilter(Shader shader, Texture2D cubemap, int size)
+// Upload mesh buffer range (vertices or triangles for indices) from mesh CPU data to buffer copy
+// NOTE: Range is written without synchronization if GPU is done with copy, otherwise driver synchronizes it
+static void UploadMeshStreamRange(Mesh mesh, int buffer, int copy, int start, int end, bool unsynchronized)
 {
-    Texture2D prefilter = { 0 };
+    MeshStream *stream = (MeshStream *)mesh.stream;
+    int size = 0;
+    const unsigned char *data = GetMeshBufferData(mesh, buffer, &size);
 
-#if defined(GRAPHICS_API_OPENGL_33) // || defined(GRAPHICS_API_OPENGL_ES2)
-    // NOTE: SetShaderDefaultLocations() already setups locations for projection and view Matrix in shader
-    // Other locations should be setup externally in shader before calling the function
-    // TODO: Locations should be taken out of this function... too shader dependant...
-    int roughnessLoc = GetShaderLocation(shader, "roughness");
+    if ((data == NULL) || (mesh.vboId[buffer] == 0)) return;
 
-    // Setup framebuffer
-    unsigned int fbo, rbo;
-    glGenFramebuffers(1, &fbo);
-    glGenRenderbuffers(1, &rbo);
-    glBindFramebuffer(GL_FRAMEBUFFER, fbo);
-    glBindRenderbuffer(GL_RENDERBUFFER, rbo);
-    glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH_COMPONENT24, size, size);
-    glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_RENDERBUFFER, rbo);
+    GLenum target = (buffer == 6)? GL_ELEMENT_ARRAY_BUFFER : GL_ARRAY_BUFFER;
+    int capacity = (buffer == 6)? stream->triangleCapacity : stream->vertexCapacity;
+    GLintptr offset = (GLintptr)(copy*capacity + start)*size;
+    GLsizeiptr dataSize = (GLsizeiptr)(end - start)*size;
 
-    // Create a prefiltered HDR environment map
-    glGenTextures(1, &prefilter.id);
-    glBindTexture(GL_TEXTURE_CUBE_MAP, prefilter.id);
-    for (unsigned int i = 0; i < 6; i++)
+    glBindBuffer(target, mesh.vboId[buffer]);
+
+    renderStats.uploadedBytes += (int)dataSize;
+
+    if (unsynchronized)
     {
-        glTexImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_X + i, 0, GL_RGB16F, size, size, 0, GL_RGB, GL_FLOAT, NULL);
+        void *mapped = glMapBufferRange(target, offset, dataSize, GL_MAP_WRITE_BIT | GL_MAP_UNSYNCHRONIZED_BIT | GL_MAP_INVALIDATE_RANGE_BIT);
+
+        if (mapped != NULL)
+        {
+            memcpy(mapped, data + start*size, dataSize);
+
+            // NOTE: Buffer data could be corrupted on unmap (i.e. screen mode change), just upload it again
+            if (glUnmapBuffer(target) == GL_TRUE) return;
+        }
     }
 
-    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
-    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
-    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_R, GL_CLAMP_TO_EDGE);
-    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
-    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    glBufferSubData(target, offset, dataSize, data + start*size);
+}
+#endif
 
-    // Generate mipmaps for the prefiltered HDR texture
-    glGenerateMipmap(GL_TEXTURE_CUBE_MAP);
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+// Enable shader program, material values, texture maps and mesh vertex buffers for mesh drawing
+// NOTE: Only state that differs from previous mesh draw is sent to GL, state is kept bound after drawing
+static void EnableMeshMaterial(Mesh mesh, Material material)
+{
+    // Notify texture maps usage, evicted textures could be reloaded (it releases mesh state)
+    if (textureUseCallback != NULL)
+    {
+        for (int i = 0; i < MAX_MATERIAL_MAPS; i++) if (material.maps[i].texture.id > 0) textureUseCallback(material.maps[i].texture.id);
+    }
 
-    // Create projection (transposed) and different views for each face
-    Matrix fboProjection = MatrixPerspective(90.0*DEG2RAD, 1.0, DEFAULT_NEAR_CULL_DISTANCE, DEFAULT_FAR_CULL_DISTANCE);
-    Matrix fboViews[6] = {
-        MatrixLookAt((Vector3){ 0.0f, 0.0f, 0.0f }, (Vector3){ 1.0f, 0.0f, 0.0f }, (Vector3){ 0.0f, -1.0f, 0.0f }),
-        MatrixLookAt((Vector3){ 0.0f, 0.0f, 0.0f }, (Vector3){ -1.0f, 0.0f, 0.0f }, (Vector3){ 0.0f, -1.0f, 0.0f }),
-        MatrixLookAt((Vector3){ 0.0f, 0.0f, 0.0f }, (Vector3){ 0.0f, 1.0f, 0.0f }, (Vector3){ 0.0f, 0.0f, 1.0f }),
-        MatrixLookAt((Vector3){ 0.0f, 0.0f, 0.0f }, (Vector3){ 0.0f, -1.0f, 0.0f }, (Vector3){ 0.0f, 0.0f, -1.0f }),
-        MatrixLookAt((Vector3){ 0.0f, 0.0f, 0.0f }, (Vector3){ 0.0f, 0.0f, 1.0f }, (Vector3){ 0.0f, -1.0f, 0.0f }),
-        MatrixLookAt((Vector3){ 0.0f, 0.0f, 0.0f }, (Vector3){ 0.0f, 0.0f, -1.0f }, (Vector3){ 0.0f, -1.0f, 0.0f })
-    };
+#if defined(GRAPHICS_API_OPENGL_33)
+    UpdateFrameBlock();     // Upload frame values shared by all shaders (if changed)
+#endif
 
-    // Prefilter HDR and store data into mipmap levels
-    glUseProgram(shader.id);
-    glActiveTexture(GL_TEXTURE0);
-    glBindTexture(GL_TEXTURE_CUBE_MAP, cubemap.id);
-    SetShaderValueMatrix(shader, shader.locs[LOC_MATRIX_PROJECTION], fboProjection);
+    // Bind shader program
+    if (!meshState.active || (meshState.shaderId != material.shader.id))
+    {
+        glUseProgram(material.shader.id);
 
-    glBindFramebuffer(GL_FRAMEBUFFER, fbo);
+        if (material.shader.id != renderStatsShaderId) renderStats.shaderSwitches++;
+        renderStatsShaderId = material.shader.id;
 
-    #define MAX_MIPMAP_LEVELS   5   // Max number of prefilter texture mipmaps
+        // Uniforms values (and attributes locations if no VAO) belong to previous shader
+        meshState.shaderId = material.shader.id;
+        if (!vaoSupported) meshState.vertexId = 0;
+        meshState.samplersSet = 0;
+        meshState.colorsSet = false;
+        meshState.matricesSet = false;
+    }
 
-    for (int mip = 0; mip < MAX_MIPMAP_LEVELS; mip++)
+    meshState.active = true;
+
+    // Upload to shader material.colDiffuse and material.colSpecular (if available)
+    Color colDiffuse = material.maps[MAP_DIFFUSE].color;
+    Color colSpecular = material.maps[MAP_SPECULAR].color;
+
+    if (!meshState.colorsSet || (memcmp(&meshState.colDiffuse, &colDiffuse, sizeof(Color)) != 0) || (memcmp(&meshState.colSpecular, &colSpecular, sizeof(Color)) != 0))
     {
-        // Resize framebuffer according to mip-level size.
-        unsigned int mipWidth  = size*(int)powf(0.5f, (float)mip);
-        unsigned int mipHeight = size*(int)powf(0.5f, (float)mip);
+        if (material.shader.locs[LOC_COLOR_DIFFUSE] != -1)
+            glUniform4f(material.shader.locs[LOC_COLOR_DIFFUSE], (float)colDiffuse.r/255.0f, (float)colDiffuse.g/255.0f,
+                                                               (float)colDiffuse.b/255.0f, (float)colDiffuse.a/255.0f);
 
-        glBindRenderbuffer(GL_RENDERBUFFER, rbo);
-        glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH_COMPONENT24, mipWidth, mipHeight);
-        glViewport(0, 0, mipWidth, mipHeight);
+        if (material.shader.locs[LOC_COLOR_SPECULAR] != -1)
+            glUniform4f(material.shader.locs[LOC_COLOR_SPECULAR], (float)colSpecular.r/255.0f, (float)colSpecular.g/255.0f,
+                                                                (float)colSpecular.b/255.0f, (float)colSpecular.a/255.0f);
 
-        float roughness = (float)mip/(float)(MAX_MIPMAP_LEVELS - 1);
-        glUniform1f(roughnessLoc, roughness);
+        meshState.colDiffuse = colDiffuse;
+        meshState.colSpecular = colSpecular;
+        meshState.colorsSet = true;
+    }
 
-        for (int i = 0; i < 6; i++)
+    // Upload to shader view and projection matrices (if available)
+    if (!meshState.matricesSet || (memcmp(&meshState.matView, &modelview, sizeof(Matrix)) != 0) || (memcmp(&meshState.matProjection, &projection, sizeof(Matrix)) != 0))
+    {
+        if (material.shader.locs[LOC_MATRIX_VIEW] != -1) glUniformMatrix4fv(material.shader.locs[LOC_MATRIX_VIEW], 1, false, MatrixToFloat(modelview));
+        if (material.shader.locs[LOC_MATRIX_PROJECTION] != -1) glUniformMatrix4fv(material.shader.locs[LOC_MATRIX_PROJECTION], 1, false, MatrixToFloat(projection));
+
+        meshState.matView = modelview;
+        meshState.matProjection = projection;
+        meshState.matricesSet = true;
+    }
+
+    // Bind active texture maps (if available)
+    // NOTE: Units not used by this material are unbound, as if no previous mesh was drawn
+    for (int i = 0; i < MAX_MATERIAL_MAPS; i++)
+    {
+        if (meshState.textureIds[i] != material.maps[i].texture.id)
         {
-            SetShaderValueMatrix(shader, shader.locs[LOC_MATRIX_VIEW], fboViews[i]);
-            glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_CUBE_MAP_POSITIVE_X + i, prefilter.id, mip);
-            glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
-            GenDrawCube();
+            glActiveTexture(GL_TEXTURE0 + i);
+            if ((i == MAP_IRRADIANCE) || (i == MAP_PREFILTER) || (i == MAP_CUBEMAP)) glBindTexture(GL_TEXTURE_CUBE_MAP, material.maps[i].texture.id);
+            else glBindTexture(GL_TEXTURE_2D, material.maps[i].texture.id);
+
+            if (material.maps[i].texture.id > 0) renderStats.textureBinds++;
+            meshState.textureIds[i] = material.maps[i].texture.id;
+        }
+
+        if ((material.maps[i].texture.id > 0) && !(meshState.samplersSet & (1u << i)))
+        {
+            glUniform1i(material.shader.locs[LOC_MAP_DIFFUSE + i], i);
+            meshState.samplersSet |= (1u << i);
         }
     }
 
-    // Unbind framebuffer and textures
-    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    // Bind vertex array objects (or VBOs)
+    if (vaoSupported)
+    {
+        if (meshState.vertexId != mesh.vaoId) glBindVertexArray(mesh.vaoId);
+        meshState.vertexId = mesh.vaoId;
+    }
+    else if (meshState.vertexId != mesh.vboId[0])
+    {
+        // NOTE: Vertex attributes are only set if different from current ones (software vertex array state)
 
-    // Reset viewport dimensions to default
-    glViewport(0, 0, framebufferWidth, framebufferHeight);
+        // Bind mesh VBO data: vertex position (shader-location = 0)
+        SetMeshVertexAttrib(material.shader.locs[LOC_VERTEX_POSITION], mesh.vboId[0], 0, mesh.vertexFormat);
 
-    prefilter.width = size;
-    prefilter.height = size;
-    //prefilter.mipmaps = 1 + (int)floor(log(size)/log(2));
-    //prefilter.format = UNCOMPRESSED_R16G16B16;
-#endif
-    return prefilter;
-}
+        // Bind mesh VBO data: vertex texcoords (shader-location = 1)
+        SetMeshVertexAttrib(material.shader.locs[LOC_VERTEX_TEXCOORD01], mesh.vboId[1], 1, mesh.vertexFormat);
 
-// Generate BRDF texture using cubemap data
-// NOTE: OpenGL ES 2.0 does not support GL_RGB16F texture format, neither GL_DEPTH_COMPONENT24
-// TODO: Review implementation: https://github.com/HectorMF/BRDFGenerator
-Texture2D GenTextureBRDF(Shader shader, int size)
-{
-    Texture2D brdf = { 0 };
-#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    // Generate BRDF convolution texture
-    glGenTextures(1, &brdf.id);
-    glBindTexture(GL_TEXTURE_2D, brdf.id);
-#if defined(GRAPHICS_API_OPENGL_33)
-    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGB32F, size, size, 0, GL_RGB, GL_FLOAT, NULL);
-#elif defined(GRAPHICS_API_OPENGL_ES2)
-    if (texFloatSupported) glTexImage2D(GL_TEXTURE_2D, 0, GL_RGB, size, size, 0, GL_RGB, GL_FLOAT, NULL);
-#endif
+        // Bind mesh VBO data: vertex normals (shader-location = 2, if available)
+        if (material.shader.locs[LOC_VERTEX_NORMAL] != -1) SetMeshVertexAttrib(material.shader.locs[LOC_VERTEX_NORMAL], mesh.vboId[2], 2, mesh.vertexFormat);
 
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+        // Bind mesh VBO data: vertex colors (shader-location = 3, if available)
+        if (material.shader.locs[LOC_VERTEX_COLOR] != -1)
+        {
+            if (mesh.vboId[3] != 0) SetVertexAttrib(material.shader.locs[LOC_VERTEX_COLOR], mesh.vboId[3], 4, GL_UNSIGNED_BYTE, true, 0, 0);
+            else
+            {
+                // Set default value for unused attribute
+                // NOTE: Required when using default shader and no VAO support
+                glVertexAttrib4f(material.shader.locs[LOC_VERTEX_COLOR], 1.0f, 1.0f, 1.0f, 1.0f);
+                DisableVertexAttrib(material.shader.locs[LOC_VERTEX_COLOR]);
+            }
+        }
 
-    // Render BRDF LUT into a quad using FBO
-    unsigned int fbo, rbo;
-    glGenFramebuffers(1, &fbo);
-    glGenRenderbuffers(1, &rbo);
-    glBindFramebuffer(GL_FRAMEBUFFER, fbo);
-    glBindRenderbuffer(GL_RENDERBUFFER, rbo);
-#if defined(GRAPHICS_API_OPENGL_33)
-    glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH_COMPONENT24, size, size);
-#elif defined(GRAPHICS_API_OPENGL_ES2)
-    glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH_COMPONENT16, size, size);
+        // Bind mesh VBO data: vertex tangents (shader-location = 4, if available)
+        if (material.shader.locs[LOC_VERTEX_TANGENT] != -1) SetMeshVertexAttrib(material.shader.locs[LOC_VERTEX_TANGENT], mesh.vboId[4], 4, mesh.vertexFormat);
+
+        // Bind mesh VBO data: vertex texcoords2 (shader-location = 5, if available)
+        if (material.shader.locs[LOC_VERTEX_TEXCOORD02] != -1) SetMeshVertexAttrib(material.shader.locs[LOC_VERTEX_TEXCOORD02], mesh.vboId[5], 5, mesh.vertexFormat);
+
+#if defined(SUPPORT_GPU_SKINNING)
+        // Bind mesh VBO data: vertex bone ids and weights (shader-location = 6, 7, if available)
+        if ((material.shader.locs[LOC_VERTEX_BONEIDS] != -1) && (material.shader.locs[LOC_VERTEX_BONEWEIGHTS] != -1))
+        {
+            if (mesh.vboId[7] != 0)
+            {
+                SetVertexAttrib(material.shader.locs[LOC_VERTEX_BONEIDS], mesh.vboId[7], 4, GL_UNSIGNED_BYTE, false, 0, 0);
+                SetVertexAttrib(material.shader.locs[LOC_VERTEX_BONEWEIGHTS], mesh.vboId[8], 4, GL_FLOAT, false, 0, 0);
+            }
+            else
+            {
+                DisableVertexAttrib(material.shader.locs[LOC_VERTEX_BONEIDS]);
+                DisableVertexAttrib(material.shader.locs[LOC_VERTEX_BONEWEIGHTS]);
+            }
+        }
 #endif
-    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, brdf.id, 0);
 
-    glViewport(0, 0, size, size);
-    glUseProgram(shader.id);
-    glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
-    GenDrawQuad();
+        if (mesh.vboId[6] != 0) glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, mesh.vboId[6]);
 
-    // Unbind framebuffer and textures
-    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+        meshState.vertexId = mesh.vboId[0];
+    }
 
-    // Unload framebuffer but keep color texture
-    glDeleteRenderbuffers(1, &rbo);
-    glDeleteFramebuffers(1, &fbo);
+#if defined(SUPPORT_GPU_SKINNING)
+    // Upload mesh bones matrices (if available)
+    // NOTE: Bones matrices change per mesh and frame, they are always uploaded
+    if ((material.shader.locs[LOC_MATRIX_BONES] != -1) && (mesh.boneCount > 0) && (mesh.boneMatrices != NULL))
+    {
+        float boneMatrices[MAX_SHADER_BONES*16];
+        int boneCount = (mesh.boneCount < MAX_SHADER_BONES)? mesh.boneCount : MAX_SHADER_BONES;
 
-    // Reset viewport dimensions to default
-    glViewport(0, 0, framebufferWidth, framebufferHeight);
+        for (int i = 0; i < boneCount; i++) memcpy(boneMatrices + i*16, MatrixToFloat(mesh.boneMatrices[i]), 16*sizeof(float));
 
-    brdf.width = size;
-    brdf.height = size;
-    brdf.mipmaps = 1;
-    brdf.format = UNCOMPRESSED_R32G32B32;
+        glUniformMatrix4fv(material.shader.locs[LOC_MATRIX_BONES], boneCount, false, boneMatrices);
+    }
 #endif
-    return brdf;
 }
 
-// Begin blending mode (alpha, additive, multiplied)
-// NOTE: Only 3 blending modes supported, default blend mode is alpha
-void BeginBlendMode(int mode)
+// Load bound mesh buffer data, every copy of the buffer gets the same data
+static void LoadMeshBuffer(unsigned int id, GLenum target, int size, const void *data, int copies, int drawHint)
 {
-    if ((blendMode != mode) && (mode < 3))
-    {
-        rlglDraw();
-
-        switch (mode)
-        {
-            case BLEND_ALPHA: glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA); break;
-            case BLEND_ADDITIVE: glBlendFunc(GL_SRC_ALPHA, GL_ONE); break; // Alternative: glBlendFunc(GL_ONE, GL_ONE);
-            case BLEND_MULTIPLIED: glBlendFunc(GL_DST_COLOR, GL_ONE_MINUS_SRC_ALPHA); break;
-            default: break;
-        }
+    glBufferData(target, size*copies, (copies == 1)? data : NULL, drawHint);
+    TrackVideoMemory(VIDEO_MEMORY_BUFFER, id, size*copies);
 
-        blendMode = mode;
+    if (copies > 1)
+    {
+        for (int i = 0; i < copies; i++) glBufferSubData(target, i*size, size, data);
     }
 }
 
-// End blending mode (reset to default: alpha blending)
-void EndBlendMode(void)
+// Update mesh buffer range (vertices or triangles for indices) from mesh CPU data at index
+// NOTE: Dynamic meshes write the range to current copy if it was not drawn since last update, otherwise
+// to next copy (ranges updated on other copies meanwhile are uploaded too). Mesh VAO must be bound
+static void UpdateMeshBuffer(Mesh mesh, int buffer, int index, int count)
 {
-    BeginBlendMode(BLEND_ALPHA);
-}
+    if ((buffer < 0) || (buffer > 6) || (mesh.vboId[buffer] == 0) || (count <= 0) || (index < 0)) return;
 
-#if defined(SUPPORT_VR_SIMULATOR)
-// Init VR simulator for selected device parameters
-// NOTE: It modifies the global variable: stereoFbo
-void InitVrSimulator(void)
-{
-#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    // Initialize framebuffer and textures for stereo rendering
-    // NOTE: Screen size should match HMD aspect ratio
-    stereoFbo = rlLoadRenderTexture(framebufferWidth, framebufferHeight, UNCOMPRESSED_R8G8B8A8, 24, false);
+#if defined(GRAPHICS_API_OPENGL_33)
+    MeshStream *stream = (MeshStream *)mesh.stream;
 
-    vrSimulatorReady = true;
-#else
-    TraceLog(LOG_WARNING, "VR Simulator not supported on OpenGL 1.1");
-#endif
-}
+    if (stream != NULL)
+    {
+        int capacity = (buffer == 6)? stream->triangleCapacity : stream->vertexCapacity;
 
-// Update VR tracking (position and orientation) and camera
-// NOTE: Camera (position, target, up) gets update with head tracking information
-void UpdateVrTracking(Camera *camera)
-{
-    // TODO: Simulate 1st person camera system
-}
+        if ((index + count) > capacity)
+        {
+            TraceLog(LOG_WARNING, "[VAO ID %i] Dynamic mesh buffer update out of buffer capacity (%i)", mesh.vaoId, capacity);
+            return;
+        }
 
-// Close VR simulator for current device
-void CloseVrSimulator(void)
-{
-#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    if (vrSimulatorReady) rlDeleteRenderTextures(stereoFbo);        // Unload stereo framebuffer and texture
-#endif
-}
+        // Current copy could be read by GPU, next copy is used (GPU is done with it if its frame completed)
+        if (stream->drawn)
+        {
+            stream->current = (stream->current + 1)%MAX_MESH_BUFFERING;
+            stream->drawn = false;
+        }
 
-// Set stereo rendering configuration parameters
-void SetVrConfiguration(VrDeviceInfo hmd, Shader distortion)
-{
-#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    // Reset vrConfig for a new values assignment
-    memset(&vrConfig, 0, sizeof(vrConfig));
+        int copy = stream->current;
 
-    // Assign distortion shader
-    vrConfig.distortionShader = distortion;
+        // NOTE: If copy was drawn on current frame (updated and drawn several times by frame), driver synchronizes upload
+        bool unsynchronized = WaitMeshFrame(stream->drawFrame[copy]);
 
-    // Compute aspect ratio
-    float aspect = ((float)hmd.hResolution*0.5f)/(float)hmd.vResolution;
+        // Ranges updated meanwhile on other copies are uploaded first
+        for (int b = 0; b < 7; b++)
+        {
+            if ((b != buffer) && (stream->pendingEnd[copy][b] > stream->pendingStart[copy][b]))
+            {
+                UploadMeshStreamRange(mesh, b, copy, stream->pendingStart[copy][b], stream->pendingEnd[copy][b], unsynchronized);
+                stream->pendingStart[copy][b] = stream->pendingEnd[copy][b] = 0;
+            }
+        }
 
-    // Compute lens parameters
-    float lensShift = (hmd.hScreenSize*0.25f - hmd.lensSeparationDistance*0.5f)/hmd.hScreenSize;
-    float leftLensCenter[2] = { 0.25f + lensShift, 0.5f };
-    float rightLensCenter[2] = { 0.75f - lensShift, 0.5f };
-    float leftScreenCenter[2] = { 0.25f, 0.5f };
-    float rightScreenCenter[2] = { 0.75f, 0.5f };
+        int start = index;
+        int end = index + count;
 
-    // Compute distortion scale parameters
-    // NOTE: To get lens max radius, lensShift must be normalized to [-1..1]
-    float lensRadius = (float)fabs(-1.0f - 4.0f*lensShift);
-    float lensRadiusSq = lensRadius*lensRadius;
-    float distortionScale = hmd.lensDistortionValues[0] +
-                            hmd.lensDistortionValues[1]*lensRadiusSq +
-                            hmd.lensDistortionValues[2]*lensRadiusSq*lensRadiusSq +
-                            hmd.lensDistortionValues[3]*lensRadiusSq*lensRadiusSq*lensRadiusSq;
+        if (stream->pendingEnd[copy][buffer] > stream->pendingStart[copy][buffer])
+        {
+            if (stream->pendingStart[copy][buffer] < start) start = stream->pendingStart[copy][buffer];
+            if (stream->pendingEnd[copy][buffer] > end) end = stream->pendingEnd[copy][buffer];
+            stream->pendingStart[copy][buffer] = stream->pendingEnd[copy][buffer] = 0;
+        }
 
-    TraceLog(LOG_DEBUG, "VR: Distortion Scale: %f", distortionScale);
+        UploadMeshStreamRange(mesh, buffer, copy, start, end, unsynchronized);
 
-    float normScreenWidth = 0.5f;
-    float normScreenHeight = 1.0f;
-    float scaleIn[2] = { 2.0f/normScreenWidth, 2.0f/normScreenHeight/aspect };
-    float scale[2] = { normScreenWidth*0.5f/distortionScale, normScreenHeight*0.5f*aspect/distortionScale };
+        // Range is pending on other copies
+        for (int i = 0; i < MAX_MESH_BUFFERING; i++)
+        {
+            if (i == copy) continue;
 
-    TraceLog(LOG_DEBUG, "VR: Distortion Shader: LeftLensCenter = { %f, %f }", leftLensCenter[0], leftLensCenter[1]);
-    TraceLog(LOG_DEBUG, "VR: Distortion Shader: RightLensCenter = { %f, %f }", rightLensCenter[0], rightLensCenter[1]);
-    TraceLog(LOG_DEBUG, "VR: Distortion Shader: Scale = { %f, %f }", scale[0], scale[1]);
-    TraceLog(LOG_DEBUG, "VR: Distortion Shader: ScaleIn = { %f, %f }", scaleIn[0], scaleIn[1]);
+            if (stream->pendingEnd[i][buffer] > stream->pendingStart[i][buffer])
+            {
+                if (index < stream->pendingStart[i][buffer]) stream->pendingStart[i][buffer] = index;
+                if ((index + count) > stream->pendingEnd[i][buffer]) stream->pendingEnd[i][buffer] = index + count;
+            }
+            else
+            {
+                stream->pendingStart[i][buffer] = index;
+                stream->pendingEnd[i][buffer] = index + count;
+            }
+        }
 
-    // Fovy is normally computed with: 2*atan2(hmd.vScreenSize, 2*hmd.eyeToScreenDistance)
-    // ...but with lens distortion it is increased (see Oculus SDK Documentation)
-    //float fovy = 2.0f*atan2(hmd.vScreenSize*0.5f*distortionScale, hmd.eyeToScreenDistance);     // Really need distortionScale?
-    float fovy = 2.0f*(float)atan2(hmd.vScreenSize*0.5f, hmd.eyeToScreenDistance);
+        return;
+    }
+#endif
 
-    // Compute camera projection matrices
-    float projOffset = 4.0f*lensShift;      // Scaled to projection space coordinates [-1..1]
-    Matrix proj = MatrixPerspective(fovy, aspect, DEFAULT_NEAR_CULL_DISTANCE, DEFAULT_FAR_CULL_DISTANCE);
-    vrConfig.eyesProjection[0] = MatrixMultiply(proj, MatrixTranslate(projOffset, 0.0f, 0.0f));
-    vrConfig.eyesProjection[1] = MatrixMultiply(proj, MatrixTranslate(-projOffset, 0.0f, 0.0f));
+    int size = 0;
+    const unsigned char *data = GetMeshBufferData(mesh, buffer, &size);
 
-    // Compute camera transformation matrices
-    // NOTE: Camera movement might seem more natural if we model the head.
-    // Our axis of rotation is the base of our head, so we might want to add
-    // some y (base of head to eye level) and -z (center of head to eye protrusion) to the camera positions.
-    vrConfig.eyesViewOffset[0] = MatrixTranslate(-hmd.interpupillaryDistance*0.5f, 0.075f, 0.045f);
-    vrConfig.eyesViewOffset[1] = MatrixTranslate(hmd.interpupillaryDistance*0.5f, 0.075f, 0.045f);
+    if ((data == NULL) || ((index + count) > ((buffer == 6)? mesh.triangleCount : mesh.vertexCount))) return;
 
-    // Compute eyes Viewports
-    vrConfig.eyeViewportRight[2] = hmd.hResolution/2;
-    vrConfig.eyeViewportRight[3] = hmd.vResolution;
+    GLenum target = (buffer == 6)? GL_ELEMENT_ARRAY_BUFFER : GL_ARRAY_BUFFER;
 
-    vrConfig.eyeViewportLeft[0] = hmd.hResolution/2;
-    vrConfig.eyeViewportLeft[1] = 0;
-    vrConfig.eyeViewportLeft[2] = hmd.hResolution/2;
-    vrConfig.eyeViewportLeft[3] = hmd.vResolution;
+    glBindBuffer(target, mesh.vboId[buffer]);
 
-    if (vrConfig.distortionShader.id > 0)
+    // Compact storage formats attributes are packed from CPU data
+    void *packed = PackMeshVertexData(mesh, buffer, index, count);
+
+    if (packed != NULL)
     {
-        // Update distortion shader with lens and distortion-scale parameters
-        SetShaderValue(vrConfig.distortionShader, GetShaderLocation(vrConfig.distortionShader, "leftLensCenter"), leftLensCenter, UNIFORM_VEC2);
-        SetShaderValue(vrConfig.distortionShader, GetShaderLocation(vrConfig.distortionShader, "rightLensCenter"), rightLensCenter, UNIFORM_VEC2);
-        SetShaderValue(vrConfig.distortionShader, GetShaderLocation(vrConfig.distortionShader, "leftScreenCenter"), leftScreenCenter, UNIFORM_VEC2);
-        SetShaderValue(vrConfig.distortionShader, GetShaderLocation(vrConfig.distortionShader, "rightScreenCenter"), rightScreenCenter, UNIFORM_VEC2);
+        int components = 0, type = 0;
+        bool normalized = false;
+        size = GetMeshAttribFormat(mesh.vertexFormat, buffer, &components, &type, &normalized);
 
-        SetShaderValue(vrConfig.distortionShader, GetShaderLocation(vrConfig.distortionShader, "scale"), scale, UNIFORM_VEC2);
-        SetShaderValue(vrConfig.distortionShader, GetShaderLocation(vrConfig.distortionShader, "scaleIn"), scaleIn, UNIFORM_VEC2);
-        SetShaderValue(vrConfig.distortionShader, GetShaderLocation(vrConfig.distortionShader, "hmdWarpParam"), hmd.lensDistortionValues, UNIFORM_VEC4);
-        SetShaderValue(vrConfig.distortionShader, GetShaderLocation(vrConfig.distortionShader, "chromaAbParam"), hmd.chromaAbCorrection, UNIFORM_VEC4);
+        glBufferSubData(target, index*size, count*size, packed);
+        RL_FREE(packed);
     }
-#endif
+    else glBufferSubData(target, index*size, count*size, data + index*size);
+
+    renderStats.uploadedBytes += count*size;
 }
 
-// Detect if VR simulator is running
-bool IsVrSimulatorReady(void)
+// Get mesh CPU data for buffer (vertex attribute or indices) and its element size (vertex or triangle)
+static const unsigned char *GetMeshBufferData(Mesh mesh, int buffer, int *size)
 {
-#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    return vrSimulatorReady;
+    const unsigned char *data = NULL;
+    *size = 0;
+
+    switch (buffer)
+    {
+        case 0: data = (const unsigned char *)mesh.vertices; *size = 3*sizeof(float); break;
+        case 1: data = (const unsigned char *)mesh.texcoords; *size = 2*sizeof(float); break;
+        case 2: data = (const unsigned char *)mesh.normals; *size = 3*sizeof(float); break;
+        case 3: data = mesh.colors; *size = 4*sizeof(unsigned char); break;
+        case 4: data = (const unsigned char *)mesh.tangents; *size = 4*sizeof(float); break;
+        case 5: data = (const unsigned char *)mesh.texcoords2; *size = 2*sizeof(float); break;
+        case 6: data = (const unsigned char *)mesh.indices; *size = 3*sizeof(unsigned short); break;
+        default: break;
+    }
+
+    return data;
+}
+
+// Get mesh vertex attribute GPU format for buffer (components, type and normalization), returns vertex size
+static int GetMeshAttribFormat(int vertexFormat, int buffer, int *components, int *type, bool *normalized)
+{
+    int size = 0;
+    *normalized = false;
+
+#if defined(GRAPHICS_API_OPENGL_ES2)
+    int halfType = contextES3? GL_HALF_FLOAT : GL_HALF_FLOAT_OES;   // NOTE: ES2 requires extension OES_vertex_half_float
 #else
-    return false;
+    int halfType = GL_HALF_FLOAT;
 #endif
+
+    switch (buffer)
+    {
+        case 0:
+        {
+            // NOTE: Half float positions are stored as XYZ1 to keep vertices 4 bytes aligned
+            if (vertexFormat & MESH_FORMAT_POSITION_HALF) { *components = 4; *type = halfType; size = 4*sizeof(unsigned short); }
+            else { *components = 3; *type = GL_FLOAT; size = 3*sizeof(float); }
+        } break;
+        case 1:
+        case 5:
+        {
+            if (vertexFormat & MESH_FORMAT_TEXCOORD_SNORM16) { *components = 2; *type = GL_SHORT; *normalized = true; size = 2*sizeof(short); }
+            else { *components = 2; *type = GL_FLOAT; size = 2*sizeof(float); }
+        } break;
+        case 2:
+        case 4:
+        {
+            if (vertexFormat & MESH_FORMAT_NORMAL_PACKED) { *components = 4; *type = GL_INT_2_10_10_10_REV; *normalized = true; size = sizeof(unsigned int); }
+            else { *components = (buffer == 2)? 3 : 4; *type = GL_FLOAT; size = (*components)*sizeof(float); }
+        } break;
+        case 3: *components = 4; *type = GL_UNSIGNED_BYTE; *normalized = true; size = 4*sizeof(unsigned char); break;
+        default: break;
+    }
+
+    return size;
 }
 
-// Enable/Disable VR experience (device or simulator)
-void ToggleVrMode(void)
+// Set mesh vertex buffer attribute pointer and enable it, considering attribute storage format
+static void SetMeshVertexAttrib(unsigned int location, unsigned int id, int buffer, int vertexFormat)
 {
-#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    vrSimulatorReady = !vrSimulatorReady;
+    int components = 0, type = 0;
+    bool normalized = false;
+    GetMeshAttribFormat(vertexFormat, buffer, &components, &type, &normalized);
 
-    if (!vrSimulatorReady)
+    SetVertexAttrib(location, id, components, type, normalized, 0, 0);
+}
+
+// Set vertex attribute pointer (from buffer) and enable attribute array
+// NOTE: Without VAO support, attributes state is tracked and only attributes that differ are set,
+// with VAO support (or on loader context) state belongs to bound vertex array and it is always set
+static void SetVertexAttrib(unsigned int index, unsigned int buffer, int size, int type, bool normalized, int stride, const void *pointer)
+{
+    VertexAttribState *attrib = NULL;
+    if (!vaoSupported && !loaderThread && (index < MAX_VERTEX_ATTRIBS_CACHED)) attrib = &vertexAttribs[index];
+
+    if ((attrib == NULL) || !attrib->valid || (attrib->buffer != buffer) || (attrib->size != size) || (attrib->type != type) ||
+        (attrib->normalized != normalized) || (attrib->stride != stride) || (attrib->pointer != pointer))
     {
-        vrStereoRender = false;
+        glBindBuffer(GL_ARRAY_BUFFER, buffer);
+        glVertexAttribPointer(index, size, type, normalized, stride, pointer);
+        if (!vaoSupported) renderStats.attribUpdates++;
+    }
 
-        // Reset viewport and default projection-modelview matrices
-        rlViewport(0, 0, framebufferWidth, framebufferHeight);
-        projection = MatrixOrtho(0.0, framebufferWidth, framebufferHeight, 0.0, 0.0, 1.0);
-        modelview = MatrixIdentity();
+    if ((attrib == NULL) || !attrib->valid || !attrib->enabled) glEnableVertexAttribArray(index);
+
+    if (attrib != NULL)
+    {
+        attrib->valid = true;
+        attrib->enabled = true;
+        attrib->buffer = buffer;
+        attrib->size = size;
+        attrib->type = type;
+        attrib->normalized = normalized;
+        attrib->stride = stride;
+        attrib->pointer = pointer;
     }
-    else vrStereoRender = true;
-#endif
 }
 
-// Begin VR drawing configuration
-void BeginVrDrawing(void)
+// Disable vertex attribute array, skipped if already disabled (only without VAO support)
+static void DisableVertexAttrib(unsigned int index)
 {
-#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    if (vrSimulatorReady)
-    {
-
-        rlEnableRenderTexture(stereoFbo.id);    // Setup framebuffer for stereo rendering
-        //glEnable(GL_FRAMEBUFFER_SRGB);        // Enable SRGB framebuffer (only if required)
+    VertexAttribState *attrib = NULL;
+    if (!vaoSupported && !loaderThread && (index < MAX_VERTEX_ATTRIBS_CACHED)) attrib = &vertexAttribs[index];
 
-        //glViewport(0, 0, buffer.width, buffer.height);    // Useful if rendering to separate framebuffers (every eye)
-        rlClearScreenBuffers();                 // Clear current framebuffer
+    if ((attrib == NULL) || !attrib->valid || attrib->enabled) glDisableVertexAttribArray(index);
 
-        vrStereoRender = true;
+    // NOTE: Attribute pointer is kept, it's still valid if attribute is enabled again
+    if (attrib != NULL)
+    {
+        if (!attrib->valid) attrib->buffer = 0;
+        attrib->valid = true;
+        attrib->enabled = false;
     }
-#endif
 }
 
-// End VR drawing process (and desktop mirror)
-void EndVrDrawing(void)
+// Forget cached vertex attributes pointing to buffer, required on buffer deletion (id could be reused)
+// NOTE: Passing buffer 0 forgets all attributes
+static void ResetVertexAttribs(unsigned int buffer)
 {
-#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    if (vrSimulatorReady)
+    for (int i = 0; i < MAX_VERTEX_ATTRIBS_CACHED; i++)
     {
-        vrStereoRender = false;         // Disable stereo render
+        if ((buffer == 0) || (vertexAttribs[i].buffer == buffer)) vertexAttribs[i].valid = false;
+    }
+}
 
-        rlDisableRenderTexture();       // Unbind current framebuffer
+// Load bound mesh vertex buffer data, attributes with compact storage format are packed first
+static void LoadMeshVertexBuffer(Mesh mesh, int buffer, int copies, int drawHint)
+{
+    int size = 0;
+    const void *data = GetMeshBufferData(mesh, buffer, &size);
+    void *packed = PackMeshVertexData(mesh, buffer, 0, mesh.vertexCount);
 
-        rlClearScreenBuffers();         // Clear current framebuffer
+    if (packed != NULL)
+    {
+        int components = 0, type = 0;
+        bool normalized = false;
+        size = GetMeshAttribFormat(mesh.vertexFormat, buffer, &components, &type, &normalized);
+        data = packed;
+    }
 
-        // Set viewport to default framebuffer size (screen size)
-        rlViewport(0, 0, framebufferWidth, framebufferHeight);
+    LoadMeshBuffer(mesh.vboId[buffer], GL_ARRAY_BUFFER, size*mesh.vertexCount, data, copies, drawHint);
 
-        // Let rlgl reconfigure internal matrices
-        rlMatrixMode(RL_PROJECTION);                            // Enable internal projection matrix
-        rlLoadIdentity();                                       // Reset internal projection matrix
-        rlOrtho(0.0, framebufferWidth, framebufferHeight, 0.0, 0.0, 1.0); // Recalculate internal projection matrix
-        rlMatrixMode(RL_MODELVIEW);                             // Enable internal modelview matrix
-        rlLoadIdentity();                                       // Reset internal modelview matrix
+    RL_FREE(packed);
+}
 
-        // Draw RenderTexture (stereoFbo) using distortion shader if available
-        if (vrConfig.distortionShader.id > 0) currentShader = vrConfig.distortionShader;
-        else currentShader = GetShaderDefault();
+// Set mesh buffers vertex attributes on bound vertex array (or current state if vertex arrays not supported)
+// NOTE: Default locations are used, attributes without buffer get default values
+static void SetMeshVertexArray(Mesh mesh)
+{
+    // Vertex positions (shader-location = 0)
+    SetMeshVertexAttrib(0, mesh.vboId[0], 0, mesh.vertexFormat);
 
-        rlEnableTexture(stereoFbo.texture.id);
+    // Vertex texcoords (shader-location = 1)
+    SetMeshVertexAttrib(1, mesh.vboId[1], 1, mesh.vertexFormat);
 
-        rlPushMatrix();
-            rlBegin(RL_QUADS);
-                rlColor4ub(255, 255, 255, 255);
-                rlNormal3f(0.0f, 0.0f, 1.0f);
+    // Vertex normals (shader-location = 2)
+    if (mesh.vboId[2] > 0) SetMeshVertexAttrib(2, mesh.vboId[2], 2, mesh.vertexFormat);
+    else
+    {
+        // Default color vertex attribute set to WHITE
+        glVertexAttrib3f(2, 1.0f, 1.0f, 1.0f);
+        DisableVertexAttrib(2);
+    }
 
-                // Bottom-left corner for texture and quad
-                rlTexCoord2f(0.0f, 1.0f);
-                rlVertex2f(0.0f, 0.0f);
+    // Vertex colors (shader-location = 3)
+    if (mesh.vboId[3] > 0) SetVertexAttrib(3, mesh.vboId[3], 4, GL_UNSIGNED_BYTE, true, 0, 0);
+    else
+    {
+        // Default color vertex attribute set to WHITE
+        glVertexAttrib4f(3, 1.0f, 1.0f, 1.0f, 1.0f);
+        DisableVertexAttrib(3);
+    }
 
-                // Bottom-right corner for texture and quad
-                rlTexCoord2f(0.0f, 0.0f);
-                rlVertex2f(0.0f, (float)stereoFbo.texture.height);
+    // Vertex tangents (shader-location = 4)
+    if (mesh.vboId[4] > 0) SetMeshVertexAttrib(4, mesh.vboId[4], 4, mesh.vertexFormat);
+    else
+    {
+        // Default tangents vertex attribute
+        glVertexAttrib4f(4, 0.0f, 0.0f, 0.0f, 0.0f);
+        DisableVertexAttrib(4);
+    }
 
-                // Top-right corner for texture and quad
-                rlTexCoord2f(1.0f, 0.0f);
-                rlVertex2f( (float)stereoFbo.texture.width, (float)stereoFbo.texture.height);
+    // Vertex texcoords2 (shader-location = 5)
+    if (mesh.vboId[5] > 0) SetMeshVertexAttrib(5, mesh.vboId[5], 5, mesh.vertexFormat);
+    else
+    {
+        // Default texcoord2 vertex attribute
+        glVertexAttrib2f(5, 0.0f, 0.0f);
+        DisableVertexAttrib(5);
+    }
 
-                // Top-left corner for texture and quad
-                rlTexCoord2f(1.0f, 1.0f);
-                rlVertex2f( (float)stereoFbo.texture.width, 0.0f);
-            rlEnd();
-        rlPopMatrix();
+#if defined(SUPPORT_GPU_SKINNING)
+    // Vertex bone ids and weights (shader-location = 6, 7)
+    if ((mesh.vboId[7] > 0) && (mesh.vboId[8] > 0))
+    {
+        SetVertexAttrib(6, mesh.vboId[7], 4, GL_UNSIGNED_BYTE, false, 0, 0);
+        SetVertexAttrib(7, mesh.vboId[8], 4, GL_FLOAT, false, 0, 0);
+    }
+    else
+    {
+        DisableVertexAttrib(6);
+        DisableVertexAttrib(7);
+    }
+#endif
 
-        rlDisableTexture();
+    if (mesh.vboId[6] > 0) glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, mesh.vboId[6]);
+}
 
-        // Update and draw render texture fbo with distortion to backbuffer
-        UpdateBuffersDefault();
-        DrawBuffersDefault();
+// Pack mesh vertex attribute range (from CPU data) to its compact storage format
+// NOTE: Returns NULL if attribute is stored as floats, packed data must be freed by caller
+static void *PackMeshVertexData(Mesh mesh, int buffer, int index, int count)
+{
+    void *packed = NULL;
 
-        // Restore defaultShader
-        currentShader = defaultShader;
+    if ((buffer == 0) && (mesh.vertexFormat & MESH_FORMAT_POSITION_HALF) && (mesh.vertices != NULL))
+    {
+        unsigned short *halfs = (unsigned short *)RL_MALLOC(count*4*sizeof(unsigned short));
 
-        // Reset viewport and default projection-modelview matrices
-        rlViewport(0, 0, framebufferWidth, framebufferHeight);
-        projection = MatrixOrtho(0.0, framebufferWidth, framebufferHeight, 0.0, 0.0, 1.0);
-        modelview = MatrixIdentity();
+        for (int i = 0; i < count; i++)
+        {
+            for (int c = 0; c < 3; c++) halfs[i*4 + c] = FloatToHalf(mesh.vertices[(index + i)*3 + c]);
+            halfs[i*4 + 3] = 0x3c00;    // 1.0f
+        }
 
-        rlDisableDepthTest();
+        packed = halfs;
     }
-#endif
-}
-#endif          // SUPPORT_VR_SIMULATOR
+    else if (((buffer == 1) || (buffer == 5)) && (mesh.vertexFormat & MESH_FORMAT_TEXCOORD_SNORM16))
+    {
+        const float *texcoords = (buffer == 1)? mesh.texcoords : mesh.texcoords2;
 
-//----------------------------------------------------------------------------------
-// Module specific Functions Definition
-//----------------------------------------------------------------------------------
+        if (texcoords != NULL)
+        {
+            short *shorts = (short *)RL_MALLOC(count*2*sizeof(short));
 
-#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-// Compile custom shader and return shader id
-static unsigned int CompileShader(const char *shaderStr, int type)
-{
-    unsigned int shader = glCreateShader(type);
-    glShaderSource(shader, 1, &shaderStr, NULL);
+            for (int i = 0; i < count*2; i++)
+            {
+                float value = texcoords[index*2 + i];
+                value = (value < -1.0f)? -1.0f : ((value > 1.0f)? 1.0f : value);
+                shorts[i] = (short)((value >= 0.0f)? (value*32767.0f + 0.5f) : (value*32767.0f - 0.5f));
+            }
 
-    GLint success = 0;
-    glCompileShader(shader);
-    glGetShaderiv(shader, GL_COMPILE_STATUS, &success);
+            packed = shorts;
+        }
+    }
+    else if (((buffer == 2) || (buffer == 4)) && (mesh.vertexFormat & MESH_FORMAT_NORMAL_PACKED))
+    {
+        const float *vectors = (buffer == 2)? mesh.normals : mesh.tangents;
+        int stride = (buffer == 2)? 3 : 4;
+
+        if (vectors != NULL)
+        {
+            unsigned int *values = (unsigned int *)RL_MALLOC(count*sizeof(unsigned int));
+
+            // NOTE: XYZ are stored as 10 bit signed normalized, W (tangents handedness) as 2 bit signed
+            for (int i = 0; i < count; i++)
+            {
+                const float *vector = vectors + (index + i)*stride;
+                unsigned int value = 0;
 
-    if (success != GL_TRUE)
-    {
-        TraceLog(LOG_WARNING, "[SHDR ID %i] Failed to compile shader...", shader);
-        int maxLength = 0;
-        int length;
-        glGetShaderiv(shader, GL_INFO_LOG_LENGTH, &maxLength);
+                for (int c = 0; c < 3; c++)
+                {
+                    float v = (vector[c] < -1.0f)? -1.0f : ((vector[c] > 1.0f)? 1.0f : vector[c]);
+                    int snorm = (int)((v >= 0.0f)? (v*511.0f + 0.5f) : (v*511.0f - 0.5f));
+                    value |= ((unsigned int)snorm & 0x3ff) << (c*10);
+                }
 
-#if defined(_MSC_VER)
-        char *log = RL_MALLOC(maxLength);
-#else
-        char log[maxLength];
-#endif
-        glGetShaderInfoLog(shader, maxLength, &length, log);
+                if (stride == 4) value |= ((unsigned int)((vector[3] < 0.0f)? -1 : 1) & 0x3) << 30;
 
-        TraceLog(LOG_INFO, "%s", log);
+                values[i] = value;
+            }
 
-#if defined(_MSC_VER)
-        RL_FREE(log);
-#endif
+            packed = values;
+        }
     }
-    else TraceLog(LOG_INFO, "[SHDR ID %i] Shader compiled successfully", shader);
 
-    return shader;
+    return packed;
 }
 
-// Load custom shader strings and return program id
-static unsigned int LoadShaderProgram(unsigned int vShaderId, unsigned int fShaderId)
+// Convert float to half float (rounded to nearest, out of range values clamped to maximum half)
+static unsigned short FloatToHalf(float value)
 {
-    unsigned int program = 0;
-
-#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    unsigned int bits = 0;
+    memcpy(&bits, &value, sizeof(float));
 
-    GLint success = 0;
-    program = glCreateProgram();
+    unsigned int sign = (bits >> 16) & 0x8000;
+    int exponent = (int)((bits >> 23) & 0xff) - 127 + 15;
+    unsigned int mantissa = bits & 0x7fffff;
+    unsigned int half = 0;
 
-    glAttachShader(program, vShaderId);
-    glAttachShader(program, fShaderId);
+    if (exponent <= 0)
+    {
+        // Denormalized half or zero
+        if (exponent < -10) return (unsigned short)sign;
 
-    // NOTE: Default attribute shader locations must be binded before linking
-    glBindAttribLocation(program, 0, DEFAULT_ATTRIB_POSITION_NAME);
-    glBindAttribLocation(program, 1, DEFAULT_ATTRIB_TEXCOORD_NAME);
-    glBindAttribLocation(program, 2, DEFAULT_ATTRIB_NORMAL_NAME);
-    glBindAttribLocation(program, 3, DEFAULT_ATTRIB_COLOR_NAME);
-    glBindAttribLocation(program, 4, DEFAULT_ATTRIB_TANGENT_NAME);
-    glBindAttribLocation(program, 5, DEFAULT_ATTRIB_TEXCOORD2_NAME);
+        mantissa |= 0x800000;
+        int shift = 14 - exponent;
+        half = mantissa >> shift;
+        if ((mantissa >> (shift - 1)) & 1) half++;
+    }
+    else if (exponent >= 31) half = 0x7bff;
+    else
+    {
+        half = ((unsigned int)exponent << 10) | (mantissa >> 13);
+        if (mantissa & 0x1000) half++;      // NOTE: Rounding carry could overflow to exponent
+        if (half > 0x7bff) half = 0x7bff;
+    }
 
-    // NOTE: If some attrib name is no found on the shader, it locations becomes -1
+    return (unsigned short)(sign | half);
+}
 
-    glLinkProgram(program);
+#if defined(GRAPHICS_API_OPENGL_ES2)
+// Convert half float to float
+static float HalfToFloat(unsigned short value)
+{
+    unsigned int sign = (unsigned int)(value & 0x8000) << 16;
+    int exponent = (value >> 10) & 0x1f;
+    unsigned int mantissa = value & 0x3ff;
+    unsigned int bits = 0;
 
-    // NOTE: All uniform variables are intitialised to 0 when a program links
+    if (exponent == 0)
+    {
+        if (mantissa == 0) bits = sign;
+        else
+        {
+            // Denormalized half, normalized on float
+            exponent = 1;
+            while ((mantissa & 0x400) == 0) { mantissa <<= 1; exponent--; }
+            mantissa &= 0x3ff;
+            bits = sign | ((unsigned int)(exponent - 15 + 127) << 23) | (mantissa << 13);
+        }
+    }
+    else if (exponent == 31) bits = sign | 0x7f800000 | (mantissa << 13);
+    else bits = sign | ((unsigned int)(exponent - 15 + 127) << 23) | (mantissa << 13);
 
-    glGetProgramiv(program, GL_LINK_STATUS, &success);
+    float result = 0.0f;
+    memcpy(&result, &bits, sizeof(float));
 
-    if (success == GL_FALSE)
-    {
-        TraceLog(LOG_WARNING, "[SHDR ID %i] Failed to link shader program...", program);
+    return result;
+}
+#endif
 
-        int maxLength = 0;
-        int length;
+// Draw mesh buffers (indexed or not), instanced if instances provided
+// NOTE: Dynamic meshes draw their current buffers copy, offset by base vertex (and first index)
+static void DrawMeshBuffers(Mesh mesh, int instances)
+{
+    int baseVertex = 0;
 
-        glGetProgramiv(program, GL_INFO_LOG_LENGTH, &maxLength);
+#if defined(GRAPHICS_API_OPENGL_33)
+    MeshStream *stream = (MeshStream *)mesh.stream;
 
-#if defined(_MSC_VER)
-        char *log = RL_MALLOC(maxLength);
-#else
-        char log[maxLength];
-#endif
-        glGetProgramInfoLog(program, maxLength, &length, log);
+    if (stream != NULL)
+    {
+        baseVertex = stream->current*stream->vertexCapacity;
+        stream->drawFrame[stream->current] = meshFrame;
+        stream->drawn = true;
+    }
 
-        TraceLog(LOG_INFO, "%s", log);
+    if ((mesh.vboId[6] != 0) && (baseVertex > 0))
+    {
+        int firstIndex = stream->current*stream->triangleCapacity*3;
 
-#if defined(_MSC_VER)
-        RL_FREE(log);
+        if (instances > 0) glDrawElementsInstancedBaseVertex(GL_TRIANGLES, mesh.triangleCount*3, GL_UNSIGNED_SHORT, (void *)(firstIndex*sizeof(unsigned short)), instances, baseVertex);
+        else glDrawElementsBaseVertex(GL_TRIANGLES, mesh.triangleCount*3, GL_UNSIGNED_SHORT, (void *)(firstIndex*sizeof(unsigned short)), baseVertex);
+        return;
+    }
 #endif
-        glDeleteProgram(program);
 
-        program = 0;
+    if (mesh.vboId[6] != 0)
+    {
+        if (instances > 0) glDrawElementsInstanced(GL_TRIANGLES, mesh.triangleCount*3, GL_UNSIGNED_SHORT, 0, instances);
+        else glDrawElements(GL_TRIANGLES, mesh.triangleCount*3, GL_UNSIGNED_SHORT, 0);     // Indexed vertices draw
+    }
+    else
+    {
+        if (instances > 0) glDrawArraysInstanced(GL_TRIANGLES, baseVertex, mesh.vertexCount, instances);
+        else glDrawArrays(GL_TRIANGLES, baseVertex, mesh.vertexCount);
     }
-    else TraceLog(LOG_INFO, "[SHDR ID %i] Shader program loaded successfully", program);
-#endif
-    return program;
 }
+#endif
 
-
-// Load default shader (just vertex positioning and texture coloring)
-// NOTE: This shader program is used for internal buffers
-static Shader LoadShaderDefault(void)
+// for all the registered draw calls, sorting key is: layer, texture, mode (stable sorting)
+static void SortDrawCalls(RenderBatch *batch)
 {
-    Shader shader = { 0 };
-    shader.locs = (int *)RL_CALLOC(MAX_SHADER_LOCATIONS, sizeof(int));
+    DynamicBuffer *buffer = &batch->vertexBuffer[batch->currentBuffer];
 
-    // NOTE: All locations must be reseted to -1 (no location)
-    for (int i = 0; i < MAX_SHADER_LOCATIONS; i++) shader.locs[i] = -1;
+    int offsets[MAX_DRAWCALL_REGISTERED] = { 0 };
+    int order[MAX_DRAWCALL_REGISTERED] = { 0 };
+    bool sorted = true;
 
-    // Vertex shader directly defined, no external file required
-    const char *defaultVShaderStr =
-#if defined(GRAPHICS_API_OPENGL_21)
-    "#version 120                       \n"
-#elif defined(GRAPHICS_API_OPENGL_ES2)
-    "#version 100                       \n"
-#endif
-#if defined(GRAPHICS_API_OPENGL_ES2) || defined(GRAPHICS_API_OPENGL_21)
-    "attribute vec3 vertexPosition;     \n"
-    "attribute vec2 vertexTexCoord;     \n"
-    "attribute vec4 vertexColor;        \n"
-    "varying vec2 fragTexCoord;         \n"
-    "varying vec4 fragColor;            \n"
-#elif defined(GRAPHICS_API_OPENGL_33)
-    "#version 330                       \n"
-    "in vec3 vertexPosition;            \n"
-    "in vec2 vertexTexCoord;            \n"
-    "in vec4 vertexColor;               \n"
-    "out vec2 fragTexCoord;             \n"
-    "out vec4 fragColor;                \n"
-#endif
-    "uniform mat4 mvp;                  \n"
-    "void main()                        \n"
-    "{                                  \n"
-    "    fragTexCoord = vertexTexCoord; \n"
-    "    fragColor = vertexColor;       \n"
-    "    gl_Position = mvp*vec4(vertexPosition, 1.0); \n"
-    "}                                  \n";
+    // Get vertex offsets of draw calls and sort them (insertion sort is stable and draws count is small)
+    for (int i = 0, offset = 0; i < batch->drawsCounter; i++)
+    {
+        offsets[i] = offset;
+        offset += (batch->draws[i].vertexCount + batch->draws[i].vertexAlignment);
 
-    // Fragment shader directly defined, no external file required
-    const char *defaultFShaderStr =
-#if defined(GRAPHICS_API_OPENGL_21)
-    "#version 120                       \n"
-#elif defined(GRAPHICS_API_OPENGL_ES2)
-    "#version 100                       \n"
-    "precision mediump float;           \n"     // precision required for OpenGL ES2 (WebGL)
-#endif
-#if defined(GRAPHICS_API_OPENGL_ES2) || defined(GRAPHICS_API_OPENGL_21)
-    "varying vec2 fragTexCoord;         \n"
-    "varying vec4 fragColor;            \n"
-#elif defined(GRAPHICS_API_OPENGL_33)
-    "#version 330       \n"
-    "in vec2 fragTexCoord;              \n"
-    "in vec4 fragColor;                 \n"
-    "out vec4 finalColor;               \n"
-#endif
-    "uniform sampler2D texture0;        \n"
-    "uniform vec4 colDiffuse;           \n"
-    "void main()                        \n"
-    "{                                  \n"
-#if defined(GRAPHICS_API_OPENGL_ES2) || defined(GRAPHICS_API_OPENGL_21)
-    "    vec4 texelColor = texture2D(texture0, fragTexCoord); \n" // NOTE: texture2D() is deprecated on OpenGL 3.3 and ES 3.0
-    "    gl_FragColor = texelColor*colDiffuse*fragColor;      \n"
-#elif defined(GRAPHICS_API_OPENGL_33)
-    "    vec4 texelColor = texture(texture0, fragTexCoord);   \n"
-    "    finalColor = texelColor*colDiffuse*fragColor;        \n"
-#endif
-    "}                                  \n";
+        int j = i;
+        while ((j > 0) && (CompareDrawCalls(&batch->draws[order[j - 1]], &batch->draws[i]) > 0))
+        {
+            order[j] = order[j - 1];
+            j--;
+        }
 
-    // NOTE: Compiled vertex/fragment shaders are kept for re-use
-    defaultVShaderId = CompileShader(defaultVShaderStr, GL_VERTEX_SHADER);     // Compile default vertex shader
-    defaultFShaderId = CompileShader(defaultFShaderStr, GL_FRAGMENT_SHADER);   // Compile default fragment shader
+        order[j] = i;
+        if (j != i) sorted = false;
+    }
 
-    shader.id = LoadShaderProgram(defaultVShaderId, defaultFShaderId);
+    // Check if some adjacent draw calls could be merged after sorting
+    bool merge = false;
+    for (int i = 1; i < batch->drawsCounter; i++)
+    {
+        if (IsDrawCallCompatible(&batch->draws[order[i - 1]], &batch->draws[order[i]])) { merge = true; break; }
+    }
 
-    if (shader.id > 0)
+    if (sorted && !merge) return;
+
+    // Init scratch buffers on first use or if batch requires a bigger capacity
+    if (sortDraws == NULL) sortDraws = (DrawCall *)RL_MALLOC(sizeof(DrawCall)*MAX_DRAWCALL_REGISTERED);
+
+    if (sortBufferElements < batch->elements)
     {
-        TraceLog(LOG_INFO, "[SHDR ID %i] Default shader loaded successfully", shader.id);
+#if defined(SUPPORT_BATCH_INTERLEAVED)
+        RL_FREE(sortBuffer.elements);
+        sortBuffer.elements = (BatchVertex *)RL_MALLOC(sizeof(BatchVertex)*4*batch->elements);
+#else
+        RL_FREE(sortBuffer.vertices);
+        RL_FREE(sortBuffer.texcoords);
+        RL_FREE(sortBuffer.colors);
+        sortBuffer.vertices = (float *)RL_MALLOC(sizeof(float)*3*4*batch->elements);
+        sortBuffer.texcoords = (float *)RL_MALLOC(sizeof(float)*2*4*batch->elements);
+        sortBuffer.colors = (unsigned char *)RL_MALLOC(sizeof(unsigned char)*4*4*batch->elements);
+#endif
+        sortBufferElements = batch->elements;
+    }
 
-        // Set default shader locations: attributes locations
-        shader.locs[LOC_VERTEX_POSITION] = glGetAttribLocation(shader.id, "vertexPosition");
-        shader.locs[LOC_VERTEX_TEXCOORD01] = glGetAttribLocation(shader.id, "vertexTexCoord");
-        shader.locs[LOC_VERTEX_COLOR] = glGetAttribLocation(shader.id, "vertexColor");
+    // Copy vertex data in sorted order, merging compatible draw calls
+    // NOTE: LINES and TRIANGLES vertex are drawn with glDrawArrays(), so merged vertex must be contiguous,
+    // only the last draw of a merged group requires alignment padding (QUADS are always aligned)
+    int sortCounter = 0;
+    int vCounter = 0;
 
-        // Set default shader locations: uniform locations
-        shader.locs[LOC_MATRIX_MVP]  = glGetUniformLocation(shader.id, "mvp");
-        shader.locs[LOC_COLOR_DIFFUSE] = glGetUniformLocation(shader.id, "colDiffuse");
-        shader.locs[LOC_MAP_DIFFUSE] = glGetUniformLocation(shader.id, "texture0");
+    for (int i = 0; i < batch->drawsCounter; i++)
+    {
+        const DrawCall *draw = &batch->draws[order[i]];
 
-        // NOTE: We could also use below function but in case DEFAULT_ATTRIB_* points are
-        // changed for external custom shaders, we just use direct bindings above
-        //SetShaderDefaultLocations(&shader);
+        if (draw->vertexCount == 0) continue;
+
+        if ((sortCounter > 0) && IsDrawCallCompatible(&sortDraws[sortCounter - 1], draw))
+        {
+            vCounter -= sortDraws[sortCounter - 1].vertexAlignment;
+            sortDraws[sortCounter - 1].vertexCount += draw->vertexCount;
+        }
+        else
+        {
+            sortDraws[sortCounter] = *draw;
+            sortCounter++;
+        }
+
+        CopyBufferVertices(&sortBuffer, vCounter, buffer, offsets[order[i]], draw->vertexCount);
+        vCounter += draw->vertexCount;
+
+        // Align vertex count to a multiple of 4 for next draw call
+        sortDraws[sortCounter - 1].vertexAlignment = (4 - (sortDraws[sortCounter - 1].vertexCount%4))%4;
+        vCounter += sortDraws[sortCounter - 1].vertexAlignment;
     }
-    else TraceLog(LOG_WARNING, "[SHDR ID %i] Default shader could not be loaded", shader.id);
 
-    return shader;
-}
+    if (sortCounter == 0) return;
 
-// Get location handlers to for shader attributes and uniforms
-// NOTE: If any location is not found, loc point becomes -1
-static void SetShaderDefaultLocations(Shader *shader)
-{
-    // NOTE: Default shader attrib locations have been fixed before linking:
-    //          vertex position location    = 0
-    //          vertex texcoord location    = 1
-    //          vertex normal location      = 2
-    //          vertex color location       = 3
-    //          vertex tangent location     = 4
-    //          vertex texcoord2 location   = 5
+    // Last draw does not require alignment
+    vCounter -= sortDraws[sortCounter - 1].vertexAlignment;
+    sortDraws[sortCounter - 1].vertexAlignment = 0;
 
-    // Get handles to GLSL input attibute locations
-    shader->locs[LOC_VERTEX_POSITION] = glGetAttribLocation(shader->id, DEFAULT_ATTRIB_POSITION_NAME);
-    shader->locs[LOC_VERTEX_TEXCOORD01] = glGetAttribLocation(shader->id, DEFAULT_ATTRIB_TEXCOORD_NAME);
-    shader->locs[LOC_VERTEX_TEXCOORD02] = glGetAttribLocation(shader->id, DEFAULT_ATTRIB_TEXCOORD2_NAME);
-    shader->locs[LOC_VERTEX_NORMAL] = glGetAttribLocation(shader->id, DEFAULT_ATTRIB_NORMAL_NAME);
-    shader->locs[LOC_VERTEX_TANGENT] = glGetAttribLocation(shader->id, DEFAULT_ATTRIB_TANGENT_NAME);
-    shader->locs[LOC_VERTEX_COLOR] = glGetAttribLocation(shader->id, DEFAULT_ATTRIB_COLOR_NAME);
+    // Swap scratch vertex arrays with current buffer arrays
+    DynamicBuffer temp = *buffer;
+#if defined(SUPPORT_BATCH_INTERLEAVED)
+    buffer->elements = sortBuffer.elements;
+    sortBuffer.elements = temp.elements;
+#else
+    buffer->vertices = sortBuffer.vertices;
+    buffer->texcoords = sortBuffer.texcoords;
+    buffer->colors = sortBuffer.colors;
+    sortBuffer.vertices = temp.vertices;
+    sortBuffer.texcoords = temp.texcoords;
+    sortBuffer.colors = temp.colors;
+#endif
 
-    // Get handles to GLSL uniform locations (vertex shader)
-    shader->locs[LOC_MATRIX_MVP]  = glGetUniformLocation(shader->id, "mvp");
-    shader->locs[LOC_MATRIX_PROJECTION]  = glGetUniformLocation(shader->id, "projection");
-    shader->locs[LOC_MATRIX_VIEW]  = glGetUniformLocation(shader->id, "view");
+    // NOTE: Scratch arrays capacity is now current batch arrays capacity
+    sortBufferElements = batch->elements;
 
-    // Get handles to GLSL uniform locations (fragment shader)
-    shader->locs[LOC_COLOR_DIFFUSE] = glGetUniformLocation(shader->id, "colDiffuse");
-    shader->locs[LOC_MAP_DIFFUSE] = glGetUniformLocation(shader->id, "texture0");
-    shader->locs[LOC_MAP_SPECULAR] = glGetUniformLocation(shader->id, "texture1");
-    shader->locs[LOC_MAP_NORMAL] = glGetUniformLocation(shader->id, "texture2");
+    buffer->vCounter = vCounter;
+    buffer->tcCounter = vCounter;
+    buffer->cCounter = vCounter;
+
+    for (int i = 0; i < sortCounter; i++) batch->draws[i] = sortDraws[i];
+    batch->drawsCounter = sortCounter;
 }
 
-// Unload default shader
-static void UnloadShaderDefault(void)
+#if defined(SUPPORT_BATCH_STREAMING)
+// Load immutable storage for currently bound array buffer and map it persistently
+// NOTE: Returns NULL if mapping fails, in that case buffer is updated with glBufferSubData()
+static void *LoadBufferPersistent(int dataSize, const void *data)
 {
-    glUseProgram(0);
+    void *mapped = NULL;
 
-    glDetachShader(defaultShader.id, defaultVShaderId);
-    glDetachShader(defaultShader.id, defaultFShaderId);
-    glDeleteShader(defaultVShaderId);
-    glDeleteShader(defaultFShaderId);
+#if !defined(__APPLE__)
+    // NOTE: GL_DYNAMIC_STORAGE_BIT allows glBufferSubData() fallback on immutable storage
+    glBufferStorage(GL_ARRAY_BUFFER, dataSize, data, GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT | GL_DYNAMIC_STORAGE_BIT);
+    mapped = glMapBufferRange(GL_ARRAY_BUFFER, 0, dataSize, GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT);
 
-    glDeleteProgram(defaultShader.id);
+    if (mapped == NULL) TraceLog(LOG_WARNING, "Buffer could not be persistent-mapped, using regular updates");
+#endif
+
+    return mapped;
 }
 
-// Load default internal buffers
-static void LoadBuffersDefault(void)
+// Upload vertex data to one of the streamed buffers (vertex positions, texcoords, colors)
+// NOTE: CPU arrays are written sequentially into mapped memory, avoiding scattered writes
+// on write-combined memory while vertex data is generated
+static void UploadBufferStream(DynamicBuffer *buffer, int vbo, int dataSize, const void *data)
 {
-    // Initialize CPU (RAM) arrays (vertex position, texcoord, color data and indexes)
-    //--------------------------------------------------------------------------------------------
-    for (int i = 0; i < MAX_BATCH_BUFFERING; i++)
+    glBindBuffer(GL_ARRAY_BUFFER, buffer->vboId[vbo]);
+
+    if (buffer->mapped[vbo] != NULL)
     {
-        vertexData[i].vertices = (float *)RL_MALLOC(sizeof(float)*3*4*MAX_BATCH_ELEMENTS);        // 3 float by vertex, 4 vertex by quad
-        vertexData[i].texcoords = (float *)RL_MALLOC(sizeof(float)*2*4*MAX_BATCH_ELEMENTS);       // 2 float by texcoord, 4 texcoord by quad
-        vertexData[i].colors = (unsigned char *)RL_MALLOC(sizeof(unsigned char)*4*4*MAX_BATCH_ELEMENTS);  // 4 float by color, 4 colors by quad
-#if defined(GRAPHICS_API_OPENGL_33)
-        vertexData[i].indices = (unsigned int *)RL_MALLOC(sizeof(unsigned int)*6*MAX_BATCH_ELEMENTS);      // 6 int by quad (indices)
-#elif defined(GRAPHICS_API_OPENGL_ES2)
-        vertexData[i].indices = (unsigned short *)RL_MALLOC(sizeof(unsigned short)*6*MAX_BATCH_ELEMENTS);  // 6 int by quad (indices)
-#endif
+        // Persistent-mapped coherent buffer, fence already waited, no flush required
+        memcpy(buffer->mapped[vbo], data, dataSize);
+        return;
+    }
 
-        for (int j = 0; j < (3*4*MAX_BATCH_ELEMENTS); j++) vertexData[i].vertices[j] = 0.0f;
-        for (int j = 0; j < (2*4*MAX_BATCH_ELEMENTS); j++) vertexData[i].texcoords[j] = 0.0f;
-        for (int j = 0; j < (4*4*MAX_BATCH_ELEMENTS); j++) vertexData[i].colors[j] = 0;
+    if (batchStreamMode == BATCH_STREAM_MAP_RANGE)
+    {
+        GLbitfield access = GL_MAP_WRITE_BIT;
 
-        int k = 0;
+        // If GPU is done with this buffer we write it without any synchronization,
+        // otherwise buffer is orphaned and driver provides a new storage for it
+        if (IsBufferFenceSignaled(buffer)) access |= (GL_MAP_UNSYNCHRONIZED_BIT | GL_MAP_INVALIDATE_RANGE_BIT);
+        else access |= GL_MAP_INVALIDATE_BUFFER_BIT;
 
-        // Indices can be initialized right now
-        for (int j = 0; j < (6*MAX_BATCH_ELEMENTS); j += 6)
+        void *mapped = glMapBufferRange(GL_ARRAY_BUFFER, 0, dataSize, access);
+
+        if (mapped != NULL)
         {
-            vertexData[i].indices[j] = 4*k;
-            vertexData[i].indices[j + 1] = 4*k + 1;
-            vertexData[i].indices[j + 2] = 4*k + 2;
-            vertexData[i].indices[j + 3] = 4*k;
-            vertexData[i].indices[j + 4] = 4*k + 2;
-            vertexData[i].indices[j + 5] = 4*k + 3;
+            memcpy(mapped, data, dataSize);
 
-            k++;
+            // NOTE: Buffer data could be corrupted on unmap (i.e. screen mode change), just upload it again
+            if (glUnmapBuffer(GL_ARRAY_BUFFER) == GL_TRUE) return;
+        }
+    }
+
+    glBufferSubData(GL_ARRAY_BUFFER, 0, dataSize, data);
+}
+
+// Check if GPU is done with buffer (no blocking)
+static bool IsBufferFenceSignaled(DynamicBuffer *buffer)
+{
+    bool signaled = true;
+
+    if (buffer->fence != NULL)
+    {
+        GLenum result = glClientWaitSync(buffer->fence, 0, 0);
+
+        if ((result == GL_ALREADY_SIGNALED) || (result == GL_CONDITION_SATISFIED))
+        {
+            glDeleteSync(buffer->fence);
+            buffer->fence = NULL;
         }
-
-        vertexData[i].vCounter = 0;
-        vertexData[i].tcCounter = 0;
-        vertexData[i].cCounter = 0;
+        else signaled = false;
     }
 
-    TraceLog(LOG_INFO, "Internal buffers initialized successfully (CPU)");
-    //--------------------------------------------------------------------------------------------
+    return signaled;
+}
 
-    // Upload to GPU (VRAM) vertex data and initialize VAOs/VBOs
-    //--------------------------------------------------------------------------------------------
-    for (int i = 0; i < MAX_BATCH_BUFFERING; i++)
+// Wait until GPU is done with buffer
+// NOTE: With MAX_BATCH_BUFFERING buffers in the ring it should rarely block
+static void WaitBufferFence(DynamicBuffer *buffer)
+{
+    if (buffer->fence != NULL)
     {
-        if (vaoSupported)
+        GLbitfield flags = GL_SYNC_FLUSH_COMMANDS_BIT;
+
+        while (true)
         {
-            // Initialize Quads VAO
-            glGenVertexArrays(1, &vertexData[i].vaoId);
-            glBindVertexArray(vertexData[i].vaoId);
-        }
+            GLenum result = glClientWaitSync(buffer->fence, flags, 1000000);  // 1 ms timeout (in nanoseconds)
 
-        // Quads - Vertex buffers binding and attributes enable
-        // Vertex position buffer (shader-location = 0)
-        glGenBuffers(1, &vertexData[i].vboId[0]);
-        glBindBuffer(GL_ARRAY_BUFFER, vertexData[i].vboId[0]);
-        glBufferData(GL_ARRAY_BUFFER, sizeof(float)*3*4*MAX_BATCH_ELEMENTS, vertexData[i].vertices, GL_DYNAMIC_DRAW);
-        glEnableVertexAttribArray(currentShader.locs[LOC_VERTEX_POSITION]);
-        glVertexAttribPointer(currentShader.locs[LOC_VERTEX_POSITION], 3, GL_FLOAT, 0, 0, 0);
+            if ((result == GL_ALREADY_SIGNALED) || (result == GL_CONDITION_SATISFIED) || (result == GL_WAIT_FAILED)) break;
 
-        // Vertex texcoord buffer (shader-location = 1)
-        glGenBuffers(1, &vertexData[i].vboId[1]);
-        glBindBuffer(GL_ARRAY_BUFFER, vertexData[i].vboId[1]);
-        glBufferData(GL_ARRAY_BUFFER, sizeof(float)*2*4*MAX_BATCH_ELEMENTS, vertexData[i].texcoords, GL_DYNAMIC_DRAW);
-        glEnableVertexAttribArray(currentShader.locs[LOC_VERTEX_TEXCOORD01]);
-        glVertexAttribPointer(currentShader.locs[LOC_VERTEX_TEXCOORD01], 2, GL_FLOAT, 0, 0, 0);
+            flags = 0;  // Commands only need to be flushed once
+        }
 
-        // Vertex color buffer (shader-location = 3)
-        glGenBuffers(1, &vertexData[i].vboId[2]);
-        glBindBuffer(GL_ARRAY_BUFFER, vertexData[i].vboId[2]);
-        glBufferData(GL_ARRAY_BUFFER, sizeof(unsigned char)*4*4*MAX_BATCH_ELEMENTS, vertexData[i].colors, GL_DYNAMIC_DRAW);
-        glEnableVertexAttribArray(currentShader.locs[LOC_VERTEX_COLOR]);
-        glVertexAttribPointer(currentShader.locs[LOC_VERTEX_COLOR], 4, GL_UNSIGNED_BYTE, GL_TRUE, 0, 0);
+        glDeleteSync(buffer->fence);
+        buffer->fence = NULL;
+    }
+}
+#endif  // SUPPORT_BATCH_STREAMING
 
-        // Fill index buffer
-        glGenBuffers(1, &vertexData[i].vboId[3]);
-        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, vertexData[i].vboId[3]);
-#if defined(GRAPHICS_API_OPENGL_33)
-        glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(int)*6*MAX_BATCH_ELEMENTS, vertexData[i].indices, GL_STATIC_DRAW);
-#elif defined(GRAPHICS_API_OPENGL_ES2)
-        glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(short)*6*MAX_BATCH_ELEMENTS, vertexData[i].indices, GL_STATIC_DRAW);
-#endif
+#if defined(SUPPORT_FRAME_CAPTURE)
+// Open requested frame capture file and write header and initial render state (called by BeginDrawing())
+static void StartFrameCapture(void)
+{
+    captureFile = fopen(captureFileName, "wb");
+    captureFileName[0] = '\0';
+
+    if (captureFile == NULL)
+    {
+        TraceLog(LOG_WARNING, "Frame capture file could not be opened");
+        return;
     }
 
-    TraceLog(LOG_INFO, "Internal buffers uploaded successfully (GPU)");
+    captureCommandsCount = 0;
+    captureTexturesCount = 0;
+    captureMeshesCount = 0;
+
+    CaptureHeader header = { { 'r', 'l', 'F', 'C' }, CAPTURE_FILE_VERSION, framebufferWidth, framebufferHeight, defaultTextureId, defaultShader.id };
+    fwrite(&header, sizeof(CaptureHeader), 1, captureFile);
+
+    // Initial render state, frame could start with any state set by previous frame
+    int viewport[4] = { 0 };
+    int framebuffer = 0;
+    glGetIntegerv(GL_VIEWPORT, viewport);
+    glGetIntegerv(GL_FRAMEBUFFER_BINDING, &framebuffer);
+
+    if (framebuffer != 0) WriteCaptureState(CAPTURE_STATE_RENDER_TEXTURE, framebuffer, 0, 0, 0);
+    WriteCaptureState(CAPTURE_STATE_VIEWPORT, viewport[0], viewport[1], viewport[2], viewport[3]);
+    WriteCaptureState(CAPTURE_STATE_BLEND_MODE, blendMode, 0, 0, 0);
+    WriteCaptureState(CAPTURE_STATE_DEPTH_TEST, glIsEnabled(GL_DEPTH_TEST), 0, 0, 0);
+    WriteCaptureState(CAPTURE_STATE_BACKFACE_CULLING, glIsEnabled(GL_CULL_FACE), 0, 0, 0);
+    WriteCaptureState(CAPTURE_STATE_SCISSOR_TEST, scissorTest, 0, 0, 0);
+    WriteCaptureState(CAPTURE_STATE_SCISSOR, scissorRect[0], scissorRect[1], scissorRect[2], scissorRect[3]);
+}
 
-    // Unbind the current VAO
-    if (vaoSupported) glBindVertexArray(0);
-    //--------------------------------------------------------------------------------------------
+// Close frame capture file (called by EndDrawing())
+static void EndFrameCapture(void)
+{
+    fclose(captureFile);
+    captureFile = NULL;
+
+    TraceLog(LOG_INFO, "Frame captured: %i commands, %i textures, %i meshes", captureCommandsCount, captureTexturesCount, captureMeshesCount);
 }
 
-// Update default internal buffers (VAOs/VBOs) with vertex array data
-// NOTE: If there is not vertex data, buffers doesn't need to be updated (vertexCount > 0)
-// TODO: If no data changed on the CPU arrays --> No need to re-update GPU arrays (change flag required)
-static void UpdateBuffersDefault(void)
+// Write capture command header, command data is written next
+static void WriteCaptureCommand(int type, int size)
 {
-    // Update vertex buffers data
-    if (vertexData[currentBuffer].vCounter > 0)
-    {
-        // Activate elements VAO
-        if (vaoSupported) glBindVertexArray(vertexData[currentBuffer].vaoId);
+    int command[2] = { type, size };
+    fwrite(command, sizeof(int), 2, captureFile);
+    captureCommandsCount++;
+}
 
-        // Vertex positions buffer
-        glBindBuffer(GL_ARRAY_BUFFER, vertexData[currentBuffer].vboId[0]);
-        glBufferSubData(GL_ARRAY_BUFFER, 0, sizeof(float)*3*vertexData[currentBuffer].vCounter, vertexData[currentBuffer].vertices);
-        //glBufferData(GL_ARRAY_BUFFER, sizeof(float)*3*4*MAX_BATCH_ELEMENTS, vertexData[currentBuffer].vertices, GL_DYNAMIC_DRAW);  // Update all buffer
+// Get texture size for frame capture
+// NOTE: OpenGL ES 2.0 can not query texture size, 0 is returned
+static void GetCaptureTextureSize(unsigned int id, int *width, int *height)
+{
+    *width = 0;
+    *height = 0;
 
-        // Texture coordinates buffer
-        glBindBuffer(GL_ARRAY_BUFFER, vertexData[currentBuffer].vboId[1]);
-        glBufferSubData(GL_ARRAY_BUFFER, 0, sizeof(float)*2*vertexData[currentBuffer].vCounter, vertexData[currentBuffer].texcoords);
-        //glBufferData(GL_ARRAY_BUFFER, sizeof(float)*2*4*MAX_BATCH_ELEMENTS, vertexData[currentBuffer].texcoords, GL_DYNAMIC_DRAW); // Update all buffer
+#if defined(GRAPHICS_API_OPENGL_33)
+    int currentTexture = 0;
+    glGetIntegerv(GL_TEXTURE_BINDING_2D, &currentTexture);
 
-        // Colors buffer
-        glBindBuffer(GL_ARRAY_BUFFER, vertexData[currentBuffer].vboId[2]);
-        glBufferSubData(GL_ARRAY_BUFFER, 0, sizeof(unsigned char)*4*vertexData[currentBuffer].vCounter, vertexData[currentBuffer].colors);
-        //glBufferData(GL_ARRAY_BUFFER, sizeof(float)*4*4*MAX_BATCH_ELEMENTS, vertexData[currentBuffer].colors, GL_DYNAMIC_DRAW);    // Update all buffer
+    glBindTexture(GL_TEXTURE_2D, id);
+    glGetTexLevelParameteriv(GL_TEXTURE_2D, 0, GL_TEXTURE_WIDTH, width);
+    glGetTexLevelParameteriv(GL_TEXTURE_2D, 0, GL_TEXTURE_HEIGHT, height);
+    glBindTexture(GL_TEXTURE_2D, currentTexture);
+#endif
+}
 
-        // NOTE: glMapBuffer() causes sync issue.
-        // If GPU is working with this buffer, glMapBuffer() will wait(stall) until GPU to finish its job.
-        // To avoid waiting (idle), you can call first glBufferData() with NULL pointer before glMapBuffer().
-        // If you do that, the previous data in PBO will be discarded and glMapBuffer() returns a new
-        // allocated pointer immediately even if GPU is still working with the previous data.
+// Write texture info, only first reference on frame is written
+// NOTE: Texture pixels are not captured, replay uses placeholder textures of the same size
+static void WriteCaptureTexture(unsigned int id)
+{
+    if ((id == 0) || (id == defaultTextureId)) return;
 
-        // Another option: map the buffer object into client's memory
-        // Probably this code could be moved somewhere else...
-        // vertexData[currentBuffer].vertices = (float *)glMapBuffer(GL_ARRAY_BUFFER, GL_READ_WRITE);
-        // if (vertexData[currentBuffer].vertices)
-        // {
-            // Update vertex data
-        // }
-        // glUnmapBuffer(GL_ARRAY_BUFFER);
+    for (int i = 0; i < captureTexturesCount; i++) if (captureTextureIds[i] == id) return;
+    if (captureTexturesCount >= MAX_CAPTURE_RESOURCES) return;
 
-        // Unbind the current VAO
-        if (vaoSupported) glBindVertexArray(0);
-    }
+    captureTextureIds[captureTexturesCount++] = id;
+
+    CaptureTexture texture = { id, 0, 0 };
+    GetCaptureTextureSize(id, &texture.width, &texture.height);
+
+    WriteCaptureCommand(CAPTURE_TEXTURE, sizeof(CaptureTexture));
+    fwrite(&texture, sizeof(CaptureTexture), 1, captureFile);
 }
 
-// Draw default internal buffers vertex data
-static void DrawBuffersDefault(void)
+// Write mesh vertex data, only first reference on frame is written
+// NOTE: Animated meshes store current animated vertices and normals
+static unsigned int WriteCaptureMesh(Mesh mesh)
 {
-    Matrix matProjection = projection;
-    Matrix matModelView = modelview;
-
-    int eyesCount = 1;
-#if defined(SUPPORT_VR_SIMULATOR)
-    if (vrStereoRender) eyesCount = 2;
-#endif
+    unsigned int id = (mesh.vaoId > 0)? mesh.vaoId : ((mesh.vboId != NULL)? mesh.vboId[0] : 0);
 
-    for (int eye = 0; eye < eyesCount; eye++)
-    {
-#if defined(SUPPORT_VR_SIMULATOR)
-        if (eyesCount == 2) SetStereoView(eye, matProjection, matModelView);
-#endif
+    for (int i = 0; i < captureMeshesCount; i++) if (captureMeshIds[i] == id) return id;
+    if (captureMeshesCount >= MAX_CAPTURE_RESOURCES) return id;
 
-        // Draw buffers
-        if (vertexData[currentBuffer].vCounter > 0)
-        {
-            // Set current shader and upload current MVP matrix
-            glUseProgram(currentShader.id);
+    captureMeshIds[captureMeshesCount++] = id;
 
-            // Create modelview-projection matrix
-            Matrix matMVP = MatrixMultiply(modelview, projection);
+    const float *vertices = (mesh.animVertices != NULL)? mesh.animVertices : mesh.vertices;
+    const float *normals = (mesh.animNormals != NULL)? mesh.animNormals : mesh.normals;
 
-            glUniformMatrix4fv(currentShader.locs[LOC_MATRIX_MVP], 1, false, MatrixToFloat(matMVP));
-            glUniform4f(currentShader.locs[LOC_COLOR_DIFFUSE], 1.0f, 1.0f, 1.0f, 1.0f);
-            glUniform1i(currentShader.locs[LOC_MAP_DIFFUSE], 0);    // Provided value refers to the texture unit (active)
+    CaptureMesh info = { id, mesh.vertexCount, mesh.triangleCount, 0 };
+    int size = sizeof(CaptureMesh);
 
-            // TODO: Support additional texture units on custom shader
-            //if (currentShader->locs[LOC_MAP_SPECULAR] > 0) glUniform1i(currentShader.locs[LOC_MAP_SPECULAR], 1);
-            //if (currentShader->locs[LOC_MAP_NORMAL] > 0) glUniform1i(currentShader.locs[LOC_MAP_NORMAL], 2);
+    if (vertices != NULL) { info.dataFlags |= CAPTURE_MESH_VERTICES; size += mesh.vertexCount*3*sizeof(float); }
+    if (mesh.texcoords != NULL) { info.dataFlags |= CAPTURE_MESH_TEXCOORDS; size += mesh.vertexCount*2*sizeof(float); }
+    if (normals != NULL) { info.dataFlags |= CAPTURE_MESH_NORMALS; size += mesh.vertexCount*3*sizeof(float); }
+    if (mesh.colors != NULL) { info.dataFlags |= CAPTURE_MESH_COLORS; size += mesh.vertexCount*4*sizeof(unsigned char); }
+    if (mesh.indices != NULL) { info.dataFlags |= CAPTURE_MESH_INDICES; size += mesh.triangleCount*3*sizeof(unsigned short); }
 
-            // NOTE: Right now additional map textures not considered for default buffers drawing
+    WriteCaptureCommand(CAPTURE_MESH, size);
+    fwrite(&info, sizeof(CaptureMesh), 1, captureFile);
 
-            int vertexOffset = 0;
+    if (vertices != NULL) fwrite(vertices, 3*sizeof(float), mesh.vertexCount, captureFile);
+    if (mesh.texcoords != NULL) fwrite(mesh.texcoords, 2*sizeof(float), mesh.vertexCount, captureFile);
+    if (normals != NULL) fwrite(normals, 3*sizeof(float), mesh.vertexCount, captureFile);
+    if (mesh.colors != NULL) fwrite(mesh.colors, 4*sizeof(unsigned char), mesh.vertexCount, captureFile);
+    if (mesh.indices != NULL) fwrite(mesh.indices, 3*sizeof(unsigned short), mesh.triangleCount, captureFile);
 
-            if (vaoSupported) glBindVertexArray(vertexData[currentBuffer].vaoId);
-            else
-            {
-                // Bind vertex attrib: position (shader-location = 0)
-                glBindBuffer(GL_ARRAY_BUFFER, vertexData[currentBuffer].vboId[0]);
-                glVertexAttribPointer(currentShader.locs[LOC_VERTEX_POSITION], 3, GL_FLOAT, 0, 0, 0);
-                glEnableVertexAttribArray(currentShader.locs[LOC_VERTEX_POSITION]);
-
-                // Bind vertex attrib: texcoord (shader-location = 1)
-                glBindBuffer(GL_ARRAY_BUFFER, vertexData[currentBuffer].vboId[1]);
-                glVertexAttribPointer(currentShader.locs[LOC_VERTEX_TEXCOORD01], 2, GL_FLOAT, 0, 0, 0);
-                glEnableVertexAttribArray(currentShader.locs[LOC_VERTEX_TEXCOORD01]);
-
-                // Bind vertex attrib: color (shader-location = 3)
-                glBindBuffer(GL_ARRAY_BUFFER, vertexData[currentBuffer].vboId[2]);
-                glVertexAttribPointer(currentShader.locs[LOC_VERTEX_COLOR], 4, GL_UNSIGNED_BYTE, GL_TRUE, 0, 0);
-                glEnableVertexAttribArray(currentShader.locs[LOC_VERTEX_COLOR]);
-
-                glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, vertexData[currentBuffer].vboId[3]);
-            }
+    return id;
+}
 
-            glActiveTexture(GL_TEXTURE0);
+// Write batch flush: shader, matrices, vertex data and draw calls (called by DrawBatchBuffers())
+// NOTE: Vertex data is read from CPU arrays, also valid on persistent-mapped streaming (data copied on upload)
+static void WriteCaptureBatch(RenderBatch *batch)
+{
+    DynamicBuffer *buffer = &batch->vertexBuffer[batch->currentBuffer];
 
-            for (int i = 0; i < drawsCounter; i++)
-            {
-                glBindTexture(GL_TEXTURE_2D, draws[i].textureId);
+    for (int i = 0; i < batch->drawsCounter; i++) WriteCaptureTexture(batch->draws[i].textureId);
 
-                // TODO: Find some way to bind additional textures --> Use global texture IDs? Register them on draw[i]?
-                //if (currentShader->locs[LOC_MAP_SPECULAR] > 0) { glActiveTexture(GL_TEXTURE1); glBindTexture(GL_TEXTURE_2D, textureUnit1_id); }
-                //if (currentShader->locs[LOC_MAP_SPECULAR] > 0) { glActiveTexture(GL_TEXTURE2); glBindTexture(GL_TEXTURE_2D, textureUnit2_id); }
+    CaptureBatch info = { currentShader.id, modelview, projection, buffer->vCounter, batch->drawsCounter };
 
-                if ((draws[i].mode == RL_LINES) || (draws[i].mode == RL_TRIANGLES)) glDrawArrays(draws[i].mode, vertexOffset, draws[i].vertexCount);
-                else
-                {
-#if defined(GRAPHICS_API_OPENGL_33)
-                    // We need to define the number of indices to be processed: quadsCount*6
-                    // NOTE: The final parameter tells the GPU the offset in bytes from the
-                    // start of the index buffer to the location of the first index to process
-                    glDrawElements(GL_TRIANGLES, draws[i].vertexCount/4*6, GL_UNSIGNED_INT, (GLvoid *)(sizeof(GLuint)*vertexOffset/4*6));
-#elif defined(GRAPHICS_API_OPENGL_ES2)
-                    glDrawElements(GL_TRIANGLES, draws[i].vertexCount/4*6, GL_UNSIGNED_SHORT, (GLvoid *)(sizeof(GLushort)*vertexOffset/4*6));
-#endif
-                }
+    WriteCaptureCommand(CAPTURE_BATCH, sizeof(CaptureBatch) + info.vertexCount*sizeof(CaptureVertex) + info.drawsCount*sizeof(CaptureDraw));
+    fwrite(&info, sizeof(CaptureBatch), 1, captureFile);
 
-                vertexOffset += (draws[i].vertexCount + draws[i].vertexAlignment);
-            }
+    // Vertex data converted to capture vertex format by chunks
+    CaptureVertex vertices[256] = { 0 };
 
-            if (!vaoSupported)
-            {
-                glBindBuffer(GL_ARRAY_BUFFER, 0);
-                glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
-            }
+    for (int offset = 0; offset < buffer->vCounter; offset += 256)
+    {
+        int count = ((buffer->vCounter - offset) < 256)? (buffer->vCounter - offset) : 256;
 
-            glBindTexture(GL_TEXTURE_2D, 0);    // Unbind textures
+        for (int i = 0; i < count; i++)
+        {
+#if defined(SUPPORT_BATCH_INTERLEAVED)
+            memcpy(vertices[i].position, buffer->elements[offset + i].position, 3*sizeof(float));
+            memcpy(vertices[i].texcoord, buffer->elements[offset + i].texcoord, 2*sizeof(float));
+            memcpy(vertices[i].color, buffer->elements[offset + i].color, 4*sizeof(unsigned char));
+#else
+            memcpy(vertices[i].position, buffer->vertices + (offset + i)*3, 3*sizeof(float));
+            memcpy(vertices[i].texcoord, buffer->texcoords + (offset + i)*2, 2*sizeof(float));
+            memcpy(vertices[i].color, buffer->colors + (offset + i)*4, 4*sizeof(unsigned char));
+#endif
         }
 
-        if (vaoSupported) glBindVertexArray(0); // Unbind VAO
-
-        glUseProgram(0);    // Unbind shader program
+        fwrite(vertices, sizeof(CaptureVertex), count, captureFile);
     }
 
-    // Reset vertex counters for next frame
-    vertexData[currentBuffer].vCounter = 0;
-    vertexData[currentBuffer].tcCounter = 0;
-    vertexData[currentBuffer].cCounter = 0;
+    DrawCall current = { 0 };
+    SetDrawCallState(&current);
 
-    // Reset depth for next draw
-    currentDepth = -1.0f;
+    for (int i = 0; i < batch->drawsCounter; i++)
+    {
+        // NOTE: Retained batches are drawn with current render state
+        const DrawCall *state = batch->retained? &current : &batch->draws[i];
 
-    // Restore projection/modelview matrices
-    projection = matProjection;
-    modelview = matModelView;
+        CaptureDraw draw = { batch->draws[i].mode, batch->draws[i].vertexCount, batch->draws[i].vertexAlignment, batch->draws[i].textureId,
+                             state->blendMode, state->scissorTest, { state->scissor[0], state->scissor[1], state->scissor[2], state->scissor[3] } };
+        fwrite(&draw, sizeof(CaptureDraw), 1, captureFile);
+    }
+}
 
-    // Reset draws array
-    for (int i = 0; i < MAX_DRAWCALL_REGISTERED; i++)
+// Write mesh draw: mesh data (first reference), material maps, matrices and instances transforms
+static void WriteCaptureMeshDraw(Mesh mesh, Material material, Matrix transform, const Matrix *transforms, int instances)
+{
+    CaptureMeshDraw info = { 0 };
+
+    info.meshId = WriteCaptureMesh(mesh);
+    info.shaderId = material.shader.id;
+
+    for (int i = 0; i < MAX_MATERIAL_MAPS; i++)
     {
-        draws[i].mode = RL_QUADS;
-        draws[i].vertexCount = 0;
-        draws[i].textureId = defaultTextureId;
+        info.textureIds[i] = material.maps[i].texture.id;
+        WriteCaptureTexture(info.textureIds[i]);
     }
 
-    drawsCounter = 1;
-
-    // Change to next buffer in the list
-    currentBuffer++;
-    if (currentBuffer >= MAX_BATCH_BUFFERING) currentBuffer = 0;
+    info.color[0] = material.maps[MAP_DIFFUSE].color.r;
+    info.color[1] = material.maps[MAP_DIFFUSE].color.g;
+    info.color[2] = material.maps[MAP_DIFFUSE].color.b;
+    info.color[3] = material.maps[MAP_DIFFUSE].color.a;
+    info.transform = transform;
+    info.modelview = MatrixMultiply(transformMatrix, modelview);
+    info.projection = projection;
+    info.instances = instances;
+
+    WriteCaptureCommand(CAPTURE_DRAW_MESH, sizeof(CaptureMeshDraw) + instances*sizeof(Matrix));
+    fwrite(&info, sizeof(CaptureMeshDraw), 1, captureFile);
+    if (instances > 0) fwrite(transforms, sizeof(Matrix), instances, captureFile);
 }
 
-// Unload default internal buffers vertex data from CPU and GPU
-static void UnloadBuffersDefault(void)
+// Write render state change (CAPTURE_STATE())
+static void WriteCaptureState(int state, int v0, int v1, int v2, int v3)
 {
-    // Unbind everything
-    if (vaoSupported) glBindVertexArray(0);
-    glDisableVertexAttribArray(0);
-    glDisableVertexAttribArray(1);
-    glDisableVertexAttribArray(2);
-    glDisableVertexAttribArray(3);
-    glBindBuffer(GL_ARRAY_BUFFER, 0);
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+    if (captureFile == NULL) return;
+
+    CaptureState info = { state, { v0, v1, v2, v3 } };
 
-    for (int i = 0; i < MAX_BATCH_BUFFERING; i++)
+#if defined(GRAPHICS_API_OPENGL_33)
+    // Render texture size from its color attachment, so replay can create an equivalent target
+    if ((state == CAPTURE_STATE_RENDER_TEXTURE) && (v0 > 0))
     {
-        // Delete VBOs from GPU (VRAM)
-        glDeleteBuffers(1, &vertexData[i].vboId[0]);
-        glDeleteBuffers(1, &vertexData[i].vboId[1]);
-        glDeleteBuffers(1, &vertexData[i].vboId[2]);
-        glDeleteBuffers(1, &vertexData[i].vboId[3]);
+        int colorType = 0;
+        int colorId = 0;
 
-        // Delete VAOs from GPU (VRAM)
-        if (vaoSupported) glDeleteVertexArrays(1, &vertexData[i].vaoId);
+        glGetFramebufferAttachmentParameteriv(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_FRAMEBUFFER_ATTACHMENT_OBJECT_TYPE, &colorType);
 
-        // Free vertex arrays memory from CPU (RAM)
-        RL_FREE(vertexData[i].vertices);
-        RL_FREE(vertexData[i].texcoords);
-        RL_FREE(vertexData[i].colors);
-        RL_FREE(vertexData[i].indices);
+        if (colorType == GL_TEXTURE)
+        {
+            glGetFramebufferAttachmentParameteriv(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_FRAMEBUFFER_ATTACHMENT_OBJECT_NAME, &colorId);
+            GetCaptureTextureSize(colorId, &info.values[1], &info.values[2]);
+        }
     }
+#endif
+
+    WriteCaptureCommand(CAPTURE_STATE, sizeof(CaptureState));
+    fwrite(&info, sizeof(CaptureState), 1, captureFile);
+}
+
+// Write shader uniform value
+static void WriteCaptureUniform(unsigned int shaderId, int location, int type, int count, const void *value, int size)
+{
+    CaptureUniform info = { shaderId, location, type, count, size };
+
+    WriteCaptureCommand(CAPTURE_UNIFORM, sizeof(CaptureUniform) + size);
+    fwrite(&info, sizeof(CaptureUniform), 1, captureFile);
+    fwrite(value, 1, size, captureFile);
 }
+#endif  // SUPPORT_FRAME_CAPTURE
 
 // Renders a 1x1 XY quad in NDC
 static void GenDrawQuad(void)
@@ -4464,14 +10830,174 @@ static void SetStereoView(int eye, Matrix matProjection, Matrix matModelView)
     SetMatrixModelview(eyeModelView);
     SetMatrixProjection(eyeProjection);
 }
+
+#if defined(SUPPORT_VR_SINGLE_PASS)
+// Set both eyes model-view-projection matrices on stereo shader (must be in use)
+// NOTE: Viewport covers both eyes, stereo shader places every eye on its framebuffer half
+static void SetStereoViewSinglePass(Shader shader, Matrix matModelView)
+{
+    float matEyesMVP[32] = { 0 };
+
+    for (int eye = 0; eye < 2; eye++)
+    {
+        Matrix eyeMVP = MatrixMultiply(MatrixMultiply(matModelView, vrConfig.eyesViewOffset[eye]), vrConfig.eyesProjection[eye]);
+        memcpy(matEyesMVP + eye*16, MatrixToFloat(eyeMVP), 16*sizeof(float));
+    }
+
+    rlViewport(0, 0, framebufferWidth, framebufferHeight);
+    glUniformMatrix4fv(shader.locs[LOC_MATRIX_MVP], 2, false, matEyesMVP);
+}
+#endif
 #endif  // SUPPORT_VR_SIMULATOR
 
 #endif  // GRAPHICS_API_OPENGL_33 || GRAPHICS_API_OPENGL_ES2
 
+// Set GL blending function for blend mode (alpha, additive, multiplied)
+static void SetBlendFunction(int mode)
+{
+    switch (mode)
+    {
+        case BLEND_ALPHA: glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA); break;
+        case BLEND_ADDITIVE: glBlendFunc(GL_SRC_ALPHA, GL_ONE); break; // Alternative: glBlendFunc(GL_ONE, GL_ONE);
+        case BLEND_MULTIPLIED: glBlendFunc(GL_DST_COLOR, GL_ONE_MINUS_SRC_ALPHA); break;
+        case BLEND_ALPHA_TARGET:
+        {
+            // NOTE: Destination alpha is accumulated (over operator), alpha blending squares coverage on transparent targets
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+            glBlendFuncSeparate(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA, GL_ONE, GL_ONE_MINUS_SRC_ALPHA);
+#else
+            glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+#endif
+        } break;
+        default: break;
+    }
+}
+
+// Unbind mesh drawing state (shader, texture maps and vertex buffers)
+// NOTE: Called by every rlgl function that modifies GL bindings, so mesh state cache stays valid
+static void ReleaseMeshState(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    // NOTE: Mesh state belongs to render thread context, loader context bindings are not cached
+    if (!meshState.active || loaderThread) return;
+
+    // Unbind all binded texture maps
+    for (int i = 0; i < MAX_MATERIAL_MAPS; i++)
+    {
+        if (meshState.textureIds[i] != 0)
+        {
+            glActiveTexture(GL_TEXTURE0 + i);       // Set shader active texture
+            if ((i == MAP_IRRADIANCE) || (i == MAP_PREFILTER) || (i == MAP_CUBEMAP)) glBindTexture(GL_TEXTURE_CUBE_MAP, 0);
+            else glBindTexture(GL_TEXTURE_2D, 0);   // Unbind current active texture
+        }
+    }
+
+    glActiveTexture(GL_TEXTURE0);
+
+    // Unbind vertex array objects (or VBOs)
+    if (vaoSupported) glBindVertexArray(0);
+    else
+    {
+        glBindBuffer(GL_ARRAY_BUFFER, 0);
+        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+    }
+
+    // Unbind shader program
+    glUseProgram(0);
+
+    memset(&meshState, 0, sizeof(MeshDrawState));
+#endif
+}
+
+// Flip screen pixel data vertically (RGBA), returns new image data
+// NOTE: Alpha value has already been applied to RGB in screen framebuffer, it is set to 255 unless alpha is kept
+// NOTE: Pixels are copied as 32 bit words with alpha byte mask set (opaque), loop is vectorized by compiler
+static unsigned char *FlipScreenPixels(const unsigned char *screenData, int width, int height, bool alpha)
+{
+    unsigned char *imgData = (unsigned char *)RL_MALLOC(width*height*sizeof(unsigned char)*4);
+
+    // Alpha byte mask as 32 bit word (independent of endianness)
+    const unsigned char alphaBytes[4] = { 0, 0, 0, 255 };
+    unsigned int alphaMask = 0;
+    if (!alpha) memcpy(&alphaMask, alphaBytes, 4);
+
+    // NOTE: Screen data and image data are pixel aligned (RGBA rows, allocated or mapped buffers)
+    const unsigned int *srcPixels = (const unsigned int *)screenData;
+    unsigned int *dstPixels = (unsigned int *)imgData;
+
+    for (int y = 0; y < height; y++)
+    {
+        const unsigned int *src = srcPixels + (size_t)y*width;
+        unsigned int *dst = dstPixels + (size_t)((height - 1) - y)*width;     // Flip line
+
+        for (int x = 0; x < width; x++) dst[x] = src[x] | alphaMask;
+    }
+
+    return imgData;
+}
+
+// Track GPU memory of resource, size of an already tracked resource (reloaded data) is replaced
+static void TrackVideoMemory(int kind, unsigned int id, unsigned int size)
+{
+    if ((id == 0) || (size == 0)) return;
+
+    VIDEO_MEMORY_LOCK();
+
+    if (id >= videoMemoryCapacity[kind])
+    {
+        unsigned int capacity = (videoMemoryCapacity[kind] == 0)? 256 : videoMemoryCapacity[kind];
+        while (capacity <= id) capacity *= 2;
+
+        unsigned int *sizes = (unsigned int *)RL_REALLOC(videoMemorySizes[kind], capacity*sizeof(unsigned int));
+
+        if (sizes == NULL)
+        {
+            VIDEO_MEMORY_UNLOCK();
+            return;
+        }
+
+        memset(sizes + videoMemoryCapacity[kind], 0, (capacity - videoMemoryCapacity[kind])*sizeof(unsigned int));
+        videoMemorySizes[kind] = sizes;
+        videoMemoryCapacity[kind] = capacity;
+    }
+
+    MemoryUsage *usage = &videoMemoryUsage[(kind == VIDEO_MEMORY_BUFFER)? 1 : 0];
+
+    if (videoMemorySizes[kind][id] > 0) usage->bytes -= videoMemorySizes[kind][id];
+    else
+    {
+        usage->count++;
+        usage->totalCount++;
+    }
+
+    videoMemorySizes[kind][id] = size;
+    usage->bytes += size;
+    if (usage->bytes > usage->peakBytes) usage->peakBytes = usage->bytes;
+
+    VIDEO_MEMORY_UNLOCK();
+}
+
+// Untrack GPU memory of unloaded resource, not tracked resources are ignored
+static void UntrackVideoMemory(int kind, unsigned int id)
+{
+    VIDEO_MEMORY_LOCK();
+
+    if ((id < videoMemoryCapacity[kind]) && (videoMemorySizes[kind][id] > 0))
+    {
+        MemoryUsage *usage = &videoMemoryUsage[(kind == VIDEO_MEMORY_BUFFER)? 1 : 0];
+
+        usage->bytes -= videoMemorySizes[kind][id];
+        usage->count--;
+        videoMemorySizes[kind][id] = 0;
+    }
+
+    VIDEO_MEMORY_UNLOCK();
+}
+
 #if defined(GRAPHICS_API_OPENGL_11)
 // Mipmaps data is generated after image data
-// NOTE: Only works with RGBA (4 bytes) data!
-static int GenerateMipmaps(unsigned char *data, int baseWidth, int baseHeight)
+// NOTE: Only works with RGBA (4 bytes) data! Data is reallocated to fit mipmaps
+static int GenerateMipmaps(unsigned char **data, int baseWidth, int baseHeight)
 {
     int mipmapCount = 1;                // Required mipmap levels count (including base level)
     int width = baseWidth;
@@ -4479,7 +11005,7 @@ static int GenerateMipmaps(unsigned char *data, int baseWidth, int baseHeight)
     int size = baseWidth*baseHeight*4;  // Size in bytes (will include mipmaps...), RGBA only
 
     // Count mipmap levels required
-    while ((width != 1) && (height != 1))
+    while ((width != 1) || (height != 1))
     {
         if (width != 1) width /= 2;
         if (height != 1) height /= 2;
@@ -4494,106 +11020,35 @@ static int GenerateMipmaps(unsigned char *data, int baseWidth, int baseHeight)
     TraceLog(LOG_DEBUG, "Total mipmaps required: %i", mipmapCount);
     TraceLog(LOG_DEBUG, "Total size of data required: %i", size);
 
-    unsigned char *temp = RL_REALLOC(data, size);
+    unsigned char *temp = RL_REALLOC(*data, size);
 
-    if (temp != NULL) data = temp;
-    else TraceLog(LOG_WARNING, "Mipmaps required memory could not be allocated");
+    if (temp != NULL) *data = temp;
+    else
+    {
+        TraceLog(LOG_WARNING, "Mipmaps required memory could not be allocated");
+        return 1;
+    }
 
+    // Generate mipmaps
+    // NOTE: Every mipmap level is generated from previous level and stored after it
     width = baseWidth;
     height = baseHeight;
-    size = (width*height*4);
-
-    // Generate mipmaps
-    // NOTE: Every mipmap data is stored after data
-    Color *image = (Color *)RL_MALLOC(width*height*sizeof(Color));
-    Color *mipmap = NULL;
     int offset = 0;
-    int j = 0;
-
-    for (int i = 0; i < size; i += 4)
-    {
-        image[j].r = data[i];
-        image[j].g = data[i + 1];
-        image[j].b = data[i + 2];
-        image[j].a = data[i + 3];
-        j++;
-    }
-
-    TraceLog(LOG_DEBUG, "Mipmap base (%ix%i)", width, height);
 
     for (int mip = 1; mip < mipmapCount; mip++)
     {
-        mipmap = GenNextMipmap(image, width, height);
+        rlGenNextMipmap(*data + offset, width, height, 4, *data + offset + width*height*4);
 
         offset += (width*height*4); // Size of last mipmap
-        j = 0;
-
-        width /= 2;
-        height /= 2;
-        size = (width*height*4);    // Mipmap size to store after offset
 
-        // Add mipmap to data
-        for (int i = 0; i < size; i += 4)
-        {
-            data[offset + i] = mipmap[j].r;
-            data[offset + i + 1] = mipmap[j].g;
-            data[offset + i + 2] = mipmap[j].b;
-            data[offset + i + 3] = mipmap[j].a;
-            j++;
-        }
-
-        RL_FREE(image);
+        if (width != 1) width /= 2;
+        if (height != 1) height /= 2;
 
-        image = mipmap;
-        mipmap = NULL;
+        TraceLog(LOG_DEBUG, "Mipmap generated successfully (%ix%i)", width, height);
     }
 
-    RL_FREE(mipmap);       // free mipmap data
-
     return mipmapCount;
 }
-
-// Manual mipmap generation (basic scaling algorithm)
-static Color *GenNextMipmap(Color *srcData, int srcWidth, int srcHeight)
-{
-    int x2, y2;
-    Color prow, pcol;
-
-    int width = srcWidth/2;
-    int height = srcHeight/2;
-
-    Color *mipmap = (Color *)RL_MALLOC(width*height*sizeof(Color));
-
-    // Scaling algorithm works perfectly (box-filter)
-    for (int y = 0; y < height; y++)
-    {
-        y2 = 2*y;
-
-        for (int x = 0; x < width; x++)
-        {
-            x2 = 2*x;
-
-            prow.r = (srcData[y2*srcWidth + x2].r + srcData[y2*srcWidth + x2 + 1].r)/2;
-            prow.g = (srcData[y2*srcWidth + x2].g + srcData[y2*srcWidth + x2 + 1].g)/2;
-            prow.b = (srcData[y2*srcWidth + x2].b + srcData[y2*srcWidth + x2 + 1].b)/2;
-            prow.a = (srcData[y2*srcWidth + x2].a + srcData[y2*srcWidth + x2 + 1].a)/2;
-
-            pcol.r = (srcData[(y2+1)*srcWidth + x2].r + srcData[(y2+1)*srcWidth + x2 + 1].r)/2;
-            pcol.g = (srcData[(y2+1)*srcWidth + x2].g + srcData[(y2+1)*srcWidth + x2 + 1].g)/2;
-            pcol.b = (srcData[(y2+1)*srcWidth + x2].b + srcData[(y2+1)*srcWidth + x2 + 1].b)/2;
-            pcol.a = (srcData[(y2+1)*srcWidth + x2].a + srcData[(y2+1)*srcWidth + x2 + 1].a)/2;
-
-            mipmap[y*width + x].r = (prow.r + pcol.r)/2;
-            mipmap[y*width + x].g = (prow.g + pcol.g)/2;
-            mipmap[y*width + x].b = (prow.b + pcol.b)/2;
-            mipmap[y*width + x].a = (prow.a + pcol.a)/2;
-        }
-    }
-
-    TraceLog(LOG_DEBUG, "Mipmap generated successfully (%ix%i)", width, height);
-
-    return mipmap;
-}
 #endif
 
 #if defined(RLGL_STANDALONE)
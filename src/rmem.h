@@ -8,6 +8,9 @@
 *     - A quicker, efficient memory allocator alternative to 'malloc' and friends.
 *     - Reduce the possibilities of memory leaks for beginner developers using Raylib.
 *     - Being able to flexibly range check memory if necessary.
+*     - Predictable allocation latency: O(1) alloc and free with segregated size classes (TLSF) and coalescing.
+*     - Allocate from worker threads with a lock-free object pool and per-thread memory pool caches.
+*     - Reference objects safely by generational handles, with live objects packed for iteration.
 *
 *   CONFIGURATION:
 *
@@ -16,6 +19,10 @@
 *       If not defined, the library is in header only mode and can be included in other headers
 *       or source files without problems. But only ONE file should hold the implementation.
 *
+*   #define RMEMAPI
+*       Functions linkage, by default exported. Define it before including the library to keep
+*       an implementation internal to the including file (i.e. #define RMEMAPI static inline).
+*
 *
 *   LICENSE: zlib/libpng
 *
@@ -47,7 +54,9 @@
 //----------------------------------------------------------------------------------
 // Defines and Macros
 //----------------------------------------------------------------------------------
-#if defined(_WIN32) && defined(BUILD_LIBTYPE_SHARED)
+#if defined(RMEMAPI)
+    // Functions linkage defined by includer (i.e. static inline, to keep an implementation internal)
+#elif defined(_WIN32) && defined(BUILD_LIBTYPE_SHARED)
     #define RMEMAPI __declspec(dllexport)         // We are building library as a Win32 shared library (.dll)
 #elif defined(_WIN32) && defined(USE_LIBTYPE_SHARED)
     #define RMEMAPI __declspec(dllimport)         // We are using library as a Win32 shared library (.dll)
@@ -60,30 +69,30 @@
 //----------------------------------------------------------------------------------
 
 // Memory Pool
+// NOTE: Block sizes are pointer aligned, the two lowest bits of 'size' flag a free block and a free previous block
 typedef struct MemNode MemNode;
 struct MemNode {
     size_t size;
-    MemNode *next, *prev;
+    MemNode *next, *prev;       // Size class list links, only used by free blocks
 };
 
-typedef struct AllocList {
-    MemNode *head, *tail;
-    size_t len, maxNodes;
-    bool autoDefrag : 1;
-} AllocList;
-
 typedef struct Stack {
     uint8_t *mem, *base;
     size_t size;
 } Stack;
 
-#define MEMPOOL_BUCKET_SIZE    8
-#define MEMPOOL_BUCKET_BITS    3
+// Free blocks are kept in two-level segregated size classes (TLSF): a power of two
+// first level split into MEMPOOL_SL_COUNT linear second level classes
+#define MEMPOOL_FL_COUNT       32   // First level classes, block sizes up to 4 GB
+#define MEMPOOL_SL_BITS        3
+#define MEMPOOL_SL_COUNT       (1 << MEMPOOL_SL_BITS)
 
 typedef struct MemPool {
-    AllocList freeList;
     Stack stack;
-    MemNode *buckets[MEMPOOL_BUCKET_SIZE];
+    size_t freeNodes;                                       // Free blocks in the size classes
+    uint32_t flBitmap;                                      // First level classes with free blocks
+    uint8_t slBitmap[MEMPOOL_FL_COUNT];                     // Second level classes with free blocks
+    MemNode *buckets[MEMPOOL_FL_COUNT][MEMPOOL_SL_COUNT];   // Free blocks, per size class
 } MemPool;
 
 // Object Pool
@@ -99,6 +108,46 @@ typedef struct BiStack {
     size_t size;
 } BiStack;
 
+// Lock-free Object Pool, can be shared by threads
+typedef struct AtomicObjPool {
+    uint8_t *mem;
+    size_t objSize, len;
+    volatile uint64_t head;     // Free list head: ABA tag in the high 32 bits, block index + 1 in the low 32 bits (0 if empty)
+} AtomicObjPool;
+
+// Memory Pool shared by threads, guarded by a spin lock
+typedef struct SharedMemPool {
+    MemPool mempool;
+    volatile long lock;
+} SharedMemPool;
+
+#define MEMPOOL_CACHE_CLASSES    8      // Cached block sizes: 16, 32, 64 ... 2048 bytes
+#define MEMPOOL_CACHE_SIZE       32     // Cached blocks per size class
+#define MEMPOOL_CACHE_BATCH      16     // Blocks moved from/to the shared pool at once
+
+// Per-thread cache of Shared Memory Pool blocks, must only be used by one thread
+typedef struct MemPoolCache {
+    SharedMemPool *shared;
+    void *blocks[MEMPOOL_CACHE_CLASSES][MEMPOOL_CACHE_SIZE];
+    size_t counts[MEMPOOL_CACHE_CLASSES];
+} MemPoolCache;
+
+// Generational handles: slot index in the low bits, slot generation in the high bits (0 is never a valid handle)
+#define HANDLEPOOL_INDEX_BITS    20     // Up to 1M objects per pool, generations wrap every 4096 reuses of a slot
+#define HANDLEPOOL_INDEX_MASK    ((UINT32_C(1) << HANDLEPOOL_INDEX_BITS) - 1)
+
+// Handle Pool, objects referenced by generational handles
+// NOTE: Live objects are packed at the start of 'objects' ('count' objects, 'handles' holds their handles),
+// freeing an object moves the last one into its place
+typedef struct HandlePool {
+    uint8_t *objects;           // Objects storage, live objects are contiguous
+    uint32_t *handles;          // Handle of every live object (same order as objects)
+    uint32_t *slots;            // Object index of every slot, next free slot for free slots
+    uint32_t *generations;      // Generation of every slot, increased when its object is freed
+    size_t objSize, len, count;
+    uint32_t freeSlot;          // First free slot ('len' if pool is full)
+} HandlePool;
+
 #if defined(__cplusplus)
 extern "C" {            // Prevents name mangling of functions
 #endif
@@ -147,6 +196,45 @@ RMEMAPI void BiStackResetAll(BiStack *destack);
 
 RMEMAPI intptr_t BiStackMargins(BiStack destack);
 
+//------------------------------------------------------------------------------------
+// Functions Declaration - Lock-free Object Pool
+//------------------------------------------------------------------------------------
+RMEMAPI AtomicObjPool CreateAtomicObjPool(size_t objsize, size_t len);
+RMEMAPI void DestroyAtomicObjPool(AtomicObjPool *objpool);
+
+RMEMAPI void *AtomicObjPoolAlloc(AtomicObjPool *objpool);
+RMEMAPI void AtomicObjPoolFree(AtomicObjPool *objpool, void *ptr);
+RMEMAPI void AtomicObjPoolCleanUp(AtomicObjPool *objpool, void **ptrref);
+
+//------------------------------------------------------------------------------------
+// Functions Declaration - Shared Memory Pool and per-thread caches
+//------------------------------------------------------------------------------------
+RMEMAPI SharedMemPool CreateSharedMemPool(size_t bytes);
+RMEMAPI void DestroySharedMemPool(SharedMemPool *shared);
+
+RMEMAPI void *SharedMemPoolAlloc(SharedMemPool *shared, size_t bytes);
+RMEMAPI void SharedMemPoolFree(SharedMemPool *shared, void *ptr);
+
+RMEMAPI MemPoolCache CreateMemPoolCache(SharedMemPool *shared);
+RMEMAPI void DestroyMemPoolCache(MemPoolCache *cache);
+
+RMEMAPI void *MemPoolCacheAlloc(MemPoolCache *cache, size_t bytes);
+RMEMAPI void MemPoolCacheFree(MemPoolCache *cache, void *ptr);
+RMEMAPI void MemPoolCacheFlush(MemPoolCache *cache);
+
+//------------------------------------------------------------------------------------
+// Functions Declaration - Handle Pool
+//------------------------------------------------------------------------------------
+RMEMAPI HandlePool CreateHandlePool(size_t objsize, size_t len);
+RMEMAPI void DestroyHandlePool(HandlePool *handlepool);
+
+RMEMAPI uint32_t HandlePoolAlloc(HandlePool *handlepool);
+RMEMAPI void HandlePoolFree(HandlePool *handlepool, uint32_t handle);
+RMEMAPI void HandlePoolCleanUp(HandlePool *handlepool, uint32_t *handleref);
+
+RMEMAPI bool HandlePoolIsValid(const HandlePool *handlepool, uint32_t handle);
+RMEMAPI void *HandlePoolGet(const HandlePool *handlepool, uint32_t handle);
+
 #ifdef __cplusplus
 }
 #endif
@@ -177,6 +265,30 @@ RMEMAPI intptr_t BiStackMargins(BiStack destack);
     #endif
 #endif
 
+// Atomic operations, used by the lock-free object pool and the shared memory pool lock
+#if defined(_MSC_VER)
+    #include <intrin.h>             // Required for: _InterlockedCompareExchange64(), _InterlockedExchange()
+    #define RMEM_ATOMIC_CAS64(x, expected, desired) (_InterlockedCompareExchange64((__int64 volatile *)(x), (__int64)(desired), (__int64)(expected)) == (__int64)(expected))
+    #define RMEM_ATOMIC_LOCK(x)                     (_InterlockedExchange((long volatile *)(x), 1) == 0)
+    #define RMEM_ATOMIC_UNLOCK(x)                   _InterlockedExchange((long volatile *)(x), 0)
+#else
+    #define RMEM_ATOMIC_CAS64(x, expected, desired) __sync_bool_compare_and_swap((x), (expected), (desired))
+    #define RMEM_ATOMIC_LOCK(x)                     (__sync_lock_test_and_set((x), 1) == 0)
+    #define RMEM_ATOMIC_UNLOCK(x)                   __sync_lock_release(x)
+#endif
+
+// Give up the processor while spinning on a contended lock, the holder may have been preempted
+#if defined(_WIN32)
+    // NOTE: Declared here to avoid including windows.h
+    __declspec(dllimport) int __stdcall SwitchToThread(void);
+    #define RMEM_YIELD()                            SwitchToThread()
+#else
+    #include <sched.h>              // Required for: sched_yield()
+    #define RMEM_YIELD()                            sched_yield()
+#endif
+
+#define RMEM_SPIN_COUNT                             64      // Lock attempts before yielding
+
 //----------------------------------------------------------------------------------
 // Global Variables Definition
 //----------------------------------------------------------------------------------
@@ -190,6 +302,106 @@ static inline size_t __AlignSize(const size_t size, const size_t align)
     return (size + (align - 1)) & -align;
 }
 
+#define MEMNODE_FREE         ((size_t)1)     // MemNode size flag: the block is free
+#define MEMNODE_PREV_FREE    ((size_t)2)     // MemNode size flag: the previous block is free (its size is stored right before this block)
+
+static inline size_t __MemNodeSize(const MemNode *const node)
+{
+    return node->size & ~(MEMNODE_FREE | MEMNODE_PREV_FREE);
+}
+
+// Next block in memory, NULL for the last block of the pool
+static inline MemNode *__MemNodeNext(const MemPool *const mempool, const MemNode *const node)
+{
+    uint8_t *const next = (uint8_t *)node + __MemNodeSize(node);
+    return (next < mempool->stack.mem + mempool->stack.size)? (MemNode *)next : NULL;
+}
+
+static inline size_t __Log2(size_t value)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return (sizeof(size_t)*8 - 1) - (size_t)((sizeof(size_t) == sizeof(unsigned long long))? __builtin_clzll(value) : __builtin_clz(value));
+#else
+    size_t result = 0;
+    while (value >>= 1) result++;
+    return result;
+#endif
+}
+
+static inline size_t __FindFirstSet(const uint32_t value)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return (size_t)__builtin_ctz(value);
+#else
+    size_t result = 0;
+    while (!(value & (1u << result))) result++;
+    return result;
+#endif
+}
+
+// Size class of a block size, first level is the power of two, second level the linear subdivision
+static inline void __MemPoolMapping(const size_t size, size_t *const fl, size_t *const sl)
+{
+    *fl = __Log2(size);
+    *sl = (size >> (*fl - MEMPOOL_SL_BITS)) ^ MEMPOOL_SL_COUNT;
+}
+
+static inline void __MemPoolInsertNode(MemPool *const mempool, MemNode *const node)
+{
+    size_t fl, sl;
+    const size_t SIZE = __MemNodeSize(node);
+    MemNode *const next = __MemNodeNext(mempool, node);
+
+    __MemPoolMapping(SIZE, &fl, &sl);
+    node->size |= MEMNODE_FREE;
+    node->prev = NULL;
+    node->next = mempool->buckets[fl][sl];
+    if (node->next != NULL) node->next->prev = node;
+    mempool->buckets[fl][sl] = node;
+    mempool->flBitmap |= 1u << fl;
+    mempool->slBitmap[fl] |= 1u << sl;
+    mempool->freeNodes++;
+
+    // Footer, lets the next block find this one when coalescing.
+    *(size_t *)((uint8_t *)node + SIZE - sizeof(size_t)) = SIZE;
+    if (next != NULL) next->size |= MEMNODE_PREV_FREE;
+}
+
+static inline void __MemPoolRemoveNode(MemPool *const mempool, MemNode *const node)
+{
+    size_t fl, sl;
+
+    __MemPoolMapping(__MemNodeSize(node), &fl, &sl);
+    (node->prev != NULL)? (node->prev->next = node->next) : (mempool->buckets[fl][sl] = node->next);
+    if (node->next != NULL) node->next->prev = node->prev;
+    if (mempool->buckets[fl][sl] == NULL)
+    {
+        mempool->slBitmap[fl] &= ~(1u << sl);
+        if (mempool->slBitmap[fl] == 0) mempool->flBitmap &= ~(1u << fl);
+    }
+    node->next = node->prev = NULL;
+    mempool->freeNodes--;
+}
+
+static inline void __LockSharedMemPool(SharedMemPool *const shared)
+{
+    for (int spin = 0; !RMEM_ATOMIC_LOCK(&shared->lock); spin++)
+    {
+        if (spin >= RMEM_SPIN_COUNT) { RMEM_YIELD(); spin = 0; }
+    }
+}
+
+static inline void __UnlockSharedMemPool(SharedMemPool *const shared)
+{
+    RMEM_ATOMIC_UNLOCK(&shared->lock);
+}
+
+// Payload size of the memory pool cache blocks of class 'index'
+static inline size_t __MemPoolCacheClassSize(const size_t index)
+{
+    return (size_t)16 << index;
+}
+
 //----------------------------------------------------------------------------------
 // Module Functions Definition - Memory Pool
 //----------------------------------------------------------------------------------
@@ -198,11 +410,11 @@ MemPool CreateMemPool(const size_t size)
 {
     MemPool mempool = { 0 };
 
-    if (size == 0UL) return mempool;
+    if ((size <= sizeof(MemNode)) || (size >= UINT32_MAX)) return mempool;
     else
     {
-        // Align the mempool size to at least the size of an alloc node.
-        mempool.stack.size = size;
+        // Keep the stack base aligned, blocks are allocated downwards from it.
+        mempool.stack.size = size & ~(sizeof(intptr_t) - 1);
         mempool.stack.mem = malloc(mempool.stack.size*sizeof *mempool.stack.mem);
 
         if (mempool.stack.mem==NULL)
@@ -222,10 +434,10 @@ MemPool CreateMemPoolFromBuffer(void *buf, const size_t size)
 {
     MemPool mempool = { 0 };
 
-    if ((size == 0UL) || (buf == NULL) || (size <= sizeof(MemNode))) return mempool;
+    if ((size == 0UL) || (buf == NULL) || (size <= sizeof(MemNode)) || (size >= UINT32_MAX)) return mempool;
     else
     {
-        mempool.stack.size = size;
+        mempool.stack.size = size & ~(sizeof(intptr_t) - 1);
         mempool.stack.mem = buf;
         mempool.stack.base = mempool.stack.mem + mempool.stack.size;
         return mempool;
@@ -249,45 +461,42 @@ void *MemPoolAlloc(MemPool *const mempool, const size_t size)
     {
         MemNode *new_mem = NULL;
         const size_t ALLOC_SIZE = __AlignSize(size + sizeof *new_mem, sizeof(intptr_t));
-        const size_t BUCKET_INDEX = (ALLOC_SIZE >> MEMPOOL_BUCKET_BITS) - 1;
+        size_t fl, sl;
 
-        // If the size is small enough, let's check if our buckets has a fitting memory block.
-        if (BUCKET_INDEX < MEMPOOL_BUCKET_SIZE && mempool->buckets[BUCKET_INDEX] != NULL && mempool->buckets[BUCKET_INDEX]->size >= ALLOC_SIZE)
-        {
-            new_mem = mempool->buckets[BUCKET_INDEX];
-            mempool->buckets[BUCKET_INDEX] = mempool->buckets[BUCKET_INDEX]->next;
-            if( mempool->buckets[BUCKET_INDEX] != NULL )
-                mempool->buckets[BUCKET_INDEX]->prev = NULL;
-        }
-        else if (mempool->freeList.head != NULL)
+        // Find the smallest size class holding blocks that all fit, O(1) with the bitmaps.
+        __MemPoolMapping(ALLOC_SIZE + ((size_t)1 << (__Log2(ALLOC_SIZE) - MEMPOOL_SL_BITS)) - 1, &fl, &sl);
+        if (fl < MEMPOOL_FL_COUNT)
         {
-            const size_t MEM_SPLIT_THRESHOLD = 16;
-
-            // If the freelist is valid, let's allocate FROM the freelist then!
-            for (MemNode *inode = mempool->freeList.head; inode != NULL; inode = inode->next)
+            uint32_t sl_map = mempool->slBitmap[fl] & (~0u << sl);
+            if (sl_map == 0)
             {
-                if (inode->size < ALLOC_SIZE) continue;
-                else if (inode->size <= (ALLOC_SIZE + MEM_SPLIT_THRESHOLD))
+                const uint32_t fl_map = (fl + 1 < MEMPOOL_FL_COUNT)? (mempool->flBitmap & (~0u << (fl + 1))) : 0;
+                if (fl_map != 0)
                 {
-                    // Close in size - reduce fragmentation by not splitting.
-                    new_mem = inode;
-                    (inode->prev != NULL)? (inode->prev->next = inode->next) : (mempool->freeList.head = inode->next);
-                    (inode->next != NULL)? (inode->next->prev = inode->prev) : (mempool->freeList.tail = inode->prev);
+                    fl = __FindFirstSet(fl_map);
+                    sl_map = mempool->slBitmap[fl];
+                }
+            }
+            if (sl_map != 0)
+            {
+                new_mem = mempool->buckets[fl][__FindFirstSet(sl_map)];
+                __MemPoolRemoveNode(mempool, new_mem);
 
-                    if (mempool->freeList.head != NULL) mempool->freeList.head->prev = NULL;
-                    else mempool->freeList.tail = NULL;
+                MemNode *const next = __MemNodeNext(mempool, new_mem);
+                const size_t NODE_SIZE = __MemNodeSize(new_mem);
 
-                    if (mempool->freeList.tail != NULL) mempool->freeList.tail->next = NULL;
-                    mempool->freeList.len--;
-                    break;
+                // Split the block, the remainder goes back to its size class.
+                if (NODE_SIZE - ALLOC_SIZE >= sizeof(MemNode) + sizeof(size_t))
+                {
+                    MemNode *const rest = (MemNode *)((uint8_t *)new_mem + ALLOC_SIZE);
+                    new_mem->size = ALLOC_SIZE | (new_mem->size & MEMNODE_PREV_FREE);
+                    rest->size = NODE_SIZE - ALLOC_SIZE;
+                    __MemPoolInsertNode(mempool, rest);
                 }
                 else
                 {
-                    // Split the memory chunk.
-                    new_mem = (MemNode *)((uint8_t *)inode + (inode->size - ALLOC_SIZE));
-                    inode->size -= ALLOC_SIZE;
-                    new_mem->size = ALLOC_SIZE;
-                    break;
+                    new_mem->size &= ~MEMNODE_FREE;
+                    if (next != NULL) next->size &= ~MEMNODE_PREV_FREE;
                 }
             }
         }
@@ -298,7 +507,7 @@ void *MemPoolAlloc(MemPool *const mempool, const size_t size)
             if ((mempool->stack.base - ALLOC_SIZE) < mempool->stack.mem) return NULL;
             else
             {
-                // Couldn't allocate from a freelist, allocate from available mempool.
+                // Couldn't allocate from the size classes, allocate from available mempool.
                 // Subtract allocation size from the mempool.
                 mempool->stack.base -= ALLOC_SIZE;
 
@@ -320,7 +529,7 @@ void *MemPoolAlloc(MemPool *const mempool, const size_t size)
         // --------------
         new_mem->next = new_mem->prev = NULL;
         uint8_t *const final_mem = (uint8_t *)new_mem + sizeof *new_mem;
-        return memset(final_mem, 0, new_mem->size - sizeof *new_mem);
+        return memset(final_mem, 0, __MemNodeSize(new_mem) - sizeof *new_mem);
     }
 }
 
@@ -340,7 +549,7 @@ void *MemPoolRealloc(MemPool *const restrict mempool, void *ptr, const size_t si
         else
         {
             MemNode *const resized = (MemNode *)(resized_block - sizeof *resized);
-            memmove(resized_block, ptr, (node->size > resized->size)? (resized->size - NODE_SIZE) : (node->size - NODE_SIZE));
+            memmove(resized_block, ptr, (__MemNodeSize(node) > __MemNodeSize(resized))? (__MemNodeSize(resized) - NODE_SIZE) : (__MemNodeSize(node) - NODE_SIZE));
             MemPoolFree(mempool, ptr);
             return resized_block;
         }
@@ -353,59 +562,46 @@ void MemPoolFree(MemPool *const restrict mempool, void *ptr)
     else
     {
         // Behind the actual pointer data is the allocation info.
-        MemNode *const mem_node = (MemNode *)((uint8_t *)ptr - sizeof *mem_node);
-        const size_t BUCKET_INDEX = (mem_node->size >> MEMPOOL_BUCKET_BITS) - 1;
+        MemNode *mem_node = (MemNode *)((uint8_t *)ptr - sizeof *mem_node);
+        size_t size = __MemNodeSize(mem_node);
 
-        // Make sure the pointer data is valid.
+        // Make sure the pointer data is valid, the free flag also catches double frees.
         if (((uintptr_t)mem_node < (uintptr_t)mempool->stack.base) ||
             (((uintptr_t)mem_node - (uintptr_t)mempool->stack.mem) > mempool->stack.size) ||
-            (mem_node->size == 0UL) ||
-            (mem_node->size > mempool->stack.size)) return;
-        // If the mem_node is right at the stack base ptr, then add it to the stack.
-        else if ((uintptr_t)mem_node == (uintptr_t)mempool->stack.base)
+            (size == 0UL) ||
+            (size > mempool->stack.size) ||
+            (mem_node->size & MEMNODE_FREE)) return;
+
+        // Flag the header before it gets merged, a stale pointer into a coalesced block is still caught.
+        mem_node->size |= MEMNODE_FREE;
+
+        // Coalesce with the next block and the previous block if they are free.
+        MemNode *next = __MemNodeNext(mempool, mem_node);
+        if ((next != NULL) && (next->size & MEMNODE_FREE))
         {
-            mempool->stack.base += mem_node->size;
+            __MemPoolRemoveNode(mempool, next);
+            size += __MemNodeSize(next);
+            next = __MemNodeNext(mempool, next);
         }
-        // attempted stack merge failed, try to place it into the memnode buckets
-        else if (BUCKET_INDEX < MEMPOOL_BUCKET_SIZE)
+        if (mem_node->size & MEMNODE_PREV_FREE)
         {
-            if (mempool->buckets[BUCKET_INDEX] == NULL) mempool->buckets[BUCKET_INDEX] = mem_node;
-            else
-            {
-                for (MemNode *n = mempool->buckets[BUCKET_INDEX]; n != NULL; n = n->next) if( n==mem_node ) return;
-                mempool->buckets[BUCKET_INDEX]->prev = mem_node;
-                mem_node->next = mempool->buckets[BUCKET_INDEX];
-                mempool->buckets[BUCKET_INDEX] = mem_node;
-            }
+            MemNode *const prev = (MemNode *)((uint8_t *)mem_node - *((size_t *)mem_node - 1));
+            __MemPoolRemoveNode(mempool, prev);
+            size += __MemNodeSize(prev);
+            mem_node = prev;
         }
-        // Otherwise, we add it to the free list.
-        // We also check if the freelist already has the pointer so we can prevent double frees.
-        else /*if ((mempool->freeList.len == 0UL) || ((uintptr_t)mempool->freeList.head >= (uintptr_t)mempool->stack.mem && (uintptr_t)mempool->freeList.head - (uintptr_t)mempool->stack.mem < mempool->stack.size))*/
-        {
-            for (MemNode *n = mempool->freeList.head; n != NULL; n = n->next) if (n == mem_node) return;
-
-            // This code insertion sorts where largest size is last.
-            if (mempool->freeList.head == NULL)
-            {
-                mempool->freeList.head = mempool->freeList.tail = mem_node;
-                mempool->freeList.len++;
-            }
-            else if (mempool->freeList.head->size >= mem_node->size)
-            {
-                mem_node->next = mempool->freeList.head;
-                mem_node->next->prev = mem_node;
-                mempool->freeList.head = mem_node;
-                mempool->freeList.len++;
-            }
-            else //if (mempool->freeList.tail->size <= mem_node->size)
-            {
-                mem_node->prev = mempool->freeList.tail;
-                mempool->freeList.tail->next = mem_node;
-                mempool->freeList.tail = mem_node;
-                mempool->freeList.len++;
-            }
 
-            if (mempool->freeList.autoDefrag && (mempool->freeList.maxNodes != 0UL) && (mempool->freeList.len > mempool->freeList.maxNodes)) MemPoolDefrag(mempool);
+        // If the mem_node is right at the stack base ptr, then give it back to the stack.
+        if ((uintptr_t)mem_node == (uintptr_t)mempool->stack.base)
+        {
+            mempool->stack.base += size;
+            if (next != NULL) next->size &= ~MEMNODE_PREV_FREE;
+        }
+        // Otherwise, we add it to its size class.
+        else
+        {
+            mem_node->size = size;
+            __MemPoolInsertNode(mempool, mem_node);
         }
     }
 }
@@ -424,9 +620,10 @@ size_t GetMemPoolFreeMemory(const MemPool mempool)
 {
     size_t total_remaining = (uintptr_t)mempool.stack.base - (uintptr_t)mempool.stack.mem;
 
-    for (MemNode *n=mempool.freeList.head; n != NULL; n = n->next) total_remaining += n->size;
-
-    for (size_t i=0; i<MEMPOOL_BUCKET_SIZE; i++) for (MemNode *n = mempool.buckets[i]; n != NULL; n = n->next) total_remaining += n->size;
+    for (size_t fl=0; fl<MEMPOOL_FL_COUNT; fl++)
+    {
+        for (size_t sl=0; sl<MEMPOOL_SL_COUNT; sl++) for (MemNode *n = mempool.buckets[fl][sl]; n != NULL; n = n->next) total_remaining += __MemNodeSize(n);
+    }
 
     return total_remaining;
 }
@@ -434,137 +631,33 @@ size_t GetMemPoolFreeMemory(const MemPool mempool)
 void MemPoolReset(MemPool *const mempool)
 {
     if (mempool == NULL) return;
-    mempool->freeList.head = mempool->freeList.tail = NULL;
-    mempool->freeList.len = 0;
-    for (size_t i = 0; i < MEMPOOL_BUCKET_SIZE; i++) mempool->buckets[i] = NULL;
+    mempool->freeNodes = 0;
+    mempool->flBitmap = 0;
+    memset(mempool->slBitmap, 0, sizeof(mempool->slBitmap));
+    memset(mempool->buckets, 0, sizeof(mempool->buckets));
     mempool->stack.base = mempool->stack.mem + mempool->stack.size;
 }
 
+// NOTE: Free blocks are coalesced on free, so defragmenting only resets a fully released pool.
 bool MemPoolDefrag(MemPool *const mempool)
 {
     if (mempool == NULL) return false;
     else
     {
         // If the memory pool has been entirely released, fully defrag it.
-        if (mempool->stack.size == GetMemPoolFreeMemory(*mempool))
+        if ((mempool->freeNodes != 0UL) && (mempool->stack.size == GetMemPoolFreeMemory(*mempool)))
         {
             MemPoolReset(mempool);
             return true;
         }
-        else
-        {
-            for (size_t i=0; i<MEMPOOL_BUCKET_SIZE; i++)
-            {
-                while (mempool->buckets[i] != NULL)
-                {
-                    if ((uintptr_t)mempool->buckets[i] == (uintptr_t)mempool->stack.base)
-                    {
-                        mempool->stack.base += mempool->buckets[i]->size;
-                        mempool->buckets[i]->size = 0;
-                        mempool->buckets[i] = mempool->buckets[i]->next;
-                        if (mempool->buckets[i] != NULL) mempool->buckets[i]->prev = NULL;
-                    }
-                    else break;
-                }
-            }
-
-            const size_t PRE_DEFRAG_LEN = mempool->freeList.len;
-            MemNode **node = &mempool->freeList.head;
-
-            while (*node != NULL)
-            {
-                if ((uintptr_t)*node == (uintptr_t)mempool->stack.base)
-                {
-                    // If node is right at the stack, merge it back into the stack.
-                    mempool->stack.base += (*node)->size;
-                    (*node)->size = 0UL;
-                    ((*node)->prev != NULL)? ((*node)->prev->next = (*node)->next) : (mempool->freeList.head = (*node)->next);
-                    ((*node)->next != NULL)? ((*node)->next->prev = (*node)->prev) : (mempool->freeList.tail = (*node)->prev);
-
-                    if (mempool->freeList.head != NULL) mempool->freeList.head->prev = NULL;
-                    else mempool->freeList.tail = NULL;
-
-                    if (mempool->freeList.tail != NULL) mempool->freeList.tail->next = NULL;
-                    mempool->freeList.len--;
-                    node = &mempool->freeList.head;
-                }
-                else if (((uintptr_t)*node + (*node)->size) == (uintptr_t)(*node)->next)
-                {
-                    // Next node is at a higher address.
-                    (*node)->size += (*node)->next->size;
-                    (*node)->next->size = 0UL;
-
-                    // <-[P Curr N]-> <-[P Next N]-> <-[P NextNext N]->
-                    //
-                    //           |--------------------|
-                    // <-[P Curr N]-> <-[P Next N]-> [P NextNext N]->
-                    if ((*node)->next->next != NULL) (*node)->next->next->prev = *node;
-
-                    // <-[P Curr N]-> <-[P NextNext N]->
-                    (*node)->next = (*node)->next->next;
-
-                    mempool->freeList.len--;
-                    node = &mempool->freeList.head;
-                }
-                else if ((((uintptr_t)*node + (*node)->size) == (uintptr_t)(*node)->prev) && ((*node)->prev->prev != NULL))
-                {
-                    // Prev node is at a higher address.
-                    (*node)->size += (*node)->prev->size;
-                    (*node)->prev->size = 0UL;
-
-                    // <-[P PrevPrev N]-> <-[P Prev N]-> <-[P Curr N]->
-                    //
-                    //               |--------------------|
-                    // <-[P PrevPrev N] <-[P Prev N]-> <-[P Curr N]->
-                    (*node)->prev->prev->next = *node;
-
-                    // <-[P PrevPrev N]-> <-[P Curr N]->
-                    (*node)->prev = (*node)->prev->prev;
-
-                    mempool->freeList.len--;
-                    node = &mempool->freeList.head;
-                }
-                else if ((*node)->prev != NULL && (*node)->next != NULL && (uintptr_t)*node - (*node)->next->size == (uintptr_t)(*node)->next)
-                {
-                    // Next node is at a lower address.
-                    (*node)->next->size += (*node)->size;
-
-                    (*node)->size = 0UL;
-                    (*node)->next->prev = (*node)->prev;
-                    (*node)->prev->next = (*node)->next;
-                    *node = (*node)->next;
-
-                    mempool->freeList.len--;
-                    node = &mempool->freeList.head;
-                }
-                else if ((*node)->prev != NULL && (*node)->next != NULL && (uintptr_t)*node - (*node)->prev->size == (uintptr_t)(*node)->prev)
-                {
-                    // Prev node is at a lower address.
-                    (*node)->prev->size += (*node)->size;
-
-                    (*node)->size = 0UL;
-                    (*node)->next->prev = (*node)->prev;
-                    (*node)->prev->next = (*node)->next;
-                    *node = (*node)->prev;
-
-                    mempool->freeList.len--;
-                    node = &mempool->freeList.head;
-                }
-                else
-                {
-                    node = &(*node)->next;
-                }
-            }
-
-            return PRE_DEFRAG_LEN > mempool->freeList.len;
-        }
+        return false;
     }
 }
 
+// NOTE: Kept for compatibility, free blocks are always coalesced.
 void ToggleMemPoolAutoDefrag(MemPool *const mempool)
 {
-    if (mempool == NULL) return;
-    else mempool->freeList.autoDefrag ^= true;
+    (void)mempool;
 }
 
 //----------------------------------------------------------------------------------
@@ -771,4 +864,345 @@ intptr_t BiStackMargins(const BiStack destack)
     return destack.back - destack.front;
 }
 
+//----------------------------------------------------------------------------------
+// Module Functions Definition - Lock-free Object Pool
+//----------------------------------------------------------------------------------
+AtomicObjPool CreateAtomicObjPool(const size_t objsize, const size_t len)
+{
+    AtomicObjPool objpool = { 0 };
+
+    // Block indices are stored in 32 bits, next to the ABA tag.
+    if ((len == 0UL) || (objsize == 0UL) || (len >= UINT32_MAX)) return objpool;
+    else
+    {
+        objpool.objSize = __AlignSize(objsize, sizeof(size_t));
+        objpool.mem = calloc(len, objpool.objSize);
+
+        if (objpool.mem == NULL) return objpool;
+        else
+        {
+            // Every free block holds the index + 1 of the next free block, 0 terminates the list.
+            for (size_t i=0; i<len; i++)
+            {
+                union ObjInfo block = { .byte = &objpool.mem[i*objpool.objSize] };
+                *block.index = (i + 1 < len)? i + 2 : 0;
+            }
+
+            objpool.len = len;
+            objpool.head = 1;
+            return objpool;
+        }
+    }
+}
+
+void DestroyAtomicObjPool(AtomicObjPool *const objpool)
+{
+    if ((objpool == NULL) || (objpool->mem == NULL)) return;
+    else
+    {
+        free(objpool->mem);
+        *objpool = (AtomicObjPool){0};
+    }
+}
+
+void *AtomicObjPoolAlloc(AtomicObjPool *const objpool)
+{
+    if (objpool == NULL) return NULL;
+    else
+    {
+        uint64_t head, next;
+        uint8_t *block;
+
+        // NOTE: The popped block may be reused by another thread before the CAS,
+        // the next index read is then stale but the CAS fails as the tag changed.
+        do
+        {
+            head = objpool->head;
+            if ((uint32_t)head == 0) return NULL;
+
+            block = objpool->mem + ((uint32_t)head - 1)*objpool->objSize;
+            next = ((head >> 32) + 1) << 32 | (uint32_t)*(volatile size_t *)block;
+        } while (!RMEM_ATOMIC_CAS64(&objpool->head, head, next));
+
+        return memset(block, 0, objpool->objSize);
+    }
+}
+
+void AtomicObjPoolFree(AtomicObjPool *const restrict objpool, void *ptr)
+{
+    union ObjInfo p = { .byte = ptr };
+    if ((objpool == NULL) || (ptr == NULL) || (p.byte < objpool->mem) || (p.byte >= objpool->mem + objpool->len*objpool->objSize) ||
+        (((p.byte - objpool->mem) % objpool->objSize) != 0)) return;
+    else
+    {
+        const uint64_t INDEX = (uint64_t)(p.byte - objpool->mem)/objpool->objSize;
+        uint64_t head, next;
+
+        do
+        {
+            head = objpool->head;
+            *p.index = (uint32_t)head;
+            next = ((head >> 32) + 1) << 32 | (INDEX + 1);
+        } while (!RMEM_ATOMIC_CAS64(&objpool->head, head, next));
+    }
+}
+
+void AtomicObjPoolCleanUp(AtomicObjPool *const restrict objpool, void **ptrref)
+{
+    if ((objpool == NULL) || (ptrref == NULL) || (*ptrref == NULL)) return;
+    else
+    {
+        AtomicObjPoolFree(objpool, *ptrref);
+        *ptrref = NULL;
+    }
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition - Shared Memory Pool and per-thread caches
+//----------------------------------------------------------------------------------
+SharedMemPool CreateSharedMemPool(const size_t size)
+{
+    SharedMemPool shared = { 0 };
+    shared.mempool = CreateMemPool(size);
+    return shared;
+}
+
+void DestroySharedMemPool(SharedMemPool *const shared)
+{
+    if (shared == NULL) return;
+    else
+    {
+        DestroyMemPool(&shared->mempool);
+        shared->lock = 0;
+    }
+}
+
+void *SharedMemPoolAlloc(SharedMemPool *const shared, const size_t size)
+{
+    if (shared == NULL) return NULL;
+    else
+    {
+        __LockSharedMemPool(shared);
+        void *const ptr = MemPoolAlloc(&shared->mempool, size);
+        __UnlockSharedMemPool(shared);
+        return ptr;
+    }
+}
+
+void SharedMemPoolFree(SharedMemPool *const restrict shared, void *ptr)
+{
+    if ((shared == NULL) || (ptr == NULL)) return;
+    else
+    {
+        __LockSharedMemPool(shared);
+        MemPoolFree(&shared->mempool, ptr);
+        __UnlockSharedMemPool(shared);
+    }
+}
+
+MemPoolCache CreateMemPoolCache(SharedMemPool *const shared)
+{
+    MemPoolCache cache = { 0 };
+    cache.shared = shared;
+    return cache;
+}
+
+void DestroyMemPoolCache(MemPoolCache *const cache)
+{
+    if (cache == NULL) return;
+    else
+    {
+        MemPoolCacheFlush(cache);
+        *cache = (MemPoolCache){ 0 };
+    }
+}
+
+void *MemPoolCacheAlloc(MemPoolCache *const cache, const size_t size)
+{
+    if ((cache == NULL) || (cache->shared == NULL) || (size == 0UL)) return NULL;
+    else
+    {
+        size_t index = 0;
+        while ((index < MEMPOOL_CACHE_CLASSES) && (__MemPoolCacheClassSize(index) < size)) index++;
+
+        // Too large to be cached, allocate straight from the shared pool.
+        if (index == MEMPOOL_CACHE_CLASSES) return SharedMemPoolAlloc(cache->shared, size);
+
+        // Refill the size class with a batch of blocks, taking the lock once.
+        if (cache->counts[index] == 0UL)
+        {
+            __LockSharedMemPool(cache->shared);
+            while (cache->counts[index] < MEMPOOL_CACHE_BATCH)
+            {
+                void *const block = MemPoolAlloc(&cache->shared->mempool, __MemPoolCacheClassSize(index));
+                if (block == NULL) break;
+                cache->blocks[index][cache->counts[index]++] = block;
+            }
+            __UnlockSharedMemPool(cache->shared);
+
+            if (cache->counts[index] == 0UL) return NULL;
+        }
+
+        void *const ptr = cache->blocks[index][--cache->counts[index]];
+        return memset(ptr, 0, __MemPoolCacheClassSize(index));
+    }
+}
+
+void MemPoolCacheFree(MemPoolCache *const restrict cache, void *ptr)
+{
+    if ((cache == NULL) || (cache->shared == NULL) || (ptr == NULL)) return;
+    else
+    {
+        // The block may be larger than requested, cache it in the largest class it fits.
+        const MemNode *const node = (const MemNode *)((uint8_t *)ptr - sizeof *node);
+        const size_t CAPACITY = __MemNodeSize(node) - sizeof *node;
+        size_t index = MEMPOOL_CACHE_CLASSES;
+
+        while ((index > 0) && (__MemPoolCacheClassSize(index - 1) > CAPACITY)) index--;
+
+        if ((index == 0) || (CAPACITY >= 2*__MemPoolCacheClassSize(MEMPOOL_CACHE_CLASSES - 1)))
+        {
+            SharedMemPoolFree(cache->shared, ptr);
+            return;
+        }
+        index--;
+
+        // Return a batch of blocks to the shared pool once the size class is full, taking the lock once.
+        if (cache->counts[index] == MEMPOOL_CACHE_SIZE)
+        {
+            __LockSharedMemPool(cache->shared);
+            for (size_t i=0; i<MEMPOOL_CACHE_BATCH; i++) MemPoolFree(&cache->shared->mempool, cache->blocks[index][--cache->counts[index]]);
+            __UnlockSharedMemPool(cache->shared);
+        }
+        cache->blocks[index][cache->counts[index]++] = ptr;
+    }
+}
+
+void MemPoolCacheFlush(MemPoolCache *const cache)
+{
+    if ((cache == NULL) || (cache->shared == NULL)) return;
+    else
+    {
+        __LockSharedMemPool(cache->shared);
+        for (size_t i=0; i<MEMPOOL_CACHE_CLASSES; i++)
+        {
+            while (cache->counts[i] > 0UL) MemPoolFree(&cache->shared->mempool, cache->blocks[i][--cache->counts[i]]);
+        }
+        __UnlockSharedMemPool(cache->shared);
+    }
+}
+
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition - Handle Pool
+//----------------------------------------------------------------------------------
+HandlePool CreateHandlePool(const size_t objsize, const size_t len)
+{
+    HandlePool handlepool = { 0 };
+
+    if ((len == 0UL) || (objsize == 0UL) || (len > HANDLEPOOL_INDEX_MASK)) return handlepool;
+    else
+    {
+        // Objects and slots arrays are allocated in one block, objects first to keep their alignment.
+        const size_t OBJSIZE = __AlignSize(objsize, sizeof(size_t));
+        uint8_t *const mem = calloc(1, len*OBJSIZE + 3*len*sizeof(uint32_t));
+        if (mem == NULL) return handlepool;
+
+        handlepool.objects = mem;
+        handlepool.handles = (uint32_t *)(mem + len*OBJSIZE);
+        handlepool.slots = handlepool.handles + len;
+        handlepool.generations = handlepool.slots + len;
+        handlepool.objSize = OBJSIZE;
+        handlepool.len = len;
+
+        for (size_t i=0; i<len; i++)
+        {
+            handlepool.slots[i] = (uint32_t)(i + 1);
+            handlepool.generations[i] = 1;
+        }
+
+        return handlepool;
+    }
+}
+
+void DestroyHandlePool(HandlePool *const handlepool)
+{
+    if ((handlepool == NULL) || (handlepool->objects == NULL)) return;
+    else
+    {
+        free(handlepool->objects);
+        *handlepool = (HandlePool){0};
+    }
+}
+
+uint32_t HandlePoolAlloc(HandlePool *const handlepool)
+{
+    if ((handlepool == NULL) || (handlepool->count == handlepool->len)) return 0;
+    else
+    {
+        const uint32_t slot = handlepool->freeSlot;
+        const size_t index = handlepool->count++;
+
+        handlepool->freeSlot = handlepool->slots[slot];
+        handlepool->slots[slot] = (uint32_t)index;
+        handlepool->handles[index] = (handlepool->generations[slot] << HANDLEPOOL_INDEX_BITS) | slot;
+
+        memset(handlepool->objects + index*handlepool->objSize, 0, handlepool->objSize);
+        return handlepool->handles[index];
+    }
+}
+
+void HandlePoolFree(HandlePool *const handlepool, const uint32_t handle)
+{
+    if (!HandlePoolIsValid(handlepool, handle)) return;
+    else
+    {
+        const uint32_t slot = handle & HANDLEPOOL_INDEX_MASK;
+        const size_t index = handlepool->slots[slot];
+        const size_t last = --handlepool->count;
+
+        // Keep live objects packed: last object takes the place of the freed one.
+        if (index != last)
+        {
+            memcpy(handlepool->objects + index*handlepool->objSize, handlepool->objects + last*handlepool->objSize, handlepool->objSize);
+            handlepool->handles[index] = handlepool->handles[last];
+            handlepool->slots[handlepool->handles[index] & HANDLEPOOL_INDEX_MASK] = (uint32_t)index;
+        }
+
+        // Outstanding handles to the slot become invalid, generation 0 is skipped so no handle is 0.
+        handlepool->generations[slot] = (handlepool->generations[slot] + 1) & (UINT32_MAX >> HANDLEPOOL_INDEX_BITS);
+        if (handlepool->generations[slot] == 0) handlepool->generations[slot] = 1;
+
+        handlepool->slots[slot] = handlepool->freeSlot;
+        handlepool->freeSlot = slot;
+    }
+}
+
+void HandlePoolCleanUp(HandlePool *const restrict handlepool, uint32_t *const handleref)
+{
+    if ((handlepool == NULL) || (handleref == NULL) || (*handleref == 0)) return;
+    else
+    {
+        HandlePoolFree(handlepool, *handleref);
+        *handleref = 0;
+    }
+}
+
+bool HandlePoolIsValid(const HandlePool *const handlepool, const uint32_t handle)
+{
+    if ((handlepool == NULL) || (handle == 0)) return false;
+    else
+    {
+        // Free slots hold the next free slot, a handle is only valid if its live object points back to it.
+        const uint32_t slot = handle & HANDLEPOOL_INDEX_MASK;
+        return (slot < handlepool->len) && (handlepool->slots[slot] < handlepool->count) && (handlepool->handles[handlepool->slots[slot]] == handle);
+    }
+}
+
+void *HandlePoolGet(const HandlePool *const handlepool, const uint32_t handle)
+{
+    if (!HandlePoolIsValid(handlepool, handle)) return NULL;
+    else return handlepool->objects + handlepool->slots[handle & HANDLEPOOL_INDEX_MASK]*handlepool->objSize;
+}
+
 #endif  // RMEM_IMPLEMENTATION
@@ -154,6 +154,7 @@ typedef int socklen_t;
     #include <netinet/tcp.h>
     #include <sys/socket.h>
     #include <arpa/inet.h>
+    #include <errno.h>
 #endif
 
 #ifndef INVALID_SOCKET
@@ -165,6 +166,9 @@ typedef int socklen_t;
     #define SOCKET int
     #define INVALID_SOCKET -1
     #define SOCKET_ERROR -1
+    #define WSAEINTR EINTR
+    #define WSAEWOULDBLOCK EWOULDBLOCK
+    #define WSAEINPROGRESS EINPROGRESS
 #endif
 
 #ifdef __USE_W32_SOCKETS
@@ -179,10 +183,32 @@ typedef int socklen_t;
 
 // Network connection related defines
 #define SOCKET_MAX_SET_SIZE                     (32)   // Maximum sockets in a set
-#define SOCKET_MAX_QUEUE_SIZE                   (16)   // Maximum socket queue size
+#define SOCKET_MAX_QUEUE_SIZE                   (SOMAXCONN) // Default listen backlog (system maximum)
 #define SOCKET_MAX_SOCK_OPTS (4)        // Maximum socket options
 #define SOCKET_MAX_UDPCHANNELS (32)        // Maximum UDP channels
 #define SOCKET_MAX_UDPADDRESSES (4)        // Maximum bound UDP addresses
+#define SOCKET_MAX_BATCH_SIZE (64)         // Maximum datagrams per batched send/receive call
+#define PACKET_POOL_BUFFER_SIZE (1500)     // Default pooled packet buffer size (Ethernet MTU)
+
+// Reliable UDP connection related defines
+#define CONNECTION_MAX_CHANNELS                 (8)    // Maximum channels per connection
+#define CONNECTION_FRAGMENT_SIZE                (1024) // Maximum message bytes per datagram, larger messages are fragmented
+#define CONNECTION_MAX_FRAGMENTS                (32)   // Maximum fragments per message
+#define CONNECTION_SEND_WINDOW                  (256)  // Maximum reliable fragments waiting to be acked
+#define CONNECTION_TIMEOUT                      (10000) // Milliseconds without receiving before a connection times out
+
+// SocketSet readiness backend, define SOCKET_BACKEND_SELECT to force select()
+#if !defined(SOCKET_BACKEND_SELECT)
+    #if defined(__linux__)
+        #define SOCKET_BACKEND_EPOLL            // epoll_wait(), O(ready) per check
+    #elif defined(__APPLE__) || defined(__FreeBSD__) || defined(__NetBSD__) || defined(__OpenBSD__) || defined(__DragonFly__)
+        #define SOCKET_BACKEND_KQUEUE           // kevent(), O(ready) per check
+    #elif defined(_WIN32) && (_WIN32_WINNT >= 0x0600)
+        #define SOCKET_BACKEND_WSAPOLL          // WSAPoll(), no FD_SETSIZE limit
+    #else
+        #define SOCKET_BACKEND_SELECT           // select(), limited to FD_SETSIZE
+    #endif
+#endif
 
 
 // Network address related defines
@@ -246,6 +272,7 @@ typedef struct _SocketAddress *SocketAddress;
 typedef struct _SocketAddressIPv4 *SocketAddressIPv4;
 typedef struct _SocketAddressIPv6 *SocketAddressIPv6;
 typedef struct _SocketAddressStorage *SocketAddressStorage;
+typedef struct _Connection *Connection;
 
 // IPAddress definition (in network byte order)
 typedef struct IPAddress {
@@ -265,11 +292,38 @@ typedef enum {
     SOCKET_UDP = 1  // SOCK_DGRAM
 } SocketType;
 
+// Connection channel reliability mode
+typedef enum {
+    CONNECTION_UNRELIABLE = 0,          // Messages may be lost, duplicated or reordered by the network
+    CONNECTION_UNRELIABLE_SEQUENCED,    // Messages may be lost, older messages than the last received are dropped
+    CONNECTION_RELIABLE_ORDERED         // Messages are resent until acked and received in order
+} ConnectionChannelMode;
+
 typedef struct UDPChannel {
     int numbound; // The total number of addresses this channel is bound to
     IPAddress address[SOCKET_MAX_UDPADDRESSES]; // The list of remote addresses this channel is bound to
 } UDPChannel;
 
+// Socket traffic counters, see GetSocketStats()
+typedef struct SocketStats {
+    uint64_t bytesSent;       // Bytes handed to the system
+    uint64_t bytesReceived;   // Bytes delivered to the game
+    uint32_t packetsSent;     // Datagrams (or TCP sends) handed to the system
+    uint32_t packetsReceived; // Datagrams (or TCP receives) delivered to the game
+    uint32_t packetsDropped;  // Datagrams dropped by the network conditioner or a full queue
+    uint32_t errors;          // Send/receive errors, not counting would block
+    volatile int sendQueue;    // Datagrams waiting to be sent (network thread and conditioner)
+    volatile int receiveQueue; // Datagrams waiting to be delivered (network thread and conditioner)
+} SocketStats;
+
+// Simulated network conditions, see SetSocketConditions()
+typedef struct NetworkConditions {
+    float latency;   // Delay added to every datagram, each way (ms)
+    float jitter;    // Random delay added on top of latency, up to this value (ms)
+    float loss;      // Probability of a datagram being dropped [0..1]
+    float duplicate; // Probability of a datagram being duplicated [0..1]
+} NetworkConditions;
+
 typedef struct Socket {
     int  ready;    // Is the socket ready? i.e. has information
     int  status;   // The last status code to have occured using this socket
@@ -281,14 +335,23 @@ typedef struct Socket {
     SocketAddressIPv6 addripv6; // The host/target IPv6 for this socket (in network byte order)
 
     struct UDPChannel binding[SOCKET_MAX_UDPCHANNELS]; // The amount of channels (if UDP) this socket is bound to
+
+    SocketStats stats;                      // The traffic counters of this socket
+    struct SocketConditioner *conditioner; // The simulated network conditions (NULL if disabled)
 } Socket;
 
 typedef struct SocketSet {
     int numsockets;
     int maxsockets;
     struct Socket **sockets;
+    int poller;     // The backend poller descriptor (epoll/kqueue), -1 if not used
+    void *events;   // The backend events buffer (epoll_event, kevent, WSAPOLLFD or fd_set)
 } SocketSet;
 
+// Called by CheckSocketsEx() for every socket with pending information,
+// the callback may remove the socket it was given from the set
+typedef void (*SocketReadyCallback)(SocketSet *set, Socket *sock, void *userData);
+
 typedef struct SocketDataPacket {
     int            channel; // The src/dst channel of the packet
     unsigned char *data;    // The packet data
@@ -296,8 +359,21 @@ typedef struct SocketDataPacket {
     int            maxlen;  // The size of the data buffer
     int            status;  // packet status after sending
     IPAddress address; // The source/dest address of an incoming/outgoing packet
+    volatile int refCount;   // The references held to this packet, see RetainPacket()/ReleasePacket()
+    struct PacketPool *pool; // The pool this packet belongs to (NULL if allocated by AllocPacket())
+    double timestamp;        // GetNetworkTime() when the packet was received, in milliseconds
 } SocketDataPacket;
 
+// Pool of fixed-size packets, acquired and released without heap allocations
+typedef struct PacketPool {
+    int count;                  // The total number of packets in the pool
+    int packetSize;             // The data buffer size of every packet
+    SocketDataPacket *packets;  // The packets slab
+    unsigned char *buffers;     // The packets data buffers slab
+    int *links;                 // The free list links, next free packet index (+1) per packet
+    volatile uint64_t freeList; // The free list head, ABA tag (high 32 bits) and packet index +1 (low 32 bits)
+} PacketPool;
+
 // Configuration for a socket.
 typedef struct SocketConfig {
     char *     host;   // The host address in xxx.xxx.xxx.xxx form
@@ -305,7 +381,10 @@ typedef struct SocketConfig {
     bool       server; // Listen for incoming clients?
     SocketType type;   // The type of socket, TCP/UDP
     bool       nonblocking;  // non-blocking operation?
-    int        backlog_size; // set a custom backlog size
+    int        backlog_size; // set a custom backlog size (SOCKET_MAX_QUEUE_SIZE if 0)
+    bool       nodelay;      // disable Nagle's algorithm (TCP_NODELAY)?
+    int        send_buffer_size;    // set a custom send buffer size (SO_SNDBUF), 0 for the system default
+    int        receive_buffer_size; // set a custom receive buffer size (SO_RCVBUF), 0 for the system default
     SocketOpt  sockopts[SOCKET_MAX_SOCK_OPTS];
 } SocketConfig;
 
@@ -315,6 +394,13 @@ typedef struct SocketResult {
     Socket *socket;
 } SocketResult;
 
+// Called by UpdateResolveAsync() once a ResolveHostAsync() request is resolved, 'status' is 0 on success
+// NOTE: 'addresses' is a NULL terminated list of 'count' addresses, only valid during the callback
+typedef void (*ResolveHostCallback)(const char *address, const char *service, int status, AddressInformation *addresses, int count, void *userData);
+
+// Called by UpdateResolveAsync() once a ResolveIPAsync() request is resolved, 'status' is 0 on success
+typedef void (*ResolveIPCallback)(const char *ip, const char *service, int status, const char *host, const char *serv, void *userData);
+
 // Packet type
 typedef struct Packet {
     uint32_t size; // The total size of bytes in data
@@ -323,6 +409,14 @@ typedef struct Packet {
     uint8_t *data; // Data stored in network byte order
 } Packet;
 
+// Bit packed packet type, values are written with arbitrary bit widths
+typedef struct BitPacket {
+    uint8_t *data;    // The packet buffer
+    uint32_t size;    // The packet buffer size in bytes
+    uint32_t bits;    // The read/write position in bits
+    bool overflow;    // Did a read/write go past the end of the buffer?
+} BitPacket;
+
 
 #ifdef __cplusplus
 extern "C" {            // Prevents name mangling of functions
@@ -351,6 +445,12 @@ char* GetAddressCanonName(AddressInformation address);
 char* GetAddressHostAndPort(AddressInformation address, char *outhost, int *outport);
 void PrintAddressInfo(AddressInformation address);
 
+// Asynchronous Address API
+void ResolveHostAsync(const char *address, const char *service, int addressType, int flags, ResolveHostCallback callback, void *userData);
+void ResolveIPAsync(const char *ip, const char *service, int flags, ResolveIPCallback callback, void *userData);
+int UpdateResolveAsync(void);
+int GetResolveAsyncPending(void);
+
 // Address Memory API
 AddressInformation AllocAddress();
 void FreeAddress(AddressInformation *addressInfo);
@@ -362,6 +462,8 @@ bool SocketBind(SocketConfig *config, SocketResult *result);
 bool SocketListen(SocketConfig *config, SocketResult *result);
 bool SocketConnect(SocketConfig *config, SocketResult *result);
 Socket *SocketAccept(Socket *server, SocketConfig *config);
+int SocketAcceptMany(Socket *server, SocketConfig *config, Socket **clients, int max);
+int CheckSocketConnect(Socket *sock, unsigned int timeout);
 
 // UDP Socket API
 int SocketSetChannel(Socket *socket, int channel, const IPAddress *address);
@@ -374,9 +476,31 @@ void FreePacket(SocketDataPacket *packet);
 SocketDataPacket **AllocPacketList(int count, int size);
 void FreePacketList(SocketDataPacket **packets);
 
+// UDP DataPacket Pool API
+PacketPool *AllocPacketPool(int count, int size);
+void FreePacketPool(PacketPool *pool);
+SocketDataPacket *AcquirePacket(PacketPool *pool);
+int AcquirePacketList(PacketPool *pool, SocketDataPacket **packets, int count);
+SocketDataPacket *RetainPacket(SocketDataPacket *packet);
+void ReleasePacket(SocketDataPacket *packet);
+
 // General Socket API
 int SocketSend(Socket *sock, const void *datap, int len);
 int SocketReceive(Socket *sock, void *data, int maxlen);
+int SocketSendBatch(Socket *sock, SocketDataPacket **packets, int count);
+int SocketReceiveBatch(Socket *sock, SocketDataPacket **packets, int max);
+int SocketReceivePool(Socket *sock, PacketPool *pool, SocketDataPacket **packets, int max);
+
+// Reliable UDP Connection API
+Connection AllocConnection(Socket *sock, IPAddress address);
+void FreeConnection(Connection *conn);
+void SetConnectionChannelMode(Connection conn, int channel, ConnectionChannelMode mode);
+bool ConnectionSend(Connection conn, int channel, const void *data, int len);
+bool ConnectionReceive(Connection conn, const SocketDataPacket *packet);
+int ConnectionRead(Connection conn, int *channel, void *data, int maxlen);
+bool UpdateConnection(Connection conn);
+float GetConnectionRTT(Connection conn);
+float GetConnectionPacketLoss(Connection conn);
 void SocketClose(Socket *sock);
 SocketAddressStorage SocketGetPeerAddress(Socket *sock);
 char* GetSocketAddressHost(SocketAddressStorage storage);
@@ -396,19 +520,55 @@ bool IsSocketConnected(Socket *sock);
 int AddSocket(SocketSet *set, Socket *sock);
 int RemoveSocket(SocketSet *set, Socket *sock);
 int CheckSockets(SocketSet *set, unsigned int timeout);
+int CheckSocketsEx(SocketSet *set, unsigned int timeout, SocketReadyCallback callback, void *userData);
+
+// Network Thread API
+double GetNetworkTime(void);
+bool StartNetworkThread(SocketSet *set, PacketPool *pool, int queueSize);
+void StopNetworkThread(void);
+bool IsNetworkThreadRunning(void);
+bool NetworkThreadSend(Socket *sock, SocketDataPacket *packet);
+int NetworkThreadReceive(Socket **socks, SocketDataPacket **packets, int max);
+
+// Socket Statistics and Conditions API
+SocketStats GetSocketStats(Socket *sock);
+void ResetSocketStats(Socket *sock);
+void PrintSocketStats(Socket *sock);
+void SetSocketConditions(Socket *sock, NetworkConditions conditions);
+NetworkConditions GetSocketConditions(Socket *sock);
 
 // Packet API
 void PacketSend(Packet *packet);
 void PacketReceive(Packet *packet);
-void PacketWrite8(Packet *packet, uint16_t value);
+void PacketWrite8(Packet *packet, uint8_t value);
 void PacketWrite16(Packet *packet, uint16_t value);
 void PacketWrite32(Packet *packet, uint32_t value);
 void PacketWrite64(Packet *packet, uint64_t value);
-uint16_t PacketRead8(Packet *packet);
+uint8_t PacketRead8(Packet *packet);
 uint16_t PacketRead16(Packet *packet);
 uint32_t PacketRead32(Packet *packet);
 uint64_t PacketRead64(Packet *packet);
 
+// Bit Packet API
+BitPacket InitBitPacket(uint8_t *data, uint32_t size);
+uint32_t GetBitPacketSize(const BitPacket *packet);
+void BitPacketWriteBits(BitPacket *packet, uint32_t value, int bits);
+uint32_t BitPacketReadBits(BitPacket *packet, int bits);
+void BitPacketWriteBool(BitPacket *packet, bool value);
+bool BitPacketReadBool(BitPacket *packet);
+void BitPacketWriteInt(BitPacket *packet, int32_t value, int32_t min, int32_t max);
+int32_t BitPacketReadInt(BitPacket *packet, int32_t min, int32_t max);
+void BitPacketWriteFloat(BitPacket *packet, float value, float min, float max, float precision);
+float BitPacketReadFloat(BitPacket *packet, float min, float max, float precision);
+void BitPacketWriteVarint(BitPacket *packet, uint32_t value);
+uint32_t BitPacketReadVarint(BitPacket *packet);
+void BitPacketWriteSignedVarint(BitPacket *packet, int32_t value);
+int32_t BitPacketReadSignedVarint(BitPacket *packet);
+void BitPacketWriteBytes(BitPacket *packet, const void *data, int size);
+void BitPacketReadBytes(BitPacket *packet, void *data, int size);
+void BitPacketWriteDelta(BitPacket *packet, const void *baseline, const void *current, int size);
+bool BitPacketReadDelta(BitPacket *packet, const void *baseline, void *current, int size);
+
 #ifdef __cplusplus
 }
 #endif
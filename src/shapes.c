@@ -33,6 +33,7 @@
 *
 **********************************************************************************************/
 
+#define RL_MEMORY_TAG   MEMORY_TAG_CORE // Module allocations subsystem (GetMemoryStats())
 #include "raylib.h"     // Declares module functions
 
 // Check if config flags have been externally provided on compilation line
@@ -44,16 +45,70 @@
 
 #include <stdlib.h>     // Required for: abs(), fabs()
 #include <math.h>       // Required for: sinf(), cosf(), sqrtf()
+#include <string.h>     // Required for: memset()
+
+// SIMD instructions used on batched collision checks (CheckCollisionRecsBatch(), CheckCollisionCirclesBatch())
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 1))
+    #include <xmmintrin.h>      // Required for: SSE intrinsics
+    #define SHAPES_SIMD_SSE
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+    #include <arm_neon.h>       // Required for: NEON intrinsics
+    #define SHAPES_SIMD_NEON
+#endif
 
 //----------------------------------------------------------------------------------
 // Defines and Macros
 //----------------------------------------------------------------------------------
-// Nop...
+#define SHAPES_BATCH_SEGMENTS       64      // Circle segments added to batch in bulk (by chunk), must be even
+#define SHAPES_STROKE_QUADS          256      // Path stroke quads added to batch in bulk (by chunk)
+#define SHAPES_STROKE_MITER_LIMIT   4.0f    // Max miter length (relative to half thickness), longer miter joins are beveled
+#define SHAPES_TESSELLATION_ERROR   0.5f    // Default max distance (in pixels) between curve and segments for automatic segments
+#define SHAPES_GRID_BUCKETS         1024    // Spatial grid initial hashed cells buckets, doubled when items exceed twice the buckets
 
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
-// Not here...
+// Polygon nodes circular list (LoadPolygonTriangles()), nodes reference polygon points
+typedef struct PolygonNodes {
+    const Vector2 *points;      // Polygon points (outline and holes)
+    int *index;                 // Node point index
+    int *prev;                  // Node previous node
+    int *next;                  // Node next node
+    int count;                  // Nodes counter
+} PolygonNodes;
+
+// Spatial grid entry (SpatialGrid), rectangle or circle
+typedef struct SpatialGridEntry {
+    Rectangle bounds;           // Entry bounds (circles: bounding square)
+    float radius;               // Circle radius (-1.0f for rectangles)
+    int userId;                 // Entry user id
+    int minX, minY;             // First cell covered by entry bounds
+    int maxX, maxY;             // Last cell covered by entry bounds
+    int next;                   // Next free entry (free entries), -2 for entries in use
+    unsigned int queryId;       // Last query entry was checked by (avoids duplicated results)
+} SpatialGridEntry;
+
+// Spatial grid cell item, entry stored in a hashed cell bucket
+typedef struct SpatialGridItem {
+    int cellX, cellY;           // Item cell
+    int entry;                  // Item entry (-1 for free items)
+    int next;                   // Next item in bucket or in free list
+} SpatialGridItem;
+
+// Spatial grid hashed cells (SpatialGrid.gridData)
+typedef struct SpatialGridData {
+    float cellSize;             // Cells size
+    SpatialGridEntry *entries;  // Entries array, entries ids are indices
+    int entryCapacity;          // Entries array capacity
+    int freeEntry;              // First free entry (-1 if no free entries)
+    SpatialGridItem *items;     // Cells items array
+    int itemCapacity;           // Cells items array capacity
+    int itemCount;              // Number of cells items used
+    int freeItem;               // First free item (-1 if no free items)
+    int *buckets;               // Hashed cells buckets, first item by bucket (-1 if empty)
+    int bucketCount;            // Number of buckets (power of two)
+    unsigned int queryId;       // Last query id
+} SpatialGridData;
 
 //----------------------------------------------------------------------------------
 // Global Variables Definition
@@ -61,11 +116,48 @@
 static Texture2D texShapes = { 0 };         // Texture used on shapes drawing (usually a white)
 static Rectangle recTexShapes = { 0 };      // Texture source rectangle used on shapes drawing
 
+static Vector2 circleTable[360] = { 0 };    // Unit circle points (sin, cos) every degree, shared by circular shapes
+static bool circleTableReady = false;       // Unit circle points table initialized (on first use)
+static float tessellationError = SHAPES_TESSELLATION_ERROR;     // Max error (in pixels) for automatic curve segments
+static int shapesRenderMode = SHAPES_RENDER_TESSELLATED;        // Shapes render mode (ShapesRenderMode)
+
+static Vector2 strokeQuads[SHAPES_STROKE_QUADS*4] = { 0 };      // Path stroke quads pending to be added to batch (DrawPolylineEx())
+static int strokeQuadsCount = 0;            // Path stroke quads counter
+static Color strokeColor = { 0 };           // Path stroke color
+static float strokeDepth = 0.0f;            // Path stroke depth, all quads drawn at same depth
+
 //----------------------------------------------------------------------------------
 // Module specific Functions Declaration
 //----------------------------------------------------------------------------------
 static float EaseCubicInOut(float t, float b, float c, float d);    // Cubic easing
 static Texture2D GetShapesTexture(void);                            // Get texture to draw shapes
+static int GetCurveSegments(float radius, float arcAngle);          // Get segments required for an arc, from its on-screen radius
+static void GetCirclePoints(float startAngle, float stepLength, int count, Vector2 *points);   // Get unit circle points (sin, cos) every stepLength degrees
+static void AddCircleSectorVertices(Vector2 center, float radius, float startAngle, float stepLength, int segments);    // Add circle sector vertex to batch (quads or triangles)
+static void AddRingVertices(Vector2 center, float innerRadius, float outerRadius, float startAngle, float stepLength, int segments);   // Add ring vertex to batch (quads or triangles)
+static void AddArcVertices(Vector2 center, float radius, float startAngle, float stepLength, int segments);   // Add arc vertex to batch (lines)
+static void AddStrokeQuad(Vector2 a, Vector2 b, Vector2 c, Vector2 d);     // Add path stroke quad (d = c for triangles), winding is fixed if required
+static void AddStrokeArc(Vector2 center, Vector2 from, float angle, float radius);  // Add path stroke arc (round joins and caps), from vector rotated by angle (radians)
+static void FlushStrokeQuads(void);                                 // Add pending path stroke quads to batch
+static void AddPointsVertices(const Vector2 *points, const Color *colors, int count, Vector2 offset, unsigned int textureId);  // Add points to batch in bulk (RL_POINTS)
+static int LinkPolygonRing(PolygonNodes *nodes, int start, int end, bool outline);  // Link polygon ring points into nodes circular list
+static float GetNodesArea(PolygonNodes *nodes, int a, int b, int c);              // Get signed area of nodes triangle
+static bool CheckPointInTriangle(Vector2 point, Vector2 a, Vector2 b, Vector2 c);   // Check if point is inside counter-clockwise triangle (edges included)
+static int FindHoleBridge(PolygonNodes *nodes, int hole, int outer);  // Find outline node to bridge hole
+static void SplitPolygon(PolygonNodes *nodes, int a, int b);        // Split polygon linking two nodes (nodes are duplicated)
+static bool CheckPolygonEar(PolygonNodes *nodes, int ear);          // Check if node is an ear (convex, no reflex node inside)
+static int ClipPolygonEars(PolygonNodes *nodes, int ear, int *indices);   // Clip polygon ears into triangles indices
+static int AllocateSpatialGridEntry(SpatialGridData *grid);         // Get a free spatial grid entry (entries array grows if required)
+static void SetSpatialGridEntry(SpatialGridData *grid, int entry, Rectangle bounds, float radius);  // Set spatial grid entry shape and covered cells
+static void InsertSpatialGridCells(SpatialGridData *grid, int entry);  // Insert entry items in its covered cells
+static void RemoveSpatialGridCells(SpatialGridData *grid, int entry);  // Remove entry items from its covered cells
+static int GetSpatialGridBucket(const SpatialGridData *grid, int cellX, int cellY);  // Get hashed cell bucket
+static bool CheckSpatialGridShapes(const SpatialGridEntry *shape1, const SpatialGridEntry *shape2);    // Check collision between spatial grid shapes (rectangles or circles)
+static int QuerySpatialGridShape(SpatialGridData *grid, const SpatialGridEntry *shape, int *userIds, int maxCount);  // Get spatial grid entries overlapping shape
+static int StoreBatchHits(int start, unsigned int mask, unsigned int *hitMask, int *hitIndices, int hitCount);  // Store batched collision checks hits
+#if defined(SHAPES_SIMD_NEON)
+static unsigned int GetLanesMask(uint32x4_t lanes);                 // Get NEON comparison lanes as bits mask
+#endif
 
 //----------------------------------------------------------------------------------
 // Module Functions Definition
@@ -91,6 +183,27 @@ void DrawPixelV(Vector2 position, Color color)
     rlEnd();
 }
 
+// Draw multiple pixels (colors optional, white if NULL)
+// NOTE: Pixels are drawn as 1px points, added to batch in bulk (one draw call)
+void DrawPixels(const Vector2 *points, const Color *colors, int count)
+{
+    if ((points == NULL) || (count <= 0)) return;
+
+    // NOTE: Points are centered on pixels, same pixels than DrawPixelV()
+    AddPointsVertices(points, colors, count, (Vector2){ 0.5f, 0.5f }, 0);
+}
+
+// Draw multiple point sprites, texture quads of size pixels centered at positions (colors optional, white if NULL)
+// NOTE: Sprites size is in screen pixels (not scaled by camera), only supported by default shader
+void DrawPointSprites(Texture2D texture, const Vector2 *positions, const Color *colors, int count, float size)
+{
+    if ((positions == NULL) || (count <= 0)) return;
+
+    rlSetPointSize(size);
+    AddPointsVertices(positions, colors, count, (Vector2){ 0.0f, 0.0f }, texture.id);
+    rlSetPointSize(1.0f);
+}
+
 // Draw a line
 void DrawLine(int startPosX, int startPosY, int endPosX, int endPosY, Color color)
 {
@@ -114,6 +227,15 @@ void DrawLineV(Vector2 startPos, Vector2 endPos, Color color)
 // Draw a line defining thickness
 void DrawLineEx(Vector2 startPos, Vector2 endPos, float thick, Color color)
 {
+    if (shapesRenderMode == SHAPES_RENDER_SDF)
+    {
+        Vector2 center = { (startPos.x + endPos.x)/2.0f, (startPos.y + endPos.y)/2.0f };
+        float length = sqrtf((endPos.x - startPos.x)*(endPos.x - startPos.x) + (endPos.y - startPos.y)*(endPos.y - startPos.y));
+        float rotation = RAD2DEG*atan2f(endPos.y - startPos.y, endPos.x - startPos.x);
+
+        if (rlDrawShapeSDF(center, (Vector2){ length/2.0f, thick/2.0f }, rotation, 0.0f, 0.0f, color)) return;
+    }
+
     if (startPos.x > endPos.x)
     {
         Vector2 tempPos = startPos;
@@ -160,20 +282,123 @@ void DrawLineBezier(Vector2 startPos, Vector2 endPos, float thick, Color color)
 {
     #define LINE_DIVISIONS         24   // Bezier line divisions
 
-    Vector2 previous = startPos;
-    Vector2 current;
+    Vector2 points[LINE_DIVISIONS + 1] = { 0 };
+    points[0] = startPos;
 
     for (int i = 1; i <= LINE_DIVISIONS; i++)
     {
         // Cubic easing in-out
         // NOTE: Easing is calculated only for y position value
-        current.y = EaseCubicInOut((float)i, startPos.y, endPos.y - startPos.y, (float)LINE_DIVISIONS);
-        current.x = previous.x + (endPos.x - startPos.x)/ (float)LINE_DIVISIONS;
+        points[i].y = EaseCubicInOut((float)i, startPos.y, endPos.y - startPos.y, (float)LINE_DIVISIONS);
+        points[i].x = points[i - 1].x + (endPos.x - startPos.x)/ (float)LINE_DIVISIONS;
+    }
+
+    // NOTE: Curve is stroked as one path, segments are joined without gaps
+    DrawPolylineEx(points, LINE_DIVISIONS + 1, thick, LINE_JOIN_MITER, LINE_CAP_BUTT, color);
+}
+
+// Draw lines sequence with thickness, joins and caps (LineJoinType, LineCapType)
+// NOTE: Path is stroked into quads (one by segment and join), added to batch in bulk,
+// repeated consecutive points are skipped
+void DrawPolylineEx(const Vector2 *points, int pointsCount, float thick, int joinType, int capType, Color color)
+{
+    if ((points == NULL) || (pointsCount < 2) || (thick <= 0.0f)) return;
+
+    float halfThick = thick/2.0f;
+
+    // Find first segment (skipping repeated points)
+    int next = 1;
+    while ((next < pointsCount) && (points[next].x == points[0].x) && (points[next].y == points[0].y)) next++;
+    if (next == pointsCount) return;
+
+    strokeQuadsCount = 0;
+    strokeColor = color;
+    strokeDepth = rlGetCurrentDepth();
+
+    Vector2 start = points[0];
+    Vector2 end = points[next];
+    float length = sqrtf((end.x - start.x)*(end.x - start.x) + (end.y - start.y)*(end.y - start.y));
+    Vector2 direction = { (end.x - start.x)/length, (end.y - start.y)/length };
+    Vector2 normal = { -direction.y, direction.x };
+
+    // Start cap
+    if (capType == LINE_CAP_SQUARE) start = (Vector2){ start.x - direction.x*halfThick, start.y - direction.y*halfThick };
+    else if (capType == LINE_CAP_ROUND) AddStrokeArc(start, (Vector2){ normal.x*halfThick, normal.y*halfThick }, PI, halfThick);
+
+    Vector2 left = { start.x + normal.x*halfThick, start.y + normal.y*halfThick };
+    Vector2 right = { start.x - normal.x*halfThick, start.y - normal.y*halfThick };
+
+    while (true)
+    {
+        // Find next segment (skipping repeated points)
+        next++;
+        while ((next < pointsCount) && (points[next].x == end.x) && (points[next].y == end.y)) next++;
+
+        if (next >= pointsCount)
+        {
+            // Last segment and end cap
+            Vector2 last = end;
+            if (capType == LINE_CAP_SQUARE) last = (Vector2){ end.x + direction.x*halfThick, end.y + direction.y*halfThick };
+
+            AddStrokeQuad(left, right, (Vector2){ last.x - normal.x*halfThick, last.y - normal.y*halfThick }, (Vector2){ last.x + normal.x*halfThick, last.y + normal.y*halfThick });
 
-        DrawLineEx(previous, current, thick, color);
+            if (capType == LINE_CAP_ROUND) AddStrokeArc(end, (Vector2){ -normal.x*halfThick, -normal.y*halfThick }, PI, halfThick);
+            break;
+        }
+
+        Vector2 nextEnd = points[next];
+        length = sqrtf((nextEnd.x - end.x)*(nextEnd.x - end.x) + (nextEnd.y - end.y)*(nextEnd.y - end.y));
+        Vector2 nextDirection = { (nextEnd.x - end.x)/length, (nextEnd.y - end.y)/length };
+        Vector2 nextNormal = { -nextDirection.y, nextDirection.x };
+
+        float cross = direction.x*nextDirection.y - direction.y*nextDirection.x;
+        float dot = direction.x*nextDirection.x + direction.y*nextDirection.y;
+
+        // Miter join: segments share the miter points, no join geometry required
+        Vector2 miter = { normal.x + nextNormal.x, normal.y + nextNormal.y };
+        float miterLength = sqrtf(miter.x*miter.x + miter.y*miter.y);
+        float cosHalfAngle = (miterLength > 0.0001f)? (miter.x*normal.x + miter.y*normal.y)/miterLength : 0.0f;
+
+        if ((joinType == LINE_JOIN_MITER) && (cosHalfAngle > 1.0f/SHAPES_STROKE_MITER_LIMIT))
+        {
+            float scale = halfThick/(cosHalfAngle*miterLength);
+            Vector2 nextLeft = { end.x + miter.x*scale, end.y + miter.y*scale };
+            Vector2 nextRight = { end.x - miter.x*scale, end.y - miter.y*scale };
+
+            AddStrokeQuad(left, right, nextRight, nextLeft);
+
+            left = nextLeft;
+            right = nextRight;
+        }
+        else
+        {
+            AddStrokeQuad(left, right, (Vector2){ end.x - normal.x*halfThick, end.y - normal.y*halfThick }, (Vector2){ end.x + normal.x*halfThick, end.y + normal.y*halfThick });
+
+            // Join geometry on outer side of the turn (inner side is covered by segments)
+            if ((cross != 0.0f) || (dot < 0.0f))
+            {
+                float side = (cross > 0.0f)? -halfThick : halfThick;
+                Vector2 outer = { normal.x*side, normal.y*side };
+                Vector2 nextOuter = { nextNormal.x*side, nextNormal.y*side };
+
+                if (joinType == LINE_JOIN_ROUND) AddStrokeArc(end, outer, atan2f(cross, dot), halfThick);
+                else
+                {
+                    Vector2 nextOuterPoint = { end.x + nextOuter.x, end.y + nextOuter.y };
+                    AddStrokeQuad(end, (Vector2){ end.x + outer.x, end.y + outer.y }, nextOuterPoint, nextOuterPoint);
+                }
+            }
+
+            left = (Vector2){ end.x + nextNormal.x*halfThick, end.y + nextNormal.y*halfThick };
+            right = (Vector2){ end.x - nextNormal.x*halfThick, end.y - nextNormal.y*halfThick };
+        }
 
-        previous = current;
+        end = nextEnd;
+        direction = nextDirection;
+        normal = nextNormal;
     }
+
+    FlushStrokeQuads();
 }
 
 // Draw lines sequence
@@ -215,64 +440,18 @@ void DrawCircleSector(Vector2 center, float radius, int startAngle, int endAngle
         endAngle = tmp;
     }
 
-    if (segments < 4)
-    {
-        // Calculate how many segments we need to draw a smooth circle, taken from https://stackoverflow.com/a/2244088
-        #define CIRCLE_ERROR_RATE  0.5f
-
-        // Calculate the maximum angle between segments based on the error rate.
-        float th = acosf(2*powf(1 - CIRCLE_ERROR_RATE/radius, 2) - 1);
-        segments = (endAngle - startAngle)*ceilf(2*PI/th)/360;
-
-        if (segments <= 0) segments = 4;
-    }
+    if (segments < 4) segments = GetCurveSegments(radius, (float)(endAngle - startAngle));
 
     float stepLength = (float)(endAngle - startAngle)/(float)segments;
-    float angle = startAngle;
 
 #if defined(SUPPORT_QUADS_DRAW_MODE)
-    if (rlCheckBufferLimit(4*segments/2)) rlglDraw();
+    if (rlCheckBufferLimit(4*(segments/2 + 1))) rlglDraw();
 
     rlEnableTexture(GetShapesTexture().id);
 
     rlBegin(RL_QUADS);
-        // NOTE: Every QUAD actually represents two segments
-        for (int i = 0; i < segments/2; i++)
-        {
-            rlColor4ub(color.r, color.g, color.b, color.a);
-
-            rlTexCoord2f(recTexShapes.x/texShapes.width, recTexShapes.y/texShapes.height);
-            rlVertex2f(center.x, center.y);
-
-            rlTexCoord2f(recTexShapes.x/texShapes.width, (recTexShapes.y + recTexShapes.height)/texShapes.height);
-            rlVertex2f(center.x + sinf(DEG2RAD*angle)*radius, center.y + cosf(DEG2RAD*angle)*radius);
-
-            rlTexCoord2f((recTexShapes.x + recTexShapes.width)/texShapes.width, (recTexShapes.y + recTexShapes.height)/texShapes.height);
-            rlVertex2f(center.x + sinf(DEG2RAD*(angle + stepLength))*radius, center.y + cosf(DEG2RAD*(angle + stepLength))*radius);
-
-            rlTexCoord2f((recTexShapes.x + recTexShapes.width)/texShapes.width, recTexShapes.y/texShapes.height);
-            rlVertex2f(center.x + sinf(DEG2RAD*(angle + stepLength*2))*radius, center.y + cosf(DEG2RAD*(angle + stepLength*2))*radius);
-
-            angle += (stepLength*2);
-        }
-
-        // NOTE: In case number of segments is odd, we add one last piece to the cake
-        if (segments%2)
-        {
-            rlColor4ub(color.r, color.g, color.b, color.a);
-
-            rlTexCoord2f(recTexShapes.x/texShapes.width, recTexShapes.y/texShapes.height);
-            rlVertex2f(center.x, center.y);
-
-            rlTexCoord2f(recTexShapes.x/texShapes.width, (recTexShapes.y + recTexShapes.height)/texShapes.height);
-            rlVertex2f(center.x + sinf(DEG2RAD*angle)*radius, center.y + cosf(DEG2RAD*angle)*radius);
-
-            rlTexCoord2f((recTexShapes.x + recTexShapes.width)/texShapes.width, (recTexShapes.y + recTexShapes.height)/texShapes.height);
-            rlVertex2f(center.x + sinf(DEG2RAD*(angle + stepLength))*radius, center.y + cosf(DEG2RAD*(angle + stepLength))*radius);
-
-            rlTexCoord2f((recTexShapes.x + recTexShapes.width)/texShapes.width, recTexShapes.y/texShapes.height);
-            rlVertex2f(center.x, center.y);
-        }
+        rlColor4ub(color.r, color.g, color.b, color.a);
+        AddCircleSectorVertices(center, radius, (float)startAngle, stepLength, segments);
     rlEnd();
 
     rlDisableTexture();
@@ -280,16 +459,8 @@ void DrawCircleSector(Vector2 center, float radius, int startAngle, int endAngle
     if (rlCheckBufferLimit(3*segments)) rlglDraw();
 
     rlBegin(RL_TRIANGLES);
-        for (int i = 0; i < segments; i++)
-        {
-            rlColor4ub(color.r, color.g, color.b, color.a);
-
-            rlVertex2f(center.x, center.y);
-            rlVertex2f(center.x + sinf(DEG2RAD*angle)*radius, center.y + cosf(DEG2RAD*angle)*radius);
-            rlVertex2f(center.x + sinf(DEG2RAD*(angle + stepLength))*radius, center.y + cosf(DEG2RAD*(angle + stepLength))*radius);
-
-            angle += stepLength;
-        }
+        rlColor4ub(color.r, color.g, color.b, color.a);
+        AddCircleSectorVertices(center, radius, (float)startAngle, stepLength, segments);
     rlEnd();
 #endif
 }
@@ -307,53 +478,35 @@ void DrawCircleSectorLines(Vector2 center, float radius, int startAngle, int end
         endAngle = tmp;
     }
 
-    if (segments < 4)
-    {
-        // Calculate how many segments we need to draw a smooth circle, taken from https://stackoverflow.com/a/2244088
-        #ifndef CIRCLE_ERROR_RATE
-        #define CIRCLE_ERROR_RATE  0.5f
-        #endif
-
-        // Calculate the maximum angle between segments based on the error rate.
-        float th = acosf(2*powf(1 - CIRCLE_ERROR_RATE/radius, 2) - 1);
-        segments = (endAngle - startAngle)*ceilf(2*PI/th)/360;
-
-        if (segments <= 0) segments = 4;
-    }
+    if (segments < 4) segments = GetCurveSegments(radius, (float)(endAngle - startAngle));
 
     float stepLength = (float)(endAngle - startAngle)/(float)segments;
-    float angle = startAngle;
 
     // Hide the cap lines when the circle is full
     bool showCapLines = true;
     int limit = 2*(segments + 2);
     if ((endAngle - startAngle)%360 == 0) { limit = 2*segments; showCapLines = false; }
 
+    Vector2 caps[2] = { 0 };
+    GetCirclePoints((float)startAngle, (float)(endAngle - startAngle), 2, caps);
+
     if (rlCheckBufferLimit(limit)) rlglDraw();
 
     rlBegin(RL_LINES);
+        rlColor4ub(color.r, color.g, color.b, color.a);
+
         if (showCapLines)
         {
-            rlColor4ub(color.r, color.g, color.b, color.a);
             rlVertex2f(center.x, center.y);
-            rlVertex2f(center.x + sinf(DEG2RAD*angle)*radius, center.y + cosf(DEG2RAD*angle)*radius);
+            rlVertex2f(center.x + caps[0].x*radius, center.y + caps[0].y*radius);
         }
 
-        for (int i = 0; i < segments; i++)
-        {
-            rlColor4ub(color.r, color.g, color.b, color.a);
-
-            rlVertex2f(center.x + sinf(DEG2RAD*angle)*radius, center.y + cosf(DEG2RAD*angle)*radius);
-            rlVertex2f(center.x + sinf(DEG2RAD*(angle + stepLength))*radius, center.y + cosf(DEG2RAD*(angle + stepLength))*radius);
-
-            angle += stepLength;
-        }
+        AddArcVertices(center, radius, (float)startAngle, stepLength, segments);
 
         if (showCapLines)
         {
-            rlColor4ub(color.r, color.g, color.b, color.a);
             rlVertex2f(center.x, center.y);
-            rlVertex2f(center.x + sinf(DEG2RAD*angle)*radius, center.y + cosf(DEG2RAD*angle)*radius);
+            rlVertex2f(center.x + caps[1].x*radius, center.y + caps[1].y*radius);
         }
     rlEnd();
 }
@@ -362,17 +515,20 @@ void DrawCircleSectorLines(Vector2 center, float radius, int startAngle, int end
 // NOTE: Gradient goes from center (color1) to border (color2)
 void DrawCircleGradient(int centerX, int centerY, float radius, Color color1, Color color2)
 {
+    Vector2 points[37] = { 0 };
+    GetCirclePoints(0.0f, 10.0f, 37, points);
+
     if (rlCheckBufferLimit(3*36)) rlglDraw();
 
     rlBegin(RL_TRIANGLES);
-        for (int i = 0; i < 360; i += 10)
+        for (int i = 0; i < 36; i++)
         {
             rlColor4ub(color1.r, color1.g, color1.b, color1.a);
             rlVertex2f(centerX, centerY);
             rlColor4ub(color2.r, color2.g, color2.b, color2.a);
-            rlVertex2f(centerX + sinf(DEG2RAD*i)*radius, centerY + cosf(DEG2RAD*i)*radius);
+            rlVertex2f(centerX + points[i].x*radius, centerY + points[i].y*radius);
             rlColor4ub(color2.r, color2.g, color2.b, color2.a);
-            rlVertex2f(centerX + sinf(DEG2RAD*(i + 10))*radius, centerY + cosf(DEG2RAD*(i + 10))*radius);
+            rlVertex2f(centerX + points[i + 1].x*radius, centerY + points[i + 1].y*radius);
         }
     rlEnd();
 }
@@ -381,7 +537,10 @@ void DrawCircleGradient(int centerX, int centerY, float radius, Color color1, Co
 // NOTE: On OpenGL 3.3 and ES2 we use QUADS to avoid drawing order issues (view rlglDraw)
 void DrawCircleV(Vector2 center, float radius, Color color)
 {
-    DrawCircleSector(center, radius, 0, 360, 36, color);
+    if ((shapesRenderMode == SHAPES_RENDER_SDF) && (radius > 0.0f) &&
+        rlDrawShapeSDF(center, (Vector2){ radius, radius }, 0.0f, radius, 0.0f, color)) return;
+
+    DrawCircleSector(center, radius, 0, 360, 0, color);
 }
 
 // Draw circle outline
@@ -392,13 +551,9 @@ void DrawCircleLines(int centerX, int centerY, float radius, Color color)
     rlBegin(RL_LINES);
         rlColor4ub(color.r, color.g, color.b, color.a);
 
-        // NOTE: Circle outline is drawn pixel by pixel every degree (0 to 360)
-        for (int i = 0; i < 360; i += 10)
-        {
-            rlVertex2f(centerX + sinf(DEG2RAD*i)*radius, centerY + cosf(DEG2RAD*i)*radius);
-            rlVertex2f(centerX + sinf(DEG2RAD*(i + 10))*radius, centerY + cosf(DEG2RAD*(i + 10))*radius);
-        }
-   rlEnd();
+        // NOTE: Circle outline is drawn every 10 degrees (0 to 360)
+        AddArcVertices((Vector2){ (float)centerX, (float)centerY }, radius, 0.0f, 10.0f, 36);
+    rlEnd();
 }
 
 void DrawRing(Vector2 center, float innerRadius, float outerRadius, int startAngle, int endAngle, int segments, Color color)
@@ -424,19 +579,11 @@ void DrawRing(Vector2 center, float innerRadius, float outerRadius, int startAng
         endAngle = tmp;
     }
 
-    if (segments < 4)
-    {
-        // Calculate how many segments we need to draw a smooth circle, taken from https://stackoverflow.com/a/2244088
-        #ifndef CIRCLE_ERROR_RATE
-            #define CIRCLE_ERROR_RATE  0.5f
-        #endif
-
-        // Calculate the maximum angle between segments based on the error rate.
-        float th = acosf(2*powf(1 - CIRCLE_ERROR_RATE/outerRadius, 2) - 1);
-        segments = (endAngle - startAngle)*ceilf(2*PI/th)/360;
+    // Full ring drawn as a circle outline shape
+    if ((shapesRenderMode == SHAPES_RENDER_SDF) && (innerRadius > 0.0f) && ((endAngle - startAngle) >= 360) &&
+        rlDrawShapeSDF(center, (Vector2){ outerRadius, outerRadius }, 0.0f, outerRadius, outerRadius - innerRadius, color)) return;
 
-        if (segments <= 0) segments = 4;
-    }
+    if (segments < 4) segments = GetCurveSegments(outerRadius, (float)(endAngle - startAngle));
 
     // Not a ring
     if (innerRadius <= 0.0f)
@@ -446,7 +593,6 @@ void DrawRing(Vector2 center, float innerRadius, float outerRadius, int startAng
     }
 
     float stepLength = (float)(endAngle - startAngle)/(float)segments;
-    float angle = startAngle;
 
 #if defined(SUPPORT_QUADS_DRAW_MODE)
     if (rlCheckBufferLimit(4*segments)) rlglDraw();
@@ -454,24 +600,8 @@ void DrawRing(Vector2 center, float innerRadius, float outerRadius, int startAng
     rlEnableTexture(GetShapesTexture().id);
 
     rlBegin(RL_QUADS);
-        for (int i = 0; i < segments; i++)
-        {
-            rlColor4ub(color.r, color.g, color.b, color.a);
-
-            rlTexCoord2f(recTexShapes.x/texShapes.width, recTexShapes.y/texShapes.height);
-            rlVertex2f(center.x + sinf(DEG2RAD*angle)*innerRadius, center.y + cosf(DEG2RAD*angle)*innerRadius);
-
-            rlTexCoord2f(recTexShapes.x/texShapes.width, (recTexShapes.y + recTexShapes.height)/texShapes.height);
-            rlVertex2f(center.x + sinf(DEG2RAD*angle)*outerRadius, center.y + cosf(DEG2RAD*angle)*outerRadius);
-
-            rlTexCoord2f((recTexShapes.x + recTexShapes.width)/texShapes.width, (recTexShapes.y + recTexShapes.height)/texShapes.height);
-            rlVertex2f(center.x + sinf(DEG2RAD*(angle + stepLength))*outerRadius, center.y + cosf(DEG2RAD*(angle + stepLength))*outerRadius);
-
-            rlTexCoord2f((recTexShapes.x + recTexShapes.width)/texShapes.width, recTexShapes.y/texShapes.height);
-            rlVertex2f(center.x + sinf(DEG2RAD*(angle + stepLength))*innerRadius, center.y + cosf(DEG2RAD*(angle + stepLength))*innerRadius);
-
-            angle += stepLength;
-        }
+        rlColor4ub(color.r, color.g, color.b, color.a);
+        AddRingVertices(center, innerRadius, outerRadius, (float)startAngle, stepLength, segments);
     rlEnd();
 
     rlDisableTexture();
@@ -479,20 +609,8 @@ void DrawRing(Vector2 center, float innerRadius, float outerRadius, int startAng
     if (rlCheckBufferLimit(6*segments)) rlglDraw();
 
     rlBegin(RL_TRIANGLES);
-        for (int i = 0; i < segments; i++)
-        {
-            rlColor4ub(color.r, color.g, color.b, color.a);
-
-            rlVertex2f(center.x + sinf(DEG2RAD*angle)*innerRadius, center.y + cosf(DEG2RAD*angle)*innerRadius);
-            rlVertex2f(center.x + sinf(DEG2RAD*angle)*outerRadius, center.y + cosf(DEG2RAD*angle)*outerRadius);
-            rlVertex2f(center.x + sinf(DEG2RAD*(angle + stepLength))*innerRadius, center.y + cosf(DEG2RAD*(angle + stepLength))*innerRadius);
-
-            rlVertex2f(center.x + sinf(DEG2RAD*(angle + stepLength))*innerRadius, center.y + cosf(DEG2RAD*(angle + stepLength))*innerRadius);
-            rlVertex2f(center.x + sinf(DEG2RAD*angle)*outerRadius, center.y + cosf(DEG2RAD*angle)*outerRadius);
-            rlVertex2f(center.x + sinf(DEG2RAD*(angle + stepLength))*outerRadius, center.y + cosf(DEG2RAD*(angle + stepLength))*outerRadius);
-
-            angle += stepLength;
-        }
+        rlColor4ub(color.r, color.g, color.b, color.a);
+        AddRingVertices(center, innerRadius, outerRadius, (float)startAngle, stepLength, segments);
     rlEnd();
 #endif
 }
@@ -520,19 +638,7 @@ void DrawRingLines(Vector2 center, float innerRadius, float outerRadius, int sta
         endAngle = tmp;
     }
 
-    if (segments < 4)
-    {
-        // Calculate how many segments we need to draw a smooth circle, taken from https://stackoverflow.com/a/2244088
-        #ifndef CIRCLE_ERROR_RATE
-            #define CIRCLE_ERROR_RATE  0.5f
-        #endif
-
-        // Calculate the maximum angle between segments based on the error rate.
-        float th = acosf(2*powf(1 - CIRCLE_ERROR_RATE/outerRadius, 2) - 1);
-        segments = (endAngle - startAngle)*ceilf(2*PI/th)/360;
-
-        if (segments <= 0) segments = 4;
-    }
+    if (segments < 4) segments = GetCurveSegments(outerRadius, (float)(endAngle - startAngle));
 
     if (innerRadius <= 0.0f)
     {
@@ -541,40 +647,32 @@ void DrawRingLines(Vector2 center, float innerRadius, float outerRadius, int sta
     }
 
     float stepLength = (float)(endAngle - startAngle)/(float)segments;
-    float angle = startAngle;
 
     bool showCapLines = true;
     int limit = 4*(segments + 1);
     if ((endAngle - startAngle)%360 == 0) { limit = 4*segments; showCapLines = false; }
 
+    Vector2 caps[2] = { 0 };
+    GetCirclePoints((float)startAngle, (float)(endAngle - startAngle), 2, caps);
+
     if (rlCheckBufferLimit(limit)) rlglDraw();
 
     rlBegin(RL_LINES);
+        rlColor4ub(color.r, color.g, color.b, color.a);
+
         if (showCapLines)
         {
-            rlColor4ub(color.r, color.g, color.b, color.a);
-            rlVertex2f(center.x + sinf(DEG2RAD*angle)*outerRadius, center.y + cosf(DEG2RAD*angle)*outerRadius);
-            rlVertex2f(center.x + sinf(DEG2RAD*angle)*innerRadius, center.y + cosf(DEG2RAD*angle)*innerRadius);
+            rlVertex2f(center.x + caps[0].x*outerRadius, center.y + caps[0].y*outerRadius);
+            rlVertex2f(center.x + caps[0].x*innerRadius, center.y + caps[0].y*innerRadius);
         }
 
-        for (int i = 0; i < segments; i++)
-        {
-            rlColor4ub(color.r, color.g, color.b, color.a);
-
-            rlVertex2f(center.x + sinf(DEG2RAD*angle)*outerRadius, center.y + cosf(DEG2RAD*angle)*outerRadius);
-            rlVertex2f(center.x + sinf(DEG2RAD*(angle + stepLength))*outerRadius, center.y + cosf(DEG2RAD*(angle + stepLength))*outerRadius);
-
-            rlVertex2f(center.x + sinf(DEG2RAD*angle)*innerRadius, center.y + cosf(DEG2RAD*angle)*innerRadius);
-            rlVertex2f(center.x + sinf(DEG2RAD*(angle + stepLength))*innerRadius, center.y + cosf(DEG2RAD*(angle + stepLength))*innerRadius);
-
-            angle += stepLength;
-        }
+        AddArcVertices(center, outerRadius, (float)startAngle, stepLength, segments);
+        AddArcVertices(center, innerRadius, (float)startAngle, stepLength, segments);
 
         if (showCapLines)
         {
-            rlColor4ub(color.r, color.g, color.b, color.a);
-            rlVertex2f(center.x + sinf(DEG2RAD*angle)*outerRadius, center.y + cosf(DEG2RAD*angle)*outerRadius);
-            rlVertex2f(center.x + sinf(DEG2RAD*angle)*innerRadius, center.y + cosf(DEG2RAD*angle)*innerRadius);
+            rlVertex2f(center.x + caps[1].x*outerRadius, center.y + caps[1].y*outerRadius);
+            rlVertex2f(center.x + caps[1].x*innerRadius, center.y + caps[1].y*innerRadius);
         }
     rlEnd();
 }
@@ -733,18 +831,11 @@ void DrawRectangleRounded(Rectangle rec, float roundness, int segments, Color co
     float radius = (rec.width > rec.height)? (rec.height*roundness)/2 : (rec.width*roundness)/2;
     if (radius <= 0.0f) return;
 
+    if ((shapesRenderMode == SHAPES_RENDER_SDF) &&
+        rlDrawShapeSDF((Vector2){ rec.x + rec.width/2.0f, rec.y + rec.height/2.0f }, (Vector2){ rec.width/2.0f, rec.height/2.0f }, 0.0f, radius, 0.0f, color)) return;
+
     // Calculate number of segments to use for the corners
-    if (segments < 4)
-    {
-        // Calculate how many segments we need to draw a smooth circle, taken from https://stackoverflow.com/a/2244088
-        #ifndef CIRCLE_ERROR_RATE
-        #define CIRCLE_ERROR_RATE  0.5f
-        #endif
-        // Calculate the maximum angle between segments based on the error rate.
-        float th = acosf(2*powf(1 - CIRCLE_ERROR_RATE/radius, 2) - 1);
-        segments = ceilf(2*PI/th)/4;
-        if (segments <= 0) segments = 4;
-    }
+    if (segments < 4) segments = GetCurveSegments(radius, 90.0f);
 
     float stepLength = 90.0f/(float)segments;
 
@@ -776,44 +867,14 @@ void DrawRectangleRounded(Rectangle rec, float roundness, int segments, Color co
     const float angles[4] = { 180.0f, 90.0f, 0.0f, 270.0f };
 
 #if defined(SUPPORT_QUADS_DRAW_MODE)
-    if (rlCheckBufferLimit(16*segments/2 + 5*4)) rlglDraw();
+    if (rlCheckBufferLimit(16*(segments/2 + 1) + 5*4)) rlglDraw();
 
     rlEnableTexture(GetShapesTexture().id);
 
     rlBegin(RL_QUADS);
         // Draw all of the 4 corners: [1] Upper Left Corner, [3] Upper Right Corner, [5] Lower Right Corner, [7] Lower Left Corner
-        for (int k = 0; k < 4; ++k) // Hope the compiler is smart enough to unroll this loop
-        {
-            float angle = angles[k];
-            const Vector2 center = centers[k];
-            // NOTE: Every QUAD actually represents two segments
-            for (int i = 0; i < segments/2; i++)
-            {
-                rlColor4ub(color.r, color.g, color.b, color.a);
-                rlTexCoord2f(recTexShapes.x/texShapes.width, recTexShapes.y/texShapes.height);
-                rlVertex2f(center.x, center.y);
-                rlTexCoord2f(recTexShapes.x/texShapes.width, (recTexShapes.y + recTexShapes.height)/texShapes.height);
-                rlVertex2f(center.x + sinf(DEG2RAD*angle)*radius, center.y + cosf(DEG2RAD*angle)*radius);
-                rlTexCoord2f((recTexShapes.x + recTexShapes.width)/texShapes.width, (recTexShapes.y + recTexShapes.height)/texShapes.height);
-                rlVertex2f(center.x + sinf(DEG2RAD*(angle + stepLength))*radius, center.y + cosf(DEG2RAD*(angle + stepLength))*radius);
-                rlTexCoord2f((recTexShapes.x + recTexShapes.width)/texShapes.width, recTexShapes.y/texShapes.height);
-                rlVertex2f(center.x + sinf(DEG2RAD*(angle + stepLength*2))*radius, center.y + cosf(DEG2RAD*(angle + stepLength*2))*radius);
-                angle += (stepLength*2);
-            }
-            // NOTE: In case number of segments is odd, we add one last piece to the cake
-            if (segments%2)
-            {
-                rlColor4ub(color.r, color.g, color.b, color.a);
-                rlTexCoord2f(recTexShapes.x/texShapes.width, recTexShapes.y/texShapes.height);
-                rlVertex2f(center.x, center.y);
-                rlTexCoord2f(recTexShapes.x/texShapes.width, (recTexShapes.y + recTexShapes.height)/texShapes.height);
-                rlVertex2f(center.x + sinf(DEG2RAD*angle)*radius, center.y + cosf(DEG2RAD*angle)*radius);
-                rlTexCoord2f((recTexShapes.x + recTexShapes.width)/texShapes.width, (recTexShapes.y + recTexShapes.height)/texShapes.height);
-                rlVertex2f(center.x + sinf(DEG2RAD*(angle + stepLength))*radius, center.y + cosf(DEG2RAD*(angle + stepLength))*radius);
-                rlTexCoord2f((recTexShapes.x + recTexShapes.width)/texShapes.width, recTexShapes.y/texShapes.height);
-                rlVertex2f(center.x, center.y);
-            }
-        }
+        rlColor4ub(color.r, color.g, color.b, color.a);
+        for (int k = 0; k < 4; ++k) AddCircleSectorVertices(centers[k], radius, angles[k], stepLength, segments);
 
         // [2] Upper Rectangle
         rlColor4ub(color.r, color.g, color.b, color.a);
@@ -877,19 +938,8 @@ void DrawRectangleRounded(Rectangle rec, float roundness, int segments, Color co
 
     rlBegin(RL_TRIANGLES);
         // Draw all of the 4 corners: [1] Upper Left Corner, [3] Upper Right Corner, [5] Lower Right Corner, [7] Lower Left Corner
-        for (int k = 0; k < 4; ++k) // Hope the compiler is smart enough to unroll this loop
-        {
-            float angle = angles[k];
-            const Vector2 center = centers[k];
-            for (int i = 0; i < segments; i++)
-            {
-                rlColor4ub(color.r, color.g, color.b, color.a);
-                rlVertex2f(center.x, center.y);
-                rlVertex2f(center.x + sinf(DEG2RAD*angle)*radius, center.y + cosf(DEG2RAD*angle)*radius);
-                rlVertex2f(center.x + sinf(DEG2RAD*(angle + stepLength))*radius, center.y + cosf(DEG2RAD*(angle + stepLength))*radius);
-                angle += stepLength;
-            }
-        }
+        rlColor4ub(color.r, color.g, color.b, color.a);
+        for (int k = 0; k < 4; ++k) AddCircleSectorVertices(centers[k], radius, angles[k], stepLength, segments);
 
         // [2] Upper Rectangle
         rlColor4ub(color.r, color.g, color.b, color.a);
@@ -957,18 +1007,12 @@ void DrawRectangleRoundedLines(Rectangle rec, float roundness, int segments, int
     float radius = (rec.width > rec.height)? (rec.height*roundness)/2 : (rec.width*roundness)/2;
     if (radius <= 0.0f) return;
 
+    // Outline is drawn outside rectangle, lineThick wide
+    if ((shapesRenderMode == SHAPES_RENDER_SDF) && (lineThick > 0) &&
+        rlDrawShapeSDF((Vector2){ rec.x + rec.width/2.0f, rec.y + rec.height/2.0f }, (Vector2){ rec.width/2.0f + lineThick, rec.height/2.0f + lineThick }, 0.0f, radius + lineThick, (float)lineThick, color)) return;
+
     // Calculate number of segments to use for the corners
-    if (segments < 4)
-    {
-        // Calculate how many segments we need to draw a smooth circle, taken from https://stackoverflow.com/a/2244088
-        #ifndef CIRCLE_ERROR_RATE
-        #define CIRCLE_ERROR_RATE  0.5f
-        #endif
-        // Calculate the maximum angle between segments based on the error rate.
-        float th = acosf(2*powf(1 - CIRCLE_ERROR_RATE/radius, 2) - 1);
-        segments = ceilf(2*PI/th)/2;
-        if (segments <= 0) segments = 4;
-    }
+    if (segments < 4) segments = GetCurveSegments(radius, 90.0f);
 
     float stepLength = 90.0f/(float)segments;
     const float outerRadius = radius + (float)lineThick, innerRadius = radius;
@@ -1015,25 +1059,8 @@ void DrawRectangleRoundedLines(Rectangle rec, float roundness, int segments, int
 
         rlBegin(RL_QUADS);
             // Draw all of the 4 corners first: Upper Left Corner, Upper Right Corner, Lower Right Corner, Lower Left Corner
-            for (int k = 0; k < 4; ++k) // Hope the compiler is smart enough to unroll this loop
-            {
-                float angle = angles[k];
-                const Vector2 center = centers[k];
-                for (int i = 0; i < segments; i++)
-                {
-                    rlColor4ub(color.r, color.g, color.b, color.a);
-                    rlTexCoord2f(recTexShapes.x/texShapes.width, recTexShapes.y/texShapes.height);
-                    rlVertex2f(center.x + sinf(DEG2RAD*angle)*innerRadius, center.y + cosf(DEG2RAD*angle)*innerRadius);
-                    rlTexCoord2f(recTexShapes.x/texShapes.width, (recTexShapes.y + recTexShapes.height)/texShapes.height);
-                    rlVertex2f(center.x + sinf(DEG2RAD*angle)*outerRadius, center.y + cosf(DEG2RAD*angle)*outerRadius);
-                    rlTexCoord2f((recTexShapes.x + recTexShapes.width)/texShapes.width, (recTexShapes.y + recTexShapes.height)/texShapes.height);
-                    rlVertex2f(center.x + sinf(DEG2RAD*(angle + stepLength))*outerRadius, center.y + cosf(DEG2RAD*(angle + stepLength))*outerRadius);
-                    rlTexCoord2f((recTexShapes.x + recTexShapes.width)/texShapes.width, recTexShapes.y/texShapes.height);
-                    rlVertex2f(center.x + sinf(DEG2RAD*(angle + stepLength))*innerRadius, center.y + cosf(DEG2RAD*(angle + stepLength))*innerRadius);
-
-                    angle += stepLength;
-                }
-            }
+            rlColor4ub(color.r, color.g, color.b, color.a);
+            for (int k = 0; k < 4; ++k) AddRingVertices(centers[k], innerRadius, outerRadius, angles[k], stepLength, segments);
 
             // Upper rectangle
             rlColor4ub(color.r, color.g, color.b, color.a);
@@ -1087,26 +1114,8 @@ void DrawRectangleRoundedLines(Rectangle rec, float roundness, int segments, int
         rlBegin(RL_TRIANGLES);
 
             // Draw all of the 4 corners first: Upper Left Corner, Upper Right Corner, Lower Right Corner, Lower Left Corner
-            for (int k = 0; k < 4; ++k) // Hope the compiler is smart enough to unroll this loop
-            {
-                float angle = angles[k];
-                const Vector2 center = centers[k];
-
-                for (int i = 0; i < segments; i++)
-                {
-                    rlColor4ub(color.r, color.g, color.b, color.a);
-
-                    rlVertex2f(center.x + sinf(DEG2RAD*angle)*innerRadius, center.y + cosf(DEG2RAD*angle)*innerRadius);
-                    rlVertex2f(center.x + sinf(DEG2RAD*angle)*outerRadius, center.y + cosf(DEG2RAD*angle)*outerRadius);
-                    rlVertex2f(center.x + sinf(DEG2RAD*(angle + stepLength))*innerRadius, center.y + cosf(DEG2RAD*(angle + stepLength))*innerRadius);
-
-                    rlVertex2f(center.x + sinf(DEG2RAD*(angle + stepLength))*innerRadius, center.y + cosf(DEG2RAD*(angle + stepLength))*innerRadius);
-                    rlVertex2f(center.x + sinf(DEG2RAD*angle)*outerRadius, center.y + cosf(DEG2RAD*angle)*outerRadius);
-                    rlVertex2f(center.x + sinf(DEG2RAD*(angle + stepLength))*outerRadius, center.y + cosf(DEG2RAD*(angle + stepLength))*outerRadius);
-
-                    angle += stepLength;
-                }
-            }
+            rlColor4ub(color.r, color.g, color.b, color.a);
+            for (int k = 0; k < 4; ++k) AddRingVertices(centers[k], innerRadius, outerRadius, angles[k], stepLength, segments);
 
             // Upper rectangle
             rlColor4ub(color.r, color.g, color.b, color.a);
@@ -1154,19 +1163,8 @@ void DrawRectangleRoundedLines(Rectangle rec, float roundness, int segments, int
         rlBegin(RL_LINES);
 
             // Draw all of the 4 corners first: Upper Left Corner, Upper Right Corner, Lower Right Corner, Lower Left Corner
-            for (int k = 0; k < 4; ++k) // Hope the compiler is smart enough to unroll this loop
-            {
-                float angle = angles[k];
-                const Vector2 center = centers[k];
-
-                for (int i = 0; i < segments; i++)
-                {
-                    rlColor4ub(color.r, color.g, color.b, color.a);
-                    rlVertex2f(center.x + sinf(DEG2RAD*angle)*outerRadius, center.y + cosf(DEG2RAD*angle)*outerRadius);
-                    rlVertex2f(center.x + sinf(DEG2RAD*(angle + stepLength))*outerRadius, center.y + cosf(DEG2RAD*(angle + stepLength))*outerRadius);
-                    angle += stepLength;
-                }
-            }
+            rlColor4ub(color.r, color.g, color.b, color.a);
+            for (int k = 0; k < 4; ++k) AddArcVertices(centers[k], outerRadius, angles[k], stepLength, segments);
             // And now the remaining 4 lines
             for(int i = 0; i < 8; i += 2)
             {
@@ -1298,9 +1296,12 @@ void DrawTriangleStrip(Vector2 *points, int pointsCount, Color color)
 void DrawPoly(Vector2 center, int sides, float radius, float rotation, Color color)
 {
     if (sides < 3) sides = 3;
-    float centralAngle = 0.0f;
 
-    if (rlCheckBufferLimit(4*(360/sides))) rlglDraw();
+#if defined(SUPPORT_QUADS_DRAW_MODE)
+    if (rlCheckBufferLimit(4*(sides/2 + 1))) rlglDraw();
+#else
+    if (rlCheckBufferLimit(3*sides)) rlglDraw();
+#endif
 
     rlPushMatrix();
         rlTranslatef(center.x, center.y, 0.0f);
@@ -1310,37 +1311,14 @@ void DrawPoly(Vector2 center, int sides, float radius, float rotation, Color col
         rlEnableTexture(GetShapesTexture().id);
 
         rlBegin(RL_QUADS);
-            for (int i = 0; i < sides; i++)
-            {
-                rlColor4ub(color.r, color.g, color.b, color.a);
-
-                rlTexCoord2f(recTexShapes.x/texShapes.width, recTexShapes.y/texShapes.height);
-                rlVertex2f(0, 0);
-
-                rlTexCoord2f(recTexShapes.x/texShapes.width, (recTexShapes.y + recTexShapes.height)/texShapes.height);
-                rlVertex2f(sinf(DEG2RAD*centralAngle)*radius, cosf(DEG2RAD*centralAngle)*radius);
-
-                rlTexCoord2f((recTexShapes.x + recTexShapes.width)/texShapes.width, (recTexShapes.y + recTexShapes.height)/texShapes.height);
-                rlVertex2f(sinf(DEG2RAD*centralAngle)*radius, cosf(DEG2RAD*centralAngle)*radius);
-
-                centralAngle += 360.0f/(float)sides;
-                rlTexCoord2f((recTexShapes.x + recTexShapes.width)/texShapes.width, recTexShapes.y/texShapes.height);
-                rlVertex2f(sinf(DEG2RAD*centralAngle)*radius, cosf(DEG2RAD*centralAngle)*radius);
-            }
+            rlColor4ub(color.r, color.g, color.b, color.a);
+            AddCircleSectorVertices((Vector2){ 0.0f, 0.0f }, radius, 0.0f, 360.0f/(float)sides, sides);
         rlEnd();
         rlDisableTexture();
 #else
         rlBegin(RL_TRIANGLES);
-            for (int i = 0; i < sides; i++)
-            {
-                rlColor4ub(color.r, color.g, color.b, color.a);
-
-                rlVertex2f(0, 0);
-                rlVertex2f(sinf(DEG2RAD*centralAngle)*radius, cosf(DEG2RAD*centralAngle)*radius);
-
-                centralAngle += 360.0f/(float)sides;
-                rlVertex2f(sinf(DEG2RAD*centralAngle)*radius, cosf(DEG2RAD*centralAngle)*radius);
-            }
+            rlColor4ub(color.r, color.g, color.b, color.a);
+            AddCircleSectorVertices((Vector2){ 0.0f, 0.0f }, radius, 0.0f, 360.0f/(float)sides, sides);
         rlEnd();
 #endif
     rlPopMatrix();
@@ -1350,63 +1328,228 @@ void DrawPoly(Vector2 center, int sides, float radius, float rotation, Color col
 void DrawPolyLines(Vector2 center, int sides, float radius, float rotation, Color color)
 {
     if (sides < 3) sides = 3;
-    float centralAngle = 0.0f;
 
-    if (rlCheckBufferLimit(3*(360/sides))) rlglDraw();
+    if (rlCheckBufferLimit(2*sides)) rlglDraw();
 
     rlPushMatrix();
         rlTranslatef(center.x, center.y, 0.0f);
         rlRotatef(rotation, 0.0f, 0.0f, 1.0f);
-        
-        rlBegin(RL_LINES);
-            for (int i = 0; i < sides; i++)
-            {
-                rlColor4ub(color.r, color.g, color.b, color.a);
 
-                rlVertex2f(sinf(DEG2RAD*centralAngle)*radius, cosf(DEG2RAD*centralAngle)*radius);
-                centralAngle += 360.0f/(float)sides;
-                rlVertex2f(sinf(DEG2RAD*centralAngle)*radius, cosf(DEG2RAD*centralAngle)*radius);
-            }
+        rlBegin(RL_LINES);
+            rlColor4ub(color.r, color.g, color.b, color.a);
+            AddArcVertices((Vector2){ 0.0f, 0.0f }, radius, 0.0f, 360.0f/(float)sides, sides);
         rlEnd();
     rlPopMatrix();
 }
 
-// Define default texture used to draw shapes
-void SetShapesTexture(Texture2D texture, Rectangle source)
+// Load polygon triangles, outline points first followed by holes points (holes: first point index of every hole)
+// NOTE: Concave polygons with holes are triangulated by ear clipping (holes are bridged to outline first),
+// triangles indices can be reused to draw static polygons (DrawPolygonTriangles()), also into a retained batch
+int *LoadPolygonTriangles(const Vector2 *points, int pointsCount, const int *holes, int holesCount, int *trianglesCount)
 {
-    texShapes = texture;
-    recTexShapes = source;
-}
+    *trianglesCount = 0;
 
-//----------------------------------------------------------------------------------
-// Module Functions Definition - Collision Detection functions
-//----------------------------------------------------------------------------------
+    if ((points == NULL) || (pointsCount < 3)) return NULL;
+    if (holes == NULL) holesCount = 0;
 
-// Check if point is inside rectangle
-bool CheckCollisionPointRec(Vector2 point, Rectangle rec)
-{
-    bool collision = false;
+    // NOTE: Every hole bridge duplicates two nodes
+    PolygonNodes nodes = { 0 };
+    nodes.points = points;
+    nodes.index = (int *)RL_MALLOC((pointsCount + 2*holesCount)*3*sizeof(int));
+    nodes.prev = nodes.index + pointsCount + 2*holesCount;
+    nodes.next = nodes.prev + pointsCount + 2*holesCount;
 
-    if ((point.x >= rec.x) && (point.x <= (rec.x + rec.width)) && (point.y >= rec.y) && (point.y <= (rec.y + rec.height))) collision = true;
+    int outlineEnd = (holesCount > 0)? holes[0] : pointsCount;
+    int outer = LinkPolygonRing(&nodes, 0, outlineEnd, true);
 
-    return collision;
-}
+    if ((outer >= 0) && (holesCount > 0))
+    {
+        // Holes are bridged from left to right, every hole from its leftmost node
+        int *lefts = (int *)RL_MALLOC(holesCount*sizeof(int));
+        int leftsCount = 0;
 
-// Check if point is inside circle
-bool CheckCollisionPointCircle(Vector2 point, Vector2 center, float radius)
-{
-    return CheckCollisionCircles(point, 0, center, radius);
-}
+        for (int i = 0; i < holesCount; i++)
+        {
+            int end = (i < (holesCount - 1))? holes[i + 1] : pointsCount;
+            int hole = LinkPolygonRing(&nodes, holes[i], end, false);
+            if (hole < 0) continue;
 
-// Check if point is inside a triangle defined by three points (p1, p2, p3)
-bool CheckCollisionPointTriangle(Vector2 point, Vector2 p1, Vector2 p2, Vector2 p3)
-{
-    bool collision = false;
+            int left = hole;
+            int node = hole;
 
-    float alpha = ((p2.y - p3.y)*(point.x - p3.x) + (p3.x - p2.x)*(point.y - p3.y)) /
-                  ((p2.y - p3.y)*(p1.x - p3.x) + (p3.x - p2.x)*(p1.y - p3.y));
+            do
+            {
+                if (points[nodes.index[node]].x < points[nodes.index[left]].x) left = node;
+                node = nodes.next[node];
+            } while (node != hole);
+
+            // Insertion sort by x (holes count is usually small)
+            int k = leftsCount++;
+            while ((k > 0) && (points[nodes.index[lefts[k - 1]]].x > points[nodes.index[left]].x)) { lefts[k] = lefts[k - 1]; k--; }
+            lefts[k] = left;
+        }
 
-    float beta = ((p3.y - p1.y)*(point.x - p3.x) + (p1.x - p3.x)*(point.y - p3.y)) /
+        for (int i = 0; i < leftsCount; i++)
+        {
+            int bridge = FindHoleBridge(&nodes, lefts[i], outer);
+            if (bridge >= 0) SplitPolygon(&nodes, bridge, lefts[i]);
+        }
+
+        RL_FREE(lefts);
+    }
+
+    int *indices = NULL;
+
+    if (outer >= 0)
+    {
+        // NOTE: Triangles count is nodes count minus 2
+        indices = (int *)RL_MALLOC((nodes.count - 2)*3*sizeof(int));
+        *trianglesCount = ClipPolygonEars(&nodes, outer, indices);
+    }
+
+    RL_FREE(nodes.index);
+
+    if (*trianglesCount == 0)
+    {
+        RL_FREE(indices);
+        indices = NULL;
+    }
+
+    return indices;
+}
+
+// Unload polygon triangles indices loaded with LoadPolygonTriangles()
+void UnloadPolygonTriangles(int *indices)
+{
+    RL_FREE(indices);
+}
+
+// Draw polygon triangles (points indexed by triangles), added to batch in bulk
+void DrawPolygonTriangles(const Vector2 *points, const int *indices, int trianglesCount, Color color)
+{
+    if ((points == NULL) || (indices == NULL) || (trianglesCount <= 0)) return;
+
+    const float depth = rlGetCurrentDepth();
+
+#if defined(SUPPORT_QUADS_DRAW_MODE)
+    // NOTE: Every triangle is drawn as a quad repeating its second vertex (same as DrawTriangle())
+    float vertices[SHAPES_STROKE_QUADS*4*3];
+    float texcoords[SHAPES_STROKE_QUADS*4*2];
+
+    Texture2D texture = GetShapesTexture();
+    const float u0 = recTexShapes.x/texture.width, u1 = (recTexShapes.x + recTexShapes.width)/texture.width;
+    const float v0 = recTexShapes.y/texture.height, v1 = (recTexShapes.y + recTexShapes.height)/texture.height;
+
+    for (int i = 0; i < SHAPES_STROKE_QUADS; i++)
+    {
+        const float quadTexcoords[4*2] = { u0, v0, u0, v1, u1, v1, u1, v0 };
+        memcpy(texcoords + i*4*2, quadTexcoords, sizeof(quadTexcoords));
+    }
+
+    for (int start = 0; start < trianglesCount; start += SHAPES_STROKE_QUADS)
+    {
+        int count = ((trianglesCount - start) < SHAPES_STROKE_QUADS)? (trianglesCount - start) : SHAPES_STROKE_QUADS;
+
+        for (int i = 0; i < count; i++)
+        {
+            const int *triangle = indices + (start + i)*3;
+            const int corners[4] = { triangle[0], triangle[1], triangle[1], triangle[2] };
+
+            for (int k = 0; k < 4; k++)
+            {
+                vertices[(i*4 + k)*3] = points[corners[k]].x;
+                vertices[(i*4 + k)*3 + 1] = points[corners[k]].y;
+                vertices[(i*4 + k)*3 + 2] = depth;
+            }
+        }
+
+        if (rlCheckBufferLimit(4*count)) rlglDraw();
+
+        rlEnableTexture(texture.id);
+
+        rlBegin(RL_QUADS);
+            rlColor4ub(color.r, color.g, color.b, color.a);
+            rlQuadBatch(vertices, texcoords, NULL, count);
+        rlEnd();
+
+        rlDisableTexture();
+    }
+#else
+    float vertices[SHAPES_STROKE_QUADS*3*3];
+
+    for (int start = 0; start < trianglesCount; start += SHAPES_STROKE_QUADS)
+    {
+        int count = ((trianglesCount - start) < SHAPES_STROKE_QUADS)? (trianglesCount - start) : SHAPES_STROKE_QUADS;
+
+        for (int i = 0; i < count*3; i++)
+        {
+            vertices[i*3] = points[indices[start*3 + i]].x;
+            vertices[i*3 + 1] = points[indices[start*3 + i]].y;
+            vertices[i*3 + 2] = depth;
+        }
+
+        if (rlCheckBufferLimit(3*count)) rlglDraw();
+
+        rlBegin(RL_TRIANGLES);
+            rlColor4ub(color.r, color.g, color.b, color.a);
+            rlVertex3fv(vertices, count*3);
+        rlEnd();
+    }
+#endif
+}
+
+// Define default texture used to draw shapes
+void SetShapesTexture(Texture2D texture, Rectangle source)
+{
+    texShapes = texture;
+    recTexShapes = source;
+}
+
+// Define shapes render mode (ShapesRenderMode)
+// NOTE: SDF mode draws filled circles, full rings, rounded rectangles and thick lines as one quad each,
+// evaluated on GPU with antialiased edges (shapes texture is not used), unsupported cases are tessellated
+void SetShapesRenderMode(int mode)
+{
+    shapesRenderMode = mode;
+}
+
+// Define max error (in pixels) allowed for automatic curve segments
+// NOTE: Used by circular shapes when segments < 4, lower values generate more segments
+void SetShapesTessellationError(float maxError)
+{
+    if (maxError > 0.0f) tessellationError = maxError;
+    else tessellationError = SHAPES_TESSELLATION_ERROR;
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition - Collision Detection functions
+//----------------------------------------------------------------------------------
+
+// Check if point is inside rectangle
+bool CheckCollisionPointRec(Vector2 point, Rectangle rec)
+{
+    bool collision = false;
+
+    if ((point.x >= rec.x) && (point.x <= (rec.x + rec.width)) && (point.y >= rec.y) && (point.y <= (rec.y + rec.height))) collision = true;
+
+    return collision;
+}
+
+// Check if point is inside circle
+bool CheckCollisionPointCircle(Vector2 point, Vector2 center, float radius)
+{
+    return CheckCollisionCircles(point, 0, center, radius);
+}
+
+// Check if point is inside a triangle defined by three points (p1, p2, p3)
+bool CheckCollisionPointTriangle(Vector2 point, Vector2 p1, Vector2 p2, Vector2 p3)
+{
+    bool collision = false;
+
+    float alpha = ((p2.y - p3.y)*(point.x - p3.x) + (p3.x - p2.x)*(point.y - p3.y)) /
+                  ((p2.y - p3.y)*(p1.x - p3.x) + (p3.x - p2.x)*(p1.y - p3.y));
+
+    float beta = ((p3.y - p1.y)*(point.x - p3.x) + (p1.x - p3.x)*(point.y - p3.y)) /
                  ((p2.y - p3.y)*(p1.x - p3.x) + (p3.x - p2.x)*(p1.y - p3.y));
 
     float gamma = 1.0f - alpha - beta;
@@ -1442,6 +1585,112 @@ bool CheckCollisionCircles(Vector2 center1, float radius1, Vector2 center2, floa
     return collision;
 }
 
+// Check collision between rectangle and rectangles set (batched), returns number of rectangles hit
+// NOTE: hitMask (optional) must hold (recs.count + 31)/32 values, hitIndices (optional) must hold recs.count values
+int CheckCollisionRecsBatch(Rectangle rec, RectangleSet recs, unsigned int *hitMask, int *hitIndices)
+{
+    if (hitMask != NULL) memset(hitMask, 0, ((recs.count + 31)/32)*sizeof(unsigned int));
+
+    int hitCount = 0;
+    int i = 0;
+
+#if defined(SHAPES_SIMD_SSE)
+    __m128 minX = _mm_set1_ps(rec.x), maxX = _mm_set1_ps(rec.x + rec.width);
+    __m128 minY = _mm_set1_ps(rec.y), maxY = _mm_set1_ps(rec.y + rec.height);
+
+    for (; i + 4 <= recs.count; i += 4)
+    {
+        __m128 x = _mm_loadu_ps(recs.x + i);
+        __m128 y = _mm_loadu_ps(recs.y + i);
+
+        __m128 overlapX = _mm_and_ps(_mm_cmplt_ps(minX, _mm_add_ps(x, _mm_loadu_ps(recs.width + i))), _mm_cmpgt_ps(maxX, x));
+        __m128 overlapY = _mm_and_ps(_mm_cmplt_ps(minY, _mm_add_ps(y, _mm_loadu_ps(recs.height + i))), _mm_cmpgt_ps(maxY, y));
+
+        unsigned int mask = (unsigned int)_mm_movemask_ps(_mm_and_ps(overlapX, overlapY));
+        if (mask != 0) hitCount = StoreBatchHits(i, mask, hitMask, hitIndices, hitCount);
+    }
+#elif defined(SHAPES_SIMD_NEON)
+    float32x4_t minX = vdupq_n_f32(rec.x), maxX = vdupq_n_f32(rec.x + rec.width);
+    float32x4_t minY = vdupq_n_f32(rec.y), maxY = vdupq_n_f32(rec.y + rec.height);
+
+    for (; i + 4 <= recs.count; i += 4)
+    {
+        float32x4_t x = vld1q_f32(recs.x + i);
+        float32x4_t y = vld1q_f32(recs.y + i);
+
+        uint32x4_t overlapX = vandq_u32(vcltq_f32(minX, vaddq_f32(x, vld1q_f32(recs.width + i))), vcgtq_f32(maxX, x));
+        uint32x4_t overlapY = vandq_u32(vcltq_f32(minY, vaddq_f32(y, vld1q_f32(recs.height + i))), vcgtq_f32(maxY, y));
+
+        unsigned int mask = GetLanesMask(vandq_u32(overlapX, overlapY));
+        if (mask != 0) hitCount = StoreBatchHits(i, mask, hitMask, hitIndices, hitCount);
+    }
+#endif
+
+    // Remaining rectangles (or all rectangles without SIMD support)
+    for (; i < recs.count; i++)
+    {
+        if ((rec.x < (recs.x[i] + recs.width[i]) && (rec.x + rec.width) > recs.x[i]) &&
+            (rec.y < (recs.y[i] + recs.height[i]) && (rec.y + rec.height) > recs.y[i])) hitCount = StoreBatchHits(i, 1, hitMask, hitIndices, hitCount);
+    }
+
+    return hitCount;
+}
+
+// Check collision between circle and circles set (batched), returns number of circles hit
+// NOTE: hitMask (optional) must hold (circles.count + 31)/32 values, hitIndices (optional) must hold circles.count values
+int CheckCollisionCirclesBatch(Vector2 center, float radius, CircleSet circles, unsigned int *hitMask, int *hitIndices)
+{
+    if (hitMask != NULL) memset(hitMask, 0, ((circles.count + 31)/32)*sizeof(unsigned int));
+
+    int hitCount = 0;
+    int i = 0;
+
+    // NOTE: Squared distances are compared, no square root required
+#if defined(SHAPES_SIMD_SSE)
+    __m128 centerX = _mm_set1_ps(center.x), centerY = _mm_set1_ps(center.y), radius1 = _mm_set1_ps(radius);
+
+    for (; i + 4 <= circles.count; i += 4)
+    {
+        __m128 dx = _mm_sub_ps(_mm_loadu_ps(circles.x + i), centerX);
+        __m128 dy = _mm_sub_ps(_mm_loadu_ps(circles.y + i), centerY);
+        __m128 radiusSum = _mm_add_ps(radius1, _mm_loadu_ps(circles.radius + i));
+
+        __m128 collision = _mm_cmple_ps(_mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy)), _mm_mul_ps(radiusSum, radiusSum));
+        collision = _mm_and_ps(collision, _mm_cmpge_ps(radiusSum, _mm_setzero_ps()));
+
+        unsigned int mask = (unsigned int)_mm_movemask_ps(collision);
+        if (mask != 0) hitCount = StoreBatchHits(i, mask, hitMask, hitIndices, hitCount);
+    }
+#elif defined(SHAPES_SIMD_NEON)
+    float32x4_t centerX = vdupq_n_f32(center.x), centerY = vdupq_n_f32(center.y), radius1 = vdupq_n_f32(radius);
+
+    for (; i + 4 <= circles.count; i += 4)
+    {
+        float32x4_t dx = vsubq_f32(vld1q_f32(circles.x + i), centerX);
+        float32x4_t dy = vsubq_f32(vld1q_f32(circles.y + i), centerY);
+        float32x4_t radiusSum = vaddq_f32(radius1, vld1q_f32(circles.radius + i));
+
+        uint32x4_t collision = vcleq_f32(vaddq_f32(vmulq_f32(dx, dx), vmulq_f32(dy, dy)), vmulq_f32(radiusSum, radiusSum));
+        collision = vandq_u32(collision, vcgeq_f32(radiusSum, vdupq_n_f32(0.0f)));
+
+        unsigned int mask = GetLanesMask(collision);
+        if (mask != 0) hitCount = StoreBatchHits(i, mask, hitMask, hitIndices, hitCount);
+    }
+#endif
+
+    // Remaining circles (or all circles without SIMD support)
+    for (; i < circles.count; i++)
+    {
+        float dx = circles.x[i] - center.x;
+        float dy = circles.y[i] - center.y;
+        float radiusSum = radius + circles.radius[i];
+
+        if ((radiusSum >= 0.0f) && ((dx*dx + dy*dy) <= radiusSum*radiusSum)) hitCount = StoreBatchHits(i, 1, hitMask, hitIndices, hitCount);
+    }
+
+    return hitCount;
+}
+
 // Check collision between circle and rectangle
 // NOTE: Reviewed version to take into account corner limit case
 bool CheckCollisionCircleRec(Vector2 center, float radius, Rectangle rec)
@@ -1531,6 +1780,207 @@ Rectangle GetCollisionRec(Rectangle rec1, Rectangle rec2)
     return retRec;
 }
 
+// Load spatial grid, hashed uniform grid for broadphase collision queries on rectangles and circles
+// NOTE: Entries are stored in every cell covered by their bounds, cellSize should be close to usual entries size
+SpatialGrid LoadSpatialGrid(float cellSize)
+{
+    SpatialGrid grid = { 0 };
+
+    SpatialGridData *data = (SpatialGridData *)RL_CALLOC(1, sizeof(SpatialGridData));
+    data->cellSize = (cellSize > 0.0f)? cellSize : 64.0f;
+    data->freeEntry = -1;
+    data->freeItem = -1;
+    data->bucketCount = SHAPES_GRID_BUCKETS;
+    data->buckets = (int *)RL_MALLOC(data->bucketCount*sizeof(int));
+    memset(data->buckets, 0xff, data->bucketCount*sizeof(int));     // All buckets empty (-1)
+
+    grid.gridData = data;
+
+    return grid;
+}
+
+// Unload spatial grid data
+void UnloadSpatialGrid(SpatialGrid grid)
+{
+    SpatialGridData *data = (SpatialGridData *)grid.gridData;
+
+    if (data != NULL)
+    {
+        RL_FREE(data->entries);
+        RL_FREE(data->items);
+        RL_FREE(data->buckets);
+        RL_FREE(data);
+    }
+}
+
+// Add rectangle entry to spatial grid, returns entry id (used to update or remove entry)
+// NOTE: userId is returned by queries, entry id is kept while entry is not removed
+int AddSpatialGridRec(SpatialGrid *grid, Rectangle rec, int userId)
+{
+    if ((grid == NULL) || (grid->gridData == NULL)) return -1;
+
+    SpatialGridData *data = (SpatialGridData *)grid->gridData;
+
+    int entry = AllocateSpatialGridEntry(data);
+    data->entries[entry].userId = userId;
+
+    SetSpatialGridEntry(data, entry, rec, -1.0f);
+    InsertSpatialGridCells(data, entry);
+    grid->entryCount++;
+
+    return entry;
+}
+
+// Add circle entry to spatial grid, returns entry id (used to update or remove entry)
+int AddSpatialGridCircle(SpatialGrid *grid, Vector2 center, float radius, int userId)
+{
+    if ((grid == NULL) || (grid->gridData == NULL)) return -1;
+
+    SpatialGridData *data = (SpatialGridData *)grid->gridData;
+
+    int entry = AllocateSpatialGridEntry(data);
+    data->entries[entry].userId = userId;
+
+    if (radius < 0.0f) radius = 0.0f;
+    SetSpatialGridEntry(data, entry, (Rectangle){ center.x - radius, center.y - radius, 2.0f*radius, 2.0f*radius }, radius);
+    InsertSpatialGridCells(data, entry);
+    grid->entryCount++;
+
+    return entry;
+}
+
+// Update spatial grid rectangle entry, returns true if entry was moved to other cells
+// NOTE: Circle entries become rectangle entries
+bool UpdateSpatialGridRec(SpatialGrid *grid, int entry, Rectangle rec)
+{
+    if ((grid == NULL) || (grid->gridData == NULL)) return false;
+
+    SpatialGridData *data = (SpatialGridData *)grid->gridData;
+    if ((entry < 0) || (entry >= data->entryCapacity) || (data->entries[entry].next != -2)) return false;
+
+    SpatialGridEntry previous = data->entries[entry];
+    SetSpatialGridEntry(data, entry, rec, -1.0f);
+
+    SpatialGridEntry *current = &data->entries[entry];
+    if ((current->minX == previous.minX) && (current->minY == previous.minY) &&
+        (current->maxX == previous.maxX) && (current->maxY == previous.maxY)) return false;
+
+    // Items are removed from previous cells, then inserted in new cells
+    SpatialGridEntry moved = *current;
+    *current = previous;
+    RemoveSpatialGridCells(data, entry);
+    data->entries[entry] = moved;
+    InsertSpatialGridCells(data, entry);
+
+    return true;
+}
+
+// Update spatial grid circle entry, returns true if entry was moved to other cells
+// NOTE: Rectangle entries become circle entries
+bool UpdateSpatialGridCircle(SpatialGrid *grid, int entry, Vector2 center, float radius)
+{
+    if ((grid == NULL) || (grid->gridData == NULL)) return false;
+
+    SpatialGridData *data = (SpatialGridData *)grid->gridData;
+    if ((entry < 0) || (entry >= data->entryCapacity) || (data->entries[entry].next != -2)) return false;
+
+    if (radius < 0.0f) radius = 0.0f;
+
+    SpatialGridEntry previous = data->entries[entry];
+    SetSpatialGridEntry(data, entry, (Rectangle){ center.x - radius, center.y - radius, 2.0f*radius, 2.0f*radius }, radius);
+
+    SpatialGridEntry *current = &data->entries[entry];
+    if ((current->minX == previous.minX) && (current->minY == previous.minY) &&
+        (current->maxX == previous.maxX) && (current->maxY == previous.maxY)) return false;
+
+    SpatialGridEntry moved = *current;
+    *current = previous;
+    RemoveSpatialGridCells(data, entry);
+    data->entries[entry] = moved;
+    InsertSpatialGridCells(data, entry);
+
+    return true;
+}
+
+// Remove entry from spatial grid
+void RemoveSpatialGridEntry(SpatialGrid *grid, int entry)
+{
+    if ((grid == NULL) || (grid->gridData == NULL)) return;
+
+    SpatialGridData *data = (SpatialGridData *)grid->gridData;
+    if ((entry < 0) || (entry >= data->entryCapacity) || (data->entries[entry].next != -2)) return;
+
+    RemoveSpatialGridCells(data, entry);
+
+    data->entries[entry].next = data->freeEntry;
+    data->freeEntry = entry;
+    grid->entryCount--;
+}
+
+// Get spatial grid entries overlapping rectangle, returns number of user ids written (up to maxCount)
+int QuerySpatialGridRec(SpatialGrid grid, Rectangle rec, int *userIds, int maxCount)
+{
+    SpatialGridEntry shape = { 0 };
+    shape.bounds = rec;
+    shape.radius = -1.0f;
+
+    return QuerySpatialGridShape((SpatialGridData *)grid.gridData, &shape, userIds, maxCount);
+}
+
+// Get spatial grid entries overlapping circle, returns number of user ids written (up to maxCount)
+int QuerySpatialGridCircle(SpatialGrid grid, Vector2 center, float radius, int *userIds, int maxCount)
+{
+    if (radius < 0.0f) radius = 0.0f;
+
+    SpatialGridEntry shape = { 0 };
+    shape.bounds = (Rectangle){ center.x - radius, center.y - radius, 2.0f*radius, 2.0f*radius };
+    shape.radius = radius;
+
+    return QuerySpatialGridShape((SpatialGridData *)grid.gridData, &shape, userIds, maxCount);
+}
+
+// Get spatial grid overlapping entries pairs (broadphase with exact shapes check), returns number of pairs written (up to maxPairs)
+// NOTE: userIdPairs must hold 2*maxPairs values, every pair is reported once
+int QuerySpatialGridPairs(SpatialGrid grid, int *userIdPairs, int maxPairs)
+{
+    const SpatialGridData *data = (const SpatialGridData *)grid.gridData;
+    if ((data == NULL) || (userIdPairs == NULL) || (maxPairs <= 0)) return 0;
+
+    int count = 0;
+
+    for (int i = 0; (i < data->entryCapacity) && (count < maxPairs); i++)
+    {
+        const SpatialGridEntry *entry = &data->entries[i];
+        if (entry->next != -2) continue;
+
+        for (int y = entry->minY; (y <= entry->maxY) && (count < maxPairs); y++)
+        {
+            for (int x = entry->minX; (x <= entry->maxX) && (count < maxPairs); x++)
+            {
+                for (int item = data->buckets[GetSpatialGridBucket(data, x, y)]; (item != -1) && (count < maxPairs); item = data->items[item].next)
+                {
+                    const SpatialGridItem *cellItem = &data->items[item];
+                    if ((cellItem->entry <= i) || (cellItem->cellX != x) || (cellItem->cellY != y)) continue;
+
+                    // NOTE: Pair is only checked on first cell shared by both entries, pairs are not duplicated
+                    const SpatialGridEntry *other = &data->entries[cellItem->entry];
+                    if ((x != ((entry->minX > other->minX)? entry->minX : other->minX)) ||
+                        (y != ((entry->minY > other->minY)? entry->minY : other->minY))) continue;
+
+                    if (CheckSpatialGridShapes(entry, other))
+                    {
+                        userIdPairs[count*2] = entry->userId;
+                        userIdPairs[count*2 + 1] = other->userId;
+                        count++;
+                    }
+                }
+            }
+        }
+    }
+
+    return count;
+}
+
 //----------------------------------------------------------------------------------
 // Module specific Functions Definition
 //----------------------------------------------------------------------------------
@@ -1564,3 +2014,796 @@ static Texture2D GetShapesTexture(void)
 
     return texShapes;
 }
+
+// Get segments required for an arc of arcAngle degrees, from its radius projected on screen
+// NOTE: Projected radius takes into account current modelview scale (2D camera zoom and screen scaling),
+// so segments keep the chord error under tessellationError pixels, taken from https://stackoverflow.com/a/2244088
+static int GetCurveSegments(float radius, float arcAngle)
+{
+    Matrix modelview = GetMatrixModelview();
+    float scaleX = sqrtf(modelview.m0*modelview.m0 + modelview.m1*modelview.m1);
+    float scaleY = sqrtf(modelview.m4*modelview.m4 + modelview.m5*modelview.m5);
+    float projectedRadius = fabsf(radius)*((scaleX > scaleY)? scaleX : scaleY);
+
+    int minSegments = (int)ceilf(arcAngle/90.0f);     // At least one segment per quarter of circle
+    if (minSegments < 1) minSegments = 1;
+
+    if (projectedRadius <= tessellationError) return minSegments;
+
+    // Calculate the maximum angle between segments based on the error rate
+    float th = 2.0f*acosf(1.0f - tessellationError/projectedRadius);
+    int segments = (int)ceilf(arcAngle*DEG2RAD/th);
+
+    return (segments < minSegments)? minSegments : segments;
+}
+
+// Add path stroke quad to pending quads, added to batch when full (FlushStrokeQuads())
+// NOTE: Quads are added in batch winding order (same as rectangles), triangles repeat last vertex (d = c)
+static void AddStrokeQuad(Vector2 a, Vector2 b, Vector2 c, Vector2 d)
+{
+    if (strokeQuadsCount >= SHAPES_STROKE_QUADS) FlushStrokeQuads();
+
+    Vector2 *quad = strokeQuads + strokeQuadsCount*4;
+    float area = (b.x - a.x)*(c.y - a.y) - (b.y - a.y)*(c.x - a.x) + (c.x - a.x)*(d.y - a.y) - (c.y - a.y)*(d.x - a.x);
+
+    quad[0] = a;
+    quad[2] = c;
+
+    if (area > 0.0f)
+    {
+        quad[1] = d;
+        quad[3] = b;
+    }
+    else
+    {
+        quad[1] = b;
+        quad[3] = d;
+    }
+
+    strokeQuadsCount++;
+}
+
+// Add path stroke arc, triangles fan around center (two segments by quad)
+static void AddStrokeArc(Vector2 center, Vector2 from, float angle, float radius)
+{
+    int segments = GetCurveSegments(radius, fabsf(angle)*RAD2DEG);
+    float stepCos = cosf(angle/segments);
+    float stepSin = sinf(angle/segments);
+
+    Vector2 current = from;
+
+    for (int i = 0; i < segments; i += 2)
+    {
+        Vector2 middle = { current.x*stepCos - current.y*stepSin, current.x*stepSin + current.y*stepCos };
+        Vector2 last = middle;
+
+        if (i + 1 < segments) last = (Vector2){ middle.x*stepCos - middle.y*stepSin, middle.x*stepSin + middle.y*stepCos };
+
+        AddStrokeQuad(center, (Vector2){ center.x + current.x, center.y + current.y },
+                      (Vector2){ center.x + middle.x, center.y + middle.y }, (Vector2){ center.x + last.x, center.y + last.y });
+
+        current = last;
+    }
+}
+
+// Add points to batch in bulk, by chunks (texture id 0 for default texture)
+static void AddPointsVertices(const Vector2 *points, const Color *colors, int count, Vector2 offset, unsigned int textureId)
+{
+    float vertices[SHAPES_STROKE_QUADS*4*3];
+    const float depth = rlGetCurrentDepth();
+
+    for (int start = 0; start < count; start += SHAPES_STROKE_QUADS*4)
+    {
+        int chunk = ((count - start) < SHAPES_STROKE_QUADS*4)? (count - start) : SHAPES_STROKE_QUADS*4;
+
+        for (int i = 0; i < chunk; i++)
+        {
+            vertices[i*3] = points[start + i].x + offset.x;
+            vertices[i*3 + 1] = points[start + i].y + offset.y;
+            vertices[i*3 + 2] = depth;
+        }
+
+        if (rlCheckBufferLimit(chunk)) rlglDraw();
+
+        if (textureId > 0) rlEnableTexture(textureId);
+
+        rlBegin(RL_POINTS);
+            if (colors == NULL) rlColor4ub(255, 255, 255, 255);
+            rlVertexBatch(vertices, NULL, (colors != NULL)? (const unsigned char *)(colors + start) : NULL, chunk);
+        rlEnd();
+
+        if (textureId > 0) rlDisableTexture();
+    }
+}
+
+// Add pending path stroke quads to batch, in bulk
+// NOTE: Quads are split in two triangles if not SUPPORT_QUADS_DRAW_MODE
+static void FlushStrokeQuads(void)
+{
+    if (strokeQuadsCount == 0) return;
+
+#if defined(SUPPORT_QUADS_DRAW_MODE)
+    float vertices[SHAPES_STROKE_QUADS*4*3];
+    float texcoords[SHAPES_STROKE_QUADS*4*2];
+
+    Texture2D texture = GetShapesTexture();
+    const float u0 = recTexShapes.x/texture.width, u1 = (recTexShapes.x + recTexShapes.width)/texture.width;
+    const float v0 = recTexShapes.y/texture.height, v1 = (recTexShapes.y + recTexShapes.height)/texture.height;
+
+    for (int i = 0; i < strokeQuadsCount*4; i++)
+    {
+        vertices[i*3] = strokeQuads[i].x;
+        vertices[i*3 + 1] = strokeQuads[i].y;
+        vertices[i*3 + 2] = strokeDepth;
+    }
+
+    for (int i = 0; i < strokeQuadsCount; i++)
+    {
+        const float quadTexcoords[4*2] = { u0, v0, u0, v1, u1, v1, u1, v0 };
+        memcpy(texcoords + i*4*2, quadTexcoords, sizeof(quadTexcoords));
+    }
+
+    if (rlCheckBufferLimit(4*strokeQuadsCount)) rlglDraw();
+
+    rlEnableTexture(texture.id);
+
+    rlBegin(RL_QUADS);
+        rlColor4ub(strokeColor.r, strokeColor.g, strokeColor.b, strokeColor.a);
+        rlQuadBatch(vertices, texcoords, NULL, strokeQuadsCount);
+    rlEnd();
+
+    rlDisableTexture();
+#else
+    float vertices[SHAPES_STROKE_QUADS*6*3];
+    const int corners[6] = { 0, 1, 2, 0, 2, 3 };
+
+    for (int i = 0; i < strokeQuadsCount; i++)
+    {
+        for (int k = 0; k < 6; k++)
+        {
+            Vector2 vertex = strokeQuads[i*4 + corners[k]];
+
+            vertices[(i*6 + k)*3] = vertex.x;
+            vertices[(i*6 + k)*3 + 1] = vertex.y;
+            vertices[(i*6 + k)*3 + 2] = strokeDepth;
+        }
+    }
+
+    if (rlCheckBufferLimit(6*strokeQuadsCount)) rlglDraw();
+
+    rlBegin(RL_TRIANGLES);
+        rlColor4ub(strokeColor.r, strokeColor.g, strokeColor.b, strokeColor.a);
+        rlVertex3fv(vertices, strokeQuadsCount*6);
+    rlEnd();
+#endif
+
+    strokeQuadsCount = 0;
+}
+
+// Link polygon ring points [start, end) into a circular list, outline counter-clockwise (positive area), holes clockwise
+// NOTE: Returns first node of the ring, -1 if ring is degenerated (less than 3 points)
+static int LinkPolygonRing(PolygonNodes *nodes, int start, int end, bool outline)
+{
+    if ((end - start) < 3) return -1;
+
+    float area = 0.0f;
+    for (int i = start, j = end - 1; i < end; j = i++) area += nodes->points[j].x*nodes->points[i].y - nodes->points[i].x*nodes->points[j].y;
+
+    bool forward = ((area > 0.0f) == outline);
+    int first = nodes->count;
+
+    for (int i = 0; i < (end - start); i++)
+    {
+        int node = nodes->count++;
+
+        nodes->index[node] = forward? (start + i) : (end - 1 - i);
+        nodes->prev[node] = (node == first)? (first + end - start - 1) : (node - 1);
+        nodes->next[node] = (i == (end - start - 1))? first : (node + 1);
+    }
+
+    return first;
+}
+
+// Get signed area of triangle (a, b, c) nodes, positive if counter-clockwise
+static float GetNodesArea(PolygonNodes *nodes, int a, int b, int c)
+{
+    Vector2 pa = nodes->points[nodes->index[a]];
+    Vector2 pb = nodes->points[nodes->index[b]];
+    Vector2 pc = nodes->points[nodes->index[c]];
+
+    return (pb.x - pa.x)*(pc.y - pa.y) - (pb.y - pa.y)*(pc.x - pa.x);
+}
+
+// Check if point is inside (or on the edges of) counter-clockwise triangle
+static bool CheckPointInTriangle(Vector2 point, Vector2 a, Vector2 b, Vector2 c)
+{
+    return (((b.x - a.x)*(point.y - a.y) - (b.y - a.y)*(point.x - a.x)) >= 0.0f) &&
+           (((c.x - b.x)*(point.y - b.y) - (c.y - b.y)*(point.x - b.x)) >= 0.0f) &&
+           (((a.x - c.x)*(point.y - c.y) - (a.y - c.y)*(point.x - c.x)) >= 0.0f);
+}
+
+// Find outline node to bridge hole (from its leftmost node), casting a ray to the left
+// NOTE: Based on earcut algorithm (David Eberly, "Triangulation by Ear Clipping")
+static int FindHoleBridge(PolygonNodes *nodes, int hole, int outer)
+{
+    const Vector2 *points = nodes->points;
+    Vector2 h = points[nodes->index[hole]];
+
+    // Find closest edge intersected by ray, bridge candidate is its leftmost point
+    float closestX = -INFINITY;
+    int bridge = -1;
+    int node = outer;
+
+    do
+    {
+        Vector2 p = points[nodes->index[node]];
+        Vector2 q = points[nodes->index[nodes->next[node]]];
+
+        if ((h.y <= p.y) && (h.y >= q.y) && (q.y != p.y))
+        {
+            float x = p.x + (h.y - p.y)*(q.x - p.x)/(q.y - p.y);
+
+            if ((x <= h.x) && (x > closestX))
+            {
+                closestX = x;
+                bridge = (p.x < q.x)? node : nodes->next[node];
+                if (x == h.x) return bridge;
+            }
+        }
+
+        node = nodes->next[node];
+    } while (node != outer);
+
+    if (bridge < 0) return -1;
+
+    // Reflex nodes inside triangle (hole, intersection, candidate) could block the bridge,
+    // closest one in angle to the ray is used instead
+    Vector2 m = points[nodes->index[bridge]];
+    float minTangent = INFINITY;
+    int stop = bridge;
+    node = bridge;
+
+    do
+    {
+        Vector2 p = points[nodes->index[node]];
+
+        if ((h.x >= p.x) && (p.x >= m.x) && (h.x != p.x) &&
+            CheckPointInTriangle(p, (h.y < m.y)? (Vector2){ h.x, h.y } : (Vector2){ closestX, h.y }, m, (h.y < m.y)? (Vector2){ closestX, h.y } : (Vector2){ h.x, h.y }))
+        {
+            float tangent = fabsf(h.y - p.y)/(h.x - p.x);
+
+            // Node must see the hole locally (hole inside node angle)
+            int prev = nodes->prev[node];
+            int next = nodes->next[node];
+            bool locallyInside = (GetNodesArea(nodes, prev, node, next) > 0.0f)?
+                ((GetNodesArea(nodes, node, hole, next) <= 0.0f) && (GetNodesArea(nodes, node, prev, hole) <= 0.0f)) :
+                ((GetNodesArea(nodes, node, hole, prev) > 0.0f) || (GetNodesArea(nodes, node, next, hole) > 0.0f));
+
+            if (locallyInside && ((tangent < minTangent) || ((tangent == minTangent) && (p.x > m.x))))
+            {
+                bridge = node;
+                m = p;
+                minTangent = tangent;
+            }
+        }
+
+        node = nodes->next[node];
+    } while (node != stop);
+
+    return bridge;
+}
+
+// Split polygon linking node a to node b, both nodes are duplicated to close the other side
+static void SplitPolygon(PolygonNodes *nodes, int a, int b)
+{
+    int a2 = nodes->count++;
+    int b2 = nodes->count++;
+    int an = nodes->next[a];
+    int bp = nodes->prev[b];
+
+    nodes->index[a2] = nodes->index[a];
+    nodes->index[b2] = nodes->index[b];
+
+    nodes->next[a] = b;
+    nodes->prev[b] = a;
+
+    nodes->next[a2] = an;
+    nodes->prev[an] = a2;
+
+    nodes->next[b2] = a2;
+    nodes->prev[a2] = b2;
+
+    nodes->next[bp] = b2;
+    nodes->prev[b2] = bp;
+}
+
+// Check if node is an ear: convex and no reflex node inside its triangle
+static bool CheckPolygonEar(PolygonNodes *nodes, int ear)
+{
+    int a = nodes->prev[ear];
+    int c = nodes->next[ear];
+
+    if (GetNodesArea(nodes, a, ear, c) <= 0.0f) return false;
+
+    Vector2 pa = nodes->points[nodes->index[a]];
+    Vector2 pb = nodes->points[nodes->index[ear]];
+    Vector2 pc = nodes->points[nodes->index[c]];
+
+    for (int node = nodes->next[c]; node != a; node = nodes->next[node])
+    {
+        Vector2 p = nodes->points[nodes->index[node]];
+
+        // NOTE: Bridges duplicate points, nodes at triangle vertex don't block it
+        if (((p.x == pa.x) && (p.y == pa.y)) || ((p.x == pb.x) && (p.y == pb.y)) || ((p.x == pc.x) && (p.y == pc.y))) continue;
+
+        if (CheckPointInTriangle(p, pa, pb, pc) && (GetNodesArea(nodes, nodes->prev[node], node, nodes->next[node]) <= 0.0f)) return false;
+    }
+
+    return true;
+}
+
+// Clip polygon ears into triangles indices (batch winding order), returns triangles count
+// NOTE: If no ear is found on a full pass (self-intersecting or degenerated polygon), next node is clipped anyway
+static int ClipPolygonEars(PolygonNodes *nodes, int ear, int *indices)
+{
+    int trianglesCount = 0;
+    int stop = ear;
+    bool force = false;
+
+    while (nodes->prev[ear] != nodes->next[ear])
+    {
+        int prev = nodes->prev[ear];
+        int next = nodes->next[ear];
+
+        if (force || CheckPolygonEar(nodes, ear))
+        {
+            // Collinear (zero area) triangles are removed without drawing them
+            if (GetNodesArea(nodes, prev, ear, next) != 0.0f)
+            {
+                indices[trianglesCount*3] = nodes->index[prev];
+                indices[trianglesCount*3 + 1] = nodes->index[next];
+                indices[trianglesCount*3 + 2] = nodes->index[ear];
+                trianglesCount++;
+            }
+
+            nodes->next[prev] = next;
+            nodes->prev[next] = prev;
+
+            ear = next;
+            stop = next;
+            force = false;
+            continue;
+        }
+
+        ear = next;
+
+        if (ear == stop)
+        {
+            // Remove collinear nodes first, otherwise force clipping
+            int node = ear;
+            bool removed = false;
+
+            do
+            {
+                int p = nodes->prev[node];
+                int n = nodes->next[node];
+
+                if ((p != n) && (GetNodesArea(nodes, p, node, n) == 0.0f))
+                {
+                    nodes->next[p] = n;
+                    nodes->prev[n] = p;
+                    if (node == stop) stop = n;
+                    removed = true;
+                    node = n;
+                }
+                else node = n;
+            } while ((node != stop) && (nodes->prev[node] != nodes->next[node]));
+
+            if (!removed) force = true;
+            ear = stop;
+        }
+    }
+
+    return trianglesCount;
+}
+
+// Store batched collision checks hits (mask bits from start index), returns updated hits count
+// NOTE: SIMD masks start at multiples of 4, never crossing a hitMask value
+// Get unit circle points (sin, cos) for angles startAngle + i*stepLength (in degrees)
+// NOTE: Whole degrees angles are taken from shared table, others are rotated by a fixed step (complex multiply),
+// so sinf()/cosf() are computed once per call instead of once per point
+static void GetCirclePoints(float startAngle, float stepLength, int count, Vector2 *points)
+{
+    if ((startAngle == floorf(startAngle)) && (stepLength == floorf(stepLength)))
+    {
+        if (!circleTableReady)
+        {
+            for (int i = 0; i < 360; i++) circleTable[i] = (Vector2){ sinf(DEG2RAD*i), cosf(DEG2RAD*i) };
+            circleTableReady = true;
+        }
+
+        int angle = (int)startAngle;
+        int step = (int)stepLength;
+
+        for (int i = 0; i < count; i++, angle += step) points[i] = circleTable[(angle%360 + 360)%360];
+    }
+    else
+    {
+        Vector2 point = { sinf(DEG2RAD*startAngle), cosf(DEG2RAD*startAngle) };
+        const float stepSin = sinf(DEG2RAD*stepLength);
+        const float stepCos = cosf(DEG2RAD*stepLength);
+
+        for (int i = 0; i < count; i++)
+        {
+            points[i] = point;
+            point = (Vector2){ point.x*stepCos + point.y*stepSin, point.y*stepCos - point.x*stepSin };
+        }
+    }
+}
+
+// Add circle sector vertex to current batch, in bulk by chunks of segments
+// NOTE: Requires rlBegin(RL_QUADS) with shapes texture enabled (every quad represents two segments)
+// or rlBegin(RL_TRIANGLES) if not SUPPORT_QUADS_DRAW_MODE, color must be set before (rlColor4ub())
+static void AddCircleSectorVertices(Vector2 center, float radius, float startAngle, float stepLength, int segments)
+{
+    Vector2 points[SHAPES_BATCH_SEGMENTS + 1];
+    float vertices[SHAPES_BATCH_SEGMENTS*3*3];
+    const float depth = rlGetCurrentDepth();
+
+#if defined(SUPPORT_QUADS_DRAW_MODE)
+    float texcoords[SHAPES_BATCH_SEGMENTS/2*4*2];
+    const float u0 = recTexShapes.x/texShapes.width, u1 = (recTexShapes.x + recTexShapes.width)/texShapes.width;
+    const float v0 = recTexShapes.y/texShapes.height, v1 = (recTexShapes.y + recTexShapes.height)/texShapes.height;
+    int texcoordsCount = (segments < SHAPES_BATCH_SEGMENTS)? (segments + 1)/2 : SHAPES_BATCH_SEGMENTS/2;
+
+    for (int i = 0; i < texcoordsCount; i++)
+    {
+        const float quadTexcoords[4*2] = { u0, v0, u0, v1, u1, v1, u1, v0 };
+        memcpy(texcoords + i*4*2, quadTexcoords, sizeof(quadTexcoords));
+    }
+#endif
+
+    for (int start = 0; start < segments; start += SHAPES_BATCH_SEGMENTS)
+    {
+        int count = ((segments - start) < SHAPES_BATCH_SEGMENTS)? (segments - start) : SHAPES_BATCH_SEGMENTS;
+        GetCirclePoints(startAngle + start*stepLength, stepLength, count + 1, points);
+
+        float *vertex = vertices;
+
+#if defined(SUPPORT_QUADS_DRAW_MODE)
+        for (int i = 0; i < count; i += 2)
+        {
+            // NOTE: In case number of segments is odd, last quad closes on center
+            Vector2 last = (i + 1 < count)? (Vector2){ center.x + points[i + 2].x*radius, center.y + points[i + 2].y*radius } : center;
+
+            const float quad[4*3] = {
+                center.x, center.y, depth,
+                center.x + points[i].x*radius, center.y + points[i].y*radius, depth,
+                center.x + points[i + 1].x*radius, center.y + points[i + 1].y*radius, depth,
+                last.x, last.y, depth
+            };
+
+            memcpy(vertex, quad, sizeof(quad));
+            vertex += 4*3;
+        }
+
+        rlQuadBatch(vertices, texcoords, NULL, (count + 1)/2);
+#else
+        for (int i = 0; i < count; i++)
+        {
+            const float triangle[3*3] = {
+                center.x, center.y, depth,
+                center.x + points[i].x*radius, center.y + points[i].y*radius, depth,
+                center.x + points[i + 1].x*radius, center.y + points[i + 1].y*radius, depth
+            };
+
+            memcpy(vertex, triangle, sizeof(triangle));
+            vertex += 3*3;
+        }
+
+        rlVertex3fv(vertices, count*3);
+#endif
+    }
+}
+
+// Add ring vertex (between inner and outer radius) to current batch, in bulk by chunks of segments
+// NOTE: Requires rlBegin(RL_QUADS) with shapes texture enabled or rlBegin(RL_TRIANGLES) if not SUPPORT_QUADS_DRAW_MODE,
+// color must be set before (rlColor4ub())
+static void AddRingVertices(Vector2 center, float innerRadius, float outerRadius, float startAngle, float stepLength, int segments)
+{
+    Vector2 points[SHAPES_BATCH_SEGMENTS + 1];
+    float vertices[SHAPES_BATCH_SEGMENTS*6*3];
+    const float depth = rlGetCurrentDepth();
+
+#if defined(SUPPORT_QUADS_DRAW_MODE)
+    float texcoords[SHAPES_BATCH_SEGMENTS*4*2];
+    const float u0 = recTexShapes.x/texShapes.width, u1 = (recTexShapes.x + recTexShapes.width)/texShapes.width;
+    const float v0 = recTexShapes.y/texShapes.height, v1 = (recTexShapes.y + recTexShapes.height)/texShapes.height;
+    int texcoordsCount = (segments < SHAPES_BATCH_SEGMENTS)? segments : SHAPES_BATCH_SEGMENTS;
+
+    for (int i = 0; i < texcoordsCount; i++)
+    {
+        const float quadTexcoords[4*2] = { u0, v0, u0, v1, u1, v1, u1, v0 };
+        memcpy(texcoords + i*4*2, quadTexcoords, sizeof(quadTexcoords));
+    }
+#endif
+
+    for (int start = 0; start < segments; start += SHAPES_BATCH_SEGMENTS)
+    {
+        int count = ((segments - start) < SHAPES_BATCH_SEGMENTS)? (segments - start) : SHAPES_BATCH_SEGMENTS;
+        GetCirclePoints(startAngle + start*stepLength, stepLength, count + 1, points);
+
+        float *vertex = vertices;
+
+        for (int i = 0; i < count; i++)
+        {
+            const Vector2 inner0 = { center.x + points[i].x*innerRadius, center.y + points[i].y*innerRadius };
+            const Vector2 outer0 = { center.x + points[i].x*outerRadius, center.y + points[i].y*outerRadius };
+            const Vector2 inner1 = { center.x + points[i + 1].x*innerRadius, center.y + points[i + 1].y*innerRadius };
+            const Vector2 outer1 = { center.x + points[i + 1].x*outerRadius, center.y + points[i + 1].y*outerRadius };
+
+#if defined(SUPPORT_QUADS_DRAW_MODE)
+            const float quad[4*3] = { inner0.x, inner0.y, depth, outer0.x, outer0.y, depth, outer1.x, outer1.y, depth, inner1.x, inner1.y, depth };
+            memcpy(vertex, quad, sizeof(quad));
+            vertex += 4*3;
+#else
+            const float triangles[6*3] = {
+                inner0.x, inner0.y, depth, outer0.x, outer0.y, depth, inner1.x, inner1.y, depth,
+                inner1.x, inner1.y, depth, outer0.x, outer0.y, depth, outer1.x, outer1.y, depth
+            };
+            memcpy(vertex, triangles, sizeof(triangles));
+            vertex += 6*3;
+#endif
+        }
+
+#if defined(SUPPORT_QUADS_DRAW_MODE)
+        rlQuadBatch(vertices, texcoords, NULL, count);
+#else
+        rlVertex3fv(vertices, count*6);
+#endif
+    }
+}
+
+// Add arc vertex (one line per segment) to current batch, in bulk by chunks of segments
+// NOTE: Requires rlBegin(RL_LINES), color must be set before (rlColor4ub())
+static void AddArcVertices(Vector2 center, float radius, float startAngle, float stepLength, int segments)
+{
+    Vector2 points[SHAPES_BATCH_SEGMENTS + 1];
+    float vertices[SHAPES_BATCH_SEGMENTS*2*3];
+    const float depth = rlGetCurrentDepth();
+
+    for (int start = 0; start < segments; start += SHAPES_BATCH_SEGMENTS)
+    {
+        int count = ((segments - start) < SHAPES_BATCH_SEGMENTS)? (segments - start) : SHAPES_BATCH_SEGMENTS;
+        GetCirclePoints(startAngle + start*stepLength, stepLength, count + 1, points);
+
+        for (int i = 0; i < count; i++)
+        {
+            const float line[2*3] = {
+                center.x + points[i].x*radius, center.y + points[i].y*radius, depth,
+                center.x + points[i + 1].x*radius, center.y + points[i + 1].y*radius, depth
+            };
+
+            memcpy(vertices + i*2*3, line, sizeof(line));
+        }
+
+        rlVertex3fv(vertices, count*2);
+    }
+}
+
+// Get a free spatial grid entry (entries array grows if required)
+static int AllocateSpatialGridEntry(SpatialGridData *grid)
+{
+    if (grid->freeEntry == -1)
+    {
+        int capacity = (grid->entryCapacity > 0)? grid->entryCapacity*2 : 64;
+        grid->entries = (SpatialGridEntry *)RL_REALLOC(grid->entries, capacity*sizeof(SpatialGridEntry));
+
+        for (int i = grid->entryCapacity; i < capacity; i++)
+        {
+            memset(&grid->entries[i], 0, sizeof(SpatialGridEntry));
+            grid->entries[i].next = (i < (capacity - 1))? i + 1 : -1;
+        }
+
+        grid->freeEntry = grid->entryCapacity;
+        grid->entryCapacity = capacity;
+    }
+
+    int entry = grid->freeEntry;
+    grid->freeEntry = grid->entries[entry].next;
+    grid->entries[entry].next = -2;
+    grid->entries[entry].queryId = 0;
+
+    return entry;
+}
+
+// Set spatial grid entry shape and covered cells
+static void SetSpatialGridEntry(SpatialGridData *grid, int entry, Rectangle bounds, float radius)
+{
+    SpatialGridEntry *current = &grid->entries[entry];
+
+    current->bounds = bounds;
+    current->radius = radius;
+    current->minX = (int)floorf(bounds.x/grid->cellSize);
+    current->minY = (int)floorf(bounds.y/grid->cellSize);
+    current->maxX = (int)floorf((bounds.x + bounds.width)/grid->cellSize);
+    current->maxY = (int)floorf((bounds.y + bounds.height)/grid->cellSize);
+}
+
+// Insert entry items in its covered cells
+// NOTE: Buckets are doubled (items rehashed) when items exceed twice the buckets
+static void InsertSpatialGridCells(SpatialGridData *grid, int entry)
+{
+    const SpatialGridEntry *current = &grid->entries[entry];
+
+    for (int y = current->minY; y <= current->maxY; y++)
+    {
+        for (int x = current->minX; x <= current->maxX; x++)
+        {
+            if (grid->freeItem == -1)
+            {
+                int capacity = (grid->itemCapacity > 0)? grid->itemCapacity*2 : 256;
+                grid->items = (SpatialGridItem *)RL_REALLOC(grid->items, capacity*sizeof(SpatialGridItem));
+
+                for (int i = grid->itemCapacity; i < capacity; i++)
+                {
+                    grid->items[i].entry = -1;
+                    grid->items[i].next = (i < (capacity - 1))? i + 1 : -1;
+                }
+
+                grid->freeItem = grid->itemCapacity;
+                grid->itemCapacity = capacity;
+            }
+
+            int item = grid->freeItem;
+            int bucket = GetSpatialGridBucket(grid, x, y);
+
+            grid->freeItem = grid->items[item].next;
+            grid->items[item] = (SpatialGridItem){ x, y, entry, grid->buckets[bucket] };
+            grid->buckets[bucket] = item;
+            grid->itemCount++;
+        }
+    }
+
+    if (grid->itemCount > 2*grid->bucketCount)
+    {
+        grid->bucketCount *= 2;
+        grid->buckets = (int *)RL_REALLOC(grid->buckets, grid->bucketCount*sizeof(int));
+        memset(grid->buckets, 0xff, grid->bucketCount*sizeof(int));
+
+        for (int i = 0; i < grid->itemCapacity; i++)
+        {
+            if (grid->items[i].entry == -1) continue;
+
+            int bucket = GetSpatialGridBucket(grid, grid->items[i].cellX, grid->items[i].cellY);
+            grid->items[i].next = grid->buckets[bucket];
+            grid->buckets[bucket] = i;
+        }
+    }
+}
+
+// Remove entry items from its covered cells
+static void RemoveSpatialGridCells(SpatialGridData *grid, int entry)
+{
+    const SpatialGridEntry *current = &grid->entries[entry];
+
+    for (int y = current->minY; y <= current->maxY; y++)
+    {
+        for (int x = current->minX; x <= current->maxX; x++)
+        {
+            int *link = &grid->buckets[GetSpatialGridBucket(grid, x, y)];
+
+            while (*link != -1)
+            {
+                SpatialGridItem *item = &grid->items[*link];
+
+                if ((item->entry == entry) && (item->cellX == x) && (item->cellY == y))
+                {
+                    int removed = *link;
+                    *link = item->next;
+
+                    item->entry = -1;
+                    item->next = grid->freeItem;
+                    grid->freeItem = removed;
+                    grid->itemCount--;
+                    break;
+                }
+
+                link = &item->next;
+            }
+        }
+    }
+}
+
+// Get hashed cell bucket
+static int GetSpatialGridBucket(const SpatialGridData *grid, int cellX, int cellY)
+{
+    unsigned int hash = ((unsigned int)cellX*73856093u) ^ ((unsigned int)cellY*19349663u);
+
+    return (int)(hash & (unsigned int)(grid->bucketCount - 1));
+}
+
+// Check collision between spatial grid shapes (rectangles or circles)
+static bool CheckSpatialGridShapes(const SpatialGridEntry *shape1, const SpatialGridEntry *shape2)
+{
+    if (!CheckCollisionRecs(shape1->bounds, shape2->bounds)) return false;
+
+    if ((shape1->radius >= 0.0f) && (shape2->radius >= 0.0f))
+    {
+        return CheckCollisionCircles((Vector2){ shape1->bounds.x + shape1->radius, shape1->bounds.y + shape1->radius }, shape1->radius,
+                                     (Vector2){ shape2->bounds.x + shape2->radius, shape2->bounds.y + shape2->radius }, shape2->radius);
+    }
+    else if (shape1->radius >= 0.0f) return CheckCollisionCircleRec((Vector2){ shape1->bounds.x + shape1->radius, shape1->bounds.y + shape1->radius }, shape1->radius, shape2->bounds);
+    else if (shape2->radius >= 0.0f) return CheckCollisionCircleRec((Vector2){ shape2->bounds.x + shape2->radius, shape2->bounds.y + shape2->radius }, shape2->radius, shape1->bounds);
+
+    return true;
+}
+
+// Get spatial grid entries overlapping shape, returns number of user ids written (up to maxCount)
+// NOTE: Entries covering several query cells are checked once (marked with query id)
+static int QuerySpatialGridShape(SpatialGridData *grid, const SpatialGridEntry *shape, int *userIds, int maxCount)
+{
+    if ((grid == NULL) || (userIds == NULL) || (maxCount <= 0)) return 0;
+
+    int count = 0;
+
+    grid->queryId++;
+    if (grid->queryId == 0)
+    {
+        for (int i = 0; i < grid->entryCapacity; i++) grid->entries[i].queryId = 0;
+        grid->queryId = 1;
+    }
+
+    int minX = (int)floorf(shape->bounds.x/grid->cellSize);
+    int minY = (int)floorf(shape->bounds.y/grid->cellSize);
+    int maxX = (int)floorf((shape->bounds.x + shape->bounds.width)/grid->cellSize);
+    int maxY = (int)floorf((shape->bounds.y + shape->bounds.height)/grid->cellSize);
+
+    for (int y = minY; (y <= maxY) && (count < maxCount); y++)
+    {
+        for (int x = minX; (x <= maxX) && (count < maxCount); x++)
+        {
+            for (int item = grid->buckets[GetSpatialGridBucket(grid, x, y)]; (item != -1) && (count < maxCount); item = grid->items[item].next)
+            {
+                const SpatialGridItem *cellItem = &grid->items[item];
+                if ((cellItem->cellX != x) || (cellItem->cellY != y)) continue;
+
+                SpatialGridEntry *entry = &grid->entries[cellItem->entry];
+                if (entry->queryId == grid->queryId) continue;
+
+                entry->queryId = grid->queryId;
+                if (CheckSpatialGridShapes(shape, entry)) userIds[count++] = entry->userId;
+            }
+        }
+    }
+
+    return count;
+}
+
+static int StoreBatchHits(int start, unsigned int mask, unsigned int *hitMask, int *hitIndices, int hitCount)
+{
+    if (hitMask != NULL) hitMask[start/32] |= (mask << (start%32));
+
+    for (int lane = 0; mask != 0; lane++, mask >>= 1)
+    {
+        if (mask & 1)
+        {
+            if (hitIndices != NULL) hitIndices[hitCount] = start + lane;
+            hitCount++;
+        }
+    }
+
+    return hitCount;
+}
+
+#if defined(SHAPES_SIMD_NEON)
+// Get NEON comparison lanes as bits mask (same as SSE _mm_movemask_ps())
+static unsigned int GetLanesMask(uint32x4_t lanes)
+{
+    const uint32_t laneBits[4] = { 1, 2, 4, 8 };
+    uint32x4_t bits = vandq_u32(lanes, vld1q_u32(laneBits));
+    uint32x2_t sum = vadd_u32(vget_low_u32(bits), vget_high_u32(bits));
+
+    return vget_lane_u32(sum, 0) | vget_lane_u32(sum, 1);
+}
+#endif
@@ -19,6 +19,10 @@
 *   #define TEXTSPLIT_MAX_SUBSTRINGS_COUNT
 *       TextSplit() function static substrings pointers array (pointing to static buffer)
 *
+*   #define TEXT_THREAD_LOCAL
+*       Storage qualifier of text functions static buffers (thread-local by default),
+*       define it empty for compilers without thread-local storage support
+*
 *
 *   DEPENDENCIES:
 *       stb_truetype  - Load TTF file and rasterize characters data
@@ -46,6 +50,7 @@
 *
 **********************************************************************************************/
 
+#define RL_MEMORY_TAG   MEMORY_TAG_TEXT // Module allocations subsystem (GetMemoryStats())
 #include "raylib.h"         // Declares module functions
 
 // Check if config flags have been externally provided on compilation line
@@ -58,9 +63,21 @@
 #include <stdarg.h>         // Required for: va_list, va_start(), vsprintf(), va_end()
 #include <stdio.h>          // Required for: FILE, fopen(), fclose(), fscanf(), feof(), rewind(), fgets()
 #include <ctype.h>          // Required for: toupper(), tolower()
+#include <math.h>           // Required for: sqrt(), fabs(), acos(), cos(), pow() [Used in MSDF generation]
 
 #include "utils.h"          // Required for: fopen() Android mapping
 
+#include "rlgl.h"           // Required for: rlUpdateTextureRec(), rlUpdateTexture(), rlglDraw() [Used in dynamic fonts]
+
+// SIMD instructions used on UTF8 decoding ASCII runs (GetCodepointsEx(), GetCodepointsCount())
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+    #include <emmintrin.h>  // Required for: SSE2 intrinsics
+    #define TEXT_SIMD_SSE2
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+    #include <arm_neon.h>   // Required for: NEON intrinsics
+    #define TEXT_SIMD_NEON
+#endif
+
 #if defined(SUPPORT_FILEFORMAT_TTF)
     #define STB_RECT_PACK_IMPLEMENTATION
     #include "external/stb_rect_pack.h"     // Required for: ttf font rectangles packaging
@@ -78,6 +95,22 @@
 
 #define MAX_TEXT_UNICODE_CHARS   512        // Maximum number of unicode codepoints
 
+#define MAX_TEXTFORMAT_BUFFERS     4        // Number of static buffers rotated by TextFormat()
+
+#define MAX_TEXT_QUADS_BATCH      64        // Glyph quads generated before submitting them to render batch (DrawTextEx())
+
+// Text functions static buffers are kept per thread, so returned strings are safe to use on any thread
+// NOTE: Ex functions variants (TextFormatEx()...) write into buffers provided by user instead
+#if !defined(TEXT_THREAD_LOCAL)
+    #if defined(_MSC_VER)
+        #define TEXT_THREAD_LOCAL __declspec(thread)
+    #elif defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 201112L) && !defined(__STDC_NO_THREADS__)
+        #define TEXT_THREAD_LOCAL _Thread_local
+    #else
+        #define TEXT_THREAD_LOCAL __thread
+    #endif
+#endif
+
 #if !defined(TEXTSPLIT_MAX_TEXT_BUFFER_LENGTH)
     #define TEXTSPLIT_MAX_TEXT_BUFFER_LENGTH    1024        // Size of static buffer: TextSplit()
 #endif
@@ -86,10 +119,104 @@
     #define TEXTSPLIT_MAX_SUBSTRINGS_COUNT       128        // Size of static pointers array: TextSplit()
 #endif
 
+#define MAX_GLYPH_LOOKUPS         32        // Maximum number of fonts glyph lookup tables (least recently built are replaced)
+#define GLYPH_LOOKUP_DIRECT_SIZE  0x250     // Codepoints looked up directly: Basic Latin, Latin-1, Latin Extended-A/B
+
+#define MAX_FONT_GLYPHS_JOBS       64       // Maximum number of worker jobs rasterizing font glyphs (LoadFontData())
+#define MIN_FONT_GLYPHS_PER_JOB     8       // Minimum number of glyphs rasterized per worker job
+
+#define MAX_DYNAMIC_FONTS           8       // Maximum number of dynamic fonts loaded at the same time (LoadFontDynamic())
+#define DYNAMIC_FONT_PADDING        2       // Dynamic font glyphs padding in atlas
+#define DYNAMIC_FONT_KEEP_AREA    0.5f      // Dynamic font atlas area kept for most recently used glyphs when atlas is full
+
+#define MSDF_CHAR_PADDING           4       // MSDF glyphs padding (distance field extends outside glyph box)
+#define MSDF_PIXEL_RANGE          4.0f      // MSDF distance range (pixels) encoded in [0..255] channels values
+#define MSDF_CORNER_ANGLE         3.0f      // MSDF edges coloring: minimum angle (radians) between edges considered a corner
+#define MSDF_CACHE_VERSION          1       // MSDF fonts cache version, included in cache files hash
+
+// MSDF edges colors, channels distance is computed from edges with channel color
+#define MSDF_BLACK                  0
+#define MSDF_RED                    1
+#define MSDF_GREEN                  2
+#define MSDF_YELLOW                 3
+#define MSDF_BLUE                   4
+#define MSDF_MAGENTA                5
+#define MSDF_CYAN                   6
+#define MSDF_WHITE                  7
+
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
-// ...
+
+// Font binary file header (ExportFontBinary(), LoadFontBinary())
+// NOTE: Header is followed by glyphs data (FontBinaryGlyph array) and atlas pixel data
+typedef struct FontBinaryHeader {
+    char id[4];                             // File identifier: "rFNT"
+    int version;                            // File version: 1
+    int baseSize;                           // Font base size
+    int charsCount;                         // Font glyphs count
+    int atlasWidth;                         // Atlas image width
+    int atlasHeight;                        // Atlas image height
+    int atlasFormat;                        // Atlas image pixel format (uncompressed or GPU compressed)
+    int atlasDataSize;                      // Atlas image data size in bytes
+} FontBinaryHeader;
+
+// Font binary file glyph data
+typedef struct FontBinaryGlyph {
+    int value;                              // Character value (Unicode)
+    int offsetX;                            // Character offset X when drawing
+    int offsetY;                            // Character offset Y when drawing
+    int advanceX;                           // Character advance position X
+    Rectangle rec;                          // Character rectangle in atlas
+} FontBinaryGlyph;
+
+// Font glyphs lookup table (codepoint -> glyph index), built for a font chars array
+typedef struct GlyphLookup {
+    const CharInfo *chars;                  // Font chars array lookup was built for (NULL if slot is free)
+    int charsCount;                         // Font chars count lookup was built for
+    int direct[GLYPH_LOOKUP_DIRECT_SIZE];   // Glyph index for Latin codepoints, -1 if not available
+    int *hashCodepoints;                    // Hash table codepoints (other codepoints), -1 if empty slot
+    int *hashIndices;                       // Hash table glyph indices
+    int hashSize;                           // Hash table size (power of two), 0 if not required
+    void *dynamic;                          // Dynamic font data if glyphs are loaded on demand (DynamicFont), NULL otherwise
+} GlyphLookup;
+
+#if defined(SUPPORT_FILEFORMAT_TTF)
+// Font glyphs rasterization job (LoadFontData()), glyphs first, first + step, first + 2*step...
+typedef struct FontGlyphsJob {
+    const stbtt_fontinfo *fontInfo;         // TTF font info (read-only, shared by jobs)
+    CharInfo *chars;                        // Font chars, values already set
+    int charsCount;                         // Font chars count
+    int first;                              // First glyph rasterized by job
+    int step;                               // Glyphs step between job glyphs
+    float scaleFactor;                      // Font scale factor
+    int ascent;                             // Font ascent (unscaled)
+    int type;                               // Font type (FONT_DEFAULT, FONT_BITMAP, FONT_SDF, FONT_MSDF)
+} FontGlyphsJob;
+
+// MSDF glyph shape edge (line or quadratic curve), glyph units (y-up)
+typedef struct MsdfEdge {
+    double x[3];                            // Edge points X: line (start, end), quadratic (start, control, end)
+    double y[3];                            // Edge points Y
+    int quadratic;                          // Edge is a quadratic curve
+    int color;                              // Edge color (MSDF_RED | MSDF_GREEN | MSDF_BLUE channels)
+} MsdfEdge;
+
+// Dynamic font data, glyphs are rasterized on first use and packed into atlas (skyline)
+// NOTE: Font chars and recs arrays are allocated for all glyph slots, empty slots use value -1
+typedef struct DynamicFont {
+    const CharInfo *chars;                  // Font chars array (NULL if data is free)
+    unsigned char *fontData;                // TTF font file data (required by stb_truetype)
+    stbtt_fontinfo fontInfo;                // TTF font info
+    float scaleFactor;                      // Font scale factor for base size
+    int ascent;                             // Font ascent (scaled)
+    stbrp_context context;                  // Atlas skyline packing context
+    stbrp_node *nodes;                      // Atlas skyline packing nodes (one per atlas column)
+    unsigned int *glyphsUse;                // Glyph slots last use (use counter value)
+    unsigned int useCounter;                // Glyphs use counter, incremented on every glyph lookup
+    unsigned int atlasVersion;              // Atlas version, incremented when glyphs are evicted or moved (TextLayout validation)
+} DynamicFont;
+#endif
 
 //----------------------------------------------------------------------------------
 // Global variables
@@ -99,6 +226,15 @@ static Font defaultFont = { 0 };    // Default font provided by raylib
 // NOTE: defaultFont is loaded on InitWindow and disposed on CloseWindow [module: core]
 #endif
 
+static GlyphLookup glyphLookups[MAX_GLYPH_LOOKUPS] = { 0 };  // Fonts glyph lookup tables (GetGlyphIndex())
+static int glyphLookupLast = 0;                             // Last glyph lookup table used
+static int glyphLookupNext = 0;                             // Next glyph lookup slot replaced if all are used
+
+#if defined(SUPPORT_FILEFORMAT_TTF)
+static DynamicFont dynamicFonts[MAX_DYNAMIC_FONTS] = { 0 };  // Dynamic fonts data (LoadFontDynamic())
+static char fontCachePath[512] = { 0 };                     // Generated fonts cache directory (LoadFontMsdf()), empty if disabled
+#endif
+
 //----------------------------------------------------------------------------------
 // Other Modules Functions Declaration (required by text)
 //----------------------------------------------------------------------------------
@@ -111,6 +247,35 @@ static Font defaultFont = { 0 };    // Default font provided by raylib
 static Font LoadBMFont(const char *fileName);     // Load a BMFont file (AngelCode font file)
 #endif
 
+static GlyphLookup *GetGlyphLookup(Font font);    // Get font glyph lookup table, built if not available
+static void BuildGlyphLookup(GlyphLookup *lookup, Font font);   // Build font glyph lookup table
+static void UnloadGlyphLookup(const CharInfo *chars);  // Unload font glyph lookup table
+static int FindGlyphIndex(const GlyphLookup *lookup, int codepoint);  // Find codepoint glyph index in lookup table, -1 if not found
+static void AddGlyphLookup(GlyphLookup *lookup, int codepoint, int index);  // Add codepoint glyph index to lookup table
+static void BuildTextLayout(TextLayout *layout);                // Build text layout glyph quads from layout text
+static unsigned int GetFontAtlasVersion(Font font);             // Get font atlas version (dynamic fonts), 0 for static fonts
+static int DecodeCodepoints(const char *text, int length, int *codepoints, int maxCount);   // Decode UTF8 text codepoints (only counted if codepoints is NULL)
+static void GenGlyphQuad(float *vertices, float *texcoords, Font font, int index, float x, float y, float z, float scale);  // Generate glyph quad vertex data
+static void DrawGlyphQuads(Texture2D texture, const float *vertices, const float *texcoords, int quadsCount, Color tint);  // Draw glyph quads (render batch flushed if required)
+
+#if defined(SUPPORT_FILEFORMAT_TTF)
+static void LoadFontGlyphsJob(void *data);                          // Worker job: rasterize font glyphs (FontGlyphsJob)
+static DynamicFont *GetDynamicFont(const CharInfo *chars);          // Get dynamic font data for font chars, NULL if font is not dynamic
+static int LoadDynamicGlyph(DynamicFont *dynamic, GlyphLookup *lookup, Font font, int codepoint);   // Rasterize glyph into dynamic font atlas, returns glyph index (-1 on failure)
+static void PackDynamicAtlas(DynamicFont *dynamic, GlyphLookup *lookup, Font font);    // Repack dynamic font atlas keeping most recently used glyphs
+static void UnloadDynamicFont(const CharInfo *chars);               // Unload dynamic font data
+static unsigned long long GetFontCacheHash(const char *fileName, int fontSize, const int *fontChars, int charsCount);    // Get generated font cache key
+
+static unsigned char *GenGlyphMsdf(const stbtt_fontinfo *fontInfo, float scale, int codepoint, int *width, int *height, int *offsetX, int *offsetY);  // Generate glyph MSDF (RGB)
+static void MsdfColorEdges(MsdfEdge *edges, const int *contours, int contoursCount);   // Assign edges colors, corners edges get different colors
+static void MsdfEdgeDirection(const MsdfEdge *edge, int end, double *dx, double *dy);  // Get edge direction at start (end = 0) or end (end = 1)
+static void MsdfEdgeDistance(const MsdfEdge *edge, double x, double y, double *distance, double *dot, double *param);    // Get signed distance from point to edge
+static double MsdfPseudoDistance(const MsdfEdge *edge, double x, double y, double distance, double param);  // Get signed pseudo-distance (edge extended at endpoints)
+static int MsdfWinding(const MsdfEdge *edges, int edgesCount, double x, double y);     // Get shape winding number at point (0 if outside)
+static int SolveQuadratic(double *t, double a, double b, double c);                    // Solve quadratic equation, returns solutions count (-1 if infinite)
+static int SolveCubic(double *t, double a, double b, double c, double d);              // Solve cubic equation, returns solutions count (-1 if infinite)
+#endif
+
 #if defined(SUPPORT_DEFAULT_FONT)
 extern void LoadFontDefault(void);
 extern void UnloadFontDefault(void);
@@ -268,12 +433,16 @@ extern void LoadFontDefault(void)
 
     defaultFont.baseSize = (int)defaultFont.recs[0].height;
 
+    GetGlyphLookup(defaultFont);    // Build glyph lookup table
+
     TraceLog(LOG_INFO, "[TEX ID %i] Default font loaded successfully", defaultFont.texture.id);
 }
 
 // Unload raylib default font
 extern void UnloadFontDefault(void)
 {
+    UnloadGlyphLookup(defaultFont.chars);
+
     for (int i = 0; i < defaultFont.charsCount; i++) UnloadImage(defaultFont.chars[i].image);
     UnloadTexture(defaultFont.texture);
     RL_FREE(defaultFont.chars);
@@ -310,6 +479,8 @@ Font LoadFont(const char *fileName)
     if (IsFileExtension(fileName, ".fnt")) font = LoadBMFont(fileName);
     else
 #endif
+    if (IsFileExtension(fileName, ".rfnt")) font = LoadFontBinary(fileName);
+    else
     {
         Image image = LoadImage(fileName);
         if (image.data != NULL) font = LoadFontFromImage(image, MAGENTA, DEFAULT_FIRST_CHAR);
@@ -351,6 +522,8 @@ Font LoadFontEx(const char *fileName, int fontSize, int *fontChars, int charsCou
         }
 
         UnloadImage(atlas);
+
+        GetGlyphLookup(font);       // Build glyph lookup table
     }
     else font = GetFontDefault();
 #else
@@ -361,6 +534,331 @@ Font LoadFontEx(const char *fileName, int fontSize, int *fontChars, int charsCou
     return font;
 }
 
+// Load font from TTF file with multi-channel signed distance field glyphs (MSDF), draw with LoadShaderMsdf() shader
+// NOTE: MSDF glyphs keep sharp corners at any drawing size, generated font is cached if cache directory is set
+Font LoadFontMsdf(const char *fileName, int fontSize, int *fontChars, int charsCount)
+{
+    Font font = { 0 };
+
+#if defined(SUPPORT_FILEFORMAT_TTF)
+    charsCount = (charsCount > 0)? charsCount : 95;
+
+    char cacheFileName[640] = { 0 };
+
+    if (fontCachePath[0] != '\0')
+    {
+        unsigned long long hash = GetFontCacheHash(fileName, fontSize, fontChars, charsCount);
+        sprintf(cacheFileName, "%s/%08x%08x.rfnt", fontCachePath, (unsigned int)(hash >> 32), (unsigned int)(hash & 0xffffffff));
+
+        if (FileExists(cacheFileName))
+        {
+            font = LoadFontBinary(cacheFileName);
+
+            if (font.chars != GetFontDefault().chars)
+            {
+                SetTextureFilter(font.texture, FILTER_BILINEAR);
+                TraceLog(LOG_INFO, "[%s] MSDF font loaded from cache", fileName);
+                return font;
+            }
+        }
+    }
+
+    font.baseSize = fontSize;
+    font.charsCount = charsCount;
+    font.chars = LoadFontData(fileName, font.baseSize, fontChars, font.charsCount, FONT_MSDF);
+
+    if (font.chars != NULL)
+    {
+        Image atlas = GenImageFontAtlas(font.chars, &font.recs, font.charsCount, font.baseSize, 2, 1);
+        font.texture = LoadTextureFromImage(atlas);
+        UnloadImage(atlas);
+
+        // NOTE: Distance field is linearly interpolated between texels
+        SetTextureFilter(font.texture, FILTER_BILINEAR);
+
+        GetGlyphLookup(font);       // Build glyph lookup table
+
+        if (cacheFileName[0] != '\0') ExportFontBinary(font, cacheFileName);
+    }
+    else font = GetFontDefault();
+#else
+    font = GetFontDefault();
+#endif
+
+    return font;
+}
+
+// Set generated fonts cache directory (LoadFontMsdf()), NULL to disable
+void SetFontCacheDirectory(const char *dirPath)
+{
+#if defined(SUPPORT_FILEFORMAT_TTF)
+    fontCachePath[0] = '\0';
+
+    if (dirPath != NULL)
+    {
+        strncpy(fontCachePath, dirPath, sizeof(fontCachePath) - 1);
+        fontCachePath[sizeof(fontCachePath) - 1] = '\0';
+    }
+#endif
+}
+
+// Load MSDF fonts shader: coverage from median of distance channels, anti-aliased at any scale
+// NOTE: Shader must be unloaded with UnloadShader(), fragment derivatives are required (OES_standard_derivatives on ES2)
+Shader LoadShaderMsdf(void)
+{
+    const char *msdfVShaderStr =
+#if defined(GRAPHICS_API_OPENGL_21)
+    "#version 120                       \n"
+#elif defined(GRAPHICS_API_OPENGL_ES2)
+    "#version 100                       \n"
+#endif
+#if defined(GRAPHICS_API_OPENGL_ES2) || defined(GRAPHICS_API_OPENGL_21)
+    "attribute vec3 vertexPosition;     \n"
+    "attribute vec2 vertexTexCoord;     \n"
+    "attribute vec4 vertexColor;        \n"
+    "varying vec2 fragTexCoord;         \n"
+    "varying vec4 fragColor;            \n"
+#else
+    "#version 330                       \n"
+    "in vec3 vertexPosition;            \n"
+    "in vec2 vertexTexCoord;            \n"
+    "in vec4 vertexColor;               \n"
+    "out vec2 fragTexCoord;             \n"
+    "out vec4 fragColor;                \n"
+#endif
+    "uniform mat4 mvp;                  \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    fragTexCoord = vertexTexCoord; \n"
+    "    fragColor = vertexColor;       \n"
+    "    gl_Position = mvp*vec4(vertexPosition, 1.0); \n"
+    "}                                  \n";
+
+    const char *msdfFShaderStr =
+#if defined(GRAPHICS_API_OPENGL_21)
+    "#version 120                       \n"
+#elif defined(GRAPHICS_API_OPENGL_ES2)
+    "#version 100                       \n"
+    "#extension GL_OES_standard_derivatives : enable \n"
+    "precision mediump float;           \n"
+#endif
+#if defined(GRAPHICS_API_OPENGL_ES2) || defined(GRAPHICS_API_OPENGL_21)
+    "varying vec2 fragTexCoord;         \n"
+    "varying vec4 fragColor;            \n"
+    #define MSDF_SHADER_TEXTURE_FUNC "texture2D"
+    #define MSDF_SHADER_OUTPUT       "gl_FragColor"
+#else
+    "#version 330                       \n"
+    "in vec2 fragTexCoord;              \n"
+    "in vec4 fragColor;                 \n"
+    "out vec4 finalColor;               \n"
+    #define MSDF_SHADER_TEXTURE_FUNC "texture"
+    #define MSDF_SHADER_OUTPUT       "finalColor"
+#endif
+    "uniform sampler2D texture0;        \n"
+    "uniform vec4 colDiffuse;           \n"
+    "float median(float r, float g, float b) { return max(min(r, g), min(max(r, g), b)); } \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    vec3 msd = " MSDF_SHADER_TEXTURE_FUNC "(texture0, fragTexCoord).rgb; \n"
+    "    float distance = median(msd.r, msd.g, msd.b) - 0.5; \n"
+    "    float alpha = clamp(distance/max(fwidth(distance), 0.0001) + 0.5, 0.0, 1.0); \n"
+    "    " MSDF_SHADER_OUTPUT " = vec4(fragColor.rgb, fragColor.a*alpha)*colDiffuse; \n"
+    "}                                  \n";
+
+    #undef MSDF_SHADER_TEXTURE_FUNC
+    #undef MSDF_SHADER_OUTPUT
+
+    return LoadShaderCode(msdfVShaderStr, msdfFShaderStr);
+}
+
+// Load font from TTF file with glyphs rasterized on first use (dynamic font atlas)
+// NOTE: Glyphs are packed into an atlasSize x atlasSize texture, least recently used glyphs are evicted when atlas is full,
+// glyphs slots are allocated up front (Font.charsCount), ASCII glyphs (32..126) are rasterized on loading
+Font LoadFontDynamic(const char *fileName, int fontSize, int atlasSize)
+{
+    Font font = GetFontDefault();
+
+#if defined(SUPPORT_FILEFORMAT_TTF)
+    DynamicFont *dynamic = NULL;
+
+    for (int i = 0; i < MAX_DYNAMIC_FONTS; i++)
+    {
+        if (dynamicFonts[i].chars == NULL) { dynamic = &dynamicFonts[i]; break; }
+    }
+
+    if ((fontSize <= 0) || (atlasSize < fontSize))
+    {
+        TraceLog(LOG_WARNING, "[%s] Dynamic font size or atlas size not valid", fileName);
+        return font;
+    }
+
+    if (dynamic == NULL)
+    {
+        TraceLog(LOG_WARNING, "[%s] Dynamic font could not be loaded, too many dynamic fonts loaded", fileName);
+        return font;
+    }
+
+    FILE *fontFile = fopen(fileName, "rb");
+
+    if (fontFile == NULL)
+    {
+        TraceLog(LOG_WARNING, "[%s] TTF file could not be opened", fileName);
+        return font;
+    }
+
+    fseek(fontFile, 0, SEEK_END);
+    long size = ftell(fontFile);
+    fseek(fontFile, 0, SEEK_SET);
+
+    unsigned char *fontData = (unsigned char *)RL_MALLOC((size > 0)? size : 1);
+    bool valid = (size > 0) && (fread(fontData, size, 1, fontFile) == 1);
+    fclose(fontFile);
+
+    memset(dynamic, 0, sizeof(DynamicFont));
+
+    if (!valid || !stbtt_InitFont(&dynamic->fontInfo, fontData, stbtt_GetFontOffsetForIndex(fontData, 0)))
+    {
+        TraceLog(LOG_WARNING, "[%s] Failed to init font!", fileName);
+        RL_FREE(fontData);
+        return font;
+    }
+
+    int ascent = 0, descent = 0, lineGap = 0;
+    stbtt_GetFontVMetrics(&dynamic->fontInfo, &ascent, &descent, &lineGap);
+
+    dynamic->fontData = fontData;
+    dynamic->scaleFactor = stbtt_ScaleForPixelHeight(&dynamic->fontInfo, (float)fontSize);
+    dynamic->ascent = (int)((float)ascent*dynamic->scaleFactor);
+
+    // Glyph slots: twice the number of base size glyphs fitting the atlas (glyphs are usually narrower)
+    int slotsPerRow = atlasSize/(fontSize + 2*DYNAMIC_FONT_PADDING);
+    int slotsCount = slotsPerRow*slotsPerRow*2;
+    if (slotsCount < 128) slotsCount = 128;
+
+    font.baseSize = fontSize;
+    font.charsCount = slotsCount;
+    font.chars = (CharInfo *)RL_CALLOC(slotsCount, sizeof(CharInfo));
+    font.recs = (Rectangle *)RL_CALLOC(slotsCount, sizeof(Rectangle));
+    for (int i = 0; i < slotsCount; i++) font.chars[i].value = -1;
+
+    // Atlas texture (GRAY_ALPHA, white with glyph coverage as alpha, like GenImageFontAtlas())
+    Image atlas = { 0 };
+    atlas.width = atlasSize;
+    atlas.height = atlasSize;
+    atlas.mipmaps = 1;
+    atlas.format = UNCOMPRESSED_GRAY_ALPHA;
+    atlas.data = RL_MALLOC(atlasSize*atlasSize*2);
+    for (int i = 0; i < atlasSize*atlasSize; i++) { ((unsigned char *)atlas.data)[i*2] = 255; ((unsigned char *)atlas.data)[i*2 + 1] = 0; }
+
+    font.texture = LoadTextureFromImage(atlas);
+    UnloadImage(atlas);
+
+    dynamic->chars = font.chars;
+    dynamic->nodes = (stbrp_node *)RL_MALLOC(atlasSize*sizeof(stbrp_node));
+    dynamic->glyphsUse = (unsigned int *)RL_CALLOC(slotsCount, sizeof(unsigned int));
+    stbrp_init_target(&dynamic->context, atlasSize, atlasSize, dynamic->nodes, atlasSize);
+
+    // NOTE: Lookup table is built after dynamic font is registered (it gets dynamic font data)
+    UnloadGlyphLookup(font.chars);
+    GetGlyphLookup(font);
+
+    for (int codepoint = 32; codepoint < 127; codepoint++) GetGlyphIndex(font, codepoint);
+
+    TraceLog(LOG_INFO, "[%s] Dynamic font loaded successfully (%i glyph slots, %ix%i atlas)", fileName, slotsCount, atlasSize, atlasSize);
+#else
+    TraceLog(LOG_WARNING, "[%s] TTF support is disabled", fileName);
+#endif
+
+    return font;
+}
+
+// Load font from binary file (exported with ExportFontBinary()), atlas is uploaded as stored
+// NOTE: File is read at once, no glyph rasterization or atlas packing is required,
+// characters images (ImageText()) are only available for uncompressed atlas formats
+Font LoadFontBinary(const char *fileName)
+{
+    Font font = { 0 };
+
+    FILE *fontFile = fopen(fileName, "rb");
+
+    if (fontFile == NULL)
+    {
+        TraceLog(LOG_WARNING, "[%s] Binary font file could not be opened", fileName);
+        return GetFontDefault();
+    }
+
+    fseek(fontFile, 0, SEEK_END);
+    long size = ftell(fontFile);
+    fseek(fontFile, 0, SEEK_SET);
+
+    unsigned char *fileData = (unsigned char *)RL_MALLOC((size > 0)? size : 1);
+    bool valid = (size >= (long)sizeof(FontBinaryHeader)) && (fread(fileData, size, 1, fontFile) == 1);
+    fclose(fontFile);
+
+    FontBinaryHeader *header = (FontBinaryHeader *)fileData;
+
+    if (valid)
+    {
+        long glyphsSize = (long)header->charsCount*(long)sizeof(FontBinaryGlyph);
+
+        valid = (memcmp(header->id, "rFNT", 4) == 0) && (header->version == 1) && (header->charsCount > 0) &&
+                (header->atlasWidth > 0) && (header->atlasHeight > 0) && (header->atlasDataSize > 0) &&
+                (header->charsCount <= (size - (long)sizeof(FontBinaryHeader))/(long)sizeof(FontBinaryGlyph)) &&
+                (header->atlasDataSize <= (size - (long)sizeof(FontBinaryHeader) - glyphsSize)) &&
+                ((header->atlasFormat >= COMPRESSED_DXT1_RGB) || (header->atlasDataSize == GetPixelDataSize(header->atlasWidth, header->atlasHeight, header->atlasFormat)));
+    }
+
+    if (!valid)
+    {
+        TraceLog(LOG_WARNING, "[%s] Binary font file not valid", fileName);
+        RL_FREE(fileData);
+        return GetFontDefault();
+    }
+
+    const FontBinaryGlyph *glyphs = (const FontBinaryGlyph *)(fileData + sizeof(FontBinaryHeader));
+
+    Image atlas = { 0 };
+    atlas.data = fileData + sizeof(FontBinaryHeader) + header->charsCount*sizeof(FontBinaryGlyph);
+    atlas.width = header->atlasWidth;
+    atlas.height = header->atlasHeight;
+    atlas.format = header->atlasFormat;
+    atlas.mipmaps = 1;
+
+    font.baseSize = header->baseSize;
+    font.charsCount = header->charsCount;
+    font.texture = LoadTextureFromImage(atlas);
+    font.chars = (CharInfo *)RL_CALLOC(font.charsCount, sizeof(CharInfo));
+    font.recs = (Rectangle *)RL_MALLOC(font.charsCount*sizeof(Rectangle));
+
+    for (int i = 0; i < font.charsCount; i++)
+    {
+        font.chars[i].value = glyphs[i].value;
+        font.chars[i].offsetX = glyphs[i].offsetX;
+        font.chars[i].offsetY = glyphs[i].offsetY;
+        font.chars[i].advanceX = glyphs[i].advanceX;
+        font.recs[i] = glyphs[i].rec;
+
+        // Characters images are required by ImageText()
+        if (atlas.format < COMPRESSED_DXT1_RGB) font.chars[i].image = ImageFromImage(atlas, font.recs[i]);
+    }
+
+    RL_FREE(fileData);
+
+    if (font.texture.id == 0)
+    {
+        UnloadFont(font);
+        TraceLog(LOG_WARNING, "[%s] Binary font atlas could not be loaded, using default font", fileName);
+        return GetFontDefault();
+    }
+
+    GetGlyphLookup(font);           // Build glyph lookup table
+
+    TraceLog(LOG_INFO, "[%s] Binary font loaded successfully (%i glyphs)", fileName, font.charsCount);
+
+    return font;
+}
+
 // Load an Image font file (XNA style)
 Font LoadFontFromImage(Image image, Color key, int firstChar)
 {
@@ -477,6 +975,8 @@ Font LoadFontFromImage(Image image, Color key, int firstChar)
 
     font.baseSize = (int)font.recs[0].height;
 
+    GetGlyphLookup(font);           // Build glyph lookup table
+
     TraceLog(LOG_INFO, "Image file loaded correctly as Font");
 
     return font;
@@ -540,59 +1040,43 @@ CharInfo *LoadFontData(const char *fileName, int fontSize, int *fontChars, int c
 
         chars = (CharInfo *)RL_MALLOC(charsCount*sizeof(CharInfo));
 
-        // NOTE: Using simple packaging, one char after another
+        for (int i = 0; i < charsCount; i++) chars[i].value = fontChars[i];
+
+        // Rasterize glyphs on worker threads, glyphs are interleaved between jobs (similar cost per job)
+        FontGlyphsJob jobs[MAX_FONT_GLYPHS_JOBS] = { 0 };
+        int jobsCount = (GetWorkerThreads() + 1)*4;
+        if (jobsCount > MAX_FONT_GLYPHS_JOBS) jobsCount = MAX_FONT_GLYPHS_JOBS;
+        if (jobsCount > charsCount/MIN_FONT_GLYPHS_PER_JOB) jobsCount = charsCount/MIN_FONT_GLYPHS_PER_JOB;
+        if (jobsCount < 1) jobsCount = 1;
+
+        int pending = 0;
+
+        for (int i = 0; i < jobsCount; i++)
+        {
+            jobs[i].fontInfo = &fontInfo;
+            jobs[i].chars = chars;
+            jobs[i].charsCount = charsCount;
+            jobs[i].first = i;
+            jobs[i].step = jobsCount;
+            jobs[i].scaleFactor = scaleFactor;
+            jobs[i].ascent = ascent;
+            jobs[i].type = type;
+
+            if (i > 0) SubmitWorkerJob(LoadFontGlyphsJob, &jobs[i], &pending);
+        }
+
+        LoadFontGlyphsJob(&jobs[0]);
+        WaitWorkerJobs(&pending);
+
+        // NOTE: We create an empty image for space character, it could be further required for atlas packing
         for (int i = 0; i < charsCount; i++)
         {
-            int chw = 0, chh = 0;   // Character width and height (on generation)
-            int ch = fontChars[i];  // Character value to get info for
-            chars[i].value = ch;
-
-            //  Render a unicode codepoint to a bitmap
-            //      stbtt_GetCodepointBitmap()           -- allocates and returns a bitmap
-            //      stbtt_GetCodepointBitmapBox()        -- how big the bitmap must be
-            //      stbtt_MakeCodepointBitmap()          -- renders into bitmap you provide
-
-            if (type != FONT_SDF) chars[i].image.data = stbtt_GetCodepointBitmap(&fontInfo, scaleFactor, scaleFactor, ch, &chw, &chh, &chars[i].offsetX, &chars[i].offsetY);
-            else if (ch != 32) chars[i].image.data = stbtt_GetCodepointSDF(&fontInfo, scaleFactor, ch, SDF_CHAR_PADDING, SDF_ON_EDGE_VALUE, SDF_PIXEL_DIST_SCALE, &chw, &chh, &chars[i].offsetX, &chars[i].offsetY);
-            else chars[i].image.data = NULL;
-            
-            stbtt_GetCodepointHMetrics(&fontInfo, ch, &chars[i].advanceX, NULL);
-            chars[i].advanceX = (int)((float)chars[i].advanceX*scaleFactor);
-
-            // Load characters images
-            chars[i].image.width = chw;
-            chars[i].image.height = chh;
-            chars[i].image.mipmaps = 1;
-            chars[i].image.format = UNCOMPRESSED_GRAYSCALE;
-
-            chars[i].offsetY += (int)((float)ascent*scaleFactor);
-
-            // NOTE: We create an empty image for space character, it could be further required for atlas packing
-            if (ch == 32)
+            if (chars[i].value == 32)
             {
+                RL_FREE(chars[i].image.data);
                 chars[i].image = GenImageColor(chars[i].advanceX, fontSize, BLANK);
-                ImageFormat(&chars[i].image, UNCOMPRESSED_GRAYSCALE);
-            }
-
-            if (type == FONT_BITMAP)
-            {
-                // Aliased bitmap (black & white) font generation, avoiding anti-aliasing
-                // NOTE: For optimum results, bitmap font should be generated at base pixel size
-                for (int p = 0; p < chw*chh; p++)
-                {
-                    if (((unsigned char *)chars[i].image.data)[p] < BITMAP_ALPHA_THRESHOLD) ((unsigned char *)chars[i].image.data)[p] = 0;
-                    else ((unsigned char *)chars[i].image.data)[p] = 255;
-                }
+                ImageFormat(&chars[i].image, (type == FONT_MSDF)? UNCOMPRESSED_R8G8B8 : UNCOMPRESSED_GRAYSCALE);
             }
-
-            // Get bounding box for character (may be offset to account for chars that dip above or below the line)
-            /*
-            int chX1, chY1, chX2, chY2;
-            stbtt_GetCodepointBitmapBox(&fontInfo, ch, scaleFactor, scaleFactor, &chX1, &chY1, &chX2, &chY2);
-
-            TraceLog(LOG_DEBUG, "Character box measures: %i, %i, %i, %i", chX1, chY1, chX2 - chX1, chY2 - chY1);
-            TraceLog(LOG_DEBUG, "Character offsetY: %i", (int)((float)ascent*scaleFactor) + chY1);
-            */
         }
 
         RL_FREE(fontBuffer);
@@ -621,6 +1105,10 @@ Image GenImageFontAtlas(const CharInfo *chars, Rectangle **charRecs, int charsCo
     // NOTE: Rectangles memory is loaded here!
     Rectangle *recs = (Rectangle *)RL_MALLOC(charsCount*sizeof(Rectangle));
 
+    // NOTE: MSDF fonts characters are RGB, other font types characters are GRAYSCALE
+    bool msdf = (chars[0].image.format == UNCOMPRESSED_R8G8B8);
+    int bytesPerPixel = msdf? 3 : 1;
+
     // Calculate image size based on required pixel area
     // NOTE 1: Image is forced to be squared and POT... very conservative!
     // NOTE 2: SDF font characters already contain an internal padding,
@@ -632,8 +1120,8 @@ Image GenImageFontAtlas(const CharInfo *chars, Rectangle **charRecs, int charsCo
 
     atlas.width = imageSize;   // Atlas bitmap width
     atlas.height = imageSize;  // Atlas bitmap height
-    atlas.data = (unsigned char *)RL_CALLOC(1, atlas.width*atlas.height);      // Create a bitmap to store characters (8 bpp)
-    atlas.format = UNCOMPRESSED_GRAYSCALE;
+    atlas.data = (unsigned char *)RL_CALLOC(1, atlas.width*atlas.height*bytesPerPixel);      // Create a bitmap to store characters (8 bpp, 24 bpp for MSDF)
+    atlas.format = msdf? UNCOMPRESSED_R8G8B8 : UNCOMPRESSED_GRAYSCALE;
     atlas.mipmaps = 1;
 
     // DEBUG: We can see padding in the generated image setting a gray background...
@@ -650,10 +1138,8 @@ Image GenImageFontAtlas(const CharInfo *chars, Rectangle **charRecs, int charsCo
             // Copy pixel data from fc.data to atlas
             for (int y = 0; y < chars[i].image.height; y++)
             {
-                for (int x = 0; x < chars[i].image.width; x++)
-                {
-                    ((unsigned char *)atlas.data)[(offsetY + y)*atlas.width + (offsetX + x)] = ((unsigned char *)chars[i].image.data)[y*chars[i].image.width + x];
-                }
+                memcpy((unsigned char *)atlas.data + ((offsetY + y)*atlas.width + offsetX)*bytesPerPixel,
+                       (unsigned char *)chars[i].image.data + y*chars[i].image.width*bytesPerPixel, chars[i].image.width*bytesPerPixel);
             }
 
             // Fill chars rectangles in atlas info
@@ -712,10 +1198,8 @@ Image GenImageFontAtlas(const CharInfo *chars, Rectangle **charRecs, int charsCo
                 // Copy pixel data from fc.data to atlas
                 for (int y = 0; y < chars[i].image.height; y++)
                 {
-                    for (int x = 0; x < chars[i].image.width; x++)
-                    {
-                        ((unsigned char *)atlas.data)[(rects[i].y + padding + y)*atlas.width + (rects[i].x + padding + x)] = ((unsigned char *)chars[i].image.data)[y*chars[i].image.width + x];
-                    }
+                    memcpy((unsigned char *)atlas.data + ((rects[i].y + padding + y)*atlas.width + rects[i].x + padding)*bytesPerPixel,
+                           (unsigned char *)chars[i].image.data + y*chars[i].image.width*bytesPerPixel, chars[i].image.width*bytesPerPixel);
                 }
             }
             else TraceLog(LOG_WARNING, "Character could not be packed: %i", i);
@@ -728,6 +1212,13 @@ Image GenImageFontAtlas(const CharInfo *chars, Rectangle **charRecs, int charsCo
 
     // TODO: Crop image if required for smaller size
 
+    // NOTE: MSDF atlas is kept as RGB, coverage is computed by MSDF shader (LoadShaderMsdf())
+    if (msdf)
+    {
+        *charRecs = recs;
+        return atlas;
+    }
+
     // Convert image data from GRAYSCALE to GRAY_ALPHA
     // WARNING: ImageAlphaMask(&atlas, atlas) does not work in this case, requires manual operation
     unsigned char *dataGrayAlpha = (unsigned char *)RL_MALLOC(atlas.width*atlas.height*sizeof(unsigned char)*2); // Two channels
@@ -748,12 +1239,105 @@ Image GenImageFontAtlas(const CharInfo *chars, Rectangle **charRecs, int charsCo
 }
 #endif
 
+// Export font as binary file (atlas image and glyphs metrics), loaded with LoadFontBinary()
+// NOTE: Atlas is read back from GPU texture in its format, dynamic fonts empty glyph slots are not exported
+bool ExportFontBinary(Font font, const char *fileName)
+{
+    bool success = false;
+
+    if ((font.chars == NULL) || (font.recs == NULL) || (font.texture.id == 0)) return false;
+
+    Image atlas = GetTextureData(font.texture);
+
+    if (atlas.data == NULL)
+    {
+        TraceLog(LOG_WARNING, "[%s] Font atlas could not be read, binary font not exported", fileName);
+        return false;
+    }
+
+    FontBinaryGlyph *glyphs = (FontBinaryGlyph *)RL_MALLOC(font.charsCount*sizeof(FontBinaryGlyph));
+    int glyphsCount = 0;
+
+    for (int i = 0; i < font.charsCount; i++)
+    {
+        if (font.chars[i].value == -1) continue;
+
+        glyphs[glyphsCount].value = font.chars[i].value;
+        glyphs[glyphsCount].offsetX = font.chars[i].offsetX;
+        glyphs[glyphsCount].offsetY = font.chars[i].offsetY;
+        glyphs[glyphsCount].advanceX = font.chars[i].advanceX;
+        glyphs[glyphsCount].rec = font.recs[i];
+        glyphsCount++;
+    }
+
+    FontBinaryHeader header = { 0 };
+    memcpy(header.id, "rFNT", 4);
+    header.version = 1;
+    header.baseSize = font.baseSize;
+    header.charsCount = glyphsCount;
+    header.atlasWidth = atlas.width;
+    header.atlasHeight = atlas.height;
+    header.atlasFormat = atlas.format;
+    header.atlasDataSize = GetPixelDataSize(atlas.width, atlas.height, atlas.format);
+
+    FILE *fontFile = fopen(fileName, "wb");
+
+    if (fontFile != NULL)
+    {
+        success = (fwrite(&header, sizeof(FontBinaryHeader), 1, fontFile) == 1) &&
+                  (fwrite(glyphs, sizeof(FontBinaryGlyph), glyphsCount, fontFile) == (size_t)glyphsCount) &&
+                  (fwrite(atlas.data, header.atlasDataSize, 1, fontFile) == 1);
+
+        fclose(fontFile);
+    }
+
+    if (success) TraceLog(LOG_INFO, "[%s] Binary font exported successfully", fileName);
+    else TraceLog(LOG_WARNING, "[%s] Binary font could not be exported", fileName);
+
+    RL_FREE(glyphs);
+    UnloadImage(atlas);
+
+    return success;
+}
+
+// Load font from file shared with previous loads of same file (not modified since)
+// NOTE: Cached fonts should be unloaded with UnloadFontCached(), data is unloaded with last reference
+Font LoadFontCached(const char *fileName)
+{
+    Font *cached = (Font *)AcquireCachedAsset(ASSET_FONT, fileName, NULL);
+
+    if (cached != NULL) return *cached;
+
+    Font font = LoadFont(fileName);
+
+    // NOTE: Default font (fallback if loading failed) is not cached
+    if (font.texture.id != GetFontDefault().texture.id) AddCachedAsset(ASSET_FONT, fileName, NULL, &font, sizeof(Font), font.texture.id, NULL);
+
+    return font;
+}
+
+// Release cached font reference, font is unloaded with last reference
+// NOTE: Fonts not cached are unloaded directly
+void UnloadFontCached(Font font)
+{
+    Font cached = { 0 };
+    int result = ReleaseCachedAsset(ASSET_FONT, font.texture.id, &cached, sizeof(Font));
+
+    if (result == 1) UnloadFont(cached);
+    else if (result == -1) UnloadFont(font);
+}
+
 // Unload Font from GPU memory (VRAM)
 void UnloadFont(Font font)
 {
     // NOTE: Make sure font is not default font (fallback)
     if (font.texture.id != GetFontDefault().texture.id)
     {
+        UnloadGlyphLookup(font.chars);
+    #if defined(SUPPORT_FILEFORMAT_TTF)
+        UnloadDynamicFont(font.chars);
+    #endif
+
         for (int i = 0; i < font.charsCount; i++) UnloadImage(font.chars[i].image);
 
         UnloadTexture(font.texture);
@@ -788,6 +1372,41 @@ void DrawFPS(int posX, int posY)
     DrawText(TextFormat("%2i FPS", fps), posX, posY, 20, LIME);
 }
 
+// Draw CPU profile zones of last frame: time per zone and bar relative to frame time
+// NOTE: Zones are recorded once profiler is enabled (EnableProfiler())
+void DrawProfiler(int posX, int posY)
+{
+    #define PROFILER_LINE_HEIGHT    12
+    #define PROFILER_TEXT_WIDTH    220
+    #define PROFILER_BAR_WIDTH     100
+
+    int count = 0;
+    const ProfileZoneStats *zones = GetProfileZones(&count);
+    float frameTime = GetFrameTime()*1000.0f;
+
+    DrawRectangle(posX, posY, PROFILER_TEXT_WIDTH + PROFILER_BAR_WIDTH + 12, (count + 1)*PROFILER_LINE_HEIGHT + 8, Fade(BLACK, 0.7f));
+
+    if (IsProfilerEnabled()) DrawText(TextFormat("CPU frame: %.2f ms", frameTime), posX + 4, posY + 4, 10, LIME);
+    else DrawText("CPU profiler disabled", posX + 4, posY + 4, 10, GRAY);
+
+    for (int i = 0; i < count; i++)
+    {
+        int y = posY + 4 + (i + 1)*PROFILER_LINE_HEIGHT;
+        int indent = zones[i].depth*8;
+        int barWidth = (frameTime > 0.0f)? (int)(zones[i].time/frameTime*PROFILER_BAR_WIDTH) : 0;
+        if (barWidth > PROFILER_BAR_WIDTH) barWidth = PROFILER_BAR_WIDTH;
+
+        Color color = (zones[i].thread == 0)? RAYWHITE : SKYBLUE;
+
+        // NOTE: Zones recorded on other threads are prefixed by thread index
+        if (zones[i].thread == 0) DrawText(zones[i].name, posX + 4 + indent, y, 10, color);
+        else DrawText(TextFormat("[%i] %s", zones[i].thread, zones[i].name), posX + 4 + indent, y, 10, color);
+        DrawText(TextFormat("%6.2f ms x%i", zones[i].time, zones[i].calls), posX + PROFILER_TEXT_WIDTH - 76, y, 10, color);
+        DrawRectangle(posX + PROFILER_TEXT_WIDTH + 4, y + 1, PROFILER_BAR_WIDTH, PROFILER_LINE_HEIGHT - 4, Fade(DARKGRAY, 0.6f));
+        DrawRectangle(posX + PROFILER_TEXT_WIDTH + 4, y + 1, barWidth, PROFILER_LINE_HEIGHT - 4, (zones[i].thread == 0)? LIME : SKYBLUE);
+    }
+}
+
 // Draw text (using default font)
 // NOTE: fontSize work like in any drawing program but if fontSize is lower than font-base-size, then font-base-size is used
 // NOTE: chars spacing is proportional to fontSize
@@ -813,15 +1432,18 @@ void DrawTextCodepoint(Font font, int codepoint, Vector2 position, float scale,
     // NOTE: In case a codepoint is not available in the font, index returned points to '?'
     int index = GetGlyphIndex(font, codepoint);
 
-    // Character rectangle on screen
+    // Character quad on screen
     // NOTE: Quad is scaled proportionally to base character width-height
-    Rectangle rec = { position.x, position.y, font.recs[index].width*scale, font.recs[index].height*scale };
-    
-    DrawTexturePro(font.texture, font.recs[index], rec, (Vector2){ 0, 0 }, 0.0f, tint);
+    float vertices[4*3] = { 0 };
+    float texcoords[4*2] = { 0 };
+
+    GenGlyphQuad(vertices, texcoords, font, index, position.x, position.y, rlGetCurrentDepth(), scale);
+    DrawGlyphQuads(font.texture, vertices, texcoords, 1, tint);
 }
 
 // Draw text using Font
 // NOTE: chars spacing is NOT proportional to fontSize
+// NOTE: Glyph quads are generated in bulk (MAX_TEXT_QUADS_BATCH) and copied into render batch at once
 void DrawTextEx(Font font, const char *text, Vector2 position, float fontSize, float spacing, Color tint)
 {
     int length = strlen(text);      // Total length in bytes of the text, scanned by codepoints in loop
@@ -831,6 +1453,11 @@ void DrawTextEx(Font font, const char *text, Vector2 position, float fontSize, f
     
     float scaleFactor = fontSize/font.baseSize;     // Character quad scaling factor
 
+    float vertices[MAX_TEXT_QUADS_BATCH*4*3];       // Glyph quads positions (XYZ)
+    float texcoords[MAX_TEXT_QUADS_BATCH*4*2];      // Glyph quads texture coordinates (UV)
+    int quadsCount = 0;
+    float depth = rlGetCurrentDepth();
+
     for (int i = 0; i < length; i++)
     {
         // Get next codepoint from byte string and glyph index in font
@@ -853,12 +1480,16 @@ void DrawTextEx(Font font, const char *text, Vector2 position, float fontSize, f
         {
             if ((codepoint != ' ') && (codepoint != '\t')) 
             {
-                Rectangle rec = { position.x + textOffsetX + font.chars[index].offsetX*scaleFactor,
-                                  position.y + textOffsetY + font.chars[index].offsetY*scaleFactor, 
-                                  font.recs[index].width*scaleFactor, 
-                                  font.recs[index].height*scaleFactor };
-    
-                DrawTexturePro(font.texture, font.recs[index], rec, (Vector2){ 0, 0 }, 0.0f, tint);
+                GenGlyphQuad(vertices + quadsCount*4*3, texcoords + quadsCount*4*2, font, index,
+                             position.x + textOffsetX + font.chars[index].offsetX*scaleFactor,
+                             position.y + textOffsetY + font.chars[index].offsetY*scaleFactor, depth, scaleFactor);
+                quadsCount++;
+
+                if (quadsCount == MAX_TEXT_QUADS_BATCH)
+                {
+                    DrawGlyphQuads(font.texture, vertices, texcoords, quadsCount, tint);
+                    quadsCount = 0;
+                }
             }
 
             if (font.chars[index].advanceX == 0) textOffsetX += ((float)font.recs[index].width*scaleFactor + spacing);
@@ -867,18 +1498,107 @@ void DrawTextEx(Font font, const char *text, Vector2 position, float fontSize, f
         
         i += (codepointByteCount - 1);   // Move text bytes counter to next codepoint
     }
+
+    if (quadsCount > 0) DrawGlyphQuads(font.texture, vertices, texcoords, quadsCount, tint);
 }
 
-// Draw text using font inside rectangle limits
-void DrawTextRec(Font font, const char *text, Rectangle rec, float fontSize, float spacing, bool wordWrap, Color tint)
+// Load render texture with text drawn, text is rendered on GPU with batched glyph quads (DrawTextEx())
+// NOTE: Unlike ImageTextEx() no glyph is composed on CPU, pixel data can be requested later only if
+// required (RequestRenderTextureData()). Should not be called inside BeginTextureMode()
+RenderTexture2D LoadRenderTextureText(Font font, const char *text, float fontSize, float spacing, Color tint)
 {
-    DrawTextRecEx(font, text, rec, fontSize, spacing, wordWrap, tint, 0, 0, WHITE, WHITE);
+    Vector2 size = MeasureTextEx(font, text, fontSize, spacing);
+
+    RenderTexture2D target = LoadRenderTexture((size.x > 1.0f)? (int)ceilf(size.x) : 1, (size.y > 1.0f)? (int)ceilf(size.y) : 1);
+
+    if (target.id > 0)
+    {
+        BeginTextureMode(target);
+            // NOTE: Transparent background keeps tint color, so glyphs edges are not darkened when drawn
+            ClearBackground((Color){ tint.r, tint.g, tint.b, 0 });
+
+            BeginBlendMode(BLEND_ALPHA_TARGET);
+                DrawTextEx(font, text, (Vector2){ 0.0f, 0.0f }, fontSize, spacing, tint);
+            EndBlendMode();
+        EndTextureMode();
+    }
+
+    return target;
 }
 
-// Draw text using font inside rectangle limits with support for text selection
-void DrawTextRecEx(Font font, const char *text, Rectangle rec, float fontSize, float spacing, bool wordWrap, Color tint, int selectStart, int selectLength, Color selectTint, Color selectBackTint)
+// Create text layout: glyph quads are generated once and drawn without text decoding
+// NOTE: Layout size is the same as MeasureTextEx(), text is copied
+TextLayout CreateTextLayout(Font font, const char *text, float fontSize, float spacing)
 {
-    int length = strlen(text);      // Total length in bytes of the text, scanned by codepoints in loop
+    TextLayout layout = { 0 };
+
+    layout.font = font;
+    layout.fontSize = fontSize;
+    layout.spacing = spacing;
+
+    int length = (text != NULL)? strlen(text) : 0;
+    layout.text = (char *)RL_MALLOC(length + 1);
+    if (length > 0) memcpy(layout.text, text, length);
+    layout.text[length] = '\0';
+
+    BuildTextLayout(&layout);
+
+    return layout;
+}
+
+// Update text layout, glyph quads are only regenerated if text changes
+// NOTE: Layouts of dynamic fonts are also regenerated if their glyphs were evicted or moved in atlas
+void UpdateTextLayout(TextLayout *layout, const char *text)
+{
+    if (text == NULL) text = "";
+
+    if ((strcmp(layout->text, text) == 0) && (layout->version == GetFontAtlasVersion(layout->font))) return;
+
+    int length = strlen(text);
+
+    if (length > (int)strlen(layout->text)) layout->text = (char *)RL_REALLOC(layout->text, length + 1);
+    memcpy(layout->text, text, length + 1);
+
+    BuildTextLayout(layout);
+}
+
+// Unload text layout data
+void UnloadTextLayout(TextLayout layout)
+{
+    RL_FREE(layout.text);
+    RL_FREE(layout.vertices);
+    RL_FREE(layout.texcoords);
+}
+
+// Draw text layout, glyph quads are copied into render batch
+// NOTE: If layout dynamic font atlas changed since layout was built, text is drawn with DrawTextEx()
+void DrawTextLayout(TextLayout layout, Vector2 position, Color tint)
+{
+    if ((layout.quadsCount == 0) || (layout.font.texture.id == 0)) return;
+
+    if (layout.version != GetFontAtlasVersion(layout.font))
+    {
+        DrawTextEx(layout.font, layout.text, position, layout.fontSize, layout.spacing, tint);
+        return;
+    }
+
+    // NOTE: Layout quads are defined at depth 0, translated to current 2D depth (same as rlVertex2f())
+    rlPushMatrix();
+        rlTranslatef(position.x, position.y, rlGetCurrentDepth());
+        DrawGlyphQuads(layout.font.texture, layout.vertices, layout.texcoords, layout.quadsCount, tint);
+    rlPopMatrix();
+}
+
+// Draw text using font inside rectangle limits
+void DrawTextRec(Font font, const char *text, Rectangle rec, float fontSize, float spacing, bool wordWrap, Color tint)
+{
+    DrawTextRecEx(font, text, rec, fontSize, spacing, wordWrap, tint, 0, 0, WHITE, WHITE);
+}
+
+// Draw text using font inside rectangle limits with support for text selection
+void DrawTextRecEx(Font font, const char *text, Rectangle rec, float fontSize, float spacing, bool wordWrap, Color tint, int selectStart, int selectLength, Color selectTint, Color selectBackTint)
+{
+    int length = strlen(text);      // Total length in bytes of the text, scanned by codepoints in loop
 
     int textOffsetY = 0;            // Offset between lines (on line break '\n')
     float textOffsetX = 0.0f;       // Offset X to next character to draw
@@ -1082,24 +1802,38 @@ Vector2 MeasureTextEx(Font font, const char *text, float fontSize, float spacing
 }
 
 // Returns index position for a unicode character on spritefont
+// NOTE: Glyph lookup table is built on font loading (or first use), it is rebuilt if a found glyph does not match
 int GetGlyphIndex(Font font, int codepoint)
 {
 #define TEXT_CHARACTER_NOTFOUND     63      // Character: '?'
     
 #define UNORDERED_CHARSET
 #if defined(UNORDERED_CHARSET)
-    int index = TEXT_CHARACTER_NOTFOUND;
+    if ((font.chars == NULL) || (font.charsCount <= 0)) return TEXT_CHARACTER_NOTFOUND;
 
-    for (int i = 0; i < font.charsCount; i++)
+    GlyphLookup *lookup = GetGlyphLookup(font);
+    int index = FindGlyphIndex(lookup, codepoint);
+
+    // Font chars modified since lookup was built (same array), lookup is rebuilt
+    if ((index >= 0) && (font.chars[index].value != codepoint))
     {
-        if (font.chars[i].value == codepoint)
-        {
-            index = i;
-            break;
-        }
+        BuildGlyphLookup(lookup, font);
+        index = FindGlyphIndex(lookup, codepoint);
     }
 
-    return index;
+#if defined(SUPPORT_FILEFORMAT_TTF)
+    // Dynamic fonts: glyphs use is tracked for eviction, missing glyphs are rasterized
+    if (lookup->dynamic != NULL)
+    {
+        DynamicFont *dynamic = (DynamicFont *)lookup->dynamic;
+
+        if (index < 0) index = LoadDynamicGlyph(dynamic, lookup, font, codepoint);
+        if (index >= 0) dynamic->glyphsUse[index] = ++dynamic->useCounter;
+        else if (codepoint != '?') index = GetGlyphIndex(font, '?');
+    }
+#endif
+
+    return (index >= 0)? index : TEXT_CHARACTER_NOTFOUND;
 #else
     return (codepoint - 32);
 #endif
@@ -1129,51 +1863,69 @@ unsigned int TextLength(const char *text)
 }
 
 // Formatting of text with variables to 'embed'
-// WARNING: String returned will expire after this function is called MAX_TEXTFORMAT_BUFFERS times
+// WARNING: String returned will expire after this function is called MAX_TEXTFORMAT_BUFFERS times (on same thread)
 const char *TextFormat(const char *text, ...)
 {
-    #define MAX_TEXTFORMAT_BUFFERS 4
-
     // We create an array of buffers so strings don't expire until MAX_TEXTFORMAT_BUFFERS invocations
-    static char buffers[MAX_TEXTFORMAT_BUFFERS][MAX_TEXT_BUFFER_LENGTH] = { 0 };
-    static int  index = 0;
-    
+    static TEXT_THREAD_LOCAL char buffers[MAX_TEXTFORMAT_BUFFERS][MAX_TEXT_BUFFER_LENGTH] = { 0 };
+    static TEXT_THREAD_LOCAL int index = 0;
+
     char *currentBuffer = buffers[index];
 
     va_list args;
     va_start(args, text);
-    vsprintf(currentBuffer, text, args);
+    vsnprintf(currentBuffer, MAX_TEXT_BUFFER_LENGTH, text, args);
     va_end(args);
-    
+
     index += 1;     // Move to next buffer for next function call
     if (index >= MAX_TEXTFORMAT_BUFFERS) index = 0;
 
     return currentBuffer;
 }
 
+// Formatting of text with variables to 'embed' into provided buffer
+// NOTE: Text is truncated to fit buffer (bufferSize includes '\0')
+char *TextFormatEx(char *buffer, int bufferSize, const char *text, ...)
+{
+    if (bufferSize <= 0) return buffer;
+
+    va_list args;
+    va_start(args, text);
+    vsnprintf(buffer, bufferSize, text, args);
+    va_end(args);
+
+    return buffer;
+}
+
 // Get a piece of a text string
-// REQUIRES: strlen()
 const char *TextSubtext(const char *text, int position, int length)
 {
-    static char buffer[MAX_TEXT_BUFFER_LENGTH] = { 0 };
+    static TEXT_THREAD_LOCAL char buffer[MAX_TEXT_BUFFER_LENGTH] = { 0 };
+
+    return TextSubtextEx(buffer, MAX_TEXT_BUFFER_LENGTH, text, position, length);
+}
+
+// Get a piece of a text string into provided buffer
+// REQUIRES: strlen()
+char *TextSubtextEx(char *buffer, int bufferSize, const char *text, int position, int length)
+{
+    if (bufferSize <= 0) return buffer;
 
     int textLength = strlen(text);
 
+    if (position < 0) position = 0;
     if (position >= textLength)
     {
-        position = textLength - 1;
+        position = textLength;
         length = 0;
     }
 
-    if (length >= textLength) length = textLength;
+    if (length > (textLength - position)) length = textLength - position;
+    if (length > (bufferSize - 1)) length = bufferSize - 1;
+    if (length < 0) length = 0;
 
-    for (int c = 0 ; c < length ; c++)
-    {
-        *(buffer + c) = *(text + position);
-        text++;
-    }
-
-    *(buffer + length) = '\0';
+    memcpy(buffer, text + position, length);
+    buffer[length] = '\0';
 
     return buffer;
 }
@@ -1229,54 +1981,105 @@ char *TextReplace(char *text, const char *replace, const char *by)
     return result;
 }
 
+// Replace text string into provided buffer, no memory is allocated
+// NOTE: Result is truncated to fit buffer (bufferSize includes '\0'), NULL returned on invalid parameters
+// REQUIRES: strlen(), strstr()
+char *TextReplaceEx(char *buffer, int bufferSize, const char *text, const char *replace, const char *by)
+{
+    if (!text || !replace || (bufferSize <= 0)) return NULL;
+
+    int replaceLen = strlen(replace);
+    if (replaceLen == 0) return NULL;
+
+    if (!by) by = "";
+    int byLen = strlen(by);
+
+    int size = 0;
+    const char *insertPoint = NULL;
+
+    while ((size < (bufferSize - 1)) && ((insertPoint = strstr(text, replace)) != NULL))
+    {
+        TextAppendEx(buffer, bufferSize, &size, text, insertPoint - text);
+        TextAppendEx(buffer, bufferSize, &size, by, byLen);
+        text = insertPoint + replaceLen;
+    }
+
+    TextAppendEx(buffer, bufferSize, &size, text, strlen(text));
+    buffer[size] = '\0';
+
+    return buffer;
+}
+
 // Insert text in a specific position, moves all text forward
-// REQUIRES: strlen(), strcpy(), strtok()
+// REQUIRES: strlen()
 // WARNING: Allocated memory should be manually freed
 char *TextInsert(const char *text, const char *insert, int position)
 {
     int textLen = strlen(text);
-    int insertLen =  strlen(insert);
+    int insertLen = strlen(insert);
 
     char *result = (char *)RL_MALLOC(textLen + insertLen + 1);
 
-    for (int i = 0; i < position; i++) result[i] = text[i];
-    for (int i = position; i < insertLen + position; i++) result[i] = insert[i];
-    for (int i = (insertLen + position); i < (textLen + insertLen); i++) result[i] = text[i];
+    return TextInsertEx(result, textLen + insertLen + 1, text, insert, position);
+}
+
+// Insert text in a specific position into provided buffer, no memory is allocated
+// NOTE: Result is truncated to fit buffer (bufferSize includes '\0')
+// REQUIRES: strlen()
+char *TextInsertEx(char *buffer, int bufferSize, const char *text, const char *insert, int position)
+{
+    if (bufferSize <= 0) return buffer;
 
-    result[textLen + insertLen] = '\0';     // Make sure text string is valid!
+    int textLen = strlen(text);
 
-    return result;
+    if (position < 0) position = 0;
+    if (position > textLen) position = textLen;
+
+    int size = 0;
+    TextAppendEx(buffer, bufferSize, &size, text, position);
+    TextAppendEx(buffer, bufferSize, &size, insert, strlen(insert));
+    TextAppendEx(buffer, bufferSize, &size, text + position, textLen - position);
+    buffer[size] = '\0';
+
+    return buffer;
 }
 
 // Join text strings with delimiter
-// REQUIRES: strcat()
 const char *TextJoin(const char **textList, int count, const char *delimiter)
 {
-    static char text[MAX_TEXT_BUFFER_LENGTH] = { 0 };
-    memset(text, 0, MAX_TEXT_BUFFER_LENGTH);
+    static TEXT_THREAD_LOCAL char buffer[MAX_TEXT_BUFFER_LENGTH] = { 0 };
+
+    return TextJoinEx(buffer, MAX_TEXT_BUFFER_LENGTH, textList, count, delimiter);
+}
+
+// Join text strings with delimiter into provided buffer
+// NOTE: Strings that do not fit in buffer (bufferSize includes '\0') are skipped
+// REQUIRES: strlen()
+char *TextJoinEx(char *buffer, int bufferSize, const char **textList, int count, const char *delimiter)
+{
+    if (bufferSize <= 0) return buffer;
 
     int totalLength = 0;
     int delimiterLen = strlen(delimiter);
 
+    buffer[0] = '\0';
+
     for (int i = 0; i < count; i++)
     {
         int textListLength = strlen(textList[i]);
 
-        // Make sure joined text could fit inside MAX_TEXT_BUFFER_LENGTH
-        if ((totalLength + textListLength) < MAX_TEXT_BUFFER_LENGTH)
+        // Make sure joined text could fit inside buffer
+        if ((totalLength + textListLength) < bufferSize)
         {
-            strcat(text, textList[i]);
-            totalLength += textListLength;
+            TextAppendEx(buffer, bufferSize, &totalLength, textList[i], textListLength);
 
-            if ((delimiterLen > 0) && (i < (count - 1)))
-            {
-                strcat(text, delimiter);
-                totalLength += delimiterLen;
-            }
+            if ((delimiterLen > 0) && (i < (count - 1))) TextAppendEx(buffer, bufferSize, &totalLength, delimiter, delimiterLen);
         }
     }
 
-    return text;
+    buffer[totalLength] = '\0';
+
+    return buffer;
 }
 
 // Split string into multiple strings
@@ -1284,14 +2087,25 @@ const char **TextSplit(const char *text, char delimiter, int *count)
 {
     // NOTE: Current implementation returns a copy of the provided string with '\0' (string end delimiter)
     // inserted between strings defined by "delimiter" parameter. No memory is dynamically allocated,
-    // all used memory is static... it has some limitations:
+    // all used memory is static (per thread)... it has some limitations:
     //      1. Maximum number of possible split strings is set by TEXTSPLIT_MAX_SUBSTRINGS_COUNT
     //      2. Maximum size of text to split is TEXTSPLIT_MAX_TEXT_BUFFER_LENGTH
 
-    static const char *result[TEXTSPLIT_MAX_SUBSTRINGS_COUNT] = { NULL };
-    static char buffer[TEXTSPLIT_MAX_TEXT_BUFFER_LENGTH] = { 0 };
-    memset(buffer, 0, TEXTSPLIT_MAX_TEXT_BUFFER_LENGTH);
+    static TEXT_THREAD_LOCAL const char *result[TEXTSPLIT_MAX_SUBSTRINGS_COUNT] = { NULL };
+    static TEXT_THREAD_LOCAL char buffer[TEXTSPLIT_MAX_TEXT_BUFFER_LENGTH] = { 0 };
+
+    *count = TextSplitEx(buffer, TEXTSPLIT_MAX_TEXT_BUFFER_LENGTH, result, TEXTSPLIT_MAX_SUBSTRINGS_COUNT, text, delimiter);
 
+    return result;
+}
+
+// Split string into multiple strings, text is copied into provided buffer and split strings point to it
+// NOTE: Returns number of split strings (up to maxCount), text is truncated to fit buffer (bufferSize includes '\0')
+int TextSplitEx(char *buffer, int bufferSize, const char **result, int maxCount, const char *text, char delimiter)
+{
+    if ((bufferSize <= 0) || (maxCount <= 0)) return 0;
+
+    buffer[0] = '\0';
     result[0] = buffer;
     int counter = 0;
 
@@ -1300,23 +2114,25 @@ const char **TextSplit(const char *text, char delimiter, int *count)
         counter = 1;
 
         // Count how many substrings we have on text and point to every one
-        for (int i = 0; i < TEXTSPLIT_MAX_TEXT_BUFFER_LENGTH; i++)
+        int i = 0;
+        for (; i < (bufferSize - 1); i++)
         {
             buffer[i] = text[i];
             if (buffer[i] == '\0') break;
             else if (buffer[i] == delimiter)
             {
                 buffer[i] = '\0';   // Set an end of string at this point
+                if (counter == maxCount) break;
+
                 result[counter] = buffer + i + 1;
                 counter++;
-
-                if (counter == TEXTSPLIT_MAX_SUBSTRINGS_COUNT) break;
             }
         }
+
+        buffer[i] = '\0';
     }
 
-    *count = counter;
-    return result;
+    return counter;
 }
 
 // Append text at specific position and move cursor!
@@ -1327,6 +2143,19 @@ void TextAppend(char *text, const char *append, int *position)
     *position += strlen(append);
 }
 
+// Append text bytes at specific position into provided buffer and move cursor, no '\0' is added
+// NOTE: Appended text is truncated to fit buffer (bufferSize includes '\0')
+void TextAppendEx(char *buffer, int bufferSize, int *position, const char *append, int length)
+{
+    int available = bufferSize - 1 - *position;
+
+    if (length > available) length = available;
+    if (length <= 0) return;
+
+    memcpy(buffer + *position, append, length);
+    *position += length;
+}
+
 // Find first text occurrence within a string
 // REQUIRES: strstr()
 int TextFindIndex(const char *text, const char *find)
@@ -1344,13 +2173,20 @@ int TextFindIndex(const char *text, const char *find)
 // REQUIRES: toupper()
 const char *TextToUpper(const char *text)
 {
-    static char buffer[MAX_TEXT_BUFFER_LENGTH] = { 0 };
+    static TEXT_THREAD_LOCAL char buffer[MAX_TEXT_BUFFER_LENGTH] = { 0 };
 
-    for (int i = 0; i < MAX_TEXT_BUFFER_LENGTH; i++)
-    {
-        if (text[i] != '\0') buffer[i] = (char)toupper(text[i]);
-        else { buffer[i] = '\0'; break; }
-    }
+    return TextToUpperEx(buffer, MAX_TEXT_BUFFER_LENGTH, text);
+}
+
+// Get upper case version of provided string into provided buffer
+// REQUIRES: toupper()
+char *TextToUpperEx(char *buffer, int bufferSize, const char *text)
+{
+    if (bufferSize <= 0) return buffer;
+
+    int i = 0;
+    for (; (i < (bufferSize - 1)) && (text[i] != '\0'); i++) buffer[i] = (char)toupper(text[i]);
+    buffer[i] = '\0';
 
     return buffer;
 }
@@ -1359,13 +2195,20 @@ const char *TextToUpper(const char *text)
 // REQUIRES: tolower()
 const char *TextToLower(const char *text)
 {
-    static char buffer[MAX_TEXT_BUFFER_LENGTH] = { 0 };
+    static TEXT_THREAD_LOCAL char buffer[MAX_TEXT_BUFFER_LENGTH] = { 0 };
 
-    for (int i = 0; i < MAX_TEXT_BUFFER_LENGTH; i++)
-    {
-        if (text[i] != '\0') buffer[i] = (char)tolower(text[i]);
-        else { buffer[i] = '\0'; break; }
-    }
+    return TextToLowerEx(buffer, MAX_TEXT_BUFFER_LENGTH, text);
+}
+
+// Get lower case version of provided string into provided buffer
+// REQUIRES: tolower()
+char *TextToLowerEx(char *buffer, int bufferSize, const char *text)
+{
+    if (bufferSize <= 0) return buffer;
+
+    int i = 0;
+    for (; (i < (bufferSize - 1)) && (text[i] != '\0'); i++) buffer[i] = (char)tolower(text[i]);
+    buffer[i] = '\0';
 
     return buffer;
 }
@@ -1374,7 +2217,7 @@ const char *TextToLower(const char *text)
 // REQUIRES: toupper()
 const char *TextToPascal(const char *text)
 {
-    static char buffer[MAX_TEXT_BUFFER_LENGTH] = { 0 };
+    static TEXT_THREAD_LOCAL char buffer[MAX_TEXT_BUFFER_LENGTH] = { 0 };
 
     buffer[0] = (char)toupper(text[0]);
 
@@ -1418,7 +2261,7 @@ char *TextToUtf8(int *codepoints, int length)
 {
     // We allocate enough memory fo fit all possible codepoints
     // NOTE: 5 bytes for every codepoint should be enough
-    char *text = (char *)calloc(length*5, 1);
+    char *text = (char *)RL_CALLOC(length*5, 1);
     const char *utf8 = NULL;
     int size = 0;
     
@@ -1436,45 +2279,46 @@ char *TextToUtf8(int *codepoints, int length)
 }
 
 // Get all codepoints in a string, codepoints count returned by parameters
+// NOTE: Up to MAX_TEXT_UNICODE_CHARS codepoints are returned, use LoadCodepoints() or GetCodepointsEx() for longer texts
 int *GetCodepoints(const char *text, int *count)
 {
-    static int codepoints[MAX_TEXT_UNICODE_CHARS] = { 0 };
-    memset(codepoints, 0, MAX_TEXT_UNICODE_CHARS*sizeof(int));
+    static TEXT_THREAD_LOCAL int codepoints[MAX_TEXT_UNICODE_CHARS] = { 0 };
 
-    int bytesProcessed = 0;
-    int textLength = strlen(text);
-    int codepointsCount = 0;
+    *count = DecodeCodepoints(text, strlen(text), codepoints, MAX_TEXT_UNICODE_CHARS);
 
-    for (int i = 0; i < textLength; codepointsCount++)
-    {
-        codepoints[codepointsCount] = GetNextCodepoint(text + i, &bytesProcessed);
-        i += bytesProcessed;
-    }
+    return codepoints;
+}
+
+// Get all codepoints in a string into provided array (up to maxCount), returns codepoints count
+int GetCodepointsEx(const char *text, int *codepoints, int maxCount)
+{
+    return DecodeCodepoints(text, strlen(text), codepoints, maxCount);
+}
+
+// Load all codepoints in a string, no length limit (memory must be freed with UnloadCodepoints())
+int *LoadCodepoints(const char *text, int *count)
+{
+    int length = strlen(text);
 
-    *count = codepointsCount;
+    // NOTE: Every codepoint requires at least one byte, text length is the maximum codepoints count
+    int *codepoints = (int *)RL_MALLOC(((length > 0)? length : 1)*sizeof(int));
+
+    *count = DecodeCodepoints(text, length, codepoints, length);
 
     return codepoints;
 }
 
+// Unload codepoints data loaded with LoadCodepoints()
+void UnloadCodepoints(int *codepoints)
+{
+    RL_FREE(codepoints);
+}
+
 // Returns total number of characters(codepoints) in a UTF8 encoded text, until '\0' is found
 // NOTE: If an invalid UTF8 sequence is encountered a '?'(0x3f) codepoint is counted instead
 int GetCodepointsCount(const char *text)
 {
-    unsigned int len = 0;
-    char *ptr = (char *)&text[0];
-
-    while (*ptr != '\0')
-    {
-        int next = 0;
-        int letter = GetNextCodepoint(ptr, &next);
-
-        if (letter == 0x3f) ptr += 1;
-        else ptr += next;
-
-        len++;
-    }
-
-    return len;
+    return DecodeCodepoints(text, strlen(text), NULL, 0);
 }
 
 
@@ -1755,8 +2599,1204 @@ static Font LoadBMFont(const char *fileName)
         UnloadFont(font);
         font = GetFontDefault();
     }
-    else TraceLog(LOG_INFO, "[%s] Font loaded successfully", fileName);
+    else
+    {
+        GetGlyphLookup(font);       // Build glyph lookup table
+
+        TraceLog(LOG_INFO, "[%s] Font loaded successfully", fileName);
+    }
 
     return font;
 }
 #endif
+
+// Get font glyph lookup table, built if not available for font chars
+// NOTE: If all lookup slots are used, least recently built one is replaced
+static GlyphLookup *GetGlyphLookup(Font font)
+{
+    GlyphLookup *lookup = &glyphLookups[glyphLookupLast];
+
+    if ((lookup->chars == font.chars) && (lookup->charsCount == font.charsCount)) return lookup;
+
+    int freeSlot = -1;
+
+    for (int i = 0; i < MAX_GLYPH_LOOKUPS; i++)
+    {
+        if ((glyphLookups[i].chars == font.chars) && (glyphLookups[i].charsCount == font.charsCount))
+        {
+            glyphLookupLast = i;
+            return &glyphLookups[i];
+        }
+
+        if ((freeSlot == -1) && (glyphLookups[i].chars == NULL)) freeSlot = i;
+    }
+
+    if (freeSlot == -1)
+    {
+        freeSlot = glyphLookupNext;
+        glyphLookupNext = (glyphLookupNext + 1)%MAX_GLYPH_LOOKUPS;
+    }
+
+    lookup = &glyphLookups[freeSlot];
+    BuildGlyphLookup(lookup, font);
+    glyphLookupLast = freeSlot;
+
+    return lookup;
+}
+
+// Build font glyph lookup table: direct table for Latin codepoints, hash table for others
+// NOTE: On duplicated codepoints first glyph is used (same as linear search)
+static void BuildGlyphLookup(GlyphLookup *lookup, Font font)
+{
+    lookup->chars = font.chars;
+    lookup->charsCount = font.charsCount;
+#if defined(SUPPORT_FILEFORMAT_TTF)
+    lookup->dynamic = GetDynamicFont(font.chars);
+#endif
+
+    for (int i = 0; i < GLYPH_LOOKUP_DIRECT_SIZE; i++) lookup->direct[i] = -1;
+
+    // NOTE: Empty glyph slots (value -1, dynamic fonts) are counted, hash table has room for glyphs added later
+    int hashCount = 0;
+    for (int i = 0; i < font.charsCount; i++)
+    {
+        if ((font.chars[i].value < 0) || (font.chars[i].value >= GLYPH_LOOKUP_DIRECT_SIZE)) hashCount++;
+    }
+
+    int hashSize = 0;
+    if (hashCount > 0)
+    {
+        hashSize = 16;
+        while (hashSize < hashCount*2) hashSize *= 2;
+    }
+
+    if (hashSize != lookup->hashSize)
+    {
+        RL_FREE(lookup->hashCodepoints);
+        RL_FREE(lookup->hashIndices);
+
+        lookup->hashCodepoints = (hashSize > 0)? (int *)RL_MALLOC(hashSize*sizeof(int)) : NULL;
+        lookup->hashIndices = (hashSize > 0)? (int *)RL_MALLOC(hashSize*sizeof(int)) : NULL;
+        lookup->hashSize = hashSize;
+    }
+
+    for (int i = 0; i < hashSize; i++) lookup->hashCodepoints[i] = -1;
+
+    for (int i = 0; i < font.charsCount; i++)
+    {
+        if (font.chars[i].value != -1) AddGlyphLookup(lookup, font.chars[i].value, i);
+    }
+}
+
+// Add codepoint glyph index to lookup table, codepoints already available keep their glyph
+// NOTE: Hash table must have free slots (sized on BuildGlyphLookup())
+static void AddGlyphLookup(GlyphLookup *lookup, int codepoint, int index)
+{
+    if ((codepoint >= 0) && (codepoint < GLYPH_LOOKUP_DIRECT_SIZE))
+    {
+        if (lookup->direct[codepoint] == -1) lookup->direct[codepoint] = index;
+    }
+    else
+    {
+        unsigned int slot = ((unsigned int)codepoint*2654435761u) & (lookup->hashSize - 1);
+
+        while ((lookup->hashCodepoints[slot] != -1) && (lookup->hashCodepoints[slot] != codepoint)) slot = (slot + 1) & (lookup->hashSize - 1);
+
+        if (lookup->hashCodepoints[slot] == -1)
+        {
+            lookup->hashCodepoints[slot] = codepoint;
+            lookup->hashIndices[slot] = index;
+        }
+    }
+}
+
+// Unload font glyph lookup table (on font unloading)
+static void UnloadGlyphLookup(const CharInfo *chars)
+{
+    for (int i = 0; i < MAX_GLYPH_LOOKUPS; i++)
+    {
+        if ((chars != NULL) && (glyphLookups[i].chars == chars))
+        {
+            RL_FREE(glyphLookups[i].hashCodepoints);
+            RL_FREE(glyphLookups[i].hashIndices);
+            memset(&glyphLookups[i], 0, sizeof(GlyphLookup));
+        }
+    }
+}
+
+// Find codepoint glyph index in lookup table, -1 if not found
+static int FindGlyphIndex(const GlyphLookup *lookup, int codepoint)
+{
+    if ((codepoint >= 0) && (codepoint < GLYPH_LOOKUP_DIRECT_SIZE)) return lookup->direct[codepoint];
+
+    if (lookup->hashSize == 0) return -1;
+
+    unsigned int slot = ((unsigned int)codepoint*2654435761u) & (lookup->hashSize - 1);
+
+    while (lookup->hashCodepoints[slot] != -1)
+    {
+        if (lookup->hashCodepoints[slot] == codepoint) return lookup->hashIndices[slot];
+        slot = (slot + 1) & (lookup->hashSize - 1);
+    }
+
+    return -1;
+}
+
+#if defined(SUPPORT_FILEFORMAT_TTF)
+// Worker job: rasterize font glyphs (bitmap or SDF), chars values must be set
+// NOTE: stb_truetype font info is only read, glyphs bitmaps are allocated per glyph
+static void LoadFontGlyphsJob(void *data)
+{
+    FontGlyphsJob *job = (FontGlyphsJob *)data;
+    CharInfo *chars = job->chars;
+
+    for (int i = job->first; i < job->charsCount; i += job->step)
+    {
+        int chw = 0, chh = 0;   // Character width and height (on generation)
+        int ch = chars[i].value;    // Character value to get info for
+
+        //  Render a unicode codepoint to a bitmap
+        //      stbtt_GetCodepointBitmap()           -- allocates and returns a bitmap
+        //      stbtt_GetCodepointBitmapBox()        -- how big the bitmap must be
+        //      stbtt_MakeCodepointBitmap()          -- renders into bitmap you provide
+
+        if ((job->type == FONT_DEFAULT) || (job->type == FONT_BITMAP)) chars[i].image.data = stbtt_GetCodepointBitmap(job->fontInfo, job->scaleFactor, job->scaleFactor, ch, &chw, &chh, &chars[i].offsetX, &chars[i].offsetY);
+        else if ((job->type == FONT_SDF) && (ch != 32)) chars[i].image.data = stbtt_GetCodepointSDF(job->fontInfo, job->scaleFactor, ch, SDF_CHAR_PADDING, SDF_ON_EDGE_VALUE, SDF_PIXEL_DIST_SCALE, &chw, &chh, &chars[i].offsetX, &chars[i].offsetY);
+        else if ((job->type == FONT_MSDF) && (ch != 32)) chars[i].image.data = GenGlyphMsdf(job->fontInfo, job->scaleFactor, ch, &chw, &chh, &chars[i].offsetX, &chars[i].offsetY);
+        else
+        {
+            chars[i].image.data = NULL;
+            chars[i].offsetX = 0;
+            chars[i].offsetY = 0;
+        }
+
+        stbtt_GetCodepointHMetrics(job->fontInfo, ch, &chars[i].advanceX, NULL);
+        chars[i].advanceX = (int)((float)chars[i].advanceX*job->scaleFactor);
+
+        // Load characters images
+        chars[i].image.width = chw;
+        chars[i].image.height = chh;
+        chars[i].image.mipmaps = 1;
+        chars[i].image.format = (job->type == FONT_MSDF)? UNCOMPRESSED_R8G8B8 : UNCOMPRESSED_GRAYSCALE;
+
+        chars[i].offsetY += (int)((float)job->ascent*job->scaleFactor);
+
+        if ((job->type == FONT_BITMAP) && (chars[i].image.data != NULL))
+        {
+            // Aliased bitmap (black & white) font generation, avoiding anti-aliasing
+            // NOTE: For optimum results, bitmap font should be generated at base pixel size
+            for (int p = 0; p < chw*chh; p++)
+            {
+                if (((unsigned char *)chars[i].image.data)[p] < BITMAP_ALPHA_THRESHOLD) ((unsigned char *)chars[i].image.data)[p] = 0;
+                else ((unsigned char *)chars[i].image.data)[p] = 255;
+            }
+        }
+    }
+}
+
+// Get dynamic font data for font chars, NULL if font is not dynamic
+static DynamicFont *GetDynamicFont(const CharInfo *chars)
+{
+    for (int i = 0; i < MAX_DYNAMIC_FONTS; i++)
+    {
+        if ((chars != NULL) && (dynamicFonts[i].chars == chars)) return &dynamicFonts[i];
+    }
+
+    return NULL;
+}
+
+// Rasterize glyph into dynamic font atlas (skyline packing), atlas texture rectangle is updated
+// NOTE: If all slots are used least recently used glyph slot is reused, if atlas is full it is repacked
+static int LoadDynamicGlyph(DynamicFont *dynamic, GlyphLookup *lookup, Font font, int codepoint)
+{
+    if (codepoint < 0) return -1;
+
+    // Find free glyph slot, or least recently used one
+    int index = -1;
+    unsigned int oldestUse = 0xffffffff;
+
+    for (int i = 0; i < font.charsCount; i++)
+    {
+        if (font.chars[i].value == -1) { index = i; break; }
+        if (dynamic->glyphsUse[i] < oldestUse) { oldestUse = dynamic->glyphsUse[i]; index = i; }
+    }
+
+    if (font.chars[index].value != -1)
+    {
+        // NOTE: Evicted glyph atlas area is not reused until atlas is repacked
+        UnloadImage(font.chars[index].image);
+        memset(&font.chars[index], 0, sizeof(CharInfo));
+        font.chars[index].value = -1;
+        font.recs[index] = (Rectangle){ 0 };
+        dynamic->atlasVersion++;
+
+        BuildGlyphLookup(lookup, font);
+    }
+
+    // Rasterize glyph (GRAY_ALPHA: white with coverage as alpha)
+    CharInfo glyph = { 0 };
+    int width = 0, height = 0;
+    unsigned char *bitmap = stbtt_GetCodepointBitmap(&dynamic->fontInfo, dynamic->scaleFactor, dynamic->scaleFactor, codepoint, &width, &height, &glyph.offsetX, &glyph.offsetY);
+
+    stbtt_GetCodepointHMetrics(&dynamic->fontInfo, codepoint, &glyph.advanceX, NULL);
+    glyph.advanceX = (int)((float)glyph.advanceX*dynamic->scaleFactor);
+    glyph.offsetY += dynamic->ascent;
+    glyph.value = codepoint;
+
+    if ((bitmap == NULL) || (width == 0) || (height == 0)) width = height = 0;
+
+    glyph.image.width = width;
+    glyph.image.height = height;
+    glyph.image.mipmaps = 1;
+    glyph.image.format = UNCOMPRESSED_GRAY_ALPHA;
+    glyph.image.data = RL_MALLOC((width*height > 0)? width*height*2 : 1);
+
+    for (int i = 0; i < width*height; i++)
+    {
+        ((unsigned char *)glyph.image.data)[i*2] = 255;
+        ((unsigned char *)glyph.image.data)[i*2 + 1] = bitmap[i];
+    }
+
+    if (bitmap != NULL) stbtt_FreeBitmap(bitmap, NULL);
+
+    Rectangle rec = { 0 };
+
+    if ((width > 0) && (height > 0))
+    {
+        stbrp_rect packRec = { 0 };
+        packRec.w = width + 2*DYNAMIC_FONT_PADDING;
+        packRec.h = height + 2*DYNAMIC_FONT_PADDING;
+
+        stbrp_pack_rects(&dynamic->context, &packRec, 1);
+
+        if (!packRec.was_packed)
+        {
+            // Atlas is full: keep most recently used glyphs, other glyphs are evicted
+            // NOTE: Selected glyph slot is already free, it is not used by repacking
+            PackDynamicAtlas(dynamic, lookup, font);
+
+            stbrp_pack_rects(&dynamic->context, &packRec, 1);
+
+            if (!packRec.was_packed)
+            {
+                TraceLog(LOG_WARNING, "Dynamic font glyph could not be packed: %i", codepoint);
+                UnloadImage(glyph.image);
+                return -1;
+            }
+        }
+
+        rec.x = (float)(packRec.x + DYNAMIC_FONT_PADDING);
+        rec.y = (float)(packRec.y + DYNAMIC_FONT_PADDING);
+        rec.width = (float)width;
+        rec.height = (float)height;
+
+        rlUpdateTextureRec(font.texture.id, (int)rec.x, (int)rec.y, width, height, UNCOMPRESSED_GRAY_ALPHA, glyph.image.data);
+    }
+    else rec.width = (float)glyph.advanceX;     // NOTE: Empty glyphs (space) are measured but not drawn (zero height)
+
+    font.chars[index] = glyph;
+    font.recs[index] = rec;
+    AddGlyphLookup(lookup, codepoint, index);
+
+    return index;
+}
+
+// Repack dynamic font atlas keeping most recently used glyphs (up to DYNAMIC_FONT_KEEP_AREA of atlas area)
+// NOTE: Pending draws are flushed first, they could use glyphs moved or evicted
+static void PackDynamicAtlas(DynamicFont *dynamic, GlyphLookup *lookup, Font font)
+{
+    rlglDraw();
+
+    int atlasSize = font.texture.width;
+    int *order = (int *)RL_MALLOC(font.charsCount*sizeof(int));
+    int count = 0;
+
+    for (int i = 0; i < font.charsCount; i++) if (font.chars[i].value != -1) order[count++] = i;
+
+    // Sort used glyphs by last use, most recent first (insertion sort, only run when atlas is full)
+    for (int i = 1; i < count; i++)
+    {
+        int slot = order[i];
+        int j = i - 1;
+
+        while ((j >= 0) && (dynamic->glyphsUse[order[j]] < dynamic->glyphsUse[slot])) { order[j + 1] = order[j]; j--; }
+        order[j + 1] = slot;
+    }
+
+    // Select glyphs kept by area, other glyphs are evicted
+    stbrp_rect *packRecs = (stbrp_rect *)RL_CALLOC((count > 0)? count : 1, sizeof(stbrp_rect));
+    float keepArea = (float)atlasSize*atlasSize*DYNAMIC_FONT_KEEP_AREA;
+    float area = 0.0f;
+    int keepCount = 0;
+
+    for (int i = 0; i < count; i++)
+    {
+        const Image *image = &font.chars[order[i]].image;
+        float glyphArea = (float)(image->width + 2*DYNAMIC_FONT_PADDING)*(image->height + 2*DYNAMIC_FONT_PADDING);
+
+        if ((area + glyphArea) > keepArea) break;
+
+        area += glyphArea;
+        packRecs[keepCount].id = order[i];
+        packRecs[keepCount].w = (image->width > 0)? image->width + 2*DYNAMIC_FONT_PADDING : 0;
+        packRecs[keepCount].h = (image->height > 0)? image->height + 2*DYNAMIC_FONT_PADDING : 0;
+        keepCount++;
+    }
+
+    stbrp_init_target(&dynamic->context, atlasSize, atlasSize, dynamic->nodes, atlasSize);
+    stbrp_pack_rects(&dynamic->context, packRecs, keepCount);
+
+    // Generate atlas data with kept glyphs
+    unsigned char *atlasData = (unsigned char *)RL_MALLOC(atlasSize*atlasSize*2);
+    for (int i = 0; i < atlasSize*atlasSize; i++) { atlasData[i*2] = 255; atlasData[i*2 + 1] = 0; }
+
+    bool *kept = (bool *)RL_CALLOC(font.charsCount, sizeof(bool));
+
+    for (int i = 0; i < keepCount; i++)
+    {
+        int slot = packRecs[i].id;
+        Image *image = &font.chars[slot].image;
+
+        if (!packRecs[i].was_packed) continue;
+
+        kept[slot] = true;
+
+        if ((packRecs[i].w > 0) && (packRecs[i].h > 0))
+        {
+            font.recs[slot].x = (float)(packRecs[i].x + DYNAMIC_FONT_PADDING);
+            font.recs[slot].y = (float)(packRecs[i].y + DYNAMIC_FONT_PADDING);
+
+            for (int y = 0; y < image->height; y++)
+            {
+                memcpy(atlasData + (((int)font.recs[slot].y + y)*atlasSize + (int)font.recs[slot].x)*2,
+                       (unsigned char *)image->data + y*image->width*2, image->width*2);
+            }
+        }
+    }
+
+    for (int i = 0; i < font.charsCount; i++)
+    {
+        if ((font.chars[i].value != -1) && !kept[i])
+        {
+            UnloadImage(font.chars[i].image);
+            memset(&font.chars[i], 0, sizeof(CharInfo));
+            font.chars[i].value = -1;
+            font.recs[i] = (Rectangle){ 0 };
+            dynamic->glyphsUse[i] = 0;
+        }
+    }
+
+    rlUpdateTexture(font.texture.id, atlasSize, atlasSize, UNCOMPRESSED_GRAY_ALPHA, atlasData);
+    dynamic->atlasVersion++;
+
+    BuildGlyphLookup(lookup, font);
+
+    TraceLog(LOG_DEBUG, "Dynamic font atlas repacked: %i glyphs kept, %i evicted", keepCount, count - keepCount);
+
+    RL_FREE(kept);
+    RL_FREE(atlasData);
+    RL_FREE(packRecs);
+    RL_FREE(order);
+}
+
+// Unload dynamic font data (on font unloading)
+static void UnloadDynamicFont(const CharInfo *chars)
+{
+    DynamicFont *dynamic = GetDynamicFont(chars);
+
+    if (dynamic != NULL)
+    {
+        RL_FREE(dynamic->fontData);
+        RL_FREE(dynamic->nodes);
+        RL_FREE(dynamic->glyphsUse);
+        memset(dynamic, 0, sizeof(DynamicFont));
+    }
+}
+
+// Get generated font cache key: font file name and modification time, generation parameters
+static unsigned long long GetFontCacheHash(const char *fileName, int fontSize, const int *fontChars, int charsCount)
+{
+    // NOTE: FNV-1a 64 bit hash
+    unsigned long long hash = 14695981039346656037ULL;
+    int values[4] = { MSDF_CACHE_VERSION, fontSize, charsCount, (int)GetFileModTime(fileName) };
+
+    for (const char *c = fileName; *c != '\0'; c++) { hash ^= (unsigned char)*c; hash *= 1099511628211ULL; }
+    for (int i = 0; i < (int)sizeof(values); i++) { hash ^= ((unsigned char *)values)[i]; hash *= 1099511628211ULL; }
+
+    for (int i = 0; i < charsCount; i++)
+    {
+        int value = (fontChars != NULL)? fontChars[i] : (i + 32);
+        for (int k = 0; k < 4; k++) { hash ^= (unsigned char)(value >> (k*8)); hash *= 1099511628211ULL; }
+    }
+
+    return hash;
+}
+
+// Generate glyph multi-channel signed distance field (RGB), glyph box is extended by MSDF_CHAR_PADDING
+// NOTE: Every channel stores signed pseudo-distance to closest edge of its color, corners are kept sharp
+// by median of channels. Pixels with median inside/outside state not matching glyph shape are corrected
+// to true signed distance (all channels), distance range is MSDF_PIXEL_RANGE pixels
+static unsigned char *GenGlyphMsdf(const stbtt_fontinfo *fontInfo, float scale, int codepoint, int *width, int *height, int *offsetX, int *offsetY)
+{
+    *width = 0;
+    *height = 0;
+    *offsetX = 0;
+    *offsetY = 0;
+
+    stbtt_vertex *vertices = NULL;
+    int verticesCount = stbtt_GetCodepointShape(fontInfo, codepoint, &vertices);
+
+    if (verticesCount <= 0) return NULL;
+
+    // Load glyph contours edges, cubic curves (OpenType) are split into two quadratic curves
+    MsdfEdge *edges = (MsdfEdge *)RL_CALLOC(verticesCount*2, sizeof(MsdfEdge));
+    int *contours = (int *)RL_MALLOC((verticesCount + 1)*sizeof(int));  // Contours first edge, contour end is next contour first edge
+    int edgesCount = 0;
+    int contoursCount = 0;
+    double px = 0.0, py = 0.0;
+
+    for (int i = 0; i < verticesCount; i++)
+    {
+        const stbtt_vertex *v = &vertices[i];
+        double x = v->x, y = v->y;
+
+        if (v->type == STBTT_vmove) contours[contoursCount++] = edgesCount;
+        else if ((v->type == STBTT_vline) || ((v->type == STBTT_vcurve) && (v->cx == x) && (v->cy == y)))
+        {
+            if ((x != px) || (y != py))
+            {
+                MsdfEdge *edge = &edges[edgesCount++];
+                edge->x[0] = px; edge->y[0] = py;
+                edge->x[1] = x; edge->y[1] = y;
+            }
+        }
+        else if (v->type == STBTT_vcurve)
+        {
+            MsdfEdge *edge = &edges[edgesCount++];
+            edge->quadratic = 1;
+            edge->x[0] = px; edge->y[0] = py;
+            edge->x[1] = v->cx; edge->y[1] = v->cy;
+            edge->x[2] = x; edge->y[2] = y;
+        }
+        else if (v->type == STBTT_vcubic)
+        {
+            // Split cubic curve at t = 0.5, every half approximated by quadratic control point (3*(c1 + c2) - p0 - p3)/4
+            double c1x = v->cx, c1y = v->cy, c2x = v->cx1, c2y = v->cy1;
+            double m01x = (px + c1x)/2, m01y = (py + c1y)/2;
+            double m12x = (c1x + c2x)/2, m12y = (c1y + c2y)/2;
+            double m23x = (c2x + x)/2, m23y = (c2y + y)/2;
+            double m012x = (m01x + m12x)/2, m012y = (m01y + m12y)/2;
+            double m123x = (m12x + m23x)/2, m123y = (m12y + m23y)/2;
+            double midx = (m012x + m123x)/2, midy = (m012y + m123y)/2;
+
+            MsdfEdge *edge = &edges[edgesCount++];
+            edge->quadratic = 1;
+            edge->x[0] = px; edge->y[0] = py;
+            edge->x[1] = (3*(m01x + m012x) - px - midx)/4; edge->y[1] = (3*(m01y + m012y) - py - midy)/4;
+            edge->x[2] = midx; edge->y[2] = midy;
+
+            edge = &edges[edgesCount++];
+            edge->quadratic = 1;
+            edge->x[0] = midx; edge->y[0] = midy;
+            edge->x[1] = (3*(m123x + m23x) - midx - x)/4; edge->y[1] = (3*(m123y + m23y) - midy - y)/4;
+            edge->x[2] = x; edge->y[2] = y;
+        }
+
+        px = x;
+        py = y;
+    }
+
+    contours[contoursCount] = edgesCount;
+    stbtt_FreeShape(fontInfo, vertices);
+
+    if (edgesCount == 0)
+    {
+        RL_FREE(edges);
+        RL_FREE(contours);
+        return NULL;
+    }
+
+    MsdfColorEdges(edges, contours, contoursCount);
+
+    // Glyph bitmap box extended by padding
+    int x0 = 0, y0 = 0, x1 = 0, y1 = 0;
+    stbtt_GetCodepointBitmapBox(fontInfo, codepoint, scale, scale, &x0, &y0, &x1, &y1);
+
+    int w = x1 - x0 + 2*MSDF_CHAR_PADDING;
+    int h = y1 - y0 + 2*MSDF_CHAR_PADDING;
+
+    float *distances = (float *)RL_MALLOC(w*h*3*sizeof(float));
+    int agreement = 0;
+
+    for (int y = 0; y < h; y++)
+    {
+        for (int x = 0; x < w; x++)
+        {
+            // Pixel center in glyph units (bitmap is y-down, glyph shape is y-up)
+            double gx = (x0 - MSDF_CHAR_PADDING + x + 0.5)/scale;
+            double gy = -(y0 - MSDF_CHAR_PADDING + y + 0.5)/scale;
+
+            double minDistance[3] = { 1e240, 1e240, 1e240 };
+            double minDot[3] = { 1.0, 1.0, 1.0 };
+            double minParam[3] = { 0 };
+            int minEdge[3] = { -1, -1, -1 };
+
+            for (int e = 0; e < edgesCount; e++)
+            {
+                double distance = 0.0, dot = 0.0, param = 0.0;
+                MsdfEdgeDistance(&edges[e], gx, gy, &distance, &dot, &param);
+
+                for (int c = 0; c < 3; c++)
+                {
+                    if (!(edges[e].color & (1 << c))) continue;
+
+                    // NOTE: On equal distances, edge less parallel to point direction is closer (sharper corner side)
+                    if ((fabs(distance) < fabs(minDistance[c])) || ((fabs(distance) == fabs(minDistance[c])) && (dot < minDot[c])))
+                    {
+                        minDistance[c] = distance;
+                        minDot[c] = dot;
+                        minParam[c] = param;
+                        minEdge[c] = e;
+                    }
+                }
+            }
+
+            float *pixel = distances + (y*w + x)*3;
+
+            for (int c = 0; c < 3; c++)
+            {
+                if (minEdge[c] >= 0) pixel[c] = (float)MsdfPseudoDistance(&edges[minEdge[c]], gx, gy, minDistance[c], minParam[c]);
+                else pixel[c] = -1e30f;
+            }
+
+            float median = fmaxf(fminf(pixel[0], pixel[1]), fminf(fmaxf(pixel[0], pixel[1]), pixel[2]));
+            bool inside = (MsdfWinding(edges, edgesCount, gx, gy) != 0);
+
+            if ((median > 0.0f) == inside) agreement++;
+            else agreement--;
+        }
+    }
+
+    // NOTE: Distances sign depends on contours orientation (TrueType and OpenType outlines are opposite),
+    // it is selected to match glyph shape on most pixels
+    float sign = (agreement >= 0)? 1.0f : -1.0f;
+
+    unsigned char *data = (unsigned char *)RL_MALLOC(w*h*3);
+
+    for (int y = 0; y < h; y++)
+    {
+        for (int x = 0; x < w; x++)
+        {
+            float *pixel = distances + (y*w + x)*3;
+            for (int c = 0; c < 3; c++) pixel[c] *= sign;
+
+            float median = fmaxf(fminf(pixel[0], pixel[1]), fminf(fmaxf(pixel[0], pixel[1]), pixel[2]));
+
+            double gx = (x0 - MSDF_CHAR_PADDING + x + 0.5)/scale;
+            double gy = -(y0 - MSDF_CHAR_PADDING + y + 0.5)/scale;
+            bool inside = (MsdfWinding(edges, edgesCount, gx, gy) != 0);
+
+            if ((median > 0.0f) != inside)
+            {
+                // Error correction: channels replaced by true signed distance
+                double trueDistance = 1e240;
+
+                for (int e = 0; e < edgesCount; e++)
+                {
+                    double distance = 0.0, dot = 0.0, param = 0.0;
+                    MsdfEdgeDistance(&edges[e], gx, gy, &distance, &dot, &param);
+                    if (fabs(distance) < trueDistance) trueDistance = fabs(distance);
+                }
+
+                pixel[0] = pixel[1] = pixel[2] = (float)(inside? trueDistance : -trueDistance);
+            }
+
+            for (int c = 0; c < 3; c++)
+            {
+                float value = (pixel[c]*scale/(2.0f*MSDF_PIXEL_RANGE) + 0.5f)*255.0f;
+                data[(y*w + x)*3 + c] = (unsigned char)((value < 0.0f)? 0.0f : ((value > 255.0f)? 255.0f : (value + 0.5f)));
+            }
+        }
+    }
+
+    RL_FREE(distances);
+    RL_FREE(edges);
+    RL_FREE(contours);
+
+    *width = w;
+    *height = h;
+    *offsetX = x0 - MSDF_CHAR_PADDING;
+    *offsetY = y0 - MSDF_CHAR_PADDING;
+
+    return data;
+}
+
+// Assign edges colors: edges meeting at a corner get different colors, smooth contours are white
+// NOTE: Based on msdfgen simple edge coloring (Viktor Chlumsky)
+static void MsdfColorEdges(MsdfEdge *edges, const int *contours, int contoursCount)
+{
+    const double crossThreshold = sin(MSDF_CORNER_ANGLE);
+    const int startColors[3] = { MSDF_CYAN, MSDF_MAGENTA, MSDF_YELLOW };
+    unsigned long long seed = 0;
+
+    for (int c = 0; c < contoursCount; c++)
+    {
+        int first = contours[c];
+        int count = contours[c + 1] - first;
+
+        if (count == 0) continue;
+
+        MsdfEdge *contour = edges + first;
+        int *corners = (int *)RL_MALLOC(count*sizeof(int));
+        int cornersCount = 0;
+
+        // Find contour corners, edges direction changes with angle over threshold
+        double prevX = 0.0, prevY = 0.0;
+        MsdfEdgeDirection(&contour[count - 1], 1, &prevX, &prevY);
+
+        for (int i = 0; i < count; i++)
+        {
+            double dirX = 0.0, dirY = 0.0;
+            MsdfEdgeDirection(&contour[i], 0, &dirX, &dirY);
+
+            double prevLength = sqrt(prevX*prevX + prevY*prevY);
+            double dirLength = sqrt(dirX*dirX + dirY*dirY);
+
+            if ((prevLength > 0.0) && (dirLength > 0.0))
+            {
+                double dot = (prevX*dirX + prevY*dirY)/(prevLength*dirLength);
+                double cross = (prevX*dirY - prevY*dirX)/(prevLength*dirLength);
+
+                if ((dot <= 0.0) || (fabs(cross) > crossThreshold)) corners[cornersCount++] = i;
+            }
+
+            MsdfEdgeDirection(&contour[i], 1, &prevX, &prevY);
+        }
+
+        if ((cornersCount == 0) || ((cornersCount == 1) && (count < 3)))
+        {
+            // Smooth contour (or single corner contour with too few edges to split)
+            for (int i = 0; i < count; i++) contour[i].color = MSDF_WHITE;
+        }
+        else if (cornersCount == 1)
+        {
+            // Teardrop contour: edges split in three groups from corner (color, white, another color)
+            int colors[3] = { startColors[seed%3], MSDF_WHITE, 0 };
+            seed /= 3;
+            colors[2] = ((colors[0] << 1) | (colors[0] >> 2)) & MSDF_WHITE;
+
+            for (int i = 0; i < count; i++)
+            {
+                int group = (int)(3 + 2.875*i/(count - 1) - 1.4375 + 0.5) - 2;
+                if (group < 0) group = 0;
+                if (group > 2) group = 2;
+                contour[(corners[0] + i)%count].color = colors[group];
+            }
+        }
+        else
+        {
+            // Multiple corners: color switched on every corner, last color must differ from first one
+            int spline = 0;
+            int start = corners[0];
+            int color = startColors[seed%3];
+            seed /= 3;
+            int initialColor = color;
+
+            for (int i = 0; i < count; i++)
+            {
+                int index = (start + i)%count;
+
+                if (((spline + 1) < cornersCount) && (corners[spline + 1] == index))
+                {
+                    spline++;
+
+                    int banned = (spline == (cornersCount - 1))? initialColor : MSDF_BLACK;
+                    int combined = color & banned;
+
+                    // Switch to a color sharing one channel with current color (not banned one)
+                    if ((combined == MSDF_RED) || (combined == MSDF_GREEN) || (combined == MSDF_BLUE)) color = combined ^ MSDF_WHITE;
+                    else
+                    {
+                        int shifted = color << (1 + (int)(seed & 1));
+                        color = (shifted | (shifted >> 3)) & MSDF_WHITE;
+                        seed >>= 1;
+                    }
+                }
+
+                contour[index].color = color;
+            }
+        }
+
+        RL_FREE(corners);
+    }
+}
+
+// Get edge direction at start (end = 0) or end (end = 1), not normalized
+static void MsdfEdgeDirection(const MsdfEdge *edge, int end, double *dx, double *dy)
+{
+    if (!edge->quadratic)
+    {
+        *dx = edge->x[1] - edge->x[0];
+        *dy = edge->y[1] - edge->y[0];
+    }
+    else
+    {
+        *dx = (end == 0)? (edge->x[1] - edge->x[0]) : (edge->x[2] - edge->x[1]);
+        *dy = (end == 0)? (edge->y[1] - edge->y[0]) : (edge->y[2] - edge->y[1]);
+
+        // NOTE: Control point matching an endpoint, direction defined by endpoints
+        if ((*dx == 0.0) && (*dy == 0.0))
+        {
+            *dx = edge->x[2] - edge->x[0];
+            *dy = edge->y[2] - edge->y[0];
+        }
+    }
+}
+
+// Get signed distance from point to edge, dot is used to select closest edge on equal distances
+// NOTE: Distance sign is defined by point side relative to edge direction, param is closest point curve parameter
+static void MsdfEdgeDistance(const MsdfEdge *edge, double x, double y, double *distance, double *dot, double *param)
+{
+    if (!edge->quadratic)
+    {
+        double aqx = x - edge->x[0], aqy = y - edge->y[0];
+        double abx = edge->x[1] - edge->x[0], aby = edge->y[1] - edge->y[0];
+        double abLength = sqrt(abx*abx + aby*aby);
+
+        *param = (aqx*abx + aqy*aby)/(abx*abx + aby*aby);
+
+        int endpoint = (*param > 0.5)? 1 : 0;
+        double eqx = edge->x[endpoint] - x, eqy = edge->y[endpoint] - y;
+        double endpointDistance = sqrt(eqx*eqx + eqy*eqy);
+
+        if ((*param > 0.0) && (*param < 1.0))
+        {
+            double orthoDistance = (aqx*aby - aqy*abx)/abLength;
+
+            if (fabs(orthoDistance) < endpointDistance)
+            {
+                *distance = orthoDistance;
+                *dot = 0.0;
+                return;
+            }
+        }
+
+        double cross = aqx*aby - aqy*abx;
+        *distance = ((cross >= 0.0)? 1.0 : -1.0)*endpointDistance;
+        *dot = (endpointDistance > 0.0)? fabs((abx*eqx + aby*eqy)/(abLength*endpointDistance)) : 0.0;
+    }
+    else
+    {
+        // Closest point on curve: roots of cubic equation dot(B(t) - point, B'(t)) = 0
+        double qax = edge->x[0] - x, qay = edge->y[0] - y;
+        double abx = edge->x[1] - edge->x[0], aby = edge->y[1] - edge->y[0];
+        double brx = edge->x[2] - edge->x[1] - abx, bry = edge->y[2] - edge->y[1] - aby;
+
+        double a = brx*brx + bry*bry;
+        double b = 3*(abx*brx + aby*bry);
+        double c = 2*(abx*abx + aby*aby) + (qax*brx + qay*bry);
+        double d = qax*abx + qay*aby;
+
+        double t[3] = { 0 };
+        int solutions = SolveCubic(t, a, b, c, d);
+
+        double dir0x = 0.0, dir0y = 0.0, dir1x = 0.0, dir1y = 0.0;
+        MsdfEdgeDirection(edge, 0, &dir0x, &dir0y);
+        MsdfEdgeDirection(edge, 1, &dir1x, &dir1y);
+
+        double minDistance = ((dir0x*qay - dir0y*qax >= 0.0)? 1.0 : -1.0)*sqrt(qax*qax + qay*qay);
+        *param = -(qax*dir0x + qay*dir0y)/(dir0x*dir0x + dir0y*dir0y);
+
+        double qcx = edge->x[2] - x, qcy = edge->y[2] - y;
+        double endDistance = sqrt(qcx*qcx + qcy*qcy);
+
+        if (endDistance < fabs(minDistance))
+        {
+            minDistance = ((dir1x*qcy - dir1y*qcx >= 0.0)? 1.0 : -1.0)*endDistance;
+            *param = ((x - edge->x[1])*dir1x + (y - edge->y[1])*dir1y)/(dir1x*dir1x + dir1y*dir1y);
+        }
+
+        for (int i = 0; i < solutions; i++)
+        {
+            if ((t[i] > 0.0) && (t[i] < 1.0))
+            {
+                double qex = qax + 2*t[i]*abx + t[i]*t[i]*brx;
+                double qey = qay + 2*t[i]*aby + t[i]*t[i]*bry;
+                double curveDistance = sqrt(qex*qex + qey*qey);
+
+                if (curveDistance <= fabs(minDistance))
+                {
+                    double tx = abx + t[i]*brx, ty = aby + t[i]*bry;
+                    minDistance = ((tx*qey - ty*qex >= 0.0)? 1.0 : -1.0)*curveDistance;
+                    *param = t[i];
+                }
+            }
+        }
+
+        *distance = minDistance;
+
+        if ((*param >= 0.0) && (*param <= 1.0)) *dot = 0.0;
+        else if (*param < 0.5)
+        {
+            double length = sqrt(dir0x*dir0x + dir0y*dir0y)*sqrt(qax*qax + qay*qay);
+            *dot = (length > 0.0)? fabs((dir0x*qax + dir0y*qay)/length) : 0.0;
+        }
+        else
+        {
+            double length = sqrt(dir1x*dir1x + dir1y*dir1y)*endDistance;
+            *dot = (length > 0.0)? fabs((dir1x*qcx + dir1y*qcy)/length) : 0.0;
+        }
+    }
+}
+
+// Get signed pseudo-distance: closest point beyond edge endpoints is measured to edge tangent line
+static double MsdfPseudoDistance(const MsdfEdge *edge, double x, double y, double distance, double param)
+{
+    int last = edge->quadratic? 2 : 1;
+    double dirX = 0.0, dirY = 0.0;
+
+    if (param < 0.0)
+    {
+        MsdfEdgeDirection(edge, 0, &dirX, &dirY);
+
+        double length = sqrt(dirX*dirX + dirY*dirY);
+        double aqx = x - edge->x[0], aqy = y - edge->y[0];
+
+        if ((length > 0.0) && ((aqx*dirX + aqy*dirY) < 0.0))
+        {
+            double pseudoDistance = (aqx*dirY - aqy*dirX)/length;
+            if (fabs(pseudoDistance) <= fabs(distance)) distance = pseudoDistance;
+        }
+    }
+    else if (param > 1.0)
+    {
+        MsdfEdgeDirection(edge, 1, &dirX, &dirY);
+
+        double length = sqrt(dirX*dirX + dirY*dirY);
+        double bqx = x - edge->x[last], bqy = y - edge->y[last];
+
+        if ((length > 0.0) && ((bqx*dirX + bqy*dirY) > 0.0))
+        {
+            double pseudoDistance = (bqx*dirY - bqy*dirX)/length;
+            if (fabs(pseudoDistance) <= fabs(distance)) distance = pseudoDistance;
+        }
+    }
+
+    return distance;
+}
+
+// Get shape winding number at point (non-zero winding rule, 0 if outside)
+// NOTE: Crossings of horizontal ray to +X, edges include start point and exclude end point going up (and opposite going down)
+static int MsdfWinding(const MsdfEdge *edges, int edgesCount, double x, double y)
+{
+    int winding = 0;
+
+    for (int e = 0; e < edgesCount; e++)
+    {
+        const MsdfEdge *edge = &edges[e];
+
+        if (!edge->quadratic)
+        {
+            double cross = (edge->x[1] - edge->x[0])*(y - edge->y[0]) - (x - edge->x[0])*(edge->y[1] - edge->y[0]);
+
+            if (edge->y[0] <= y) { if ((edge->y[1] > y) && (cross > 0.0)) winding++; }
+            else if ((edge->y[1] <= y) && (cross < 0.0)) winding--;
+        }
+        else
+        {
+            double a = edge->y[0] - 2*edge->y[1] + edge->y[2];
+            double b = 2*(edge->y[1] - edge->y[0]);
+            double c = edge->y[0] - y;
+
+            double t[2] = { 0 };
+            int solutions = SolveQuadratic(t, a, b, c);
+
+            for (int i = 0; i < solutions; i++)
+            {
+                double dy = 2*a*t[i] + b;
+                double u = 1.0 - t[i];
+                double cx = u*u*edge->x[0] + 2*u*t[i]*edge->x[1] + t[i]*t[i]*edge->x[2];
+
+                if (cx <= x) continue;
+
+                if ((dy > 0.0) && (t[i] >= 0.0) && (t[i] < 1.0)) winding++;
+                else if ((dy < 0.0) && (t[i] > 0.0) && (t[i] <= 1.0)) winding--;
+            }
+        }
+    }
+
+    return winding;
+}
+
+// Solve quadratic equation a*t^2 + b*t + c = 0, returns solutions count (-1 if infinite)
+static int SolveQuadratic(double *t, double a, double b, double c)
+{
+    if ((a == 0.0) || ((fabs(b) + fabs(c)) > 1e12*fabs(a)))
+    {
+        // Linear equation
+        if ((b == 0.0) || (fabs(c) > 1e12*fabs(b))) return (c == 0.0)? -1 : 0;
+
+        t[0] = -c/b;
+        return 1;
+    }
+
+    double discriminant = b*b - 4*a*c;
+
+    if (discriminant > 0.0)
+    {
+        discriminant = sqrt(discriminant);
+        t[0] = (-b + discriminant)/(2*a);
+        t[1] = (-b - discriminant)/(2*a);
+        return 2;
+    }
+    else if (discriminant == 0.0)
+    {
+        t[0] = -b/(2*a);
+        return 1;
+    }
+
+    return 0;
+}
+
+// Solve cubic equation a*t^3 + b*t^2 + c*t + d = 0, returns solutions count (-1 if infinite)
+static int SolveCubic(double *t, double a, double b, double c, double d)
+{
+    if (a != 0.0)
+    {
+        double bn = b/a, cn = c/a, dn = d/a;
+
+        if ((fabs(bn) < 1e6) && (fabs(cn) < 1e6) && (fabs(dn) < 1e6))
+        {
+            // Normalized cubic equation t^3 + bn*t^2 + cn*t + dn = 0 (trigonometric or Cardano solution)
+            double bn2 = bn*bn;
+            double q = (bn2 - 3*cn)/9;
+            double r = (bn*(2*bn2 - 9*cn) + 27*dn)/54;
+            double r2 = r*r;
+            double q3 = q*q*q;
+
+            if (r2 < q3)
+            {
+                double angle = r/sqrt(q3);
+                if (angle < -1.0) angle = -1.0;
+                if (angle > 1.0) angle = 1.0;
+                angle = acos(angle);
+                bn /= 3;
+                q = -2*sqrt(q);
+
+                t[0] = q*cos(angle/3) - bn;
+                t[1] = q*cos((angle + 2*PI)/3) - bn;
+                t[2] = q*cos((angle - 2*PI)/3) - bn;
+                return 3;
+            }
+            else
+            {
+                double u = -pow(fabs(r) + sqrt(r2 - q3), 1.0/3.0);
+                if (r < 0.0) u = -u;
+                double v = (u == 0.0)? 0.0 : q/u;
+                bn /= 3;
+
+                t[0] = (u + v) - bn;
+                t[1] = -0.5*(u + v) - bn;
+                t[2] = 0.5*sqrt(3.0)*(u - v);
+                return (fabs(t[2]) < 1e-14)? 2 : 1;
+            }
+        }
+    }
+
+    return SolveQuadratic(t, b, c, d);
+}
+#endif  // SUPPORT_FILEFORMAT_TTF
+
+// Build text layout glyph quads from layout text (same placement as DrawTextEx())
+static void BuildTextLayout(TextLayout *layout)
+{
+    Font font = layout->font;
+    const char *text = layout->text;
+    int length = strlen(text);
+
+    // NOTE: Quads arrays are sized for one quad per byte (upper bound of drawn codepoints)
+    RL_FREE(layout->vertices);
+    RL_FREE(layout->texcoords);
+    layout->vertices = (float *)RL_MALLOC(((length > 0)? length : 1)*4*3*sizeof(float));
+    layout->texcoords = (float *)RL_MALLOC(((length > 0)? length : 1)*4*2*sizeof(float));
+    layout->quadsCount = 0;
+
+    int textOffsetY = 0;
+    float textOffsetX = 0.0f;
+    float scaleFactor = layout->fontSize/font.baseSize;
+
+    for (int i = 0; i < length; i++)
+    {
+        int codepointByteCount = 0;
+        int codepoint = GetNextCodepoint(&text[i], &codepointByteCount);
+        int index = GetGlyphIndex(font, codepoint);
+
+        if (codepoint == 0x3f) codepointByteCount = 1;
+
+        if (codepoint == '\n')
+        {
+            textOffsetY += (int)((font.baseSize + font.baseSize/2)*scaleFactor);
+            textOffsetX = 0.0f;
+        }
+        else
+        {
+            if ((codepoint != ' ') && (codepoint != '\t'))
+            {
+                GenGlyphQuad(layout->vertices + layout->quadsCount*4*3, layout->texcoords + layout->quadsCount*4*2, font, index,
+                             textOffsetX + font.chars[index].offsetX*scaleFactor,
+                             textOffsetY + font.chars[index].offsetY*scaleFactor, 0.0f, scaleFactor);
+                layout->quadsCount++;
+            }
+
+            if (font.chars[index].advanceX == 0) textOffsetX += ((float)font.recs[index].width*scaleFactor + layout->spacing);
+            else textOffsetX += ((float)font.chars[index].advanceX*scaleFactor + layout->spacing);
+        }
+
+        i += (codepointByteCount - 1);
+    }
+
+    layout->size = MeasureTextEx(font, text, layout->fontSize, layout->spacing);
+
+    // NOTE: Version is read after glyphs lookup, dynamic glyphs could be rasterized while building
+    layout->version = GetFontAtlasVersion(font);
+}
+
+// Get font atlas version (dynamic fonts), 0 for static fonts
+static unsigned int GetFontAtlasVersion(Font font)
+{
+    unsigned int version = 0;
+
+#if defined(SUPPORT_FILEFORMAT_TTF)
+    DynamicFont *dynamic = GetDynamicFont(font.chars);
+    if (dynamic != NULL) version = dynamic->atlasVersion;
+#endif
+
+    return version;
+}
+
+// Decode UTF8 text codepoints (only counted if codepoints is NULL, maxCount ignored)
+// NOTE: ASCII runs are processed 16 bytes at once with SIMD instructions (if available), other
+// sequences with GetNextCodepoint(), invalid bytes are decoded as '?'(0x3f) moving one byte (same as DrawTextEx())
+static int DecodeCodepoints(const char *text, int length, int *codepoints, int maxCount)
+{
+    const unsigned char *bytes = (const unsigned char *)text;
+    int count = 0;
+    int i = 0;
+
+    while (i < length)
+    {
+#if defined(TEXT_SIMD_SSE2) || defined(TEXT_SIMD_NEON)
+        // Bulk ASCII runs: 16 codepoints per iteration, stops on first block with a non-ASCII byte
+        while (((i + 16) <= length) && ((codepoints == NULL) || ((count + 16) <= maxCount)))
+        {
+    #if defined(TEXT_SIMD_SSE2)
+            __m128i block = _mm_loadu_si128((const __m128i *)(bytes + i));
+            if (_mm_movemask_epi8(block) != 0) break;
+
+            if (codepoints != NULL)
+            {
+                __m128i zero = _mm_setzero_si128();
+                __m128i low = _mm_unpacklo_epi8(block, zero);
+                __m128i high = _mm_unpackhi_epi8(block, zero);
+
+                _mm_storeu_si128((__m128i *)(codepoints + count), _mm_unpacklo_epi16(low, zero));
+                _mm_storeu_si128((__m128i *)(codepoints + count + 4), _mm_unpackhi_epi16(low, zero));
+                _mm_storeu_si128((__m128i *)(codepoints + count + 8), _mm_unpacklo_epi16(high, zero));
+                _mm_storeu_si128((__m128i *)(codepoints + count + 12), _mm_unpackhi_epi16(high, zero));
+            }
+    #else
+            uint8x16_t block = vld1q_u8(bytes + i);
+            uint8x8_t any = vorr_u8(vget_low_u8(block), vget_high_u8(block));
+            if ((vget_lane_u64(vreinterpret_u64_u8(any), 0) & 0x8080808080808080ULL) != 0) break;
+
+            if (codepoints != NULL)
+            {
+                uint16x8_t low = vmovl_u8(vget_low_u8(block));
+                uint16x8_t high = vmovl_u8(vget_high_u8(block));
+
+                vst1q_u32((uint32_t *)(codepoints + count), vmovl_u16(vget_low_u16(low)));
+                vst1q_u32((uint32_t *)(codepoints + count + 4), vmovl_u16(vget_high_u16(low)));
+                vst1q_u32((uint32_t *)(codepoints + count + 8), vmovl_u16(vget_low_u16(high)));
+                vst1q_u32((uint32_t *)(codepoints + count + 12), vmovl_u16(vget_high_u16(high)));
+            }
+    #endif
+            i += 16;
+            count += 16;
+        }
+#endif
+        // Scalar decoding until next 16 bytes block (or text end)
+        int blockEnd = ((i + 16) < length)? (i + 16) : length;
+
+        while (i < blockEnd)
+        {
+            if ((codepoints != NULL) && (count >= maxCount)) return count;
+
+            int codepoint = bytes[i];
+            int codepointByteCount = 1;
+
+            if (codepoint >= 0x80)
+            {
+                codepoint = GetNextCodepoint(text + i, &codepointByteCount);
+                if (codepoint == 0x3f) codepointByteCount = 1;
+            }
+
+            if (codepoints != NULL) codepoints[count] = codepoint;
+
+            count++;
+            i += codepointByteCount;
+        }
+
+        if ((codepoints != NULL) && (count >= maxCount)) break;
+    }
+
+    return count;
+}
+
+// Generate glyph quad vertex data: quad top-left corner at (x, y), glyph rectangle scaled
+// NOTE: Quad vertex order: top-left, bottom-left, bottom-right, top-right (same as DrawTexturePro())
+static void GenGlyphQuad(float *vertices, float *texcoords, Font font, int index, float x, float y, float z, float scale)
+{
+    Rectangle source = font.recs[index];
+    float w = source.width*scale;
+    float h = source.height*scale;
+    float width = (float)font.texture.width;
+    float height = (float)font.texture.height;
+
+    vertices[0] = x; vertices[1] = y; vertices[2] = z;
+    vertices[3] = x; vertices[4] = y + h; vertices[5] = z;
+    vertices[6] = x + w; vertices[7] = y + h; vertices[8] = z;
+    vertices[9] = x + w; vertices[10] = y; vertices[11] = z;
+
+    texcoords[0] = source.x/width; texcoords[1] = source.y/height;
+    texcoords[2] = source.x/width; texcoords[3] = (source.y + source.height)/height;
+    texcoords[4] = (source.x + source.width)/width; texcoords[5] = (source.y + source.height)/height;
+    texcoords[6] = (source.x + source.width)/width; texcoords[7] = source.y/height;
+}
+
+// Draw glyph quads, quads are copied into render batch at once (no per glyph matrix transform)
+// NOTE: Quads are submitted in chunks smaller than batch capacity, render batch is flushed when full
+static void DrawGlyphQuads(Texture2D texture, const float *vertices, const float *texcoords, int quadsCount, Color tint)
+{
+    if ((texture.id == 0) || (quadsCount <= 0)) return;
+
+    int batchQuads = rlGetBatchElements() - 1;
+    if (batchQuads < 1) batchQuads = 1;
+
+    for (int i = 0; i < quadsCount; i += batchQuads)
+    {
+        int count = ((quadsCount - i) < batchQuads)? (quadsCount - i) : batchQuads;
+
+        // NOTE: Texture is enabled after flushing, render batch draw calls are reset on flush
+        if (rlCheckBufferLimit(count*4)) rlglDraw();
+
+        rlEnableTexture(texture.id);
+
+        rlBegin(RL_QUADS);
+            rlColor4ub(tint.r, tint.g, tint.b, tint.a);
+            rlNormal3f(0.0f, 0.0f, 1.0f);   // Normal vector pointing towards viewer
+            rlQuadBatch(vertices + i*4*3, texcoords + i*4*2, NULL, count);
+        rlEnd();
+    }
+
+    rlDisableTexture();
+}
@@ -15,6 +15,7 @@
 *   #define SUPPORT_FILEFORMAT_DDS
 *   #define SUPPORT_FILEFORMAT_PKM
 *   #define SUPPORT_FILEFORMAT_KTX
+*   #define SUPPORT_FILEFORMAT_KTX2
 *   #define SUPPORT_FILEFORMAT_PVR
 *   #define SUPPORT_FILEFORMAT_ASTC
 *       Select desired fileformats to be supported for image data loading. Some of those formats are
@@ -57,6 +58,7 @@
 *
 **********************************************************************************************/
 
+#define RL_MEMORY_TAG   MEMORY_TAG_TEXTURES     // Module allocations subsystem (GetMemoryStats())
 #include "raylib.h"             // Declares module functions
 
 // Check if config flags have been externally provided on compilation line
@@ -70,6 +72,25 @@
 
 #include "utils.h"              // Required for: fopen() Android mapping
 
+// SIMD instructions used on image blending (ImageDraw())
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+    #include <emmintrin.h>      // Required for: SSE2 intrinsics
+    #define IMAGE_SIMD_SSE2
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+    #include <arm_neon.h>       // Required for: NEON intrinsics
+    #define IMAGE_SIMD_NEON
+#endif
+
+// Memory-mapped files support (LoadImageMapped())
+// NOTE: Android assets and web virtual filesystem are not regular files, file data is read instead
+#if (defined(__unix__) || defined(__APPLE__)) && !defined(PLATFORM_ANDROID) && !defined(PLATFORM_WEB)
+    #include <sys/mman.h>       // Required for: mmap(), munmap()
+    #include <sys/stat.h>       // Required for: fstat()
+    #include <fcntl.h>          // Required for: open()
+    #include <unistd.h>         // Required for: close()
+    #define SUPPORT_FILE_MAPPING
+#endif
+
 #include "rlgl.h"               // raylib OpenGL abstraction layer to OpenGL 1.1, 3.3 or ES2
                                 // Required for: rlLoadTexture() rlDeleteTextures(),
                                 //      rlGenerateMipmaps(), some funcs for DrawTexturePro()
@@ -141,17 +162,223 @@
 //----------------------------------------------------------------------------------
 // Defines and Macros
 //----------------------------------------------------------------------------------
-// Nop...
+#define MAX_IMAGE_MAPPINGS      16      // Maximum number of images loaded at the same time with LoadImageMapped()
+#define MAX_ASYNC_IMAGES_PER_FRAME  32  // Maximum number of images delivered per frame by LoadImagesAsync() (callbacks)
+#define MAX_ASYNC_FILEPATH_LENGTH  512  // Maximum file path length for LoadImagesAsync()
+#define MAX_IMAGE_BANDS         32      // Maximum number of row bands an image operation is split into (worker jobs)
+#define MIN_IMAGE_BAND_PIXELS   65536   // Minimum number of pixels processed per row band (smaller images run on calling thread)
+#define TILED_IMAGE_TILE_SIZE     256   // Tiled image tiles size in pixels (width and height)
+#define MAX_TILED_IMAGE_TILES      64   // Maximum number of tiles kept in memory per tiled image (LRU cache)
+#define MAX_TILED_IMAGE_MIPMAPS    32   // Maximum number of mipmap levels exported from tiled image
+#define MAX_VIRTUAL_PAGE_LOADS     16   // Maximum number of virtual texture pages loaded per worker job
+#define VIRTUAL_TEXTURE_FEEDBACK_SCALE  8   // Virtual texture feedback render texture size divider (screen size)
+#define VIRTUAL_TEXTURE_FALLBACK_SIZE 1024  // Virtual texture fallback texture maximum size (mipmap level loaded)
+#define TEXTURE_UPLOAD_BUDGET   4194304 // Default bytes uploaded per frame by progressive textures (SetTextureUploadBudget())
+#define TEXTURE_FIRST_UPLOAD      65536 // Bytes uploaded by LoadTextureProgressive() before returning (smallest mipmaps)
+#define MAX_POSTPROCESS_EFFECTS    16   // Maximum number of effects per post-processing chain
+#define MAX_POSTEFFECT_VALUES       8   // Maximum number of uniform values kept per per-pixel effect
 
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
-// ...
+// Image file mapping, Image.data points into file data
+typedef struct ImageMapping {
+    void *fileData;             // File data (mapped or loaded)
+    size_t fileSize;            // File data size in bytes
+    const void *imageData;      // Image data pointer (inside file data)
+    bool mapped;                // File data is memory-mapped (otherwise allocated)
+    bool packed;                // File data is inside a mounted pack file (not released)
+} ImageMapping;
+
+// Asynchronous image load job, decoded on worker thread
+typedef struct AsyncImageJob {
+    char fileName[MAX_ASYNC_FILEPATH_LENGTH];   // Image file name
+    Image image;                // Image loaded (decoded)
+    int pending;                // Worker job pending counter (0 when image is loaded)
+    bool delivered;             // Image delivered to callback
+} AsyncImageJob;
+
+// Asynchronous images load batch (LoadImagesAsync())
+typedef struct AsyncImageBatch {
+    AsyncImageJob *jobs;        // Image load jobs
+    int count;                  // Number of jobs
+    int delivered;              // Number of images delivered to callback
+    LoadImageCallback callback; // Callback called on main thread for every image loaded
+    void *userData;             // Callback user data
+    struct AsyncImageBatch *next;   // Next batch in list
+} AsyncImageBatch;
+
+// Image rows band process function, processes rows [startRow, endRow)
+typedef void (*ImageBandFunc)(void *data, int startRow, int endRow);
+
+// Image rows band job, run on worker thread
+typedef struct ImageBandJob {
+    ImageBandFunc func;         // Band process function
+    void *data;                 // Operation data (shared by all bands)
+    int startRow;               // First row of the band
+    int endRow;                 // Last row of the band (not included)
+} ImageBandJob;
+
+// Image pixel format conversion data (8 bit per channel source formats)
+typedef struct ImageConvertData {
+    const unsigned char *src;   // Source pixels data
+    int srcChannels;            // Source pixels channels (1 to 4)
+    void *dst;                  // Destination pixels data
+    int dstFormat;              // Destination pixel format
+    int width;                  // Image width (pixels per row)
+} ImageConvertData;
+
+// Tiled image tile, pixels data cached in memory
+typedef struct ImageTile {
+    int x;                      // Tile position x (in tiles), -1 if tile slot is not used
+    int y;                      // Tile position y (in tiles)
+    unsigned char *data;        // Tile pixels data (tile width at image borders could be smaller)
+    unsigned int lastUse;       // Tile last use counter value (LRU)
+} ImageTile;
+
+// Tiled image internal data, file pixels are read by tiles on demand
+typedef struct TiledImageData {
+    FILE *file;                 // Image file (kept open)
+    long long dataOffset;       // Pixels data offset in file
+    ImageTile tiles[MAX_TILED_IMAGE_TILES];    // Tiles cache
+    int tilesCount;             // Number of tiles slots in use
+    unsigned int useCounter;    // Tiles use counter (LRU)
+} TiledImageData;
+
+// Tiled image mipmap level, rows generated streaming rows of previous level
+typedef struct TiledMipmapLevel {
+    int width;                  // Level width
+    int height;                 // Level height
+    long long dataOffset;       // Level pixels data offset in file
+    int rowsCount;              // Number of rows written to file
+    unsigned char *rows[2];     // Previous level rows required for next row
+    unsigned char *output;      // Level row generated
+} TiledMipmapLevel;
+
+// Virtual texture internal data
+// NOTE: Page cache slot is -1 if page is not resident, -2 if page is being loaded
+typedef struct VirtualTextureData {
+    TiledImage source;          // Pages source (tiled image, one tile per page)
+    int pagesX;                 // Number of pages (horizontal)
+    int pagesY;                 // Number of pages (vertical)
+    int cacheSize;              // Pages cache size (pages per side)
+    int *pageSlots;             // Page cache slot (per page)
+    unsigned int *pageLastSeen; // Page last frame seen on feedback (per page)
+    int *slotPages;             // Cache slot page (per slot, -1 if free)
+    unsigned int *slotLastUse;  // Cache slot last frame used (per slot)
+    Color *pageTableData;       // Page table data (CPU copy)
+    bool pageTableDirty;        // Page table requires update
+    unsigned int frameCounter;  // Feedback frames counter
+    int requests[MAX_VIRTUAL_PAGE_LOADS];       // Pages requested on last feedback
+    int requestsCount;          // Number of pages requested
+    int loadPages[MAX_VIRTUAL_PAGE_LOADS];      // Pages being loaded (worker job)
+    Image loadImages[MAX_VIRTUAL_PAGE_LOADS];   // Pages images loaded (worker job)
+    int loadCount;              // Number of pages being loaded
+    int pending;                // Worker job pending counter
+    Color *feedbackData;        // Feedback readback pixels (reused every frame)
+} VirtualTextureData;
+
+#if defined(SUPPORT_IMAGE_MANIPULATION)
+// Image resize data (8 bit per channel formats)
+typedef struct ImageResizeData {
+    const unsigned char *src;   // Source pixels data
+    int srcWidth;               // Source image width
+    int srcHeight;              // Source image height
+    unsigned char *dst;         // Destination pixels data
+    int dstWidth;               // Destination image width
+    int dstHeight;              // Destination image height
+    int channels;               // Pixels channels (1 to 4)
+} ImageResizeData;
+#endif
+
+// Texture residency entry, textures loaded with LoadTextureFromImage() are tracked for VRAM usage
+// NOTE: Textures loaded from file (LoadTexture()) can be evicted and reloaded transparently
+typedef struct TextureResidency {
+    unsigned int id;            // Texture id (kept while evicted)
+    char *fileName;             // Source file name (NULL if texture data can not be reloaded)
+    int width;                  // Texture width
+    int height;                 // Texture height
+    int mipmaps;                // Texture mipmap levels
+    int format;                 // Texture pixel format
+    unsigned int size;          // Texture data size in VRAM (all mipmap levels)
+    unsigned int lastUse;       // Last frame texture was used for drawing
+    bool resident;              // Texture data is in VRAM (not evicted)
+} TextureResidency;
+
+// Progressive texture upload (LoadTextureProgressive()), mipmap levels uploaded from smallest to largest
+typedef struct TextureUpload {
+    unsigned int id;            // Texture id
+    Image image;                // Texture image data (all mipmap levels), unloaded when upload completes
+    int level;                  // Largest mipmap level uploaded, sampled levels start here (mipmaps: none uploaded)
+    int row;                    // Rows uploaded of next mipmap level (level - 1)
+    char *fileName;             // Source file name, set as residency source on completion (NULL if mipmaps were generated)
+} TextureUpload;
+
+// Post-processing effect uniform value, applied again when merged pass shader is generated
+typedef struct PostEffectValue {
+    char name[32];              // Uniform name
+    int type;                   // Uniform data type (ShaderUniformDataType)
+    unsigned char data[16];     // Uniform value (up to 4 components)
+} PostEffectValue;
+
+// Post-processing effect, per-pixel code (merged with adjacent per-pixel effects) or full pass shader
+typedef struct PostEffect {
+    char *code;                 // Per-pixel effect code (NULL for full pass effects)
+    Shader shader;              // Full pass effect shader (not owned)
+    int pass;                   // Pass running the effect
+    PostEffectValue values[MAX_POSTEFFECT_VALUES];  // Per-pixel effect uniform values
+    int valuesCount;            // Per-pixel effect uniform values count
+} PostEffect;
+
+// Post-processing chain internal data
+typedef struct PostProcessData {
+    PostEffect effects[MAX_POSTPROCESS_EFFECTS];    // Effects (chain order)
+    int effectsCount;           // Number of effects
+    Shader passes[MAX_POSTPROCESS_EFFECTS];         // Passes shaders
+    bool generated[MAX_POSTPROCESS_EFFECTS];        // Pass shader is generated (merged per-pixel effects, owned)
+    int passesCount;            // Number of passes
+    bool dirty;                 // Effects changed, passes must be generated again
+} PostProcessData;
+
+#if defined(SUPPORT_IMAGE_GENERATION)
+// Procedural image generation data (RGBA output), parameters used depend on generator
+typedef struct ImageGenData {
+    Color *pixels;              // Output pixels data
+    int width;                  // Image width
+    int height;                 // Image height
+    int offsetX;                // Perlin noise offset x
+    int offsetY;                // Perlin noise offset y
+    float scale;                // Perlin noise scale
+    float density;              // Radial gradient density
+    Color inner;                // Radial gradient inner color
+    Color outer;                // Radial gradient outer color
+    const int *seeds;           // Cellular seeds positions (x, y pairs per tile)
+    int seedsPerRow;            // Cellular seeds per row
+    int seedsPerCol;            // Cellular seeds per column
+    int tileSize;               // Cellular tile size
+} ImageGenData;
+#endif
 
 //----------------------------------------------------------------------------------
 // Global Variables Definition
 //----------------------------------------------------------------------------------
-// It's lonely here...
+static ImageMapping imageMappings[MAX_IMAGE_MAPPINGS] = { 0 };  // Images loaded with LoadImageMapped()
+static int imageMappingsCount = 0;                              // Number of images mappings in use
+static AsyncImageBatch *asyncImageBatches = NULL;               // Asynchronous images load batches in progress
+static bool imageExportFast = false;                            // PNG export uses fast encoder (SetImageExportFast())
+
+static TextureResidency *residencyTextures = NULL;              // Textures tracked for VRAM usage
+static int residencyCount = 0;                                  // Textures tracked count
+static int residencyCapacity = 0;                               // Textures tracked array capacity
+static int *residencyIndices = NULL;                            // Tracked texture index by texture id (-1 if not tracked)
+static unsigned int residencyIndicesSize = 0;                   // Texture ids covered by indices array
+static unsigned long long textureMemoryUsed = 0;                // VRAM used by resident tracked textures
+static unsigned int textureMemoryBudget = 0;                    // VRAM budget (0: no budget, SetTextureMemoryBudget())
+static unsigned int residencyFrame = 1;                         // Frames counter for textures last use
+
+static TextureUpload *textureUploads = NULL;                    // Progressive textures uploads in progress (load order)
+static int textureUploadsCount = 0;                             // Progressive textures uploads count
+static unsigned int textureUploadBudget = TEXTURE_UPLOAD_BUDGET;    // Bytes uploaded per frame (0: no limit, SetTextureUploadBudget())
 
 //----------------------------------------------------------------------------------
 // Other Modules Functions Declaration (required by text)
@@ -174,12 +401,70 @@ static Image LoadPKM(const char *fileName);   // Load PKM file
 static Image LoadKTX(const char *fileName);   // Load KTX file
 static int SaveKTX(Image image, const char *fileName);  // Save image data as KTX file
 #endif
+#if defined(SUPPORT_FILEFORMAT_KTX2)
+static Image LoadKTX2(const char *fileName);  // Load KTX2 file
+static int GetKTX2PixelFormat(unsigned int vkFormat);   // Get raylib pixel format from KTX2 Vulkan format
+#endif
 #if defined(SUPPORT_FILEFORMAT_PVR)
 static Image LoadPVR(const char *fileName);   // Load PVR file
 #endif
 #if defined(SUPPORT_FILEFORMAT_ASTC)
 static Image LoadASTC(const char *fileName);  // Load ASTC file
 #endif
+static int GetImagePayloadOffset(const unsigned char *fileData, size_t fileSize, Image *image);  // Get GPU-ready image data offset in file data (-1 if not available)
+static void LoadImageJob(void *data);           // Worker job: load image for AsyncImageJob
+static int GetPixelChannels(int format);        // Get number of 8 bit channels of pixel format (0 if not 8 bit per channel)
+static void ProcessImageBands(ImageBandFunc func, void *data, int width, int height);  // Process image rows split in bands on worker threads
+static void ImageBandJobRun(void *data);        // Worker job: process one image rows band
+static void ConvertPixelRows(void *data, int startRow, int endRow);    // Convert pixel rows from 8 bit per channel format (ImageConvertData)
+static bool SeekFile64(FILE *file, long long offset);           // Set file position from start (64 bit offsets)
+static ImageTile *GetImageTile(TiledImage image, int x, int y); // Get tiled image tile, loaded from file if not cached
+static bool GetKTXGlFormats(int format, unsigned int *glInternalFormat, unsigned int *glFormat, unsigned int *glType);   // Get KTX OpenGL formats for uncompressed pixel format (no GPU context required)
+static bool WriteMipmapRow(FILE *file, TiledMipmapLevel *levels, int levelsCount, int level, const unsigned char *row, int format);  // Write mipmap level row to file, next levels rows generated from it
+#if !defined(GRAPHICS_API_OPENGL_11)
+static Shader LoadVirtualTextureShader(bool feedback);          // Load virtual texture shader (sampling or feedback)
+#endif
+static void LoadVirtualPagesJob(void *data);    // Worker job: load virtual texture pages requested
+#if !defined(GRAPHICS_API_OPENGL_11)
+static void LoadPostProcessPasses(PostProcessData *data);   // Load passes shaders, adjacent per-pixel effects merged into one generated shader
+static Shader LoadPostEffectsShader(PostProcessData *data, int first, int count);  // Generate shader running per-pixel effects in order
+static void DrawPostProcessPass(Shader shader, Texture2D texture);  // Draw texture with pass shader (full-screen triangle)
+#endif
+static void BlendPixelsRGBA(unsigned char *dst, const unsigned char *src, int count, Color tint);   // Blend tinted RGBA pixels over RGBA pixels (alpha blending)
+static void BlendPixelRGBA(unsigned char *dst, const unsigned char *src, Color tint, bool tinted);  // Blend one tinted RGBA pixel over RGBA pixel
+static void ReadImagePixels(Image image, Color *pixels);    // Read image pixel data into Color array (GetImageData())
+#if defined(SUPPORT_IMAGE_MANIPULATION)
+static bool ImageColorApplyLUT(Image *image, const unsigned char *lutR, const unsigned char *lutG, const unsigned char *lutB, const unsigned char *lutA);  // Apply per channel lookup tables in place (8 bit per channel formats)
+static void ResizePixelRows(void *data, int startRow, int endRow);     // Resize image output rows (ImageResizeData)
+#endif
+static void TrackTexture(Texture2D texture);    // Start tracking texture VRAM usage
+static void UntrackTexture(unsigned int id);    // Stop tracking texture (texture unloaded)
+static TextureResidency *GetTextureResidency(unsigned int id);  // Get tracked texture entry (NULL if not tracked)
+static void EnsureTextureResident(unsigned int id);     // Reload texture data from source file if evicted
+static void ReleaseTextureSource(unsigned int id);      // Texture data modified, it can not be evicted anymore
+static void TextureUsed(unsigned int id);       // Texture used for drawing callback (rlgl)
+static bool ReloadCachedTexture(void *asset, const char *fileName, const char *fileName2); // Reload cached texture data in place (hot reload)
+static int UploadTextureLevel(TextureUpload *upload, int budget, bool force);   // Upload next mipmap level rows of progressive texture, returns bytes uploaded
+static void FinishTextureUpload(int index, bool completed); // Release progressive texture upload data and remove it
+#if defined(SUPPORT_IMAGE_GENERATION)
+static void GenGradientRadialRows(void *data, int startRow, int endRow);   // Generate radial gradient rows (ImageGenData)
+static void GenPerlinNoiseRows(void *data, int startRow, int endRow);      // Generate perlin noise rows (ImageGenData)
+static void GenCellularRows(void *data, int startRow, int endRow);         // Generate cellular rows (ImageGenData)
+#endif
+#if defined(SUPPORT_IMAGE_EXPORT) && defined(SUPPORT_FILEFORMAT_PNG)
+static int SavePNGFast(const char *fileName, const unsigned char *data, int width, int height, int channels);  // Save PNG file with fast encoder (sub filter, greedy deflate)
+static unsigned char *DeflateDataFast(const unsigned char *data, int dataSize, int *compDataSize);    // Compress data as zlib stream (greedy matching, fixed Huffman codes)
+#endif
+
+//----------------------------------------------------------------------------------
+// Module Functions Declaration (used by other modules)
+//----------------------------------------------------------------------------------
+void UpdateImagesAsync(void);                   // [Module: core] Deliver images loaded asynchronously, called on EndDrawing()
+void UpdateTextureResidency(void);              // [Module: core] Evict least recently used textures over VRAM budget, called on EndDrawing()
+void UpdateTexturesProgressive(void);           // [Module: core] Upload progressive textures mipmaps within per-frame budget, called on EndDrawing()
+#if defined(SUPPORT_IMAGE_EXPORT) && defined(SUPPORT_FILEFORMAT_PNG)
+int SavePNG(const char *fileName, const unsigned char *data, int width, int height, int channels);   // [Module: core] Save PNG file, safe to call from worker threads
+#endif
 
 //----------------------------------------------------------------------------------
 // Module Functions Definition
@@ -283,6 +568,9 @@ Image LoadImage(const char *fileName)
 #if defined(SUPPORT_FILEFORMAT_KTX)
     else if (IsFileExtension(fileName, ".ktx")) image = LoadKTX(fileName);
 #endif
+#if defined(SUPPORT_FILEFORMAT_KTX2)
+    else if (IsFileExtension(fileName, ".ktx2")) image = LoadKTX2(fileName);
+#endif
 #if defined(SUPPORT_FILEFORMAT_PVR)
     else if (IsFileExtension(fileName, ".pvr")) image = LoadPVR(fileName);
 #endif
@@ -385,3331 +673,6775 @@ Image LoadImageRaw(const char *fileName, int width, int height, int format, int
     return image;
 }
 
-// Load texture from file into GPU memory (VRAM)
-Texture2D LoadTexture(const char *fileName)
+// Load image from file, GPU compressed data is not copied: Image.data points into the mapped file
+// NOTE: Zero-copy loading supported for DDS (DXT), KTX/KTX2 (single level) and ASTC files,
+// other files (or uncompressed data) are loaded with LoadImage(), image must be unloaded with UnloadImage()
+// WARNING: Mapped image data is read-only, image must not be modified (it is GPU compressed),
+// images mapped from a pack file (uncompressed entry) must be unloaded before unmounting the pack
+Image LoadImageMapped(const char *fileName)
 {
-    Texture2D texture = { 0 };
+    Image image = { 0 };
 
-    Image image = LoadImage(fileName);
+    if (imageMappingsCount >= MAX_IMAGE_MAPPINGS) return LoadImage(fileName);
 
-    if (image.data != NULL)
+    void *fileData = NULL;
+    size_t fileSize = 0;
+    bool mapped = false;
+    bool packed = false;
+
+#if defined(SUPPORT_PACK_FILES)
+    // Uncompressed packed files data is used in place (pack file is already loaded)
+    unsigned int packedSize = 0;
+    fileData = (void *)GetPackedFileData(fileName, &packedSize);
+    fileSize = packedSize;
+    packed = (fileData != NULL);
+#endif
+
+#if defined(SUPPORT_FILE_MAPPING)
+    int fd = packed? -1 : open(fileName, O_RDONLY);
+
+    if (fd >= 0)
     {
-        texture = LoadTextureFromImage(image);
-        UnloadImage(image);
+        struct stat fileStats = { 0 };
+
+        if ((fstat(fd, &fileStats) == 0) && (fileStats.st_size > 0))
+        {
+            fileData = mmap(NULL, (size_t)fileStats.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+
+            if (fileData == MAP_FAILED) fileData = NULL;
+            else
+            {
+                fileSize = (size_t)fileStats.st_size;
+                mapped = true;
+            }
+        }
+
+        close(fd);      // NOTE: Mapping remains valid after closing file descriptor
     }
-    else TraceLog(LOG_WARNING, "Texture could not be created");
+#else
+    FILE *file = packed? NULL : fopen(fileName, "rb");
 
-    return texture;
-}
+    if (file != NULL)
+    {
+        fseek(file, 0, SEEK_END);
+        long size = ftell(file);
+        fseek(file, 0, SEEK_SET);
 
-// Load a texture from image data
-// NOTE: image is not unloaded, it must be done manually
-Texture2D LoadTextureFromImage(Image image)
-{
-    Texture2D texture = { 0 };
+        if (size > 0)
+        {
+            fileData = RL_MALLOC(size);
 
-    if ((image.data != NULL) && (image.width != 0) && (image.height != 0))
+            if (fread(fileData, 1, size, file) == (size_t)size) fileSize = (size_t)size;
+            else { RL_FREE(fileData); fileData = NULL; }
+        }
+
+        fclose(file);
+    }
+#endif
+
+    int offset = (fileData != NULL)? GetImagePayloadOffset((const unsigned char *)fileData, fileSize, &image) : -1;
+
+    if (offset < 0)
     {
-        texture.id = rlLoadTexture(image.data, image.width, image.height, image.format, image.mipmaps);
+        if (!packed)
+        {
+        #if defined(SUPPORT_FILE_MAPPING)
+            if (fileData != NULL) munmap(fileData, fileSize);
+        #else
+            RL_FREE(fileData);
+        #endif
+        }
+
+        return LoadImage(fileName);
     }
-    else TraceLog(LOG_WARNING, "Texture could not be loaded from Image");
 
-    texture.width = image.width;
-    texture.height = image.height;
-    texture.mipmaps = image.mipmaps;
-    texture.format = image.format;
+    image.data = (unsigned char *)fileData + offset;
 
-    return texture;
-}
+    imageMappings[imageMappingsCount].fileData = fileData;
+    imageMappings[imageMappingsCount].fileSize = fileSize;
+    imageMappings[imageMappingsCount].imageData = image.data;
+    imageMappings[imageMappingsCount].mapped = mapped;
+    imageMappings[imageMappingsCount].packed = packed;
+    imageMappingsCount++;
 
-// Load texture for rendering (framebuffer)
-// NOTE: Render texture is loaded by default with RGBA color attachment and depth RenderBuffer
-RenderTexture2D LoadRenderTexture(int width, int height)
-{
-    RenderTexture2D target = rlLoadRenderTexture(width, height, UNCOMPRESSED_R8G8B8A8, 24, false);
+    TraceLog(LOG_INFO, "[%s] Image %s successfully (%ix%i)", fileName, (mapped || packed)? "mapped" : "loaded", image.width, image.height);
 
-    return target;
+    return image;
 }
 
-// Unload image from CPU memory (RAM)
-void UnloadImage(Image image)
+// Load images asynchronously, files are decoded on worker threads (same formats than LoadImage())
+// NOTE: Callback is called on main thread (EndDrawing()) for every image, it can upload them to GPU (LoadTextureFromImage()),
+// image is owned by callback and must be unloaded by it, if loading failed image.data is NULL
+void LoadImagesAsync(const char **fileNames, int count, LoadImageCallback callback, void *userData)
 {
-    RL_FREE(image.data);
-}
+    if ((fileNames == NULL) || (count <= 0) || (callback == NULL)) return;
 
-// Unload texture from GPU memory (VRAM)
-void UnloadTexture(Texture2D texture)
-{
-    if (texture.id > 0)
-    {
-        rlDeleteTextures(texture.id);
+    AsyncImageBatch *batch = (AsyncImageBatch *)RL_CALLOC(1, sizeof(AsyncImageBatch));
+    batch->jobs = (AsyncImageJob *)RL_CALLOC(count, sizeof(AsyncImageJob));
+    batch->count = count;
+    batch->callback = callback;
+    batch->userData = userData;
 
-        TraceLog(LOG_INFO, "[TEX ID %i] Unloaded texture data from VRAM (GPU)", texture.id);
+    for (int i = 0; i < count; i++)
+    {
+        if (strlen(fileNames[i]) >= MAX_ASYNC_FILEPATH_LENGTH) TraceLog(LOG_WARNING, "[%s] Image file path too long, can not be loaded asynchronously", fileNames[i]);
+        else strcpy(batch->jobs[i].fileName, fileNames[i]);
     }
+
+    // NOTE: Batch is linked before submitting jobs, jobs could run synchronously
+    batch->next = asyncImageBatches;
+    asyncImageBatches = batch;
+
+    for (int i = 0; i < count; i++) SubmitWorkerJob(LoadImageJob, &batch->jobs[i], &batch->jobs[i].pending);
 }
 
-// Unload render texture from GPU memory (VRAM)
-void UnloadRenderTexture(RenderTexture2D target)
+// Get number of images requested with LoadImagesAsync() not delivered yet
+int GetImagesAsyncPending(void)
 {
-    if (target.id > 0) rlDeleteRenderTextures(target);
+    int pending = 0;
+
+    for (AsyncImageBatch *batch = asyncImageBatches; batch != NULL; batch = batch->next) pending += (batch->count - batch->delivered);
+
+    return pending;
 }
 
-// Get pixel data from image in the form of Color struct array
-Color *GetImageData(Image image)
+// Deliver images loaded asynchronously to their callbacks (main thread)
+// NOTE: Up to MAX_ASYNC_IMAGES_PER_FRAME images are delivered per call to limit GPU uploads per frame
+void UpdateImagesAsync(void)
 {
-    if ((image.width == 0) || (image.height == 0)) return NULL;
-    
-    Color *pixels = (Color *)RL_MALLOC(image.width*image.height*sizeof(Color));
-    
-    if (image.format >= COMPRESSED_DXT1_RGB) TraceLog(LOG_WARNING, "Pixel data retrieval not supported for compressed image formats");
-    else
+    int delivered = 0;
+    AsyncImageBatch **link = &asyncImageBatches;
+
+    while (*link != NULL)
     {
-        if ((image.format == UNCOMPRESSED_R32) ||
-            (image.format == UNCOMPRESSED_R32G32B32) ||
-            (image.format == UNCOMPRESSED_R32G32B32A32)) TraceLog(LOG_WARNING, "32bit pixel format converted to 8bit per channel");
+        AsyncImageBatch *batch = *link;
 
-        for (int i = 0, k = 0; i < image.width*image.height; i++)
+        for (int i = 0; (i < batch->count) && (delivered < MAX_ASYNC_IMAGES_PER_FRAME); i++)
         {
-            switch (image.format)
-            {
-                case UNCOMPRESSED_GRAYSCALE:
-                {
-                    pixels[i].r = ((unsigned char *)image.data)[i];
-                    pixels[i].g = ((unsigned char *)image.data)[i];
-                    pixels[i].b = ((unsigned char *)image.data)[i];
-                    pixels[i].a = 255;
+            AsyncImageJob *job = &batch->jobs[i];
 
-                } break;
-                case UNCOMPRESSED_GRAY_ALPHA:
-                {
-                    pixels[i].r = ((unsigned char *)image.data)[k];
-                    pixels[i].g = ((unsigned char *)image.data)[k];
-                    pixels[i].b = ((unsigned char *)image.data)[k];
-                    pixels[i].a = ((unsigned char *)image.data)[k + 1];
+            if (!job->delivered && (GetWorkerJobsPending(&job->pending) == 0))
+            {
+                job->delivered = true;
+                batch->delivered++;
+                delivered++;
 
-                    k += 2;
-                } break;
-                case UNCOMPRESSED_R5G5B5A1:
-                {
-                    unsigned short pixel = ((unsigned short *)image.data)[i];
+                batch->callback(i, job->fileName, job->image, batch->userData);
+            }
+        }
 
-                    pixels[i].r = (unsigned char)((float)((pixel & 0b1111100000000000) >> 11)*(255/31));
-                    pixels[i].g = (unsigned char)((float)((pixel & 0b0000011111000000) >> 6)*(255/31));
-                    pixels[i].b = (unsigned char)((float)((pixel & 0b0000000000111110) >> 1)*(255/31));
-                    pixels[i].a = (unsigned char)((pixel & 0b0000000000000001)*255);
+        if (batch->delivered == batch->count)
+        {
+            *link = batch->next;
 
-                } break;
-                case UNCOMPRESSED_R5G6B5:
-                {
-                    unsigned short pixel = ((unsigned short *)image.data)[i];
+            RL_FREE(batch->jobs);
+            RL_FREE(batch);
+        }
+        else link = &batch->next;
+    }
+}
 
-                    pixels[i].r = (unsigned char)((float)((pixel & 0b1111100000000000) >> 11)*(255/31));
-                    pixels[i].g = (unsigned char)((float)((pixel & 0b0000011111100000) >> 5)*(255/63));
-                    pixels[i].b = (unsigned char)((float)(pixel & 0b0000000000011111)*(255/31));
-                    pixels[i].a = 255;
+// Load tiled image from file, pixels data is read by tiles on demand (images bigger than memory)
+// NOTE: Only uncompressed KTX files supported (as exported by ExportTiledImageMipmaps()), base level used,
+// KTX support for tiled images does not depend on SUPPORT_FILEFORMAT_KTX (GPU compressed formats loading)
+TiledImage LoadTiledImage(const char *fileName)
+{
+    TiledImage image = { 0 };
 
-                } break;
-                case UNCOMPRESSED_R4G4B4A4:
-                {
-                    unsigned short pixel = ((unsigned short *)image.data)[i];
+    // KTX file Header (64 bytes)
+    // v1.1 - https://www.khronos.org/opengles/sdk/tools/KTX/file_format_spec/
+    typedef struct {
+        char id[12];                        // Identifier: "«KTX 11»\r\n\x1A\n"
+        unsigned int endianness;            // Little endian: 0x01 0x02 0x03 0x04
+        unsigned int glType;                // For compressed textures, glType must equal 0
+        unsigned int glTypeSize;            // For compressed texture data, usually 1
+        unsigned int glFormat;              // For compressed textures is 0
+        unsigned int glInternalFormat;      // Compressed internal format
+        unsigned int glBaseInternalFormat;  // Same as glFormat (RGB, RGBA, ALPHA...)
+        unsigned int width;                 // Texture image width in pixels
+        unsigned int height;                // Texture image height in pixels
+        unsigned int depth;                 // For 2D textures is 0
+        unsigned int elements;              // Number of array elements, usually 0
+        unsigned int faces;                 // Cubemap faces, for no-cubemap = 1
+        unsigned int mipmapLevels;          // Non-mipmapped textures = 1
+        unsigned int keyValueDataSize;      // Used to encode any arbitrary data...
+    } KTXHeader;
 
-                    pixels[i].r = (unsigned char)((float)((pixel & 0b1111000000000000) >> 12)*(255/15));
-                    pixels[i].g = (unsigned char)((float)((pixel & 0b0000111100000000) >> 8)*(255/15));
-                    pixels[i].b = (unsigned char)((float)((pixel & 0b0000000011110000) >> 4)*(255/15));
-                    pixels[i].a = (unsigned char)((float)(pixel & 0b0000000000001111)*(255/15));
+    if (IsFileExtension(fileName, ".ktx"))
+    {
+        FILE *ktxFile = fopen(fileName, "rb");
 
-                } break;
-                case UNCOMPRESSED_R8G8B8A8:
-                {
-                    pixels[i].r = ((unsigned char *)image.data)[k];
-                    pixels[i].g = ((unsigned char *)image.data)[k + 1];
-                    pixels[i].b = ((unsigned char *)image.data)[k + 2];
-                    pixels[i].a = ((unsigned char *)image.data)[k + 3];
+        if (ktxFile == NULL) TraceLog(LOG_WARNING, "[%s] KTX image file could not be opened", fileName);
+        else
+        {
+            KTXHeader ktxHeader = { 0 };
+            fread(&ktxHeader, sizeof(KTXHeader), 1, ktxFile);
+            fclose(ktxFile);
 
-                    k += 4;
-                } break;
-                case UNCOMPRESSED_R8G8B8:
-                {
-                    pixels[i].r = (unsigned char)((unsigned char *)image.data)[k];
-                    pixels[i].g = (unsigned char)((unsigned char *)image.data)[k + 1];
-                    pixels[i].b = (unsigned char)((unsigned char *)image.data)[k + 2];
-                    pixels[i].a = 255;
+            if ((ktxHeader.id[1] != 'K') || (ktxHeader.id[2] != 'T') || (ktxHeader.id[3] != 'X') ||
+                (ktxHeader.id[4] != ' ') || (ktxHeader.id[5] != '1') || (ktxHeader.id[6] != '1'))
+            {
+                TraceLog(LOG_WARNING, "[%s] KTX file does not seem to be a valid file", fileName);
+            }
+            else
+            {
+                int format = 0;
 
-                    k += 3;
-                } break;
-                case UNCOMPRESSED_R32:
+                for (int i = UNCOMPRESSED_GRAYSCALE; i <= UNCOMPRESSED_R32G32B32A32; i++)
                 {
-                    pixels[i].r = (unsigned char)(((float *)image.data)[k]*255.0f);
-                    pixels[i].g = 0;
-                    pixels[i].b = 0;
-                    pixels[i].a = 255;
+                    unsigned int glInternalFormat = 0, glFormat = 0, glType = 0;
+                    GetKTXGlFormats(i, &glInternalFormat, &glFormat, &glType);
 
-                } break;
-                case UNCOMPRESSED_R32G32B32:
-                {
-                    pixels[i].r = (unsigned char)(((float *)image.data)[k]*255.0f);
-                    pixels[i].g = (unsigned char)(((float *)image.data)[k + 1]*255.0f);
-                    pixels[i].b = (unsigned char)(((float *)image.data)[k + 2]*255.0f);
-                    pixels[i].a = 255;
+                    if ((glInternalFormat == ktxHeader.glInternalFormat) && (glFormat == ktxHeader.glFormat) && (glType == ktxHeader.glType)) format = i;
+                }
 
-                    k += 3;
-                } break;
-                case UNCOMPRESSED_R32G32B32A32:
+                // NOTE: Base level data starts after key-value data and level data size
+                if (format == 0) TraceLog(LOG_WARNING, "[%s] KTX image format not supported for tiled image (only uncompressed)", fileName);
+                else
                 {
-                    pixels[i].r = (unsigned char)(((float *)image.data)[k]*255.0f);
-                    pixels[i].g = (unsigned char)(((float *)image.data)[k]*255.0f);
-                    pixels[i].b = (unsigned char)(((float *)image.data)[k]*255.0f);
-                    pixels[i].a = (unsigned char)(((float *)image.data)[k]*255.0f);
-
-                    k += 4;
-                } break;
-                default: break;
+                    image = LoadTiledImageRaw(fileName, ktxHeader.width, ktxHeader.height, format, sizeof(KTXHeader) + ktxHeader.keyValueDataSize + sizeof(unsigned int));
+                    if ((image.tilesData != NULL) && (ktxHeader.mipmapLevels > 1)) image.mipmaps = ktxHeader.mipmapLevels;
+                }
             }
         }
     }
+    else TraceLog(LOG_WARNING, "[%s] Image fileformat not supported for tiled image", fileName);
 
-    return pixels;
+    return image;
 }
 
-// Get pixel data from image as Vector4 array (float normalized)
-Vector4 *GetImageDataNormalized(Image image)
+// Load tiled image from RAW file data (uncompressed formats), pixels data is read by tiles on demand
+TiledImage LoadTiledImageRaw(const char *fileName, int width, int height, int format, int headerSize)
 {
-    Vector4 *pixels = (Vector4 *)RL_MALLOC(image.width*image.height*sizeof(Vector4));
+    TiledImage image = { 0 };
 
-    if (image.format >= COMPRESSED_DXT1_RGB) TraceLog(LOG_WARNING, "Pixel data retrieval not supported for compressed image formats");
+    if ((width <= 0) || (height <= 0) || (format <= 0) || (format >= COMPRESSED_DXT1_RGB))
+    {
+        TraceLog(LOG_WARNING, "[%s] Tiled image requires valid size and uncompressed format", fileName);
+        return image;
+    }
+
+    FILE *file = fopen(fileName, "rb");
+
+    if (file == NULL) TraceLog(LOG_WARNING, "[%s] Tiled image file could not be opened", fileName);
     else
     {
-        for (int i = 0, k = 0; i < image.width*image.height; i++)
-        {
-            switch (image.format)
-            {
-                case UNCOMPRESSED_GRAYSCALE:
-                {
-                    pixels[i].x = (float)((unsigned char *)image.data)[i]/255.0f;
-                    pixels[i].y = (float)((unsigned char *)image.data)[i]/255.0f;
-                    pixels[i].z = (float)((unsigned char *)image.data)[i]/255.0f;
-                    pixels[i].w = 1.0f;
+        TiledImageData *data = (TiledImageData *)RL_CALLOC(1, sizeof(TiledImageData));
+        data->file = file;
+        data->dataOffset = headerSize;
 
-                } break;
-                case UNCOMPRESSED_GRAY_ALPHA:
-                {
-                    pixels[i].x = (float)((unsigned char *)image.data)[k]/255.0f;
-                    pixels[i].y = (float)((unsigned char *)image.data)[k]/255.0f;
-                    pixels[i].z = (float)((unsigned char *)image.data)[k]/255.0f;
-                    pixels[i].w = (float)((unsigned char *)image.data)[k + 1]/255.0f;
+        image.width = width;
+        image.height = height;
+        image.format = format;
+        image.mipmaps = 1;
+        image.tileSize = TILED_IMAGE_TILE_SIZE;
+        image.tilesData = data;
 
-                    k += 2;
-                } break;
-                case UNCOMPRESSED_R5G5B5A1:
-                {
-                    unsigned short pixel = ((unsigned short *)image.data)[i];
+        TraceLog(LOG_INFO, "[%s] Tiled image opened successfully (%ix%i)", fileName, width, height);
+    }
 
-                    pixels[i].x = (float)((pixel & 0b1111100000000000) >> 11)*(1.0f/31);
-                    pixels[i].y = (float)((pixel & 0b0000011111000000) >> 6)*(1.0f/31);
-                    pixels[i].z = (float)((pixel & 0b0000000000111110) >> 1)*(1.0f/31);
-                    pixels[i].w = ((pixel & 0b0000000000000001) == 0)? 0.0f : 1.0f;
+    return image;
+}
 
-                } break;
-                case UNCOMPRESSED_R5G6B5:
-                {
-                    unsigned short pixel = ((unsigned short *)image.data)[i];
+// Unload tiled image, cached tiles are released and file is closed
+void UnloadTiledImage(TiledImage image)
+{
+    TiledImageData *data = (TiledImageData *)image.tilesData;
 
-                    pixels[i].x = (float)((pixel & 0b1111100000000000) >> 11)*(1.0f/31);
-                    pixels[i].y = (float)((pixel & 0b0000011111100000) >> 5)*(1.0f/63);
-                    pixels[i].z = (float)(pixel & 0b0000000000011111)*(1.0f/31);
-                    pixels[i].w = 1.0f;
+    if (data == NULL) return;
 
-                } break;
-                case UNCOMPRESSED_R4G4B4A4:
-                {
-                    unsigned short pixel = ((unsigned short *)image.data)[i];
+    for (int i = 0; i < data->tilesCount; i++) RL_FREE(data->tiles[i].data);
 
-                    pixels[i].x = (float)((pixel & 0b1111000000000000) >> 12)*(1.0f/15);
-                    pixels[i].y = (float)((pixel & 0b0000111100000000) >> 8)*(1.0f/15);
-                    pixels[i].z = (float)((pixel & 0b0000000011110000) >> 4)*(1.0f/15);
-                    pixels[i].w = (float)(pixel & 0b0000000000001111)*(1.0f/15);
+    fclose(data->file);
+    RL_FREE(data);
+}
 
-                } break;
-                case UNCOMPRESSED_R8G8B8A8:
-                {
-                    pixels[i].x = (float)((unsigned char *)image.data)[k]/255.0f;
-                    pixels[i].y = (float)((unsigned char *)image.data)[k + 1]/255.0f;
-                    pixels[i].z = (float)((unsigned char *)image.data)[k + 2]/255.0f;
-                    pixels[i].w = (float)((unsigned char *)image.data)[k + 3]/255.0f;
+// Get image region from tiled image, only tiles overlapping region are loaded (cached)
+// NOTE: Region is clamped to image size, returned image must be unloaded (UnloadImage())
+Image GetTiledImageRegion(TiledImage image, Rectangle rec)
+{
+    Image region = { 0 };
 
-                    k += 4;
-                } break;
-                case UNCOMPRESSED_R8G8B8:
-                {
-                    pixels[i].x = (float)((unsigned char *)image.data)[k]/255.0f;
-                    pixels[i].y = (float)((unsigned char *)image.data)[k + 1]/255.0f;
-                    pixels[i].z = (float)((unsigned char *)image.data)[k + 2]/255.0f;
-                    pixels[i].w = 1.0f;
+    if (image.tilesData == NULL) return region;
 
-                    k += 3;
-                } break;
-                case UNCOMPRESSED_R32:
-                {
-                    pixels[i].x = ((float *)image.data)[k];
-                    pixels[i].y = 0.0f;
-                    pixels[i].z = 0.0f;
-                    pixels[i].w = 1.0f;
+    int x0 = (rec.x < 0)? 0 : (int)rec.x;
+    int y0 = (rec.y < 0)? 0 : (int)rec.y;
+    int x1 = ((rec.x + rec.width) > image.width)? image.width : (int)(rec.x + rec.width);
+    int y1 = ((rec.y + rec.height) > image.height)? image.height : (int)(rec.y + rec.height);
 
-                } break;
-                case UNCOMPRESSED_R32G32B32:
-                {
-                    pixels[i].x = ((float *)image.data)[k];
-                    pixels[i].y = ((float *)image.data)[k + 1];
-                    pixels[i].z = ((float *)image.data)[k + 2];
-                    pixels[i].w = 1.0f;
+    if ((x1 <= x0) || (y1 <= y0))
+    {
+        TraceLog(LOG_WARNING, "Tiled image region is out of image bounds");
+        return region;
+    }
 
-                    k += 3;
-                } break;
-                case UNCOMPRESSED_R32G32B32A32:
-                {
-                    pixels[i].x = ((float *)image.data)[k];
-                    pixels[i].y = ((float *)image.data)[k + 1];
-                    pixels[i].z = ((float *)image.data)[k + 2];
-                    pixels[i].w = ((float *)image.data)[k + 3];
+    int bytesPerPixel = GetPixelDataSize(1, 1, image.format);
 
-                    k += 4;
-                }
-                default: break;
+    region.data = RL_MALLOC((x1 - x0)*(y1 - y0)*bytesPerPixel);
+    region.width = x1 - x0;
+    region.height = y1 - y0;
+    region.mipmaps = 1;
+    region.format = image.format;
+
+    for (int ty = y0/image.tileSize; ty <= (y1 - 1)/image.tileSize; ty++)
+    {
+        for (int tx = x0/image.tileSize; tx <= (x1 - 1)/image.tileSize; tx++)
+        {
+            ImageTile *tile = GetImageTile(image, tx, ty);
+
+            if (tile == NULL)
+            {
+                UnloadImage(region);
+                return (Image){ 0 };
+            }
+
+            int tileX = tx*image.tileSize;
+            int tileY = ty*image.tileSize;
+            int tileWidth = ((tileX + image.tileSize) > image.width)? (image.width - tileX) : image.tileSize;
+
+            // Tile area overlapping region
+            int startX = (x0 > tileX)? x0 : tileX;
+            int endX = (x1 < (tileX + tileWidth))? x1 : (tileX + tileWidth);
+            int startY = (y0 > tileY)? y0 : tileY;
+            int endY = (y1 < (tileY + image.tileSize))? y1 : (tileY + image.tileSize);
+
+            for (int y = startY; y < endY; y++)
+            {
+                memcpy((unsigned char *)region.data + ((y - y0)*region.width + (startX - x0))*bytesPerPixel,
+                       tile->data + ((y - tileY)*tileWidth + (startX - tileX))*bytesPerPixel, (endX - startX)*bytesPerPixel);
             }
         }
     }
 
-    return pixels;
+    return region;
 }
 
-// Get image alpha border rectangle
-Rectangle GetImageAlphaBorder(Image image, float threshold)
+// Export tiled image to KTX file with full mipmaps chain (down to 1x1), file data is streamed by rows
+// NOTE: Mipmaps are generated with a 2x2 box filter, only previous level rows are kept in memory (bounded memory)
+// Supported formats: 8 bit per channel and 32 bit float per channel formats
+bool ExportTiledImageMipmaps(TiledImage image, const char *fileName)
 {
-    Rectangle crop = { 0 };
-    
-    Color *pixels = GetImageData(image);
-    
-    if (pixels != NULL)
+    bool success = false;
+
+    // KTX file Header (64 bytes)
+    // v1.1 - https://www.khronos.org/opengles/sdk/tools/KTX/file_format_spec/
+    typedef struct {
+        char id[12];                        // Identifier: "«KTX 11»\r\n\x1A\n"
+        unsigned int endianness;            // Little endian: 0x01 0x02 0x03 0x04
+        unsigned int glType;                // For compressed textures, glType must equal 0
+        unsigned int glTypeSize;            // For compressed texture data, usually 1
+        unsigned int glFormat;              // For compressed textures is 0
+        unsigned int glInternalFormat;      // Compressed internal format
+        unsigned int glBaseInternalFormat;  // Same as glFormat (RGB, RGBA, ALPHA...)
+        unsigned int width;                 // Texture image width in pixels
+        unsigned int height;                // Texture image height in pixels
+        unsigned int depth;                 // For 2D textures is 0
+        unsigned int elements;              // Number of array elements, usually 0
+        unsigned int faces;                 // Cubemap faces, for no-cubemap = 1
+        unsigned int mipmapLevels;          // Non-mipmapped textures = 1
+        unsigned int keyValueDataSize;      // Used to encode any arbitrary data...
+    } KTXHeader;
+
+    TiledImageData *data = (TiledImageData *)image.tilesData;
+
+    if (data == NULL) return false;
+
+    int bytesPerPixel = GetPixelDataSize(1, 1, image.format);
+    long long baseSize = (long long)image.width*image.height*bytesPerPixel;
+
+    KTXHeader ktxHeader = { 0 };
+    const char ktxIdentifier[12] = { 0xAB, 'K', 'T', 'X', ' ', '1', '1', 0xBB, '\r', '\n', 0x1A, '\n' };
+    memcpy(ktxHeader.id, ktxIdentifier, 12);
+    ktxHeader.endianness = 0x04030201;
+    ktxHeader.glTypeSize = 1;
+    ktxHeader.width = image.width;
+    ktxHeader.height = image.height;
+    ktxHeader.faces = 1;
+
+    if ((GetPixelChannels(image.format) == 0) && (image.format != UNCOMPRESSED_R32) &&
+        (image.format != UNCOMPRESSED_R32G32B32) && (image.format != UNCOMPRESSED_R32G32B32A32))
     {
-        int xMin = 65536;   // Define a big enough number
-        int xMax = 0;
-        int yMin = 65536;
-        int yMax = 0;
+        TraceLog(LOG_WARNING, "Tiled image format not supported for mipmaps generation");
+    }
+    else if (!GetKTXGlFormats(image.format, &ktxHeader.glInternalFormat, &ktxHeader.glFormat, &ktxHeader.glType))
+    {
+        TraceLog(LOG_WARNING, "Image format not supported for KTX export.");
+    }
+    else if (baseSize > 0xffffffffLL)
+    {
+        // NOTE: KTX 1.1 stores every level size as unsigned int
+        TraceLog(LOG_WARNING, "Tiled image size too big for KTX export, level data size limited to 4GB");
+    }
+    else
+    {
+        ktxHeader.glBaseInternalFormat = ktxHeader.glFormat;
+        if (ktxHeader.glType == 0x1406) ktxHeader.glTypeSize = 4;   // GL_FLOAT
 
-        for (int y = 0; y < image.height; y++)
+        // Compute mipmap levels sizes and data offsets
+        TiledMipmapLevel levels[MAX_TILED_IMAGE_MIPMAPS] = { 0 };
+        int levelsCount = 0;
+        long long offset = sizeof(KTXHeader);
+
+        for (int width = image.width, height = image.height; levelsCount < MAX_TILED_IMAGE_MIPMAPS; levelsCount++)
         {
-            for (int x = 0; x < image.width; x++)
+            levels[levelsCount].width = width;
+            levels[levelsCount].height = height;
+            levels[levelsCount].dataOffset = offset + sizeof(unsigned int);
+            offset = levels[levelsCount].dataOffset + (long long)width*height*bytesPerPixel;
+
+            if ((width == 1) && (height == 1)) { levelsCount++; break; }
+
+            width = (width > 1)? width/2 : 1;
+            height = (height > 1)? height/2 : 1;
+        }
+
+        ktxHeader.mipmapLevels = levelsCount;
+
+        FILE *ktxFile = fopen(fileName, "wb");
+
+        if (ktxFile == NULL) TraceLog(LOG_WARNING, "[%s] KTX image file could not be created", fileName);
+        else
+        {
+            success = (fwrite(&ktxHeader, sizeof(KTXHeader), 1, ktxFile) == 1);
+
+            for (int i = 0; i < levelsCount; i++)
             {
-                if (pixels[y*image.width + x].a > (unsigned char)(threshold*255.0f))
+                unsigned int dataSize = levels[i].width*levels[i].height*bytesPerPixel;
+
+                success = success && SeekFile64(ktxFile, levels[i].dataOffset - sizeof(unsigned int)) && (fwrite(&dataSize, sizeof(unsigned int), 1, ktxFile) == 1);
+
+                // Previous level rows required to generate next row, level output row
+                if (i > 0)
                 {
-                    if (x < xMin) xMin = x;
-                    if (x > xMax) xMax = x;
-                    if (y < yMin) yMin = y;
-                    if (y > yMax) yMax = y;
+                    levels[i].rows[0] = (unsigned char *)RL_MALLOC(levels[i - 1].width*bytesPerPixel);
+                    levels[i].rows[1] = (unsigned char *)RL_MALLOC(levels[i - 1].width*bytesPerPixel);
+                    levels[i].output = (unsigned char *)RL_MALLOC(levels[i].width*bytesPerPixel);
                 }
             }
-        }
 
-        // Check for empty blank image
-        if ((xMin != 65536) && (xMax != 65536))
-        {
-            crop = (Rectangle){ xMin, yMin, (xMax + 1) - xMin, (yMax + 1) - yMin };
-        }
+            // Stream base level rows from source file, every row written generates next levels rows when possible
+            unsigned char *row = (unsigned char *)RL_MALLOC(image.width*bytesPerPixel);
 
-        RL_FREE(pixels);
-    }
+            for (int y = 0; success && (y < image.height); y++)
+            {
+                success = SeekFile64(data->file, data->dataOffset + (long long)y*image.width*bytesPerPixel) &&
+                          (fread(row, image.width*bytesPerPixel, 1, data->file) == 1);
 
-    return crop;
-}
+                if (success) success = WriteMipmapRow(ktxFile, levels, levelsCount, 0, row, image.format);
+                else TraceLog(LOG_WARNING, "Tiled image data can not be read, wrong requested format or size");
+            }
 
-// Get pixel data size in bytes (image or texture)
-// NOTE: Size depends on pixel format
-int GetPixelDataSize(int width, int height, int format)
-{
-    int dataSize = 0;       // Size in bytes
-    int bpp = 0;            // Bits per pixel
+            RL_FREE(row);
 
-    switch (format)
-    {
-        case UNCOMPRESSED_GRAYSCALE: bpp = 8; break;
-        case UNCOMPRESSED_GRAY_ALPHA:
-        case UNCOMPRESSED_R5G6B5:
-        case UNCOMPRESSED_R5G5B5A1:
-        case UNCOMPRESSED_R4G4B4A4: bpp = 16; break;
-        case UNCOMPRESSED_R8G8B8A8: bpp = 32; break;
-        case UNCOMPRESSED_R8G8B8: bpp = 24; break;
-        case UNCOMPRESSED_R32: bpp = 32; break;
-        case UNCOMPRESSED_R32G32B32: bpp = 32*3; break;
-        case UNCOMPRESSED_R32G32B32A32: bpp = 32*4; break;
-        case COMPRESSED_DXT1_RGB:
-        case COMPRESSED_DXT1_RGBA:
-        case COMPRESSED_ETC1_RGB:
-        case COMPRESSED_ETC2_RGB:
-        case COMPRESSED_PVRT_RGB:
-        case COMPRESSED_PVRT_RGBA: bpp = 4; break;
-        case COMPRESSED_DXT3_RGBA:
-        case COMPRESSED_DXT5_RGBA:
-        case COMPRESSED_ETC2_EAC_RGBA:
-        case COMPRESSED_ASTC_4x4_RGBA: bpp = 8; break;
-        case COMPRESSED_ASTC_8x8_RGBA: bpp = 2; break;
-        default: break;
-    }
+            for (int i = 1; i < levelsCount; i++)
+            {
+                RL_FREE(levels[i].rows[0]);
+                RL_FREE(levels[i].rows[1]);
+                RL_FREE(levels[i].output);
+            }
 
-    dataSize = width*height*bpp/8;  // Total data size in bytes
+            fclose(ktxFile);
 
-    return dataSize;
+            if (success) TraceLog(LOG_INFO, "[%s] Tiled image exported successfully (%i mipmaps)", fileName, levelsCount);
+            else TraceLog(LOG_WARNING, "[%s] Tiled image could not be exported", fileName);
+        }
+    }
+
+    return success;
 }
 
-// Get pixel data from GPU texture and return an Image
-// NOTE: Compressed texture formats not supported
-Image GetTextureData(Texture2D texture)
+// Load texture from file into GPU memory (VRAM)
+Texture2D LoadTexture(const char *fileName)
 {
-    Image image = { 0 };
+    Texture2D texture = { 0 };
 
-    if (texture.format < 8)
+    // NOTE: GPU compressed files are uploaded directly from file data (unmapped after upload)
+    Image image = LoadImageMapped(fileName);
+
+    if (image.data != NULL)
     {
-        image.data = rlReadTexturePixels(texture);
+        texture = LoadTextureFromImage(image);
+        UnloadImage(image);
 
-        if (image.data != NULL)
-        {
-            image.width = texture.width;
-            image.height = texture.height;
-            image.format = texture.format;
-            image.mipmaps = 1;
+        // Keep source file, texture data can be evicted and reloaded from it
+        TextureResidency *entry = GetTextureResidency(texture.id);
 
-#if defined(GRAPHICS_API_OPENGL_ES2)
-            // NOTE: Data retrieved on OpenGL ES 2.0 should be RGBA,
-            // coming from FBO color buffer attachment, but it seems
-            // original texture format is retrieved on RPI...
-            image.format = UNCOMPRESSED_R8G8B8A8;
-#endif
-            TraceLog(LOG_INFO, "Texture pixel data obtained successfully");
+        if (entry != NULL)
+        {
+            entry->fileName = (char *)RL_MALLOC(strlen(fileName) + 1);
+            strcpy(entry->fileName, fileName);
         }
-        else TraceLog(LOG_WARNING, "Texture pixel data could not be obtained");
     }
-    else TraceLog(LOG_WARNING, "Compressed texture data could not be obtained");
+    else TraceLog(LOG_WARNING, "Texture could not be created");
 
-    return image;
+    return texture;
 }
 
-// Get pixel data from GPU frontbuffer and return an Image (screenshot)
-Image GetScreenData(void)
+// Load texture from file shared with previous loads of same file (not modified since)
+// NOTE: Cached textures should be unloaded with UnloadTextureCached(), data is unloaded with last reference
+Texture2D LoadTextureCached(const char *fileName)
 {
-    Image image = { 0 };
+    Texture2D *cached = (Texture2D *)AcquireCachedAsset(ASSET_TEXTURE, fileName, NULL);
 
-    image.width = GetScreenWidth();
-    image.height = GetScreenHeight();
-    image.mipmaps = 1;
-    image.format = UNCOMPRESSED_R8G8B8A8;
-    image.data = rlReadScreenPixels(image.width, image.height);
+    if (cached != NULL) return *cached;
 
-    return image;
-}
+    Texture2D texture = LoadTexture(fileName);
 
-// Update GPU texture with new data
-// NOTE: pixels data must match texture.format
-void UpdateTexture(Texture2D texture, const void *pixels)
-{
-    rlUpdateTexture(texture.id, texture.width, texture.height, texture.format, pixels);
+    if (texture.id > 0) AddCachedAsset(ASSET_TEXTURE, fileName, NULL, &texture, sizeof(Texture2D), texture.id, ReloadCachedTexture);
+
+    return texture;
 }
 
-// Export image data to file
-// NOTE: File format depends on fileName extension
-void ExportImage(Image image, const char *fileName)
+// Load texture from file uploading smallest mipmaps first, texture can be drawn on return
+// NOTE: Mipmaps are generated if not stored in file (uncompressed formats), larger mipmap levels are
+// uploaded on next frames within upload budget (SetTextureUploadBudget()), meanwhile drawing samples
+// largest mipmap level uploaded. On OpenGL 1.1 and ES 2.0 texture is fully loaded (LoadTexture())
+Texture2D LoadTextureProgressive(const char *fileName)
 {
-    int success = 0;
+    Texture2D texture = { 0 };
 
-#if defined(SUPPORT_IMAGE_EXPORT)
-    // NOTE: Getting Color array as RGBA unsigned char values
-    unsigned char *imgData = (unsigned char *)GetImageData(image);
+    if ((rlGetVersion() != OPENGL_21) && (rlGetVersion() != OPENGL_33)) return LoadTexture(fileName);
 
-#if defined(SUPPORT_FILEFORMAT_PNG)
-    if (IsFileExtension(fileName, ".png")) success = stbi_write_png(fileName, image.width, image.height, 4, imgData, image.width*4);
-#else
-    if (false) {}
-#endif
-#if defined(SUPPORT_FILEFORMAT_BMP)
-    else if (IsFileExtension(fileName, ".bmp")) success = stbi_write_bmp(fileName, image.width, image.height, 4, imgData);
-#endif
-#if defined(SUPPORT_FILEFORMAT_TGA)
-    else if (IsFileExtension(fileName, ".tga")) success = stbi_write_tga(fileName, image.width, image.height, 4, imgData);
-#endif
-#if defined(SUPPORT_FILEFORMAT_JPG)
-    else if (IsFileExtension(fileName, ".jpg")) success = stbi_write_jpg(fileName, image.width, image.height, 4, imgData, 80);  // JPG quality: between 1 and 100
-#endif
-#if defined(SUPPORT_FILEFORMAT_KTX)
-    else if (IsFileExtension(fileName, ".ktx")) success = SaveKTX(image, fileName);
-#endif
-    else if (IsFileExtension(fileName, ".raw"))
+    // NOTE: GPU compressed files are uploaded directly from mapped file data, kept until upload completes
+    Image image = LoadImageMapped(fileName);
+
+    if (image.data == NULL)
     {
-        // Export raw pixel data (without header)
-        // NOTE: It's up to the user to track image parameters
-        FILE *rawFile = fopen(fileName, "wb");
-        success = fwrite(image.data, GetPixelDataSize(image.width, image.height, image.format), 1, rawFile);
-        fclose(rawFile);
+        TraceLog(LOG_WARNING, "Texture could not be created");
+        return texture;
     }
 
-    RL_FREE(imgData);
-#endif
+    bool fileMipmaps = (image.mipmaps > 1);
 
-    if (success != 0) TraceLog(LOG_INFO, "Image exported successfully: %s", fileName);
-    else TraceLog(LOG_WARNING, "Image could not be exported.");
-}
+    // NOTE: Uncompressed images are never mapped, mipmaps can be generated in place
+    if (!fileMipmaps && (image.format < COMPRESSED_DXT1_RGB)) ImageMipmaps(&image);
 
-// Export image as code file (.h) defining an array of bytes
-void ExportImageAsCode(Image image, const char *fileName)
-{
-    #define BYTES_TEXT_PER_LINE     20
+    if (image.mipmaps <= 1)
+    {
+        texture = LoadTextureFromImage(image);
+        UnloadImage(image);
+        return texture;
+    }
 
-    FILE *txtFile = fopen(fileName, "wt");
+    // Mipmap levels storage allocated, data uploaded from smallest level
+    texture.id = rlLoadTexture(NULL, image.width, image.height, image.format, image.mipmaps);
+    texture.width = image.width;
+    texture.height = image.height;
+    texture.mipmaps = image.mipmaps;
+    texture.format = image.format;
 
-    if (txtFile != NULL)
+    if (texture.id == 0)
     {
-        char varFileName[256] = { 0 };
-        int dataSize = GetPixelDataSize(image.width, image.height, image.format);
+        UnloadImage(image);
+        return texture;
+    }
 
-        fprintf(txtFile, "////////////////////////////////////////////////////////////////////////////////////////\n");
-        fprintf(txtFile, "//                                                                                    //\n");
-        fprintf(txtFile, "// ImageAsCode exporter v1.0 - Image pixel data exported as an array of bytes         //\n");
-        fprintf(txtFile, "//                                                                                    //\n");
-        fprintf(txtFile, "// more info and bugs-report:  github.com/raysan5/raylib                              //\n");
-        fprintf(txtFile, "// feedback and support:       ray[at]raylib.com                                      //\n");
-        fprintf(txtFile, "//                                                                                    //\n");
-        fprintf(txtFile, "// Copyright (c) 2020 Ramon Santamaria (@raysan5)                                     //\n");
-        fprintf(txtFile, "//                                                                                    //\n");
-        fprintf(txtFile, "////////////////////////////////////////////////////////////////////////////////////////\n\n");
+    TrackTexture(texture);
 
-        // Get file name from path and convert variable name to uppercase
-        strcpy(varFileName, GetFileNameWithoutExt(fileName));
-        for (int i = 0; varFileName[i] != '\0'; i++) if ((varFileName[i] >= 'a') && (varFileName[i] <= 'z')) { varFileName[i] = varFileName[i] - 32; }
+    TextureUpload upload = { texture.id, image, image.mipmaps, 0, NULL };
 
-        // Add image information
-        fprintf(txtFile, "// Image data information\n");
-        fprintf(txtFile, "#define %s_WIDTH    %i\n", varFileName, image.width);
-        fprintf(txtFile, "#define %s_HEIGHT   %i\n", varFileName, image.height);
-        fprintf(txtFile, "#define %s_FORMAT   %i          // raylib internal pixel format\n\n", varFileName, image.format);
+    if (fileMipmaps)
+    {
+        upload.fileName = (char *)RL_MALLOC(strlen(fileName) + 1);
+        strcpy(upload.fileName, fileName);
+    }
 
-        fprintf(txtFile, "static unsigned char %s_DATA[%i] = { ", varFileName, dataSize);
-        for (int i = 0; i < dataSize - 1; i++) fprintf(txtFile, ((i%BYTES_TEXT_PER_LINE == 0)? "0x%x,\n" : "0x%x, "), ((unsigned char *)image.data)[i]);
-        fprintf(txtFile, "0x%x };\n", ((unsigned char *)image.data)[dataSize - 1]);
+    // Smallest mipmap levels are uploaded before returning, at least one level
+    int uploaded = 0;
 
-        fclose(txtFile);
+    while ((upload.level > 0) && (uploaded < TEXTURE_FIRST_UPLOAD))
+    {
+        int bytes = UploadTextureLevel(&upload, TEXTURE_FIRST_UPLOAD - uploaded, (upload.level == image.mipmaps));
+        if (bytes == 0) break;
+
+        uploaded += bytes;
     }
+
+    textureUploads = (TextureUpload *)RL_REALLOC(textureUploads, (textureUploadsCount + 1)*sizeof(TextureUpload));
+    textureUploads[textureUploadsCount++] = upload;
+
+    if (upload.level == 0) FinishTextureUpload(textureUploadsCount - 1, true);
+    else TraceLog(LOG_INFO, "[TEX ID %i] Texture loading progressively [%s] (%i of %i mipmaps uploaded)", texture.id, fileName, texture.mipmaps - upload.level, texture.mipmaps);
+
+    return texture;
 }
 
-// Copy an image to a new image
-Image ImageCopy(Image image)
+// Load a texture from image data
+// NOTE: image is not unloaded, it must be done manually
+Texture2D LoadTextureFromImage(Image image)
 {
-    Image newImage = { 0 };
-
-    int width = image.width;
-    int height = image.height;
-    int size = 0;
+    Texture2D texture = { 0 };
 
-    for (int i = 0; i < image.mipmaps; i++)
+    if ((image.data != NULL) && (image.width != 0) && (image.height != 0))
     {
-        size += GetPixelDataSize(width, height, image.format);
+        texture.id = rlLoadTexture(image.data, image.width, image.height, image.format, image.mipmaps);
+    }
+    else TraceLog(LOG_WARNING, "Texture could not be loaded from Image");
 
-        width /= 2;
-        height /= 2;
+    texture.width = image.width;
+    texture.height = image.height;
+    texture.mipmaps = image.mipmaps;
+    texture.format = image.format;
 
-        // Security check for NPOT textures
-        if (width < 1) width = 1;
-        if (height < 1) height = 1;
+    if (texture.id > 0) TrackTexture(texture);
+
+    return texture;
+}
+
+// Load texture for rendering (framebuffer)
+// NOTE: Render texture is loaded by default with RGBA color attachment and depth RenderBuffer
+RenderTexture2D LoadRenderTexture(int width, int height)
+{
+    RenderTexture2D target = rlLoadRenderTexture(width, height, UNCOMPRESSED_R8G8B8A8, 24, false);
+
+    return target;
+}
+
+// Unload image from CPU memory (RAM)
+void UnloadImage(Image image)
+{
+    // Images loaded with LoadImageMapped() release their file data
+    for (int i = 0; i < imageMappingsCount; i++)
+    {
+        if (imageMappings[i].imageData == image.data)
+        {
+            // NOTE: Packed files data is owned by mounted pack
+            if (!imageMappings[i].packed)
+            {
+            #if defined(SUPPORT_FILE_MAPPING)
+                if (imageMappings[i].mapped) munmap(imageMappings[i].fileData, imageMappings[i].fileSize);
+                else RL_FREE(imageMappings[i].fileData);
+            #else
+                RL_FREE(imageMappings[i].fileData);
+            #endif
+            }
+
+            imageMappings[i] = imageMappings[imageMappingsCount - 1];
+            imageMappingsCount--;
+            return;
+        }
     }
 
-    newImage.data = RL_MALLOC(size);
+    RL_FREE(image.data);
+}
 
-    if (newImage.data != NULL)
+// Unload texture from GPU memory (VRAM)
+void UnloadTexture(Texture2D texture)
+{
+    if (texture.id > 0)
     {
-        // NOTE: Size must be provided in bytes
-        memcpy(newImage.data, image.data, size);
+        for (int i = 0; i < textureUploadsCount; i++)
+        {
+            if (textureUploads[i].id == texture.id) { FinishTextureUpload(i, false); break; }
+        }
 
-        newImage.width = image.width;
-        newImage.height = image.height;
-        newImage.mipmaps = image.mipmaps;
-        newImage.format = image.format;
+        UntrackTexture(texture.id);
+        rlDeleteTextures(texture.id);
+
+        TraceLog(LOG_INFO, "[TEX ID %i] Unloaded texture data from VRAM (GPU)", texture.id);
     }
+}
 
-    return newImage;
+// Release cached texture reference, texture is unloaded with last reference
+// NOTE: Textures not cached are unloaded directly
+void UnloadTextureCached(Texture2D texture)
+{
+    Texture2D cached = { 0 };
+    int result = ReleaseCachedAsset(ASSET_TEXTURE, texture.id, &cached, sizeof(Texture2D));
+
+    if (result == 1) UnloadTexture(cached);
+    else if (result == -1) UnloadTexture(texture);
 }
 
-// Create an image from another image piece
-Image ImageFromImage(Image image, Rectangle rec)
+// Unload render texture from GPU memory (VRAM)
+void UnloadRenderTexture(RenderTexture2D target)
 {
-    Image result = ImageCopy(image);
+    if (target.id > 0) rlDeleteRenderTextures(target);
+}
 
-#if defined(SUPPORT_IMAGE_MANIPULATION)
-    ImageCrop(&result, rec);
-#endif
+// Get a transient render texture from pool (same defaults as LoadRenderTexture())
+// NOTE: Render texture is reused by size, it must be returned with ReleasePooledRenderTexture()
+RenderTexture2D GetPooledRenderTexture(int width, int height)
+{
+    return rlGetPooledRenderTexture(width, height, UNCOMPRESSED_R8G8B8A8, 24, false);
+}
 
-    return result;
+// Return a transient render texture to pool, unused render textures are unloaded after a while
+void ReleasePooledRenderTexture(RenderTexture2D target)
+{
+    rlReleasePooledRenderTexture(target);
 }
 
-// Convert image to POT (power-of-two)
-// NOTE: It could be useful on OpenGL ES 2.0 (RPI, HTML5)
-void ImageToPOT(Image *image, Color fillColor)
+// Load virtual texture from tiled KTX file (as exported by ExportTiledImageMipmaps()), pages are loaded when visible
+// NOTE: Pages cache texture keeps cacheSize*cacheSize pages, fallback texture is loaded from a small mipmap level (if available),
+// virtual texture is addressed by texture coordinates [0..1], i.e. GenMeshHeightmap() terrain covered by a single huge texture
+VirtualTexture LoadVirtualTexture(const char *fileName, int cacheSize)
 {
-    // Security check to avoid program crash
-    if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
+    VirtualTexture vt = { 0 };
 
-    Color *pixels = GetImageData(*image);   // Get pixels data
+#if defined(GRAPHICS_API_OPENGL_11)
+    TraceLog(LOG_WARNING, "[%s] Virtual texture requires shaders support (OpenGL 2.1, 3.3 or ES2)", fileName);
+#else
+    TiledImage source = LoadTiledImage(fileName);
 
-    // Calculate next power-of-two values
-    // NOTE: Just add the required amount of pixels at the right and bottom sides of image...
-    int potWidth = (int)powf(2, ceilf(logf((float)image->width)/logf(2)));
-    int potHeight = (int)powf(2, ceilf(logf((float)image->height)/logf(2)));
+    if (source.tilesData == NULL) return vt;
 
-    // Check if POT texture generation is required (if texture is not already POT)
-    if ((potWidth != image->width) || (potHeight != image->height))
+    if (cacheSize > 255) cacheSize = 255;       // Cache page position stored on page table as unsigned char
+    if (cacheSize < 1) cacheSize = 1;
+
+    VirtualTextureData *data = (VirtualTextureData *)RL_CALLOC(1, sizeof(VirtualTextureData));
+    data->source = source;
+    data->pagesX = (source.width + source.tileSize - 1)/source.tileSize;
+    data->pagesY = (source.height + source.tileSize - 1)/source.tileSize;
+    data->cacheSize = cacheSize;
+
+    if ((data->pagesX > 4096) || (data->pagesY > 4096))
     {
-        Color *pixelsPOT = NULL;
+        // NOTE: Feedback encodes pages positions with 12 bit
+        TraceLog(LOG_WARNING, "[%s] Virtual texture too big, maximum 4096x4096 pages supported", fileName);
+        UnloadTiledImage(source);
+        RL_FREE(data);
+        return vt;
+    }
 
-        // Generate POT array from NPOT data
-        pixelsPOT = (Color *)RL_MALLOC(potWidth*potHeight*sizeof(Color));
+    data->pageSlots = (int *)RL_MALLOC(data->pagesX*data->pagesY*sizeof(int));
+    data->pageLastSeen = (unsigned int *)RL_CALLOC(data->pagesX*data->pagesY, sizeof(unsigned int));
+    data->slotPages = (int *)RL_MALLOC(cacheSize*cacheSize*sizeof(int));
+    data->slotLastUse = (unsigned int *)RL_CALLOC(cacheSize*cacheSize, sizeof(unsigned int));
+    data->pageTableData = (Color *)RL_CALLOC(data->pagesX*data->pagesY, sizeof(Color));
+
+    for (int i = 0; i < data->pagesX*data->pagesY; i++) data->pageSlots[i] = -1;
+    for (int i = 0; i < cacheSize*cacheSize; i++) data->slotPages[i] = -1;
+
+    vt.width = source.width;
+    vt.height = source.height;
+    vt.pageSize = source.tileSize;
+    vt.vtData = data;
+
+    // Page table texture (nearest filtering, loaded by default)
+    vt.pageTable.id = rlLoadTexture(data->pageTableData, data->pagesX, data->pagesY, UNCOMPRESSED_R8G8B8A8, 1);
+    vt.pageTable.width = data->pagesX;
+    vt.pageTable.height = data->pagesY;
+    vt.pageTable.mipmaps = 1;
+    vt.pageTable.format = UNCOMPRESSED_R8G8B8A8;
+
+    // Pages cache texture, pages are uploaded when loaded
+    vt.pageCache.id = rlLoadTexture(NULL, cacheSize*vt.pageSize, cacheSize*vt.pageSize, source.format, 1);
+    vt.pageCache.width = cacheSize*vt.pageSize;
+    vt.pageCache.height = cacheSize*vt.pageSize;
+    vt.pageCache.mipmaps = 1;
+    vt.pageCache.format = source.format;
+
+    // Fallback texture from first mipmap level fitting VIRTUAL_TEXTURE_FALLBACK_SIZE
+    // NOTE: KTX levels data is consecutive, every level data preceded by its size
+    TiledImageData *sourceData = (TiledImageData *)source.tilesData;
+    long long levelOffset = sourceData->dataOffset;
+    int levelWidth = source.width;
+    int levelHeight = source.height;
+    int bytesPerPixel = GetPixelDataSize(1, 1, source.format);
+
+    for (int i = 1; i < source.mipmaps; i++)
+    {
+        levelOffset += (long long)levelWidth*levelHeight*bytesPerPixel + sizeof(unsigned int);
+        levelWidth = (levelWidth > 1)? levelWidth/2 : 1;
+        levelHeight = (levelHeight > 1)? levelHeight/2 : 1;
 
-        for (int j = 0; j < potHeight; j++)
+        if ((levelWidth <= VIRTUAL_TEXTURE_FALLBACK_SIZE) && (levelHeight <= VIRTUAL_TEXTURE_FALLBACK_SIZE))
         {
-            for (int i = 0; i < potWidth; i++)
+            TiledImage level = LoadTiledImageRaw(fileName, levelWidth, levelHeight, source.format, 0);
+
+            if (level.tilesData != NULL)
             {
-                if ((j < image->height) && (i < image->width)) pixelsPOT[j*potWidth + i] = pixels[j*image->width + i];
-                else pixelsPOT[j*potWidth + i] = fillColor;
+                ((TiledImageData *)level.tilesData)->dataOffset = levelOffset;
+
+                Image image = GetTiledImageRegion(level, (Rectangle){ 0, 0, (float)levelWidth, (float)levelHeight });
+                if (image.data != NULL) vt.fallback = LoadTextureFromImage(image);
+
+                UnloadImage(image);
+                UnloadTiledImage(level);
             }
+            break;
         }
+    }
 
-        TraceLog(LOG_WARNING, "Image converted to POT: (%ix%i) -> (%ix%i)", image->width, image->height, potWidth, potHeight);
+    if (vt.fallback.id == 0)
+    {
+        Color pixel = GRAY;
+        Image image = LoadImageEx(&pixel, 1, 1);
+        vt.fallback = LoadTextureFromImage(image);
+        UnloadImage(image);
+    }
 
-        RL_FREE(pixels);                       // Free pixels data
-        RL_FREE(image->data);                  // Free old image data
+    // Feedback render texture (low resolution)
+    int feedbackWidth = GetScreenWidth()/VIRTUAL_TEXTURE_FEEDBACK_SCALE;
+    int feedbackHeight = GetScreenHeight()/VIRTUAL_TEXTURE_FEEDBACK_SCALE;
+    vt.feedback = LoadRenderTexture((feedbackWidth > 0)? feedbackWidth : 1, (feedbackHeight > 0)? feedbackHeight : 1);
 
-        int format = image->format;         // Store image data format to reconvert later
+    vt.shader = LoadVirtualTextureShader(false);
+    vt.feedbackShader = LoadVirtualTextureShader(true);
 
-        // NOTE: Image size changes, new width and height
-        *image = LoadImageEx(pixelsPOT, potWidth, potHeight);
+    // Shaders uniforms (program state is kept)
+    Vector2 virtualPages = { (float)vt.width/vt.pageSize, (float)vt.height/vt.pageSize };
+    Vector2 pagesCount = { (float)data->pagesX, (float)data->pagesY };
+    float cachePages = (float)cacheSize;
 
-        RL_FREE(pixelsPOT);                    // Free POT pixels data
+    SetShaderValue(vt.shader, GetShaderLocation(vt.shader, "virtualPages"), &virtualPages, UNIFORM_VEC2);
+    SetShaderValue(vt.shader, GetShaderLocation(vt.shader, "pagesCount"), &pagesCount, UNIFORM_VEC2);
+    SetShaderValue(vt.shader, GetShaderLocation(vt.shader, "cachePages"), &cachePages, UNIFORM_FLOAT);
+    SetShaderValue(vt.feedbackShader, GetShaderLocation(vt.feedbackShader, "virtualPages"), &virtualPages, UNIFORM_VEC2);
 
-        ImageFormat(image, format);  // Reconvert image to previous format
-    }
+    TraceLog(LOG_INFO, "[%s] Virtual texture loaded successfully (%ix%i - %ix%i pages, cache: %i pages)", fileName, vt.width, vt.height, data->pagesX, data->pagesY, cacheSize*cacheSize);
+#endif
+
+    return vt;
 }
 
-// Convert image data to desired format
-void ImageFormat(Image *image, int newFormat)
+// Unload virtual texture, pages being loaded are waited for
+void UnloadVirtualTexture(VirtualTexture vt)
 {
-    // Security check to avoid program crash
-    if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
+    VirtualTextureData *data = (VirtualTextureData *)vt.vtData;
 
-    if ((newFormat != 0) && (image->format != newFormat))
-    {
-        if ((image->format < COMPRESSED_DXT1_RGB) && (newFormat < COMPRESSED_DXT1_RGB))
-        {
-            Vector4 *pixels = GetImageDataNormalized(*image);     // Supports 8 to 32 bit per channel
+    if (data == NULL) return;
 
-            RL_FREE(image->data);      // WARNING! We loose mipmaps data --> Regenerated at the end...
-            image->data = NULL;
-            image->format = newFormat;
+    WaitWorkerJobs(&data->pending);
 
-            int k = 0;
+    for (int i = 0; i < data->loadCount; i++) UnloadImage(data->loadImages[i]);
 
-            switch (image->format)
-            {
-                case UNCOMPRESSED_GRAYSCALE:
-                {
-                    image->data = (unsigned char *)RL_MALLOC(image->width*image->height*sizeof(unsigned char));
+    UnloadTexture(vt.pageTable);
+    UnloadTexture(vt.pageCache);
+    UnloadTexture(vt.fallback);
+    UnloadRenderTexture(vt.feedback);
+    UnloadShader(vt.shader);
+    UnloadShader(vt.feedbackShader);
 
-                    for (int i = 0; i < image->width*image->height; i++)
-                    {
-                        ((unsigned char *)image->data)[i] = (unsigned char)((pixels[i].x*0.299f + pixels[i].y*0.587f + pixels[i].z*0.114f)*255.0f);
-                    }
+    UnloadTiledImage(data->source);
 
-                } break;
-                case UNCOMPRESSED_GRAY_ALPHA:
-                {
-                    image->data = (unsigned char *)RL_MALLOC(image->width*image->height*2*sizeof(unsigned char));
+    RL_FREE(data->pageSlots);
+    RL_FREE(data->pageLastSeen);
+    RL_FREE(data->slotPages);
+    RL_FREE(data->slotLastUse);
+    RL_FREE(data->pageTableData);
+    RL_FREE(data->feedbackData);
+    RL_FREE(data);
+}
 
-                    for (int i = 0; i < image->width*image->height*2; i += 2, k++)
-                    {
-                        ((unsigned char *)image->data)[i] = (unsigned char)((pixels[k].x*0.299f + (float)pixels[k].y*0.587f + (float)pixels[k].z*0.114f)*255.0f);
-                        ((unsigned char *)image->data)[i + 1] = (unsigned char)(pixels[k].w*255.0f);
-                    }
+// Begin virtual texture feedback pass, models using the virtual texture must be drawn with vt.feedbackShader
+// NOTE: Feedback render texture is low resolution, same camera than main pass should be used
+void BeginVirtualTextureFeedback(VirtualTexture vt)
+{
+    if (vt.vtData == NULL) return;
 
-                } break;
-                case UNCOMPRESSED_R5G6B5:
-                {
-                    image->data = (unsigned short *)RL_MALLOC(image->width*image->height*sizeof(unsigned short));
+    BeginTextureMode(vt.feedback);
+    ClearBackground(BLANK);
+}
 
-                    unsigned char r = 0;
-                    unsigned char g = 0;
-                    unsigned char b = 0;
+// End virtual texture feedback pass, visible pages are marked as used and not resident ones are requested
+// NOTE: Feedback pixels are read back from GPU, requested pages are loaded on UpdateVirtualTexture()
+void EndVirtualTextureFeedback(VirtualTexture vt)
+{
+    VirtualTextureData *data = (VirtualTextureData *)vt.vtData;
 
-                    for (int i = 0; i < image->width*image->height; i++)
-                    {
-                        r = (unsigned char)(round(pixels[i].x*31.0f));
-                        g = (unsigned char)(round(pixels[i].y*63.0f));
-                        b = (unsigned char)(round(pixels[i].z*31.0f));
+    if (data == NULL) return;
 
-                        ((unsigned short *)image->data)[i] = (unsigned short)r << 11 | (unsigned short)g << 5 | (unsigned short)b;
-                    }
+    EndTextureMode();
 
-                } break;
-                case UNCOMPRESSED_R8G8B8:
-                {
-                    image->data = (unsigned char *)RL_MALLOC(image->width*image->height*3*sizeof(unsigned char));
+    // NOTE: Feedback is read into a buffer kept between frames (no allocation per frame)
+    if (data->feedbackData == NULL) data->feedbackData = (Color *)RL_MALLOC(vt.feedback.texture.width*vt.feedback.texture.height*sizeof(Color));
 
-                    for (int i = 0, k = 0; i < image->width*image->height*3; i += 3, k++)
-                    {
-                        ((unsigned char *)image->data)[i] = (unsigned char)(pixels[k].x*255.0f);
-                        ((unsigned char *)image->data)[i + 1] = (unsigned char)(pixels[k].y*255.0f);
-                        ((unsigned char *)image->data)[i + 2] = (unsigned char)(pixels[k].z*255.0f);
-                    }
-                } break;
-                case UNCOMPRESSED_R5G5B5A1:
-                {
-                    #define ALPHA_THRESHOLD  50
+    Color *pixels = data->feedbackData;
 
-                    image->data = (unsigned short *)RL_MALLOC(image->width*image->height*sizeof(unsigned short));
+    if (!rlReadTexturePixelsEx(vt.feedback.texture, pixels)) return;
 
-                    unsigned char r = 0;
-                    unsigned char g = 0;
-                    unsigned char b = 0;
-                    unsigned char a = 0;
+    data->frameCounter++;
+    data->requestsCount = 0;
 
-                    for (int i = 0; i < image->width*image->height; i++)
-                    {
-                        r = (unsigned char)(round(pixels[i].x*31.0f));
-                        g = (unsigned char)(round(pixels[i].y*31.0f));
-                        b = (unsigned char)(round(pixels[i].z*31.0f));
-                        a = (pixels[i].w > ((float)ALPHA_THRESHOLD/255.0f))? 1 : 0;
+    for (int i = 0; i < vt.feedback.texture.width*vt.feedback.texture.height; i++)
+    {
+        // NOTE: Pages positions encoded with 12 bit: r, g (low 8 bit), b (high 4 bit of x and y)
+        if (pixels[i].a == 0) continue;
 
-                        ((unsigned short *)image->data)[i] = (unsigned short)r << 11 | (unsigned short)g << 6 | (unsigned short)b << 1 | (unsigned short)a;
-                    }
+        int x = pixels[i].r + (pixels[i].b & 0x0f)*256;
+        int y = pixels[i].g + (pixels[i].b >> 4)*256;
 
-                } break;
-                case UNCOMPRESSED_R4G4B4A4:
-                {
-                    image->data = (unsigned short *)RL_MALLOC(image->width*image->height*sizeof(unsigned short));
+        if ((x >= data->pagesX) || (y >= data->pagesY)) continue;
 
-                    unsigned char r = 0;
-                    unsigned char g = 0;
-                    unsigned char b = 0;
-                    unsigned char a = 0;
+        int page = y*data->pagesX + x;
 
-                    for (int i = 0; i < image->width*image->height; i++)
-                    {
-                        r = (unsigned char)(round(pixels[i].x*15.0f));
-                        g = (unsigned char)(round(pixels[i].y*15.0f));
-                        b = (unsigned char)(round(pixels[i].z*15.0f));
-                        a = (unsigned char)(round(pixels[i].w*15.0f));
+        if (data->pageLastSeen[page] == data->frameCounter) continue;
+        data->pageLastSeen[page] = data->frameCounter;
 
-                        ((unsigned short *)image->data)[i] = (unsigned short)r << 12 | (unsigned short)g << 8 | (unsigned short)b << 4 | (unsigned short)a;
-                    }
+        if (data->pageSlots[page] >= 0) data->slotLastUse[data->pageSlots[page]] = data->frameCounter;
+        else if ((data->pageSlots[page] == -1) && (data->requestsCount < MAX_VIRTUAL_PAGE_LOADS)) data->requests[data->requestsCount++] = page;
+    }
+}
 
-                } break;
-                case UNCOMPRESSED_R8G8B8A8:
-                {
-                    image->data = (unsigned char *)RL_MALLOC(image->width*image->height*4*sizeof(unsigned char));
+// Update virtual texture, loaded pages are uploaded to pages cache (least recently used pages replaced)
+// and pages requested on last feedback are loaded asynchronously from file (worker threads)
+void UpdateVirtualTexture(VirtualTexture vt)
+{
+    VirtualTextureData *data = (VirtualTextureData *)vt.vtData;
 
-                    for (int i = 0, k = 0; i < image->width*image->height*4; i += 4, k++)
-                    {
-                        ((unsigned char *)image->data)[i] = (unsigned char)(pixels[k].x*255.0f);
-                        ((unsigned char *)image->data)[i + 1] = (unsigned char)(pixels[k].y*255.0f);
-                        ((unsigned char *)image->data)[i + 2] = (unsigned char)(pixels[k].z*255.0f);
-                        ((unsigned char *)image->data)[i + 3] = (unsigned char)(pixels[k].w*255.0f);
-                    }
-                } break;
-                case UNCOMPRESSED_R32:
-                {
-                    // WARNING: Image is converted to GRAYSCALE eqeuivalent 32bit
+    if (data == NULL) return;
 
-                    image->data = (float *)RL_MALLOC(image->width*image->height*sizeof(float));
+    if ((data->loadCount > 0) && (GetWorkerJobsPending(&data->pending) == 0))
+    {
+        for (int i = 0; i < data->loadCount; i++)
+        {
+            int page = data->loadPages[i];
+            Image image = data->loadImages[i];
 
-                    for (int i = 0; i < image->width*image->height; i++)
-                    {
-                        ((float *)image->data)[i] = (float)(pixels[i].x*0.299f + pixels[i].y*0.587f + pixels[i].z*0.114f);
-                    }
-                } break;
-                case UNCOMPRESSED_R32G32B32:
-                {
-                    image->data = (float *)RL_MALLOC(image->width*image->height*3*sizeof(float));
+            data->pageSlots[page] = -1;
 
-                    for (int i = 0, k = 0; i < image->width*image->height*3; i += 3, k++)
-                    {
-                        ((float *)image->data)[i] = pixels[k].x;
-                        ((float *)image->data)[i + 1] = pixels[k].y;
-                        ((float *)image->data)[i + 2] = pixels[k].z;
-                    }
-                } break;
-                case UNCOMPRESSED_R32G32B32A32:
-                {
-                    image->data = (float *)RL_MALLOC(image->width*image->height*4*sizeof(float));
+            if (image.data == NULL) continue;
 
-                    for (int i = 0, k = 0; i < image->width*image->height*4; i += 4, k++)
-                    {
-                        ((float *)image->data)[i] = pixels[k].x;
-                        ((float *)image->data)[i + 1] = pixels[k].y;
-                        ((float *)image->data)[i + 2] = pixels[k].z;
-                        ((float *)image->data)[i + 3] = pixels[k].w;
-                    }
-                } break;
-                default: break;
-            }
+            // Find free cache slot or least recently used one (pages used on last feedback are kept)
+            int slot = -1;
 
-            RL_FREE(pixels);
-            pixels = NULL;
+            for (int s = 0; s < data->cacheSize*data->cacheSize; s++)
+            {
+                if (data->slotPages[s] == -1) { slot = s; break; }
+                if ((data->slotLastUse[s] != data->frameCounter) && ((slot == -1) || (data->slotLastUse[s] < data->slotLastUse[slot]))) slot = s;
+            }
 
-            // In case original image had mipmaps, generate mipmaps for formated image
-            // NOTE: Original mipmaps are replaced by new ones, if custom mipmaps were used, they are lost
-            if (image->mipmaps > 1)
+            if (slot >= 0)
             {
-                image->mipmaps = 1;
-            #if defined(SUPPORT_IMAGE_MANIPULATION)
-                if (image->data != NULL) ImageMipmaps(image);
-            #endif
+                if (data->slotPages[slot] >= 0)
+                {
+                    data->pageSlots[data->slotPages[slot]] = -1;
+                    data->pageTableData[data->slotPages[slot]].a = 0;
+                }
+
+                int slotX = slot%data->cacheSize;
+                int slotY = slot/data->cacheSize;
+
+                rlUpdateTextureRec(vt.pageCache.id, slotX*vt.pageSize, slotY*vt.pageSize, image.width, image.height, image.format, image.data);
+
+                data->slotPages[slot] = page;
+                data->slotLastUse[slot] = data->frameCounter;
+                data->pageSlots[page] = slot;
+                data->pageTableData[page] = (Color){ (unsigned char)slotX, (unsigned char)slotY, 0, 255 };
+                data->pageTableDirty = true;
             }
+
+            UnloadImage(image);
         }
-        else TraceLog(LOG_WARNING, "Image data format is compressed, can not be converted");
+
+        data->loadCount = 0;
     }
-}
 
-// Apply alpha mask to image
-// NOTE 1: Returned image is GRAY_ALPHA (16bit) or RGBA (32bit)
-// NOTE 2: alphaMask should be same size as image
-void ImageAlphaMask(Image *image, Image alphaMask)
-{
-    if ((image->width != alphaMask.width) || (image->height != alphaMask.height))
+    if ((data->loadCount == 0) && (data->requestsCount > 0))
     {
-        TraceLog(LOG_WARNING, "Alpha mask must be same size as image");
+        for (int i = 0; i < data->requestsCount; i++)
+        {
+            data->loadPages[i] = data->requests[i];
+            data->pageSlots[data->requests[i]] = -2;
+        }
+
+        data->loadCount = data->requestsCount;
+        data->requestsCount = 0;
+
+        SubmitWorkerJob(LoadVirtualPagesJob, data, &data->pending);
     }
-    else if (image->format >= COMPRESSED_DXT1_RGB)
+
+    if (data->pageTableDirty)
     {
-        TraceLog(LOG_WARNING, "Alpha mask can not be applied to compressed data formats");
+        rlUpdateTexture(vt.pageTable.id, data->pagesX, data->pagesY, UNCOMPRESSED_R8G8B8A8, data->pageTableData);
+        data->pageTableDirty = false;
     }
-    else
-    {
-        // Force mask to be Grayscale
-        Image mask = ImageCopy(alphaMask);
-        if (mask.format != UNCOMPRESSED_GRAYSCALE) ImageFormat(&mask, UNCOMPRESSED_GRAYSCALE);
+}
 
-        // In case image is only grayscale, we just add alpha channel
-        if (image->format == UNCOMPRESSED_GRAYSCALE)
-        {
-            unsigned char *data = (unsigned char *)RL_MALLOC(image->width*image->height*2);
+// Set material shader and maps to sample virtual texture
+// NOTE: Maps used: MAP_DIFFUSE (fallback texture), MAP_SPECULAR (page table), MAP_NORMAL (pages cache)
+void SetMaterialVirtualTexture(Material *material, VirtualTexture vt)
+{
+    material->shader = vt.shader;
+    material->maps[MAP_DIFFUSE].texture = vt.fallback;
+    material->maps[MAP_SPECULAR].texture = vt.pageTable;
+    material->maps[MAP_NORMAL].texture = vt.pageCache;
+}
 
-            // Apply alpha mask to alpha channel
-            for (int i = 0, k = 0; (i < mask.width*mask.height) || (i < image->width*image->height); i++, k += 2)
-            {
-                data[k] = ((unsigned char *)image->data)[i];
-                data[k + 1] = ((unsigned char *)mask.data)[i];
-            }
+// Load post-processing chain, scene must be drawn into post.target (BeginTextureMode())
+PostProcess LoadPostProcess(int width, int height)
+{
+    PostProcess post = { 0 };
 
-            RL_FREE(image->data);
-            image->data = data;
-            image->format = UNCOMPRESSED_GRAY_ALPHA;
-        }
-        else
-        {
-            // Convert image to RGBA
-            if (image->format != UNCOMPRESSED_R8G8B8A8) ImageFormat(image, UNCOMPRESSED_R8G8B8A8);
+#if defined(GRAPHICS_API_OPENGL_11)
+    TraceLog(LOG_WARNING, "Post-processing requires shaders support (OpenGL 2.1, 3.3 or ES2)");
+#else
+    post.target = LoadRenderTexture(width, height);
 
-            // Apply alpha mask to alpha channel
-            for (int i = 0, k = 3; (i < mask.width*mask.height) || (i < image->width*image->height); i++, k += 4)
-            {
-                ((unsigned char *)image->data)[k] = ((unsigned char *)mask.data)[i];
-            }
-        }
+    if (post.target.id == 0) return post;
+
+    PostProcessData *data = (PostProcessData *)RL_CALLOC(1, sizeof(PostProcessData));
+    post.ppData = data;
+#endif
+
+    return post;
+}
+
+// Unload post-processing chain, full pass effects shaders are not unloaded (owned by user)
+void UnloadPostProcess(PostProcess post)
+{
+    PostProcessData *data = (PostProcessData *)post.ppData;
+
+    if (data == NULL) return;
 
-        UnloadImage(mask);
+    for (int i = 0; i < data->passesCount; i++)
+    {
+        if (data->generated[i]) UnloadShader(data->passes[i]);
     }
+
+    for (int i = 0; i < data->effectsCount; i++) RL_FREE(data->effects[i].code);
+
+    UnloadRenderTexture(post.target);
+    RL_FREE(data);
 }
 
-// Clear alpha channel to desired color
-// NOTE: Threshold defines the alpha limit, 0.0f to 1.0f
-void ImageAlphaClear(Image *image, Color color, float threshold)
+// Add per-pixel effect to chain, returns effect index (-1 on failure)
+// NOTE: Code must define a function: vec4 effect(vec4 color, vec2 texCoord), plus uniforms used (names unique in chain);
+// effect only gets current pixel color, texture0 is not sampled by merged effects (use AddPostEffectShader())
+int AddPostEffect(PostProcess post, const char *fsCode)
 {
-    // Security check to avoid program crash
-    if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
+    PostProcessData *data = (PostProcessData *)post.ppData;
 
-    Color *pixels = GetImageData(*image);
+    if ((data == NULL) || (fsCode == NULL)) return -1;
 
-    for (int i = 0; i < image->width*image->height; i++) if (pixels[i].a <= (unsigned char)(threshold*255.0f)) pixels[i] = color;
+    if (data->effectsCount >= MAX_POSTPROCESS_EFFECTS)
+    {
+        TraceLog(LOG_WARNING, "Post-processing effects limit reached (%i)", MAX_POSTPROCESS_EFFECTS);
+        return -1;
+    }
 
-    UnloadImage(*image);
+    PostEffect *effect = &data->effects[data->effectsCount];
+    memset(effect, 0, sizeof(PostEffect));
+    effect->code = (char *)RL_MALLOC(strlen(fsCode) + 1);
+    strcpy(effect->code, fsCode);
 
-    int prevFormat = image->format;
-    *image = LoadImageEx(pixels, image->width, image->height);
+    data->dirty = true;         // Merged passes must be generated again
 
-    ImageFormat(image, prevFormat);
+    return data->effectsCount++;
 }
 
-// Premultiply alpha channel
-void ImageAlphaPremultiply(Image *image)
+// Add full pass effect shader to chain, shader samples texture0 (previous pass output), returns effect index (-1 on failure)
+int AddPostEffectShader(PostProcess post, Shader shader)
 {
-    // Security check to avoid program crash
-    if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
+    PostProcessData *data = (PostProcessData *)post.ppData;
 
-    float alpha = 0.0f;
-    Color *pixels = GetImageData(*image);
+    if ((data == NULL) || (shader.id == 0)) return -1;
 
-    for (int i = 0; i < image->width*image->height; i++)
+    if (data->effectsCount >= MAX_POSTPROCESS_EFFECTS)
     {
-        alpha = (float)pixels[i].a/255.0f;
-        pixels[i].r = (unsigned char)((float)pixels[i].r*alpha);
-        pixels[i].g = (unsigned char)((float)pixels[i].g*alpha);
-        pixels[i].b = (unsigned char)((float)pixels[i].b*alpha);
+        TraceLog(LOG_WARNING, "Post-processing effects limit reached (%i)", MAX_POSTPROCESS_EFFECTS);
+        return -1;
     }
 
-    UnloadImage(*image);
+    PostEffect *effect = &data->effects[data->effectsCount];
+    memset(effect, 0, sizeof(PostEffect));
+    effect->shader = shader;
 
-    int prevFormat = image->format;
-    *image = LoadImageEx(pixels, image->width, image->height);
+    data->dirty = true;
 
-    ImageFormat(image, prevFormat);
+    return data->effectsCount++;
 }
 
-#if defined(SUPPORT_IMAGE_MANIPULATION)
-// Load cubemap from image, multiple image cubemap layouts supported
-TextureCubemap LoadTextureCubemap(Image image, int layoutType)
+// Set effect shader uniform value
+// NOTE: Per-pixel effects values are kept and set again when merged pass shader is generated
+void SetPostEffectValue(PostProcess post, int effect, const char *uniformName, const void *value, int uniformType)
 {
-    TextureCubemap cubemap = { 0 };
+    PostProcessData *data = (PostProcessData *)post.ppData;
 
-    if (layoutType == CUBEMAP_AUTO_DETECT)      // Try to automatically guess layout type
+    if ((data == NULL) || (effect < 0) || (effect >= data->effectsCount)) return;
+
+    PostEffect *fx = &data->effects[effect];
+
+    if (fx->code == NULL)
     {
-        // Check image width/height to determine the type of cubemap provided
-        if (image.width > image.height)
-        {
-            if ((image.width/6) == image.height) { layoutType = CUBEMAP_LINE_HORIZONTAL; cubemap.width = image.width/6; }
-            else if ((image.width/4) == (image.height/3)) { layoutType = CUBEMAP_CROSS_FOUR_BY_THREE; cubemap.width = image.width/4; }
-            else if (image.width >= (int)((float)image.height*1.85f)) { layoutType = CUBEMAP_PANORAMA; cubemap.width = image.width/4; }
-        }
-        else if (image.height > image.width)
+        SetShaderValue(fx->shader, GetShaderLocation(fx->shader, uniformName), value, uniformType);
+        return;
+    }
+
+    int size = 4;
+    if ((uniformType == UNIFORM_VEC2) || (uniformType == UNIFORM_IVEC2)) size = 8;
+    else if ((uniformType == UNIFORM_VEC3) || (uniformType == UNIFORM_IVEC3)) size = 12;
+    else if ((uniformType == UNIFORM_VEC4) || (uniformType == UNIFORM_IVEC4)) size = 16;
+
+    PostEffectValue *entry = NULL;
+
+    for (int i = 0; i < fx->valuesCount; i++)
+    {
+        if (strcmp(fx->values[i].name, uniformName) == 0) { entry = &fx->values[i]; break; }
+    }
+
+    if (entry == NULL)
+    {
+        if (fx->valuesCount >= MAX_POSTEFFECT_VALUES)
         {
-            if ((image.height/6) == image.width) { layoutType = CUBEMAP_LINE_VERTICAL; cubemap.width = image.height/6; }
-            else if ((image.width/3) == (image.height/4)) { layoutType = CUBEMAP_CROSS_THREE_BY_FOUR; cubemap.width = image.width/3; }
+            TraceLog(LOG_WARNING, "Post-processing effect values limit reached (%i)", MAX_POSTEFFECT_VALUES);
+            return;
         }
 
-        cubemap.height = cubemap.width;
+        entry = &fx->values[fx->valuesCount++];
+        strncpy(entry->name, uniformName, sizeof(entry->name) - 1);
     }
 
-    if (layoutType != CUBEMAP_AUTO_DETECT)
+    entry->type = uniformType;
+    memcpy(entry->data, value, size);
+
+    if (!data->dirty)
     {
-        int size = cubemap.width;
+        Shader shader = data->passes[fx->pass];
+        SetShaderValue(shader, GetShaderLocation(shader, entry->name), entry->data, entry->type);
+    }
+}
 
-        Image faces = { 0 };                // Vertical column image
-        Rectangle faceRecs[6] = { 0 };      // Face source rectangles
-        for (int i = 0; i < 6; i++) faceRecs[i] = (Rectangle){ 0, 0, size, size };
+// Draw scene render target through effects chain
+// NOTE: Intermediate passes use pooled render targets (ping-pong), last pass draws directly into
+// current framebuffer (no extra resolve), it must be called outside texture mode
+void DrawPostProcess(PostProcess post)
+{
+#if !defined(GRAPHICS_API_OPENGL_11)
+    PostProcessData *data = (PostProcessData *)post.ppData;
 
-        if (layoutType == CUBEMAP_LINE_VERTICAL)
+    if (data == NULL) return;
+
+    if (data->dirty) LoadPostProcessPasses(data);
+
+    if (data->passesCount == 0)
+    {
+        DrawPostProcessPass(GetShaderDefault(), post.target.texture);
+        return;
+    }
+
+    RenderTexture2D pingPong[2] = { 0 };
+    Texture2D source = post.target.texture;
+
+    for (int i = 0; i < data->passesCount; i++)
+    {
+        bool last = (i == (data->passesCount - 1));
+
+        if (!last)
         {
-            faces = image;
-            for (int i = 0; i < 6; i++) faceRecs[i].y = size*i;
+            RenderTexture2D *target = &pingPong[i%2];
+            if (target->id == 0) *target = GetPooledRenderTexture(post.target.texture.width, post.target.texture.height);
+
+            BeginTextureMode(*target);
+            ClearBackground(BLANK);
         }
-        else if (layoutType == CUBEMAP_PANORAMA)
+
+        DrawPostProcessPass(data->passes[i], source);
+
+        if (!last)
         {
-            // TODO: Convert panorama image to square faces...
-            // Ref: https://github.com/denivip/panorama/blob/master/panorama.cpp
+            EndTextureMode();
+            source = pingPong[i%2].texture;
         }
-        else
-        {
-            if (layoutType == CUBEMAP_LINE_HORIZONTAL) for (int i = 0; i < 6; i++) faceRecs[i].x = size*i;
-            else if (layoutType == CUBEMAP_CROSS_THREE_BY_FOUR)
-            {
-                faceRecs[0].x = size; faceRecs[0].y = size;
-                faceRecs[1].x = size; faceRecs[1].y = 3*size;
-                faceRecs[2].x = size; faceRecs[2].y = 0;
-                faceRecs[3].x = size; faceRecs[3].y = 2*size;
-                faceRecs[4].x = 0; faceRecs[4].y = size;
-                faceRecs[5].x = 2*size; faceRecs[5].y = size;
-            }
-            else if (layoutType == CUBEMAP_CROSS_FOUR_BY_THREE)
-            {
-                faceRecs[0].x = 2*size; faceRecs[0].y = size;
-                faceRecs[1].x = 0; faceRecs[1].y = size;
-                faceRecs[2].x = size; faceRecs[2].y = 0;
-                faceRecs[3].x = size; faceRecs[3].y = 2*size;
-                faceRecs[4].x = size; faceRecs[4].y = size;
-                faceRecs[5].x = 3*size; faceRecs[5].y = size;
-            }
-
-            // Convert image data to 6 faces in a vertical column, that's the optimum layout for loading
-            faces = GenImageColor(size, size*6, MAGENTA);
-            ImageFormat(&faces, image.format);
-
-            // TODO: Image formating does not work with compressed textures!
-        }
-
-        for (int i = 0; i < 6; i++) ImageDraw(&faces, image, faceRecs[i], (Rectangle){ 0, size*i, size, size }, WHITE);
-
-        cubemap.id = rlLoadTextureCubemap(faces.data, size, faces.format);
-        if (cubemap.id == 0) TraceLog(LOG_WARNING, "Cubemap image could not be loaded.");
-
-        UnloadImage(faces);
     }
-    else TraceLog(LOG_WARNING, "Cubemap image layout can not be detected.");
 
-    return cubemap;
+    for (int i = 0; i < 2; i++)
+    {
+        if (pingPong[i].id > 0) ReleasePooledRenderTexture(pingPong[i]);
+    }
+#endif
 }
 
-// Crop an image to area defined by a rectangle
-// NOTE: Security checks are performed in case rectangle goes out of bounds
-void ImageCrop(Image *image, Rectangle crop)
+// Get pixel data from image in the form of Color struct array
+Color *GetImageData(Image image)
 {
-    // Security check to avoid program crash
-    if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
+    if ((image.width == 0) || (image.height == 0)) return NULL;
+    
+    Color *pixels = (Color *)RL_MALLOC(image.width*image.height*sizeof(Color));
+    
+    ReadImagePixels(image, pixels);
 
-    // Security checks to validate crop rectangle
-    if (crop.x < 0) { crop.width += crop.x; crop.x = 0; }
-    if (crop.y < 0) { crop.height += crop.y; crop.y = 0; }
-    if ((crop.x + crop.width) > image->width) crop.width = image->width - crop.x;
-    if ((crop.y + crop.height) > image->height) crop.height = image->height - crop.y;
+    return pixels;
+}
 
-    if ((crop.x < image->width) && (crop.y < image->height))
-    {
-        // Start the cropping process
-        Color *pixels = GetImageData(*image);   // Get data as Color pixels array
-        Color *cropPixels = (Color *)RL_MALLOC((int)crop.width*(int)crop.height*sizeof(Color));
+// Get pixel data from image as Vector4 array (float normalized)
+Vector4 *GetImageDataNormalized(Image image)
+{
+    Vector4 *pixels = (Vector4 *)RL_MALLOC(image.width*image.height*sizeof(Vector4));
 
-        for (int j = (int)crop.y; j < (int)(crop.y + crop.height); j++)
+    if (image.format >= COMPRESSED_DXT1_RGB) TraceLog(LOG_WARNING, "Pixel data retrieval not supported for compressed image formats");
+    else
+    {
+        for (int i = 0, k = 0; i < image.width*image.height; i++)
         {
-            for (int i = (int)crop.x; i < (int)(crop.x + crop.width); i++)
+            switch (image.format)
             {
-                cropPixels[(j - (int)crop.y)*(int)crop.width + (i - (int)crop.x)] = pixels[j*image->width + i];
-            }
-        }
+                case UNCOMPRESSED_GRAYSCALE:
+                {
+                    pixels[i].x = (float)((unsigned char *)image.data)[i]/255.0f;
+                    pixels[i].y = (float)((unsigned char *)image.data)[i]/255.0f;
+                    pixels[i].z = (float)((unsigned char *)image.data)[i]/255.0f;
+                    pixels[i].w = 1.0f;
 
-        RL_FREE(pixels);
+                } break;
+                case UNCOMPRESSED_GRAY_ALPHA:
+                {
+                    pixels[i].x = (float)((unsigned char *)image.data)[k]/255.0f;
+                    pixels[i].y = (float)((unsigned char *)image.data)[k]/255.0f;
+                    pixels[i].z = (float)((unsigned char *)image.data)[k]/255.0f;
+                    pixels[i].w = (float)((unsigned char *)image.data)[k + 1]/255.0f;
 
-        int format = image->format;
+                    k += 2;
+                } break;
+                case UNCOMPRESSED_R5G5B5A1:
+                {
+                    unsigned short pixel = ((unsigned short *)image.data)[i];
 
-        UnloadImage(*image);
+                    pixels[i].x = (float)((pixel & 0b1111100000000000) >> 11)*(1.0f/31);
+                    pixels[i].y = (float)((pixel & 0b0000011111000000) >> 6)*(1.0f/31);
+                    pixels[i].z = (float)((pixel & 0b0000000000111110) >> 1)*(1.0f/31);
+                    pixels[i].w = ((pixel & 0b0000000000000001) == 0)? 0.0f : 1.0f;
 
-        *image = LoadImageEx(cropPixels, (int)crop.width, (int)crop.height);
+                } break;
+                case UNCOMPRESSED_R5G6B5:
+                {
+                    unsigned short pixel = ((unsigned short *)image.data)[i];
 
-        RL_FREE(cropPixels);
+                    pixels[i].x = (float)((pixel & 0b1111100000000000) >> 11)*(1.0f/31);
+                    pixels[i].y = (float)((pixel & 0b0000011111100000) >> 5)*(1.0f/63);
+                    pixels[i].z = (float)(pixel & 0b0000000000011111)*(1.0f/31);
+                    pixels[i].w = 1.0f;
 
-        // Reformat 32bit RGBA image to original format
-        ImageFormat(image, format);
-    }
-    else TraceLog(LOG_WARNING, "Image can not be cropped, crop rectangle out of bounds");
-}
+                } break;
+                case UNCOMPRESSED_R4G4B4A4:
+                {
+                    unsigned short pixel = ((unsigned short *)image.data)[i];
 
-// Crop image depending on alpha value
-void ImageAlphaCrop(Image *image, float threshold)
-{
-    // Security check to avoid program crash
-    if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
+                    pixels[i].x = (float)((pixel & 0b1111000000000000) >> 12)*(1.0f/15);
+                    pixels[i].y = (float)((pixel & 0b0000111100000000) >> 8)*(1.0f/15);
+                    pixels[i].z = (float)((pixel & 0b0000000011110000) >> 4)*(1.0f/15);
+                    pixels[i].w = (float)(pixel & 0b0000000000001111)*(1.0f/15);
 
-    Color *pixels = GetImageData(*image);
+                } break;
+                case UNCOMPRESSED_R8G8B8A8:
+                {
+                    pixels[i].x = (float)((unsigned char *)image.data)[k]/255.0f;
+                    pixels[i].y = (float)((unsigned char *)image.data)[k + 1]/255.0f;
+                    pixels[i].z = (float)((unsigned char *)image.data)[k + 2]/255.0f;
+                    pixels[i].w = (float)((unsigned char *)image.data)[k + 3]/255.0f;
 
-    int xMin = 65536;   // Define a big enough number
-    int xMax = 0;
-    int yMin = 65536;
-    int yMax = 0;
+                    k += 4;
+                } break;
+                case UNCOMPRESSED_R8G8B8:
+                {
+                    pixels[i].x = (float)((unsigned char *)image.data)[k]/255.0f;
+                    pixels[i].y = (float)((unsigned char *)image.data)[k + 1]/255.0f;
+                    pixels[i].z = (float)((unsigned char *)image.data)[k + 2]/255.0f;
+                    pixels[i].w = 1.0f;
 
-    for (int y = 0; y < image->height; y++)
-    {
-        for (int x = 0; x < image->width; x++)
-        {
-            if (pixels[y*image->width + x].a > (unsigned char)(threshold*255.0f))
-            {
-                if (x < xMin) xMin = x;
-                if (x > xMax) xMax = x;
-                if (y < yMin) yMin = y;
-                if (y > yMax) yMax = y;
+                    k += 3;
+                } break;
+                case UNCOMPRESSED_R32:
+                {
+                    pixels[i].x = ((float *)image.data)[k];
+                    pixels[i].y = 0.0f;
+                    pixels[i].z = 0.0f;
+                    pixels[i].w = 1.0f;
+
+                } break;
+                case UNCOMPRESSED_R32G32B32:
+                {
+                    pixels[i].x = ((float *)image.data)[k];
+                    pixels[i].y = ((float *)image.data)[k + 1];
+                    pixels[i].z = ((float *)image.data)[k + 2];
+                    pixels[i].w = 1.0f;
+
+                    k += 3;
+                } break;
+                case UNCOMPRESSED_R32G32B32A32:
+                {
+                    pixels[i].x = ((float *)image.data)[k];
+                    pixels[i].y = ((float *)image.data)[k + 1];
+                    pixels[i].z = ((float *)image.data)[k + 2];
+                    pixels[i].w = ((float *)image.data)[k + 3];
+
+                    k += 4;
+                }
+                default: break;
             }
         }
     }
 
-    Rectangle crop = { xMin, yMin, (xMax + 1) - xMin, (yMax + 1) - yMin };
-
-    RL_FREE(pixels);
-
-    // Check for not empty image brefore cropping
-    if (!((xMax < xMin) || (yMax < yMin))) ImageCrop(image, crop);
+    return pixels;
 }
 
-// Resize and image to new size
-// NOTE: Uses stb default scaling filters (both bicubic):
-// STBIR_DEFAULT_FILTER_UPSAMPLE    STBIR_FILTER_CATMULLROM
-// STBIR_DEFAULT_FILTER_DOWNSAMPLE  STBIR_FILTER_MITCHELL   (high-quality Catmull-Rom)
-void ImageResize(Image *image, int newWidth, int newHeight)
+// Get image alpha border rectangle
+Rectangle GetImageAlphaBorder(Image image, float threshold)
 {
-    // Security check to avoid program crash
-    if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
-
-    // Get data as Color pixels array to work with it
-    Color *pixels = GetImageData(*image);
-    Color *output = (Color *)RL_MALLOC(newWidth*newHeight*sizeof(Color));
-
-    // NOTE: Color data is casted to (unsigned char *), there shouldn't been any problem...
-    stbir_resize_uint8((unsigned char *)pixels, image->width, image->height, 0, (unsigned char *)output, newWidth, newHeight, 0, 4);
+    Rectangle crop = { 0 };
+    
+    Color *pixels = GetImageData(image);
+    
+    if (pixels != NULL)
+    {
+        int xMin = 65536;   // Define a big enough number
+        int xMax = 0;
+        int yMin = 65536;
+        int yMax = 0;
 
-    int format = image->format;
+        for (int y = 0; y < image.height; y++)
+        {
+            for (int x = 0; x < image.width; x++)
+            {
+                if (pixels[y*image.width + x].a > (unsigned char)(threshold*255.0f))
+                {
+                    if (x < xMin) xMin = x;
+                    if (x > xMax) xMax = x;
+                    if (y < yMin) yMin = y;
+                    if (y > yMax) yMax = y;
+                }
+            }
+        }
 
-    UnloadImage(*image);
+        // Check for empty blank image
+        if ((xMin != 65536) && (xMax != 65536))
+        {
+            crop = (Rectangle){ xMin, yMin, (xMax + 1) - xMin, (yMax + 1) - yMin };
+        }
 
-    *image = LoadImageEx(output, newWidth, newHeight);
-    ImageFormat(image, format);  // Reformat 32bit RGBA image to original format
+        RL_FREE(pixels);
+    }
 
-    RL_FREE(output);
-    RL_FREE(pixels);
+    return crop;
 }
 
-// Resize and image to new size using Nearest-Neighbor scaling algorithm
-void ImageResizeNN(Image *image,int newWidth,int newHeight)
+// Get pixel data size in bytes (image or texture)
+// NOTE: Size depends on pixel format
+int GetPixelDataSize(int width, int height, int format)
 {
-    // Security check to avoid program crash
-    if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
-
-    Color *pixels = GetImageData(*image);
-    Color *output = (Color *)RL_MALLOC(newWidth*newHeight*sizeof(Color));
-
-    // EDIT: added +1 to account for an early rounding problem
-    int xRatio = (int)((image->width << 16)/newWidth) + 1;
-    int yRatio = (int)((image->height << 16)/newHeight) + 1;
+    int dataSize = 0;       // Size in bytes
+    int bpp = 0;            // Bits per pixel
 
-    int x2, y2;
-    for (int y = 0; y < newHeight; y++)
+    switch (format)
     {
-        for (int x = 0; x < newWidth; x++)
-        {
-            x2 = ((x*xRatio) >> 16);
-            y2 = ((y*yRatio) >> 16);
-
-            output[(y*newWidth) + x] = pixels[(y2*image->width) + x2] ;
-        }
+        case UNCOMPRESSED_GRAYSCALE: bpp = 8; break;
+        case UNCOMPRESSED_GRAY_ALPHA:
+        case UNCOMPRESSED_R5G6B5:
+        case UNCOMPRESSED_R5G5B5A1:
+        case UNCOMPRESSED_R4G4B4A4: bpp = 16; break;
+        case UNCOMPRESSED_R8G8B8A8: bpp = 32; break;
+        case UNCOMPRESSED_R8G8B8: bpp = 24; break;
+        case UNCOMPRESSED_R32: bpp = 32; break;
+        case UNCOMPRESSED_R32G32B32: bpp = 32*3; break;
+        case UNCOMPRESSED_R32G32B32A32: bpp = 32*4; break;
+        case COMPRESSED_DXT1_RGB:
+        case COMPRESSED_DXT1_RGBA:
+        case COMPRESSED_ETC1_RGB:
+        case COMPRESSED_ETC2_RGB:
+        case COMPRESSED_PVRT_RGB:
+        case COMPRESSED_PVRT_RGBA: bpp = 4; break;
+        case COMPRESSED_DXT3_RGBA:
+        case COMPRESSED_DXT5_RGBA:
+        case COMPRESSED_ETC2_EAC_RGBA:
+        case COMPRESSED_ASTC_4x4_RGBA: bpp = 8; break;
+        case COMPRESSED_ASTC_8x8_RGBA: bpp = 2; break;
+        default: break;
     }
 
-    int format = image->format;
-
-    UnloadImage(*image);
-
-    *image = LoadImageEx(output, newWidth, newHeight);
-    ImageFormat(image, format);  // Reformat 32bit RGBA image to original format
+    dataSize = width*height*bpp/8;  // Total data size in bytes
 
-    RL_FREE(output);
-    RL_FREE(pixels);
+    return dataSize;
 }
 
-// Resize canvas and fill with color
-// NOTE: Resize offset is relative to the top-left corner of the original image
-void ImageResizeCanvas(Image *image, int newWidth, int newHeight, int offsetX, int offsetY, Color color)
+// Get pixel data from GPU texture and return an Image
+// NOTE: Compressed texture formats not supported
+Image GetTextureData(Texture2D texture)
 {
-    // Security check to avoid program crash
-    if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
+    Image image = { 0 };
 
-    if ((newWidth != image->width) || (newHeight != image->height))
+    if (texture.format < 8)
     {
-        // Support offsets out of canvas new size -> original image is cropped
-        if (offsetX < 0)
-        {
-            ImageCrop(image, (Rectangle) { -offsetX, 0, image->width + offsetX, image->height });
-            offsetX = 0;
-        }
-        else if (offsetX > (newWidth - image->width))
-        {
-            ImageCrop(image, (Rectangle) { 0, 0, image->width - (offsetX - (newWidth - image->width)), image->height });
-            offsetX = newWidth - image->width;
-        }
+        EnsureTextureResident(texture.id);
+        image.data = rlReadTexturePixels(texture);
 
-        if (offsetY < 0)
-        {
-            ImageCrop(image, (Rectangle) { 0, -offsetY, image->width, image->height + offsetY });
-            offsetY = 0;
-        }
-        else if (offsetY > (newHeight - image->height))
+        if (image.data != NULL)
         {
-            ImageCrop(image, (Rectangle) { 0, 0, image->width, image->height - (offsetY - (newHeight - image->height)) });
-            offsetY = newHeight - image->height;
+            image.width = texture.width;
+            image.height = texture.height;
+            image.format = texture.format;
+            image.mipmaps = 1;
+
+#if defined(GRAPHICS_API_OPENGL_ES2)
+            // NOTE: Data retrieved on OpenGL ES 2.0 should be RGBA,
+            // coming from FBO color buffer attachment, but it seems
+            // original texture format is retrieved on RPI...
+            image.format = UNCOMPRESSED_R8G8B8A8;
+#endif
+            TraceLog(LOG_INFO, "Texture pixel data obtained successfully");
         }
+        else TraceLog(LOG_WARNING, "Texture pixel data could not be obtained");
+    }
+    else TraceLog(LOG_WARNING, "Compressed texture data could not be obtained");
 
-        if ((newWidth > image->width) && (newHeight > image->height))
-        {
-            Image imTemp = GenImageColor(newWidth, newHeight, color);
+    return image;
+}
 
-            Rectangle srcRec = { 0.0f, 0.0f, (float)image->width, (float)image->height };
-            Rectangle dstRec = { (float)offsetX, (float)offsetY, srcRec.width, srcRec.height };
+// Get pixel data from GPU texture into an existing Image, image data is reused if size and format match
+// NOTE: Avoids allocations when texture is read back every frame, image should be zero-initialized on first call
+bool GetTextureDataEx(Texture2D texture, Image *image)
+{
+    bool success = false;
 
-            ImageDraw(&imTemp, *image, srcRec, dstRec, WHITE);
-            ImageFormat(&imTemp, image->format);
-            UnloadImage(*image);
-            *image = imTemp;
-        }
-        else if ((newWidth < image->width) && (newHeight < image->height))
-        {
-            Rectangle crop = { (float)offsetX, (float)offsetY, (float)newWidth, (float)newHeight };
-            ImageCrop(image, crop);
-        }
-        else    // One side is bigger and the other is smaller
-        {
-            Image imTemp = GenImageColor(newWidth, newHeight, color);
+    if (image == NULL) return success;
 
-            Rectangle srcRec = { 0.0f, 0.0f, (float)image->width, (float)image->height };
-            Rectangle dstRec = { (float)offsetX, (float)offsetY, (float)image->width, (float)image->height };
+    if (texture.format < 8)
+    {
+#if defined(GRAPHICS_API_OPENGL_ES2)
+        // NOTE: Data retrieved on OpenGL ES 2.0 is RGBA (readback framebuffer color format)
+        int format = UNCOMPRESSED_R8G8B8A8;
+#else
+        int format = texture.format;
+#endif
+        if ((image->data == NULL) || (image->width != texture.width) || (image->height != texture.height) ||
+            (image->format != format) || (image->mipmaps != 1))
+        {
+            RL_FREE(image->data);
 
-            if (newWidth < image->width)
-            {
-                srcRec.x = offsetX;
-                srcRec.width = newWidth;
-                dstRec.x = 0.0f;
-            }
+            image->data = RL_MALLOC(GetPixelDataSize(texture.width, texture.height, format));
+            image->width = texture.width;
+            image->height = texture.height;
+            image->format = format;
+            image->mipmaps = 1;
+        }
 
-            if (newHeight < image->height)
-            {
-                srcRec.y = offsetY;
-                srcRec.height = newHeight;
-                dstRec.y = 0.0f;
-            }
+        EnsureTextureResident(texture.id);
+        success = rlReadTexturePixelsEx(texture, image->data);
 
-            ImageDraw(&imTemp, *image, srcRec, dstRec, WHITE);
-            ImageFormat(&imTemp, image->format);
-            UnloadImage(*image);
-            *image = imTemp;
-        }
+        if (!success) TraceLog(LOG_WARNING, "Texture pixel data could not be obtained");
     }
+    else TraceLog(LOG_WARNING, "Compressed texture data could not be obtained");
+
+    return success;
 }
 
-// Generate all mipmap levels for a provided image
-// NOTE 1: Supports POT and NPOT images
-// NOTE 2: image.data is scaled to include mipmap levels
-// NOTE 3: Mipmaps format is the same as base image
-void ImageMipmaps(Image *image)
+// Get pixel data from GPU frontbuffer and return an Image (screenshot)
+Image GetScreenData(void)
 {
-    // Security check to avoid program crash
-    if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
+    Image image = { 0 };
 
-    int mipCount = 1;                   // Required mipmap levels count (including base level)
-    int mipWidth = image->width;        // Base image width
-    int mipHeight = image->height;      // Base image height
-    int mipSize = GetPixelDataSize(mipWidth, mipHeight, image->format);  // Image data size (in bytes)
+    image.width = GetScreenWidth();
+    image.height = GetScreenHeight();
+    image.mipmaps = 1;
+    image.format = UNCOMPRESSED_R8G8B8A8;
+    image.data = rlReadScreenPixels(image.width, image.height);
 
-    // Count mipmap levels required
-    while ((mipWidth != 1) || (mipHeight != 1))
-    {
-        if (mipWidth != 1) mipWidth /= 2;
-        if (mipHeight != 1) mipHeight /= 2;
+    return image;
+}
 
-        // Security check for NPOT textures
-        if (mipWidth < 1) mipWidth = 1;
-        if (mipHeight < 1) mipHeight = 1;
+// Request render texture pixel data reading, GPU copy is not waited
+// NOTE: Returns 0 if not supported (OpenGL 3.3 required) or all readback buffers are in flight,
+// GetTextureData() should be used instead (synchronous, bottom-left origin)
+unsigned int RequestRenderTextureData(RenderTexture2D target)
+{
+    rlglDraw();     // Pending draws into render texture must be submitted before reading
 
-        TraceLog(LOG_DEBUG, "Next mipmap level: %i x %i - current size %i", mipWidth, mipHeight, mipSize);
+    return rlReadFramebufferPixelsAsync(target.id, target.texture.width, target.texture.height);
+}
 
-        mipCount++;
-        mipSize += GetPixelDataSize(mipWidth, mipHeight, image->format);       // Add mipmap size (in bytes)
-    }
+// Get requested render texture pixel data as an Image (RGBA, top-left origin as drawn)
+// NOTE: Returned image data is NULL if GPU copy is not done yet (unless wait), request is released once returned
+Image GetRenderTextureDataAsync(RenderTexture2D target, unsigned int requestId, bool wait)
+{
+    Image image = { 0 };
 
-    TraceLog(LOG_DEBUG, "Mipmaps available: %i - Mipmaps required: %i", image->mipmaps, mipCount);
-    TraceLog(LOG_DEBUG, "Mipmaps total size required: %i", mipSize);
-    TraceLog(LOG_DEBUG, "Image data memory start address: 0x%x", image->data);
+    image.data = rlGetScreenPixelsAsync(requestId, wait);
 
-    if (image->mipmaps < mipCount)
+    if (image.data != NULL)
     {
-        void *temp = RL_REALLOC(image->data, mipSize);
+        image.width = target.texture.width;
+        image.height = target.texture.height;
+        image.mipmaps = 1;
+        image.format = UNCOMPRESSED_R8G8B8A8;
+    }
 
-        if (temp != NULL)
-        {
-            image->data = temp;      // Assign new pointer (new size) to store mipmaps data
-            TraceLog(LOG_DEBUG, "Image data memory point reallocated: 0x%x", temp);
-        }
-        else TraceLog(LOG_WARNING, "Mipmaps required memory could not be allocated");
+    return image;
+}
 
-        // Pointer to allocated memory point where store next mipmap level data
-        unsigned char *nextmip = (unsigned char *)image->data + GetPixelDataSize(image->width, image->height, image->format);
+// Update GPU texture with new data
+// NOTE: pixels data must match texture.format
+void UpdateTexture(Texture2D texture, const void *pixels)
+{
+    ReleaseTextureSource(texture.id);
+    rlUpdateTexture(texture.id, texture.width, texture.height, texture.format, pixels);
+}
 
-        mipWidth = image->width/2;
-        mipHeight = image->height/2;
-        mipSize = GetPixelDataSize(mipWidth, mipHeight, image->format);
-        Image imCopy = ImageCopy(*image);
+// Update GPU texture with new data, without waiting for GPU copy
+// NOTE: pixels data is copied into a pixel buffer, it can be reused or freed on return
+void UpdateTextureAsync(Texture2D texture, const void *pixels)
+{
+    ReleaseTextureSource(texture.id);
+    rlUpdateTextureAsync(texture.id, texture.width, texture.height, texture.format, pixels);
+}
 
-        for (int i = 1; i < mipCount; i++)
-        {
-            TraceLog(LOG_DEBUG, "Gen mipmap level: %i (%i x %i) - size: %i - offset: 0x%x", i, mipWidth, mipHeight, mipSize, nextmip);
+// Check if texture asynchronous updates are completed
+bool IsTextureUpdated(Texture2D texture)
+{
+    return rlIsTextureUpdated(texture.id);
+}
 
-            ImageResize(&imCopy, mipWidth, mipHeight);  // Uses internally Mitchell cubic downscale filter
+// Set textures VRAM budget in bytes (0: no budget)
+// NOTE: Over budget, least recently used textures loaded from file (LoadTexture()) are evicted on EndDrawing(),
+// evicted textures keep their id and are reloaded from file transparently when used for drawing
+void SetTextureMemoryBudget(unsigned int bytes)
+{
+    textureMemoryBudget = bytes;
 
-            memcpy(nextmip, imCopy.data, mipSize);
-            nextmip += mipSize;
-            image->mipmaps++;
+    rlSetTextureUseCallback((bytes > 0)? TextureUsed : NULL);
+}
 
-            mipWidth /= 2;
-            mipHeight /= 2;
+// Get VRAM used by textures loaded (resident data, mipmaps included)
+// NOTE: Only textures loaded with LoadTexture() or LoadTextureFromImage() are tracked
+unsigned int GetTextureMemoryUsage(void)
+{
+    return (textureMemoryUsed > 0xffffffff)? 0xffffffff : (unsigned int)textureMemoryUsed;
+}
 
-            // Security check for NPOT textures
-            if (mipWidth < 1) mipWidth = 1;
-            if (mipHeight < 1) mipHeight = 1;
+// Check if texture data is in VRAM (not evicted by VRAM budget)
+bool IsTextureResident(Texture2D texture)
+{
+    TextureResidency *entry = GetTextureResidency(texture.id);
 
-            mipSize = GetPixelDataSize(mipWidth, mipHeight, image->format);
-        }
+    return (entry != NULL)? entry->resident : (texture.id > 0);
+}
 
-        UnloadImage(imCopy);
-    }
-    else TraceLog(LOG_WARNING, "Image mipmaps already available");
+// Set bytes uploaded per frame by progressive textures (0: no limit)
+// NOTE: Budget is checked by rows uploaded, GPU compressed mipmap levels are uploaded as a whole,
+// at least one row or level is uploaded every frame so loading always progresses
+void SetTextureUploadBudget(unsigned int bytes)
+{
+    textureUploadBudget = bytes;
 }
 
-// Dither image data to 16bpp or lower (Floyd-Steinberg dithering)
-// NOTE: In case selected bpp do not represent an known 16bit format,
-// dithered data is stored in the LSB part of the unsigned short
-void ImageDither(Image *image, int rBpp, int gBpp, int bBpp, int aBpp)
+// Check if texture all mipmap levels are uploaded (LoadTextureProgressive())
+bool IsTextureComplete(Texture2D texture)
 {
-    // Security check to avoid program crash
-    if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
+    for (int i = 0; i < textureUploadsCount; i++) if (textureUploads[i].id == texture.id) return false;
 
-    if (image->format >= COMPRESSED_DXT1_RGB)
-    {
-        TraceLog(LOG_WARNING, "Compressed data formats can not be dithered");
-        return;
-    }
+    return (texture.id > 0);
+}
 
-    if ((rBpp + gBpp + bBpp + aBpp) > 16)
-    {
-        TraceLog(LOG_WARNING, "Unsupported dithering bpps (%ibpp), only 16bpp or lower modes supported", (rBpp+gBpp+bBpp+aBpp));
-    }
-    else
-    {
-        Color *pixels = GetImageData(*image);
+// Upload progressive textures mipmap levels within per-frame budget, textures uploaded in load order
+void UpdateTexturesProgressive(void)
+{
+    int budget = ((textureUploadBudget == 0) || (textureUploadBudget > 0x7fffffff))? 0x7fffffff : (int)textureUploadBudget;
+    bool force = true;
 
-        RL_FREE(image->data);      // free old image data
+    while (textureUploadsCount > 0)
+    {
+        TextureUpload *upload = &textureUploads[0];
 
-        if ((image->format != UNCOMPRESSED_R8G8B8) && (image->format != UNCOMPRESSED_R8G8B8A8))
+        while (upload->level > 0)
         {
-            TraceLog(LOG_WARNING, "Image format is already 16bpp or lower, dithering could have no effect");
-        }
+            int bytes = UploadTextureLevel(upload, budget, force);
+            if (bytes == 0) break;
 
-        // Define new image format, check if desired bpp match internal known format
-        if ((rBpp == 5) && (gBpp == 6) && (bBpp == 5) && (aBpp == 0)) image->format = UNCOMPRESSED_R5G6B5;
-        else if ((rBpp == 5) && (gBpp == 5) && (bBpp == 5) && (aBpp == 1)) image->format = UNCOMPRESSED_R5G5B5A1;
-        else if ((rBpp == 4) && (gBpp == 4) && (bBpp == 4) && (aBpp == 4)) image->format = UNCOMPRESSED_R4G4B4A4;
-        else
-        {
-            image->format = 0;
-            TraceLog(LOG_WARNING, "Unsupported dithered OpenGL internal format: %ibpp (R%iG%iB%iA%i)", (rBpp+gBpp+bBpp+aBpp), rBpp, gBpp, bBpp, aBpp);
+            budget -= bytes;
+            force = false;
         }
 
-        // NOTE: We will store the dithered data as unsigned short (16bpp)
-        image->data = (unsigned short *)RL_MALLOC(image->width*image->height*sizeof(unsigned short));
+        if (upload->level > 0) break;   // Budget exhausted
 
-        Color oldPixel = WHITE;
-        Color newPixel = WHITE;
+        FinishTextureUpload(0, true);
+    }
+}
 
-        int rError, gError, bError;
-        unsigned short rPixel, gPixel, bPixel, aPixel;   // Used for 16bit pixel composition
+// Evict least recently used textures while VRAM budget is exceeded
+// NOTE: Textures used on current frame are never evicted, frames counter advances on every call
+void UpdateTextureResidency(void)
+{
+    while ((textureMemoryBudget > 0) && (textureMemoryUsed > textureMemoryBudget))
+    {
+        TextureResidency *oldest = NULL;
 
-        #define MIN(a,b) (((a)<(b))?(a):(b))
+        for (int i = 0; i < residencyCount; i++)
+        {
+            TextureResidency *entry = &residencyTextures[i];
 
-        for (int y = 0; y < image->height; y++)
-        {
-            for (int x = 0; x < image->width; x++)
-            {
-                oldPixel = pixels[y*image->width + x];
+            if (!entry->resident || (entry->fileName == NULL) || (entry->lastUse >= residencyFrame)) continue;
+            if ((oldest == NULL) || (entry->lastUse < oldest->lastUse)) oldest = entry;
+        }
 
-                // NOTE: New pixel obtained by bits truncate, it would be better to round values (check ImageFormat())
-                newPixel.r = oldPixel.r >> (8 - rBpp);     // R bits
-                newPixel.g = oldPixel.g >> (8 - gBpp);     // G bits
-                newPixel.b = oldPixel.b >> (8 - bBpp);     // B bits
-                newPixel.a = oldPixel.a >> (8 - aBpp);     // A bits (not used on dithering)
+        if (oldest == NULL) break;      // No texture can be evicted
 
-                // NOTE: Error must be computed between new and old pixel but using same number of bits!
-                // We want to know how much color precision we have lost...
-                rError = (int)oldPixel.r - (int)(newPixel.r << (8 - rBpp));
-                gError = (int)oldPixel.g - (int)(newPixel.g << (8 - gBpp));
-                bError = (int)oldPixel.b - (int)(newPixel.b << (8 - bBpp));
+        rlReleaseTextureStorage(oldest->id, oldest->mipmaps);
 
-                pixels[y*image->width + x] = newPixel;
+        oldest->resident = false;
+        textureMemoryUsed -= oldest->size;
 
-                // NOTE: Some cases are out of the array and should be ignored
-                if (x < (image->width - 1))
-                {
-                    pixels[y*image->width + x+1].r = MIN((int)pixels[y*image->width + x+1].r + (int)((float)rError*7.0f/16), 0xff);
-                    pixels[y*image->width + x+1].g = MIN((int)pixels[y*image->width + x+1].g + (int)((float)gError*7.0f/16), 0xff);
-                    pixels[y*image->width + x+1].b = MIN((int)pixels[y*image->width + x+1].b + (int)((float)bError*7.0f/16), 0xff);
-                }
+        TraceLog(LOG_INFO, "[TEX ID %i] Texture data evicted from VRAM (%i KB)", oldest->id, oldest->size/1024);
+    }
 
-                if ((x > 0) && (y < (image->height - 1)))
-                {
-                    pixels[(y+1)*image->width + x-1].r = MIN((int)pixels[(y+1)*image->width + x-1].r + (int)((float)rError*3.0f/16), 0xff);
-                    pixels[(y+1)*image->width + x-1].g = MIN((int)pixels[(y+1)*image->width + x-1].g + (int)((float)gError*3.0f/16), 0xff);
-                    pixels[(y+1)*image->width + x-1].b = MIN((int)pixels[(y+1)*image->width + x-1].b + (int)((float)bError*3.0f/16), 0xff);
-                }
+    residencyFrame++;
+}
 
-                if (y < (image->height - 1))
-                {
-                    pixels[(y+1)*image->width + x].r = MIN((int)pixels[(y+1)*image->width + x].r + (int)((float)rError*5.0f/16), 0xff);
-                    pixels[(y+1)*image->width + x].g = MIN((int)pixels[(y+1)*image->width + x].g + (int)((float)gError*5.0f/16), 0xff);
-                    pixels[(y+1)*image->width + x].b = MIN((int)pixels[(y+1)*image->width + x].b + (int)((float)bError*5.0f/16), 0xff);
-                }
+// Export image data to file
+// NOTE: File format depends on fileName extension
+void ExportImage(Image image, const char *fileName)
+{
+    int success = 0;
 
-                if ((x < (image->width - 1)) && (y < (image->height - 1)))
-                {
-                    pixels[(y+1)*image->width + x+1].r = MIN((int)pixels[(y+1)*image->width + x+1].r + (int)((float)rError*1.0f/16), 0xff);
-                    pixels[(y+1)*image->width + x+1].g = MIN((int)pixels[(y+1)*image->width + x+1].g + (int)((float)gError*1.0f/16), 0xff);
-                    pixels[(y+1)*image->width + x+1].b = MIN((int)pixels[(y+1)*image->width + x+1].b + (int)((float)bError*1.0f/16), 0xff);
-                }
+#if defined(SUPPORT_IMAGE_EXPORT)
+    // NOTE: Getting Color array as RGBA unsigned char values, temporary copy on scratch memory
+    unsigned char *imgData = (unsigned char *)PushScratchMemory(image.width*image.height*sizeof(Color));
+    ReadImagePixels(image, (Color *)imgData);
 
-                rPixel = (unsigned short)newPixel.r;
-                gPixel = (unsigned short)newPixel.g;
-                bPixel = (unsigned short)newPixel.b;
-                aPixel = (unsigned short)newPixel.a;
+#if defined(SUPPORT_FILEFORMAT_PNG)
+    if (IsFileExtension(fileName, ".png")) success = SavePNG(fileName, imgData, image.width, image.height, 4);
+#else
+    if (false) {}
+#endif
+#if defined(SUPPORT_FILEFORMAT_BMP)
+    else if (IsFileExtension(fileName, ".bmp")) success = stbi_write_bmp(fileName, image.width, image.height, 4, imgData);
+#endif
+#if defined(SUPPORT_FILEFORMAT_TGA)
+    else if (IsFileExtension(fileName, ".tga")) success = stbi_write_tga(fileName, image.width, image.height, 4, imgData);
+#endif
+#if defined(SUPPORT_FILEFORMAT_JPG)
+    else if (IsFileExtension(fileName, ".jpg")) success = stbi_write_jpg(fileName, image.width, image.height, 4, imgData, 80);  // JPG quality: between 1 and 100
+#endif
+#if defined(SUPPORT_FILEFORMAT_KTX)
+    else if (IsFileExtension(fileName, ".ktx")) success = SaveKTX(image, fileName);
+#endif
+    else if (IsFileExtension(fileName, ".raw"))
+    {
+        // Export raw pixel data (without header)
+        // NOTE: It's up to the user to track image parameters
+        FILE *rawFile = fopen(fileName, "wb");
+        success = fwrite(image.data, GetPixelDataSize(image.width, image.height, image.format), 1, rawFile);
+        fclose(rawFile);
+    }
 
-                ((unsigned short *)image->data)[y*image->width + x] = (rPixel << (gBpp + bBpp + aBpp)) | (gPixel << (bBpp + aBpp)) | (bPixel << aBpp) | aPixel;
-            }
-        }
+    PopScratchMemory(imgData);
+#endif
 
-        RL_FREE(pixels);
-    }
+    if (success != 0) TraceLog(LOG_INFO, "Image exported successfully: %s", fileName);
+    else TraceLog(LOG_WARNING, "Image could not be exported.");
 }
 
-// Extract color palette from image to maximum size
-// NOTE: Memory allocated should be freed manually!
-Color *ImageExtractPalette(Image image, int maxPaletteSize, int *extractCount)
+// Set fast PNG export, used by ExportImage() and screenshots
+// NOTE: Fast encoder uses a single filter and greedy compression, files are lossless but bigger
+void SetImageExportFast(bool fast)
 {
-    #define COLOR_EQUAL(col1, col2) ((col1.r == col2.r)&&(col1.g == col2.g)&&(col1.b == col2.b)&&(col1.a == col2.a))
+    imageExportFast = fast;
+}
 
-    Color *pixels = GetImageData(image);
-    Color *palette = (Color *)RL_MALLOC(maxPaletteSize*sizeof(Color));
+#if defined(SUPPORT_IMAGE_EXPORT) && defined(SUPPORT_FILEFORMAT_PNG)
+// Save PNG file (8 bit per channel, 1 to 4 channels)
+// NOTE: No shared text buffers used, screenshots are saved with it on worker threads
+int SavePNG(const char *fileName, const unsigned char *data, int width, int height, int channels)
+{
+    if (imageExportFast) return SavePNGFast(fileName, data, width, height, channels);
+    else return stbi_write_png(fileName, width, height, channels, data, width*channels);
+}
+#endif
 
-    int palCount = 0;
-    for (int i = 0; i < maxPaletteSize; i++) palette[i] = BLANK;   // Set all colors to BLANK
+// Export image as code file (.h) defining an array of bytes
+void ExportImageAsCode(Image image, const char *fileName)
+{
+    #define BYTES_TEXT_PER_LINE     20
 
-    for (int i = 0; i < image.width*image.height; i++)
-    {
-        if (pixels[i].a > 0)
-        {
-            bool colorInPalette = false;
+    FILE *txtFile = fopen(fileName, "wt");
 
-            // Check if the color is already on palette
-            for (int j = 0; j < maxPaletteSize; j++)
-            {
-                if (COLOR_EQUAL(pixels[i], palette[j]))
-                {
-                    colorInPalette = true;
-                    break;
-                }
-            }
+    if (txtFile != NULL)
+    {
+        char varFileName[256] = { 0 };
+        int dataSize = GetPixelDataSize(image.width, image.height, image.format);
 
-            // Store color if not on the palette
-            if (!colorInPalette)
-            {
-                palette[palCount] = pixels[i];      // Add pixels[i] to palette
-                palCount++;
+        fprintf(txtFile, "////////////////////////////////////////////////////////////////////////////////////////\n");
+        fprintf(txtFile, "//                                                                                    //\n");
+        fprintf(txtFile, "// ImageAsCode exporter v1.0 - Image pixel data exported as an array of bytes         //\n");
+        fprintf(txtFile, "//                                                                                    //\n");
+        fprintf(txtFile, "// more info and bugs-report:  github.com/raysan5/raylib                              //\n");
+        fprintf(txtFile, "// feedback and support:       ray[at]raylib.com                                      //\n");
+        fprintf(txtFile, "//                                                                                    //\n");
+        fprintf(txtFile, "// Copyright (c) 2020 Ramon Santamaria (@raysan5)                                     //\n");
+        fprintf(txtFile, "//                                                                                    //\n");
+        fprintf(txtFile, "////////////////////////////////////////////////////////////////////////////////////////\n\n");
 
-                // We reached the limit of colors supported by palette
-                if (palCount >= maxPaletteSize)
-                {
-                    i = image.width*image.height;   // Finish palette get
-                    TraceLog(LOG_WARNING, "Image palette is greater than %i colors!", maxPaletteSize);
-                }
-            }
-        }
-    }
+        // Get file name from path and convert variable name to uppercase
+        strcpy(varFileName, GetFileNameWithoutExt(fileName));
+        for (int i = 0; varFileName[i] != '\0'; i++) if ((varFileName[i] >= 'a') && (varFileName[i] <= 'z')) { varFileName[i] = varFileName[i] - 32; }
 
-    RL_FREE(pixels);
+        // Add image information
+        fprintf(txtFile, "// Image data information\n");
+        fprintf(txtFile, "#define %s_WIDTH    %i\n", varFileName, image.width);
+        fprintf(txtFile, "#define %s_HEIGHT   %i\n", varFileName, image.height);
+        fprintf(txtFile, "#define %s_FORMAT   %i          // raylib internal pixel format\n\n", varFileName, image.format);
 
-    *extractCount = palCount;
+        fprintf(txtFile, "static unsigned char %s_DATA[%i] = { ", varFileName, dataSize);
+        for (int i = 0; i < dataSize - 1; i++) fprintf(txtFile, ((i%BYTES_TEXT_PER_LINE == 0)? "0x%x,\n" : "0x%x, "), ((unsigned char *)image.data)[i]);
+        fprintf(txtFile, "0x%x };\n", ((unsigned char *)image.data)[dataSize - 1]);
 
-    return palette;
+        fclose(txtFile);
+    }
 }
 
-// Draw an image (source) within an image (destination)
-// NOTE: Color tint is applied to source image
-void ImageDraw(Image *dst, Image src, Rectangle srcRec, Rectangle dstRec, Color tint)
+// Copy an image to a new image
+Image ImageCopy(Image image)
 {
-    // Security check to avoid program crash
-    if ((dst->data == NULL) || (dst->width == 0) || (dst->height == 0) ||
-        (src.data == NULL) || (src.width == 0) || (src.height == 0)) return;
+    Image newImage = { 0 };
 
-    // Security checks to avoid size and rectangle issues (out of bounds)
-    // Check that srcRec is inside src image
-    if (srcRec.x < 0) srcRec.x = 0;
-    if (srcRec.y < 0) srcRec.y = 0;
+    int width = image.width;
+    int height = image.height;
+    int size = 0;
 
-    if ((srcRec.x + srcRec.width) > src.width)
+    for (int i = 0; i < image.mipmaps; i++)
     {
-        srcRec.width = src.width - srcRec.x;
-        TraceLog(LOG_WARNING, "Source rectangle width out of bounds, rescaled width: %i", srcRec.width);
-    }
+        size += GetPixelDataSize(width, height, image.format);
 
-    if ((srcRec.y + srcRec.height) > src.height)
-    {
-        srcRec.height = src.height - srcRec.y;
-        TraceLog(LOG_WARNING, "Source rectangle height out of bounds, rescaled height: %i", srcRec.height);
-    }
+        width /= 2;
+        height /= 2;
 
-    Image srcCopy = ImageCopy(src);     // Make a copy of source image to work with it
+        // Security check for NPOT textures
+        if (width < 1) width = 1;
+        if (height < 1) height = 1;
+    }
 
-    // Crop source image to desired source rectangle (if required)
-    if ((src.width != (int)srcRec.width) && (src.height != (int)srcRec.height)) ImageCrop(&srcCopy, srcRec);
+    newImage.data = RL_MALLOC(size);
 
-    // Scale source image in case destination rec size is different than source rec size
-    if (((int)dstRec.width != (int)srcRec.width) || ((int)dstRec.height != (int)srcRec.height))
+    if (newImage.data != NULL)
     {
-        ImageResize(&srcCopy, (int)dstRec.width, (int)dstRec.height);
-    }
+        // NOTE: Size must be provided in bytes
+        memcpy(newImage.data, image.data, size);
 
-    // Check that dstRec is inside dst image
-    // Allow negative position within destination with cropping
-    if (dstRec.x < 0)
-    {
-        ImageCrop(&srcCopy, (Rectangle) { -dstRec.x, 0, dstRec.width + dstRec.x, dstRec.height });
-        dstRec.width = dstRec.width + dstRec.x;
-        dstRec.x = 0;
+        newImage.width = image.width;
+        newImage.height = image.height;
+        newImage.mipmaps = image.mipmaps;
+        newImage.format = image.format;
     }
 
-    if ((dstRec.x + dstRec.width) > dst->width)
-    {
-        ImageCrop(&srcCopy, (Rectangle) { 0, 0, dst->width - dstRec.x, dstRec.height });
-        dstRec.width = dst->width - dstRec.x;
-    }
+    return newImage;
+}
 
-    if (dstRec.y < 0)
-    {
-        ImageCrop(&srcCopy, (Rectangle) { 0, -dstRec.y, dstRec.width, dstRec.height + dstRec.y });
-        dstRec.height = dstRec.height + dstRec.y;
-        dstRec.y = 0;
-    }
+// Create an image from another image piece
+Image ImageFromImage(Image image, Rectangle rec)
+{
+    Image result = ImageCopy(image);
 
-    if ((dstRec.y + dstRec.height) > dst->height)
-    {
-        ImageCrop(&srcCopy, (Rectangle) { 0, 0, dstRec.width, dst->height - dstRec.y });
-        dstRec.height = dst->height - dstRec.y;
-    }
+#if defined(SUPPORT_IMAGE_MANIPULATION)
+    ImageCrop(&result, rec);
+#endif
 
-    // Get image data as Color pixels array to work with it
-    Color *dstPixels = GetImageData(*dst);
-    Color *srcPixels = GetImageData(srcCopy);
+    return result;
+}
 
-    UnloadImage(srcCopy);       // Source copy not required any more
+// Convert image to POT (power-of-two)
+// NOTE: It could be useful on OpenGL ES 2.0 (RPI, HTML5)
+void ImageToPOT(Image *image, Color fillColor)
+{
+    // Security check to avoid program crash
+    if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
 
-    Vector4 fsrc, fdst, fout;   // Normalized pixel data (ready for operation)
-    Vector4 ftint = ColorNormalize(tint);   // Normalized color tint
+    Color *pixels = GetImageData(*image);   // Get pixels data
 
-    // Blit pixels, copy source image into destination
-    // TODO: Maybe out-of-bounds blitting could be considered here instead of so much cropping
-    for (int j = (int)dstRec.y; j < (int)(dstRec.y + dstRec.height); j++)
+    // Calculate next power-of-two values
+    // NOTE: Just add the required amount of pixels at the right and bottom sides of image...
+    int potWidth = (int)powf(2, ceilf(logf((float)image->width)/logf(2)));
+    int potHeight = (int)powf(2, ceilf(logf((float)image->height)/logf(2)));
+
+    // Check if POT texture generation is required (if texture is not already POT)
+    if ((potWidth != image->width) || (potHeight != image->height))
     {
-        for (int i = (int)dstRec.x; i < (int)(dstRec.x + dstRec.width); i++)
+        Color *pixelsPOT = NULL;
+
+        // Generate POT array from NPOT data
+        pixelsPOT = (Color *)RL_MALLOC(potWidth*potHeight*sizeof(Color));
+
+        for (int j = 0; j < potHeight; j++)
         {
-            // Alpha blending (https://en.wikipedia.org/wiki/Alpha_compositing)
+            for (int i = 0; i < potWidth; i++)
+            {
+                if ((j < image->height) && (i < image->width)) pixelsPOT[j*potWidth + i] = pixels[j*image->width + i];
+                else pixelsPOT[j*potWidth + i] = fillColor;
+            }
+        }
 
-            fdst = ColorNormalize(dstPixels[j*(int)dst->width + i]);
-            fsrc = ColorNormalize(srcPixels[(j - (int)dstRec.y)*(int)dstRec.width + (i - (int)dstRec.x)]);
+        TraceLog(LOG_WARNING, "Image converted to POT: (%ix%i) -> (%ix%i)", image->width, image->height, potWidth, potHeight);
 
-            // Apply color tint to source image
-            fsrc.x *= ftint.x; fsrc.y *= ftint.y; fsrc.z *= ftint.z; fsrc.w *= ftint.w;
+        RL_FREE(pixels);                       // Free pixels data
+        RL_FREE(image->data);                  // Free old image data
 
-            fout.w = fsrc.w + fdst.w*(1.0f - fsrc.w);
+        int format = image->format;         // Store image data format to reconvert later
 
-            if (fout.w <= 0.0f)
-            {
-                fout.x = 0.0f;
-                fout.y = 0.0f;
-                fout.z = 0.0f;
-            }
-            else
-            {
-                fout.x = (fsrc.x*fsrc.w + fdst.x*fdst.w*(1 - fsrc.w))/fout.w;
-                fout.y = (fsrc.y*fsrc.w + fdst.y*fdst.w*(1 - fsrc.w))/fout.w;
-                fout.z = (fsrc.z*fsrc.w + fdst.z*fdst.w*(1 - fsrc.w))/fout.w;
-            }
+        // NOTE: Image size changes, new width and height
+        *image = LoadImageEx(pixelsPOT, potWidth, potHeight);
 
-            dstPixels[j*(int)dst->width + i] = (Color){ (unsigned char)(fout.x*255.0f),
-                                                        (unsigned char)(fout.y*255.0f),
-                                                        (unsigned char)(fout.z*255.0f),
-                                                        (unsigned char)(fout.w*255.0f) };
+        RL_FREE(pixelsPOT);                    // Free POT pixels data
 
-            // TODO: Support other blending options
-        }
+        ImageFormat(image, format);  // Reconvert image to previous format
     }
-
-    UnloadImage(*dst);
-
-    *dst = LoadImageEx(dstPixels, (int)dst->width, (int)dst->height);
-    ImageFormat(dst, dst->format);
-
-    RL_FREE(srcPixels);
-    RL_FREE(dstPixels);
-}
-
-// Create an image from text (default font)
-Image ImageText(const char *text, int fontSize, Color color)
-{
-    int defaultFontSize = 10;   // Default Font chars height in pixel
-    if (fontSize < defaultFontSize) fontSize = defaultFontSize;
-    int spacing = fontSize / defaultFontSize;
-
-    Image imText = ImageTextEx(GetFontDefault(), text, (float)fontSize, (float)spacing, color);
-
-    return imText;
 }
 
-// Create an image from text (custom sprite font)
-Image ImageTextEx(Font font, const char *text, float fontSize, float spacing, Color tint)
+// Convert image data to desired format
+void ImageFormat(Image *image, int newFormat)
 {
-    int length = strlen(text);
-
-    int index;                  // Index position in sprite font
-    int letter = 0;             // Current character
-    int positionX = 0;          // Image drawing position
+    // Security check to avoid program crash
+    if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
 
-    // NOTE: Text image is generated at font base size, later scaled to desired font size
-    Vector2 imSize = MeasureTextEx(font, text, (float)font.baseSize, spacing);
+    if ((newFormat != 0) && (image->format != newFormat))
+    {
+        int srcChannels = GetPixelChannels(image->format);
 
-    // Create image to store text
-    Image imText = GenImageColor((int)imSize.x, (int)imSize.y, BLANK);
+        if ((srcChannels > 0) && (newFormat <= UNCOMPRESSED_R8G8B8A8))
+        {
+            // Direct conversion from 8 bit per channel formats, no float normalization required
+            // NOTE: Conversion is split in rows bands on worker threads for big images
+            ImageConvertData convert = { 0 };
+            convert.src = (const unsigned char *)image->data;
+            convert.srcChannels = srcChannels;
+            convert.dst = RL_MALLOC(GetPixelDataSize(image->width, image->height, newFormat));
+            convert.dstFormat = newFormat;
+            convert.width = image->width;
 
-    for (int i = 0; i < length; i++)
-    {
-        int next = 0;
-        letter = GetNextCodepoint(&text[i], &next);
-        index = GetGlyphIndex(font, letter);
+            ProcessImageBands(ConvertPixelRows, &convert, image->width, image->height);
 
-        if (letter == 0x3f) next = 1;
-        i += (next - 1);
+            RL_FREE(image->data);      // WARNING! We loose mipmaps data --> Regenerated at the end...
+            image->data = convert.dst;
+            image->format = newFormat;
 
-        if (letter == '\n')
-        {
-            // TODO: Support line break
-        }
-        else
-        {
-            if (letter != ' ')
+            // In case original image had mipmaps, generate mipmaps for formated image
+            if (image->mipmaps > 1)
             {
-                ImageDraw(&imText, font.chars[index].image, (Rectangle){ 0, 0, font.chars[index].image.width, font.chars[index].image.height },
-                         (Rectangle){ (float)(positionX + font.chars[index].offsetX),(float)font.chars[index].offsetY,
-                                      font.chars[index].image.width, font.chars[index].image.height }, tint);
+                image->mipmaps = 1;
+            #if defined(SUPPORT_IMAGE_MANIPULATION)
+                ImageMipmaps(image);
+            #endif
             }
-
-            if (font.chars[index].advanceX == 0) positionX += (int)(font.recs[index].width + spacing);
-            else positionX += font.chars[index].advanceX + (int)spacing;
         }
-    }
+        else if ((image->format < COMPRESSED_DXT1_RGB) && (newFormat < COMPRESSED_DXT1_RGB))
+        {
+            Vector4 *pixels = GetImageDataNormalized(*image);     // Supports 8 to 32 bit per channel
 
-    // Scale image depending on text size
-    if (fontSize > imSize.y)
-    {
-        float scaleFactor = fontSize/imSize.y;
-        TraceLog(LOG_INFO, "Image text scaled by factor: %f", scaleFactor);
+            RL_FREE(image->data);      // WARNING! We loose mipmaps data --> Regenerated at the end...
+            image->data = NULL;
+            image->format = newFormat;
 
-        // Using nearest-neighbor scaling algorithm for default font
-        if (font.texture.id == GetFontDefault().texture.id) ImageResizeNN(&imText, (int)(imSize.x*scaleFactor), (int)(imSize.y*scaleFactor));
-        else ImageResize(&imText, (int)(imSize.x*scaleFactor), (int)(imSize.y*scaleFactor));
-    }
+            int k = 0;
 
-    return imText;
-}
+            switch (image->format)
+            {
+                case UNCOMPRESSED_GRAYSCALE:
+                {
+                    image->data = (unsigned char *)RL_MALLOC(image->width*image->height*sizeof(unsigned char));
 
-// Draw rectangle within an image
-void ImageDrawRectangle(Image *dst, Rectangle rec, Color color)
-{
-    // Security check to avoid program crash
-    if ((dst->data == NULL) || (dst->width == 0) || (dst->height == 0)) return;
+                    for (int i = 0; i < image->width*image->height; i++)
+                    {
+                        ((unsigned char *)image->data)[i] = (unsigned char)((pixels[i].x*0.299f + pixels[i].y*0.587f + pixels[i].z*0.114f)*255.0f);
+                    }
 
-    Image imRec = GenImageColor((int)rec.width, (int)rec.height, color);
-    ImageDraw(dst, imRec, (Rectangle){ 0, 0, rec.width, rec.height }, rec, WHITE);
-    UnloadImage(imRec);
-}
+                } break;
+                case UNCOMPRESSED_GRAY_ALPHA:
+                {
+                    image->data = (unsigned char *)RL_MALLOC(image->width*image->height*2*sizeof(unsigned char));
 
-// Draw rectangle lines within an image
-void ImageDrawRectangleLines(Image *dst, Rectangle rec, int thick, Color color)
-{
-    ImageDrawRectangle(dst, (Rectangle){ rec.x, rec.y, rec.width, thick }, color);
-    ImageDrawRectangle(dst, (Rectangle){ rec.x, rec.y + thick, thick, rec.height - thick*2 }, color);
-    ImageDrawRectangle(dst, (Rectangle){ rec.x + rec.width - thick, rec.y + thick, thick, rec.height - thick*2 }, color);
-    ImageDrawRectangle(dst, (Rectangle){ rec.x, rec.y + rec.height - thick, rec.width, thick }, color);
-}
+                    for (int i = 0; i < image->width*image->height*2; i += 2, k++)
+                    {
+                        ((unsigned char *)image->data)[i] = (unsigned char)((pixels[k].x*0.299f + (float)pixels[k].y*0.587f + (float)pixels[k].z*0.114f)*255.0f);
+                        ((unsigned char *)image->data)[i + 1] = (unsigned char)(pixels[k].w*255.0f);
+                    }
 
-// Draw text (default font) within an image (destination)
-void ImageDrawText(Image *dst, Vector2 position, const char *text, int fontSize, Color color)
-{
-    // NOTE: For default font, sapcing is set to desired font size / default font size (10)
-    ImageDrawTextEx(dst, position, GetFontDefault(), text, (float)fontSize, (float)fontSize/10, color);
-}
+                } break;
+                case UNCOMPRESSED_R5G6B5:
+                {
+                    image->data = (unsigned short *)RL_MALLOC(image->width*image->height*sizeof(unsigned short));
 
-// Draw text (custom sprite font) within an image (destination)
-void ImageDrawTextEx(Image *dst, Vector2 position, Font font, const char *text, float fontSize, float spacing, Color color)
-{
-    Image imText = ImageTextEx(font, text, fontSize, spacing, color);
+                    unsigned char r = 0;
+                    unsigned char g = 0;
+                    unsigned char b = 0;
 
-    Rectangle srcRec = { 0.0f, 0.0f, (float)imText.width, (float)imText.height };
-    Rectangle dstRec = { position.x, position.y, (float)imText.width, (float)imText.height };
+                    for (int i = 0; i < image->width*image->height; i++)
+                    {
+                        r = (unsigned char)(round(pixels[i].x*31.0f));
+                        g = (unsigned char)(round(pixels[i].y*63.0f));
+                        b = (unsigned char)(round(pixels[i].z*31.0f));
 
-    ImageDraw(dst, imText, srcRec, dstRec, WHITE);
+                        ((unsigned short *)image->data)[i] = (unsigned short)r << 11 | (unsigned short)g << 5 | (unsigned short)b;
+                    }
 
-    UnloadImage(imText);
-}
+                } break;
+                case UNCOMPRESSED_R8G8B8:
+                {
+                    image->data = (unsigned char *)RL_MALLOC(image->width*image->height*3*sizeof(unsigned char));
 
-// Flip image vertically
-void ImageFlipVertical(Image *image)
-{
-    // Security check to avoid program crash
-    if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
+                    for (int i = 0, k = 0; i < image->width*image->height*3; i += 3, k++)
+                    {
+                        ((unsigned char *)image->data)[i] = (unsigned char)(pixels[k].x*255.0f);
+                        ((unsigned char *)image->data)[i + 1] = (unsigned char)(pixels[k].y*255.0f);
+                        ((unsigned char *)image->data)[i + 2] = (unsigned char)(pixels[k].z*255.0f);
+                    }
+                } break;
+                case UNCOMPRESSED_R5G5B5A1:
+                {
+                    #define ALPHA_THRESHOLD  50
 
-    Color *srcPixels = GetImageData(*image);
-    Color *dstPixels = (Color *)RL_MALLOC(image->width*image->height*sizeof(Color));
+                    image->data = (unsigned short *)RL_MALLOC(image->width*image->height*sizeof(unsigned short));
 
-    for (int y = 0; y < image->height; y++)
-    {
-        for (int x = 0; x < image->width; x++)
-        {
-            dstPixels[y*image->width + x] = srcPixels[(image->height - 1 - y)*image->width + x];
-        }
-    }
+                    unsigned char r = 0;
+                    unsigned char g = 0;
+                    unsigned char b = 0;
+                    unsigned char a = 0;
 
-    Image processed = LoadImageEx(dstPixels, image->width, image->height);
-    ImageFormat(&processed, image->format);
-    UnloadImage(*image);
+                    for (int i = 0; i < image->width*image->height; i++)
+                    {
+                        r = (unsigned char)(round(pixels[i].x*31.0f));
+                        g = (unsigned char)(round(pixels[i].y*31.0f));
+                        b = (unsigned char)(round(pixels[i].z*31.0f));
+                        a = (pixels[i].w > ((float)ALPHA_THRESHOLD/255.0f))? 1 : 0;
 
-    RL_FREE(srcPixels);
-    RL_FREE(dstPixels);
+                        ((unsigned short *)image->data)[i] = (unsigned short)r << 11 | (unsigned short)g << 6 | (unsigned short)b << 1 | (unsigned short)a;
+                    }
 
-    image->data = processed.data;
-}
+                } break;
+                case UNCOMPRESSED_R4G4B4A4:
+                {
+                    image->data = (unsigned short *)RL_MALLOC(image->width*image->height*sizeof(unsigned short));
 
-// Flip image horizontally
-void ImageFlipHorizontal(Image *image)
-{
-    // Security check to avoid program crash
-    if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
+                    unsigned char r = 0;
+                    unsigned char g = 0;
+                    unsigned char b = 0;
+                    unsigned char a = 0;
 
-    Color *srcPixels = GetImageData(*image);
-    Color *dstPixels = (Color *)RL_MALLOC(image->width*image->height*sizeof(Color));
+                    for (int i = 0; i < image->width*image->height; i++)
+                    {
+                        r = (unsigned char)(round(pixels[i].x*15.0f));
+                        g = (unsigned char)(round(pixels[i].y*15.0f));
+                        b = (unsigned char)(round(pixels[i].z*15.0f));
+                        a = (unsigned char)(round(pixels[i].w*15.0f));
 
-    for (int y = 0; y < image->height; y++)
-    {
-        for (int x = 0; x < image->width; x++)
-        {
-            dstPixels[y*image->width + x] = srcPixels[y*image->width + (image->width - 1 - x)];
-        }
-    }
+                        ((unsigned short *)image->data)[i] = (unsigned short)r << 12 | (unsigned short)g << 8 | (unsigned short)b << 4 | (unsigned short)a;
+                    }
 
-    Image processed = LoadImageEx(dstPixels, image->width, image->height);
-    ImageFormat(&processed, image->format);
-    UnloadImage(*image);
+                } break;
+                case UNCOMPRESSED_R8G8B8A8:
+                {
+                    image->data = (unsigned char *)RL_MALLOC(image->width*image->height*4*sizeof(unsigned char));
 
-    RL_FREE(srcPixels);
-    RL_FREE(dstPixels);
+                    for (int i = 0, k = 0; i < image->width*image->height*4; i += 4, k++)
+                    {
+                        ((unsigned char *)image->data)[i] = (unsigned char)(pixels[k].x*255.0f);
+                        ((unsigned char *)image->data)[i + 1] = (unsigned char)(pixels[k].y*255.0f);
+                        ((unsigned char *)image->data)[i + 2] = (unsigned char)(pixels[k].z*255.0f);
+                        ((unsigned char *)image->data)[i + 3] = (unsigned char)(pixels[k].w*255.0f);
+                    }
+                } break;
+                case UNCOMPRESSED_R32:
+                {
+                    // WARNING: Image is converted to GRAYSCALE eqeuivalent 32bit
 
-    image->data = processed.data;
-}
+                    image->data = (float *)RL_MALLOC(image->width*image->height*sizeof(float));
 
-// Rotate image clockwise 90deg
-void ImageRotateCW(Image *image)
-{
-    // Security check to avoid program crash
-    if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
-
-    Color *srcPixels = GetImageData(*image);
-    Color *rotPixels = (Color *)RL_MALLOC(image->width*image->height*sizeof(Color));
+                    for (int i = 0; i < image->width*image->height; i++)
+                    {
+                        ((float *)image->data)[i] = (float)(pixels[i].x*0.299f + pixels[i].y*0.587f + pixels[i].z*0.114f);
+                    }
+                } break;
+                case UNCOMPRESSED_R32G32B32:
+                {
+                    image->data = (float *)RL_MALLOC(image->width*image->height*3*sizeof(float));
 
-    for (int y = 0; y < image->height; y++)
-    {
-        for (int x = 0; x < image->width; x++)
-        {
-            rotPixels[x*image->height + (image->height - y - 1)] = srcPixels[y*image->width + x];
-        }
-    }
+                    for (int i = 0, k = 0; i < image->width*image->height*3; i += 3, k++)
+                    {
+                        ((float *)image->data)[i] = pixels[k].x;
+                        ((float *)image->data)[i + 1] = pixels[k].y;
+                        ((float *)image->data)[i + 2] = pixels[k].z;
+                    }
+                } break;
+                case UNCOMPRESSED_R32G32B32A32:
+                {
+                    image->data = (float *)RL_MALLOC(image->width*image->height*4*sizeof(float));
 
-    Image processed = LoadImageEx(rotPixels, image->height, image->width);
-    ImageFormat(&processed, image->format);
-    UnloadImage(*image);
+                    for (int i = 0, k = 0; i < image->width*image->height*4; i += 4, k++)
+                    {
+                        ((float *)image->data)[i] = pixels[k].x;
+                        ((float *)image->data)[i + 1] = pixels[k].y;
+                        ((float *)image->data)[i + 2] = pixels[k].z;
+                        ((float *)image->data)[i + 3] = pixels[k].w;
+                    }
+                } break;
+                default: break;
+            }
 
-    RL_FREE(srcPixels);
-    RL_FREE(rotPixels);
+            RL_FREE(pixels);
+            pixels = NULL;
 
-    image->data = processed.data;
-    image->width = processed.width;
-    image->height = processed.height;
+            // In case original image had mipmaps, generate mipmaps for formated image
+            // NOTE: Original mipmaps are replaced by new ones, if custom mipmaps were used, they are lost
+            if (image->mipmaps > 1)
+            {
+                image->mipmaps = 1;
+            #if defined(SUPPORT_IMAGE_MANIPULATION)
+                if (image->data != NULL) ImageMipmaps(image);
+            #endif
+            }
+        }
+        else TraceLog(LOG_WARNING, "Image data format is compressed, can not be converted");
+    }
 }
 
-// Rotate image counter-clockwise 90deg
-void ImageRotateCCW(Image *image)
+// Apply alpha mask to image
+// NOTE 1: Returned image is GRAY_ALPHA (16bit) or RGBA (32bit)
+// NOTE 2: alphaMask should be same size as image
+void ImageAlphaMask(Image *image, Image alphaMask)
 {
-    // Security check to avoid program crash
-    if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
+    if ((image->width != alphaMask.width) || (image->height != alphaMask.height))
+    {
+        TraceLog(LOG_WARNING, "Alpha mask must be same size as image");
+    }
+    else if (image->format >= COMPRESSED_DXT1_RGB)
+    {
+        TraceLog(LOG_WARNING, "Alpha mask can not be applied to compressed data formats");
+    }
+    else
+    {
+        // Force mask to be Grayscale
+        // NOTE: Grayscale masks (with or without alpha) are read directly, no copy required
+        Image mask = alphaMask;
+        int maskStride = 1;
 
-    Color *srcPixels = GetImageData(*image);
-    Color *rotPixels = (Color *)RL_MALLOC(image->width*image->height*sizeof(Color));
+        if (alphaMask.format == UNCOMPRESSED_GRAY_ALPHA) maskStride = 2;
+        else if (alphaMask.format != UNCOMPRESSED_GRAYSCALE)
+        {
+            mask = ImageCopy(alphaMask);
+            ImageFormat(&mask, UNCOMPRESSED_GRAYSCALE);
+        }
 
-    for (int y = 0; y < image->height; y++)
-    {
-        for (int x = 0; x < image->width; x++)
+        // In case image is only grayscale, we just add alpha channel
+        if (image->format == UNCOMPRESSED_GRAYSCALE)
         {
-            rotPixels[x*image->height + y] = srcPixels[y*image->width + (image->width - x - 1)];
+            unsigned char *data = (unsigned char *)RL_MALLOC(image->width*image->height*2);
+
+            // Apply alpha mask to alpha channel
+            for (int i = 0, k = 0; (i < mask.width*mask.height) || (i < image->width*image->height); i++, k += 2)
+            {
+                data[k] = ((unsigned char *)image->data)[i];
+                data[k + 1] = ((unsigned char *)mask.data)[i*maskStride];
+            }
+
+            RL_FREE(image->data);
+            image->data = data;
+            image->format = UNCOMPRESSED_GRAY_ALPHA;
+            image->mipmaps = 1;
         }
-    }
+        else
+        {
+            // Convert image to a format with alpha channel (grayscale + alpha is kept)
+            if ((image->format != UNCOMPRESSED_GRAY_ALPHA) && (image->format != UNCOMPRESSED_R8G8B8A8)) ImageFormat(image, UNCOMPRESSED_R8G8B8A8);
 
-    Image processed = LoadImageEx(rotPixels, image->height, image->width);
-    ImageFormat(&processed, image->format);
-    UnloadImage(*image);
+            int channels = GetPixelChannels(image->format);
 
-    RL_FREE(srcPixels);
-    RL_FREE(rotPixels);
+            // Apply alpha mask to alpha channel (last channel)
+            for (int i = 0, k = channels - 1; (i < mask.width*mask.height) || (i < image->width*image->height); i++, k += channels)
+            {
+                ((unsigned char *)image->data)[k] = ((unsigned char *)mask.data)[i*maskStride];
+            }
+        }
 
-    image->data = processed.data;
-    image->width = processed.width;
-    image->height = processed.height;
+        if (mask.data != alphaMask.data) UnloadImage(mask);
+    }
 }
 
-// Modify image color: tint
-void ImageColorTint(Image *image, Color color)
+// Clear alpha channel to desired color
+// NOTE: Threshold defines the alpha limit, 0.0f to 1.0f
+void ImageAlphaClear(Image *image, Color color, float threshold)
 {
     // Security check to avoid program crash
     if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
 
-    Color *pixels = GetImageData(*image);
-
-    float cR = (float)color.r/255;
-    float cG = (float)color.g/255;
-    float cB = (float)color.b/255;
-    float cA = (float)color.a/255;
+    int channels = GetPixelChannels(image->format);
 
-    for (int y = 0; y < image->height; y++)
+    // Process 8 bit per channel formats in place
+    if (channels > 0)
     {
-        for (int x = 0; x < image->width; x++)
-        {
-            int index = y * image->width + x;
-            unsigned char r = 255*((float)pixels[index].r/255*cR);
-            unsigned char g = 255*((float)pixels[index].g/255*cG);
-            unsigned char b = 255*((float)pixels[index].b/255*cB);
-            unsigned char a = 255*((float)pixels[index].a/255*cA);
+        unsigned char *data = (unsigned char *)image->data;
+        unsigned char limit = (unsigned char)(threshold*255.0f);
+        unsigned char gray = (unsigned char)((color.r*299 + color.g*587 + color.b*114)/1000);
+        const unsigned char replace[4] = { color.r, color.g, color.b, color.a };
 
-            pixels[y*image->width + x].r = r;
-            pixels[y*image->width + x].g = g;
-            pixels[y*image->width + x].b = b;
-            pixels[y*image->width + x].a = a;
-        }
-    }
+        for (int i = 0; i < image->width*image->height; i++, data += channels)
+        {
+            // NOTE: Formats without alpha channel are opaque (alpha = 255)
+            unsigned char alpha = ((channels == 2) || (channels == 4))? data[channels - 1] : 255;
+            if (alpha > limit) continue;
 
-    Image processed = LoadImageEx(pixels, image->width, image->height);
-    ImageFormat(&processed, image->format);
-    UnloadImage(*image);
-    RL_FREE(pixels);
+            if (channels <= 2) data[0] = gray;
+            else memcpy(data, replace, 3);
 
-    image->data = processed.data;
-}
+            if ((channels == 2) || (channels == 4)) data[channels - 1] = color.a;
+        }
 
-// Modify image color: invert
-void ImageColorInvert(Image *image)
-{
-    // Security check to avoid program crash
-    if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
+        return;
+    }
 
     Color *pixels = GetImageData(*image);
 
-    for (int y = 0; y < image->height; y++)
-    {
-        for (int x = 0; x < image->width; x++)
-        {
-            pixels[y*image->width + x].r = 255 - pixels[y*image->width + x].r;
-            pixels[y*image->width + x].g = 255 - pixels[y*image->width + x].g;
-            pixels[y*image->width + x].b = 255 - pixels[y*image->width + x].b;
-        }
-    }
+    for (int i = 0; i < image->width*image->height; i++) if (pixels[i].a <= (unsigned char)(threshold*255.0f)) pixels[i] = color;
 
-    Image processed = LoadImageEx(pixels, image->width, image->height);
-    ImageFormat(&processed, image->format);
     UnloadImage(*image);
-    RL_FREE(pixels);
 
-    image->data = processed.data;
-}
+    int prevFormat = image->format;
+    *image = LoadImageEx(pixels, image->width, image->height);
 
-// Modify image color: grayscale
-void ImageColorGrayscale(Image *image)
-{
-    ImageFormat(image, UNCOMPRESSED_GRAYSCALE);
+    ImageFormat(image, prevFormat);
 }
 
-// Modify image color: contrast
-// NOTE: Contrast values between -100 and 100
-void ImageColorContrast(Image *image, float contrast)
+// Premultiply alpha channel
+void ImageAlphaPremultiply(Image *image)
 {
     // Security check to avoid program crash
     if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
 
-    if (contrast < -100) contrast = -100;
-    if (contrast > 100) contrast = 100;
+    // Process formats with 8 bit alpha channel in place, formats without alpha are not modified
+    int channels = GetPixelChannels(image->format);
 
-    contrast = (100.0f + contrast)/100.0f;
-    contrast *= contrast;
+    if (channels > 0)
+    {
+        if ((channels == 1) || (channels == 3)) return;
 
-    Color *pixels = GetImageData(*image);
+        unsigned char *data = (unsigned char *)image->data;
 
-    for (int y = 0; y < image->height; y++)
-    {
-        for (int x = 0; x < image->width; x++)
+        for (int i = 0; i < image->width*image->height; i++, data += channels)
         {
-            float pR = (float)pixels[y*image->width + x].r/255.0f;
-            pR -= 0.5;
-            pR *= contrast;
-            pR += 0.5;
-            pR *= 255;
-            if (pR < 0) pR = 0;
-            if (pR > 255) pR = 255;
+            float alpha = (float)data[channels - 1]/255.0f;
+            for (int c = 0; c < channels - 1; c++) data[c] = (unsigned char)((float)data[c]*alpha);
+        }
 
-            float pG = (float)pixels[y*image->width + x].g/255.0f;
-            pG -= 0.5;
-            pG *= contrast;
-            pG += 0.5;
-            pG *= 255;
-            if (pG < 0) pG = 0;
-            if (pG > 255) pG = 255;
+        return;
+    }
 
-            float pB = (float)pixels[y*image->width + x].b/255.0f;
-            pB -= 0.5;
-            pB *= contrast;
-            pB += 0.5;
-            pB *= 255;
-            if (pB < 0) pB = 0;
-            if (pB > 255) pB = 255;
+    float alpha = 0.0f;
+    Color *pixels = GetImageData(*image);
 
-            pixels[y*image->width + x].r = (unsigned char)pR;
-            pixels[y*image->width + x].g = (unsigned char)pG;
-            pixels[y*image->width + x].b = (unsigned char)pB;
-        }
+    for (int i = 0; i < image->width*image->height; i++)
+    {
+        alpha = (float)pixels[i].a/255.0f;
+        pixels[i].r = (unsigned char)((float)pixels[i].r*alpha);
+        pixels[i].g = (unsigned char)((float)pixels[i].g*alpha);
+        pixels[i].b = (unsigned char)((float)pixels[i].b*alpha);
     }
 
-    Image processed = LoadImageEx(pixels, image->width, image->height);
-    ImageFormat(&processed, image->format);
     UnloadImage(*image);
-    RL_FREE(pixels);
 
-    image->data = processed.data;
+    int prevFormat = image->format;
+    *image = LoadImageEx(pixels, image->width, image->height);
+
+    ImageFormat(image, prevFormat);
 }
 
-// Modify image color: brightness
-// NOTE: Brightness values between -255 and 255
-void ImageColorBrightness(Image *image, int brightness)
+#if defined(SUPPORT_IMAGE_MANIPULATION)
+// Load cubemap from image, multiple image cubemap layouts supported
+TextureCubemap LoadTextureCubemap(Image image, int layoutType)
 {
-    // Security check to avoid program crash
-    if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
-
-    if (brightness < -255) brightness = -255;
-    if (brightness > 255) brightness = 255;
-
-    Color *pixels = GetImageData(*image);
+    TextureCubemap cubemap = { 0 };
 
-    for (int y = 0; y < image->height; y++)
+    if (layoutType == CUBEMAP_AUTO_DETECT)      // Try to automatically guess layout type
     {
-        for (int x = 0; x < image->width; x++)
+        // Check image width/height to determine the type of cubemap provided
+        if (image.width > image.height)
         {
-            int cR = pixels[y*image->width + x].r + brightness;
-            int cG = pixels[y*image->width + x].g + brightness;
-            int cB = pixels[y*image->width + x].b + brightness;
+            if ((image.width/6) == image.height) { layoutType = CUBEMAP_LINE_HORIZONTAL; cubemap.width = image.width/6; }
+            else if ((image.width/4) == (image.height/3)) { layoutType = CUBEMAP_CROSS_FOUR_BY_THREE; cubemap.width = image.width/4; }
+            else if (image.width >= (int)((float)image.height*1.85f)) { layoutType = CUBEMAP_PANORAMA; cubemap.width = image.width/4; }
+        }
+        else if (image.height > image.width)
+        {
+            if ((image.height/6) == image.width) { layoutType = CUBEMAP_LINE_VERTICAL; cubemap.width = image.height/6; }
+            else if ((image.width/3) == (image.height/4)) { layoutType = CUBEMAP_CROSS_THREE_BY_FOUR; cubemap.width = image.width/3; }
+        }
 
-            if (cR < 0) cR = 1;
-            if (cR > 255) cR = 255;
+        cubemap.height = cubemap.width;
+    }
 
-            if (cG < 0) cG = 1;
-            if (cG > 255) cG = 255;
+    if (layoutType != CUBEMAP_AUTO_DETECT)
+    {
+        int size = cubemap.width;
 
-            if (cB < 0) cB = 1;
-            if (cB > 255) cB = 255;
+        Image faces = { 0 };                // Vertical column image
+        Rectangle faceRecs[6] = { 0 };      // Face source rectangles
+        for (int i = 0; i < 6; i++) faceRecs[i] = (Rectangle){ 0, 0, size, size };
 
-            pixels[y*image->width + x].r = (unsigned char)cR;
-            pixels[y*image->width + x].g = (unsigned char)cG;
-            pixels[y*image->width + x].b = (unsigned char)cB;
+        if (layoutType == CUBEMAP_LINE_VERTICAL)
+        {
+            faces = image;
+            for (int i = 0; i < 6; i++) faceRecs[i].y = size*i;
         }
-    }
-
-    Image processed = LoadImageEx(pixels, image->width, image->height);
-    ImageFormat(&processed, image->format);
-    UnloadImage(*image);
-    RL_FREE(pixels);
-
-    image->data = processed.data;
-}
-
-// Modify image color: replace color
-void ImageColorReplace(Image *image, Color color, Color replace)
-{
-    // Security check to avoid program crash
-    if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
-
-    Color *pixels = GetImageData(*image);
-
-    for (int y = 0; y < image->height; y++)
-    {
-        for (int x = 0; x < image->width; x++)
+        else if (layoutType == CUBEMAP_PANORAMA)
         {
-            if ((pixels[y*image->width + x].r == color.r) &&
-                (pixels[y*image->width + x].g == color.g) &&
-                (pixels[y*image->width + x].b == color.b) &&
-                (pixels[y*image->width + x].a == color.a))
+            // TODO: Convert panorama image to square faces...
+            // Ref: https://github.com/denivip/panorama/blob/master/panorama.cpp
+        }
+        else
+        {
+            if (layoutType == CUBEMAP_LINE_HORIZONTAL) for (int i = 0; i < 6; i++) faceRecs[i].x = size*i;
+            else if (layoutType == CUBEMAP_CROSS_THREE_BY_FOUR)
             {
-                pixels[y*image->width + x].r = replace.r;
-                pixels[y*image->width + x].g = replace.g;
-                pixels[y*image->width + x].b = replace.b;
-                pixels[y*image->width + x].a = replace.a;
+                faceRecs[0].x = size; faceRecs[0].y = size;
+                faceRecs[1].x = size; faceRecs[1].y = 3*size;
+                faceRecs[2].x = size; faceRecs[2].y = 0;
+                faceRecs[3].x = size; faceRecs[3].y = 2*size;
+                faceRecs[4].x = 0; faceRecs[4].y = size;
+                faceRecs[5].x = 2*size; faceRecs[5].y = size;
+            }
+            else if (layoutType == CUBEMAP_CROSS_FOUR_BY_THREE)
+            {
+                faceRecs[0].x = 2*size; faceRecs[0].y = size;
+                faceRecs[1].x = 0; faceRecs[1].y = size;
+                faceRecs[2].x = size; faceRecs[2].y = 0;
+                faceRecs[3].x = size; faceRecs[3].y = 2*size;
+                faceRecs[4].x = size; faceRecs[4].y = size;
+                faceRecs[5].x = 3*size; faceRecs[5].y = size;
             }
-        }
-    }
-
-    Image processed = LoadImageEx(pixels, image->width, image->height);
-    ImageFormat(&processed, image->format);
-    UnloadImage(*image);
-    RL_FREE(pixels);
 
-    image->data = processed.data;
-}
-#endif      // SUPPORT_IMAGE_MANIPULATION
+            // Convert image data to 6 faces in a vertical column, that's the optimum layout for loading
+            faces = GenImageColor(size, size*6, MAGENTA);
+            ImageFormat(&faces, image.format);
 
-// Generate image: plain color
-Image GenImageColor(int width, int height, Color color)
-{
-    Color *pixels = (Color *)RL_CALLOC(width*height, sizeof(Color));
+            // TODO: Image formating does not work with compressed textures!
+        }
 
-    for (int i = 0; i < width*height; i++) pixels[i] = color;
+        for (int i = 0; i < 6; i++) ImageDraw(&faces, image, faceRecs[i], (Rectangle){ 0, size*i, size, size }, WHITE);
 
-    Image image = LoadImageEx(pixels, width, height);
+        cubemap.id = rlLoadTextureCubemap(faces.data, size, faces.format);
+        if (cubemap.id == 0) TraceLog(LOG_WARNING, "Cubemap image could not be loaded.");
 
-    RL_FREE(pixels);
+        UnloadImage(faces);
+    }
+    else TraceLog(LOG_WARNING, "Cubemap image layout can not be detected.");
 
-    return image;
+    return cubemap;
 }
 
-#if defined(SUPPORT_IMAGE_GENERATION)
-// Generate image: vertical gradient
-Image GenImageGradientV(int width, int height, Color top, Color bottom)
+// Load texture array from images (layers), all images must be same size and format
+// NOTE: Only base mipmap level of every image is used, layer is selected on DrawTextureLayer()
+Texture2D LoadTextureArray(Image *layers, int count)
 {
-    Color *pixels = (Color *)RL_MALLOC(width*height*sizeof(Color));
+    Texture2D texture = { 0 };
 
-    for (int j = 0; j < height; j++)
+    if ((layers == NULL) || (count <= 0) || (layers[0].data == NULL))
     {
-        float factor = (float)j/(float)height;
-        for (int i = 0; i < width; i++)
+        TraceLog(LOG_WARNING, "Texture array could not be loaded from Images");
+        return texture;
+    }
+
+    for (int i = 1; i < count; i++)
+    {
+        if ((layers[i].data == NULL) || (layers[i].width != layers[0].width) ||
+            (layers[i].height != layers[0].height) || (layers[i].format != layers[0].format))
         {
-            pixels[j*width + i].r = (int)((float)bottom.r*factor + (float)top.r*(1.f - factor));
-            pixels[j*width + i].g = (int)((float)bottom.g*factor + (float)top.g*(1.f - factor));
-            pixels[j*width + i].b = (int)((float)bottom.b*factor + (float)top.b*(1.f - factor));
-            pixels[j*width + i].a = (int)((float)bottom.a*factor + (float)top.a*(1.f - factor));
+            TraceLog(LOG_WARNING, "Texture array layer %i does not match first layer size and format", i);
+            return texture;
         }
     }
 
-    Image image = LoadImageEx(pixels, width, height);
-    RL_FREE(pixels);
+    // Pack layers base level data consecutively
+    int layerSize = GetPixelDataSize(layers[0].width, layers[0].height, layers[0].format);
+    unsigned char *data = (unsigned char *)RL_MALLOC(layerSize*count);
 
-    return image;
-}
+    for (int i = 0; i < count; i++) memcpy(data + i*layerSize, layers[i].data, layerSize);
 
-// Generate image: horizontal gradient
-Image GenImageGradientH(int width, int height, Color left, Color right)
-{
-    Color *pixels = (Color *)RL_MALLOC(width*height*sizeof(Color));
+    texture.id = rlLoadTextureArray(data, layers[0].width, layers[0].height, count, layers[0].format);
 
-    for (int i = 0; i < width; i++)
+    RL_FREE(data);
+
+    if (texture.id > 0)
     {
-        float factor = (float)i/(float)width;
-        for (int j = 0; j < height; j++)
-        {
-            pixels[j*width + i].r = (int)((float)right.r*factor + (float)left.r*(1.f - factor));
-            pixels[j*width + i].g = (int)((float)right.g*factor + (float)left.g*(1.f - factor));
-            pixels[j*width + i].b = (int)((float)right.b*factor + (float)left.b*(1.f - factor));
-            pixels[j*width + i].a = (int)((float)right.a*factor + (float)left.a*(1.f - factor));
-        }
+        texture.width = layers[0].width;
+        texture.height = layers[0].height;
+        texture.mipmaps = 1;
+        texture.format = layers[0].format;
     }
 
-    Image image = LoadImageEx(pixels, width, height);
-    RL_FREE(pixels);
-
-    return image;
+    return texture;
 }
 
-// Generate image: radial gradient
-Image GenImageGradientRadial(int width, int height, float density, Color inner, Color outer)
+// Crop an image to area defined by a rectangle
+// NOTE: Security checks are performed in case rectangle goes out of bounds
+void ImageCrop(Image *image, Rectangle crop)
 {
-    Color *pixels = (Color *)RL_MALLOC(width*height*sizeof(Color));
-    float radius = (width < height)? (float)width/2.0f : (float)height/2.0f;
+    // Security check to avoid program crash
+    if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
 
-    float centerX = (float)width/2.0f;
-    float centerY = (float)height/2.0f;
+    // Security checks to validate crop rectangle
+    if (crop.x < 0) { crop.width += crop.x; crop.x = 0; }
+    if (crop.y < 0) { crop.height += crop.y; crop.y = 0; }
+    if ((crop.x + crop.width) > image->width) crop.width = image->width - crop.x;
+    if ((crop.y + crop.height) > image->height) crop.height = image->height - crop.y;
 
-    for (int y = 0; y < height; y++)
+    if ((crop.x < image->width) && (crop.y < image->height))
     {
-        for (int x = 0; x < width; x++)
+        // Start the cropping process
+        Color *pixels = GetImageData(*image);   // Get data as Color pixels array
+        Color *cropPixels = (Color *)RL_MALLOC((int)crop.width*(int)crop.height*sizeof(Color));
+
+        for (int j = (int)crop.y; j < (int)(crop.y + crop.height); j++)
         {
-            float dist = hypotf((float)x - centerX, (float)y - centerY);
-            float factor = (dist - radius*density)/(radius*(1.0f - density));
+            for (int i = (int)crop.x; i < (int)(crop.x + crop.width); i++)
+            {
+                cropPixels[(j - (int)crop.y)*(int)crop.width + (i - (int)crop.x)] = pixels[j*image->width + i];
+            }
+        }
 
-            factor = (float)fmax(factor, 0.f);
-            factor = (float)fmin(factor, 1.f); // dist can be bigger than radius so we have to check
+        RL_FREE(pixels);
 
-            pixels[y*width + x].r = (int)((float)outer.r*factor + (float)inner.r*(1.0f - factor));
-            pixels[y*width + x].g = (int)((float)outer.g*factor + (float)inner.g*(1.0f - factor));
-            pixels[y*width + x].b = (int)((float)outer.b*factor + (float)inner.b*(1.0f - factor));
-            pixels[y*width + x].a = (int)((float)outer.a*factor + (float)inner.a*(1.0f - factor));
-        }
-    }
+        int format = image->format;
 
-    Image image = LoadImageEx(pixels, width, height);
-    RL_FREE(pixels);
+        UnloadImage(*image);
 
-    return image;
+        *image = LoadImageEx(cropPixels, (int)crop.width, (int)crop.height);
+
+        RL_FREE(cropPixels);
+
+        // Reformat 32bit RGBA image to original format
+        ImageFormat(image, format);
+    }
+    else TraceLog(LOG_WARNING, "Image can not be cropped, crop rectangle out of bounds");
 }
 
-// Generate image: checked
-Image GenImageChecked(int width, int height, int checksX, int checksY, Color col1, Color col2)
+// Crop image depending on alpha value
+void ImageAlphaCrop(Image *image, float threshold)
 {
-    Color *pixels = (Color *)RL_MALLOC(width*height*sizeof(Color));
+    // Security check to avoid program crash
+    if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
 
-    for (int y = 0; y < height; y++)
+    Color *pixels = GetImageData(*image);
+
+    int xMin = 65536;   // Define a big enough number
+    int xMax = 0;
+    int yMin = 65536;
+    int yMax = 0;
+
+    for (int y = 0; y < image->height; y++)
     {
-        for (int x = 0; x < width; x++)
+        for (int x = 0; x < image->width; x++)
         {
-            if ((x/checksX + y/checksY)%2 == 0) pixels[y*width + x] = col1;
-            else pixels[y*width + x] = col2;
+            if (pixels[y*image->width + x].a > (unsigned char)(threshold*255.0f))
+            {
+                if (x < xMin) xMin = x;
+                if (x > xMax) xMax = x;
+                if (y < yMin) yMin = y;
+                if (y > yMax) yMax = y;
+            }
         }
     }
 
-    Image image = LoadImageEx(pixels, width, height);
+    Rectangle crop = { xMin, yMin, (xMax + 1) - xMin, (yMax + 1) - yMin };
+
     RL_FREE(pixels);
 
-    return image;
+    // Check for not empty image brefore cropping
+    if (!((xMax < xMin) || (yMax < yMin))) ImageCrop(image, crop);
 }
 
-// Generate image: white noise
-Image GenImageWhiteNoise(int width, int height, float factor)
+// Resize and image to new size
+// NOTE: Uses stb default scaling filters (both bicubic):
+// STBIR_DEFAULT_FILTER_UPSAMPLE    STBIR_FILTER_CATMULLROM
+// STBIR_DEFAULT_FILTER_DOWNSAMPLE  STBIR_FILTER_MITCHELL   (high-quality Catmull-Rom)
+// NOTE: 8 bit per channel formats are resized directly, output rows split in bands on worker threads for big images
+void ImageResize(Image *image, int newWidth, int newHeight)
 {
-    Color *pixels = (Color *)RL_MALLOC(width*height*sizeof(Color));
+    // Security check to avoid program crash
+    if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
 
-    for (int i = 0; i < width*height; i++)
+    int channels = GetPixelChannels(image->format);
+
+    if (channels > 0)
     {
-        if (GetRandomValue(0, 99) < (int)(factor*100.0f)) pixels[i] = WHITE;
-        else pixels[i] = BLACK;
-    }
+        ImageResizeData resize = { 0 };
+        resize.src = (const unsigned char *)image->data;
+        resize.srcWidth = image->width;
+        resize.srcHeight = image->height;
+        resize.dst = (unsigned char *)RL_MALLOC(newWidth*newHeight*channels*sizeof(unsigned char));
+        resize.dstWidth = newWidth;
+        resize.dstHeight = newHeight;
+        resize.channels = channels;
+
+        ProcessImageBands(ResizePixelRows, &resize, newWidth, newHeight);
+
+        RL_FREE(image->data);
+        image->data = resize.dst;
+        image->width = newWidth;
+        image->height = newHeight;
+        image->mipmaps = 1;
 
-    Image image = LoadImageEx(pixels, width, height);
-    RL_FREE(pixels);
+        return;
+    }
 
-    return image;
-}
+    // Get data as Color pixels array to work with it
+    Color *pixels = GetImageData(*image);
+    Color *output = (Color *)RL_MALLOC(newWidth*newHeight*sizeof(Color));
 
-// Generate image: perlin noise
-Image GenImagePerlinNoise(int width, int height, int offsetX, int offsetY, float scale)
-{
-    Color *pixels = (Color *)RL_MALLOC(width*height*sizeof(Color));
+    // NOTE: Color data is casted to (unsigned char *), there shouldn't been any problem...
+    stbir_resize_uint8((unsigned char *)pixels, image->width, image->height, 0, (unsigned char *)output, newWidth, newHeight, 0, 4);
 
-    for (int y = 0; y < height; y++)
-    {
-        for (int x = 0; x < width; x++)
-        {
-            float nx = (float)(x + offsetX)*scale/(float)width;
-            float ny = (float)(y + offsetY)*scale/(float)height;
+    int format = image->format;
 
-            // Typical values to start playing with:
-            //   lacunarity = ~2.0   -- spacing between successive octaves (use exactly 2.0 for wrapping output)
-            //   gain       =  0.5   -- relative weighting applied to each successive octave
-            //   octaves    =  6     -- number of "octaves" of noise3() to sum
+    UnloadImage(*image);
 
-            // NOTE: We need to translate the data from [-1..1] to [0..1]
-            float p = (stb_perlin_fbm_noise3(nx, ny, 1.0f, 2.0f, 0.5f, 6) + 1.0f)/2.0f;
+    *image = LoadImageEx(output, newWidth, newHeight);
+    ImageFormat(image, format);  // Reformat 32bit RGBA image to original format
 
-            int intensity = (int)(p*255.0f);
-            pixels[y*width + x] = (Color){intensity, intensity, intensity, 255};
-        }
-    }
-
-    Image image = LoadImageEx(pixels, width, height);
+    RL_FREE(output);
     RL_FREE(pixels);
-
-    return image;
 }
 
-// Generate image: cellular algorithm. Bigger tileSize means bigger cells
-Image GenImageCellular(int width, int height, int tileSize)
+// Resize and image to new size using Nearest-Neighbor scaling algorithm
+void ImageResizeNN(Image *image,int newWidth,int newHeight)
 {
-    Color *pixels = (Color *)RL_MALLOC(width*height*sizeof(Color));
+    // Security check to avoid program crash
+    if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
 
-    int seedsPerRow = width/tileSize;
-    int seedsPerCol = height/tileSize;
-    int seedsCount = seedsPerRow * seedsPerCol;
+    Color *pixels = GetImageData(*image);
+    Color *output = (Color *)RL_MALLOC(newWidth*newHeight*sizeof(Color));
 
-    Vector2 *seeds = (Vector2 *)RL_MALLOC(seedsCount*sizeof(Vector2));
+    // EDIT: added +1 to account for an early rounding problem
+    int xRatio = (int)((image->width << 16)/newWidth) + 1;
+    int yRatio = (int)((image->height << 16)/newHeight) + 1;
 
-    for (int i = 0; i < seedsCount; i++)
+    int x2, y2;
+    for (int y = 0; y < newHeight; y++)
     {
-        int y = (i/seedsPerRow)*tileSize + GetRandomValue(0, tileSize - 1);
-        int x = (i%seedsPerRow)*tileSize + GetRandomValue(0, tileSize - 1);
-        seeds[i] = (Vector2){ (float)x, (float)y};
+        for (int x = 0; x < newWidth; x++)
+        {
+            x2 = ((x*xRatio) >> 16);
+            y2 = ((y*yRatio) >> 16);
+
+            output[(y*newWidth) + x] = pixels[(y2*image->width) + x2] ;
+        }
     }
 
-    for (int y = 0; y < height; y++)
+    int format = image->format;
+
+    UnloadImage(*image);
+
+    *image = LoadImageEx(output, newWidth, newHeight);
+    ImageFormat(image, format);  // Reformat 32bit RGBA image to original format
+
+    RL_FREE(output);
+    RL_FREE(pixels);
+}
+
+// Resize canvas and fill with color
+// NOTE: Resize offset is relative to the top-left corner of the original image
+void ImageResizeCanvas(Image *image, int newWidth, int newHeight, int offsetX, int offsetY, Color color)
+{
+    // Security check to avoid program crash
+    if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
+
+    if ((newWidth != image->width) || (newHeight != image->height))
     {
-        int tileY = y/tileSize;
+        // Support offsets out of canvas new size -> original image is cropped
+        if (offsetX < 0)
+        {
+            ImageCrop(image, (Rectangle) { -offsetX, 0, image->width + offsetX, image->height });
+            offsetX = 0;
+        }
+        else if (offsetX > (newWidth - image->width))
+        {
+            ImageCrop(image, (Rectangle) { 0, 0, image->width - (offsetX - (newWidth - image->width)), image->height });
+            offsetX = newWidth - image->width;
+        }
 
-        for (int x = 0; x < width; x++)
+        if (offsetY < 0)
         {
-            int tileX = x/tileSize;
+            ImageCrop(image, (Rectangle) { 0, -offsetY, image->width, image->height + offsetY });
+            offsetY = 0;
+        }
+        else if (offsetY > (newHeight - image->height))
+        {
+            ImageCrop(image, (Rectangle) { 0, 0, image->width, image->height - (offsetY - (newHeight - image->height)) });
+            offsetY = newHeight - image->height;
+        }
 
-            float minDistance = (float)strtod("Inf", NULL);
+        if ((newWidth > image->width) && (newHeight > image->height))
+        {
+            Image imTemp = GenImageColor(newWidth, newHeight, color);
 
-            // Check all adjacent tiles
-            for (int i = -1; i < 2; i++)
-            {
-                if ((tileX + i < 0) || (tileX + i >= seedsPerRow)) continue;
+            Rectangle srcRec = { 0.0f, 0.0f, (float)image->width, (float)image->height };
+            Rectangle dstRec = { (float)offsetX, (float)offsetY, srcRec.width, srcRec.height };
 
-                for (int j = -1; j < 2; j++)
-                {
-                    if ((tileY + j < 0) || (tileY + j >= seedsPerCol)) continue;
+            ImageDraw(&imTemp, *image, srcRec, dstRec, WHITE);
+            ImageFormat(&imTemp, image->format);
+            UnloadImage(*image);
+            *image = imTemp;
+        }
+        else if ((newWidth < image->width) && (newHeight < image->height))
+        {
+            Rectangle crop = { (float)offsetX, (float)offsetY, (float)newWidth, (float)newHeight };
+            ImageCrop(image, crop);
+        }
+        else    // One side is bigger and the other is smaller
+        {
+            Image imTemp = GenImageColor(newWidth, newHeight, color);
 
-                    Vector2 neighborSeed = seeds[(tileY + j)*seedsPerRow + tileX + i];
+            Rectangle srcRec = { 0.0f, 0.0f, (float)image->width, (float)image->height };
+            Rectangle dstRec = { (float)offsetX, (float)offsetY, (float)image->width, (float)image->height };
 
-                    float dist = (float)hypot(x - (int)neighborSeed.x, y - (int)neighborSeed.y);
-                    minDistance = (float)fmin(minDistance, dist);
-                }
+            if (newWidth < image->width)
+            {
+                srcRec.x = offsetX;
+                srcRec.width = newWidth;
+                dstRec.x = 0.0f;
             }
 
-            // I made this up but it seems to give good results at all tile sizes
-            int intensity = (int)(minDistance*256.0f/tileSize);
-            if (intensity > 255) intensity = 255;
+            if (newHeight < image->height)
+            {
+                srcRec.y = offsetY;
+                srcRec.height = newHeight;
+                dstRec.y = 0.0f;
+            }
 
-            pixels[y*width + x] = (Color){ intensity, intensity, intensity, 255 };
+            ImageDraw(&imTemp, *image, srcRec, dstRec, WHITE);
+            ImageFormat(&imTemp, image->format);
+            UnloadImage(*image);
+            *image = imTemp;
         }
     }
+}
 
-    RL_FREE(seeds);
+// Generate all mipmap levels for a provided image
+// NOTE 1: Supports POT and NPOT images
+// NOTE 2: image.data is scaled to include mipmap levels
+// NOTE 3: Mipmaps format is the same as base image
+void ImageMipmaps(Image *image)
+{
+    // Security check to avoid program crash
+    if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
 
-    Image image = LoadImageEx(pixels, width, height);
-    RL_FREE(pixels);
+    int mipCount = 1;                   // Required mipmap levels count (including base level)
+    int mipWidth = image->width;        // Base image width
+    int mipHeight = image->height;      // Base image height
+    int mipSize = GetPixelDataSize(mipWidth, mipHeight, image->format);  // Image data size (in bytes)
 
-    return image;
-}
-#endif      // SUPPORT_IMAGE_GENERATION
+    // Count mipmap levels required
+    while ((mipWidth != 1) || (mipHeight != 1))
+    {
+        if (mipWidth != 1) mipWidth /= 2;
+        if (mipHeight != 1) mipHeight /= 2;
 
-// Generate GPU mipmaps for a texture
-void GenTextureMipmaps(Texture2D *texture)
-{
-    // NOTE: NPOT textures support check inside function
-    // On WebGL (OpenGL ES 2.0) NPOT textures support is limited
-    rlGenerateMipmaps(texture);
-}
+        // Security check for NPOT textures
+        if (mipWidth < 1) mipWidth = 1;
+        if (mipHeight < 1) mipHeight = 1;
 
-// Set texture scaling filter mode
-void SetTextureFilter(Texture2D texture, int filterMode)
-{
-    switch (filterMode)
+        TraceLog(LOG_DEBUG, "Next mipmap level: %i x %i - current size %i", mipWidth, mipHeight, mipSize);
+
+        mipCount++;
+        mipSize += GetPixelDataSize(mipWidth, mipHeight, image->format);       // Add mipmap size (in bytes)
+    }
+
+    TraceLog(LOG_DEBUG, "Mipmaps available: %i - Mipmaps required: %i", image->mipmaps, mipCount);
+    TraceLog(LOG_DEBUG, "Mipmaps total size required: %i", mipSize);
+    TraceLog(LOG_DEBUG, "Image data memory start address: 0x%x", image->data);
+
+    if (image->mipmaps < mipCount)
     {
-        case FILTER_POINT:
+        void *temp = RL_REALLOC(image->data, mipSize);
+
+        if (temp != NULL)
         {
-            if (texture.mipmaps > 1)
-            {
-                // RL_FILTER_MIP_NEAREST - tex filter: POINT, mipmaps filter: POINT (sharp switching between mipmaps)
-                rlTextureParameters(texture.id, RL_TEXTURE_MIN_FILTER, RL_FILTER_MIP_NEAREST);
+            image->data = temp;      // Assign new pointer (new size) to store mipmaps data
+            TraceLog(LOG_DEBUG, "Image data memory point reallocated: 0x%x", temp);
+        }
+        else TraceLog(LOG_WARNING, "Mipmaps required memory could not be allocated");
 
-                // RL_FILTER_NEAREST - tex filter: POINT (no filter), no mipmaps
-                rlTextureParameters(texture.id, RL_TEXTURE_MAG_FILTER, RL_FILTER_NEAREST);
-            }
-            else
-            {
-                // RL_FILTER_NEAREST - tex filter: POINT (no filter), no mipmaps
-                rlTextureParameters(texture.id, RL_TEXTURE_MIN_FILTER, RL_FILTER_NEAREST);
-                rlTextureParameters(texture.id, RL_TEXTURE_MAG_FILTER, RL_FILTER_NEAREST);
-            }
-        } break;
-        case FILTER_BILINEAR:
+        // Pointer to allocated memory point where store next mipmap level data
+        unsigned char *nextmip = (unsigned char *)image->data + GetPixelDataSize(image->width, image->height, image->format);
+
+        mipWidth = image->width/2;
+        mipHeight = image->height/2;
+        mipSize = GetPixelDataSize(mipWidth, mipHeight, image->format);
+
+        // 8 bit per channel formats: every level is box-filtered from previous level
+        int channels = 0;
+        if (image->format == UNCOMPRESSED_GRAYSCALE) channels = 1;
+        else if (image->format == UNCOMPRESSED_GRAY_ALPHA) channels = 2;
+        else if (image->format == UNCOMPRESSED_R8G8B8) channels = 3;
+        else if (image->format == UNCOMPRESSED_R8G8B8A8) channels = 4;
+
+        if ((channels > 0) && (image->mipmaps == 1))
         {
-            if (texture.mipmaps > 1)
-            {
-                // RL_FILTER_LINEAR_MIP_NEAREST - tex filter: BILINEAR, mipmaps filter: POINT (sharp switching between mipmaps)
-                // Alternative: RL_FILTER_NEAREST_MIP_LINEAR - tex filter: POINT, mipmaps filter: BILINEAR (smooth transition between mipmaps)
-                rlTextureParameters(texture.id, RL_TEXTURE_MIN_FILTER, RL_FILTER_LINEAR_MIP_NEAREST);
+            unsigned char *prevmip = (unsigned char *)image->data;
+            int prevWidth = image->width;
+            int prevHeight = image->height;
 
-                // RL_FILTER_LINEAR - tex filter: BILINEAR, no mipmaps
-                rlTextureParameters(texture.id, RL_TEXTURE_MAG_FILTER, RL_FILTER_LINEAR);
-            }
-            else
+            for (int i = 1; i < mipCount; i++)
             {
-                // RL_FILTER_LINEAR - tex filter: BILINEAR, no mipmaps
-                rlTextureParameters(texture.id, RL_TEXTURE_MIN_FILTER, RL_FILTER_LINEAR);
-                rlTextureParameters(texture.id, RL_TEXTURE_MAG_FILTER, RL_FILTER_LINEAR);
+                rlGenNextMipmap(prevmip, prevWidth, prevHeight, channels, nextmip);
+
+                prevmip = nextmip;
+                prevWidth = (prevWidth > 1)? prevWidth/2 : 1;
+                prevHeight = (prevHeight > 1)? prevHeight/2 : 1;
+
+                nextmip += prevWidth*prevHeight*channels;
+                image->mipmaps++;
             }
-        } break;
-        case FILTER_TRILINEAR:
+
+            return;
+        }
+
+        Image imCopy = ImageCopy(*image);
+
+        for (int i = 1; i < mipCount; i++)
         {
-            if (texture.mipmaps > 1)
-            {
-                // RL_FILTER_MIP_LINEAR - tex filter: BILINEAR, mipmaps filter: BILINEAR (smooth transition between mipmaps)
-                rlTextureParameters(texture.id, RL_TEXTURE_MIN_FILTER, RL_FILTER_MIP_LINEAR);
+            TraceLog(LOG_DEBUG, "Gen mipmap level: %i (%i x %i) - size: %i - offset: 0x%x", i, mipWidth, mipHeight, mipSize, nextmip);
 
-                // RL_FILTER_LINEAR - tex filter: BILINEAR, no mipmaps
-                rlTextureParameters(texture.id, RL_TEXTURE_MAG_FILTER, RL_FILTER_LINEAR);
-            }
-            else
-            {
-                TraceLog(LOG_WARNING, "[TEX ID %i] No mipmaps available for TRILINEAR texture filtering", texture.id);
+            ImageResize(&imCopy, mipWidth, mipHeight);  // Uses internally Mitchell cubic downscale filter
 
-                // RL_FILTER_LINEAR - tex filter: BILINEAR, no mipmaps
-                rlTextureParameters(texture.id, RL_TEXTURE_MIN_FILTER, RL_FILTER_LINEAR);
-                rlTextureParameters(texture.id, RL_TEXTURE_MAG_FILTER, RL_FILTER_LINEAR);
-            }
-        } break;
-        case FILTER_ANISOTROPIC_4X: rlTextureParameters(texture.id, RL_TEXTURE_ANISOTROPIC_FILTER, 4); break;
-        case FILTER_ANISOTROPIC_8X: rlTextureParameters(texture.id, RL_TEXTURE_ANISOTROPIC_FILTER, 8); break;
-        case FILTER_ANISOTROPIC_16X: rlTextureParameters(texture.id, RL_TEXTURE_ANISOTROPIC_FILTER, 16); break;
-        default: break;
+            memcpy(nextmip, imCopy.data, mipSize);
+            nextmip += mipSize;
+            image->mipmaps++;
+
+            mipWidth /= 2;
+            mipHeight /= 2;
+
+            // Security check for NPOT textures
+            if (mipWidth < 1) mipWidth = 1;
+            if (mipHeight < 1) mipHeight = 1;
+
+            mipSize = GetPixelDataSize(mipWidth, mipHeight, image->format);
+        }
+
+        UnloadImage(imCopy);
     }
+    else TraceLog(LOG_WARNING, "Image mipmaps already available");
 }
 
-// Set texture wrapping mode
-void SetTextureWrap(Texture2D texture, int wrapMode)
+// Dither image data to 16bpp or lower (Floyd-Steinberg dithering)
+// NOTE: In case selected bpp do not represent an known 16bit format,
+// dithered data is stored in the LSB part of the unsigned short
+// NOTE: Error is diffused with integer arithmetic through two rows error buffers, 8 bit per channel
+// formats are read directly and dithered in place (16bit output never overtakes source pixels)
+void ImageDither(Image *image, int rBpp, int gBpp, int bBpp, int aBpp)
 {
-    switch (wrapMode)
+    // Security check to avoid program crash
+    if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
+
+    if (image->format >= COMPRESSED_DXT1_RGB)
     {
-        case WRAP_REPEAT:
+        TraceLog(LOG_WARNING, "Compressed data formats can not be dithered");
+        return;
+    }
+
+    if ((rBpp + gBpp + bBpp + aBpp) > 16)
+    {
+        TraceLog(LOG_WARNING, "Unsupported dithering bpps (%ibpp), only 16bpp or lower modes supported", (rBpp+gBpp+bBpp+aBpp));
+    }
+    else
+    {
+        if ((image->format != UNCOMPRESSED_R8G8B8) && (image->format != UNCOMPRESSED_R8G8B8A8))
         {
-            rlTextureParameters(texture.id, RL_TEXTURE_WRAP_S, RL_WRAP_REPEAT);
-            rlTextureParameters(texture.id, RL_TEXTURE_WRAP_T, RL_WRAP_REPEAT);
-        } break;
-        case WRAP_CLAMP:
+            TraceLog(LOG_WARNING, "Image format is already 16bpp or lower, dithering could have no effect");
+        }
+
+        // Source pixels: 8 bit per channel formats read directly, other formats converted to RGBA
+        int channels = GetPixelChannels(image->format);
+        unsigned char *src = (unsigned char *)image->data;
+        Color *pixels = NULL;
+
+        if (channels == 0)
         {
-            rlTextureParameters(texture.id, RL_TEXTURE_WRAP_S, RL_WRAP_CLAMP);
-            rlTextureParameters(texture.id, RL_TEXTURE_WRAP_T, RL_WRAP_CLAMP);
-        } break;
-        case WRAP_MIRROR_REPEAT:
+            pixels = GetImageData(*image);
+            src = (unsigned char *)pixels;
+            channels = 4;
+        }
+
+        // NOTE: We will store the dithered data as unsigned short (16bpp)
+        // Output is written over source data when source pixels are 16bpp or bigger
+        unsigned short *output = NULL;
+        if ((pixels == NULL) && (channels >= 2)) output = (unsigned short *)image->data;
+        else output = (unsigned short *)RL_MALLOC(image->width*image->height*sizeof(unsigned short));
+
+        // Define new image format, check if desired bpp match internal known format
+        int format = 0;
+        if ((rBpp == 5) && (gBpp == 6) && (bBpp == 5) && (aBpp == 0)) format = UNCOMPRESSED_R5G6B5;
+        else if ((rBpp == 5) && (gBpp == 5) && (bBpp == 5) && (aBpp == 1)) format = UNCOMPRESSED_R5G5B5A1;
+        else if ((rBpp == 4) && (gBpp == 4) && (bBpp == 4) && (aBpp == 4)) format = UNCOMPRESSED_R4G4B4A4;
+        else TraceLog(LOG_WARNING, "Unsupported dithered OpenGL internal format: %ibpp (R%iG%iB%iA%i)", (rBpp+gBpp+bBpp+aBpp), rBpp, gBpp, bBpp, aBpp);
+
+        // Diffused error per channel (r, g, b) for current and next row, one pixel padding on both sides
+        // NOTE: Truncation error is never negative, values are only clamped to 255
+        int errorRowSize = (image->width + 2)*3;
+        int *errors = (int *)RL_CALLOC(errorRowSize*2, sizeof(int));
+        int *currentErrors = errors;
+        int *nextErrors = errors + errorRowSize;
+
+        int rShift = 8 - rBpp, gShift = 8 - gBpp, bShift = 8 - bBpp, aShift = 8 - aBpp;
+
+        for (int y = 0; y < image->height; y++)
         {
-            rlTextureParameters(texture.id, RL_TEXTURE_WRAP_S, RL_WRAP_MIRROR_REPEAT);
-            rlTextureParameters(texture.id, RL_TEXTURE_WRAP_T, RL_WRAP_MIRROR_REPEAT);
-        } break;
-        case WRAP_MIRROR_CLAMP:
+            for (int x = 0; x < image->width; x++)
+            {
+                int i = y*image->width + x;
+                const unsigned char *p = src + (size_t)i*channels;
+
+                int r = p[0], g = p[0], b = p[0], a = 255;
+                if (channels == 2) a = p[1];
+                else if (channels >= 3) { g = p[1]; b = p[2]; }
+                if (channels == 4) a = p[3];
+
+                int *error = currentErrors + (x + 1)*3;
+                r += error[0]; if (r > 0xff) r = 0xff;
+                g += error[1]; if (g > 0xff) g = 0xff;
+                b += error[2]; if (b > 0xff) b = 0xff;
+
+                // NOTE: New pixel obtained by bits truncate, it would be better to round values (check ImageFormat())
+                int rPixel = r >> rShift;       // R bits
+                int gPixel = g >> gShift;       // G bits
+                int bPixel = b >> bShift;       // B bits
+                int aPixel = a >> aShift;       // A bits (not used on dithering)
+
+                // NOTE: Error must be computed between new and old pixel but using same number of bits!
+                // We want to know how much color precision we have lost...
+                int rError = r - (rPixel << rShift);
+                int gError = g - (gPixel << gShift);
+                int bError = b - (bPixel << bShift);
+
+                // NOTE: Out of image cases land on padding or last row buffer, never read
+                error[3] += rError*7/16; error[4] += gError*7/16; error[5] += bError*7/16;
+
+                int *below = nextErrors + (x + 1)*3;
+                below[-3] += rError*3/16; below[-2] += gError*3/16; below[-1] += bError*3/16;
+                below[0] += rError*5/16; below[1] += gError*5/16; below[2] += bError*5/16;
+                below[3] += rError*1/16; below[4] += gError*1/16; below[5] += bError*1/16;
+
+                output[i] = (unsigned short)((rPixel << (gBpp + bBpp + aBpp)) | (gPixel << (bBpp + aBpp)) | (bPixel << aBpp) | aPixel);
+            }
+
+            // Swap error rows, next row errors start cleared
+            int *temp = currentErrors;
+            currentErrors = nextErrors;
+            nextErrors = temp;
+            memset(nextErrors, 0, errorRowSize*sizeof(int));
+        }
+
+        RL_FREE(errors);
+
+        if ((void *)output != image->data)
         {
-            rlTextureParameters(texture.id, RL_TEXTURE_WRAP_S, RL_WRAP_MIRROR_CLAMP);
-            rlTextureParameters(texture.id, RL_TEXTURE_WRAP_T, RL_WRAP_MIRROR_CLAMP);
-        } break;
-        default: break;
+            RL_FREE(image->data);      // free old image data
+            image->data = output;
+        }
+        else if (channels > 2)
+        {
+            // Shrink data in place to dithered size
+            void *temp = RL_REALLOC(image->data, image->width*image->height*sizeof(unsigned short));
+            if (temp != NULL) image->data = temp;
+        }
+
+        RL_FREE(pixels);
+
+        image->format = format;
+        image->mipmaps = 1;
     }
 }
 
-// Draw a Texture2D
-void DrawTexture(Texture2D texture, int posX, int posY, Color tint)
+// Extract color palette from image to maximum size
+// NOTE: Memory allocated should be freed manually!
+// NOTE: Colors are looked up in a hash table (open addressing), palette keeps colors first appearance order
+Color *ImageExtractPalette(Image image, int maxPaletteSize, int *extractCount)
 {
-    DrawTextureEx(texture, (Vector2){ (float)posX, (float)posY }, 0.0f, 1.0f, tint);
-}
+    // NOTE: RGBA images are read directly, other formats converted
+    Color *pixels = (image.format == UNCOMPRESSED_R8G8B8A8)? (Color *)image.data : GetImageData(image);
+    Color *palette = (Color *)RL_MALLOC(maxPaletteSize*sizeof(Color));
 
-// Draw a Texture2D with position defined as Vector2
-void DrawTextureV(Texture2D texture, Vector2 position, Color tint)
-{
-    DrawTextureEx(texture, position, 0, 1.0f, tint);
-}
+    int palCount = 0;
+    for (int i = 0; i < maxPaletteSize; i++) palette[i] = BLANK;   // Set all colors to BLANK
 
-// Draw a Texture2D with extended parameters
-void DrawTextureEx(Texture2D texture, Vector2 position, float rotation, float scale, Color tint)
-{
-    Rectangle sourceRec = { 0.0f, 0.0f, (float)texture.width, (float)texture.height };
-    Rectangle destRec = { position.x, position.y, (float)texture.width*scale, (float)texture.height*scale };
-    Vector2 origin = { 0.0f, 0.0f };
+    // Hash table of palette indices (-1 if empty), at least twice palette size
+    int tableSize = 64;
+    while (tableSize < maxPaletteSize*2) tableSize *= 2;
 
-    DrawTexturePro(texture, sourceRec, destRec, origin, rotation, tint);
-}
+    int *table = (int *)RL_MALLOC(tableSize*sizeof(int));
+    for (int i = 0; i < tableSize; i++) table[i] = -1;
 
-// Draw a part of a texture (defined by a rectangle)
-void DrawTextureRec(Texture2D texture, Rectangle sourceRec, Vector2 position, Color tint)
-{
-    Rectangle destRec = { position.x, position.y, (float)fabs(sourceRec.width), (float)fabs(sourceRec.height) };
-    Vector2 origin = { 0.0f, 0.0f };
+    for (int i = 0; i < image.width*image.height; i++)
+    {
+        if (pixels[i].a > 0)
+        {
+            unsigned int key = ((unsigned int)pixels[i].r << 24) | ((unsigned int)pixels[i].g << 16) | ((unsigned int)pixels[i].b << 8) | pixels[i].a;
+            unsigned int slot = (key*2654435761u) & (tableSize - 1);
 
-    DrawTexturePro(texture, sourceRec, destRec, origin, 0.0f, tint);
-}
+            bool colorInPalette = false;
 
-// Draw texture quad with tiling and offset parameters
-// NOTE: Tiling and offset should be provided considering normalized texture values [0..1]
-// i.e tiling = { 1.0f, 1.0f } refers to all texture, offset = { 0.5f, 0.5f } moves texture origin to center
-void DrawTextureQuad(Texture2D texture, Vector2 tiling, Vector2 offset, Rectangle quad, Color tint)
-{
-    Rectangle source = { offset.x*texture.width, offset.y*texture.height, tiling.x*texture.width, tiling.y*texture.height };
-    Vector2 origin = { 0.0f, 0.0f };
+            // Check if the color is already on palette
+            while (table[slot] != -1)
+            {
+                Color col = palette[table[slot]];
 
-    DrawTexturePro(texture, source, quad, origin, 0.0f, tint);
+                if ((col.r == pixels[i].r) && (col.g == pixels[i].g) && (col.b == pixels[i].b) && (col.a == pixels[i].a))
+                {
+                    colorInPalette = true;
+                    break;
+                }
+
+                slot = (slot + 1) & (tableSize - 1);
+            }
+
+            // Store color if not on the palette
+            if (!colorInPalette)
+            {
+                table[slot] = palCount;
+                palette[palCount] = pixels[i];      // Add pixels[i] to palette
+                palCount++;
+
+                // We reached the limit of colors supported by palette
+                if (palCount >= maxPaletteSize)
+                {
+                    i = image.width*image.height;   // Finish palette get
+                    TraceLog(LOG_WARNING, "Image palette is greater than %i colors!", maxPaletteSize);
+                }
+            }
+        }
+    }
+
+    RL_FREE(table);
+    if ((void *)pixels != image.data) RL_FREE(pixels);
+
+    *extractCount = palCount;
+
+    return palette;
 }
 
-// Draw a part of a texture (defined by a rectangle) with 'pro' parameters
-// NOTE: origin is relative to destination rectangle size
-void DrawTexturePro(Texture2D texture, Rectangle sourceRec, Rectangle destRec, Vector2 origin, float rotation, Color tint)
+// Quantize image colors to a palette of maximum size (median cut)
+// NOTE: Colors histogram is built with 5 bit per channel (RGB, transparent pixels ignored), histogram
+// boxes are split at weighted median of their widest channel, palette colors are boxes average colors
+// NOTE: Memory allocated should be freed manually!
+Color *ImageQuantizePalette(Image image, int maxPaletteSize, int *colorsCount)
 {
-    // Check if texture is valid
-    if (texture.id > 0)
-    {
-        float width = (float)texture.width;
-        float height = (float)texture.height;
+    #define QUANTIZE_HISTOGRAM_SIZE     32768   // 5 bit per channel RGB
 
-        bool flipX = false;
+    *colorsCount = 0;
 
-        if (sourceRec.width < 0) { flipX = true; sourceRec.width *= -1; }
-        if (sourceRec.height < 0) sourceRec.y -= sourceRec.height;
+    if ((image.data == NULL) || (maxPaletteSize <= 0)) return NULL;
 
-        rlEnableTexture(texture.id);
+    Color *pixels = (image.format == UNCOMPRESSED_R8G8B8A8)? (Color *)image.data : GetImageData(image);
 
-        rlPushMatrix();
-            rlTranslatef(destRec.x, destRec.y, 0.0f);
-            rlRotatef(rotation, 0.0f, 0.0f, 1.0f);
-            rlTranslatef(-origin.x, -origin.y, 0.0f);
+    // Histogram: pixels count and channels sums per bucket
+    unsigned int *counts = (unsigned int *)RL_CALLOC(QUANTIZE_HISTOGRAM_SIZE, sizeof(unsigned int));
+    unsigned long long *sums = (unsigned long long *)RL_CALLOC(QUANTIZE_HISTOGRAM_SIZE*3, sizeof(unsigned long long));
 
-            rlBegin(RL_QUADS);
-                rlColor4ub(tint.r, tint.g, tint.b, tint.a);
-                rlNormal3f(0.0f, 0.0f, 1.0f);                          // Normal vector pointing towards viewer
+    for (int i = 0; i < image.width*image.height; i++)
+    {
+        if (pixels[i].a == 0) continue;
 
-                // Bottom-left corner for texture and quad
-                if (flipX) rlTexCoord2f((sourceRec.x + sourceRec.width)/width, sourceRec.y/height);
-                else rlTexCoord2f(sourceRec.x/width, sourceRec.y/height);
-                rlVertex2f(0.0f, 0.0f);
+        int bucket = ((pixels[i].r >> 3) << 10) | ((pixels[i].g >> 3) << 5) | (pixels[i].b >> 3);
+        counts[bucket]++;
+        sums[bucket*3] += pixels[i].r;
+        sums[bucket*3 + 1] += pixels[i].g;
+        sums[bucket*3 + 2] += pixels[i].b;
+    }
 
-                // Bottom-right corner for texture and quad
-                if (flipX) rlTexCoord2f((sourceRec.x + sourceRec.width)/width, (sourceRec.y + sourceRec.height)/height);
-                else rlTexCoord2f(sourceRec.x/width, (sourceRec.y + sourceRec.height)/height);
-                rlVertex2f(0.0f, destRec.height);
+    if ((void *)pixels != image.data) RL_FREE(pixels);
 
-                // Top-right corner for texture and quad
-                if (flipX) rlTexCoord2f(sourceRec.x/width, (sourceRec.y + sourceRec.height)/height);
-                else rlTexCoord2f((sourceRec.x + sourceRec.width)/width, (sourceRec.y + sourceRec.height)/height);
-                rlVertex2f(destRec.width, destRec.height);
+    // Used buckets list, boxes are ranges of it
+    int *buckets = (int *)RL_MALLOC(QUANTIZE_HISTOGRAM_SIZE*sizeof(int));
+    int *sorted = (int *)RL_MALLOC(QUANTIZE_HISTOGRAM_SIZE*sizeof(int));
+    int bucketsCount = 0;
 
-                // Top-left corner for texture and quad
-                if (flipX) rlTexCoord2f(sourceRec.x/width, sourceRec.y/height);
-                else rlTexCoord2f((sourceRec.x + sourceRec.width)/width, sourceRec.y/height);
-                rlVertex2f(destRec.width, 0.0f);
-            rlEnd();
-        rlPopMatrix();
+    for (int i = 0; i < QUANTIZE_HISTOGRAM_SIZE; i++) if (counts[i] > 0) buckets[bucketsCount++] = i;
 
-        rlDisableTexture();
+    int *boxStart = (int *)RL_MALLOC(maxPaletteSize*sizeof(int));
+    int *boxEnd = (int *)RL_MALLOC(maxPaletteSize*sizeof(int));
+    int boxesCount = 0;
+
+    if (bucketsCount > 0)
+    {
+        boxStart[0] = 0;
+        boxEnd[0] = bucketsCount;
+        boxesCount = 1;
     }
-}
 
-// Draws a texture (or part of it) that stretches or shrinks nicely using n-patch info
-void DrawTextureNPatch(Texture2D texture, NPatchInfo nPatchInfo, Rectangle destRec, Vector2 origin, float rotation, Color tint)
-{
-    if (texture.id > 0)
+    while (boxesCount < maxPaletteSize)
     {
-        float width = (float)texture.width;
-        float height = (float)texture.height;
+        // Find box with widest channel range (boxes with only one bucket can not be split)
+        int splitBox = -1, splitChannel = 0, splitRange = 0;
 
-        float patchWidth = (destRec.width <= 0.0f)? 0.0f : destRec.width;
-        float patchHeight = (destRec.height <= 0.0f)? 0.0f : destRec.height;
+        for (int b = 0; b < boxesCount; b++)
+        {
+            if ((boxEnd[b] - boxStart[b]) < 2) continue;
 
-        if (nPatchInfo.sourceRec.width < 0) nPatchInfo.sourceRec.x -= nPatchInfo.sourceRec.width;
-        if (nPatchInfo.sourceRec.height < 0) nPatchInfo.sourceRec.y -= nPatchInfo.sourceRec.height;
-        if (nPatchInfo.type == NPT_3PATCH_HORIZONTAL) patchHeight = nPatchInfo.sourceRec.height;
-        if (nPatchInfo.type == NPT_3PATCH_VERTICAL) patchWidth = nPatchInfo.sourceRec.width;
+            int minValue[3] = { 31, 31, 31 }, maxValue[3] = { 0, 0, 0 };
 
-        bool drawCenter = true;
-        bool drawMiddle = true;
-        float leftBorder = (float)nPatchInfo.left;
-        float topBorder = (float)nPatchInfo.top;
-        float rightBorder = (float)nPatchInfo.right;
-        float bottomBorder = (float)nPatchInfo.bottom;
+            for (int k = boxStart[b]; k < boxEnd[b]; k++)
+            {
+                for (int c = 0; c < 3; c++)
+                {
+                    int value = (buckets[k] >> (10 - c*5)) & 0x1f;
+                    if (value < minValue[c]) minValue[c] = value;
+                    if (value > maxValue[c]) maxValue[c] = value;
+                }
+            }
 
-        // adjust the lateral (left and right) border widths in case patchWidth < texture.width
-        if (patchWidth <= (leftBorder + rightBorder) && nPatchInfo.type != NPT_3PATCH_VERTICAL)
-        {
-            drawCenter = false;
-            leftBorder = (leftBorder / (leftBorder + rightBorder)) * patchWidth;
-            rightBorder = patchWidth - leftBorder;
+            for (int c = 0; c < 3; c++)
+            {
+                if ((maxValue[c] - minValue[c]) > splitRange)
+                {
+                    splitRange = maxValue[c] - minValue[c];
+                    splitBox = b;
+                    splitChannel = c;
+                }
+            }
         }
-        // adjust the lateral (top and bottom) border heights in case patchHeight < texture.height
-        if (patchHeight <= (topBorder + bottomBorder) && nPatchInfo.type != NPT_3PATCH_HORIZONTAL)
+
+        if (splitBox == -1) break;      // All boxes are single colors
+
+        // Sort box buckets by split channel (counting sort, 32 values)
+        int start = boxStart[splitBox], end = boxEnd[splitBox];
+        int shift = 10 - splitChannel*5;
+        int offsets[33] = { 0 };
+        unsigned long long total = 0;
+
+        for (int k = start; k < end; k++)
         {
-            drawMiddle = false;
-            topBorder = (topBorder / (topBorder + bottomBorder)) * patchHeight;
-            bottomBorder = patchHeight - topBorder;
+            offsets[((buckets[k] >> shift) & 0x1f) + 1]++;
+            total += counts[buckets[k]];
         }
+        for (int v = 0; v < 32; v++) offsets[v + 1] += offsets[v];
+        for (int k = start; k < end; k++) sorted[start + offsets[(buckets[k] >> shift) & 0x1f]++] = buckets[k];
+        memcpy(buckets + start, sorted + start, (end - start)*sizeof(int));
 
-        Vector2 vertA, vertB, vertC, vertD;
-        vertA.x = 0.0f;                             // outer left
-        vertA.y = 0.0f;                             // outer top
-        vertB.x = leftBorder;                       // inner left
-        vertB.y = topBorder;                        // inner top
-        vertC.x = patchWidth  - rightBorder;        // inner right
-        vertC.y = patchHeight - bottomBorder;       // inner bottom
-        vertD.x = patchWidth;                       // outer right
-        vertD.y = patchHeight;                      // outer bottom
+        // Split at weighted median, both halves at least one bucket
+        int median = start + 1;
+        unsigned long long accum = counts[buckets[start]];
 
-        Vector2 coordA, coordB, coordC, coordD;
-        coordA.x = nPatchInfo.sourceRec.x / width;
-        coordA.y = nPatchInfo.sourceRec.y / height;
-        coordB.x = (nPatchInfo.sourceRec.x + leftBorder) / width;
-        coordB.y = (nPatchInfo.sourceRec.y + topBorder) / height;
-        coordC.x = (nPatchInfo.sourceRec.x + nPatchInfo.sourceRec.width  - rightBorder) / width;
-        coordC.y = (nPatchInfo.sourceRec.y + nPatchInfo.sourceRec.height - bottomBorder) / height;
-        coordD.x = (nPatchInfo.sourceRec.x + nPatchInfo.sourceRec.width)  / width;
-        coordD.y = (nPatchInfo.sourceRec.y + nPatchInfo.sourceRec.height) / height;
+        while ((median < (end - 1)) && (accum*2 < total)) accum += counts[buckets[median++]];
 
-        rlEnableTexture(texture.id);
+        boxStart[boxesCount] = median;
+        boxEnd[boxesCount] = end;
+        boxEnd[splitBox] = median;
+        boxesCount++;
+    }
 
-        rlPushMatrix();
-            rlTranslatef(destRec.x, destRec.y, 0.0f);
-            rlRotatef(rotation, 0.0f, 0.0f, 1.0f);
+    Color *palette = (Color *)RL_MALLOC(maxPaletteSize*sizeof(Color));
+    for (int i = 0; i < maxPaletteSize; i++) palette[i] = BLANK;
+
+    for (int b = 0; b < boxesCount; b++)
+    {
+        unsigned long long count = 0, r = 0, g = 0, bl = 0;
+
+        for (int k = boxStart[b]; k < boxEnd[b]; k++)
+        {
+            count += counts[buckets[k]];
+            r += sums[buckets[k]*3];
+            g += sums[buckets[k]*3 + 1];
+            bl += sums[buckets[k]*3 + 2];
+        }
+
+        palette[b] = (Color){ (unsigned char)((r + count/2)/count), (unsigned char)((g + count/2)/count), (unsigned char)((bl + count/2)/count), 255 };
+    }
+
+    RL_FREE(boxStart);
+    RL_FREE(boxEnd);
+    RL_FREE(sorted);
+    RL_FREE(buckets);
+    RL_FREE(sums);
+    RL_FREE(counts);
+
+    *colorsCount = boxesCount;
+
+    return palette;
+}
+
+// Draw an image (source) within an image (destination)
+// NOTE: Color tint is applied to source image
+void ImageDraw(Image *dst, Image src, Rectangle srcRec, Rectangle dstRec, Color tint)
+{
+    // Security check to avoid program crash
+    if ((dst->data == NULL) || (dst->width == 0) || (dst->height == 0) ||
+        (src.data == NULL) || (src.width == 0) || (src.height == 0)) return;
+
+    // Security checks to avoid size and rectangle issues (out of bounds)
+    // Check that srcRec is inside src image
+    if (srcRec.x < 0) srcRec.x = 0;
+    if (srcRec.y < 0) srcRec.y = 0;
+
+    // Fast path: RGBA images without scaling, rectangles are clipped and pixels blended directly into dst
+    if ((dst->format == UNCOMPRESSED_R8G8B8A8) && (src.format == UNCOMPRESSED_R8G8B8A8) &&
+        ((int)dstRec.width == (int)srcRec.width) && ((int)dstRec.height == (int)srcRec.height))
+    {
+        int srcX = (int)srcRec.x;
+        int srcY = (int)srcRec.y;
+        int dstX = (int)dstRec.x;
+        int dstY = (int)dstRec.y;
+        int width = (int)srcRec.width;
+        int height = (int)srcRec.height;
+
+        // Clip to source image, then to destination image
+        if ((srcX + width) > src.width) width = src.width - srcX;
+        if ((srcY + height) > src.height) height = src.height - srcY;
+        if (dstX < 0) { srcX -= dstX; width += dstX; dstX = 0; }
+        if (dstY < 0) { srcY -= dstY; height += dstY; dstY = 0; }
+        if ((dstX + width) > dst->width) width = dst->width - dstX;
+        if ((dstY + height) > dst->height) height = dst->height - dstY;
+
+        for (int y = 0; y < height; y++)
+        {
+            BlendPixelsRGBA((unsigned char *)dst->data + ((dstY + y)*dst->width + dstX)*4,
+                            (const unsigned char *)src.data + ((srcY + y)*src.width + srcX)*4, width, tint);
+        }
+
+        return;
+    }
+
+    if ((srcRec.x + srcRec.width) > src.width)
+    {
+        srcRec.width = src.width - srcRec.x;
+        TraceLog(LOG_WARNING, "Source rectangle width out of bounds, rescaled width: %i", srcRec.width);
+    }
+
+    if ((srcRec.y + srcRec.height) > src.height)
+    {
+        srcRec.height = src.height - srcRec.y;
+        TraceLog(LOG_WARNING, "Source rectangle height out of bounds, rescaled height: %i", srcRec.height);
+    }
+
+    Image srcCopy = ImageCopy(src);     // Make a copy of source image to work with it
+
+    // Crop source image to desired source rectangle (if required)
+    if ((src.width != (int)srcRec.width) && (src.height != (int)srcRec.height)) ImageCrop(&srcCopy, srcRec);
+
+    // Scale source image in case destination rec size is different than source rec size
+    if (((int)dstRec.width != (int)srcRec.width) || ((int)dstRec.height != (int)srcRec.height))
+    {
+        ImageResize(&srcCopy, (int)dstRec.width, (int)dstRec.height);
+    }
+
+    // Check that dstRec is inside dst image
+    // Allow negative position within destination with cropping
+    if (dstRec.x < 0)
+    {
+        ImageCrop(&srcCopy, (Rectangle) { -dstRec.x, 0, dstRec.width + dstRec.x, dstRec.height });
+        dstRec.width = dstRec.width + dstRec.x;
+        dstRec.x = 0;
+    }
+
+    if ((dstRec.x + dstRec.width) > dst->width)
+    {
+        ImageCrop(&srcCopy, (Rectangle) { 0, 0, dst->width - dstRec.x, dstRec.height });
+        dstRec.width = dst->width - dstRec.x;
+    }
+
+    if (dstRec.y < 0)
+    {
+        ImageCrop(&srcCopy, (Rectangle) { 0, -dstRec.y, dstRec.width, dstRec.height + dstRec.y });
+        dstRec.height = dstRec.height + dstRec.y;
+        dstRec.y = 0;
+    }
+
+    if ((dstRec.y + dstRec.height) > dst->height)
+    {
+        ImageCrop(&srcCopy, (Rectangle) { 0, 0, dstRec.width, dst->height - dstRec.y });
+        dstRec.height = dst->height - dstRec.y;
+    }
+
+    // Get image data as Color pixels array to work with it
+    // NOTE: Pixels arrays only used on this call, allocated on scratch memory
+    Color *dstPixels = (Color *)PushScratchMemory(dst->width*dst->height*sizeof(Color));
+    Color *srcPixels = (Color *)PushScratchMemory(srcCopy.width*srcCopy.height*sizeof(Color));
+    ReadImagePixels(*dst, dstPixels);
+    ReadImagePixels(srcCopy, srcPixels);
+
+    UnloadImage(srcCopy);       // Source copy not required any more
+
+    Vector4 fsrc, fdst, fout;   // Normalized pixel data (ready for operation)
+    Vector4 ftint = ColorNormalize(tint);   // Normalized color tint
+
+    // Blit pixels, copy source image into destination
+    // TODO: Maybe out-of-bounds blitting could be considered here instead of so much cropping
+    for (int j = (int)dstRec.y; j < (int)(dstRec.y + dstRec.height); j++)
+    {
+        for (int i = (int)dstRec.x; i < (int)(dstRec.x + dstRec.width); i++)
+        {
+            // Alpha blending (https://en.wikipedia.org/wiki/Alpha_compositing)
+
+            fdst = ColorNormalize(dstPixels[j*(int)dst->width + i]);
+            fsrc = ColorNormalize(srcPixels[(j - (int)dstRec.y)*(int)dstRec.width + (i - (int)dstRec.x)]);
+
+            // Apply color tint to source image
+            fsrc.x *= ftint.x; fsrc.y *= ftint.y; fsrc.z *= ftint.z; fsrc.w *= ftint.w;
+
+            fout.w = fsrc.w + fdst.w*(1.0f - fsrc.w);
+
+            if (fout.w <= 0.0f)
+            {
+                fout.x = 0.0f;
+                fout.y = 0.0f;
+                fout.z = 0.0f;
+            }
+            else
+            {
+                fout.x = (fsrc.x*fsrc.w + fdst.x*fdst.w*(1 - fsrc.w))/fout.w;
+                fout.y = (fsrc.y*fsrc.w + fdst.y*fdst.w*(1 - fsrc.w))/fout.w;
+                fout.z = (fsrc.z*fsrc.w + fdst.z*fdst.w*(1 - fsrc.w))/fout.w;
+            }
+
+            dstPixels[j*(int)dst->width + i] = (Color){ (unsigned char)(fout.x*255.0f),
+                                                        (unsigned char)(fout.y*255.0f),
+                                                        (unsigned char)(fout.z*255.0f),
+                                                        (unsigned char)(fout.w*255.0f) };
+
+            // TODO: Support other blending options
+        }
+    }
+
+    UnloadImage(*dst);
+
+    *dst = LoadImageEx(dstPixels, (int)dst->width, (int)dst->height);
+    ImageFormat(dst, dst->format);
+
+    PopScratchMemory(srcPixels);
+    PopScratchMemory(dstPixels);
+}
+
+// Create an image from text (default font)
+Image ImageText(const char *text, int fontSize, Color color)
+{
+    int defaultFontSize = 10;   // Default Font chars height in pixel
+    if (fontSize < defaultFontSize) fontSize = defaultFontSize;
+    int spacing = fontSize / defaultFontSize;
+
+    Image imText = ImageTextEx(GetFontDefault(), text, (float)fontSize, (float)spacing, color);
+
+    return imText;
+}
+
+// Create an image from text (custom sprite font)
+// NOTE: Glyphs are composed on CPU from font glyphs images (kept in RAM, atlas is not read back),
+// LoadRenderTextureText() renders text on GPU if CPU pixels are not required
+Image ImageTextEx(Font font, const char *text, float fontSize, float spacing, Color tint)
+{
+    int length = strlen(text);
+
+    int index;                  // Index position in sprite font
+    int letter = 0;             // Current character
+    int positionX = 0;          // Image drawing position
+
+    // NOTE: Text image is generated at font base size, later scaled to desired font size
+    Vector2 imSize = MeasureTextEx(font, text, (float)font.baseSize, spacing);
+
+    // Create image to store text
+    Image imText = GenImageColor((int)imSize.x, (int)imSize.y, BLANK);
+
+    for (int i = 0; i < length; i++)
+    {
+        int next = 0;
+        letter = GetNextCodepoint(&text[i], &next);
+        index = GetGlyphIndex(font, letter);
+
+        if (letter == 0x3f) next = 1;
+        i += (next - 1);
+
+        if (letter == '\n')
+        {
+            // TODO: Support line break
+        }
+        else
+        {
+            if (letter != ' ')
+            {
+                ImageDraw(&imText, font.chars[index].image, (Rectangle){ 0, 0, font.chars[index].image.width, font.chars[index].image.height },
+                         (Rectangle){ (float)(positionX + font.chars[index].offsetX),(float)font.chars[index].offsetY,
+                                      font.chars[index].image.width, font.chars[index].image.height }, tint);
+            }
+
+            if (font.chars[index].advanceX == 0) positionX += (int)(font.recs[index].width + spacing);
+            else positionX += font.chars[index].advanceX + (int)spacing;
+        }
+    }
+
+    // Scale image depending on text size
+    if (fontSize > imSize.y)
+    {
+        float scaleFactor = fontSize/imSize.y;
+        TraceLog(LOG_INFO, "Image text scaled by factor: %f", scaleFactor);
+
+        // Using nearest-neighbor scaling algorithm for default font
+        if (font.texture.id == GetFontDefault().texture.id) ImageResizeNN(&imText, (int)(imSize.x*scaleFactor), (int)(imSize.y*scaleFactor));
+        else ImageResize(&imText, (int)(imSize.x*scaleFactor), (int)(imSize.y*scaleFactor));
+    }
+
+    return imText;
+}
+
+// Draw rectangle within an image
+void ImageDrawRectangle(Image *dst, Rectangle rec, Color color)
+{
+    // Security check to avoid program crash
+    if ((dst->data == NULL) || (dst->width == 0) || (dst->height == 0)) return;
+
+    Image imRec = GenImageColor((int)rec.width, (int)rec.height, color);
+    ImageDraw(dst, imRec, (Rectangle){ 0, 0, rec.width, rec.height }, rec, WHITE);
+    UnloadImage(imRec);
+}
+
+// Draw rectangle lines within an image
+void ImageDrawRectangleLines(Image *dst, Rectangle rec, int thick, Color color)
+{
+    ImageDrawRectangle(dst, (Rectangle){ rec.x, rec.y, rec.width, thick }, color);
+    ImageDrawRectangle(dst, (Rectangle){ rec.x, rec.y + thick, thick, rec.height - thick*2 }, color);
+    ImageDrawRectangle(dst, (Rectangle){ rec.x + rec.width - thick, rec.y + thick, thick, rec.height - thick*2 }, color);
+    ImageDrawRectangle(dst, (Rectangle){ rec.x, rec.y + rec.height - thick, rec.width, thick }, color);
+}
+
+// Draw text (default font) within an image (destination)
+void ImageDrawText(Image *dst, Vector2 position, const char *text, int fontSize, Color color)
+{
+    // NOTE: For default font, sapcing is set to desired font size / default font size (10)
+    ImageDrawTextEx(dst, position, GetFontDefault(), text, (float)fontSize, (float)fontSize/10, color);
+}
+
+// Draw text (custom sprite font) within an image (destination)
+void ImageDrawTextEx(Image *dst, Vector2 position, Font font, const char *text, float fontSize, float spacing, Color color)
+{
+    Image imText = ImageTextEx(font, text, fontSize, spacing, color);
+
+    Rectangle srcRec = { 0.0f, 0.0f, (float)imText.width, (float)imText.height };
+    Rectangle dstRec = { position.x, position.y, (float)imText.width, (float)imText.height };
+
+    ImageDraw(dst, imText, srcRec, dstRec, WHITE);
+
+    UnloadImage(imText);
+}
+
+// Flip image vertically
+void ImageFlipVertical(Image *image)
+{
+    // Security check to avoid program crash
+    if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
+
+    if (image->format >= COMPRESSED_DXT1_RGB)
+    {
+        TraceLog(LOG_WARNING, "Image flip not supported for compressed formats");
+        return;
+    }
+
+    // NOTE: Rows are swapped in place (any uncompressed format), all mipmap levels are flipped
+    unsigned char *level = (unsigned char *)image->data;
+    unsigned char temp[256];
+
+    for (int m = 0, width = image->width, height = image->height; m < image->mipmaps; m++)
+    {
+        int rowSize = GetPixelDataSize(width, 1, image->format);
+
+        for (int y = 0; y < height/2; y++)
+        {
+            unsigned char *rowA = level + y*rowSize;
+            unsigned char *rowB = level + (height - 1 - y)*rowSize;
+
+            for (int offset = 0; offset < rowSize; offset += sizeof(temp))
+            {
+                int size = ((rowSize - offset) < (int)sizeof(temp))? (rowSize - offset) : (int)sizeof(temp);
+
+                memcpy(temp, rowA + offset, size);
+                memcpy(rowA + offset, rowB + offset, size);
+                memcpy(rowB + offset, temp, size);
+            }
+        }
+
+        level += rowSize*height;
+        width = (width > 1)? width/2 : 1;
+        height = (height > 1)? height/2 : 1;
+    }
+}
+
+// Flip image horizontally
+void ImageFlipHorizontal(Image *image)
+{
+    // Security check to avoid program crash
+    if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
+
+    if (image->format >= COMPRESSED_DXT1_RGB)
+    {
+        TraceLog(LOG_WARNING, "Image flip not supported for compressed formats");
+        return;
+    }
+
+    // NOTE: Pixels are swapped in place (any uncompressed format), all mipmap levels are flipped
+    int bytesPerPixel = GetPixelDataSize(1, 1, image->format);
+    unsigned char *level = (unsigned char *)image->data;
+    unsigned char temp[16];     // Largest pixel size: UNCOMPRESSED_R32G32B32A32
+
+    for (int m = 0, width = image->width, height = image->height; m < image->mipmaps; m++)
+    {
+        for (int y = 0; y < height; y++)
+        {
+            unsigned char *row = level + y*width*bytesPerPixel;
+
+            for (int x = 0; x < width/2; x++)
+            {
+                unsigned char *pixelA = row + x*bytesPerPixel;
+                unsigned char *pixelB = row + (width - 1 - x)*bytesPerPixel;
+
+                memcpy(temp, pixelA, bytesPerPixel);
+                memcpy(pixelA, pixelB, bytesPerPixel);
+                memcpy(pixelB, temp, bytesPerPixel);
+            }
+        }
+
+        level += width*height*bytesPerPixel;
+        width = (width > 1)? width/2 : 1;
+        height = (height > 1)? height/2 : 1;
+    }
+}
+
+// Rotate image clockwise 90deg
+void ImageRotateCW(Image *image)
+{
+    // Security check to avoid program crash
+    if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
+
+    if (image->format >= COMPRESSED_DXT1_RGB)
+    {
+        TraceLog(LOG_WARNING, "Image rotation not supported for compressed formats");
+        return;
+    }
+
+    // NOTE: Pixels are copied in image format (any uncompressed format), all mipmap levels are rotated
+    int bytesPerPixel = GetPixelDataSize(1, 1, image->format);
+    int dataSize = 0;
+
+    for (int m = 0, width = image->width, height = image->height; m < image->mipmaps; m++)
+    {
+        dataSize += width*height*bytesPerPixel;
+        width = (width > 1)? width/2 : 1;
+        height = (height > 1)? height/2 : 1;
+    }
+
+    unsigned char *rotData = (unsigned char *)RL_MALLOC(dataSize);
+    const unsigned char *srcLevel = (const unsigned char *)image->data;
+    unsigned char *dstLevel = rotData;
+
+    for (int m = 0, width = image->width, height = image->height; m < image->mipmaps; m++)
+    {
+        for (int y = 0; y < height; y++)
+        {
+            for (int x = 0; x < width; x++)
+            {
+                memcpy(dstLevel + (x*height + (height - y - 1))*bytesPerPixel, srcLevel + (y*width + x)*bytesPerPixel, bytesPerPixel);
+            }
+        }
+
+        srcLevel += width*height*bytesPerPixel;
+        dstLevel += width*height*bytesPerPixel;
+        width = (width > 1)? width/2 : 1;
+        height = (height > 1)? height/2 : 1;
+    }
+
+    RL_FREE(image->data);
+
+    int width = image->width;
+    image->data = rotData;
+    image->width = image->height;
+    image->height = width;
+}
+
+// Rotate image counter-clockwise 90deg
+void ImageRotateCCW(Image *image)
+{
+    // Security check to avoid program crash
+    if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
+
+    if (image->format >= COMPRESSED_DXT1_RGB)
+    {
+        TraceLog(LOG_WARNING, "Image rotation not supported for compressed formats");
+        return;
+    }
+
+    // NOTE: Pixels are copied in image format (any uncompressed format), all mipmap levels are rotated
+    int bytesPerPixel = GetPixelDataSize(1, 1, image->format);
+    int dataSize = 0;
+
+    for (int m = 0, width = image->width, height = image->height; m < image->mipmaps; m++)
+    {
+        dataSize += width*height*bytesPerPixel;
+        width = (width > 1)? width/2 : 1;
+        height = (height > 1)? height/2 : 1;
+    }
+
+    unsigned char *rotData = (unsigned char *)RL_MALLOC(dataSize);
+    const unsigned char *srcLevel = (const unsigned char *)image->data;
+    unsigned char *dstLevel = rotData;
+
+    for (int m = 0, width = image->width, height = image->height; m < image->mipmaps; m++)
+    {
+        for (int y = 0; y < height; y++)
+        {
+            for (int x = 0; x < width; x++)
+            {
+                memcpy(dstLevel + ((width - x - 1)*height + y)*bytesPerPixel, srcLevel + (y*width + x)*bytesPerPixel, bytesPerPixel);
+            }
+        }
+
+        srcLevel += width*height*bytesPerPixel;
+        dstLevel += width*height*bytesPerPixel;
+        width = (width > 1)? width/2 : 1;
+        height = (height > 1)? height/2 : 1;
+    }
+
+    RL_FREE(image->data);
+
+    int width = image->width;
+    image->data = rotData;
+    image->width = image->height;
+    image->height = width;
+}
+
+// Modify image color: tint
+void ImageColorTint(Image *image, Color color)
+{
+    // Security check to avoid program crash
+    if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
+
+    // Tint 8 bit per channel formats in place
+    unsigned char lutR[256], lutG[256], lutB[256], lutA[256];
+
+    for (int i = 0; i < 256; i++)
+    {
+        lutR[i] = (unsigned char)(i*color.r/255);
+        lutG[i] = (unsigned char)(i*color.g/255);
+        lutB[i] = (unsigned char)(i*color.b/255);
+        lutA[i] = (unsigned char)(i*color.a/255);
+    }
+
+    if (ImageColorApplyLUT(image, lutR, lutG, lutB, lutA)) return;
+
+    Color *pixels = GetImageData(*image);
+
+    float cR = (float)color.r/255;
+    float cG = (float)color.g/255;
+    float cB = (float)color.b/255;
+    float cA = (float)color.a/255;
+
+    for (int y = 0; y < image->height; y++)
+    {
+        for (int x = 0; x < image->width; x++)
+        {
+            int index = y * image->width + x;
+            unsigned char r = 255*((float)pixels[index].r/255*cR);
+            unsigned char g = 255*((float)pixels[index].g/255*cG);
+            unsigned char b = 255*((float)pixels[index].b/255*cB);
+            unsigned char a = 255*((float)pixels[index].a/255*cA);
+
+            pixels[y*image->width + x].r = r;
+            pixels[y*image->width + x].g = g;
+            pixels[y*image->width + x].b = b;
+            pixels[y*image->width + x].a = a;
+        }
+    }
+
+    Image processed = LoadImageEx(pixels, image->width, image->height);
+    ImageFormat(&processed, image->format);
+    UnloadImage(*image);
+    RL_FREE(pixels);
+
+    image->data = processed.data;
+}
+
+// Modify image color: invert
+void ImageColorInvert(Image *image)
+{
+    // Security check to avoid program crash
+    if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
+
+    // Invert 8 bit per channel formats in place
+    unsigned char lut[256];
+    for (int i = 0; i < 256; i++) lut[i] = (unsigned char)(255 - i);
+
+    if (ImageColorApplyLUT(image, lut, lut, lut, NULL)) return;
+
+    Color *pixels = GetImageData(*image);
+
+    for (int y = 0; y < image->height; y++)
+    {
+        for (int x = 0; x < image->width; x++)
+        {
+            pixels[y*image->width + x].r = 255 - pixels[y*image->width + x].r;
+            pixels[y*image->width + x].g = 255 - pixels[y*image->width + x].g;
+            pixels[y*image->width + x].b = 255 - pixels[y*image->width + x].b;
+        }
+    }
+
+    Image processed = LoadImageEx(pixels, image->width, image->height);
+    ImageFormat(&processed, image->format);
+    UnloadImage(*image);
+    RL_FREE(pixels);
+
+    image->data = processed.data;
+}
+
+// Modify image color: grayscale
+void ImageColorGrayscale(Image *image)
+{
+    ImageFormat(image, UNCOMPRESSED_GRAYSCALE);
+}
+
+// Modify image color: contrast
+// NOTE: Contrast values between -100 and 100
+void ImageColorContrast(Image *image, float contrast)
+{
+    // Security check to avoid program crash
+    if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
+
+    if (contrast < -100) contrast = -100;
+    if (contrast > 100) contrast = 100;
+
+    contrast = (100.0f + contrast)/100.0f;
+    contrast *= contrast;
+
+    // Modify contrast of 8 bit per channel formats in place (same operation than below)
+    unsigned char lut[256];
+
+    for (int i = 0; i < 256; i++)
+    {
+        float value = (((float)i/255.0f - 0.5f)*contrast + 0.5f)*255.0f;
+        lut[i] = (unsigned char)((value < 0)? 0 : ((value > 255)? 255 : value));
+    }
+
+    if (ImageColorApplyLUT(image, lut, lut, lut, NULL)) return;
+
+    Color *pixels = GetImageData(*image);
+
+    for (int y = 0; y < image->height; y++)
+    {
+        for (int x = 0; x < image->width; x++)
+        {
+            float pR = (float)pixels[y*image->width + x].r/255.0f;
+            pR -= 0.5;
+            pR *= contrast;
+            pR += 0.5;
+            pR *= 255;
+            if (pR < 0) pR = 0;
+            if (pR > 255) pR = 255;
+
+            float pG = (float)pixels[y*image->width + x].g/255.0f;
+            pG -= 0.5;
+            pG *= contrast;
+            pG += 0.5;
+            pG *= 255;
+            if (pG < 0) pG = 0;
+            if (pG > 255) pG = 255;
+
+            float pB = (float)pixels[y*image->width + x].b/255.0f;
+            pB -= 0.5;
+            pB *= contrast;
+            pB += 0.5;
+            pB *= 255;
+            if (pB < 0) pB = 0;
+            if (pB > 255) pB = 255;
+
+            pixels[y*image->width + x].r = (unsigned char)pR;
+            pixels[y*image->width + x].g = (unsigned char)pG;
+            pixels[y*image->width + x].b = (unsigned char)pB;
+        }
+    }
+
+    Image processed = LoadImageEx(pixels, image->width, image->height);
+    ImageFormat(&processed, image->format);
+    UnloadImage(*image);
+    RL_FREE(pixels);
+
+    image->data = processed.data;
+}
+
+// Modify image color: brightness
+// NOTE: Brightness values between -255 and 255
+void ImageColorBrightness(Image *image, int brightness)
+{
+    // Security check to avoid program crash
+    if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
+
+    if (brightness < -255) brightness = -255;
+    if (brightness > 255) brightness = 255;
+
+    // Modify brightness of 8 bit per channel formats in place (same operation than below)
+    unsigned char lut[256];
+
+    for (int i = 0; i < 256; i++)
+    {
+        int value = i + brightness;
+        lut[i] = (unsigned char)((value < 0)? 1 : ((value > 255)? 255 : value));
+    }
+
+    if (ImageColorApplyLUT(image, lut, lut, lut, NULL)) return;
+
+    Color *pixels = GetImageData(*image);
+
+    for (int y = 0; y < image->height; y++)
+    {
+        for (int x = 0; x < image->width; x++)
+        {
+            int cR = pixels[y*image->width + x].r + brightness;
+            int cG = pixels[y*image->width + x].g + brightness;
+            int cB = pixels[y*image->width + x].b + brightness;
+
+            if (cR < 0) cR = 1;
+            if (cR > 255) cR = 255;
+
+            if (cG < 0) cG = 1;
+            if (cG > 255) cG = 255;
+
+            if (cB < 0) cB = 1;
+            if (cB > 255) cB = 255;
+
+            pixels[y*image->width + x].r = (unsigned char)cR;
+            pixels[y*image->width + x].g = (unsigned char)cG;
+            pixels[y*image->width + x].b = (unsigned char)cB;
+        }
+    }
+
+    Image processed = LoadImageEx(pixels, image->width, image->height);
+    ImageFormat(&processed, image->format);
+    UnloadImage(*image);
+    RL_FREE(pixels);
+
+    image->data = processed.data;
+}
+
+// Modify image color: replace color
+void ImageColorReplace(Image *image, Color color, Color replace)
+{
+    // Security check to avoid program crash
+    if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
+
+    int channels = GetPixelChannels(image->format);
+
+    // Replace color on 8 bit per channel formats in place
+    // NOTE: Formats without alpha are opaque (alpha = 255), grayscale pixels match gray colors (r = g = b)
+    if (channels > 0)
+    {
+        bool hasAlpha = ((channels == 2) || (channels == 4));
+        if (!hasAlpha && (color.a != 255)) return;
+        if ((channels <= 2) && ((color.r != color.g) || (color.r != color.b))) return;
+
+        unsigned char *data = (unsigned char *)image->data;
+        unsigned char gray = (unsigned char)((replace.r*299 + replace.g*587 + replace.b*114)/1000);
+
+        for (int i = 0; i < image->width*image->height; i++, data += channels)
+        {
+            if (hasAlpha && (data[channels - 1] != color.a)) continue;
+
+            if (channels <= 2)
+            {
+                if (data[0] != color.r) continue;
+                data[0] = gray;
+            }
+            else
+            {
+                if ((data[0] != color.r) || (data[1] != color.g) || (data[2] != color.b)) continue;
+                data[0] = replace.r;
+                data[1] = replace.g;
+                data[2] = replace.b;
+            }
+
+            if (hasAlpha) data[channels - 1] = replace.a;
+        }
+
+        return;
+    }
+
+    Color *pixels = GetImageData(*image);
+
+    for (int y = 0; y < image->height; y++)
+    {
+        for (int x = 0; x < image->width; x++)
+        {
+            if ((pixels[y*image->width + x].r == color.r) &&
+                (pixels[y*image->width + x].g == color.g) &&
+                (pixels[y*image->width + x].b == color.b) &&
+                (pixels[y*image->width + x].a == color.a))
+            {
+                pixels[y*image->width + x].r = replace.r;
+                pixels[y*image->width + x].g = replace.g;
+                pixels[y*image->width + x].b = replace.b;
+                pixels[y*image->width + x].a = replace.a;
+            }
+        }
+    }
+
+    Image processed = LoadImageEx(pixels, image->width, image->height);
+    ImageFormat(&processed, image->format);
+    UnloadImage(*image);
+    RL_FREE(pixels);
+
+    image->data = processed.data;
+}
+#endif      // SUPPORT_IMAGE_MANIPULATION
+
+// Generate image: plain color
+Image GenImageColor(int width, int height, Color color)
+{
+    Color *pixels = (Color *)RL_CALLOC(width*height, sizeof(Color));
+
+    for (int i = 0; i < width*height; i++) pixels[i] = color;
+
+    Image image = LoadImageEx(pixels, width, height);
+
+    RL_FREE(pixels);
+
+    return image;
+}
+
+#if defined(SUPPORT_IMAGE_GENERATION)
+// Generate image: vertical gradient
+Image GenImageGradientV(int width, int height, Color top, Color bottom)
+{
+    Color *pixels = (Color *)RL_MALLOC(width*height*sizeof(Color));
+
+    for (int j = 0; j < height; j++)
+    {
+        float factor = (float)j/(float)height;
+        for (int i = 0; i < width; i++)
+        {
+            pixels[j*width + i].r = (int)((float)bottom.r*factor + (float)top.r*(1.f - factor));
+            pixels[j*width + i].g = (int)((float)bottom.g*factor + (float)top.g*(1.f - factor));
+            pixels[j*width + i].b = (int)((float)bottom.b*factor + (float)top.b*(1.f - factor));
+            pixels[j*width + i].a = (int)((float)bottom.a*factor + (float)top.a*(1.f - factor));
+        }
+    }
+
+    Image image = LoadImageEx(pixels, width, height);
+    RL_FREE(pixels);
+
+    return image;
+}
+
+// Generate image: horizontal gradient
+Image GenImageGradientH(int width, int height, Color left, Color right)
+{
+    Color *pixels = (Color *)RL_MALLOC(width*height*sizeof(Color));
+
+    for (int i = 0; i < width; i++)
+    {
+        float factor = (float)i/(float)width;
+        for (int j = 0; j < height; j++)
+        {
+            pixels[j*width + i].r = (int)((float)right.r*factor + (float)left.r*(1.f - factor));
+            pixels[j*width + i].g = (int)((float)right.g*factor + (float)left.g*(1.f - factor));
+            pixels[j*width + i].b = (int)((float)right.b*factor + (float)left.b*(1.f - factor));
+            pixels[j*width + i].a = (int)((float)right.a*factor + (float)left.a*(1.f - factor));
+        }
+    }
+
+    Image image = LoadImageEx(pixels, width, height);
+    RL_FREE(pixels);
+
+    return image;
+}
+
+// Generate image: radial gradient
+// NOTE: Rows are generated in bands on worker threads
+Image GenImageGradientRadial(int width, int height, float density, Color inner, Color outer)
+{
+    Color *pixels = (Color *)RL_MALLOC(width*height*sizeof(Color));
+
+    ImageGenData gen = { 0 };
+    gen.pixels = pixels;
+    gen.width = width;
+    gen.height = height;
+    gen.density = density;
+    gen.inner = inner;
+    gen.outer = outer;
+
+    ProcessImageBands(GenGradientRadialRows, &gen, width, height);
+
+    // NOTE: Pixels data ownership is passed to image (no copy)
+    Image image = { pixels, width, height, 1, UNCOMPRESSED_R8G8B8A8 };
+
+    return image;
+}
+
+// Generate image: checked
+Image GenImageChecked(int width, int height, int checksX, int checksY, Color col1, Color col2)
+{
+    Color *pixels = (Color *)RL_MALLOC(width*height*sizeof(Color));
+
+    for (int y = 0; y < height; y++)
+    {
+        for (int x = 0; x < width; x++)
+        {
+            if ((x/checksX + y/checksY)%2 == 0) pixels[y*width + x] = col1;
+            else pixels[y*width + x] = col2;
+        }
+    }
+
+    Image image = LoadImageEx(pixels, width, height);
+    RL_FREE(pixels);
+
+    return image;
+}
+
+// Generate image: white noise
+Image GenImageWhiteNoise(int width, int height, float factor)
+{
+    Color *pixels = (Color *)RL_MALLOC(width*height*sizeof(Color));
+    int threshold = (int)(factor*100.0f);
+
+    // NOTE: Generated on calling thread, random values sequence must be kept (SetRandomSeed())
+    for (int i = 0; i < width*height; i++)
+    {
+        if (GetRandomValue(0, 99) < threshold) pixels[i] = WHITE;
+        else pixels[i] = BLACK;
+    }
+
+    Image image = { pixels, width, height, 1, UNCOMPRESSED_R8G8B8A8 };
+
+    return image;
+}
+
+// Generate image: perlin noise
+// NOTE: Rows are generated in bands on worker threads
+Image GenImagePerlinNoise(int width, int height, int offsetX, int offsetY, float scale)
+{
+    Color *pixels = (Color *)RL_MALLOC(width*height*sizeof(Color));
+
+    ImageGenData gen = { 0 };
+    gen.pixels = pixels;
+    gen.width = width;
+    gen.height = height;
+    gen.offsetX = offsetX;
+    gen.offsetY = offsetY;
+    gen.scale = scale;
+
+    ProcessImageBands(GenPerlinNoiseRows, &gen, width, height);
+
+    Image image = { pixels, width, height, 1, UNCOMPRESSED_R8G8B8A8 };
+
+    return image;
+}
+
+// Generate image: cellular algorithm. Bigger tileSize means bigger cells
+// NOTE: Seeds are generated on calling thread (random values sequence), rows in bands on worker threads
+Image GenImageCellular(int width, int height, int tileSize)
+{
+    Color *pixels = (Color *)RL_MALLOC(width*height*sizeof(Color));
+
+    int seedsPerRow = width/tileSize;
+    int seedsPerCol = height/tileSize;
+    int seedsCount = seedsPerRow * seedsPerCol;
+
+    int *seeds = (int *)RL_MALLOC(seedsCount*2*sizeof(int));
+
+    for (int i = 0; i < seedsCount; i++)
+    {
+        int y = (i/seedsPerRow)*tileSize + GetRandomValue(0, tileSize - 1);
+        int x = (i%seedsPerRow)*tileSize + GetRandomValue(0, tileSize - 1);
+        seeds[i*2] = x;
+        seeds[i*2 + 1] = y;
+    }
+
+    ImageGenData gen = { 0 };
+    gen.pixels = pixels;
+    gen.width = width;
+    gen.height = height;
+    gen.seeds = seeds;
+    gen.seedsPerRow = seedsPerRow;
+    gen.seedsPerCol = seedsPerCol;
+    gen.tileSize = tileSize;
+
+    ProcessImageBands(GenCellularRows, &gen, width, height);
+
+    RL_FREE(seeds);
+
+    Image image = { pixels, width, height, 1, UNCOMPRESSED_R8G8B8A8 };
+
+    return image;
+}
+#endif      // SUPPORT_IMAGE_GENERATION
+
+// Generate GPU mipmaps for a texture
+void GenTextureMipmaps(Texture2D *texture)
+{
+    // NOTE: NPOT textures support check inside function
+    // On WebGL (OpenGL ES 2.0) NPOT textures support is limited
+    ReleaseTextureSource(texture->id);
+    rlGenerateMipmaps(texture);
+
+    // Update tracked VRAM size with generated mipmaps
+    TextureResidency *entry = GetTextureResidency(texture->id);
+
+    if ((entry != NULL) && (entry->mipmaps != texture->mipmaps))
+    {
+        textureMemoryUsed -= entry->size;
+        entry->mipmaps = texture->mipmaps;
+        entry->size = 0;
+        for (int i = 0, w = entry->width, h = entry->height; i < entry->mipmaps; i++, w = (w > 1)? w/2 : 1, h = (h > 1)? h/2 : 1) entry->size += GetPixelDataSize(w, h, entry->format);
+        textureMemoryUsed += entry->size;
+    }
+}
+
+// Set texture scaling filter mode
+void SetTextureFilter(Texture2D texture, int filterMode)
+{
+    switch (filterMode)
+    {
+        case FILTER_POINT:
+        {
+            if (texture.mipmaps > 1)
+            {
+                // RL_FILTER_MIP_NEAREST - tex filter: POINT, mipmaps filter: POINT (sharp switching between mipmaps)
+                rlTextureParameters(texture.id, RL_TEXTURE_MIN_FILTER, RL_FILTER_MIP_NEAREST);
+
+                // RL_FILTER_NEAREST - tex filter: POINT (no filter), no mipmaps
+                rlTextureParameters(texture.id, RL_TEXTURE_MAG_FILTER, RL_FILTER_NEAREST);
+            }
+            else
+            {
+                // RL_FILTER_NEAREST - tex filter: POINT (no filter), no mipmaps
+                rlTextureParameters(texture.id, RL_TEXTURE_MIN_FILTER, RL_FILTER_NEAREST);
+                rlTextureParameters(texture.id, RL_TEXTURE_MAG_FILTER, RL_FILTER_NEAREST);
+            }
+        } break;
+        case FILTER_BILINEAR:
+        {
+            if (texture.mipmaps > 1)
+            {
+                // RL_FILTER_LINEAR_MIP_NEAREST - tex filter: BILINEAR, mipmaps filter: POINT (sharp switching between mipmaps)
+                // Alternative: RL_FILTER_NEAREST_MIP_LINEAR - tex filter: POINT, mipmaps filter: BILINEAR (smooth transition between mipmaps)
+                rlTextureParameters(texture.id, RL_TEXTURE_MIN_FILTER, RL_FILTER_LINEAR_MIP_NEAREST);
+
+                // RL_FILTER_LINEAR - tex filter: BILINEAR, no mipmaps
+                rlTextureParameters(texture.id, RL_TEXTURE_MAG_FILTER, RL_FILTER_LINEAR);
+            }
+            else
+            {
+                // RL_FILTER_LINEAR - tex filter: BILINEAR, no mipmaps
+                rlTextureParameters(texture.id, RL_TEXTURE_MIN_FILTER, RL_FILTER_LINEAR);
+                rlTextureParameters(texture.id, RL_TEXTURE_MAG_FILTER, RL_FILTER_LINEAR);
+            }
+        } break;
+        case FILTER_TRILINEAR:
+        {
+            if (texture.mipmaps > 1)
+            {
+                // RL_FILTER_MIP_LINEAR - tex filter: BILINEAR, mipmaps filter: BILINEAR (smooth transition between mipmaps)
+                rlTextureParameters(texture.id, RL_TEXTURE_MIN_FILTER, RL_FILTER_MIP_LINEAR);
+
+                // RL_FILTER_LINEAR - tex filter: BILINEAR, no mipmaps
+                rlTextureParameters(texture.id, RL_TEXTURE_MAG_FILTER, RL_FILTER_LINEAR);
+            }
+            else
+            {
+                TraceLog(LOG_WARNING, "[TEX ID %i] No mipmaps available for TRILINEAR texture filtering", texture.id);
+
+                // RL_FILTER_LINEAR - tex filter: BILINEAR, no mipmaps
+                rlTextureParameters(texture.id, RL_TEXTURE_MIN_FILTER, RL_FILTER_LINEAR);
+                rlTextureParameters(texture.id, RL_TEXTURE_MAG_FILTER, RL_FILTER_LINEAR);
+            }
+        } break;
+        case FILTER_ANISOTROPIC_4X: rlTextureParameters(texture.id, RL_TEXTURE_ANISOTROPIC_FILTER, 4); break;
+        case FILTER_ANISOTROPIC_8X: rlTextureParameters(texture.id, RL_TEXTURE_ANISOTROPIC_FILTER, 8); break;
+        case FILTER_ANISOTROPIC_16X: rlTextureParameters(texture.id, RL_TEXTURE_ANISOTROPIC_FILTER, 16); break;
+        default: break;
+    }
+}
+
+// Set texture wrapping mode
+void SetTextureWrap(Texture2D texture, int wrapMode)
+{
+    switch (wrapMode)
+    {
+        case WRAP_REPEAT:
+        {
+            rlTextureParameters(texture.id, RL_TEXTURE_WRAP_S, RL_WRAP_REPEAT);
+            rlTextureParameters(texture.id, RL_TEXTURE_WRAP_T, RL_WRAP_REPEAT);
+        } break;
+        case WRAP_CLAMP:
+        {
+            rlTextureParameters(texture.id, RL_TEXTURE_WRAP_S, RL_WRAP_CLAMP);
+            rlTextureParameters(texture.id, RL_TEXTURE_WRAP_T, RL_WRAP_CLAMP);
+        } break;
+        case WRAP_MIRROR_REPEAT:
+        {
+            rlTextureParameters(texture.id, RL_TEXTURE_WRAP_S, RL_WRAP_MIRROR_REPEAT);
+            rlTextureParameters(texture.id, RL_TEXTURE_WRAP_T, RL_WRAP_MIRROR_REPEAT);
+        } break;
+        case WRAP_MIRROR_CLAMP:
+        {
+            rlTextureParameters(texture.id, RL_TEXTURE_WRAP_S, RL_WRAP_MIRROR_CLAMP);
+            rlTextureParameters(texture.id, RL_TEXTURE_WRAP_T, RL_WRAP_MIRROR_CLAMP);
+        } break;
+        default: break;
+    }
+}
+
+// Draw a Texture2D
+void DrawTexture(Texture2D texture, int posX, int posY, Color tint)
+{
+    DrawTextureEx(texture, (Vector2){ (float)posX, (float)posY }, 0.0f, 1.0f, tint);
+}
+
+// Draw a Texture2D with position defined as Vector2
+void DrawTextureV(Texture2D texture, Vector2 position, Color tint)
+{
+    DrawTextureEx(texture, position, 0, 1.0f, tint);
+}
+
+// Draw a Texture2D with extended parameters
+void DrawTextureEx(Texture2D texture, Vector2 position, float rotation, float scale, Color tint)
+{
+    Rectangle sourceRec = { 0.0f, 0.0f, (float)texture.width, (float)texture.height };
+    Rectangle destRec = { position.x, position.y, (float)texture.width*scale, (float)texture.height*scale };
+    Vector2 origin = { 0.0f, 0.0f };
+
+    DrawTexturePro(texture, sourceRec, destRec, origin, rotation, tint);
+}
+
+// Draw a part of a texture (defined by a rectangle)
+void DrawTextureRec(Texture2D texture, Rectangle sourceRec, Vector2 position, Color tint)
+{
+    Rectangle destRec = { position.x, position.y, (float)fabs(sourceRec.width), (float)fabs(sourceRec.height) };
+    Vector2 origin = { 0.0f, 0.0f };
+
+    DrawTexturePro(texture, sourceRec, destRec, origin, 0.0f, tint);
+}
+
+// Draw texture quad with tiling and offset parameters
+// NOTE: Tiling and offset should be provided considering normalized texture values [0..1]
+// i.e tiling = { 1.0f, 1.0f } refers to all texture, offset = { 0.5f, 0.5f } moves texture origin to center
+void DrawTextureQuad(Texture2D texture, Vector2 tiling, Vector2 offset, Rectangle quad, Color tint)
+{
+    Rectangle source = { offset.x*texture.width, offset.y*texture.height, tiling.x*texture.width, tiling.y*texture.height };
+    Vector2 origin = { 0.0f, 0.0f };
+
+    DrawTexturePro(texture, source, quad, origin, 0.0f, tint);
+}
+
+// Draw a part of a texture (defined by a rectangle) with 'pro' parameters
+// NOTE: origin is relative to destination rectangle size
+void DrawTexturePro(Texture2D texture, Rectangle sourceRec, Rectangle destRec, Vector2 origin, float rotation, Color tint)
+{
+    // Check if texture is valid
+    if (texture.id > 0)
+    {
+        float width = (float)texture.width;
+        float height = (float)texture.height;
+
+        bool flipX = false;
+
+        if (sourceRec.width < 0) { flipX = true; sourceRec.width *= -1; }
+        if (sourceRec.height < 0) sourceRec.y -= sourceRec.height;
+
+        rlEnableTexture(texture.id);
+
+        rlPushMatrix();
+            rlTranslatef(destRec.x, destRec.y, 0.0f);
+            rlRotatef(rotation, 0.0f, 0.0f, 1.0f);
             rlTranslatef(-origin.x, -origin.y, 0.0f);
 
-            rlBegin(RL_QUADS);
-                rlColor4ub(tint.r, tint.g, tint.b, tint.a);
-                rlNormal3f(0.0f, 0.0f, 1.0f);                          // Normal vector pointing towards viewer
+            rlBegin(RL_QUADS);
+                rlColor4ub(tint.r, tint.g, tint.b, tint.a);
+                rlNormal3f(0.0f, 0.0f, 1.0f);                          // Normal vector pointing towards viewer
+
+                // Bottom-left corner for texture and quad
+                if (flipX) rlTexCoord2f((sourceRec.x + sourceRec.width)/width, sourceRec.y/height);
+                else rlTexCoord2f(sourceRec.x/width, sourceRec.y/height);
+                rlVertex2f(0.0f, 0.0f);
+
+                // Bottom-right corner for texture and quad
+                if (flipX) rlTexCoord2f((sourceRec.x + sourceRec.width)/width, (sourceRec.y + sourceRec.height)/height);
+                else rlTexCoord2f(sourceRec.x/width, (sourceRec.y + sourceRec.height)/height);
+                rlVertex2f(0.0f, destRec.height);
+
+                // Top-right corner for texture and quad
+                if (flipX) rlTexCoord2f(sourceRec.x/width, (sourceRec.y + sourceRec.height)/height);
+                else rlTexCoord2f((sourceRec.x + sourceRec.width)/width, (sourceRec.y + sourceRec.height)/height);
+                rlVertex2f(destRec.width, destRec.height);
+
+                // Top-left corner for texture and quad
+                if (flipX) rlTexCoord2f(sourceRec.x/width, sourceRec.y/height);
+                else rlTexCoord2f((sourceRec.x + sourceRec.width)/width, sourceRec.y/height);
+                rlVertex2f(destRec.width, 0.0f);
+            rlEnd();
+        rlPopMatrix();
+
+        rlDisableTexture();
+    }
+}
+
+// Draw a part of a texture array layer defined by a rectangle with 'pro' parameters
+// NOTE: Consecutive layers draws (animation frames, tiles) are batched in a single draw call
+void DrawTextureLayer(Texture2D texture, int layer, Rectangle sourceRec, Rectangle destRec, Vector2 origin, float rotation, Color tint)
+{
+    // Check if texture is valid
+    if (texture.id > 0)
+    {
+        float width = (float)texture.width;
+        float height = (float)texture.height;
+
+        bool flipX = false;
+
+        if (sourceRec.width < 0) { flipX = true; sourceRec.width *= -1; }
+        if (sourceRec.height < 0) sourceRec.y -= sourceRec.height;
+
+        rlEnableTextureArray(texture.id);
+        rlTexLayer(layer);
+
+        rlPushMatrix();
+            rlTranslatef(destRec.x, destRec.y, 0.0f);
+            rlRotatef(rotation, 0.0f, 0.0f, 1.0f);
+            rlTranslatef(-origin.x, -origin.y, 0.0f);
+
+            rlBegin(RL_QUADS);
+                rlColor4ub(tint.r, tint.g, tint.b, tint.a);
+                rlNormal3f(0.0f, 0.0f, 1.0f);                          // Normal vector pointing towards viewer
+
+                // Bottom-left corner for texture and quad
+                if (flipX) rlTexCoord2f((sourceRec.x + sourceRec.width)/width, sourceRec.y/height);
+                else rlTexCoord2f(sourceRec.x/width, sourceRec.y/height);
+                rlVertex2f(0.0f, 0.0f);
+
+                // Bottom-right corner for texture and quad
+                if (flipX) rlTexCoord2f((sourceRec.x + sourceRec.width)/width, (sourceRec.y + sourceRec.height)/height);
+                else rlTexCoord2f(sourceRec.x/width, (sourceRec.y + sourceRec.height)/height);
+                rlVertex2f(0.0f, destRec.height);
+
+                // Top-right corner for texture and quad
+                if (flipX) rlTexCoord2f(sourceRec.x/width, (sourceRec.y + sourceRec.height)/height);
+                else rlTexCoord2f((sourceRec.x + sourceRec.width)/width, (sourceRec.y + sourceRec.height)/height);
+                rlVertex2f(destRec.width, destRec.height);
+
+                // Top-left corner for texture and quad
+                if (flipX) rlTexCoord2f(sourceRec.x/width, sourceRec.y/height);
+                else rlTexCoord2f((sourceRec.x + sourceRec.width)/width, sourceRec.y/height);
+                rlVertex2f(destRec.width, 0.0f);
+            rlEnd();
+        rlPopMatrix();
+
+        rlTexLayer(0);
+        rlDisableTexture();
+    }
+}
+
+// Draws a texture (or part of it) that stretches or shrinks nicely using n-patch info
+void DrawTextureNPatch(Texture2D texture, NPatchInfo nPatchInfo, Rectangle destRec, Vector2 origin, float rotation, Color tint)
+{
+    if (texture.id > 0)
+    {
+        float width = (float)texture.width;
+        float height = (float)texture.height;
+
+        float patchWidth = (destRec.width <= 0.0f)? 0.0f : destRec.width;
+        float patchHeight = (destRec.height <= 0.0f)? 0.0f : destRec.height;
+
+        if (nPatchInfo.sourceRec.width < 0) nPatchInfo.sourceRec.x -= nPatchInfo.sourceRec.width;
+        if (nPatchInfo.sourceRec.height < 0) nPatchInfo.sourceRec.y -= nPatchInfo.sourceRec.height;
+        if (nPatchInfo.type == NPT_3PATCH_HORIZONTAL) patchHeight = nPatchInfo.sourceRec.height;
+        if (nPatchInfo.type == NPT_3PATCH_VERTICAL) patchWidth = nPatchInfo.sourceRec.width;
+
+        bool drawCenter = true;
+        bool drawMiddle = true;
+        float leftBorder = (float)nPatchInfo.left;
+        float topBorder = (float)nPatchInfo.top;
+        float rightBorder = (float)nPatchInfo.right;
+        float bottomBorder = (float)nPatchInfo.bottom;
+
+        // adjust the lateral (left and right) border widths in case patchWidth < texture.width
+        if (patchWidth <= (leftBorder + rightBorder) && nPatchInfo.type != NPT_3PATCH_VERTICAL)
+        {
+            drawCenter = false;
+            leftBorder = (leftBorder / (leftBorder + rightBorder)) * patchWidth;
+            rightBorder = patchWidth - leftBorder;
+        }
+        // adjust the lateral (top and bottom) border heights in case patchHeight < texture.height
+        if (patchHeight <= (topBorder + bottomBorder) && nPatchInfo.type != NPT_3PATCH_HORIZONTAL)
+        {
+            drawMiddle = false;
+            topBorder = (topBorder / (topBorder + bottomBorder)) * patchHeight;
+            bottomBorder = patchHeight - topBorder;
+        }
+
+        Vector2 vertA, vertB, vertC, vertD;
+        vertA.x = 0.0f;                             // outer left
+        vertA.y = 0.0f;                             // outer top
+        vertB.x = leftBorder;                       // inner left
+        vertB.y = topBorder;                        // inner top
+        vertC.x = patchWidth  - rightBorder;        // inner right
+        vertC.y = patchHeight - bottomBorder;       // inner bottom
+        vertD.x = patchWidth;                       // outer right
+        vertD.y = patchHeight;                      // outer bottom
+
+        Vector2 coordA, coordB, coordC, coordD;
+        coordA.x = nPatchInfo.sourceRec.x / width;
+        coordA.y = nPatchInfo.sourceRec.y / height;
+        coordB.x = (nPatchInfo.sourceRec.x + leftBorder) / width;
+        coordB.y = (nPatchInfo.sourceRec.y + topBorder) / height;
+        coordC.x = (nPatchInfo.sourceRec.x + nPatchInfo.sourceRec.width  - rightBorder) / width;
+        coordC.y = (nPatchInfo.sourceRec.y + nPatchInfo.sourceRec.height - bottomBorder) / height;
+        coordD.x = (nPatchInfo.sourceRec.x + nPatchInfo.sourceRec.width)  / width;
+        coordD.y = (nPatchInfo.sourceRec.y + nPatchInfo.sourceRec.height) / height;
+
+        rlEnableTexture(texture.id);
+
+        rlPushMatrix();
+            rlTranslatef(destRec.x, destRec.y, 0.0f);
+            rlRotatef(rotation, 0.0f, 0.0f, 1.0f);
+            rlTranslatef(-origin.x, -origin.y, 0.0f);
+
+            rlBegin(RL_QUADS);
+                rlColor4ub(tint.r, tint.g, tint.b, tint.a);
+                rlNormal3f(0.0f, 0.0f, 1.0f);                          // Normal vector pointing towards viewer
+
+                if (nPatchInfo.type == NPT_9PATCH)
+                {
+                    // ------------------------------------------------------------
+                    // TOP-LEFT QUAD
+                    rlTexCoord2f(coordA.x, coordB.y); rlVertex2f(vertA.x, vertB.y);  // Bottom-left corner for texture and quad
+                    rlTexCoord2f(coordB.x, coordB.y); rlVertex2f(vertB.x, vertB.y);  // Bottom-right corner for texture and quad
+                    rlTexCoord2f(coordB.x, coordA.y); rlVertex2f(vertB.x, vertA.y);  // Top-right corner for texture and quad
+                    rlTexCoord2f(coordA.x, coordA.y); rlVertex2f(vertA.x, vertA.y);  // Top-left corner for texture and quad
+                    if (drawCenter)
+                    {
+                        // TOP-CENTER QUAD
+                        rlTexCoord2f(coordB.x, coordB.y); rlVertex2f(vertB.x, vertB.y);  // Bottom-left corner for texture and quad
+                        rlTexCoord2f(coordC.x, coordB.y); rlVertex2f(vertC.x, vertB.y);  // Bottom-right corner for texture and quad
+                        rlTexCoord2f(coordC.x, coordA.y); rlVertex2f(vertC.x, vertA.y);  // Top-right corner for texture and quad
+                        rlTexCoord2f(coordB.x, coordA.y); rlVertex2f(vertB.x, vertA.y);  // Top-left corner for texture and quad
+                    }
+                    // TOP-RIGHT QUAD
+                    rlTexCoord2f(coordC.x, coordB.y); rlVertex2f(vertC.x, vertB.y);  // Bottom-left corner for texture and quad
+                    rlTexCoord2f(coordD.x, coordB.y); rlVertex2f(vertD.x, vertB.y);  // Bottom-right corner for texture and quad
+                    rlTexCoord2f(coordD.x, coordA.y); rlVertex2f(vertD.x, vertA.y);  // Top-right corner for texture and quad
+                    rlTexCoord2f(coordC.x, coordA.y); rlVertex2f(vertC.x, vertA.y);  // Top-left corner for texture and quad
+                    if (drawMiddle)
+                    {
+                        // ------------------------------------------------------------
+                        // MIDDLE-LEFT QUAD
+                        rlTexCoord2f(coordA.x, coordC.y); rlVertex2f(vertA.x, vertC.y);  // Bottom-left corner for texture and quad
+                        rlTexCoord2f(coordB.x, coordC.y); rlVertex2f(vertB.x, vertC.y);  // Bottom-right corner for texture and quad
+                        rlTexCoord2f(coordB.x, coordB.y); rlVertex2f(vertB.x, vertB.y);  // Top-right corner for texture and quad
+                        rlTexCoord2f(coordA.x, coordB.y); rlVertex2f(vertA.x, vertB.y);  // Top-left corner for texture and quad
+                        if (drawCenter)
+                        {
+                            // MIDDLE-CENTER QUAD
+                            rlTexCoord2f(coordB.x, coordC.y); rlVertex2f(vertB.x, vertC.y);  // Bottom-left corner for texture and quad
+                            rlTexCoord2f(coordC.x, coordC.y); rlVertex2f(vertC.x, vertC.y);  // Bottom-right corner for texture and quad
+                            rlTexCoord2f(coordC.x, coordB.y); rlVertex2f(vertC.x, vertB.y);  // Top-right corner for texture and quad
+                            rlTexCoord2f(coordB.x, coordB.y); rlVertex2f(vertB.x, vertB.y);  // Top-left corner for texture and quad
+                        }
+
+                        // MIDDLE-RIGHT QUAD
+                        rlTexCoord2f(coordC.x, coordC.y); rlVertex2f(vertC.x, vertC.y);  // Bottom-left corner for texture and quad
+                        rlTexCoord2f(coordD.x, coordC.y); rlVertex2f(vertD.x, vertC.y);  // Bottom-right corner for texture and quad
+                        rlTexCoord2f(coordD.x, coordB.y); rlVertex2f(vertD.x, vertB.y);  // Top-right corner for texture and quad
+                        rlTexCoord2f(coordC.x, coordB.y); rlVertex2f(vertC.x, vertB.y);  // Top-left corner for texture and quad
+                    }
+
+                    // ------------------------------------------------------------
+                    // BOTTOM-LEFT QUAD
+                    rlTexCoord2f(coordA.x, coordD.y); rlVertex2f(vertA.x, vertD.y);  // Bottom-left corner for texture and quad
+                    rlTexCoord2f(coordB.x, coordD.y); rlVertex2f(vertB.x, vertD.y);  // Bottom-right corner for texture and quad
+                    rlTexCoord2f(coordB.x, coordC.y); rlVertex2f(vertB.x, vertC.y);  // Top-right corner for texture and quad
+                    rlTexCoord2f(coordA.x, coordC.y); rlVertex2f(vertA.x, vertC.y);  // Top-left corner for texture and quad
+                    if (drawCenter)
+                    {
+                        // BOTTOM-CENTER QUAD
+                        rlTexCoord2f(coordB.x, coordD.y); rlVertex2f(vertB.x, vertD.y);  // Bottom-left corner for texture and quad
+                        rlTexCoord2f(coordC.x, coordD.y); rlVertex2f(vertC.x, vertD.y);  // Bottom-right corner for texture and quad
+                        rlTexCoord2f(coordC.x, coordC.y); rlVertex2f(vertC.x, vertC.y);  // Top-right corner for texture and quad
+                        rlTexCoord2f(coordB.x, coordC.y); rlVertex2f(vertB.x, vertC.y);  // Top-left corner for texture and quad
+                    }
+
+                    // BOTTOM-RIGHT QUAD
+                    rlTexCoord2f(coordC.x, coordD.y); rlVertex2f(vertC.x, vertD.y);  // Bottom-left corner for texture and quad
+                    rlTexCoord2f(coordD.x, coordD.y); rlVertex2f(vertD.x, vertD.y);  // Bottom-right corner for texture and quad
+                    rlTexCoord2f(coordD.x, coordC.y); rlVertex2f(vertD.x, vertC.y);  // Top-right corner for texture and quad
+                    rlTexCoord2f(coordC.x, coordC.y); rlVertex2f(vertC.x, vertC.y);  // Top-left corner for texture and quad
+                }
+                else if (nPatchInfo.type == NPT_3PATCH_VERTICAL)
+                {
+                    // TOP QUAD
+                    // -----------------------------------------------------------
+                    // Texture coords                 Vertices
+                    rlTexCoord2f(coordA.x, coordB.y); rlVertex2f(vertA.x, vertB.y);  // Bottom-left corner for texture and quad
+                    rlTexCoord2f(coordD.x, coordB.y); rlVertex2f(vertD.x, vertB.y);  // Bottom-right corner for texture and quad
+                    rlTexCoord2f(coordD.x, coordA.y); rlVertex2f(vertD.x, vertA.y);  // Top-right corner for texture and quad
+                    rlTexCoord2f(coordA.x, coordA.y); rlVertex2f(vertA.x, vertA.y);  // Top-left corner for texture and quad
+                    if (drawCenter)
+                    {
+                        // MIDDLE QUAD
+                        // -----------------------------------------------------------
+                        // Texture coords                 Vertices
+                        rlTexCoord2f(coordA.x, coordC.y); rlVertex2f(vertA.x, vertC.y);  // Bottom-left corner for texture and quad
+                        rlTexCoord2f(coordD.x, coordC.y); rlVertex2f(vertD.x, vertC.y);  // Bottom-right corner for texture and quad
+                        rlTexCoord2f(coordD.x, coordB.y); rlVertex2f(vertD.x, vertB.y);  // Top-right corner for texture and quad
+                        rlTexCoord2f(coordA.x, coordB.y); rlVertex2f(vertA.x, vertB.y);  // Top-left corner for texture and quad
+                    }
+                    // BOTTOM QUAD
+                    // -----------------------------------------------------------
+                    // Texture coords                 Vertices
+                    rlTexCoord2f(coordA.x, coordD.y); rlVertex2f(vertA.x, vertD.y);  // Bottom-left corner for texture and quad
+                    rlTexCoord2f(coordD.x, coordD.y); rlVertex2f(vertD.x, vertD.y);  // Bottom-right corner for texture and quad
+                    rlTexCoord2f(coordD.x, coordC.y); rlVertex2f(vertD.x, vertC.y);  // Top-right corner for texture and quad
+                    rlTexCoord2f(coordA.x, coordC.y); rlVertex2f(vertA.x, vertC.y);  // Top-left corner for texture and quad
+                }
+                else if (nPatchInfo.type == NPT_3PATCH_HORIZONTAL)
+                {
+                    // LEFT QUAD
+                    // -----------------------------------------------------------
+                    // Texture coords                 Vertices
+                    rlTexCoord2f(coordA.x, coordD.y); rlVertex2f(vertA.x, vertD.y);  // Bottom-left corner for texture and quad
+                    rlTexCoord2f(coordB.x, coordD.y); rlVertex2f(vertB.x, vertD.y);  // Bottom-right corner for texture and quad
+                    rlTexCoord2f(coordB.x, coordA.y); rlVertex2f(vertB.x, vertA.y);  // Top-right corner for texture and quad
+                    rlTexCoord2f(coordA.x, coordA.y); rlVertex2f(vertA.x, vertA.y);  // Top-left corner for texture and quad
+                    if (drawCenter)
+                    {
+                        // CENTER QUAD
+                        // -----------------------------------------------------------
+                        // Texture coords                 Vertices
+                        rlTexCoord2f(coordB.x, coordD.y); rlVertex2f(vertB.x, vertD.y);  // Bottom-left corner for texture and quad
+                        rlTexCoord2f(coordC.x, coordD.y); rlVertex2f(vertC.x, vertD.y);  // Bottom-right corner for texture and quad
+                        rlTexCoord2f(coordC.x, coordA.y); rlVertex2f(vertC.x, vertA.y);  // Top-right corner for texture and quad
+                        rlTexCoord2f(coordB.x, coordA.y); rlVertex2f(vertB.x, vertA.y);  // Top-left corner for texture and quad
+                    }
+                    // RIGHT QUAD
+                    // -----------------------------------------------------------
+                    // Texture coords                 Vertices
+                    rlTexCoord2f(coordC.x, coordD.y); rlVertex2f(vertC.x, vertD.y);  // Bottom-left corner for texture and quad
+                    rlTexCoord2f(coordD.x, coordD.y); rlVertex2f(vertD.x, vertD.y);  // Bottom-right corner for texture and quad
+                    rlTexCoord2f(coordD.x, coordA.y); rlVertex2f(vertD.x, vertA.y);  // Top-right corner for texture and quad
+                    rlTexCoord2f(coordC.x, coordA.y); rlVertex2f(vertC.x, vertA.y);  // Top-left corner for texture and quad
+                }
+            rlEnd();
+        rlPopMatrix();
+
+        rlDisableTexture();
+
+    }
+}
+
+//----------------------------------------------------------------------------------
+// Module specific Functions Definition
+//----------------------------------------------------------------------------------
+#if defined(SUPPORT_FILEFORMAT_GIF)
+// Load animated GIF data
+//  - Image.data buffer includes all frames: [image#0][image#1][image#2][...]
+//  - Number of frames is returned through 'frames' parameter
+//  - Frames delay is returned through 'delays' parameter (int array)
+//  - All frames are returned in RGBA format
+static Image LoadAnimatedGIF(const char *fileName, int *frames, int **delays)
+{
+    Image image = { 0 };
+
+    FILE *gifFile = fopen(fileName, "rb");
+
+    if (gifFile == NULL)
+    {
+        TraceLog(LOG_WARNING, "[%s] Animated GIF file could not be opened", fileName);
+    }
+    else
+    {
+        fseek(gifFile, 0L, SEEK_END);
+        int size = ftell(gifFile);
+        fseek(gifFile, 0L, SEEK_SET);    
+
+        unsigned char *buffer = (unsigned char *)RL_CALLOC(size, sizeof(char));    
+        fread(buffer, sizeof(char), size, gifFile);
+
+        fclose(gifFile);    // Close file pointer
+
+        int comp = 0;
+        image.data = stbi_load_gif_from_memory(buffer, size, delays, &image.width, &image.height, frames, &comp, 4);
+
+        image.mipmaps = 1;
+        image.format = UNCOMPRESSED_R8G8B8A8;
+
+        RL_FREE(buffer);
+    }
+
+    return image;
+}
+#endif
+
+#if defined(SUPPORT_FILEFORMAT_DDS)
+// Loading DDS image data (compressed or uncompressed)
+static Image LoadDDS(const char *fileName)
+{
+    // Required extension:
+    // GL_EXT_texture_compression_s3tc
+
+    // Supported tokens (defined by extensions)
+    // GL_COMPRESSED_RGB_S3TC_DXT1_EXT      0x83F0
+    // GL_COMPRESSED_RGBA_S3TC_DXT1_EXT     0x83F1
+    // GL_COMPRESSED_RGBA_S3TC_DXT3_EXT     0x83F2
+    // GL_COMPRESSED_RGBA_S3TC_DXT5_EXT     0x83F3
+
+    #define FOURCC_DXT1 0x31545844  // Equivalent to "DXT1" in ASCII
+    #define FOURCC_DXT3 0x33545844  // Equivalent to "DXT3" in ASCII
+    #define FOURCC_DXT5 0x35545844  // Equivalent to "DXT5" in ASCII
+
+    // DDS Pixel Format
+    typedef struct {
+        unsigned int size;
+        unsigned int flags;
+        unsigned int fourCC;
+        unsigned int rgbBitCount;
+        unsigned int rBitMask;
+        unsigned int gBitMask;
+        unsigned int bBitMask;
+        unsigned int aBitMask;
+    } DDSPixelFormat;
+
+    // DDS Header (124 bytes)
+    typedef struct {
+        unsigned int size;
+        unsigned int flags;
+        unsigned int height;
+        unsigned int width;
+        unsigned int pitchOrLinearSize;
+        unsigned int depth;
+        unsigned int mipmapCount;
+        unsigned int reserved1[11];
+        DDSPixelFormat ddspf;
+        unsigned int caps;
+        unsigned int caps2;
+        unsigned int caps3;
+        unsigned int caps4;
+        unsigned int reserved2;
+    } DDSHeader;
+
+    Image image = { 0 };
+
+    FILE *ddsFile = fopen(fileName, "rb");
+
+    if (ddsFile == NULL)
+    {
+        TraceLog(LOG_WARNING, "[%s] DDS file could not be opened", fileName);
+    }
+    else
+    {
+        // Verify the type of file
+        char ddsHeaderId[4];
+
+        fread(ddsHeaderId, 4, 1, ddsFile);
+
+        if ((ddsHeaderId[0] != 'D') || (ddsHeaderId[1] != 'D') || (ddsHeaderId[2] != 'S') || (ddsHeaderId[3] != ' '))
+        {
+            TraceLog(LOG_WARNING, "[%s] DDS file does not seem to be a valid image", fileName);
+        }
+        else
+        {
+            DDSHeader ddsHeader;
+
+            // Get the image header
+            fread(&ddsHeader, sizeof(DDSHeader), 1, ddsFile);
+
+            TraceLog(LOG_DEBUG, "[%s] DDS file header size: %i", fileName, sizeof(DDSHeader));
+            TraceLog(LOG_DEBUG, "[%s] DDS file pixel format size: %i", fileName, ddsHeader.ddspf.size);
+            TraceLog(LOG_DEBUG, "[%s] DDS file pixel format flags: 0x%x", fileName, ddsHeader.ddspf.flags);
+            TraceLog(LOG_DEBUG, "[%s] DDS file format: 0x%x", fileName, ddsHeader.ddspf.fourCC);
+            TraceLog(LOG_DEBUG, "[%s] DDS file bit count: 0x%x", fileName, ddsHeader.ddspf.rgbBitCount);
+
+            image.width = ddsHeader.width;
+            image.height = ddsHeader.height;
+
+            if (ddsHeader.mipmapCount == 0) image.mipmaps = 1;      // Parameter not used
+            else image.mipmaps = ddsHeader.mipmapCount;
+
+            if (ddsHeader.ddspf.rgbBitCount == 16)     // 16bit mode, no compressed
+            {
+                if (ddsHeader.ddspf.flags == 0x40)         // no alpha channel
+                {
+                    image.data = (unsigned short *)RL_MALLOC(image.width*image.height*sizeof(unsigned short));
+                    fread(image.data, image.width*image.height*sizeof(unsigned short), 1, ddsFile);
+
+                    image.format = UNCOMPRESSED_R5G6B5;
+                }
+                else if (ddsHeader.ddspf.flags == 0x41)        // with alpha channel
+                {
+                    if (ddsHeader.ddspf.aBitMask == 0x8000)    // 1bit alpha
+                    {
+                        image.data = (unsigned short *)RL_MALLOC(image.width*image.height*sizeof(unsigned short));
+                        fread(image.data, image.width*image.height*sizeof(unsigned short), 1, ddsFile);
+
+                        unsigned char alpha = 0;
+
+                        // NOTE: Data comes as A1R5G5B5, it must be reordered to R5G5B5A1
+                        for (int i = 0; i < image.width*image.height; i++)
+                        {
+                            alpha = ((unsigned short *)image.data)[i] >> 15;
+                            ((unsigned short *)image.data)[i] = ((unsigned short *)image.data)[i] << 1;
+                            ((unsigned short *)image.data)[i] += alpha;
+                        }
+
+                        image.format = UNCOMPRESSED_R5G5B5A1;
+                    }
+                    else if (ddsHeader.ddspf.aBitMask == 0xf000)   // 4bit alpha
+                    {
+                        image.data = (unsigned short *)RL_MALLOC(image.width*image.height*sizeof(unsigned short));
+                        fread(image.data, image.width*image.height*sizeof(unsigned short), 1, ddsFile);
+
+                        unsigned char alpha = 0;
+
+                        // NOTE: Data comes as A4R4G4B4, it must be reordered R4G4B4A4
+                        for (int i = 0; i < image.width*image.height; i++)
+                        {
+                            alpha = ((unsigned short *)image.data)[i] >> 12;
+                            ((unsigned short *)image.data)[i] = ((unsigned short *)image.data)[i] << 4;
+                            ((unsigned short *)image.data)[i] += alpha;
+                        }
+
+                        image.format = UNCOMPRESSED_R4G4B4A4;
+                    }
+                }
+            }
+            if (ddsHeader.ddspf.flags == 0x40 && ddsHeader.ddspf.rgbBitCount == 24)   // DDS_RGB, no compressed
+            {
+                // NOTE: not sure if this case exists...
+                image.data = (unsigned char *)RL_MALLOC(image.width*image.height*3*sizeof(unsigned char));
+                fread(image.data, image.width*image.height*3, 1, ddsFile);
+
+                image.format = UNCOMPRESSED_R8G8B8;
+            }
+            else if (ddsHeader.ddspf.flags == 0x41 && ddsHeader.ddspf.rgbBitCount == 32) // DDS_RGBA, no compressed
+            {
+                image.data = (unsigned char *)RL_MALLOC(image.width*image.height*4*sizeof(unsigned char));
+                fread(image.data, image.width*image.height*4, 1, ddsFile);
+
+                unsigned char blue = 0;
+
+                // NOTE: Data comes as A8R8G8B8, it must be reordered R8G8B8A8 (view next comment)
+                // DirecX understand ARGB as a 32bit DWORD but the actual memory byte alignment is BGRA
+                // So, we must realign B8G8R8A8 to R8G8B8A8
+                for (int i = 0; i < image.width*image.height*4; i += 4)
+                {
+                    blue = ((unsigned char *)image.data)[i];
+                    ((unsigned char *)image.data)[i] = ((unsigned char *)image.data)[i + 2];
+                    ((unsigned char *)image.data)[i + 2] = blue;
+                }
+
+                image.format = UNCOMPRESSED_R8G8B8A8;
+            }
+            else if (((ddsHeader.ddspf.flags == 0x04) || (ddsHeader.ddspf.flags == 0x05)) && (ddsHeader.ddspf.fourCC > 0)) // Compressed
+            {
+                int size;       // DDS image data size
+
+                // Calculate data size, including all mipmaps
+                if (ddsHeader.mipmapCount > 1) size = ddsHeader.pitchOrLinearSize*2;
+                else size = ddsHeader.pitchOrLinearSize;
+
+                TraceLog(LOG_DEBUG, "Pitch or linear size: %i", ddsHeader.pitchOrLinearSize);
+
+                image.data = (unsigned char *)RL_MALLOC(size*sizeof(unsigned char));
+
+                fread(image.data, size, 1, ddsFile);
+
+                switch (ddsHeader.ddspf.fourCC)
+                {
+                    case FOURCC_DXT1:
+                    {
+                        if (ddsHeader.ddspf.flags == 0x04) image.format = COMPRESSED_DXT1_RGB;
+                        else image.format = COMPRESSED_DXT1_RGBA;
+                    } break;
+                    case FOURCC_DXT3: image.format = COMPRESSED_DXT3_RGBA; break;
+                    case FOURCC_DXT5: image.format = COMPRESSED_DXT5_RGBA; break;
+                    default: break;
+                }
+            }
+        }
+
+        fclose(ddsFile);    // Close file pointer
+    }
+
+    return image;
+}
+#endif
+
+#if defined(SUPPORT_FILEFORMAT_PKM)
+// Loading PKM image data (ETC1/ETC2 compression)
+// NOTE: KTX is the standard Khronos Group compression format (ETC1/ETC2, mipmaps)
+// PKM is a much simpler file format used mainly to contain a single ETC1/ETC2 compressed image (no mipmaps)
+static Image LoadPKM(const char *fileName)
+{
+    // Required extensions:
+    // GL_OES_compressed_ETC1_RGB8_texture  (ETC1) (OpenGL ES 2.0)
+    // GL_ARB_ES3_compatibility  (ETC2/EAC) (OpenGL ES 3.0)
+
+    // Supported tokens (defined by extensions)
+    // GL_ETC1_RGB8_OES                 0x8D64
+    // GL_COMPRESSED_RGB8_ETC2          0x9274
+    // GL_COMPRESSED_RGBA8_ETC2_EAC     0x9278
+
+    // PKM file (ETC1) Header (16 bytes)
+    typedef struct {
+        char id[4];                 // "PKM "
+        char version[2];            // "10" or "20"
+        unsigned short format;      // Data format (big-endian) (Check list below)
+        unsigned short width;       // Texture width (big-endian) (origWidth rounded to multiple of 4)
+        unsigned short height;      // Texture height (big-endian) (origHeight rounded to multiple of 4)
+        unsigned short origWidth;   // Original width (big-endian)
+        unsigned short origHeight;  // Original height (big-endian)
+    } PKMHeader;
+
+    // Formats list
+    // version 10: format: 0=ETC1_RGB, [1=ETC1_RGBA, 2=ETC1_RGB_MIP, 3=ETC1_RGBA_MIP] (not used)
+    // version 20: format: 0=ETC1_RGB, 1=ETC2_RGB, 2=ETC2_RGBA_OLD, 3=ETC2_RGBA, 4=ETC2_RGBA1, 5=ETC2_R, 6=ETC2_RG, 7=ETC2_SIGNED_R, 8=ETC2_SIGNED_R
+
+    // NOTE: The extended width and height are the widths rounded up to a multiple of 4.
+    // NOTE: ETC is always 4bit per pixel (64 bit for each 4x4 block of pixels)
+
+    Image image = { 0 };
+
+    FILE *pkmFile = fopen(fileName, "rb");
+
+    if (pkmFile == NULL)
+    {
+        TraceLog(LOG_WARNING, "[%s] PKM file could not be opened", fileName);
+    }
+    else
+    {
+        PKMHeader pkmHeader;
+
+        // Get the image header
+        fread(&pkmHeader, sizeof(PKMHeader), 1, pkmFile);
+
+        if ((pkmHeader.id[0] != 'P') || (pkmHeader.id[1] != 'K') || (pkmHeader.id[2] != 'M') || (pkmHeader.id[3] != ' '))
+        {
+            TraceLog(LOG_WARNING, "[%s] PKM file does not seem to be a valid image", fileName);
+        }
+        else
+        {
+            // NOTE: format, width and height come as big-endian, data must be swapped to little-endian
+            pkmHeader.format = ((pkmHeader.format & 0x00FF) << 8) | ((pkmHeader.format & 0xFF00) >> 8);
+            pkmHeader.width = ((pkmHeader.width & 0x00FF) << 8) | ((pkmHeader.width & 0xFF00) >> 8);
+            pkmHeader.height = ((pkmHeader.height & 0x00FF) << 8) | ((pkmHeader.height & 0xFF00) >> 8);
+
+            TraceLog(LOG_DEBUG, "PKM (ETC) image width: %i", pkmHeader.width);
+            TraceLog(LOG_DEBUG, "PKM (ETC) image height: %i", pkmHeader.height);
+            TraceLog(LOG_DEBUG, "PKM (ETC) image format: %i", pkmHeader.format);
+
+            image.width = pkmHeader.width;
+            image.height = pkmHeader.height;
+            image.mipmaps = 1;
+
+            int bpp = 4;
+            if (pkmHeader.format == 3) bpp = 8;
+
+            int size = image.width*image.height*bpp/8;  // Total data size in bytes
+
+            image.data = (unsigned char *)RL_MALLOC(size*sizeof(unsigned char));
+
+            fread(image.data, size, 1, pkmFile);
+
+            if (pkmHeader.format == 0) image.format = COMPRESSED_ETC1_RGB;
+            else if (pkmHeader.format == 1) image.format = COMPRESSED_ETC2_RGB;
+            else if (pkmHeader.format == 3) image.format = COMPRESSED_ETC2_EAC_RGBA;
+        }
+
+        fclose(pkmFile);    // Close file pointer
+    }
+
+    return image;
+}
+#endif
+
+#if defined(SUPPORT_FILEFORMAT_KTX)
+// Load KTX compressed image data (ETC1/ETC2 compression)
+static Image LoadKTX(const char *fileName)
+{
+    // Required extensions:
+    // GL_OES_compressed_ETC1_RGB8_texture  (ETC1)
+    // GL_ARB_ES3_compatibility  (ETC2/EAC)
+
+    // Supported tokens (defined by extensions)
+    // GL_ETC1_RGB8_OES                 0x8D64
+    // GL_COMPRESSED_RGB8_ETC2          0x9274
+    // GL_COMPRESSED_RGBA8_ETC2_EAC     0x9278
+
+    // KTX file Header (64 bytes)
+    // v1.1 - https://www.khronos.org/opengles/sdk/tools/KTX/file_format_spec/
+    // v2.0 - http://github.khronos.org/KTX-Specification/
+
+    // TODO: Support KTX 2.2 specs!
+
+    typedef struct {
+        char id[12];                        // Identifier: "«KTX 11»\r\n\x1A\n"
+        unsigned int endianness;            // Little endian: 0x01 0x02 0x03 0x04
+        unsigned int glType;                // For compressed textures, glType must equal 0
+        unsigned int glTypeSize;            // For compressed texture data, usually 1
+        unsigned int glFormat;              // For compressed textures is 0
+        unsigned int glInternalFormat;      // Compressed internal format
+        unsigned int glBaseInternalFormat;  // Same as glFormat (RGB, RGBA, ALPHA...)
+        unsigned int width;                 // Texture image width in pixels
+        unsigned int height;                // Texture image height in pixels
+        unsigned int depth;                 // For 2D textures is 0
+        unsigned int elements;              // Number of array elements, usually 0
+        unsigned int faces;                 // Cubemap faces, for no-cubemap = 1
+        unsigned int mipmapLevels;          // Non-mipmapped textures = 1
+        unsigned int keyValueDataSize;      // Used to encode any arbitrary data...
+    } KTXHeader;
+
+    // NOTE: Before start of every mipmap data block, we have: unsigned int dataSize
+
+    Image image = { 0 };
+
+    FILE *ktxFile = fopen(fileName, "rb");
+
+    if (ktxFile == NULL)
+    {
+        TraceLog(LOG_WARNING, "[%s] KTX image file could not be opened", fileName);
+    }
+    else
+    {
+        KTXHeader ktxHeader;
+
+        // Get the image header
+        fread(&ktxHeader, sizeof(KTXHeader), 1, ktxFile);
+
+        if ((ktxHeader.id[1] != 'K') || (ktxHeader.id[2] != 'T') || (ktxHeader.id[3] != 'X') ||
+            (ktxHeader.id[4] != ' ') || (ktxHeader.id[5] != '1') || (ktxHeader.id[6] != '1'))
+        {
+            TraceLog(LOG_WARNING, "[%s] KTX file does not seem to be a valid file", fileName);
+        }
+        else
+        {
+            image.width = ktxHeader.width;
+            image.height = ktxHeader.height;
+            image.mipmaps = ktxHeader.mipmapLevels;
+
+            TraceLog(LOG_DEBUG, "KTX (ETC) image width: %i", ktxHeader.width);
+            TraceLog(LOG_DEBUG, "KTX (ETC) image height: %i", ktxHeader.height);
+            TraceLog(LOG_DEBUG, "KTX (ETC) image format: 0x%x", ktxHeader.glInternalFormat);
+
+            unsigned char unused;
+
+            if (ktxHeader.keyValueDataSize > 0)
+            {
+                for (unsigned int i = 0; i < ktxHeader.keyValueDataSize; i++) fread(&unused, sizeof(unsigned char), 1U, ktxFile);
+            }
+
+            int dataSize;
+            fread(&dataSize, sizeof(unsigned int), 1, ktxFile);
+
+            image.data = (unsigned char *)RL_MALLOC(dataSize*sizeof(unsigned char));
+
+            fread(image.data, dataSize, 1, ktxFile);
+
+            if (ktxHeader.glInternalFormat == 0x8D64) image.format = COMPRESSED_ETC1_RGB;
+            else if (ktxHeader.glInternalFormat == 0x9274) image.format = COMPRESSED_ETC2_RGB;
+            else if (ktxHeader.glInternalFormat == 0x9278) image.format = COMPRESSED_ETC2_EAC_RGBA;
+        }
+
+        fclose(ktxFile);    // Close file pointer
+    }
+
+    return image;
+}
+
+// Save image data as KTX file
+// NOTE: By default KTX 1.1 spec is used, 2.0 is still on draft (01Oct2018)
+static int SaveKTX(Image image, const char *fileName)
+{
+    int success = 0;
+
+    // KTX file Header (64 bytes)
+    // v1.1 - https://www.khronos.org/opengles/sdk/tools/KTX/file_format_spec/
+    // v2.0 - http://github.khronos.org/KTX-Specification/ - still on draft, not ready for implementation
+
+    typedef struct {
+        char id[12];                        // Identifier: "«KTX 11»\r\n\x1A\n"             // KTX 2.0: "«KTX 22»\r\n\x1A\n"
+        unsigned int endianness;            // Little endian: 0x01 0x02 0x03 0x04
+        unsigned int glType;                // For compressed textures, glType must equal 0
+        unsigned int glTypeSize;            // For compressed texture data, usually 1
+        unsigned int glFormat;              // For compressed textures is 0
+        unsigned int glInternalFormat;      // Compressed internal format
+        unsigned int glBaseInternalFormat;  // Same as glFormat (RGB, RGBA, ALPHA...)       // KTX 2.0: UInt32 vkFormat
+        unsigned int width;                 // Texture image width in pixels
+        unsigned int height;                // Texture image height in pixels
+        unsigned int depth;                 // For 2D textures is 0
+        unsigned int elements;              // Number of array elements, usually 0
+        unsigned int faces;                 // Cubemap faces, for no-cubemap = 1
+        unsigned int mipmapLevels;          // Non-mipmapped textures = 1
+        unsigned int keyValueDataSize;      // Used to encode any arbitrary data...         // KTX 2.0: UInt32 levelOrder - ordering of the mipmap levels, usually 0
+                                                                                            // KTX 2.0: UInt32 supercompressionScheme - 0 (None), 1 (Crunch CRN), 2 (Zlib DEFLATE)...
+        // KTX 2.0 defines additional header elements...
+    } KTXHeader;
+
+    // NOTE: Before start of every mipmap data block, we have: unsigned int dataSize
+
+    FILE *ktxFile = fopen(fileName, "wb");
+
+    if (ktxFile == NULL) TraceLog(LOG_WARNING, "[%s] KTX image file could not be created", fileName);
+    else
+    {
+        KTXHeader ktxHeader;
+
+        // KTX identifier (v1.1)
+        //unsigned char id[12] = { '«', 'K', 'T', 'X', ' ', '1', '1', '»', '\r', '\n', '\x1A', '\n' };
+        //unsigned char id[12] = { 0xAB, 0x4B, 0x54, 0x58, 0x20, 0x31, 0x31, 0xBB, 0x0D, 0x0A, 0x1A, 0x0A };
+
+        const char ktxIdentifier[12] = { 0xAB, 'K', 'T', 'X', ' ', '1', '1', 0xBB, '\r', '\n', 0x1A, '\n' };
+
+        // Get the image header
+        strncpy(ktxHeader.id, ktxIdentifier, 12); // KTX 1.1 signature
+        ktxHeader.endianness = 0;
+        ktxHeader.glType = 0;                     // Obtained from image.format
+        ktxHeader.glTypeSize = 1;
+        ktxHeader.glFormat = 0;                   // Obtained from image.format
+        ktxHeader.glInternalFormat = 0;           // Obtained from image.format
+        ktxHeader.glBaseInternalFormat = 0;
+        ktxHeader.width = image.width;
+        ktxHeader.height = image.height;
+        ktxHeader.depth = 0;
+        ktxHeader.elements = 0;
+        ktxHeader.faces = 1;
+        ktxHeader.mipmapLevels = image.mipmaps;   // If it was 0, it means mipmaps should be generated on loading (not for compressed formats)
+        ktxHeader.keyValueDataSize = 0;           // No extra data after the header
+
+        rlGetGlTextureFormats(image.format, &ktxHeader.glInternalFormat, &ktxHeader.glFormat, &ktxHeader.glType);   // rlgl module function
+        ktxHeader.glBaseInternalFormat = ktxHeader.glFormat;    // KTX 1.1 only
+
+        // NOTE: We can save into a .ktx all PixelFormats supported by raylib, including compressed formats like DXT, ETC or ASTC
+
+        if (ktxHeader.glFormat == -1) TraceLog(LOG_WARNING, "Image format not supported for KTX export.");
+        else
+        {
+            success = fwrite(&ktxHeader, sizeof(KTXHeader), 1, ktxFile);
+
+            int width = image.width;
+            int height = image.height;
+            int dataOffset = 0;
+
+            // Save all mipmaps data
+            for (int i = 0; i < image.mipmaps; i++)
+            {
+                unsigned int dataSize = GetPixelDataSize(width, height, image.format);
+                success = fwrite(&dataSize, sizeof(unsigned int), 1, ktxFile);
+                success = fwrite((unsigned char *)image.data + dataOffset, dataSize, 1, ktxFile);
+
+                width /= 2;
+                height /= 2;
+                dataOffset += dataSize;
+            }
+        }
+
+        fclose(ktxFile);    // Close file pointer
+    }
+
+    // If all data has been written correctly to file, success = 1
+    return success;
+}
+#endif
+
+#if defined(SUPPORT_IMAGE_EXPORT) && defined(SUPPORT_FILEFORMAT_PNG)
+// Save PNG file with a fast encoder
+// NOTE: Every row uses sub filter (no per row filter selection) and data is compressed
+// with greedy matching and fixed Huffman codes, encoding is many times faster than stb_image_write
+static int SavePNGFast(const char *fileName, const unsigned char *data, int width, int height, int channels)
+{
+    int success = 0;
+
+    if ((data == NULL) || (width <= 0) || (height <= 0) || (channels < 1) || (channels > 4)) return success;
+
+    // Filter rows with sub filter (type 1): difference with same channel of previous pixel
+    int rowSize = width*channels;
+    int filteredSize = (rowSize + 1)*height;
+    unsigned char *filtered = (unsigned char *)RL_MALLOC(filteredSize);
+
+    for (int y = 0; y < height; y++)
+    {
+        const unsigned char *row = data + (size_t)y*rowSize;
+        unsigned char *out = filtered + (size_t)y*(rowSize + 1);
+
+        out[0] = 1;
+        for (int i = 0; i < channels; i++) out[1 + i] = row[i];
+        for (int i = channels; i < rowSize; i++) out[1 + i] = (unsigned char)(row[i] - row[i - channels]);
+    }
+
+    int compDataSize = 0;
+    unsigned char *compData = DeflateDataFast(filtered, filteredSize, &compDataSize);
+
+    RL_FREE(filtered);
+
+    FILE *pngFile = fopen(fileName, "wb");
+
+    if (pngFile != NULL)
+    {
+        // CRC32 table (computed per call, no shared state between worker threads)
+        unsigned int crcTable[256] = { 0 };
+
+        for (unsigned int i = 0; i < 256; i++)
+        {
+            unsigned int c = i;
+            for (int k = 0; k < 8; k++) c = (c & 1)? (0xedb88320 ^ (c >> 1)) : (c >> 1);
+            crcTable[i] = c;
+        }
+
+        static const unsigned char colorTypes[4] = { 0, 4, 2, 6 };  // Gray, gray + alpha, RGB, RGBA
+
+        unsigned char header[8 + 25 + 8] = { 0x89, 'P', 'N', 'G', 0x0d, 0x0a, 0x1a, 0x0a,
+            0, 0, 0, 13, 'I', 'H', 'D', 'R',
+            (unsigned char)(width >> 24), (unsigned char)(width >> 16), (unsigned char)(width >> 8), (unsigned char)width,
+            (unsigned char)(height >> 24), (unsigned char)(height >> 16), (unsigned char)(height >> 8), (unsigned char)height,
+            8, colorTypes[channels - 1], 0, 0, 0, 0, 0, 0, 0,
+            (unsigned char)(compDataSize >> 24), (unsigned char)(compDataSize >> 16), (unsigned char)(compDataSize >> 8), (unsigned char)compDataSize,
+            'I', 'D', 'A', 'T' };
+
+        // IHDR chunk CRC (chunk type and data)
+        unsigned int crc = 0xffffffff;
+        for (int i = 12; i < 29; i++) crc = crcTable[(crc ^ header[i]) & 0xff] ^ (crc >> 8);
+        crc ^= 0xffffffff;
+        header[29] = (unsigned char)(crc >> 24); header[30] = (unsigned char)(crc >> 16); header[31] = (unsigned char)(crc >> 8); header[32] = (unsigned char)crc;
+
+        // IDAT chunk CRC (chunk type and compressed data)
+        crc = 0xffffffff;
+        for (int i = 37; i < 41; i++) crc = crcTable[(crc ^ header[i]) & 0xff] ^ (crc >> 8);
+        for (int i = 0; i < compDataSize; i++) crc = crcTable[(crc ^ compData[i]) & 0xff] ^ (crc >> 8);
+        crc ^= 0xffffffff;
+
+        unsigned char footer[4 + 12] = { (unsigned char)(crc >> 24), (unsigned char)(crc >> 16), (unsigned char)(crc >> 8), (unsigned char)crc,
+            0, 0, 0, 0, 'I', 'E', 'N', 'D', 0xae, 0x42, 0x60, 0x82 };
+
+        success = (fwrite(header, sizeof(header), 1, pngFile) == 1) &&
+                  (fwrite(compData, compDataSize, 1, pngFile) == 1) &&
+                  (fwrite(footer, sizeof(footer), 1, pngFile) == 1);
+
+        fclose(pngFile);
+    }
+
+    RL_FREE(compData);
+
+    return success;
+}
+
+// Compress data as zlib stream with a single fixed Huffman codes block
+// NOTE: Matches are found with a one entry hash table (last position of every 3 bytes hash),
+// no lazy matching and no hash insertion inside matches, it favors speed over compression ratio
+static unsigned char *DeflateDataFast(const unsigned char *data, int dataSize, int *compDataSize)
+{
+    #define DEFLATE_HASH_BITS       15
+    #define DEFLATE_WINDOW_SIZE     32768
+    #define DEFLATE_MAX_MATCH       258
+
+    static const unsigned short lengthBase[29] = { 3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31, 35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258 };
+    static const unsigned char lengthExtra[29] = { 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0 };
+    static const unsigned short distBase[30] = { 1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193, 257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577 };
+    static const unsigned char distExtra[30] = { 0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6, 7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13 };
+
+    // Fixed Huffman literal/length codes, bits reversed to be written LSB first
+    unsigned short litCodes[288] = { 0 };
+    unsigned char litBits[288] = { 0 };
+
+    for (int i = 0; i < 288; i++)
+    {
+        unsigned int code = 0;
+        int bits = 0;
+
+        if (i < 144) { code = 0x30 + i; bits = 8; }
+        else if (i < 256) { code = 0x190 + (i - 144); bits = 9; }
+        else if (i < 280) { code = i - 256; bits = 7; }
+        else { code = 0xc0 + (i - 280); bits = 8; }
+
+        unsigned int reversed = 0;
+        for (int b = 0; b < bits; b++) reversed |= ((code >> b) & 1) << (bits - 1 - b);
+
+        litCodes[i] = (unsigned short)reversed;
+        litBits[i] = (unsigned char)bits;
+    }
+
+    // Length symbol for every match length (0: not a valid length)
+    unsigned char lengthSymbols[DEFLATE_MAX_MATCH + 1] = { 0 };
+    for (int s = 0; s < 29; s++)
+    {
+        int last = (s < 28)? lengthBase[s + 1] : DEFLATE_MAX_MATCH + 1;
+        for (int len = lengthBase[s]; len < last; len++) lengthSymbols[len] = (unsigned char)s;
+    }
+
+    // Worst case: every byte as 9 bits literal, plus zlib header, end of block and adler32
+    unsigned char *compData = (unsigned char *)RL_MALLOC(dataSize + dataSize/8 + 64);
+    int *hashTable = (int *)RL_MALLOC((1 << DEFLATE_HASH_BITS)*sizeof(int));
+    for (int i = 0; i < (1 << DEFLATE_HASH_BITS); i++) hashTable[i] = -DEFLATE_WINDOW_SIZE - 1;
+
+    int size = 0;
+    unsigned int bitBuffer = 0;     // Pending bits, written LSB first
+    int bitCount = 0;
+
+    #define DEFLATE_WRITE_BITS(value, count) \
+    { \
+        bitBuffer |= (unsigned int)(value) << bitCount; \
+        bitCount += (count); \
+        while (bitCount >= 8) { compData[size++] = (unsigned char)bitBuffer; bitBuffer >>= 8; bitCount -= 8; } \
+    }
+
+    compData[size++] = 0x78;        // zlib header: deflate, 32K window
+    compData[size++] = 0x01;        // zlib header: fastest compression level, check bits
+    DEFLATE_WRITE_BITS(3, 3);       // Final block, fixed Huffman codes (BFINAL = 1, BTYPE = 01)
+
+    int i = 0;
+    while (i < dataSize)
+    {
+        int matchLength = 0;
+        int matchDistance = 0;
+
+        if (i + 3 <= dataSize)
+        {
+            unsigned int value = data[i] | (data[i + 1] << 8) | (data[i + 2] << 16);
+            unsigned int hash = (value*2654435761u) >> (32 - DEFLATE_HASH_BITS);
+            int candidate = hashTable[hash];
+            hashTable[hash] = i;
+
+            if ((i - candidate) <= DEFLATE_WINDOW_SIZE)
+            {
+                int maxLength = dataSize - i;
+                if (maxLength > DEFLATE_MAX_MATCH) maxLength = DEFLATE_MAX_MATCH;
+
+                const unsigned char *a = data + candidate;
+                const unsigned char *b = data + i;
+                int length = 0;
+                while ((length < maxLength) && (a[length] == b[length])) length++;
+
+                if (length >= 3)
+                {
+                    matchLength = length;
+                    matchDistance = i - candidate;
+                }
+            }
+        }
+
+        if (matchLength > 0)
+        {
+            int s = lengthSymbols[matchLength];
+            DEFLATE_WRITE_BITS(litCodes[257 + s], litBits[257 + s]);
+            if (lengthExtra[s] > 0) DEFLATE_WRITE_BITS(matchLength - lengthBase[s], lengthExtra[s]);
+
+            int d = 0;
+            while ((d < 29) && (distBase[d + 1] <= matchDistance)) d++;
+
+            // Distance codes are fixed 5 bits, bits reversed
+            unsigned int reversed = ((d & 1) << 4) | ((d & 2) << 2) | (d & 4) | ((d & 8) >> 2) | ((d & 16) >> 4);
+            DEFLATE_WRITE_BITS(reversed, 5);
+            if (distExtra[d] > 0) DEFLATE_WRITE_BITS(matchDistance - distBase[d], distExtra[d]);
+
+            i += matchLength;
+        }
+        else
+        {
+            DEFLATE_WRITE_BITS(litCodes[data[i]], litBits[data[i]]);
+            i++;
+        }
+    }
+
+    DEFLATE_WRITE_BITS(litCodes[256], litBits[256]);    // End of block
+    if (bitCount > 0) DEFLATE_WRITE_BITS(0, 8 - bitCount);
+
+    // Adler32 checksum of uncompressed data (big endian)
+    unsigned int s1 = 1, s2 = 0;
+    for (int p = 0; p < dataSize; )
+    {
+        int blockEnd = ((dataSize - p) > 5552)? p + 5552 : dataSize;
+        for (; p < blockEnd; p++) { s1 += data[p]; s2 += s1; }
+        s1 %= 65521;
+        s2 %= 65521;
+    }
+
+    compData[size++] = (unsigned char)(s2 >> 8);
+    compData[size++] = (unsigned char)s2;
+    compData[size++] = (unsigned char)(s1 >> 8);
+    compData[size++] = (unsigned char)s1;
+
+    RL_FREE(hashTable);
+
+    *compDataSize = size;
+    return compData;
+}
+#endif
+
+#if defined(SUPPORT_FILEFORMAT_PVR)
+// Loading PVR image data (uncompressed or PVRT compression)
+// NOTE: PVR v2 not supported, use PVR v3 instead
+static Image LoadPVR(const char *fileName)
+{
+    // Required extension:
+    // GL_IMG_texture_compression_pvrtc
+
+    // Supported tokens (defined by extensions)
+    // GL_COMPRESSED_RGB_PVRTC_4BPPV1_IMG       0x8C00
+    // GL_COMPRESSED_RGBA_PVRTC_4BPPV1_IMG      0x8C02
+
+#if 0   // Not used...
+    // PVR file v2 Header (52 bytes)
+    typedef struct {
+        unsigned int headerLength;
+        unsigned int height;
+        unsigned int width;
+        unsigned int numMipmaps;
+        unsigned int flags;
+        unsigned int dataLength;
+        unsigned int bpp;
+        unsigned int bitmaskRed;
+        unsigned int bitmaskGreen;
+        unsigned int bitmaskBlue;
+        unsigned int bitmaskAlpha;
+        unsigned int pvrTag;
+        unsigned int numSurfs;
+    } PVRHeaderV2;
+#endif
+
+    // PVR file v3 Header (52 bytes)
+    // NOTE: After it could be metadata (15 bytes?)
+    typedef struct {
+        char id[4];
+        unsigned int flags;
+        unsigned char channels[4];      // pixelFormat high part
+        unsigned char channelDepth[4];  // pixelFormat low part
+        unsigned int colourSpace;
+        unsigned int channelType;
+        unsigned int height;
+        unsigned int width;
+        unsigned int depth;
+        unsigned int numSurfaces;
+        unsigned int numFaces;
+        unsigned int numMipmaps;
+        unsigned int metaDataSize;
+    } PVRHeaderV3;
+
+#if 0   // Not used...
+    // Metadata (usually 15 bytes)
+    typedef struct {
+        unsigned int devFOURCC;
+        unsigned int key;
+        unsigned int dataSize;      // Not used?
+        unsigned char *data;        // Not used?
+    } PVRMetadata;
+#endif
+
+    Image image = { 0 };
+
+    FILE *pvrFile = fopen(fileName, "rb");
+
+    if (pvrFile == NULL)
+    {
+        TraceLog(LOG_WARNING, "[%s] PVR file could not be opened", fileName);
+    }
+    else
+    {
+        // Check PVR image version
+        unsigned char pvrVersion = 0;
+        fread(&pvrVersion, sizeof(unsigned char), 1, pvrFile);
+        fseek(pvrFile, 0, SEEK_SET);
+
+        // Load different PVR data formats
+        if (pvrVersion == 0x50)
+        {
+            PVRHeaderV3 pvrHeader;
+
+            // Get PVR image header
+            fread(&pvrHeader, sizeof(PVRHeaderV3), 1, pvrFile);
+
+            if ((pvrHeader.id[0] != 'P') || (pvrHeader.id[1] != 'V') || (pvrHeader.id[2] != 'R') || (pvrHeader.id[3] != 3))
+            {
+                TraceLog(LOG_WARNING, "[%s] PVR file does not seem to be a valid image", fileName);
+            }
+            else
+            {
+                image.width = pvrHeader.width;
+                image.height = pvrHeader.height;
+                image.mipmaps = pvrHeader.numMipmaps;
+
+                // Check data format
+                if (((pvrHeader.channels[0] == 'l') && (pvrHeader.channels[1] == 0)) && (pvrHeader.channelDepth[0] == 8))
+                    image.format = UNCOMPRESSED_GRAYSCALE;
+                else if (((pvrHeader.channels[0] == 'l') && (pvrHeader.channels[1] == 'a')) && ((pvrHeader.channelDepth[0] == 8) && (pvrHeader.channelDepth[1] == 8)))
+                    image.format = UNCOMPRESSED_GRAY_ALPHA;
+                else if ((pvrHeader.channels[0] == 'r') && (pvrHeader.channels[1] == 'g') && (pvrHeader.channels[2] == 'b'))
+                {
+                    if (pvrHeader.channels[3] == 'a')
+                    {
+                        if ((pvrHeader.channelDepth[0] == 5) && (pvrHeader.channelDepth[1] == 5) && (pvrHeader.channelDepth[2] == 5) && (pvrHeader.channelDepth[3] == 1))
+                            image.format = UNCOMPRESSED_R5G5B5A1;
+                        else if ((pvrHeader.channelDepth[0] == 4) && (pvrHeader.channelDepth[1] == 4) && (pvrHeader.channelDepth[2] == 4) && (pvrHeader.channelDepth[3] == 4))
+                            image.format = UNCOMPRESSED_R4G4B4A4;
+                        else if ((pvrHeader.channelDepth[0] == 8) && (pvrHeader.channelDepth[1] == 8) && (pvrHeader.channelDepth[2] == 8) && (pvrHeader.channelDepth[3] == 8))
+                            image.format = UNCOMPRESSED_R8G8B8A8;
+                    }
+                    else if (pvrHeader.channels[3] == 0)
+                    {
+                        if ((pvrHeader.channelDepth[0] == 5) && (pvrHeader.channelDepth[1] == 6) && (pvrHeader.channelDepth[2] == 5)) image.format = UNCOMPRESSED_R5G6B5;
+                        else if ((pvrHeader.channelDepth[0] == 8) && (pvrHeader.channelDepth[1] == 8) && (pvrHeader.channelDepth[2] == 8)) image.format = UNCOMPRESSED_R8G8B8;
+                    }
+                }
+                else if (pvrHeader.channels[0] == 2) image.format = COMPRESSED_PVRT_RGB;
+                else if (pvrHeader.channels[0] == 3) image.format = COMPRESSED_PVRT_RGBA;
+
+                // Skip meta data header
+                unsigned char unused = 0;
+                for (int i = 0; i < pvrHeader.metaDataSize; i++) fread(&unused, sizeof(unsigned char), 1, pvrFile);
+
+                // Calculate data size (depends on format)
+                int bpp = 0;
+
+                switch (image.format)
+                {
+                    case UNCOMPRESSED_GRAYSCALE: bpp = 8; break;
+                    case UNCOMPRESSED_GRAY_ALPHA:
+                    case UNCOMPRESSED_R5G5B5A1:
+                    case UNCOMPRESSED_R5G6B5:
+                    case UNCOMPRESSED_R4G4B4A4: bpp = 16; break;
+                    case UNCOMPRESSED_R8G8B8A8: bpp = 32; break;
+                    case UNCOMPRESSED_R8G8B8: bpp = 24; break;
+                    case COMPRESSED_PVRT_RGB:
+                    case COMPRESSED_PVRT_RGBA: bpp = 4; break;
+                    default: break;
+                }
+
+                int dataSize = image.width*image.height*bpp/8;  // Total data size in bytes
+                image.data = (unsigned char *)RL_MALLOC(dataSize*sizeof(unsigned char));
+
+                // Read data from file
+                fread(image.data, dataSize, 1, pvrFile);
+            }
+        }
+        else if (pvrVersion == 52) TraceLog(LOG_INFO, "PVR v2 not supported, update your files to PVR v3");
+
+        fclose(pvrFile);    // Close file pointer
+    }
+
+    return image;
+}
+#endif
+
+#if defined(SUPPORT_FILEFORMAT_KTX2)
+// Load KTX2 image data (uncompressed or GPU compressed: DXT, ETC1/ETC2, ASTC)
+// NOTE: Only base 2D image (first layer/face) with its mipmaps is loaded, mipmaps are stored from largest to smallest
+static Image LoadKTX2(const char *fileName)
+{
+    // KTX2 file Header (80 bytes) + levels index
+    // v2.0 - http://github.khronos.org/KTX-Specification/
+
+    // NOTE: Supercompressed data (BasisLZ, Zstandard) and UASTC (Basis universal) payloads
+    // require a transcoder, not supported, KTX2 files must store a GPU format directly
+
+    typedef struct {
+        char id[12];                        // Identifier: "«KTX 20»\r\n\x1A\n"
+        unsigned int vkFormat;              // Vulkan format (VkFormat), 0 (VK_FORMAT_UNDEFINED) for Basis universal
+        unsigned int typeSize;              // Size of data type in bytes, 1 for compressed formats
+        unsigned int pixelWidth;            // Texture image width in pixels
+        unsigned int pixelHeight;           // Texture image height in pixels
+        unsigned int pixelDepth;            // For 2D textures is 0
+        unsigned int layerCount;            // Number of array elements, for no-array = 0
+        unsigned int faceCount;             // Cubemap faces, for no-cubemap = 1
+        unsigned int levelCount;            // Number of mipmap levels, 0 to request generation
+        unsigned int supercompressionScheme;// Supercompression: 0 - None, 1 - BasisLZ, 2 - Zstandard, 3 - ZLIB
+        unsigned int dfdByteOffset;         // Data format descriptor offset
+        unsigned int dfdByteLength;         // Data format descriptor size
+        unsigned int kvdByteOffset;         // Key/value data offset
+        unsigned int kvdByteLength;         // Key/value data size
+        unsigned long long sgdByteOffset;   // Supercompression global data offset
+        unsigned long long sgdByteLength;   // Supercompression global data size
+    } KTX2Header;
+
+    typedef struct {
+        unsigned long long byteOffset;      // Level data offset (from file start)
+        unsigned long long byteLength;      // Level data size (all layers and faces)
+        unsigned long long uncompressedByteLength;  // Level data size after supercompression decoding
+    } KTX2LevelIndex;
+
+    Image image = { 0 };
+
+    FILE *ktxFile = fopen(fileName, "rb");
+
+    if (ktxFile == NULL)
+    {
+        TraceLog(LOG_WARNING, "[%s] KTX2 image file could not be opened", fileName);
+    }
+    else
+    {
+        KTX2Header ktxHeader = { 0 };
+
+        // Get the image header
+        fread(&ktxHeader, sizeof(KTX2Header), 1, ktxFile);
+
+        int format = GetKTX2PixelFormat(ktxHeader.vkFormat);
+
+        if ((ktxHeader.id[1] != 'K') || (ktxHeader.id[2] != 'T') || (ktxHeader.id[3] != 'X') ||
+            (ktxHeader.id[4] != ' ') || (ktxHeader.id[5] != '2') || (ktxHeader.id[6] != '0'))
+        {
+            TraceLog(LOG_WARNING, "[%s] KTX2 file does not seem to be a valid file", fileName);
+        }
+        else if ((ktxHeader.supercompressionScheme != 0) || (ktxHeader.vkFormat == 0))
+        {
+            TraceLog(LOG_WARNING, "[%s] KTX2 supercompressed or Basis universal data not supported (transcoder required)", fileName);
+        }
+        else if (format == 0)
+        {
+            TraceLog(LOG_WARNING, "[%s] KTX2 image format not supported (VkFormat: %i)", fileName, ktxHeader.vkFormat);
+        }
+        else
+        {
+            image.width = ktxHeader.pixelWidth;
+            image.height = ktxHeader.pixelHeight;
+            image.format = format;
+            image.mipmaps = (ktxHeader.levelCount > 0)? ktxHeader.levelCount : 1;
+
+            TraceLog(LOG_DEBUG, "KTX2 image width: %i", ktxHeader.pixelWidth);
+            TraceLog(LOG_DEBUG, "KTX2 image height: %i", ktxHeader.pixelHeight);
+            TraceLog(LOG_DEBUG, "KTX2 image format: %i (VkFormat: %i)", format, ktxHeader.vkFormat);
+
+            if ((ktxHeader.layerCount > 1) || (ktxHeader.faceCount > 1)) TraceLog(LOG_WARNING, "[%s] KTX2 array or cubemap, only first image loaded", fileName);
+
+            KTX2LevelIndex *levels = (KTX2LevelIndex *)RL_MALLOC(image.mipmaps*sizeof(KTX2LevelIndex));
+            fread(levels, sizeof(KTX2LevelIndex), image.mipmaps, ktxFile);
+
+            // Compute required data size for first image of every level
+            int dataSize = 0;
+            for (int i = 0, width = image.width, height = image.height; i < image.mipmaps; i++)
+            {
+                dataSize += GetPixelDataSize(width, height, format);
+                width = (width > 1)? width/2 : 1;
+                height = (height > 1)? height/2 : 1;
+            }
+
+            image.data = RL_MALLOC(dataSize);
+
+            // NOTE: Levels are stored in file from smallest to largest, read them in raylib order
+            unsigned char *dataPtr = (unsigned char *)image.data;
+
+            for (int i = 0, width = image.width, height = image.height; i < image.mipmaps; i++)
+            {
+                int levelSize = GetPixelDataSize(width, height, format);
+
+                if ((levels[i].byteLength < (unsigned long long)levelSize) ||
+                    (fseek(ktxFile, (long)levels[i].byteOffset, SEEK_SET) != 0) ||
+                    (fread(dataPtr, levelSize, 1, ktxFile) != 1))
+                {
+                    TraceLog(LOG_WARNING, "[%s] KTX2 mipmap level %i could not be read", fileName, i);
+
+                    // Keep valid levels loaded, base level required
+                    if (i == 0) { RL_FREE(image.data); image.data = NULL; }
+                    image.mipmaps = i;
+                    break;
+                }
+
+                dataPtr += levelSize;
+                width = (width > 1)? width/2 : 1;
+                height = (height > 1)? height/2 : 1;
+            }
+
+            RL_FREE(levels);
+
+            if ((image.data != NULL) && !rlIsTextureFormatSupported(image.format))
+            {
+                TraceLog(LOG_WARNING, "[%s] KTX2 image format not supported by GPU, texture can not be loaded", fileName);
+            }
+        }
+
+        fclose(ktxFile);    // Close file pointer
+    }
+
+    return image;
+}
+
+// Get raylib pixel format from KTX2 Vulkan format (VkFormat), UNORM and SRGB variants are mapped to same format
+static int GetKTX2PixelFormat(unsigned int vkFormat)
+{
+    int format = 0;
+
+    switch (vkFormat)
+    {
+        case 9: case 15: format = UNCOMPRESSED_GRAYSCALE; break;            // VK_FORMAT_R8_UNORM, VK_FORMAT_R8_SRGB
+        case 16: case 22: format = UNCOMPRESSED_GRAY_ALPHA; break;          // VK_FORMAT_R8G8_UNORM, VK_FORMAT_R8G8_SRGB
+        case 23: case 29: format = UNCOMPRESSED_R8G8B8; break;              // VK_FORMAT_R8G8B8_UNORM, VK_FORMAT_R8G8B8_SRGB
+        case 37: case 43: format = UNCOMPRESSED_R8G8B8A8; break;            // VK_FORMAT_R8G8B8A8_UNORM, VK_FORMAT_R8G8B8A8_SRGB
+        case 100: format = UNCOMPRESSED_R32; break;                         // VK_FORMAT_R32_SFLOAT
+        case 106: format = UNCOMPRESSED_R32G32B32; break;                   // VK_FORMAT_R32G32B32_SFLOAT
+        case 109: format = UNCOMPRESSED_R32G32B32A32; break;                // VK_FORMAT_R32G32B32A32_SFLOAT
+        case 131: case 132: format = COMPRESSED_DXT1_RGB; break;            // VK_FORMAT_BC1_RGB_UNORM_BLOCK, VK_FORMAT_BC1_RGB_SRGB_BLOCK
+        case 133: case 134: format = COMPRESSED_DXT1_RGBA; break;           // VK_FORMAT_BC1_RGBA_UNORM_BLOCK, VK_FORMAT_BC1_RGBA_SRGB_BLOCK
+        case 135: case 136: format = COMPRESSED_DXT3_RGBA; break;           // VK_FORMAT_BC2_UNORM_BLOCK, VK_FORMAT_BC2_SRGB_BLOCK
+        case 137: case 138: format = COMPRESSED_DXT5_RGBA; break;           // VK_FORMAT_BC3_UNORM_BLOCK, VK_FORMAT_BC3_SRGB_BLOCK
+        case 147: case 148: format = COMPRESSED_ETC2_RGB; break;            // VK_FORMAT_ETC2_R8G8B8_UNORM_BLOCK, VK_FORMAT_ETC2_R8G8B8_SRGB_BLOCK
+        case 151: case 152: format = COMPRESSED_ETC2_EAC_RGBA; break;       // VK_FORMAT_ETC2_R8G8B8A8_UNORM_BLOCK, VK_FORMAT_ETC2_R8G8B8A8_SRGB_BLOCK
+        case 157: case 158: format = COMPRESSED_ASTC_4x4_RGBA; break;       // VK_FORMAT_ASTC_4x4_UNORM_BLOCK, VK_FORMAT_ASTC_4x4_SRGB_BLOCK
+        case 171: case 172: format = COMPRESSED_ASTC_8x8_RGBA; break;       // VK_FORMAT_ASTC_8x8_UNORM_BLOCK, VK_FORMAT_ASTC_8x8_SRGB_BLOCK
+        default: break;
+    }
+
+    return format;
+}
+#endif
+
+#if defined(SUPPORT_FILEFORMAT_ASTC)
+// Load ASTC compressed image data (ASTC compression)
+static Image LoadASTC(const char *fileName)
+{
+    // Required extensions:
+    // GL_KHR_texture_compression_astc_hdr
+    // GL_KHR_texture_compression_astc_ldr
+
+    // Supported tokens (defined by extensions)
+    // GL_COMPRESSED_RGBA_ASTC_4x4_KHR      0x93b0
+    // GL_COMPRESSED_RGBA_ASTC_8x8_KHR      0x93b7
+
+    // ASTC file Header (16 bytes)
+    typedef struct {
+        unsigned char id[4];        // Signature: 0x13 0xAB 0xA1 0x5C
+        unsigned char blockX;       // Block X dimensions
+        unsigned char blockY;       // Block Y dimensions
+        unsigned char blockZ;       // Block Z dimensions (1 for 2D images)
+        unsigned char width[3];     // Image width in pixels (24bit value)
+        unsigned char height[3];    // Image height in pixels (24bit value)
+        unsigned char length[3];    // Image Z-size (1 for 2D images)
+    } ASTCHeader;
+
+    Image image = { 0 };
+
+    FILE *astcFile = fopen(fileName, "rb");
+
+    if (astcFile == NULL)
+    {
+        TraceLog(LOG_WARNING, "[%s] ASTC file could not be opened", fileName);
+    }
+    else
+    {
+        ASTCHeader astcHeader;
+
+        // Get ASTC image header
+        fread(&astcHeader, sizeof(ASTCHeader), 1, astcFile);
+
+        if ((astcHeader.id[3] != 0x5c) || (astcHeader.id[2] != 0xa1) || (astcHeader.id[1] != 0xab) || (astcHeader.id[0] != 0x13))
+        {
+            TraceLog(LOG_WARNING, "[%s] ASTC file does not seem to be a valid image", fileName);
+        }
+        else
+        {
+            // NOTE: Assuming Little Endian (could it be wrong?)
+            image.width = 0x00000000 | ((int)astcHeader.width[2] << 16) | ((int)astcHeader.width[1] << 8) | ((int)astcHeader.width[0]);
+            image.height = 0x00000000 | ((int)astcHeader.height[2] << 16) | ((int)astcHeader.height[1] << 8) | ((int)astcHeader.height[0]);
+
+            TraceLog(LOG_DEBUG, "ASTC image width: %i", image.width);
+            TraceLog(LOG_DEBUG, "ASTC image height: %i", image.height);
+            TraceLog(LOG_DEBUG, "ASTC image blocks: %ix%i", astcHeader.blockX, astcHeader.blockY);
+
+            image.mipmaps = 1;      // NOTE: ASTC format only contains one mipmap level
+
+            // NOTE: Each block is always stored in 128bit so we can calculate the bpp
+            int bpp = 128/(astcHeader.blockX*astcHeader.blockY);
+
+            // NOTE: Currently we only support 2 blocks configurations: 4x4 and 8x8
+            if ((bpp == 8) || (bpp == 2))
+            {
+                int dataSize = image.width*image.height*bpp/8;  // Data size in bytes
+
+                image.data = (unsigned char *)RL_MALLOC(dataSize*sizeof(unsigned char));
+                fread(image.data, dataSize, 1, astcFile);
+
+                if (bpp == 8) image.format = COMPRESSED_ASTC_4x4_RGBA;
+                else if (bpp == 2) image.format = COMPRESSED_ASTC_8x8_RGBA;
+            }
+            else TraceLog(LOG_WARNING, "[%s] ASTC block size configuration not supported", fileName);
+        }
+
+        fclose(astcFile);
+    }
+
+    return image;
+}
+#endif
+
+// Get GPU-ready image data offset in file data, image parameters are filled from file header
+// NOTE: Only GPU compressed data stored in raylib layout (mipmaps from largest to smallest, contiguous)
+// is accepted, -1 is returned otherwise (data requires conversion, LoadImage() must be used)
+static int GetImagePayloadOffset(const unsigned char *fileData, size_t fileSize, Image *image)
+{
+    #define READ_UINT(ptr) ((unsigned int)(ptr)[0] | ((unsigned int)(ptr)[1] << 8) | ((unsigned int)(ptr)[2] << 16) | ((unsigned int)(ptr)[3] << 24))
+
+    int offset = -1;
+    Image info = { 0 };
+
+#if defined(SUPPORT_FILEFORMAT_DDS)
+    if ((fileSize > 128) && (memcmp(fileData, "DDS ", 4) == 0))
+    {
+        unsigned int flags = READ_UINT(fileData + 80);
+        unsigned int fourCC = READ_UINT(fileData + 84);
+
+        info.height = READ_UINT(fileData + 12);
+        info.width = READ_UINT(fileData + 16);
+        info.mipmaps = (READ_UINT(fileData + 28) == 0)? 1 : READ_UINT(fileData + 28);
+
+        if (fourCC == 0x31545844) info.format = (flags == 0x04)? COMPRESSED_DXT1_RGB : COMPRESSED_DXT1_RGBA;  // "DXT1"
+        else if (fourCC == 0x33545844) info.format = COMPRESSED_DXT3_RGBA;  // "DXT3"
+        else if (fourCC == 0x35545844) info.format = COMPRESSED_DXT5_RGBA;  // "DXT5"
+
+        if ((flags == 0x04) || (flags == 0x05)) offset = 128;
+    }
+#endif
+#if defined(SUPPORT_FILEFORMAT_KTX)
+    if ((fileSize > 68) && (memcmp(fileData + 1, "KTX 11", 6) == 0))
+    {
+        unsigned int glInternalFormat = READ_UINT(fileData + 28);
+
+        info.width = READ_UINT(fileData + 36);
+        info.height = READ_UINT(fileData + 40);
+        info.mipmaps = 1;
+
+        if (glInternalFormat == 0x8D64) info.format = COMPRESSED_ETC1_RGB;
+        else if (glInternalFormat == 0x9274) info.format = COMPRESSED_ETC2_RGB;
+        else if (glInternalFormat == 0x9278) info.format = COMPRESSED_ETC2_EAC_RGBA;
+
+        // NOTE: Every mipmap level is preceded by its size, only single level files are contiguous
+        if ((READ_UINT(fileData + 56) <= 1) && (READ_UINT(fileData + 60) < fileSize)) offset = 64 + READ_UINT(fileData + 60) + 4;
+    }
+#endif
+#if defined(SUPPORT_FILEFORMAT_KTX2)
+    if ((fileSize > 104) && (memcmp(fileData + 1, "KTX 20", 6) == 0))
+    {
+        info.width = READ_UINT(fileData + 20);
+        info.height = READ_UINT(fileData + 24);
+        info.mipmaps = 1;
+        info.format = GetKTX2PixelFormat(READ_UINT(fileData + 12));
+
+        // NOTE: Mipmaps are stored from smallest to largest, only single level files are contiguous
+        // Level index (first level 64bit byteOffset) is just after 80 bytes header, supercompression not supported
+        if ((READ_UINT(fileData + 40) <= 1) && (READ_UINT(fileData + 44) == 0) &&
+            (READ_UINT(fileData + 84) == 0) && (READ_UINT(fileData + 80) < fileSize)) offset = (int)READ_UINT(fileData + 80);
+    }
+#endif
+#if defined(SUPPORT_FILEFORMAT_ASTC)
+    if ((fileSize > 16) && (fileData[0] == 0x13) && (fileData[1] == 0xab) && (fileData[2] == 0xa1) && (fileData[3] == 0x5c))
+    {
+        int bpp = 128/(fileData[4]*fileData[5]);
+
+        info.width = ((int)fileData[9] << 16) | ((int)fileData[8] << 8) | ((int)fileData[7]);
+        info.height = ((int)fileData[12] << 16) | ((int)fileData[11] << 8) | ((int)fileData[10]);
+        info.mipmaps = 1;
+
+        if (bpp == 8) info.format = COMPRESSED_ASTC_4x4_RGBA;
+        else if (bpp == 2) info.format = COMPRESSED_ASTC_8x8_RGBA;
+
+        offset = 16;
+    }
+#endif
+
+    // Only compressed formats are mapped: uncompressed data could be modified by image functions
+    if ((offset < 0) || (info.format < COMPRESSED_DXT1_RGB) || (info.width <= 0) || (info.height <= 0)) return -1;
+
+    // Check file contains all image data
+    size_t dataSize = 0;
+    for (int i = 0, width = info.width, height = info.height; i < info.mipmaps; i++)
+    {
+        dataSize += GetPixelDataSize(width, height, info.format);
+        width = (width > 1)? width/2 : 1;
+        height = (height > 1)? height/2 : 1;
+    }
+
+    if (((size_t)offset + dataSize) > fileSize) return -1;
+
+    *image = info;
+
+    return offset;
+}
+
+// Worker job: load image for asynchronous image job
+static void LoadImageJob(void *data)
+{
+    AsyncImageJob *job = (AsyncImageJob *)data;
+
+    if (job->fileName[0] != '\0') job->image = LoadImage(job->fileName);
+}
+
+// Get number of 8 bit channels of pixel format, 0 if format is not 8 bit per channel
+static int GetPixelChannels(int format)
+{
+    int channels = 0;
+
+    switch (format)
+    {
+        case UNCOMPRESSED_GRAYSCALE: channels = 1; break;
+        case UNCOMPRESSED_GRAY_ALPHA: channels = 2; break;
+        case UNCOMPRESSED_R8G8B8: channels = 3; break;
+        case UNCOMPRESSED_R8G8B8A8: channels = 4; break;
+        default: break;
+    }
+
+    return channels;
+}
+
+// Process image rows split in bands, bands are distributed on worker threads (calling thread processes first band)
+// NOTE: Number of bands depends on worker threads available (SetWorkerThreads()) and image size
+static void ProcessImageBands(ImageBandFunc func, void *data, int width, int height)
+{
+    int bands = GetWorkerThreads() + 1;
+    int maxBands = (int)(((long long)width*height)/MIN_IMAGE_BAND_PIXELS);
+
+    if (bands > maxBands) bands = maxBands;
+    if (bands > height) bands = height;
+    if (bands > MAX_IMAGE_BANDS) bands = MAX_IMAGE_BANDS;
+
+    if (bands <= 1)
+    {
+        func(data, 0, height);
+        return;
+    }
+
+    ImageBandJob jobs[MAX_IMAGE_BANDS] = { 0 };
+    int rowsPerBand = (height + bands - 1)/bands;
+    int pending = 0;
+
+    for (int i = 0; i < bands; i++)
+    {
+        jobs[i].func = func;
+        jobs[i].data = data;
+        jobs[i].startRow = i*rowsPerBand;
+        jobs[i].endRow = ((i + 1)*rowsPerBand < height)? (i + 1)*rowsPerBand : height;
+    }
+
+    for (int i = 1; i < bands; i++) if (jobs[i].startRow < jobs[i].endRow) SubmitWorkerJob(ImageBandJobRun, &jobs[i], &pending);
+
+    ImageBandJobRun(&jobs[0]);
+    WaitWorkerJobs(&pending);
+}
+
+// Worker job: process one image rows band
+static void ImageBandJobRun(void *data)
+{
+    ImageBandJob *job = (ImageBandJob *)data;
+
+    job->func(job->data, job->startRow, job->endRow);
+}
+
+// Convert pixel rows from 8 bit per channel format to desired format (up to UNCOMPRESSED_R8G8B8A8)
+// NOTE: Integer rounding matches float conversion results (round(value/255*max)), gray uses luminance weights
+static void ConvertPixelRows(void *data, int startRow, int endRow)
+{
+    ImageConvertData *convert = (ImageConvertData *)data;
+
+    int start = startRow*convert->width;
+    int count = (endRow - startRow)*convert->width;
+    int channels = convert->srcChannels;
+
+    // Source channels offsets, grayscale sources replicate gray value, alpha is opaque if not available
+    int offsetG = (channels >= 3)? 1 : 0;
+    int offsetB = (channels >= 3)? 2 : 0;
+    int offsetA = (channels == 4)? 3 : ((channels == 2)? 1 : -1);
+
+    const unsigned char *src = convert->src + start*channels;
+
+    #define ALPHA_THRESHOLD  50
+
+    switch (convert->dstFormat)
+    {
+        case UNCOMPRESSED_GRAYSCALE:
+        {
+            unsigned char *dst = (unsigned char *)convert->dst + start;
+
+            if (channels <= 2) for (int i = 0; i < count; i++, src += channels) dst[i] = src[0];
+            else for (int i = 0; i < count; i++, src += channels) dst[i] = (unsigned char)((src[0]*299 + src[1]*587 + src[2]*114)/1000);
+        } break;
+        case UNCOMPRESSED_GRAY_ALPHA:
+        {
+            unsigned char *dst = (unsigned char *)convert->dst + start*2;
+
+            for (int i = 0; i < count; i++, src += channels, dst += 2)
+            {
+                dst[0] = (channels <= 2)? src[0] : (unsigned char)((src[0]*299 + src[offsetG]*587 + src[offsetB]*114)/1000);
+                dst[1] = (offsetA < 0)? 255 : src[offsetA];
+            }
+        } break;
+        case UNCOMPRESSED_R5G6B5:
+        {
+            unsigned short *dst = (unsigned short *)convert->dst + start;
+
+            for (int i = 0; i < count; i++, src += channels)
+            {
+                unsigned short r = (unsigned short)((src[0]*31 + 127)/255);
+                unsigned short g = (unsigned short)((src[offsetG]*63 + 127)/255);
+                unsigned short b = (unsigned short)((src[offsetB]*31 + 127)/255);
+
+                dst[i] = r << 11 | g << 5 | b;
+            }
+        } break;
+        case UNCOMPRESSED_R8G8B8:
+        {
+            unsigned char *dst = (unsigned char *)convert->dst + start*3;
+
+            for (int i = 0; i < count; i++, src += channels, dst += 3)
+            {
+                dst[0] = src[0];
+                dst[1] = src[offsetG];
+                dst[2] = src[offsetB];
+            }
+        } break;
+        case UNCOMPRESSED_R5G5B5A1:
+        {
+            unsigned short *dst = (unsigned short *)convert->dst + start;
+
+            for (int i = 0; i < count; i++, src += channels)
+            {
+                unsigned short r = (unsigned short)((src[0]*31 + 127)/255);
+                unsigned short g = (unsigned short)((src[offsetG]*31 + 127)/255);
+                unsigned short b = (unsigned short)((src[offsetB]*31 + 127)/255);
+                unsigned short a = ((offsetA < 0) || (src[offsetA] > ALPHA_THRESHOLD))? 1 : 0;
+
+                dst[i] = r << 11 | g << 6 | b << 1 | a;
+            }
+        } break;
+        case UNCOMPRESSED_R4G4B4A4:
+        {
+            unsigned short *dst = (unsigned short *)convert->dst + start;
+
+            for (int i = 0; i < count; i++, src += channels)
+            {
+                unsigned short r = (unsigned short)((src[0]*15 + 127)/255);
+                unsigned short g = (unsigned short)((src[offsetG]*15 + 127)/255);
+                unsigned short b = (unsigned short)((src[offsetB]*15 + 127)/255);
+                unsigned short a = (offsetA < 0)? 15 : (unsigned short)((src[offsetA]*15 + 127)/255);
+
+                dst[i] = r << 12 | g << 8 | b << 4 | a;
+            }
+        } break;
+        case UNCOMPRESSED_R8G8B8A8:
+        {
+            unsigned char *dst = (unsigned char *)convert->dst + start*4;
+
+            for (int i = 0; i < count; i++, src += channels, dst += 4)
+            {
+                dst[0] = src[0];
+                dst[1] = src[offsetG];
+                dst[2] = src[offsetB];
+                dst[3] = (offsetA < 0)? 255 : src[offsetA];
+            }
+        } break;
+        default: break;
+    }
+}
+
+#if defined(SUPPORT_IMAGE_MANIPULATION)
+// Resize image output rows, every band samples full source image (bands edges could differ by 1 from single pass resize)
+// NOTE: Uses stb default scaling filters, same as stbir_resize_uint8()
+static void ResizePixelRows(void *data, int startRow, int endRow)
+{
+    ImageResizeData *resize = (ImageResizeData *)data;
 
-                if (nPatchInfo.type == NPT_9PATCH)
+    stbir_resize_region(resize->src, resize->srcWidth, resize->srcHeight, 0,
+                        resize->dst + startRow*resize->dstWidth*resize->channels, resize->dstWidth, endRow - startRow, 0,
+                        STBIR_TYPE_UINT8, resize->channels, STBIR_ALPHA_CHANNEL_NONE, 0,
+                        STBIR_EDGE_CLAMP, STBIR_EDGE_CLAMP, STBIR_FILTER_DEFAULT, STBIR_FILTER_DEFAULT, STBIR_COLORSPACE_LINEAR, NULL,
+                        0.0f, (float)startRow/(float)resize->dstHeight, 1.0f, (float)endRow/(float)resize->dstHeight);
+}
+
+// Apply per channel lookup tables in place to image data (all mipmap levels), alpha table is optional (NULL)
+// NOTE: Grayscale is transformed as RGB and converted back with luminance weights (same result than RGBA round-trip)
+// Returns false if image format is not 8 bit per channel (operation must be done through RGBA data)
+static bool ImageColorApplyLUT(Image *image, const unsigned char *lutR, const unsigned char *lutG, const unsigned char *lutB, const unsigned char *lutA)
+{
+    int channels = GetPixelChannels(image->format);
+    if (channels == 0) return false;
+
+    int pixelCount = 0;
+    for (int m = 0, width = image->width, height = image->height; m < image->mipmaps; m++)
+    {
+        pixelCount += width*height;
+        width = (width > 1)? width/2 : 1;
+        height = (height > 1)? height/2 : 1;
+    }
+
+    unsigned char *data = (unsigned char *)image->data;
+
+    if (channels <= 2)
+    {
+        unsigned char lutGray[256];
+        for (int i = 0; i < 256; i++) lutGray[i] = (unsigned char)((lutR[i]*299 + lutG[i]*587 + lutB[i]*114)/1000);
+
+        if (channels == 1) for (int i = 0; i < pixelCount; i++) data[i] = lutGray[data[i]];
+        else
+        {
+            for (int i = 0; i < pixelCount*2; i += 2)
+            {
+                data[i] = lutGray[data[i]];
+                if (lutA != NULL) data[i + 1] = lutA[data[i + 1]];
+            }
+        }
+    }
+    else
+    {
+        for (int i = 0; i < pixelCount*channels; i += channels)
+        {
+            data[i] = lutR[data[i]];
+            data[i + 1] = lutG[data[i + 1]];
+            data[i + 2] = lutB[data[i + 2]];
+            if ((channels == 4) && (lutA != NULL)) data[i + 3] = lutA[data[i + 3]];
+        }
+    }
+
+    return true;
+}
+#endif
+
+// Blend tinted RGBA pixels over RGBA pixels, same operation than ImageDraw() general path:
+// outA = srcA + dstA*(1 - srcA), outRGB = (srcRGB*srcA + dstRGB*dstA*(1 - srcA))/outA
+// NOTE: Groups of 4 pixels with opaque/transparent source or opaque destination are processed with
+// integer SIMD (SSE2/NEON), remaining pixels with floating point operation
+static void BlendPixelsRGBA(unsigned char *dst, const unsigned char *src, int count, Color tint)
+{
+    const bool tinted = ((tint.r < 255) || (tint.g < 255) || (tint.b < 255) || (tint.a < 255));
+    int i = 0;
+
+#if defined(IMAGE_SIMD_SSE2)
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i alphaMask = _mm_set1_epi32((int)0xff000000);
+    const __m128i round = _mm_set1_epi16(128);
+    const __m128i full = _mm_set1_epi16(255);
+    const __m128i tintFactor = _mm_setr_epi16(tint.r, tint.g, tint.b, tint.a, tint.r, tint.g, tint.b, tint.a);
+
+    #define DIV255_EPI16(x) _mm_srli_epi16(_mm_add_epi16(_mm_add_epi16((x), round), _mm_srli_epi16(_mm_add_epi16((x), round), 8)), 8)
+
+    for (; (i + 4) <= count; i += 4)
+    {
+        __m128i s = _mm_loadu_si128((const __m128i *)(src + i*4));
+
+        if (tinted)
+        {
+            __m128i lo = _mm_mullo_epi16(_mm_unpacklo_epi8(s, zero), tintFactor);
+            __m128i hi = _mm_mullo_epi16(_mm_unpackhi_epi8(s, zero), tintFactor);
+            s = _mm_packus_epi16(DIV255_EPI16(lo), DIV255_EPI16(hi));
+        }
+
+        __m128i srcAlpha = _mm_and_si128(s, alphaMask);
+
+        if (_mm_movemask_epi8(_mm_cmpeq_epi32(srcAlpha, zero)) == 0xffff) continue;     // Transparent source
+        if (_mm_movemask_epi8(_mm_cmpeq_epi32(srcAlpha, alphaMask)) == 0xffff)          // Opaque source
+        {
+            _mm_storeu_si128((__m128i *)(dst + i*4), s);
+            continue;
+        }
+
+        __m128i d = _mm_loadu_si128((const __m128i *)(dst + i*4));
+
+        if (_mm_movemask_epi8(_mm_cmpeq_epi32(_mm_and_si128(d, alphaMask), alphaMask)) == 0xffff)
+        {
+            // Opaque destination: out = (src*srcA + dst*(255 - srcA))/255, outA = 255
+            __m128i sLo = _mm_unpacklo_epi8(s, zero);
+            __m128i sHi = _mm_unpackhi_epi8(s, zero);
+            __m128i aLo = _mm_shufflehi_epi16(_mm_shufflelo_epi16(sLo, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(3, 3, 3, 3));
+            __m128i aHi = _mm_shufflehi_epi16(_mm_shufflelo_epi16(sHi, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(3, 3, 3, 3));
+
+            __m128i lo = _mm_add_epi16(_mm_mullo_epi16(sLo, aLo), _mm_mullo_epi16(_mm_unpacklo_epi8(d, zero), _mm_sub_epi16(full, aLo)));
+            __m128i hi = _mm_add_epi16(_mm_mullo_epi16(sHi, aHi), _mm_mullo_epi16(_mm_unpackhi_epi8(d, zero), _mm_sub_epi16(full, aHi)));
+
+            _mm_storeu_si128((__m128i *)(dst + i*4), _mm_or_si128(_mm_packus_epi16(DIV255_EPI16(lo), DIV255_EPI16(hi)), alphaMask));
+            continue;
+        }
+
+        for (int k = i; k < (i + 4); k++) BlendPixelRGBA(dst + k*4, src + k*4, tint, tinted);  // General blending
+    }
+
+    #undef DIV255_EPI16
+#elif defined(IMAGE_SIMD_NEON)
+    const uint8x8_t tintFactor = { tint.r, tint.g, tint.b, tint.a, tint.r, tint.g, tint.b, tint.a };
+    const uint8x8_t alphaIndex = { 3, 3, 3, 3, 7, 7, 7, 7 };
+    const uint32x4_t alphaMask = vdupq_n_u32(0xff000000);
+    const uint16x8_t round = vdupq_n_u16(128);
+
+    #define DIV255_U16(x) vmovn_u16(vshrq_n_u16(vaddq_u16(vaddq_u16((x), round), vshrq_n_u16(vaddq_u16((x), round), 8)), 8))
+    #define ALL_LANES(x) (vget_lane_u64(vreinterpret_u64_u32(vand_u32(vget_low_u32(x), vget_high_u32(x))), 0) == 0xffffffffffffffffULL)
+
+    for (; (i + 4) <= count; i += 4)
+    {
+        uint8x16_t s = vld1q_u8(src + i*4);
+
+        if (tinted) s = vcombine_u8(DIV255_U16(vmull_u8(vget_low_u8(s), tintFactor)), DIV255_U16(vmull_u8(vget_high_u8(s), tintFactor)));
+
+        uint32x4_t srcAlpha = vandq_u32(vreinterpretq_u32_u8(s), alphaMask);
+
+        if (ALL_LANES(vceqq_u32(srcAlpha, vdupq_n_u32(0)))) continue;     // Transparent source
+        if (ALL_LANES(vceqq_u32(srcAlpha, alphaMask)))                   // Opaque source
+        {
+            vst1q_u8(dst + i*4, s);
+            continue;
+        }
+
+        uint8x16_t d = vld1q_u8(dst + i*4);
+
+        if (ALL_LANES(vceqq_u32(vandq_u32(vreinterpretq_u32_u8(d), alphaMask), alphaMask)))
+        {
+            // Opaque destination: out = (src*srcA + dst*(255 - srcA))/255, outA = 255
+            uint8x8_t aLo = vtbl1_u8(vget_low_u8(s), alphaIndex);
+            uint8x8_t aHi = vtbl1_u8(vget_high_u8(s), alphaIndex);
+
+            uint16x8_t lo = vmlal_u8(vmull_u8(vget_low_u8(s), aLo), vget_low_u8(d), vmvn_u8(aLo));
+            uint16x8_t hi = vmlal_u8(vmull_u8(vget_high_u8(s), aHi), vget_high_u8(d), vmvn_u8(aHi));
+
+            vst1q_u8(dst + i*4, vorrq_u8(vcombine_u8(DIV255_U16(lo), DIV255_U16(hi)), vreinterpretq_u8_u32(alphaMask)));
+            continue;
+        }
+
+        for (int k = i; k < (i + 4); k++) BlendPixelRGBA(dst + k*4, src + k*4, tint, tinted);  // General blending
+    }
+
+    #undef DIV255_U16
+    #undef ALL_LANES
+#endif
+
+    for (; i < count; i++) BlendPixelRGBA(dst + i*4, src + i*4, tint, tinted);
+}
+
+// Blend one tinted RGBA pixel over RGBA pixel (general path of BlendPixelsRGBA())
+static void BlendPixelRGBA(unsigned char *d, const unsigned char *s, Color tint, bool tinted)
+{
+    unsigned char sr = s[0], sg = s[1], sb = s[2], sa = s[3];
+
+    if (tinted)
+    {
+        sr = (unsigned char)((sr*tint.r + 127)/255);
+        sg = (unsigned char)((sg*tint.g + 127)/255);
+        sb = (unsigned char)((sb*tint.b + 127)/255);
+        sa = (unsigned char)((sa*tint.a + 127)/255);
+    }
+
+    if (sa == 0) return;
+    if (sa == 255) { d[0] = sr; d[1] = sg; d[2] = sb; d[3] = 255; return; }
+
+    if (d[3] == 255)
+    {
+        d[0] = (unsigned char)((sr*sa + d[0]*(255 - sa) + 127)/255);
+        d[1] = (unsigned char)((sg*sa + d[1]*(255 - sa) + 127)/255);
+        d[2] = (unsigned char)((sb*sa + d[2]*(255 - sa) + 127)/255);
+        return;
+    }
+
+    // General alpha blending (https://en.wikipedia.org/wiki/Alpha_compositing)
+    float fsa = (float)sa/255.0f;
+    float fda = (float)d[3]/255.0f;
+    float outA = fsa + fda*(1.0f - fsa);
+
+    d[0] = (unsigned char)(((float)sr*fsa + (float)d[0]*fda*(1.0f - fsa))/outA);
+    d[1] = (unsigned char)(((float)sg*fsa + (float)d[1]*fda*(1.0f - fsa))/outA);
+    d[2] = (unsigned char)(((float)sb*fsa + (float)d[2]*fda*(1.0f - fsa))/outA);
+    d[3] = (unsigned char)(outA*255.0f);
+}
+
+// Read image pixel data into Color array
+// NOTE: Array must fit image.width*image.height colors, callers choose where it is allocated
+static void ReadImagePixels(Image image, Color *pixels)
+{
+    if (image.format >= COMPRESSED_DXT1_RGB) TraceLog(LOG_WARNING, "Pixel data retrieval not supported for compressed image formats");
+    else
+    {
+        if ((image.format == UNCOMPRESSED_R32) ||
+            (image.format == UNCOMPRESSED_R32G32B32) ||
+            (image.format == UNCOMPRESSED_R32G32B32A32)) TraceLog(LOG_WARNING, "32bit pixel format converted to 8bit per channel");
+
+        for (int i = 0, k = 0; i < image.width*image.height; i++)
+        {
+            switch (image.format)
+            {
+                case UNCOMPRESSED_GRAYSCALE:
                 {
-                    // ------------------------------------------------------------
-                    // TOP-LEFT QUAD
-                    rlTexCoord2f(coordA.x, coordB.y); rlVertex2f(vertA.x, vertB.y);  // Bottom-left corner for texture and quad
-                    rlTexCoord2f(coordB.x, coordB.y); rlVertex2f(vertB.x, vertB.y);  // Bottom-right corner for texture and quad
-                    rlTexCoord2f(coordB.x, coordA.y); rlVertex2f(vertB.x, vertA.y);  // Top-right corner for texture and quad
-                    rlTexCoord2f(coordA.x, coordA.y); rlVertex2f(vertA.x, vertA.y);  // Top-left corner for texture and quad
-                    if (drawCenter)
-                    {
-                        // TOP-CENTER QUAD
-                        rlTexCoord2f(coordB.x, coordB.y); rlVertex2f(vertB.x, vertB.y);  // Bottom-left corner for texture and quad
-                        rlTexCoord2f(coordC.x, coordB.y); rlVertex2f(vertC.x, vertB.y);  // Bottom-right corner for texture and quad
-                        rlTexCoord2f(coordC.x, coordA.y); rlVertex2f(vertC.x, vertA.y);  // Top-right corner for texture and quad
-                        rlTexCoord2f(coordB.x, coordA.y); rlVertex2f(vertB.x, vertA.y);  // Top-left corner for texture and quad
-                    }
-                    // TOP-RIGHT QUAD
-                    rlTexCoord2f(coordC.x, coordB.y); rlVertex2f(vertC.x, vertB.y);  // Bottom-left corner for texture and quad
-                    rlTexCoord2f(coordD.x, coordB.y); rlVertex2f(vertD.x, vertB.y);  // Bottom-right corner for texture and quad
-                    rlTexCoord2f(coordD.x, coordA.y); rlVertex2f(vertD.x, vertA.y);  // Top-right corner for texture and quad
-                    rlTexCoord2f(coordC.x, coordA.y); rlVertex2f(vertC.x, vertA.y);  // Top-left corner for texture and quad
-                    if (drawMiddle)
-                    {
-                        // ------------------------------------------------------------
-                        // MIDDLE-LEFT QUAD
-                        rlTexCoord2f(coordA.x, coordC.y); rlVertex2f(vertA.x, vertC.y);  // Bottom-left corner for texture and quad
-                        rlTexCoord2f(coordB.x, coordC.y); rlVertex2f(vertB.x, vertC.y);  // Bottom-right corner for texture and quad
-                        rlTexCoord2f(coordB.x, coordB.y); rlVertex2f(vertB.x, vertB.y);  // Top-right corner for texture and quad
-                        rlTexCoord2f(coordA.x, coordB.y); rlVertex2f(vertA.x, vertB.y);  // Top-left corner for texture and quad
-                        if (drawCenter)
-                        {
-                            // MIDDLE-CENTER QUAD
-                            rlTexCoord2f(coordB.x, coordC.y); rlVertex2f(vertB.x, vertC.y);  // Bottom-left corner for texture and quad
-                            rlTexCoord2f(coordC.x, coordC.y); rlVertex2f(vertC.x, vertC.y);  // Bottom-right corner for texture and quad
-                            rlTexCoord2f(coordC.x, coordB.y); rlVertex2f(vertC.x, vertB.y);  // Top-right corner for texture and quad
-                            rlTexCoord2f(coordB.x, coordB.y); rlVertex2f(vertB.x, vertB.y);  // Top-left corner for texture and quad
-                        }
+                    pixels[i].r = ((unsigned char *)image.data)[i];
+                    pixels[i].g = ((unsigned char *)image.data)[i];
+                    pixels[i].b = ((unsigned char *)image.data)[i];
+                    pixels[i].a = 255;
 
-                        // MIDDLE-RIGHT QUAD
-                        rlTexCoord2f(coordC.x, coordC.y); rlVertex2f(vertC.x, vertC.y);  // Bottom-left corner for texture and quad
-                        rlTexCoord2f(coordD.x, coordC.y); rlVertex2f(vertD.x, vertC.y);  // Bottom-right corner for texture and quad
-                        rlTexCoord2f(coordD.x, coordB.y); rlVertex2f(vertD.x, vertB.y);  // Top-right corner for texture and quad
-                        rlTexCoord2f(coordC.x, coordB.y); rlVertex2f(vertC.x, vertB.y);  // Top-left corner for texture and quad
-                    }
+                } break;
+                case UNCOMPRESSED_GRAY_ALPHA:
+                {
+                    pixels[i].r = ((unsigned char *)image.data)[k];
+                    pixels[i].g = ((unsigned char *)image.data)[k];
+                    pixels[i].b = ((unsigned char *)image.data)[k];
+                    pixels[i].a = ((unsigned char *)image.data)[k + 1];
 
-                    // ------------------------------------------------------------
-                    // BOTTOM-LEFT QUAD
-                    rlTexCoord2f(coordA.x, coordD.y); rlVertex2f(vertA.x, vertD.y);  // Bottom-left corner for texture and quad
-                    rlTexCoord2f(coordB.x, coordD.y); rlVertex2f(vertB.x, vertD.y);  // Bottom-right corner for texture and quad
-                    rlTexCoord2f(coordB.x, coordC.y); rlVertex2f(vertB.x, vertC.y);  // Top-right corner for texture and quad
-                    rlTexCoord2f(coordA.x, coordC.y); rlVertex2f(vertA.x, vertC.y);  // Top-left corner for texture and quad
-                    if (drawCenter)
-                    {
-                        // BOTTOM-CENTER QUAD
-                        rlTexCoord2f(coordB.x, coordD.y); rlVertex2f(vertB.x, vertD.y);  // Bottom-left corner for texture and quad
-                        rlTexCoord2f(coordC.x, coordD.y); rlVertex2f(vertC.x, vertD.y);  // Bottom-right corner for texture and quad
-                        rlTexCoord2f(coordC.x, coordC.y); rlVertex2f(vertC.x, vertC.y);  // Top-right corner for texture and quad
-                        rlTexCoord2f(coordB.x, coordC.y); rlVertex2f(vertB.x, vertC.y);  // Top-left corner for texture and quad
-                    }
+                    k += 2;
+                } break;
+                case UNCOMPRESSED_R5G5B5A1:
+                {
+                    unsigned short pixel = ((unsigned short *)image.data)[i];
 
-                    // BOTTOM-RIGHT QUAD
-                    rlTexCoord2f(coordC.x, coordD.y); rlVertex2f(vertC.x, vertD.y);  // Bottom-left corner for texture and quad
-                    rlTexCoord2f(coordD.x, coordD.y); rlVertex2f(vertD.x, vertD.y);  // Bottom-right corner for texture and quad
-                    rlTexCoord2f(coordD.x, coordC.y); rlVertex2f(vertD.x, vertC.y);  // Top-right corner for texture and quad
-                    rlTexCoord2f(coordC.x, coordC.y); rlVertex2f(vertC.x, vertC.y);  // Top-left corner for texture and quad
-                }
-                else if (nPatchInfo.type == NPT_3PATCH_VERTICAL)
+                    pixels[i].r = (unsigned char)((float)((pixel & 0b1111100000000000) >> 11)*(255/31));
+                    pixels[i].g = (unsigned char)((float)((pixel & 0b0000011111000000) >> 6)*(255/31));
+                    pixels[i].b = (unsigned char)((float)((pixel & 0b0000000000111110) >> 1)*(255/31));
+                    pixels[i].a = (unsigned char)((pixel & 0b0000000000000001)*255);
+
+                } break;
+                case UNCOMPRESSED_R5G6B5:
                 {
-                    // TOP QUAD
-                    // -----------------------------------------------------------
-                    // Texture coords                 Vertices
-                    rlTexCoord2f(coordA.x, coordB.y); rlVertex2f(vertA.x, vertB.y);  // Bottom-left corner for texture and quad
-                    rlTexCoord2f(coordD.x, coordB.y); rlVertex2f(vertD.x, vertB.y);  // Bottom-right corner for texture and quad
-                    rlTexCoord2f(coordD.x, coordA.y); rlVertex2f(vertD.x, vertA.y);  // Top-right corner for texture and quad
-                    rlTexCoord2f(coordA.x, coordA.y); rlVertex2f(vertA.x, vertA.y);  // Top-left corner for texture and quad
-                    if (drawCenter)
-                    {
-                        // MIDDLE QUAD
-                        // -----------------------------------------------------------
-                        // Texture coords                 Vertices
-                        rlTexCoord2f(coordA.x, coordC.y); rlVertex2f(vertA.x, vertC.y);  // Bottom-left corner for texture and quad
-                        rlTexCoord2f(coordD.x, coordC.y); rlVertex2f(vertD.x, vertC.y);  // Bottom-right corner for texture and quad
-                        rlTexCoord2f(coordD.x, coordB.y); rlVertex2f(vertD.x, vertB.y);  // Top-right corner for texture and quad
-                        rlTexCoord2f(coordA.x, coordB.y); rlVertex2f(vertA.x, vertB.y);  // Top-left corner for texture and quad
-                    }
-                    // BOTTOM QUAD
-                    // -----------------------------------------------------------
-                    // Texture coords                 Vertices
-                    rlTexCoord2f(coordA.x, coordD.y); rlVertex2f(vertA.x, vertD.y);  // Bottom-left corner for texture and quad
-                    rlTexCoord2f(coordD.x, coordD.y); rlVertex2f(vertD.x, vertD.y);  // Bottom-right corner for texture and quad
-                    rlTexCoord2f(coordD.x, coordC.y); rlVertex2f(vertD.x, vertC.y);  // Top-right corner for texture and quad
-                    rlTexCoord2f(coordA.x, coordC.y); rlVertex2f(vertA.x, vertC.y);  // Top-left corner for texture and quad
-                }
-                else if (nPatchInfo.type == NPT_3PATCH_HORIZONTAL)
+                    unsigned short pixel = ((unsigned short *)image.data)[i];
+
+                    pixels[i].r = (unsigned char)((float)((pixel & 0b1111100000000000) >> 11)*(255/31));
+                    pixels[i].g = (unsigned char)((float)((pixel & 0b0000011111100000) >> 5)*(255/63));
+                    pixels[i].b = (unsigned char)((float)(pixel & 0b0000000000011111)*(255/31));
+                    pixels[i].a = 255;
+
+                } break;
+                case UNCOMPRESSED_R4G4B4A4:
+                {
+                    unsigned short pixel = ((unsigned short *)image.data)[i];
+
+                    pixels[i].r = (unsigned char)((float)((pixel & 0b1111000000000000) >> 12)*(255/15));
+                    pixels[i].g = (unsigned char)((float)((pixel & 0b0000111100000000) >> 8)*(255/15));
+                    pixels[i].b = (unsigned char)((float)((pixel & 0b0000000011110000) >> 4)*(255/15));
+                    pixels[i].a = (unsigned char)((float)(pixel & 0b0000000000001111)*(255/15));
+
+                } break;
+                case UNCOMPRESSED_R8G8B8A8:
+                {
+                    pixels[i].r = ((unsigned char *)image.data)[k];
+                    pixels[i].g = ((unsigned char *)image.data)[k + 1];
+                    pixels[i].b = ((unsigned char *)image.data)[k + 2];
+                    pixels[i].a = ((unsigned char *)image.data)[k + 3];
+
+                    k += 4;
+                } break;
+                case UNCOMPRESSED_R8G8B8:
+                {
+                    pixels[i].r = (unsigned char)((unsigned char *)image.data)[k];
+                    pixels[i].g = (unsigned char)((unsigned char *)image.data)[k + 1];
+                    pixels[i].b = (unsigned char)((unsigned char *)image.data)[k + 2];
+                    pixels[i].a = 255;
+
+                    k += 3;
+                } break;
+                case UNCOMPRESSED_R32:
+                {
+                    pixels[i].r = (unsigned char)(((float *)image.data)[k]*255.0f);
+                    pixels[i].g = 0;
+                    pixels[i].b = 0;
+                    pixels[i].a = 255;
+
+                } break;
+                case UNCOMPRESSED_R32G32B32:
                 {
-                    // LEFT QUAD
-                    // -----------------------------------------------------------
-                    // Texture coords                 Vertices
-                    rlTexCoord2f(coordA.x, coordD.y); rlVertex2f(vertA.x, vertD.y);  // Bottom-left corner for texture and quad
-                    rlTexCoord2f(coordB.x, coordD.y); rlVertex2f(vertB.x, vertD.y);  // Bottom-right corner for texture and quad
-                    rlTexCoord2f(coordB.x, coordA.y); rlVertex2f(vertB.x, vertA.y);  // Top-right corner for texture and quad
-                    rlTexCoord2f(coordA.x, coordA.y); rlVertex2f(vertA.x, vertA.y);  // Top-left corner for texture and quad
-                    if (drawCenter)
-                    {
-                        // CENTER QUAD
-                        // -----------------------------------------------------------
-                        // Texture coords                 Vertices
-                        rlTexCoord2f(coordB.x, coordD.y); rlVertex2f(vertB.x, vertD.y);  // Bottom-left corner for texture and quad
-                        rlTexCoord2f(coordC.x, coordD.y); rlVertex2f(vertC.x, vertD.y);  // Bottom-right corner for texture and quad
-                        rlTexCoord2f(coordC.x, coordA.y); rlVertex2f(vertC.x, vertA.y);  // Top-right corner for texture and quad
-                        rlTexCoord2f(coordB.x, coordA.y); rlVertex2f(vertB.x, vertA.y);  // Top-left corner for texture and quad
-                    }
-                    // RIGHT QUAD
-                    // -----------------------------------------------------------
-                    // Texture coords                 Vertices
-                    rlTexCoord2f(coordC.x, coordD.y); rlVertex2f(vertC.x, vertD.y);  // Bottom-left corner for texture and quad
-                    rlTexCoord2f(coordD.x, coordD.y); rlVertex2f(vertD.x, vertD.y);  // Bottom-right corner for texture and quad
-                    rlTexCoord2f(coordD.x, coordA.y); rlVertex2f(vertD.x, vertA.y);  // Top-right corner for texture and quad
-                    rlTexCoord2f(coordC.x, coordA.y); rlVertex2f(vertC.x, vertA.y);  // Top-left corner for texture and quad
-                }
-            rlEnd();
-        rlPopMatrix();
+                    pixels[i].r = (unsigned char)(((float *)image.data)[k]*255.0f);
+                    pixels[i].g = (unsigned char)(((float *)image.data)[k + 1]*255.0f);
+                    pixels[i].b = (unsigned char)(((float *)image.data)[k + 2]*255.0f);
+                    pixels[i].a = 255;
 
-        rlDisableTexture();
+                    k += 3;
+                } break;
+                case UNCOMPRESSED_R32G32B32A32:
+                {
+                    pixels[i].r = (unsigned char)(((float *)image.data)[k]*255.0f);
+                    pixels[i].g = (unsigned char)(((float *)image.data)[k]*255.0f);
+                    pixels[i].b = (unsigned char)(((float *)image.data)[k]*255.0f);
+                    pixels[i].a = (unsigned char)(((float *)image.data)[k]*255.0f);
 
+                    k += 4;
+                } break;
+                default: break;
+            }
+        }
     }
 }
 
-//----------------------------------------------------------------------------------
-// Module specific Functions Definition
-//----------------------------------------------------------------------------------
-#if defined(SUPPORT_FILEFORMAT_GIF)
-// Load animated GIF data
-//  - Image.data buffer includes all frames: [image#0][image#1][image#2][...]
-//  - Number of frames is returned through 'frames' parameter
-//  - Frames delay is returned through 'delays' parameter (int array)
-//  - All frames are returned in RGBA format
-static Image LoadAnimatedGIF(const char *fileName, int *frames, int **delays)
+// Set file position from file start, supports 64 bit offsets (files bigger than 2GB)
+static bool SeekFile64(FILE *file, long long offset)
 {
-    Image image = { 0 };
+#if defined(_WIN32)
+    return (_fseeki64(file, offset, SEEK_SET) == 0);
+#else
+    return (fseeko(file, (off_t)offset, SEEK_SET) == 0);
+#endif
+}
 
-    FILE *gifFile = fopen(fileName, "rb");
+// Get tiled image tile, tile is loaded from file if not cached, least recently used tile is replaced when cache is full
+// NOTE: Returns NULL if tile data can not be read
+static ImageTile *GetImageTile(TiledImage image, int x, int y)
+{
+    TiledImageData *data = (TiledImageData *)image.tilesData;
+    ImageTile *tile = NULL;
 
-    if (gifFile == NULL)
+    data->useCounter++;
+
+    for (int i = 0; i < data->tilesCount; i++)
     {
-        TraceLog(LOG_WARNING, "[%s] Animated GIF file could not be opened", fileName);
+        if ((data->tiles[i].x == x) && (data->tiles[i].y == y))
+        {
+            data->tiles[i].lastUse = data->useCounter;
+            return &data->tiles[i];
+        }
+    }
+
+    int bytesPerPixel = GetPixelDataSize(1, 1, image.format);
+
+    if (data->tilesCount < MAX_TILED_IMAGE_TILES)
+    {
+        tile = &data->tiles[data->tilesCount];
+        tile->data = (unsigned char *)RL_MALLOC(image.tileSize*image.tileSize*bytesPerPixel);
+        data->tilesCount++;
     }
     else
     {
-        fseek(gifFile, 0L, SEEK_END);
-        int size = ftell(gifFile);
-        fseek(gifFile, 0L, SEEK_SET);    
+        tile = &data->tiles[0];
 
-        unsigned char *buffer = (unsigned char *)RL_CALLOC(size, sizeof(char));    
-        fread(buffer, sizeof(char), size, gifFile);
+        for (int i = 1; i < data->tilesCount; i++) if (data->tiles[i].lastUse < tile->lastUse) tile = &data->tiles[i];
+    }
 
-        fclose(gifFile);    // Close file pointer
+    int tileX = x*image.tileSize;
+    int tileY = y*image.tileSize;
+    int tileWidth = ((tileX + image.tileSize) > image.width)? (image.width - tileX) : image.tileSize;
+    int tileHeight = ((tileY + image.tileSize) > image.height)? (image.height - tileY) : image.tileSize;
 
-        int comp = 0;
-        image.data = stbi_load_gif_from_memory(buffer, size, delays, &image.width, &image.height, frames, &comp, 4);
+    // Read tile rows from file
+    for (int row = 0; row < tileHeight; row++)
+    {
+        long long offset = data->dataOffset + ((long long)(tileY + row)*image.width + tileX)*bytesPerPixel;
 
-        image.mipmaps = 1;
-        image.format = UNCOMPRESSED_R8G8B8A8;
+        if (!SeekFile64(data->file, offset) || (fread(tile->data + row*tileWidth*bytesPerPixel, tileWidth*bytesPerPixel, 1, data->file) != 1))
+        {
+            TraceLog(LOG_WARNING, "Tiled image data can not be read, wrong requested format or size");
 
-        free(buffer);
+            tile->x = -1;
+            tile->lastUse = 0;
+            return NULL;
+        }
     }
 
-    return image;
+    tile->x = x;
+    tile->y = y;
+    tile->lastUse = data->useCounter;
+
+    return tile;
 }
-#endif
 
-#if defined(SUPPORT_FILEFORMAT_DDS)
-// Loading DDS image data (compressed or uncompressed)
-static Image LoadDDS(const char *fileName)
+// Get KTX OpenGL formats for uncompressed pixel format, OpenGL 3.3 sized formats are used
+// NOTE: Values are defined here instead of using rlGetGlTextureFormats(), it does not require a GPU context
+static bool GetKTXGlFormats(int format, unsigned int *glInternalFormat, unsigned int *glFormat, unsigned int *glType)
 {
-    // Required extension:
-    // GL_EXT_texture_compression_s3tc
-
-    // Supported tokens (defined by extensions)
-    // GL_COMPRESSED_RGB_S3TC_DXT1_EXT      0x83F0
-    // GL_COMPRESSED_RGBA_S3TC_DXT1_EXT     0x83F1
-    // GL_COMPRESSED_RGBA_S3TC_DXT3_EXT     0x83F2
-    // GL_COMPRESSED_RGBA_S3TC_DXT5_EXT     0x83F3
-
-    #define FOURCC_DXT1 0x31545844  // Equivalent to "DXT1" in ASCII
-    #define FOURCC_DXT3 0x33545844  // Equivalent to "DXT3" in ASCII
-    #define FOURCC_DXT5 0x35545844  // Equivalent to "DXT5" in ASCII
-
-    // DDS Pixel Format
-    typedef struct {
-        unsigned int size;
-        unsigned int flags;
-        unsigned int fourCC;
-        unsigned int rgbBitCount;
-        unsigned int rBitMask;
-        unsigned int gBitMask;
-        unsigned int bBitMask;
-        unsigned int aBitMask;
-    } DDSPixelFormat;
-
-    // DDS Header (124 bytes)
-    typedef struct {
-        unsigned int size;
-        unsigned int flags;
-        unsigned int height;
-        unsigned int width;
-        unsigned int pitchOrLinearSize;
-        unsigned int depth;
-        unsigned int mipmapCount;
-        unsigned int reserved1[11];
-        DDSPixelFormat ddspf;
-        unsigned int caps;
-        unsigned int caps2;
-        unsigned int caps3;
-        unsigned int caps4;
-        unsigned int reserved2;
-    } DDSHeader;
-
-    Image image = { 0 };
-
-    FILE *ddsFile = fopen(fileName, "rb");
+    bool supported = true;
 
-    if (ddsFile == NULL)
+    switch (format)
     {
-        TraceLog(LOG_WARNING, "[%s] DDS file could not be opened", fileName);
+        case UNCOMPRESSED_GRAYSCALE: *glInternalFormat = 0x8229; *glFormat = 0x1903; *glType = 0x1401; break;     // GL_R8, GL_RED, GL_UNSIGNED_BYTE
+        case UNCOMPRESSED_GRAY_ALPHA: *glInternalFormat = 0x822B; *glFormat = 0x8227; *glType = 0x1401; break;    // GL_RG8, GL_RG, GL_UNSIGNED_BYTE
+        case UNCOMPRESSED_R5G6B5: *glInternalFormat = 0x8D62; *glFormat = 0x1907; *glType = 0x8363; break;        // GL_RGB565, GL_RGB, GL_UNSIGNED_SHORT_5_6_5
+        case UNCOMPRESSED_R8G8B8: *glInternalFormat = 0x8051; *glFormat = 0x1907; *glType = 0x1401; break;        // GL_RGB8, GL_RGB, GL_UNSIGNED_BYTE
+        case UNCOMPRESSED_R5G5B5A1: *glInternalFormat = 0x8057; *glFormat = 0x1908; *glType = 0x8034; break;      // GL_RGB5_A1, GL_RGBA, GL_UNSIGNED_SHORT_5_5_5_1
+        case UNCOMPRESSED_R4G4B4A4: *glInternalFormat = 0x8056; *glFormat = 0x1908; *glType = 0x8033; break;      // GL_RGBA4, GL_RGBA, GL_UNSIGNED_SHORT_4_4_4_4
+        case UNCOMPRESSED_R8G8B8A8: *glInternalFormat = 0x8058; *glFormat = 0x1908; *glType = 0x1401; break;      // GL_RGBA8, GL_RGBA, GL_UNSIGNED_BYTE
+        case UNCOMPRESSED_R32: *glInternalFormat = 0x822E; *glFormat = 0x1903; *glType = 0x1406; break;           // GL_R32F, GL_RED, GL_FLOAT
+        case UNCOMPRESSED_R32G32B32: *glInternalFormat = 0x8815; *glFormat = 0x1907; *glType = 0x1406; break;     // GL_RGB32F, GL_RGB, GL_FLOAT
+        case UNCOMPRESSED_R32G32B32A32: *glInternalFormat = 0x8814; *glFormat = 0x1908; *glType = 0x1406; break;  // GL_RGBA32F, GL_RGBA, GL_FLOAT
+        default: supported = false; break;
     }
-    else
-    {
-        // Verify the type of file
-        char ddsHeaderId[4];
-
-        fread(ddsHeaderId, 4, 1, ddsFile);
-
-        if ((ddsHeaderId[0] != 'D') || (ddsHeaderId[1] != 'D') || (ddsHeaderId[2] != 'S') || (ddsHeaderId[3] != ' '))
-        {
-            TraceLog(LOG_WARNING, "[%s] DDS file does not seem to be a valid image", fileName);
-        }
-        else
-        {
-            DDSHeader ddsHeader;
 
-            // Get the image header
-            fread(&ddsHeader, sizeof(DDSHeader), 1, ddsFile);
+    return supported;
+}
 
-            TraceLog(LOG_DEBUG, "[%s] DDS file header size: %i", fileName, sizeof(DDSHeader));
-            TraceLog(LOG_DEBUG, "[%s] DDS file pixel format size: %i", fileName, ddsHeader.ddspf.size);
-            TraceLog(LOG_DEBUG, "[%s] DDS file pixel format flags: 0x%x", fileName, ddsHeader.ddspf.flags);
-            TraceLog(LOG_DEBUG, "[%s] DDS file format: 0x%x", fileName, ddsHeader.ddspf.fourCC);
-            TraceLog(LOG_DEBUG, "[%s] DDS file bit count: 0x%x", fileName, ddsHeader.ddspf.rgbBitCount);
+// Write mipmap level row to file, row is also used to generate next level row (2x2 box filter) when both source rows are available
+// NOTE: Odd sizes clamp last row/column, next level rows are written recursively
+static bool WriteMipmapRow(FILE *file, TiledMipmapLevel *levels, int levelsCount, int level, const unsigned char *row, int format)
+{
+    TiledMipmapLevel *current = &levels[level];
+    int bytesPerPixel = GetPixelDataSize(1, 1, format);
+    int rowSize = current->width*bytesPerPixel;
 
-            image.width = ddsHeader.width;
-            image.height = ddsHeader.height;
+    if (!SeekFile64(file, current->dataOffset + (long long)current->rowsCount*rowSize) || (fwrite(row, rowSize, 1, file) != 1)) return false;
 
-            if (ddsHeader.mipmapCount == 0) image.mipmaps = 1;      // Parameter not used
-            else image.mipmaps = ddsHeader.mipmapCount;
+    int rowIndex = current->rowsCount;
+    current->rowsCount++;
 
-            if (ddsHeader.ddspf.rgbBitCount == 16)     // 16bit mode, no compressed
-            {
-                if (ddsHeader.ddspf.flags == 0x40)         // no alpha channel
-                {
-                    image.data = (unsigned short *)RL_MALLOC(image.width*image.height*sizeof(unsigned short));
-                    fread(image.data, image.width*image.height*sizeof(unsigned short), 1, ddsFile);
+    if (level + 1 >= levelsCount) return true;
 
-                    image.format = UNCOMPRESSED_R5G6B5;
-                }
-                else if (ddsHeader.ddspf.flags == 0x41)        // with alpha channel
-                {
-                    if (ddsHeader.ddspf.aBitMask == 0x8000)    // 1bit alpha
-                    {
-                        image.data = (unsigned short *)RL_MALLOC(image.width*image.height*sizeof(unsigned short));
-                        fread(image.data, image.width*image.height*sizeof(unsigned short), 1, ddsFile);
+    TiledMipmapLevel *next = &levels[level + 1];
 
-                        unsigned char alpha = 0;
+    if (next->rowsCount >= next->height) return true;
 
-                        // NOTE: Data comes as A1R5G5B5, it must be reordered to R5G5B5A1
-                        for (int i = 0; i < image.width*image.height; i++)
-                        {
-                            alpha = ((unsigned short *)image.data)[i] >> 15;
-                            ((unsigned short *)image.data)[i] = ((unsigned short *)image.data)[i] << 1;
-                            ((unsigned short *)image.data)[i] += alpha;
-                        }
+    // Source rows required for next level row
+    int row0 = 2*next->rowsCount;
+    int row1 = (row0 + 1 < current->height)? (row0 + 1) : (current->height - 1);
+    if (row0 > current->height - 1) row0 = current->height - 1;
 
-                        image.format = UNCOMPRESSED_R5G5B5A1;
-                    }
-                    else if (ddsHeader.ddspf.aBitMask == 0xf000)   // 4bit alpha
-                    {
-                        image.data = (unsigned short *)RL_MALLOC(image.width*image.height*sizeof(unsigned short));
-                        fread(image.data, image.width*image.height*sizeof(unsigned short), 1, ddsFile);
+    if (rowIndex == row0) memcpy(next->rows[0], row, rowSize);
+    if (rowIndex == row1) memcpy(next->rows[1], row, rowSize);
+    if (rowIndex != row1) return true;
 
-                        unsigned char alpha = 0;
+    int channels = GetPixelChannels(format);
 
-                        // NOTE: Data comes as A4R4G4B4, it must be reordered R4G4B4A4
-                        for (int i = 0; i < image.width*image.height; i++)
-                        {
-                            alpha = ((unsigned short *)image.data)[i] >> 12;
-                            ((unsigned short *)image.data)[i] = ((unsigned short *)image.data)[i] << 4;
-                            ((unsigned short *)image.data)[i] += alpha;
-                        }
+    for (int x = 0; x < next->width; x++)
+    {
+        int x0 = 2*x;
+        int x1 = (x0 + 1 < current->width)? (x0 + 1) : (current->width - 1);
+        if (x0 > current->width - 1) x0 = current->width - 1;
 
-                        image.format = UNCOMPRESSED_R4G4B4A4;
-                    }
-                }
-            }
-            if (ddsHeader.ddspf.flags == 0x40 && ddsHeader.ddspf.rgbBitCount == 24)   // DDS_RGB, no compressed
+        if (channels > 0)
+        {
+            for (int c = 0; c < channels; c++)
             {
-                // NOTE: not sure if this case exists...
-                image.data = (unsigned char *)RL_MALLOC(image.width*image.height*3*sizeof(unsigned char));
-                fread(image.data, image.width*image.height*3, 1, ddsFile);
-
-                image.format = UNCOMPRESSED_R8G8B8;
+                next->output[x*channels + c] = (unsigned char)((next->rows[0][x0*channels + c] + next->rows[0][x1*channels + c] +
+                                                                next->rows[1][x0*channels + c] + next->rows[1][x1*channels + c] + 2)/4);
             }
-            else if (ddsHeader.ddspf.flags == 0x41 && ddsHeader.ddspf.rgbBitCount == 32) // DDS_RGBA, no compressed
+        }
+        else
+        {
+            // 32 bit float per channel formats
+            float *output = (float *)next->output;
+            const float *src0 = (const float *)next->rows[0];
+            const float *src1 = (const float *)next->rows[1];
+            int floatChannels = bytesPerPixel/4;
+
+            for (int c = 0; c < floatChannels; c++)
             {
-                image.data = (unsigned char *)RL_MALLOC(image.width*image.height*4*sizeof(unsigned char));
-                fread(image.data, image.width*image.height*4, 1, ddsFile);
+                output[x*floatChannels + c] = (src0[x0*floatChannels + c] + src0[x1*floatChannels + c] +
+                                               src1[x0*floatChannels + c] + src1[x1*floatChannels + c])*0.25f;
+            }
+        }
+    }
 
-                unsigned char blue = 0;
+    return WriteMipmapRow(file, levels, levelsCount, level + 1, next->output, format);
+}
 
-                // NOTE: Data comes as A8R8G8B8, it must be reordered R8G8B8A8 (view next comment)
-                // DirecX understand ARGB as a 32bit DWORD but the actual memory byte alignment is BGRA
-                // So, we must realign B8G8R8A8 to R8G8B8A8
-                for (int i = 0; i < image.width*image.height*4; i += 4)
-                {
-                    blue = ((unsigned char *)image.data)[i];
-                    ((unsigned char *)image.data)[i] = ((unsigned char *)image.data)[i + 2];
-                    ((unsigned char *)image.data)[i + 2] = blue;
-                }
+// Load virtual texture shader, sampling shader reads page table to find page in cache (fallback if not resident),
+// feedback shader writes visible page position (12 bit per coordinate)
+// NOTE: Samplers follow material maps: texture0 (fallback), texture1 (page table), texture2 (pages cache)
+#if !defined(GRAPHICS_API_OPENGL_11)
+static Shader LoadVirtualTextureShader(bool feedback)
+{
+    const char *vsCode =
+#if defined(GRAPHICS_API_OPENGL_21)
+    "#version 120                       \n"
+#elif defined(GRAPHICS_API_OPENGL_ES2)
+    "#version 100                       \n"
+#endif
+#if defined(GRAPHICS_API_OPENGL_ES2) || defined(GRAPHICS_API_OPENGL_21)
+    "attribute vec3 vertexPosition;     \n"
+    "attribute vec2 vertexTexCoord;     \n"
+    "varying vec2 fragTexCoord;         \n"
+#elif defined(GRAPHICS_API_OPENGL_33)
+    "#version 330                       \n"
+    "in vec3 vertexPosition;            \n"
+    "in vec2 vertexTexCoord;            \n"
+    "out vec2 fragTexCoord;             \n"
+#endif
+    "uniform mat4 mvp;                  \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    fragTexCoord = vertexTexCoord; \n"
+    "    gl_Position = mvp*vec4(vertexPosition, 1.0); \n"
+    "}                                  \n";
+
+    // NOTE: High precision required on ES2 to address up to 4096 pages
+#if defined(GRAPHICS_API_OPENGL_21)
+    #define VT_SHADER_HEADER "#version 120\n" "varying vec2 fragTexCoord;\n"
+    #define VT_SHADER_TEXTURE "texture2D"
+    #define VT_SHADER_OUTPUT "gl_FragColor"
+#elif defined(GRAPHICS_API_OPENGL_ES2)
+    #define VT_SHADER_HEADER "#version 100\n" "#ifdef GL_FRAGMENT_PRECISION_HIGH\n" "precision highp float;\n" "#else\n" "precision mediump float;\n" "#endif\n" "varying vec2 fragTexCoord;\n"
+    #define VT_SHADER_TEXTURE "texture2D"
+    #define VT_SHADER_OUTPUT "gl_FragColor"
+#elif defined(GRAPHICS_API_OPENGL_33)
+    #define VT_SHADER_HEADER "#version 330\n" "in vec2 fragTexCoord;\n" "out vec4 finalColor;\n"
+    #define VT_SHADER_TEXTURE "texture"
+    #define VT_SHADER_OUTPUT "finalColor"
+#endif
 
-                image.format = UNCOMPRESSED_R8G8B8A8;
-            }
-            else if (((ddsHeader.ddspf.flags == 0x04) || (ddsHeader.ddspf.flags == 0x05)) && (ddsHeader.ddspf.fourCC > 0)) // Compressed
-            {
-                int size;       // DDS image data size
+    const char *fsCode =
+    VT_SHADER_HEADER
+    "uniform sampler2D texture0;        \n"
+    "uniform sampler2D texture1;        \n"
+    "uniform sampler2D texture2;        \n"
+    "uniform vec4 colDiffuse;           \n"
+    "uniform vec2 virtualPages;         \n"     // Virtual texture size in pages (not rounded)
+    "uniform vec2 pagesCount;           \n"     // Page table size
+    "uniform float cachePages;          \n"     // Pages cache size (pages per side)
+    "void main()                        \n"
+    "{                                  \n"
+    "    vec2 uv = clamp(fragTexCoord, 0.0, 0.99999); \n"
+    "    vec2 pageCoord = uv*virtualPages; \n"
+    "    vec2 page = floor(pageCoord);  \n"
+    "    vec4 entry = " VT_SHADER_TEXTURE "(texture1, (page + 0.5)/pagesCount); \n"
+    "    vec4 texelColor = " VT_SHADER_TEXTURE "(texture0, uv); \n"
+    "    if (entry.a > 0.5) texelColor = " VT_SHADER_TEXTURE "(texture2, (floor(entry.rg*255.0 + 0.5) + fract(pageCoord))/cachePages); \n"
+    "    " VT_SHADER_OUTPUT " = texelColor*colDiffuse; \n"
+    "}                                  \n";
+
+    const char *fsFeedbackCode =
+    VT_SHADER_HEADER
+    "uniform vec2 virtualPages;         \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    vec2 page = floor(clamp(fragTexCoord, 0.0, 0.99999)*virtualPages); \n"
+    "    vec2 high = floor(page/256.0); \n"
+    "    vec2 low = page - high*256.0;  \n"
+    "    " VT_SHADER_OUTPUT " = vec4(low/255.0, (high.x + high.y*16.0)/255.0, 1.0); \n"
+    "}                                  \n";
+
+    return LoadShaderCode(vsCode, feedback? fsFeedbackCode : fsCode);
+}
+#endif
+
+#if !defined(GRAPHICS_API_OPENGL_11)
+// Load post-processing passes shaders, every full pass effect is a pass and adjacent per-pixel effects
+// are merged into one generated shader pass (one full-screen pass instead of one per effect)
+static void LoadPostProcessPasses(PostProcessData *data)
+{
+    for (int i = 0; i < data->passesCount; i++)
+    {
+        if (data->generated[i]) UnloadShader(data->passes[i]);
+    }
+
+    data->passesCount = 0;
+    data->dirty = false;
+
+    for (int i = 0; i < data->effectsCount; )
+    {
+        int pass = data->passesCount++;
 
-                // Calculate data size, including all mipmaps
-                if (ddsHeader.mipmapCount > 1) size = ddsHeader.pitchOrLinearSize*2;
-                else size = ddsHeader.pitchOrLinearSize;
+        if (data->effects[i].code == NULL)
+        {
+            data->passes[pass] = data->effects[i].shader;
+            data->generated[pass] = false;
+            data->effects[i].pass = pass;
+            i++;
+            continue;
+        }
 
-                TraceLog(LOG_DEBUG, "Pitch or linear size: %i", ddsHeader.pitchOrLinearSize);
+        int count = 0;
+        while (((i + count) < data->effectsCount) && (data->effects[i + count].code != NULL)) count++;
 
-                image.data = (unsigned char *)RL_MALLOC(size*sizeof(unsigned char));
+        data->passes[pass] = LoadPostEffectsShader(data, i, count);
+        data->generated[pass] = true;
 
-                fread(image.data, size, 1, ddsFile);
+        // Effects values set before generation are applied to merged shader
+        for (int k = i; k < (i + count); k++)
+        {
+            PostEffect *fx = &data->effects[k];
+            fx->pass = pass;
 
-                switch (ddsHeader.ddspf.fourCC)
-                {
-                    case FOURCC_DXT1:
-                    {
-                        if (ddsHeader.ddspf.flags == 0x04) image.format = COMPRESSED_DXT1_RGB;
-                        else image.format = COMPRESSED_DXT1_RGBA;
-                    } break;
-                    case FOURCC_DXT3: image.format = COMPRESSED_DXT3_RGBA; break;
-                    case FOURCC_DXT5: image.format = COMPRESSED_DXT5_RGBA; break;
-                    default: break;
-                }
-            }
+            for (int v = 0; v < fx->valuesCount; v++) SetShaderValue(data->passes[pass], GetShaderLocation(data->passes[pass], fx->values[v].name), fx->values[v].data, fx->values[v].type);
         }
 
-        fclose(ddsFile);    // Close file pointer
+        i += count;
     }
 
-    return image;
+    TraceLog(LOG_INFO, "Post-processing chain: %i effects drawn in %i passes", data->effectsCount, data->passesCount);
 }
-#endif
 
-#if defined(SUPPORT_FILEFORMAT_PKM)
-// Loading PKM image data (ETC1/ETC2 compression)
-// NOTE: KTX is the standard Khronos Group compression format (ETC1/ETC2, mipmaps)
-// PKM is a much simpler file format used mainly to contain a single ETC1/ETC2 compressed image (no mipmaps)
-static Image LoadPKM(const char *fileName)
+// Generate shader running per-pixel effects in order, every effect function is renamed with a macro
+static Shader LoadPostEffectsShader(PostProcessData *data, int first, int count)
 {
-    // Required extensions:
-    // GL_OES_compressed_ETC1_RGB8_texture  (ETC1) (OpenGL ES 2.0)
-    // GL_ARB_ES3_compatibility  (ETC2/EAC) (OpenGL ES 3.0)
-
-    // Supported tokens (defined by extensions)
-    // GL_ETC1_RGB8_OES                 0x8D64
-    // GL_COMPRESSED_RGB8_ETC2          0x9274
-    // GL_COMPRESSED_RGBA8_ETC2_EAC     0x9278
+#if defined(GRAPHICS_API_OPENGL_21)
+    #define POST_SHADER_HEADER "#version 120\n" "varying vec2 fragTexCoord;\n" "varying vec4 fragColor;\n"
+    #define POST_SHADER_TEXTURE "texture2D"
+    #define POST_SHADER_OUTPUT "gl_FragColor"
+#elif defined(GRAPHICS_API_OPENGL_ES2)
+    #define POST_SHADER_HEADER "#version 100\n" "precision mediump float;\n" "varying vec2 fragTexCoord;\n" "varying vec4 fragColor;\n"
+    #define POST_SHADER_TEXTURE "texture2D"
+    #define POST_SHADER_OUTPUT "gl_FragColor"
+#elif defined(GRAPHICS_API_OPENGL_33)
+    #define POST_SHADER_HEADER "#version 330\n" "in vec2 fragTexCoord;\n" "in vec4 fragColor;\n" "out vec4 finalColor;\n"
+    #define POST_SHADER_TEXTURE "texture"
+    #define POST_SHADER_OUTPUT "finalColor"
+#endif
 
-    // PKM file (ETC1) Header (16 bytes)
-    typedef struct {
-        char id[4];                 // "PKM "
-        char version[2];            // "10" or "20"
-        unsigned short format;      // Data format (big-endian) (Check list below)
-        unsigned short width;       // Texture width (big-endian) (origWidth rounded to multiple of 4)
-        unsigned short height;      // Texture height (big-endian) (origHeight rounded to multiple of 4)
-        unsigned short origWidth;   // Original width (big-endian)
-        unsigned short origHeight;  // Original height (big-endian)
-    } PKMHeader;
+    int size = 1024;
+    for (int i = first; i < (first + count); i++) size += (int)strlen(data->effects[i].code) + 64;
 
-    // Formats list
-    // version 10: format: 0=ETC1_RGB, [1=ETC1_RGBA, 2=ETC1_RGB_MIP, 3=ETC1_RGBA_MIP] (not used)
-    // version 20: format: 0=ETC1_RGB, 1=ETC2_RGB, 2=ETC2_RGBA_OLD, 3=ETC2_RGBA, 4=ETC2_RGBA1, 5=ETC2_R, 6=ETC2_RG, 7=ETC2_SIGNED_R, 8=ETC2_SIGNED_R
+    char *fsCode = (char *)RL_CALLOC(size, 1);
+    char line[128] = { 0 };
 
-    // NOTE: The extended width and height are the widths rounded up to a multiple of 4.
-    // NOTE: ETC is always 4bit per pixel (64 bit for each 4x4 block of pixels)
+    strcat(fsCode, POST_SHADER_HEADER "uniform sampler2D texture0;\n");
 
-    Image image = { 0 };
+    for (int i = first; i < (first + count); i++)
+    {
+        sprintf(line, "#define effect postEffect%i\n", i);
+        strcat(fsCode, line);
+        strcat(fsCode, data->effects[i].code);
+        strcat(fsCode, "\n#undef effect\n");
+    }
 
-    FILE *pkmFile = fopen(fileName, "rb");
+    strcat(fsCode, "void main()\n{\n    vec4 color = " POST_SHADER_TEXTURE "(texture0, fragTexCoord);\n");
 
-    if (pkmFile == NULL)
+    for (int i = first; i < (first + count); i++)
     {
-        TraceLog(LOG_WARNING, "[%s] PKM file could not be opened", fileName);
+        sprintf(line, "    color = postEffect%i(color, fragTexCoord);\n", i);
+        strcat(fsCode, line);
     }
-    else
-    {
-        PKMHeader pkmHeader;
 
-        // Get the image header
-        fread(&pkmHeader, sizeof(PKMHeader), 1, pkmFile);
+    strcat(fsCode, "    " POST_SHADER_OUTPUT " = color;\n}\n");
 
-        if ((pkmHeader.id[0] != 'P') || (pkmHeader.id[1] != 'K') || (pkmHeader.id[2] != 'M') || (pkmHeader.id[3] != ' '))
-        {
-            TraceLog(LOG_WARNING, "[%s] PKM file does not seem to be a valid image", fileName);
-        }
-        else
-        {
-            // NOTE: format, width and height come as big-endian, data must be swapped to little-endian
-            pkmHeader.format = ((pkmHeader.format & 0x00FF) << 8) | ((pkmHeader.format & 0xFF00) >> 8);
-            pkmHeader.width = ((pkmHeader.width & 0x00FF) << 8) | ((pkmHeader.width & 0xFF00) >> 8);
-            pkmHeader.height = ((pkmHeader.height & 0x00FF) << 8) | ((pkmHeader.height & 0xFF00) >> 8);
+    #undef POST_SHADER_HEADER
+    #undef POST_SHADER_TEXTURE
+    #undef POST_SHADER_OUTPUT
 
-            TraceLog(LOG_DEBUG, "PKM (ETC) image width: %i", pkmHeader.width);
-            TraceLog(LOG_DEBUG, "PKM (ETC) image height: %i", pkmHeader.height);
-            TraceLog(LOG_DEBUG, "PKM (ETC) image format: %i", pkmHeader.format);
+    Shader shader = LoadShaderCode(NULL, fsCode);
 
-            image.width = pkmHeader.width;
-            image.height = pkmHeader.height;
-            image.mipmaps = 1;
+    RL_FREE(fsCode);
 
-            int bpp = 4;
-            if (pkmHeader.format == 3) bpp = 8;
+    return shader;
+}
 
-            int size = image.width*image.height*bpp/8;  // Total data size in bytes
+// Draw texture with pass shader, a single triangle covers the texture area (no quad diagonal seam)
+// NOTE: Render textures are flipped vertically, texture coordinates go beyond [0..1] out of the covered area
+static void DrawPostProcessPass(Shader shader, Texture2D texture)
+{
+    float width = (float)texture.width;
+    float height = (float)texture.height;
 
-            image.data = (unsigned char *)RL_MALLOC(size*sizeof(unsigned char));
+    // NOTE: Batch is drawn first, so triangles draw call starts empty and texture can be set after rlBegin()
+    // (rlBegin() resets draw call texture when draw mode changes)
+    rlglDraw();
+    BeginShaderMode(shader);
 
-            fread(image.data, size, 1, pkmFile);
+    rlBegin(RL_TRIANGLES);
+        rlEnableTexture(texture.id);
+        rlColor4ub(255, 255, 255, 255);
 
-            if (pkmHeader.format == 0) image.format = COMPRESSED_ETC1_RGB;
-            else if (pkmHeader.format == 1) image.format = COMPRESSED_ETC2_RGB;
-            else if (pkmHeader.format == 3) image.format = COMPRESSED_ETC2_EAC_RGBA;
-        }
+        rlTexCoord2f(0.0f, 1.0f);
+        rlVertex2f(0.0f, 0.0f);
 
-        fclose(pkmFile);    // Close file pointer
-    }
+        rlTexCoord2f(0.0f, -1.0f);
+        rlVertex2f(0.0f, 2.0f*height);
 
-    return image;
+        rlTexCoord2f(2.0f, 1.0f);
+        rlVertex2f(2.0f*width, 0.0f);
+    rlEnd();
+
+    rlDisableTexture();
+
+    EndShaderMode();
 }
 #endif
 
-#if defined(SUPPORT_FILEFORMAT_KTX)
-// Load KTX compressed image data (ETC1/ETC2 compression)
-static Image LoadKTX(const char *fileName)
+// Worker job: load virtual texture pages requested, every page is a tile of source tiled image
+// NOTE: Source tiled image is only accessed by this job while loading (one job at a time)
+static void LoadVirtualPagesJob(void *data)
 {
-    // Required extensions:
-    // GL_OES_compressed_ETC1_RGB8_texture  (ETC1)
-    // GL_ARB_ES3_compatibility  (ETC2/EAC)
-
-    // Supported tokens (defined by extensions)
-    // GL_ETC1_RGB8_OES                 0x8D64
-    // GL_COMPRESSED_RGB8_ETC2          0x9274
-    // GL_COMPRESSED_RGBA8_ETC2_EAC     0x9278
-
-    // KTX file Header (64 bytes)
-    // v1.1 - https://www.khronos.org/opengles/sdk/tools/KTX/file_format_spec/
-    // v2.0 - http://github.khronos.org/KTX-Specification/
+    VirtualTextureData *vtData = (VirtualTextureData *)data;
+    int pageSize = vtData->source.tileSize;
 
-    // TODO: Support KTX 2.2 specs!
+    for (int i = 0; i < vtData->loadCount; i++)
+    {
+        int x = vtData->loadPages[i]%vtData->pagesX;
+        int y = vtData->loadPages[i]/vtData->pagesX;
 
-    typedef struct {
-        char id[12];                        // Identifier: "«KTX 11»\r\n\x1A\n"
-        unsigned int endianness;            // Little endian: 0x01 0x02 0x03 0x04
-        unsigned int glType;                // For compressed textures, glType must equal 0
-        unsigned int glTypeSize;            // For compressed texture data, usually 1
-        unsigned int glFormat;              // For compressed textures is 0
-        unsigned int glInternalFormat;      // Compressed internal format
-        unsigned int glBaseInternalFormat;  // Same as glFormat (RGB, RGBA, ALPHA...)
-        unsigned int width;                 // Texture image width in pixels
-        unsigned int height;                // Texture image height in pixels
-        unsigned int depth;                 // For 2D textures is 0
-        unsigned int elements;              // Number of array elements, usually 0
-        unsigned int faces;                 // Cubemap faces, for no-cubemap = 1
-        unsigned int mipmapLevels;          // Non-mipmapped textures = 1
-        unsigned int keyValueDataSize;      // Used to encode any arbitrary data...
-    } KTXHeader;
+        vtData->loadImages[i] = GetTiledImageRegion(vtData->source, (Rectangle){ (float)(x*pageSize), (float)(y*pageSize), (float)pageSize, (float)pageSize });
+    }
+}
 
-    // NOTE: Before start of every mipmap data block, we have: unsigned int dataSize
+#if defined(SUPPORT_IMAGE_GENERATION)
+// Generate radial gradient rows, color interpolated by distance to image center
+static void GenGradientRadialRows(void *data, int startRow, int endRow)
+{
+    ImageGenData *gen = (ImageGenData *)data;
 
-    Image image = { 0 };
+    float radius = (gen->width < gen->height)? (float)gen->width/2.0f : (float)gen->height/2.0f;
+    float centerX = (float)gen->width/2.0f;
+    float centerY = (float)gen->height/2.0f;
+    float innerDist = radius*gen->density;
+    float invRange = 1.0f/(radius*(1.0f - gen->density));
 
-    FILE *ktxFile = fopen(fileName, "rb");
+    Color inner = gen->inner;
+    Color outer = gen->outer;
 
-    if (ktxFile == NULL)
-    {
-        TraceLog(LOG_WARNING, "[%s] KTX image file could not be opened", fileName);
-    }
-    else
+    for (int y = startRow; y < endRow; y++)
     {
-        KTXHeader ktxHeader;
-
-        // Get the image header
-        fread(&ktxHeader, sizeof(KTXHeader), 1, ktxFile);
+        Color *row = gen->pixels + (size_t)y*gen->width;
+        float dy = (float)y - centerY;
 
-        if ((ktxHeader.id[1] != 'K') || (ktxHeader.id[2] != 'T') || (ktxHeader.id[3] != 'X') ||
-            (ktxHeader.id[4] != ' ') || (ktxHeader.id[5] != '1') || (ktxHeader.id[6] != '1'))
-        {
-            TraceLog(LOG_WARNING, "[%s] KTX file does not seem to be a valid file", fileName);
-        }
-        else
+        for (int x = 0; x < gen->width; x++)
         {
-            image.width = ktxHeader.width;
-            image.height = ktxHeader.height;
-            image.mipmaps = ktxHeader.mipmapLevels;
+            float dx = (float)x - centerX;
+            float factor = (sqrtf(dx*dx + dy*dy) - innerDist)*invRange;
 
-            TraceLog(LOG_DEBUG, "KTX (ETC) image width: %i", ktxHeader.width);
-            TraceLog(LOG_DEBUG, "KTX (ETC) image height: %i", ktxHeader.height);
-            TraceLog(LOG_DEBUG, "KTX (ETC) image format: 0x%x", ktxHeader.glInternalFormat);
+            // NOTE: dist can be bigger than radius so we have to check
+            factor = (factor < 0.0f)? 0.0f : ((factor > 1.0f)? 1.0f : factor);
 
-            unsigned char unused;
+            row[x].r = (unsigned char)((float)outer.r*factor + (float)inner.r*(1.0f - factor));
+            row[x].g = (unsigned char)((float)outer.g*factor + (float)inner.g*(1.0f - factor));
+            row[x].b = (unsigned char)((float)outer.b*factor + (float)inner.b*(1.0f - factor));
+            row[x].a = (unsigned char)((float)outer.a*factor + (float)inner.a*(1.0f - factor));
+        }
+    }
+}
 
-            if (ktxHeader.keyValueDataSize > 0)
-            {
-                for (unsigned int i = 0; i < ktxHeader.keyValueDataSize; i++) fread(&unused, sizeof(unsigned char), 1U, ktxFile);
-            }
+// Generate perlin noise rows (fractal brownian motion, 6 octaves)
+static void GenPerlinNoiseRows(void *data, int startRow, int endRow)
+{
+    ImageGenData *gen = (ImageGenData *)data;
 
-            int dataSize;
-            fread(&dataSize, sizeof(unsigned int), 1, ktxFile);
+    for (int y = startRow; y < endRow; y++)
+    {
+        Color *row = gen->pixels + (size_t)y*gen->width;
+        float ny = (float)(y + gen->offsetY)*gen->scale/(float)gen->height;
 
-            image.data = (unsigned char *)RL_MALLOC(dataSize*sizeof(unsigned char));
+        for (int x = 0; x < gen->width; x++)
+        {
+            float nx = (float)(x + gen->offsetX)*gen->scale/(float)gen->width;
 
-            fread(image.data, dataSize, 1, ktxFile);
+            // Typical values to start playing with:
+            //   lacunarity = ~2.0   -- spacing between successive octaves (use exactly 2.0 for wrapping output)
+            //   gain       =  0.5   -- relative weighting applied to each successive octave
+            //   octaves    =  6     -- number of "octaves" of noise3() to sum
 
-            if (ktxHeader.glInternalFormat == 0x8D64) image.format = COMPRESSED_ETC1_RGB;
-            else if (ktxHeader.glInternalFormat == 0x9274) image.format = COMPRESSED_ETC2_RGB;
-            else if (ktxHeader.glInternalFormat == 0x9278) image.format = COMPRESSED_ETC2_EAC_RGBA;
-        }
+            // NOTE: We need to translate the data from [-1..1] to [0..1]
+            float p = (stb_perlin_fbm_noise3(nx, ny, 1.0f, 2.0f, 0.5f, 6) + 1.0f)/2.0f;
 
-        fclose(ktxFile);    // Close file pointer
+            unsigned char intensity = (unsigned char)(p*255.0f);
+            row[x] = (Color){ intensity, intensity, intensity, 255 };
+        }
     }
-
-    return image;
 }
 
-// Save image data as KTX file
-// NOTE: By default KTX 1.1 spec is used, 2.0 is still on draft (01Oct2018)
-static int SaveKTX(Image image, const char *fileName)
+// Generate cellular rows, intensity by distance to nearest seed in adjacent tiles
+// NOTE: Squared integer distances are compared, only one square root per pixel
+static void GenCellularRows(void *data, int startRow, int endRow)
 {
-    int success = 0;
-
-    // KTX file Header (64 bytes)
-    // v1.1 - https://www.khronos.org/opengles/sdk/tools/KTX/file_format_spec/
-    // v2.0 - http://github.khronos.org/KTX-Specification/ - still on draft, not ready for implementation
-
-    typedef struct {
-        char id[12];                        // Identifier: "«KTX 11»\r\n\x1A\n"             // KTX 2.0: "«KTX 22»\r\n\x1A\n"
-        unsigned int endianness;            // Little endian: 0x01 0x02 0x03 0x04
-        unsigned int glType;                // For compressed textures, glType must equal 0
-        unsigned int glTypeSize;            // For compressed texture data, usually 1
-        unsigned int glFormat;              // For compressed textures is 0
-        unsigned int glInternalFormat;      // Compressed internal format
-        unsigned int glBaseInternalFormat;  // Same as glFormat (RGB, RGBA, ALPHA...)       // KTX 2.0: UInt32 vkFormat
-        unsigned int width;                 // Texture image width in pixels
-        unsigned int height;                // Texture image height in pixels
-        unsigned int depth;                 // For 2D textures is 0
-        unsigned int elements;              // Number of array elements, usually 0
-        unsigned int faces;                 // Cubemap faces, for no-cubemap = 1
-        unsigned int mipmapLevels;          // Non-mipmapped textures = 1
-        unsigned int keyValueDataSize;      // Used to encode any arbitrary data...         // KTX 2.0: UInt32 levelOrder - ordering of the mipmap levels, usually 0
-                                                                                            // KTX 2.0: UInt32 supercompressionScheme - 0 (None), 1 (Crunch CRN), 2 (Zlib DEFLATE)...
-        // KTX 2.0 defines additional header elements...
-    } KTXHeader;
-
-    // NOTE: Before start of every mipmap data block, we have: unsigned int dataSize
+    ImageGenData *gen = (ImageGenData *)data;
 
-    FILE *ktxFile = fopen(fileName, "wb");
+    int tileSize = gen->tileSize;
+    float intensityScale = 256.0f/tileSize;
 
-    if (ktxFile == NULL) TraceLog(LOG_WARNING, "[%s] KTX image file could not be created", fileName);
-    else
+    for (int y = startRow; y < endRow; y++)
     {
-        KTXHeader ktxHeader;
-
-        // KTX identifier (v1.1)
-        //unsigned char id[12] = { '«', 'K', 'T', 'X', ' ', '1', '1', '»', '\r', '\n', '\x1A', '\n' };
-        //unsigned char id[12] = { 0xAB, 0x4B, 0x54, 0x58, 0x20, 0x31, 0x31, 0xBB, 0x0D, 0x0A, 0x1A, 0x0A };
+        Color *row = gen->pixels + (size_t)y*gen->width;
+        int tileY = y/tileSize;
 
-        const char ktxIdentifier[12] = { 0xAB, 'K', 'T', 'X', ' ', '1', '1', 0xBB, '\r', '\n', 0x1A, '\n' };
+        for (int x = 0; x < gen->width; x++)
+        {
+            int tileX = x/tileSize;
 
-        // Get the image header
-        strncpy(ktxHeader.id, ktxIdentifier, 12); // KTX 1.1 signature
-        ktxHeader.endianness = 0;
-        ktxHeader.glType = 0;                     // Obtained from image.format
-        ktxHeader.glTypeSize = 1;
-        ktxHeader.glFormat = 0;                   // Obtained from image.format
-        ktxHeader.glInternalFormat = 0;           // Obtained from image.format
-        ktxHeader.glBaseInternalFormat = 0;
-        ktxHeader.width = image.width;
-        ktxHeader.height = image.height;
-        ktxHeader.depth = 0;
-        ktxHeader.elements = 0;
-        ktxHeader.faces = 1;
-        ktxHeader.mipmapLevels = image.mipmaps;   // If it was 0, it means mipmaps should be generated on loading (not for compressed formats)
-        ktxHeader.keyValueDataSize = 0;           // No extra data after the header
+            int minDistanceSqr = -1;     // No seed found (infinite distance)
 
-        rlGetGlTextureFormats(image.format, &ktxHeader.glInternalFormat, &ktxHeader.glFormat, &ktxHeader.glType);   // rlgl module function
-        ktxHeader.glBaseInternalFormat = ktxHeader.glFormat;    // KTX 1.1 only
+            // Check all adjacent tiles
+            for (int j = -1; j < 2; j++)
+            {
+                if ((tileY + j < 0) || (tileY + j >= gen->seedsPerCol)) continue;
 
-        // NOTE: We can save into a .ktx all PixelFormats supported by raylib, including compressed formats like DXT, ETC or ASTC
+                const int *seedsRow = gen->seeds + (tileY + j)*gen->seedsPerRow*2;
 
-        if (ktxHeader.glFormat == -1) TraceLog(LOG_WARNING, "Image format not supported for KTX export.");
-        else
-        {
-            success = fwrite(&ktxHeader, sizeof(KTXHeader), 1, ktxFile);
+                for (int i = -1; i < 2; i++)
+                {
+                    if ((tileX + i < 0) || (tileX + i >= gen->seedsPerRow)) continue;
 
-            int width = image.width;
-            int height = image.height;
-            int dataOffset = 0;
+                    int dx = x - seedsRow[(tileX + i)*2];
+                    int dy = y - seedsRow[(tileX + i)*2 + 1];
+                    int distanceSqr = dx*dx + dy*dy;
 
-            // Save all mipmaps data
-            for (int i = 0; i < image.mipmaps; i++)
-            {
-                unsigned int dataSize = GetPixelDataSize(width, height, image.format);
-                success = fwrite(&dataSize, sizeof(unsigned int), 1, ktxFile);
-                success = fwrite((unsigned char *)image.data + dataOffset, dataSize, 1, ktxFile);
+                    if ((minDistanceSqr < 0) || (distanceSqr < minDistanceSqr)) minDistanceSqr = distanceSqr;
+                }
+            }
 
-                width /= 2;
-                height /= 2;
-                dataOffset += dataSize;
+            // I made this up but it seems to give good results at all tile sizes
+            int intensity = 255;
+            if (minDistanceSqr >= 0)
+            {
+                float value = sqrtf((float)minDistanceSqr)*intensityScale;
+                if (value < 255.0f) intensity = (int)value;
             }
-        }
 
-        fclose(ktxFile);    // Close file pointer
+            row[x] = (Color){ (unsigned char)intensity, (unsigned char)intensity, (unsigned char)intensity, 255 };
+        }
     }
-
-    // If all data has been written correctly to file, success = 1
-    return success;
 }
 #endif
 
-#if defined(SUPPORT_FILEFORMAT_PVR)
-// Loading PVR image data (uncompressed or PVRT compression)
-// NOTE: PVR v2 not supported, use PVR v3 instead
-static Image LoadPVR(const char *fileName)
+// Start tracking texture VRAM usage (texture data is resident)
+static void TrackTexture(Texture2D texture)
 {
-    // Required extension:
-    // GL_IMG_texture_compression_pvrtc
+    if (texture.id >= residencyIndicesSize)
+    {
+        unsigned int newSize = (residencyIndicesSize > 0)? residencyIndicesSize : 256;
+        while (newSize <= texture.id) newSize *= 2;
 
-    // Supported tokens (defined by extensions)
-    // GL_COMPRESSED_RGB_PVRTC_4BPPV1_IMG       0x8C00
-    // GL_COMPRESSED_RGBA_PVRTC_4BPPV1_IMG      0x8C02
+        int *indices = (int *)RL_REALLOC(residencyIndices, newSize*sizeof(int));
+        if (indices == NULL) return;
 
-#if 0   // Not used...
-    // PVR file v2 Header (52 bytes)
-    typedef struct {
-        unsigned int headerLength;
-        unsigned int height;
-        unsigned int width;
-        unsigned int numMipmaps;
-        unsigned int flags;
-        unsigned int dataLength;
-        unsigned int bpp;
-        unsigned int bitmaskRed;
-        unsigned int bitmaskGreen;
-        unsigned int bitmaskBlue;
-        unsigned int bitmaskAlpha;
-        unsigned int pvrTag;
-        unsigned int numSurfs;
-    } PVRHeaderV2;
-#endif
+        for (unsigned int i = residencyIndicesSize; i < newSize; i++) indices[i] = -1;
 
-    // PVR file v3 Header (52 bytes)
-    // NOTE: After it could be metadata (15 bytes?)
-    typedef struct {
-        char id[4];
-        unsigned int flags;
-        unsigned char channels[4];      // pixelFormat high part
-        unsigned char channelDepth[4];  // pixelFormat low part
-        unsigned int colourSpace;
-        unsigned int channelType;
-        unsigned int height;
-        unsigned int width;
-        unsigned int depth;
-        unsigned int numSurfaces;
-        unsigned int numFaces;
-        unsigned int numMipmaps;
-        unsigned int metaDataSize;
-    } PVRHeaderV3;
+        residencyIndices = indices;
+        residencyIndicesSize = newSize;
+    }
 
-#if 0   // Not used...
-    // Metadata (usually 15 bytes)
-    typedef struct {
-        unsigned int devFOURCC;
-        unsigned int key;
-        unsigned int dataSize;      // Not used?
-        unsigned char *data;        // Not used?
-    } PVRMetadata;
-#endif
+    if (residencyCount >= residencyCapacity)
+    {
+        int newCapacity = (residencyCapacity > 0)? residencyCapacity*2 : 64;
+        TextureResidency *textures = (TextureResidency *)RL_REALLOC(residencyTextures, newCapacity*sizeof(TextureResidency));
+        if (textures == NULL) return;
 
-    Image image = { 0 };
+        residencyTextures = textures;
+        residencyCapacity = newCapacity;
+    }
 
-    FILE *pvrFile = fopen(fileName, "rb");
+    TextureResidency entry = { 0 };
+    entry.id = texture.id;
+    entry.width = texture.width;
+    entry.height = texture.height;
+    entry.mipmaps = texture.mipmaps;
+    entry.format = texture.format;
+    entry.lastUse = residencyFrame;
+    entry.resident = true;
 
-    if (pvrFile == NULL)
+    for (int i = 0, w = texture.width, h = texture.height; i < texture.mipmaps; i++, w = (w > 1)? w/2 : 1, h = (h > 1)? h/2 : 1) entry.size += GetPixelDataSize(w, h, texture.format);
+
+    residencyIndices[texture.id] = residencyCount;
+    residencyTextures[residencyCount++] = entry;
+
+    textureMemoryUsed += entry.size;
+}
+
+// Stop tracking texture, last entry is moved to its place
+static void UntrackTexture(unsigned int id)
+{
+    TextureResidency *entry = GetTextureResidency(id);
+
+    if (entry == NULL) return;
+
+    if (entry->resident) textureMemoryUsed -= entry->size;
+    RL_FREE(entry->fileName);
+
+    int index = residencyIndices[id];
+    residencyCount--;
+
+    if (index != residencyCount)
     {
-        TraceLog(LOG_WARNING, "[%s] PVR file could not be opened", fileName);
+        residencyTextures[index] = residencyTextures[residencyCount];
+        residencyIndices[residencyTextures[index].id] = index;
     }
-    else
-    {
-        // Check PVR image version
-        unsigned char pvrVersion = 0;
-        fread(&pvrVersion, sizeof(unsigned char), 1, pvrFile);
-        fseek(pvrFile, 0, SEEK_SET);
 
-        // Load different PVR data formats
-        if (pvrVersion == 0x50)
-        {
-            PVRHeaderV3 pvrHeader;
+    residencyIndices[id] = -1;
+}
 
-            // Get PVR image header
-            fread(&pvrHeader, sizeof(PVRHeaderV3), 1, pvrFile);
+// Get tracked texture entry (NULL if not tracked)
+static TextureResidency *GetTextureResidency(unsigned int id)
+{
+    if ((id >= residencyIndicesSize) || (residencyIndices[id] < 0)) return NULL;
 
-            if ((pvrHeader.id[0] != 'P') || (pvrHeader.id[1] != 'V') || (pvrHeader.id[2] != 'R') || (pvrHeader.id[3] != 3))
-            {
-                TraceLog(LOG_WARNING, "[%s] PVR file does not seem to be a valid image", fileName);
-            }
-            else
-            {
-                image.width = pvrHeader.width;
-                image.height = pvrHeader.height;
-                image.mipmaps = pvrHeader.numMipmaps;
+    return &residencyTextures[residencyIndices[id]];
+}
 
-                // Check data format
-                if (((pvrHeader.channels[0] == 'l') && (pvrHeader.channels[1] == 0)) && (pvrHeader.channelDepth[0] == 8))
-                    image.format = UNCOMPRESSED_GRAYSCALE;
-                else if (((pvrHeader.channels[0] == 'l') && (pvrHeader.channels[1] == 'a')) && ((pvrHeader.channelDepth[0] == 8) && (pvrHeader.channelDepth[1] == 8)))
-                    image.format = UNCOMPRESSED_GRAY_ALPHA;
-                else if ((pvrHeader.channels[0] == 'r') && (pvrHeader.channels[1] == 'g') && (pvrHeader.channels[2] == 'b'))
-                {
-                    if (pvrHeader.channels[3] == 'a')
-                    {
-                        if ((pvrHeader.channelDepth[0] == 5) && (pvrHeader.channelDepth[1] == 5) && (pvrHeader.channelDepth[2] == 5) && (pvrHeader.channelDepth[3] == 1))
-                            image.format = UNCOMPRESSED_R5G5B5A1;
-                        else if ((pvrHeader.channelDepth[0] == 4) && (pvrHeader.channelDepth[1] == 4) && (pvrHeader.channelDepth[2] == 4) && (pvrHeader.channelDepth[3] == 4))
-                            image.format = UNCOMPRESSED_R4G4B4A4;
-                        else if ((pvrHeader.channelDepth[0] == 8) && (pvrHeader.channelDepth[1] == 8) && (pvrHeader.channelDepth[2] == 8) && (pvrHeader.channelDepth[3] == 8))
-                            image.format = UNCOMPRESSED_R8G8B8A8;
-                    }
-                    else if (pvrHeader.channels[3] == 0)
-                    {
-                        if ((pvrHeader.channelDepth[0] == 5) && (pvrHeader.channelDepth[1] == 6) && (pvrHeader.channelDepth[2] == 5)) image.format = UNCOMPRESSED_R5G6B5;
-                        else if ((pvrHeader.channelDepth[0] == 8) && (pvrHeader.channelDepth[1] == 8) && (pvrHeader.channelDepth[2] == 8)) image.format = UNCOMPRESSED_R8G8B8;
-                    }
-                }
-                else if (pvrHeader.channels[0] == 2) image.format = COMPRESSED_PVRT_RGB;
-                else if (pvrHeader.channels[0] == 3) image.format = COMPRESSED_PVRT_RGBA;
+// Reload texture data from source file if it was evicted
+// NOTE: If file data does not match texture anymore, texture is kept evicted (1x1 white texel)
+static void EnsureTextureResident(unsigned int id)
+{
+    TextureResidency *entry = GetTextureResidency(id);
 
-                // Skip meta data header
-                unsigned char unused = 0;
-                for (int i = 0; i < pvrHeader.metaDataSize; i++) fread(&unused, sizeof(unsigned char), 1, pvrFile);
+    if ((entry == NULL) || entry->resident || (entry->fileName == NULL)) return;
 
-                // Calculate data size (depends on format)
-                int bpp = 0;
+    Image image = LoadImageMapped(entry->fileName);
 
-                switch (image.format)
-                {
-                    case UNCOMPRESSED_GRAYSCALE: bpp = 8; break;
-                    case UNCOMPRESSED_GRAY_ALPHA:
-                    case UNCOMPRESSED_R5G5B5A1:
-                    case UNCOMPRESSED_R5G6B5:
-                    case UNCOMPRESSED_R4G4B4A4: bpp = 16; break;
-                    case UNCOMPRESSED_R8G8B8A8: bpp = 32; break;
-                    case UNCOMPRESSED_R8G8B8: bpp = 24; break;
-                    case COMPRESSED_PVRT_RGB:
-                    case COMPRESSED_PVRT_RGBA: bpp = 4; break;
-                    default: break;
-                }
+    if ((image.data != NULL) && (image.width == entry->width) && (image.height == entry->height) &&
+        (image.format == entry->format) && (image.mipmaps == entry->mipmaps) &&
+        rlReloadTexture(id, image.data, image.width, image.height, image.format, image.mipmaps))
+    {
+        entry->resident = true;
+        textureMemoryUsed += entry->size;
 
-                int dataSize = image.width*image.height*bpp/8;  // Total data size in bytes
-                image.data = (unsigned char *)RL_MALLOC(dataSize*sizeof(unsigned char));
+        TraceLog(LOG_INFO, "[TEX ID %i] Texture data reloaded from file: %s", id, entry->fileName);
+    }
+    else TraceLog(LOG_WARNING, "[TEX ID %i] Texture data could not be reloaded from file: %s", id, entry->fileName);
 
-                // Read data from file
-                fread(image.data, dataSize, 1, pvrFile);
-            }
-        }
-        else if (pvrVersion == 52) TraceLog(LOG_INFO, "PVR v2 not supported, update your files to PVR v3");
+    UnloadImage(image);
+}
 
-        fclose(pvrFile);    // Close file pointer
-    }
+// Texture data is going to be modified, reload it if evicted and stop evicting it (source file does not match anymore)
+static void ReleaseTextureSource(unsigned int id)
+{
+    TextureResidency *entry = GetTextureResidency(id);
 
-    return image;
+    if ((entry == NULL) || (entry->fileName == NULL)) return;
+
+    EnsureTextureResident(id);
+
+    RL_FREE(entry->fileName);
+    entry->fileName = NULL;
 }
-#endif
 
-#if defined(SUPPORT_FILEFORMAT_ASTC)
-// Load ASTC compressed image data (ASTC compression)
-static Image LoadASTC(const char *fileName)
+// Texture used for drawing callback (rlgl), evicted texture data is reloaded before drawing
+static void TextureUsed(unsigned int id)
 {
-    // Required extensions:
-    // GL_KHR_texture_compression_astc_hdr
-    // GL_KHR_texture_compression_astc_ldr
+    TextureResidency *entry = GetTextureResidency(id);
 
-    // Supported tokens (defined by extensions)
-    // GL_COMPRESSED_RGBA_ASTC_4x4_KHR      0x93b0
-    // GL_COMPRESSED_RGBA_ASTC_8x8_KHR      0x93b7
+    if (entry == NULL) return;
 
-    // ASTC file Header (16 bytes)
-    typedef struct {
-        unsigned char id[4];        // Signature: 0x13 0xAB 0xA1 0x5C
-        unsigned char blockX;       // Block X dimensions
-        unsigned char blockY;       // Block Y dimensions
-        unsigned char blockZ;       // Block Z dimensions (1 for 2D images)
-        unsigned char width[3];     // Image width in pixels (24bit value)
-        unsigned char height[3];    // Image height in pixels (24bit value)
-        unsigned char length[3];    // Image Z-size (1 for 2D images)
-    } ASTCHeader;
+    entry->lastUse = residencyFrame;
 
-    Image image = { 0 };
+    if (!entry->resident) EnsureTextureResident(id);
+}
 
-    FILE *astcFile = fopen(fileName, "rb");
+// Upload next mipmap level rows of progressive texture within budget, returns bytes uploaded
+// NOTE: If force is requested at least one row (GPU compressed formats: one level) is uploaded
+static int UploadTextureLevel(TextureUpload *upload, int budget, bool force)
+{
+    Image *image = &upload->image;
+    int level = upload->level - 1;
+    int width = ((image->width >> level) > 0)? (image->width >> level) : 1;
+    int height = ((image->height >> level) > 0)? (image->height >> level) : 1;
 
-    if (astcFile == NULL)
+    int offset = 0;
+    for (int i = 0; i < level; i++)
     {
-        TraceLog(LOG_WARNING, "[%s] ASTC file could not be opened", fileName);
+        offset += GetPixelDataSize(((image->width >> i) > 0)? (image->width >> i) : 1, ((image->height >> i) > 0)? (image->height >> i) : 1, image->format);
+    }
+
+    int uploaded = 0;
+
+    if (image->format >= COMPRESSED_DXT1_RGB)
+    {
+        uploaded = GetPixelDataSize(width, height, image->format);
+        if ((uploaded > budget) && !force) return 0;
+
+        rlUpdateTextureMipmap(upload->id, level, 0, width, height, image->format, (unsigned char *)image->data + offset);
+        upload->row = height;
     }
     else
     {
-        ASTCHeader astcHeader;
+        int rowSize = GetPixelDataSize(width, 1, image->format);
+        int rows = height - upload->row;
 
-        // Get ASTC image header
-        fread(&astcHeader, sizeof(ASTCHeader), 1, astcFile);
+        if (rows*rowSize > budget) rows = (budget > 0)? budget/rowSize : 0;
+        if ((rows == 0) && force) rows = 1;
+        if (rows == 0) return 0;
 
-        if ((astcHeader.id[3] != 0x5c) || (astcHeader.id[2] != 0xa1) || (astcHeader.id[1] != 0xab) || (astcHeader.id[0] != 0x13))
-        {
-            TraceLog(LOG_WARNING, "[%s] ASTC file does not seem to be a valid image", fileName);
-        }
-        else
-        {
-            // NOTE: Assuming Little Endian (could it be wrong?)
-            image.width = 0x00000000 | ((int)astcHeader.width[2] << 16) | ((int)astcHeader.width[1] << 8) | ((int)astcHeader.width[0]);
-            image.height = 0x00000000 | ((int)astcHeader.height[2] << 16) | ((int)astcHeader.height[1] << 8) | ((int)astcHeader.height[0]);
+        rlUpdateTextureMipmap(upload->id, level, upload->row, width, rows, image->format, (unsigned char *)image->data + offset + upload->row*rowSize);
+        upload->row += rows;
+        uploaded = rows*rowSize;
+    }
 
-            TraceLog(LOG_DEBUG, "ASTC image width: %i", image.width);
-            TraceLog(LOG_DEBUG, "ASTC image height: %i", image.height);
-            TraceLog(LOG_DEBUG, "ASTC image blocks: %ix%i", astcHeader.blockX, astcHeader.blockY);
+    // Level completed, it can be sampled
+    if (upload->row == height)
+    {
+        upload->level = level;
+        upload->row = 0;
 
-            image.mipmaps = 1;      // NOTE: ASTC format only contains one mipmap level
+        rlSetTextureMipmapRange(upload->id, level, image->mipmaps - 1);
+    }
 
-            // NOTE: Each block is always stored in 128bit so we can calculate the bpp
-            int bpp = 128/(astcHeader.blockX*astcHeader.blockY);
+    return uploaded;
+}
 
-            // NOTE: Currently we only support 2 blocks configurations: 4x4 and 8x8
-            if ((bpp == 8) || (bpp == 2))
-            {
-                int dataSize = image.width*image.height*bpp/8;  // Data size in bytes
+// Release progressive texture upload data and remove it from uploads in progress
+// NOTE: Completed textures loaded with file mipmaps can be evicted and reloaded from file (residency)
+static void FinishTextureUpload(int index, bool completed)
+{
+    TextureUpload *upload = &textureUploads[index];
 
-                image.data = (unsigned char *)RL_MALLOC(dataSize*sizeof(unsigned char));
-                fread(image.data, dataSize, 1, astcFile);
+    UnloadImage(upload->image);
 
-                if (bpp == 8) image.format = COMPRESSED_ASTC_4x4_RGBA;
-                else if (bpp == 2) image.format = COMPRESSED_ASTC_8x8_RGBA;
-            }
-            else TraceLog(LOG_WARNING, "[%s] ASTC block size configuration not supported", fileName);
+    TextureResidency *entry = GetTextureResidency(upload->id);
+
+    if (completed && (entry != NULL) && (upload->fileName != NULL))
+    {
+        entry->fileName = upload->fileName;
+        upload->fileName = NULL;
+    }
+
+    if (completed) TraceLog(LOG_INFO, "[TEX ID %i] Texture loaded progressively (%i mipmaps)", upload->id, upload->image.mipmaps);
+
+    RL_FREE(upload->fileName);
+
+    textureUploadsCount--;
+    memmove(&textureUploads[index], &textureUploads[index + 1], (textureUploadsCount - index)*sizeof(TextureUpload));
+}
+
+// Reload cached texture data in place from modified file (hot reload), texture id is kept
+// NOTE: Texture size, format and mipmaps must match, shared Texture2D copies can not be updated
+static bool ReloadCachedTexture(void *asset, const char *fileName, const char *fileName2)
+{
+    Texture2D *texture = (Texture2D *)asset;
+    bool success = false;
+
+    Image image = LoadImageMapped(fileName);
+
+    if (image.data != NULL)
+    {
+        if ((image.width == texture->width) && (image.height == texture->height) &&
+            (image.format == texture->format) && (image.mipmaps == texture->mipmaps))
+        {
+            EnsureTextureResident(texture->id);     // Keep VRAM budget tracking consistent
+            success = rlReloadTexture(texture->id, image.data, image.width, image.height, image.format, image.mipmaps);
         }
+        else TraceLog(LOG_WARNING, "[TEX ID %i] Texture size or format changed, it can not be reloaded in place: %s", texture->id, fileName);
 
-        fclose(astcFile);
+        UnloadImage(image);
     }
 
-    return image;
+    return success;
 }
-#endif
@@ -6,7 +6,29 @@
 *
 *   #define SUPPORT_TRACELOG
 *       Show TraceLog() output messages
-*       NOTE: By default LOG_DEBUG traces not shown
+*       NOTE: By default LOG_DEBUG traces not shown, messages can be written on a background thread (SetTraceLogAsync())
+*
+*   #define SUPPORT_WORKER_THREADS
+*       Run internal jobs (asynchronous image loading, image processing) on a worker threads pool
+*       NOTE: Requires POSIX threads, on other platforms jobs run on the calling thread
+*
+*   #define SUPPORT_MEMORY_TRACKING
+*       Track memory allocations by subsystem (RL_MALLOC() tags), current and peak usage reported by GetMemoryStats()
+*
+*   #define SUPPORT_PROFILER
+*       CPU frame profiler timing zones (BeginProfileZone()/EndProfileZone()), disabled until EnableProfiler()
+*
+*   #define PROFILER_THREAD_LOCAL
+*       Storage qualifier of profiler per thread state (thread-local by default),
+*       define it empty for compilers without thread-local storage support (main thread zones only)
+*
+*   #define SCRATCH_MEMORY_SIZE
+*       Size of scratch memory arena (frame and call temporary allocations), allocations that
+*       do not fit go to memory allocator
+*
+*   #define SCRATCH_THREAD_LOCAL
+*       Storage qualifier of scratch memory owner thread flag (thread-local by default),
+*       define it empty for compilers without thread-local storage support (single thread programs only)
 *
 *
 *   LICENSE: zlib/libpng
@@ -30,6 +52,11 @@
 *
 **********************************************************************************************/
 
+#if defined(__linux__) && !defined(PLATFORM_ANDROID) && !defined(_GNU_SOURCE)
+    #define _GNU_SOURCE                 // Required for: fopencookie() [Used in pack files streams]
+#endif
+
+#define RL_MEMORY_TAG   MEMORY_TAG_CORE // Module allocations subsystem (GetMemoryStats())
 #include "raylib.h"                     // WARNING: Required for: LogType enum
 
 // Check if config flags have been externally provided on compilation line
@@ -50,10 +77,127 @@
 #include <stdarg.h>                     // Required for: va_list, va_start(), vfprintf(), va_end()
 #include <string.h>                     // Required for: strcpy(), strcat()
 
+// Scratch memory arena, rmem functions kept internal to raylib (programs can include their own rmem implementation)
+#define RMEMAPI static inline
+#define RMEM_IMPLEMENTATION
+#include "rmem.h"                       // Required for: BiStack, CreateBiStackFromBuffer(), BiStackAllocFront(), BiStackAllocBack()
+
+#if defined(SUPPORT_WORKER_THREADS) && !defined(_WIN32) && !defined(PLATFORM_WEB)
+    #include <pthread.h>                // Required for: pthread_create(), pthread_mutex_*, pthread_cond_*
+    #include <unistd.h>                 // Required for: sysconf()
+    #define WORKER_THREADS_AVAILABLE
+#endif
+
+// Trace log messages written on a background thread (SetTraceLogAsync())
+#if defined(SUPPORT_TRACELOG) && !defined(_WIN32) && !defined(PLATFORM_WEB)
+    #include <pthread.h>                // Required for: pthread_create(), pthread_join(), pthread_cond_*
+    #include <time.h>                   // Required for: time(), clock_gettime()
+    #define TRACELOG_ASYNC_AVAILABLE
+#endif
+
+// File watches backend: inotify on Linux, files modification time polling otherwise
+#if defined(__linux__)
+    #include <sys/inotify.h>            // Required for: inotify_init1(), inotify_add_watch(), inotify_rm_watch()
+    #include <unistd.h>                 // Required for: read(), close()
+    #define FILE_WATCH_INOTIFY
+#endif
+
+// Profiler state is kept per thread, zones are recorded without locks
+#if defined(SUPPORT_PROFILER)
+    #if !defined(PROFILER_THREAD_LOCAL)
+        #if defined(_MSC_VER)
+            #define PROFILER_THREAD_LOCAL __declspec(thread)
+        #elif defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 201112L) && !defined(__STDC_NO_THREADS__)
+            #define PROFILER_THREAD_LOCAL _Thread_local
+        #else
+            #define PROFILER_THREAD_LOCAL __thread
+        #endif
+    #endif
+
+    #if defined(_MSC_VER)
+        #include <intrin.h>             // Required for: _InterlockedIncrement(), _ReadWriteBarrier()
+        #define PROFILER_ATOMIC_INC(x)  _InterlockedIncrement((long volatile *)(x))
+        #define PROFILER_BARRIER()      _ReadWriteBarrier()
+    #else
+        #define PROFILER_ATOMIC_INC(x)  __sync_add_and_fetch((x), 1)
+        #define PROFILER_BARRIER()      __sync_synchronize()
+    #endif
+#endif
+
+// Memory allocations tracking table is shared by all threads, protected by a spin lock
+#if defined(SUPPORT_MEMORY_TRACKING)
+    #if defined(_MSC_VER)
+        #include <intrin.h>             // Required for: _InterlockedExchange()
+        #define MEMORY_LOCK()           while (_InterlockedExchange(&memTrackingLock, 1) != 0) { }
+        #define MEMORY_UNLOCK()         _InterlockedExchange(&memTrackingLock, 0)
+    #else
+        #define MEMORY_LOCK()           while (__sync_lock_test_and_set(&memTrackingLock, 1) != 0) { }
+        #define MEMORY_UNLOCK()         __sync_lock_release(&memTrackingLock)
+    #endif
+#endif
+
+// Scratch memory is owned by the thread that creates it (InitWindow() or first MemAllocScratch() call)
+#if !defined(SCRATCH_THREAD_LOCAL)
+    #if defined(_MSC_VER)
+        #define SCRATCH_THREAD_LOCAL __declspec(thread)
+    #elif defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 201112L) && !defined(__STDC_NO_THREADS__)
+        #define SCRATCH_THREAD_LOCAL _Thread_local
+    #else
+        #define SCRATCH_THREAD_LOCAL __thread
+    #endif
+#endif
+
+// Pack files memory-mapping support (MountPackFile())
+// NOTE: Android packs are read from APK assets buffer, other platforms read pack data into memory
+#if defined(SUPPORT_PACK_FILES) && (defined(__unix__) || defined(__APPLE__)) && !defined(PLATFORM_ANDROID) && !defined(PLATFORM_WEB)
+    #include <sys/mman.h>               // Required for: mmap(), munmap()
+    #include <sys/stat.h>               // Required for: fstat()
+    #include <fcntl.h>                  // Required for: open()
+    #include <unistd.h>                 // Required for: close()
+    #define PACK_FILE_MAPPING
+#endif
+
+// Packed files streams: funopen() on BSD libc (Android, macOS), fopencookie() on glibc, temporary files otherwise
+#if defined(SUPPORT_PACK_FILES) && (defined(PLATFORM_ANDROID) || defined(__APPLE__))
+    #define PACK_STREAM_FUNOPEN
+#elif defined(SUPPORT_PACK_FILES) && defined(__GLIBC__)
+    #define PACK_STREAM_FOPENCOOKIE
+#endif
+
 #define MAX_TRACELOG_BUFFER_SIZE   128  // Max length of one trace-log message
+#define MAX_TRACELOG_MSG_LENGTH    256  // Max length of one trace-log message formatted on asynchronous mode
+#define MAX_TRACELOG_QUEUE        1024  // Max number of trace-log messages queued on asynchronous mode (full queue drops messages)
+#define MAX_TRACELOG_SITES         256  // Max number of trace-log formats rate limited on asynchronous mode
+#define TRACELOG_RATE_LIMIT         20  // Max number of warnings per second with the same format on asynchronous mode
+
+#define MAX_WORKER_THREADS          16  // Max number of worker threads
+#define MAX_WORKER_JOBS           1024  // Max number of jobs queued (if queue is full, job runs on calling thread)
+#define MAX_ASYNC_FILES_PER_FRAME   64  // Max number of files data delivered per frame by LoadFileDataAsync() (callbacks)
 
 #define MAX_UWP_MESSAGES 512            // Max UWP messages to process
 
+#if !defined(SCRATCH_MEMORY_SIZE)
+    #define SCRATCH_MEMORY_SIZE (4*1024*1024)   // Scratch memory arena size (frame and call temporary allocations)
+#endif
+#define SCRATCH_HEADER_SIZE         16  // Call scratch allocations header (previous arena back position), keeps data aligned
+
+#define MAX_FILE_CHANGE_EVENTS     256  // Max number of file change events queued (GetFileChangeEvent())
+#define FILE_WATCH_POLL_INTERVAL    1.0 // Watched files modification check interval, if no watch backend available (in seconds)
+
+#define MAX_PROFILE_THREADS         16  // Max number of threads recording profile zones
+#define MAX_PROFILE_EVENTS        8192  // Max number of profile zones kept per thread (ring buffer, ExportProfileTrace())
+#define MAX_PROFILE_ZONE_DEPTH      32  // Max number of nested profile zones per thread
+#define MAX_PROFILE_ZONES           64  // Max number of profile zones statistics per frame (GetProfileZones())
+
+#define MAX_MOUNTED_PACKS            8  // Max number of pack files mounted at the same time
+#define MAX_PACK_PATH_LENGTH       512  // Max length of a packed file path (mount path included)
+
+#define PACK_COMPRESSION_NONE        0  // Packed file stored uncompressed (zero-copy access)
+#define PACK_COMPRESSION_LZ4         1  // Packed file stored as a LZ4 block
+
+#define LZ4_HASH_BITS               12  // LZ4 compression matches hash table bits (CompressLZ4())
+#define LZ4_HASH_TABLE_SIZE (1 << LZ4_HASH_BITS)
+
 //----------------------------------------------------------------------------------
 // Global Variables Definition
 //----------------------------------------------------------------------------------
@@ -63,10 +207,236 @@ static int logTypeLevel = LOG_INFO;                     // Minimum log type leve
 static int logTypeExit = LOG_ERROR;                     // Log type that exits
 static TraceLogCallback logCallback = NULL;             // Log callback function pointer
 
+// Memory allocator (NULL callbacks: standard library)
+static MemAllocCallback memAllocCallback = NULL;        // Memory allocation callback
+static MemReallocCallback memReallocCallback = NULL;    // Memory reallocation callback
+static MemFreeCallback memFreeCallback = NULL;          // Memory free callback
+static void *memUserData = NULL;                        // Memory allocator callbacks user data
+
+#if defined(SUPPORT_MEMORY_TRACKING)
+// Tracked memory allocation (open addressing hash table slot, by pointer)
+typedef struct MemoryAllocation {
+    void *ptr;                  // Allocated memory (NULL if slot is free)
+    unsigned int size;          // Allocation size (in bytes)
+    int tag;                    // Allocation subsystem (MemoryTag)
+} MemoryAllocation;
+
+static MemoryAllocation *memAllocations = NULL;         // Tracked allocations hash table (linear probing)
+static unsigned int memAllocationsSize = 0;             // Tracked allocations table slots (power of two)
+static unsigned int memAllocationsCount = 0;            // Tracked allocations alive
+static MemoryUsage memUsage = { 0 };                    // Memory usage, all subsystems
+static MemoryUsage memUsageTags[MAX_MEMORY_TAGS] = { 0 };   // Memory usage by subsystem
+static volatile long memTrackingLock = 0;               // Tracking table lock (allocations from any thread)
+#endif
+
+// Scratch memory arena: frame allocations on front side, call allocations on back side
+static BiStack scratch = { 0 };                         // Scratch memory arena (owner thread only)
+static bool scratchCreated = false;                     // Scratch memory created (owner thread assigned)
+static void **scratchOverflow = NULL;                   // Frame allocations not fitting on arena (memory allocator, freed at frame end)
+static int scratchOverflowCount = 0;                    // Frame allocations not fitting on arena count
+static int scratchOverflowCapacity = 0;                 // Frame allocations not fitting on arena array capacity
+static SCRATCH_THREAD_LOCAL bool scratchOwner = false;  // Calling thread owns scratch memory
+
+#if defined(TRACELOG_ASYNC_AVAILABLE)
+// Trace log message queued, slot sequence orders producers and consumer (bounded lock-free queue)
+typedef struct TraceLogMessage {
+    volatile unsigned int sequence;     // Slot sequence: queue position to write (free) or position + 1 (written)
+    int logType;                        // Message log type
+    char text[MAX_TRACELOG_MSG_LENGTH]; // Message formatted
+} TraceLogMessage;
+
+// Trace log call site rate limiting, identified by format string pointer
+typedef struct TraceLogSite {
+    const char *volatile format;        // Message format (NULL if slot is free)
+    volatile unsigned int second;       // Current rate limiting window (seconds)
+    volatile int count;                 // Messages logged on current window
+} TraceLogSite;
+
+// Trace log asynchronous writer
+static struct {
+    TraceLogMessage queue[MAX_TRACELOG_QUEUE];  // Messages queue (ring buffer)
+    volatile unsigned int head;         // Next queue position to write (producers)
+    unsigned int tail;                  // Next queue position to read (logger thread)
+    TraceLogSite sites[MAX_TRACELOG_SITES];     // Rate limited call sites
+    volatile int dropped;               // Messages dropped since last report (queue full)
+    volatile int limited;               // Messages rate limited since last report
+    volatile bool running;              // Messages are queued (logger thread running)
+    volatile bool quit;                 // Request logger thread to exit (after writing queued messages)
+    bool exitRegistered;                // Queued messages writing registered on program exit
+    pthread_t thread;                   // Logger thread
+    pthread_mutex_t mutex;              // Guards logger thread waiting only (producers never lock)
+    pthread_cond_t messageAvailable;    // Signaled when a message is queued (or on quit)
+} traceLogAsync = { 0 };
+#endif
+
 #if defined(PLATFORM_ANDROID)
 static AAssetManager *assetManager = NULL;              // Android assets manager pointer 
 #endif
 
+#if defined(WORKER_THREADS_AVAILABLE)
+// Worker job queued
+typedef struct WorkerJob {
+    WorkerJobFunc func;                 // Job function
+    void *data;                         // Job data
+    int *pending;                       // Pending jobs counter to decrement when done (can be NULL)
+} WorkerJob;
+
+// Worker threads pool
+static struct {
+    pthread_t threads[MAX_WORKER_THREADS];  // Worker threads
+    int threadCount;                    // Number of worker threads running
+    int requestedCount;                 // Number of worker threads requested (-1: number of cores - 1)
+    WorkerJob jobs[MAX_WORKER_JOBS];    // Jobs queue (ring buffer)
+    int jobsHead;                       // Next job to run
+    int jobsCount;                      // Number of jobs queued
+    bool quit;                          // Request worker threads to exit
+    pthread_mutex_t mutex;              // Guards queue and pending counters
+    pthread_cond_t jobAvailable;        // Signaled when a job is queued (or on quit)
+    pthread_cond_t jobDone;             // Signaled when a job finishes
+    pthread_mutex_t initMutex;          // Guards lazy initialization (jobs submitted from any thread)
+} workerPool = { .requestedCount = -1, .initMutex = PTHREAD_MUTEX_INITIALIZER };
+
+#define JOB_ATOMIC_FETCH_ADD(x, v)      __sync_fetch_and_add((x), (v))
+#else
+#define JOB_ATOMIC_FETCH_ADD(x, v)      ((*(x) += (v)) - (v))
+#endif
+
+// Parallel for loop shared state, chunks are claimed atomically by every participating thread
+typedef struct ParallelForJob {
+    ParallelForFunc func;               // Loop body function, called once per chunk
+    void *data;                         // User data
+    int count;                          // Number of iterations
+    int chunkSize;                      // Number of iterations per chunk
+    int chunkCount;                     // Number of chunks
+    int nextChunk;                      // Next chunk to run (atomic)
+} ParallelForJob;
+
+// Asynchronous file data load request, file read on worker thread
+typedef struct AsyncFileRequest {
+    char *fileName;             // File name (copied)
+    unsigned char *data;        // File data read, NULL if reading failed
+    unsigned int bytesRead;     // File data size in bytes
+    int pending;                // Worker job pending counter (0 when file is read)
+    LoadFileDataCallback callback;  // Callback called on main thread when file is read
+    void *userData;             // Callback user data
+    struct AsyncFileRequest *next;  // Next request in list
+} AsyncFileRequest;
+
+static AsyncFileRequest *asyncFileRequests = NULL;      // Asynchronous file data requests not delivered yet (LoadFileDataAsync())
+
+// Assets cache entry, asset data copied (value struct), shared by every load
+typedef struct AssetCacheEntry {
+    int type;                   // Asset type (AssetType)
+    char *fileName;             // Asset file name
+    char *fileName2;            // Asset second file name (i.e. fragment shader), NULL if not used
+    long modTime;               // File modification time when loaded
+    long modTime2;              // Second file modification time when loaded
+    int refCount;               // Asset references (loads not unloaded yet)
+    unsigned long long handle;  // Asset identifier (texture id, meshes address...)
+    void *asset;                // Asset data (value struct copy)
+    AssetReloadFunc reload;     // Asset reload in place function (hot reload), NULL if not supported
+    bool stale;                 // Files modified, entry is not returned to new loads
+    int watch;                  // File watch (hot reload), 0 if not watched
+    int watch2;                 // Second file watch (hot reload), 0 if not watched
+} AssetCacheEntry;
+
+static AssetCacheEntry *assetsCache = NULL;             // Cached assets
+static int assetsCacheCount = 0;                        // Cached assets count
+static int assetsCacheCapacity = 0;                     // Cached assets array capacity
+static bool assetsHotReload = false;                    // Cached assets reloaded on files modification (SetAssetsHotReload())
+
+// File watch, files are watched through their directory (files replaced on saving keep being watched)
+typedef struct FileWatch {
+    int id;                     // Watch id (0 if watch slot is not used)
+    char *path;                 // Watched file or directory path
+    const char *name;           // Watched file name (points into path), NULL if watching a directory
+    bool internal;              // Watch used internally (assets hot reload), changes are not queued
+    bool changed;               // Watched file changed since last check (internal watches)
+    int wd;                     // Watched directory inotify descriptor
+    long modTime;               // Watched file modification time (polling)
+} FileWatch;
+
+// File change event queued
+typedef struct FileChange {
+    int watch;                  // Watch id
+    int type;                   // Change type (FileChangeType)
+    char *fileName;             // Changed file path
+} FileChange;
+
+static FileWatch *fileWatches = NULL;                   // File watches
+static int fileWatchesCount = 0;                        // File watches array size (used and free slots)
+static int fileWatchNextId = 1;                         // Next file watch id
+#if defined(FILE_WATCH_INOTIFY)
+static int fileWatchFd = -1;                            // File watches inotify instance
+#else
+static double fileWatchLastCheck = 0.0;                 // Last watched files modification check time (polling)
+#endif
+static FileChange fileChanges[MAX_FILE_CHANGE_EVENTS] = { 0 };  // File change events queue (ring buffer)
+static int fileChangesHead = 0;                         // File change events queue first event
+static int fileChangesCount = 0;                        // File change events queued
+static char *fileChangeName = NULL;                     // Last file change event path returned (freed on next event)
+
+#if defined(SUPPORT_PROFILER)
+// Profile zone recorded, written once zone ends
+typedef struct ProfileEvent {
+    const char *name;           // Zone name (static string provided on BeginProfileZone())
+    double start;               // Zone start time (seconds, GetTime() clock)
+    double end;                 // Zone end time (seconds, GetTime() clock)
+    int depth;                  // Zone nesting depth on its thread
+} ProfileEvent;
+
+// Profile zones recorded by one thread, only written by owner thread
+typedef struct ProfileThread {
+    ProfileEvent events[MAX_PROFILE_EVENTS];    // Ended zones (ring buffer)
+    volatile unsigned int eventsCount;          // Ended zones written since thread registration (published after event data)
+    unsigned int eventsRead;                    // Ended zones already aggregated on frame statistics (main thread)
+    const char *openNames[MAX_PROFILE_ZONE_DEPTH];  // Open zones names
+    double openStarts[MAX_PROFILE_ZONE_DEPTH];  // Open zones start times
+    int depth;                                  // Open zones count (including zones over MAX_PROFILE_ZONE_DEPTH)
+    int id;                                     // Thread index on profile threads
+} ProfileThread;
+
+static ProfileThread *profileThreads[MAX_PROFILE_THREADS] = { 0 };  // Threads recording profile zones
+static volatile int profileThreadsCount = 0;            // Threads registered (slots reserved, may be over MAX_PROFILE_THREADS)
+static volatile int profileGeneration = 1;              // Profile threads generation, threads register again after CloseProfiler()
+static volatile bool profilerEnabled = false;           // Profile zones recording enabled (EnableProfiler())
+static ProfileZoneStats profileZones[MAX_PROFILE_ZONES] = { 0 };    // Profile zones statistics of last frame
+static int profileZonesCount = 0;                       // Profile zones statistics count
+static double profileFrameStart = 0.0;                  // Current frame start time (UpdateProfiler())
+
+static PROFILER_THREAD_LOCAL ProfileThread *profileThread = NULL;   // Calling thread profile zones
+static PROFILER_THREAD_LOCAL int profileThreadGeneration = 0;       // Calling thread registration generation
+#endif
+
+#if defined(SUPPORT_PACK_FILES)
+// Pack file entry (packed file), name points into pack data (not NULL terminated)
+typedef struct PackEntry {
+    const char *name;           // Packed file name (relative to mount path)
+    int nameLength;             // Packed file name length
+    int compression;            // Packed file compression (PACK_COMPRESSION_*)
+    unsigned int offset;        // Packed file data offset in pack
+    unsigned int dataSize;      // Packed file data size in pack
+    unsigned int size;          // Packed file size (uncompressed)
+} PackEntry;
+
+// Mounted pack file, entries looked up by name hash (open addressing)
+typedef struct PackFile {
+    char *fileName;             // Pack file name
+    char *mountPath;            // Path packed files are mounted at (empty: working directory)
+    const unsigned char *data;  // Pack file data
+    unsigned int dataSize;      // Pack file data size
+    bool mapped;                // Pack file data is memory-mapped (otherwise allocated or Android asset buffer)
+    void *asset;                // Android asset kept open for pack data (AAsset)
+    PackEntry *entries;         // Packed files
+    int entriesCount;           // Packed files count
+    int *lookup;                // Packed files indices by name hash, -1 if empty slot
+    int lookupSize;             // Lookup table size (power of two)
+} PackFile;
+
+static PackFile packs[MAX_MOUNTED_PACKS] = { 0 };       // Mounted pack files
+static int packsCount = 0;                              // Mounted pack files count
+#endif
+
 #if defined(PLATFORM_UWP)
 static int UWPOutMessageId = -1;                        // Last index of output message
 static UWPMessage *UWPOutMessages[MAX_UWP_MESSAGES];    // Messages out to UWP
@@ -88,6 +458,55 @@ static fpos_t android_seek(void *cookie, fpos_t offset, int whence);
 static int android_close(void *cookie);
 #endif
 
+#if defined(SUPPORT_PACK_FILES)
+static void ClosePackFile(PackFile *pack);                                          // Release pack file data and index
+static const PackEntry *FindPackEntry(const char *fileName, const PackFile **pack);   // Find packed file in mounted packs (last mounted first)
+static unsigned int GetPackNameHash(const char *name, int length);                  // Get packed file name hash (FNV-1a)
+static FILE *OpenPackStream(const unsigned char *data, unsigned int size, unsigned char *buffer);  // Open read-only stream on packed file data (buffer is freed on close)
+#if defined(PACK_STREAM_FUNOPEN)
+static int pack_read(void *cookie, char *buf, int size);
+static int pack_write(void *cookie, const char *buf, int size);
+static fpos_t pack_seek(void *cookie, fpos_t offset, int whence);
+#elif defined(PACK_STREAM_FOPENCOOKIE)
+static ssize_t pack_read(void *cookie, char *buf, size_t size);
+static ssize_t pack_write(void *cookie, const char *buf, size_t size);
+static int pack_seek(void *cookie, off64_t *offset, int whence);
+#endif
+#if defined(PACK_STREAM_FUNOPEN) || defined(PACK_STREAM_FOPENCOOKIE)
+static int pack_close(void *cookie);
+#endif
+#endif
+
+#if defined(SUPPORT_MEMORY_TRACKING)
+static void TrackAllocation(void *ptr, unsigned int size, int tag);     // Register allocation on tracking table (memory usage)
+static bool UntrackAllocation(void *ptr, unsigned int *size, int *tag); // Remove allocation from tracking table, false if not tracked
+#endif
+
+#if defined(TRACELOG_ASYNC_AVAILABLE)
+static void WriteTraceLogMessage(int logType, const char *message); // Write formatted trace log message (callback, logcat or standard output)
+static void CallTraceLogCallback(int logType, const char *text, ...);   // Call trace log callback with variable arguments
+static bool IsTraceLogRateLimited(const char *format);  // Check message format rate limit, message counted on its site
+static void PushTraceLogMessage(int logType, const char *text, va_list args);   // Format and queue message (lock-free)
+static void *TraceLogThread(void *arg);                 // Logger thread loop, writes queued messages
+static void CloseTraceLogAsync(void);                   // Stop logger thread on program exit (queued messages written)
+#endif
+
+static int WriteLZ4Sequence(unsigned char *dst, int dstCapacity, int op, const unsigned char *literals, int literalCount, int offset, int matchLength);  // Write LZ4 sequence (literals and match)
+
+#if defined(WORKER_THREADS_AVAILABLE)
+static void InitWorkerThreads(void);                    // Start worker threads (requested count)
+static void *WorkerThread(void *arg);                   // Worker thread loop, runs queued jobs
+static bool RunNextWorkerJob(void);                     // Run next queued job on calling thread (mutex locked)
+#endif
+static void ParallelForJobRun(void *data);              // Run parallel for chunks until none left (ParallelForJob)
+static void LoadFileDataJob(void *data);                // Read file data, runs on worker thread (AsyncFileRequest)
+static FileWatch *GetFileWatch(int id);                 // Get file watch by id, NULL if not found
+static void PushFileChange(FileWatch *watch, int type, const char *name);   // Register file change (queued or flagged for internal watches)
+#if defined(SUPPORT_PROFILER)
+static ProfileThread *GetProfileThread(void);           // Get calling thread profile zones, registered on first call
+static int CompareProfileZones(const void *a, const void *b);   // Compare profile zones statistics (thread, start time)
+#endif
+
 //----------------------------------------------------------------------------------
 // Module Functions Definition - Utilities
 //----------------------------------------------------------------------------------
@@ -120,6 +539,21 @@ void TraceLog(int logType, const char *text, ...)
     va_list args;
     va_start(args, text);
 
+#if defined(TRACELOG_ASYNC_AVAILABLE)
+    if (traceLogAsync.running)
+    {
+        if (logType < logTypeExit)
+        {
+            PushTraceLogMessage(logType, text, args);
+            va_end(args);
+            return;
+        }
+
+        // Exit message is written directly once queued messages are written
+        SetTraceLogAsync(false);
+    }
+#endif
+
     if (logCallback)
     {
         logCallback(logType, text, args);
@@ -164,116 +598,2463 @@ void TraceLog(int logType, const char *text, ...)
 #endif  // SUPPORT_TRACELOG
 }
 
-#if defined(PLATFORM_ANDROID)
-// Initialize asset manager from android app
-void InitAssetManager(AAssetManager *manager)
+// Set trace log messages written on a background thread, calling thread only formats and queues them (lock-free)
+// NOTE: Warnings with the same format are rate limited (TRACELOG_RATE_LIMIT per second), repeated messages
+// are merged, exit messages (SetTraceLogExit()) are written directly after queued messages, disabling waits
+// for queued messages to be written. Not available without POSIX threads (messages are written directly)
+void SetTraceLogAsync(bool enabled)
 {
-    assetManager = manager;
-}
+#if defined(TRACELOG_ASYNC_AVAILABLE)
+    if (enabled && !traceLogAsync.running)
+    {
+        traceLogAsync.head = 0;
+        traceLogAsync.tail = 0;
+        for (int i = 0; i < MAX_TRACELOG_QUEUE; i++) traceLogAsync.queue[i].sequence = i;
 
-// Replacement for fopen
-FILE *android_fopen(const char *fileName, const char *mode)
-{
-    if (mode[0] == 'w') return NULL;
+        traceLogAsync.quit = false;
+        pthread_mutex_init(&traceLogAsync.mutex, NULL);
+        pthread_cond_init(&traceLogAsync.messageAvailable, NULL);
 
-    AAsset *asset = AAssetManager_open(assetManager, fileName, 0);
+        if (pthread_create(&traceLogAsync.thread, NULL, TraceLogThread, NULL) != 0)
+        {
+            pthread_cond_destroy(&traceLogAsync.messageAvailable);
+            pthread_mutex_destroy(&traceLogAsync.mutex);
+            TraceLog(LOG_WARNING, "Trace log thread could not be created, messages written directly");
+            return;
+        }
 
-    if (!asset) return NULL;
+        // Queued messages are written if program exits without disabling asynchronous mode
+        if (!traceLogAsync.exitRegistered) traceLogAsync.exitRegistered = (atexit(CloseTraceLogAsync) == 0);
 
-    return funopen(asset, android_read, android_write, android_seek, android_close);
+        __sync_synchronize();
+        traceLogAsync.running = true;
+    }
+    else if (!enabled && traceLogAsync.running)
+    {
+        // NOTE: Messages logged by logger thread (callback) are queued, it can not wait for itself
+        if (pthread_equal(pthread_self(), traceLogAsync.thread)) return;
+
+        traceLogAsync.running = false;
+        __sync_synchronize();
+
+        pthread_mutex_lock(&traceLogAsync.mutex);
+        traceLogAsync.quit = true;
+        pthread_cond_signal(&traceLogAsync.messageAvailable);
+        pthread_mutex_unlock(&traceLogAsync.mutex);
+
+        pthread_join(traceLogAsync.thread, NULL);
+
+        pthread_cond_destroy(&traceLogAsync.messageAvailable);
+        pthread_mutex_destroy(&traceLogAsync.mutex);
+    }
+#endif
 }
-#endif  // PLATFORM_ANDROID
 
 //----------------------------------------------------------------------------------
-// Module specific Functions Definition
+// Module Functions Definition - Memory management
 //----------------------------------------------------------------------------------
-#if defined(PLATFORM_ANDROID)
-static int android_read(void *cookie, char *buf, int size)
+
+// Set memory allocator (NULL: standard library)
+// NOTE: Memory allocated before changing allocator can not be freed with the new one
+void SetMemoryAllocator(MemAllocCallback allocCallback, MemReallocCallback reallocCallback, MemFreeCallback freeCallback, void *userData)
 {
-    return AAsset_read((AAsset *)cookie, buf, size);
+    if (((allocCallback == NULL) || (reallocCallback == NULL) || (freeCallback == NULL)) &&
+        ((allocCallback != NULL) || (reallocCallback != NULL) || (freeCallback != NULL)))
+    {
+        TraceLog(LOG_WARNING, "MEMORY: Allocator requires alloc, realloc and free callbacks");
+        return;
+    }
+
+    if (scratch.mem != NULL) TraceLog(LOG_WARNING, "MEMORY: Allocator changed after scratch memory creation");
+
+    memAllocCallback = allocCallback;
+    memReallocCallback = reallocCallback;
+    memFreeCallback = freeCallback;
+    memUserData = userData;
 }
 
-static int android_write(void *cookie, const char *buf, int size)
+// Allocate memory with raylib memory allocator
+void *MemAlloc(unsigned int size)
 {
-    TraceLog(LOG_ERROR, "Can't provide write access to the APK");
-
-    return EACCES;
+    return MemAllocTagged(size, MEMORY_TAG_USER);
 }
 
-static fpos_t android_seek(void *cookie, fpos_t offset, int whence)
+// Allocate memory initialized to zero with raylib memory allocator
+void *MemCalloc(unsigned int count, unsigned int size)
 {
-    return AAsset_seek((AAsset *)cookie, offset, whence);
+    return MemCallocTagged(count, size, MEMORY_TAG_USER);
 }
 
-static int android_close(void *cookie)
+// Reallocate memory allocated with raylib memory allocator
+void *MemRealloc(void *ptr, unsigned int size)
 {
-    AAsset_close((AAsset *)cookie);
-    return 0;
+    return MemReallocTagged(ptr, size, MEMORY_TAG_USER);
 }
-#endif  // PLATFORM_ANDROID
 
-#if defined(PLATFORM_UWP)
-UWPMessage *CreateUWPMessage(void)
+// Free memory allocated with raylib memory allocator
+void MemFree(void *ptr)
 {
-    UWPMessage *msg = (UWPMessage *)RL_MALLOC(sizeof(UWPMessage));
-    msg->type = UWP_MSG_NONE;
-    Vector2 v0 = { 0, 0 };
-    msg->paramVector0 = v0;
-    msg->paramInt0 = 0;
-    msg->paramInt1 = 0;
-    msg->paramChar0 = 0;
-    msg->paramFloat0 = 0;
-    msg->paramDouble0 = 0;
-    msg->paramBool0 = false;
-    return msg;
+#if defined(SUPPORT_MEMORY_TRACKING)
+    // NOTE: Allocation is untracked before memory is released, address can be reused by other threads
+    unsigned int size = 0;
+    int tag = 0;
+    if (ptr != NULL) UntrackAllocation(ptr, &size, &tag);
+#endif
+
+    if (memFreeCallback != NULL) memFreeCallback(ptr, memUserData);
+    else free(ptr);
 }
 
-void DeleteUWPMessage(UWPMessage *msg)
+// Allocate memory accounted to a subsystem
+void *MemAllocTagged(unsigned int size, int tag)
 {
-    RL_FREE(msg);
+    void *ptr = (memAllocCallback != NULL)? memAllocCallback(size, memUserData) : malloc(size);
+
+#if defined(SUPPORT_MEMORY_TRACKING)
+    if (ptr != NULL) TrackAllocation(ptr, size, tag);
+#endif
+
+    return ptr;
 }
 
-bool UWPHasMessages(void)
+// Allocate memory initialized to zero accounted to a subsystem
+void *MemCallocTagged(unsigned int count, unsigned int size, int tag)
 {
-    return (UWPOutMessageId > -1);
+    void *ptr = NULL;
+
+    if (memAllocCallback == NULL) ptr = calloc(count, size);
+    else
+    {
+        ptr = memAllocCallback(count*size, memUserData);
+        if (ptr != NULL) memset(ptr, 0, count*size);
+    }
+
+#if defined(SUPPORT_MEMORY_TRACKING)
+    if (ptr != NULL) TrackAllocation(ptr, count*size, tag);
+#endif
+
+    return ptr;
 }
 
-UWPMessage *UWPGetMessage(void)
+// Reallocate memory, new allocations accounted to a subsystem
+// NOTE: Reallocated memory keeps the subsystem it was allocated for
+void *MemReallocTagged(void *ptr, unsigned int size, int tag)
 {
-    if (UWPHasMessages()) return UWPOutMessages[UWPOutMessageId--];
+#if defined(SUPPORT_MEMORY_TRACKING)
+    unsigned int prevSize = 0;
+    bool tracked = (ptr != NULL) && UntrackAllocation(ptr, &prevSize, &tag);
+#endif
 
-    return NULL;
+    void *result = (memReallocCallback != NULL)? memReallocCallback(ptr, size, memUserData) : realloc(ptr, size);
+
+#if defined(SUPPORT_MEMORY_TRACKING)
+    if (result != NULL) TrackAllocation(result, size, tag);
+    else if (tracked && (size > 0)) TrackAllocation(ptr, prevSize, tag);   // Reallocation failed, previous memory is kept
+#endif
+
+    return result;
 }
 
-void UWPSendMessage(UWPMessage *msg)
+// Get memory usage statistics
+// NOTE: GPU memory usage is filled by GetMemoryStats() (core)
+void GetMemoryUsage(MemoryUsage *heap, MemoryUsage *tags)
 {
-    if ((UWPInMessageId + 1) < MAX_UWP_MESSAGES)
+#if defined(SUPPORT_MEMORY_TRACKING)
+    MEMORY_LOCK();
+    *heap = memUsage;
+    for (int i = 0; i < MAX_MEMORY_TAGS; i++) tags[i] = memUsageTags[i];
+    MEMORY_UNLOCK();
+#else
+    *heap = (MemoryUsage){ 0 };
+    for (int i = 0; i < MAX_MEMORY_TAGS; i++) tags[i] = (MemoryUsage){ 0 };
+#endif
+}
+
+// Allocate scratch memory, released at the end of the frame
+// NOTE: Only the thread owning scratch memory can allocate (NULL returned on other threads)
+void *MemAllocScratch(unsigned int size)
+{
+    if (!scratchOwner)
     {
-        UWPInMessageId++;
-        UWPInMessages[UWPInMessageId] = msg;
+        if (scratchCreated) return NULL;
+        InitScratchMemory();
     }
-    else TraceLog(LOG_WARNING, "[UWP Messaging] Not enough array space to register new UWP inbound Message.");
+
+    void *ptr = BiStackAllocFront(&scratch, size);
+
+    if (ptr == NULL)
+    {
+        // Arena full, allocation is tracked to be freed at frame end
+        if (scratchOverflowCount == scratchOverflowCapacity)
+        {
+            int capacity = (scratchOverflowCapacity == 0)? 16 : scratchOverflowCapacity*2;
+            void **overflow = (void **)RL_REALLOC(scratchOverflow, capacity*sizeof(void *));
+
+            if (overflow == NULL) return NULL;
+
+            scratchOverflow = overflow;
+            scratchOverflowCapacity = capacity;
+        }
+
+        ptr = MemAlloc(size);
+        if (ptr != NULL) scratchOverflow[scratchOverflowCount++] = ptr;
+    }
+
+    return ptr;
 }
 
-void SendMessageToUWP(UWPMessage *msg)
+// Create scratch memory arena, calling thread owns it
+void InitScratchMemory(void)
 {
-    if ((UWPOutMessageId + 1) < MAX_UWP_MESSAGES)
+    if (scratchCreated) return;
+
+    void *buffer = RL_MALLOC(SCRATCH_MEMORY_SIZE);
+
+    if (buffer != NULL) scratch = CreateBiStackFromBuffer(buffer, SCRATCH_MEMORY_SIZE);
+    else TraceLog(LOG_WARNING, "MEMORY: Failed to allocate scratch memory, memory allocator used instead");
+
+    scratchCreated = true;
+    scratchOwner = true;
+}
+
+// Allocate temporary memory for current call, released in reverse order with PopScratchMemory()
+// NOTE: Other threads than the owner and allocations not fitting on arena use memory allocator
+void *PushScratchMemory(unsigned int size)
+{
+    unsigned char *back = scratch.back;
+    unsigned char *ptr = scratchOwner? (unsigned char *)BiStackAllocBack(&scratch, size + SCRATCH_HEADER_SIZE) : NULL;
+
+    if (ptr == NULL) return RL_MALLOC(size);
+
+    *(unsigned char **)ptr = back;      // Arena position to restore on release
+
+    return ptr + SCRATCH_HEADER_SIZE;
+}
+
+// Release temporary memory allocated with PushScratchMemory()
+void PopScratchMemory(void *ptr)
+{
+    if (ptr == NULL) return;
+
+    if (((unsigned char *)ptr > scratch.mem) && ((unsigned char *)ptr < scratch.mem + scratch.size))
     {
-        UWPOutMessageId++;
-        UWPOutMessages[UWPOutMessageId] = msg;
+        scratch.back = *(unsigned char **)((unsigned char *)ptr - SCRATCH_HEADER_SIZE);
     }
-    else TraceLog(LOG_WARNING, "[UWP Messaging] Not enough array space to register new UWP outward Message.");
+    else RL_FREE(ptr);
 }
 
-bool HasMessageFromUWP(void)
+// Release frame scratch allocations
+void ResetScratchMemory(void)
 {
-    return UWPInMessageId > -1;
+    if (!scratchOwner) return;
+
+    if (scratch.back != scratch.mem + scratch.size) TraceLog(LOG_WARNING, "MEMORY: Call scratch memory not released at frame end");
+
+    BiStackResetAll(&scratch);
+
+    for (int i = 0; i < scratchOverflowCount; i++) RL_FREE(scratchOverflow[i]);
+    scratchOverflowCount = 0;
 }
 
-UWPMessage *GetMessageFromUWP(void)
+// Release scratch memory arena
+void CloseScratchMemory(void)
 {
-    if (HasMessageFromUWP()) return UWPInMessages[UWPInMessageId--];
+    if (!scratchOwner) return;
 
-    return NULL;
+    ResetScratchMemory();
+
+    RL_FREE(scratchOverflow);
+    scratchOverflow = NULL;
+    scratchOverflowCapacity = 0;
+
+    RL_FREE(scratch.mem);
+    scratch = (BiStack){ 0 };
+
+    scratchCreated = false;
+    scratchOwner = false;
 }
-#endif  // PLATFORM_UWP
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition - Worker threads
+//----------------------------------------------------------------------------------
+
+// Set number of worker threads used by internal jobs (0 runs jobs on calling thread, -1 uses cores count - 1)
+// NOTE: Running threads are stopped (after finishing queued jobs), new ones start on next job
+void SetWorkerThreads(int count)
+{
+#if defined(WORKER_THREADS_AVAILABLE)
+    CloseWorkerThreads();
+    workerPool.requestedCount = (count > MAX_WORKER_THREADS)? MAX_WORKER_THREADS : count;
+#endif
+}
+
+// Get number of worker threads available for internal jobs
+int GetWorkerThreads(void)
+{
+#if defined(WORKER_THREADS_AVAILABLE)
+    if (workerPool.threadCount == 0) InitWorkerThreads();
+
+    return workerPool.threadCount;
+#else
+    return 0;
+#endif
+}
+
+// Submit job to shared worker threads, counter (if provided) is incremented and decremented once job is done
+// NOTE: Same counter can be shared by multiple jobs, if no worker thread is available job runs immediately
+void SubmitJob(JobFunc func, void *data, int *counter)
+{
+    if (func == NULL) return;
+
+    SubmitWorkerJob(func, data, counter);
+}
+
+// Wait for jobs sharing counter to finish, calling thread runs queued jobs while waiting
+void WaitJob(int *counter)
+{
+    if (counter == NULL) return;
+
+    WaitWorkerJobs(counter);
+}
+
+// Check if jobs sharing counter are finished (non-blocking)
+bool IsJobDone(int *counter)
+{
+    if (counter == NULL) return true;
+
+    return (GetWorkerJobsPending(counter) <= 0);
+}
+
+// Run loop body in parallel, iterations range [0, count) split in chunks of chunkSize (0: automatic)
+// NOTE: Calling thread runs chunks too, function returns once all chunks are done
+void ParallelFor(ParallelForFunc func, void *data, int count, int chunkSize)
+{
+    if ((func == NULL) || (count <= 0)) return;
+
+    int threadCount = GetWorkerThreads();
+
+    // Automatic chunk size: a few chunks per thread, balances uneven iterations cost
+    if (chunkSize <= 0) chunkSize = count/(4*(threadCount + 1));
+    if (chunkSize < 1) chunkSize = 1;
+
+    ParallelForJob job = { 0 };
+    job.func = func;
+    job.data = data;
+    job.count = count;
+    job.chunkSize = chunkSize;
+    job.chunkCount = (count + chunkSize - 1)/chunkSize;
+
+    // Helper jobs are only submitted when there are chunks left for them
+    int helpers = job.chunkCount - 1;
+    if (helpers > threadCount) helpers = threadCount;
+
+    int pending = 0;
+    for (int i = 0; i < helpers; i++) SubmitWorkerJob(ParallelForJobRun, &job, &pending);
+
+    ParallelForJobRun(&job);
+    WaitWorkerJobs(&pending);
+}
+
+// Submit job to worker threads, pending counter (if provided) is incremented and decremented once job is done
+// NOTE: If no worker thread available (or queue is full), job runs directly on calling thread
+void SubmitWorkerJob(WorkerJobFunc func, void *data, int *pending)
+{
+#if defined(WORKER_THREADS_AVAILABLE)
+    if (workerPool.threadCount == 0) InitWorkerThreads();
+
+    if (workerPool.threadCount > 0)
+    {
+        pthread_mutex_lock(&workerPool.mutex);
+
+        if (workerPool.jobsCount < MAX_WORKER_JOBS)
+        {
+            WorkerJob *job = &workerPool.jobs[(workerPool.jobsHead + workerPool.jobsCount)%MAX_WORKER_JOBS];
+            job->func = func;
+            job->data = data;
+            job->pending = pending;
+            workerPool.jobsCount++;
+
+            if (pending != NULL) (*pending)++;
+
+            pthread_cond_signal(&workerPool.jobAvailable);
+            pthread_mutex_unlock(&workerPool.mutex);
+            return;
+        }
+
+        pthread_mutex_unlock(&workerPool.mutex);
+    }
+#endif
+
+    func(data);
+}
+
+// Get number of submitted jobs not finished yet (counter provided on SubmitWorkerJob())
+int GetWorkerJobsPending(int *pending)
+{
+#if defined(WORKER_THREADS_AVAILABLE)
+    if (workerPool.threadCount == 0) return *pending;
+
+    pthread_mutex_lock(&workerPool.mutex);
+    int count = *pending;
+    pthread_mutex_unlock(&workerPool.mutex);
+
+    return count;
+#else
+    return *pending;
+#endif
+}
+
+// Wait for submitted jobs to finish (counter provided on SubmitWorkerJob())
+// NOTE: Calling thread runs queued jobs while waiting
+void WaitWorkerJobs(int *pending)
+{
+#if defined(WORKER_THREADS_AVAILABLE)
+    if (workerPool.threadCount == 0) return;
+
+    pthread_mutex_lock(&workerPool.mutex);
+
+    while (*pending > 0)
+    {
+        if (!RunNextWorkerJob()) pthread_cond_wait(&workerPool.jobDone, &workerPool.mutex);
+    }
+
+    pthread_mutex_unlock(&workerPool.mutex);
+#endif
+}
+
+// Stop worker threads, queued jobs are finished first
+void CloseWorkerThreads(void)
+{
+#if defined(WORKER_THREADS_AVAILABLE)
+    if (workerPool.threadCount == 0) return;
+
+    pthread_mutex_lock(&workerPool.mutex);
+    workerPool.quit = true;
+    pthread_cond_broadcast(&workerPool.jobAvailable);
+    pthread_mutex_unlock(&workerPool.mutex);
+
+    for (int i = 0; i < workerPool.threadCount; i++) pthread_join(workerPool.threads[i], NULL);
+
+    pthread_cond_destroy(&workerPool.jobDone);
+    pthread_cond_destroy(&workerPool.jobAvailable);
+    pthread_mutex_destroy(&workerPool.mutex);
+
+    workerPool.threadCount = 0;
+    workerPool.quit = false;
+#endif
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition - Asynchronous file loading
+//----------------------------------------------------------------------------------
+
+// Load file data asynchronously, file is read on a worker thread (mounted packs included)
+// NOTE: Callback is called on main thread (PollInputEvents()) once file is read, data is owned by
+// callback and must be freed with UnloadFileData(), if reading failed data is NULL
+void LoadFileDataAsync(const char *fileName, LoadFileDataCallback callback, void *userData)
+{
+    if ((fileName == NULL) || (callback == NULL)) return;
+
+    AsyncFileRequest *request = (AsyncFileRequest *)RL_CALLOC(1, sizeof(AsyncFileRequest));
+    request->fileName = (char *)RL_MALLOC(strlen(fileName) + 1);
+    strcpy(request->fileName, fileName);
+    request->callback = callback;
+    request->userData = userData;
+
+    // NOTE: Request is linked before submitting job, job could run synchronously
+    request->next = asyncFileRequests;
+    asyncFileRequests = request;
+
+    SubmitWorkerJob(LoadFileDataJob, request, &request->pending);
+}
+
+// Get number of files requested with LoadFileDataAsync() not delivered yet
+int GetFileDataAsyncPending(void)
+{
+    int pending = 0;
+
+    for (AsyncFileRequest *request = asyncFileRequests; request != NULL; request = request->next) pending++;
+
+    return pending;
+}
+
+// Unload file data loaded asynchronously (LoadFileDataAsync())
+void UnloadFileData(unsigned char *data)
+{
+    RL_FREE(data);
+}
+
+// Deliver files data loaded asynchronously to their callbacks (main thread)
+// NOTE: Up to MAX_ASYNC_FILES_PER_FRAME files are delivered per call, oldest requests first
+void UpdateFileDataAsync(void)
+{
+    int delivered = 0;
+
+    while ((asyncFileRequests != NULL) && (delivered < MAX_ASYNC_FILES_PER_FRAME))
+    {
+        // Requests list is newest first, look for the oldest request already read
+        AsyncFileRequest **ready = NULL;
+
+        for (AsyncFileRequest **link = &asyncFileRequests; *link != NULL; link = &(*link)->next)
+        {
+            if (GetWorkerJobsPending(&(*link)->pending) == 0) ready = link;
+        }
+
+        if (ready == NULL) break;
+
+        // NOTE: Request is unlinked before calling callback, it could request more files
+        AsyncFileRequest *request = *ready;
+        *ready = request->next;
+        delivered++;
+
+        request->callback(request->fileName, request->data, request->bytesRead, request->userData);
+
+        RL_FREE(request->fileName);
+        RL_FREE(request);
+    }
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition - Assets cache
+//----------------------------------------------------------------------------------
+
+// Set cached assets hot reload, cached assets files are watched and changes checked on EndDrawing() (development)
+// NOTE: Assets supporting it are reloaded in place (textures), others are loaded again on next cached load
+void SetAssetsHotReload(bool enabled)
+{
+    if (enabled == assetsHotReload) return;
+
+    assetsHotReload = enabled;
+
+    for (int i = 0; i < assetsCacheCount; i++)
+    {
+        AssetCacheEntry *entry = &assetsCache[i];
+
+        if (enabled)
+        {
+            entry->watch = AddFileWatch(entry->fileName, true);
+            if (entry->fileName2 != NULL) entry->watch2 = AddFileWatch(entry->fileName2, true);
+        }
+        else
+        {
+            UnwatchFile(entry->watch);
+            UnwatchFile(entry->watch2);
+            entry->watch = 0;
+            entry->watch2 = 0;
+        }
+    }
+}
+
+// Get cached asset loaded from same files (not modified since), asset reference count is incremented
+// NOTE: Returns NULL if asset is not cached, it must be loaded and added with AddCachedAsset()
+void *AcquireCachedAsset(int type, const char *fileName, const char *fileName2)
+{
+    long modTime = GetFileModTime(fileName);
+    long modTime2 = (fileName2 != NULL)? GetFileModTime(fileName2) : 0;
+
+    for (int i = 0; i < assetsCacheCount; i++)
+    {
+        AssetCacheEntry *entry = &assetsCache[i];
+
+        if ((entry->type != type) || entry->stale || (strcmp(entry->fileName, fileName) != 0)) continue;
+        if ((fileName2 == NULL) != (entry->fileName2 == NULL)) continue;
+        if ((fileName2 != NULL) && (strcmp(entry->fileName2, fileName2) != 0)) continue;
+
+        // Files modified since asset was loaded, it is not returned anymore
+        if ((entry->modTime != modTime) || (entry->modTime2 != modTime2))
+        {
+            entry->stale = true;
+            continue;
+        }
+
+        entry->refCount++;
+        return entry->asset;
+    }
+
+    return NULL;
+}
+
+// Add loaded asset to cache with one reference, asset data is copied (size bytes)
+// NOTE: handle identifies asset on release (value structs could be copied by user)
+void *AddCachedAsset(int type, const char *fileName, const char *fileName2, const void *asset, int size, unsigned long long handle, AssetReloadFunc reload)
+{
+    if (assetsCacheCount >= assetsCacheCapacity)
+    {
+        int newCapacity = (assetsCacheCapacity > 0)? assetsCacheCapacity*2 : 32;
+        AssetCacheEntry *entries = (AssetCacheEntry *)RL_REALLOC(assetsCache, newCapacity*sizeof(AssetCacheEntry));
+        if (entries == NULL) return NULL;
+
+        assetsCache = entries;
+        assetsCacheCapacity = newCapacity;
+    }
+
+    AssetCacheEntry *entry = &assetsCache[assetsCacheCount++];
+    memset(entry, 0, sizeof(AssetCacheEntry));
+
+    entry->type = type;
+    entry->fileName = (char *)RL_MALLOC(strlen(fileName) + 1);
+    strcpy(entry->fileName, fileName);
+    entry->modTime = GetFileModTime(fileName);
+
+    if (fileName2 != NULL)
+    {
+        entry->fileName2 = (char *)RL_MALLOC(strlen(fileName2) + 1);
+        strcpy(entry->fileName2, fileName2);
+        entry->modTime2 = GetFileModTime(fileName2);
+    }
+
+    if (assetsHotReload)
+    {
+        entry->watch = AddFileWatch(fileName, true);
+        if (fileName2 != NULL) entry->watch2 = AddFileWatch(fileName2, true);
+    }
+
+    entry->refCount = 1;
+    entry->handle = handle;
+    entry->asset = RL_MALLOC(size);
+    memcpy(entry->asset, asset, size);
+    entry->reload = reload;
+
+    return entry->asset;
+}
+
+// Release cached asset reference by handle
+// NOTE: Returns -1 if asset is not cached, 0 if still referenced, 1 if it was the last reference:
+// cached asset data is copied into asset (size bytes) and removed from cache, caller must unload it
+int ReleaseCachedAsset(int type, unsigned long long handle, void *asset, int size)
+{
+    for (int i = 0; i < assetsCacheCount; i++)
+    {
+        AssetCacheEntry *entry = &assetsCache[i];
+
+        if ((entry->type != type) || (entry->handle != handle)) continue;
+
+        entry->refCount--;
+        if (entry->refCount > 0) return 0;
+
+        memcpy(asset, entry->asset, size);
+
+        UnwatchFile(entry->watch);
+        UnwatchFile(entry->watch2);
+
+        RL_FREE(entry->fileName);
+        RL_FREE(entry->fileName2);
+        RL_FREE(entry->asset);
+
+        assetsCache[i] = assetsCache[assetsCacheCount - 1];
+        assetsCacheCount--;
+
+        return 1;
+    }
+
+    return -1;
+}
+
+// Check cached assets files changes, modified assets are reloaded in place if supported (hot reload)
+// NOTE: Only assets with watched files changed are checked (no files access per frame)
+void UpdateCachedAssets(void)
+{
+    if (!assetsHotReload) return;
+
+    for (int i = 0; i < assetsCacheCount; i++)
+    {
+        AssetCacheEntry *entry = &assetsCache[i];
+
+        // NOTE: Both watches are checked, changed flags are cleared
+        bool changed = IsFileWatchChanged(entry->watch);
+        if (IsFileWatchChanged(entry->watch2)) changed = true;
+
+        if (!changed || entry->stale) continue;
+
+        entry->modTime = GetFileModTime(entry->fileName);
+        if (entry->fileName2 != NULL) entry->modTime2 = GetFileModTime(entry->fileName2);
+
+        if ((entry->reload != NULL) && entry->reload(entry->asset, entry->fileName, entry->fileName2))
+        {
+            TraceLog(LOG_INFO, "Asset reloaded: %s", entry->fileName);
+        }
+        else
+        {
+            entry->stale = true;
+            TraceLog(LOG_INFO, "Asset modified, it will be loaded again on next load: %s", entry->fileName);
+        }
+    }
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition - File watches
+//----------------------------------------------------------------------------------
+
+// Watch file or directory changes, changes are queued on PollInputEvents() (GetFileChangeEvent())
+// NOTE: Returns watch id, 0 if path could not be watched
+int WatchFile(const char *path)
+{
+    return AddFileWatch(path, false);
+}
+
+// Stop watching file or directory changes
+void UnwatchFile(int watch)
+{
+    FileWatch *fileWatch = GetFileWatch(watch);
+
+    if (fileWatch == NULL) return;
+
+#if defined(FILE_WATCH_INOTIFY)
+    // NOTE: Directory watch descriptor is shared by every file watched in it
+    bool shared = false;
+
+    for (int i = 0; i < fileWatchesCount; i++)
+    {
+        if ((fileWatches[i].id != 0) && (&fileWatches[i] != fileWatch) && (fileWatches[i].wd == fileWatch->wd)) shared = true;
+    }
+
+    if (!shared && (fileWatch->wd >= 0)) inotify_rm_watch(fileWatchFd, fileWatch->wd);
+#endif
+
+    RL_FREE(fileWatch->path);
+    memset(fileWatch, 0, sizeof(FileWatch));
+}
+
+// Get next file change event queued, returns false if no more events
+// NOTE: Event file name is valid until next call
+bool GetFileChangeEvent(FileChangeEvent *event)
+{
+    RL_FREE(fileChangeName);
+    fileChangeName = NULL;
+
+    if ((event == NULL) || (fileChangesCount == 0)) return false;
+
+    FileChange *change = &fileChanges[fileChangesHead];
+    fileChangesHead = (fileChangesHead + 1)%MAX_FILE_CHANGE_EVENTS;
+    fileChangesCount--;
+
+    fileChangeName = change->fileName;
+
+    event->watch = change->watch;
+    event->type = change->type;
+    event->fileName = fileChangeName;
+
+    return true;
+}
+
+// Add file or directory watch, internal watches changes are flagged instead of queued
+int AddFileWatch(const char *path, bool internal)
+{
+    if ((path == NULL) || (path[0] == '\0')) return 0;
+
+    FileWatch watch = { 0 };
+    watch.path = (char *)RL_MALLOC(strlen(path) + 1);
+    strcpy(watch.path, path);
+    watch.internal = internal;
+    watch.wd = -1;
+
+    bool isDirectory = DirectoryExists(path);
+
+    // Files are watched through their directory
+    char *dirPath = NULL;
+
+    if (!isDirectory)
+    {
+        const char *separator = strrchr(watch.path, '/');
+        const char *separator2 = strrchr(watch.path, '\\');
+        if (separator2 > separator) separator = separator2;
+
+        watch.name = (separator != NULL)? separator + 1 : watch.path;
+
+        int dirLength = (separator != NULL)? (int)(separator - watch.path) : 0;
+        if (separator == watch.path) dirLength = 1;     // Root directory
+
+        dirPath = (char *)RL_CALLOC(dirLength + 2, 1);
+        if (separator == NULL) strcpy(dirPath, ".");
+        else memcpy(dirPath, watch.path, dirLength);
+    }
+
+#if defined(FILE_WATCH_INOTIFY)
+    if (fileWatchFd < 0) fileWatchFd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+
+    if (fileWatchFd >= 0) watch.wd = inotify_add_watch(fileWatchFd, (dirPath != NULL)? dirPath : path, IN_CLOSE_WRITE | IN_CREATE | IN_DELETE | IN_MOVED_FROM | IN_MOVED_TO);
+
+    RL_FREE(dirPath);
+
+    if (watch.wd < 0)
+    {
+        TraceLog(LOG_WARNING, "[%s] File could not be watched", path);
+        RL_FREE(watch.path);
+        return 0;
+    }
+#else
+    RL_FREE(dirPath);
+    watch.modTime = GetFileModTime(path);
+#endif
+
+    int index = 0;
+    while ((index < fileWatchesCount) && (fileWatches[index].id != 0)) index++;
+
+    if (index == fileWatchesCount)
+    {
+        fileWatches = (FileWatch *)RL_REALLOC(fileWatches, (fileWatchesCount + 1)*sizeof(FileWatch));
+        fileWatchesCount++;
+    }
+
+    watch.id = fileWatchNextId++;
+    fileWatches[index] = watch;
+
+    return watch.id;
+}
+
+// Check if watched file changed since last check (internal watches), changed flag is cleared
+bool IsFileWatchChanged(int watch)
+{
+    FileWatch *fileWatch = GetFileWatch(watch);
+
+    if ((fileWatch == NULL) || !fileWatch->changed) return false;
+
+    fileWatch->changed = false;
+
+    return true;
+}
+
+// Read watched files changes (on PollInputEvents())
+// NOTE: Without watch backend, watched files modification time is checked once per FILE_WATCH_POLL_INTERVAL
+void UpdateFileWatches(void)
+{
+    if (fileWatchesCount == 0) return;
+
+#if defined(FILE_WATCH_INOTIFY)
+    // NOTE: Buffer aligned for inotify_event struct, events are variable size (name included)
+    long long buffer[512];
+
+    while (true)
+    {
+        int size = (int)read(fileWatchFd, buffer, sizeof(buffer));
+        if (size <= 0) break;   // No more events (non-blocking)
+
+        for (int offset = 0; offset < size; )
+        {
+            const struct inotify_event *event = (const struct inotify_event *)((const char *)buffer + offset);
+            offset += (int)(sizeof(struct inotify_event) + event->len);
+
+            if (event->mask & IN_Q_OVERFLOW)
+            {
+                // Events lost, every internal watch is checked
+                for (int i = 0; i < fileWatchesCount; i++) if (fileWatches[i].internal) fileWatches[i].changed = true;
+                continue;
+            }
+
+            if (event->len == 0) continue;
+
+            int type = FILE_CHANGE_MODIFIED;
+            if (event->mask & (IN_CREATE | IN_MOVED_TO)) type = FILE_CHANGE_CREATED;
+            else if (event->mask & (IN_DELETE | IN_MOVED_FROM)) type = FILE_CHANGE_DELETED;
+
+            for (int i = 0; i < fileWatchesCount; i++)
+            {
+                FileWatch *watch = &fileWatches[i];
+
+                if ((watch->id == 0) || (watch->wd != event->wd)) continue;
+                if ((watch->name != NULL) && (strcmp(watch->name, event->name) != 0)) continue;
+
+                PushFileChange(watch, type, event->name);
+            }
+        }
+    }
+#else
+    double time = GetTime();
+    if ((time - fileWatchLastCheck) < FILE_WATCH_POLL_INTERVAL) return;
+    fileWatchLastCheck = time;
+
+    for (int i = 0; i < fileWatchesCount; i++)
+    {
+        FileWatch *watch = &fileWatches[i];
+
+        if (watch->id == 0) continue;
+
+        long modTime = GetFileModTime(watch->path);
+
+        if (modTime == watch->modTime) continue;
+
+        // NOTE: Directories changes are reported as directory modified (entries are not compared)
+        int type = FILE_CHANGE_MODIFIED;
+        if (watch->modTime == 0) type = FILE_CHANGE_CREATED;
+        else if (modTime == 0) type = FILE_CHANGE_DELETED;
+
+        watch->modTime = modTime;
+
+        PushFileChange(watch, type, NULL);
+    }
+#endif
+}
+
+// Stop watching all files, queued changes are discarded (on CloseWindow())
+void CloseFileWatches(void)
+{
+    for (int i = 0; i < fileWatchesCount; i++) RL_FREE(fileWatches[i].path);
+
+    RL_FREE(fileWatches);
+    fileWatches = NULL;
+    fileWatchesCount = 0;
+
+    while (fileChangesCount > 0)
+    {
+        RL_FREE(fileChanges[fileChangesHead].fileName);
+        fileChangesHead = (fileChangesHead + 1)%MAX_FILE_CHANGE_EVENTS;
+        fileChangesCount--;
+    }
+
+    RL_FREE(fileChangeName);
+    fileChangeName = NULL;
+
+#if defined(FILE_WATCH_INOTIFY)
+    if (fileWatchFd >= 0) close(fileWatchFd);
+    fileWatchFd = -1;
+#endif
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition - Profiler
+//----------------------------------------------------------------------------------
+
+// Enable profile zones recording, statistics are collected every frame (EndDrawing())
+void EnableProfiler(void)
+{
+#if defined(SUPPORT_PROFILER)
+    if (!profilerEnabled) profileFrameStart = GetTime();
+    profilerEnabled = true;
+#endif
+}
+
+// Disable profile zones recording, recorded zones are kept (ExportProfileTrace())
+void DisableProfiler(void)
+{
+#if defined(SUPPORT_PROFILER)
+    profilerEnabled = false;
+#endif
+}
+
+// Check if profile zones recording is enabled
+bool IsProfilerEnabled(void)
+{
+#if defined(SUPPORT_PROFILER)
+    return profilerEnabled;
+#else
+    return false;
+#endif
+}
+
+// Begin CPU profile zone on calling thread (nestable)
+// NOTE: Name is stored as pointer, it must remain valid (string literal), zones with same name are aggregated
+void BeginProfileZone(const char *name)
+{
+#if defined(SUPPORT_PROFILER)
+    if (!profilerEnabled) return;
+
+    ProfileThread *thread = GetProfileThread();
+
+    if (thread == NULL) return;
+
+    if (thread->depth < MAX_PROFILE_ZONE_DEPTH)
+    {
+        thread->openNames[thread->depth] = name;
+        thread->openStarts[thread->depth] = GetTime();
+    }
+
+    thread->depth++;
+#endif
+}
+
+// End last CPU profile zone begun on calling thread
+void EndProfileZone(void)
+{
+#if defined(SUPPORT_PROFILER)
+    // NOTE: Zones begun while profiler was disabled were not opened
+    ProfileThread *thread = profileThread;
+
+    if ((thread == NULL) || (profileThreadGeneration != profileGeneration) || (thread->depth == 0)) return;
+
+    thread->depth--;
+
+    if (thread->depth < MAX_PROFILE_ZONE_DEPTH)
+    {
+        ProfileEvent *event = &thread->events[thread->eventsCount%MAX_PROFILE_EVENTS];
+
+        event->name = thread->openNames[thread->depth];
+        event->start = thread->openStarts[thread->depth];
+        event->end = GetTime();
+        event->depth = thread->depth;
+
+        // Event data must be visible before it is counted (read by main thread)
+        PROFILER_BARRIER();
+        thread->eventsCount++;
+    }
+#endif
+}
+
+// Get CPU profile zones statistics of last frame, sorted by thread and start time
+const ProfileZoneStats *GetProfileZones(int *count)
+{
+#if defined(SUPPORT_PROFILER)
+    *count = profileZonesCount;
+    return profileZones;
+#else
+    *count = 0;
+    return NULL;
+#endif
+}
+
+// Export recorded CPU profile zones as Chrome trace events (JSON), viewable on chrome://tracing or Perfetto
+// NOTE: Up to MAX_PROFILE_EVENTS latest zones are exported per thread
+bool ExportProfileTrace(const char *fileName)
+{
+    bool success = false;
+
+#if defined(SUPPORT_PROFILER)
+    FILE *file = fopen(fileName, "wt");
+
+    if (file == NULL)
+    {
+        TraceLog(LOG_WARNING, "[%s] Profile trace file could not be opened", fileName);
+        return false;
+    }
+
+    int threadsCount = (profileThreadsCount < MAX_PROFILE_THREADS)? profileThreadsCount : MAX_PROFILE_THREADS;
+    int eventsCount = 0;
+    bool first = true;
+
+    fprintf(file, "{\"traceEvents\":[\n");
+
+    for (int t = 0; t < threadsCount; t++)
+    {
+        ProfileThread *thread = profileThreads[t];
+
+        if (thread == NULL) continue;
+
+        fprintf(file, "%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":%i,\"args\":{\"name\":\"Thread %i\"}}",
+                first? "" : ",\n", t, t);
+        first = false;
+
+        unsigned int last = thread->eventsCount;
+        PROFILER_BARRIER();
+        unsigned int i = (last > MAX_PROFILE_EVENTS)? (last - MAX_PROFILE_EVENTS) : 0;
+
+        for (; i < last; i++)
+        {
+            const ProfileEvent *event = &thread->events[i%MAX_PROFILE_EVENTS];
+
+            fprintf(file, ",\n{\"name\":\"");
+
+            // NOTE: Only quotes, backslashes and control characters need escaping
+            for (const char *c = event->name; *c != '\0'; c++)
+            {
+                if ((*c == '"') || (*c == '\\')) fprintf(file, "\\%c", *c);
+                else if ((unsigned char)*c < 0x20) fprintf(file, "\\u%04x", *c);
+                else fputc(*c, file);
+            }
+
+            fprintf(file, "\",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f,\"pid\":0,\"tid\":%i}",
+                    event->start*1000000.0, (event->end - event->start)*1000000.0, t);
+            eventsCount++;
+        }
+    }
+
+    fprintf(file, "\n],\"displayTimeUnit\":\"ms\"}\n");
+
+    success = (ferror(file) == 0);
+    if (fclose(file) != 0) success = false;
+
+    if (success) TraceLog(LOG_INFO, "[%s] Profile trace exported successfully (%i zones)", fileName, eventsCount);
+    else TraceLog(LOG_WARNING, "[%s] Profile trace could not be written", fileName);
+#endif
+
+    return success;
+}
+
+// Collect CPU profile zones ended since last call into frame statistics (on EndDrawing())
+// NOTE: Zones are read without locks, threads ending more than MAX_PROFILE_EVENTS zones per frame lose the oldest ones
+void UpdateProfiler(void)
+{
+#if defined(SUPPORT_PROFILER)
+    double frameStart = profileFrameStart;
+    profileFrameStart = GetTime();
+
+    profileZonesCount = 0;
+
+    int threadsCount = (profileThreadsCount < MAX_PROFILE_THREADS)? profileThreadsCount : MAX_PROFILE_THREADS;
+
+    for (int t = 0; t < threadsCount; t++)
+    {
+        ProfileThread *thread = profileThreads[t];
+
+        if (thread == NULL) continue;
+
+        unsigned int last = thread->eventsCount;
+        PROFILER_BARRIER();
+
+        if ((last - thread->eventsRead) > MAX_PROFILE_EVENTS) thread->eventsRead = last - MAX_PROFILE_EVENTS;
+
+        for (; thread->eventsRead < last; thread->eventsRead++)
+        {
+            const ProfileEvent *event = &thread->events[thread->eventsRead%MAX_PROFILE_EVENTS];
+            float time = (float)((event->end - event->start)*1000.0);
+            ProfileZoneStats *zone = NULL;
+
+            for (int i = 0; i < profileZonesCount; i++)
+            {
+                if ((profileZones[i].thread == t) && ((profileZones[i].name == event->name) || (strcmp(profileZones[i].name, event->name) == 0)))
+                {
+                    zone = &profileZones[i];
+                    break;
+                }
+            }
+
+            if (zone == NULL)
+            {
+                if (profileZonesCount >= MAX_PROFILE_ZONES) continue;
+
+                zone = &profileZones[profileZonesCount++];
+                zone->name = event->name;
+                zone->thread = t;
+                zone->depth = event->depth;
+                zone->calls = 0;
+                zone->start = (float)((event->start - frameStart)*1000.0);
+                zone->time = 0.0f;
+                zone->timeMax = 0.0f;
+            }
+
+            // NOTE: Zones end after their nested zones, first call start and depth are kept from outermost one
+            float start = (float)((event->start - frameStart)*1000.0);
+            if (start < zone->start) zone->start = start;
+            if (event->depth < zone->depth) zone->depth = event->depth;
+
+            zone->calls++;
+            zone->time += time;
+            if (time > zone->timeMax) zone->timeMax = time;
+        }
+    }
+
+    if (profileZonesCount > 1) qsort(profileZones, profileZonesCount, sizeof(ProfileZoneStats), CompareProfileZones);
+#endif
+}
+
+// Release recorded CPU profile zones (on CloseWindow())
+// NOTE: Threads still recording zones register again on their next zone
+void CloseProfiler(void)
+{
+#if defined(SUPPORT_PROFILER)
+    int threadsCount = (profileThreadsCount < MAX_PROFILE_THREADS)? profileThreadsCount : MAX_PROFILE_THREADS;
+
+    for (int t = 0; t < threadsCount; t++)
+    {
+        RL_FREE(profileThreads[t]);
+        profileThreads[t] = NULL;
+    }
+
+    profileGeneration++;
+    PROFILER_BARRIER();
+    profileThreadsCount = 0;
+    profileZonesCount = 0;
+#endif
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition - Pack files
+//----------------------------------------------------------------------------------
+#if defined(SUPPORT_PACK_FILES)
+
+// Pack file format (little-endian):
+//   Header (16 bytes): char id[4] = "rPAK", uint32 version (1), uint32 entriesCount, uint32 indexOffset
+//   Index (at indexOffset), per entry: uint32 offset, uint32 dataSize, uint32 size,
+//                                      uint16 compression (0: none, 1: LZ4 block), uint16 nameLength, char name[nameLength]
+// NOTE: Names use '/' separators and are relative to pack root, files data is stored anywhere before index
+
+// Mount pack file, packed files are read by every file loader at mountPath (read-only virtual filesystem)
+// NOTE: Later mounted packs take precedence, files not packed are read from disk,
+// packs should not be mounted or unmounted while assets are loaded on worker threads
+bool MountPackFile(const char *fileName, const char *mountPath)
+{
+    if (packsCount >= MAX_MOUNTED_PACKS)
+    {
+        TraceLog(LOG_WARNING, "[%s] Pack file can not be mounted, too many packs mounted", fileName);
+        return false;
+    }
+
+    PackFile pack = { 0 };
+
+#if defined(PACK_FILE_MAPPING)
+    int fd = open(fileName, O_RDONLY);
+
+    if (fd >= 0)
+    {
+        struct stat fileStats = { 0 };
+
+        if ((fstat(fd, &fileStats) == 0) && (fileStats.st_size > 0))
+        {
+            void *data = mmap(NULL, (size_t)fileStats.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+
+            if (data != MAP_FAILED)
+            {
+                pack.data = (const unsigned char *)data;
+                pack.dataSize = (unsigned int)fileStats.st_size;
+                pack.mapped = true;
+            }
+        }
+
+        close(fd);      // NOTE: Mapping remains valid after closing file descriptor
+    }
+#elif defined(PLATFORM_ANDROID)
+    // NOTE: Asset buffer is mapped from APK if pack is stored uncompressed in it
+    AAsset *asset = AAssetManager_open(assetManager, fileName, AASSET_MODE_BUFFER);
+
+    if (asset != NULL)
+    {
+        pack.data = (const unsigned char *)AAsset_getBuffer(asset);
+        pack.dataSize = (unsigned int)AAsset_getLength(asset);
+        pack.asset = asset;
+
+        if (pack.data == NULL) AAsset_close(asset);
+    }
+#else
+    FILE *file = (fopen)(fileName, "rb");
+
+    if (file != NULL)
+    {
+        fseek(file, 0, SEEK_END);
+        long size = ftell(file);
+        fseek(file, 0, SEEK_SET);
+
+        if (size > 0)
+        {
+            unsigned char *data = (unsigned char *)RL_MALLOC(size);
+
+            if (fread(data, 1, size, file) == (size_t)size)
+            {
+                pack.data = data;
+                pack.dataSize = (unsigned int)size;
+            }
+            else RL_FREE(data);
+        }
+
+        fclose(file);
+    }
+#endif
+
+    if (pack.data == NULL)
+    {
+        TraceLog(LOG_WARNING, "[%s] Pack file could not be opened", fileName);
+        return false;
+    }
+
+    #define PACK_READ_U16(ptr) (unsigned int)((ptr)[0] | ((ptr)[1] << 8))
+    #define PACK_READ_U32(ptr) (unsigned int)((ptr)[0] | ((ptr)[1] << 8) | ((ptr)[2] << 16) | ((unsigned int)(ptr)[3] << 24))
+
+    bool valid = (pack.dataSize >= 16) && (memcmp(pack.data, "rPAK", 4) == 0) && (PACK_READ_U32(pack.data + 4) == 1);
+
+    if (valid)
+    {
+        unsigned int entriesCount = PACK_READ_U32(pack.data + 8);
+        unsigned int indexOffset = PACK_READ_U32(pack.data + 12);
+
+        // NOTE: Every index entry requires at least 16 bytes
+        if ((indexOffset > pack.dataSize) || (entriesCount > (pack.dataSize - indexOffset)/16)) valid = false;
+        else
+        {
+            pack.entries = (PackEntry *)RL_CALLOC((entriesCount > 0)? entriesCount : 1, sizeof(PackEntry));
+            pack.lookupSize = 16;
+            while (pack.lookupSize < (int)entriesCount*2) pack.lookupSize *= 2;
+            pack.lookup = (int *)RL_MALLOC(pack.lookupSize*sizeof(int));
+            for (int i = 0; i < pack.lookupSize; i++) pack.lookup[i] = -1;
+
+            const unsigned char *index = pack.data + indexOffset;
+            const unsigned char *indexEnd = pack.data + pack.dataSize;
+
+            for (unsigned int i = 0; valid && (i < entriesCount); i++)
+            {
+                if ((indexEnd - index) < 16) { valid = false; break; }
+
+                PackEntry *entry = &pack.entries[pack.entriesCount];
+                entry->offset = PACK_READ_U32(index);
+                entry->dataSize = PACK_READ_U32(index + 4);
+                entry->size = PACK_READ_U32(index + 8);
+                entry->compression = (int)PACK_READ_U16(index + 12);
+                entry->nameLength = (int)PACK_READ_U16(index + 14);
+                entry->name = (const char *)index + 16;
+                index += 16 + entry->nameLength;
+
+                if ((index > indexEnd) || (entry->offset > pack.dataSize) || (entry->dataSize > (pack.dataSize - entry->offset)) ||
+                    ((entry->compression == PACK_COMPRESSION_NONE) && (entry->dataSize != entry->size)) ||
+                    (entry->compression > PACK_COMPRESSION_LZ4) || (entry->size > 0x7fffffff))
+                {
+                    valid = false;
+                    break;
+                }
+
+                // Insert in lookup table, duplicated names keep the last one
+                unsigned int slot = GetPackNameHash(entry->name, entry->nameLength) & (pack.lookupSize - 1);
+
+                while (pack.lookup[slot] != -1)
+                {
+                    const PackEntry *other = &pack.entries[pack.lookup[slot]];
+                    if ((other->nameLength == entry->nameLength) && (memcmp(other->name, entry->name, entry->nameLength) == 0)) break;
+                    slot = (slot + 1) & (pack.lookupSize - 1);
+                }
+
+                pack.lookup[slot] = pack.entriesCount;
+                pack.entriesCount++;
+            }
+        }
+    }
+
+    if (!valid)
+    {
+        TraceLog(LOG_WARNING, "[%s] Pack file is not valid", fileName);
+
+        ClosePackFile(&pack);
+        return false;
+    }
+
+    pack.fileName = (char *)RL_MALLOC(strlen(fileName) + 1);
+    strcpy(pack.fileName, fileName);
+
+    // Mount path stored with '/' separators, without trailing separator
+    if (mountPath == NULL) mountPath = "";
+    if ((mountPath[0] == '.') && ((mountPath[1] == '/') || (mountPath[1] == '\\') || (mountPath[1] == '\0'))) mountPath += (mountPath[1] == '\0')? 1 : 2;
+
+    int mountLength = (int)strlen(mountPath);
+    while ((mountLength > 0) && ((mountPath[mountLength - 1] == '/') || (mountPath[mountLength - 1] == '\\'))) mountLength--;
+
+    pack.mountPath = (char *)RL_MALLOC(mountLength + 1);
+    for (int i = 0; i < mountLength; i++) pack.mountPath[i] = (mountPath[i] == '\\')? '/' : mountPath[i];
+    pack.mountPath[mountLength] = '\0';
+
+    packs[packsCount] = pack;
+    packsCount++;
+
+    TraceLog(LOG_INFO, "[%s] Pack file mounted successfully (%i files)", fileName, pack.entriesCount);
+
+    return true;
+}
+
+// Unmount pack file, NULL unmounts last mounted pack
+// WARNING: Data returned by GetPackedFileData() for this pack is no longer valid
+void UnmountPackFile(const char *fileName)
+{
+    for (int i = packsCount - 1; i >= 0; i--)
+    {
+        PackFile *pack = &packs[i];
+
+        if ((fileName != NULL) && (strcmp(pack->fileName, fileName) != 0)) continue;
+
+        TraceLog(LOG_INFO, "[%s] Pack file unmounted", pack->fileName);
+
+        ClosePackFile(pack);
+
+        // Keep mount order (precedence)
+        for (int j = i; j < packsCount - 1; j++) packs[j] = packs[j + 1];
+        packsCount--;
+
+        return;
+    }
+}
+
+// Check if file is available in a mounted pack
+bool IsPackedFile(const char *fileName)
+{
+    return (FindPackEntry(fileName, NULL) != NULL);
+}
+
+// Get packed file data, data points into mounted pack (zero-copy), valid until pack is unmounted
+// NOTE: Returns NULL if file is not packed or it is compressed
+const unsigned char *GetPackedFileData(const char *fileName, unsigned int *size)
+{
+    const PackFile *pack = NULL;
+    const PackEntry *entry = FindPackEntry(fileName, &pack);
+
+    if ((entry == NULL) || (entry->compression != PACK_COMPRESSION_NONE)) return NULL;
+
+    if (size != NULL) *size = entry->size;
+
+    return pack->data + entry->offset;
+}
+
+// Replacement for fopen, files are read from mounted packs if available
+// NOTE: Only read-only modes are redirected to packs
+FILE *pack_fopen(const char *fileName, const char *mode)
+{
+    if ((packsCount > 0) && (mode[0] == 'r') && (strchr(mode, '+') == NULL))
+    {
+        const PackFile *pack = NULL;
+        const PackEntry *entry = FindPackEntry(fileName, &pack);
+
+        if (entry != NULL)
+        {
+            const unsigned char *data = pack->data + entry->offset;
+
+            if (entry->compression == PACK_COMPRESSION_NONE) return OpenPackStream(data, entry->size, NULL);
+
+            unsigned char *buffer = (unsigned char *)RL_MALLOC((entry->size > 0)? entry->size : 1);
+
+            if (DecompressLZ4(data, (int)entry->dataSize, buffer, (int)entry->size) != (int)entry->size)
+            {
+                TraceLog(LOG_WARNING, "[%s] Packed file data could not be decompressed", fileName);
+                RL_FREE(buffer);
+                return NULL;
+            }
+
+            return OpenPackStream(buffer, entry->size, buffer);
+        }
+    }
+
+#if defined(PLATFORM_ANDROID)
+    return android_fopen(fileName, mode);
+#else
+    return (fopen)(fileName, mode);
+#endif
+}
+#endif  // SUPPORT_PACK_FILES
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition - LZ4 compression
+//----------------------------------------------------------------------------------
+// Compress data as LZ4 block (no frame), returns compressed size or 0 if dstCapacity is not enough
+// NOTE: Greedy matching (hash of 4 bytes sequences), dstCapacity of srcSize + srcSize/255 + 16 is always enough
+int CompressLZ4(const unsigned char *src, int srcSize, unsigned char *dst, int dstCapacity)
+{
+    int *table = (int *)RL_MALLOC(LZ4_HASH_TABLE_SIZE*sizeof(int));
+    for (int i = 0; i < LZ4_HASH_TABLE_SIZE; i++) table[i] = -1;
+
+    int ip = 0;
+    int anchor = 0;
+    int op = 0;
+
+    // NOTE: LZ4 block format requires the last 5 bytes to be literals and the last match to start 12 bytes before end
+    const int matchLimit = srcSize - 5;
+    const int startLimit = srcSize - 12;
+
+    while (ip < startLimit)
+    {
+        unsigned int sequence = 0;
+        memcpy(&sequence, src + ip, 4);
+
+        unsigned int hash = (sequence*2654435761u) >> (32 - LZ4_HASH_BITS);
+        int ref = table[hash];
+        table[hash] = ip;
+
+        if ((ref < 0) || ((ip - ref) > 0xffff) || (memcmp(src + ref, src + ip, 4) != 0)) { ip++; continue; }
+
+        int length = 4;
+        while (((ip + length) < matchLimit) && (src[ref + length] == src[ip + length])) length++;
+
+        op = WriteLZ4Sequence(dst, dstCapacity, op, src + anchor, ip - anchor, ip - ref, length);
+        if (op < 0) break;
+
+        ip += length;
+        anchor = ip;
+    }
+
+    // Last sequence contains only literals
+    if (op >= 0) op = WriteLZ4Sequence(dst, dstCapacity, op, src + anchor, srcSize - anchor, 0, 0);
+
+    RL_FREE(table);
+
+    return (op > 0)? op : 0;
+}
+
+// Decompress LZ4 block data (no frame), returns decompressed size or -1 on malformed data
+int DecompressLZ4(const unsigned char *src, int srcSize, unsigned char *dst, int dstSize)
+{
+    const unsigned char *ip = src;
+    const unsigned char *ipEnd = src + srcSize;
+    unsigned char *op = dst;
+    unsigned char *opEnd = dst + dstSize;
+
+    while (ip < ipEnd)
+    {
+        unsigned int token = *ip++;
+
+        // Literals copy
+        unsigned int literals = token >> 4;
+
+        if (literals == 15)
+        {
+            unsigned int value = 255;
+
+            while (value == 255)
+            {
+                if (ip >= ipEnd) return -1;
+                value = *ip++;
+                literals += value;
+            }
+        }
+
+        if ((literals > (unsigned int)(ipEnd - ip)) || (literals > (unsigned int)(opEnd - op))) return -1;
+
+        memcpy(op, ip, literals);
+        ip += literals;
+        op += literals;
+
+        if (ip >= ipEnd) break;     // Last sequence contains only literals
+
+        // Match copy (can overlap output)
+        if ((ipEnd - ip) < 2) return -1;
+
+        unsigned int offset = ip[0] | (ip[1] << 8);
+        ip += 2;
+
+        if ((offset == 0) || (offset > (unsigned int)(op - dst))) return -1;
+
+        unsigned int length = token & 0x0f;
+
+        if (length == 15)
+        {
+            unsigned int value = 255;
+
+            while (value == 255)
+            {
+                if (ip >= ipEnd) return -1;
+                value = *ip++;
+                length += value;
+            }
+        }
+
+        length += 4;
+
+        if (length > (unsigned int)(opEnd - op)) return -1;
+
+        const unsigned char *match = op - offset;
+        for (unsigned int i = 0; i < length; i++) op[i] = match[i];
+        op += length;
+    }
+
+    return (int)(op - dst);
+}
+
+#if defined(PLATFORM_ANDROID)
+// Initialize asset manager from android app
+void InitAssetManager(AAssetManager *manager)
+{
+    assetManager = manager;
+}
+
+// Replacement for fopen
+FILE *android_fopen(const char *fileName, const char *mode)
+{
+    if (mode[0] == 'w') return NULL;
+
+    AAsset *asset = AAssetManager_open(assetManager, fileName, 0);
+
+    if (!asset) return NULL;
+
+    return funopen(asset, android_read, android_write, android_seek, android_close);
+}
+#endif  // PLATFORM_ANDROID
+
+//----------------------------------------------------------------------------------
+// Module specific Functions Definition
+//----------------------------------------------------------------------------------
+#if defined(SUPPORT_MEMORY_TRACKING)
+// Get tracked allocations table slot for memory pointer (Fibonacci hashing)
+static inline unsigned int GetAllocationSlot(const void *ptr, unsigned int mask)
+{
+    return (unsigned int)((((size_t)ptr >> 4)*2654435769u) >> 8) & mask;
+}
+
+// Register allocation on tracking table
+// NOTE: Table memory is not tracked, it is allocated out of raylib memory allocator
+static void TrackAllocation(void *ptr, unsigned int size, int tag)
+{
+    if ((tag < 0) || (tag >= MAX_MEMORY_TAGS)) tag = MEMORY_TAG_USER;
+
+    MEMORY_LOCK();
+
+    // Table grows at half load, keeping probe sequences short
+    if (memAllocationsCount >= memAllocationsSize/2)
+    {
+        unsigned int newSize = (memAllocationsSize == 0)? 1024 : memAllocationsSize*2;
+        MemoryAllocation *allocations = (MemoryAllocation *)calloc(newSize, sizeof(MemoryAllocation));
+
+        if (allocations == NULL)
+        {
+            MEMORY_UNLOCK();
+            return;
+        }
+
+        for (unsigned int i = 0; i < memAllocationsSize; i++)
+        {
+            if (memAllocations[i].ptr == NULL) continue;
+
+            unsigned int slot = GetAllocationSlot(memAllocations[i].ptr, newSize - 1);
+            while (allocations[slot].ptr != NULL) slot = (slot + 1) & (newSize - 1);
+            allocations[slot] = memAllocations[i];
+        }
+
+        free(memAllocations);
+        memAllocations = allocations;
+        memAllocationsSize = newSize;
+    }
+
+    unsigned int mask = memAllocationsSize - 1;
+    unsigned int slot = GetAllocationSlot(ptr, mask);
+    while (memAllocations[slot].ptr != NULL) slot = (slot + 1) & mask;
+
+    memAllocations[slot] = (MemoryAllocation){ ptr, size, tag };
+    memAllocationsCount++;
+
+    MemoryUsage *usages[2] = { &memUsage, &memUsageTags[tag] };
+    for (int i = 0; i < 2; i++)
+    {
+        usages[i]->bytes += size;
+        if (usages[i]->bytes > usages[i]->peakBytes) usages[i]->peakBytes = usages[i]->bytes;
+        usages[i]->count++;
+        usages[i]->totalCount++;
+    }
+
+    MEMORY_UNLOCK();
+}
+
+// Remove allocation from tracking table, false if not tracked (allocated before tracking table growth failed)
+static bool UntrackAllocation(void *ptr, unsigned int *size, int *tag)
+{
+    bool found = false;
+
+    MEMORY_LOCK();
+
+    if (memAllocationsSize > 0)
+    {
+        unsigned int mask = memAllocationsSize - 1;
+        unsigned int slot = GetAllocationSlot(ptr, mask);
+
+        while ((memAllocations[slot].ptr != NULL) && (memAllocations[slot].ptr != ptr)) slot = (slot + 1) & mask;
+
+        if (memAllocations[slot].ptr == ptr)
+        {
+            found = true;
+            *size = memAllocations[slot].size;
+            *tag = memAllocations[slot].tag;
+
+            memUsage.bytes -= *size;
+            memUsage.count--;
+            memUsageTags[*tag].bytes -= *size;
+            memUsageTags[*tag].count--;
+
+            // Backward shift deletion, following entries move to keep probe sequences unbroken
+            unsigned int next = slot;
+            for (;;)
+            {
+                next = (next + 1) & mask;
+                if (memAllocations[next].ptr == NULL) break;
+
+                unsigned int home = GetAllocationSlot(memAllocations[next].ptr, mask);
+
+                // Entry stays if its home slot is cyclically in (slot, next]
+                if ((slot <= next)? ((slot < home) && (home <= next)) : ((slot < home) || (home <= next))) continue;
+
+                memAllocations[slot] = memAllocations[next];
+                slot = next;
+            }
+
+            memAllocations[slot].ptr = NULL;
+            memAllocationsCount--;
+        }
+    }
+
+    MEMORY_UNLOCK();
+
+    return found;
+}
+#endif
+
+#if defined(SUPPORT_PACK_FILES)
+// Release pack file data and index
+static void ClosePackFile(PackFile *pack)
+{
+#if defined(PACK_FILE_MAPPING)
+    if (pack->mapped) munmap((void *)pack->data, pack->dataSize);
+#elif defined(PLATFORM_ANDROID)
+    AAsset_close((AAsset *)pack->asset);
+#else
+    RL_FREE((void *)pack->data);
+#endif
+
+    RL_FREE(pack->fileName);
+    RL_FREE(pack->mountPath);
+    RL_FREE(pack->entries);
+    RL_FREE(pack->lookup);
+}
+
+// Find packed file in mounted packs, packs mounted later take precedence
+static const PackEntry *FindPackEntry(const char *fileName, const PackFile **pack)
+{
+    if ((packsCount == 0) || (fileName == NULL)) return NULL;
+
+    // Normalize path: '/' separators, no leading "./"
+    char path[MAX_PACK_PATH_LENGTH] = { 0 };
+    int length = 0;
+
+    while ((fileName[0] == '.') && ((fileName[1] == '/') || (fileName[1] == '\\'))) fileName += 2;
+
+    for (; fileName[length] != '\0'; length++)
+    {
+        if (length >= (MAX_PACK_PATH_LENGTH - 1)) return NULL;
+        path[length] = (fileName[length] == '\\')? '/' : fileName[length];
+    }
+
+    for (int i = packsCount - 1; i >= 0; i--)
+    {
+        const PackFile *current = &packs[i];
+        const char *name = path;
+        int nameLength = length;
+        int mountLength = (int)strlen(current->mountPath);
+
+        if (mountLength > 0)
+        {
+            if ((length <= mountLength) || (path[mountLength] != '/') || (memcmp(path, current->mountPath, mountLength) != 0)) continue;
+
+            name += mountLength + 1;
+            nameLength -= mountLength + 1;
+        }
+
+        unsigned int slot = GetPackNameHash(name, nameLength) & (current->lookupSize - 1);
+
+        while (current->lookup[slot] != -1)
+        {
+            const PackEntry *entry = &current->entries[current->lookup[slot]];
+
+            if ((entry->nameLength == nameLength) && (memcmp(entry->name, name, nameLength) == 0))
+            {
+                if (pack != NULL) *pack = current;
+                return entry;
+            }
+
+            slot = (slot + 1) & (current->lookupSize - 1);
+        }
+    }
+
+    return NULL;
+}
+
+// Get packed file name hash (FNV-1a)
+static unsigned int GetPackNameHash(const char *name, int length)
+{
+    unsigned int hash = 2166136261u;
+
+    for (int i = 0; i < length; i++)
+    {
+        hash ^= (unsigned char)name[i];
+        hash *= 16777619u;
+    }
+
+    return hash;
+}
+
+#if defined(PACK_STREAM_FUNOPEN) || defined(PACK_STREAM_FOPENCOOKIE)
+// Packed file memory stream (stream cookie)
+typedef struct PackStream {
+    const unsigned char *data;  // Packed file data
+    unsigned int size;          // Packed file size
+    unsigned int position;      // Read position
+    unsigned char *buffer;      // Decompressed data buffer (freed on close), NULL if data is inside pack
+} PackStream;
+
+// Read packed file stream data, returns bytes read
+static int ReadPackStream(PackStream *stream, char *buf, unsigned int size)
+{
+    unsigned int available = stream->size - stream->position;
+    unsigned int count = (size < available)? size : available;
+
+    memcpy(buf, stream->data + stream->position, count);
+    stream->position += count;
+
+    return (int)count;
+}
+
+// Seek packed file stream, returns new position or -1 if out of range
+static long long SeekPackStream(PackStream *stream, long long offset, int whence)
+{
+    if (whence == SEEK_CUR) offset += stream->position;
+    else if (whence == SEEK_END) offset += stream->size;
+
+    if ((offset < 0) || (offset > stream->size)) return -1;
+
+    stream->position = (unsigned int)offset;
+
+    return offset;
+}
+
+static int pack_close(void *cookie)
+{
+    PackStream *stream = (PackStream *)cookie;
+
+    RL_FREE(stream->buffer);
+    RL_FREE(stream);
+
+    return 0;
+}
+#endif
+
+#if defined(PACK_STREAM_FUNOPEN)
+static int pack_read(void *cookie, char *buf, int size)
+{
+    return ReadPackStream((PackStream *)cookie, buf, (unsigned int)size);
+}
+
+static int pack_write(void *cookie, const char *buf, int size)
+{
+    TraceLog(LOG_ERROR, "Can't provide write access to packed files");
+
+    return -1;
+}
+
+static fpos_t pack_seek(void *cookie, fpos_t offset, int whence)
+{
+    return (fpos_t)SeekPackStream((PackStream *)cookie, (long long)offset, whence);
+}
+#elif defined(PACK_STREAM_FOPENCOOKIE)
+static ssize_t pack_read(void *cookie, char *buf, size_t size)
+{
+    return ReadPackStream((PackStream *)cookie, buf, (size < 0x7fffffff)? (unsigned int)size : 0x7fffffff);
+}
+
+static ssize_t pack_write(void *cookie, const char *buf, size_t size)
+{
+    TraceLog(LOG_ERROR, "Can't provide write access to packed files");
+
+    return -1;
+}
+
+static int pack_seek(void *cookie, off64_t *offset, int whence)
+{
+    long long position = SeekPackStream((PackStream *)cookie, (long long)*offset, whence);
+
+    if (position < 0) return -1;
+
+    *offset = (off64_t)position;
+
+    return 0;
+}
+#endif
+
+// Open read-only stream on packed file data, buffer (if not NULL) is owned by stream
+// NOTE: Packed file data is read in place if platform supports custom streams, otherwise it is copied to a temporary file
+static FILE *OpenPackStream(const unsigned char *data, unsigned int size, unsigned char *buffer)
+{
+    FILE *file = NULL;
+
+#if defined(PACK_STREAM_FUNOPEN) || defined(PACK_STREAM_FOPENCOOKIE)
+    PackStream *stream = (PackStream *)RL_MALLOC(sizeof(PackStream));
+    stream->data = data;
+    stream->size = size;
+    stream->position = 0;
+    stream->buffer = buffer;
+
+    #if defined(PACK_STREAM_FUNOPEN)
+    file = funopen(stream, pack_read, pack_write, pack_seek, pack_close);
+    #else
+    cookie_io_functions_t functions = { pack_read, pack_write, pack_seek, pack_close };
+    file = fopencookie(stream, "rb", functions);
+    #endif
+
+    if (file == NULL) pack_close(stream);
+#else
+    file = tmpfile();
+
+    if (file != NULL)
+    {
+        if (fwrite(data, 1, size, file) == size) rewind(file);
+        else { fclose(file); file = NULL; }
+    }
+
+    RL_FREE(buffer);
+#endif
+
+    return file;
+}
+#endif  // SUPPORT_PACK_FILES
+
+#if defined(PLATFORM_ANDROID)
+static int android_read(void *cookie, char *buf, int size)
+{
+    return AAsset_read((AAsset *)cookie, buf, size);
+}
+
+static int android_write(void *cookie, const char *buf, int size)
+{
+    TraceLog(LOG_ERROR, "Can't provide write access to the APK");
+
+    return EACCES;
+}
+
+static fpos_t android_seek(void *cookie, fpos_t offset, int whence)
+{
+    return AAsset_seek((AAsset *)cookie, offset, whence);
+}
+
+static int android_close(void *cookie)
+{
+    AAsset_close((AAsset *)cookie);
+    return 0;
+}
+#endif  // PLATFORM_ANDROID
+
+#if defined(PLATFORM_UWP)
+UWPMessage *CreateUWPMessage(void)
+{
+    UWPMessage *msg = (UWPMessage *)RL_MALLOC(sizeof(UWPMessage));
+    msg->type = UWP_MSG_NONE;
+    Vector2 v0 = { 0, 0 };
+    msg->paramVector0 = v0;
+    msg->paramInt0 = 0;
+    msg->paramInt1 = 0;
+    msg->paramChar0 = 0;
+    msg->paramFloat0 = 0;
+    msg->paramDouble0 = 0;
+    msg->paramBool0 = false;
+    return msg;
+}
+
+void DeleteUWPMessage(UWPMessage *msg)
+{
+    RL_FREE(msg);
+}
+
+bool UWPHasMessages(void)
+{
+    return (UWPOutMessageId > -1);
+}
+
+UWPMessage *UWPGetMessage(void)
+{
+    if (UWPHasMessages()) return UWPOutMessages[UWPOutMessageId--];
+
+    return NULL;
+}
+
+void UWPSendMessage(UWPMessage *msg)
+{
+    if ((UWPInMessageId + 1) < MAX_UWP_MESSAGES)
+    {
+        UWPInMessageId++;
+        UWPInMessages[UWPInMessageId] = msg;
+    }
+    else TraceLog(LOG_WARNING, "[UWP Messaging] Not enough array space to register new UWP inbound Message.");
+}
+
+void SendMessageToUWP(UWPMessage *msg)
+{
+    if ((UWPOutMessageId + 1) < MAX_UWP_MESSAGES)
+    {
+        UWPOutMessageId++;
+        UWPOutMessages[UWPOutMessageId] = msg;
+    }
+    else TraceLog(LOG_WARNING, "[UWP Messaging] Not enough array space to register new UWP outward Message.");
+}
+
+bool HasMessageFromUWP(void)
+{
+    return UWPInMessageId > -1;
+}
+
+UWPMessage *GetMessageFromUWP(void)
+{
+    if (HasMessageFromUWP()) return UWPInMessages[UWPInMessageId--];
+
+    return NULL;
+}
+#endif  // PLATFORM_UWP
+
+// Write LZ4 sequence (literals and match), returns output size or -1 if dstCapacity is not enough
+// NOTE: Sequence with matchLength 0 is the last sequence (only literals)
+static int WriteLZ4Sequence(unsigned char *dst, int dstCapacity, int op, const unsigned char *literals, int literalCount, int offset, int matchLength)
+{
+    int matchExtra = (matchLength > 0)? matchLength - 4 : 0;
+    int needed = 1 + literalCount/255 + 1 + literalCount + ((matchLength > 0)? 2 + matchExtra/255 + 1 : 0);
+
+    if ((op + needed) > dstCapacity) return -1;
+
+    unsigned char *token = &dst[op++];
+    *token = (unsigned char)(((literalCount >= 15)? 15 : literalCount) << 4);
+
+    if (literalCount >= 15)
+    {
+        int value = literalCount - 15;
+        for (; value >= 255; value -= 255) dst[op++] = 255;
+        dst[op++] = (unsigned char)value;
+    }
+
+    memcpy(dst + op, literals, literalCount);
+    op += literalCount;
+
+    if (matchLength > 0)
+    {
+        dst[op++] = (unsigned char)(offset & 0xff);
+        dst[op++] = (unsigned char)(offset >> 8);
+
+        *token |= (unsigned char)((matchExtra >= 15)? 15 : matchExtra);
+
+        if (matchExtra >= 15)
+        {
+            int value = matchExtra - 15;
+            for (; value >= 255; value -= 255) dst[op++] = 255;
+            dst[op++] = (unsigned char)value;
+        }
+    }
+
+    return op;
+}
+
+#if defined(WORKER_THREADS_AVAILABLE)
+// Start worker threads, by default one per core (excluding calling thread)
+// NOTE: Jobs can be submitted from any thread, initialization is guarded and checked again once locked
+static void InitWorkerThreads(void)
+{
+    pthread_mutex_lock(&workerPool.initMutex);
+
+    if (workerPool.threadCount > 0)
+    {
+        pthread_mutex_unlock(&workerPool.initMutex);
+        return;
+    }
+
+    int count = workerPool.requestedCount;
+
+    if (count < 0)
+    {
+        long cores = sysconf(_SC_NPROCESSORS_ONLN);
+        count = (cores > 1)? (int)cores - 1 : 0;
+        if (count > MAX_WORKER_THREADS) count = MAX_WORKER_THREADS;
+    }
+
+    if (count == 0)
+    {
+        pthread_mutex_unlock(&workerPool.initMutex);
+        return;
+    }
+
+    pthread_mutex_init(&workerPool.mutex, NULL);
+    pthread_cond_init(&workerPool.jobAvailable, NULL);
+    pthread_cond_init(&workerPool.jobDone, NULL);
+
+    workerPool.jobsHead = 0;
+    workerPool.jobsCount = 0;
+    workerPool.quit = false;
+
+    // NOTE: Thread count is published once all threads are created, other threads check it unlocked
+    int created = 0;
+    for (int i = 0; i < count; i++)
+    {
+        if (pthread_create(&workerPool.threads[created], NULL, WorkerThread, NULL) == 0) created++;
+        else TraceLog(LOG_WARNING, "Worker thread could not be created");
+    }
+
+    if (created > 0)
+    {
+        __sync_synchronize();
+        workerPool.threadCount = created;
+        TraceLog(LOG_INFO, "Worker threads initialized successfully (%i)", created);
+    }
+    else
+    {
+        pthread_cond_destroy(&workerPool.jobDone);
+        pthread_cond_destroy(&workerPool.jobAvailable);
+        pthread_mutex_destroy(&workerPool.mutex);
+    }
+
+    pthread_mutex_unlock(&workerPool.initMutex);
+}
+
+// Worker thread loop, runs queued jobs until quit is requested and queue is empty
+static void *WorkerThread(void *arg)
+{
+    pthread_mutex_lock(&workerPool.mutex);
+
+    while (true)
+    {
+        if (RunNextWorkerJob()) continue;
+        if (workerPool.quit) break;
+
+        pthread_cond_wait(&workerPool.jobAvailable, &workerPool.mutex);
+    }
+
+    pthread_mutex_unlock(&workerPool.mutex);
+
+    return NULL;
+}
+
+// Run next queued job, mutex must be locked (it is unlocked while job runs)
+static bool RunNextWorkerJob(void)
+{
+    if (workerPool.jobsCount == 0) return false;
+
+    WorkerJob job = workerPool.jobs[workerPool.jobsHead];
+    workerPool.jobsHead = (workerPool.jobsHead + 1)%MAX_WORKER_JOBS;
+    workerPool.jobsCount--;
+
+    pthread_mutex_unlock(&workerPool.mutex);
+    job.func(job.data);
+    pthread_mutex_lock(&workerPool.mutex);
+
+    if (job.pending != NULL) (*job.pending)--;
+    pthread_cond_broadcast(&workerPool.jobDone);
+
+    return true;
+}
+#endif
+
+// Run parallel for chunks until none left, runs on worker threads and calling thread
+static void ParallelForJobRun(void *data)
+{
+    ParallelForJob *job = (ParallelForJob *)data;
+
+    while (true)
+    {
+        int chunk = JOB_ATOMIC_FETCH_ADD(&job->nextChunk, 1);
+        if (chunk >= job->chunkCount) break;
+
+        int start = chunk*job->chunkSize;
+        int end = start + job->chunkSize;
+        if (end > job->count) end = job->count;
+
+        job->func(job->data, start, end);
+    }
+}
+
+// Read file data, runs on worker thread (request delivered on main thread)
+static void LoadFileDataJob(void *data)
+{
+    AsyncFileRequest *request = (AsyncFileRequest *)data;
+    FILE *file = fopen(request->fileName, "rb");
+
+    if (file != NULL)
+    {
+        fseek(file, 0, SEEK_END);
+        long size = ftell(file);
+        fseek(file, 0, SEEK_SET);
+
+        if (size > 0)
+        {
+            request->data = (unsigned char *)RL_MALLOC(size);
+
+            if (fread(request->data, 1, size, file) == (size_t)size) request->bytesRead = (unsigned int)size;
+            else { RL_FREE(request->data); request->data = NULL; }
+        }
+
+        fclose(file);
+    }
+
+    if (request->data == NULL) TraceLog(LOG_WARNING, "[%s] File could not be read asynchronously", request->fileName);
+}
+
+// Get file watch by id, NULL if not found
+static FileWatch *GetFileWatch(int id)
+{
+    if (id <= 0) return NULL;
+
+    for (int i = 0; i < fileWatchesCount; i++) if (fileWatches[i].id == id) return &fileWatches[i];
+
+    return NULL;
+}
+
+// Register file change, queued (repeated changes not read yet are queued once) or flagged for internal watches
+// NOTE: Name is the changed entry name for directory watches, file path is built from watch path
+static void PushFileChange(FileWatch *watch, int type, const char *name)
+{
+    if (watch->internal)
+    {
+        watch->changed = true;
+        return;
+    }
+
+    char *fileName = NULL;
+
+    if ((watch->name == NULL) && (name != NULL))
+    {
+        fileName = (char *)RL_MALLOC(strlen(watch->path) + strlen(name) + 2);
+        sprintf(fileName, "%s/%s", watch->path, name);
+    }
+    else
+    {
+        fileName = (char *)RL_MALLOC(strlen(watch->path) + 1);
+        strcpy(fileName, watch->path);
+    }
+
+    for (int i = 0; i < fileChangesCount; i++)
+    {
+        FileChange *change = &fileChanges[(fileChangesHead + i)%MAX_FILE_CHANGE_EVENTS];
+
+        if ((change->watch == watch->id) && (change->type == type) && (strcmp(change->fileName, fileName) == 0))
+        {
+            RL_FREE(fileName);
+            return;
+        }
+    }
+
+    if (fileChangesCount == MAX_FILE_CHANGE_EVENTS)
+    {
+        TraceLog(LOG_WARNING, "File changes queue is full, change discarded: %s", fileName);
+        RL_FREE(fileName);
+        return;
+    }
+
+    FileChange *change = &fileChanges[(fileChangesHead + fileChangesCount)%MAX_FILE_CHANGE_EVENTS];
+    change->watch = watch->id;
+    change->type = type;
+    change->fileName = fileName;
+    fileChangesCount++;
+}
+
+#if defined(SUPPORT_PROFILER)
+// Get calling thread profile zones, thread is registered on first call
+// NOTE: Returns NULL if MAX_PROFILE_THREADS threads are already registered (thread is not registered again),
+// threads slots are kept until CloseProfiler(), short-lived threads should not record zones
+static ProfileThread *GetProfileThread(void)
+{
+    if (profileThreadGeneration == profileGeneration) return profileThread;
+
+    int generation = profileGeneration;
+    profileThread = NULL;
+    profileThreadGeneration = generation;
+
+    int id = PROFILER_ATOMIC_INC(&profileThreadsCount) - 1;
+
+    if (id >= MAX_PROFILE_THREADS)
+    {
+        TraceLog(LOG_WARNING, "Profiler: Thread zones not recorded, MAX_PROFILE_THREADS reached");
+        return NULL;
+    }
+
+    ProfileThread *thread = (ProfileThread *)RL_CALLOC(1, sizeof(ProfileThread));
+
+    if (thread != NULL)
+    {
+        thread->id = id;
+        profileThreads[id] = thread;
+    }
+
+    profileThread = thread;
+
+    return thread;
+}
+
+// Compare profile zones statistics, sorted by thread and first call start time
+static int CompareProfileZones(const void *a, const void *b)
+{
+    const ProfileZoneStats *zoneA = (const ProfileZoneStats *)a;
+    const ProfileZoneStats *zoneB = (const ProfileZoneStats *)b;
+
+    if (zoneA->thread != zoneB->thread) return zoneA->thread - zoneB->thread;
+    if (zoneA->start != zoneB->start) return (zoneA->start < zoneB->start)? -1 : 1;
+
+    return zoneA->depth - zoneB->depth;
+}
+#endif
+
+#if defined(TRACELOG_ASYNC_AVAILABLE)
+// Write formatted trace log message (callback, logcat or standard output)
+static void WriteTraceLogMessage(int logType, const char *message)
+{
+    if (logCallback)
+    {
+        CallTraceLogCallback(logType, "%s", message);
+        return;
+    }
+
+#if defined(PLATFORM_ANDROID)
+    switch (logType)
+    {
+        case LOG_TRACE: __android_log_write(ANDROID_LOG_VERBOSE, "raylib", message); break;
+        case LOG_DEBUG: __android_log_write(ANDROID_LOG_DEBUG, "raylib", message); break;
+        case LOG_INFO: __android_log_write(ANDROID_LOG_INFO, "raylib", message); break;
+        case LOG_WARNING: __android_log_write(ANDROID_LOG_WARN, "raylib", message); break;
+        case LOG_ERROR: __android_log_write(ANDROID_LOG_ERROR, "raylib", message); break;
+        case LOG_FATAL: __android_log_write(ANDROID_LOG_FATAL, "raylib", message); break;
+        default: break;
+    }
+#else
+    const char *prefix = "";
+
+    switch (logType)
+    {
+        case LOG_TRACE: prefix = "TRACE: "; break;
+        case LOG_DEBUG: prefix = "DEBUG: "; break;
+        case LOG_INFO: prefix = "INFO: "; break;
+        case LOG_WARNING: prefix = "WARNING: "; break;
+        case LOG_ERROR: prefix = "ERROR: "; break;
+        case LOG_FATAL: prefix = "FATAL: "; break;
+        default: break;
+    }
+
+    printf("%s%s\n", prefix, message);
+#endif
+}
+
+// Call trace log callback with variable arguments (callback expects a va_list)
+static void CallTraceLogCallback(int logType, const char *text, ...)
+{
+    va_list args;
+    va_start(args, text);
+    logCallback(logType, text, args);
+    va_end(args);
+}
+
+// Check message format rate limit, message is counted on its call site (format string pointer)
+// NOTE: Sites are found without locks, if sites table is full messages are not limited
+static bool IsTraceLogRateLimited(const char *format)
+{
+    unsigned int second = (unsigned int)time(NULL);
+    unsigned int index = (unsigned int)(((size_t)format >> 3)%MAX_TRACELOG_SITES);
+
+    for (int i = 0; i < 8; i++)
+    {
+        TraceLogSite *site = &traceLogAsync.sites[(index + i)%MAX_TRACELOG_SITES];
+
+        if ((site->format != format) && !__sync_bool_compare_and_swap(&site->format, NULL, format) && (site->format != format)) continue;
+
+        // NOTE: Concurrent window changes could let a few more messages through, limit is approximate
+        if (site->second != second)
+        {
+            site->second = second;
+            site->count = 0;
+        }
+
+        if (__sync_add_and_fetch(&site->count, 1) > TRACELOG_RATE_LIMIT)
+        {
+            __sync_add_and_fetch(&traceLogAsync.limited, 1);
+            return true;
+        }
+
+        return false;
+    }
+
+    return false;
+}
+
+// Format message and queue it for logger thread, message is dropped if queue is full
+// NOTE: Multiple producers reserve slots with a compare-and-swap on queue head (bounded lock-free queue)
+static void PushTraceLogMessage(int logType, const char *text, va_list args)
+{
+    // NOTE: Only warnings and errors are rate limited, loading messages are expected in bursts
+    if ((logType >= LOG_WARNING) && IsTraceLogRateLimited(text)) return;
+
+    TraceLogMessage *message = NULL;
+    unsigned int position = traceLogAsync.head;
+
+    while (true)
+    {
+        message = &traceLogAsync.queue[position%MAX_TRACELOG_QUEUE];
+        int diff = (int)(message->sequence - position);
+
+        if (diff == 0)
+        {
+            if (__sync_bool_compare_and_swap(&traceLogAsync.head, position, position + 1)) break;
+        }
+        else if (diff < 0)
+        {
+            __sync_add_and_fetch(&traceLogAsync.dropped, 1);
+            return;
+        }
+
+        position = traceLogAsync.head;
+    }
+
+    message->logType = logType;
+    vsnprintf(message->text, MAX_TRACELOG_MSG_LENGTH, text, args);
+
+    // Message data must be visible before slot is published
+    __sync_synchronize();
+    message->sequence = position + 1;
+
+    pthread_cond_signal(&traceLogAsync.messageAvailable);
+}
+
+// Logger thread loop, writes queued messages, repeated messages are merged
+// NOTE: Producers signal without locking, a missed signal delays writing up to wait timeout
+static void *TraceLogThread(void *arg)
+{
+    char lastText[MAX_TRACELOG_MSG_LENGTH] = { 0 };
+    char report[MAX_TRACELOG_MSG_LENGTH] = { 0 };
+    int lastType = -1;
+    int repeated = 0;
+    time_t repeatedTime = 0;
+
+    while (true)
+    {
+        TraceLogMessage *message = &traceLogAsync.queue[traceLogAsync.tail%MAX_TRACELOG_QUEUE];
+
+        if ((int)(message->sequence - (traceLogAsync.tail + 1)) == 0)
+        {
+            __sync_synchronize();
+
+            if ((message->logType == lastType) && (strcmp(message->text, lastText) == 0))
+            {
+                if (repeated == 0) repeatedTime = time(NULL);
+                repeated++;
+            }
+            else
+            {
+                if (repeated > 0)
+                {
+                    snprintf(report, MAX_TRACELOG_MSG_LENGTH, "Previous message repeated %i times", repeated);
+                    WriteTraceLogMessage(lastType, report);
+                    repeated = 0;
+                }
+
+                WriteTraceLogMessage(message->logType, message->text);
+
+                lastType = message->logType;
+                strcpy(lastText, message->text);
+            }
+
+            // Slot is free once message is copied, producers can write it on next queue loop
+            __sync_synchronize();
+            message->sequence = traceLogAsync.tail + MAX_TRACELOG_QUEUE;
+            traceLogAsync.tail++;
+        }
+        else
+        {
+            // Queue empty: report merged, dropped and rate limited messages before waiting
+            if ((repeated > 0) && (traceLogAsync.quit || (time(NULL) != repeatedTime)))
+            {
+                snprintf(report, MAX_TRACELOG_MSG_LENGTH, "Previous message repeated %i times", repeated);
+                WriteTraceLogMessage(lastType, report);
+                repeated = 0;
+            }
+
+            int dropped = __sync_fetch_and_and(&traceLogAsync.dropped, 0);
+            int limited = __sync_fetch_and_and(&traceLogAsync.limited, 0);
+
+            if (dropped > 0)
+            {
+                snprintf(report, MAX_TRACELOG_MSG_LENGTH, "TRACELOG: %i messages dropped, queue full", dropped);
+                WriteTraceLogMessage(LOG_WARNING, report);
+            }
+
+            if (limited > 0)
+            {
+                snprintf(report, MAX_TRACELOG_MSG_LENGTH, "TRACELOG: %i messages rate limited", limited);
+                WriteTraceLogMessage(LOG_WARNING, report);
+            }
+
+            if (traceLogAsync.quit) break;
+
+            fflush(stdout);
+
+            struct timespec timeout = { 0 };
+            clock_gettime(CLOCK_REALTIME, &timeout);
+            timeout.tv_nsec += 100*1000000;
+            if (timeout.tv_nsec >= 1000000000) { timeout.tv_sec++; timeout.tv_nsec -= 1000000000; }
+
+            pthread_mutex_lock(&traceLogAsync.mutex);
+            if (!traceLogAsync.quit) pthread_cond_timedwait(&traceLogAsync.messageAvailable, &traceLogAsync.mutex, &timeout);
+            pthread_mutex_unlock(&traceLogAsync.mutex);
+        }
+    }
+
+    fflush(stdout);
+
+    return NULL;
+}
+
+// Stop logger thread on program exit, queued messages are written
+static void CloseTraceLogAsync(void)
+{
+    SetTraceLogAsync(false);
+}
+#endif
@@ -35,7 +35,10 @@
 //----------------------------------------------------------------------------------
 // Some basic Defines
 //----------------------------------------------------------------------------------
-#if defined(PLATFORM_ANDROID)
+#if defined(SUPPORT_PACK_FILES)
+    #include <stdio.h>                      // Required for: FILE, fopen() declared before being replaced
+    #define fopen(name, mode) pack_fopen(name, mode)
+#elif defined(PLATFORM_ANDROID)
     #define fopen(name, mode) android_fopen(name, mode)
 #endif
 
@@ -46,6 +49,20 @@
 extern "C" {            // Prevents name mangling of functions
 #endif
 
+// Worker job function, runs on a worker thread (or calling thread if not available)
+typedef void (*WorkerJobFunc)(void *data);
+
+// Cached asset types
+typedef enum {
+    ASSET_TEXTURE = 0,
+    ASSET_FONT,
+    ASSET_MODEL,
+    ASSET_SHADER
+} AssetType;
+
+// Cached asset reload function, reloads asset data in place from files (hot reload)
+typedef bool (*AssetReloadFunc)(void *asset, const char *fileName, const char *fileName2);
+
 //----------------------------------------------------------------------------------
 // Global Variables Definition
 //----------------------------------------------------------------------------------
@@ -59,6 +76,60 @@ void InitAssetManager(AAssetManager *manager);  // Initialize asset manager from
 FILE *android_fopen(const char *fileName, const char *mode);    // Replacement for fopen()
 #endif
 
+// Memory usage (allocations tracked by subsystem)
+// NOTE: GetMemoryStats() is declared in raylib.h, it adds GPU memory usage from rlgl
+void GetMemoryUsage(MemoryUsage *heap, MemoryUsage *tags);  // Get CPU memory usage, total and by subsystem (MAX_MEMORY_TAGS)
+
+// Scratch memory (temporary allocations on arena)
+// NOTE: SetMemoryAllocator(), MemAlloc*() and MemFree() are declared in raylib.h
+void InitScratchMemory(void);                   // Create scratch memory arena, calling thread owns it (on InitWindow())
+void *PushScratchMemory(unsigned int size);     // Allocate temporary memory for current call (any thread, arena used on owner thread)
+void PopScratchMemory(void *ptr);               // Release temporary memory, in reverse allocation order
+void ResetScratchMemory(void);                  // Release frame scratch allocations (on EndDrawing())
+void CloseScratchMemory(void);                  // Release scratch memory arena (on CloseWindow())
+
+// Worker threads (internal jobs)
+// NOTE: SetWorkerThreads() is declared in raylib.h
+void SubmitWorkerJob(WorkerJobFunc func, void *data, int *pending); // Submit job to worker threads (pending counter optional)
+int GetWorkerJobsPending(int *pending);         // Get number of submitted jobs not finished yet
+void WaitWorkerJobs(int *pending);              // Wait for submitted jobs to finish (calling thread helps)
+void CloseWorkerThreads(void);                  // Stop worker threads (on CloseWindow())
+
+// Asynchronous file loading
+// NOTE: LoadFileDataAsync() is declared in raylib.h
+void UpdateFileDataAsync(void);                 // Deliver files data loaded asynchronously to callbacks (on PollInputEvents())
+
+// Assets cache (shared assets loaded from files, reference counted)
+// NOTE: SetAssetsHotReload() is declared in raylib.h
+void *AcquireCachedAsset(int type, const char *fileName, const char *fileName2);    // Get cached asset (reference added), NULL if not cached or files modified
+void *AddCachedAsset(int type, const char *fileName, const char *fileName2, const void *asset, int size, unsigned long long handle, AssetReloadFunc reload);  // Add loaded asset to cache (one reference)
+int ReleaseCachedAsset(int type, unsigned long long handle, void *asset, int size); // Release cached asset reference (1: last reference, asset must be unloaded)
+void UpdateCachedAssets(void);                  // Check cached assets files changes (hot reload, on EndDrawing())
+
+// File watches
+// NOTE: WatchFile(), UnwatchFile() and GetFileChangeEvent() are declared in raylib.h
+int AddFileWatch(const char *path, bool internal);  // Add file or directory watch (internal watches changes are not queued)
+bool IsFileWatchChanged(int watch);             // Check if watched file changed since last check (internal watches)
+void UpdateFileWatches(void);                   // Read watched files changes (on PollInputEvents())
+void CloseFileWatches(void);                    // Stop watching all files (on CloseWindow())
+
+// Profiler
+// NOTE: BeginProfileZone(), EndProfileZone() and GetProfileZones() are declared in raylib.h
+void UpdateProfiler(void);                      // Collect profile zones ended since last call into frame statistics (on EndDrawing())
+void CloseProfiler(void);                       // Release recorded profile zones (on CloseWindow())
+
+// LZ4 compression (block format, no frame)
+int CompressLZ4(const unsigned char *src, int srcSize, unsigned char *dst, int dstCapacity);  // Compress data, returns compressed size (0 if dstCapacity is not enough)
+int DecompressLZ4(const unsigned char *src, int srcSize, unsigned char *dst, int dstSize);    // Decompress data, returns decompressed size (-1 on malformed data)
+
+#if defined(SUPPORT_PACK_FILES)
+// Pack files (read-only virtual filesystem)
+// NOTE: MountPackFile() and UnmountPackFile() are declared in raylib.h
+FILE *pack_fopen(const char *fileName, const char *mode);   // Replacement for fopen, reads mounted packs first
+bool IsPackedFile(const char *fileName);                    // Check if file is available in a mounted pack
+const unsigned char *GetPackedFileData(const char *fileName, unsigned int *size);   // Get packed file data (zero-copy), NULL if not packed or compressed
+#endif
+
 #if defined(PLATFORM_UWP)
 // UWP Messages System
 typedef enum {